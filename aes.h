@@ -0,0 +1,322 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__AES_H)
+#  if !defined(SIMDE__AES_H)
+#    define SIMDE__AES_H
+#  endif
+#  include "ssse3.h"
+
+#  if defined(SIMDE_AES_NATIVE)
+#    undef SIMDE_AES_NATIVE
+#  endif
+#  if defined(SIMDE_AES_FORCE_NATIVE)
+#    define SIMDE_AES_NATIVE
+#  elif defined(__AES__) && !defined(SIMDE_AES_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AES_NATIVE
+#  endif
+
+#  if defined(SIMDE_AES_NATIVE) && !defined(SIMDE_SSE2_NATIVE)
+#    if defined(SIMDE_AES_FORCE_NATIVE)
+#      error Native AES support requires native SSE2 support
+#    else
+#      warning Native AES support requires native SSE2 support, disabling
+#      undef SIMDE_AES_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_AES_NATIVE)
+#    include <wmmintrin.h>
+#  endif
+
+#  include <stdint.h>
+
+SIMDE__BEGIN_DECLS
+
+/* The portable implementation never indexes memory with key or data
+   dependent values, so it runs in constant time.  SubBytes is computed
+   on bit planes (bit i of plane b is bit b of byte i) with the
+   Boyar-Peralta circuit, which only needs AND and XOR; ShiftRows is a
+   fixed byte shuffle, and MixColumns is built from SSE2 operations on
+   the whole block. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_aes_transpose8x8 (uint64_t x) {
+  uint64_t t;
+
+  t = (x ^ (x >>  7)) & UINT64_C(0x00AA00AA00AA00AA);
+  x = x ^ t ^ (t <<  7);
+  t = (x ^ (x >> 14)) & UINT64_C(0x0000CCCC0000CCCC);
+  x = x ^ t ^ (t << 14);
+  t = (x ^ (x >> 28)) & UINT64_C(0x00000000F0F0F0F0);
+  x = x ^ t ^ (t << 28);
+
+  return x;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_x_aes_bitslice (uint32_t q[8], simde__m128i a) {
+  const uint64_t lo = simde_x_aes_transpose8x8(a.u64[0]);
+  const uint64_t hi = simde_x_aes_transpose8x8(a.u64[1]);
+
+  for (size_t b = 0 ; b < 8 ; b++) {
+    q[b] =
+      ((uint32_t) ((lo >> (b * 8)) & 0xff)) |
+      ((uint32_t) ((hi >> (b * 8)) & 0xff) << 8);
+  }
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_unbitslice (const uint32_t q[8]) {
+  simde__m128i r;
+  uint64_t lo = 0, hi = 0;
+
+  for (size_t b = 0 ; b < 8 ; b++) {
+    lo |= ((uint64_t) (q[b]        & 0xff)) << (b * 8);
+    hi |= ((uint64_t) ((q[b] >> 8) & 0xff)) << (b * 8);
+  }
+  r.u64[0] = simde_x_aes_transpose8x8(lo);
+  r.u64[1] = simde_x_aes_transpose8x8(hi);
+
+  return r;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_x_aes_sbox_planes (uint32_t q[8]) {
+  uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+  uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19, y20, y21;
+  uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11, z12, z13, z14, z15, z16, z17;
+  uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+  uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29, t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+  uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49, t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+  uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+  x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+  x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+  /* Top linear transformation. */
+  y14 = x3 ^ x5;  y13 = x0 ^ x6;  y9  = x0 ^ x3;  y8  = x0 ^ x5;
+  t0  = x1 ^ x2;  y1  = t0 ^ x7;  y4  = y1 ^ x3;  y12 = y13 ^ y14;
+  y2  = y1 ^ x0;  y5  = y1 ^ x6;  y3  = y5 ^ y8;  t1  = x4 ^ y12;
+  y15 = t1 ^ x5;  y20 = t1 ^ x1;  y6  = y15 ^ x7; y10 = y15 ^ t0;
+  y11 = y20 ^ y9; y7  = x7 ^ y11; y17 = y10 ^ y11; y19 = y10 ^ y8;
+  y16 = t0 ^ y11; y21 = y13 ^ y16; y18 = x0 ^ y16;
+
+  /* Non-linear section (inversion in GF(2^8)). */
+  t2  = y12 & y15; t3  = y3 & y6;   t4  = t3 ^ t2;   t5  = y4 & x7;
+  t6  = t5 ^ t2;   t7  = y13 & y16; t8  = y5 & y1;   t9  = t8 ^ t7;
+  t10 = y2 & y7;   t11 = t10 ^ t7;  t12 = y9 & y11;  t13 = y14 & y17;
+  t14 = t13 ^ t12; t15 = y8 & y10;  t16 = t15 ^ t12; t17 = t4 ^ t14;
+  t18 = t6 ^ t16;  t19 = t9 ^ t14;  t20 = t11 ^ t16; t21 = t17 ^ y20;
+  t22 = t18 ^ y19; t23 = t19 ^ y21; t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22; t26 = t21 & t23; t27 = t24 ^ t26; t28 = t25 & t27;
+  t29 = t28 ^ t22; t30 = t23 ^ t24; t31 = t22 ^ t26; t32 = t31 & t30;
+  t33 = t32 ^ t24; t34 = t23 ^ t33; t35 = t27 ^ t33; t36 = t24 & t35;
+  t37 = t36 ^ t34; t38 = t27 ^ t36; t39 = t29 & t38; t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37; t42 = t29 ^ t33; t43 = t29 ^ t40; t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0  = t44 & y15; z1  = t37 & y6;  z2  = t33 & x7;  z3  = t43 & y16;
+  z4  = t40 & y1;  z5  = t29 & y7;  z6  = t42 & y11; z7  = t45 & y17;
+  z8  = t41 & y10; z9  = t44 & y12; z10 = t37 & y3;  z11 = t33 & y4;
+  z12 = t43 & y13; z13 = t40 & y5;  z14 = t29 & y2;  z15 = t42 & y9;
+  z16 = t45 & y14; z17 = t41 & y8;
+
+  /* Bottom linear transformation. */
+  t46 = z15 ^ z16; t47 = z10 ^ z11; t48 = z5 ^ z13;  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;  t51 = z2 ^ z5;   t52 = z7 ^ z8;   t53 = z0 ^ z3;
+  t54 = z6 ^ z7;   t55 = z16 ^ z17; t56 = z12 ^ t48; t57 = t50 ^ t53;
+  t58 = z4 ^ t46;  t59 = z3 ^ t54;  t60 = t46 ^ t57; t61 = z14 ^ t57;
+  t62 = t52 ^ t58; t63 = t49 ^ t58; t64 = z4 ^ t59;  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;  s0  = t59 ^ t63; s6  = t56 ^ ~t62; s7 = t48 ^ ~t60;
+  t67 = t64 ^ t65; s3  = t53 ^ t66; s4  = t51 ^ t66; s5  = t47 ^ t65;
+  s1  = t64 ^ ~s3; s2  = t55 ^ ~t67;
+
+  q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+  q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+
+/* The inverse S-box is the forward one wrapped in the inverse of the
+   affine transformation. */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_x_aes_inv_affine_planes (uint32_t q[8]) {
+  const uint32_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3];
+  const uint32_t q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+  q[7] = q1 ^ q4 ^ q6;
+  q[6] = q0 ^ q3 ^ q5;
+  q[5] = q7 ^ q2 ^ q4;
+  q[4] = q6 ^ q1 ^ q3;
+  q[3] = q5 ^ q0 ^ q2;
+  q[2] = q4 ^ q7 ^ q1;
+  q[1] = q3 ^ q6 ^ q0;
+  q[0] = q2 ^ q5 ^ q7;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_sub_bytes (simde__m128i a) {
+  uint32_t q[8];
+
+  simde_x_aes_bitslice(q, a);
+  simde_x_aes_sbox_planes(q);
+  return simde_x_aes_unbitslice(q);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_inv_sub_bytes (simde__m128i a) {
+  uint32_t q[8];
+
+  simde_x_aes_bitslice(q, a);
+  simde_x_aes_inv_affine_planes(q);
+  simde_x_aes_sbox_planes(q);
+  simde_x_aes_inv_affine_planes(q);
+  return simde_x_aes_unbitslice(q);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_shift_rows (simde__m128i a) {
+  return simde_mm_shuffle_epi8(a, simde_mm_set_epi8(11,  6,  1, 12,  7,  2, 13,  8,
+                                                     3, 14,  9,  4, 15, 10,  5,  0));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_inv_shift_rows (simde__m128i a) {
+  return simde_mm_shuffle_epi8(a, simde_mm_set_epi8( 3,  6,  9, 12, 15,  2,  5,  8,
+                                                    11, 14,  1,  4,  7, 10, 13,  0));
+}
+
+/* Multiplication of each byte by x in GF(2^8). */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_xtime (simde__m128i a) {
+  const simde__m128i carry = simde_mm_cmplt_epi8(a, simde_mm_setzero_si128());
+  return simde_mm_xor_si128(simde_mm_add_epi8(a, a),
+                            simde_mm_and_si128(carry, simde_mm_set1_epi8(0x1b)));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_mix_columns (simde__m128i a) {
+  /* Rotate each column by one, two and three rows. */
+  const simde__m128i r8  = simde_mm_or_si128(simde_mm_srli_epi32(a,  8), simde_mm_slli_epi32(a, 24));
+  const simde__m128i r16 = simde_mm_or_si128(simde_mm_srli_epi32(a, 16), simde_mm_slli_epi32(a, 16));
+  const simde__m128i r24 = simde_mm_or_si128(simde_mm_srli_epi32(a, 24), simde_mm_slli_epi32(a,  8));
+
+  /* {02}·a0 ^ {03}·a1 ^ a2 ^ a3 */
+  return simde_mm_xor_si128(simde_x_aes_xtime(simde_mm_xor_si128(a, r8)),
+                            simde_mm_xor_si128(r8, simde_mm_xor_si128(r16, r24)));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_inv_mix_columns (simde__m128i a) {
+  /* InvMixColumns is MixColumns applied after multiplying each column
+     by {04}x^2 + {05}. */
+  const simde__m128i r16 = simde_mm_or_si128(simde_mm_srli_epi32(a, 16), simde_mm_slli_epi32(a, 16));
+  const simde__m128i t = simde_x_aes_xtime(simde_x_aes_xtime(simde_mm_xor_si128(a, r16)));
+
+  return simde_x_aes_mix_columns(simde_mm_xor_si128(a, t));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesenc_si128 (simde__m128i a, simde__m128i round_key) {
+#if defined(SIMDE_AES_NATIVE)
+  return SIMDE__M128I_C(_mm_aesenc_si128(a.n, round_key.n));
+#else
+  a = simde_x_aes_sub_bytes(simde_x_aes_shift_rows(a));
+  return simde_mm_xor_si128(simde_x_aes_mix_columns(a), round_key);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesenclast_si128 (simde__m128i a, simde__m128i round_key) {
+#if defined(SIMDE_AES_NATIVE)
+  return SIMDE__M128I_C(_mm_aesenclast_si128(a.n, round_key.n));
+#else
+  a = simde_x_aes_sub_bytes(simde_x_aes_shift_rows(a));
+  return simde_mm_xor_si128(a, round_key);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesdec_si128 (simde__m128i a, simde__m128i round_key) {
+#if defined(SIMDE_AES_NATIVE)
+  return SIMDE__M128I_C(_mm_aesdec_si128(a.n, round_key.n));
+#else
+  a = simde_x_aes_inv_sub_bytes(simde_x_aes_inv_shift_rows(a));
+  return simde_mm_xor_si128(simde_x_aes_inv_mix_columns(a), round_key);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesdeclast_si128 (simde__m128i a, simde__m128i round_key) {
+#if defined(SIMDE_AES_NATIVE)
+  return SIMDE__M128I_C(_mm_aesdeclast_si128(a.n, round_key.n));
+#else
+  a = simde_x_aes_inv_sub_bytes(simde_x_aes_inv_shift_rows(a));
+  return simde_mm_xor_si128(a, round_key);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesimc_si128 (simde__m128i a) {
+#if defined(SIMDE_AES_NATIVE)
+  return SIMDE__M128I_C(_mm_aesimc_si128(a.n));
+#else
+  return simde_x_aes_inv_mix_columns(a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aeskeygenassist_si128 (simde__m128i a, const int imm8) {
+  /* SubWord of the second and fourth words, followed by RotWord and
+     the round constant for the upper half of each pair. */
+  const simde__m128i s = simde_x_aes_sub_bytes(a);
+  const simde__m128i r = simde_mm_shuffle_epi8(s, simde_mm_set_epi8(12, 15, 14, 13, 15, 14, 13, 12,
+                                                                     4,  7,  6,  5,  7,  6,  5,  4));
+  return simde_mm_xor_si128(r, simde_mm_set_epi32(imm8 & 0xff, 0, imm8 & 0xff, 0));
+}
+#if defined(SIMDE_AES_NATIVE)
+#  define simde_mm_aeskeygenassist_si128(a, imm8) SIMDE__M128I_C(_mm_aeskeygenassist_si128(a.n, imm8))
+#endif
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__AES_H) */
@@ -0,0 +1,2530 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__AVX_H)
+#  if !defined(SIMDE__AVX_H)
+#    define SIMDE__AVX_H
+#  endif
+#  include "sse4.2.h"
+
+#  if defined(SIMDE_AVX_NATIVE)
+#    undef SIMDE_AVX_NATIVE
+#  endif
+#  if defined(SIMDE_AVX_FORCE_NATIVE)
+#    define SIMDE_AVX_NATIVE
+#  elif defined(__AVX__) && !defined(SIMDE_AVX_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX_NATIVE
+#  endif
+
+#  if defined(SIMDE_AVX_NATIVE) && !defined(SIMDE_SSE4_2_NATIVE)
+#    if defined(SIMDE_AVX_FORCE_NATIVE)
+#      error Native AVX support requires native SSE4.2 support
+#    else
+#      warning Native AVX support requires native SSE4.2 support, disabling
+#      undef SIMDE_AVX_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_AVX_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <stdint.h>
+#  include <limits.h>
+#  include <string.h>
+
+SIMDE__BEGIN_DECLS
+
+/* The 256-bit types can also be accessed as two 128-bit halves (the
+   m128, m128d and m128i members).  When AVX isn't available but SSE
+   is, most functions simply run the 128-bit version on each half. */
+typedef SIMDE__ALIGN(32) union {
+#if defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  int8_t          i8 __attribute__((__vector_size__(32), __may_alias__));
+  int16_t        i16 __attribute__((__vector_size__(32), __may_alias__));
+  int32_t        i32 __attribute__((__vector_size__(32), __may_alias__));
+  int64_t        i64 __attribute__((__vector_size__(32), __may_alias__));
+  uint8_t         u8 __attribute__((__vector_size__(32), __may_alias__));
+  uint16_t       u16 __attribute__((__vector_size__(32), __may_alias__));
+  uint32_t       u32 __attribute__((__vector_size__(32), __may_alias__));
+  uint64_t       u64 __attribute__((__vector_size__(32), __may_alias__));
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128 __attribute__((__vector_size__(32), __may_alias__));
+  simde_uint128 u128 __attribute__((__vector_size__(32), __may_alias__));
+  #endif
+  simde_float32  f32 __attribute__((__vector_size__(32), __may_alias__));
+  simde_float64  f64 __attribute__((__vector_size__(32), __may_alias__));
+#else
+  int8_t         i8[32];
+  int16_t        i16[16];
+  int32_t        i32[8];
+  int64_t        i64[4];
+  uint8_t        u8[32];
+  uint16_t       u16[16];
+  uint32_t       u32[8];
+  uint64_t       u64[4];
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128[2];
+  simde_uint128 u128[2];
+  #endif
+  simde_float32  f32[8];
+  simde_float64  f64[4];
+#endif
+
+  simde__m128    m128[2];
+
+#if defined(SIMDE_AVX_NATIVE)
+  __m256         n;
+#endif
+} simde__m256;
+
+typedef SIMDE__ALIGN(32) union {
+#if defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  int8_t          i8 __attribute__((__vector_size__(32), __may_alias__));
+  int16_t        i16 __attribute__((__vector_size__(32), __may_alias__));
+  int32_t        i32 __attribute__((__vector_size__(32), __may_alias__));
+  int64_t        i64 __attribute__((__vector_size__(32), __may_alias__));
+  uint8_t         u8 __attribute__((__vector_size__(32), __may_alias__));
+  uint16_t       u16 __attribute__((__vector_size__(32), __may_alias__));
+  uint32_t       u32 __attribute__((__vector_size__(32), __may_alias__));
+  uint64_t       u64 __attribute__((__vector_size__(32), __may_alias__));
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128 __attribute__((__vector_size__(32), __may_alias__));
+  simde_uint128 u128 __attribute__((__vector_size__(32), __may_alias__));
+  #endif
+  simde_float32  f32 __attribute__((__vector_size__(32), __may_alias__));
+  simde_float64  f64 __attribute__((__vector_size__(32), __may_alias__));
+#else
+  int8_t         i8[32];
+  int16_t        i16[16];
+  int32_t        i32[8];
+  int64_t        i64[4];
+  uint8_t        u8[32];
+  uint16_t       u16[16];
+  uint32_t       u32[8];
+  uint64_t       u64[4];
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128[2];
+  simde_uint128 u128[2];
+  #endif
+  simde_float32  f32[8];
+  simde_float64  f64[4];
+#endif
+
+  simde__m128d   m128d[2];
+
+#if defined(SIMDE_AVX_NATIVE)
+  __m256d        n;
+#endif
+} simde__m256d;
+
+typedef SIMDE__ALIGN(32) union {
+#if defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  int8_t          i8 __attribute__((__vector_size__(32), __may_alias__));
+  int16_t        i16 __attribute__((__vector_size__(32), __may_alias__));
+  int32_t        i32 __attribute__((__vector_size__(32), __may_alias__));
+  int64_t        i64 __attribute__((__vector_size__(32), __may_alias__));
+  uint8_t         u8 __attribute__((__vector_size__(32), __may_alias__));
+  uint16_t       u16 __attribute__((__vector_size__(32), __may_alias__));
+  uint32_t       u32 __attribute__((__vector_size__(32), __may_alias__));
+  uint64_t       u64 __attribute__((__vector_size__(32), __may_alias__));
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128 __attribute__((__vector_size__(32), __may_alias__));
+  simde_uint128 u128 __attribute__((__vector_size__(32), __may_alias__));
+  #endif
+  simde_float32  f32 __attribute__((__vector_size__(32), __may_alias__));
+  simde_float64  f64 __attribute__((__vector_size__(32), __may_alias__));
+#else
+  int8_t         i8[32];
+  int16_t        i16[16];
+  int32_t        i32[8];
+  int64_t        i64[4];
+  uint8_t        u8[32];
+  uint16_t       u16[16];
+  uint32_t       u32[8];
+  uint64_t       u64[4];
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128[2];
+  simde_uint128 u128[2];
+  #endif
+  simde_float32  f32[8];
+  simde_float64  f64[4];
+#endif
+
+  simde__m128i   m128i[2];
+
+#if defined(SIMDE_AVX_NATIVE)
+  __m256i        n;
+#endif
+} simde__m256i;
+
+#if defined(SIMDE_AVX_NATIVE)
+HEDLEY_STATIC_ASSERT(sizeof(__m256) == sizeof(simde__m256), "__m256 size doesn't match simde__m256 size");
+HEDLEY_STATIC_ASSERT(sizeof(__m256d) == sizeof(simde__m256d), "__m256d size doesn't match simde__m256d size");
+HEDLEY_STATIC_ASSERT(sizeof(__m256i) == sizeof(simde__m256i), "__m256i size doesn't match simde__m256i size");
+#define SIMDE__M256_C(expr) ((simde__m256) { .n = expr })
+#define SIMDE__M256D_C(expr) ((simde__m256d) { .n = expr })
+#define SIMDE__M256I_C(expr) ((simde__m256i) { .n = expr })
+#endif
+HEDLEY_STATIC_ASSERT(32 == sizeof(simde__m256), "simde__m256 size incorrect");
+HEDLEY_STATIC_ASSERT(32 == sizeof(simde__m256d), "simde__m256d size incorrect");
+HEDLEY_STATIC_ASSERT(32 == sizeof(simde__m256i), "simde__m256i size incorrect");
+
+enum {
+  simde_CMP_EQ_OQ    = 0x00,
+  simde_CMP_LT_OS    = 0x01,
+  simde_CMP_LE_OS    = 0x02,
+  simde_CMP_UNORD_Q  = 0x03,
+  simde_CMP_NEQ_UQ   = 0x04,
+  simde_CMP_NLT_US   = 0x05,
+  simde_CMP_NLE_US   = 0x06,
+  simde_CMP_ORD_Q    = 0x07,
+  simde_CMP_EQ_UQ    = 0x08,
+  simde_CMP_NGE_US   = 0x09,
+  simde_CMP_NGT_US   = 0x0a,
+  simde_CMP_FALSE_OQ = 0x0b,
+  simde_CMP_NEQ_OQ   = 0x0c,
+  simde_CMP_GE_OS    = 0x0d,
+  simde_CMP_GT_OS    = 0x0e,
+  simde_CMP_TRUE_UQ  = 0x0f,
+  simde_CMP_EQ_OS    = 0x10,
+  simde_CMP_LT_OQ    = 0x11,
+  simde_CMP_LE_OQ    = 0x12,
+  simde_CMP_UNORD_S  = 0x13,
+  simde_CMP_NEQ_US   = 0x14,
+  simde_CMP_NLT_UQ   = 0x15,
+  simde_CMP_NLE_UQ   = 0x16,
+  simde_CMP_ORD_S    = 0x17,
+  simde_CMP_EQ_US    = 0x18,
+  simde_CMP_NGE_UQ   = 0x19,
+  simde_CMP_NGT_UQ   = 0x1a,
+  simde_CMP_FALSE_OS = 0x1b,
+  simde_CMP_NEQ_OS   = 0x1c,
+  simde_CMP_GE_OQ    = 0x1d,
+  simde_CMP_GT_OQ    = 0x1e,
+  simde_CMP_TRUE_US  = 0x1f
+};
+
+/* Ignoring whether it signals on QNaN (bit 4), each comparison
+   predicate is true for some subset of the four possible outcomes of
+   comparing two values: less than (bit 0), equal (bit 1), greater than
+   (bit 2) and unordered (bit 3). */
+static const uint8_t simde__cmp_predicates[16] = {
+  0x2, 0x1, 0x3, 0x8, 0xd, 0xe, 0xc, 0x7,
+  0xa, 0x9, 0xb, 0x0, 0x5, 0x6, 0x4, 0xf
+};
+
+#define SIMDE__CMP_OUTCOME(a, b) \
+  ((((a) <  (b)) << 0) | \
+   (((a) == (b)) << 1) | \
+   (((a) >  (b)) << 2) | \
+   ((((a) != (a)) | ((b) != (b))) << 3))
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_add_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_add_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_add_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_add_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] + b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_add_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_add_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_add_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_add_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[i] + b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_addsub_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_addsub_pd(a.n, b.n));
+#elif defined(SIMDE_SSE3_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_addsub_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_addsub_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i += 2) {
+    r.f64[  i  ] = a.f64[  i  ] - b.f64[  i  ];
+    r.f64[i + 1] = a.f64[i + 1] + b.f64[i + 1];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_addsub_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_addsub_ps(a.n, b.n));
+#elif defined(SIMDE_SSE3_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_addsub_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_addsub_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i += 2) {
+    r.f32[  i  ] = a.f32[  i  ] - b.f32[  i  ];
+    r.f32[i + 1] = a.f32[i + 1] + b.f32[i + 1];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_and_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_and_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_and_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_and_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = a.u64[i] & b.u64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_and_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_and_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_and_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_and_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = a.u32[i] & b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_andnot_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_andnot_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_andnot_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_andnot_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = ~a.u64[i] & b.u64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_andnot_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_andnot_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_andnot_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_andnot_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = ~a.u32[i] & b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_blendv_pd (simde__m256d a, simde__m256d b, simde__m256d mask) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_blendv_pd(a.n, b.n, mask.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_blendv_pd(a.m128d[0], b.m128d[0], mask.m128d[0]);
+  r.m128d[1] = simde_mm_blendv_pd(a.m128d[1], b.m128d[1], mask.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    const uint64_t m = (uint64_t) (mask.i64[i] >> 63);
+    r.u64[i] = (a.u64[i] & ~m) | (b.u64[i] & m);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_blendv_ps (simde__m256 a, simde__m256 b, simde__m256 mask) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_blendv_ps(a.n, b.n, mask.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_blendv_ps(a.m128[0], b.m128[0], mask.m128[0]);
+  r.m128[1] = simde_mm_blendv_ps(a.m128[1], b.m128[1], mask.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    const uint32_t m = (uint32_t) (mask.i32[i] >> 31);
+    r.u32[i] = (a.u32[i] & ~m) | (b.u32[i] & m);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_broadcast_pd (simde__m128d const* mem_addr) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_broadcast_pd(&(mem_addr->n)));
+#else
+  simde__m256d r;
+  r.m128d[0] = r.m128d[1] = simde_mm_loadu_pd((simde_float64 const*) mem_addr);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_broadcast_ps (simde__m128 const* mem_addr) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_broadcast_ps(&(mem_addr->n)));
+#else
+  simde__m256 r;
+  r.m128[0] = r.m128[1] = simde_mm_loadu_ps((simde_float32 const*) mem_addr);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_broadcast_sd (simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_broadcast_sd(mem_addr));
+#else
+  simde__m256d r;
+  r.m128d[0] = r.m128d[1] = simde_mm_set1_pd(*mem_addr);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_broadcast_ss (simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128_C(_mm_broadcast_ss(mem_addr));
+#else
+  return simde_mm_set1_ps(*mem_addr);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_broadcast_ss (simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_broadcast_ss(mem_addr));
+#else
+  simde__m256 r;
+  r.m128[0] = r.m128[1] = simde_mm_set1_ps(*mem_addr);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_castpd_ps (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_castpd_ps(a.n));
+#else
+  union {
+    simde__m256d pd;
+    simde__m256 ps;
+  } r = { .pd = a };
+  return r.ps;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_castpd_si256 (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_castpd_si256(a.n));
+#else
+  union {
+    simde__m256d pd;
+    simde__m256i si256;
+  } r = { .pd = a };
+  return r.si256;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_castpd128_pd256 (simde__m128d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_castpd128_pd256(a.n));
+#else
+  simde__m256d r;
+  r.m128d[0] = a;
+  r.m128d[1] = simde_mm_setzero_pd();
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm256_castpd256_pd128 (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128D_C(_mm256_castpd256_pd128(a.n));
+#else
+  return a.m128d[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_castps_pd (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_castps_pd(a.n));
+#else
+  union {
+    simde__m256 ps;
+    simde__m256d pd;
+  } r = { .ps = a };
+  return r.pd;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_castps_si256 (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_castps_si256(a.n));
+#else
+  union {
+    simde__m256 ps;
+    simde__m256i si256;
+  } r = { .ps = a };
+  return r.si256;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_castps128_ps256 (simde__m128 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_castps128_ps256(a.n));
+#else
+  simde__m256 r;
+  r.m128[0] = a;
+  r.m128[1] = simde_mm_setzero_ps();
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_castps256_ps128 (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128_C(_mm256_castps256_ps128(a.n));
+#else
+  return a.m128[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_castsi128_si256 (simde__m128i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_castsi128_si256(a.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = a;
+  r.m128i[1] = simde_mm_setzero_si128();
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_castsi256_si128 (simde__m256i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128I_C(_mm256_castsi256_si128(a.n));
+#else
+  return a.m128i[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_castsi256_pd (simde__m256i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_castsi256_pd(a.n));
+#else
+  union {
+    simde__m256i si256;
+    simde__m256d pd;
+  } r = { .si256 = a };
+  return r.pd;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_castsi256_ps (simde__m256i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_castsi256_ps(a.n));
+#else
+  union {
+    simde__m256i si256;
+    simde__m256 ps;
+  } r = { .si256 = a };
+  return r.ps;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_ceil_pd (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_ceil_pd(a.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_ceil_pd(a.m128d[0]);
+  r.m128d[1] = simde_mm_ceil_pd(a.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = simde_x_round_f64(a.f64[i], simde_MM_FROUND_CEIL);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_ceil_ps (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_ceil_ps(a.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_ceil_ps(a.m128[0]);
+  r.m128[1] = simde_mm_ceil_ps(a.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = simde_x_round_f32(a.f32[i], simde_MM_FROUND_CEIL);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_cmp_pd (simde__m128d a, simde__m128d b, const int imm8) {
+#if defined(SIMDE_SSE2_NATIVE)
+  /* SSE only has instructions for the first eight predicates; the
+     others swap the operands or combine two comparisons.  Callers
+     inside SIMDe use (simde_mm_cmp_pd)(...) so they get this function
+     rather than the AVX macro, which needs imm8 to be a constant. */
+  switch (imm8 & 31) {
+    case simde_CMP_EQ_OQ:
+    case simde_CMP_EQ_OS:
+      return simde_mm_cmpeq_pd(a, b);
+    case simde_CMP_LT_OS:
+    case simde_CMP_LT_OQ:
+      return simde_mm_cmplt_pd(a, b);
+    case simde_CMP_LE_OS:
+    case simde_CMP_LE_OQ:
+      return simde_mm_cmple_pd(a, b);
+    case simde_CMP_UNORD_Q:
+    case simde_CMP_UNORD_S:
+      return simde_mm_cmpunord_pd(a, b);
+    case simde_CMP_NEQ_UQ:
+    case simde_CMP_NEQ_US:
+      return simde_mm_cmpneq_pd(a, b);
+    case simde_CMP_NLT_US:
+    case simde_CMP_NLT_UQ:
+      return simde_mm_cmpnlt_pd(a, b);
+    case simde_CMP_NLE_US:
+    case simde_CMP_NLE_UQ:
+      return simde_mm_cmpnle_pd(a, b);
+    case simde_CMP_ORD_Q:
+    case simde_CMP_ORD_S:
+      return simde_mm_cmpord_pd(a, b);
+    case simde_CMP_EQ_UQ:
+    case simde_CMP_EQ_US:
+      return simde_mm_or_pd(simde_mm_cmpeq_pd(a, b), simde_mm_cmpunord_pd(a, b));
+    case simde_CMP_NGE_US:
+    case simde_CMP_NGE_UQ:
+      return simde_mm_cmpnle_pd(b, a);
+    case simde_CMP_NGT_US:
+    case simde_CMP_NGT_UQ:
+      return simde_mm_cmpnlt_pd(b, a);
+    case simde_CMP_FALSE_OQ:
+    case simde_CMP_FALSE_OS:
+      return simde_mm_setzero_pd();
+    case simde_CMP_NEQ_OQ:
+    case simde_CMP_NEQ_OS:
+      return simde_mm_andnot_pd(simde_mm_cmpunord_pd(a, b), simde_mm_cmpneq_pd(a, b));
+    case simde_CMP_GE_OS:
+    case simde_CMP_GE_OQ:
+      return simde_mm_cmple_pd(b, a);
+    case simde_CMP_GT_OS:
+    case simde_CMP_GT_OQ:
+      return simde_mm_cmplt_pd(b, a);
+    case simde_CMP_TRUE_UQ:
+    case simde_CMP_TRUE_US:
+    default:
+      return simde_mm_cmpeq_pd(simde_mm_setzero_pd(), simde_mm_setzero_pd());
+  }
+#else
+  simde__m128d r;
+  const uint8_t p = simde__cmp_predicates[imm8 & 15];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.u64[i] = (SIMDE__CMP_OUTCOME(a.f64[i], b.f64[i]) & p) ? ~UINT64_C(0) : 0;
+  }
+  return r;
+#endif
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm_cmp_pd(a, b, imm8) SIMDE__M128D_C(_mm_cmp_pd(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_cmp_pd (simde__m256d a, simde__m256d b, const int imm8) {
+  simde__m256d r;
+#if defined(SIMDE_SSE2_NATIVE)
+  r.m128d[0] = (simde_mm_cmp_pd)(a.m128d[0], b.m128d[0], imm8);
+  r.m128d[1] = (simde_mm_cmp_pd)(a.m128d[1], b.m128d[1], imm8);
+#else
+  const uint8_t p = simde__cmp_predicates[imm8 & 15];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.u64[i] = (SIMDE__CMP_OUTCOME(a.f64[i], b.f64[i]) & p) ? ~UINT64_C(0) : 0;
+  }
+#endif
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_cmp_pd(a, b, imm8) SIMDE__M256D_C(_mm256_cmp_pd(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cmp_ps (simde__m128 a, simde__m128 b, const int imm8) {
+#if defined(SIMDE_SSE_NATIVE)
+  switch (imm8 & 31) {
+    case simde_CMP_EQ_OQ:
+    case simde_CMP_EQ_OS:
+      return simde_mm_cmpeq_ps(a, b);
+    case simde_CMP_LT_OS:
+    case simde_CMP_LT_OQ:
+      return simde_mm_cmplt_ps(a, b);
+    case simde_CMP_LE_OS:
+    case simde_CMP_LE_OQ:
+      return simde_mm_cmple_ps(a, b);
+    case simde_CMP_UNORD_Q:
+    case simde_CMP_UNORD_S:
+      return simde_mm_cmpunord_ps(a, b);
+    case simde_CMP_NEQ_UQ:
+    case simde_CMP_NEQ_US:
+      return simde_mm_cmpneq_ps(a, b);
+    case simde_CMP_NLT_US:
+    case simde_CMP_NLT_UQ:
+      return simde_mm_cmpnlt_ps(a, b);
+    case simde_CMP_NLE_US:
+    case simde_CMP_NLE_UQ:
+      return simde_mm_cmpnle_ps(a, b);
+    case simde_CMP_ORD_Q:
+    case simde_CMP_ORD_S:
+      return simde_mm_cmpord_ps(a, b);
+    case simde_CMP_EQ_UQ:
+    case simde_CMP_EQ_US:
+      return simde_mm_or_ps(simde_mm_cmpeq_ps(a, b), simde_mm_cmpunord_ps(a, b));
+    case simde_CMP_NGE_US:
+    case simde_CMP_NGE_UQ:
+      return simde_mm_cmpnle_ps(b, a);
+    case simde_CMP_NGT_US:
+    case simde_CMP_NGT_UQ:
+      return simde_mm_cmpnlt_ps(b, a);
+    case simde_CMP_FALSE_OQ:
+    case simde_CMP_FALSE_OS:
+      return simde_mm_setzero_ps();
+    case simde_CMP_NEQ_OQ:
+    case simde_CMP_NEQ_OS:
+      return simde_mm_andnot_ps(simde_mm_cmpunord_ps(a, b), simde_mm_cmpneq_ps(a, b));
+    case simde_CMP_GE_OS:
+    case simde_CMP_GE_OQ:
+      return simde_mm_cmple_ps(b, a);
+    case simde_CMP_GT_OS:
+    case simde_CMP_GT_OQ:
+      return simde_mm_cmplt_ps(b, a);
+    case simde_CMP_TRUE_UQ:
+    case simde_CMP_TRUE_US:
+    default:
+      return simde_mm_cmpeq_ps(simde_mm_setzero_ps(), simde_mm_setzero_ps());
+  }
+#else
+  simde__m128 r;
+  const uint8_t p = simde__cmp_predicates[imm8 & 15];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.u32[i] = (SIMDE__CMP_OUTCOME(a.f32[i], b.f32[i]) & p) ? 0xffffffff : 0;
+  }
+  return r;
+#endif
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm_cmp_ps(a, b, imm8) SIMDE__M128_C(_mm_cmp_ps(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cmp_ps (simde__m256 a, simde__m256 b, const int imm8) {
+  simde__m256 r;
+#if defined(SIMDE_SSE_NATIVE)
+  r.m128[0] = (simde_mm_cmp_ps)(a.m128[0], b.m128[0], imm8);
+  r.m128[1] = (simde_mm_cmp_ps)(a.m128[1], b.m128[1], imm8);
+#else
+  const uint8_t p = simde__cmp_predicates[imm8 & 15];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.u32[i] = (SIMDE__CMP_OUTCOME(a.f32[i], b.f32[i]) & p) ? 0xffffffff : 0;
+  }
+#endif
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_cmp_ps(a, b, imm8) SIMDE__M256_C(_mm256_cmp_ps(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_cmp_sd (simde__m128d a, simde__m128d b, const int imm8) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return simde_mm_move_sd(a, (simde_mm_cmp_pd)(a, b, imm8));
+#else
+  const uint8_t p = simde__cmp_predicates[imm8 & 15];
+  a.u64[0] = (SIMDE__CMP_OUTCOME(a.f64[0], b.f64[0]) & p) ? ~UINT64_C(0) : 0;
+  return a;
+#endif
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm_cmp_sd(a, b, imm8) SIMDE__M128D_C(_mm_cmp_sd(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cmp_ss (simde__m128 a, simde__m128 b, const int imm8) {
+#if defined(SIMDE_SSE_NATIVE)
+  return simde_mm_move_ss(a, (simde_mm_cmp_ps)(a, b, imm8));
+#else
+  const uint8_t p = simde__cmp_predicates[imm8 & 15];
+  a.u32[0] = (SIMDE__CMP_OUTCOME(a.f32[0], b.f32[0]) & p) ? 0xffffffff : 0;
+  return a;
+#endif
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm_cmp_ss(a, b, imm8) SIMDE__M128_C(_mm_cmp_ss(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_cvtepi32_pd (simde__m128i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_cvtepi32_pd(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_cvtepi32_pd(a);
+  r.m128d[1] = simde_mm_cvtepi32_pd(simde_mm_srli_si128(a, 8));
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = (simde_float64) a.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtepi32_ps (simde__m256i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_cvtepi32_ps(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_cvtepi32_ps(a.m128i[0]);
+  r.m128[1] = simde_mm_cvtepi32_ps(a.m128i[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = (simde_float32) a.i32[i];
+  }
+  return r;
+#endif
+}
+
+/* Out-of-range values (and NaN) produce INT32_MIN, like the hardware
+   "integer indefinite" value. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_cvtpd_epi32 (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128I_C(_mm256_cvtpd_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return simde_mm_unpacklo_epi64(simde_mm_cvtpd_epi32(a.m128d[0]), simde_mm_cvtpd_epi32(a.m128d[1]));
+#else
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(a.f64) / sizeof(a.f64[0])) ; i++) {
+    const simde_float64 v = simde_x_round_f64(a.f64[i], simde_MM_FROUND_CUR_DIRECTION);
+    r.i32[i] = (v > -2147483649.0 && v < 2147483648.0) ? (int32_t) v : INT32_MIN;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_cvtpd_ps (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128_C(_mm256_cvtpd_ps(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return simde_mm_movelh_ps(simde_mm_cvtpd_ps(a.m128d[0]), simde_mm_cvtpd_ps(a.m128d[1]));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a.f64) / sizeof(a.f64[0])) ; i++) {
+    r.f32[i] = (simde_float32) a.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cvtps_epi32 (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_cvtps_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cvtps_epi32(a.m128[0]);
+  r.m128i[1] = simde_mm_cvtps_epi32(a.m128[1]);
+  return r;
+#else
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const simde_float32 v = simde_x_round_f32(a.f32[i], simde_MM_FROUND_CUR_DIRECTION);
+    r.i32[i] = (v >= -2147483648.0f && v < 2147483648.0f) ? (int32_t) v : INT32_MIN;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_cvtps_pd (simde__m128 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_cvtps_pd(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_cvtps_pd(a);
+  r.m128d[1] = simde_mm_cvtps_pd(simde_mm_movehl_ps(a, a));
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = (simde_float64) a.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm256_cvtsd_f64 (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return _mm_cvtsd_f64(_mm256_castpd256_pd128(a.n));
+#else
+  return a.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm256_cvtsi256_si32 (simde__m256i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return _mm_cvtsi128_si32(_mm256_castsi256_si128(a.n));
+#else
+  return a.i32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm256_cvtss_f32 (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return _mm_cvtss_f32(_mm256_castps256_ps128(a.n));
+#else
+  return a.f32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_cvttpd_epi32 (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128I_C(_mm256_cvttpd_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return simde_mm_unpacklo_epi64(simde_mm_cvttpd_epi32(a.m128d[0]), simde_mm_cvttpd_epi32(a.m128d[1]));
+#else
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(a.f64) / sizeof(a.f64[0])) ; i++) {
+    const simde_float64 v = a.f64[i];
+    r.i32[i] = (v > -2147483649.0 && v < 2147483648.0) ? (int32_t) v : INT32_MIN;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cvttps_epi32 (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_cvttps_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cvttps_epi32(a.m128[0]);
+  r.m128i[1] = simde_mm_cvttps_epi32(a.m128[1]);
+  return r;
+#else
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const simde_float32 v = a.f32[i];
+    r.i32[i] = (v >= -2147483648.0f && v < 2147483648.0f) ? (int32_t) v : INT32_MIN;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_div_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_div_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_div_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_div_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] / b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_div_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_div_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_div_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_div_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[i] / b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm256_extractf128_pd (simde__m256d a, const int imm8) {
+  return a.m128d[imm8 & 1];
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_extractf128_pd(a, imm8) SIMDE__M128D_C(_mm256_extractf128_pd(a.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_extractf128_ps (simde__m256 a, const int imm8) {
+  return a.m128[imm8 & 1];
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_extractf128_ps(a, imm8) SIMDE__M128_C(_mm256_extractf128_ps(a.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_extractf128_si256 (simde__m256i a, const int imm8) {
+  return a.m128i[imm8 & 1];
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_extractf128_si256(a, imm8) SIMDE__M128I_C(_mm256_extractf128_si256(a.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_floor_pd (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_floor_pd(a.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_floor_pd(a.m128d[0]);
+  r.m128d[1] = simde_mm_floor_pd(a.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = simde_x_round_f64(a.f64[i], simde_MM_FROUND_FLOOR);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_floor_ps (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_floor_ps(a.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_floor_ps(a.m128[0]);
+  r.m128[1] = simde_mm_floor_ps(a.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = simde_x_round_f32(a.f32[i], simde_MM_FROUND_FLOOR);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_hadd_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_hadd_pd(a.n, b.n));
+#elif defined(SIMDE_SSE3_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_hadd_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_hadd_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  r.f64[0] = a.f64[0] + a.f64[1];
+  r.f64[1] = b.f64[0] + b.f64[1];
+  r.f64[2] = a.f64[2] + a.f64[3];
+  r.f64[3] = b.f64[2] + b.f64[3];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_hadd_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_hadd_ps(a.n, b.n));
+#elif defined(SIMDE_SSE3_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_hadd_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_hadd_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i += 4) {
+    r.f32[i + 0] = a.f32[i + 0] + a.f32[i + 1];
+    r.f32[i + 1] = a.f32[i + 2] + a.f32[i + 3];
+    r.f32[i + 2] = b.f32[i + 0] + b.f32[i + 1];
+    r.f32[i + 3] = b.f32[i + 2] + b.f32[i + 3];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_hsub_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_hsub_pd(a.n, b.n));
+#elif defined(SIMDE_SSE3_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_hsub_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_hsub_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  r.f64[0] = a.f64[0] - a.f64[1];
+  r.f64[1] = b.f64[0] - b.f64[1];
+  r.f64[2] = a.f64[2] - a.f64[3];
+  r.f64[3] = b.f64[2] - b.f64[3];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_hsub_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_hsub_ps(a.n, b.n));
+#elif defined(SIMDE_SSE3_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_hsub_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_hsub_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i += 4) {
+    r.f32[i + 0] = a.f32[i + 0] - a.f32[i + 1];
+    r.f32[i + 1] = a.f32[i + 2] - a.f32[i + 3];
+    r.f32[i + 2] = b.f32[i + 0] - b.f32[i + 1];
+    r.f32[i + 3] = b.f32[i + 2] - b.f32[i + 3];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_insertf128_pd (simde__m256d a, simde__m128d b, const int imm8) {
+  a.m128d[imm8 & 1] = b;
+  return a;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_insertf128_pd(a, b, imm8) SIMDE__M256D_C(_mm256_insertf128_pd(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_insertf128_ps (simde__m256 a, simde__m128 b, const int imm8) {
+  a.m128[imm8 & 1] = b;
+  return a;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_insertf128_ps(a, b, imm8) SIMDE__M256_C(_mm256_insertf128_ps(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_insertf128_si256 (simde__m256i a, simde__m128i b, const int imm8) {
+  a.m128i[imm8 & 1] = b;
+  return a;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_insertf128_si256(a, b, imm8) SIMDE__M256I_C(_mm256_insertf128_si256(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_lddqu_si256 (simde__m256i const* mem_addr) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_lddqu_si256(&(mem_addr->n)));
+#else
+  simde__m256i r;
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_load_pd (simde_float64 const mem_addr[HEDLEY_ARRAY_PARAM(4)]) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_load_pd(mem_addr));
+#else
+  simde__m256d r;
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_load_ps (simde_float32 const mem_addr[HEDLEY_ARRAY_PARAM(8)]) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_load_ps(mem_addr));
+#else
+  simde__m256 r;
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_load_si256 (simde__m256i const* mem_addr) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_load_si256(&(mem_addr->n)));
+#else
+  simde__m256i r;
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_loadu_pd (simde_float64 const mem_addr[HEDLEY_ARRAY_PARAM(4)]) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_loadu_pd(mem_addr));
+#else
+  simde__m256d r;
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_loadu_ps (simde_float32 const mem_addr[HEDLEY_ARRAY_PARAM(8)]) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_loadu_ps(mem_addr));
+#else
+  simde__m256 r;
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_loadu_si256 (simde__m256i const* mem_addr) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_loadu_si256(&(mem_addr->n)));
+#else
+  simde__m256i r;
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_loadu2_m128d (simde_float64 const hiaddr[HEDLEY_ARRAY_PARAM(2)], simde_float64 const loaddr[HEDLEY_ARRAY_PARAM(2)]) {
+  simde__m256d r;
+  r.m128d[0] = simde_mm_loadu_pd(loaddr);
+  r.m128d[1] = simde_mm_loadu_pd(hiaddr);
+  return r;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_loadu2_m128 (simde_float32 const hiaddr[HEDLEY_ARRAY_PARAM(4)], simde_float32 const loaddr[HEDLEY_ARRAY_PARAM(4)]) {
+  simde__m256 r;
+  r.m128[0] = simde_mm_loadu_ps(loaddr);
+  r.m128[1] = simde_mm_loadu_ps(hiaddr);
+  return r;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_loadu2_m128i (simde__m128i const* hiaddr, simde__m128i const* loaddr) {
+  simde__m256i r;
+  r.m128i[0] = simde_mm_loadu_si128(loaddr);
+  r.m128i[1] = simde_mm_loadu_si128(hiaddr);
+  return r;
+}
+
+/* The masked loads and stores only access the elements selected by
+   the mask, so (like the native instructions) they're safe to use on
+   buffers which end right before an unmapped page.  The portable
+   versions access memory through a volatile pointer; otherwise GCC 12
+   will turn a loop with a constant mask into a full-width load and a
+   blend, and with -Ofast the stores into a read-modify-write of the
+   whole vector. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskload_pd (simde_float64 const* mem_addr, simde__m128i mask) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128D_C(_mm_maskload_pd(mem_addr, mask.n));
+#else
+  simde__m128d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = (mask.i64[i] < 0) ? ((volatile simde_float64 const*) mem_addr)[i] : 0.0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskload_pd (simde_float64 const* mem_addr, simde__m256i mask) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_maskload_pd(mem_addr, mask.n));
+#else
+  simde__m256d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = (mask.i64[i] < 0) ? ((volatile simde_float64 const*) mem_addr)[i] : 0.0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskload_ps (simde_float32 const* mem_addr, simde__m128i mask) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M128_C(_mm_maskload_ps(mem_addr, mask.n));
+#else
+  simde__m128 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = (mask.i32[i] < 0) ? ((volatile simde_float32 const*) mem_addr)[i] : 0.0f;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskload_ps (simde_float32 const* mem_addr, simde__m256i mask) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_maskload_ps(mem_addr, mask.n));
+#else
+  simde__m256 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = (mask.i32[i] < 0) ? ((volatile simde_float32 const*) mem_addr)[i] : 0.0f;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_maskstore_pd (simde_float64* mem_addr, simde__m128i mask, simde__m128d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm_maskstore_pd(mem_addr, mask.n, a.n);
+#else
+  for (size_t i = 0 ; i < (sizeof(a.f64) / sizeof(a.f64[0])) ; i++) {
+    if (mask.i64[i] < 0)
+      ((volatile simde_float64*) mem_addr)[i] = a.f64[i];
+  }
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_maskstore_pd (simde_float64* mem_addr, simde__m256i mask, simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_maskstore_pd(mem_addr, mask.n, a.n);
+#else
+  for (size_t i = 0 ; i < (sizeof(a.f64) / sizeof(a.f64[0])) ; i++) {
+    if (mask.i64[i] < 0)
+      ((volatile simde_float64*) mem_addr)[i] = a.f64[i];
+  }
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_maskstore_ps (simde_float32* mem_addr, simde__m128i mask, simde__m128 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm_maskstore_ps(mem_addr, mask.n, a.n);
+#else
+  for (size_t i = 0 ; i < (sizeof(a.f32) / sizeof(a.f32[0])) ; i++) {
+    if (mask.i32[i] < 0)
+      ((volatile simde_float32*) mem_addr)[i] = a.f32[i];
+  }
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_maskstore_ps (simde_float32* mem_addr, simde__m256i mask, simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_maskstore_ps(mem_addr, mask.n, a.n);
+#else
+  for (size_t i = 0 ; i < (sizeof(a.f32) / sizeof(a.f32[0])) ; i++) {
+    if (mask.i32[i] < 0)
+      ((volatile simde_float32*) mem_addr)[i] = a.f32[i];
+  }
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_max_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_max_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_max_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_max_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = (a.f64[i] > b.f64[i]) ? a.f64[i] : b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_max_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_max_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_max_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_max_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = (a.f32[i] > b.f32[i]) ? a.f32[i] : b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_min_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_min_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_min_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_min_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = (a.f64[i] < b.f64[i]) ? a.f64[i] : b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_min_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_min_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_min_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_min_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = (a.f32[i] < b.f32[i]) ? a.f32[i] : b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm256_movemask_pd (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return _mm256_movemask_pd(a.n);
+#elif defined(SIMDE_SSE2_NATIVE)
+  return simde_mm_movemask_pd(a.m128d[0]) | (simde_mm_movemask_pd(a.m128d[1]) << 2);
+#else
+  int r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.u64) / sizeof(a.u64[0])) ; i++) {
+    r |= (int) (a.u64[i] >> 63) << i;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm256_movemask_ps (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return _mm256_movemask_ps(a.n);
+#elif defined(SIMDE_SSE_NATIVE)
+  return simde_mm_movemask_ps(a.m128[0]) | (simde_mm_movemask_ps(a.m128[1]) << 4);
+#else
+  int r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.u32) / sizeof(a.u32[0])) ; i++) {
+    r |= (int) (a.u32[i] >> 31) << i;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mul_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_mul_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_mul_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_mul_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] * b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mul_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_mul_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_mul_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_mul_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[i] * b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_or_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_or_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_or_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_or_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = a.u64[i] | b.u64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_or_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_or_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_or_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_or_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = a.u32[i] | b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_permute_pd (simde__m256d a, const int imm8) {
+  simde__m256d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[(i & 2) + ((imm8 >> i) & 1)];
+  }
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_permute_pd(a, imm8) SIMDE__M256D_C(_mm256_permute_pd(a.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm256_permute_pd(a, imm8) (__extension__ ({ \
+      const simde__m256d simde__tmp_mm256_permute_pd_a_ = (a); \
+      (simde__m256d) { .f64 = SIMDE__SHUFFLE_VECTOR(64, 32, simde__tmp_mm256_permute_pd_a_.f64, simde__tmp_mm256_permute_pd_a_.f64, \
+          (((imm8)     ) & 1)    , (((imm8) >> 1) & 1)    , \
+          (((imm8) >> 2) & 1) + 2, (((imm8) >> 3) & 1) + 2) }; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_permute_ps (simde__m256 a, const int imm8) {
+  simde__m256 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[(i & 4) + ((imm8 >> ((i & 3) * 2)) & 3)];
+  }
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_permute_ps(a, imm8) SIMDE__M256_C(_mm256_permute_ps(a.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm256_permute_ps(a, imm8) (__extension__ ({ \
+      const simde__m256 simde__tmp_mm256_permute_ps_a_ = (a); \
+      (simde__m256) { .f32 = SIMDE__SHUFFLE_VECTOR(32, 32, simde__tmp_mm256_permute_ps_a_.f32, simde__tmp_mm256_permute_ps_a_.f32, \
+          (((imm8)     ) & 3)    , (((imm8) >> 2) & 3)    , \
+          (((imm8) >> 4) & 3)    , (((imm8) >> 6) & 3)    , \
+          (((imm8)     ) & 3) + 4, (((imm8) >> 2) & 3) + 4, \
+          (((imm8) >> 4) & 3) + 4, (((imm8) >> 6) & 3) + 4) }; }))
+#endif
+
+/* Each nibble of imm8 selects one of the four 128-bit halves of a and
+   b (or zero, if bit 3 is set) for the corresponding half of r. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_permute2f128_pd (simde__m256d a, simde__m256d b, const int imm8) {
+  simde__m256d r;
+  for (size_t i = 0 ; i < (sizeof(r.m128d) / sizeof(r.m128d[0])) ; i++) {
+    const int sel = imm8 >> (i * 4);
+    const simde__m256d* src = (sel & 2) ? &b : &a;
+    r.m128d[i] = (sel & 8) ? simde_mm_setzero_pd() : src->m128d[sel & 1];
+  }
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_permute2f128_pd(a, b, imm8) SIMDE__M256D_C(_mm256_permute2f128_pd(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_permute2f128_ps (simde__m256 a, simde__m256 b, const int imm8) {
+  simde__m256 r;
+  for (size_t i = 0 ; i < (sizeof(r.m128) / sizeof(r.m128[0])) ; i++) {
+    const int sel = imm8 >> (i * 4);
+    const simde__m256* src = (sel & 2) ? &b : &a;
+    r.m128[i] = (sel & 8) ? simde_mm_setzero_ps() : src->m128[sel & 1];
+  }
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_permute2f128_ps(a, b, imm8) SIMDE__M256_C(_mm256_permute2f128_ps(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_permute2f128_si256 (simde__m256i a, simde__m256i b, const int imm8) {
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+    const int sel = imm8 >> (i * 4);
+    const simde__m256i* src = (sel & 2) ? &b : &a;
+    r.m128i[i] = (sel & 8) ? simde_mm_setzero_si128() : src->m128i[sel & 1];
+  }
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_permute2f128_si256(a, b, imm8) SIMDE__M256I_C(_mm256_permute2f128_si256(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_rcp_ps (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_rcp_ps(a.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_rcp_ps(a.m128[0]);
+  r.m128[1] = simde_mm_rcp_ps(a.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = 1.0f / a.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_round_pd (simde__m256d a, int rounding) {
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = simde_x_round_f64(a.f64[i], rounding);
+  }
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_round_pd(a, rounding) SIMDE__M256D_C(_mm256_round_pd(a.n, rounding))
+#elif defined(SIMDE_SSE4_1_NATIVE) && defined(__GNUC__)
+#  define simde_mm256_round_pd(a, rounding) (__extension__ ({ \
+      const simde__m256d simde__tmp_mm256_round_pd_a_ = (a); \
+      simde_mm256_set_m128d(simde_mm_round_pd(simde__tmp_mm256_round_pd_a_.m128d[1], rounding), \
+                            simde_mm_round_pd(simde__tmp_mm256_round_pd_a_.m128d[0], rounding)); }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_round_ps (simde__m256 a, int rounding) {
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = simde_x_round_f32(a.f32[i], rounding);
+  }
+  return r;
+}
+#if defined(SIMDE_AVX_NATIVE)
+#  define simde_mm256_round_ps(a, rounding) SIMDE__M256_C(_mm256_round_ps(a.n, rounding))
+#elif defined(SIMDE_SSE4_1_NATIVE) && defined(__GNUC__)
+#  define simde_mm256_round_ps(a, rounding) (__extension__ ({ \
+      const simde__m256 simde__tmp_mm256_round_ps_a_ = (a); \
+      simde_mm256_set_m128(simde_mm_round_ps(simde__tmp_mm256_round_ps_a_.m128[1], rounding), \
+                           simde_mm_round_ps(simde__tmp_mm256_round_ps_a_.m128[0], rounding)); }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_rsqrt_ps (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_rsqrt_ps(a.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_rsqrt_ps(a.m128[0]);
+  r.m128[1] = simde_mm_rsqrt_ps(a.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = 1.0f / sqrtf(a.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set_epi16 (int16_t e15, int16_t e14, int16_t e13, int16_t e12, int16_t e11, int16_t e10, int16_t  e9, int16_t  e8,
+                       int16_t  e7, int16_t  e6, int16_t  e5, int16_t  e4, int16_t  e3, int16_t  e2, int16_t  e1, int16_t  e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_set_epi16(e15, e14, e13, e12, e11, e10,  e9,  e8,
+                                          e7,  e6,  e5,  e4,  e3,  e2,  e1,  e0));
+#else
+  return (simde__m256i) { .i16 = {  e0,  e1,  e2,  e3,  e4,  e5,  e6,  e7,
+                                    e8,  e9, e10, e11, e12, e13, e14, e15 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set_epi32 (int32_t e7, int32_t e6, int32_t e5, int32_t e4,
+                       int32_t e3, int32_t e2, int32_t e1, int32_t e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_set_epi32(e7, e6, e5, e4,
+                                         e3, e2, e1, e0));
+#else
+  return (simde__m256i) { .i32 = { e0, e1, e2, e3,
+                                   e4, e5, e6, e7 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set_epi64x (int64_t e3, int64_t e2, int64_t e1, int64_t e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_set_epi64x(e3, e2, e1, e0));
+#else
+  return (simde__m256i) { .i64 = { e0, e1, e2, e3 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set_epi8 (int8_t e31, int8_t e30, int8_t e29, int8_t e28, int8_t e27, int8_t e26, int8_t e25, int8_t e24,
+                      int8_t e23, int8_t e22, int8_t e21, int8_t e20, int8_t e19, int8_t e18, int8_t e17, int8_t e16,
+                      int8_t e15, int8_t e14, int8_t e13, int8_t e12, int8_t e11, int8_t e10, int8_t  e9, int8_t  e8,
+                      int8_t  e7, int8_t  e6, int8_t  e5, int8_t  e4, int8_t  e3, int8_t  e2, int8_t  e1, int8_t  e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_set_epi8(e31, e30, e29, e28, e27, e26, e25, e24,
+                                        e23, e22, e21, e20, e19, e18, e17, e16,
+                                        e15, e14, e13, e12, e11, e10,  e9,  e8,
+                                         e7,  e6,  e5,  e4,  e3,  e2,  e1,  e0));
+#else
+  return (simde__m256i) { .i8 = {  e0,  e1,  e2,  e3,  e4,  e5,  e6,  e7,
+                                   e8,  e9, e10, e11, e12, e13, e14, e15,
+                                  e16, e17, e18, e19, e20, e21, e22, e23,
+                                  e24, e25, e26, e27, e28, e29, e30, e31 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_set_m128 (simde__m128 hi, simde__m128 lo) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_insertf128_ps(_mm256_castps128_ps256(lo.n), hi.n, 1));
+#else
+  simde__m256 r;
+  r.m128[0] = lo;
+  r.m128[1] = hi;
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_set_m128d (simde__m128d hi, simde__m128d lo) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_insertf128_pd(_mm256_castpd128_pd256(lo.n), hi.n, 1));
+#else
+  simde__m256d r;
+  r.m128d[0] = lo;
+  r.m128d[1] = hi;
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set_m128i (simde__m128i hi, simde__m128i lo) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_insertf128_si256(_mm256_castsi128_si256(lo.n), hi.n, 1));
+#else
+  simde__m256i r;
+  r.m128i[0] = lo;
+  r.m128i[1] = hi;
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_set_pd (simde_float64 e3, simde_float64 e2, simde_float64 e1, simde_float64 e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_set_pd(e3, e2, e1, e0));
+#else
+  return (simde__m256d) { .f64 = { e0, e1, e2, e3 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_set_ps (simde_float32 e7, simde_float32 e6, simde_float32 e5, simde_float32 e4,
+                    simde_float32 e3, simde_float32 e2, simde_float32 e1, simde_float32 e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_set_ps(e7, e6, e5, e4,
+                                     e3, e2, e1, e0));
+#else
+  return (simde__m256) { .f32 = { e0, e1, e2, e3,
+                                  e4, e5, e6, e7 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set1_epi8 (int8_t a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_set1_epi8(a));
+#else
+  return (simde__m256i) { .i8 = { a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set1_epi16 (int16_t a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_set1_epi16(a));
+#else
+  return (simde__m256i) { .i16 = { a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set1_epi32 (int32_t a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_set1_epi32(a));
+#else
+  return (simde__m256i) { .i32 = { a, a, a, a, a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_set1_epi64x (int64_t a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_set1_epi64x(a));
+#else
+  return (simde__m256i) { .i64 = { a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_set1_pd (simde_float64 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_set1_pd(a));
+#else
+  return (simde__m256d) { .f64 = { a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_set1_ps (simde_float32 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_set1_ps(a));
+#else
+  return (simde__m256) { .f32 = { a, a, a, a, a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_setr_epi16 (int16_t e15, int16_t e14, int16_t e13, int16_t e12, int16_t e11, int16_t e10, int16_t  e9, int16_t  e8,
+                        int16_t  e7, int16_t  e6, int16_t  e5, int16_t  e4, int16_t  e3, int16_t  e2, int16_t  e1, int16_t  e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_setr_epi16(e15, e14, e13, e12, e11, e10,  e9,  e8,
+                                           e7,  e6,  e5,  e4,  e3,  e2,  e1,  e0));
+#else
+  return (simde__m256i) { .i16 = { e15, e14, e13, e12, e11, e10,  e9,  e8,
+                                    e7,  e6,  e5,  e4,  e3,  e2,  e1,  e0 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_setr_epi32 (int32_t e7, int32_t e6, int32_t e5, int32_t e4,
+                        int32_t e3, int32_t e2, int32_t e1, int32_t e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_setr_epi32(e7, e6, e5, e4,
+                                          e3, e2, e1, e0));
+#else
+  return (simde__m256i) { .i32 = { e7, e6, e5, e4,
+                                   e3, e2, e1, e0 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_setr_epi64x (int64_t e3, int64_t e2, int64_t e1, int64_t e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_setr_epi64x(e3, e2, e1, e0));
+#else
+  return (simde__m256i) { .i64 = { e3, e2, e1, e0 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_setr_epi8 (int8_t e31, int8_t e30, int8_t e29, int8_t e28, int8_t e27, int8_t e26, int8_t e25, int8_t e24,
+                       int8_t e23, int8_t e22, int8_t e21, int8_t e20, int8_t e19, int8_t e18, int8_t e17, int8_t e16,
+                       int8_t e15, int8_t e14, int8_t e13, int8_t e12, int8_t e11, int8_t e10, int8_t  e9, int8_t  e8,
+                       int8_t  e7, int8_t  e6, int8_t  e5, int8_t  e4, int8_t  e3, int8_t  e2, int8_t  e1, int8_t  e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_setr_epi8(e31, e30, e29, e28, e27, e26, e25, e24,
+                                         e23, e22, e21, e20, e19, e18, e17, e16,
+                                         e15, e14, e13, e12, e11, e10,  e9,  e8,
+                                          e7,  e6,  e5,  e4,  e3,  e2,  e1,  e0));
+#else
+  return (simde__m256i) { .i8 = { e31, e30, e29, e28, e27, e26, e25, e24,
+                                  e23, e22, e21, e20, e19, e18, e17, e16,
+                                  e15, e14, e13, e12, e11, e10,  e9,  e8,
+                                   e7,  e6,  e5,  e4,  e3,  e2,  e1,  e0 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_setr_m128 (simde__m128 lo, simde__m128 hi) {
+  return simde_mm256_set_m128(hi, lo);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_setr_m128d (simde__m128d lo, simde__m128d hi) {
+  return simde_mm256_set_m128d(hi, lo);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_setr_m128i (simde__m128i lo, simde__m128i hi) {
+  return simde_mm256_set_m128i(hi, lo);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_setr_pd (simde_float64 e3, simde_float64 e2, simde_float64 e1, simde_float64 e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_setr_pd(e3, e2, e1, e0));
+#else
+  return (simde__m256d) { .f64 = { e3, e2, e1, e0 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_setr_ps (simde_float32 e7, simde_float32 e6, simde_float32 e5, simde_float32 e4,
+                     simde_float32 e3, simde_float32 e2, simde_float32 e1, simde_float32 e0) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_setr_ps(e7, e6, e5, e4,
+                                      e3, e2, e1, e0));
+#else
+  return (simde__m256) { .f32 = { e7, e6, e5, e4,
+                                  e3, e2, e1, e0 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_setzero_pd (void) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_setzero_pd());
+#else
+  return (simde__m256d) { .f64 = { 0.0, } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_setzero_ps (void) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_setzero_ps());
+#else
+  return (simde__m256) { .f32 = { 0.0f, } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_setzero_si256 (void) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_setzero_si256());
+#else
+  return (simde__m256i) { .i64 = { 0, } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_sqrt_pd (simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_sqrt_pd(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_sqrt_pd(a.m128d[0]);
+  r.m128d[1] = simde_mm_sqrt_pd(a.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = sqrt(a.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_sqrt_ps (simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_sqrt_ps(a.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_sqrt_ps(a.m128[0]);
+  r.m128[1] = simde_mm_sqrt_ps(a.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = sqrtf(a.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_store_pd (simde_float64 mem_addr[HEDLEY_ARRAY_PARAM(4)], simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_store_pd(mem_addr, a.n);
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_store_ps (simde_float32 mem_addr[HEDLEY_ARRAY_PARAM(8)], simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_store_ps(mem_addr, a.n);
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_store_si256 (simde__m256i* mem_addr, simde__m256i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_store_si256(&(mem_addr->n), a.n);
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_storeu_pd (simde_float64 mem_addr[HEDLEY_ARRAY_PARAM(4)], simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_storeu_pd(mem_addr, a.n);
+#else
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_storeu_ps (simde_float32 mem_addr[HEDLEY_ARRAY_PARAM(8)], simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_storeu_ps(mem_addr, a.n);
+#else
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_storeu_si256 (simde__m256i* mem_addr, simde__m256i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_storeu_si256(&(mem_addr->n), a.n);
+#else
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_storeu2_m128d (simde_float64 hiaddr[HEDLEY_ARRAY_PARAM(2)], simde_float64 loaddr[HEDLEY_ARRAY_PARAM(2)], simde__m256d a) {
+  /* simde_mm_storeu_pd only writes the low element, so copy each
+     half directly. */
+  memcpy(loaddr, &(a.m128d[0]), sizeof(a.m128d[0]));
+  memcpy(hiaddr, &(a.m128d[1]), sizeof(a.m128d[1]));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_storeu2_m128 (simde_float32 hiaddr[HEDLEY_ARRAY_PARAM(4)], simde_float32 loaddr[HEDLEY_ARRAY_PARAM(4)], simde__m256 a) {
+  simde_mm_storeu_ps(loaddr, a.m128[0]);
+  simde_mm_storeu_ps(hiaddr, a.m128[1]);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_storeu2_m128i (simde__m128i* hiaddr, simde__m128i* loaddr, simde__m256i a) {
+  simde_mm_storeu_si128(loaddr, a.m128i[0]);
+  simde_mm_storeu_si128(hiaddr, a.m128i[1]);
+}
+
+/* Uses the native 128-bit streaming stores when AVX isn't available.
+   Without SSE2 only clang can express a non-temporal store, so GCC does
+   a cached one. */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_stream_pd (simde_float64 mem_addr[HEDLEY_ARRAY_PARAM(4)], simde__m256d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_stream_pd(mem_addr, a.n);
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde_mm_stream_pd(mem_addr, a.m128d[0]);
+  simde_mm_stream_pd(mem_addr + 2, a.m128d[1]);
+#elif defined(SIMDE__NONTEMPORAL_STORE) && defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  SIMDE__NONTEMPORAL_STORE(a.f64, &(((simde__m256d*) mem_addr)->f64));
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+/* Falls back on two simde_mm_stream_ps calls with native SSE; without
+   it the store is non-temporal under clang only, cached under GCC. */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_stream_ps (simde_float32 mem_addr[HEDLEY_ARRAY_PARAM(8)], simde__m256 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_stream_ps(mem_addr, a.n);
+#elif defined(SIMDE_SSE_NATIVE)
+  simde_mm_stream_ps(mem_addr, a.m128[0]);
+  simde_mm_stream_ps(mem_addr + 4, a.m128[1]);
+#elif defined(SIMDE__NONTEMPORAL_STORE) && defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  SIMDE__NONTEMPORAL_STORE(a.f32, &(((simde__m256*) mem_addr)->f32));
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+/* Split into simde_mm_stream_si128 halves with native SSE2.  In the
+   portable path GCC has no non-temporal store builtin, so the data
+   goes through the cache. */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_stream_si256 (simde__m256i* mem_addr, simde__m256i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_stream_si256(&(mem_addr->n), a.n);
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde_mm_stream_si128(&(mem_addr->m128i[0]), a.m128i[0]);
+  simde_mm_stream_si128(&(mem_addr->m128i[1]), a.m128i[1]);
+#elif defined(SIMDE__NONTEMPORAL_STORE) && defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  SIMDE__NONTEMPORAL_STORE(a.i64, &(mem_addr->i64));
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 32);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_sub_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_sub_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_sub_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_sub_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] - b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_sub_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_sub_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_sub_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_sub_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[i] - b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_xor_pd (simde__m256d a, simde__m256d b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_xor_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256d r;
+  r.m128d[0] = simde_mm_xor_pd(a.m128d[0], b.m128d[0]);
+  r.m128d[1] = simde_mm_xor_pd(a.m128d[1], b.m128d[1]);
+  return r;
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = a.u64[i] ^ b.u64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_xor_ps (simde__m256 a, simde__m256 b) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_xor_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m256 r;
+  r.m128[0] = simde_mm_xor_ps(a.m128[0], b.m128[0]);
+  r.m128[1] = simde_mm_xor_ps(a.m128[1], b.m128[1]);
+  return r;
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = a.u32[i] ^ b.u32[i];
+  }
+  return r;
+#endif
+}
+
+/* Without AVX there are no YMM registers to clear, so these are no-ops
+   unless AVX is available. */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_zeroall (void) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_zeroall();
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_zeroupper (void) {
+#if defined(SIMDE_AVX_NATIVE)
+  _mm256_zeroupper();
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_zextpd128_pd256 (simde__m128d a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256D_C(_mm256_insertf128_pd(_mm256_setzero_pd(), a.n, 0));
+#else
+  simde__m256d r;
+  r.m128d[0] = a;
+  r.m128d[1] = simde_mm_setzero_pd();
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_zextps128_ps256 (simde__m128 a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256_C(_mm256_insertf128_ps(_mm256_setzero_ps(), a.n, 0));
+#else
+  simde__m256 r;
+  r.m128[0] = a;
+  r.m128[1] = simde_mm_setzero_ps();
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_zextsi128_si256 (simde__m128i a) {
+#if defined(SIMDE_AVX_NATIVE)
+  return SIMDE__M256I_C(_mm256_insertf128_si256(_mm256_setzero_si256(), a.n, 0));
+#else
+  simde__m256i r;
+  r.m128i[0] = a;
+  r.m128i[1] = simde_mm_setzero_si128();
+  return r;
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__AVX_H) */
@@ -0,0 +1,2094 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__AVX2_H)
+#  if !defined(SIMDE__AVX2_H)
+#    define SIMDE__AVX2_H
+#  endif
+#  include "avx.h"
+
+#  if defined(SIMDE_AVX2_NATIVE)
+#    undef SIMDE_AVX2_NATIVE
+#  endif
+#  if defined(SIMDE_AVX2_FORCE_NATIVE)
+#    define SIMDE_AVX2_NATIVE
+#  elif defined(__AVX2__) && !defined(SIMDE_AVX2_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX2_NATIVE
+#  endif
+
+#  if defined(SIMDE_AVX2_NATIVE) && !defined(SIMDE_AVX_NATIVE)
+#    if defined(SIMDE_AVX2_FORCE_NATIVE)
+#      error Native AVX2 support requires native AVX support
+#    else
+#      warning Native AVX2 support requires native AVX support, disabling
+#      undef SIMDE_AVX2_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_AVX2_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <stdint.h>
+#  include <limits.h>
+#  include <stddef.h>
+#  include <string.h>
+
+SIMDE__BEGIN_DECLS
+
+/* Almost all of the AVX2 integer instructions operate on each 128-bit
+   lane independently, so when AVX2 isn't available they can be built
+   from the SSE functions on the m128i halves.  Purely element-wise
+   operations also get a portable loop over the full vector, which
+   gives the compiler a chance to use wider vectors. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_abs_epi8 (simde__m256i a) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_abs_epi8(a.n));
+#elif defined(SIMDE_SSSE3_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_abs_epi8(a.m128i[0]);
+  r.m128i[1] = simde_mm_abs_epi8(a.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.u8[i] = (uint8_t) ((a.i8[i] < 0) ? -a.i8[i] : a.i8[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_abs_epi16 (simde__m256i a) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_abs_epi16(a.n));
+#elif defined(SIMDE_SSSE3_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_abs_epi16(a.m128i[0]);
+  r.m128i[1] = simde_mm_abs_epi16(a.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.u16[i] = (uint16_t) ((a.i16[i] < 0) ? -a.i16[i] : a.i16[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_abs_epi32 (simde__m256i a) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_abs_epi32(a.n));
+#elif defined(SIMDE_SSSE3_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_abs_epi32(a.m128i[0]);
+  r.m128i[1] = simde_mm_abs_epi32(a.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.u32[i] = (a.i32[i] < 0) ? -((uint32_t) a.i32[i]) : ((uint32_t) a.i32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_add_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_add_epi8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_add_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_add_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.i8[i] = a.i8[i] + b.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_add_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_add_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_add_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_add_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.i16[i] = a.i16[i] + b.i16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_add_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_add_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_add_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_add_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[i] + b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_add_epi64 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_add_epi64(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_add_epi64(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_add_epi64(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] + b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_adds_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_adds_epi8(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_adds_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_adds_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_adds_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_adds_epi16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_adds_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_adds_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_adds_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_adds_epu8(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_adds_epu8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_adds_epu8(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_adds_epu16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_adds_epu16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_adds_epu16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_adds_epu16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_and_si256 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_and_si256(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_and_si128(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_and_si128(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] & b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_andnot_si256 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_andnot_si256(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_andnot_si128(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_andnot_si128(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ~(a.i64[i]) & b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_avg_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_avg_epu8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_avg_epu8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_avg_epu8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u8) / sizeof(r.u8[0])) ; i++) {
+    r.u8[i] = (uint8_t) ((a.u8[i] + b.u8[i] + 1) >> 1);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_avg_epu16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_avg_epu16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_avg_epu16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_avg_epu16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (uint16_t) ((a.u16[i] + b.u16[i] + 1) >> 1);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_bslli_epi128 (simde__m256i a, const int imm8) {
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u8) / sizeof(r.u8[0])) ; i++) {
+    const int e = (int) (i & 15) - imm8;
+    r.u8[i] = (e >= 0) ? a.u8[(int) i - imm8] : 0;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_bslli_epi128(a, imm8) SIMDE__M256I_C(_mm256_bslli_epi128(a.n, imm8))
+#elif defined(SIMDE_SSE2_NATIVE) && defined(__GNUC__)
+#  define simde_mm256_bslli_epi128(a, imm8) (__extension__ ({ \
+      const simde__m256i simde__tmp_mm256_bslli_epi128_a_ = (a); \
+      simde_mm256_set_m128i(simde_mm_bslli_si128(simde__tmp_mm256_bslli_epi128_a_.m128i[1], imm8), \
+                            simde_mm_bslli_si128(simde__tmp_mm256_bslli_epi128_a_.m128i[0], imm8)); }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_bsrli_epi128 (simde__m256i a, const int imm8) {
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u8) / sizeof(r.u8[0])) ; i++) {
+    const int e = (int) (i & 15) + imm8;
+    r.u8[i] = (e < 16) ? a.u8[(int) i + imm8] : 0;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_bsrli_epi128(a, imm8) SIMDE__M256I_C(_mm256_bsrli_epi128(a.n, imm8))
+#elif defined(SIMDE_SSE2_NATIVE) && defined(__GNUC__)
+#  define simde_mm256_bsrli_epi128(a, imm8) (__extension__ ({ \
+      const simde__m256i simde__tmp_mm256_bsrli_epi128_a_ = (a); \
+      simde_mm256_set_m128i(simde_mm_bsrli_si128(simde__tmp_mm256_bsrli_epi128_a_.m128i[1], imm8), \
+                            simde_mm_bsrli_si128(simde__tmp_mm256_bsrli_epi128_a_.m128i[0], imm8)); }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cmpeq_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_cmpeq_epi8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cmpeq_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_cmpeq_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.i8[i] = (a.i8[i] == b.i8[i]) ? ~INT8_C(0) : INT8_C(0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cmpeq_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_cmpeq_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cmpeq_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_cmpeq_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.i16[i] = (a.i16[i] == b.i16[i]) ? ~INT16_C(0) : INT16_C(0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cmpeq_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_cmpeq_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cmpeq_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_cmpeq_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = (a.i32[i] == b.i32[i]) ? ~INT32_C(0) : INT32_C(0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cmpeq_epi64 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_cmpeq_epi64(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cmpeq_epi64(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_cmpeq_epi64(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = (a.i64[i] == b.i64[i]) ? ~INT64_C(0) : INT64_C(0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cmpgt_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_cmpgt_epi8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cmpgt_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_cmpgt_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.i8[i] = (a.i8[i] > b.i8[i]) ? ~INT8_C(0) : INT8_C(0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cmpgt_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_cmpgt_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cmpgt_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_cmpgt_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.i16[i] = (a.i16[i] > b.i16[i]) ? ~INT16_C(0) : INT16_C(0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cmpgt_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_cmpgt_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cmpgt_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_cmpgt_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = (a.i32[i] > b.i32[i]) ? ~INT32_C(0) : INT32_C(0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cmpgt_epi64 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_cmpgt_epi64(a.n, b.n));
+#elif defined(SIMDE_SSE4_2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_cmpgt_epi64(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_cmpgt_epi64(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = (a.i64[i] > b.i64[i]) ? ~INT64_C(0) : INT64_C(0);
+  }
+  return r;
+#endif
+}
+
+/* The gathers are done with one scalar load per element.  For the
+   masked variants the address of each load is selected from either
+   base_addr or the corresponding element of src, so every element
+   takes the same path and elements which are masked off never touch
+   the memory they would have been gathered from (just like the
+   native instructions, which don't fault on masked elements). */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_i32gather_epi32 (int32_t const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale);
+    int32_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i32gather_epi32(base_addr, vindex, scale) SIMDE__M128I_C(_mm_i32gather_epi32((int const*) (base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_i32gather_epi32 (int32_t const* base_addr, simde__m256i vindex, const int scale) {
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale);
+    int32_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i32gather_epi32(base_addr, vindex, scale) SIMDE__M256I_C(_mm256_i32gather_epi32((int const*) (base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_i32gather_epi64 (int64_t const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale);
+    int64_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i32gather_epi64(base_addr, vindex, scale) SIMDE__M128I_C(_mm_i32gather_epi64((long long const*) (base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_i32gather_epi64 (int64_t const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale);
+    int64_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i32gather_epi64(base_addr, vindex, scale) SIMDE__M256I_C(_mm256_i32gather_epi64((long long const*) (base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_i32gather_pd (simde_float64 const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m128d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale);
+    simde_float64 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i32gather_pd(base_addr, vindex, scale) SIMDE__M128D_C(_mm_i32gather_pd((base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_i32gather_pd (simde_float64 const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m256d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale);
+    simde_float64 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i32gather_pd(base_addr, vindex, scale) SIMDE__M256D_C(_mm256_i32gather_pd((base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_i32gather_ps (simde_float32 const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m128 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale);
+    simde_float32 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i32gather_ps(base_addr, vindex, scale) SIMDE__M128_C(_mm_i32gather_ps((base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_i32gather_ps (simde_float32 const* base_addr, simde__m256i vindex, const int scale) {
+  simde__m256 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale);
+    simde_float32 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i32gather_ps(base_addr, vindex, scale) SIMDE__M256_C(_mm256_i32gather_ps((base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_i64gather_epi32 (int32_t const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m128i r = simde_mm_setzero_si128();
+  for (size_t i = 0 ; i < (sizeof(vindex.i64) / sizeof(vindex.i64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale);
+    int32_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i64gather_epi32(base_addr, vindex, scale) SIMDE__M128I_C(_mm_i64gather_epi32((int const*) (base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_i64gather_epi32 (int32_t const* base_addr, simde__m256i vindex, const int scale) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale);
+    int32_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i64gather_epi32(base_addr, vindex, scale) SIMDE__M128I_C(_mm256_i64gather_epi32((int const*) (base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_i64gather_epi64 (int64_t const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale);
+    int64_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i64gather_epi64(base_addr, vindex, scale) SIMDE__M128I_C(_mm_i64gather_epi64((long long const*) (base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_i64gather_epi64 (int64_t const* base_addr, simde__m256i vindex, const int scale) {
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale);
+    int64_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i64gather_epi64(base_addr, vindex, scale) SIMDE__M256I_C(_mm256_i64gather_epi64((long long const*) (base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_i64gather_pd (simde_float64 const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m128d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale);
+    simde_float64 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i64gather_pd(base_addr, vindex, scale) SIMDE__M128D_C(_mm_i64gather_pd((base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_i64gather_pd (simde_float64 const* base_addr, simde__m256i vindex, const int scale) {
+  simde__m256d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale);
+    simde_float64 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i64gather_pd(base_addr, vindex, scale) SIMDE__M256D_C(_mm256_i64gather_pd((base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_i64gather_ps (simde_float32 const* base_addr, simde__m128i vindex, const int scale) {
+  simde__m128 r = simde_mm_setzero_ps();
+  for (size_t i = 0 ; i < (sizeof(vindex.i64) / sizeof(vindex.i64[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale);
+    simde_float32 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i64gather_ps(base_addr, vindex, scale) SIMDE__M128_C(_mm_i64gather_ps((base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_i64gather_ps (simde_float32 const* base_addr, simde__m256i vindex, const int scale) {
+  simde__m128 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    const uint8_t* src_addr = ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale);
+    simde_float32 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i64gather_ps(base_addr, vindex, scale) SIMDE__M128_C(_mm256_i64gather_ps((base_addr), (vindex).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_madd_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_madd_epi16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_madd_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_madd_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maddubs_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_maddubs_epi16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_maddubs_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_maddubs_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_i32gather_epi32 (simde__m128i src, int32_t const* base_addr, simde__m128i vindex, simde__m128i mask, const int scale) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i32[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(int32_t));
+    int32_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i32gather_epi32(src, base_addr, vindex, mask, scale) SIMDE__M128I_C(_mm_mask_i32gather_epi32((src).n, (int const*) (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_i32gather_epi32 (simde__m256i src, int32_t const* base_addr, simde__m256i vindex, simde__m256i mask, const int scale) {
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i32[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(int32_t));
+    int32_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i32gather_epi32(src, base_addr, vindex, mask, scale) SIMDE__M256I_C(_mm256_mask_i32gather_epi32((src).n, (int const*) (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_i32gather_epi64 (simde__m128i src, int64_t const* base_addr, simde__m128i vindex, simde__m128i mask, const int scale) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i64[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(int64_t));
+    int64_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i32gather_epi64(src, base_addr, vindex, mask, scale) SIMDE__M128I_C(_mm_mask_i32gather_epi64((src).n, (long long const*) (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_i32gather_epi64 (simde__m256i src, int64_t const* base_addr, simde__m128i vindex, simde__m256i mask, const int scale) {
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i64[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(int64_t));
+    int64_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i32gather_epi64(src, base_addr, vindex, mask, scale) SIMDE__M256I_C(_mm256_mask_i32gather_epi64((src).n, (long long const*) (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_i32gather_pd (simde__m128d src, simde_float64 const* base_addr, simde__m128i vindex, simde__m128d mask, const int scale) {
+  simde__m128d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i64[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(simde_float64));
+    simde_float64 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i32gather_pd(src, base_addr, vindex, mask, scale) SIMDE__M128D_C(_mm_mask_i32gather_pd((src).n, (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_i32gather_pd (simde__m256d src, simde_float64 const* base_addr, simde__m128i vindex, simde__m256d mask, const int scale) {
+  simde__m256d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i64[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(simde_float64));
+    simde_float64 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i32gather_pd(src, base_addr, vindex, mask, scale) SIMDE__M256D_C(_mm256_mask_i32gather_pd((src).n, (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_i32gather_ps (simde__m128 src, simde_float32 const* base_addr, simde__m128i vindex, simde__m128 mask, const int scale) {
+  simde__m128 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i32[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(simde_float32));
+    simde_float32 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i32gather_ps(src, base_addr, vindex, mask, scale) SIMDE__M128_C(_mm_mask_i32gather_ps((src).n, (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_i32gather_ps (simde__m256 src, simde_float32 const* base_addr, simde__m256i vindex, simde__m256 mask, const int scale) {
+  simde__m256 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i32[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i32[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(simde_float32));
+    simde_float32 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i32gather_ps(src, base_addr, vindex, mask, scale) SIMDE__M256_C(_mm256_mask_i32gather_ps((src).n, (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_i64gather_epi32 (simde__m128i src, int32_t const* base_addr, simde__m128i vindex, simde__m128i mask, const int scale) {
+  simde__m128i r = simde_mm_setzero_si128();
+  for (size_t i = 0 ; i < (sizeof(vindex.i64) / sizeof(vindex.i64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i32[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(int32_t));
+    int32_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i64gather_epi32(src, base_addr, vindex, mask, scale) SIMDE__M128I_C(_mm_mask_i64gather_epi32((src).n, (int const*) (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_mask_i64gather_epi32 (simde__m128i src, int32_t const* base_addr, simde__m256i vindex, simde__m128i mask, const int scale) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i32[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(int32_t));
+    int32_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i64gather_epi32(src, base_addr, vindex, mask, scale) SIMDE__M128I_C(_mm256_mask_i64gather_epi32((src).n, (int const*) (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_i64gather_epi64 (simde__m128i src, int64_t const* base_addr, simde__m128i vindex, simde__m128i mask, const int scale) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i64[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(int64_t));
+    int64_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i64gather_epi64(src, base_addr, vindex, mask, scale) SIMDE__M128I_C(_mm_mask_i64gather_epi64((src).n, (long long const*) (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_i64gather_epi64 (simde__m256i src, int64_t const* base_addr, simde__m256i vindex, simde__m256i mask, const int scale) {
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i64[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(int64_t));
+    int64_t v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.i64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i64gather_epi64(src, base_addr, vindex, mask, scale) SIMDE__M256I_C(_mm256_mask_i64gather_epi64((src).n, (long long const*) (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_i64gather_pd (simde__m128d src, simde_float64 const* base_addr, simde__m128i vindex, simde__m128d mask, const int scale) {
+  simde__m128d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i64[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(simde_float64));
+    simde_float64 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i64gather_pd(src, base_addr, vindex, mask, scale) SIMDE__M128D_C(_mm_mask_i64gather_pd((src).n, (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_i64gather_pd (simde__m256d src, simde_float64 const* base_addr, simde__m256i vindex, simde__m256d mask, const int scale) {
+  simde__m256d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i64[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(simde_float64));
+    simde_float64 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f64[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i64gather_pd(src, base_addr, vindex, mask, scale) SIMDE__M256D_C(_mm256_mask_i64gather_pd((src).n, (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_i64gather_ps (simde__m128 src, simde_float32 const* base_addr, simde__m128i vindex, simde__m128 mask, const int scale) {
+  simde__m128 r = simde_mm_setzero_ps();
+  for (size_t i = 0 ; i < (sizeof(vindex.i64) / sizeof(vindex.i64[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i32[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(simde_float32));
+    simde_float32 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i64gather_ps(src, base_addr, vindex, mask, scale) SIMDE__M128_C(_mm_mask_i64gather_ps((src).n, (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_mask_i64gather_ps (simde__m128 src, simde_float32 const* base_addr, simde__m256i vindex, simde__m128 mask, const int scale) {
+  simde__m128 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    const uint8_t* src_addr = (mask.i32[i] < 0) ?
+      ((const uint8_t*) base_addr) + ((ptrdiff_t) vindex.i64[i] * scale) :
+      ((const uint8_t*) &src) + (i * sizeof(simde_float32));
+    simde_float32 v;
+    memcpy(&v, src_addr, sizeof(v));
+    r.f32[i] = v;
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i64gather_ps(src, base_addr, vindex, mask, scale) SIMDE__M128_C(_mm256_mask_i64gather_ps((src).n, (base_addr), (vindex).n, (mask).n, scale))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_max_epi8(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_max_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_max_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.i8[i] = (a.i8[i] > b.i8[i]) ? a.i8[i] : b.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_max_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_max_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_max_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.i16[i] = (a.i16[i] > b.i16[i]) ? a.i16[i] : b.i16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_max_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_max_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_max_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = (a.i32[i] > b.i32[i]) ? a.i32[i] : b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_max_epu8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_max_epu8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_max_epu8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u8) / sizeof(r.u8[0])) ; i++) {
+    r.u8[i] = (a.u8[i] > b.u8[i]) ? a.u8[i] : b.u8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epu16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_max_epu16(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_max_epu16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_max_epu16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (a.u16[i] > b.u16[i]) ? a.u16[i] : b.u16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epu32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_max_epu32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_max_epu32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_max_epu32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (a.u32[i] > b.u32[i]) ? a.u32[i] : b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_min_epi8(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_min_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_min_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.i8[i] = (a.i8[i] < b.i8[i]) ? a.i8[i] : b.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_min_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_min_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_min_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.i16[i] = (a.i16[i] < b.i16[i]) ? a.i16[i] : b.i16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_min_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_min_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_min_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = (a.i32[i] < b.i32[i]) ? a.i32[i] : b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_min_epu8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_min_epu8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_min_epu8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u8) / sizeof(r.u8[0])) ; i++) {
+    r.u8[i] = (a.u8[i] < b.u8[i]) ? a.u8[i] : b.u8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epu16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_min_epu16(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_min_epu16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_min_epu16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (a.u16[i] < b.u16[i]) ? a.u16[i] : b.u16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epu32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_min_epu32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_min_epu32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_min_epu32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (a.u32[i] < b.u32[i]) ? a.u32[i] : b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm256_movemask_epi8 (simde__m256i a) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_movemask_epi8(a.n);
+#else
+  const uint32_t lo = (uint32_t) simde_mm_movemask_epi8(a.m128i[0]);
+  const uint32_t hi = (uint32_t) simde_mm_movemask_epi8(a.m128i[1]);
+  return (int32_t) (lo | (hi << 16));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mul_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_mul_epi32(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_mul_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_mul_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mul_epu32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_mul_epu32(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_mul_epu32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_mul_epu32(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mulhi_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_mulhi_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_mulhi_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_mulhi_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.u16[i] = (uint16_t) (((uint32_t) (((int32_t) a.i16[i]) * ((int32_t) b.i16[i]))) >> 16);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mulhi_epu16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_mulhi_epu16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_mulhi_epu16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_mulhi_epu16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (uint16_t) ((((uint32_t) a.u16[i]) * ((uint32_t) b.u16[i])) >> 16);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mullo_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_mullo_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_mullo_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_mullo_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.u16[i] = (uint16_t) (((uint32_t) a.u16[i]) * ((uint32_t) b.u16[i]));
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mullo_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_mullo_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_mullo_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_mullo_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.u32[i] = a.u32[i] * b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_or_si256 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_or_si256(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_or_si128(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_or_si128(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] | b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_packs_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_packs_epi16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_packs_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_packs_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_packs_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_packs_epi32(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_packs_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_packs_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_packus_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_packus_epi16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_packus_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_packus_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_packus_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_packus_epi32(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_packus_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_packus_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_permute4x64_epi64 (simde__m256i a, const int imm8) {
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[(imm8 >> (i * 2)) & 3];
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_permute4x64_epi64(a, imm8) SIMDE__M256I_C(_mm256_permute4x64_epi64(a.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm256_permute4x64_epi64(a, imm8) (__extension__ ({ \
+      const simde__m256i simde__tmp_mm256_permute4x64_epi64_a_ = (a); \
+      (simde__m256i) { .i64 = SIMDE__SHUFFLE_VECTOR(64, 32, simde__tmp_mm256_permute4x64_epi64_a_.i64, simde__tmp_mm256_permute4x64_epi64_a_.i64, \
+          (((imm8)     ) & 3), (((imm8) >> 2) & 3), \
+          (((imm8) >> 4) & 3), (((imm8) >> 6) & 3)) }; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_permute4x64_pd (simde__m256d a, const int imm8) {
+  simde__m256d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[(imm8 >> (i * 2)) & 3];
+  }
+  return r;
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_permute4x64_pd(a, imm8) SIMDE__M256D_C(_mm256_permute4x64_pd(a.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm256_permute4x64_pd(a, imm8) (__extension__ ({ \
+      const simde__m256d simde__tmp_mm256_permute4x64_pd_a_ = (a); \
+      (simde__m256d) { .f64 = SIMDE__SHUFFLE_VECTOR(64, 32, simde__tmp_mm256_permute4x64_pd_a_.f64, simde__tmp_mm256_permute4x64_pd_a_.f64, \
+          (((imm8)     ) & 3), (((imm8) >> 2) & 3), \
+          (((imm8) >> 4) & 3), (((imm8) >> 6) & 3)) }; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_permutevar8x32_epi32 (simde__m256i a, simde__m256i idx) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_permutevar8x32_epi32(a.n, idx.n));
+#else
+  simde__m256i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[idx.i32[i] & 7];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_permutevar8x32_ps (simde__m256 a, simde__m256i idx) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256_C(_mm256_permutevar8x32_ps(a.n, idx.n));
+#else
+  simde__m256 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[idx.i32[i] & 7];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sad_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_sad_epu8(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_sad_epu8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_sad_epu8(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shuffle_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_shuffle_epi8(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_shuffle_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_shuffle_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+/* The variable shifts differ from the C shift operators in that a count
+   greater than or equal to the element width is well-defined: logical
+   shifts produce zero and arithmetic shifts fill with the sign bit.
+   With GCC-style vector extensions the count is masked to the element
+   width (so the shift itself is defined) and the out-of-range elements
+   are cleared with a compare mask, which lets the compiler map the
+   whole thing onto the target's variable shift instructions. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sllv_epi32 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M128I_C(_mm_sllv_epi32(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m128i r;
+  r.u32 = (a.u32 << (count.u32 & 31)) & ((__typeof__(r.u32)) (count.u32 < 32));
+  return r;
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (count.u32[i] < 32) ? (a.u32[i] << count.u32[i]) : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sllv_epi32 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_sllv_epi32(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m256i r;
+  r.u32 = (a.u32 << (count.u32 & 31)) & ((__typeof__(r.u32)) (count.u32 < 32));
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (count.u32[i] < 32) ? (a.u32[i] << count.u32[i]) : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sllv_epi64 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M128I_C(_mm_sllv_epi64(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m128i r;
+  r.u64 = (a.u64 << (count.u64 & 63)) & ((__typeof__(r.u64)) (count.u64 < 64));
+  return r;
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = (count.u64[i] < 64) ? (a.u64[i] << count.u64[i]) : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sllv_epi64 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_sllv_epi64(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m256i r;
+  r.u64 = (a.u64 << (count.u64 & 63)) & ((__typeof__(r.u64)) (count.u64 < 64));
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = (count.u64[i] < 64) ? (a.u64[i] << count.u64[i]) : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srav_epi32 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M128I_C(_mm_srav_epi32(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m128i r;
+  const __typeof__(count.u32) in_range = (__typeof__(count.u32)) (count.u32 < 32);
+  r.i32 = a.i32 >> ((__typeof__(r.i32)) ((count.u32 & in_range) | (~in_range & 31)));
+  return r;
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[i] >> ((count.u32[i] < 32) ? count.u32[i] : 31);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srav_epi32 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_srav_epi32(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m256i r;
+  const __typeof__(count.u32) in_range = (__typeof__(count.u32)) (count.u32 < 32);
+  r.i32 = a.i32 >> ((__typeof__(r.i32)) ((count.u32 & in_range) | (~in_range & 31)));
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[i] >> ((count.u32[i] < 32) ? count.u32[i] : 31);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srlv_epi32 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M128I_C(_mm_srlv_epi32(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m128i r;
+  r.u32 = (a.u32 >> (count.u32 & 31)) & ((__typeof__(r.u32)) (count.u32 < 32));
+  return r;
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (count.u32[i] < 32) ? (a.u32[i] >> count.u32[i]) : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srlv_epi32 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_srlv_epi32(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m256i r;
+  r.u32 = (a.u32 >> (count.u32 & 31)) & ((__typeof__(r.u32)) (count.u32 < 32));
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (count.u32[i] < 32) ? (a.u32[i] >> count.u32[i]) : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srlv_epi64 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M128I_C(_mm_srlv_epi64(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m128i r;
+  r.u64 = (a.u64 >> (count.u64 & 63)) & ((__typeof__(r.u64)) (count.u64 < 64));
+  return r;
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = (count.u64[i] < 64) ? (a.u64[i] >> count.u64[i]) : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srlv_epi64 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_srlv_epi64(a.n, count.n));
+#elif defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m256i r;
+  r.u64 = (a.u64 >> (count.u64 & 63)) & ((__typeof__(r.u64)) (count.u64 < 64));
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = (count.u64[i] < 64) ? (a.u64[i] >> count.u64[i]) : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sub_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_sub_epi8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_sub_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_sub_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.i8[i] = a.i8[i] - b.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sub_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_sub_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_sub_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_sub_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.i16[i] = a.i16[i] - b.i16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sub_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_sub_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_sub_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_sub_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[i] - b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sub_epi64 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_sub_epi64(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_sub_epi64(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_sub_epi64(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] - b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_subs_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_subs_epi8(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_subs_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_subs_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_subs_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_subs_epi16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_subs_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_subs_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_subs_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_subs_epu8(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_subs_epu8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_subs_epu8(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_subs_epu16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_subs_epu16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_subs_epu16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_subs_epu16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_unpackhi_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_unpackhi_epi8(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_unpackhi_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_unpackhi_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_unpackhi_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_unpackhi_epi16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_unpackhi_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_unpackhi_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_unpackhi_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_unpackhi_epi32(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_unpackhi_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_unpackhi_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_unpackhi_epi64 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_unpackhi_epi64(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_unpackhi_epi64(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_unpackhi_epi64(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_unpacklo_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_unpacklo_epi8(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_unpacklo_epi8(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_unpacklo_epi8(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_unpacklo_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_unpacklo_epi16(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_unpacklo_epi16(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_unpacklo_epi16(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_unpacklo_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_unpacklo_epi32(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_unpacklo_epi32(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_unpacklo_epi32(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_unpacklo_epi64 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_unpacklo_epi64(a.n, b.n));
+#else
+  simde__m256i r;
+  r.m128i[0] = simde_mm_unpacklo_epi64(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_unpacklo_epi64(a.m128i[1], b.m128i[1]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_xor_si256 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return SIMDE__M256I_C(_mm256_xor_si256(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m256i r;
+  r.m128i[0] = simde_mm_xor_si128(a.m128i[0], b.m128i[0]);
+  r.m128i[1] = simde_mm_xor_si128(a.m128i[1], b.m128i[1]);
+  return r;
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] ^ b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__AVX2_H) */
@@ -0,0 +1,2988 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__AVX512F_H)
+#  if !defined(SIMDE__AVX512F_H)
+#    define SIMDE__AVX512F_H
+#  endif
+#  include "avx2.h"
+#  include "fma.h"
+#  include "popcnt.h"
+
+#  if defined(SIMDE_AVX512F_NATIVE)
+#    undef SIMDE_AVX512F_NATIVE
+#  endif
+#  if defined(SIMDE_AVX512F_FORCE_NATIVE)
+#    define SIMDE_AVX512F_NATIVE
+#  elif defined(__AVX512F__) && !defined(SIMDE_AVX512F_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512F_NATIVE
+#  endif
+
+#  if defined(SIMDE_AVX512F_NATIVE) && !defined(SIMDE_AVX2_NATIVE)
+#    if defined(SIMDE_AVX512F_FORCE_NATIVE)
+#      error Native AVX512F support requires native AVX2 support
+#    else
+#      warning Native AVX512F support requires native AVX2 support, disabling
+#      undef SIMDE_AVX512F_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_AVX512F_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <stdint.h>
+#  include <limits.h>
+#  include <stddef.h>
+#  include <string.h>
+
+SIMDE__BEGIN_DECLS
+
+/* The 512-bit types can also be accessed as two 256-bit halves (the
+   m256, m256d and m256i members) or four 128-bit quarters.  Without
+   AVX-512, element-wise functions run the 256-bit version on each
+   half whenever that version isn't itself a plain loop, which means
+   AVX2 or SSE code depending on what the target has. */
+typedef SIMDE__ALIGN(64) union {
+#if defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  int8_t          i8 __attribute__((__vector_size__(64), __may_alias__));
+  int16_t        i16 __attribute__((__vector_size__(64), __may_alias__));
+  int32_t        i32 __attribute__((__vector_size__(64), __may_alias__));
+  int64_t        i64 __attribute__((__vector_size__(64), __may_alias__));
+  uint8_t         u8 __attribute__((__vector_size__(64), __may_alias__));
+  uint16_t       u16 __attribute__((__vector_size__(64), __may_alias__));
+  uint32_t       u32 __attribute__((__vector_size__(64), __may_alias__));
+  uint64_t       u64 __attribute__((__vector_size__(64), __may_alias__));
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128 __attribute__((__vector_size__(64), __may_alias__));
+  simde_uint128 u128 __attribute__((__vector_size__(64), __may_alias__));
+  #endif
+  simde_float32  f32 __attribute__((__vector_size__(64), __may_alias__));
+  simde_float64  f64 __attribute__((__vector_size__(64), __may_alias__));
+#else
+  int8_t         i8[64];
+  int16_t        i16[32];
+  int32_t        i32[16];
+  int64_t        i64[8];
+  uint8_t        u8[64];
+  uint16_t       u16[32];
+  uint32_t       u32[16];
+  uint64_t       u64[8];
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128[4];
+  simde_uint128 u128[4];
+  #endif
+  simde_float32  f32[16];
+  simde_float64  f64[8];
+#endif
+
+  simde__m256    m256[2];
+  simde__m128    m128[4];
+
+#if defined(SIMDE_AVX512F_NATIVE)
+  __m512         n;
+#endif
+} simde__m512;
+
+typedef SIMDE__ALIGN(64) union {
+#if defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  int8_t          i8 __attribute__((__vector_size__(64), __may_alias__));
+  int16_t        i16 __attribute__((__vector_size__(64), __may_alias__));
+  int32_t        i32 __attribute__((__vector_size__(64), __may_alias__));
+  int64_t        i64 __attribute__((__vector_size__(64), __may_alias__));
+  uint8_t         u8 __attribute__((__vector_size__(64), __may_alias__));
+  uint16_t       u16 __attribute__((__vector_size__(64), __may_alias__));
+  uint32_t       u32 __attribute__((__vector_size__(64), __may_alias__));
+  uint64_t       u64 __attribute__((__vector_size__(64), __may_alias__));
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128 __attribute__((__vector_size__(64), __may_alias__));
+  simde_uint128 u128 __attribute__((__vector_size__(64), __may_alias__));
+  #endif
+  simde_float32  f32 __attribute__((__vector_size__(64), __may_alias__));
+  simde_float64  f64 __attribute__((__vector_size__(64), __may_alias__));
+#else
+  int8_t         i8[64];
+  int16_t        i16[32];
+  int32_t        i32[16];
+  int64_t        i64[8];
+  uint8_t        u8[64];
+  uint16_t       u16[32];
+  uint32_t       u32[16];
+  uint64_t       u64[8];
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128[4];
+  simde_uint128 u128[4];
+  #endif
+  simde_float32  f32[16];
+  simde_float64  f64[8];
+#endif
+
+  simde__m256d   m256d[2];
+  simde__m128d   m128d[4];
+
+#if defined(SIMDE_AVX512F_NATIVE)
+  __m512d        n;
+#endif
+} simde__m512d;
+
+typedef SIMDE__ALIGN(64) union {
+#if defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  int8_t          i8 __attribute__((__vector_size__(64), __may_alias__));
+  int16_t        i16 __attribute__((__vector_size__(64), __may_alias__));
+  int32_t        i32 __attribute__((__vector_size__(64), __may_alias__));
+  int64_t        i64 __attribute__((__vector_size__(64), __may_alias__));
+  uint8_t         u8 __attribute__((__vector_size__(64), __may_alias__));
+  uint16_t       u16 __attribute__((__vector_size__(64), __may_alias__));
+  uint32_t       u32 __attribute__((__vector_size__(64), __may_alias__));
+  uint64_t       u64 __attribute__((__vector_size__(64), __may_alias__));
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128 __attribute__((__vector_size__(64), __may_alias__));
+  simde_uint128 u128 __attribute__((__vector_size__(64), __may_alias__));
+  #endif
+  simde_float32  f32 __attribute__((__vector_size__(64), __may_alias__));
+  simde_float64  f64 __attribute__((__vector_size__(64), __may_alias__));
+#else
+  int8_t         i8[64];
+  int16_t        i16[32];
+  int32_t        i32[16];
+  int64_t        i64[8];
+  uint8_t        u8[64];
+  uint16_t       u16[32];
+  uint32_t       u32[16];
+  uint64_t       u64[8];
+  #if defined(SIMDE__HAVE_INT128)
+  simde_int128  i128[4];
+  simde_uint128 u128[4];
+  #endif
+  simde_float32  f32[16];
+  simde_float64  f64[8];
+#endif
+
+  simde__m256i   m256i[2];
+  simde__m128i   m128i[4];
+
+#if defined(SIMDE_AVX512F_NATIVE)
+  __m512i        n;
+#endif
+} simde__m512i;
+
+/* Mask registers hold one bit per element, with bit i corresponding
+   to element i. */
+typedef uint16_t simde__mmask16;
+typedef uint8_t simde__mmask8;
+
+#if defined(SIMDE_AVX512F_NATIVE)
+HEDLEY_STATIC_ASSERT(sizeof(__m512) == sizeof(simde__m512), "__m512 size doesn't match simde__m512 size");
+HEDLEY_STATIC_ASSERT(sizeof(__m512d) == sizeof(simde__m512d), "__m512d size doesn't match simde__m512d size");
+HEDLEY_STATIC_ASSERT(sizeof(__m512i) == sizeof(simde__m512i), "__m512i size doesn't match simde__m512i size");
+HEDLEY_STATIC_ASSERT(sizeof(__mmask16) == sizeof(simde__mmask16), "__mmask16 size doesn't match simde__mmask16 size");
+HEDLEY_STATIC_ASSERT(sizeof(__mmask8) == sizeof(simde__mmask8), "__mmask8 size doesn't match simde__mmask8 size");
+#define SIMDE__M512_C(expr) ((simde__m512) { .n = expr })
+#define SIMDE__M512D_C(expr) ((simde__m512d) { .n = expr })
+#define SIMDE__M512I_C(expr) ((simde__m512i) { .n = expr })
+#endif
+HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512), "simde__m512 size incorrect");
+HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512d), "simde__m512d size incorrect");
+HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512i), "simde__m512i size incorrect");
+
+/* Gather the sign bit of each element into a mask, like AVX512DQ's
+   _mm512_movepi32_mask and _mm512_movepi64_mask.  The compares below
+   use these to turn the result of two 256-bit compares into a mask. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_x_mm512_movepi32_mask (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cmplt_epi32_mask(a.n, _mm512_setzero_si512());
+#elif defined(SIMDE_SSE_NATIVE)
+  return (simde__mmask16) (simde_mm256_movemask_ps(simde_mm256_castsi256_ps(a.m256i[0])) |
+                           (simde_mm256_movemask_ps(simde_mm256_castsi256_ps(a.m256i[1])) << 8));
+#else
+  simde__mmask16 r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.u32) / sizeof(a.u32[0])) ; i++) {
+    r |= (simde__mmask16) ((a.u32[i] >> 31) << i);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_x_mm512_movepi64_mask (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cmplt_epi64_mask(a.n, _mm512_setzero_si512());
+#elif defined(SIMDE_SSE2_NATIVE)
+  return (simde__mmask8) (simde_mm256_movemask_pd(simde_mm256_castsi256_pd(a.m256i[0])) |
+                          (simde_mm256_movemask_pd(simde_mm256_castsi256_pd(a.m256i[1])) << 4));
+#else
+  simde__mmask8 r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.u64) / sizeof(a.u64[0])) ; i++) {
+    r |= (simde__mmask8) ((a.u64[i] >> 63) << i);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mov_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_mov_epi32(src.n, k, a.n));
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : src.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mov_epi32 (simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_mov_epi32(k, a.n));
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mov_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_mov_epi64(src.n, k, a.n));
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : src.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mov_epi64 (simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_mov_epi64(k, a.n));
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_mov_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_mov_pd(src.n, k, a.n));
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : src.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_mov_pd (simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_mov_pd(k, a.n));
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_mov_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_mov_ps(src.n, k, a.n));
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : src.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_mov_ps (simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_mov_ps(k, a.n));
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_abs_epi32 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_abs_epi32(a.n));
+#elif defined(SIMDE_SSSE3_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_abs_epi32(a.m256i[0]);
+  r.m256i[1] = simde_mm256_abs_epi32(a.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.u32[i] = (a.i32[i] < 0) ? -((uint32_t) a.i32[i]) : ((uint32_t) a.i32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_abs_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_abs_epi32(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_abs_epi32(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_abs_epi32 (simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_abs_epi32(k, a.n));
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_abs_epi32(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_add_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_add_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_add_epi32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_add_epi32(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[i] + b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_add_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_add_epi32(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_add_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_add_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_add_epi32(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_add_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_add_epi64 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_add_epi64(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_add_epi64(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_add_epi64(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] + b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_add_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_add_epi64(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_add_epi64(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_add_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_add_epi64(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi64(k, simde_mm512_add_epi64(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_add_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_add_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = simde_mm256_add_pd(a.m256d[0], b.m256d[0]);
+  r.m256d[1] = simde_mm256_add_pd(a.m256d[1], b.m256d[1]);
+  return r;
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] + b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_add_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_add_pd(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_add_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_add_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_add_pd(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_pd(k, simde_mm512_add_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_add_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_add_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m512 r;
+  r.m256[0] = simde_mm256_add_ps(a.m256[0], b.m256[0]);
+  r.m256[1] = simde_mm256_add_ps(a.m256[1], b.m256[1]);
+  return r;
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[i] + b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_add_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_add_ps(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_add_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_add_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_add_ps(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_ps(k, simde_mm512_add_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_and_si512 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_and_si512(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_and_si256(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_and_si256(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] & b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_andnot_si512 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_andnot_si512(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_andnot_si256(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_andnot_si256(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ~(a.i64[i]) & b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_castpd_ps (simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_castpd_ps(a.n));
+#else
+  union {
+    simde__m512d pd;
+    simde__m512 ps;
+  } r = { .pd = a };
+  return r.ps;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_castpd_si512 (simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_castpd_si512(a.n));
+#else
+  union {
+    simde__m512d pd;
+    simde__m512i si512;
+  } r = { .pd = a };
+  return r.si512;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm512_castpd512_pd256 (simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M256D_C(_mm512_castpd512_pd256(a.n));
+#else
+  return a.m256d[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_castps_pd (simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_castps_pd(a.n));
+#else
+  union {
+    simde__m512 ps;
+    simde__m512d pd;
+  } r = { .ps = a };
+  return r.pd;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_castps_si512 (simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_castps_si512(a.n));
+#else
+  union {
+    simde__m512 ps;
+    simde__m512i si512;
+  } r = { .ps = a };
+  return r.si512;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_castps512_ps256 (simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M256_C(_mm512_castps512_ps256(a.n));
+#else
+  return a.m256[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_castsi512_pd (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_castsi512_pd(a.n));
+#else
+  union {
+    simde__m512i si512;
+    simde__m512d pd;
+  } r = { .si512 = a };
+  return r.pd;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_castsi512_ps (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_castsi512_ps(a.n));
+#else
+  union {
+    simde__m512i si512;
+    simde__m512 ps;
+  } r = { .si512 = a };
+  return r.ps;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_castsi512_si256 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M256I_C(_mm512_castsi512_si256(a.n));
+#else
+  return a.m256i[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmp_pd_mask (simde__m512d a, simde__m512d b, const int imm8) {
+#if defined(SIMDE_SSE2_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = (simde_mm256_cmp_pd)(a.m256d[0], b.m256d[0], imm8);
+  r.m256d[1] = (simde_mm256_cmp_pd)(a.m256d[1], b.m256d[1], imm8);
+  return simde_x_mm512_movepi64_mask(simde_mm512_castpd_si512(r));
+#else
+  simde__mmask8 r = 0;
+  const uint8_t p = simde__cmp_predicates[imm8 & 15];
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.f64) / sizeof(a.f64[0])) ; i++) {
+    r |= (simde__mmask8) (((SIMDE__CMP_OUTCOME(a.f64[i], b.f64[i]) & p) ? 1 : 0) << i);
+  }
+  return r;
+#endif
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cmp_pd_mask(a, b, imm8) _mm512_cmp_pd_mask(a.n, b.n, imm8)
+#elif defined(SIMDE_AVX_NATIVE) && defined(__GNUC__)
+#  define simde_mm512_cmp_pd_mask(a, b, imm8) (__extension__ ({ \
+      const simde__m512d simde__tmp_mm512_cmp_pd_mask_a_ = (a); \
+      const simde__m512d simde__tmp_mm512_cmp_pd_mask_b_ = (b); \
+      (simde__mmask8) (simde_mm256_movemask_pd(simde_mm256_cmp_pd(simde__tmp_mm512_cmp_pd_mask_a_.m256d[0], \
+                                                                  simde__tmp_mm512_cmp_pd_mask_b_.m256d[0], imm8)) | \
+              (simde_mm256_movemask_pd(simde_mm256_cmp_pd(simde__tmp_mm512_cmp_pd_mask_a_.m256d[1], \
+                                                          simde__tmp_mm512_cmp_pd_mask_b_.m256d[1], imm8)) << 4)); }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmp_ps_mask (simde__m512 a, simde__m512 b, const int imm8) {
+#if defined(SIMDE_SSE_NATIVE)
+  simde__m512 r;
+  r.m256[0] = (simde_mm256_cmp_ps)(a.m256[0], b.m256[0], imm8);
+  r.m256[1] = (simde_mm256_cmp_ps)(a.m256[1], b.m256[1], imm8);
+  return simde_x_mm512_movepi32_mask(simde_mm512_castps_si512(r));
+#else
+  simde__mmask16 r = 0;
+  const uint8_t p = simde__cmp_predicates[imm8 & 15];
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.f32) / sizeof(a.f32[0])) ; i++) {
+    r |= (simde__mmask16) (((SIMDE__CMP_OUTCOME(a.f32[i], b.f32[i]) & p) ? 1 : 0) << i);
+  }
+  return r;
+#endif
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cmp_ps_mask(a, b, imm8) _mm512_cmp_ps_mask(a.n, b.n, imm8)
+#elif defined(SIMDE_AVX_NATIVE) && defined(__GNUC__)
+#  define simde_mm512_cmp_ps_mask(a, b, imm8) (__extension__ ({ \
+      const simde__m512 simde__tmp_mm512_cmp_ps_mask_a_ = (a); \
+      const simde__m512 simde__tmp_mm512_cmp_ps_mask_b_ = (b); \
+      (simde__mmask16) (simde_mm256_movemask_ps(simde_mm256_cmp_ps(simde__tmp_mm512_cmp_ps_mask_a_.m256[0], \
+                                                                   simde__tmp_mm512_cmp_ps_mask_b_.m256[0], imm8)) | \
+              (simde_mm256_movemask_ps(simde_mm256_cmp_ps(simde__tmp_mm512_cmp_ps_mask_a_.m256[1], \
+                                                          simde__tmp_mm512_cmp_ps_mask_b_.m256[1], imm8)) << 8)); }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpeq_epi32_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cmpeq_epi32_mask(a.n, b.n);
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_cmpeq_epi32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_cmpeq_epi32(a.m256i[1], b.m256i[1]);
+  return simde_x_mm512_movepi32_mask(r);
+#else
+  simde__mmask16 r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.i32) / sizeof(a.i32[0])) ; i++) {
+    r |= (simde__mmask16) (((a.i32[i] == b.i32[i]) ? 1 : 0) << i);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpeq_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_cmpeq_epi32_mask(k1, a.n, b.n);
+#else
+  return k1 & simde_mm512_cmpeq_epi32_mask(a, b);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpeq_epi64_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cmpeq_epi64_mask(a.n, b.n);
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_cmpeq_epi64(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_cmpeq_epi64(a.m256i[1], b.m256i[1]);
+  return simde_x_mm512_movepi64_mask(r);
+#else
+  simde__mmask8 r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.i64) / sizeof(a.i64[0])) ; i++) {
+    r |= (simde__mmask8) (((a.i64[i] == b.i64[i]) ? 1 : 0) << i);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpeq_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_cmpeq_epi64_mask(k1, a.n, b.n);
+#else
+  return k1 & simde_mm512_cmpeq_epi64_mask(a, b);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpgt_epi32_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cmpgt_epi32_mask(a.n, b.n);
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_cmpgt_epi32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_cmpgt_epi32(a.m256i[1], b.m256i[1]);
+  return simde_x_mm512_movepi32_mask(r);
+#else
+  simde__mmask16 r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.i32) / sizeof(a.i32[0])) ; i++) {
+    r |= (simde__mmask16) (((a.i32[i] > b.i32[i]) ? 1 : 0) << i);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpgt_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_cmpgt_epi32_mask(k1, a.n, b.n);
+#else
+  return k1 & simde_mm512_cmpgt_epi32_mask(a, b);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpgt_epi64_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cmpgt_epi64_mask(a.n, b.n);
+#elif defined(SIMDE_SSE4_2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_cmpgt_epi64(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_cmpgt_epi64(a.m256i[1], b.m256i[1]);
+  return simde_x_mm512_movepi64_mask(r);
+#else
+  simde__mmask8 r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.i64) / sizeof(a.i64[0])) ; i++) {
+    r |= (simde__mmask8) (((a.i64[i] > b.i64[i]) ? 1 : 0) << i);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpgt_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_cmpgt_epi64_mask(k1, a.n, b.n);
+#else
+  return k1 & simde_mm512_cmpgt_epi64_mask(a, b);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_div_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_div_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = simde_mm256_div_pd(a.m256d[0], b.m256d[0]);
+  r.m256d[1] = simde_mm256_div_pd(a.m256d[1], b.m256d[1]);
+  return r;
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] / b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_div_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_div_pd(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_div_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_div_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_div_pd(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_pd(k, simde_mm512_div_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_div_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_div_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m512 r;
+  r.m256[0] = simde_mm256_div_ps(a.m256[0], b.m256[0]);
+  r.m256[1] = simde_mm256_div_ps(a.m256[1], b.m256[1]);
+  return r;
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[i] / b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_div_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_div_ps(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_div_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_div_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_div_ps(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_ps(k, simde_mm512_div_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_fmadd_pd (simde__m512d a, simde__m512d b, simde__m512d c) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_fmadd_pd(a.n, b.n, c.n));
+#elif defined(SIMDE_FMA_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = simde_mm256_fmadd_pd(a.m256d[0], b.m256d[0], c.m256d[0]);
+  r.m256d[1] = simde_mm256_fmadd_pd(a.m256d[1], b.m256d[1], c.m256d[1]);
+  return r;
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_fmadd_ps (simde__m512 a, simde__m512 b, simde__m512 c) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_fmadd_ps(a.n, b.n, c.n));
+#elif defined(SIMDE_FMA_NATIVE)
+  simde__m512 r;
+  r.m256[0] = simde_mm256_fmadd_ps(a.m256[0], b.m256[0], c.m256[0]);
+  r.m256[1] = simde_mm256_fmadd_ps(a.m256[1], b.m256[1], c.m256[1]);
+  return r;
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kand (simde__mmask16 a, simde__mmask16 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_kand(a, b);
+#else
+  return (simde__mmask16) (a & b);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kandn (simde__mmask16 a, simde__mmask16 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_kandn(a, b);
+#else
+  return (simde__mmask16) (~a & b);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_knot (simde__mmask16 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_knot(a);
+#else
+  return (simde__mmask16) (~a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kor (simde__mmask16 a, simde__mmask16 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_kor(a, b);
+#else
+  return (simde__mmask16) (a | b);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kxnor (simde__mmask16 a, simde__mmask16 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_kxnor(a, b);
+#else
+  return (simde__mmask16) (~(a ^ b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kxor (simde__mmask16 a, simde__mmask16 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_kxor(a, b);
+#else
+  return (simde__mmask16) (a ^ b);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_load_pd (simde_float64 const mem_addr[HEDLEY_ARRAY_PARAM(8)]) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_load_pd(mem_addr));
+#else
+  simde__m512d r;
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 64);
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_load_ps (simde_float32 const mem_addr[HEDLEY_ARRAY_PARAM(16)]) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_load_ps(mem_addr));
+#else
+  simde__m512 r;
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 64);
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_load_si512 (simde__m512i const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_load_si512(&(mem_addr->n)));
+#else
+  simde__m512i r;
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 64);
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_loadu_pd (simde_float64 const mem_addr[HEDLEY_ARRAY_PARAM(8)]) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_loadu_pd(mem_addr));
+#else
+  simde__m512d r;
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_loadu_ps (simde_float32 const mem_addr[HEDLEY_ARRAY_PARAM(16)]) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_loadu_ps(mem_addr));
+#else
+  simde__m512 r;
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_loadu_si512 (simde__m512i const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_loadu_si512(&(mem_addr->n)));
+#else
+  simde__m512i r;
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+/* Masked loads and stores never touch memory for elements whose mask
+   bit is clear, so they can be used on the tail of an array without
+   reading or writing past the end. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_loadu_epi32 (simde__m512i src, simde__mmask16 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_loadu_epi32(src.n, k, mem_addr));
+#else
+  simde__m512i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? ((volatile int32_t const*) mem_addr)[i] : src.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_loadu_epi32 (simde__mmask16 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_loadu_epi32(k, mem_addr));
+#else
+  simde__m512i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? ((volatile int32_t const*) mem_addr)[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_loadu_epi64 (simde__m512i src, simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_loadu_epi64(src.n, k, mem_addr));
+#else
+  simde__m512i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? ((volatile int64_t const*) mem_addr)[i] : src.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_loadu_epi64 (simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_loadu_epi64(k, mem_addr));
+#else
+  simde__m512i r;
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? ((volatile int64_t const*) mem_addr)[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_loadu_pd (simde__m512d src, simde__mmask8 k, simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_loadu_pd(src.n, k, mem_addr));
+#else
+  simde__m512d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = ((k >> i) & 1) ? ((volatile simde_float64 const*) mem_addr)[i] : src.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_loadu_pd (simde__mmask8 k, simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_loadu_pd(k, mem_addr));
+#else
+  simde__m512d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = ((k >> i) & 1) ? ((volatile simde_float64 const*) mem_addr)[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_loadu_ps (simde__m512 src, simde__mmask16 k, simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_loadu_ps(src.n, k, mem_addr));
+#else
+  simde__m512 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = ((k >> i) & 1) ? ((volatile simde_float32 const*) mem_addr)[i] : src.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_loadu_ps (simde__mmask16 k, simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_loadu_ps(k, mem_addr));
+#else
+  simde__m512 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = ((k >> i) & 1) ? ((volatile simde_float32 const*) mem_addr)[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_max_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_max_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_max_epi32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_max_epi32(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = (a.i32[i] > b.i32[i]) ? a.i32[i] : b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_max_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_max_epi32(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_max_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_max_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_max_epi32(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_max_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_max_epu32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_max_epu32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_max_epu32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_max_epu32(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (a.u32[i] > b.u32[i]) ? a.u32[i] : b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_max_epu32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_max_epu32(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_max_epu32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_max_epu32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_max_epu32(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_max_epu32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_max_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_max_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = simde_mm256_max_pd(a.m256d[0], b.m256d[0]);
+  r.m256d[1] = simde_mm256_max_pd(a.m256d[1], b.m256d[1]);
+  return r;
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = (a.f64[i] > b.f64[i]) ? a.f64[i] : b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_max_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_max_pd(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_max_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_max_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_max_pd(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_pd(k, simde_mm512_max_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_max_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_max_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m512 r;
+  r.m256[0] = simde_mm256_max_ps(a.m256[0], b.m256[0]);
+  r.m256[1] = simde_mm256_max_ps(a.m256[1], b.m256[1]);
+  return r;
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = (a.f32[i] > b.f32[i]) ? a.f32[i] : b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_max_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_max_ps(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_max_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_max_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_max_ps(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_ps(k, simde_mm512_max_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_min_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_min_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_min_epi32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_min_epi32(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = (a.i32[i] < b.i32[i]) ? a.i32[i] : b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_min_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_min_epi32(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_min_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_min_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_min_epi32(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_min_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_min_epu32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_min_epu32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_min_epu32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_min_epu32(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (a.u32[i] < b.u32[i]) ? a.u32[i] : b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_min_epu32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_min_epu32(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_min_epu32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_min_epu32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_min_epu32(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_min_epu32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_min_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_min_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = simde_mm256_min_pd(a.m256d[0], b.m256d[0]);
+  r.m256d[1] = simde_mm256_min_pd(a.m256d[1], b.m256d[1]);
+  return r;
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = (a.f64[i] < b.f64[i]) ? a.f64[i] : b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_min_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_min_pd(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_min_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_min_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_min_pd(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_pd(k, simde_mm512_min_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_min_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_min_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m512 r;
+  r.m256[0] = simde_mm256_min_ps(a.m256[0], b.m256[0]);
+  r.m256[1] = simde_mm256_min_ps(a.m256[1], b.m256[1]);
+  return r;
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = (a.f32[i] < b.f32[i]) ? a.f32[i] : b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_min_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_min_ps(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_min_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_min_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_min_ps(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_ps(k, simde_mm512_min_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mul_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mul_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = simde_mm256_mul_pd(a.m256d[0], b.m256d[0]);
+  r.m256d[1] = simde_mm256_mul_pd(a.m256d[1], b.m256d[1]);
+  return r;
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] * b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_mul_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_mul_pd(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_mul_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_mul_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_mul_pd(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_pd(k, simde_mm512_mul_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mul_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mul_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m512 r;
+  r.m256[0] = simde_mm256_mul_ps(a.m256[0], b.m256[0]);
+  r.m256[1] = simde_mm256_mul_ps(a.m256[1], b.m256[1]);
+  return r;
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[i] * b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_mul_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_mul_ps(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_mul_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_mul_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_mul_ps(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_ps(k, simde_mm512_mul_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mullo_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mullo_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE4_1_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_mullo_epi32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_mullo_epi32(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[i] * b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mullo_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_mullo_epi32(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_mullo_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mullo_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_mullo_epi32(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_mullo_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_or_si512 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_or_si512(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_or_si256(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_or_si256(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] | b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_set_epi32 (int32_t e15, int32_t e14, int32_t e13, int32_t e12,
+                       int32_t e11, int32_t e10, int32_t  e9, int32_t  e8,
+                       int32_t  e7, int32_t  e6, int32_t  e5, int32_t  e4,
+                       int32_t  e3, int32_t  e2, int32_t  e1, int32_t  e0) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_set_epi32(e15, e14, e13, e12,
+                                         e11, e10,  e9,  e8,
+                                          e7,  e6,  e5,  e4,
+                                          e3,  e2,  e1,  e0));
+#else
+  return (simde__m512i) { .i32 = {  e0,  e1,  e2,  e3,
+                                    e4,  e5,  e6,  e7,
+                                    e8,  e9, e10, e11,
+                                   e12, e13, e14, e15 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_set_epi64 (int64_t e7, int64_t e6, int64_t e5, int64_t e4,
+                       int64_t e3, int64_t e2, int64_t e1, int64_t e0) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_set_epi64(e7, e6, e5, e4,
+                                         e3, e2, e1, e0));
+#else
+  return (simde__m512i) { .i64 = { e0, e1, e2, e3,
+                                   e4, e5, e6, e7 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_set_pd (simde_float64 e7, simde_float64 e6, simde_float64 e5, simde_float64 e4,
+                    simde_float64 e3, simde_float64 e2, simde_float64 e1, simde_float64 e0) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_set_pd(e7, e6, e5, e4,
+                                      e3, e2, e1, e0));
+#else
+  return (simde__m512d) { .f64 = { e0, e1, e2, e3,
+                                   e4, e5, e6, e7 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_set_ps (simde_float32 e15, simde_float32 e14, simde_float32 e13, simde_float32 e12,
+                    simde_float32 e11, simde_float32 e10, simde_float32  e9, simde_float32  e8,
+                    simde_float32  e7, simde_float32  e6, simde_float32  e5, simde_float32  e4,
+                    simde_float32  e3, simde_float32  e2, simde_float32  e1, simde_float32  e0) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_set_ps(e15, e14, e13, e12,
+                                     e11, e10,  e9,  e8,
+                                      e7,  e6,  e5,  e4,
+                                      e3,  e2,  e1,  e0));
+#else
+  return (simde__m512) { .f32 = {  e0,  e1,  e2,  e3,
+                                   e4,  e5,  e6,  e7,
+                                   e8,  e9, e10, e11,
+                                  e12, e13, e14, e15 } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_set1_epi32 (int32_t a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_set1_epi32(a));
+#else
+  return (simde__m512i) { .i32 = { a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_set1_epi64 (int64_t a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_set1_epi64(a));
+#else
+  return (simde__m512i) { .i64 = { a, a, a, a, a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_set1_pd (simde_float64 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_set1_pd(a));
+#else
+  return (simde__m512d) { .f64 = { a, a, a, a, a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_set1_ps (simde_float32 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_set1_ps(a));
+#else
+  return (simde__m512) { .f32 = { a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_setzero_pd (void) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_setzero_pd());
+#else
+  return (simde__m512d) { .f64 = { 0.0, } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_setzero_ps (void) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_setzero_ps());
+#else
+  return (simde__m512) { .f32 = { 0.0f, } };
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_setzero_si512 (void) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_setzero_si512());
+#else
+  return (simde__m512i) { .i64 = { 0, } };
+#endif
+}
+
+/* Compress and expand work on 128 bits at a time.  The mask bits for
+   each group of four 32-bit elements pick a simde_mm_shuffle_epi8
+   control from one of these tables, and the groups are then stored
+   (compress) or loaded (expand) at an offset given by the number of
+   selected elements before them.  Unselected bytes are zeroed.  64-bit
+   elements use the same tables with each mask bit doubled. */
+static const SIMDE__ALIGN(16) uint8_t simde__compress_epi32_shuffles[16][16] = {
+  { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80 },
+  { 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80 },
+  { 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80 },
+  { 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f }
+};
+
+static const SIMDE__ALIGN(16) uint8_t simde__expand_epi32_shuffles[16][16] = {
+  { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80 },
+  { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x02, 0x03 },
+  { 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07 },
+  { 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x0b },
+  { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 },
+  { 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b },
+  { 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f }
+};
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_x_kdup_mmask8 (simde__mmask8 k) {
+  uint_fast16_t r = k;
+  r = (r | (r << 4)) & 0x0f0f;
+  r = (r | (r << 2)) & 0x3333;
+  r = (r | (r << 1)) & 0x5555;
+  return (simde__mmask16) (r | (r << 1));
+}
+
+/* Compress the 32-bit elements of n 128-bit vectors into r, which must
+   already be zeroed. */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_x_compress_epi32 (void* r, simde__m128i const a[], size_t n, simde__mmask16 k) {
+  size_t offset = 0;
+  for (size_t i = 0 ; i < n ; i++) {
+    const uint32_t m = (k >> (i * 4)) & 15;
+    simde__m128i* dest = (simde__m128i*) (((uint8_t*) r) + (offset * sizeof(int32_t)));
+    simde_mm_storeu_si128(dest, simde_mm_shuffle_epi8(a[i], simde_mm_load_si128((simde__m128i const*) simde__compress_epi32_shuffles[m])));
+    offset += (size_t) simde_mm_popcnt_u32(m);
+  }
+}
+
+/* Spread the leading 32-bit elements of a out to the elements of r
+   selected by k, zeroing the others.  a must hold n * 4 elements. */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_x_expand_epi32 (simde__m128i r[], void const* a, size_t n, simde__mmask16 k) {
+  size_t offset = 0;
+  for (size_t i = 0 ; i < n ; i++) {
+    const uint32_t m = (k >> (i * 4)) & 15;
+    simde__m128i const* src = (simde__m128i const*) (((uint8_t const*) a) + (offset * sizeof(int32_t)));
+    r[i] = simde_mm_shuffle_epi8(simde_mm_loadu_si128(src), simde_mm_load_si128((simde__m128i const*) simde__expand_epi32_shuffles[m]));
+    offset += (size_t) simde_mm_popcnt_u32(m);
+  }
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_compress_epi32 (simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_compress_epi32(k, a.n));
+#else
+  simde__m512i r = simde_mm512_setzero_si512();
+  simde_x_compress_epi32(&r, a.m128i, 4, k);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_compress_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_compress_epi32(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, (simde__mmask16) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm512_maskz_compress_epi32(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_epi32 (void* base_addr, simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_mask_compressstoreu_epi32(base_addr, k, a.n);
+#else
+  simde__m512i r = simde_mm512_maskz_compress_epi32(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(int32_t));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_compress_epi64 (simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_compress_epi64(k, a.n));
+#else
+  simde__m512i r = simde_mm512_setzero_si512();
+  simde_x_compress_epi32(&r, a.m128i, 4, simde_x_kdup_mmask8(k));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_compress_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_compress_epi64(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_epi64(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm512_maskz_compress_epi64(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_mask_compressstoreu_epi64(base_addr, k, a.n);
+#else
+  simde__m512i r = simde_mm512_maskz_compress_epi64(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(int64_t));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_compress_pd (simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_compress_pd(k, a.n));
+#else
+  simde__m512i ai = simde_mm512_castpd_si512(a);
+  simde__m512i r = simde_mm512_setzero_si512();
+  simde_x_compress_epi32(&r, ai.m128i, 4, simde_x_kdup_mmask8(k));
+  return simde_mm512_castsi512_pd(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_compress_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_compress_pd(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_pd(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm512_maskz_compress_pd(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_pd (simde_float64* base_addr, simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_mask_compressstoreu_pd(base_addr, k, a.n);
+#else
+  simde__m512d r = simde_mm512_maskz_compress_pd(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float64));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_compress_ps (simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_compress_ps(k, a.n));
+#else
+  simde__m512i ai = simde_mm512_castps_si512(a);
+  simde__m512i r = simde_mm512_setzero_si512();
+  simde_x_compress_epi32(&r, ai.m128i, 4, k);
+  return simde_mm512_castsi512_ps(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_compress_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_compress_ps(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_ps(src, (simde__mmask16) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm512_maskz_compress_ps(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_ps (simde_float32* base_addr, simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_mask_compressstoreu_ps(base_addr, k, a.n);
+#else
+  simde__m512 r = simde_mm512_maskz_compress_ps(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float32));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi32 (simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_expand_epi32(k, a.n));
+#else
+  simde__m512i r;
+  simde_x_expand_epi32(r.m128i, &a, 4, k);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_expand_epi32(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_maskz_expand_epi32(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi32 (simde__mmask16 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_expandloadu_epi32(k, mem_addr));
+#else
+  simde__m512i a = simde_mm512_setzero_si512();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(int32_t));
+  return simde_mm512_maskz_expand_epi32(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi32 (simde__m512i src, simde__mmask16 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_expandloadu_epi32(src.n, k, mem_addr));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_maskz_expandloadu_epi32(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi64 (simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_expand_epi64(k, a.n));
+#else
+  simde__m512i r;
+  simde_x_expand_epi32(r.m128i, &a, 4, simde_x_kdup_mmask8(k));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_expand_epi64(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_maskz_expand_epi64(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi64 (simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_expandloadu_epi64(k, mem_addr));
+#else
+  simde__m512i a = simde_mm512_setzero_si512();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(int64_t));
+  return simde_mm512_maskz_expand_epi64(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi64 (simde__m512i src, simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_expandloadu_epi64(src.n, k, mem_addr));
+#else
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_maskz_expandloadu_epi64(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_expand_pd (simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_expand_pd(k, a.n));
+#else
+  simde__m512i r;
+  simde_x_expand_epi32(r.m128i, &a, 4, simde_x_kdup_mmask8(k));
+  return simde_mm512_castsi512_pd(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_expand_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_expand_pd(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_maskz_expand_pd(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_expandloadu_pd (simde__mmask8 k, simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_expandloadu_pd(k, mem_addr));
+#else
+  simde__m512d a = simde_mm512_setzero_pd();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float64));
+  return simde_mm512_maskz_expand_pd(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_expandloadu_pd (simde__m512d src, simde__mmask8 k, simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_expandloadu_pd(src.n, k, mem_addr));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_maskz_expandloadu_pd(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_expand_ps (simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_expand_ps(k, a.n));
+#else
+  simde__m512i r;
+  simde_x_expand_epi32(r.m128i, &a, 4, k);
+  return simde_mm512_castsi512_ps(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_expand_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_expand_ps(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_maskz_expand_ps(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_expandloadu_ps (simde__mmask16 k, simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_expandloadu_ps(k, mem_addr));
+#else
+  simde__m512 a = simde_mm512_setzero_ps();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float32));
+  return simde_mm512_maskz_expand_ps(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_expandloadu_ps (simde__m512 src, simde__mmask16 k, simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_expandloadu_ps(src.n, k, mem_addr));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_maskz_expandloadu_ps(k, mem_addr));
+#endif
+}
+
+/* The reductions combine element i with element i + n, halving n each
+   time.  That is the order the native versions use, so floating-point
+   sums and products round the same way. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_add_epi32 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_add_epi32(a.n);
+#else
+  for (size_t n = (sizeof(a.u32) / sizeof(a.u32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.u32[i] += a.u32[i + n];
+    }
+  }
+  return a.i32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_add_epi32 (simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_reduce_add_epi32(k, a.n);
+#else
+  return simde_mm512_reduce_add_epi32(simde_mm512_maskz_mov_epi32(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_add_epi64 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_add_epi64(a.n);
+#else
+  for (size_t n = (sizeof(a.u64) / sizeof(a.u64[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.u64[i] += a.u64[i + n];
+    }
+  }
+  return a.i64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_add_epi64 (simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_reduce_add_epi64(k, a.n);
+#else
+  return simde_mm512_reduce_add_epi64(simde_mm512_maskz_mov_epi64(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_add_pd (simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_add_pd(a.n);
+#else
+  for (size_t n = (sizeof(a.f64) / sizeof(a.f64[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.f64[i] += a.f64[i + n];
+    }
+  }
+  return a.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_add_pd (simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_reduce_add_pd(k, a.n);
+#else
+  return simde_mm512_reduce_add_pd(simde_mm512_maskz_mov_pd(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_add_ps (simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_add_ps(a.n);
+#else
+  for (size_t n = (sizeof(a.f32) / sizeof(a.f32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.f32[i] += a.f32[i + n];
+    }
+  }
+  return a.f32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_add_ps (simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_reduce_add_ps(k, a.n);
+#else
+  return simde_mm512_reduce_add_ps(simde_mm512_maskz_mov_ps(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_max_epi32 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_max_epi32(a.n);
+#else
+  for (size_t n = (sizeof(a.i32) / sizeof(a.i32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.i32[i] = (a.i32[i + n] > a.i32[i]) ? a.i32[i + n] : a.i32[i];
+    }
+  }
+  return a.i32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_max_epu32 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_max_epu32(a.n);
+#else
+  for (size_t n = (sizeof(a.u32) / sizeof(a.u32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.u32[i] = (a.u32[i + n] > a.u32[i]) ? a.u32[i + n] : a.u32[i];
+    }
+  }
+  return a.u32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_max_pd (simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_max_pd(a.n);
+#else
+  for (size_t n = (sizeof(a.f64) / sizeof(a.f64[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.f64[i] = (a.f64[i + n] > a.f64[i]) ? a.f64[i + n] : a.f64[i];
+    }
+  }
+  return a.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_max_ps (simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_max_ps(a.n);
+#else
+  for (size_t n = (sizeof(a.f32) / sizeof(a.f32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.f32[i] = (a.f32[i + n] > a.f32[i]) ? a.f32[i + n] : a.f32[i];
+    }
+  }
+  return a.f32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_min_epi32 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_min_epi32(a.n);
+#else
+  for (size_t n = (sizeof(a.i32) / sizeof(a.i32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.i32[i] = (a.i32[i + n] < a.i32[i]) ? a.i32[i + n] : a.i32[i];
+    }
+  }
+  return a.i32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_min_epu32 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_min_epu32(a.n);
+#else
+  for (size_t n = (sizeof(a.u32) / sizeof(a.u32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.u32[i] = (a.u32[i + n] < a.u32[i]) ? a.u32[i + n] : a.u32[i];
+    }
+  }
+  return a.u32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_min_pd (simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_min_pd(a.n);
+#else
+  for (size_t n = (sizeof(a.f64) / sizeof(a.f64[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.f64[i] = (a.f64[i + n] < a.f64[i]) ? a.f64[i + n] : a.f64[i];
+    }
+  }
+  return a.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_min_ps (simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_min_ps(a.n);
+#else
+  for (size_t n = (sizeof(a.f32) / sizeof(a.f32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.f32[i] = (a.f32[i + n] < a.f32[i]) ? a.f32[i + n] : a.f32[i];
+    }
+  }
+  return a.f32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_mul_epi32 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_mul_epi32(a.n);
+#else
+  for (size_t n = (sizeof(a.u32) / sizeof(a.u32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.u32[i] *= a.u32[i + n];
+    }
+  }
+  return a.i32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_mul_epi32 (simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_reduce_mul_epi32(k, a.n);
+#else
+  return simde_mm512_reduce_mul_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(1), k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_mul_epi64 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_mul_epi64(a.n);
+#else
+  for (size_t n = (sizeof(a.u64) / sizeof(a.u64[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.u64[i] *= a.u64[i + n];
+    }
+  }
+  return a.i64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_mul_epi64 (simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_reduce_mul_epi64(k, a.n);
+#else
+  return simde_mm512_reduce_mul_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(INT64_C(1)), k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_mul_pd (simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_mul_pd(a.n);
+#else
+  for (size_t n = (sizeof(a.f64) / sizeof(a.f64[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.f64[i] *= a.f64[i + n];
+    }
+  }
+  return a.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_mul_pd (simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_reduce_mul_pd(k, a.n);
+#else
+  return simde_mm512_reduce_mul_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(1.0), k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_mul_ps (simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_reduce_mul_ps(a.n);
+#else
+  for (size_t n = (sizeof(a.f32) / sizeof(a.f32[0])) / 2 ; n > 0 ; n /= 2) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < n ; i++) {
+      a.f32[i] *= a.f32[i + n];
+    }
+  }
+  return a.f32[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_mul_ps (simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mask_reduce_mul_ps(k, a.n);
+#else
+  return simde_mm512_reduce_mul_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(1.0f), k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_sqrt_pd (simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_sqrt_pd(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = simde_mm256_sqrt_pd(a.m256d[0]);
+  r.m256d[1] = simde_mm256_sqrt_pd(a.m256d[1]);
+  return r;
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = sqrt(a.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_sqrt_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_sqrt_pd(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_sqrt_pd(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_sqrt_pd (simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_sqrt_pd(k, a.n));
+#else
+  return simde_mm512_maskz_mov_pd(k, simde_mm512_sqrt_pd(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_sqrt_ps (simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_sqrt_ps(a.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m512 r;
+  r.m256[0] = simde_mm256_sqrt_ps(a.m256[0]);
+  r.m256[1] = simde_mm256_sqrt_ps(a.m256[1]);
+  return r;
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = sqrtf(a.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_sqrt_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_sqrt_ps(src.n, k, a.n));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_sqrt_ps(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_sqrt_ps (simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_sqrt_ps(k, a.n));
+#else
+  return simde_mm512_maskz_mov_ps(k, simde_mm512_sqrt_ps(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_store_pd (simde_float64 mem_addr[HEDLEY_ARRAY_PARAM(8)], simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_store_pd(mem_addr, a.n);
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 64);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_store_ps (simde_float32 mem_addr[HEDLEY_ARRAY_PARAM(16)], simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_store_ps(mem_addr, a.n);
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 64);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_store_si512 (simde__m512i* mem_addr, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_store_si512(&(mem_addr->n), a.n);
+#else
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 64);
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_storeu_pd (simde_float64 mem_addr[HEDLEY_ARRAY_PARAM(8)], simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_storeu_pd(mem_addr, a.n);
+#else
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_storeu_ps (simde_float32 mem_addr[HEDLEY_ARRAY_PARAM(16)], simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_storeu_ps(mem_addr, a.n);
+#else
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_storeu_si512 (simde__m512i* mem_addr, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_storeu_si512(&(mem_addr->n), a.n);
+#else
+  memcpy(mem_addr, &a, sizeof(a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_storeu_epi32 (void* mem_addr, simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_mask_storeu_epi32(mem_addr, k, a.n);
+#else
+  for (size_t i = 0 ; i < (sizeof(a.i32) / sizeof(a.i32[0])) ; i++) {
+    if ((k >> i) & 1) {
+      ((int32_t*) mem_addr)[i] = a.i32[i];
+    }
+  }
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_storeu_epi64 (void* mem_addr, simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_mask_storeu_epi64(mem_addr, k, a.n);
+#else
+  for (size_t i = 0 ; i < (sizeof(a.i64) / sizeof(a.i64[0])) ; i++) {
+    if ((k >> i) & 1) {
+      ((int64_t*) mem_addr)[i] = a.i64[i];
+    }
+  }
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_storeu_pd (simde_float64* mem_addr, simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_mask_storeu_pd(mem_addr, k, a.n);
+#else
+  for (size_t i = 0 ; i < (sizeof(a.f64) / sizeof(a.f64[0])) ; i++) {
+    if ((k >> i) & 1) {
+      mem_addr[i] = a.f64[i];
+    }
+  }
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_storeu_ps (simde_float32* mem_addr, simde__mmask16 k, simde__m512 a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  _mm512_mask_storeu_ps(mem_addr, k, a.n);
+#else
+  for (size_t i = 0 ; i < (sizeof(a.f32) / sizeof(a.f32[0])) ; i++) {
+    if ((k >> i) & 1) {
+      mem_addr[i] = a.f32[i];
+    }
+  }
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sub_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_sub_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_sub_epi32(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_sub_epi32(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[i] - b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sub_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_sub_epi32(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_sub_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sub_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_sub_epi32(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_sub_epi32(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sub_epi64 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_sub_epi64(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_sub_epi64(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_sub_epi64(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] - b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sub_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_mask_sub_epi64(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_sub_epi64(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sub_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_maskz_sub_epi64(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_epi64(k, simde_mm512_sub_epi64(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_sub_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_sub_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512d r;
+  r.m256d[0] = simde_mm256_sub_pd(a.m256d[0], b.m256d[0]);
+  r.m256d[1] = simde_mm256_sub_pd(a.m256d[1], b.m256d[1]);
+  return r;
+#else
+  simde__m512d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] - b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_sub_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_mask_sub_pd(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_sub_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_sub_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512D_C(_mm512_maskz_sub_pd(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_pd(k, simde_mm512_sub_pd(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_sub_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_sub_ps(a.n, b.n));
+#elif defined(SIMDE_SSE_NATIVE)
+  simde__m512 r;
+  r.m256[0] = simde_mm256_sub_ps(a.m256[0], b.m256[0]);
+  r.m256[1] = simde_mm256_sub_ps(a.m256[1], b.m256[1]);
+  return r;
+#else
+  simde__m512 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = a.f32[i] - b.f32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_sub_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_mask_sub_ps(src.n, k, a.n, b.n));
+#else
+  return simde_mm512_mask_mov_ps(src, k, simde_mm512_sub_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_sub_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512_C(_mm512_maskz_sub_ps(k, a.n, b.n));
+#else
+  return simde_mm512_maskz_mov_ps(k, simde_mm512_sub_ps(a, b));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_xor_si512 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return SIMDE__M512I_C(_mm512_xor_si512(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  simde__m512i r;
+  r.m256i[0] = simde_mm256_xor_si256(a.m256i[0], b.m256i[0]);
+  r.m256i[1] = simde_mm256_xor_si256(a.m256i[1], b.m256i[1]);
+  return r;
+#else
+  simde__m512i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i64[i] ^ b.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__AVX512F_H) */
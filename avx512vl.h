@@ -0,0 +1,948 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if !defined(SIMDE__AVX512VL_H)
+#  if !defined(SIMDE__AVX512VL_H)
+#    define SIMDE__AVX512VL_H
+#  endif
+#  include "avx512f.h"
+
+#  if defined(SIMDE_AVX512VL_NATIVE)
+#    undef SIMDE_AVX512VL_NATIVE
+#  endif
+#  if defined(SIMDE_AVX512VL_FORCE_NATIVE)
+#    define SIMDE_AVX512VL_NATIVE
+#  elif defined(__AVX512VL__) && !defined(SIMDE_AVX512VL_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512VL_NATIVE
+#  endif
+
+#  if defined(SIMDE_AVX512VL_NATIVE) && !defined(SIMDE_AVX512F_NATIVE)
+#    if defined(SIMDE_AVX512VL_FORCE_NATIVE)
+#      error Native AVX512VL support requires native AVX512F support
+#    else
+#      warning Native AVX512VL support requires native AVX512F support, disabling
+#      undef SIMDE_AVX512VL_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_AVX512VL_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <stdint.h>
+#  include <string.h>
+
+SIMDE__BEGIN_DECLS
+
+/* AVX-512VL provides the masked AVX-512 operations on 128- and 256-bit
+   vectors.  The masks are the same simde__mmask8 type as in AVX-512F;
+   bits past the last element are ignored. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_mov_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_mask_mov_epi32(src.n, k, a.n));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : src.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_mov_epi32 (simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_maskz_mov_epi32(k, a.n));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_mov_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_mask_mov_epi64(src.n, k, a.n));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : src.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_mov_epi64 (simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_maskz_mov_epi64(k, a.n));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_mov_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128D_C(_mm_mask_mov_pd(src.n, k, a.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : src.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_mov_pd (simde__mmask8 k, simde__m128d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128D_C(_mm_maskz_mov_pd(k, a.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_mov_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128_C(_mm_mask_mov_ps(src.n, k, a.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : src.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_mov_ps (simde__mmask8 k, simde__m128 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128_C(_mm_maskz_mov_ps(k, a.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_mov_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_mask_mov_epi32(src.n, k, a.n));
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : src.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_mov_epi32 (simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_maskz_mov_epi32(k, a.n));
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_mov_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_mask_mov_epi64(src.n, k, a.n));
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : src.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_mov_epi64 (simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_maskz_mov_epi64(k, a.n));
+#else
+  simde__m256i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_mov_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256D_C(_mm256_mask_mov_pd(src.n, k, a.n));
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : src.i64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_mov_pd (simde__mmask8 k, simde__m256d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256D_C(_mm256_maskz_mov_pd(k, a.n));
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = ((k >> i) & 1) ? a.i64[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_mov_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256_C(_mm256_mask_mov_ps(src.n, k, a.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : src.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_mov_ps (simde__mmask8 k, simde__m256 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256_C(_mm256_maskz_mov_ps(k, a.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = ((k >> i) & 1) ? a.i32[i] : 0;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_compress_epi32 (simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_maskz_compress_epi32(k, a.n));
+#else
+  simde__m128i r = simde_mm_setzero_si128();
+  simde_x_compress_epi32(&r, &a, 1, k);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_compress_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_mask_compress_epi32(src.n, k, a.n));
+#else
+  k &= 0x0f;
+  return simde_mm_mask_mov_epi32(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm_maskz_compress_epi32(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_compressstoreu_epi32 (void* base_addr, simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  _mm_mask_compressstoreu_epi32(base_addr, k, a.n);
+#else
+  k &= 0x0f;
+  simde__m128i r = simde_mm_maskz_compress_epi32(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(int32_t));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expand_epi32 (simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_maskz_expand_epi32(k, a.n));
+#else
+  simde__m128i r;
+  simde_x_expand_epi32(&r, &a, 1, k);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expand_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_mask_expand_epi32(src.n, k, a.n));
+#else
+  return simde_mm_mask_mov_epi32(src, k, simde_mm_maskz_expand_epi32(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expandloadu_epi32 (simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_maskz_expandloadu_epi32(k, mem_addr));
+#else
+  k &= 0x0f;
+  simde__m128i a = simde_mm_setzero_si128();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(int32_t));
+  return simde_mm_maskz_expand_epi32(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expandloadu_epi32 (simde__m128i src, simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_mask_expandloadu_epi32(src.n, k, mem_addr));
+#else
+  return simde_mm_mask_mov_epi32(src, k, simde_mm_maskz_expandloadu_epi32(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_compress_epi64 (simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_maskz_compress_epi64(k, a.n));
+#else
+  simde__m128i r = simde_mm_setzero_si128();
+  simde_x_compress_epi32(&r, &a, 1, simde_x_kdup_mmask8(k));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_compress_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_mask_compress_epi64(src.n, k, a.n));
+#else
+  k &= 0x03;
+  return simde_mm_mask_mov_epi64(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm_maskz_compress_epi64(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  _mm_mask_compressstoreu_epi64(base_addr, k, a.n);
+#else
+  k &= 0x03;
+  simde__m128i r = simde_mm_maskz_compress_epi64(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(int64_t));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expand_epi64 (simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_maskz_expand_epi64(k, a.n));
+#else
+  simde__m128i r;
+  simde_x_expand_epi32(&r, &a, 1, simde_x_kdup_mmask8(k));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expand_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_mask_expand_epi64(src.n, k, a.n));
+#else
+  return simde_mm_mask_mov_epi64(src, k, simde_mm_maskz_expand_epi64(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expandloadu_epi64 (simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_maskz_expandloadu_epi64(k, mem_addr));
+#else
+  k &= 0x03;
+  simde__m128i a = simde_mm_setzero_si128();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(int64_t));
+  return simde_mm_maskz_expand_epi64(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expandloadu_epi64 (simde__m128i src, simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128I_C(_mm_mask_expandloadu_epi64(src.n, k, mem_addr));
+#else
+  return simde_mm_mask_mov_epi64(src, k, simde_mm_maskz_expandloadu_epi64(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_compress_pd (simde__mmask8 k, simde__m128d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128D_C(_mm_maskz_compress_pd(k, a.n));
+#else
+  simde__m128i ai = simde_mm_castpd_si128(a);
+  simde__m128i r = simde_mm_setzero_si128();
+  simde_x_compress_epi32(&r, &ai, 1, simde_x_kdup_mmask8(k));
+  return simde_mm_castsi128_pd(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_compress_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128D_C(_mm_mask_compress_pd(src.n, k, a.n));
+#else
+  k &= 0x03;
+  return simde_mm_mask_mov_pd(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm_maskz_compress_pd(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_compressstoreu_pd (simde_float64* base_addr, simde__mmask8 k, simde__m128d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  _mm_mask_compressstoreu_pd(base_addr, k, a.n);
+#else
+  k &= 0x03;
+  simde__m128d r = simde_mm_maskz_compress_pd(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float64));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_expand_pd (simde__mmask8 k, simde__m128d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128D_C(_mm_maskz_expand_pd(k, a.n));
+#else
+  simde__m128i r;
+  simde_x_expand_epi32(&r, &a, 1, simde_x_kdup_mmask8(k));
+  return simde_mm_castsi128_pd(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_expand_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128D_C(_mm_mask_expand_pd(src.n, k, a.n));
+#else
+  return simde_mm_mask_mov_pd(src, k, simde_mm_maskz_expand_pd(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_expandloadu_pd (simde__mmask8 k, simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128D_C(_mm_maskz_expandloadu_pd(k, mem_addr));
+#else
+  k &= 0x03;
+  simde__m128d a = simde_mm_setzero_pd();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float64));
+  return simde_mm_maskz_expand_pd(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_expandloadu_pd (simde__m128d src, simde__mmask8 k, simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128D_C(_mm_mask_expandloadu_pd(src.n, k, mem_addr));
+#else
+  return simde_mm_mask_mov_pd(src, k, simde_mm_maskz_expandloadu_pd(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_compress_ps (simde__mmask8 k, simde__m128 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128_C(_mm_maskz_compress_ps(k, a.n));
+#else
+  simde__m128i ai = simde_mm_castps_si128(a);
+  simde__m128i r = simde_mm_setzero_si128();
+  simde_x_compress_epi32(&r, &ai, 1, k);
+  return simde_mm_castsi128_ps(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_compress_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128_C(_mm_mask_compress_ps(src.n, k, a.n));
+#else
+  k &= 0x0f;
+  return simde_mm_mask_mov_ps(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm_maskz_compress_ps(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_compressstoreu_ps (simde_float32* base_addr, simde__mmask8 k, simde__m128 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  _mm_mask_compressstoreu_ps(base_addr, k, a.n);
+#else
+  k &= 0x0f;
+  simde__m128 r = simde_mm_maskz_compress_ps(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float32));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_expand_ps (simde__mmask8 k, simde__m128 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128_C(_mm_maskz_expand_ps(k, a.n));
+#else
+  simde__m128i r;
+  simde_x_expand_epi32(&r, &a, 1, k);
+  return simde_mm_castsi128_ps(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_expand_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128_C(_mm_mask_expand_ps(src.n, k, a.n));
+#else
+  return simde_mm_mask_mov_ps(src, k, simde_mm_maskz_expand_ps(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_expandloadu_ps (simde__mmask8 k, simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128_C(_mm_maskz_expandloadu_ps(k, mem_addr));
+#else
+  k &= 0x0f;
+  simde__m128 a = simde_mm_setzero_ps();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float32));
+  return simde_mm_maskz_expand_ps(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_expandloadu_ps (simde__m128 src, simde__mmask8 k, simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M128_C(_mm_mask_expandloadu_ps(src.n, k, mem_addr));
+#else
+  return simde_mm_mask_mov_ps(src, k, simde_mm_maskz_expandloadu_ps(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_compress_epi32 (simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_maskz_compress_epi32(k, a.n));
+#else
+  simde__m256i r = simde_mm256_setzero_si256();
+  simde_x_compress_epi32(&r, a.m128i, 2, k);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_compress_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_mask_compress_epi32(src.n, k, a.n));
+#else
+  return simde_mm256_mask_mov_epi32(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm256_maskz_compress_epi32(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_compressstoreu_epi32 (void* base_addr, simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  _mm256_mask_compressstoreu_epi32(base_addr, k, a.n);
+#else
+  simde__m256i r = simde_mm256_maskz_compress_epi32(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(int32_t));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expand_epi32 (simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_maskz_expand_epi32(k, a.n));
+#else
+  simde__m256i r;
+  simde_x_expand_epi32(r.m128i, &a, 2, k);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expand_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_mask_expand_epi32(src.n, k, a.n));
+#else
+  return simde_mm256_mask_mov_epi32(src, k, simde_mm256_maskz_expand_epi32(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expandloadu_epi32 (simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_maskz_expandloadu_epi32(k, mem_addr));
+#else
+  simde__m256i a = simde_mm256_setzero_si256();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(int32_t));
+  return simde_mm256_maskz_expand_epi32(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expandloadu_epi32 (simde__m256i src, simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_mask_expandloadu_epi32(src.n, k, mem_addr));
+#else
+  return simde_mm256_mask_mov_epi32(src, k, simde_mm256_maskz_expandloadu_epi32(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_compress_epi64 (simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_maskz_compress_epi64(k, a.n));
+#else
+  simde__m256i r = simde_mm256_setzero_si256();
+  simde_x_compress_epi32(&r, a.m128i, 2, simde_x_kdup_mmask8(k));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_compress_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_mask_compress_epi64(src.n, k, a.n));
+#else
+  k &= 0x0f;
+  return simde_mm256_mask_mov_epi64(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm256_maskz_compress_epi64(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  _mm256_mask_compressstoreu_epi64(base_addr, k, a.n);
+#else
+  k &= 0x0f;
+  simde__m256i r = simde_mm256_maskz_compress_epi64(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(int64_t));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expand_epi64 (simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_maskz_expand_epi64(k, a.n));
+#else
+  simde__m256i r;
+  simde_x_expand_epi32(r.m128i, &a, 2, simde_x_kdup_mmask8(k));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expand_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_mask_expand_epi64(src.n, k, a.n));
+#else
+  return simde_mm256_mask_mov_epi64(src, k, simde_mm256_maskz_expand_epi64(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expandloadu_epi64 (simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_maskz_expandloadu_epi64(k, mem_addr));
+#else
+  k &= 0x0f;
+  simde__m256i a = simde_mm256_setzero_si256();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(int64_t));
+  return simde_mm256_maskz_expand_epi64(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expandloadu_epi64 (simde__m256i src, simde__mmask8 k, void const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256I_C(_mm256_mask_expandloadu_epi64(src.n, k, mem_addr));
+#else
+  return simde_mm256_mask_mov_epi64(src, k, simde_mm256_maskz_expandloadu_epi64(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_compress_pd (simde__mmask8 k, simde__m256d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256D_C(_mm256_maskz_compress_pd(k, a.n));
+#else
+  simde__m256i ai = simde_mm256_castpd_si256(a);
+  simde__m256i r = simde_mm256_setzero_si256();
+  simde_x_compress_epi32(&r, ai.m128i, 2, simde_x_kdup_mmask8(k));
+  return simde_mm256_castsi256_pd(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_compress_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256D_C(_mm256_mask_compress_pd(src.n, k, a.n));
+#else
+  k &= 0x0f;
+  return simde_mm256_mask_mov_pd(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm256_maskz_compress_pd(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_compressstoreu_pd (simde_float64* base_addr, simde__mmask8 k, simde__m256d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  _mm256_mask_compressstoreu_pd(base_addr, k, a.n);
+#else
+  k &= 0x0f;
+  simde__m256d r = simde_mm256_maskz_compress_pd(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float64));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_expand_pd (simde__mmask8 k, simde__m256d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256D_C(_mm256_maskz_expand_pd(k, a.n));
+#else
+  simde__m256i r;
+  simde_x_expand_epi32(r.m128i, &a, 2, simde_x_kdup_mmask8(k));
+  return simde_mm256_castsi256_pd(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_expand_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256D_C(_mm256_mask_expand_pd(src.n, k, a.n));
+#else
+  return simde_mm256_mask_mov_pd(src, k, simde_mm256_maskz_expand_pd(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_expandloadu_pd (simde__mmask8 k, simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256D_C(_mm256_maskz_expandloadu_pd(k, mem_addr));
+#else
+  k &= 0x0f;
+  simde__m256d a = simde_mm256_setzero_pd();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float64));
+  return simde_mm256_maskz_expand_pd(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_expandloadu_pd (simde__m256d src, simde__mmask8 k, simde_float64 const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256D_C(_mm256_mask_expandloadu_pd(src.n, k, mem_addr));
+#else
+  return simde_mm256_mask_mov_pd(src, k, simde_mm256_maskz_expandloadu_pd(k, mem_addr));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_compress_ps (simde__mmask8 k, simde__m256 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256_C(_mm256_maskz_compress_ps(k, a.n));
+#else
+  simde__m256i ai = simde_mm256_castps_si256(a);
+  simde__m256i r = simde_mm256_setzero_si256();
+  simde_x_compress_epi32(&r, ai.m128i, 2, k);
+  return simde_mm256_castsi256_ps(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_compress_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256_C(_mm256_mask_compress_ps(src.n, k, a.n));
+#else
+  return simde_mm256_mask_mov_ps(src, (simde__mmask8) ((UINT32_C(1) << simde_mm_popcnt_u32(k)) - 1), simde_mm256_maskz_compress_ps(k, a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_compressstoreu_ps (simde_float32* base_addr, simde__mmask8 k, simde__m256 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  _mm256_mask_compressstoreu_ps(base_addr, k, a.n);
+#else
+  simde__m256 r = simde_mm256_maskz_compress_ps(k, a);
+  memcpy(base_addr, &r, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float32));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_expand_ps (simde__mmask8 k, simde__m256 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256_C(_mm256_maskz_expand_ps(k, a.n));
+#else
+  simde__m256i r;
+  simde_x_expand_epi32(r.m128i, &a, 2, k);
+  return simde_mm256_castsi256_ps(r);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_expand_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256_C(_mm256_mask_expand_ps(src.n, k, a.n));
+#else
+  return simde_mm256_mask_mov_ps(src, k, simde_mm256_maskz_expand_ps(k, a));
+#endif
+}
+
+/* Only the selected number of elements are read from mem_addr. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_expandloadu_ps (simde__mmask8 k, simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256_C(_mm256_maskz_expandloadu_ps(k, mem_addr));
+#else
+  simde__m256 a = simde_mm256_setzero_ps();
+  memcpy(&a, mem_addr, (size_t) simde_mm_popcnt_u32(k) * sizeof(simde_float32));
+  return simde_mm256_maskz_expand_ps(k, a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_expandloadu_ps (simde__m256 src, simde__mmask8 k, simde_float32 const* mem_addr) {
+#if defined(SIMDE_AVX512VL_NATIVE)
+  return SIMDE__M256_C(_mm256_mask_expandloadu_ps(src.n, k, mem_addr));
+#else
+  return simde_mm256_mask_mov_ps(src, k, simde_mm256_maskz_expandloadu_ps(k, mem_addr));
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__AVX512VL_H) */
@@ -0,0 +1,198 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__BMI_H)
+#  if !defined(SIMDE__BMI_H)
+#    define SIMDE__BMI_H
+#  endif
+#  include "popcnt.h"
+
+#  if defined(SIMDE_BMI_NATIVE)
+#    undef SIMDE_BMI_NATIVE
+#  endif
+#  if defined(SIMDE_BMI_FORCE_NATIVE)
+#    define SIMDE_BMI_NATIVE
+#  elif defined(__BMI__) && !defined(SIMDE_BMI_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_BMI_NATIVE
+#  endif
+
+#  if defined(SIMDE_BMI_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <stdint.h>
+
+SIMDE__BEGIN_DECLS
+
+/* These don't use any of the vector types, so they can be used with
+   or without the vector headers. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_andn_u32 (uint32_t a, uint32_t b) {
+#if defined(SIMDE_BMI_NATIVE)
+  return _andn_u32(a, b);
+#else
+  return ~a & b;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_andn_u64 (uint64_t a, uint64_t b) {
+#if defined(SIMDE_BMI_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _andn_u64(a, b);
+#else
+  return ~a & b;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_bextr_u32 (uint32_t a, uint32_t start, uint32_t len) {
+#if defined(SIMDE_BMI_NATIVE)
+  return _bextr_u32(a, start, len);
+#else
+  /* Only the low byte of each operand is used, and out-of-range
+     values are well defined. */
+  start &= 0xff;
+  len &= 0xff;
+
+  if (start >= 32) {
+    return 0;
+  }
+
+  a >>= start;
+  return (len >= 32) ? a : (a & ((UINT32_C(1) << len) - 1));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_bextr_u64 (uint64_t a, uint32_t start, uint32_t len) {
+#if defined(SIMDE_BMI_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _bextr_u64(a, start, len);
+#else
+  start &= 0xff;
+  len &= 0xff;
+
+  if (start >= 64) {
+    return 0;
+  }
+
+  a >>= start;
+  return (len >= 64) ? a : (a & ((UINT64_C(1) << len) - 1));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsi_u32 (uint32_t a) {
+#if defined(SIMDE_BMI_NATIVE)
+  return _blsi_u32(a);
+#else
+  return a & (~a + 1);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsi_u64 (uint64_t a) {
+#if defined(SIMDE_BMI_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _blsi_u64(a);
+#else
+  return a & (~a + 1);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsmsk_u32 (uint32_t a) {
+#if defined(SIMDE_BMI_NATIVE)
+  return _blsmsk_u32(a);
+#else
+  return a ^ (a - 1);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsmsk_u64 (uint64_t a) {
+#if defined(SIMDE_BMI_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _blsmsk_u64(a);
+#else
+  return a ^ (a - 1);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsr_u32 (uint32_t a) {
+#if defined(SIMDE_BMI_NATIVE)
+  return _blsr_u32(a);
+#else
+  return a & (a - 1);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsr_u64 (uint64_t a) {
+#if defined(SIMDE_BMI_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _blsr_u64(a);
+#else
+  return a & (a - 1);
+#endif
+}
+
+/* TZCNT is defined for zero (it returns the operand size), unlike
+   __builtin_ctz, so the zero case is handled separately. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_tzcnt_u32 (uint32_t a) {
+#if defined(SIMDE_BMI_NATIVE)
+  return _tzcnt_u32(a);
+#elif HEDLEY_GCC_HAS_BUILTIN(__builtin_ctz,3,4,0)
+  return (a == 0) ? 32 : (uint32_t) __builtin_ctz(a);
+#else
+  /* Count the bits below the lowest set bit. */
+  return (uint32_t) simde_mm_popcnt_u32((a & (~a + 1)) - 1);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_tzcnt_u64 (uint64_t a) {
+#if defined(SIMDE_BMI_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _tzcnt_u64(a);
+#elif HEDLEY_GCC_HAS_BUILTIN(__builtin_ctzll,3,4,0)
+  return (a == 0) ? 64 : (uint64_t) __builtin_ctzll(a);
+#else
+  return (uint64_t) simde_mm_popcnt_u64((a & (~a + 1)) - 1);
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__BMI_H) */
@@ -0,0 +1,291 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__BMI2_H)
+#  if !defined(SIMDE__BMI2_H)
+#    define SIMDE__BMI2_H
+#  endif
+#  include "simde-common.h"
+
+#  if defined(SIMDE_BMI2_NATIVE)
+#    undef SIMDE_BMI2_NATIVE
+#  endif
+#  if defined(SIMDE_BMI2_FORCE_NATIVE)
+#    define SIMDE_BMI2_NATIVE
+#  elif defined(__BMI2__) && !defined(SIMDE_BMI2_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_BMI2_NATIVE
+#  endif
+
+#  if defined(SIMDE_BMI2_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <stdint.h>
+
+SIMDE__BEGIN_DECLS
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_bzhi_u32 (uint32_t a, uint32_t index) {
+#if defined(SIMDE_BMI2_NATIVE)
+  return _bzhi_u32(a, index);
+#else
+  index &= 0xff;
+  return (index >= 32) ? a : (a & ((UINT32_C(1) << index) - 1));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_bzhi_u64 (uint64_t a, uint32_t index) {
+#if defined(SIMDE_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _bzhi_u64(a, index);
+#else
+  index &= 0xff;
+  return (index >= 64) ? a : (a & ((UINT64_C(1) << index) - 1));
+#endif
+}
+
+/* GCC only provides _mulx_u32 on 32-bit x86 and _mulx_u64 on x86_64;
+   either way it is just a widening multiplication, which the compiler
+   turns into MULX when BMI2 is enabled. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_mulx_u32 (uint32_t a, uint32_t b, uint32_t* hi) {
+#if defined(SIMDE_BMI2_NATIVE) && !defined(SIMDE_ARCH_AMD64)
+  return _mulx_u32(a, b, hi);
+#else
+  const uint64_t r = ((uint64_t) a) * ((uint64_t) b);
+  *hi = (uint32_t) (r >> 32);
+  return (uint32_t) r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_mulx_u64 (uint64_t a, uint64_t b, uint64_t* hi) {
+#if defined(SIMDE_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  unsigned long long h;
+  const uint64_t r = _mulx_u64(a, b, &h);
+  *hi = (uint64_t) h;
+  return r;
+#elif defined(SIMDE__HAVE_INT128)
+  const simde_uint128 r = ((simde_uint128) a) * ((simde_uint128) b);
+  *hi = (uint64_t) (r >> 64);
+  return (uint64_t) r;
+#else
+  const uint64_t al = a & UINT32_MAX, ah = a >> 32;
+  const uint64_t bl = b & UINT32_MAX, bh = b >> 32;
+  const uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+  const uint64_t mid = (ll >> 32) + (lh & UINT32_MAX) + (hl & UINT32_MAX);
+
+  *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+  return (mid << 32) | (ll & UINT32_MAX);
+#endif
+}
+
+/* The portable pdep/pext only visit the set bits of the mask (each
+   iteration clears the lowest one), so they take O(popcount(mask))
+   steps instead of one per bit position; the masks used for rank and
+   select are usually sparse. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_pdep_u32 (uint32_t a, uint32_t mask) {
+#if defined(SIMDE_BMI2_NATIVE)
+  return _pdep_u32(a, mask);
+#else
+  uint32_t r = 0;
+
+  for (uint32_t bit = 1 ; mask != 0 ; bit <<= 1) {
+    if (a & bit) {
+      r |= mask & (~mask + 1);
+    }
+    mask &= mask - 1;
+  }
+
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_pdep_u64 (uint64_t a, uint64_t mask) {
+#if defined(SIMDE_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _pdep_u64(a, mask);
+#else
+  uint64_t r = 0;
+
+  for (uint64_t bit = 1 ; mask != 0 ; bit <<= 1) {
+    if (a & bit) {
+      r |= mask & (~mask + 1);
+    }
+    mask &= mask - 1;
+  }
+
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_pext_u32 (uint32_t a, uint32_t mask) {
+#if defined(SIMDE_BMI2_NATIVE)
+  return _pext_u32(a, mask);
+#else
+  uint32_t r = 0;
+
+  for (uint32_t bit = 1 ; mask != 0 ; bit <<= 1) {
+    if (a & mask & (~mask + 1)) {
+      r |= bit;
+    }
+    mask &= mask - 1;
+  }
+
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_pext_u64 (uint64_t a, uint64_t mask) {
+#if defined(SIMDE_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _pext_u64(a, mask);
+#else
+  uint64_t r = 0;
+
+  for (uint64_t bit = 1 ; mask != 0 ; bit <<= 1) {
+    if (a & mask & (~mask + 1)) {
+      r |= bit;
+    }
+    mask &= mask - 1;
+  }
+
+  return r;
+#endif
+}
+
+/* GCC and clang don't declare _rorx_u32, _sarx_i32, _shlx_u32 and
+   _shrx_u32 (or the 64-bit versions); they emit RORX, SARX, SHLX and
+   SHRX for ordinary rotates and shifts when BMI2 is enabled.  ICC and
+   MSVC do provide them.  Like the instructions, the portable versions
+   mask the count to the operand width. */
+#if defined(SIMDE_BMI2_NATIVE) && (defined(__INTEL_COMPILER) || (defined(_MSC_VER) && !defined(__clang__)))
+#  define SIMDE__BMI2_SHIFT_INTRINSICS
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_rorx_u32 (uint32_t a, const int imm8) {
+  return (a >> (imm8 & 31)) | (a << ((32 - imm8) & 31));
+}
+#if defined(SIMDE__BMI2_SHIFT_INTRINSICS)
+#  define simde_rorx_u32(a, imm8) ((uint32_t) _rorx_u32(a, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_rorx_u64 (uint64_t a, const int imm8) {
+  return (a >> (imm8 & 63)) | (a << ((64 - imm8) & 63));
+}
+#if defined(SIMDE__BMI2_SHIFT_INTRINSICS) && defined(SIMDE_ARCH_AMD64)
+#  define simde_rorx_u64(a, imm8) ((uint64_t) _rorx_u64(a, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_sarx_i32 (int32_t a, uint32_t count) {
+#if defined(SIMDE__BMI2_SHIFT_INTRINSICS)
+  return (int32_t) _sarx_i32(a, count);
+#else
+  return a >> (count & 31);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_sarx_i64 (int64_t a, uint64_t count) {
+#if defined(SIMDE__BMI2_SHIFT_INTRINSICS) && defined(SIMDE_ARCH_AMD64)
+  return (int64_t) _sarx_i64(a, (unsigned int) count);
+#else
+  return a >> (count & 63);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_shlx_u32 (uint32_t a, uint32_t count) {
+#if defined(SIMDE__BMI2_SHIFT_INTRINSICS)
+  return (uint32_t) _shlx_u32(a, count);
+#else
+  return a << (count & 31);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_shlx_u64 (uint64_t a, uint64_t count) {
+#if defined(SIMDE__BMI2_SHIFT_INTRINSICS) && defined(SIMDE_ARCH_AMD64)
+  return (uint64_t) _shlx_u64(a, (unsigned int) count);
+#else
+  return a << (count & 63);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_shrx_u32 (uint32_t a, uint32_t count) {
+#if defined(SIMDE__BMI2_SHIFT_INTRINSICS)
+  return (uint32_t) _shrx_u32(a, count);
+#else
+  return a >> (count & 31);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_shrx_u64 (uint64_t a, uint64_t count) {
+#if defined(SIMDE__BMI2_SHIFT_INTRINSICS) && defined(SIMDE_ARCH_AMD64)
+  return (uint64_t) _shrx_u64(a, (unsigned int) count);
+#else
+  return a >> (count & 63);
+#endif
+}
+
+/* Code written for ICC or MSVC can use the Intel names on compilers
+   which don't declare them. */
+#if defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(SIMDE__BMI2_SHIFT_INTRINSICS)
+#  define _rorx_u32(a, imm8) simde_rorx_u32(a, imm8)
+#  define _rorx_u64(a, imm8) simde_rorx_u64(a, imm8)
+#  define _sarx_i32(a, count) simde_sarx_i32(a, count)
+#  define _sarx_i64(a, count) simde_sarx_i64(a, count)
+#  define _shlx_u32(a, count) simde_shlx_u32(a, count)
+#  define _shlx_u64(a, count) simde_shlx_u64(a, count)
+#  define _shrx_u32(a, count) simde_shrx_u32(a, count)
+#  define _shrx_u64(a, count) simde_shrx_u64(a, count)
+#endif
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__BMI2_H) */
@@ -0,0 +1,126 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__CLMUL_H)
+#  if !defined(SIMDE__CLMUL_H)
+#    define SIMDE__CLMUL_H
+#  endif
+#  include "sse2.h"
+
+#  if defined(SIMDE_PCLMUL_NATIVE)
+#    undef SIMDE_PCLMUL_NATIVE
+#  endif
+#  if defined(SIMDE_PCLMUL_FORCE_NATIVE)
+#    define SIMDE_PCLMUL_NATIVE
+#  elif defined(__PCLMUL__) && !defined(SIMDE_PCLMUL_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_PCLMUL_NATIVE
+#  endif
+
+#  if defined(SIMDE_PCLMUL_NATIVE) && !defined(SIMDE_SSE2_NATIVE)
+#    if defined(SIMDE_PCLMUL_FORCE_NATIVE)
+#      error Native PCLMUL support requires native SSE2 support
+#    else
+#      warning Native PCLMUL support requires native SSE2 support, disabling
+#      undef SIMDE_PCLMUL_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_PCLMUL_NATIVE)
+#    include <wmmintrin.h>
+#  endif
+
+/* The ARMv8 cryptography extension has a 64x64 -> 128-bit polynomial
+   multiply (PMULL). */
+#  if !defined(SIMDE_PCLMUL_NATIVE) && defined(__ARM_NEON) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)) && !defined(SIMDE_PCLMUL_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_PCLMUL_ARM_PMULL
+#    include <arm_neon.h>
+#  endif
+
+#  include <stdint.h>
+#  include <string.h>
+
+SIMDE__BEGIN_DECLS
+
+/* Carry-less 32x32 -> 64-bit multiplication using ordinary integer
+   multiplications.  Each operand is split into four parts holding
+   every fourth bit; with three zero bits between the bits of a part,
+   the carries of a product never reach the next bit that we keep, so
+   the XOR of the right products gives the carry-less result.  There
+   are no branches or table lookups, so this runs in constant time. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_clmul_u32 (uint32_t x, uint32_t y) {
+  const uint64_t x0 = x & UINT32_C(0x11111111), y0 = y & UINT32_C(0x11111111);
+  const uint64_t x1 = x & UINT32_C(0x22222222), y1 = y & UINT32_C(0x22222222);
+  const uint64_t x2 = x & UINT32_C(0x44444444), y2 = y & UINT32_C(0x44444444);
+  const uint64_t x3 = x & UINT32_C(0x88888888), y3 = y & UINT32_C(0x88888888);
+
+  const uint64_t z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+  const uint64_t z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+  const uint64_t z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+  const uint64_t z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+
+  return
+    (z0 & UINT64_C(0x1111111111111111)) |
+    (z1 & UINT64_C(0x2222222222222222)) |
+    (z2 & UINT64_C(0x4444444444444444)) |
+    (z3 & UINT64_C(0x8888888888888888));
+}
+
+/* Carry-less 64x64 -> 128-bit multiplication, one Karatsuba step on
+   top of simde_x_clmul_u32. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_clmul_u64 (uint64_t x, uint64_t y) {
+  simde__m128i r;
+
+#if defined(SIMDE_PCLMUL_ARM_PMULL)
+  const poly128_t p = vmull_p64((poly64_t) x, (poly64_t) y);
+  memcpy(&r, &p, sizeof(r));
+#else
+  const uint32_t xl = (uint32_t) x, xh = (uint32_t) (x >> 32);
+  const uint32_t yl = (uint32_t) y, yh = (uint32_t) (y >> 32);
+
+  const uint64_t lo = simde_x_clmul_u32(xl, yl);
+  const uint64_t hi = simde_x_clmul_u32(xh, yh);
+  const uint64_t mid = simde_x_clmul_u32(xl ^ xh, yl ^ yh) ^ lo ^ hi;
+
+  r.u64[0] = lo ^ (mid << 32);
+  r.u64[1] = hi ^ (mid >> 32);
+#endif
+
+  return r;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_clmulepi64_si128 (simde__m128i a, simde__m128i b, const int imm8) {
+  return simde_x_clmul_u64(a.u64[imm8 & 1], b.u64[(imm8 >> 4) & 1]);
+}
+#if defined(SIMDE_PCLMUL_NATIVE)
+#  define simde_mm_clmulepi64_si128(a, b, imm8) SIMDE__M128I_C(_mm_clmulepi64_si128(a.n, b.n, imm8))
+#endif
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__CLMUL_H) */
@@ -0,0 +1,274 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__F16C_H)
+#  if !defined(SIMDE__F16C_H)
+#    define SIMDE__F16C_H
+#  endif
+#  include "avx.h"
+
+#  if defined(SIMDE_F16C_NATIVE)
+#    undef SIMDE_F16C_NATIVE
+#  endif
+#  if defined(SIMDE_F16C_FORCE_NATIVE)
+#    define SIMDE_F16C_NATIVE
+#  elif defined(__F16C__) && !defined(SIMDE_F16C_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_F16C_NATIVE
+#  endif
+
+#  if defined(SIMDE_F16C_NATIVE) && !defined(SIMDE_AVX_NATIVE)
+#    if defined(SIMDE_F16C_FORCE_NATIVE)
+#      error Native F16C support requires native AVX support
+#    else
+#      warning Native F16C support requires native AVX support, disabling
+#      undef SIMDE_F16C_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_F16C_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+/* AArch64 has instructions to convert to and from half precision, and
+   the compiler uses them for conversions involving __fp16. */
+#  if defined(SIMDE_ARCH_AARCH64) && defined(__ARM_FP16_FORMAT_IEEE)
+#    define SIMDE__HAVE_FP16
+#  endif
+
+#  include <stdint.h>
+#  include <string.h>
+
+SIMDE__BEGIN_DECLS
+
+/* The portable conversions work on the bit patterns of the values
+   with integer operations only.  Every element goes through the same
+   sequence of operations (the special cases are selected at the end
+   rather than branched to), so the loops can be vectorized. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_cvtsh_ss (uint16_t a) {
+#if defined(SIMDE__HAVE_FP16)
+  __fp16 h;
+  memcpy(&h, &a, sizeof(h));
+  return (simde_float32) h;
+#else
+  const uint32_t sign = ((uint32_t) (a & 0x8000)) << 16;
+  const uint32_t em = ((uint32_t) (a & 0x7fff)) << 13;
+  const uint32_t e = em & UINT32_C(0x0f800000);
+
+  /* Rebias the exponent from 15 to 127. */
+  const uint32_t normal = em + UINT32_C(0x38000000);
+
+  /* Infinity and NaN keep the maximum exponent; NaNs are quieted. */
+  const uint32_t special = (em + UINT32_C(0x70000000)) | (((em & UINT32_C(0x007fe000)) != 0) ? UINT32_C(0x00400000) : 0);
+
+  /* Subnormals are m * 2^-24, which is a normal float.  Normalizing m
+     needs the number of leading zeros in its 10 bits; counting them
+     with comparisons keeps everything in integer vector operations. */
+  const uint32_t m = (uint32_t) (a & 0x3ff);
+  const uint32_t lz =
+    (m < 0x200) + (m < 0x100) + (m < 0x080) + (m < 0x040) + (m < 0x020) +
+    (m < 0x010) + (m < 0x008) + (m < 0x004) + (m < 0x002);
+  const uint32_t subnormal = (m != 0) ? (((112 - lz) << 23) | ((m << (14 + lz)) & UINT32_C(0x007fffff))) : 0;
+
+  uint32_t r = (e == UINT32_C(0x0f800000)) ? special : ((e == 0) ? subnormal : normal);
+  r |= sign;
+
+  simde_float32 f;
+  memcpy(&f, &r, sizeof(f));
+  return f;
+#endif
+}
+
+/* rounding must be one of simde_MM_FROUND_TO_NEAREST_INT,
+   simde_MM_FROUND_TO_NEG_INF, simde_MM_FROUND_TO_POS_INF or
+   simde_MM_FROUND_TO_ZERO; see simde_x_cvtps_ph_rounding. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint16_t
+simde_x_cvtss_sh (simde_float32 a, int rounding) {
+  uint32_t u;
+  memcpy(&u, &a, sizeof(u));
+
+  const uint32_t sign = u >> 31;
+  const uint32_t x = u & UINT32_C(0x7fffffff);
+  const uint32_t e = x >> 23;
+
+  /* Values which are normal in half precision are rebiased and lose 13
+     bits of mantissa.  Smaller ones become subnormal: the significand
+     (with the implicit bit) is shifted right by 126 - e, and anything
+     shifted out completely only affects the rounding. */
+  const int subnormal = x < UINT32_C(0x38800000);
+  const uint32_t v = subnormal ? ((x & UINT32_C(0x007fffff)) | ((e != 0) ? UINT32_C(0x00800000) : 0)) : (x - UINT32_C(0x38000000));
+  const uint32_t shift = subnormal ? ((e < 95) ? 31 : (126 - e)) : 13;
+
+  uint32_t q = v >> shift;
+  const uint32_t rem = v & ((UINT32_C(1) << shift) - 1);
+  const uint32_t half = UINT32_C(1) << (shift - 1);
+
+  /* Mantissa carries propagate into the exponent, so rounding up the
+     largest subnormal (or mantissa) gives the next power of two. */
+  uint32_t up, limit;
+  switch (rounding) {
+    case simde_MM_FROUND_TO_NEG_INF:
+      up = (rem != 0) & sign;
+      limit = sign ? 0x7c00 : 0x7bff;
+      break;
+    case simde_MM_FROUND_TO_POS_INF:
+      up = (rem != 0) & !sign;
+      limit = sign ? 0x7bff : 0x7c00;
+      break;
+    case simde_MM_FROUND_TO_ZERO:
+      up = 0;
+      limit = 0x7bff;
+      break;
+    default:
+      up = (rem > half) | ((rem == half) & q);
+      limit = 0x7c00;
+      break;
+  }
+  q += up;
+
+  /* Overflow goes to infinity or the largest finite value, depending
+     on the rounding direction. */
+  q = (q > limit) ? limit : q;
+
+  /* Infinity stays infinity, NaNs are quieted and keep the upper bits
+     of their payload. */
+  q = (x > UINT32_C(0x7f800000)) ? (UINT32_C(0x7e00) | ((x >> 13) & UINT32_C(0x3ff))) : q;
+  q = (x == UINT32_C(0x7f800000)) ? UINT32_C(0x7c00) : q;
+
+  return (uint16_t) ((sign << 15) | q);
+}
+
+/* Bit 2 of the rounding argument to cvtps_ph selects the current (MXCSR)
+   rounding mode; otherwise bits 0 and 1 pick the direction. */
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_x_cvtps_ph_rounding (int rounding) {
+  if (rounding & simde_MM_FROUND_CUR_DIRECTION) {
+    const unsigned int mode = simde_MM_GET_ROUNDING_MODE();
+    if (mode == simde_MM_ROUND_DOWN)
+      return simde_MM_FROUND_TO_NEG_INF;
+    else if (mode == simde_MM_ROUND_UP)
+      return simde_MM_FROUND_TO_POS_INF;
+    else if (mode == simde_MM_ROUND_TOWARD_ZERO)
+      return simde_MM_FROUND_TO_ZERO;
+    else
+      return simde_MM_FROUND_TO_NEAREST_INT;
+  }
+
+  return rounding & 3;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cvtph_ps (simde__m128i a) {
+#if defined(SIMDE_F16C_NATIVE)
+  return SIMDE__M128_C(_mm_cvtph_ps(a.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = simde_x_cvtsh_ss(a.u16[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtph_ps (simde__m128i a) {
+#if defined(SIMDE_F16C_NATIVE)
+  return SIMDE__M256_C(_mm256_cvtph_ps(a.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = simde_x_cvtsh_ss(a.u16[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtps_ph (simde__m128 a, const int rounding) {
+  simde__m128i r = simde_mm_setzero_si128();
+  const int mode = simde_x_cvtps_ph_rounding(rounding);
+
+#if defined(SIMDE__HAVE_FP16)
+  if (mode == simde_x_cvtps_ph_rounding(simde_MM_FROUND_CUR_DIRECTION)) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(a.f32) / sizeof(a.f32[0])) ; i++) {
+      const __fp16 h = (__fp16) a.f32[i];
+      uint16_t b;
+      memcpy(&b, &h, sizeof(b));
+      r.u16[i] = b;
+    }
+    return r;
+  }
+#endif
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a.f32) / sizeof(a.f32[0])) ; i++) {
+    r.u16[i] = simde_x_cvtss_sh(a.f32[i], mode);
+  }
+  return r;
+}
+#if defined(SIMDE_F16C_NATIVE)
+#  define simde_mm_cvtps_ph(a, rounding) SIMDE__M128I_C(_mm_cvtps_ph(a.n, rounding))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_cvtps_ph (simde__m256 a, const int rounding) {
+  simde__m128i r;
+  const int mode = simde_x_cvtps_ph_rounding(rounding);
+
+#if defined(SIMDE__HAVE_FP16)
+  if (mode == simde_x_cvtps_ph_rounding(simde_MM_FROUND_CUR_DIRECTION)) {
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(a.f32) / sizeof(a.f32[0])) ; i++) {
+      const __fp16 h = (__fp16) a.f32[i];
+      uint16_t b;
+      memcpy(&b, &h, sizeof(b));
+      r.u16[i] = b;
+    }
+    return r;
+  }
+#endif
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a.f32) / sizeof(a.f32[0])) ; i++) {
+    r.u16[i] = simde_x_cvtss_sh(a.f32[i], mode);
+  }
+  return r;
+}
+#if defined(SIMDE_F16C_NATIVE)
+#  define simde_mm256_cvtps_ph(a, rounding) SIMDE__M128I_C(_mm256_cvtps_ph(a.n, rounding))
+#endif
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__F16C_H) */
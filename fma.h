@@ -0,0 +1,522 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__FMA_H)
+#  if !defined(SIMDE__FMA_H)
+#    define SIMDE__FMA_H
+#  endif
+#  include "avx.h"
+
+#  if defined(SIMDE_FMA_NATIVE)
+#    undef SIMDE_FMA_NATIVE
+#  endif
+#  if defined(SIMDE_FMA_FORCE_NATIVE)
+#    define SIMDE_FMA_NATIVE
+#  elif defined(__FMA__) && !defined(SIMDE_FMA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_FMA_NATIVE
+#  endif
+
+#  if defined(SIMDE_FMA_NATIVE) && !defined(SIMDE_AVX_NATIVE)
+#    if defined(SIMDE_FMA_FORCE_NATIVE)
+#      error Native FMA support requires native AVX support
+#    else
+#      warning Native FMA support requires native AVX support, disabling
+#      undef SIMDE_FMA_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_FMA_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <math.h>
+
+SIMDE__BEGIN_DECLS
+
+/* The result of a fused multiply-add is rounded only once, so doing a
+   multiplication followed by an addition would give different results
+   for some inputs.  The portable versions use fmaf()/fma() from C99,
+   which are always correctly rounded; compilers which know the target
+   has an FMA instruction (such as x86 with FMA3, or ARMv8's fmla)
+   also vectorize the loops using it.  Note that negating an operand
+   is exact, so the fmsub/fnmadd/fnmsub variants are all one fma(). */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fmadd_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fmadd_pd(a.n, b.n, c.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_fmadd_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256D_C(_mm256_fmadd_pd(a.n, b.n, c.n));
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fmadd_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fmadd_ps(a.n, b.n, c.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_fmadd_ps (simde__m256 a, simde__m256 b, simde__m256 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256_C(_mm256_fmadd_ps(a.n, b.n, c.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fmadd_sd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fmadd_sd(a.n, b.n, c.n));
+#else
+  simde__m128d r = a;
+  r.f64[0] = fma(a.f64[0], b.f64[0], c.f64[0]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fmadd_ss (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fmadd_ss(a.n, b.n, c.n));
+#else
+  simde__m128 r = a;
+  r.f32[0] = fmaf(a.f32[0], b.f32[0], c.f32[0]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fmaddsub_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fmaddsub_pd(a.n, b.n, c.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], (i & 1) ? c.f64[i] : -c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_fmaddsub_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256D_C(_mm256_fmaddsub_pd(a.n, b.n, c.n));
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], (i & 1) ? c.f64[i] : -c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fmaddsub_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fmaddsub_ps(a.n, b.n, c.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], (i & 1) ? c.f32[i] : -c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_fmaddsub_ps (simde__m256 a, simde__m256 b, simde__m256 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256_C(_mm256_fmaddsub_ps(a.n, b.n, c.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], (i & 1) ? c.f32[i] : -c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fmsub_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fmsub_pd(a.n, b.n, c.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], -c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_fmsub_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256D_C(_mm256_fmsub_pd(a.n, b.n, c.n));
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], -c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fmsub_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fmsub_ps(a.n, b.n, c.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], -c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_fmsub_ps (simde__m256 a, simde__m256 b, simde__m256 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256_C(_mm256_fmsub_ps(a.n, b.n, c.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], -c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fmsub_sd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fmsub_sd(a.n, b.n, c.n));
+#else
+  simde__m128d r = a;
+  r.f64[0] = fma(a.f64[0], b.f64[0], -c.f64[0]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fmsub_ss (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fmsub_ss(a.n, b.n, c.n));
+#else
+  simde__m128 r = a;
+  r.f32[0] = fmaf(a.f32[0], b.f32[0], -c.f32[0]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fmsubadd_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fmsubadd_pd(a.n, b.n, c.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], (i & 1) ? -c.f64[i] : c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_fmsubadd_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256D_C(_mm256_fmsubadd_pd(a.n, b.n, c.n));
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(a.f64[i], b.f64[i], (i & 1) ? -c.f64[i] : c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fmsubadd_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fmsubadd_ps(a.n, b.n, c.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], (i & 1) ? -c.f32[i] : c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_fmsubadd_ps (simde__m256 a, simde__m256 b, simde__m256 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256_C(_mm256_fmsubadd_ps(a.n, b.n, c.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(a.f32[i], b.f32[i], (i & 1) ? -c.f32[i] : c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fnmadd_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fnmadd_pd(a.n, b.n, c.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(-a.f64[i], b.f64[i], c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_fnmadd_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256D_C(_mm256_fnmadd_pd(a.n, b.n, c.n));
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(-a.f64[i], b.f64[i], c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fnmadd_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fnmadd_ps(a.n, b.n, c.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(-a.f32[i], b.f32[i], c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_fnmadd_ps (simde__m256 a, simde__m256 b, simde__m256 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256_C(_mm256_fnmadd_ps(a.n, b.n, c.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(-a.f32[i], b.f32[i], c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fnmadd_sd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fnmadd_sd(a.n, b.n, c.n));
+#else
+  simde__m128d r = a;
+  r.f64[0] = fma(-a.f64[0], b.f64[0], c.f64[0]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fnmadd_ss (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fnmadd_ss(a.n, b.n, c.n));
+#else
+  simde__m128 r = a;
+  r.f32[0] = fmaf(-a.f32[0], b.f32[0], c.f32[0]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fnmsub_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fnmsub_pd(a.n, b.n, c.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(-a.f64[i], b.f64[i], -c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_fnmsub_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256D_C(_mm256_fnmsub_pd(a.n, b.n, c.n));
+#else
+  simde__m256d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = fma(-a.f64[i], b.f64[i], -c.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fnmsub_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fnmsub_ps(a.n, b.n, c.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(-a.f32[i], b.f32[i], -c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_fnmsub_ps (simde__m256 a, simde__m256 b, simde__m256 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M256_C(_mm256_fnmsub_ps(a.n, b.n, c.n));
+#else
+  simde__m256 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = fmaf(-a.f32[i], b.f32[i], -c.f32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_fnmsub_sd (simde__m128d a, simde__m128d b, simde__m128d c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128D_C(_mm_fnmsub_sd(a.n, b.n, c.n));
+#else
+  simde__m128d r = a;
+  r.f64[0] = fma(-a.f64[0], b.f64[0], -c.f64[0]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_fnmsub_ss (simde__m128 a, simde__m128 b, simde__m128 c) {
+#if defined(SIMDE_FMA_NATIVE)
+  return SIMDE__M128_C(_mm_fnmsub_ss(a.n, b.n, c.n));
+#else
+  simde__m128 r = a;
+  r.f32[0] = fmaf(-a.f32[0], b.f32[0], -c.f32[0]);
+  return r;
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__FMA_H) */
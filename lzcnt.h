@@ -0,0 +1,88 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__LZCNT_H)
+#  if !defined(SIMDE__LZCNT_H)
+#    define SIMDE__LZCNT_H
+#  endif
+#  include "popcnt.h"
+
+#  if defined(SIMDE_LZCNT_NATIVE)
+#    undef SIMDE_LZCNT_NATIVE
+#  endif
+#  if defined(SIMDE_LZCNT_FORCE_NATIVE)
+#    define SIMDE_LZCNT_NATIVE
+#  elif defined(__LZCNT__) && !defined(SIMDE_LZCNT_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_LZCNT_NATIVE
+#  endif
+
+#  if defined(SIMDE_LZCNT_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <stdint.h>
+
+SIMDE__BEGIN_DECLS
+
+/* LZCNT is defined for zero (it returns the operand size), unlike
+   __builtin_clz, so the zero case is handled separately. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_lzcnt_u32 (uint32_t a) {
+#if defined(SIMDE_LZCNT_NATIVE)
+  return _lzcnt_u32(a);
+#elif HEDLEY_GCC_HAS_BUILTIN(__builtin_clz,3,4,0)
+  return (a == 0) ? 32 : (uint32_t) __builtin_clz(a);
+#else
+  /* Smear the highest set bit downwards and count the zeros left. */
+  a |= a >>  1;
+  a |= a >>  2;
+  a |= a >>  4;
+  a |= a >>  8;
+  a |= a >> 16;
+  return (uint32_t) simde_mm_popcnt_u32(~a);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_lzcnt_u64 (uint64_t a) {
+#if defined(SIMDE_LZCNT_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _lzcnt_u64(a);
+#elif HEDLEY_GCC_HAS_BUILTIN(__builtin_clzll,3,4,0)
+  return (a == 0) ? 64 : (uint64_t) __builtin_clzll(a);
+#else
+  a |= a >>  1;
+  a |= a >>  2;
+  a |= a >>  4;
+  a |= a >>  8;
+  a |= a >> 16;
+  a |= a >> 32;
+  return (uint64_t) simde_mm_popcnt_u64(~a);
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__LZCNT_H) */
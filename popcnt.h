@@ -0,0 +1,115 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__POPCNT_H)
+#  if !defined(SIMDE__POPCNT_H)
+#    define SIMDE__POPCNT_H
+#  endif
+#  include "simde-common.h"
+
+#  if defined(SIMDE_POPCNT_NATIVE)
+#    undef SIMDE_POPCNT_NATIVE
+#  endif
+#  if defined(SIMDE_POPCNT_FORCE_NATIVE)
+#    define SIMDE_POPCNT_NATIVE
+#  elif defined(__POPCNT__) && !defined(SIMDE_POPCNT_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_POPCNT_NATIVE
+#  endif
+
+#  if defined(SIMDE_POPCNT_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  include <stdint.h>
+
+SIMDE__BEGIN_DECLS
+
+/* Without the instruction we still prefer the compiler builtin, since
+   it knows about things like ARM's CNT; the SWAR versions are only
+   for compilers without one. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm_popcnt_u32 (uint32_t a) {
+#if defined(SIMDE_POPCNT_NATIVE)
+  return _mm_popcnt_u32(a);
+#elif HEDLEY_GCC_HAS_BUILTIN(__builtin_popcount,3,4,0)
+  return __builtin_popcount(a);
+#else
+  a = a - ((a >> 1) & UINT32_C(0x55555555));
+  a = (a & UINT32_C(0x33333333)) + ((a >> 2) & UINT32_C(0x33333333));
+  a = (a + (a >> 4)) & UINT32_C(0x0f0f0f0f);
+  return (int32_t) ((a * UINT32_C(0x01010101)) >> 24);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm_popcnt_u64 (uint64_t a) {
+#if defined(SIMDE_POPCNT_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  return _mm_popcnt_u64(a);
+#elif HEDLEY_GCC_HAS_BUILTIN(__builtin_popcountll,3,4,0)
+  return __builtin_popcountll(a);
+#else
+  a = a - ((a >> 1) & UINT64_C(0x5555555555555555));
+  a = (a & UINT64_C(0x3333333333333333)) + ((a >> 2) & UINT64_C(0x3333333333333333));
+  a = (a + (a >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+  return (int64_t) ((a * UINT64_C(0x0101010101010101)) >> 56);
+#endif
+}
+
+/* BSF and BSR are part of the base x86 instruction set rather than
+   any extension, so _bit_scan_forward and _bit_scan_reverse live here
+   with the other bit-counting functions.  The instructions leave the
+   result undefined for zero; we return -1. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_bit_scan_forward (int32_t a) {
+#if HEDLEY_GCC_HAS_BUILTIN(__builtin_ctz,3,4,0)
+  return (a == 0) ? -1 : __builtin_ctz((unsigned int) a);
+#else
+  const uint32_t v = (uint32_t) a;
+  return (a == 0) ? -1 : simde_mm_popcnt_u32((v & (~v + 1)) - 1);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_bit_scan_reverse (int32_t a) {
+#if HEDLEY_GCC_HAS_BUILTIN(__builtin_clz,3,4,0)
+  return (a == 0) ? -1 : 31 - __builtin_clz((unsigned int) a);
+#else
+  uint32_t v = (uint32_t) a;
+  v |= v >>  1;
+  v |= v >>  2;
+  v |= v >>  4;
+  v |= v >>  8;
+  v |= v >> 16;
+  return simde_mm_popcnt_u32(v) - 1;
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__POPCNT_H) */
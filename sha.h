@@ -0,0 +1,304 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE__SHA_H)
+#  if !defined(SIMDE__SHA_H)
+#    define SIMDE__SHA_H
+#  endif
+#  include "sse2.h"
+
+#  if defined(SIMDE_SHA_NATIVE)
+#    undef SIMDE_SHA_NATIVE
+#  endif
+#  if defined(SIMDE_SHA_FORCE_NATIVE)
+#    define SIMDE_SHA_NATIVE
+#  elif defined(__SHA__) && !defined(SIMDE_SHA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_SHA_NATIVE
+#  endif
+
+#  if defined(SIMDE_SHA_NATIVE) && !defined(SIMDE_SSE2_NATIVE)
+#    if defined(SIMDE_SHA_FORCE_NATIVE)
+#      error Native SHA support requires native SSE2 support
+#    else
+#      warning Native SHA support requires native SSE2 support, disabling
+#      undef SIMDE_SHA_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_SHA_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+/* The ARMv8 cryptography extension has SHA-1 and SHA-256
+   instructions.  They keep the words in the opposite order and split
+   the work between instructions differently, but everything except
+   simde_mm_sha256rnds2_epu32 (ARM only has a four-round step) maps
+   onto them. */
+#  if !defined(SIMDE_SHA_NATIVE) && defined(SIMDE_SSE2_NEON) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2)) && !defined(SIMDE_SHA_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_SHA_ARM_CRYPTO
+#    include <arm_neon.h>
+#  endif
+
+#  include <stdint.h>
+
+SIMDE__BEGIN_DECLS
+
+#if defined(SIMDE_SHA_ARM_CRYPTO)
+SIMDE__FUNCTION_ATTRIBUTES
+uint32x4_t
+simde_x_sha_reverse_u32 (uint32x4_t a) {
+  a = vrev64q_u32(a);
+  return vextq_u32(a, a, 2);
+}
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_rol32 (uint32_t v, int n) {
+  return (v << n) | (v >> (32 - n));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_ror32 (uint32_t v, int n) {
+  return (v >> n) | (v << (32 - n));
+}
+
+/* The message schedule works on all four words of a vector at once;
+   only the rounds themselves are inherently serial. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_sha1_rol1 (simde__m128i a) {
+  return simde_mm_or_si128(simde_mm_slli_epi32(a, 1), simde_mm_srli_epi32(a, 31));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_sha256_sigma0 (simde__m128i a) {
+  /* ROTR^7(x) ^ ROTR^18(x) ^ SHR^3(x) */
+  return simde_mm_xor_si128(
+    simde_mm_xor_si128(
+      simde_mm_or_si128(simde_mm_srli_epi32(a,  7), simde_mm_slli_epi32(a, 25)),
+      simde_mm_or_si128(simde_mm_srli_epi32(a, 18), simde_mm_slli_epi32(a, 14))),
+    simde_mm_srli_epi32(a, 3));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_sha256_sigma1 (simde__m128i a) {
+  /* ROTR^17(x) ^ ROTR^19(x) ^ SHR^10(x) */
+  return simde_mm_xor_si128(
+    simde_mm_xor_si128(
+      simde_mm_or_si128(simde_mm_srli_epi32(a, 17), simde_mm_slli_epi32(a, 15)),
+      simde_mm_or_si128(simde_mm_srli_epi32(a, 19), simde_mm_slli_epi32(a, 13))),
+    simde_mm_srli_epi32(a, 10));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg1_epu32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SHA_NATIVE)
+  return SIMDE__M128I_C(_mm_sha1msg1_epu32(a.n, b.n));
+#elif defined(SIMDE_SHA_ARM_CRYPTO)
+  simde__m128i r;
+  r.neon_u32 = simde_x_sha_reverse_u32(
+    vsha1su0q_u32(simde_x_sha_reverse_u32(a.neon_u32), simde_x_sha_reverse_u32(b.neon_u32), vdupq_n_u32(0)));
+  return r;
+#else
+  /* W[i] ^ W[i + 2] */
+  return simde_mm_xor_si128(a, simde_mm_unpacklo_epi64(simde_mm_unpackhi_epi64(b, b), a));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg2_epu32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SHA_NATIVE)
+  return SIMDE__M128I_C(_mm_sha1msg2_epu32(a.n, b.n));
+#elif defined(SIMDE_SHA_ARM_CRYPTO)
+  simde__m128i r;
+  r.neon_u32 = simde_x_sha_reverse_u32(
+    vsha1su1q_u32(simde_x_sha_reverse_u32(a.neon_u32), simde_x_sha_reverse_u32(b.neon_u32)));
+  return r;
+#else
+  /* W16..W18 only depend on the inputs; W19 also needs W16, which
+     ends up in the top element. */
+  const simde__m128i t = simde_x_sha1_rol1(simde_mm_xor_si128(a, simde_mm_bslli_si128(b, 4)));
+  return simde_mm_xor_si128(t, simde_x_sha1_rol1(simde_mm_bsrli_si128(t, 12)));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1nexte_epu32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SHA_NATIVE)
+  return SIMDE__M128I_C(_mm_sha1nexte_epu32(a.n, b.n));
+#else
+  simde__m128i r = b;
+  r.u32[3] = b.u32[3] + simde_x_sha_rol32(a.u32[3], 30);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1rnds4_epu32 (simde__m128i a, simde__m128i b, const int func) {
+#if defined(SIMDE_SHA_ARM_CRYPTO)
+  simde__m128i r;
+  const uint32x4_t abcd = simde_x_sha_reverse_u32(a.neon_u32);
+  const uint32x4_t w = simde_x_sha_reverse_u32(b.neon_u32);
+  uint32x4_t t;
+
+  /* The x86 instruction expects E to already be added to the first
+     word, and adds the round constant itself. */
+  switch (func & 3) {
+    case 0:
+      t = vsha1cq_u32(abcd, 0, vaddq_u32(w, vdupq_n_u32(UINT32_C(0x5a827999))));
+      break;
+    case 1:
+      t = vsha1pq_u32(abcd, 0, vaddq_u32(w, vdupq_n_u32(UINT32_C(0x6ed9eba1))));
+      break;
+    case 2:
+      t = vsha1mq_u32(abcd, 0, vaddq_u32(w, vdupq_n_u32(UINT32_C(0x8f1bbcdc))));
+      break;
+    default:
+      t = vsha1pq_u32(abcd, 0, vaddq_u32(w, vdupq_n_u32(UINT32_C(0xca62c1d6))));
+      break;
+  }
+  r.neon_u32 = simde_x_sha_reverse_u32(t);
+  return r;
+#else
+  static const uint32_t k[] = {
+    UINT32_C(0x5a827999), UINT32_C(0x6ed9eba1), UINT32_C(0x8f1bbcdc), UINT32_C(0xca62c1d6)
+  };
+  simde__m128i r;
+  uint32_t A = a.u32[3], B = a.u32[2], C = a.u32[1], D = a.u32[0], E = 0;
+
+  for (int i = 0 ; i < 4 ; i++) {
+    uint32_t f;
+    switch (func & 3) {
+      case 0:
+        f = (B & C) ^ (~B & D);
+        break;
+      case 2:
+        f = (B & C) ^ (B & D) ^ (C & D);
+        break;
+      default:
+        f = B ^ C ^ D;
+        break;
+    }
+
+    const uint32_t T = f + simde_x_sha_rol32(A, 5) + b.u32[3 - i] + E + k[func & 3];
+    E = D;
+    D = C;
+    C = simde_x_sha_rol32(B, 30);
+    B = A;
+    A = T;
+  }
+
+  r.u32[3] = A;
+  r.u32[2] = B;
+  r.u32[1] = C;
+  r.u32[0] = D;
+  return r;
+#endif
+}
+#if defined(SIMDE_SHA_NATIVE)
+#  define simde_mm_sha1rnds4_epu32(a, b, func) SIMDE__M128I_C(_mm_sha1rnds4_epu32(a.n, b.n, func))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg1_epu32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SHA_NATIVE)
+  return SIMDE__M128I_C(_mm_sha256msg1_epu32(a.n, b.n));
+#elif defined(SIMDE_SHA_ARM_CRYPTO)
+  simde__m128i r;
+  r.neon_u32 = vsha256su0q_u32(a.neon_u32, b.neon_u32);
+  return r;
+#else
+  /* W[i] + sigma0(W[i + 1]) */
+  const simde__m128i w = simde_mm_or_si128(simde_mm_bsrli_si128(a, 4), simde_mm_bslli_si128(b, 12));
+  return simde_mm_add_epi32(a, simde_x_sha256_sigma0(w));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg2_epu32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SHA_NATIVE)
+  return SIMDE__M128I_C(_mm_sha256msg2_epu32(a.n, b.n));
+#elif defined(SIMDE_SHA_ARM_CRYPTO)
+  /* SHA256SU1 also adds W[i - 7], which the x86 instruction leaves to
+     the caller, so pass zeros in its place. */
+  simde__m128i r;
+  r.neon_u32 = vsha256su1q_u32(a.neon_u32, vdupq_n_u32(0), vsetq_lane_u32(0, b.neon_u32, 0));
+  return r;
+#else
+  /* W16 and W17 depend on b; W18 and W19 depend on W16 and W17.  The
+     shifted-in zeros are harmless since sigma1(0) == 0. */
+  const simde__m128i t = simde_mm_add_epi32(a, simde_x_sha256_sigma1(simde_mm_bsrli_si128(b, 8)));
+  return simde_mm_add_epi32(t, simde_x_sha256_sigma1(simde_mm_bslli_si128(t, 8)));
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256rnds2_epu32 (simde__m128i a, simde__m128i b, simde__m128i k) {
+#if defined(SIMDE_SHA_NATIVE)
+  return SIMDE__M128I_C(_mm_sha256rnds2_epu32(a.n, b.n, k.n));
+#else
+  simde__m128i r;
+  uint32_t A = b.u32[3], B = b.u32[2], C = a.u32[3], D = a.u32[2];
+  uint32_t E = b.u32[1], F = b.u32[0], G = a.u32[1], H = a.u32[0];
+
+  for (int i = 0 ; i < 2 ; i++) {
+    const uint32_t S1 = simde_x_sha_ror32(E, 6) ^ simde_x_sha_ror32(E, 11) ^ simde_x_sha_ror32(E, 25);
+    const uint32_t ch = (E & F) ^ (~E & G);
+    const uint32_t T1 = H + S1 + ch + k.u32[i];
+    const uint32_t S0 = simde_x_sha_ror32(A, 2) ^ simde_x_sha_ror32(A, 13) ^ simde_x_sha_ror32(A, 22);
+    const uint32_t maj = (A & B) ^ (A & C) ^ (B & C);
+    const uint32_t T2 = S0 + maj;
+
+    H = G;
+    G = F;
+    F = E;
+    E = D + T1;
+    D = C;
+    C = B;
+    B = A;
+    A = T1 + T2;
+  }
+
+  r.u32[3] = A;
+  r.u32[2] = B;
+  r.u32[1] = E;
+  r.u32[0] = F;
+  return r;
+#endif
+}
+
+SIMDE__END_DECLS
+
+#endif /* !defined(SIMDE__SHA_H) */
@@ -43,6 +43,31 @@
 #  define SIMDE__ENABLE_GCC_VEC_EXT
 #endif
 
+/* Select elements from two vectors using compile-time constant
+   indices (like clang's __builtin_shufflevector), which lets the
+   compiler emit a single shuffle instead of per-element moves.  Only
+   usable on the GCC vector extension members of the SIMDe types. */
+#if defined(SIMDE__ENABLE_GCC_VEC_EXT)
+#  if HEDLEY_CLANG_HAS_BUILTIN(__builtin_shufflevector)
+#    define SIMDE__SHUFFLE_VECTOR(elem_size, vec_size, a, b, ...) __builtin_shufflevector(a, b, __VA_ARGS__)
+#  elif HEDLEY_GCC_HAS_BUILTIN(__builtin_shuffle,4,7,0) && !defined(__INTEL_COMPILER)
+#    define SIMDE__SHUFFLE_VECTOR(elem_size, vec_size, a, b, ...) \
+       __builtin_shuffle(a, b, (int##elem_size##_t __attribute__((__vector_size__(vec_size)))) { __VA_ARGS__ })
+#  endif
+#endif
+
+/* Stores (and loads) which hint that the data shouldn't be brought
+   into the cache.  Only defined when the compiler can actually express
+   that, which currently means clang; GCC has no such builtin, so
+   without the native _mm_stream_* functions callers fall back on a
+   normal store. */
+#if HEDLEY_CLANG_HAS_BUILTIN(__builtin_nontemporal_store)
+#  define SIMDE__NONTEMPORAL_STORE(value, ptr) __builtin_nontemporal_store(value, ptr)
+#endif
+#if HEDLEY_CLANG_HAS_BUILTIN(__builtin_nontemporal_load)
+#  define SIMDE__NONTEMPORAL_LOAD(ptr) __builtin_nontemporal_load(ptr)
+#endif
+
 #if !defined(SIMDE_ENABLE_OPENMP) && ((defined(_OPENMP) && (_OPENMP >= 201307L)) || (defined(_OPENMP_SIMD) && (_OPENMP_SIMD >= 201307L)))
 #  define SIMDE_ENABLE_OPENMP
 #endif
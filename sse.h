@@ -956,7 +956,7 @@ simde_mm_extract_pi16 (simde__m64 a, const int imm8) {
 #if defined(SIMDE_SSE_NATIVE)
 #  define simde_mm_extract_pi16(a, imm8) _mm_extract_pi16(a.n, imm8)
 #endif
-#define simde_m_pextrw(a, imm8) simde_mm_extract_pi16(a.n, imm8)
+#define simde_m_pextrw(a, imm8) simde_mm_extract_pi16(a, imm8)
 
 enum {
 #if defined(SIMDE_SSE_NATIVE)
@@ -1019,9 +1019,9 @@ simde_mm_insert_pi16 (simde__m64 a, int16_t i, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE_NATIVE) && !defined(__PGI)
-#  define simde_mm_insert_pi16(a, i, imm8) SIMDE__M64_C(_mm_insert_pi16((a).n, i, imm8));
+#  define simde_mm_insert_pi16(a, i, imm8) SIMDE__M64_C(_mm_insert_pi16((a).n, i, imm8))
 #endif
-#define simde_m_pinsrw(a, i, imm8) SIMDE__M64_C(simde_mm_insert_pi16((a).n, i, imm8));
+#define simde_m_pinsrw(a, i, imm8) simde_mm_insert_pi16(a, i, imm8)
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128
@@ -1416,14 +1416,37 @@ simde_mm_or_ps (simde__m128 a, simde__m128 b) {
 #endif
 }
 
+/* The low two bits of each hint are the temporal locality expected by
+   __builtin_prefetch, and bit 2 requests a prefetch for writing. */
+enum {
+  simde_MM_HINT_NTA = 0,
+  simde_MM_HINT_T2  = 1,
+  simde_MM_HINT_T1  = 2,
+  simde_MM_HINT_T0  = 3,
+  simde_MM_HINT_ET1 = 6,
+  simde_MM_HINT_ET0 = 7
+};
+
 SIMDE__FUNCTION_ATTRIBUTES
 void
 simde_mm_prefetch (char const* p, int i) {
+#if HEDLEY_GCC_HAS_BUILTIN(__builtin_prefetch,3,4,0)
+  switch (i) {
+    case simde_MM_HINT_NTA: __builtin_prefetch(p, 0, 0); break;
+    case simde_MM_HINT_T2:  __builtin_prefetch(p, 0, 1); break;
+    case simde_MM_HINT_T1:  __builtin_prefetch(p, 0, 2); break;
+    case simde_MM_HINT_T0:  __builtin_prefetch(p, 0, 3); break;
+    case simde_MM_HINT_ET1: __builtin_prefetch(p, 1, 2); break;
+    case simde_MM_HINT_ET0: __builtin_prefetch(p, 1, 3); break;
+    default: break;
+  }
+#else
   (void) p;
   (void) i;
+#endif
 }
 #if defined(SIMDE_SSE_NATIVE)
-#  define simde_mm_prefetch(p, i) _mm_prefetch(p, i)
+#  define simde_mm_prefetch(p, i) _mm_prefetch(p, (int) (i))
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
@@ -1933,21 +1956,32 @@ simde_mm_xor_ps (simde__m128 a, simde__m128 b) {
 #endif
 }
 
+/* Without native SSE the store is only non-temporal when the compiler
+   provides __builtin_nontemporal_store (currently clang); GCC gets an
+   ordinary cached store. */
 SIMDE__FUNCTION_ATTRIBUTES
 void
 simde_mm_stream_pi (simde__m64* mem_addr, simde__m64 a) {
 #if defined(SIMDE_SSE_NATIVE)
   _mm_stream_pi(&(mem_addr->n), a.n);
+#elif defined(SIMDE__NONTEMPORAL_STORE) && defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  SIMDE__NONTEMPORAL_STORE(a.i64, &(mem_addr->i64));
 #else
   mem_addr->i64[0] = a.i64[0];
 #endif
 }
 
+/* Bypasses the cache only with native SSE or clang's
+   __builtin_nontemporal_store; other compilers, GCC included, do a
+   normal store. */
 SIMDE__FUNCTION_ATTRIBUTES
 void
 simde_mm_stream_ps (simde_float32 mem_addr[4], simde__m128 a) {
 #if defined(SIMDE_SSE_NATIVE)
   _mm_stream_ps(mem_addr, a.n);
+#elif defined(SIMDE__NONTEMPORAL_STORE) && defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 16);
+  SIMDE__NONTEMPORAL_STORE(a.f32, &(((simde__m128*) mem_addr)->f32));
 #else
   HEDLEY_ASSUME_ALIGNED(mem_addr, 16);
   memcpy(mem_addr, &a, sizeof(a));
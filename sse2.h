@@ -56,6 +56,12 @@
 #    if defined(SIMDE_SSE2_NEON)
 #      include <arm_neon.h>
 #    endif
+
+#    if !defined(__INTEL_COMPILER) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#      include <stdatomic.h>
+#    elif defined(_WIN32)
+#      include <Windows.h>
+#    endif
 #  endif
 
 #  include <stdint.h>
@@ -451,7 +457,7 @@ simde_mm_bslli_si128 (simde__m128i a, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE2_NATIVE) && !defined(__PGI)
-#  define simde_mm_bslli_si128(a, imm8) SIMDE__M128I_C(_mm_slli_si128(a.n, imm8));
+#  define simde_mm_bslli_si128(a, imm8) SIMDE__M128I_C(_mm_slli_si128(a.n, imm8))
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
@@ -482,14 +488,20 @@ simde_mm_bsrli_si128 (simde__m128i a, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE2_NATIVE) && !defined(__PGI)
-#  define simde_mm_bsrli_si128(a, imm8) SIMDE__M128I_C(_mm_srli_si128(a.n, imm8));
+#  define simde_mm_bsrli_si128(a, imm8) SIMDE__M128I_C(_mm_srli_si128(a.n, imm8))
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 void
 simde_mm_clflush (void const* p) {
 #if defined(SIMDE_SSE2_NATIVE)
-  return _mm_clflush(p);
+  _mm_clflush(p);
+#elif defined(SIMDE_ARCH_AARCH64) && defined(__GNUC__)
+  /* Clean and invalidate to the point of coherency; Linux and the BSDs
+     allow this from user space. */
+  __asm__ __volatile__ ("dc civac, %0" : : "r" (p) : "memory");
+#else
+  (void) p;
 #endif
 }
 
@@ -996,6 +1008,66 @@ simde_mm_cmpunord_sd (simde__m128d a, simde__m128d b) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_comieq_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_comieq_sd(a.n, b.n);
+#else
+  return a.f64[0] == b.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_comige_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_comige_sd(a.n, b.n);
+#else
+  return a.f64[0] >= b.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_comigt_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_comigt_sd(a.n, b.n);
+#else
+  return a.f64[0] > b.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_comile_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_comile_sd(a.n, b.n);
+#else
+  return a.f64[0] <= b.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_comilt_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_comilt_sd(a.n, b.n);
+#else
+  return a.f64[0] < b.f64[0];
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_comineq_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_comineq_sd(a.n, b.n);
+#else
+  return a.f64[0] != b.f64[0];
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128d
 simde_mm_cvtepi32_pd (simde__m128i a) {
@@ -1333,6 +1405,34 @@ simde_mm_cvttsd_si64 (simde__m128d a) {
 }
 #define simde_mm_cvttsd_si64x(a) simde_mm_cvttsd_si64(a)
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_div_pd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_div_pd(a.n, b.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = a.f64[i] / b.f64[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_div_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_div_sd(a.n, b.n));
+#else
+  simde__m128d r;
+  r.f64[0] = a.f64[0] / b.f64[0];
+  r.f64[1] = a.f64[1];
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 int32_t
 simde_mm_extract_epi16 (simde__m128i a, const int imm8) {
@@ -1352,6 +1452,32 @@ simde_mm_insert_epi16 (simde__m128i a, int32_t i, const int imm8) {
 #  define simde_mm_insert_epi16(a, i, imm8) SIMDE__M128I_C(_mm_insert_epi16(a.n, i, imm8))
 #endif
 
+/* LFENCE also waits for every earlier instruction to complete before
+   later ones start, which nothing portable can express.  Without native
+   SSE2 this is only an acquire fence: it orders earlier loads before
+   later loads and stores, and nothing more (it is not a speculation
+   barrier). */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_lfence (void) {
+#if defined(SIMDE_SSE2_NATIVE)
+  _mm_lfence();
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#elif !defined(__INTEL_COMPILER) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+  atomic_thread_fence(memory_order_acquire);
+#elif defined(_MSC_VER)
+  MemoryBarrier();
+#elif HEDLEY_CLANG_HAS_FEATURE(c_atomic)
+  __c11_atomic_thread_fence(__ATOMIC_ACQUIRE);
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+  __sync_synchronize();
+#elif defined(_OPENMP)
+#  pragma omp critical(simde_mm_lfence_)
+  { }
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128d
 simde_mm_load_pd (simde_float64 const mem_addr[HEDLEY_ARRAY_PARAM(2)]) {
@@ -1500,6 +1626,32 @@ simde_mm_madd_epi16 (simde__m128i a, simde__m128i b) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_move_epi64 (simde__m128i a) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_move_epi64(a.n));
+#else
+  simde__m128i r;
+  r.i64[0] = a.i64[0];
+  r.i64[1] = 0;
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_move_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_move_sd(a.n, b.n));
+#else
+  simde__m128d r;
+  r.f64[0] = b.f64[0];
+  r.f64[1] = a.f64[1];
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 int32_t
 simde_mm_movemask_epi8 (simde__m128i a) {
@@ -1515,6 +1667,42 @@ simde_mm_movemask_epi8 (simde__m128i a) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm_movemask_pd (simde__m128d a) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_movemask_pd(a.n);
+#else
+  int32_t r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.u64) / sizeof(a.u64[0])) ; i++) {
+    r |= (int32_t) ((a.u64[i] >> 63) << i);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mfence (void) {
+#if defined(SIMDE_SSE2_NATIVE)
+  _mm_mfence();
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#elif !defined(__INTEL_COMPILER) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+  atomic_thread_fence(memory_order_seq_cst);
+#elif defined(_MSC_VER)
+  MemoryBarrier();
+#elif HEDLEY_CLANG_HAS_FEATURE(c_atomic)
+  __c11_atomic_thread_fence(__ATOMIC_SEQ_CST);
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+  __sync_synchronize();
+#elif defined(_OPENMP)
+#  pragma omp critical(simde_mm_mfence_)
+  { }
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_min_epi16 (simde__m128i a, simde__m128i b) {
@@ -1573,6 +1761,22 @@ simde_mm_min_sd (simde__m128d a, simde__m128d b) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_maskmoveu_si128 (simde__m128i a, simde__m128i mask, int8_t mem_addr[HEDLEY_ARRAY_PARAM(16)]) {
+#if defined(SIMDE_SSE2_NATIVE)
+  _mm_maskmoveu_si128(a.n, mask.n, (char*) mem_addr);
+#else
+  /* Bytes which aren't selected must not be touched at all, so this
+     can't be turned into a blend and a full 16-byte store. */
+  for (size_t i = 0 ; i < (sizeof(a.i8) / sizeof(a.i8[0])) ; i++) {
+    if (mask.u8[i] & 0x80) {
+      mem_addr[i] = a.i8[i];
+    }
+  }
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_max_epi16 (simde__m128i a, simde__m128i b) {
@@ -1731,6 +1935,21 @@ simde_mm_mullo_epi16 (simde__m128i a, simde__m128i b) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_or_pd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_or_pd(a.n, b.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = a.u64[i] | b.u64[i];
+  }
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_or_si128 (simde__m128i a, simde__m128i b) {
@@ -1794,6 +2013,28 @@ simde_mm_packus_epi16 (simde__m128i a, simde__m128i b) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sad_epu8 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_sad_epu8(a.n, b.n));
+#else
+  simde__m128i r;
+
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    uint16_t sum = 0;
+    SIMDE__VECTORIZE_REDUCTION(+:sum)
+    for (size_t j = 0 ; j < ((sizeof(r.u8) / sizeof(r.u8[0])) / 2) ; j++) {
+      const size_t e = j + (i * 8);
+      sum += (uint16_t) ((a.u8[e] > b.u8[e]) ? (a.u8[e] - b.u8[e]) : (b.u8[e] - a.u8[e]));
+    }
+    r.u64[i] = sum;
+  }
+
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_set_epi8 (int8_t e15, int8_t e14, int8_t e13, int8_t e12,
@@ -2048,6 +2289,95 @@ simde_mm_setzero_si128 (void) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shuffle_epi32 (simde__m128i a, const int imm8) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i32[(imm8 >> (i * 2)) & 3];
+  }
+  return r;
+}
+#if defined(SIMDE_SSE2_NATIVE)
+#  define simde_mm_shuffle_epi32(a, imm8) SIMDE__M128I_C(_mm_shuffle_epi32(a.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm_shuffle_epi32(a, imm8) (__extension__ ({ \
+      const simde__m128i simde__tmp_mm_shuffle_epi32_a_ = (a); \
+      (simde__m128i) { .i32 = SIMDE__SHUFFLE_VECTOR(32, 16, simde__tmp_mm_shuffle_epi32_a_.i32, simde__tmp_mm_shuffle_epi32_a_.i32, \
+          ((imm8)     ) & 3, ((imm8) >> 2) & 3, \
+          ((imm8) >> 4) & 3, ((imm8) >> 6) & 3) }; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shufflehi_epi16 (simde__m128i a, const int imm8) {
+  simde__m128i r;
+  r.i64[0] = a.i64[0];
+  for (size_t i = 4 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.i16[i] = a.i16[4 + ((imm8 >> ((i - 4) * 2)) & 3)];
+  }
+  return r;
+}
+#if defined(SIMDE_SSE2_NATIVE)
+#  define simde_mm_shufflehi_epi16(a, imm8) SIMDE__M128I_C(_mm_shufflehi_epi16(a.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm_shufflehi_epi16(a, imm8) (__extension__ ({ \
+      const simde__m128i simde__tmp_mm_shufflehi_epi16_a_ = (a); \
+      (simde__m128i) { .i16 = SIMDE__SHUFFLE_VECTOR(16, 16, simde__tmp_mm_shufflehi_epi16_a_.i16, simde__tmp_mm_shufflehi_epi16_a_.i16, \
+          0, 1, 2, 3, \
+          (((imm8)     ) & 3) + 4, (((imm8) >> 2) & 3) + 4, \
+          (((imm8) >> 4) & 3) + 4, (((imm8) >> 6) & 3) + 4) }; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shufflelo_epi16 (simde__m128i a, const int imm8) {
+  simde__m128i r;
+  for (size_t i = 0 ; i < ((sizeof(r.i16) / sizeof(r.i16[0])) / 2) ; i++) {
+    r.i16[i] = a.i16[((imm8 >> (i * 2)) & 3)];
+  }
+  r.i64[1] = a.i64[1];
+  return r;
+}
+#if defined(SIMDE_SSE2_NATIVE)
+#  define simde_mm_shufflelo_epi16(a, imm8) SIMDE__M128I_C(_mm_shufflelo_epi16(a.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm_shufflelo_epi16(a, imm8) (__extension__ ({ \
+      const simde__m128i simde__tmp_mm_shufflelo_epi16_a_ = (a); \
+      (simde__m128i) { .i16 = SIMDE__SHUFFLE_VECTOR(16, 16, simde__tmp_mm_shufflelo_epi16_a_.i16, simde__tmp_mm_shufflelo_epi16_a_.i16, \
+          (((imm8)     ) & 3), (((imm8) >> 2) & 3), \
+          (((imm8) >> 4) & 3), (((imm8) >> 6) & 3), \
+          4, 5, 6, 7) }; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_sqrt_pd (simde__m128d a) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_sqrt_pd(a.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = sqrt(a.f64[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_sqrt_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_sqrt_sd(a.n, b.n));
+#else
+  simde__m128d r;
+  r.f64[0] = sqrt(b.f64[0]);
+  r.f64[1] = a.f64[1];
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_srai_epi16 (simde__m128i a, int count) {
@@ -2139,6 +2469,66 @@ simde_mm_sra_epi32 (simde__m128i a, simde__m128i count) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sll_epi16 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_sll_epi16(a.n, count.n));
+#else
+  simde__m128i r;
+
+  if (count.u64[0] > 15)
+    return simde_mm_setzero_si128();
+
+  const int s = (int) count.u64[0];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (uint16_t) (a.u16[i] << s);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sll_epi32 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_sll_epi32(a.n, count.n));
+#else
+  simde__m128i r;
+
+  if (count.u64[0] > 31)
+    return simde_mm_setzero_si128();
+
+  const int s = (int) count.u64[0];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (a.u32[i] << s);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sll_epi64 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_sll_epi64(a.n, count.n));
+#else
+  simde__m128i r;
+
+  if (count.u64[0] > 63)
+    return simde_mm_setzero_si128();
+
+  const int s = (int) count.u64[0];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = (a.u64[i] << s);
+  }
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_slli_epi16 (simde__m128i a, const int imm8) {
@@ -2151,7 +2541,7 @@ simde_mm_slli_epi16 (simde__m128i a, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE2_NATIVE)
-#  define simde_mm_slli_epi16(a, imm8) SIMDE__M128I_C(_mm_slli_epi16(a.n, imm8));
+#  define simde_mm_slli_epi16(a, imm8) SIMDE__M128I_C(_mm_slli_epi16(a.n, imm8))
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
@@ -2166,7 +2556,7 @@ simde_mm_slli_epi32 (simde__m128i a, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE2_NATIVE)
-#  define simde_mm_slli_epi32(a, imm8) SIMDE__M128I_C(_mm_slli_epi32(a.n, imm8));
+#  define simde_mm_slli_epi32(a, imm8) SIMDE__M128I_C(_mm_slli_epi32(a.n, imm8))
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
@@ -2181,8 +2571,68 @@ simde_mm_slli_epi64 (simde__m128i a, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE2_NATIVE)
-#  define simde_mm_slli_epi64(a, imm8) SIMDE__M128I_C(_mm_slli_epi64(a.n, imm8));
+#  define simde_mm_slli_epi64(a, imm8) SIMDE__M128I_C(_mm_slli_epi64(a.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srl_epi16 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_srl_epi16(a.n, count.n));
+#else
+  simde__m128i r;
+
+  if (count.u64[0] > 15)
+    return simde_mm_setzero_si128();
+
+  const int s = (int) count.u64[0];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (uint16_t) (a.u16[i] >> s);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srl_epi32 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_srl_epi32(a.n, count.n));
+#else
+  simde__m128i r;
+
+  if (count.u64[0] > 31)
+    return simde_mm_setzero_si128();
+
+  const int s = (int) count.u64[0];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (a.u32[i] >> s);
+  }
+  return r;
 #endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srl_epi64 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_srl_epi64(a.n, count.n));
+#else
+  simde__m128i r;
+
+  if (count.u64[0] > 63)
+    return simde_mm_setzero_si128();
+
+  const int s = (int) count.u64[0];
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = (a.u64[i] >> s);
+  }
+  return r;
+#endif
+}
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
@@ -2196,7 +2646,7 @@ simde_mm_srli_epi16 (simde__m128i a, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE2_NATIVE)
-#  define simde_mm_srli_epi16(a, imm8) SIMDE__M128I_C(_mm_srli_epi16(a.n, imm8));
+#  define simde_mm_srli_epi16(a, imm8) SIMDE__M128I_C(_mm_srli_epi16(a.n, imm8))
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
@@ -2211,7 +2661,7 @@ simde_mm_srli_epi32 (simde__m128i a, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE2_NATIVE)
-#  define simde_mm_srli_epi32(a, imm8) SIMDE__M128I_C(_mm_srli_epi32(a.n, imm8));
+#  define simde_mm_srli_epi32(a, imm8) SIMDE__M128I_C(_mm_srli_epi32(a.n, imm8))
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
@@ -2226,7 +2676,7 @@ simde_mm_srli_epi64 (simde__m128i a, const int imm8) {
   return r;
 }
 #if defined(SIMDE_SSE2_NATIVE)
-#  define simde_mm_srli_epi64(a, imm8) SIMDE__M128I_C(_mm_srli_epi64(a.n, imm8));
+#  define simde_mm_srli_epi64(a, imm8) SIMDE__M128I_C(_mm_srli_epi64(a.n, imm8))
 #endif
 
 #if defined(simde_mm_srli_si128)
@@ -2359,38 +2809,54 @@ simde_mm_storeu_si128 (simde__m128i* mem_addr, simde__m128i a) {
 #endif
 }
 
+/* Non-temporal with native SSE2 or under clang; otherwise (e.g., GCC
+   without SSE2) this is a plain, cached store. */
 SIMDE__FUNCTION_ATTRIBUTES
 void
 simde_mm_stream_pd (simde_float64 mem_addr[HEDLEY_ARRAY_PARAM(2)], simde__m128d a) {
 #if defined(SIMDE_SSE2_NATIVE)
   _mm_stream_pd(mem_addr, a.n);
+#elif defined(SIMDE__NONTEMPORAL_STORE) && defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 16);
+  SIMDE__NONTEMPORAL_STORE(a.f64, &(((simde__m128d*) mem_addr)->f64));
 #else
   HEDLEY_ASSUME_ALIGNED(mem_addr, 16);
   memcpy(mem_addr, &a, sizeof(a));
 #endif
 }
 
+/* As with simde_mm_stream_pd, only native SSE2 or clang keep the data
+   out of the cache; GCC without SSE2 falls back on memcpy. */
 SIMDE__FUNCTION_ATTRIBUTES
 void
 simde_mm_stream_si128 (simde__m128i* mem_addr, simde__m128i a) {
 #if defined(SIMDE_SSE2_NATIVE)
   _mm_stream_si128(&mem_addr->n, a.n);
+#elif defined(SIMDE__NONTEMPORAL_STORE) && defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  HEDLEY_ASSUME_ALIGNED(mem_addr, 16);
+  SIMDE__NONTEMPORAL_STORE(a.i64, &(mem_addr->i64));
 #else
   HEDLEY_ASSUME_ALIGNED(mem_addr, 16);
   memcpy(mem_addr, &a, sizeof(a));
 #endif
 }
 
+/* The portable version is a normal store unless clang's
+   __builtin_nontemporal_store is available; GCC has no equivalent. */
 SIMDE__FUNCTION_ATTRIBUTES
 void
 simde_mm_stream_si32 (int32_t* mem_addr, int32_t a) {
 #if defined(SIMDE_SSE2_NATIVE)
   _mm_stream_si32(mem_addr, a);
+#elif defined(SIMDE__NONTEMPORAL_STORE)
+  SIMDE__NONTEMPORAL_STORE(a, mem_addr);
 #else
   *mem_addr = a;
 #endif
 }
 
+/* Needs native SSE2 on x86-64 (or clang) to be non-temporal; GCC
+   elsewhere emits an ordinary store. */
 SIMDE__FUNCTION_ATTRIBUTES
 void
 simde_mm_stream_si64 (int64_t* mem_addr, int64_t a) {
@@ -2402,6 +2868,8 @@ simde_mm_stream_si64 (int64_t* mem_addr, int64_t a) {
   #else
     _mm_stream_si64(mem_addr, a);
   #endif
+#elif defined(SIMDE__NONTEMPORAL_STORE)
+  SIMDE__NONTEMPORAL_STORE(a, mem_addr);
 #else
   *mem_addr = a;
 #endif
@@ -2593,6 +3061,96 @@ simde_mm_subs_epu16 (simde__m128i a, simde__m128i b) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_ucomieq_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_ucomieq_sd(a.n, b.n);
+#else
+  fenv_t envp;
+  int x = feholdexcept(&envp);
+  int r = a.f64[0] == b.f64[0];
+  if (HEDLEY_LIKELY(x == 0))
+    fesetenv(&envp);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_ucomige_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_ucomige_sd(a.n, b.n);
+#else
+  fenv_t envp;
+  int x = feholdexcept(&envp);
+  int r = a.f64[0] >= b.f64[0];
+  if (HEDLEY_LIKELY(x == 0))
+    fesetenv(&envp);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_ucomigt_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_ucomigt_sd(a.n, b.n);
+#else
+  fenv_t envp;
+  int x = feholdexcept(&envp);
+  int r = a.f64[0] > b.f64[0];
+  if (HEDLEY_LIKELY(x == 0))
+    fesetenv(&envp);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_ucomile_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_ucomile_sd(a.n, b.n);
+#else
+  fenv_t envp;
+  int x = feholdexcept(&envp);
+  int r = a.f64[0] <= b.f64[0];
+  if (HEDLEY_LIKELY(x == 0))
+    fesetenv(&envp);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_ucomilt_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_ucomilt_sd(a.n, b.n);
+#else
+  fenv_t envp;
+  int x = feholdexcept(&envp);
+  int r = a.f64[0] < b.f64[0];
+  if (HEDLEY_LIKELY(x == 0))
+    fesetenv(&envp);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_ucomineq_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return _mm_ucomineq_sd(a.n, b.n);
+#else
+  fenv_t envp;
+  int x = feholdexcept(&envp);
+  int r = a.f64[0] != b.f64[0];
+  if (HEDLEY_LIKELY(x == 0))
+    fesetenv(&envp);
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_unpackhi_epi8 (simde__m128i a, simde__m128i b) {
@@ -2753,6 +3311,21 @@ simde_mm_unpacklo_pd (simde__m128d a, simde__m128d b) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_xor_pd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_xor_pd(a.n, b.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = a.u64[i] ^ b.u64[i];
+  }
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_xor_si128 (simde__m128i a, simde__m128i b) {
@@ -56,6 +56,184 @@
 
 SIMDE__BEGIN_DECLS
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_addsub_pd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128D_C(_mm_addsub_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_add_pd(a.n, _mm_xor_pd(b.n, _mm_set_pd(0.0, -0.0))));
+#else
+  simde__m128d r;
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i += 2) {
+    r.f64[  i  ] = a.f64[  i  ] - b.f64[  i  ];
+    r.f64[1 + i] = a.f64[1 + i] + b.f64[1 + i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_addsub_ps (simde__m128 a, simde__m128 b) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128_C(_mm_addsub_ps(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128_C(_mm_add_ps(a.n, _mm_xor_ps(b.n, _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f))));
+#else
+  simde__m128 r;
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i += 2) {
+    r.f32[  i  ] = a.f32[  i  ] - b.f32[  i  ];
+    r.f32[1 + i] = a.f32[1 + i] + b.f32[1 + i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_hadd_pd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128D_C(_mm_hadd_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_add_pd(_mm_unpacklo_pd(a.n, b.n), _mm_unpackhi_pd(a.n, b.n)));
+#else
+  simde__m128d r;
+  r.f64[0] = a.f64[0] + a.f64[1];
+  r.f64[1] = b.f64[0] + b.f64[1];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_hadd_ps (simde__m128 a, simde__m128 b) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128_C(_mm_hadd_ps(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128_C(_mm_add_ps(_mm_shuffle_ps(a.n, b.n, _MM_SHUFFLE(2, 0, 2, 0)),
+                                  _mm_shuffle_ps(a.n, b.n, _MM_SHUFFLE(3, 1, 3, 1))));
+#else
+  simde__m128 r;
+  r.f32[0] = a.f32[0] + a.f32[1];
+  r.f32[1] = a.f32[2] + a.f32[3];
+  r.f32[2] = b.f32[0] + b.f32[1];
+  r.f32[3] = b.f32[2] + b.f32[3];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_hsub_pd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128D_C(_mm_hsub_pd(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_sub_pd(_mm_unpacklo_pd(a.n, b.n), _mm_unpackhi_pd(a.n, b.n)));
+#else
+  simde__m128d r;
+  r.f64[0] = a.f64[0] - a.f64[1];
+  r.f64[1] = b.f64[0] - b.f64[1];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_hsub_ps (simde__m128 a, simde__m128 b) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128_C(_mm_hsub_ps(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128_C(_mm_sub_ps(_mm_shuffle_ps(a.n, b.n, _MM_SHUFFLE(2, 0, 2, 0)),
+                                  _mm_shuffle_ps(a.n, b.n, _MM_SHUFFLE(3, 1, 3, 1))));
+#else
+  simde__m128 r;
+  r.f32[0] = a.f32[0] - a.f32[1];
+  r.f32[1] = a.f32[2] - a.f32[3];
+  r.f32[2] = b.f32[0] - b.f32[1];
+  r.f32[3] = b.f32[2] - b.f32[3];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_lddqu_si128 (simde__m128i const* mem_addr) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_lddqu_si128(&mem_addr->n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_loadu_si128(&mem_addr->n));
+#else
+  simde__m128i r;
+  memcpy(&r, mem_addr, sizeof(r));
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_loaddup_pd (simde_float64 const* mem_addr) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128D_C(_mm_loaddup_pd(mem_addr));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_load1_pd(mem_addr));
+#else
+  simde__m128d r;
+  r.f64[0] = *mem_addr;
+  r.f64[1] = *mem_addr;
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_movedup_pd (simde__m128d a) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128D_C(_mm_movedup_pd(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128D_C(_mm_unpacklo_pd(a.n, a.n));
+#else
+  simde__m128d r;
+  r.f64[0] = a.f64[0];
+  r.f64[1] = a.f64[0];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_movehdup_ps (simde__m128 a) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128_C(_mm_movehdup_ps(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128_C(_mm_shuffle_ps(a.n, a.n, _MM_SHUFFLE(3, 3, 1, 1)));
+#else
+  simde__m128 r;
+  r.f32[0] = a.f32[1];
+  r.f32[1] = a.f32[1];
+  r.f32[2] = a.f32[3];
+  r.f32[3] = a.f32[3];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_moveldup_ps (simde__m128 a) {
+#if defined(SIMDE_SSE3_NATIVE)
+  return SIMDE__M128_C(_mm_moveldup_ps(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128_C(_mm_shuffle_ps(a.n, a.n, _MM_SHUFFLE(2, 2, 0, 0)));
+#else
+  simde__m128 r;
+  r.f32[0] = a.f32[0];
+  r.f32[1] = a.f32[0];
+  r.f32[2] = a.f32[2];
+  r.f32[3] = a.f32[2];
+  return r;
+#endif
+}
+
 SIMDE__END_DECLS
 
 #endif /* !defined(SIMDE__SSE3_H) */
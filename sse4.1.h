@@ -60,11 +60,193 @@
 
 SIMDE__BEGIN_DECLS
 
+enum {
+  simde_MM_FROUND_TO_NEAREST_INT = 0x00,
+  simde_MM_FROUND_TO_NEG_INF     = 0x01,
+  simde_MM_FROUND_TO_POS_INF     = 0x02,
+  simde_MM_FROUND_TO_ZERO        = 0x03,
+  simde_MM_FROUND_CUR_DIRECTION  = 0x04,
+
+  simde_MM_FROUND_RAISE_EXC      = 0x00,
+  simde_MM_FROUND_NO_EXC         = 0x08,
+
+  simde_MM_FROUND_NINT           = simde_MM_FROUND_TO_NEAREST_INT | simde_MM_FROUND_RAISE_EXC,
+  simde_MM_FROUND_FLOOR          = simde_MM_FROUND_TO_NEG_INF     | simde_MM_FROUND_RAISE_EXC,
+  simde_MM_FROUND_CEIL           = simde_MM_FROUND_TO_POS_INF     | simde_MM_FROUND_RAISE_EXC,
+  simde_MM_FROUND_TRUNC          = simde_MM_FROUND_TO_ZERO        | simde_MM_FROUND_RAISE_EXC,
+  simde_MM_FROUND_RINT           = simde_MM_FROUND_CUR_DIRECTION  | simde_MM_FROUND_RAISE_EXC,
+  simde_MM_FROUND_NEARBYINT      = simde_MM_FROUND_CUR_DIRECTION  | simde_MM_FROUND_NO_EXC
+};
+
+/* Round a single element without touching the floating-point
+   environment.  Anything with a magnitude of at least 2^23 (2^52 for
+   doubles) is already integral, infinite or NaN and is passed through;
+   everything else fits in an integer, so we truncate with a conversion
+   and fix the result up using the (exact) fractional part.  The current
+   direction is honoured by adding and subtracting the magic constant,
+   which makes the FPU do the rounding for us, and copysign restores the
+   sign of results which round to zero (e.g., -0.25 → -0.0).
+
+   The range check and final select work on the bits rather than on
+   floating-point compares; with -ftrapping-math (the default) GCC
+   refuses to if-convert the latter, so the loops calling these would
+   not vectorize. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_round_f32 (simde_float32 v, int rounding) {
+  uint32_t vu, ru, cu, mask;
+  simde_float32 c, f, r;
+  int32_t t;
+
+  memcpy(&vu, &v, sizeof(vu));
+  mask = -((uint32_t) ((vu & UINT32_C(0x7fffffff)) < UINT32_C(0x4b000000)));
+  cu = vu & mask;
+  memcpy(&c, &cu, sizeof(c));
+  t = (int32_t) c;
+  f = c - (simde_float32) t;
+
+  switch (rounding & ~simde_MM_FROUND_NO_EXC) {
+    case simde_MM_FROUND_TO_NEAREST_INT:
+      r = (simde_float32) (t + ((f > 0.5f) | ((f == 0.5f) & t)) - ((f < -0.5f) | ((f == -0.5f) & t)));
+      break;
+    case simde_MM_FROUND_TO_NEG_INF:
+      r = (simde_float32) (t - (f < 0.0f));
+      break;
+    case simde_MM_FROUND_TO_POS_INF:
+      r = (simde_float32) (t + (f > 0.0f));
+      break;
+    case simde_MM_FROUND_TO_ZERO:
+      r = (simde_float32) t;
+      break;
+    default:
+      {
+        const simde_float32 m = (c < 0.0f) ? -8388608.0f : 8388608.0f;
+        r = (c + m) - m;
+      }
+      break;
+  }
+
+  memcpy(&ru, &r, sizeof(ru));
+  ru = (ru & mask) | (vu & ~mask);
+  memcpy(&r, &ru, sizeof(r));
+
+  return copysignf(r, v);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_x_round_f64 (simde_float64 v, int rounding) {
+  uint64_t vu, ru, cu, mask;
+  simde_float64 c, f, r;
+  int64_t t;
+
+  memcpy(&vu, &v, sizeof(vu));
+  mask = -((uint64_t) ((vu & UINT64_C(0x7fffffffffffffff)) < UINT64_C(0x4330000000000000)));
+  cu = vu & mask;
+  memcpy(&c, &cu, sizeof(c));
+  t = (int64_t) c;
+  f = c - (simde_float64) t;
+
+  switch (rounding & ~simde_MM_FROUND_NO_EXC) {
+    case simde_MM_FROUND_TO_NEAREST_INT:
+      r = (simde_float64) (t + ((f > 0.5) | ((f == 0.5) & t)) - ((f < -0.5) | ((f == -0.5) & t)));
+      break;
+    case simde_MM_FROUND_TO_NEG_INF:
+      r = (simde_float64) (t - (f < 0.0));
+      break;
+    case simde_MM_FROUND_TO_POS_INF:
+      r = (simde_float64) (t + (f > 0.0));
+      break;
+    case simde_MM_FROUND_TO_ZERO:
+      r = (simde_float64) t;
+      break;
+    default:
+      {
+        const simde_float64 m = (c < 0.0) ? -4503599627370496.0 : 4503599627370496.0;
+        r = (c + m) - m;
+      }
+      break;
+  }
+
+  memcpy(&ru, &r, sizeof(ru));
+  ru = (ru & mask) | (vu & ~mask);
+  memcpy(&r, &ru, sizeof(r));
+
+  return copysign(r, v);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_blend_epi16 (simde__m128i a, simde__m128i b, const int imm8) {
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = ((imm8 >> i) & 1) ? b.u16[i] : a.u16[i];
+  }
+  return r;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_blend_epi16(a, b, imm8) SIMDE__M128I_C(_mm_blend_epi16(a.n, b.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm_blend_epi16(a, b, imm8) (__extension__ ({ \
+      const simde__m128i simde__tmp_mm_blend_epi16_a_ = (a); \
+      const simde__m128i simde__tmp_mm_blend_epi16_b_ = (b); \
+      (simde__m128i) { .i16 = SIMDE__SHUFFLE_VECTOR(16, 16, simde__tmp_mm_blend_epi16_a_.i16, simde__tmp_mm_blend_epi16_b_.i16, \
+          (((imm8) >> 0) & 1) ? 8 : 0, (((imm8) >> 1) & 1) ? 9 : 1, \
+          (((imm8) >> 2) & 1) ? 10 : 2, (((imm8) >> 3) & 1) ? 11 : 3, \
+          (((imm8) >> 4) & 1) ? 12 : 4, (((imm8) >> 5) & 1) ? 13 : 5, \
+          (((imm8) >> 6) & 1) ? 14 : 6, (((imm8) >> 7) & 1) ? 15 : 7) }; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_blend_pd (simde__m128d a, simde__m128d b, const int imm8) {
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.u64[i] = ((imm8 >> i) & 1) ? b.u64[i] : a.u64[i];
+  }
+  return r;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_blend_pd(a, b, imm8) SIMDE__M128D_C(_mm_blend_pd(a.n, b.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm_blend_pd(a, b, imm8) (__extension__ ({ \
+      const simde__m128d simde__tmp_mm_blend_pd_a_ = (a); \
+      const simde__m128d simde__tmp_mm_blend_pd_b_ = (b); \
+      (simde__m128d) { .f64 = SIMDE__SHUFFLE_VECTOR(64, 16, simde__tmp_mm_blend_pd_a_.f64, simde__tmp_mm_blend_pd_b_.f64, \
+          (((imm8) >> 0) & 1) ? 2 : 0, (((imm8) >> 1) & 1) ? 3 : 1) }; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_blend_ps (simde__m128 a, simde__m128 b, const int imm8) {
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.u32[i] = ((imm8 >> i) & 1) ? b.u32[i] : a.u32[i];
+  }
+  return r;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_blend_ps(a, b, imm8) SIMDE__M128_C(_mm_blend_ps(a.n, b.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm_blend_ps(a, b, imm8) (__extension__ ({ \
+      const simde__m128 simde__tmp_mm_blend_ps_a_ = (a); \
+      const simde__m128 simde__tmp_mm_blend_ps_b_ = (b); \
+      (simde__m128) { .f32 = SIMDE__SHUFFLE_VECTOR(32, 16, simde__tmp_mm_blend_ps_a_.f32, simde__tmp_mm_blend_ps_b_.f32, \
+          (((imm8) >> 0) & 1) ? 4 : 0, (((imm8) >> 1) & 1) ? 5 : 1, \
+          (((imm8) >> 2) & 1) ? 6 : 2, (((imm8) >> 3) & 1) ? 7 : 3) }; }))
+#endif
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_blendv_epi8 (simde__m128i a, simde__m128i b, simde__m128i mask) {
 #if defined(SIMDE_SSE4_1_NATIVE)
   return SIMDE__M128I_C(_mm_blendv_epi8(a.n, b.n, mask.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i m = _mm_cmplt_epi8(mask.n, _mm_setzero_si128());
+  return SIMDE__M128I_C(_mm_or_si128(_mm_and_si128(m, b.n), _mm_andnot_si128(m, a.n)));
 #else
   simde__m128i r;
   SIMDE__VECTORIZE
@@ -79,32 +261,983 @@ simde_mm_blendv_epi8 (simde__m128i a, simde__m128i b, simde__m128i mask) {
 #endif
 }
 
-#if defined(simde_mm_extract_epi64)
-#  undef simde_mm_extract_epi64
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_blendv_pd (simde__m128d a, simde__m128d b, simde__m128d mask) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128D_C(_mm_blendv_pd(a.n, b.n, mask.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i m = _mm_shuffle_epi32(_mm_srai_epi32(_mm_castpd_si128(mask.n), 31), _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128d md = _mm_castsi128_pd(m);
+  return SIMDE__M128D_C(_mm_or_pd(_mm_and_pd(md, b.n), _mm_andnot_pd(md, a.n)));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    const uint64_t m = (uint64_t) (mask.i64[i] >> 63);
+    r.u64[i] = (a.u64[i] & ~m) | (b.u64[i] & m);
+  }
+  return r;
 #endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
-int64_t
-simde_mm_extract_epi64 (simde__m128i a, const int imm8) {
-  return a.u64[imm8];
+simde__m128
+simde_mm_blendv_ps (simde__m128 a, simde__m128 b, simde__m128 mask) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128_C(_mm_blendv_ps(a.n, b.n, mask.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128 m = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(mask.n), 31));
+  return SIMDE__M128_C(_mm_or_ps(_mm_and_ps(m, b.n), _mm_andnot_ps(m, a.n)));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    const uint32_t m = (uint32_t) (mask.i32[i] >> 31);
+    r.u32[i] = (a.u32[i] & ~m) | (b.u32[i] & m);
+  }
+  return r;
+#endif
 }
-#if defined(SIMDE_SSE4_1_NATIVE) && defined(SIMDE_ARCH_AMD64)
-#  define simde_mm_extract_epi64(a, imm8) _mm_extract_epi64(a.n, imm8)
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_ceil_pd (simde__m128d a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128D_C(_mm_ceil_pd(a.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = simde_x_round_f64(a.f64[i], simde_MM_FROUND_CEIL);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_ceil_ps (simde__m128 a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128_C(_mm_ceil_ps(a.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = simde_x_round_f32(a.f32[i], simde_MM_FROUND_CEIL);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_ceil_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128D_C(_mm_ceil_sd(a.n, b.n));
+#else
+  a.f64[0] = simde_x_round_f64(b.f64[0], simde_MM_FROUND_CEIL);
+  return a;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_ceil_ss (simde__m128 a, simde__m128 b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128_C(_mm_ceil_ss(a.n, b.n));
+#else
+  a.f32[0] = simde_x_round_f32(b.f32[0], simde_MM_FROUND_CEIL);
+  return a;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cmpeq_epi64 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cmpeq_epi64(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i t = _mm_cmpeq_epi32(a.n, b.n);
+  return SIMDE__M128I_C(_mm_and_si128(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = (a.u64[i] == b.u64[i]) ? ~UINT64_C(0) : UINT64_C(0);
+  }
+  return r;
 #endif
+}
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
-simde_mm_min_epi8 (simde__m128i a, simde__m128i b) {
-#if defined(SIMDE_SSE4_1_NATIVE) && !defined(__PGI)
-  return SIMDE__M128I_C(_mm_min_epi8(a.n, b.n));
+simde_mm_cvtepi16_epi32 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepi16_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_srai_epi32(_mm_unpacklo_epi16(a.n, a.n), 16));
 #else
   simde__m128i r;
   SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
-    r.i8[i] = a.i8[i] < b.i8[i] ? a.i8[i] : b.i8[i];
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepi16_epi64 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepi16_epi64(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  __m128i s = _mm_srai_epi32(_mm_unpacklo_epi16(a.n, a.n), 16);
+  return SIMDE__M128I_C(_mm_unpacklo_epi32(s, _mm_srai_epi32(s, 31)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepi32_epi64 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepi32_epi64(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_unpacklo_epi32(a.n, _mm_srai_epi32(a.n, 31)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepi8_epi16 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepi8_epi16(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_srai_epi16(_mm_unpacklo_epi8(a.n, a.n), 8));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.i16[i] = a.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepi8_epi32 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepi8_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  __m128i s = _mm_unpacklo_epi8(a.n, a.n);
+  s = _mm_unpacklo_epi16(s, s);
+  return SIMDE__M128I_C(_mm_srai_epi32(s, 24));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = a.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepi8_epi64 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepi8_epi64(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  __m128i s = _mm_unpacklo_epi8(a.n, a.n);
+  s = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 24);
+  return SIMDE__M128I_C(_mm_unpacklo_epi32(s, _mm_srai_epi32(s, 31)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = a.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepu16_epi32 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepu16_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_unpacklo_epi16(a.n, _mm_setzero_si128()));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = a.u16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepu16_epi64 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepu16_epi64(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i z = _mm_setzero_si128();
+  return SIMDE__M128I_C(_mm_unpacklo_epi32(_mm_unpacklo_epi16(a.n, z), z));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = a.u16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepu32_epi64 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepu32_epi64(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_unpacklo_epi32(a.n, _mm_setzero_si128()));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = a.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepu8_epi16 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepu8_epi16(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_unpacklo_epi8(a.n, _mm_setzero_si128()));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = a.u8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepu8_epi32 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepu8_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i z = _mm_setzero_si128();
+  return SIMDE__M128I_C(_mm_unpacklo_epi16(_mm_unpacklo_epi8(a.n, z), z));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = a.u8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtepu8_epi64 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_cvtepu8_epi64(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i z = _mm_setzero_si128();
+  return SIMDE__M128I_C(_mm_unpacklo_epi32(_mm_unpacklo_epi16(_mm_unpacklo_epi8(a.n, z), z), z));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u64) / sizeof(r.u64[0])) ; i++) {
+    r.u64[i] = a.u8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_dp_pd (simde__m128d a, simde__m128d b, const int imm8) {
+#if defined(SIMDE_SSE2_NATIVE)
+  const __m128d p = _mm_and_pd(_mm_mul_pd(a.n, b.n),
+                               _mm_castsi128_pd(_mm_set_epi64x(-((imm8 >> 5) & 1), -((imm8 >> 4) & 1))));
+  const __m128d s = _mm_add_pd(p, _mm_shuffle_pd(p, p, 1));
+  return SIMDE__M128D_C(_mm_and_pd(s, _mm_castsi128_pd(_mm_set_epi64x(-((imm8 >> 1) & 1), -(imm8 & 1)))));
+#else
+  simde__m128d r;
+  const simde_float64 sum =
+    (((imm8 >> 4) & 1) ? (a.f64[0] * b.f64[0]) : 0.0) +
+    (((imm8 >> 5) & 1) ? (a.f64[1] * b.f64[1]) : 0.0);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = ((imm8 >> i) & 1) ? sum : 0.0;
   }
+
   return r;
 #endif
 }
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_dp_pd(a, b, imm8) SIMDE__M128D_C(_mm_dp_pd(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_dp_ps (simde__m128 a, simde__m128 b, const int imm8) {
+#if defined(SIMDE_SSE2_NATIVE)
+  /* Both shuffles add the same pairs as dpps does, just in a different
+     order within each pair, so every lane ends up with the exact sum. */
+  const __m128 p = _mm_and_ps(_mm_mul_ps(a.n, b.n),
+                              _mm_castsi128_ps(_mm_set_epi32(-((imm8 >> 7) & 1), -((imm8 >> 6) & 1),
+                                                             -((imm8 >> 5) & 1), -((imm8 >> 4) & 1))));
+  const __m128 t = _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)));
+  const __m128 s = _mm_add_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2)));
+  return SIMDE__M128_C(_mm_and_ps(s, _mm_castsi128_ps(_mm_set_epi32(-((imm8 >> 3) & 1), -((imm8 >> 2) & 1),
+                                                                    -((imm8 >> 1) & 1), -(imm8 & 1)))));
+#else
+  simde__m128 r;
+  simde_float32 sum;
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = ((imm8 >> (i + 4)) & 1) ? (a.f32[i] * b.f32[i]) : 0.0f;
+  }
+
+  sum = (r.f32[0] + r.f32[1]) + (r.f32[2] + r.f32[3]);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = ((imm8 >> i) & 1) ? sum : 0.0f;
+  }
+
+  return r;
+#endif
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_dp_ps(a, b, imm8) SIMDE__M128_C(_mm_dp_ps(a.n, b.n, imm8))
+#endif
+
+#if defined(simde_mm_extract_epi8)
+#  undef simde_mm_extract_epi8
+#endif
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_extract_epi8 (simde__m128i a, const int imm8) {
+  return a.u8[imm8 & 15];
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_extract_epi8(a, imm8) _mm_extract_epi8(a.n, imm8)
+#endif
+
+#if defined(simde_mm_extract_epi32)
+#  undef simde_mm_extract_epi32
+#endif
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm_extract_epi32 (simde__m128i a, const int imm8) {
+  return a.i32[imm8 & 3];
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_extract_epi32(a, imm8) _mm_extract_epi32(a.n, imm8)
+#endif
+
+#if defined(simde_mm_extract_epi64)
+#  undef simde_mm_extract_epi64
+#endif
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm_extract_epi64 (simde__m128i a, const int imm8) {
+  return a.u64[imm8];
+}
+#if defined(SIMDE_SSE4_1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+#  define simde_mm_extract_epi64(a, imm8) _mm_extract_epi64(a.n, imm8)
+#endif
+
+#if defined(simde_mm_extract_ps)
+#  undef simde_mm_extract_ps
+#endif
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm_extract_ps (simde__m128 a, const int imm8) {
+  return a.i32[imm8 & 3];
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_extract_ps(a, imm8) _mm_extract_ps(a.n, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_floor_pd (simde__m128d a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128D_C(_mm_floor_pd(a.n));
+#else
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = simde_x_round_f64(a.f64[i], simde_MM_FROUND_FLOOR);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_floor_ps (simde__m128 a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128_C(_mm_floor_ps(a.n));
+#else
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = simde_x_round_f32(a.f32[i], simde_MM_FROUND_FLOOR);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_floor_sd (simde__m128d a, simde__m128d b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128D_C(_mm_floor_sd(a.n, b.n));
+#else
+  a.f64[0] = simde_x_round_f64(b.f64[0], simde_MM_FROUND_FLOOR);
+  return a;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_floor_ss (simde__m128 a, simde__m128 b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128_C(_mm_floor_ss(a.n, b.n));
+#else
+  a.f32[0] = simde_x_round_f32(b.f32[0], simde_MM_FROUND_FLOOR);
+  return a;
+#endif
+}
+
+#if defined(simde_mm_insert_epi8)
+#  undef simde_mm_insert_epi8
+#endif
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_insert_epi8 (simde__m128i a, int i, const int imm8) {
+  a.i8[imm8 & 15] = (int8_t) i;
+  return a;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_insert_epi8(a, i, imm8) SIMDE__M128I_C(_mm_insert_epi8(a.n, i, imm8))
+#endif
+
+#if defined(simde_mm_insert_epi32)
+#  undef simde_mm_insert_epi32
+#endif
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_insert_epi32 (simde__m128i a, int32_t i, const int imm8) {
+  a.i32[imm8 & 3] = i;
+  return a;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_insert_epi32(a, i, imm8) SIMDE__M128I_C(_mm_insert_epi32(a.n, i, imm8))
+#endif
+
+#if defined(simde_mm_insert_epi64)
+#  undef simde_mm_insert_epi64
+#endif
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_insert_epi64 (simde__m128i a, int64_t i, const int imm8) {
+  a.i64[imm8 & 1] = i;
+  return a;
+}
+#if defined(SIMDE_SSE4_1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+#  define simde_mm_insert_epi64(a, i, imm8) SIMDE__M128I_C(_mm_insert_epi64(a.n, i, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_insert_ps (simde__m128 a, simde__m128 b, const int imm8) {
+  simde__m128 r;
+
+  a.f32[(imm8 >> 4) & 3] = b.f32[(imm8 >> 6) & 3];
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = ((imm8 >> i) & 1) ? 0 : a.u32[i];
+  }
+
+  return r;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_insert_ps(a, b, imm8) SIMDE__M128_C(_mm_insert_ps(a.n, b.n, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm_insert_ps(a, b, imm8) (__extension__ ({ \
+      const simde__m128 simde__tmp_mm_insert_ps_a_ = (a); \
+      const simde__m128 simde__tmp_mm_insert_ps_b_ = (b); \
+      simde__m128 simde__tmp_mm_insert_ps_r_; \
+      simde__tmp_mm_insert_ps_r_.f32 = SIMDE__SHUFFLE_VECTOR(32, 16, simde__tmp_mm_insert_ps_a_.f32, simde__tmp_mm_insert_ps_b_.f32, \
+          ((((imm8) >> 4) & 3) == 0) ? (4 + (((imm8) >> 6) & 3)) : 0, \
+          ((((imm8) >> 4) & 3) == 1) ? (4 + (((imm8) >> 6) & 3)) : 1, \
+          ((((imm8) >> 4) & 3) == 2) ? (4 + (((imm8) >> 6) & 3)) : 2, \
+          ((((imm8) >> 4) & 3) == 3) ? (4 + (((imm8) >> 6) & 3)) : 3); \
+      simde__tmp_mm_insert_ps_r_.u32 &= (__typeof__(simde__tmp_mm_insert_ps_r_.u32)) { \
+          ((imm8) & 1) ? 0 : ~UINT32_C(0), ((imm8) & 2) ? 0 : ~UINT32_C(0), \
+          ((imm8) & 4) ? 0 : ~UINT32_C(0), ((imm8) & 8) ? 0 : ~UINT32_C(0) }; \
+      simde__tmp_mm_insert_ps_r_; }))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_max_epi32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_max_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i m = _mm_cmpgt_epi32(a.n, b.n);
+  return SIMDE__M128I_C(_mm_or_si128(_mm_and_si128(m, a.n), _mm_andnot_si128(m, b.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = (a.i32[i] > b.i32[i]) ? a.i32[i] : b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_max_epi8 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_max_epi8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i m = _mm_cmpgt_epi8(a.n, b.n);
+  return SIMDE__M128I_C(_mm_or_si128(_mm_and_si128(m, a.n), _mm_andnot_si128(m, b.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.i8[i] = (a.i8[i] > b.i8[i]) ? a.i8[i] : b.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_max_epu16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_max_epu16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_add_epi16(b.n, _mm_subs_epu16(a.n, b.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (a.u16[i] > b.u16[i]) ? a.u16[i] : b.u16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_max_epu32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_max_epu32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i bias = _mm_set1_epi32(INT32_MIN);
+  const __m128i m = _mm_cmpgt_epi32(_mm_xor_si128(a.n, bias), _mm_xor_si128(b.n, bias));
+  return SIMDE__M128I_C(_mm_or_si128(_mm_and_si128(m, a.n), _mm_andnot_si128(m, b.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (a.u32[i] > b.u32[i]) ? a.u32[i] : b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_min_epi32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_min_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i m = _mm_cmpgt_epi32(b.n, a.n);
+  return SIMDE__M128I_C(_mm_or_si128(_mm_and_si128(m, a.n), _mm_andnot_si128(m, b.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.i32[i] = (a.i32[i] < b.i32[i]) ? a.i32[i] : b.i32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_min_epi8 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE) && !defined(__PGI)
+  return SIMDE__M128I_C(_mm_min_epi8(a.n, b.n));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.i8[i] = a.i8[i] < b.i8[i] ? a.i8[i] : b.i8[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_min_epu16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_min_epu16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_sub_epi16(a.n, _mm_subs_epu16(a.n, b.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (a.u16[i] < b.u16[i]) ? a.u16[i] : b.u16[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_min_epu32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_min_epu32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i bias = _mm_set1_epi32(INT32_MIN);
+  const __m128i m = _mm_cmpgt_epi32(_mm_xor_si128(b.n, bias), _mm_xor_si128(a.n, bias));
+  return SIMDE__M128I_C(_mm_or_si128(_mm_and_si128(m, a.n), _mm_andnot_si128(m, b.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (a.u32[i] < b.u32[i]) ? a.u32[i] : b.u32[i];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_minpos_epu16 (simde__m128i a) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_minpos_epu16(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  /* Flip the sign bits so min_epi16 does an unsigned compare, reduce
+     horizontally, then do the same with the indices of the lanes which
+     hold the minimum to find the first one. */
+  const __m128i bias = _mm_set1_epi16(INT16_MIN);
+  __m128i m, e, idx;
+
+  m = _mm_xor_si128(a.n, bias);
+  m = _mm_min_epi16(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+  m = _mm_min_epi16(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+  m = _mm_min_epi16(m, _mm_shufflelo_epi16(m, _MM_SHUFFLE(2, 3, 0, 1)));
+  m = _mm_xor_si128(m, bias);
+
+  e = _mm_cmpeq_epi16(a.n, _mm_shuffle_epi32(_mm_shufflelo_epi16(m, 0), 0));
+  idx = _mm_or_si128(_mm_and_si128(e, _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7)), _mm_andnot_si128(e, _mm_set1_epi16(8)));
+  idx = _mm_min_epi16(idx, _mm_shuffle_epi32(idx, _MM_SHUFFLE(1, 0, 3, 2)));
+  idx = _mm_min_epi16(idx, _mm_shuffle_epi32(idx, _MM_SHUFFLE(2, 3, 0, 1)));
+  idx = _mm_min_epi16(idx, _mm_shufflelo_epi16(idx, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  return SIMDE__M128I_C(_mm_cvtsi32_si128((int) (((((uint32_t) _mm_cvtsi128_si32(idx)) & 0x7) << 16) | (((uint32_t) _mm_cvtsi128_si32(m)) & 0xffff))));
+#else
+  simde__m128i r = simde_mm_setzero_si128();
+
+  r.u16[0] = UINT16_MAX;
+  for (size_t i = 0 ; i < (sizeof(a.u16) / sizeof(a.u16[0])) ; i++) {
+    if (a.u16[i] < r.u16[0]) {
+      r.u16[0] = a.u16[i];
+      r.u16[1] = (uint16_t) i;
+    }
+  }
+
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mpsadbw_epu8 (simde__m128i a, simde__m128i b, const int imm8) {
+  const int a_offset = imm8 & 4;
+  const int b_offset = (imm8 & 3) << 2;
+#if defined(SIMDE_SSSE3_NATIVE)
+  /* Line up (a[j + k], a[j + k + 1]) against (b[k], b[k + 1]) so that
+     maddubs can add each pair of absolute differences for us. */
+  const __m128i ai = _mm_add_epi8(_mm_set1_epi8((char) a_offset), _mm_setr_epi8(0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8));
+  const __m128i bi = _mm_add_epi8(_mm_set1_epi8((char) b_offset), _mm_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1));
+  const __m128i two = _mm_set1_epi8(2);
+  const __m128i one = _mm_set1_epi8(1);
+  __m128i x, y, r;
+
+  x = _mm_shuffle_epi8(a.n, ai);
+  y = _mm_shuffle_epi8(b.n, bi);
+  r = _mm_maddubs_epi16(_mm_or_si128(_mm_subs_epu8(x, y), _mm_subs_epu8(y, x)), one);
+
+  x = _mm_shuffle_epi8(a.n, _mm_add_epi8(ai, two));
+  y = _mm_shuffle_epi8(b.n, _mm_add_epi8(bi, two));
+  r = _mm_add_epi16(r, _mm_maddubs_epi16(_mm_or_si128(_mm_subs_epu8(x, y), _mm_subs_epu8(y, x)), one));
+
+  return SIMDE__M128I_C(r);
+#elif defined(SIMDE_SSE2_NATIVE)
+  /* The offsets aren't immediates here, so load the eight bytes of a
+     starting at a_offset + k instead of shifting, compare them against
+     a broadcast b[b_offset + k] and accumulate in 16 bits. */
+  const __m128i zero = _mm_setzero_si128();
+  __m128i r = zero;
+
+  for (size_t k = 0 ; k < 4 ; k++) {
+    const __m128i x = _mm_loadl_epi64((const __m128i*) &(a.u8[a_offset + k]));
+    const __m128i y = _mm_set1_epi8((char) b.u8[b_offset + k]);
+    r = _mm_add_epi16(r, _mm_unpacklo_epi8(_mm_or_si128(_mm_subs_epu8(x, y), _mm_subs_epu8(y, x)), zero));
+  }
+
+  return SIMDE__M128I_C(r);
+#else
+  simde__m128i r;
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u16) / sizeof(r.u16[0])) ; i++) {
+    r.u16[i] = (uint16_t)
+      (abs(a.u8[a_offset + i + 0] - b.u8[b_offset + 0]) +
+       abs(a.u8[a_offset + i + 1] - b.u8[b_offset + 1]) +
+       abs(a.u8[a_offset + i + 2] - b.u8[b_offset + 2]) +
+       abs(a.u8[a_offset + i + 3] - b.u8[b_offset + 3]));
+  }
+
+  return r;
+#endif
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_mpsadbw_epu8(a, b, imm8) SIMDE__M128I_C(_mm_mpsadbw_epu8(a.n, b.n, imm8))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mul_epi32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_mul_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  /* Fix up the unsigned product: a * b = (unsigned) a * (unsigned) b -
+     2^32 * ((a < 0 ? b : 0) + (b < 0 ? a : 0)) (mod 2^64). */
+  const __m128i c = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a.n, 31), b.n),
+                                  _mm_and_si128(_mm_srai_epi32(b.n, 31), a.n));
+  return SIMDE__M128I_C(_mm_sub_epi64(_mm_mul_epu32(a.n, b.n), _mm_slli_epi64(c, 32)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i64) / sizeof(r.i64[0])) ; i++) {
+    r.i64[i] = (int64_t) a.i32[i * 2] * (int64_t) b.i32[i * 2];
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mullo_epi32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_mullo_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i even = _mm_mul_epu32(a.n, b.n);
+  const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a.n, 32), _mm_srli_epi64(b.n, 32));
+  return SIMDE__M128I_C(_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                           _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.u32) / sizeof(r.u32[0])) ; i++) {
+    r.u32[i] = (uint32_t) ((uint64_t) a.u32[i] * (uint64_t) b.u32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_packus_epi32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_packus_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  /* Clamp to [0, 65535] and bias into the signed range so packs_epi32
+     can't saturate, then flip the bias back out. */
+  const __m128i max = _mm_set1_epi32(UINT16_MAX);
+  const __m128i bias = _mm_set1_epi32(-32768);
+  __m128i x = _mm_and_si128(a.n, _mm_cmpgt_epi32(a.n, _mm_setzero_si128()));
+  __m128i y = _mm_and_si128(b.n, _mm_cmpgt_epi32(b.n, _mm_setzero_si128()));
+  __m128i m;
+  m = _mm_cmpgt_epi32(x, max);
+  x = _mm_add_epi32(_mm_or_si128(_mm_and_si128(m, max), _mm_andnot_si128(m, x)), bias);
+  m = _mm_cmpgt_epi32(y, max);
+  y = _mm_add_epi32(_mm_or_si128(_mm_and_si128(m, max), _mm_andnot_si128(m, y)), bias);
+  return SIMDE__M128I_C(_mm_xor_si128(_mm_packs_epi32(x, y), _mm_set1_epi16(INT16_MIN)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a.i32) / sizeof(a.i32[0])) ; i++) {
+    r.u16[i + 0] = (a.i32[i] < 0) ? 0 : ((a.i32[i] > UINT16_MAX) ? UINT16_MAX : (uint16_t) a.i32[i]);
+    r.u16[i + 4] = (b.i32[i] < 0) ? 0 : ((b.i32[i] > UINT16_MAX) ? UINT16_MAX : (uint16_t) b.i32[i]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_round_pd (simde__m128d a, int rounding) {
+  simde__m128d r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f64) / sizeof(r.f64[0])) ; i++) {
+    r.f64[i] = simde_x_round_f64(a.f64[i], rounding);
+  }
+  return r;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_round_pd(a, rounding) SIMDE__M128D_C(_mm_round_pd(a.n, rounding))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_round_ps (simde__m128 a, int rounding) {
+  simde__m128 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.f32) / sizeof(r.f32[0])) ; i++) {
+    r.f32[i] = simde_x_round_f32(a.f32[i], rounding);
+  }
+  return r;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_round_ps(a, rounding) SIMDE__M128_C(_mm_round_ps(a.n, rounding))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_round_sd (simde__m128d a, simde__m128d b, int rounding) {
+  a.f64[0] = simde_x_round_f64(b.f64[0], rounding);
+  return a;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_round_sd(a, b, rounding) SIMDE__M128D_C(_mm_round_sd(a.n, b.n, rounding))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_round_ss (simde__m128 a, simde__m128 b, int rounding) {
+  a.f32[0] = simde_x_round_f32(b.f32[0], rounding);
+  return a;
+}
+#if defined(SIMDE_SSE4_1_NATIVE)
+#  define simde_mm_round_ss(a, b, rounding) SIMDE__M128_C(_mm_round_ss(a.n, b.n, rounding))
+#endif
+
+/* Without native SSE4.1 the load only carries the non-temporal hint
+   under clang (__builtin_nontemporal_load); GCC does a normal load. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_stream_load_si128 (const simde__m128i* mem_addr) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return SIMDE__M128I_C(_mm_stream_load_si128((__m128i*) &(mem_addr->n)));
+#elif defined(SIMDE__NONTEMPORAL_LOAD) && defined(SIMDE__ENABLE_GCC_VEC_EXT)
+  simde__m128i r;
+  r.i64 = SIMDE__NONTEMPORAL_LOAD(&(mem_addr->i64));
+  return r;
+#else
+  return simde_mm_load_si128(mem_addr);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_testc_si128 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return _mm_testc_si128(a.n, b.n);
+#elif defined(SIMDE_SSE2_NATIVE)
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_andnot_si128(a.n, b.n), _mm_setzero_si128())) == 0xffff;
+#else
+  uint64_t r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.u64) / sizeof(a.u64[0])) ; i++) {
+    r |= ~a.u64[i] & b.u64[i];
+  }
+  return !r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_testnzc_si128 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return _mm_testnzc_si128(a.n, b.n);
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i z = _mm_setzero_si128();
+  return (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(a.n, b.n), z)) != 0xffff) &&
+         (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_andnot_si128(a.n, b.n), z)) != 0xffff);
+#else
+  uint64_t rz = 0, rc = 0;
+  for (size_t i = 0 ; i < (sizeof(a.u64) / sizeof(a.u64[0])) ; i++) {
+    rz |= a.u64[i] & b.u64[i];
+    rc |= ~a.u64[i] & b.u64[i];
+  }
+  return (rz != 0) && (rc != 0);
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm_testz_si128 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSE4_1_NATIVE)
+  return _mm_testz_si128(a.n, b.n);
+#elif defined(SIMDE_SSE2_NATIVE)
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(a.n, b.n), _mm_setzero_si128())) == 0xffff;
+#else
+  uint64_t r = 0;
+  SIMDE__VECTORIZE_REDUCTION(|:r)
+  for (size_t i = 0 ; i < (sizeof(a.u64) / sizeof(a.u64[0])) ; i++) {
+    r |= a.u64[i] & b.u64[i];
+  }
+  return !r;
+#endif
+}
 
 SIMDE__END_DECLS
 
@@ -60,6 +60,109 @@
 
 SIMDE__BEGIN_DECLS
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_abs_epi8 (simde__m128i a) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_abs_epi8(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_min_epu8(a.n, _mm_sub_epi8(_mm_setzero_si128(), a.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    const int8_t m = a.i8[i] >> 7;
+    r.u8[i] = (uint8_t) ((a.i8[i] ^ m) - m);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_abs_epi16 (simde__m128i a) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_abs_epi16(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  return SIMDE__M128I_C(_mm_max_epi16(a.n, _mm_sub_epi16(_mm_setzero_si128(), a.n)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    const int16_t m = a.i16[i] >> 15;
+    r.u16[i] = (uint16_t) ((a.i16[i] ^ m) - m);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_abs_epi32 (simde__m128i a) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_abs_epi32(a.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i m = _mm_srai_epi32(a.n, 31);
+  return SIMDE__M128I_C(_mm_sub_epi32(_mm_xor_si128(a.n, m), m));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const uint32_t m = (uint32_t) (a.i32[i] >> 31);
+    r.u32[i] = (a.u32[i] ^ m) - m;
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_abs_pi8 (simde__m64 a) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_abs_pi8(a.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    const int8_t m = a.i8[i] >> 7;
+    r.u8[i] = (uint8_t) ((a.i8[i] ^ m) - m);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_abs_pi16 (simde__m64 a) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_abs_pi16(a.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    const int16_t m = a.i16[i] >> 15;
+    r.u16[i] = (uint16_t) ((a.i16[i] ^ m) - m);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_abs_pi32 (simde__m64 a) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_abs_pi32(a.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    const uint32_t m = (uint32_t) (a.i32[i] >> 31);
+    r.u32[i] = (a.u32[i] ^ m) - m;
+  }
+  return r;
+#endif
+}
+
 #if defined(simde_mm_alignr_epi8)
 #  undef simde_mm_alignr_epi8
 #endif
@@ -103,6 +206,336 @@ simde_mm_alignr_epi8 (simde__m128i a, simde__m128i b, int count) {
 #  define simde_mm_alignr_epi8(a, b, count) SIMDE__M128I_C(_mm_alignr_epi8(a.n, b.n, count))
 #endif
 
+#if defined(simde_mm_alignr_pi8)
+#  undef simde_mm_alignr_pi8
+#endif
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_alignr_pi8 (simde__m64 a, simde__m64 b, const int count) {
+  simde__m64 r;
+
+  if (HEDLEY_UNLIKELY(count > 15)) {
+    r.u64[0] = 0;
+  } else if (count > 7) {
+    r.u64[0] = a.u64[0] >> ((count - 8) * 8);
+  } else if (count == 0) {
+    r.u64[0] = b.u64[0];
+  } else {
+    r.u64[0] = (b.u64[0] >> (count * 8)) | (a.u64[0] << (64 - (count * 8)));
+  }
+
+  return r;
+}
+#if defined(SIMDE_SSSE3_NATIVE)
+#  define simde_mm_alignr_pi8(a, b, count) SIMDE__M64_C(_mm_alignr_pi8(a.n, b.n, count))
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_hadd_epi16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_hadd_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  /* Sum each pair in the low half of its 32-bit lane, sign-extend it
+     so the (saturating) pack can't alter it, then pack. */
+  const __m128i ta = _mm_add_epi16(a.n, _mm_srli_epi32(a.n, 16));
+  const __m128i tb = _mm_add_epi16(b.n, _mm_srli_epi32(b.n, 16));
+  return SIMDE__M128I_C(_mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(ta, 16), 16),
+                                        _mm_srai_epi32(_mm_slli_epi32(tb, 16), 16)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < ((sizeof(r.i16) / sizeof(r.i16[0])) / 2) ; i++) {
+    r.i16[    i] = (int16_t) (a.u16[2 * i] + a.u16[(2 * i) + 1]);
+    r.i16[4 + i] = (int16_t) (b.u16[2 * i] + b.u16[(2 * i) + 1]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_hadd_epi32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_hadd_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128 fa = _mm_castsi128_ps(a.n);
+  const __m128 fb = _mm_castsi128_ps(b.n);
+  return SIMDE__M128I_C(_mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))),
+                                      _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1)))));
+#else
+  simde__m128i r;
+  r.u32[0] = a.u32[0] + a.u32[1];
+  r.u32[1] = a.u32[2] + a.u32[3];
+  r.u32[2] = b.u32[0] + b.u32[1];
+  r.u32[3] = b.u32[2] + b.u32[3];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_hadd_pi16 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_hadd_pi16(a.n, b.n));
+#else
+  simde__m64 r;
+  r.i16[0] = (int16_t) (a.u16[0] + a.u16[1]);
+  r.i16[1] = (int16_t) (a.u16[2] + a.u16[3]);
+  r.i16[2] = (int16_t) (b.u16[0] + b.u16[1]);
+  r.i16[3] = (int16_t) (b.u16[2] + b.u16[3]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_hadd_pi32 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_hadd_pi32(a.n, b.n));
+#else
+  simde__m64 r;
+  r.u32[0] = a.u32[0] + a.u32[1];
+  r.u32[1] = b.u32[0] + b.u32[1];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_hadds_epi16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_hadds_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  /* Widen each pair to 32 bits, add, and let packs saturate. */
+  const __m128i ta = _mm_add_epi32(_mm_srai_epi32(_mm_slli_epi32(a.n, 16), 16), _mm_srai_epi32(a.n, 16));
+  const __m128i tb = _mm_add_epi32(_mm_srai_epi32(_mm_slli_epi32(b.n, 16), 16), _mm_srai_epi32(b.n, 16));
+  return SIMDE__M128I_C(_mm_packs_epi32(ta, tb));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < ((sizeof(r.i16) / sizeof(r.i16[0])) / 2) ; i++) {
+    const int32_t ta = a.i16[2 * i] + a.i16[(2 * i) + 1];
+    const int32_t tb = b.i16[2 * i] + b.i16[(2 * i) + 1];
+    r.i16[    i] = (int16_t) ((ta < INT16_MIN) ? INT16_MIN : ((ta > INT16_MAX) ? INT16_MAX : ta));
+    r.i16[4 + i] = (int16_t) ((tb < INT16_MIN) ? INT16_MIN : ((tb > INT16_MAX) ? INT16_MAX : tb));
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_hadds_pi16 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_hadds_pi16(a.n, b.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < ((sizeof(r.i16) / sizeof(r.i16[0])) / 2) ; i++) {
+    const int32_t ta = a.i16[2 * i] + a.i16[(2 * i) + 1];
+    const int32_t tb = b.i16[2 * i] + b.i16[(2 * i) + 1];
+    r.i16[    i] = (int16_t) ((ta < INT16_MIN) ? INT16_MIN : ((ta > INT16_MAX) ? INT16_MAX : ta));
+    r.i16[2 + i] = (int16_t) ((tb < INT16_MIN) ? INT16_MIN : ((tb > INT16_MAX) ? INT16_MAX : tb));
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_hsub_epi16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_hsub_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i ta = _mm_sub_epi16(a.n, _mm_srli_epi32(a.n, 16));
+  const __m128i tb = _mm_sub_epi16(b.n, _mm_srli_epi32(b.n, 16));
+  return SIMDE__M128I_C(_mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(ta, 16), 16),
+                                        _mm_srai_epi32(_mm_slli_epi32(tb, 16), 16)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < ((sizeof(r.i16) / sizeof(r.i16[0])) / 2) ; i++) {
+    r.i16[    i] = (int16_t) (a.u16[2 * i] - a.u16[(2 * i) + 1]);
+    r.i16[4 + i] = (int16_t) (b.u16[2 * i] - b.u16[(2 * i) + 1]);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_hsub_epi32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_hsub_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128 fa = _mm_castsi128_ps(a.n);
+  const __m128 fb = _mm_castsi128_ps(b.n);
+  return SIMDE__M128I_C(_mm_sub_epi32(_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))),
+                                      _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1)))));
+#else
+  simde__m128i r;
+  r.u32[0] = a.u32[0] - a.u32[1];
+  r.u32[1] = a.u32[2] - a.u32[3];
+  r.u32[2] = b.u32[0] - b.u32[1];
+  r.u32[3] = b.u32[2] - b.u32[3];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_hsub_pi16 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_hsub_pi16(a.n, b.n));
+#else
+  simde__m64 r;
+  r.i16[0] = (int16_t) (a.u16[0] - a.u16[1]);
+  r.i16[1] = (int16_t) (a.u16[2] - a.u16[3]);
+  r.i16[2] = (int16_t) (b.u16[0] - b.u16[1]);
+  r.i16[3] = (int16_t) (b.u16[2] - b.u16[3]);
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_hsub_pi32 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_hsub_pi32(a.n, b.n));
+#else
+  simde__m64 r;
+  r.u32[0] = a.u32[0] - a.u32[1];
+  r.u32[1] = b.u32[0] - b.u32[1];
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_hsubs_epi16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_hsubs_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i ta = _mm_sub_epi32(_mm_srai_epi32(_mm_slli_epi32(a.n, 16), 16), _mm_srai_epi32(a.n, 16));
+  const __m128i tb = _mm_sub_epi32(_mm_srai_epi32(_mm_slli_epi32(b.n, 16), 16), _mm_srai_epi32(b.n, 16));
+  return SIMDE__M128I_C(_mm_packs_epi32(ta, tb));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < ((sizeof(r.i16) / sizeof(r.i16[0])) / 2) ; i++) {
+    const int32_t ta = a.i16[2 * i] - a.i16[(2 * i) + 1];
+    const int32_t tb = b.i16[2 * i] - b.i16[(2 * i) + 1];
+    r.i16[    i] = (int16_t) ((ta < INT16_MIN) ? INT16_MIN : ((ta > INT16_MAX) ? INT16_MAX : ta));
+    r.i16[4 + i] = (int16_t) ((tb < INT16_MIN) ? INT16_MIN : ((tb > INT16_MAX) ? INT16_MAX : tb));
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_hsubs_pi16 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_hsubs_pi16(a.n, b.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < ((sizeof(r.i16) / sizeof(r.i16[0])) / 2) ; i++) {
+    const int32_t ta = a.i16[2 * i] - a.i16[(2 * i) + 1];
+    const int32_t tb = b.i16[2 * i] - b.i16[(2 * i) + 1];
+    r.i16[    i] = (int16_t) ((ta < INT16_MIN) ? INT16_MIN : ((ta > INT16_MAX) ? INT16_MAX : ta));
+    r.i16[2 + i] = (int16_t) ((tb < INT16_MIN) ? INT16_MIN : ((tb > INT16_MAX) ? INT16_MAX : tb));
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maddubs_epi16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_maddubs_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  /* Zero-extend a and sign-extend b into 16-bit lanes; no single
+     product can overflow, only the final sum needs to saturate. */
+  const __m128i a_even = _mm_and_si128(a.n, _mm_set1_epi16(0x00ff));
+  const __m128i a_odd  = _mm_srli_epi16(a.n, 8);
+  const __m128i b_even = _mm_srai_epi16(_mm_slli_epi16(b.n, 8), 8);
+  const __m128i b_odd  = _mm_srai_epi16(b.n, 8);
+  return SIMDE__M128I_C(_mm_adds_epi16(_mm_mullo_epi16(a_even, b_even), _mm_mullo_epi16(a_odd, b_odd)));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    const int32_t t =
+      (a.u8[  2 * i    ] * b.i8[  2 * i    ]) +
+      (a.u8[(2 * i) + 1] * b.i8[(2 * i) + 1]);
+    r.i16[i] = (int16_t) ((t < INT16_MIN) ? INT16_MIN : ((t > INT16_MAX) ? INT16_MAX : t));
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_maddubs_pi16 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_maddubs_pi16(a.n, b.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    const int32_t t =
+      (a.u8[  2 * i    ] * b.i8[  2 * i    ]) +
+      (a.u8[(2 * i) + 1] * b.i8[(2 * i) + 1]);
+    r.i16[i] = (int16_t) ((t < INT16_MIN) ? INT16_MIN : ((t > INT16_MAX) ? INT16_MAX : t));
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mulhrs_epi16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_mulhrs_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  /* Rebuild the 32-bit products, round, then keep the low 16 bits
+     (-32768 * -32768 wraps, it doesn't saturate). */
+  const __m128i lo = _mm_mullo_epi16(a.n, b.n);
+  const __m128i hi = _mm_mulhi_epi16(a.n, b.n);
+  const __m128i round = _mm_set1_epi32(0x4000);
+  __m128i r0 = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(lo, hi), round), 15);
+  __m128i r1 = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(lo, hi), round), 15);
+  r0 = _mm_srai_epi32(_mm_slli_epi32(r0, 16), 16);
+  r1 = _mm_srai_epi32(_mm_slli_epi32(r1, 16), 16);
+  return SIMDE__M128I_C(_mm_packs_epi32(r0, r1));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.u16[i] = (uint16_t) ((((a.i16[i] * b.i16[i]) + 0x4000) >> 15) & 0xffff);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_mulhrs_pi16 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_mulhrs_pi16(a.n, b.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.u16[i] = (uint16_t) ((((a.i16[i] * b.i16[i]) + 0x4000) >> 15) & 0xffff);
+  }
+  return r;
+#endif
+}
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_shuffle_epi8 (simde__m128i a, simde__m128i b) {
@@ -121,6 +554,125 @@ simde_mm_shuffle_epi8 (simde__m128i a, simde__m128i b) {
 #endif
 }
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_shuffle_pi8 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_shuffle_pi8(a.n, b.n));
+#else
+  simde__m64 r;
+  for (size_t i = 0 ; i < (sizeof(r.u8) / sizeof(r.u8[0])) ; i++) {
+    r.u8[i] = a.u8[b.u8[i] & 7] & (~(b.i8[i]) >> 7);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sign_epi8 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_sign_epi8(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i neg = _mm_cmplt_epi8(b.n, zero);
+  const __m128i r = _mm_sub_epi8(_mm_xor_si128(a.n, neg), neg);
+  return SIMDE__M128I_C(_mm_andnot_si128(_mm_cmpeq_epi8(b.n, zero), r));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.u8[i] = (b.i8[i] < 0) ? (uint8_t) (-a.u8[i]) : ((b.i8[i] > 0) ? a.u8[i] : 0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_sign_pi8 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_sign_pi8(a.n, b.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i8) / sizeof(r.i8[0])) ; i++) {
+    r.u8[i] = (b.i8[i] < 0) ? (uint8_t) (-a.u8[i]) : ((b.i8[i] > 0) ? a.u8[i] : 0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sign_epi16 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_sign_epi16(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i neg = _mm_cmplt_epi16(b.n, zero);
+  const __m128i r = _mm_sub_epi16(_mm_xor_si128(a.n, neg), neg);
+  return SIMDE__M128I_C(_mm_andnot_si128(_mm_cmpeq_epi16(b.n, zero), r));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.u16[i] = (b.i16[i] < 0) ? (uint16_t) (-a.u16[i]) : ((b.i16[i] > 0) ? a.u16[i] : 0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_sign_pi16 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_sign_pi16(a.n, b.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i16) / sizeof(r.i16[0])) ; i++) {
+    r.u16[i] = (b.i16[i] < 0) ? (uint16_t) (-a.u16[i]) : ((b.i16[i] > 0) ? a.u16[i] : 0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sign_epi32 (simde__m128i a, simde__m128i b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M128I_C(_mm_sign_epi32(a.n, b.n));
+#elif defined(SIMDE_SSE2_NATIVE)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i neg = _mm_cmplt_epi32(b.n, zero);
+  const __m128i r = _mm_sub_epi32(_mm_xor_si128(a.n, neg), neg);
+  return SIMDE__M128I_C(_mm_andnot_si128(_mm_cmpeq_epi32(b.n, zero), r));
+#else
+  simde__m128i r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.u32[i] = (b.i32[i] < 0) ? (uint32_t) (-a.u32[i]) : ((b.i32[i] > 0) ? a.u32[i] : 0);
+  }
+  return r;
+#endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m64
+simde_mm_sign_pi32 (simde__m64 a, simde__m64 b) {
+#if defined(SIMDE_SSSE3_NATIVE)
+  return SIMDE__M64_C(_mm_sign_pi32(a.n, b.n));
+#else
+  simde__m64 r;
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r.i32) / sizeof(r.i32[0])) ; i++) {
+    r.u32[i] = (b.i32[i] < 0) ? (uint32_t) (-a.u32[i]) : ((b.i32[i] > 0) ? a.u32[i] : 0);
+  }
+  return r;
+#endif
+}
+
 SIMDE__END_DECLS
 
-#endif /* !defined(SIMDE__SSE2_H) */
+#endif /* !defined(SIMDE__SSSE3_H) */
@@ -0,0 +1,290 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../aes.h"
+
+static MunitResult
+test_simde_mm_aesdec_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i round_key;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0xb15fc9d3), UINT32_C(0x25dce7d2), UINT32_C(0x81edbda1), UINT32_C(0x066822ec)),
+      simde_x_mm_set_epu32(UINT32_C(0x59ed0ece), UINT32_C(0x73b96ae2), UINT32_C(0x3387ec27), UINT32_C(0x467ee882)),
+      simde_x_mm_set_epu32(UINT32_C(0x665ae146), UINT32_C(0xa68a027f), UINT32_C(0xf4603bf3), UINT32_C(0xaecebe1f)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xd950478e), UINT32_C(0xf896bd76), UINT32_C(0x983bda5b), UINT32_C(0x3c4c9ad9)),
+      simde_x_mm_set_epu32(UINT32_C(0x8f69c22d), UINT32_C(0x9d06da9e), UINT32_C(0x88e13837), UINT32_C(0x9b85940c)),
+      simde_x_mm_set_epu32(UINT32_C(0x2e95dd60), UINT32_C(0x029c5bd7), UINT32_C(0xafa40888), UINT32_C(0x95772666)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x940e9d3a), UINT32_C(0xfcc4b763), UINT32_C(0x3437b5b3), UINT32_C(0xe66e2165)),
+      simde_x_mm_set_epu32(UINT32_C(0x7a910296), UINT32_C(0x2e38dd69), UINT32_C(0xaf795db0), UINT32_C(0x6aa999f5)),
+      simde_x_mm_set_epu32(UINT32_C(0xef5ad3dc), UINT32_C(0x15f03304), UINT32_C(0x2ba28888), UINT32_C(0x12a66e1c)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x116efce7), UINT32_C(0xda057489), UINT32_C(0x9bf220d8), UINT32_C(0x9c8115c9)),
+      simde_x_mm_set_epu32(UINT32_C(0x57393e6d), UINT32_C(0x84e0814e), UINT32_C(0x44dbd863), UINT32_C(0x9e2230ad)),
+      simde_x_mm_set_epu32(UINT32_C(0x22b45990), UINT32_C(0x812c8052), UINT32_C(0x1195a23f), UINT32_C(0x661e5c9c)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe8eff3f6), UINT32_C(0x02fc03b2), UINT32_C(0x85400090), UINT32_C(0xb8d1151c)),
+      simde_x_mm_set_epu32(UINT32_C(0xca0b39e4), UINT32_C(0xfa2996f8), UINT32_C(0xee953089), UINT32_C(0x33bc1c1e)),
+      simde_x_mm_set_epu32(UINT32_C(0x1de66c60), UINT32_C(0x87ea80a5), UINT32_C(0x3d46d9d2), UINT32_C(0xc95bf463)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x5289c47a), UINT32_C(0xa50f4c2a), UINT32_C(0xe7c5a19b), UINT32_C(0x608f6019)),
+      simde_x_mm_set_epu32(UINT32_C(0xcabdaa5f), UINT32_C(0x043ee099), UINT32_C(0xad9dd29b), UINT32_C(0x4ee38e71)),
+      simde_x_mm_set_epu32(UINT32_C(0xfbb3b805), UINT32_C(0xae1f4de0), UINT32_C(0x03669827), UINT32_C(0x7152132f)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x7bca695c), UINT32_C(0x6277c545), UINT32_C(0x4f9c2a04), UINT32_C(0xc1217e7a)),
+      simde_x_mm_set_epu32(UINT32_C(0xccc19ed9), UINT32_C(0x21de8b07), UINT32_C(0xec6eea14), UINT32_C(0xff1f3b22)),
+      simde_x_mm_set_epu32(UINT32_C(0xe4daaebb), UINT32_C(0x5bd87603), UINT32_C(0xe79ac2c2), UINT32_C(0x2b37103c)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x6427a9ab), UINT32_C(0xe312aa87), UINT32_C(0x18ee6dc2), UINT32_C(0x30d32079)),
+      simde_x_mm_set_epu32(UINT32_C(0x7de7ceff), UINT32_C(0x9806cf85), UINT32_C(0x29d9d561), UINT32_C(0x4be110fd)),
+      simde_x_mm_set_epu32(UINT32_C(0x9e79a617), UINT32_C(0x9543057b), UINT32_C(0x51e6b7c8), UINT32_C(0xd51127b1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesdec_si128(test_vec[i].a, test_vec[i].round_key);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aesdeclast_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i round_key;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x04f56a3a), UINT32_C(0x0017a0a3), UINT32_C(0xc4c48174), UINT32_C(0xa9987757)),
+      simde_x_mm_set_epu32(UINT32_C(0xe88f12f0), UINT32_C(0x9a0b4b45), UINT32_C(0xea4b0df4), UINT32_C(0x91a8b70b)),
+      simde_x_mm_set_epu32(UINT32_C(0x5f075552), UINT32_C(0xaae9da34), UINT32_C(0xb83c0f3e), UINT32_C(0x192fefd1)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xcbfc577b), UINT32_C(0xf179d56c), UINT32_C(0x60181210), UINT32_C(0x3a944099)),
+      simde_x_mm_set_epu32(UINT32_C(0x2de664cc), UINT32_C(0xfa6c7b32), UINT32_C(0x531c4139), UINT32_C(0x5304beb2)),
+      simde_x_mm_set_epu32(UINT32_C(0x8fd2d1cf), UINT32_C(0xa38b428a), UINT32_C(0x78493345), UINT32_C(0xc3ab644b)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe7250cf9), UINT32_C(0x081d8649), UINT32_C(0x6f7e5671), UINT32_C(0x821cf511)),
+      simde_x_mm_set_epu32(UINT32_C(0xbd5cfc43), UINT32_C(0x40f76cb5), UINT32_C(0x073025bc), UINT32_C(0x6ad85094)),
+      simde_x_mm_set_epu32(UINT32_C(0xacd6202a), UINT32_C(0xf033d511), UINT32_C(0xb8f25290), UINT32_C(0x6c06d177)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x7eb847bc), UINT32_C(0x6e8bcc62), UINT32_C(0xfa23fc8e), UINT32_C(0xcd9a397d)),
+      simde_x_mm_set_epu32(UINT32_C(0xf31b86c4), UINT32_C(0xa37f6817), UINT32_C(0x3a35c044), UINT32_C(0xa3fb96bf)),
+      simde_x_mm_set_epu32(UINT32_C(0x7329a1bc), UINT32_C(0x29483dbc), UINT32_C(0x7faf9ba2), UINT32_C(0xb73580ac)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x277a1e6b), UINT32_C(0x06368b16), UINT32_C(0xe0cb33bb), UINT32_C(0x526bb67d)),
+      simde_x_mm_set_epu32(UINT32_C(0xd285fbe5), UINT32_C(0x76614411), UINT32_C(0xe63fb1ce), UINT32_C(0x497f23b4)),
+      simde_x_mm_set_epu32(UINT32_C(0x9adc35e0), UINT32_C(0x4b6422ee), UINT32_C(0x4382c830), UINT32_C(0xe95bcaa7)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x3bfdc910), UINT32_C(0xdbc4da57), UINT32_C(0xd4813f0f), UINT32_C(0x35e962d1)),
+      simde_x_mm_set_epu32(UINT32_C(0x6c94c0c2), UINT32_C(0x10394772), UINT32_C(0xdc0f153e), UINT32_C(0xbef488de)),
+      simde_x_mm_set_epu32(UINT32_C(0xb505babe), UINT32_C(0x59d262a8), UINT32_C(0x432ebec5), UINT32_C(0xa77c9a8f)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x95ff054b), UINT32_C(0xe9d88e08), UINT32_C(0xfd3280a2), UINT32_C(0xf4be3941)),
+      simde_x_mm_set_epu32(UINT32_C(0x01d50363), UINT32_C(0xbd08a8b1), UINT32_C(0xef57936d), UINT32_C(0x705b174b)),
+      simde_x_mm_set_epu32(UINT32_C(0xbb74e5af), UINT32_C(0x1052920e), UINT32_C(0x042ac877), UINT32_C(0x517621b3)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x3b8d414f), UINT32_C(0x87f20c62), UINT32_C(0xa9099019), UINT32_C(0x31433159)),
+      simde_x_mm_set_epu32(UINT32_C(0x0288dab6), UINT32_C(0xca29bdf8), UINT32_C(0x1dc2efb8), UINT32_C(0x987f0845)),
+      simde_x_mm_set_epu32(UINT32_C(0x2cc85b24), UINT32_C(0x834d2b53), UINT32_C(0xf776c136), UINT32_C(0x2f7bf050)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesdeclast_si128(test_vec[i].a, test_vec[i].round_key);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aesenc_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i round_key;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x2f9975be), UINT32_C(0x3f97b5d9), UINT32_C(0xd929b43c), UINT32_C(0x1c43594f)),
+      simde_x_mm_set_epu32(UINT32_C(0xa34aa532), UINT32_C(0xc2419db5), UINT32_C(0x4699530f), UINT32_C(0xe9f3a9e3)),
+      simde_x_mm_set_epu32(UINT32_C(0xcee107e3), UINT32_C(0x7082924c), UINT32_C(0x78dfbcd4), UINT32_C(0x51cebae1)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x39f874ca), UINT32_C(0x342703ea), UINT32_C(0x867187fa), UINT32_C(0x6887c9c6)),
+      simde_x_mm_set_epu32(UINT32_C(0x7c379bc5), UINT32_C(0x0383535f), UINT32_C(0xf3bb3b30), UINT32_C(0x056bd8dd)),
+      simde_x_mm_set_epu32(UINT32_C(0xaeeba8ea), UINT32_C(0x9c7496b4), UINT32_C(0x34a066e3), UINT32_C(0x3d7d1f49)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xd4cca807), UINT32_C(0x3b95b643), UINT32_C(0x2f87dba6), UINT32_C(0xa0aa266e)),
+      simde_x_mm_set_epu32(UINT32_C(0x4120bf92), UINT32_C(0xfc4f1bc8), UINT32_C(0xf0425350), UINT32_C(0xe7d47fe4)),
+      simde_x_mm_set_epu32(UINT32_C(0x2a0154f4), UINT32_C(0x96eb6418), UINT32_C(0x4285d661), UINT32_C(0x5e7ebf73)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xaf8556fd), UINT32_C(0x72f3e9c7), UINT32_C(0x66fd27aa), UINT32_C(0x419888f2)),
+      simde_x_mm_set_epu32(UINT32_C(0x8e34f816), UINT32_C(0x1357cad9), UINT32_C(0xfe763c01), UINT32_C(0x98e33311)),
+      simde_x_mm_set_epu32(UINT32_C(0x62cc83fd), UINT32_C(0xd3f98cf3), UINT32_C(0x856f8d74), UINT32_C(0x2b375723)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe224b34b), UINT32_C(0x86735681), UINT32_C(0xe5bb23e9), UINT32_C(0x2a508b00)),
+      simde_x_mm_set_epu32(UINT32_C(0x5d0d4d5a), UINT32_C(0xad16c26c), UINT32_C(0x60f9d59f), UINT32_C(0xa7e5f39b)),
+      simde_x_mm_set_epu32(UINT32_C(0xcc80e5ce), UINT32_C(0x2ea13849), UINT32_C(0x140e0db8), UINT32_C(0x8016ce20)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xd4a6838f), UINT32_C(0x1a33fd18), UINT32_C(0x75aa8257), UINT32_C(0x971d525d)),
+      simde_x_mm_set_epu32(UINT32_C(0xe23b1053), UINT32_C(0xa3c9a286), UINT32_C(0x8f7c0b87), UINT32_C(0xd652903d)),
+      simde_x_mm_set_epu32(UINT32_C(0x84f62ebb), UINT32_C(0x2667a6d1), UINT32_C(0x19b81c61), UINT32_C(0x4248ec1b)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe0d6722f), UINT32_C(0xe5db599c), UINT32_C(0x0b0184d1), UINT32_C(0xf54a9467)),
+      simde_x_mm_set_epu32(UINT32_C(0x34fc1e68), UINT32_C(0x235f02c8), UINT32_C(0xaf55552e), UINT32_C(0xbfacd551)),
+      simde_x_mm_set_epu32(UINT32_C(0xfc431281), UINT32_C(0x9a0b1652), UINT32_C(0x07660104), UINT32_C(0x1427dff9)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x9976f2d8), UINT32_C(0xae90c05b), UINT32_C(0x332e0a7d), UINT32_C(0x01a3343f)),
+      simde_x_mm_set_epu32(UINT32_C(0xbaf61457), UINT32_C(0xb274e640), UINT32_C(0x22633056), UINT32_C(0xb1d23567)),
+      simde_x_mm_set_epu32(UINT32_C(0xe3daf268), UINT32_C(0xe78e0b7b), UINT32_C(0x42d29422), UINT32_C(0xee29c0aa)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesenc_si128(test_vec[i].a, test_vec[i].round_key);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aesenclast_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i round_key;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0xf5b58045), UINT32_C(0x82214465), UINT32_C(0x6ae5b6ec), UINT32_C(0xac77e8db)),
+      simde_x_mm_set_epu32(UINT32_C(0xcacd514f), UINT32_C(0x5e6d38b2), UINT32_C(0x22bf40c9), UINT32_C(0x40b560f7)),
+      simde_x_mm_set_epu32(UINT32_C(0xd914ca21), UINT32_C(0x5c98f5ff), UINT32_C(0xb36a5b07), UINT32_C(0xa6482e4e)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xca85f5e4), UINT32_C(0xb3183556), UINT32_C(0x010bfe67), UINT32_C(0x1e24d7c3)),
+      simde_x_mm_set_epu32(UINT32_C(0xb1efb330), UINT32_C(0x63b7c4b2), UINT32_C(0x8658c808), UINT32_C(0x2e6dd4db)),
+      simde_x_mm_set_epu32(UINT32_C(0xdcc4bd59), UINT32_C(0x1f812203), UINT32_C(0xf4cf5e8d), UINT32_C(0x5ac06ff5)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xebf844cc), UINT32_C(0x867f9ffe), UINT32_C(0x3e678b86), UINT32_C(0x0fea4d3b)),
+      simde_x_mm_set_epu32(UINT32_C(0xaf9be090), UINT32_C(0xbf563ee4), UINT32_C(0xb51bcc26), UINT32_C(0xe43f3e34)),
+      simde_x_mm_set_epu32(UINT32_C(0xeb1e03db), UINT32_C(0x0dd1255f), UINT32_C(0xc35a1762), UINT32_C(0x0ded03d6)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x5e715744), UINT32_C(0x9e35baa2), UINT32_C(0x2fb67712), UINT32_C(0x9a25e50f)),
+      simde_x_mm_set_epu32(UINT32_C(0xd3cbfd09), UINT32_C(0x5372779e), UINT32_C(0x249a5ce0), UINT32_C(0xd33038a0)),
+      simde_x_mm_set_epu32(UINT32_C(0xd8852412), UINT32_C(0x464d2ca4), UINT32_C(0x9c39a829), UINT32_C(0x8ba6cdd6)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xa5ad412a), UINT32_C(0x68723f76), UINT32_C(0xc0b68276), UINT32_C(0xc92e656b)),
+      simde_x_mm_set_epu32(UINT32_C(0x08c83cd1), UINT32_C(0x445edd15), UINT32_C(0x1fed1567), UINT32_C(0x391e3b62)),
+      simde_x_mm_set_epu32(UINT32_C(0x4d867134), UINT32_C(0xfe6f5e2d), UINT32_C(0xc278605f), UINT32_C(0x3f5e281d)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xd402e5f7), UINT32_C(0x66f76bbb), UINT32_C(0x28d59e4b), UINT32_C(0x9eeaa71a)),
+      simde_x_mm_set_epu32(UINT32_C(0x02057e82), UINT32_C(0x6d331740), UINT32_C(0x792ce545), UINT32_C(0xa2790c5f)),
+      simde_x_mm_set_epu32(UINT32_C(0x310622ea), UINT32_C(0x59b4ceaa), UINT32_C(0x725b9af6), UINT32_C(0xea1107fd)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xa655f9aa), UINT32_C(0x5e77a82c), UINT32_C(0x91ead901), UINT32_C(0x86a3cba8)),
+      simde_x_mm_set_epu32(UINT32_C(0xd2812c0c), UINT32_C(0xdbe81bf3), UINT32_C(0xcf9c1450), UINT32_C(0x63fd533e)),
+      simde_x_mm_set_epu32(UINT32_C(0x8a0633a0), UINT32_C(0x5ae28282), UINT32_C(0x8b60d62c), UINT32_C(0x470866fc)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x10a68024), UINT32_C(0xf114b865), UINT32_C(0x20eff2ea), UINT32_C(0x99fa99a8)),
+      simde_x_mm_set_epu32(UINT32_C(0x656eaf72), UINT32_C(0xf887a54d), UINT32_C(0x5cacca28), UINT32_C(0xd2878f9c)),
+      simde_x_mm_set_epu32(UINT32_C(0xc4b14144), UINT32_C(0x4faa6800), UINT32_C(0xb288a6af), UINT32_C(0x187d065e)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesenclast_si128(test_vec[i].a, test_vec[i].round_key);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aesimc_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x1a2c11b9), UINT32_C(0x67619855), UINT32_C(0xc5755843), UINT32_C(0xf23ae125)),
+      simde_x_mm_set_epu32(UINT32_C(0x69204592), UINT32_C(0x1b7469cd), UINT32_C(0x1452c429), UINT32_C(0x67a16ca6)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x60aef6fa), UINT32_C(0xd78124d4), UINT32_C(0x35a036f1), UINT32_C(0xbafcb110)),
+      simde_x_mm_set_epu32(UINT32_C(0xa9eaa021), UINT32_C(0xd1837581), UINT32_C(0x5e3af9cf), UINT32_C(0x4773994a)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x0437055d), UINT32_C(0x848e0ac7), UINT32_C(0x520f4fb7), UINT32_C(0xb23125a5)),
+      simde_x_mm_set_epu32(UINT32_C(0xacfc7b40), UINT32_C(0xa900b2dc), UINT32_C(0x0d994170), UINT32_C(0xed517cc3)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x8cb4864c), UINT32_C(0x430a7659), UINT32_C(0xbeff4565), UINT32_C(0xbcf0e087)),
+      simde_x_mm_set_epu32(UINT32_C(0x1c2ae92d), UINT32_C(0xd8b4212b), UINT32_C(0x9667af3f), UINT32_C(0xc9c7c3e6)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x18f5c2e2), UINT32_C(0xaddc9748), UINT32_C(0xf9a80a79), UINT32_C(0xd3941a8f)),
+      simde_x_mm_set_epu32(UINT32_C(0x4d971601), UINT32_C(0x3df14022), UINT32_C(0x2a4a9ddf), UINT32_C(0x7a6e0cca)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe1a21374), UINT32_C(0xa3b2b87a), UINT32_C(0x2e3b90d0), UINT32_C(0x864da6d0)),
+      simde_x_mm_set_epu32(UINT32_C(0x2a4e90d0), UINT32_C(0x778cd1f9), UINT32_C(0xcc5bd81a), UINT32_C(0x88a0c95c)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xb4571f11), UINT32_C(0xe00e81d0), UINT32_C(0x7d52f113), UINT32_C(0x786c176f)),
+      simde_x_mm_set_epu32(UINT32_C(0xbb4dd1ca), UINT32_C(0x2fac2b17), UINT32_C(0x58ec552c), UINT32_C(0xd06967b2)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x1ec345e1), UINT32_C(0xca175acc), UINT32_C(0x288ab921), UINT32_C(0x8ec98bb8)),
+      simde_x_mm_set_epu32(UINT32_C(0x1076b9a6), UINT32_C(0x95d2939f), UINT32_C(0xb9be5c61), UINT32_C(0x0f61e2f8)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesimc_si128(test_vec[i].a);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aeskeygenassist_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0xc0b939e5), UINT32_C(0x50358ba3), UINT32_C(0x549cd352), UINT32_C(0xd2b7c0c4)),
+      simde_x_mm_set_epu32(UINT32_C(0xd9ba5609), UINT32_C(0xba5612d9), UINT32_C(0x0020de7d), UINT32_C(0x20de6600)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x7aa3dc1d), UINT32_C(0xd1e48709), UINT32_C(0x035b9a66), UINT32_C(0xe33be328)),
+      simde_x_mm_set_epu32(UINT32_C(0xa4da0a9d), UINT32_C(0xda0a86a4), UINT32_C(0x337b39a3), UINT32_C(0x7b39b833)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x04132f1f), UINT32_C(0x001b8940), UINT32_C(0x014cbac9), UINT32_C(0x57133181)),
+      simde_x_mm_set_epu32(UINT32_C(0xc0f27d0e), UINT32_C(0xf27d15c0), UINT32_C(0xdd7c29ef), UINT32_C(0x7c29f4dd)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xd8620d61), UINT32_C(0x9a2ea8c5), UINT32_C(0xb746f0df), UINT32_C(0xeca47429)),
+      simde_x_mm_set_epu32(UINT32_C(0xef61aacc), UINT32_C(0x61aad7ef), UINT32_C(0x9ea95a97), UINT32_C(0xa95a8c9e)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x0a6376ab), UINT32_C(0xc1961c50), UINT32_C(0xf37780d1), UINT32_C(0x80a13833)),
+      simde_x_mm_set_epu32(UINT32_C(0x6267fb23), UINT32_C(0x67fb3862), UINT32_C(0x3e0df5d6), UINT32_C(0x0df5cd3e)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x693bced0), UINT32_C(0x2c0f02c7), UINT32_C(0x2880a808), UINT32_C(0x7a04498d)),
+      simde_x_mm_set_epu32(UINT32_C(0x70f9e290), UINT32_C(0xf9e28b70), UINT32_C(0x3034cdd9), UINT32_C(0x34cdc230)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xf1ca0035), UINT32_C(0xb206f2c0), UINT32_C(0x42fda02f), UINT32_C(0x47c252a7)),
+      simde_x_mm_set_epu32(UINT32_C(0x96a17478), UINT32_C(0xa1746396), UINT32_C(0x152c54fb), UINT32_C(0x2c54e015)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xb6ba0597), UINT32_C(0x7d0c34fe), UINT32_C(0x28cae714), UINT32_C(0x83ffd447)),
+      simde_x_mm_set_epu32(UINT32_C(0x884ef470), UINT32_C(0x4ef46b88), UINT32_C(0xfa34748f), UINT32_C(0x347494fa)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aeskeygenassist_si128(test_vec[i].a, 0x1b);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm_aesdec_si128",          test_simde_mm_aesdec_si128,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_aesdeclast_si128",      test_simde_mm_aesdeclast_si128,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_aesenc_si128",          test_simde_mm_aesenc_si128,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_aesenclast_si128",      test_simde_mm_aesenclast_si128,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_aesimc_si128",          test_simde_mm_aesimc_si128,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_aeskeygenassist_si128", test_simde_mm_aeskeygenassist_si128, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_aes_test_suite = {
+  (char*) "/aes",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
@@ -0,0 +1,4595 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../avx.h"
+
+#include <math.h>
+
+#if !defined(_WIN32)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+static MunitResult
+test_simde_mm_cmp_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128i ge_os;
+    simde__m128i neq_uq;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -80.55,     46.38),
+      simde_mm_set_pd(   -89.61,    -77.57),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_pd(   -69.56,     61.05),
+      simde_mm_set_pd(    79.32,     61.05),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm_set_pd(   -76.60,     82.08),
+      simde_mm_set_pd(      NAN,    -57.64),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_pd(    81.96,     36.19),
+      simde_mm_set_pd(     8.74,     36.19),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm_set_pd(    15.87,    -40.96),
+      simde_mm_set_pd(   -19.65,     99.08),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                   0)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_pd(   -90.17,      2.88),
+      simde_mm_set_pd(   -49.53,      2.88),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm_set_pd(    91.65,     30.11),
+      simde_mm_set_pd(    37.87,       NAN),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                   0)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_pd(    -5.60,    -61.59),
+      simde_mm_set_pd(    36.59,    -61.59),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r;
+
+    r = simde_mm_cmp_pd(test_vec[i].a, test_vec[i].b, simde_CMP_GE_OS);
+    simde_assert_m128d_u64(r, ==, test_vec[i].ge_os);
+    r = simde_mm_cmp_pd(test_vec[i].a, test_vec[i].b, simde_CMP_NEQ_UQ);
+    simde_assert_m128d_u64(r, ==, test_vec[i].neq_uq);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmp_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128i ge_os;
+    simde__m128i neq_uq;
+  } test_vec[8] = {
+    { simde_mm_set_ps(   -93.30f,    -51.58f,     30.80f,     74.89f),
+      simde_mm_set_ps(    -5.97f,     -1.93f,     45.13f,    -14.28f),
+      simde_mm_set_epi32(          0,           0,           0,          -1),
+      simde_mm_set_epi32(         -1,          -1,          -1,          -1) },
+    { simde_mm_set_ps(    38.36f,    -89.02f,     54.59f,     50.91f),
+      simde_mm_set_ps(   -30.56f,     63.00f,     88.97f,     50.91f),
+      simde_mm_set_epi32(         -1,           0,           0,          -1),
+      simde_mm_set_epi32(         -1,          -1,          -1,           0) },
+    { simde_mm_set_ps(   -84.35f,    -55.81f,    -47.48f,    -83.56f),
+      simde_mm_set_ps(       NAN,    -47.44f,     97.98f,    -40.48f),
+      simde_mm_set_epi32(          0,           0,           0,           0),
+      simde_mm_set_epi32(         -1,          -1,          -1,          -1) },
+    { simde_mm_set_ps(   -90.86f,    -42.52f,    -80.03f,     53.14f),
+      simde_mm_set_ps(    -4.20f,     64.76f,        NAN,     53.14f),
+      simde_mm_set_epi32(          0,           0,           0,          -1),
+      simde_mm_set_epi32(         -1,          -1,          -1,           0) },
+    { simde_mm_set_ps(    43.04f,    -63.18f,    -76.22f,    -90.42f),
+      simde_mm_set_ps(   -85.46f,     24.47f,     41.24f,        NAN),
+      simde_mm_set_epi32(         -1,           0,           0,           0),
+      simde_mm_set_epi32(         -1,          -1,          -1,          -1) },
+    { simde_mm_set_ps(    -8.21f,     19.76f,    -83.55f,    -97.90f),
+      simde_mm_set_ps(   -52.09f,    -29.60f,    -95.82f,    -97.90f),
+      simde_mm_set_epi32(         -1,          -1,          -1,          -1),
+      simde_mm_set_epi32(         -1,          -1,          -1,           0) },
+    { simde_mm_set_ps(    -5.29f,        NAN,     99.59f,     -6.59f),
+      simde_mm_set_ps(    44.74f,    -82.99f,    -48.33f,    -19.62f),
+      simde_mm_set_epi32(          0,           0,          -1,          -1),
+      simde_mm_set_epi32(         -1,          -1,          -1,          -1) },
+    { simde_mm_set_ps(   -23.31f,        NAN,    -53.22f,     25.47f),
+      simde_mm_set_ps(   -38.54f,    -24.05f,     96.00f,     25.47f),
+      simde_mm_set_epi32(         -1,           0,           0,          -1),
+      simde_mm_set_epi32(         -1,          -1,          -1,           0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r;
+
+    r = simde_mm_cmp_ps(test_vec[i].a, test_vec[i].b, simde_CMP_GE_OS);
+    simde_assert_m128_u32(r, ==, test_vec[i].ge_os);
+    r = simde_mm_cmp_ps(test_vec[i].a, test_vec[i].b, simde_CMP_NEQ_UQ);
+    simde_assert_m128_u32(r, ==, test_vec[i].neq_uq);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmp_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    79.68,    -42.33),
+      simde_mm_set_pd(      NAN,     56.91),
+      simde_mm_set_epi64x(INT64_C( 4635307398472946156), INT64_C(                  -1)) },
+    { simde_mm_set_pd(      NAN,      2.32),
+      simde_mm_set_pd(   -10.07,      2.32),
+      simde_mm_set_epi64x(INT64_C( 9221120237041090560), INT64_C(                  -1)) },
+    { simde_mm_set_pd(      NAN,      7.52),
+      simde_mm_set_pd(      NAN,     95.80),
+      simde_mm_set_epi64x(INT64_C( 9221120237041090560), INT64_C(                  -1)) },
+    { simde_mm_set_pd(   -24.00,       NAN),
+      simde_mm_set_pd(    -9.54,       NAN),
+      simde_mm_set_epi64x(INT64_C(-4595923419731591168), INT64_C(                   0)) },
+    { simde_mm_set_pd(     5.72,       NAN),
+      simde_mm_set_pd(   -54.26,    -41.43),
+      simde_mm_set_epi64x(INT64_C( 4618126165894527713), INT64_C(                   0)) },
+    { simde_mm_set_pd(      NAN,    -54.27),
+      simde_mm_set_pd(    35.59,    -54.27),
+      simde_mm_set_epi64x(INT64_C( 9221120237041090560), INT64_C(                  -1)) },
+    { simde_mm_set_pd(      NAN,    -91.32),
+      simde_mm_set_pd(    37.41,     74.69),
+      simde_mm_set_epi64x(INT64_C( 9221120237041090560), INT64_C(                  -1)) },
+    { simde_mm_set_pd(   -89.27,     88.15),
+      simde_mm_set_pd(    87.82,     88.15),
+      simde_mm_set_epi64x(INT64_C(-4587389802125165855), INT64_C(                  -1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_cmp_sd(test_vec[i].a, test_vec[i].b, simde_CMP_LE_OQ);
+    simde_assert_m128d_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmp_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(       NAN,     97.33f,     -8.65f,     77.02f),
+      simde_mm_set_ps(   -11.88f,     64.46f,     23.45f,     93.72f),
+      simde_mm_set_epi32( 2143289344,  1120053494, -1056283034,          -1) },
+    { simde_mm_set_ps(    42.07f,     -7.26f,     27.93f,     38.80f),
+      simde_mm_set_ps(   -90.92f,    -57.74f,     78.69f,     38.80f),
+      simde_mm_set_epi32( 1109936046, -1058516500,  1105162404,          -1) },
+    { simde_mm_set_ps(   -65.65f,    -85.66f,    -79.74f,     33.72f),
+      simde_mm_set_ps(    85.18f,    -48.18f,     37.74f,     46.35f),
+      simde_mm_set_epi32(-1031582515, -1028959764, -1029735711,          -1) },
+    { simde_mm_set_ps(   -17.59f,    -48.01f,     85.80f,     47.87f),
+      simde_mm_set_ps(   -20.13f,     37.84f,     56.67f,     47.87f),
+      simde_mm_set_epi32(-1047742382, -1035990467,  1118542234,          -1) },
+    { simde_mm_set_ps(    21.41f,    -40.83f,    -18.04f,     69.48f),
+      simde_mm_set_ps(    79.99f,     36.40f,     34.74f,     31.75f),
+      simde_mm_set_epi32( 1101744046, -1037872660, -1047506452,           0) },
+    { simde_mm_set_ps(    76.03f,     51.26f,     77.64f,    -26.31f),
+      simde_mm_set_ps(   -98.43f,    -67.29f,     94.91f,    -26.31f),
+      simde_mm_set_epi32( 1117261660,  1112345149,  1117472686,          -1) },
+    { simde_mm_set_ps(    -7.65f,     29.58f,     -9.87f,     37.35f),
+      simde_mm_set_ps(   -63.54f,     25.33f,    -87.69f,    -64.60f),
+      simde_mm_set_epi32(-1057698611,  1106027479, -1055003771,           0) },
+    { simde_mm_set_ps(       NAN,    -79.95f,     48.53f,    -66.84f),
+      simde_mm_set_ps(    14.63f,     12.32f,     16.68f,    -66.84f),
+      simde_mm_set_epi32( 2143289344, -1029708186,  1111629496,          -1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_cmp_ss(test_vec[i].a, test_vec[i].b, simde_CMP_NGT_UQ);
+    simde_assert_m128_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskload_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128i mask;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(  -351.95,   -709.44),
+      simde_mm_set_epi64x(INT64_C( 4279387580235534067), INT64_C(-7744931839301871183)),
+      simde_mm_set_pd(     0.00,   -709.44) },
+    { simde_mm_set_pd(  -131.84,    359.64),
+      simde_mm_set_epi64x(INT64_C( 6326735503586868801), INT64_C( 7070883065906858448)),
+      simde_mm_set_pd(     0.00,      0.00) },
+    { simde_mm_set_pd(   944.01,    -49.06),
+      simde_mm_set_epi64x(INT64_C( 3184995521939448166), INT64_C( 2279981638287649158)),
+      simde_mm_set_pd(     0.00,      0.00) },
+    { simde_mm_set_pd(   930.45,   -111.02),
+      simde_mm_set_epi64x(INT64_C(-6261765649196172722), INT64_C( 3795576292676280255)),
+      simde_mm_set_pd(   930.45,      0.00) },
+    { simde_mm_set_pd(   893.09,    539.63),
+      simde_mm_set_epi64x(INT64_C(-7121200519053874070), INT64_C(-5334803950473523734)),
+      simde_mm_set_pd(   893.09,    539.63) },
+    { simde_mm_set_pd(   567.18,     79.66),
+      simde_mm_set_epi64x(INT64_C(  543680792865499023), INT64_C( 3921757833679138148)),
+      simde_mm_set_pd(     0.00,      0.00) },
+    { simde_mm_set_pd(  -766.71,    666.68),
+      simde_mm_set_epi64x(INT64_C(-8728157666133887549), INT64_C( -420432481515074726)),
+      simde_mm_set_pd(  -766.71,    666.68) },
+    { simde_mm_set_pd(   677.06,    -83.41),
+      simde_mm_set_epi64x(INT64_C(-2684380270586102377), INT64_C(-8468850738334536084)),
+      simde_mm_set_pd(   677.06,    -83.41) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 a[2];
+    memcpy(a, &(test_vec[i].a), sizeof(a));
+    simde__m128d r = simde_mm_maskload_pd(a, test_vec[i].mask);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskload_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128i mask;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -909.85f,    916.99f,    -94.33f,    -29.80f),
+      simde_mm_set_epi32( 1433429686,  1094075163,  1714024083, -1941916874),
+      simde_mm_set_ps(     0.00f,      0.00f,      0.00f,    -29.80f) },
+    { simde_mm_set_ps(  -288.89f,   -189.13f,    566.13f,   -355.05f),
+      simde_mm_set_epi32( -633825193,   516798585, -1830345560,  -853866989),
+      simde_mm_set_ps(  -288.89f,      0.00f,    566.13f,   -355.05f) },
+    { simde_mm_set_ps(  -184.54f,    838.59f,   -646.37f,    172.22f),
+      simde_mm_set_epi32(  110375766,   -34282234, -2039357250, -1649927137),
+      simde_mm_set_ps(     0.00f,    838.59f,   -646.37f,    172.22f) },
+    { simde_mm_set_ps(   195.02f,   -613.32f,     -7.68f,   -747.02f),
+      simde_mm_set_epi32(  157347138,  2024016696,  -487776530,  -620480408),
+      simde_mm_set_ps(     0.00f,      0.00f,     -7.68f,   -747.02f) },
+    { simde_mm_set_ps(   -66.51f,    111.76f,   -964.02f,   -874.44f),
+      simde_mm_set_epi32( 1268258556,  1630969168,  -780947473,  1448749020),
+      simde_mm_set_ps(     0.00f,      0.00f,   -964.02f,      0.00f) },
+    { simde_mm_set_ps(  -710.71f,    426.17f,    201.69f,    388.38f),
+      simde_mm_set_epi32( -972775126,  1801433755,   932432941, -1239172059),
+      simde_mm_set_ps(  -710.71f,      0.00f,      0.00f,    388.38f) },
+    { simde_mm_set_ps(   572.17f,   -300.82f,   -656.14f,   -762.54f),
+      simde_mm_set_epi32( -665829459,  1413484157, -2008701001,  1730436768),
+      simde_mm_set_ps(   572.17f,      0.00f,   -656.14f,      0.00f) },
+    { simde_mm_set_ps(   413.02f,     78.60f,    272.23f,   -596.03f),
+      simde_mm_set_epi32( -312137237, -1978064411,  -477332749,  1350968389),
+      simde_mm_set_ps(   413.02f,     78.60f,    272.23f,      0.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 a[4];
+    simde_mm_storeu_ps(a, test_vec[i].a);
+    simde__m128 r = simde_mm_maskload_ps(a, test_vec[i].mask);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskstore_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128i mask;
+    simde__m128d dst;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(  -933.42,   -473.28),
+      simde_mm_set_epi64x(INT64_C( 1453536698811482167), INT64_C(-7755681829270015458)),
+      simde_mm_set_pd(  -369.17,    368.69),
+      simde_mm_set_pd(  -369.17,   -473.28) },
+    { simde_mm_set_pd(   304.81,    738.34),
+      simde_mm_set_epi64x(INT64_C(-8419528290674124341), INT64_C( -131260974005394507)),
+      simde_mm_set_pd(   631.01,    -66.16),
+      simde_mm_set_pd(   304.81,    738.34) },
+    { simde_mm_set_pd(   241.24,    175.67),
+      simde_mm_set_epi64x(INT64_C(-7812784437925112028), INT64_C( 8854451913035567923)),
+      simde_mm_set_pd(  -117.12,   -612.48),
+      simde_mm_set_pd(   241.24,   -612.48) },
+    { simde_mm_set_pd(   862.94,    312.03),
+      simde_mm_set_epi64x(INT64_C(-1896801715679605196), INT64_C( 3707663245303197690)),
+      simde_mm_set_pd(   606.45,   -517.36),
+      simde_mm_set_pd(   862.94,   -517.36) },
+    { simde_mm_set_pd(  -550.75,    660.90),
+      simde_mm_set_epi64x(INT64_C( 4907527191207642847), INT64_C( 2843108236390774951)),
+      simde_mm_set_pd(   768.88,   -222.94),
+      simde_mm_set_pd(   768.88,   -222.94) },
+    { simde_mm_set_pd(   174.29,    977.30),
+      simde_mm_set_epi64x(INT64_C(-4602912754377624718), INT64_C( 1219315587881943340)),
+      simde_mm_set_pd(   333.90,   -825.81),
+      simde_mm_set_pd(   174.29,   -825.81) },
+    { simde_mm_set_pd(  -555.41,    474.76),
+      simde_mm_set_epi64x(INT64_C( 6964220127740454272), INT64_C( 6857957493584767559)),
+      simde_mm_set_pd(  -925.45,   -452.99),
+      simde_mm_set_pd(  -925.45,   -452.99) },
+    { simde_mm_set_pd(   343.84,    517.93),
+      simde_mm_set_epi64x(INT64_C( 1210629244583016897), INT64_C( 3525302845231298981)),
+      simde_mm_set_pd(   381.56,   -894.60),
+      simde_mm_set_pd(   381.56,   -894.60) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 dst[2];
+    memcpy(dst, &(test_vec[i].dst), sizeof(dst));
+    simde_mm_maskstore_pd(dst, test_vec[i].mask, test_vec[i].a);
+    simde__m128d r = simde_mm_loadu_pd(dst);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskstore_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128i mask;
+    simde__m128 dst;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -494.54f,   -550.66f,    183.23f,   -208.47f),
+      simde_mm_set_epi32( 1262191352,  1968871832, -1450259782,   841221654),
+      simde_mm_set_ps(   525.49f,   -157.04f,    787.45f,    948.87f),
+      simde_mm_set_ps(   525.49f,   -157.04f,    183.23f,    948.87f) },
+    { simde_mm_set_ps(   274.78f,    454.55f,    417.91f,   -954.91f),
+      simde_mm_set_epi32( -889331967,  -348268512,   440946758,  1794554800),
+      simde_mm_set_ps(    60.65f,   -162.97f,    899.92f,    771.62f),
+      simde_mm_set_ps(   274.78f,    454.55f,    899.92f,    771.62f) },
+    { simde_mm_set_ps(   124.36f,    867.10f,    832.82f,   -327.00f),
+      simde_mm_set_epi32( 2073835132,  1051311148,  2017183360, -1651099870),
+      simde_mm_set_ps(   139.19f,   -880.26f,   -776.13f,   -186.28f),
+      simde_mm_set_ps(   139.19f,   -880.26f,   -776.13f,   -327.00f) },
+    { simde_mm_set_ps(   752.85f,    730.34f,   -884.16f,    266.76f),
+      simde_mm_set_epi32(  111121996, -1437631159,   903566541,   643485682),
+      simde_mm_set_ps(   943.42f,   -393.81f,    -79.49f,    205.58f),
+      simde_mm_set_ps(   943.42f,    730.34f,    -79.49f,    205.58f) },
+    { simde_mm_set_ps(   729.91f,   -540.13f,   -930.17f,    630.30f),
+      simde_mm_set_epi32(-2048822971,   302501580,  -626693301,  -283073256),
+      simde_mm_set_ps(  -815.81f,    608.01f,    471.03f,   -694.69f),
+      simde_mm_set_ps(   729.91f,    608.01f,   -930.17f,    630.30f) },
+    { simde_mm_set_ps(    59.52f,   -582.30f,   -661.65f,    373.44f),
+      simde_mm_set_epi32( 1917757179,  1731436271,  1166629169,   873054240),
+      simde_mm_set_ps(  -246.91f,   -642.52f,    997.55f,   -273.74f),
+      simde_mm_set_ps(  -246.91f,   -642.52f,    997.55f,   -273.74f) },
+    { simde_mm_set_ps(   -88.26f,    645.93f,   -507.68f,   -359.57f),
+      simde_mm_set_epi32( -820688700,   584115861,  -432149351,  -360963401),
+      simde_mm_set_ps(   856.24f,   -668.60f,     89.19f,   -579.11f),
+      simde_mm_set_ps(   -88.26f,   -668.60f,   -507.68f,   -359.57f) },
+    { simde_mm_set_ps(  -408.67f,   -238.73f,    715.54f,   -823.75f),
+      simde_mm_set_epi32(  360772704,  1675151436,  -331385739,  -183717253),
+      simde_mm_set_ps(  -220.99f,   -295.04f,   -271.42f,     34.37f),
+      simde_mm_set_ps(  -220.99f,   -295.04f,    715.54f,   -823.75f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 dst[4];
+    simde_mm_storeu_ps(dst, test_vec[i].dst);
+    simde_mm_maskstore_ps(dst, test_vec[i].mask, test_vec[i].a);
+    simde__m128 r = simde_mm_loadu_ps(dst);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_add_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(  -139.46,   -493.44,   -178.35,   -150.12),
+      simde_mm256_set_pd(  -454.73,    661.68,   -427.29,   -816.90),
+      simde_mm256_set_pd(  -594.19,    168.24,   -605.64,   -967.02) },
+    { simde_mm256_set_pd(  -661.65,     62.58,    821.09,    778.20),
+      simde_mm256_set_pd(   649.91,    217.08,    307.67,    302.88),
+      simde_mm256_set_pd(   -11.74,    279.66,   1128.76,   1081.08) },
+    { simde_mm256_set_pd(   882.04,    238.50,    540.08,    395.41),
+      simde_mm256_set_pd(   758.83,    696.14,    524.46,    493.53),
+      simde_mm256_set_pd(  1640.87,    934.64,   1064.54,    888.94) },
+    { simde_mm256_set_pd(   860.16,    873.45,     39.77,     39.51),
+      simde_mm256_set_pd(  -850.62,   -215.12,   -246.33,    648.59),
+      simde_mm256_set_pd(     9.54,    658.33,   -206.56,    688.10) },
+    { simde_mm256_set_pd(  -306.57,   -455.66,   -411.00,    557.23),
+      simde_mm256_set_pd(  -164.54,   -833.46,    520.07,    -95.27),
+      simde_mm256_set_pd(  -471.11,  -1289.12,    109.07,    461.96) },
+    { simde_mm256_set_pd(   735.93,   -667.39,   -296.60,    669.36),
+      simde_mm256_set_pd(   354.88,    718.84,   -816.68,    715.47),
+      simde_mm256_set_pd(  1090.81,     51.45,  -1113.28,   1384.83) },
+    { simde_mm256_set_pd(  -403.48,    520.03,   -606.62,    317.66),
+      simde_mm256_set_pd(   644.97,   -997.31,    602.73,   -797.32),
+      simde_mm256_set_pd(   241.49,   -477.28,     -3.89,   -479.66) },
+    { simde_mm256_set_pd(  -867.86,    790.20,   -991.21,    719.08),
+      simde_mm256_set_pd(    81.08,   -117.91,   -361.09,    876.93),
+      simde_mm256_set_pd(  -786.78,    672.29,  -1352.30,   1596.01) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_add_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_add_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(  -580.51f,    -70.88f,   -386.44f,   -688.25f,
+                            -59.58f,    -54.49f,    183.70f,   -844.05f),
+      simde_mm256_set_ps(   805.77f,     98.24f,    724.38f,     78.35f,
+                            327.07f,     37.18f,   -933.16f,    367.84f),
+      simde_mm256_set_ps(   225.26f,     27.36f,    337.94f,   -609.90f,
+                            267.49f,    -17.31f,   -749.46f,   -476.21f) },
+    { simde_mm256_set_ps(   919.23f,   -244.89f,    499.57f,    977.30f,
+                            829.54f,   -446.21f,   -239.79f,   -372.43f),
+      simde_mm256_set_ps(  -632.28f,    165.73f,   -714.00f,   -345.98f,
+                           -399.28f,   -849.57f,    914.42f,   -492.15f),
+      simde_mm256_set_ps(   286.95f,    -79.16f,   -214.43f,    631.32f,
+                            430.26f,  -1295.78f,    674.63f,   -864.58f) },
+    { simde_mm256_set_ps(   890.16f,    -28.12f,    116.05f,    724.43f,
+                            -80.17f,    776.38f,    144.33f,    763.85f),
+      simde_mm256_set_ps(   686.32f,   -366.09f,    281.47f,    656.34f,
+                            288.91f,    889.40f,    527.91f,   -867.04f),
+      simde_mm256_set_ps(  1576.48f,   -394.21f,    397.52f,   1380.77f,
+                            208.74f,   1665.78f,    672.24f,   -103.19f) },
+    { simde_mm256_set_ps(   890.43f,    178.37f,    -45.04f,    303.01f,
+                             99.80f,     99.85f,   -516.17f,   -858.82f),
+      simde_mm256_set_ps(   228.15f,    -17.46f,    428.22f,    199.39f,
+                           -815.09f,    631.43f,    875.10f,   -746.40f),
+      simde_mm256_set_ps(  1118.58f,    160.91f,    383.18f,    502.40f,
+                           -715.29f,    731.28f,    358.93f,  -1605.22f) },
+    { simde_mm256_set_ps(  -992.25f,   -162.29f,    628.84f,    405.15f,
+                           -624.77f,    291.89f,   -548.65f,    416.97f),
+      simde_mm256_set_ps(   583.36f,   -294.47f,   -829.27f,    373.76f,
+                            704.40f,    279.33f,    945.75f,   -196.53f),
+      simde_mm256_set_ps(  -408.89f,   -456.76f,   -200.43f,    778.91f,
+                             79.63f,    571.22f,    397.10f,    220.44f) },
+    { simde_mm256_set_ps(  -104.44f,    397.07f,   -340.35f,    976.72f,
+                            -28.87f,   -412.48f,   -782.41f,    338.05f),
+      simde_mm256_set_ps(  -514.29f,    878.71f,    504.24f,    711.38f,
+                            104.82f,   -313.37f,    399.17f,   -900.64f),
+      simde_mm256_set_ps(  -618.73f,   1275.78f,    163.89f,   1688.10f,
+                             75.95f,   -725.85f,   -383.24f,   -562.59f) },
+    { simde_mm256_set_ps(   501.35f,    -67.84f,    538.74f,    717.90f,
+                             -3.42f,    688.69f,    452.10f,    994.88f),
+      simde_mm256_set_ps(  -911.99f,    628.61f,      5.74f,    110.28f,
+                           -124.29f,   -771.83f,    764.01f,    305.53f),
+      simde_mm256_set_ps(  -410.64f,    560.77f,    544.48f,    828.18f,
+                           -127.71f,    -83.14f,   1216.11f,   1300.41f) },
+    { simde_mm256_set_ps(  -942.37f,    -34.24f,    199.54f,    265.41f,
+                           -553.07f,    990.98f,    709.63f,   -349.94f),
+      simde_mm256_set_ps(   268.63f,    814.77f,   -805.37f,    781.57f,
+                            741.94f,     -7.02f,   -191.01f,   -878.44f),
+      simde_mm256_set_ps(  -673.74f,    780.53f,   -605.83f,   1046.98f,
+                            188.87f,    983.96f,    518.62f,  -1228.38f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_add_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_addsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   789.67,    303.65,   -845.15,     53.41),
+      simde_mm256_set_pd(   467.94,   -122.63,   -343.33,    830.81),
+      simde_mm256_set_pd(  1257.61,    426.28,  -1188.48,   -777.40) },
+    { simde_mm256_set_pd(   194.32,   -624.75,    202.64,    344.09),
+      simde_mm256_set_pd(   719.20,   -795.78,   -564.81,   -910.64),
+      simde_mm256_set_pd(   913.52,    171.03,   -362.17,   1254.73) },
+    { simde_mm256_set_pd(  -762.14,    740.61,   -898.53,    908.19),
+      simde_mm256_set_pd(   706.14,    361.23,     51.00,    110.20),
+      simde_mm256_set_pd(   -56.00,    379.38,   -847.53,    797.99) },
+    { simde_mm256_set_pd(  -353.64,    572.71,    236.27,   -497.08),
+      simde_mm256_set_pd(   402.06,     71.77,   -432.27,    175.86),
+      simde_mm256_set_pd(    48.42,    500.94,   -196.00,   -672.94) },
+    { simde_mm256_set_pd(  -696.76,     56.18,   -799.56,     55.31),
+      simde_mm256_set_pd(   710.98,    294.18,   -864.23,    555.07),
+      simde_mm256_set_pd(    14.22,   -238.00,  -1663.79,   -499.76) },
+    { simde_mm256_set_pd(   -62.47,    904.65,   -735.89,   -833.49),
+      simde_mm256_set_pd(   823.87,   -144.75,   -284.65,   -485.61),
+      simde_mm256_set_pd(   761.40,   1049.40,  -1020.54,   -347.88) },
+    { simde_mm256_set_pd(  -267.80,   -176.87,    579.85,    925.95),
+      simde_mm256_set_pd(   -43.07,   -346.15,     79.80,    373.02),
+      simde_mm256_set_pd(  -310.87,    169.28,    659.65,    552.93) },
+    { simde_mm256_set_pd(   333.12,   -824.29,   -768.03,   -880.53),
+      simde_mm256_set_pd(  -165.24,    328.47,    217.41,    827.85),
+      simde_mm256_set_pd(   167.88,  -1152.76,   -550.62,  -1708.38) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_addsub_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_addsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   469.24f,   -115.89f,    836.26f,    396.36f,
+                            329.66f,    925.32f,    593.70f,    519.84f),
+      simde_mm256_set_ps(  -630.30f,    915.15f,    371.10f,    915.11f,
+                            182.75f,    745.23f,     41.90f,   -270.63f),
+      simde_mm256_set_ps(  -161.06f,  -1031.04f,   1207.36f,   -518.75f,
+                            512.41f,    180.09f,    635.60f,    790.47f) },
+    { simde_mm256_set_ps(  -844.82f,    980.00f,    841.48f,    192.09f,
+                           -775.87f,   -424.97f,   -327.13f,    702.35f),
+      simde_mm256_set_ps(  -505.83f,   -579.56f,   -392.76f,     -6.63f,
+                           -172.47f,   -992.85f,   -714.78f,     22.79f),
+      simde_mm256_set_ps( -1350.65f,   1559.56f,    448.72f,    198.72f,
+                           -948.34f,    567.88f,  -1041.91f,    679.56f) },
+    { simde_mm256_set_ps(  -564.25f,    829.31f,   -217.24f,   -854.67f,
+                           -873.45f,     -1.15f,    511.68f,    434.80f),
+      simde_mm256_set_ps(   300.75f,    230.37f,   -103.69f,   -501.64f,
+                           -619.76f,   -232.09f,    797.73f,   -788.42f),
+      simde_mm256_set_ps(  -263.50f,    598.94f,   -320.93f,   -353.03f,
+                          -1493.21f,    230.94f,   1309.41f,   1223.22f) },
+    { simde_mm256_set_ps(   291.70f,    970.31f,    141.14f,   -292.99f,
+                           -127.17f,     18.32f,     92.34f,    727.39f),
+      simde_mm256_set_ps(   922.90f,    536.13f,    602.61f,    274.63f,
+                            227.90f,   -459.63f,    552.99f,    159.71f),
+      simde_mm256_set_ps(  1214.60f,    434.18f,    743.75f,   -567.62f,
+                            100.73f,    477.95f,    645.33f,    567.68f) },
+    { simde_mm256_set_ps(  -387.38f,    160.44f,    805.36f,   -326.70f,
+                           -421.39f,   -958.49f,    927.03f,     75.28f),
+      simde_mm256_set_ps(   137.92f,    197.67f,    -22.54f,    348.76f,
+                           -567.40f,   -711.60f,    447.86f,      2.77f),
+      simde_mm256_set_ps(  -249.46f,    -37.23f,    782.82f,   -675.46f,
+                           -988.79f,   -246.89f,   1374.89f,     72.51f) },
+    { simde_mm256_set_ps(   385.85f,    696.56f,     61.89f,   -421.81f,
+                           -514.51f,   -886.22f,    364.20f,    623.76f),
+      simde_mm256_set_ps(  -365.04f,   -612.76f,   -676.62f,    993.71f,
+                           -613.69f,   -282.19f,   -192.25f,     76.35f),
+      simde_mm256_set_ps(    20.81f,   1309.32f,   -614.73f,  -1415.52f,
+                          -1128.20f,   -604.03f,    171.95f,    547.41f) },
+    { simde_mm256_set_ps(  -783.41f,   -813.08f,   -471.04f,    -42.20f,
+                           -709.65f,   -790.84f,   -681.84f,   -870.88f),
+      simde_mm256_set_ps(  -655.37f,    746.05f,    828.73f,   -425.93f,
+                            631.08f,   -638.63f,   -224.14f,    305.29f),
+      simde_mm256_set_ps( -1438.78f,  -1559.13f,    357.69f,    383.73f,
+                            -78.57f,   -152.21f,   -905.98f,  -1176.17f) },
+    { simde_mm256_set_ps(   190.86f,   -800.18f,   -993.64f,   -410.26f,
+                            596.10f,    916.68f,    344.04f,   -624.40f),
+      simde_mm256_set_ps(   888.75f,   -674.71f,     57.75f,   -624.26f,
+                            627.59f,   -175.09f,     15.68f,   -163.12f),
+      simde_mm256_set_ps(  1079.61f,   -125.47f,   -935.89f,    214.00f,
+                           1223.69f,   1091.77f,    359.72f,   -461.28f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_addsub_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_and_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-8468007357031904514), INT64_C( 8128043134002243763),
+                             INT64_C(-6222343682407571421), INT64_C(-3212874766637790527)),
+      simde_mm256_set_epi64x(INT64_C( 7893462921058739647), INT64_C( -987151637348497248),
+                             INT64_C( 1042479244532642304), INT64_C(-2735960619421606127)),
+      simde_mm256_set_epi64x(INT64_C(  579574726270648510), INT64_C( 8091996564257605792),
+                             INT64_C(  587017442615713792), INT64_C(-3314224587525846527)) },
+    { simde_mm256_set_epi64x(INT64_C( 4722054792953783817), INT64_C( 1478040827992175563),
+                             INT64_C( -350533070329064026), INT64_C(-1016027368036795581)),
+      simde_mm256_set_epi64x(INT64_C(-1604903128540285912), INT64_C( 3847459113931478300),
+                             INT64_C(-8315267173793245391), INT64_C( -952536119823843956)),
+      simde_mm256_set_epi64x(INT64_C( 4722051768030094344), INT64_C( 1441162932812058888),
+                             INT64_C(-8646304321836526304), INT64_C(-1097109813109507840)) },
+    { simde_mm256_set_epi64x(INT64_C( 5254779351438723586), INT64_C(-6863763543633930047),
+                             INT64_C(-8542017213972850781), INT64_C(-3940144522914637512)),
+      simde_mm256_set_epi64x(INT64_C( 2042905169693738330), INT64_C( 3443222188164308692),
+                             INT64_C( 6602378062368085417), INT64_C(-7324032006471022851)),
+      simde_mm256_set_epi64x(INT64_C(  596895624813608962), INT64_C( 2344123898377033920),
+                             INT64_C(  657535002581407137), INT64_C(-8623888470945824712)) },
+    { simde_mm256_set_epi64x(INT64_C(-8305192684523296251), INT64_C(   93877602893765111),
+                             INT64_C(-7038632051985097714), INT64_C( 5569307091982443558)),
+      simde_mm256_set_epi64x(INT64_C( 2319818763434612042), INT64_C(-8653008737648823639),
+                             INT64_C( 5654783245630591970), INT64_C( 2661337639914621523)),
+      simde_mm256_set_epi64x(INT64_C(   13517677570048000), INT64_C(   92328353885917345),
+                             INT64_C( 1031818411004678146), INT64_C(  309095029550104578)) },
+    { simde_mm256_set_epi64x(INT64_C( 6412066679601226534), INT64_C( 5243290819062192403),
+                             INT64_C( 4287103853346113637), INT64_C(  814530724744371421)),
+      simde_mm256_set_epi64x(INT64_C(-2028138079901591357), INT64_C( 4436483542044312301),
+                             INT64_C( 7175921726730340590), INT64_C(-7088478995784268395)),
+      simde_mm256_set_epi64x(INT64_C( 4672511174011895810), INT64_C(  612920557951778817),
+                             INT64_C( 2527885019054409828), INT64_C(  648669395543262357)) },
+    { simde_mm256_set_epi64x(INT64_C(-4153441017122035973), INT64_C( 2570127391568644821),
+                             INT64_C(-4151403742310096711), INT64_C( 5083454156658707484)),
+      simde_mm256_set_epi64x(INT64_C(  943562857002024170), INT64_C(  846383742438384462),
+                             INT64_C( 4730307450125931438), INT64_C(-1679420471777018087)),
+      simde_mm256_set_epi64x(INT64_C(  294987296325969130), INT64_C(  264275344262955588),
+                             INT64_C( 4621045061539397800), INT64_C( 4647730870153645080)) },
+    { simde_mm256_set_epi64x(INT64_C(-3410639499255960292), INT64_C(-4326369014879823061),
+                             INT64_C(-5986589938309154331), INT64_C(-9015122079932102673)),
+      simde_mm256_set_epi64x(INT64_C( 7637455860788501554), INT64_C(-6798903731585057967),
+                             INT64_C( 3144378034621746751), INT64_C(-4835772501581349285)),
+      simde_mm256_set_epi64x(INT64_C( 4659168574370614288), INT64_C(-9104835870095025407),
+                             INT64_C( 2928201951288199205), INT64_C(-9159263896844630453)) },
+    { simde_mm256_set_epi64x(INT64_C(-7324239692915772499), INT64_C( 6725384276544904433),
+                             INT64_C(-7608423970524688384), INT64_C( 9099478870839321090)),
+      simde_mm256_set_epi64x(INT64_C(-5109390572797909365), INT64_C( 1614795092602041330),
+                             INT64_C( 2189601238044352909), INT64_C(-3784454611539826344)),
+      simde_mm256_set_epi64x(INT64_C(-7488641446122085751), INT64_C( 1459242234776162544),
+                             INT64_C( 1612573102959689728), INT64_C( 5351053232754155520)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_and_pd(simde_mm256_castsi256_pd(test_vec[i].a), simde_mm256_castsi256_pd(test_vec[i].b));
+    simde_assert_m256d_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_and_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1445500309,   765806611,   335839946, -1821929733,
+                             1653724298,  2011940807,   495819654, -2063200525),
+      simde_mm256_set_epi32(   -6734318,  1700127943, -1575672020, -1006772436,
+                            -1595080465,   456154510, -1978718486, -1292389048),
+      simde_mm256_set_epi32(-1450104318,   621101059,      262664, -2090496472,
+                              545325194,   320882054,   135070338, -2147089344) },
+    { simde_mm256_set_epi32( 1577160257,   393289173, -1879362077,   -75630160,
+                              263631839,  1735442673,  -354492742,  1476958301),
+      simde_mm256_set_epi32( -864931754,   552823511,  -681369223,  -298522289,
+                             1835556083, -1545235393,    40450399,   917847398),
+      simde_mm256_set_epi32( 1275068480,     7407829, -2023546527,  -365631232,
+                              220205267,   593526833,    38279194,   268441668) },
+    { simde_mm256_set_epi32(  682924121,   818506652,  -275501286,  -280325510,
+                             1359863936,  -255228957,   663432626,  -261154109),
+      simde_mm256_set_epi32( 1024690442,   299358430,  -523858127,  2138184292,
+                            -1575871414,  1194172470, -2108970997,  -635116172),
+      simde_mm256_set_epi32(  672172040,   281102492,  -528216304,  1866601056,
+                                      0,  1074364450,    34285570,  -802947008) },
+    { simde_mm256_set_epi32(  511082978, -1540027267,  -482626646, -1475133861,
+                            -1757468407, -2021545769,   -53275071, -2092424045),
+      simde_mm256_set_epi32(-2065142393,   956980198,  1394322467,  1120292242,
+                            -1347484590,  1229777761,   844699622, -1822222635),
+      simde_mm256_set_epi32(   73400706,   536873060,  1125883938,      134162,
+                            -2026962944,    16820289,   810620480, -2092956527) },
+    { simde_mm256_set_epi32( 1343055858,  -374618998, -1309287420, -2082901678,
+                            -1316957685, -1806028686, -2000513488, -1452134219),
+      simde_mm256_set_epi32(  783323677,   554025647,  1138092804, -1648138563,
+                             -452388300,  -572848830,  1887642155,   227337939),
+      simde_mm256_set_epi32(        528,   553762954,    30787588, -2118033392,
+                            -1593830912, -1806041022,     8520224,   151003281) },
+    { simde_mm256_set_epi32( -439359318,  1435721670,  1521532721,  -121972101,
+                             1989131740,  -967445797,  2080253830,  -867807685),
+      simde_mm256_set_epi32( 1446578450,   302193101, -1983476920, -1014279286,
+                            -1926059102,  -604180471,   148705837, -1398685888),
+      simde_mm256_set_epi32( 1141442562,   268638660,   142641920, -1064676854,
+                               67283328, -1034620919,   148636164, -1946153472) },
+    { simde_mm256_set_epi32( -736581564,  -311555366,   363374645,  1167638647,
+                              741556898,   316528639,  1939413572,  1491631752),
+      simde_mm256_set_epi32( 1331227198, -1951987254,   217864564, -1778814252,
+                            -1986508981,   929091525,  -103769656, -1247408213),
+      simde_mm256_set_epi32( 1142466564, -1993996086,    78121012,    93864020,
+                              135283202,   306235333,  1905268800,   278924936) },
+    { simde_mm256_set_epi32( 1024570770,  1999237172,  1122630355, -1256563369,
+                              142108538,   636889022, -1946757718,  1856298900),
+      simde_mm256_set_epi32( -652617539,  1158437909,  -432379677,  -582357892,
+                             1661320097, -1650509709, -1362431287, -1395238224),
+      simde_mm256_set_epi32(  420581520,  1158172692,  1109944515, -1794618284,
+                                   8992,    93724722, -1966944120,   746871440) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_and_ps(simde_mm256_castsi256_ps(test_vec[i].a), simde_mm256_castsi256_ps(test_vec[i].b));
+    simde_assert_m256_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_andnot_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-5263750021762551045), INT64_C( 9179673242464520917),
+                             INT64_C(-9093758908690654058), INT64_C( -897955962973389322)),
+      simde_mm256_set_epi64x(INT64_C( 2656324682166438593), INT64_C( 3681302900421681411),
+                             INT64_C(-1902338080110062410), INT64_C(-7598162750313672530)),
+      simde_mm256_set_epi64x(INT64_C(    3386502264391680), INT64_C(    5098788817363202),
+                             INT64_C( 7210686900854865952), INT64_C(  289398264748310536)) },
+    { simde_mm256_set_epi64x(INT64_C(-7066294840266339372), INT64_C(-6532943517522700168),
+                             INT64_C( 3679802719113679693), INT64_C(-9019792752945428554)),
+      simde_mm256_set_epi64x(INT64_C(-3410423700084751849), INT64_C(-2068662121438484779),
+                             INT64_C(-7758498486598852108), INT64_C( 1380108495802568330)),
+      simde_mm256_set_epi64x(INT64_C( 4611833038383349763), INT64_C( 4758229477983528581),
+                             INT64_C(-8915994043602296656), INT64_C( 1235148585889433608)) },
+    { simde_mm256_set_epi64x(INT64_C( 1911456400102916563), INT64_C( 2201288425987589728),
+                             INT64_C(-4417230067799888944), INT64_C( 7823311745506072453)),
+      simde_mm256_set_epi64x(INT64_C(-5127348462024543943), INT64_C( 9038653170711858071),
+                             INT64_C( 7454130533421291877), INT64_C(  265355593913042315)),
+      simde_mm256_set_epi64x(INT64_C(-6894689387856941016), INT64_C( 7017508730205112727),
+                             INT64_C( 2684185036976033829), INT64_C(  229123931864825866)) },
+    { simde_mm256_set_epi64x(INT64_C( 6667924424951622121), INT64_C( 3098760663339855094),
+                             INT64_C(  240564729182486026), INT64_C( -356610271789073012)),
+      simde_mm256_set_epi64x(INT64_C(-4062476609948270294), INT64_C( -564293351391403501),
+                             INT64_C( 4027772796318830603), INT64_C(-8462659812319073741)),
+      simde_mm256_set_epi64x(INT64_C(-9001000208157179902), INT64_C(-3446880957634706943),
+                             INT64_C( 3792318975481741313), INT64_C(   36740336151577139)) },
+    { simde_mm256_set_epi64x(INT64_C(-8940597842585489446), INT64_C( -240655713089345798),
+                             INT64_C( 3552367477471891830), INT64_C(-6581179936607751408)),
+      simde_mm256_set_epi64x(INT64_C(-7055826126489718763), INT64_C( 6266695295841074586),
+                             INT64_C( -864555000030745827), INT64_C( 4538712144312145036)),
+      simde_mm256_set_epi64x(INT64_C( 2022153634684899333), INT64_C(  168535375958235392),
+                             INT64_C(-4323331910305502711), INT64_C( 1897154539860657292)) },
+    { simde_mm256_set_epi64x(INT64_C(-3910973603283733608), INT64_C( 3641954470150428130),
+                             INT64_C(  957242737282875771), INT64_C(-8615192878689386579)),
+      simde_mm256_set_epi64x(INT64_C(-6438938889293815614), INT64_C( 1763333911054876739),
+                             INT64_C( 3924605833046284235), INT64_C(-1745919348050035780)),
+      simde_mm256_set_epi64x(INT64_C( 2739315578582859842), INT64_C(  607999762519654401),
+                             INT64_C( 3618360843066300032), INT64_C( 7459385959201669136)) },
+    { simde_mm256_set_epi64x(INT64_C( 2379226445189665661), INT64_C(-7437814052437851403),
+                             INT64_C(-1821479695034980741), INT64_C( 8740807348694111864)),
+      simde_mm256_set_epi64x(INT64_C(-4905202145514831853), INT64_C(  412752818092763030),
+                             INT64_C( 6446794647771860800), INT64_C(-8840904396099032752)),
+      simde_mm256_set_epi64x(INT64_C(-7284281975542644734), INT64_C(  376160520123016450),
+                             INT64_C( 1821442171983923456), INT64_C(-8934499533290559232)) },
+    { simde_mm256_set_epi64x(INT64_C( 8377192964719343288), INT64_C(-3163960800261455499),
+                             INT64_C( 8598270693773161600), INT64_C(   10660288224359342)),
+      simde_mm256_set_epi64x(INT64_C(-2632155194775489227), INT64_C( 7209135332531794711),
+                             INT64_C( 7488406370398589846), INT64_C( 5698470347053903010)),
+      simde_mm256_set_epi64x(INT64_C(-8414922843699019515), INT64_C( 2308275135515210242),
+                             INT64_C(   48422801465492246), INT64_C( 5697054105142168576)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_andnot_pd(simde_mm256_castsi256_pd(test_vec[i].a), simde_mm256_castsi256_pd(test_vec[i].b));
+    simde_assert_m256d_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_andnot_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( 1628103198,   835502509, -1047030006, -1291094247,
+                             1407920889,  1684845624, -1456920980,   677156551),
+      simde_mm256_set_epi32( -139377740,   657129729,  2004721430,   561801323,
+                             -881217721, -2006423242, -1628134991, -1926692439),
+      simde_mm256_set_epi32(-1766784608,   102957056,   912787476,     7604322,
+                            -2012183290, -2013247226,   383025553, -2061434584) },
+    { simde_mm256_set_epi32(-1374771019,  1195771988,  -596104155, -1040546784,
+                             -781049867, -1798457410, -1717139401,  -823111792),
+      simde_mm256_set_epi32( 1318257868,  -463761220,  -928118141,  1325247076,
+                             1049334912,  1531168886,   172392187,  1611379884),
+      simde_mm256_set_epi32( 1083245640, -1608937304,     8782466,   235219524,
+                              780763136,  1258440768,    37779144,   537636908) },
+    { simde_mm256_set_epi32(  944915117,   933985864,  1098346332, -1602892942,
+                             1431579672,   464636889, -2035724044,  1309998463),
+      simde_mm256_set_epi32( 1850232665, -1702744845,  -101000315, -1041390299,
+                             1753821881, -1962416316,   570811421, -1274339198),
+      simde_mm256_set_epi32( 1174932816, -2013265741, -1199009663,  1099441157,
+                              680071841, -2147081212,   537175049, -1341456256) },
+    { simde_mm256_set_epi32(  619449433,   708482351,   616423219,   317146121,
+                              166551473,   -79491200,  1836130525,  1253289531),
+      simde_mm256_set_epi32( -802716805,  -904077580,  -784918140, -1577824501,
+                            -1437125943,  -518001600,  -467773722, -1773013459),
+      simde_mm256_set_epi32( -805076190, -1073460528,  -788397948, -1592784126,
+                            -1575870392,     1892416, -2146544094, -1807724540) },
+    { simde_mm256_set_epi32( 1394512378,  2064802828, -1648986541, -1865789838,
+                            -2046533378, -1850322198,   -43771082, -1729388632),
+      simde_mm256_set_epi32(-2094080503,  1056799123, -1242541241,  -357961525,
+                             2123373507,  1547587514, -1208453784,  -970602567),
+      simde_mm256_set_epi32(-2145366527,    82647443,   541065476,  1780592777,
+                             2022710017,  1275596048,    43541576,  1174683665) },
+    { simde_mm256_set_epi32( 1628111161,  1950857672,  1264411980,  2069383759,
+                             -617845047,  -293790980,  -660117517,  -449944527),
+      simde_mm256_set_epi32( -660757099,   649910545,  1796610639, -2010609889,
+                             2012627225,  1124124467,  1448308219,  1856743068),
+      simde_mm256_set_epi32(-1735089020,    45629457,   537008643, -2145352432,
+                              617742608,    16827651,   105908232,   176259724) },
+    { simde_mm256_set_epi32( -240518305, -1278332970,  -203564467, -1997125381,
+                                7211343,  -211647813,  -947846742,   798840659),
+      simde_mm256_set_epi32( -486629395,  1679173409, -1398725314,    98876069,
+                            -1106646572,  -146016069, -1601060488,  1132970466),
+      simde_mm256_set_epi32(   39191712,  1141899297,   203433266,    83931652,
+                            -1107173232,    67729408,   537968720,  1073905824) },
+    { simde_mm256_set_epi32( -755091777,  1737064234,  -547819457,  -109725088,
+                             1356545760, -1162800652,   767496988,  1443689341),
+      simde_mm256_set_epi32( -841782445,    15233498,  -424398974,   690872701,
+                              334879311,  -475565369,   550510258,  1503070753),
+      simde_mm256_set_epi32(  218188096,     6291664,   547622784,      540957,
+                               52740111,  1090937347,     4197538,   160630784) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_andnot_ps(simde_mm256_castsi256_ps(test_vec[i].a), simde_mm256_castsi256_ps(test_vec[i].b));
+    simde_assert_m256_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_blendv_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256i mask;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(  -139.46,   -493.44,   -178.35,   -150.12),
+      simde_mm256_set_pd(  -454.73,    661.68,   -427.29,   -816.90),
+      simde_mm256_set_epi64x(INT64_C(-5066149971971028818), INT64_C( 5798943475809943034),
+                             INT64_C( -434406427971561925), INT64_C( 3013833125420579048)),
+      simde_mm256_set_pd(  -454.73,   -493.44,   -427.29,   -150.12) },
+    { simde_mm256_set_pd(   758.83,    696.14,    524.46,    493.53),
+      simde_mm256_set_pd(   860.16,    873.45,     39.77,     39.51),
+      simde_mm256_set_epi64x(INT64_C(-7232456860375249732), INT64_C(-8813332279788866561),
+                             INT64_C( 3637352168423718754), INT64_C(-8202013156862694163)),
+      simde_mm256_set_pd(   860.16,    873.45,    524.46,     39.51) },
+    { simde_mm256_set_pd(   735.93,   -667.39,   -296.60,    669.36),
+      simde_mm256_set_pd(   354.88,    718.84,   -816.68,    715.47),
+      simde_mm256_set_epi64x(INT64_C( 2826871496271147051), INT64_C(  -67467460651057754),
+                             INT64_C(-2024024807456945809), INT64_C(  251542150023356069)),
+      simde_mm256_set_pd(   735.93,    718.84,   -816.68,    669.36) },
+    { simde_mm256_set_pd(    81.08,   -117.91,   -361.09,    876.93),
+      simde_mm256_set_pd(   -59.58,    -54.49,    183.70,   -844.05),
+      simde_mm256_set_epi64x(INT64_C( 6162921582679896961), INT64_C(  -67058151501419195),
+                             INT64_C( 8736594645849638876), INT64_C(  938289071026600832)),
+      simde_mm256_set_pd(    81.08,    -54.49,   -361.09,    876.93) },
+    { simde_mm256_set_pd(   829.54,   -446.21,   -239.79,   -372.43),
+      simde_mm256_set_pd(   919.23,   -244.89,    499.57,    977.30),
+      simde_mm256_set_epi64x(INT64_C(-2575997615671337201), INT64_C( 7297889704517417732),
+                             INT64_C( 9172345768258790473), INT64_C(-2067957505144870942)),
+      simde_mm256_set_pd(   919.23,   -446.21,   -239.79,    977.30) },
+    { simde_mm256_set_pd(   890.16,    -28.12,    116.05,    724.43),
+      simde_mm256_set_pd(   288.91,    889.40,    527.91,   -867.04),
+      simde_mm256_set_epi64x(INT64_C(-2612332361897720730), INT64_C( -309393131500118402),
+                             INT64_C( 6938731346222642100), INT64_C(-7961812945163634380)),
+      simde_mm256_set_pd(   288.91,    889.40,    116.05,   -867.04) },
+    { simde_mm256_set_pd(  -815.09,    631.43,    875.10,   -746.40),
+      simde_mm256_set_pd(   228.15,    -17.46,    428.22,    199.39),
+      simde_mm256_set_epi64x(INT64_C(-5622762979427380359), INT64_C(-4755721388062530723),
+                             INT64_C( 2317866299385614641), INT64_C( 8236810168995723322)),
+      simde_mm256_set_pd(   228.15,    -17.46,    875.10,   -746.40) },
+    { simde_mm256_set_pd(   583.36,   -294.47,   -829.27,    373.76),
+      simde_mm256_set_pd(   -28.87,   -412.48,   -782.41,    338.05),
+      simde_mm256_set_epi64x(INT64_C(-6733189645011034283), INT64_C(-2584876022173641867),
+                             INT64_C( 2209071749393765833), INT64_C(-8051728930592070267)),
+      simde_mm256_set_pd(   -28.87,   -412.48,   -829.27,    338.05) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_blendv_pd(test_vec[i].a, test_vec[i].b, simde_mm256_castsi256_pd(test_vec[i].mask));
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_blendv_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256i mask;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   501.35f,    -67.84f,    538.74f,    717.90f,
+                             -3.42f,    688.69f,    452.10f,    994.88f),
+      simde_mm256_set_ps(  -911.99f,    628.61f,      5.74f,    110.28f,
+                           -124.29f,   -771.83f,    764.01f,    305.53f),
+      simde_mm256_set_epi32( 1587861891, -1703134874,  1675182569,  2011818047,
+                             1483213179,  -644956182,  -432703292,  1720179563),
+      simde_mm256_set_ps(   501.35f,    628.61f,    538.74f,    717.90f,
+                             -3.42f,   -771.83f,    764.01f,    994.88f) },
+    { simde_mm256_set_ps(   467.94f,   -122.63f,   -343.33f,    830.81f,
+                            789.67f,    303.65f,   -845.15f,     53.41f),
+      simde_mm256_set_ps(   719.20f,   -795.78f,   -564.81f,   -910.64f,
+                            194.32f,   -624.75f,    202.64f,    344.09f),
+      simde_mm256_set_epi32(  301341712, -1445423365,   -72481548,  1782132537,
+                             1079776012,  2037115285,  1323630404,  -661466071),
+      simde_mm256_set_ps(   467.94f,   -795.78f,   -564.81f,    830.81f,
+                            789.67f,    303.65f,   -845.15f,    344.09f) },
+    { simde_mm256_set_ps(   710.98f,    294.18f,   -864.23f,    555.07f,
+                           -696.76f,     56.18f,   -799.56f,     55.31f),
+      simde_mm256_set_ps(   823.87f,   -144.75f,   -284.65f,   -485.61f,
+                            -62.47f,    904.65f,   -735.89f,   -833.49f),
+      simde_mm256_set_epi32( -862266657, -1011629139,   -71612868,  -692126085,
+                             -781654037,  -142565644, -1901809200,  -717518514),
+      simde_mm256_set_ps(   823.87f,   -144.75f,   -284.65f,   -485.61f,
+                            -62.47f,    904.65f,   -735.89f,   -833.49f) },
+    { simde_mm256_set_ps(   469.24f,   -115.89f,    836.26f,    396.36f,
+                            329.66f,    925.32f,    593.70f,    519.84f),
+      simde_mm256_set_ps(  -630.30f,    915.15f,    371.10f,    915.11f,
+                            182.75f,    745.23f,     41.90f,   -270.63f),
+      simde_mm256_set_epi32(-2021106510,  1418267815,  1198215833,  1632763775,
+                            -1554138074,   977316123,  -449452745,   351669045),
+      simde_mm256_set_ps(  -630.30f,   -115.89f,    836.26f,    396.36f,
+                            182.75f,    925.32f,     41.90f,    519.84f) },
+    { simde_mm256_set_ps(  -564.25f,    829.31f,   -217.24f,   -854.67f,
+                           -873.45f,     -1.15f,    511.68f,    434.80f),
+      simde_mm256_set_ps(   300.75f,    230.37f,   -103.69f,   -501.64f,
+                           -619.76f,   -232.09f,    797.73f,   -788.42f),
+      simde_mm256_set_epi32( -914358104,  -974990436, -2101360628,   394557271,
+                              -69344088,   851518371, -1122264150,   -66836922),
+      simde_mm256_set_ps(   300.75f,    230.37f,   -103.69f,   -854.67f,
+                           -619.76f,     -1.15f,    797.73f,   -788.42f) },
+    { simde_mm256_set_ps(  -387.38f,    160.44f,    805.36f,   -326.70f,
+                           -421.39f,   -958.49f,    927.03f,     75.28f),
+      simde_mm256_set_ps(   137.92f,    197.67f,    -22.54f,    348.76f,
+                           -567.40f,   -711.60f,    447.86f,      2.77f),
+      simde_mm256_set_epi32(-1433489493, -1124646196,   902170231,  1226886909,
+                            -2137945016, -1561047438,  -642500485, -1824145612),
+      simde_mm256_set_ps(   137.92f,    197.67f,    805.36f,   -326.70f,
+                           -567.40f,   -711.60f,    447.86f,      2.77f) },
+    { simde_mm256_set_ps(  -783.41f,   -813.08f,   -471.04f,    -42.20f,
+                           -709.65f,   -790.84f,   -681.84f,   -870.88f),
+      simde_mm256_set_ps(  -655.37f,    746.05f,    828.73f,   -425.93f,
+                            631.08f,   -638.63f,   -224.14f,    305.29f),
+      simde_mm256_set_epi32(  214389946,  1363639682,  1671771117,   394903542,
+                              216447257,  1769336572,  -525188838,  -898215909),
+      simde_mm256_set_ps(  -783.41f,   -813.08f,   -471.04f,    -42.20f,
+                           -709.65f,   -790.84f,   -224.14f,    305.29f) },
+    { simde_mm256_set_ps(   854.60f,    440.76f,    701.06f,   -519.48f,
+                            -84.24f,   -992.20f,    944.31f,    -61.38f),
+      simde_mm256_set_ps(   880.57f,   -691.37f,   -434.15f,     78.19f,
+                            111.12f,    199.00f,    440.85f,    335.34f),
+      simde_mm256_set_epi32(-1804504024,  -306604772,  -980003023,   506183052,
+                             1341187593,  -738233397, -1660791386,  -300451005),
+      simde_mm256_set_ps(   880.57f,   -691.37f,   -434.15f,   -519.48f,
+                            -84.24f,    199.00f,    440.85f,    335.34f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_blendv_ps(test_vec[i].a, test_vec[i].b, simde_mm256_castsi256_ps(test_vec[i].mask));
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_broadcast_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[4];
+    simde__m128 v;
+    simde__m256 r;
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    v = simde_mm_loadu_ps(a);
+    r = simde_mm256_broadcast_ps(&v);
+
+    munit_assert_memory_equal(sizeof(a), &(r.f32[0]), a);
+    munit_assert_memory_equal(sizeof(a), &(r.f32[4]), a);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_broadcast_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a;
+    simde__m256 r;
+
+    random_f32v(1, &a);
+    r = simde_mm256_broadcast_ss(&a);
+
+    for (size_t j = 0 ; j < 8 ; j++) {
+      munit_assert_float(r.f32[j], ==, a);
+    }
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_castps128_ps256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[4];
+    simde__m256 r;
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+
+    /* The upper 128 bits are undefined, only check the lower half. */
+    r = simde_mm256_castps128_ps256(simde_mm_loadu_ps(a));
+    munit_assert_memory_equal(sizeof(a), &r, a);
+
+    simde__m128 l = simde_mm256_castps256_ps128(r);
+    munit_assert_memory_equal(sizeof(a), &l, a);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_ceil_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   136.66,    967.79,    176.04,   -211.21),
+      simde_mm256_set_pd(   137.00,    968.00,    177.00,   -211.00) },
+    { simde_mm256_set_pd(   310.12,   -205.36,    679.12,   -197.81),
+      simde_mm256_set_pd(   311.00,   -205.00,    680.00,   -197.00) },
+    { simde_mm256_set_pd(   575.40,   -913.52,   -191.33,   -747.17),
+      simde_mm256_set_pd(   576.00,   -913.00,   -191.00,   -747.00) },
+    { simde_mm256_set_pd(   106.35,   -985.39,    265.13,   -562.14),
+      simde_mm256_set_pd(   107.00,   -985.00,    266.00,   -562.00) },
+    { simde_mm256_set_pd(   382.15,   -383.51,    827.10,   -887.28),
+      simde_mm256_set_pd(   383.00,   -383.00,    828.00,   -887.00) },
+    { simde_mm256_set_pd(  -270.81,   -979.27,    -38.13,    573.43),
+      simde_mm256_set_pd(  -270.00,   -979.00,    -38.00,    574.00) },
+    { simde_mm256_set_pd(  -985.04,    198.93,    918.15,   -816.43),
+      simde_mm256_set_pd(  -985.00,    199.00,    919.00,   -816.00) },
+    { simde_mm256_set_pd(   846.67,   -499.09,   -904.59,   -821.66),
+      simde_mm256_set_pd(   847.00,   -499.00,   -904.00,   -821.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_ceil_pd(test_vec[i].a);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_ceil_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(  -501.36f,     48.51f,   -205.29f,   -371.51f,
+                            925.77f,    942.52f,   -505.51f,   -954.31f),
+      simde_mm256_set_ps(  -501.00f,     49.00f,   -205.00f,   -371.00f,
+                            926.00f,    943.00f,   -505.00f,   -954.00f) },
+    { simde_mm256_set_ps(  -682.28f,   -860.63f,    -36.14f,   -525.00f,
+                            237.77f,    471.44f,   -711.33f,   -790.12f),
+      simde_mm256_set_ps(  -682.00f,   -860.00f,    -36.00f,   -525.00f,
+                            238.00f,    472.00f,   -711.00f,   -790.00f) },
+    { simde_mm256_set_ps(  -404.63f,    184.24f,   -226.19f,    -35.61f,
+                            944.15f,   -350.90f,    960.25f,    714.62f),
+      simde_mm256_set_ps(  -404.00f,    185.00f,   -226.00f,    -35.00f,
+                            945.00f,   -350.00f,    961.00f,    715.00f) },
+    { simde_mm256_set_ps(  -416.83f,   -464.24f,    649.95f,     73.95f,
+                           -442.41f,   -700.24f,    761.43f,   -763.39f),
+      simde_mm256_set_ps(  -416.00f,   -464.00f,    650.00f,     74.00f,
+                           -442.00f,   -700.00f,    762.00f,   -763.00f) },
+    { simde_mm256_set_ps(  -540.52f,   -300.38f,   -233.74f,   -220.30f,
+                            561.92f,    989.63f,    710.56f,    463.17f),
+      simde_mm256_set_ps(  -540.00f,   -300.00f,   -233.00f,   -220.00f,
+                            562.00f,    990.00f,    711.00f,    464.00f) },
+    { simde_mm256_set_ps(  -793.87f,   -804.90f,   -831.06f,    365.89f,
+                            556.85f,    463.74f,    -53.73f,    914.51f),
+      simde_mm256_set_ps(  -793.00f,   -804.00f,   -831.00f,    366.00f,
+                            557.00f,    464.00f,    -53.00f,    915.00f) },
+    { simde_mm256_set_ps(   605.33f,    506.40f,   -151.69f,   -992.06f,
+                            819.43f,    857.02f,   -203.02f,   -691.51f),
+      simde_mm256_set_ps(   606.00f,    507.00f,   -151.00f,   -992.00f,
+                            820.00f,    858.00f,   -203.00f,   -691.00f) },
+    { simde_mm256_set_ps(   -75.75f,   -973.64f,   -734.82f,   -113.70f,
+                           -809.59f,    942.66f,   -785.16f,    628.18f),
+      simde_mm256_set_ps(   -75.00f,   -973.00f,   -734.00f,   -113.00f,
+                           -809.00f,    943.00f,   -785.00f,    629.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_ceil_ps(test_vec[i].a);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmp_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256i eq_oq;
+    simde__m256i lt_os;
+    simde__m256i nle_uq;
+    simde__m256i unord_q;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(    58.05,     58.94,       NAN,     94.91),
+      simde_mm256_set_pd(    66.97,    -94.87,       NAN,     94.91),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                  -1), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm256_set_pd(   -74.21,       NAN,     23.18,    -49.85),
+      simde_mm256_set_pd(   -74.21,       NAN,     89.34,    -64.27),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_pd(    73.56,    -31.45,       NAN,    -37.25),
+      simde_mm256_set_pd(    80.68,    -31.45,     66.00,     19.18),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm256_set_pd(    67.84,    -23.58,     11.83,     96.74),
+      simde_mm256_set_pd(    69.38,    -46.57,    -33.26,       NAN),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                  -1), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                  -1)) },
+    { simde_mm256_set_pd(    76.92,    -67.32,       NAN,    -39.88),
+      simde_mm256_set_pd(    79.05,    -18.58,       NAN,     22.54),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm256_set_pd(    95.60,    -33.26,    -24.84,    -96.58),
+      simde_mm256_set_pd(   -13.48,     91.83,    -24.84,     39.21),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_pd(   -69.39,     64.46,     11.55,     60.90),
+      simde_mm256_set_pd(   -45.56,      5.17,    -37.13,    -78.99),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                  -1), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_pd(     9.91,     23.79,     29.82,     31.02),
+      simde_mm256_set_pd(   -66.11,     52.45,     36.52,     43.54),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                  -1), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r;
+
+    r = simde_mm256_cmp_pd(test_vec[i].a, test_vec[i].b, simde_CMP_EQ_OQ);
+    simde_assert_m256d_u64(r, ==, test_vec[i].eq_oq);
+    r = simde_mm256_cmp_pd(test_vec[i].a, test_vec[i].b, simde_CMP_LT_OS);
+    simde_assert_m256d_u64(r, ==, test_vec[i].lt_os);
+    r = simde_mm256_cmp_pd(test_vec[i].a, test_vec[i].b, simde_CMP_NLE_UQ);
+    simde_assert_m256d_u64(r, ==, test_vec[i].nle_uq);
+    r = simde_mm256_cmp_pd(test_vec[i].a, test_vec[i].b, simde_CMP_UNORD_Q);
+    simde_assert_m256d_u64(r, ==, test_vec[i].unord_q);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmp_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256i eq_oq;
+    simde__m256i lt_os;
+    simde__m256i nle_uq;
+    simde__m256i unord_q;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   -92.28f,      9.76f,    -83.84f,     19.87f,
+                                NAN,    -85.31f,     35.67f,    -67.26f),
+      simde_mm256_set_ps(   -92.28f,     48.68f,     99.40f,     19.87f,
+                            -50.63f,    -85.31f,     35.67f,    -65.34f),
+      simde_mm256_set_epi32(         -1,           0,           0,          -1,
+                                      0,          -1,          -1,           0),
+      simde_mm256_set_epi32(          0,          -1,          -1,           0,
+                                      0,           0,           0,          -1),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                     -1,           0,           0,           0),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                     -1,           0,           0,           0) },
+    { simde_mm256_set_ps(   -37.07f,    -81.60f,    -80.80f,      8.08f,
+                            -37.84f,      8.16f,    -93.60f,    -14.04f),
+      simde_mm256_set_ps(   -41.87f,    -14.58f,      8.66f,     55.18f,
+                             61.74f,      8.16f,    -44.22f,    -11.43f),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,          -1,           0,           0),
+      simde_mm256_set_epi32(          0,          -1,          -1,          -1,
+                                     -1,           0,          -1,          -1),
+      simde_mm256_set_epi32(         -1,           0,           0,           0,
+                                      0,           0,           0,           0),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0) },
+    { simde_mm256_set_ps(   -22.55f,    -55.21f,     52.02f,    -52.27f,
+                             23.93f,    -87.60f,     79.51f,     43.09f),
+      simde_mm256_set_ps(       NAN,    -85.50f,    -31.52f,    -48.16f,
+                             63.29f,    -35.29f,     -1.83f,     -0.63f),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0),
+      simde_mm256_set_epi32(          0,           0,           0,          -1,
+                                     -1,          -1,           0,           0),
+      simde_mm256_set_epi32(         -1,          -1,          -1,           0,
+                                      0,           0,          -1,          -1),
+      simde_mm256_set_epi32(         -1,           0,           0,           0,
+                                      0,           0,           0,           0) },
+    { simde_mm256_set_ps(     0.96f,    -49.02f,     56.05f,     95.94f,
+                             91.52f,    -21.24f,    -34.03f,      1.48f),
+      simde_mm256_set_ps(     0.96f,    -49.02f,    -74.21f,     84.72f,
+                             91.52f,    -21.24f,    -50.72f,    -82.32f),
+      simde_mm256_set_epi32(         -1,          -1,           0,           0,
+                                     -1,          -1,           0,           0),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0),
+      simde_mm256_set_epi32(          0,           0,          -1,          -1,
+                                      0,           0,          -1,          -1),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0) },
+    { simde_mm256_set_ps(   -89.02f,    -82.27f,     28.81f,     20.96f,
+                            -91.23f,     85.35f,    -56.29f,    -81.21f),
+      simde_mm256_set_ps(   -89.02f,     59.51f,     85.42f,     58.68f,
+                            -44.07f,      3.10f,    -63.12f,    -83.42f),
+      simde_mm256_set_epi32(         -1,           0,           0,           0,
+                                      0,           0,           0,           0),
+      simde_mm256_set_epi32(          0,          -1,          -1,          -1,
+                                     -1,           0,           0,           0),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,          -1,          -1,          -1),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0) },
+    { simde_mm256_set_ps(   -82.68f,     -6.90f,     -8.39f,     77.89f,
+                            -73.05f,     74.86f,    -35.32f,     23.74f),
+      simde_mm256_set_ps(   -27.92f,     19.61f,     -8.39f,     77.89f,
+                             97.03f,     74.86f,     53.77f,    -89.16f),
+      simde_mm256_set_epi32(          0,           0,          -1,          -1,
+                                      0,          -1,           0,           0),
+      simde_mm256_set_epi32(         -1,          -1,           0,           0,
+                                     -1,           0,          -1,           0),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,          -1),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0) },
+    { simde_mm256_set_ps(   -60.94f,      4.94f,     61.13f,     17.07f,
+                              3.78f,    -86.10f,    -34.27f,     77.66f),
+      simde_mm256_set_ps(   -36.38f,    -88.99f,     44.66f,    -57.90f,
+                             40.69f,     27.74f,      0.63f,     83.24f),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0),
+      simde_mm256_set_epi32(         -1,           0,           0,           0,
+                                     -1,          -1,          -1,          -1),
+      simde_mm256_set_epi32(          0,          -1,          -1,          -1,
+                                      0,           0,           0,           0),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0) },
+    { simde_mm256_set_ps(    15.61f,    -83.39f,     80.53f,    -19.08f,
+                            -98.14f,     84.50f,    -48.07f,    -74.10f),
+      simde_mm256_set_ps(    15.61f,     88.54f,     98.78f,     -7.42f,
+                            -98.14f,     84.50f,     83.75f,    -74.10f),
+      simde_mm256_set_epi32(         -1,           0,           0,           0,
+                                     -1,          -1,           0,          -1),
+      simde_mm256_set_epi32(          0,          -1,          -1,          -1,
+                                      0,           0,          -1,           0),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r;
+
+    r = simde_mm256_cmp_ps(test_vec[i].a, test_vec[i].b, simde_CMP_EQ_OQ);
+    simde_assert_m256_u32(r, ==, test_vec[i].eq_oq);
+    r = simde_mm256_cmp_ps(test_vec[i].a, test_vec[i].b, simde_CMP_LT_OS);
+    simde_assert_m256_u32(r, ==, test_vec[i].lt_os);
+    r = simde_mm256_cmp_ps(test_vec[i].a, test_vec[i].b, simde_CMP_NLE_UQ);
+    simde_assert_m256_u32(r, ==, test_vec[i].nle_uq);
+    r = simde_mm256_cmp_ps(test_vec[i].a, test_vec[i].b, simde_CMP_UNORD_Q);
+    simde_assert_m256_u32(r, ==, test_vec[i].unord_q);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtepi32_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(         88,        -880,         -78,        -313),
+      simde_mm256_set_pd(    88.00,   -880.00,    -78.00,   -313.00) },
+    { simde_mm_set_epi32(       -762,         278,        -280,        -240),
+      simde_mm256_set_pd(  -762.00,    278.00,   -280.00,   -240.00) },
+    { simde_mm_set_epi32(        752,        -707,        -652,        -495),
+      simde_mm256_set_pd(   752.00,   -707.00,   -652.00,   -495.00) },
+    { simde_mm_set_epi32(        558,         219,        -913,        -985),
+      simde_mm256_set_pd(   558.00,    219.00,   -913.00,   -985.00) },
+    { simde_mm_set_epi32(        485,        -903,          85,         771),
+      simde_mm256_set_pd(   485.00,   -903.00,     85.00,    771.00) },
+    { simde_mm_set_epi32(       -638,        -997,         174,         298),
+      simde_mm256_set_pd(  -638.00,   -997.00,    174.00,    298.00) },
+    { simde_mm_set_epi32(       -835,        -470,         983,         181),
+      simde_mm256_set_pd(  -835.00,   -470.00,    983.00,    181.00) },
+    { simde_mm_set_epi32(        954,         972,         -80,          73),
+      simde_mm256_set_pd(   954.00,    972.00,    -80.00,     73.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_cvtepi32_pd(test_vec[i].a);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtepi32_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(        180,        -573,        -156,        -337,
+                                   -435,        -560,        -522,          66),
+      simde_mm256_set_ps(   180.00f,   -573.00f,   -156.00f,   -337.00f,
+                           -435.00f,   -560.00f,   -522.00f,     66.00f) },
+    { simde_mm256_set_epi32(         87,         662,        -744,        -588,
+                                     -9,        -469,         140,         324),
+      simde_mm256_set_ps(    87.00f,    662.00f,   -744.00f,   -588.00f,
+                             -9.00f,   -469.00f,    140.00f,    324.00f) },
+    { simde_mm256_set_epi32(       -803,         589,         635,        -860,
+                                   -682,         609,         284,         887),
+      simde_mm256_set_ps(  -803.00f,    589.00f,    635.00f,   -860.00f,
+                           -682.00f,    609.00f,    284.00f,    887.00f) },
+    { simde_mm256_set_epi32(        699,         493,         543,         217,
+                                    860,         683,          -8,         623),
+      simde_mm256_set_ps(   699.00f,    493.00f,    543.00f,    217.00f,
+                            860.00f,    683.00f,     -8.00f,    623.00f) },
+    { simde_mm256_set_epi32(       -156,        -171,         748,        -632,
+                                   -764,          -8,         797,         785),
+      simde_mm256_set_ps(  -156.00f,   -171.00f,    748.00f,   -632.00f,
+                           -764.00f,     -8.00f,    797.00f,    785.00f) },
+    { simde_mm256_set_epi32(       -620,         333,        -574,        -768,
+                                    604,         807,         -94,         245),
+      simde_mm256_set_ps(  -620.00f,    333.00f,   -574.00f,   -768.00f,
+                            604.00f,    807.00f,    -94.00f,    245.00f) },
+    { simde_mm256_set_epi32(        -51,        -202,        -224,        -982,
+                                    952,        -400,         -97,        -512),
+      simde_mm256_set_ps(   -51.00f,   -202.00f,   -224.00f,   -982.00f,
+                            952.00f,   -400.00f,    -97.00f,   -512.00f) },
+    { simde_mm256_set_epi32(       -777,         145,         377,         491,
+                                   -831,         332,        -188,         737),
+      simde_mm256_set_ps(  -777.00f,    145.00f,    377.00f,    491.00f,
+                           -831.00f,    332.00f,   -188.00f,    737.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_cvtepi32_ps(test_vec[i].a);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtpd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   496.04,   -828.56,   -956.80,   -850.14),
+      simde_mm_set_epi32(        496,        -829,        -957,        -850) },
+    { simde_mm256_set_pd(  -524.15,    975.48,    747.72,   -691.91),
+      simde_mm_set_epi32(       -524,         975,         748,        -692) },
+    { simde_mm256_set_pd(   446.22,   -240.63,   -129.20,    962.47),
+      simde_mm_set_epi32(        446,        -241,        -129,         962) },
+    { simde_mm256_set_pd(   178.73,   -245.62,    387.36,   -634.91),
+      simde_mm_set_epi32(        179,        -246,         387,        -635) },
+    { simde_mm256_set_pd(   564.76,   -289.62,    948.79,   -391.32),
+      simde_mm_set_epi32(        565,        -290,         949,        -391) },
+    { simde_mm256_set_pd(   523.61,     26.38,    751.77,   -531.50),
+      simde_mm_set_epi32(        524,          26,         752,        -532) },
+    { simde_mm256_set_pd(   500.60,   -421.01,   -295.86,   -508.42),
+      simde_mm_set_epi32(        501,        -421,        -296,        -508) },
+    { simde_mm256_set_pd(   666.74,   -179.02,   -207.00,   -169.03),
+      simde_mm_set_epi32(        667,        -179,        -207,        -169) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm256_cvtpd_epi32(test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtpd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(  -665.75,    655.59,    335.52,    921.23),
+      simde_mm_set_ps(  -665.75f,    655.59f,    335.52f,    921.23f) },
+    { simde_mm256_set_pd(   830.38,   -189.78,   -237.56,   -152.21),
+      simde_mm_set_ps(   830.38f,   -189.78f,   -237.56f,   -152.21f) },
+    { simde_mm256_set_pd(  -991.87,    687.59,    848.45,   -841.16),
+      simde_mm_set_ps(  -991.87f,    687.59f,    848.45f,   -841.16f) },
+    { simde_mm256_set_pd(    24.46,    968.31,   -435.52,    456.30),
+      simde_mm_set_ps(    24.46f,    968.31f,   -435.52f,    456.30f) },
+    { simde_mm256_set_pd(  -459.32,   -158.39,    682.65,    950.53),
+      simde_mm_set_ps(  -459.32f,   -158.39f,    682.65f,    950.53f) },
+    { simde_mm256_set_pd(  -870.26,     25.99,    488.30,   -792.20),
+      simde_mm_set_ps(  -870.26f,     25.99f,    488.30f,   -792.20f) },
+    { simde_mm256_set_pd(  -283.50,    365.43,    129.90,    588.43),
+      simde_mm_set_ps(  -283.50f,    365.43f,    129.90f,    588.43f) },
+    { simde_mm256_set_pd(  -147.34,   -384.16,   -898.86,   -818.08),
+      simde_mm_set_ps(  -147.34f,   -384.16f,   -898.86f,   -818.08f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm256_cvtpd_ps(test_vec[i].a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtps_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(  -724.77f,    179.89f,   -484.49f,   -870.07f,
+                           -862.94f,    155.05f,   -656.94f,   -430.19f),
+      simde_mm256_set_epi32(       -725,         180,        -484,        -870,
+                                   -863,         155,        -657,        -430) },
+    { simde_mm256_set_ps(   612.87f,     11.05f,   -237.39f,    735.21f,
+                            330.70f,    738.15f,    953.17f,    230.11f),
+      simde_mm256_set_epi32(        613,          11,        -237,         735,
+                                    331,         738,         953,         230) },
+    { simde_mm256_set_ps(   226.80f,    280.52f,   -634.65f,    346.54f,
+                            777.11f,    649.83f,    109.99f,   -661.83f),
+      simde_mm256_set_epi32(        227,         281,        -635,         347,
+                                    777,         650,         110,        -662) },
+    { simde_mm256_set_ps(   802.41f,   -552.31f,    950.18f,   -757.03f,
+                             82.19f,   -576.17f,     22.84f,    -56.50f),
+      simde_mm256_set_epi32(        802,        -552,         950,        -757,
+                                     82,        -576,          23,         -56) },
+    { simde_mm256_set_ps(   775.00f,     11.45f,    301.68f,   -924.93f,
+                             61.73f,   -945.24f,   -143.44f,   -720.60f),
+      simde_mm256_set_epi32(        775,          11,         302,        -925,
+                                     62,        -945,        -143,        -721) },
+    { simde_mm256_set_ps(  -688.51f,    993.09f,   -227.96f,    771.32f,
+                            937.18f,    175.11f,   -405.20f,     96.73f),
+      simde_mm256_set_epi32(       -689,         993,        -228,         771,
+                                    937,         175,        -405,          97) },
+    { simde_mm256_set_ps(   456.31f,    116.36f,    320.97f,     51.01f,
+                            413.93f,    820.52f,   -945.08f,    784.20f),
+      simde_mm256_set_epi32(        456,         116,         321,          51,
+                                    414,         821,        -945,         784) },
+    { simde_mm256_set_ps(  -263.43f,    -18.68f,    697.23f,   -112.39f,
+                            996.32f,   -155.65f,    116.31f,     21.71f),
+      simde_mm256_set_epi32(       -263,         -19,         697,        -112,
+                                    996,        -156,         116,          22) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cvtps_epi32(test_vec[i].a);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtps_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(   414.10f,   -326.94f,   -243.68f,    -76.12f),
+      simde_mm256_set_pd(   414.10,   -326.94,   -243.68,    -76.12) },
+    { simde_mm_set_ps(     1.66f,   -847.22f,    659.19f,   -720.59f),
+      simde_mm256_set_pd(     1.66,   -847.22,    659.19,   -720.59) },
+    { simde_mm_set_ps(   171.27f,    548.41f,    950.51f,   -152.97f),
+      simde_mm256_set_pd(   171.27,    548.41,    950.51,   -152.97) },
+    { simde_mm_set_ps(  -400.02f,    892.77f,    484.82f,    -83.14f),
+      simde_mm256_set_pd(  -400.02,    892.77,    484.82,    -83.14) },
+    { simde_mm_set_ps(  -868.82f,     28.38f,    638.67f,   -902.65f),
+      simde_mm256_set_pd(  -868.82,     28.38,    638.67,   -902.65) },
+    { simde_mm_set_ps(  -936.17f,   -969.34f,   -295.41f,    202.79f),
+      simde_mm256_set_pd(  -936.17,   -969.34,   -295.41,    202.79) },
+    { simde_mm_set_ps(  -576.11f,    503.23f,    630.23f,     35.45f),
+      simde_mm256_set_pd(  -576.11,    503.23,    630.23,     35.45) },
+    { simde_mm_set_ps(  -221.81f,    -80.77f,   -415.59f,    918.85f),
+      simde_mm256_set_pd(  -221.81,    -80.77,   -415.59,    918.85) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_cvtps_pd(test_vec[i].a);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtsd_f64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float64 a[4];
+
+    random_f64v(sizeof(a) / sizeof(a[0]), a);
+    munit_assert_double(simde_mm256_cvtsd_f64(simde_mm256_loadu_pd(a)), ==, a[0]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtsi256_si32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde__m256i a;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) &a);
+    munit_assert_int32(simde_mm256_cvtsi256_si32(a), ==, a.i32[0]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtss_f32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[8];
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    munit_assert_float(simde_mm256_cvtss_f32(simde_mm256_loadu_ps(a)), ==, a[0]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvttpd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(  -412.63,    743.54,   -713.92,    358.66),
+      simde_mm_set_epi32(       -412,         743,        -713,         358) },
+    { simde_mm256_set_pd(  -170.78,   -622.83,   -452.72,   -649.32),
+      simde_mm_set_epi32(       -170,        -622,        -452,        -649) },
+    { simde_mm256_set_pd(  -834.06,    852.43,     16.62,   -289.60),
+      simde_mm_set_epi32(       -834,         852,          16,        -289) },
+    { simde_mm256_set_pd(   761.13,    323.74,   -954.45,   -708.64),
+      simde_mm_set_epi32(        761,         323,        -954,        -708) },
+    { simde_mm256_set_pd(  -930.67,   -263.66,    449.07,   -426.14),
+      simde_mm_set_epi32(       -930,        -263,         449,        -426) },
+    { simde_mm256_set_pd(  -726.98,    -12.77,    310.23,   -106.95),
+      simde_mm_set_epi32(       -726,         -12,         310,        -106) },
+    { simde_mm256_set_pd(  -703.14,   -939.72,    237.39,    797.46),
+      simde_mm_set_epi32(       -703,        -939,         237,         797) },
+    { simde_mm256_set_pd(   -35.17,    456.12,    799.17,   -374.31),
+      simde_mm_set_epi32(        -35,         456,         799,        -374) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm256_cvttpd_epi32(test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvttps_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(  -585.52f,    -25.07f,    510.69f,    288.17f,
+                           -683.29f,    669.13f,   -306.26f,   -185.24f),
+      simde_mm256_set_epi32(       -585,         -25,         510,         288,
+                                   -683,         669,        -306,        -185) },
+    { simde_mm256_set_ps(   541.54f,    831.57f,   -117.74f,    354.73f,
+                           -882.99f,    560.11f,   -416.97f,    201.87f),
+      simde_mm256_set_epi32(        541,         831,        -117,         354,
+                                   -882,         560,        -416,         201) },
+    { simde_mm256_set_ps(   388.91f,    454.54f,    349.76f,    535.91f,
+                            -62.23f,    750.35f,   -294.80f,    216.31f),
+      simde_mm256_set_epi32(        388,         454,         349,         535,
+                                    -62,         750,        -294,         216) },
+    { simde_mm256_set_ps(   890.82f,   -129.29f,   -672.29f,    300.11f,
+                             30.26f,    402.64f,   -396.27f,   -795.15f),
+      simde_mm256_set_epi32(        890,        -129,        -672,         300,
+                                     30,         402,        -396,        -795) },
+    { simde_mm256_set_ps(   332.89f,     86.17f,    590.95f,    128.49f,
+                           -550.60f,    362.89f,    475.83f,   -104.14f),
+      simde_mm256_set_epi32(        332,          86,         590,         128,
+                                   -550,         362,         475,        -104) },
+    { simde_mm256_set_ps(   921.49f,    389.65f,   -481.29f,   -490.77f,
+                            -31.34f,    -77.20f,   -962.64f,    253.77f),
+      simde_mm256_set_epi32(        921,         389,        -481,        -490,
+                                    -31,         -77,        -962,         253) },
+    { simde_mm256_set_ps(   518.33f,   -604.58f,   -398.70f,    801.78f,
+                           -187.72f,   -149.75f,    301.61f,    968.78f),
+      simde_mm256_set_epi32(        518,        -604,        -398,         801,
+                                   -187,        -149,         301,         968) },
+    { simde_mm256_set_ps(   946.22f,   -503.21f,   -794.11f,    295.16f,
+                            741.19f,    739.48f,    515.49f,   -366.68f),
+      simde_mm256_set_epi32(        946,        -503,        -794,         295,
+                                    741,         739,         515,        -366) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cvttps_epi32(test_vec[i].a);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_div_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(  -901.32,    -34.80,   -200.81,   -952.29),
+      simde_mm256_set_pd(   654.15,    360.34,   -933.41,    459.98),
+      simde_mm256_set_pd(    -1.38,     -0.10,      0.22,     -2.07) },
+    { simde_mm256_set_pd(  -606.25,    630.81,   -272.57,   -927.10),
+      simde_mm256_set_pd(   301.53,   -725.46,    970.59,   -945.40),
+      simde_mm256_set_pd(    -2.01,     -0.87,     -0.28,      0.98) },
+    { simde_mm256_set_pd(   380.05,   -510.14,    -44.80,   -498.89),
+      simde_mm256_set_pd(  -889.35,   -372.73,   -693.29,    966.82),
+      simde_mm256_set_pd(    -0.43,      1.37,      0.06,     -0.52) },
+    { simde_mm256_set_pd(   104.43,    498.48,    830.61,    920.93),
+      simde_mm256_set_pd(     8.12,     -8.61,   -898.97,   -613.97),
+      simde_mm256_set_pd(    12.86,    -57.90,     -0.92,     -1.50) },
+    { simde_mm256_set_pd(   460.02,   -479.86,   -371.36,   -841.97),
+      simde_mm256_set_pd(  -151.54,   -763.55,   -120.79,    905.42),
+      simde_mm256_set_pd(    -3.04,      0.63,      3.07,     -0.93) },
+    { simde_mm256_set_pd(    93.26,    404.78,    667.86,    800.68),
+      simde_mm256_set_pd(   404.99,    627.13,    286.21,   -803.69),
+      simde_mm256_set_pd(     0.23,      0.65,      2.33,     -1.00) },
+    { simde_mm256_set_pd(  -375.12,   -304.97,    862.22,    552.92),
+      simde_mm256_set_pd(   811.01,    187.23,    803.55,    428.70),
+      simde_mm256_set_pd(    -0.46,     -1.63,      1.07,      1.29) },
+    { simde_mm256_set_pd(   648.79,    819.85,    253.62,    426.29),
+      simde_mm256_set_pd(   369.78,   -946.93,   -840.04,   -772.78),
+      simde_mm256_set_pd(     1.75,     -0.87,     -0.30,     -0.55) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_div_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_div_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(  -824.83f,   -369.83f,    130.99f,   -916.32f,
+                            -11.22f,   -238.15f,   -155.67f,    625.23f),
+      simde_mm256_set_ps(  -363.96f,    378.15f,   -575.07f,   -266.77f,
+                            493.94f,   -544.25f,   -525.32f,    837.15f),
+      simde_mm256_set_ps(     2.27f,     -0.98f,     -0.23f,      3.43f,
+                             -0.02f,      0.44f,      0.30f,      0.75f) },
+    { simde_mm256_set_ps(   704.98f,   -955.73f,    243.85f,   -531.64f,
+                           -367.23f,     97.31f,   -927.98f,   -606.55f),
+      simde_mm256_set_ps(   930.55f,   -100.03f,   -941.04f,    835.46f,
+                            110.29f,    215.40f,    235.90f,   -102.52f),
+      simde_mm256_set_ps(     0.76f,      9.55f,     -0.26f,     -0.64f,
+                             -3.33f,      0.45f,     -3.93f,      5.92f) },
+    { simde_mm256_set_ps(   814.13f,    317.01f,   -468.30f,     -1.63f,
+                           -943.12f,   -980.68f,    706.93f,    409.17f),
+      simde_mm256_set_ps(    60.49f,    602.58f,   -195.08f,   -372.82f,
+                            823.95f,    320.05f,    594.91f,    234.91f),
+      simde_mm256_set_ps(    13.46f,      0.53f,      2.40f,      0.00f,
+                             -1.14f,     -3.06f,      1.19f,      1.74f) },
+    { simde_mm256_set_ps(  -921.32f,    524.53f,   -956.40f,   -662.74f,
+                            207.83f,     74.36f,    947.05f,    -92.85f),
+      simde_mm256_set_ps(  -699.24f,    898.48f,   -889.18f,   -109.37f,
+                            483.69f,   -641.13f,    830.61f,   -236.38f),
+      simde_mm256_set_ps(     1.32f,      0.58f,      1.08f,      6.06f,
+                              0.43f,     -0.12f,      1.14f,      0.39f) },
+    { simde_mm256_set_ps(  -152.21f,    633.82f,    854.50f,    208.47f,
+                           -323.59f,    237.24f,     78.03f,    524.65f),
+      simde_mm256_set_ps(   734.78f,    -16.45f,    -65.17f,    791.11f,
+                            263.36f,    -64.39f,    884.93f,    531.06f),
+      simde_mm256_set_ps(    -0.21f,    -38.53f,    -13.11f,      0.26f,
+                             -1.23f,     -3.68f,      0.09f,      0.99f) },
+    { simde_mm256_set_ps(   735.63f,    850.46f,    892.18f,   -893.85f,
+                              0.48f,    386.89f,    548.47f,   -148.67f),
+      simde_mm256_set_ps(   687.84f,    333.68f,   -243.75f,    742.58f,
+                            191.50f,     48.31f,    803.96f,    686.26f),
+      simde_mm256_set_ps(     1.07f,      2.55f,     -3.66f,     -1.20f,
+                              0.00f,      8.01f,      0.68f,     -0.22f) },
+    { simde_mm256_set_ps(   710.27f,    755.56f,   -401.38f,    946.10f,
+                           -575.14f,    477.53f,    545.11f,    916.49f),
+      simde_mm256_set_ps(   847.32f,   -955.10f,   -245.93f,    -41.02f,
+                           -108.23f,   -927.82f,    401.73f,   -271.11f),
+      simde_mm256_set_ps(     0.84f,     -0.79f,      1.63f,    -23.06f,
+                              5.31f,     -0.51f,      1.36f,     -3.38f) },
+    { simde_mm256_set_ps(  -725.38f,   -577.28f,    488.17f,    -37.59f,
+                            719.73f,   -174.92f,    861.61f,     20.48f),
+      simde_mm256_set_ps(    61.18f,   -183.90f,    991.32f,    421.96f,
+                           -178.90f,   -981.00f,   -839.81f,    550.93f),
+      simde_mm256_set_ps(   -11.86f,      3.14f,      0.49f,     -0.09f,
+                             -4.02f,      0.18f,     -1.03f,      0.04f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_div_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_extractf128_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[8];
+    simde__m256 v;
+    simde__m128 r;
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    v = simde_mm256_loadu_ps(a);
+
+    r = simde_mm256_extractf128_ps(v, 0);
+    munit_assert_memory_equal(sizeof(r), &r, &(a[0]));
+    r = simde_mm256_extractf128_ps(v, 1);
+    munit_assert_memory_equal(sizeof(r), &r, &(a[4]));
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_extractf128_si256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde__m256i a;
+    simde__m128i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) &a);
+
+    r = simde_mm256_extractf128_si256(a, 0);
+    simde_assert_m128i_i64(r, ==, a.m128i[0]);
+    r = simde_mm256_extractf128_si256(a, 1);
+    munit_assert_int64(r.i64[0], ==, a.i64[2]);
+    munit_assert_int64(r.i64[1], ==, a.i64[3]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_floor_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   -64.57,   -349.62,   -773.17,   -832.59),
+      simde_mm256_set_pd(   -65.00,   -350.00,   -774.00,   -833.00) },
+    { simde_mm256_set_pd(   479.46,   -628.08,   -198.87,    672.90),
+      simde_mm256_set_pd(   479.00,   -629.00,   -199.00,    672.00) },
+    { simde_mm256_set_pd(   397.61,    423.78,    468.40,    993.00),
+      simde_mm256_set_pd(   397.00,    423.00,    468.00,    993.00) },
+    { simde_mm256_set_pd(   957.93,   -424.56,   -806.87,   -534.08),
+      simde_mm256_set_pd(   957.00,   -425.00,   -807.00,   -535.00) },
+    { simde_mm256_set_pd(   668.41,   -136.04,   -772.87,   -494.63),
+      simde_mm256_set_pd(   668.00,   -137.00,   -773.00,   -495.00) },
+    { simde_mm256_set_pd(   126.75,    -71.29,   -180.81,   -404.80),
+      simde_mm256_set_pd(   126.00,    -72.00,   -181.00,   -405.00) },
+    { simde_mm256_set_pd(  -832.81,    268.21,   -159.18,   -233.75),
+      simde_mm256_set_pd(  -833.00,    268.00,   -160.00,   -234.00) },
+    { simde_mm256_set_pd(  -875.95,     15.65,   -882.92,   -989.71),
+      simde_mm256_set_pd(  -876.00,     15.00,   -883.00,   -990.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_floor_pd(test_vec[i].a);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_floor_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   970.43f,    846.74f,    756.18f,    746.96f,
+                            213.09f,   -307.78f,    150.81f,   -811.48f),
+      simde_mm256_set_ps(   970.00f,    846.00f,    756.00f,    746.00f,
+                            213.00f,   -308.00f,    150.00f,   -812.00f) },
+    { simde_mm256_set_ps(  -840.58f,    842.23f,    349.58f,    639.65f,
+                           -658.84f,   -299.79f,    863.54f,   -699.63f),
+      simde_mm256_set_ps(  -841.00f,    842.00f,    349.00f,    639.00f,
+                           -659.00f,   -300.00f,    863.00f,   -700.00f) },
+    { simde_mm256_set_ps(   472.53f,    553.48f,    646.48f,   -741.82f,
+                            559.23f,   -638.75f,    102.57f,    918.82f),
+      simde_mm256_set_ps(   472.00f,    553.00f,    646.00f,   -742.00f,
+                            559.00f,   -639.00f,    102.00f,    918.00f) },
+    { simde_mm256_set_ps(  -398.80f,    910.96f,    948.60f,   -157.49f,
+                           -492.69f,    148.85f,    977.46f,    464.71f),
+      simde_mm256_set_ps(  -399.00f,    910.00f,    948.00f,   -158.00f,
+                           -493.00f,    148.00f,    977.00f,    464.00f) },
+    { simde_mm256_set_ps(  -603.61f,    932.48f,    838.85f,   -359.79f,
+                            962.68f,   -804.44f,      3.77f,   -233.47f),
+      simde_mm256_set_ps(  -604.00f,    932.00f,    838.00f,   -360.00f,
+                            962.00f,   -805.00f,      3.00f,   -234.00f) },
+    { simde_mm256_set_ps(  -400.69f,   -911.46f,   -438.92f,    317.70f,
+                            536.53f,    145.57f,   -709.75f,    708.17f),
+      simde_mm256_set_ps(  -401.00f,   -912.00f,   -439.00f,    317.00f,
+                            536.00f,    145.00f,   -710.00f,    708.00f) },
+    { simde_mm256_set_ps(   172.80f,    808.50f,   -428.88f,    -23.30f,
+                           -774.56f,   -374.18f,    605.81f,   -605.07f),
+      simde_mm256_set_ps(   172.00f,    808.00f,   -429.00f,    -24.00f,
+                           -775.00f,   -375.00f,    605.00f,   -606.00f) },
+    { simde_mm256_set_ps(  -102.95f,   -184.47f,   -279.49f,    310.07f,
+                           -654.34f,    552.32f,   -788.29f,     87.50f),
+      simde_mm256_set_ps(  -103.00f,   -185.00f,   -280.00f,    310.00f,
+                           -655.00f,    552.00f,   -789.00f,     87.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_floor_ps(test_vec[i].a);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_hadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   382.89,    124.56,    415.69,   -799.02),
+      simde_mm256_set_pd(   185.15,    622.63,    992.04,    -25.07),
+      simde_mm256_set_pd(   807.78,    507.45,    966.97,   -383.33) },
+    { simde_mm256_set_pd(   423.58,    822.53,   -851.77,    342.70),
+      simde_mm256_set_pd(  -169.25,   -704.58,    269.39,   -297.77),
+      simde_mm256_set_pd(  -873.83,   1246.11,    -28.38,   -509.07) },
+    { simde_mm256_set_pd(  -709.12,   -166.45,   -236.13,   -240.91),
+      simde_mm256_set_pd(    22.51,     58.10,    914.35,    -20.08),
+      simde_mm256_set_pd(    80.61,   -875.57,    894.27,   -477.04) },
+    { simde_mm256_set_pd(  -391.28,   -589.58,    257.07,   -990.61),
+      simde_mm256_set_pd(  -864.68,   -611.78,   -662.90,    884.25),
+      simde_mm256_set_pd( -1476.46,   -980.86,    221.35,   -733.54) },
+    { simde_mm256_set_pd(   878.39,   -590.92,   -321.72,    257.83),
+      simde_mm256_set_pd(  -331.20,    468.46,   -655.30,    511.12),
+      simde_mm256_set_pd(   137.26,    287.47,   -144.18,    -63.89) },
+    { simde_mm256_set_pd(   182.19,   -240.60,    739.10,   -144.16),
+      simde_mm256_set_pd(  -909.98,   -359.51,   -847.47,     78.12),
+      simde_mm256_set_pd( -1269.49,    -58.41,   -769.35,    594.94) },
+    { simde_mm256_set_pd(   560.22,   -479.40,    216.09,    229.50),
+      simde_mm256_set_pd(   507.27,    173.74,    456.57,   -358.46),
+      simde_mm256_set_pd(   681.01,     80.82,     98.11,    445.59) },
+    { simde_mm256_set_pd(   618.32,   -544.75,    274.65,   -210.51),
+      simde_mm256_set_pd(  -785.92,   -148.14,   -391.77,   -783.06),
+      simde_mm256_set_pd(  -934.06,     73.57,  -1174.83,     64.14) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_hadd_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_hadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   740.86f,    790.05f,      3.68f,   -540.02f,
+                             49.53f,   -411.65f,    244.67f,    878.27f),
+      simde_mm256_set_ps(   686.33f,    665.35f,    650.32f,   -452.32f,
+                            778.83f,    605.63f,   -416.44f,    266.02f),
+      simde_mm256_set_ps(  1351.68f,    198.00f,   1530.91f,   -536.34f,
+                           1384.46f,   -150.42f,   -362.12f,   1122.94f) },
+    { simde_mm256_set_ps(  -771.48f,   -133.09f,   -462.68f,    881.29f,
+                            688.89f,   -937.13f,    807.51f,   -920.19f),
+      simde_mm256_set_ps(   178.84f,    175.11f,   -206.08f,   -981.70f,
+                            386.74f,      8.51f,   -942.12f,    119.56f),
+      simde_mm256_set_ps(   353.95f,  -1187.78f,   -904.57f,    418.61f,
+                            395.25f,   -822.56f,   -248.24f,   -112.68f) },
+    { simde_mm256_set_ps(   548.76f,   -864.05f,   -967.17f,   -655.72f,
+                            977.46f,   -800.94f,    817.75f,    652.21f),
+      simde_mm256_set_ps(   403.02f,   -401.51f,    422.09f,    946.10f,
+                           -670.47f,   -649.93f,    938.95f,    553.28f),
+      simde_mm256_set_ps(     1.51f,   1368.19f,   -315.29f,  -1622.89f,
+                          -1320.40f,   1492.23f,    176.52f,   1469.96f) },
+    { simde_mm256_set_ps(  -593.88f,   -272.16f,    234.21f,   -972.14f,
+                            985.57f,    299.01f,   -207.97f,   -811.35f),
+      simde_mm256_set_ps(  -181.51f,   -608.70f,    272.02f,    468.45f,
+                            892.16f,    786.04f,    -80.64f,    371.02f),
+      simde_mm256_set_ps(  -790.21f,    740.47f,   -866.04f,   -737.93f,
+                           1678.20f,    290.38f,   1284.58f,  -1019.32f) },
+    { simde_mm256_set_ps(   489.66f,   -426.40f,   -425.69f,   -625.55f,
+                            -40.50f,    737.83f,   -125.21f,    121.10f),
+      simde_mm256_set_ps(   171.14f,   -939.55f,   -873.64f,     30.67f,
+                            -65.42f,    561.77f,    -34.30f,   -903.38f),
+      simde_mm256_set_ps(  -768.41f,   -842.97f,     63.26f,  -1051.24f,
+                            496.35f,   -937.68f,    697.33f,     -4.11f) },
+    { simde_mm256_set_ps(    49.95f,    131.36f,   -480.21f,    913.53f,
+                           -886.88f,   -304.07f,   -538.00f,   -473.23f),
+      simde_mm256_set_ps(  -540.81f,   -276.01f,    375.33f,   -579.53f,
+                           -857.61f,    392.47f,    433.73f,   -233.26f),
+      simde_mm256_set_ps(  -816.82f,   -204.20f,    181.31f,    433.32f,
+                           -465.14f,    200.47f,  -1190.95f,  -1011.23f) },
+    { simde_mm256_set_ps(    24.56f,    926.85f,    800.42f,    674.92f,
+                           -558.96f,   -507.94f,   -534.18f,     57.15f),
+      simde_mm256_set_ps(   598.15f,    536.94f,    445.20f,   -265.84f,
+                           -539.43f,    441.84f,    846.32f,    338.08f),
+      simde_mm256_set_ps(  1135.09f,    179.36f,    951.41f,   1475.34f,
+                            -97.59f,   1184.40f,  -1066.90f,   -477.03f) },
+    { simde_mm256_set_ps(   -26.96f,   -467.13f,   -884.53f,    -67.02f,
+                            -63.06f,    483.64f,   -726.38f,    501.35f),
+      simde_mm256_set_ps(   328.92f,   -611.61f,   -649.12f,   -164.07f,
+                           -156.96f,    474.73f,   -472.38f,    909.27f),
+      simde_mm256_set_ps(  -282.69f,   -813.19f,   -494.09f,   -951.55f,
+                            317.77f,    436.89f,    420.58f,   -225.03f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_hadd_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_hsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   493.35,    869.83,   -890.70,    162.47),
+      simde_mm256_set_pd(  -535.58,   -818.09,    592.48,   -179.10),
+      simde_mm256_set_pd(  -282.51,    376.48,   -771.58,   1053.17) },
+    { simde_mm256_set_pd(   860.70,   -532.77,    505.16,    790.05),
+      simde_mm256_set_pd(   262.91,    991.60,   -405.90,   -562.64),
+      simde_mm256_set_pd(   728.69,  -1393.47,   -156.74,    284.89) },
+    { simde_mm256_set_pd(   710.76,    210.74,   -974.64,    938.44),
+      simde_mm256_set_pd(   193.84,    483.94,    270.01,   -160.30),
+      simde_mm256_set_pd(   290.10,   -500.02,   -430.31,   1913.08) },
+    { simde_mm256_set_pd(  -295.45,    851.15,    686.68,   -831.77),
+      simde_mm256_set_pd(   349.18,   -356.70,   -298.37,    183.68),
+      simde_mm256_set_pd(  -705.88,   1146.60,    482.05,  -1518.45) },
+    { simde_mm256_set_pd(   108.90,   -121.59,    604.79,   -649.87),
+      simde_mm256_set_pd(  -546.53,    -11.64,    897.87,   -735.12),
+      simde_mm256_set_pd(   534.89,   -230.49,  -1632.99,  -1254.66) },
+    { simde_mm256_set_pd(  -154.14,    749.53,   -683.72,     57.90),
+      simde_mm256_set_pd(  -939.75,     34.29,    -10.10,    422.63),
+      simde_mm256_set_pd(   974.04,    903.67,    432.73,    741.62) },
+    { simde_mm256_set_pd(  -119.87,     41.53,    259.96,   -160.71),
+      simde_mm256_set_pd(   752.00,    712.51,    151.70,   -681.22),
+      simde_mm256_set_pd(   -39.49,    161.40,   -832.92,   -420.67) },
+    { simde_mm256_set_pd(   765.97,   -393.70,    338.41,   -585.56),
+      simde_mm256_set_pd(  -500.71,   -734.63,    307.89,   -931.83),
+      simde_mm256_set_pd(  -233.92,  -1159.67,  -1239.72,   -923.97) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_hsub_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_hsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   756.34f,   -240.18f,      5.83f,   -106.13f,
+                            122.55f,    864.52f,    721.10f,    205.46f),
+      simde_mm256_set_ps(   -41.32f,   -503.71f,    447.35f,   -541.91f,
+                            344.23f,   -175.31f,   -402.29f,    497.76f),
+      simde_mm256_set_ps(  -462.39f,   -989.26f,   -996.52f,   -111.96f,
+                           -519.54f,    900.05f,    741.97f,   -515.64f) },
+    { simde_mm256_set_ps(  -718.54f,    -74.00f,    106.76f,   -814.45f,
+                           -603.08f,     33.20f,    654.58f,    448.74f),
+      simde_mm256_set_ps(   693.78f,   -246.96f,   -396.72f,    858.65f,
+                            746.51f,    -31.17f,    630.97f,   -761.53f),
+      simde_mm256_set_ps(  -940.74f,   1255.37f,    644.54f,   -921.21f,
+                           -777.68f,  -1392.50f,    636.28f,   -205.84f) },
+    { simde_mm256_set_ps(   220.81f,    717.44f,   -648.76f,   -996.23f,
+                           -474.65f,    818.79f,   -248.25f,   -782.25f),
+      simde_mm256_set_ps(   508.20f,    541.44f,   -138.26f,    459.36f,
+                           -798.24f,    967.10f,    443.99f,   -444.82f),
+      simde_mm256_set_ps(    33.24f,    597.62f,    496.63f,   -347.47f,
+                           1765.34f,   -888.81f,   1293.44f,   -534.00f) },
+    { simde_mm256_set_ps(  -766.45f,    726.01f,   -359.77f,    619.45f,
+                           -973.94f,   -668.55f,    716.03f,     96.43f),
+      simde_mm256_set_ps(   435.90f,   -444.63f,    350.38f,   -392.86f,
+                            848.35f,    213.42f,   -255.51f,    787.58f),
+      simde_mm256_set_ps(  -880.53f,   -743.24f,   1492.46f,    979.22f,
+                           -634.93f,   1043.09f,    305.39f,   -619.60f) },
+    { simde_mm256_set_ps(  -519.08f,    934.57f,    -51.60f,   -648.26f,
+                           -108.28f,   -785.81f,    886.17f,   -767.74f),
+      simde_mm256_set_ps(  -699.33f,   -684.30f,   -977.60f,    685.06f,
+                           -908.63f,   -495.83f,     42.32f,    773.70f),
+      simde_mm256_set_ps(    15.03f,   1662.66f,   1453.65f,   -596.66f,
+                            412.80f,    731.38f,   -677.53f,  -1653.91f) },
+    { simde_mm256_set_ps(   161.83f,    855.88f,    704.32f,    -49.93f,
+                             64.95f,    547.56f,    780.01f,   -599.52f),
+      simde_mm256_set_ps(  -284.98f,   -750.47f,    -69.44f,   -328.09f,
+                           -866.14f,   -409.86f,   -119.28f,   -570.15f),
+      simde_mm256_set_ps(  -465.49f,   -258.65f,    694.05f,   -754.25f,
+                            456.28f,   -450.87f,    482.61f,  -1379.53f) },
+    { simde_mm256_set_ps(   564.10f,    907.08f,    222.22f,   -150.74f,
+                           -607.41f,    415.92f,   -957.32f,   -706.08f),
+      simde_mm256_set_ps(  -132.83f,    360.64f,   -880.38f,    160.02f,
+                            660.04f,   -964.86f,   -319.79f,    509.36f),
+      simde_mm256_set_ps(   493.47f,   1040.40f,    342.98f,   -372.96f,
+                          -1624.90f,    829.15f,   1023.33f,    251.24f) },
+    { simde_mm256_set_ps(   961.60f,    653.97f,   -274.92f,    846.63f,
+                           -310.40f,   -610.02f,    575.37f,    955.40f),
+      simde_mm256_set_ps(   784.30f,    181.01f,    681.12f,     48.42f,
+                           -913.91f,    345.06f,   -688.67f,    879.99f),
+      simde_mm256_set_ps(  -603.29f,   -632.70f,   -307.63f,   1121.55f,
+                           1258.97f,   1568.66f,   -299.62f,    380.03f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_hsub_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_insertf128_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float64 a[4], b[2], e[4];
+    simde__m256d r;
+
+    random_f64v(sizeof(a) / sizeof(a[0]), a);
+    random_f64v(sizeof(b) / sizeof(b[0]), b);
+
+    r = simde_mm256_insertf128_pd(simde_mm256_loadu_pd(a), simde_mm_loadu_pd(b), 0);
+    e[0] = b[0]; e[1] = b[1]; e[2] = a[2]; e[3] = a[3];
+    munit_assert_memory_equal(sizeof(e), &r, e);
+
+    r = simde_mm256_insertf128_pd(simde_mm256_loadu_pd(a), simde_mm_loadu_pd(b), 1);
+    e[0] = a[0]; e[1] = a[1]; e[2] = b[0]; e[3] = b[1];
+    munit_assert_memory_equal(sizeof(e), &r, e);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_load_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    SIMDE__ALIGN(32) simde_float64 a[4];
+    simde__m256d r;
+
+    random_f64v(sizeof(a) / sizeof(a[0]), a);
+    r = simde_mm256_load_pd(a);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_loadu2_m128i(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde__m128i hi, lo;
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(hi), (uint8_t*) &hi);
+    munit_rand_memory(sizeof(lo), (uint8_t*) &lo);
+    r = simde_mm256_loadu2_m128i(&hi, &lo);
+
+    simde_assert_m128i_i64(r.m128i[0], ==, lo);
+    simde_assert_m128i_i64(r.m128i[1], ==, hi);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_loadu_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[9];
+    simde__m256 r;
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    r = simde_mm256_loadu_ps(&(a[1]));
+
+    munit_assert_memory_equal(sizeof(r), &(a[1]), &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maskload_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256i mask;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(    -9.33,   -886.93,   -633.35,     38.19),
+      simde_mm256_set_epi64x(INT64_C(-2090057335118092511), INT64_C( 8596237798705538366),
+                             INT64_C( 2346869603109945826), INT64_C(-8577588193352090785)),
+      simde_mm256_set_pd(    -9.33,      0.00,      0.00,     38.19) },
+    { simde_mm256_set_pd(   509.84,    389.78,   -178.77,    -68.49),
+      simde_mm256_set_epi64x(INT64_C(-3615428071606685222), INT64_C(-2042537703094603902),
+                             INT64_C( 2364423555725593121), INT64_C( -471265660970846529)),
+      simde_mm256_set_pd(   509.84,    389.78,      0.00,    -68.49) },
+    { simde_mm256_set_pd(   136.66,    967.79,    176.04,   -211.21),
+      simde_mm256_set_epi64x(INT64_C(-2844448435563086131), INT64_C( -547990234873297241),
+                             INT64_C( 6386443742241356288), INT64_C(  185092546866153060)),
+      simde_mm256_set_pd(   136.66,    967.79,      0.00,      0.00) },
+    { simde_mm256_set_pd(   382.15,   -383.51,    827.10,   -887.28),
+      simde_mm256_set_epi64x(INT64_C(-3147778929872586701), INT64_C( 6825289433802529403),
+                             INT64_C( 5061293610672754540), INT64_C( 6543944863587058106)),
+      simde_mm256_set_pd(   382.15,      0.00,      0.00,      0.00) },
+    { simde_mm256_set_pd(   925.77,    942.52,   -505.51,   -954.31),
+      simde_mm256_set_epi64x(INT64_C(-3224071860724134085), INT64_C( 7157387755969638314),
+                             INT64_C( 2083705546046588873), INT64_C( 4377793882729436417)),
+      simde_mm256_set_pd(   925.77,      0.00,      0.00,      0.00) },
+    { simde_mm256_set_pd(   944.15,   -350.90,    960.25,    714.62),
+      simde_mm256_set_epi64x(INT64_C(-4602906160375900439), INT64_C(-2953307945032711878),
+                             INT64_C(-8063077597351306956), INT64_C(-2512549229135592757)),
+      simde_mm256_set_pd(   944.15,   -350.90,    960.25,    714.62) },
+    { simde_mm256_set_pd(   561.92,    989.63,    710.56,    463.17),
+      simde_mm256_set_epi64x(INT64_C(-1308796083481853427), INT64_C( 7049291083723533687),
+                             INT64_C( 2652235195749621278), INT64_C(-9129412172836234035)),
+      simde_mm256_set_pd(   561.92,      0.00,      0.00,    463.17) },
+    { simde_mm256_set_pd(   819.43,    857.02,   -203.02,   -691.51),
+      simde_mm256_set_epi64x(INT64_C( 8703063418079417512), INT64_C(  832450605734888962),
+                             INT64_C( 4308259888046908762), INT64_C(-5612640126239375707)),
+      simde_mm256_set_pd(     0.00,      0.00,      0.00,   -691.51) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 a[4];
+    simde_mm256_storeu_pd(a, test_vec[i].a);
+    simde__m256d r = simde_mm256_maskload_pd(a, test_vec[i].mask);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maskload_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256i mask;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(  -792.38f,   -324.59f,   -401.03f,   -406.72f,
+                           -459.42f,    123.99f,    809.90f,    640.23f),
+      simde_mm256_set_epi32(-1747916283,   886643191,  1690295310,  1856857126,
+                            -1788377766,  1346821844,  -397929047,  -894171395),
+      simde_mm256_set_ps(  -792.38f,      0.00f,      0.00f,      0.00f,
+                           -459.42f,      0.00f,    809.90f,    640.23f) },
+    { simde_mm256_set_ps(   598.52f,    221.95f,     86.68f,   -296.99f,
+                           -185.92f,   -997.61f,    992.07f,   -621.43f),
+      simde_mm256_set_epi32( -268052285,   661324525,  1908738286,  1651901845,
+                              700441382,  1145362707, -1780004763,  1795661021),
+      simde_mm256_set_ps(   598.52f,      0.00f,      0.00f,      0.00f,
+                              0.00f,      0.00f,    992.07f,      0.00f) },
+    { simde_mm256_set_ps(  -565.51f,     23.11f,    819.95f,   -985.78f,
+                            979.48f,    766.49f,   -348.12f,    779.86f),
+      simde_mm256_set_epi32(  502181148, -1797989589,  -551044635, -2099394577,
+                             -757351190, -2018204850,  1260639150,   389431065),
+      simde_mm256_set_ps(     0.00f,     23.11f,    819.95f,   -985.78f,
+                            979.48f,    766.49f,      0.00f,      0.00f) },
+    { simde_mm256_set_ps(  -335.96f,   -751.28f,    523.68f,    606.05f,
+                           -931.67f,     39.01f,    499.36f,   -645.74f),
+      simde_mm256_set_epi32( 1101440651,  1201058802, -1721523827,  1788111192,
+                               99644333,  -311108367, -1068560384,  1770840578),
+      simde_mm256_set_ps(     0.00f,      0.00f,    523.68f,      0.00f,
+                              0.00f,     39.01f,    499.36f,      0.00f) },
+    { simde_mm256_set_ps(  -972.18f,   -472.60f,   -748.02f,   -617.33f,
+                            307.48f,    160.30f,    556.13f,   -828.25f),
+      simde_mm256_set_epi32(-1754194475,   -75630160,  -412040975,  1476958301,
+                             1700127943,  1140711212, -1691329138,   855094600),
+      simde_mm256_set_ps(  -972.18f,   -472.60f,   -748.02f,      0.00f,
+                              0.00f,      0.00f,    556.13f,      0.00f) },
+    { simde_mm256_set_ps(  -792.53f,   -816.08f,   -749.75f,    800.06f,
+                            181.55f,    469.06f,   -571.91f,   -498.03f),
+      simde_mm256_set_epi32(  299358430,    -9299356,  1194172470,  -635116172,
+                            -1328976996,  1867158138,  1892254691,  1886329539),
+      simde_mm256_set_ps(     0.00f,   -816.08f,      0.00f,    800.06f,
+                            181.55f,      0.00f,      0.00f,      0.00f) },
+    { simde_mm256_set_ps(   262.55f,   -195.77f,   -806.64f,    215.89f,
+                           -898.40f,   -137.98f,    322.39f,   -289.83f),
+      simde_mm256_set_epi32( 1772864650,    64581970, -1806028686,   695349429,
+                            -1190503450, -1027191406,  1229777761,   325261013),
+      simde_mm256_set_ps(     0.00f,      0.00f,   -806.64f,      0.00f,
+                           -898.40f,   -137.98f,      0.00f,      0.00f) },
+    { simde_mm256_set_ps(  -771.23f,    197.61f,   -845.01f,   -128.86f,
+                             -1.44f,    597.84f,    368.03f,   -672.83f),
+      simde_mm256_set_epi32(  302193101,  1133204362,  1543303177, -1398685888,
+                             1435721670,  -121972101,  1180037851,  1279675963),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,   -128.86f,
+                              0.00f,    597.84f,      0.00f,      0.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 a[8];
+    simde_mm256_storeu_ps(a, test_vec[i].a);
+    simde__m256 r = simde_mm256_maskload_ps(a, test_vec[i].mask);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maskstore_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256i mask;
+    simde__m256d dst;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(  -231.63,    229.22,   -674.84,   -352.09),
+      simde_mm256_set_epi64x(INT64_C( 5731346171921605065), INT64_C(-3991217438543380194),
+                             INT64_C( 7266285005228331898), INT64_C( 4049585329774185312)),
+      simde_mm256_set_pd(   395.71,   -609.86,     53.87,    200.63),
+      simde_mm256_set_pd(   395.71,    229.22,     53.87,    200.63) },
+    { simde_mm256_set_pd(  -429.77,   -960.81,    176.96,    280.93),
+      simde_mm256_set_epi64x(INT64_C(   87451283049685717), INT64_C(-7739744323365698755),
+                             INT64_C(-9115733494676000521), INT64_C(  910884005743659062)),
+      simde_mm256_set_pd(   551.17,    411.57,   -805.57,     70.61),
+      simde_mm256_set_pd(   551.17,   -960.81,    176.96,     70.61) },
+    { simde_mm256_set_pd(  -975.01,   -490.03,   -178.20,    210.85),
+      simde_mm256_set_epi64x(INT64_C(-4080710329635055219), INT64_C(-3167120079893244833),
+                             INT64_C( 6287230239399680168), INT64_C(-3972166206952941769)),
+      simde_mm256_set_pd(   234.52,   -532.90,     85.47,     26.62),
+      simde_mm256_set_pd(  -975.01,   -490.03,     85.47,    210.85) },
+    { simde_mm256_set_pd(  -476.25,    110.90,   -657.97,    142.23),
+      simde_mm256_set_epi64x(INT64_C( 3827207677150570847), INT64_C(  303231484362161374),
+                             INT64_C(-5317683929105041471), INT64_C( 4252796601106233254)),
+      simde_mm256_set_pd(  -762.53,    899.73,   -300.10,    763.23),
+      simde_mm256_set_pd(  -762.53,    899.73,   -657.97,    763.23) },
+    { simde_mm256_set_pd(   659.01,   -818.05,    818.85,   -261.20),
+      simde_mm256_set_epi64x(INT64_C( 2849876668747697677), INT64_C( 1412178978463063647),
+                             INT64_C(-3742375416971520354), INT64_C(-9013449264516148128)),
+      simde_mm256_set_pd(  -902.15,   -800.39,    799.11,      9.41),
+      simde_mm256_set_pd(  -902.15,   -800.39,    818.85,   -261.20) },
+    { simde_mm256_set_pd(  -703.91,   -623.86,   -390.88,    482.23),
+      simde_mm256_set_epi64x(INT64_C( 8021094725646257762), INT64_C(-2619992761236649870),
+                             INT64_C( 3190921278044918631), INT64_C( 4437242412877008970)),
+      simde_mm256_set_pd(    44.77,   -847.56,    104.37,   -858.99),
+      simde_mm256_set_pd(    44.77,   -623.86,    104.37,   -858.99) },
+    { simde_mm256_set_pd(   235.99,    798.61,    106.73,   -821.93),
+      simde_mm256_set_epi64x(INT64_C( 8669170832803906902), INT64_C( 1551516607787504527),
+                             INT64_C( 7389693186148018737), INT64_C(-8903866072810151422)),
+      simde_mm256_set_pd(  -982.08,   -693.91,    665.94,   -630.65),
+      simde_mm256_set_pd(  -982.08,   -693.91,    665.94,   -821.93) },
+    { simde_mm256_set_pd(   -42.58,    385.21,   -832.65,     33.66),
+      simde_mm256_set_epi64x(INT64_C(   21816254278037379), INT64_C(-4833398337418845706),
+                             INT64_C(-3687542579910277954), INT64_C( 2536780937467050896)),
+      simde_mm256_set_pd(   213.03,     99.39,    761.70,   -318.03),
+      simde_mm256_set_pd(   213.03,    385.21,   -832.65,   -318.03) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 dst[4];
+    simde_mm256_storeu_pd(dst, test_vec[i].dst);
+    simde_mm256_maskstore_pd(dst, test_vec[i].mask, test_vec[i].a);
+    simde__m256d r = simde_mm256_loadu_pd(dst);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maskstore_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256i mask;
+    simde__m256 dst;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   920.14f,    679.41f,   -671.91f,    728.29f,
+                            270.57f,    531.91f,   -757.06f,   -961.25f),
+      simde_mm256_set_epi32( -989045739,  -582357892, -1650509709, -1395238224,
+                             1999237172, -1256563369,   636889022,  1856298900),
+      simde_mm256_set_ps(   683.28f,   -794.58f,    404.64f,   -365.25f,
+                           -131.20f,   -532.27f,    438.46f,    766.85f),
+      simde_mm256_set_ps(   920.14f,    679.41f,   -671.91f,    728.29f,
+                           -131.20f,    531.91f,    438.46f,    766.85f) },
+    { simde_mm256_set_ps(   849.43f,    896.44f,    337.81f,    -14.57f,
+                           -762.30f,   -493.32f,   -250.91f,   -247.98f),
+      simde_mm256_set_epi32( 1189085719,  1129998037, -1814126092,  -472936822,
+                              398445524,  -597796744, -1672899763, -1257535562),
+      simde_mm256_set_ps(   -75.57f,   -293.07f,    670.38f,    158.38f,
+                           -805.56f,   -745.64f,   -733.58f,   -304.57f),
+      simde_mm256_set_ps(   -75.57f,   -293.07f,    337.81f,    -14.57f,
+                           -805.56f,   -493.32f,   -250.91f,   -247.98f) },
+    { simde_mm256_set_ps(   507.06f,   -566.02f,    100.89f,    248.39f,
+                           -621.79f,   -155.56f,   -209.43f,    -23.98f),
+      simde_mm256_set_epi32(  330514730,  -919379437,   680579083,  1606380083,
+                            -1302042135,  -967611146,  1013513738,  1656864140),
+      simde_mm256_set_ps(   670.88f,    479.48f,   -264.46f,   -350.87f,
+                            652.45f,    413.32f,   -865.65f,    826.05f),
+      simde_mm256_set_ps(   670.88f,   -566.02f,   -264.46f,   -350.87f,
+                           -621.79f,   -155.56f,   -865.65f,    826.05f) },
+    { simde_mm256_set_ps(  -219.32f,    110.79f,     -4.69f,    140.77f,
+                           -178.48f,    -41.29f,   -652.33f,   -468.78f),
+      simde_mm256_set_epi32( -181296958,   -53247933,   841373643,  1828649916,
+                              576189336,  -243903006,   663847291,  1514045357),
+      simde_mm256_set_ps(   959.12f,    414.97f,   -600.47f,   -285.96f,
+                            -86.73f,   -480.70f,   -733.41f,    459.86f),
+      simde_mm256_set_ps(  -219.32f,    110.79f,   -600.47f,   -285.96f,
+                            -86.73f,    -41.29f,   -733.41f,    459.86f) },
+    { simde_mm256_set_ps(  -758.11f,    540.55f,    156.30f,   -965.54f,
+                            467.50f,   -483.48f,    146.75f,    176.26f),
+      simde_mm256_set_epi32( -843762379, -1455000809, -1453239402,  1061072034,
+                              -50366792,  1629995381,  -251644800,  -992939090),
+      simde_mm256_set_ps(   411.01f,   -298.41f,    432.65f,     10.24f,
+                            456.79f,   -961.58f,   -949.15f,    226.52f),
+      simde_mm256_set_ps(  -758.11f,    540.55f,    156.30f,     10.24f,
+                            467.50f,   -961.58f,    146.75f,    176.26f) },
+    { simde_mm256_set_ps(   -16.68f,    -49.42f,   -419.70f,    210.51f,
+                           -628.00f,    138.50f,    531.66f,   -678.74f),
+      simde_mm256_set_epi32( 1683722428,  -822236572,  1531168886,  -536103764,
+                             -951711660, -1040546784, -1798457410,  -823111792),
+      simde_mm256_set_ps(   264.44f,    687.79f,    985.15f,    114.07f,
+                            326.12f,    325.07f,   -369.84f,   -810.29f),
+      simde_mm256_set_ps(   264.44f,    -49.42f,    985.15f,    210.51f,
+                           -628.00f,    138.50f,    531.66f,   -678.74f) },
+    { simde_mm256_set_ps(   811.95f,    103.93f,   -391.06f,    408.41f,
+                           -654.34f,    725.15f,    919.14f,   -680.44f),
+      simde_mm256_set_epi32( -904077580,   569659147,  -518001600,   374470189,
+                            -1439001297, -1830337527,   -79491200,  -894194117),
+      simde_mm256_set_ps(  -905.10f,   -765.86f,    607.30f,    460.12f,
+                            393.18f,   -868.88f,   -870.05f,   -914.33f),
+      simde_mm256_set_ps(   811.95f,   -765.86f,   -391.06f,    460.12f,
+                           -654.34f,    725.15f,    919.14f,   -680.44f) },
+    { simde_mm256_set_ps(   925.05f,     54.06f,    653.13f,    675.26f,
+                           -671.25f,   -773.24f,    658.37f,    749.59f),
+      simde_mm256_set_epi32(-1497573103, -2010609889, -1023359181,  -290740580,
+                             -196625976,  2069383759,  -293790980,  -449944527),
+      simde_mm256_set_ps(   938.40f,   -242.11f,    860.87f,   -892.07f,
+                            797.77f,    628.91f,    481.08f,    -19.20f),
+      simde_mm256_set_ps(   925.05f,     54.06f,    653.13f,    675.26f,
+                           -671.25f,    628.91f,    658.37f,    749.59f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 dst[8];
+    simde_mm256_storeu_ps(dst, test_vec[i].dst);
+    simde_mm256_maskstore_ps(dst, test_vec[i].mask, test_vec[i].a);
+    simde__m256 r = simde_mm256_loadu_ps(dst);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_maskload_maskstore_guard(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+#if defined(_WIN32) || !(defined(MAP_ANONYMOUS) || defined(MAP_ANON))
+  return MUNIT_SKIP;
+#else
+  /* Map three pages and make the outer two inaccessible.  Each vector
+     below straddles one of the boundaries with only the selected
+     element in the middle page, so touching any other element faults. */
+#  if !defined(MAP_ANONYMOUS)
+#    define MAP_ANONYMOUS MAP_ANON
+#  endif
+  const size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+  unsigned char* map = mmap(NULL, page_size * 3, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  munit_assert_ptr_not_equal(map, MAP_FAILED);
+  munit_assert_int(mprotect(map, page_size, PROT_NONE), ==, 0);
+  munit_assert_int(mprotect(map + (page_size * 2), page_size, PROT_NONE), ==, 0);
+
+  simde_float64* lo_pd = (simde_float64*) (map + page_size);
+  simde_float64* hi_pd = (simde_float64*) (map + (page_size * 2));
+  simde_float32* lo_ps = (simde_float32*) (map + page_size);
+  simde_float32* hi_ps = (simde_float32*) (map + (page_size * 2));
+  simde__m128d r128d, e128d;
+  simde__m256d r256d, e256d;
+  simde__m128 r128, e128;
+  simde__m256 r256, e256;
+
+  lo_pd[0] = 1.5;
+  hi_pd[-1] = 2.5;
+  r128d = simde_mm_maskload_pd(lo_pd - 1, simde_mm_set_epi64x(-1, 0));
+  e128d = simde_mm_set_pd(1.5, 0.0);
+  simde_assert_m128d_f64_equal(r128d, e128d, 1);
+  r128d = simde_mm_maskload_pd(hi_pd - 1, simde_mm_set_epi64x(0, -1));
+  e128d = simde_mm_set_pd(0.0, 2.5);
+  simde_assert_m128d_f64_equal(r128d, e128d, 1);
+  r256d = simde_mm256_maskload_pd(lo_pd - 3, simde_mm256_set_epi64x(-1, 0, 0, 0));
+  e256d = simde_mm256_set_pd(1.5, 0.0, 0.0, 0.0);
+  simde_assert_m256d_f64_equal(r256d, e256d, 1);
+  r256d = simde_mm256_maskload_pd(hi_pd - 1, simde_mm256_set_epi64x(0, 0, 0, -1));
+  e256d = simde_mm256_set_pd(0.0, 0.0, 0.0, 2.5);
+  simde_assert_m256d_f64_equal(r256d, e256d, 1);
+
+  simde_mm_maskstore_pd(lo_pd - 1, simde_mm_set_epi64x(-1, 0), simde_mm_set_pd(3.5, 4.5));
+  simde_mm_maskstore_pd(hi_pd - 1, simde_mm_set_epi64x(0, -1), simde_mm_set_pd(5.5, 6.5));
+  munit_assert_double(lo_pd[0], ==, 3.5);
+  munit_assert_double(hi_pd[-1], ==, 6.5);
+  simde_mm256_maskstore_pd(lo_pd - 3, simde_mm256_set_epi64x(-1, 0, 0, 0), simde_mm256_set_pd(7.5, 8.5, 9.5, 10.5));
+  simde_mm256_maskstore_pd(hi_pd - 1, simde_mm256_set_epi64x(0, 0, 0, -1), simde_mm256_set_pd(11.5, 12.5, 13.5, 14.5));
+  munit_assert_double(lo_pd[0], ==, 7.5);
+  munit_assert_double(hi_pd[-1], ==, 14.5);
+
+  lo_ps[0] = 1.5f;
+  hi_ps[-1] = 2.5f;
+  r128 = simde_mm_maskload_ps(lo_ps - 3, simde_mm_set_epi32(-1, 0, 0, 0));
+  e128 = simde_mm_set_ps(1.5f, 0.0f, 0.0f, 0.0f);
+  simde_assert_m128_f32_equal(r128, e128, 1);
+  r128 = simde_mm_maskload_ps(hi_ps - 1, simde_mm_set_epi32(0, 0, 0, -1));
+  e128 = simde_mm_set_ps(0.0f, 0.0f, 0.0f, 2.5f);
+  simde_assert_m128_f32_equal(r128, e128, 1);
+  r256 = simde_mm256_maskload_ps(lo_ps - 7, simde_mm256_set_epi32(-1, 0, 0, 0, 0, 0, 0, 0));
+  e256 = simde_mm256_set_ps(1.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  simde_assert_m256_f32_equal(r256, e256, 1);
+  r256 = simde_mm256_maskload_ps(hi_ps - 1, simde_mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1));
+  e256 = simde_mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.5f);
+  simde_assert_m256_f32_equal(r256, e256, 1);
+
+  simde_mm_maskstore_ps(lo_ps - 3, simde_mm_set_epi32(-1, 0, 0, 0), simde_mm_set_ps(3.5f, 4.5f, 5.5f, 6.5f));
+  simde_mm_maskstore_ps(hi_ps - 1, simde_mm_set_epi32(0, 0, 0, -1), simde_mm_set_ps(7.5f, 8.5f, 9.5f, 10.5f));
+  munit_assert_float(lo_ps[0], ==, 3.5f);
+  munit_assert_float(hi_ps[-1], ==, 10.5f);
+  simde_mm256_maskstore_ps(lo_ps - 7, simde_mm256_set_epi32(-1, 0, 0, 0, 0, 0, 0, 0),
+                           simde_mm256_set_ps(11.5f, 12.5f, 13.5f, 14.5f, 15.5f, 16.5f, 17.5f, 18.5f));
+  simde_mm256_maskstore_ps(hi_ps - 1, simde_mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, -1),
+                           simde_mm256_set_ps(19.5f, 20.5f, 21.5f, 22.5f, 23.5f, 24.5f, 25.5f, 26.5f));
+  munit_assert_float(lo_ps[0], ==, 11.5f);
+  munit_assert_float(hi_ps[-1], ==, 26.5f);
+
+  munmap(map, page_size * 3);
+
+  return MUNIT_OK;
+#endif
+}
+
+static MunitResult
+test_simde_mm256_max_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   662.40,    -10.29,    803.65,     97.32),
+      simde_mm256_set_pd(  -870.52,   -441.17,   -673.22,   -514.83),
+      simde_mm256_set_pd(   662.40,    -10.29,    803.65,     97.32) },
+    { simde_mm256_set_pd(  -982.93,   -624.75,    -77.07,   -981.31),
+      simde_mm256_set_pd(  -490.35,   -826.17,    437.39,   -512.36),
+      simde_mm256_set_pd(  -490.35,   -624.75,    437.39,   -512.36) },
+    { simde_mm256_set_pd(   637.23,   -283.99,    948.32,    -19.10),
+      simde_mm256_set_pd(  -232.29,    -98.84,   -130.25,   -248.64),
+      simde_mm256_set_pd(   637.23,    -98.84,    948.32,    -19.10) },
+    { simde_mm256_set_pd(   980.01,   -884.30,   -559.95,     16.81),
+      simde_mm256_set_pd(   864.03,   -218.92,   -995.24,    -42.52),
+      simde_mm256_set_pd(   980.01,   -218.92,   -559.95,     16.81) },
+    { simde_mm256_set_pd(   655.95,    322.69,   -528.39,   -407.95),
+      simde_mm256_set_pd(  -108.02,    434.59,    425.88,    487.93),
+      simde_mm256_set_pd(   655.95,    434.59,    425.88,    487.93) },
+    { simde_mm256_set_pd(  -601.00,   -229.81,    367.77,    424.52),
+      simde_mm256_set_pd(  -160.84,    473.63,    902.10,    231.53),
+      simde_mm256_set_pd(  -160.84,    473.63,    902.10,    424.52) },
+    { simde_mm256_set_pd(   396.88,    419.57,    255.69,    954.05),
+      simde_mm256_set_pd(  -967.21,   -870.56,     20.76,   -480.51),
+      simde_mm256_set_pd(   396.88,    419.57,    255.69,    954.05) },
+    { simde_mm256_set_pd(   -98.20,    474.06,    874.58,    917.82),
+      simde_mm256_set_pd(   763.93,   -681.95,   -150.67,   -491.01),
+      simde_mm256_set_pd(   763.93,    474.06,    874.58,    917.82) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_max_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_max_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(  -641.84f,   -455.79f,   -913.11f,    675.77f,
+                            146.91f,   -645.39f,   -239.53f,   -295.46f),
+      simde_mm256_set_ps(  -898.60f,   -407.92f,   -798.62f,      6.91f,
+                           -282.57f,    114.00f,      5.02f,    244.46f),
+      simde_mm256_set_ps(  -641.84f,   -407.92f,   -798.62f,    675.77f,
+                            146.91f,    114.00f,      5.02f,    244.46f) },
+    { simde_mm256_set_ps(   595.96f,    813.96f,   -484.62f,    283.25f,
+                           -193.11f,    177.06f,   -416.08f,     92.30f),
+      simde_mm256_set_ps(  -519.54f,   -764.08f,    466.01f,    -86.06f,
+                             44.24f,    973.25f,    612.67f,   -875.90f),
+      simde_mm256_set_ps(   595.96f,    813.96f,    466.01f,    283.25f,
+                             44.24f,    973.25f,    612.67f,     92.30f) },
+    { simde_mm256_set_ps(  -176.16f,    419.43f,    837.70f,    351.39f,
+                            995.87f,   -909.70f,     95.90f,     83.41f),
+      simde_mm256_set_ps(  -299.42f,    197.81f,    705.14f,   -199.45f,
+                           -724.80f,   -443.12f,    172.50f,   -513.32f),
+      simde_mm256_set_ps(  -176.16f,    419.43f,    837.70f,    351.39f,
+                            995.87f,   -443.12f,    172.50f,     83.41f) },
+    { simde_mm256_set_ps(   669.27f,     99.52f,   -423.12f,    412.24f,
+                            -15.63f,     -7.06f,    579.99f,   -878.19f),
+      simde_mm256_set_ps(  -832.42f,   -532.39f,    -76.24f,   -296.30f,
+                            966.89f,    791.93f,   -357.00f,    778.22f),
+      simde_mm256_set_ps(   669.27f,     99.52f,    -76.24f,    412.24f,
+                            966.89f,    791.93f,    579.99f,    778.22f) },
+    { simde_mm256_set_ps(    96.26f,   -959.38f,    583.83f,   -880.02f,
+                            435.81f,   -833.36f,    103.47f,   -944.87f),
+      simde_mm256_set_ps(   457.41f,   -287.23f,    -24.73f,    321.69f,
+                            -28.19f,   -963.04f,     16.89f,   -181.94f),
+      simde_mm256_set_ps(   457.41f,   -287.23f,    583.83f,    321.69f,
+                            435.81f,   -833.36f,    103.47f,   -181.94f) },
+    { simde_mm256_set_ps(   825.91f,    915.76f,    735.16f,   -255.29f,
+                            421.87f,    960.98f,   -245.60f,   -955.03f),
+      simde_mm256_set_ps(   450.80f,    575.44f,   -409.84f,   -665.93f,
+                            375.33f,   -323.61f,    186.23f,   -939.05f),
+      simde_mm256_set_ps(   825.91f,    915.76f,    735.16f,   -255.29f,
+                            421.87f,    960.98f,    186.23f,   -939.05f) },
+    { simde_mm256_set_ps(  -142.88f,    934.66f,      2.86f,    523.21f,
+                            805.44f,   -785.95f,    647.52f,   -158.25f),
+      simde_mm256_set_ps(   608.25f,   -354.20f,    371.67f,    663.14f,
+                           -604.64f,   -286.84f,   -712.08f,    335.96f),
+      simde_mm256_set_ps(   608.25f,    934.66f,    371.67f,    663.14f,
+                            805.44f,   -286.84f,    647.52f,    335.96f) },
+    { simde_mm256_set_ps(   601.47f,   -970.23f,   -308.25f,    553.99f,
+                           -310.73f,    -40.14f,    633.04f,    697.01f),
+      simde_mm256_set_ps(  -782.25f,    958.58f,    778.76f,    887.89f,
+                           -601.75f,   -402.92f,     39.92f,    749.63f),
+      simde_mm256_set_ps(   601.47f,    958.58f,    778.76f,    887.89f,
+                           -310.73f,    -40.14f,    633.04f,    749.63f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_max_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   340.57,   -156.66,   -283.30,     39.66),
+      simde_mm256_set_pd(  -396.49,    914.84,    -51.84,    986.15),
+      simde_mm256_set_pd(  -396.49,   -156.66,   -283.30,     39.66) },
+    { simde_mm256_set_pd(  -855.14,   -933.06,   -815.97,    651.70),
+      simde_mm256_set_pd(   442.72,    289.17,    522.37,    653.68),
+      simde_mm256_set_pd(  -855.14,   -933.06,   -815.97,    651.70) },
+    { simde_mm256_set_pd(   995.17,   -166.42,    431.12,    257.81),
+      simde_mm256_set_pd(   123.26,    145.48,    439.02,   -775.90),
+      simde_mm256_set_pd(   123.26,   -166.42,    431.12,   -775.90) },
+    { simde_mm256_set_pd(  -423.23,   -918.00,    853.72,   -949.48),
+      simde_mm256_set_pd(  -283.81,    576.78,    777.11,     54.08),
+      simde_mm256_set_pd(  -423.23,   -918.00,    777.11,   -949.48) },
+    { simde_mm256_set_pd(    94.73,   -501.32,    -98.75,     56.36),
+      simde_mm256_set_pd(   466.82,    818.41,   -747.49,   -256.20),
+      simde_mm256_set_pd(    94.73,   -501.32,   -747.49,   -256.20) },
+    { simde_mm256_set_pd(  -499.33,   -546.11,   -324.07,    -73.67),
+      simde_mm256_set_pd(   456.58,   -474.02,    574.53,   -422.81),
+      simde_mm256_set_pd(  -499.33,   -546.11,   -324.07,   -422.81) },
+    { simde_mm256_set_pd(   -21.91,     26.49,   -280.08,    146.49),
+      simde_mm256_set_pd(  -709.06,   -764.23,   -525.18,    647.58),
+      simde_mm256_set_pd(  -709.06,   -764.23,   -525.18,    146.49) },
+    { simde_mm256_set_pd(   907.79,   -922.29,    177.27,   -338.05),
+      simde_mm256_set_pd(  -893.07,   -597.23,    -42.54,    828.07),
+      simde_mm256_set_pd(  -893.07,   -922.29,    -42.54,   -338.05) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_min_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   185.89f,    888.93f,    -96.56f,    468.09f,
+                            898.42f,    835.11f,   -982.23f,   -677.24f),
+      simde_mm256_set_ps(   845.26f,   -869.90f,    154.17f,   -639.42f,
+                           -341.04f,   -405.30f,    172.23f,   -120.67f),
+      simde_mm256_set_ps(   185.89f,   -869.90f,    -96.56f,   -639.42f,
+                           -341.04f,   -405.30f,   -982.23f,   -677.24f) },
+    { simde_mm256_set_ps(   298.35f,    537.69f,    561.54f,   -328.65f,
+                            602.47f,    245.59f,    980.21f,   -625.53f),
+      simde_mm256_set_ps(   168.69f,    134.29f,    138.13f,    496.62f,
+                           -831.93f,   -184.12f,    387.72f,    808.03f),
+      simde_mm256_set_ps(   168.69f,    134.29f,    138.13f,   -328.65f,
+                           -831.93f,   -184.12f,    387.72f,   -625.53f) },
+    { simde_mm256_set_ps(   -26.49f,     -2.08f,    -23.93f,    528.93f,
+                            130.39f,   -695.70f,    390.73f,   -302.96f),
+      simde_mm256_set_ps(   863.53f,   -323.61f,    789.33f,    -72.21f,
+                           -941.85f,    -59.72f,   -347.22f,    928.31f),
+      simde_mm256_set_ps(   -26.49f,   -323.61f,    -23.93f,    -72.21f,
+                           -941.85f,   -695.70f,   -347.22f,   -302.96f) },
+    { simde_mm256_set_ps(  -228.42f,    281.97f,    696.51f,   -247.77f,
+                           -409.59f,    521.39f,   -847.30f,   -572.37f),
+      simde_mm256_set_ps(   753.92f,    807.87f,    961.81f,   -297.53f,
+                           -887.93f,   -239.33f,    695.86f,   -856.96f),
+      simde_mm256_set_ps(  -228.42f,    281.97f,    696.51f,   -297.53f,
+                           -887.93f,   -239.33f,   -847.30f,   -856.96f) },
+    { simde_mm256_set_ps(   868.71f,   -912.67f,      8.63f,   -946.12f,
+                            526.56f,     -5.42f,    725.75f,    513.44f),
+      simde_mm256_set_ps(   685.36f,   -128.82f,    955.84f,    -19.74f,
+                            760.95f,    597.57f,    -48.52f,    718.46f),
+      simde_mm256_set_ps(   685.36f,   -912.67f,      8.63f,   -946.12f,
+                            526.56f,     -5.42f,    -48.52f,    513.44f) },
+    { simde_mm256_set_ps(  -720.32f,    677.03f,   -261.95f,    712.36f,
+                            302.70f,    218.89f,   -803.44f,    171.39f),
+      simde_mm256_set_ps(   611.26f,    996.84f,   -446.97f,    610.54f,
+                           -198.69f,   -373.64f,    358.81f,   -884.83f),
+      simde_mm256_set_ps(  -720.32f,    677.03f,   -446.97f,    610.54f,
+                           -198.69f,   -373.64f,   -803.44f,   -884.83f) },
+    { simde_mm256_set_ps(   632.15f,    380.84f,   -749.11f,   -153.35f,
+                           -691.29f,   -422.37f,   -413.21f,   -849.67f),
+      simde_mm256_set_ps(    -7.14f,    472.75f,   -187.61f,   -325.09f,
+                           -167.75f,   -129.45f,   -739.37f,    429.63f),
+      simde_mm256_set_ps(    -7.14f,    380.84f,   -749.11f,   -325.09f,
+                           -691.29f,   -422.37f,   -739.37f,   -849.67f) },
+    { simde_mm256_set_ps(  -938.63f,   -239.22f,   -180.13f,   -718.99f,
+                           -280.11f,    853.01f,   -126.60f,    929.46f),
+      simde_mm256_set_ps(   -99.94f,   -761.92f,    455.42f,   -272.65f,
+                             33.59f,    290.58f,    553.96f,   -652.36f),
+      simde_mm256_set_ps(  -938.63f,   -761.92f,   -180.13f,   -718.99f,
+                           -280.11f,    290.58f,   -126.60f,   -652.36f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_min_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_movemask_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    int r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(  -890.48,   -911.80,    162.19,    668.67),
+      12 },
+    { simde_mm256_set_pd(   364.74,     76.01,    659.83,    815.30),
+      0 },
+    { simde_mm256_set_pd(   645.19,    389.76,   -241.77,    137.60),
+      2 },
+    { simde_mm256_set_pd(   958.49,    781.49,   -914.79,    946.60),
+      2 },
+    { simde_mm256_set_pd(   937.63,    593.11,    679.40,      2.28),
+      0 },
+    { simde_mm256_set_pd(   337.55,    407.30,    728.58,   -762.36),
+      1 },
+    { simde_mm256_set_pd(  -871.11,   -254.58,    -21.47,   -342.46),
+      15 },
+    { simde_mm256_set_pd(  -871.85,    172.62,    158.74,   -973.21),
+      9 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm256_movemask_pd(test_vec[i].a);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_movemask_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    int r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   821.48f,    156.61f,    465.60f,   -960.67f,
+                            117.36f,    681.71f,   -518.91f,   -274.10f),
+      19 },
+    { simde_mm256_set_ps(  -365.97f,   -210.72f,   -239.16f,    226.38f,
+                           -988.70f,    548.22f,   -661.12f,    963.69f),
+      234 },
+    { simde_mm256_set_ps(   914.12f,   -795.64f,    975.06f,   -902.27f,
+                           -199.71f,    359.44f,    756.08f,   -272.66f),
+      89 },
+    { simde_mm256_set_ps(    13.36f,   -536.30f,    352.25f,    355.32f,
+                            187.80f,   -699.06f,   -740.48f,    734.70f),
+      70 },
+    { simde_mm256_set_ps(   -76.12f,   -393.25f,    437.86f,   -498.19f,
+                            -46.17f,    563.94f,     76.64f,   -244.77f),
+      217 },
+    { simde_mm256_set_ps(  -463.72f,    634.54f,    959.19f,    855.18f,
+                           -528.92f,    622.11f,   -830.06f,    946.66f),
+      138 },
+    { simde_mm256_set_ps(   245.55f,    765.11f,   -743.32f,    506.81f,
+                           -975.73f,    950.91f,   -637.10f,   -775.66f),
+      43 },
+    { simde_mm256_set_ps(    22.51f,   -134.45f,    722.70f,    100.66f,
+                            391.37f,    900.97f,   -687.47f,   -624.80f),
+      67 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm256_movemask_ps(test_vec[i].a);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mul_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(    78.86,      2.61,    -68.57,     81.17),
+      simde_mm256_set_pd(   -17.98,    -82.54,      9.21,     74.23),
+      simde_mm256_set_pd( -1417.90,   -215.43,   -631.53,   6025.25) },
+    { simde_mm256_set_pd(   -72.04,    -15.72,    -99.74,    -42.75),
+      simde_mm256_set_pd(   -34.40,    -26.02,    -91.27,     85.85),
+      simde_mm256_set_pd(  2478.18,    409.03,   9103.27,  -3670.09) },
+    { simde_mm256_set_pd(    74.08,     25.32,     77.71,     -1.95),
+      simde_mm256_set_pd(   -99.94,    -57.81,    -62.90,     71.95),
+      simde_mm256_set_pd( -7403.56,  -1463.75,  -4887.96,   -140.30) },
+    { simde_mm256_set_pd(    71.14,     21.28,      0.30,    -99.39),
+      simde_mm256_set_pd(    81.71,     82.50,     59.60,     74.40),
+      simde_mm256_set_pd(  5812.85,   1755.60,     17.88,  -7394.62) },
+    { simde_mm256_set_pd(    53.93,     69.48,     18.49,    -33.09),
+      simde_mm256_set_pd(    36.07,     12.07,     61.32,    -94.14),
+      simde_mm256_set_pd(  1945.26,    838.62,   1133.81,   3115.09) },
+    { simde_mm256_set_pd(    27.80,    -91.63,     40.54,     82.89),
+      simde_mm256_set_pd(   -44.81,     21.38,    -84.61,     88.57),
+      simde_mm256_set_pd( -1245.72,  -1959.05,  -3430.09,   7341.57) },
+    { simde_mm256_set_pd(    63.68,    -48.75,      9.83,     86.93),
+      simde_mm256_set_pd(   -75.32,     -6.92,     82.79,     30.07),
+      simde_mm256_set_pd( -4796.38,    337.35,    813.83,   2613.99) },
+    { simde_mm256_set_pd(   -82.04,     85.99,    -61.92,    -68.47),
+      simde_mm256_set_pd(   -49.13,     -2.61,    -70.28,    -40.18),
+      simde_mm256_set_pd(  4030.63,   -224.43,   4351.74,   2751.12) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_mul_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mul_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(    45.77f,    -97.96f,    -41.45f,     65.38f,
+                              2.43f,    -59.23f,     12.94f,     57.23f),
+      simde_mm256_set_ps(    59.49f,    -19.01f,    -98.85f,     98.57f,
+                             74.35f,    -27.49f,     85.82f,     74.54f),
+      simde_mm256_set_ps(  2722.86f,   1862.22f,   4097.33f,   6444.51f,
+                            180.67f,   1628.23f,   1110.51f,   4265.92f) },
+    { simde_mm256_set_ps(    84.64f,     95.53f,    -81.45f,     14.48f,
+                            -25.67f,     86.45f,     18.97f,     78.25f),
+      simde_mm256_set_ps(     2.00f,     69.40f,    -51.56f,    -15.81f,
+                             13.95f,    -37.64f,     98.40f,     71.67f),
+      simde_mm256_set_ps(   169.28f,   6629.78f,   4199.56f,   -228.93f,
+                           -358.10f,  -3253.98f,   1866.65f,   5608.18f) },
+    { simde_mm256_set_ps(    35.64f,      8.98f,     85.54f,     97.88f,
+                             65.27f,     17.35f,      1.41f,     46.55f),
+      simde_mm256_set_ps(   -98.80f,    -15.03f,     80.46f,    -54.50f,
+                             67.37f,     38.74f,     34.98f,    -67.24f),
+      simde_mm256_set_ps( -3521.23f,   -134.97f,   6882.55f,  -5334.46f,
+                           4397.24f,    672.14f,     49.32f,  -3130.02f) },
+    { simde_mm256_set_ps(   -81.84f,    -81.18f,    -57.54f,    -70.09f,
+                             32.57f,      6.71f,    -94.65f,    -21.70f),
+      simde_mm256_set_ps(   -25.97f,     82.93f,    -34.06f,    -40.52f,
+                            -99.03f,    -99.15f,    -30.70f,     -3.89f),
+      simde_mm256_set_ps(  2125.38f,  -6732.26f,   1959.81f,   2840.05f,
+                          -3225.41f,   -665.30f,   2905.76f,     84.41f) },
+    { simde_mm256_set_ps(    50.91f,    -12.51f,    -69.79f,     38.98f,
+                             47.43f,     29.00f,    -59.47f,    -28.66f),
+      simde_mm256_set_ps(    43.57f,     24.99f,    -60.81f,    -20.24f,
+                             78.64f,     95.71f,      1.55f,     50.68f),
+      simde_mm256_set_ps(  2218.15f,   -312.62f,   4243.93f,   -788.96f,
+                           3729.90f,   2775.59f,    -92.18f,  -1452.49f) },
+    { simde_mm256_set_ps(   -41.40f,    -35.88f,     80.34f,     75.52f,
+                             43.02f,     59.83f,     73.39f,    -14.04f),
+      simde_mm256_set_ps(    89.70f,      2.36f,    -48.64f,     61.60f,
+                            -61.98f,     -5.02f,    -81.17f,    -28.22f),
+      simde_mm256_set_ps( -3713.58f,    -84.68f,  -3907.74f,   4652.03f,
+                          -2666.38f,   -300.35f,  -5957.07f,    396.21f) },
+    { simde_mm256_set_ps(    -1.30f,    -16.38f,     76.27f,    -91.59f,
+                             18.03f,    -47.84f,     72.24f,    -24.80f),
+      simde_mm256_set_ps(   -21.34f,    -57.63f,    -49.98f,     96.11f,
+                             16.93f,      6.16f,     -8.53f,    -70.52f),
+      simde_mm256_set_ps(    27.74f,    943.98f,  -3811.97f,  -8802.71f,
+                            305.25f,   -294.69f,   -616.21f,   1748.90f) },
+    { simde_mm256_set_ps(   -87.42f,    -41.42f,     79.94f,    -55.51f,
+                             47.57f,     43.47f,     81.91f,      7.30f),
+      simde_mm256_set_ps(   -21.18f,     64.74f,     -9.69f,     98.45f,
+                            -64.63f,     21.80f,    -58.25f,     26.65f),
+      simde_mm256_set_ps(  1851.56f,  -2681.53f,   -774.62f,  -5464.96f,
+                          -3074.45f,    947.65f,  -4771.26f,    194.54f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_mul_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_or_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 9174076822222071176), INT64_C( 1146275231172378799),
+                             INT64_C(  799247603641064379), INT64_C( 7875324206031752531)),
+      simde_mm256_set_epi64x(INT64_C(-1960886654577924403), INT64_C( 2568287924899366311),
+                             INT64_C(-2320432071191296749), INT64_C( 4159866668411149476)),
+      simde_mm256_set_epi64x(INT64_C(  -10731252953585715), INT64_C( 3453248813284705711),
+                             INT64_C(-2314991530076823621), INT64_C( 9077802967984168439)) },
+    { simde_mm256_set_epi64x(INT64_C(-7164449666514439698), INT64_C(-5189901824162931981),
+                             INT64_C(-7363887530638353325), INT64_C(-4585637755591338280)),
+      simde_mm256_set_epi64x(INT64_C(-3460835011996087905), INT64_C( 7525437095324996868),
+                             INT64_C(-8555852692536965069), INT64_C( 5806669729113138730)),
+      simde_mm256_set_epi64x(INT64_C(-2307277885918037505), INT64_C(      -4484214431753),
+                             INT64_C(-7363465315950273421), INT64_C(-3396294816603048198)) },
+    { simde_mm256_set_epi64x(INT64_C(-6954577730723597119), INT64_C( 6283941803564046548),
+                             INT64_C( 4441188653239636074), INT64_C( 4488941611403565307)),
+      simde_mm256_set_epi64x(INT64_C(-3992344035504466778), INT64_C( 1286863375196357294),
+                             INT64_C( 7649728281413368083), INT64_C(-6081850673603433756)),
+      simde_mm256_set_epi64x(INT64_C(-2306836526954449689), INT64_C( 6341028624194050814),
+                             INT64_C( 9199534486151182715), INT64_C(-4621839330779989249)) },
+    { simde_mm256_set_epi64x(INT64_C( 3887846346589517805), INT64_C(  912911467001301608),
+                             INT64_C(-2578163458868618678), INT64_C( 6429688812190471989)),
+      simde_mm256_set_epi64x(INT64_C( 3578290062143197737), INT64_C( -754754313665252621),
+                             INT64_C(-5483848698731918415), INT64_C(-9105880097342730921)),
+      simde_mm256_set_epi64x(INT64_C( 3890239262118885357), INT64_C( -166682700776736005),
+                             INT64_C(    -573945350792197), INT64_C(-2757328958176436361)) },
+    { simde_mm256_set_epi64x(INT64_C(  998383938503017045), INT64_C(-1811360079359879358),
+                             INT64_C(-8690054584233781173), INT64_C( -483246530276006530)),
+      simde_mm256_set_epi64x(INT64_C( 7240901318594084029), INT64_C(  736841014546753353),
+                             INT64_C(-7173479290020694409), INT64_C(-2021178779961265753)),
+      simde_mm256_set_epi64x(INT64_C( 7926047167569837821), INT64_C(-1225601422226131125),
+                             INT64_C(-6956161502890033537), INT64_C( -289499350009252353)) },
+    { simde_mm256_set_epi64x(INT64_C( 6698537634285662481), INT64_C(-4917424482665765905),
+                             INT64_C(-7704020453963525474), INT64_C( 1690263302396896542)),
+      simde_mm256_set_epi64x(INT64_C(-1068033669511674775), INT64_C(-4128290074361762317),
+                             INT64_C( 8891227181538390479), INT64_C( 2350013965882648585)),
+      simde_mm256_set_epi64x(INT64_C( -144680895687707271), INT64_C(   -2851596830117889),
+                             INT64_C(  -38282555338935329), INT64_C( 4034642271117700383)) },
+    { simde_mm256_set_epi64x(INT64_C( 8248316572108700941), INT64_C(-8586250742674291671),
+                             INT64_C( 6602989750183654588), INT64_C( 4168618465848635219)),
+      simde_mm256_set_epi64x(INT64_C(  169917920867141196), INT64_C(-8132286831039867566),
+                             INT64_C( 6845092169184055036), INT64_C( 4586204194694818484)),
+      simde_mm256_set_epi64x(INT64_C( 8250571955540066125), INT64_C(-8072752395232275077),
+                             INT64_C( 6917158765477232380), INT64_C( 4611114730285363191)) },
+    { simde_mm256_set_epi64x(INT64_C( 7079593533497230353), INT64_C( 6046085019888467050),
+                             INT64_C( 7217195864967340973), INT64_C( -675720629650052759)),
+      simde_mm256_set_epi64x(INT64_C(-3531223782532997079), INT64_C(-1417571279134140751),
+                             INT64_C( -150466203406054875), INT64_C(-8306760294403546006)),
+      simde_mm256_set_epi64x(INT64_C(-1225024247475870663), INT64_C(   -1189195252236549),
+                             INT64_C( -150325300082775123), INT64_C(  -90213073636299413)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_or_pd(simde_mm256_castsi256_pd(test_vec[i].a), simde_mm256_castsi256_pd(test_vec[i].b));
+    simde_assert_m256d_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_or_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1521245019,  1710025286,  1117063612, -1739463994,
+                            -1275302859, -1897268267,   770355706,  1758840019),
+      simde_mm256_set_epi32(  502398732, -1886147983,  -601387697, -1845974098,
+                            -1024346447, -1407820826,   609891671, -1650369864),
+      simde_mm256_set_epi32(-1108082771,  -268440969,  -558395905, -1711674386,
+                             -201457995, -1358955529,   771405311,   -34218245) },
+    { simde_mm256_set_epi32(-1035998795,   547614754,   308823182,  -175209021,
+                              784217609, -1233525625,   168517723,   701531994),
+      simde_mm256_set_epi32(-1490550113,   245356719, -1124699977,   847768511,
+                              -10360787, -1260078602,  1560851003,  -903868606),
+      simde_mm256_set_epi32( -415241281,   784332975, -1090620225,  -141561857,
+                                   -467, -1224868361,  1594618491,  -336556198) },
+    { simde_mm256_set_epi32(-1376712711, -1422030660, -1451699317,   966385669,
+                             -199132678,  -193096358,  1872163111, -1967812530),
+      simde_mm256_set_epi32(  386699311,  -547329959,   598135894,  -302430389,
+                             1024057333,  1086462064, -1247208517,    76626283),
+      simde_mm256_set_epi32(-1073899521,    -8525571, -1409361953,   -33953969,
+                              -47579137,  -184574598,    -4195393, -1900693137) },
+    { simde_mm256_set_epi32( 1890103850,  -764045856,   743099355,  1475149665,
+                            -1530382371,   976477870, -1874833365,   441249230),
+      simde_mm256_set_epi32(  319830139,   887578584,   966747192,  1637630311,
+                            -1208917749, -1321539690,  -125200516,   645117416),
+      simde_mm256_set_epi32( 1941486203,  -151527432,  1038086139,  2013069159,
+                            -1208387617, -1153695810,  -120989825,  1048575470) },
+    { simde_mm256_set_epi32(-1749055774,   957373254,  1095499719,  -485426413,
+                              352297577,  1419714114,  -860712972,   281320817),
+      simde_mm256_set_epi32(-1946187176,   266500871,    27076093, -2071162058,
+                            -2048404626,   737948932,  -401709157, -1935102674),
+      simde_mm256_set_epi32(-1610641670,  1072855879,  1105199103,  -409142473,
+                            -1778388113,  2147434310,  -323031041, -1662206593) },
+    { simde_mm256_set_epi32( 1393297030,  -745438435,   698266920,  -786678650,
+                             1167132169,   480781145,  -350423575, -1277293496),
+      simde_mm256_set_epi32(  410944594,  1468796572, -1666186055,  -496869674,
+                              495913260,  -908866130,  1422304599,  1091072580),
+      simde_mm256_set_epi32( 1535018710,  -677539939, -1111575111,  -209813802,
+                             1570705197,  -570691585,    -2165249,  -203522484) },
+    { simde_mm256_set_epi32( 1383252300, -2103484662, -1544270599,  1134159713,
+                             1860330764,   275348005,   270556777,   390023434),
+      simde_mm256_set_epi32(  768042720,  -968323784, -1351523691, -1299550173,
+                             1711895905,   517892253,  1529196490,   294325445),
+      simde_mm256_set_epi32( 2146953196,  -958406854, -1342869763,  -207882397,
+                             1860924781,   520059581,  1529217003,   398413263) },
+    { simde_mm256_set_epi32( -444061427,  1413604512, -1034815891,  -733401106,
+                             -686576687,  -513428216, -1120279976,   245312201),
+      simde_mm256_set_epi32(-1046747205, -1258125464,  -231852408,  1937736942,
+                              917503816, -1233647910, -1105693070,   384771206),
+      simde_mm256_set_epi32( -442765377,  -180099096,  -226494739,  -142626834,
+                             -138412071,  -142755878, -1086720390,   520040143) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_or_ps(simde_mm256_castsi256_ps(test_vec[i].a), simde_mm256_castsi256_ps(test_vec[i].b));
+    simde_assert_m256_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_permute2f128_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r0x21;
+    simde__m256 r0x83;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   767.68f,     17.63f,   -979.38f,   -481.21f,
+                            676.00f,    390.40f,    330.36f,   -810.99f),
+      simde_mm256_set_ps(    15.82f,    116.89f,   -379.93f,   -821.33f,
+                            476.58f,   -563.75f,    533.20f,   -128.34f),
+      simde_mm256_set_ps(   476.58f,   -563.75f,    533.20f,   -128.34f,
+                            767.68f,     17.63f,   -979.38f,   -481.21f),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,      0.00f,
+                             15.82f,    116.89f,   -379.93f,   -821.33f) },
+    { simde_mm256_set_ps(  -700.04f,   -532.56f,   -627.48f,   -137.07f,
+                            226.25f,    147.45f,   -130.77f,    609.12f),
+      simde_mm256_set_ps(    17.23f,   -376.14f,    913.99f,    755.91f,
+                           -517.61f,   -489.79f,   -122.15f,    278.73f),
+      simde_mm256_set_ps(  -517.61f,   -489.79f,   -122.15f,    278.73f,
+                           -700.04f,   -532.56f,   -627.48f,   -137.07f),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,      0.00f,
+                             17.23f,   -376.14f,    913.99f,    755.91f) },
+    { simde_mm256_set_ps(  -646.14f,   -173.67f,    765.69f,    -65.39f,
+                            234.80f,    169.67f,   -881.03f,     31.46f),
+      simde_mm256_set_ps(  -472.80f,   -738.43f,    441.34f,   -531.15f,
+                            253.40f,   -175.49f,   -714.69f,    858.66f),
+      simde_mm256_set_ps(   253.40f,   -175.49f,   -714.69f,    858.66f,
+                           -646.14f,   -173.67f,    765.69f,    -65.39f),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,      0.00f,
+                           -472.80f,   -738.43f,    441.34f,   -531.15f) },
+    { simde_mm256_set_ps(  -627.01f,    643.48f,    493.27f,    240.55f,
+                           -195.70f,    970.29f,   -339.17f,   -822.68f),
+      simde_mm256_set_ps(  -925.08f,   -894.28f,    738.70f,    845.44f,
+                           -849.60f,   -771.40f,    -11.80f,    574.27f),
+      simde_mm256_set_ps(  -849.60f,   -771.40f,    -11.80f,    574.27f,
+                           -627.01f,    643.48f,    493.27f,    240.55f),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,      0.00f,
+                           -925.08f,   -894.28f,    738.70f,    845.44f) },
+    { simde_mm256_set_ps(  -505.84f,    352.02f,   -943.07f,     33.48f,
+                            719.39f,   -797.81f,    390.30f,   -264.77f),
+      simde_mm256_set_ps(  -524.15f,    975.48f,    747.72f,   -691.91f,
+                            496.04f,   -828.56f,   -956.80f,   -850.14f),
+      simde_mm256_set_ps(   496.04f,   -828.56f,   -956.80f,   -850.14f,
+                           -505.84f,    352.02f,   -943.07f,     33.48f),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,      0.00f,
+                           -524.15f,    975.48f,    747.72f,   -691.91f) },
+    { simde_mm256_set_ps(   178.73f,   -245.62f,    387.36f,   -634.91f,
+                            446.22f,   -240.63f,   -129.20f,    962.47f),
+      simde_mm256_set_ps(   523.61f,     26.38f,    751.77f,   -531.50f,
+                            564.76f,   -289.62f,    948.79f,   -391.32f),
+      simde_mm256_set_ps(   564.76f,   -289.62f,    948.79f,   -391.32f,
+                            178.73f,   -245.62f,    387.36f,   -634.91f),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,      0.00f,
+                            523.61f,     26.38f,    751.77f,   -531.50f) },
+    { simde_mm256_set_ps(   666.74f,   -179.02f,   -207.00f,   -169.03f,
+                            500.60f,   -421.01f,   -295.86f,   -508.42f),
+      simde_mm256_set_ps(   830.38f,   -189.78f,   -237.56f,   -152.21f,
+                           -665.75f,    655.59f,    335.52f,    921.23f),
+      simde_mm256_set_ps(  -665.75f,    655.59f,    335.52f,    921.23f,
+                            666.74f,   -179.02f,   -207.00f,   -169.03f),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,      0.00f,
+                            830.38f,   -189.78f,   -237.56f,   -152.21f) },
+    { simde_mm256_set_ps(    24.46f,    968.31f,   -435.52f,    456.30f,
+                           -991.87f,    687.59f,    848.45f,   -841.16f),
+      simde_mm256_set_ps(  -870.26f,     25.99f,    488.30f,   -792.20f,
+                           -459.32f,   -158.39f,    682.65f,    950.53f),
+      simde_mm256_set_ps(  -459.32f,   -158.39f,    682.65f,    950.53f,
+                             24.46f,    968.31f,   -435.52f,    456.30f),
+      simde_mm256_set_ps(     0.00f,      0.00f,      0.00f,      0.00f,
+                           -870.26f,     25.99f,    488.30f,   -792.20f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r;
+
+    r = simde_mm256_permute2f128_ps(test_vec[i].a, test_vec[i].b, 0x21);
+    simde_assert_m256_f32_equal(r, test_vec[i].r0x21, 1);
+    r = simde_mm256_permute2f128_ps(test_vec[i].a, test_vec[i].b, 0x83);
+    simde_assert_m256_f32_equal(r, test_vec[i].r0x83, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_permute_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d r5;
+    simde__m256d r10;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(  -632.37,   -335.82,    819.21,   -155.82),
+      simde_mm256_set_pd(  -335.82,   -632.37,   -155.82,    819.21),
+      simde_mm256_set_pd(  -632.37,   -335.82,    819.21,   -155.82) },
+    { simde_mm256_set_pd(  -751.06,   -848.33,    598.13,    -77.84),
+      simde_mm256_set_pd(  -848.33,   -751.06,    -77.84,    598.13),
+      simde_mm256_set_pd(  -751.06,   -848.33,    598.13,    -77.84) },
+    { simde_mm256_set_pd(  -919.54,   -498.53,   -124.15,   -770.95),
+      simde_mm256_set_pd(  -498.53,   -919.54,   -770.95,   -124.15),
+      simde_mm256_set_pd(  -919.54,   -498.53,   -124.15,   -770.95) },
+    { simde_mm256_set_pd(   173.47,    900.64,   -134.58,    668.40),
+      simde_mm256_set_pd(   900.64,    173.47,    668.40,   -134.58),
+      simde_mm256_set_pd(   173.47,    900.64,   -134.58,    668.40) },
+    { simde_mm256_set_pd(   287.37,    368.37,    708.36,   -922.76),
+      simde_mm256_set_pd(   368.37,    287.37,   -922.76,    708.36),
+      simde_mm256_set_pd(   287.37,    368.37,    708.36,   -922.76) },
+    { simde_mm256_set_pd(  -385.26,    461.94,    155.84,   -719.44),
+      simde_mm256_set_pd(   461.94,   -385.26,   -719.44,    155.84),
+      simde_mm256_set_pd(  -385.26,    461.94,    155.84,   -719.44) },
+    { simde_mm256_set_pd(  -412.24,   -824.29,    -89.68,   -930.36),
+      simde_mm256_set_pd(  -824.29,   -412.24,   -930.36,    -89.68),
+      simde_mm256_set_pd(  -412.24,   -824.29,    -89.68,   -930.36) },
+    { simde_mm256_set_pd(  -621.31,   -405.72,   -814.69,   -828.06),
+      simde_mm256_set_pd(  -405.72,   -621.31,   -828.06,   -814.69),
+      simde_mm256_set_pd(  -621.31,   -405.72,   -814.69,   -828.06) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r;
+
+    r = simde_mm256_permute_pd(test_vec[i].a, 5);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r5, 1);
+    r = simde_mm256_permute_pd(test_vec[i].a, 10);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r10, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_permute_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 r27;
+    simde__m256 r177;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   945.60f,   -288.98f,    803.27f,    267.49f,
+                           -293.56f,   -999.19f,   -785.28f,    115.48f),
+      simde_mm256_set_ps(   267.49f,    803.27f,   -288.98f,    945.60f,
+                            115.48f,   -785.28f,   -999.19f,   -293.56f),
+      simde_mm256_set_ps(  -288.98f,    945.60f,    267.49f,    803.27f,
+                           -999.19f,   -293.56f,    115.48f,   -785.28f) },
+    { simde_mm256_set_ps(   769.91f,   -651.09f,    -35.00f,    888.28f,
+                            572.10f,   -577.44f,   -508.43f,    278.72f),
+      simde_mm256_set_ps(   888.28f,    -35.00f,   -651.09f,    769.91f,
+                            278.72f,   -508.43f,   -577.44f,    572.10f),
+      simde_mm256_set_ps(  -651.09f,    769.91f,    888.28f,    -35.00f,
+                           -577.44f,    572.10f,    278.72f,   -508.43f) },
+    { simde_mm256_set_ps(  -697.09f,    158.94f,   -298.91f,   -174.23f,
+                            796.36f,   -614.94f,    925.79f,   -406.78f),
+      simde_mm256_set_ps(  -174.23f,   -298.91f,    158.94f,   -697.09f,
+                           -406.78f,    925.79f,   -614.94f,    796.36f),
+      simde_mm256_set_ps(   158.94f,   -697.09f,   -174.23f,   -298.91f,
+                           -614.94f,    796.36f,   -406.78f,    925.79f) },
+    { simde_mm256_set_ps(  -701.66f,    336.36f,    827.50f,    852.17f,
+                            360.02f,    180.14f,   -635.41f,   -261.01f),
+      simde_mm256_set_ps(   852.17f,    827.50f,    336.36f,   -701.66f,
+                           -261.01f,   -635.41f,    180.14f,    360.02f),
+      simde_mm256_set_ps(   336.36f,   -701.66f,    852.17f,    827.50f,
+                            180.14f,    360.02f,   -261.01f,   -635.41f) },
+    { simde_mm256_set_ps(   -43.86f,    136.15f,    874.11f,    638.40f,
+                           -686.07f,    201.12f,    330.48f,    -34.26f),
+      simde_mm256_set_ps(   638.40f,    874.11f,    136.15f,    -43.86f,
+                            -34.26f,    330.48f,    201.12f,   -686.07f),
+      simde_mm256_set_ps(   136.15f,    -43.86f,    638.40f,    874.11f,
+                            201.12f,   -686.07f,    -34.26f,    330.48f) },
+    { simde_mm256_set_ps(   344.78f,   -879.87f,    686.08f,    -32.18f,
+                           -985.10f,    -49.43f,   -596.38f,    341.18f),
+      simde_mm256_set_ps(   -32.18f,    686.08f,   -879.87f,    344.78f,
+                            341.18f,   -596.38f,    -49.43f,   -985.10f),
+      simde_mm256_set_ps(  -879.87f,    344.78f,    -32.18f,    686.08f,
+                            -49.43f,   -985.10f,    341.18f,   -596.38f) },
+    { simde_mm256_set_ps(  -242.31f,   -768.37f,    496.73f,   -782.13f,
+                            347.13f,   -514.03f,   -260.59f,    810.36f),
+      simde_mm256_set_ps(  -782.13f,    496.73f,   -768.37f,   -242.31f,
+                            810.36f,   -260.59f,   -514.03f,    347.13f),
+      simde_mm256_set_ps(  -768.37f,   -242.31f,   -782.13f,    496.73f,
+                           -514.03f,    347.13f,    810.36f,   -260.59f) },
+    { simde_mm256_set_ps(   538.03f,   -266.15f,    489.35f,    971.26f,
+                            984.84f,   -871.56f,   -218.35f,    -65.51f),
+      simde_mm256_set_ps(   971.26f,    489.35f,   -266.15f,    538.03f,
+                            -65.51f,   -218.35f,   -871.56f,    984.84f),
+      simde_mm256_set_ps(  -266.15f,    538.03f,    971.26f,    489.35f,
+                           -871.56f,    984.84f,    -65.51f,   -218.35f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r;
+
+    r = simde_mm256_permute_ps(test_vec[i].a, 27);
+    simde_assert_m256_f32_equal(r, test_vec[i].r27, 1);
+    r = simde_mm256_permute_ps(test_vec[i].a, 177);
+    simde_assert_m256_f32_equal(r, test_vec[i].r177, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_rcp_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(     4.07f,      4.67f,      8.46f,      9.69f,
+                              4.74f,      5.88f,      2.56f,     10.00f),
+      simde_mm256_set_ps(     0.25f,      0.21f,      0.12f,      0.10f,
+                              0.21f,      0.17f,      0.39f,      0.10f) },
+    { simde_mm256_set_ps(     5.65f,      7.66f,      3.58f,      7.22f,
+                              6.60f,      2.97f,      7.71f,      9.26f),
+      simde_mm256_set_ps(     0.18f,      0.13f,      0.28f,      0.14f,
+                              0.15f,      0.34f,      0.13f,      0.11f) },
+    { simde_mm256_set_ps(     1.12f,      1.72f,      7.04f,      6.97f,
+                              7.34f,      7.80f,      7.00f,      1.98f),
+      simde_mm256_set_ps(     0.89f,      0.58f,      0.14f,      0.14f,
+                              0.14f,      0.13f,      0.14f,      0.51f) },
+    { simde_mm256_set_ps(     3.32f,      8.90f,      6.33f,      3.46f,
+                              4.17f,      5.05f,      5.39f,      6.82f),
+      simde_mm256_set_ps(     0.30f,      0.11f,      0.16f,      0.29f,
+                              0.24f,      0.20f,      0.19f,      0.15f) },
+    { simde_mm256_set_ps(     6.51f,      7.45f,      4.68f,      8.71f,
+                              9.50f,      6.55f,      9.37f,      9.13f),
+      simde_mm256_set_ps(     0.15f,      0.13f,      0.21f,      0.11f,
+                              0.11f,      0.15f,      0.11f,      0.11f) },
+    { simde_mm256_set_ps(     5.82f,      6.57f,      9.92f,      1.65f,
+                              8.22f,      8.66f,      1.26f,      3.86f),
+      simde_mm256_set_ps(     0.17f,      0.15f,      0.10f,      0.61f,
+                              0.12f,      0.12f,      0.79f,      0.26f) },
+    { simde_mm256_set_ps(     1.80f,      9.84f,      9.27f,      5.00f,
+                              9.68f,      2.17f,      6.89f,      6.99f),
+      simde_mm256_set_ps(     0.56f,      0.10f,      0.11f,      0.20f,
+                              0.10f,      0.46f,      0.15f,      0.14f) },
+    { simde_mm256_set_ps(     2.56f,      6.71f,      1.10f,      5.90f,
+                              6.13f,      6.94f,      8.79f,      6.94f),
+      simde_mm256_set_ps(     0.39f,      0.15f,      0.91f,      0.17f,
+                              0.16f,      0.14f,      0.11f,      0.14f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_rcp_ps(test_vec[i].a);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 2);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_round_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d nearest;
+    simde__m256d floor;
+    simde__m256d ceil;
+    simde__m256d trunc;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(    -9.18,     -5.06,     -5.91,      9.71),
+      simde_mm256_set_pd(    -9.00,     -5.00,     -6.00,     10.00),
+      simde_mm256_set_pd(   -10.00,     -6.00,     -6.00,      9.00),
+      simde_mm256_set_pd(    -9.00,     -5.00,     -5.00,     10.00),
+      simde_mm256_set_pd(    -9.00,     -5.00,     -5.00,      9.00) },
+    { simde_mm256_set_pd(     1.43,      7.34,      7.11,     -8.10),
+      simde_mm256_set_pd(     1.00,      7.00,      7.00,     -8.00),
+      simde_mm256_set_pd(     1.00,      7.00,      7.00,     -9.00),
+      simde_mm256_set_pd(     2.00,      8.00,      8.00,     -8.00),
+      simde_mm256_set_pd(     1.00,      7.00,      7.00,     -8.00) },
+    { simde_mm256_set_pd(     5.61,     -1.11,     -3.02,     -2.25),
+      simde_mm256_set_pd(     6.00,     -1.00,     -3.00,     -2.00),
+      simde_mm256_set_pd(     5.00,     -2.00,     -4.00,     -3.00),
+      simde_mm256_set_pd(     6.00,     -1.00,     -3.00,     -2.00),
+      simde_mm256_set_pd(     5.00,     -1.00,     -3.00,     -2.00) },
+    { simde_mm256_set_pd(    -2.47,     -0.50,      4.41,      3.98),
+      simde_mm256_set_pd(    -2.00,     -0.00,      4.00,      4.00),
+      simde_mm256_set_pd(    -3.00,     -1.00,      4.00,      3.00),
+      simde_mm256_set_pd(    -2.00,     -0.00,      5.00,      4.00),
+      simde_mm256_set_pd(    -2.00,     -0.00,      4.00,      3.00) },
+    { simde_mm256_set_pd(    -7.20,      5.76,      1.91,     -7.89),
+      simde_mm256_set_pd(    -7.00,      6.00,      2.00,     -8.00),
+      simde_mm256_set_pd(    -8.00,      5.00,      1.00,     -8.00),
+      simde_mm256_set_pd(    -7.00,      6.00,      2.00,     -7.00),
+      simde_mm256_set_pd(    -7.00,      5.00,      1.00,     -7.00) },
+    { simde_mm256_set_pd(    -2.64,     -5.71,     -0.25,      0.30),
+      simde_mm256_set_pd(    -3.00,     -6.00,     -0.00,      0.00),
+      simde_mm256_set_pd(    -3.00,     -6.00,     -1.00,      0.00),
+      simde_mm256_set_pd(    -2.00,     -5.00,     -0.00,      1.00),
+      simde_mm256_set_pd(    -2.00,     -5.00,     -0.00,      0.00) },
+    { simde_mm256_set_pd(     7.37,     -8.55,     -1.82,      2.09),
+      simde_mm256_set_pd(     7.00,     -9.00,     -2.00,      2.00),
+      simde_mm256_set_pd(     7.00,     -9.00,     -2.00,      2.00),
+      simde_mm256_set_pd(     8.00,     -8.00,     -1.00,      3.00),
+      simde_mm256_set_pd(     7.00,     -8.00,     -1.00,      2.00) },
+    { simde_mm256_set_pd(     6.32,      5.97,      3.91,     -3.33),
+      simde_mm256_set_pd(     6.00,      6.00,      4.00,     -3.00),
+      simde_mm256_set_pd(     6.00,      5.00,      3.00,     -4.00),
+      simde_mm256_set_pd(     7.00,      6.00,      4.00,     -3.00),
+      simde_mm256_set_pd(     6.00,      5.00,      3.00,     -3.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r;
+
+    r = simde_mm256_round_pd(test_vec[i].a, simde_MM_FROUND_TO_NEAREST_INT);
+    simde_assert_m256d_f64_equal(r, test_vec[i].nearest, 1);
+    r = simde_mm256_round_pd(test_vec[i].a, simde_MM_FROUND_TO_NEG_INF);
+    simde_assert_m256d_f64_equal(r, test_vec[i].floor, 1);
+    r = simde_mm256_round_pd(test_vec[i].a, simde_MM_FROUND_TO_POS_INF);
+    simde_assert_m256d_f64_equal(r, test_vec[i].ceil, 1);
+    r = simde_mm256_round_pd(test_vec[i].a, simde_MM_FROUND_TO_ZERO);
+    simde_assert_m256d_f64_equal(r, test_vec[i].trunc, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_round_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 nearest;
+    simde__m256 floor;
+    simde__m256 ceil;
+    simde__m256 trunc;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(     3.06f,     -6.75f,     -8.69f,     -9.25f,
+                             -8.85f,     -3.30f,     -6.43f,     -9.57f),
+      simde_mm256_set_ps(     3.00f,     -7.00f,     -9.00f,     -9.00f,
+                             -9.00f,     -3.00f,     -6.00f,    -10.00f),
+      simde_mm256_set_ps(     3.00f,     -7.00f,     -9.00f,    -10.00f,
+                             -9.00f,     -4.00f,     -7.00f,    -10.00f),
+      simde_mm256_set_ps(     4.00f,     -6.00f,     -8.00f,     -9.00f,
+                             -8.00f,     -3.00f,     -6.00f,     -9.00f),
+      simde_mm256_set_ps(     3.00f,     -6.00f,     -8.00f,     -9.00f,
+                             -8.00f,     -3.00f,     -6.00f,     -9.00f) },
+    { simde_mm256_set_ps(     3.20f,     -8.27f,      9.62f,      9.35f,
+                             -3.14f,      9.98f,      2.71f,      5.99f),
+      simde_mm256_set_ps(     3.00f,     -8.00f,     10.00f,      9.00f,
+                             -3.00f,     10.00f,      3.00f,      6.00f),
+      simde_mm256_set_ps(     3.00f,     -9.00f,      9.00f,      9.00f,
+                             -4.00f,      9.00f,      2.00f,      5.00f),
+      simde_mm256_set_ps(     4.00f,     -8.00f,     10.00f,     10.00f,
+                             -3.00f,     10.00f,      3.00f,      6.00f),
+      simde_mm256_set_ps(     3.00f,     -8.00f,      9.00f,      9.00f,
+                             -3.00f,      9.00f,      2.00f,      5.00f) },
+    { simde_mm256_set_ps(    -7.27f,     -7.03f,     -8.12f,      0.71f,
+                              3.09f,      9.92f,     -9.51f,      6.13f),
+      simde_mm256_set_ps(    -7.00f,     -7.00f,     -8.00f,      1.00f,
+                              3.00f,     10.00f,    -10.00f,      6.00f),
+      simde_mm256_set_ps(    -8.00f,     -8.00f,     -9.00f,      0.00f,
+                              3.00f,      9.00f,    -10.00f,      6.00f),
+      simde_mm256_set_ps(    -7.00f,     -7.00f,     -8.00f,      1.00f,
+                              4.00f,     10.00f,     -9.00f,      7.00f),
+      simde_mm256_set_ps(    -7.00f,     -7.00f,     -8.00f,      0.00f,
+                              3.00f,      9.00f,     -9.00f,      6.00f) },
+    { simde_mm256_set_ps(     7.37f,      8.35f,     -8.45f,     -6.03f,
+                              0.98f,      4.92f,      9.63f,     -0.40f),
+      simde_mm256_set_ps(     7.00f,      8.00f,     -8.00f,     -6.00f,
+                              1.00f,      5.00f,     10.00f,     -0.00f),
+      simde_mm256_set_ps(     7.00f,      8.00f,     -9.00f,     -7.00f,
+                              0.00f,      4.00f,      9.00f,     -1.00f),
+      simde_mm256_set_ps(     8.00f,      9.00f,     -8.00f,     -6.00f,
+                              1.00f,      5.00f,     10.00f,     -0.00f),
+      simde_mm256_set_ps(     7.00f,      8.00f,     -8.00f,     -6.00f,
+                              0.00f,      4.00f,      9.00f,     -0.00f) },
+    { simde_mm256_set_ps(     1.75f,     -0.17f,     -1.58f,     -6.59f,
+                              4.63f,     -5.16f,      0.74f,     -7.51f),
+      simde_mm256_set_ps(     2.00f,     -0.00f,     -2.00f,     -7.00f,
+                              5.00f,     -5.00f,      1.00f,     -8.00f),
+      simde_mm256_set_ps(     1.00f,     -1.00f,     -2.00f,     -7.00f,
+                              4.00f,     -6.00f,      0.00f,     -8.00f),
+      simde_mm256_set_ps(     2.00f,     -0.00f,     -1.00f,     -6.00f,
+                              5.00f,     -5.00f,      1.00f,     -7.00f),
+      simde_mm256_set_ps(     1.00f,     -0.00f,     -1.00f,     -6.00f,
+                              4.00f,     -5.00f,      0.00f,     -7.00f) },
+    { simde_mm256_set_ps(    -8.74f,     -1.35f,      4.71f,      9.39f,
+                              7.40f,      5.81f,     -2.35f,     -8.00f),
+      simde_mm256_set_ps(    -9.00f,     -1.00f,      5.00f,      9.00f,
+                              7.00f,      6.00f,     -2.00f,     -8.00f),
+      simde_mm256_set_ps(    -9.00f,     -2.00f,      4.00f,      9.00f,
+                              7.00f,      5.00f,     -3.00f,     -8.00f),
+      simde_mm256_set_ps(    -8.00f,     -1.00f,      5.00f,     10.00f,
+                              8.00f,      6.00f,     -2.00f,     -8.00f),
+      simde_mm256_set_ps(    -8.00f,     -1.00f,      4.00f,      9.00f,
+                              7.00f,      5.00f,     -2.00f,     -8.00f) },
+    { simde_mm256_set_ps(    -2.31f,     -9.99f,      4.81f,      0.72f,
+                              2.86f,     -5.93f,      1.85f,      3.70f),
+      simde_mm256_set_ps(    -2.00f,    -10.00f,      5.00f,      1.00f,
+                              3.00f,     -6.00f,      2.00f,      4.00f),
+      simde_mm256_set_ps(    -3.00f,    -10.00f,      4.00f,      0.00f,
+                              2.00f,     -6.00f,      1.00f,      3.00f),
+      simde_mm256_set_ps(    -2.00f,     -9.00f,      5.00f,      1.00f,
+                              3.00f,     -5.00f,      2.00f,      4.00f),
+      simde_mm256_set_ps(    -2.00f,     -9.00f,      4.00f,      0.00f,
+                              2.00f,     -5.00f,      1.00f,      3.00f) },
+    { simde_mm256_set_ps(    -7.62f,     -5.38f,     -9.94f,     -3.23f,
+                              8.05f,      3.11f,      6.56f,     -0.30f),
+      simde_mm256_set_ps(    -8.00f,     -5.00f,    -10.00f,     -3.00f,
+                              8.00f,      3.00f,      7.00f,     -0.00f),
+      simde_mm256_set_ps(    -8.00f,     -6.00f,    -10.00f,     -4.00f,
+                              8.00f,      3.00f,      6.00f,     -1.00f),
+      simde_mm256_set_ps(    -7.00f,     -5.00f,     -9.00f,     -3.00f,
+                              9.00f,      4.00f,      7.00f,     -0.00f),
+      simde_mm256_set_ps(    -7.00f,     -5.00f,     -9.00f,     -3.00f,
+                              8.00f,      3.00f,      6.00f,     -0.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r;
+
+    r = simde_mm256_round_ps(test_vec[i].a, simde_MM_FROUND_TO_NEAREST_INT);
+    simde_assert_m256_f32_equal(r, test_vec[i].nearest, 1);
+    r = simde_mm256_round_ps(test_vec[i].a, simde_MM_FROUND_TO_NEG_INF);
+    simde_assert_m256_f32_equal(r, test_vec[i].floor, 1);
+    r = simde_mm256_round_ps(test_vec[i].a, simde_MM_FROUND_TO_POS_INF);
+    simde_assert_m256_f32_equal(r, test_vec[i].ceil, 1);
+    r = simde_mm256_round_ps(test_vec[i].a, simde_MM_FROUND_TO_ZERO);
+    simde_assert_m256_f32_equal(r, test_vec[i].trunc, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_rsqrt_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(    80.77f,     44.18f,     42.39f,      6.23f,
+                             12.42f,     36.38f,     27.09f,     28.26f),
+      simde_mm256_set_ps(     0.11f,      0.15f,      0.15f,      0.40f,
+                              0.28f,      0.17f,      0.19f,      0.19f) },
+    { simde_mm256_set_ps(    96.55f,     81.94f,     46.99f,     44.73f,
+                             78.64f,     50.98f,     88.11f,     70.99f),
+      simde_mm256_set_ps(     0.10f,      0.11f,      0.15f,      0.15f,
+                              0.11f,      0.14f,      0.11f,      0.12f) },
+    { simde_mm256_set_ps(    76.26f,     16.68f,     93.59f,     46.93f,
+                             23.69f,     98.05f,     98.81f,     46.00f),
+      simde_mm256_set_ps(     0.11f,      0.24f,      0.10f,      0.15f,
+                              0.21f,      0.10f,      0.10f,      0.15f) },
+    { simde_mm256_set_ps(    56.62f,      7.11f,     93.59f,     26.63f,
+                              2.42f,     67.14f,      5.78f,     93.27f),
+      simde_mm256_set_ps(     0.13f,      0.38f,      0.10f,      0.19f,
+                              0.64f,      0.12f,      0.42f,      0.10f) },
+    { simde_mm256_set_ps(    59.71f,     27.21f,     46.60f,     99.39f,
+                             57.79f,      2.78f,     17.00f,     67.68f),
+      simde_mm256_set_ps(     0.13f,      0.19f,      0.15f,      0.10f,
+                              0.13f,      0.60f,      0.24f,      0.12f) },
+    { simde_mm256_set_ps(     6.03f,      7.14f,     40.21f,     42.25f,
+                             18.43f,     39.59f,      2.47f,     78.15f),
+      simde_mm256_set_ps(     0.41f,      0.37f,      0.16f,      0.15f,
+                              0.23f,      0.16f,      0.64f,      0.11f) },
+    { simde_mm256_set_ps(    22.98f,     32.17f,     73.50f,     78.86f,
+                             45.09f,     90.27f,     98.60f,     41.85f),
+      simde_mm256_set_ps(     0.21f,      0.18f,      0.12f,      0.11f,
+                              0.15f,      0.11f,      0.10f,      0.15f) },
+    { simde_mm256_set_ps(    70.68f,     41.38f,     15.12f,     44.69f,
+                             56.11f,     38.31f,     14.21f,     33.99f),
+      simde_mm256_set_ps(     0.12f,      0.16f,      0.26f,      0.15f,
+                              0.13f,      0.16f,      0.27f,      0.17f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_rsqrt_ps(test_vec[i].a);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 2);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set1_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    const int32_t a = (int32_t) munit_rand_uint32();
+    simde__m256i r = simde_mm256_set1_epi32(a);
+
+    for (size_t j = 0 ; j < 8 ; j++) {
+      munit_assert_int32(r.i32[j], ==, a);
+    }
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set1_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    const simde_float64 a = munit_rand_double();
+    simde__m256d r = simde_mm256_set1_pd(a);
+
+    for (size_t j = 0 ; j < 4 ; j++) {
+      munit_assert_double(r.f64[j], ==, a);
+    }
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    int16_t a[16];
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) a);
+    r = simde_mm256_set_epi16(a[15], a[14], a[13], a[12], a[11], a[10], a[ 9], a[ 8],
+                              a[ 7], a[ 6], a[ 5], a[ 4], a[ 3], a[ 2], a[ 1], a[ 0]);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    int32_t a[8];
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) a);
+    r = simde_mm256_set_epi32(a[7], a[6], a[5], a[4], a[3], a[2], a[1], a[0]);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set_epi64x(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    int64_t a[4];
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) a);
+    r = simde_mm256_set_epi64x(a[3], a[2], a[1], a[0]);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    int8_t a[32];
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) a);
+    r = simde_mm256_set_epi8(a[31], a[30], a[29], a[28], a[27], a[26], a[25], a[24],
+                             a[23], a[22], a[21], a[20], a[19], a[18], a[17], a[16],
+                             a[15], a[14], a[13], a[12], a[11], a[10], a[ 9], a[ 8],
+                             a[ 7], a[ 6], a[ 5], a[ 4], a[ 3], a[ 2], a[ 1], a[ 0]);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set_m128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[8];
+    simde__m256 r;
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    r = simde_mm256_set_m128(simde_mm_loadu_ps(&(a[4])), simde_mm_loadu_ps(&(a[0])));
+    munit_assert_memory_equal(sizeof(a), a, &r);
+
+    r = simde_mm256_setr_m128(simde_mm_loadu_ps(&(a[0])), simde_mm_loadu_ps(&(a[4])));
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set_m128i(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde__m128i a[2];
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) a);
+    r = simde_mm256_set_m128i(a[1], a[0]);
+    munit_assert_memory_equal(sizeof(a), a, &r);
+
+    r = simde_mm256_setr_m128i(a[0], a[1]);
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float64 a[4];
+    simde__m256d r;
+
+    random_f64v(sizeof(a) / sizeof(a[0]), a);
+    r = simde_mm256_set_pd(a[3], a[2], a[1], a[0]);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_set_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[8];
+    simde__m256 r;
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    r = simde_mm256_set_ps(a[7], a[6], a[5], a[4], a[3], a[2], a[1], a[0]);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_setr_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    int32_t a[8];
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) a);
+    r = simde_mm256_setr_epi32(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_setr_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[8];
+    simde__m256 r;
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    r = simde_mm256_setr_ps(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+
+    munit_assert_memory_equal(sizeof(a), a, &r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_setzero_si256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const uint8_t zero[32] = { 0, };
+  simde__m256i r = simde_mm256_setzero_si256();
+
+  munit_assert_memory_equal(sizeof(r), &r, zero);
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sqrt_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   733.74,    525.07,    357.41,    353.15),
+      simde_mm256_set_pd(    27.09,     22.91,     18.91,     18.79) },
+    { simde_mm256_set_pd(   976.12,    812.77,    733.77,    747.61),
+      simde_mm256_set_pd(    31.24,     28.51,     27.09,     27.34) },
+    { simde_mm256_set_pd(   948.61,    974.58,    771.91,    355.73),
+      simde_mm256_set_pd(    30.80,     31.22,     27.78,     18.86) },
+    { simde_mm256_set_pd(   343.92,    942.99,    311.73,    388.23),
+      simde_mm256_set_pd(    18.55,     30.71,     17.66,     19.70) },
+    { simde_mm256_set_pd(   757.61,    367.76,    278.38,    803.98),
+      simde_mm256_set_pd(    27.52,     19.18,     16.68,     28.35) },
+    { simde_mm256_set_pd(   968.73,    667.36,    200.06,    678.37),
+      simde_mm256_set_pd(    31.12,     25.83,     14.14,     26.05) },
+    { simde_mm256_set_pd(     4.69,    554.64,    638.90,    444.86),
+      simde_mm256_set_pd(     2.17,     23.55,     25.28,     21.09) },
+    { simde_mm256_set_pd(   745.06,    108.80,    747.77,    522.81),
+      simde_mm256_set_pd(    27.30,     10.43,     27.35,     22.87) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_sqrt_pd(test_vec[i].a);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sqrt_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   514.18f,    780.10f,    276.80f,    398.46f,
+                            518.29f,    944.97f,    136.09f,    676.54f),
+      simde_mm256_set_ps(    22.68f,     27.93f,     16.64f,     19.96f,
+                             22.77f,     30.74f,     11.67f,     26.01f) },
+    { simde_mm256_set_ps(   157.60f,    459.82f,    753.03f,    628.99f,
+                            281.19f,     76.45f,    459.03f,    145.83f),
+      simde_mm256_set_ps(    12.55f,     21.44f,     27.44f,     25.08f,
+                             16.77f,      8.74f,     21.42f,     12.08f) },
+    { simde_mm256_set_ps(   462.93f,    984.35f,     37.43f,     66.21f,
+                             88.55f,    626.00f,    166.91f,    638.21f),
+      simde_mm256_set_ps(    21.52f,     31.37f,      6.12f,      8.14f,
+                              9.41f,     25.02f,     12.92f,     25.26f) },
+    { simde_mm256_set_ps(   261.40f,    850.59f,    677.14f,    791.41f,
+                            161.52f,    720.13f,    142.80f,    482.93f),
+      simde_mm256_set_ps(    16.17f,     29.16f,     26.02f,     28.13f,
+                             12.71f,     26.84f,     11.95f,     21.98f) },
+    { simde_mm256_set_ps(   558.91f,    995.90f,    366.04f,    993.13f,
+                            503.32f,    193.42f,    844.12f,    455.56f),
+      simde_mm256_set_ps(    23.64f,     31.56f,     19.13f,     31.51f,
+                             22.43f,     13.91f,     29.05f,     21.34f) },
+    { simde_mm256_set_ps(   457.31f,    522.22f,     34.14f,    391.80f,
+                            305.71f,    854.71f,    111.17f,     88.40f),
+      simde_mm256_set_ps(    21.38f,     22.85f,      5.84f,     19.79f,
+                             17.48f,     29.24f,     10.54f,      9.40f) },
+    { simde_mm256_set_ps(    54.79f,     85.05f,    331.21f,    818.75f,
+                            621.37f,     11.28f,    395.24f,    257.58f),
+      simde_mm256_set_ps(     7.40f,      9.22f,     18.20f,     28.61f,
+                             24.93f,      3.36f,     19.88f,     16.05f) },
+    { simde_mm256_set_ps(     9.66f,    595.20f,    956.59f,    526.69f,
+                            826.23f,    986.48f,    449.09f,    206.23f),
+      simde_mm256_set_ps(     3.11f,     24.40f,     30.93f,     22.95f,
+                             28.74f,     31.41f,     21.19f,     14.36f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_sqrt_ps(test_vec[i].a);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_store_si256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde__m256i a;
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) &a);
+    simde_mm256_store_si256(&r, a);
+
+    simde_assert_m256i_i64(r, ==, a);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_storeu2_m128d(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float64 a[4];
+    simde_float64 hi[2], lo[2];
+
+    random_f64v(sizeof(a) / sizeof(a[0]), a);
+    simde_mm256_storeu2_m128d(hi, lo, simde_mm256_loadu_pd(a));
+
+    munit_assert_memory_equal(sizeof(lo), lo, &(a[0]));
+    munit_assert_memory_equal(sizeof(hi), hi, &(a[2]));
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_storeu2_m128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[8];
+    simde_float32 hi[4], lo[4];
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    simde_mm256_storeu2_m128(hi, lo, simde_mm256_loadu_ps(a));
+
+    munit_assert_memory_equal(sizeof(lo), lo, &(a[0]));
+    munit_assert_memory_equal(sizeof(hi), hi, &(a[4]));
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_storeu_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float64 a[4];
+    simde_float64 r[5];
+
+    random_f64v(sizeof(a) / sizeof(a[0]), a);
+    simde_mm256_storeu_pd(&(r[1]), simde_mm256_loadu_pd(a));
+
+    munit_assert_memory_equal(sizeof(a), a, &(r[1]));
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_stream_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde_float32 a[8];
+    SIMDE__ALIGN(32) simde_float32 r[8];
+
+    random_f32v(sizeof(a) / sizeof(a[0]), a);
+    simde_mm256_stream_ps(r, simde_mm256_loadu_ps(a));
+
+    munit_assert_memory_equal(sizeof(a), a, r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   947.28,   -959.60,   -819.61,   -864.59),
+      simde_mm256_set_pd(   619.86,    607.69,   -581.37,    176.47),
+      simde_mm256_set_pd(   327.42,  -1567.29,   -238.24,  -1041.06) },
+    { simde_mm256_set_pd(   145.96,    628.39,     -2.04,   -700.97),
+      simde_mm256_set_pd(   167.31,    514.50,    185.17,    987.46),
+      simde_mm256_set_pd(   -21.35,    113.89,   -187.21,  -1688.43) },
+    { simde_mm256_set_pd(   799.53,   -504.55,   -308.12,    241.77),
+      simde_mm256_set_pd(   518.87,   -633.50,   -480.81,   -761.34),
+      simde_mm256_set_pd(   280.66,    128.95,    172.69,   1003.11) },
+    { simde_mm256_set_pd(  -246.57,    125.27,    279.20,   -763.79),
+      simde_mm256_set_pd(   887.20,   -849.41,    443.28,   -475.10),
+      simde_mm256_set_pd( -1133.77,    974.68,   -164.08,   -288.69) },
+    { simde_mm256_set_pd(  -140.34,     17.56,    -16.27,   -522.54),
+      simde_mm256_set_pd(   336.54,     62.31,   -409.24,    870.20),
+      simde_mm256_set_pd(  -476.88,    -44.75,    392.97,  -1392.74) },
+    { simde_mm256_set_pd(   684.03,   -393.00,    420.81,    414.52),
+      simde_mm256_set_pd(  -254.94,   -992.46,    349.49,    964.51),
+      simde_mm256_set_pd(   938.97,    599.46,     71.32,   -549.99) },
+    { simde_mm256_set_pd(   -35.72,    764.13,   -315.16,   -983.20),
+      simde_mm256_set_pd(   472.84,   -306.99,    785.59,   -923.79),
+      simde_mm256_set_pd(  -508.56,   1071.12,  -1100.75,    -59.41) },
+    { simde_mm256_set_pd(  -281.82,    665.25,   -369.07,    -78.97),
+      simde_mm256_set_pd(  -928.18,   -184.69,   -930.49,    970.72),
+      simde_mm256_set_pd(   646.36,    849.94,    561.42,  -1049.69) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_sub_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   449.44f,    -20.90f,   -522.78f,    978.73f,
+                            825.77f,   -390.06f,   -385.37f,   -731.22f),
+      simde_mm256_set_ps(   -72.81f,    195.10f,    673.13f,   -817.20f,
+                            355.55f,    700.03f,    199.47f,   -639.06f),
+      simde_mm256_set_ps(   522.25f,   -216.00f,  -1195.91f,   1795.93f,
+                            470.22f,  -1090.09f,   -584.84f,    -92.16f) },
+    { simde_mm256_set_ps(   907.53f,    177.17f,    -78.14f,   -264.17f,
+                           -941.57f,    603.97f,   -131.74f,    498.63f),
+      simde_mm256_set_ps(  -767.86f,   -652.36f,    735.43f,    570.68f,
+                            789.57f,   -359.27f,    287.11f,     90.84f),
+      simde_mm256_set_ps(  1675.39f,    829.53f,   -813.57f,   -834.85f,
+                          -1731.14f,    963.24f,   -418.85f,    407.79f) },
+    { simde_mm256_set_ps(  -635.43f,    138.47f,   -806.67f,    559.65f,
+                           -930.93f,   -841.27f,    603.26f,   -487.01f),
+      simde_mm256_set_ps(    57.01f,   -850.27f,   -878.71f,   -772.35f,
+                            219.49f,   -269.13f,    990.37f,   -714.53f),
+      simde_mm256_set_ps(  -692.44f,    988.74f,     72.04f,   1332.00f,
+                          -1150.42f,   -572.14f,   -387.11f,    227.52f) },
+    { simde_mm256_set_ps(  -141.71f,   -811.07f,    803.29f,   -762.17f,
+                            428.65f,    648.64f,    928.03f,   -852.26f),
+      simde_mm256_set_ps(   -57.33f,   -558.28f,   -510.73f,     73.71f,
+                            966.80f,   -327.92f,    678.16f,   -210.09f),
+      simde_mm256_set_ps(   -84.38f,   -252.79f,   1314.02f,   -835.88f,
+                           -538.15f,    976.56f,    249.87f,   -642.17f) },
+    { simde_mm256_set_ps(  -902.91f,   -771.97f,   -924.83f,   -527.90f,
+                            -39.20f,   -896.17f,    375.95f,   -600.72f),
+      simde_mm256_set_ps(   719.26f,   -852.42f,    814.88f,   -481.43f,
+                           -543.70f,    213.51f,    677.78f,   -785.34f),
+      simde_mm256_set_ps( -1622.17f,     80.45f,  -1739.71f,    -46.47f,
+                            504.50f,  -1109.68f,   -301.83f,    184.62f) },
+    { simde_mm256_set_ps(  -903.47f,    744.44f,   -767.21f,   -884.31f,
+                           -131.68f,   -625.38f,   -618.11f,   -235.37f),
+      simde_mm256_set_ps(  -792.66f,   -963.14f,   -955.98f,    273.22f,
+                           -388.09f,   -371.69f,    634.37f,    -61.04f),
+      simde_mm256_set_ps(  -110.81f,   1707.58f,    188.77f,  -1157.53f,
+                            256.41f,   -253.69f,  -1252.48f,   -174.33f) },
+    { simde_mm256_set_ps(  -269.02f,    -70.09f,   -486.63f,    700.29f,
+                            556.31f,   -185.79f,   -477.19f,   -494.40f),
+      simde_mm256_set_ps(   444.20f,    389.62f,     75.58f,    485.72f,
+                           -866.19f,   -974.16f,   -587.30f,    634.88f),
+      simde_mm256_set_ps(  -713.22f,   -459.71f,   -562.21f,    214.57f,
+                           1422.50f,    788.37f,    110.11f,  -1129.28f) },
+    { simde_mm256_set_ps(   263.86f,    -13.56f,   -845.02f,   -295.88f,
+                            124.77f,    366.30f,    619.24f,   -216.48f),
+      simde_mm256_set_ps(   699.29f,    455.28f,    769.87f,    906.27f,
+                           -154.34f,    625.87f,     78.64f,   -525.95f),
+      simde_mm256_set_ps(  -435.43f,   -468.84f,  -1614.89f,  -1202.15f,
+                            279.11f,   -259.57f,    540.60f,    309.47f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_sub_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_xor_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-3965166483946737687), INT64_C( -151618424900663366),
+                             INT64_C(-4618161061920694561), INT64_C(-7220077334036061386)),
+      simde_mm256_set_epi64x(INT64_C(-3550799601757126002), INT64_C( 1402523072837999930),
+                             INT64_C( 5987183105605562347), INT64_C( 2204604189138186018)),
+      simde_mm256_set_epi64x(INT64_C(  450888296960814439), INT64_C(-1255496502300108160),
+                             INT64_C(-1369585032594984652), INT64_C(-8839033077427270636)) },
+    { simde_mm256_set_epi64x(INT64_C( 8820689192957633043), INT64_C(   86804481945533303),
+                             INT64_C(-2669127387174184670), INT64_C(-3487340192172806694)),
+      simde_mm256_set_epi64x(INT64_C( 1011816317381142233), INT64_C(-4286434508542673046),
+                             INT64_C( -202121036945059577), INT64_C( 4921627590985688838)),
+      simde_mm256_set_epi64x(INT64_C( 8386779487117739210), INT64_C(-4199638877628005347),
+                             INT64_C( 2865610102704359461), INT64_C(-8370123913531864356)) },
+    { simde_mm256_set_epi64x(INT64_C( 7490775609993140280), INT64_C( 2037235925776834257),
+                             INT64_C( 1672272737552142329), INT64_C( 3488480694298335833)),
+      simde_mm256_set_epi64x(INT64_C( 5016801020018093104), INT64_C(  -32464168228467136),
+                             INT64_C( 4167228036726399226), INT64_C(-8155919780869325952)),
+      simde_mm256_set_epi64x(INT64_C( 2480310525803885576), INT64_C(-2033061574334754671),
+                             INT64_C( 3378241658737766147), INT64_C(-4703507751764598311)) },
+    { simde_mm256_set_epi64x(INT64_C( -579688265686396447), INT64_C( 1890541509489863699),
+                             INT64_C( 5121713863378900440), INT64_C( -450528305869822429)),
+      simde_mm256_set_epi64x(INT64_C( -391425349063820784), INT64_C(-2217119795417373904),
+                             INT64_C( 2321066443425970256), INT64_C( 7765601223982957528)),
+      simde_mm256_set_epi64x(INT64_C(  965432987791092721), INT64_C( -358115101205655773),
+                             INT64_C( 7432608712644062600), INT64_C(-7891551401119504901)) },
+    { simde_mm256_set_epi64x(INT64_C( 2163649404286093875), INT64_C(-7098472830199302207),
+                             INT64_C(-1078626706501261378), INT64_C( -301908116373322864)),
+      simde_mm256_set_epi64x(INT64_C( 6066834273145075946), INT64_C(-3147613411955313941),
+                             INT64_C(-5841276338059595941), INT64_C( 9169314640092920090)),
+      simde_mm256_set_epi64x(INT64_C( 5347859680973517529), INT64_C( 5272667151601272106),
+                             INT64_C( 6910893096384202981), INT64_C(-8867416969456633206)) },
+    { simde_mm256_set_epi64x(INT64_C(-1758054342164762649), INT64_C( 6522938562062097509),
+                             INT64_C( 3850503469281659547), INT64_C( 1254233926873061301)),
+      simde_mm256_set_epi64x(INT64_C( 4355090805700345573), INT64_C(-7945938530788213076),
+                             INT64_C( 1894892102541868214), INT64_C(-8085498041537273416)),
+      simde_mm256_set_epi64x(INT64_C(-2600187904395767550), INT64_C(-3802030881784208695),
+                             INT64_C( 3396768356462900781), INT64_C(-7012837707272489459)) },
+    { simde_mm256_set_epi64x(INT64_C(-5896964209014542279), INT64_C(-5746925770666271233),
+                             INT64_C( 1394778590950203672), INT64_C( 1088015601741603250)),
+      simde_mm256_set_epi64x(INT64_C( 5628730564676288294), INT64_C( 4809217952170307740),
+                             INT64_C( 6597654547815935456), INT64_C(-7902204866640239300)),
+      simde_mm256_set_epi64x(INT64_C(-2291062361113030881), INT64_C( -971907485597373085),
+                             INT64_C( 5248009028145450232), INT64_C(-7112077825058831218)) },
+    { simde_mm256_set_epi64x(INT64_C(-2883763134487307933), INT64_C( -693455437251875520),
+                             INT64_C(  925810350832567433), INT64_C(-3664732753752476342)),
+      simde_mm256_set_epi64x(INT64_C( 1037093056432289696), INT64_C(-5605253048849986098),
+                             INT64_C( 5462801685409729659), INT64_C( 6668591273271165128)),
+      simde_mm256_set_epi64x(INT64_C(-2765581709042782525), INT64_C( 4924261750843826318),
+                             INT64_C( 5122535250232199410), INT64_C(-7948896685168446078)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_xor_pd(simde_mm256_castsi256_pd(test_vec[i].a), simde_mm256_castsi256_pd(test_vec[i].b));
+    simde_assert_m256d_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_xor_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(  269043403,  2122170344, -1371938782,  -403461247,
+                              520704485,   416312149,   -11855835, -1804955722),
+      simde_mm256_set_epi32(  618587297,   699251129, -1492539564,  1168315557,
+                             1367287731,    49818777, -1853515641,   750582578),
+      simde_mm256_set_epi32(  886547050,  1473250897,   154158966, -1571766492,
+                             1316386390,   438847436,  1859027106, -1193905020) },
+    { simde_mm256_set_epi32(  294015325,   144359604,  -318948009,   469331844,
+                               98025278,   817899940,  1536836312,  1763245275),
+      simde_mm256_set_epi32( -698252064,   514341782,  -584233577, -1297205022,
+                             -244278307, -1530645511,  1380270624,  1628969304),
+      simde_mm256_set_epi32( -941107779,   372439842,   835743936, -1453893786,
+                             -190372637, -1811670435,   165609720,   134276483) },
+    { simde_mm256_set_epi32( 1507631463,  -527065771,  -448617551,  -130666658,
+                            -1232092246,   268218061,   814959101,  -685074596),
+      simde_mm256_set_epi32(  184562973, -1677670812,  2014692138,   106860651,
+                             -241476601,  -459756645, -1850757673,  1439050395),
+      simde_mm256_set_epi32( 1390187642,  2090162993, -1655218021,   -26689739,
+                             1192533933,  -345766570, -1589844950, -2098414137) },
+    { simde_mm256_set_epi32(  562958872,  1648610602, -1935647544,  1475417031,
+                            -1154014572,  1141879248,  1447289471,   121075315),
+      simde_mm256_set_epi32( 1721073192,  1847867149, -1448139449,  -983269524,
+                              734903349,  1040919200,  1319368611,  -647718283),
+      simde_mm256_set_epi32( 1192979504,   208140839,   621771151, -1835701077,
+                            -1862623583,  2047122288,   417338844,  -564925434) },
+    { simde_mm256_set_epi32(  829533354, -1337838185,  2144696934, -1590396348,
+                             -393738262,  1606934269, -1388230602, -1472736234),
+      simde_mm256_set_epi32( 1566035920,   126420896,   497050185,   910937244,
+                            -1090949448,  1957206788,   176078949,  1283415240),
+      simde_mm256_set_epi32( 1814455162, -1211420105,  1651841071, -1753237800,
+                             1450273106,   728712697, -1489008557,  -465008418) },
+    { simde_mm256_set_epi32( 1781216478,  1734719102,  1676178728,   826221624,
+                            -1192421664,   707330976,  -767929424,  1608050952),
+      simde_mm256_set_epi32(-2070046606,   -16223364,  1694298483, -1805795723,
+                             -457886567,  -788422197,  1368824605,  1412674245),
+      simde_mm256_set_epi32( -290018132, -1737636606,   118785115, -1520264627,
+                             1549279865,   -81223061, -2085828435,   199973837) },
+    { simde_mm256_set_epi32( -493828865,   756298851, -1019580879,  1748157223,
+                            -1625801949, -1916681228,  1901400898,   630124524),
+      simde_mm256_set_epi32( -480607859,  1478573214,  -806015755,   461416869,
+                             -767131713, -1550790959, -1803963303,  1935972459),
+      simde_mm256_set_epi32(   30033266,  1966409981,   214909636,  1941072514,
+                             1298023580,   777063717,  -450058469,  1458206599) },
+    { simde_mm256_set_epi32(-1876342633,   540447529, -1622810890, -2004570845,
+                            -1894874128,    83601614, -1658381547, -1615320386),
+      simde_mm256_set_epi32( 1362624467,  1525741300,   463450416,   416654923,
+                              702071346,   540409028, -1115803054,   -58425997),
+      simde_mm256_set_epi32(-1054951612,  2059822557, -2066059322, -1873736856,
+                            -1495907902,   617501706,   542714183,  1664899021) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_xor_ps(simde_mm256_castsi256_ps(test_vec[i].a), simde_mm256_castsi256_ps(test_vec[i].b));
+    simde_assert_m256_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_zeroupper(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  simde_float32 a[8];
+  random_f32v(sizeof(a) / sizeof(a[0]), a);
+
+  simde__m256 r = simde_mm256_loadu_ps(a);
+  simde_mm256_zeroupper();
+  munit_assert_memory_equal(sizeof(a), &r, a);
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_zextsi128_si256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    simde__m128i a;
+    simde__m256i r;
+
+    munit_rand_memory(sizeof(a), (uint8_t*) &a);
+
+    r = simde_mm256_zextsi128_si256(a);
+    munit_assert_int64(r.i64[0], ==, a.i64[0]);
+    munit_assert_int64(r.i64[1], ==, a.i64[1]);
+    munit_assert_int64(r.i64[2], ==, 0);
+    munit_assert_int64(r.i64[3], ==, 0);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm_cmp_pd",               test_simde_mm_cmp_pd,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmp_ps",               test_simde_mm_cmp_ps,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmp_sd",               test_simde_mm_cmp_sd,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmp_ss",               test_simde_mm_cmp_ss,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maskload_pd",          test_simde_mm_maskload_pd,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maskload_ps",          test_simde_mm_maskload_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maskstore_pd",         test_simde_mm_maskstore_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maskstore_ps",         test_simde_mm_maskstore_ps,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_add_pd",            test_simde_mm256_add_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_add_ps",            test_simde_mm256_add_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_addsub_pd",         test_simde_mm256_addsub_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_addsub_ps",         test_simde_mm256_addsub_ps,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_and_pd",            test_simde_mm256_and_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_and_ps",            test_simde_mm256_and_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_andnot_pd",         test_simde_mm256_andnot_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_andnot_ps",         test_simde_mm256_andnot_ps,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_blendv_pd",         test_simde_mm256_blendv_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_blendv_ps",         test_simde_mm256_blendv_ps,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_broadcast_ps",      test_simde_mm256_broadcast_ps,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_broadcast_ss",      test_simde_mm256_broadcast_ss,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_castps128_ps256",   test_simde_mm256_castps128_ps256,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_ceil_pd",           test_simde_mm256_ceil_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_ceil_ps",           test_simde_mm256_ceil_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmp_pd",            test_simde_mm256_cmp_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmp_ps",            test_simde_mm256_cmp_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtepi32_pd",       test_simde_mm256_cvtepi32_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtepi32_ps",       test_simde_mm256_cvtepi32_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtpd_epi32",       test_simde_mm256_cvtpd_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtpd_ps",          test_simde_mm256_cvtpd_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtps_epi32",       test_simde_mm256_cvtps_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtps_pd",          test_simde_mm256_cvtps_pd,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtsd_f64",         test_simde_mm256_cvtsd_f64,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtsi256_si32",     test_simde_mm256_cvtsi256_si32,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtss_f32",         test_simde_mm256_cvtss_f32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvttpd_epi32",      test_simde_mm256_cvttpd_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvttps_epi32",      test_simde_mm256_cvttps_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_div_pd",            test_simde_mm256_div_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_div_ps",            test_simde_mm256_div_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_extractf128_ps",    test_simde_mm256_extractf128_ps,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_extractf128_si256", test_simde_mm256_extractf128_si256, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_floor_pd",          test_simde_mm256_floor_pd,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_floor_ps",          test_simde_mm256_floor_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_hadd_pd",           test_simde_mm256_hadd_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_hadd_ps",           test_simde_mm256_hadd_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_hsub_pd",           test_simde_mm256_hsub_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_hsub_ps",           test_simde_mm256_hsub_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_insertf128_pd",     test_simde_mm256_insertf128_pd,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_load_pd",           test_simde_mm256_load_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_loadu2_m128i",      test_simde_mm256_loadu2_m128i,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_loadu_ps",          test_simde_mm256_loadu_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_maskload_pd",       test_simde_mm256_maskload_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_maskload_ps",       test_simde_mm256_maskload_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_maskstore_pd",      test_simde_mm256_maskstore_pd,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_maskstore_ps",      test_simde_mm256_maskstore_ps,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/maskload_maskstore_guard", test_simde_maskload_maskstore_guard, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_max_pd",            test_simde_mm256_max_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_max_ps",            test_simde_mm256_max_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_min_pd",            test_simde_mm256_min_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_min_ps",            test_simde_mm256_min_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_movemask_pd",       test_simde_mm256_movemask_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_movemask_ps",       test_simde_mm256_movemask_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mul_pd",            test_simde_mm256_mul_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mul_ps",            test_simde_mm256_mul_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_or_pd",             test_simde_mm256_or_pd,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_or_ps",             test_simde_mm256_or_ps,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_permute2f128_ps",   test_simde_mm256_permute2f128_ps,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_permute_pd",        test_simde_mm256_permute_pd,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_permute_ps",        test_simde_mm256_permute_ps,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_rcp_ps",            test_simde_mm256_rcp_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_round_pd",          test_simde_mm256_round_pd,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_round_ps",          test_simde_mm256_round_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_rsqrt_ps",          test_simde_mm256_rsqrt_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set1_epi32",        test_simde_mm256_set1_epi32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set1_pd",           test_simde_mm256_set1_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set_epi16",         test_simde_mm256_set_epi16,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set_epi32",         test_simde_mm256_set_epi32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set_epi64x",        test_simde_mm256_set_epi64x,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set_epi8",          test_simde_mm256_set_epi8,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set_m128",          test_simde_mm256_set_m128,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set_m128i",         test_simde_mm256_set_m128i,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set_pd",            test_simde_mm256_set_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_set_ps",            test_simde_mm256_set_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_setr_epi32",        test_simde_mm256_setr_epi32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_setr_ps",           test_simde_mm256_setr_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_setzero_si256",     test_simde_mm256_setzero_si256,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sqrt_pd",           test_simde_mm256_sqrt_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sqrt_ps",           test_simde_mm256_sqrt_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_store_si256",       test_simde_mm256_store_si256,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_storeu2_m128",      test_simde_mm256_storeu2_m128,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_storeu2_m128d",     test_simde_mm256_storeu2_m128d,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_storeu_pd",         test_simde_mm256_storeu_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_stream_ps",         test_simde_mm256_stream_ps,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sub_pd",            test_simde_mm256_sub_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sub_ps",            test_simde_mm256_sub_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_xor_pd",            test_simde_mm256_xor_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_xor_ps",            test_simde_mm256_xor_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_zeroupper",         test_simde_mm256_zeroupper,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_zextsi128_si256",   test_simde_mm256_zextsi128_si256,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_avx_test_suite = {
+  (char*) "/avx",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
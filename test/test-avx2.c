@@ -0,0 +1,7483 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../avx2.h"
+
+static MunitResult
+test_simde_mm_i32gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const int32_t table[32] = {
+     2007895027,  -829299312,   383820229,  -515582232,
+     1317384406,  1962916072,  2046340519, -1712832678,
+      -63406598,   967928689,   247950592,  1356176394,
+     -855446148, -1277964867,  -629184109,  1847487725,
+    -1300596602,  1278660827, -1884064769, -1683937587,
+     -494381358,   290034711, -1901383782,   873776252,
+     1291338222, -1305600347,  1676228649,  -678548945,
+    -1241580122,   658182310,  1168993537, -1025662741
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(         22,           9,          20,           5),
+      simde_mm_set_epi32(-1901383782,   967928689,  -494381358,  1962916072) },
+    { simde_mm_set_epi32(          6,          14,          27,          30),
+      simde_mm_set_epi32( 2046340519,  -629184109,  -678548945,  1168993537) },
+    { simde_mm_set_epi32(         12,          14,          12,          14),
+      simde_mm_set_epi32( -855446148,  -629184109,  -855446148,  -629184109) },
+    { simde_mm_set_epi32(         29,          29,           6,          12),
+      simde_mm_set_epi32(  658182310,   658182310,  2046340519,  -855446148) },
+    { simde_mm_set_epi32(          2,          26,          21,           2),
+      simde_mm_set_epi32(  383820229,  1676228649,   290034711,   383820229) },
+    { simde_mm_set_epi32(         24,          23,          17,          30),
+      simde_mm_set_epi32( 1291338222,   873776252,  1278660827,  1168993537) },
+    { simde_mm_set_epi32(         25,          28,          11,          29),
+      simde_mm_set_epi32(-1305600347, -1241580122,  1356176394,   658182310) },
+    { simde_mm_set_epi32(         29,          29,          15,           4),
+      simde_mm_set_epi32(  658182310,   658182310,  1847487725,  1317384406) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_i32gather_epi32(table, test_vec[i].vindex, 4);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i64gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const int32_t table[32] = {
+     2007895027,  -829299312,   383820229,  -515582232,
+     1317384406,  1962916072,  2046340519, -1712832678,
+      -63406598,   967928689,   247950592,  1356176394,
+     -855446148, -1277964867,  -629184109,  1847487725,
+    -1300596602,  1278660827, -1884064769, -1683937587,
+     -494381358,   290034711, -1901383782,   873776252,
+     1291338222, -1305600347,  1676228649,  -678548945,
+    -1241580122,   658182310,  1168993537, -1025662741
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(                  14), INT64_C(                  13)),
+      simde_mm_set_epi32(          0,           0,  -629184109, -1277964867) },
+    { simde_mm_set_epi64x(INT64_C(                  16), INT64_C(                   9)),
+      simde_mm_set_epi32(          0,           0, -1300596602,   967928689) },
+    { simde_mm_set_epi64x(INT64_C(                  20), INT64_C(                  27)),
+      simde_mm_set_epi32(          0,           0,  -494381358,  -678548945) },
+    { simde_mm_set_epi64x(INT64_C(                  11), INT64_C(                   1)),
+      simde_mm_set_epi32(          0,           0,  1356176394,  -829299312) },
+    { simde_mm_set_epi64x(INT64_C(                  27), INT64_C(                  23)),
+      simde_mm_set_epi32(          0,           0,  -678548945,   873776252) },
+    { simde_mm_set_epi64x(INT64_C(                  28), INT64_C(                   7)),
+      simde_mm_set_epi32(          0,           0, -1241580122, -1712832678) },
+    { simde_mm_set_epi64x(INT64_C(                  13), INT64_C(                  15)),
+      simde_mm_set_epi32(          0,           0, -1277964867,  1847487725) },
+    { simde_mm_set_epi64x(INT64_C(                  31), INT64_C(                   5)),
+      simde_mm_set_epi32(          0,           0, -1025662741,  1962916072) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_i64gather_epi32(table, test_vec[i].vindex, 4);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i32gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const simde_float32 table[32] = {
+      -178.35f,   -139.46f,   -427.29f,   -454.73f,
+       821.09f,   -661.65f,    307.67f,    649.91f,
+       540.08f,    882.04f,    524.46f,    758.83f,
+        39.77f,    860.16f,   -246.33f,   -850.62f,
+      -411.00f,   -306.57f,    520.07f,   -164.54f,
+      -296.60f,    735.93f,   -816.68f,    354.88f,
+      -606.62f,   -403.48f,    602.73f,    644.97f,
+      -991.21f,   -867.86f,   -361.09f,     81.08f
+  };
+
+  const struct {
+    simde__m128 src;
+    simde__m128i vindex;
+    simde__m128 mask;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -104.44f,    397.07f,   -340.35f,    976.72f),
+      simde_mm_set_epi32(         19,          17,          20,           3),
+      simde_mm_set_ps(   104.82f,   -313.37f,    399.17f,   -900.64f),
+      simde_mm_set_ps(  -104.44f,   -306.57f,   -340.35f,   -454.73f) },
+    { simde_mm_set_ps(    -3.42f,    688.69f,    452.10f,    994.88f),
+      simde_mm_set_epi32(         21,          17,          27,          21),
+      simde_mm_set_ps(   501.35f,    -67.84f,    538.74f,    717.90f),
+      simde_mm_set_ps(    -3.42f,   -306.57f,    452.10f,    994.88f) },
+    { simde_mm_set_ps(  -911.99f,    628.61f,      5.74f,    110.28f),
+      simde_mm_set_epi32(         26,          23,           8,           2),
+      simde_mm_set_ps(  -553.07f,    990.98f,    709.63f,   -349.94f),
+      simde_mm_set_ps(   602.73f,    628.61f,      5.74f,   -427.29f) },
+    { simde_mm_set_ps(   741.94f,     -7.02f,   -191.01f,   -878.44f),
+      simde_mm_set_epi32(         27,           2,          10,          17),
+      simde_mm_set_ps(   268.63f,    814.77f,   -805.37f,    781.57f),
+      simde_mm_set_ps(   741.94f,     -7.02f,    524.46f,   -878.44f) },
+    { simde_mm_set_ps(   467.94f,   -122.63f,   -343.33f,    830.81f),
+      simde_mm_set_epi32(          2,          16,          11,          21),
+      simde_mm_set_ps(   194.32f,   -624.75f,    202.64f,    344.09f),
+      simde_mm_set_ps(   467.94f,   -411.00f,   -343.33f,    830.81f) },
+    { simde_mm_set_ps(  -762.14f,    740.61f,   -898.53f,    908.19f),
+      simde_mm_set_epi32(         28,           1,           0,          17),
+      simde_mm_set_ps(   706.14f,    361.23f,     51.00f,    110.20f),
+      simde_mm_set_ps(  -762.14f,    740.61f,   -898.53f,    908.19f) },
+    { simde_mm_set_ps(   402.06f,     71.77f,   -432.27f,    175.86f),
+      simde_mm_set_epi32(         20,          25,          25,           2),
+      simde_mm_set_ps(  -696.76f,     56.18f,   -799.56f,     55.31f),
+      simde_mm_set_ps(  -296.60f,     71.77f,   -403.48f,    175.86f) },
+    { simde_mm_set_ps(   -62.47f,    904.65f,   -735.89f,   -833.49f),
+      simde_mm_set_epi32(          8,           9,          23,           9),
+      simde_mm_set_ps(   823.87f,   -144.75f,   -284.65f,   -485.61f),
+      simde_mm_set_ps(   -62.47f,    882.04f,    354.88f,    882.04f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_mask_i32gather_ps(test_vec[i].src, table, test_vec[i].vindex, test_vec[i].mask, 4);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sllv_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32( -829299312,    84686477,  2007895027,  -289865106),
+      simde_mm_set_epi32(         12,          24,          11,          29),
+      simde_mm_set_epi32(  509149184, -1929379840,  1885313024, -1073741824) },
+    { simde_mm_set_epi32( 1350171741,   -63406598,  -996420037, -1712832678),
+      simde_mm_set_epi32(         32,           6,           9,          37),
+      simde_mm_set_epi32(          0,   236945024,   934049280,           0) },
+    { simde_mm_set_epi32( -629184109, -1909680003, -1277964867,  1153591783),
+      simde_mm_set_epi32(         18,          14,          24,           5),
+      simde_mm_set_epi32(-1504968704,   639582208, -1124073472, -1739768608) },
+    { simde_mm_set_epi32(  367872179,   290034711,      -62276,  -494381358),
+      simde_mm_set_epi32(         12,          27,          34,          34),
+      simde_mm_set_epi32( -729075712, -1207959552,           0,           0) },
+    { simde_mm_set_epi32( -678548945,  2131775155,  1676228649,  1324566895),
+      simde_mm_set_epi32(         11,          30,           8,          14),
+      simde_mm_set_epi32( 1901164544, -1073741824,  -382195456,  -765739008) },
+    { simde_mm_set_epi32(-1233857949,  1427438312, -1222233563,   347896290),
+      simde_mm_set_epi32(         34,          32,          24,           8),
+      simde_mm_set_epi32(          0,           0,   620756992, -1132862976) },
+    { simde_mm_set_epi32(  834066927,  1754084791,  1434916998,  -499567743),
+      simde_mm_set_epi32(          2,          12,          24,          26),
+      simde_mm_set_epi32( -958699588,  -748982272, -2046820352,    67108864) },
+    { simde_mm_set_epi32(  169829449,  -868233590,  1029665220,   -11880479),
+      simde_mm_set_epi32(  290814750,          27,          20,           5),
+      simde_mm_set_epi32(          0,  1342177280,   473956352,  -380175328) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sllv_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_srav_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32( -258181479,   293729615, -1251163138,  -745620659),
+      simde_mm_set_epi32(         20,          13,          22,          28),
+      simde_mm_set_epi32(       -247,       35855,        -299,          -3) },
+    { simde_mm_set_epi32( -687161748, -2040592882, -1110162330, -2132131122),
+      simde_mm_set_epi32(         29,          30,          36,          36),
+      simde_mm_set_epi32(         -2,          -2,          -1,          -1) },
+    { simde_mm_set_epi32(-1236468233,  1040205976, -1607813346,  1673171249),
+      simde_mm_set_epi32(         25,           4,          11,          29),
+      simde_mm_set_epi32(        -37,    65012873,     -785066,           3) },
+    { simde_mm_set_epi32(-1262455021, -1879757549,   791425716, -1545894799),
+      simde_mm_set_epi32(          5,          32,          13,          26),
+      simde_mm_set_epi32(  -39451720,          -1,       96609,         -24) },
+    { simde_mm_set_epi32( 1642807701, -2130011262,   579790769,   466050901),
+      simde_mm_set_epi32(          5,           6,           6,          21),
+      simde_mm_set_epi32(   51337740,   -33281426,     9059230,         222) },
+    { simde_mm_set_epi32(-1658253539,  -928387603, -1035863430,   587913967),
+      simde_mm_set_epi32(         23,           3,           8,          23),
+      simde_mm_set_epi32(       -198,  -116048451,    -4046342,          70) },
+    { simde_mm_set_epi32( -458048814,  1675182569,   326413788,  -135665601),
+      simde_mm_set_epi32(         19,           4,          22,          33),
+      simde_mm_set_epi32(       -874,   104698910,          77,          -1) },
+    { simde_mm_set_epi32(  529322910,   193638493,  1498354285,   490336860),
+      simde_mm_set_epi32(         17,           0,           9,           2),
+      simde_mm_set_epi32(       4038,   193638493,     2926473,   122584215) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_srav_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_srlv_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(-6147398225264824519), INT64_C(-6730289059708792052)),
+      simde_mm_set_epi64x(INT64_C(                  28), INT64_C(                  65)),
+      simde_mm_set_epi64x(INT64_C(         45818633766), INT64_C(                   0)) },
+    { simde_mm_set_epi64x(INT64_C( 9008118349657988407), INT64_C( 5766905550516161976)),
+      simde_mm_set_epi64x(INT64_C(                  56), INT64_C(                  25)),
+      simde_mm_set_epi64x(INT64_C(                 125), INT64_C(        171867178395)) },
+    { simde_mm_set_epi64x(INT64_C(-3232727606794355412), INT64_C(-6462463738241046735)),
+      simde_mm_set_epi64x(INT64_C(-6044803787191705868), INT64_C(                  11)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(    5851699382552980)) },
+    { simde_mm_set_epi64x(INT64_C(-2972658898048289913), INT64_C(-3357178522697346985)),
+      simde_mm_set_epi64x(INT64_C(                   7), INT64_C(                  28)),
+      simde_mm_set_epi64x(INT64_C(  120891290434853607), INT64_C(         56213012155)) },
+    { simde_mm_set_epi64x(INT64_C(-3876456243313861119), INT64_C( 5633960039252807372)),
+      simde_mm_set_epi64x(INT64_C(                  56), INT64_C(                  37)),
+      simde_mm_set_epi64x(INT64_C(                 202), INT64_C(            40992454)) },
+    { simde_mm_set_epi64x(INT64_C(-5491376389666216307), INT64_C( 5924471048322245095)),
+      simde_mm_set_epi64x(INT64_C(                  21), INT64_C(                  48)),
+      simde_mm_set_epi64x(INT64_C(       6177600709935), INT64_C(               21047)) },
+    { simde_mm_set_epi64x(INT64_C(-6674972198016109214), INT64_C(-5025831250689864269)),
+      simde_mm_set_epi64x(INT64_C(                   4), INT64_C(                  31)),
+      simde_mm_set_epi64x(INT64_C(  735735742230840150), INT64_C(          6249599542)) },
+    { simde_mm_set_epi64x(INT64_C(-7008572733351615565), INT64_C( 6744171947846294706)),
+      simde_mm_set_epi64x(INT64_C(                   1), INT64_C(                  30)),
+      simde_mm_set_epi64x(INT64_C( 5719085670178968025), INT64_C(          6280999582)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_srlv_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_abs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( 21354,  14644, -24304,   1790,  -3940,  30361,   4481,  -2737,
+                            -19092, -15362, -11378, -17587,   4437,  31518,  10561,  30555),
+      simde_mm256_set_epi16( 21354,  14644,  24304,   1790,   3940,  30361,   4481,   2737,
+                             19092,  15362,  11378,  17587,   4437,  31518,  10561,  30555) },
+    { simde_mm256_set_epi16( 17085, -19683,  25102,   -286,  23830,  27750,  24949, -16771,
+                             -9918, -10068, -25566,  -6420, -10486, -16788, -31137,   1550),
+      simde_mm256_set_epi16( 17085,  19683,  25102,    286,  23830,  27750,  24949,  16771,
+                              9918,  10068,  25566,   6420,  10486,  16788,  31137,   1550) },
+    { simde_mm256_set_epi16(-26698,  -6173,  12076,  12980,   4114,  -8739,  29876,  14589,
+                            -13569, -20444, -23452,  13839,  12791,  -4388,  25347, -27783),
+      simde_mm256_set_epi16( 26698,   6173,  12076,  12980,   4114,   8739,  29876,  14589,
+                             13569,  20444,  23452,  13839,  12791,   4388,  25347,  27783) },
+    { simde_mm256_set_epi16(-32502, -25726,  18777,   5549,   7111,  24405,  25067,  16789,
+                             12804,  31675,   8846,  -6223,  -9184, -21261,   -534,  21365),
+      simde_mm256_set_epi16( 32502,  25726,  18777,   5549,   7111,  24405,  25067,  16789,
+                             12804,  31675,   8846,   6223,   9184,  21261,    534,  21365) },
+    { simde_mm256_set_epi16( 26532,  30359, -15807,  -1414, -11796, -22014, -14487, -19672,
+                            -10383,   4280,   -422,  -5169, -24591,  13686, -22165,   6229),
+      simde_mm256_set_epi16( 26532,  30359,  15807,   1414,  11796,  22014,  14487,  19672,
+                             10383,   4280,    422,   5169,  24591,  13686,  22165,   6229) },
+    { simde_mm256_set_epi16( 25561,  16873,  -5487,  26569,  -2071,  -6081,  -6990, -17710,
+                             22632,   2427,   4980, -21028,  22926, -16406,  -3126,  15266),
+      simde_mm256_set_epi16( 25561,  16873,   5487,  26569,   2071,   6081,   6990,  17710,
+                             22632,   2427,   4980,  21028,  22926,  16406,   3126,  15266) },
+    { simde_mm256_set_epi16(-14682,  32000, -19463, -24900,  20763,  13200,  -4758, -13662,
+                             12672, -28235, -18814,  -7733,  28222, -31804,  -8540,  -9853),
+      simde_mm256_set_epi16( 14682,  32000,  19463,  24900,  20763,  13200,   4758,  13662,
+                             12672,  28235,  18814,   7733,  28222,  31804,   8540,   9853) },
+    { simde_mm256_set_epi16( 31083,  -5739, -23911,  13762,  20196,   -188,  23775,    410,
+                             22674, -11223,  -5789,  14246,  19570, -26724, -15277, -32073),
+      simde_mm256_set_epi16( 31083,   5739,  23911,  13762,  20196,    188,  23775,    410,
+                             22674,  11223,   5789,  14246,  19570,  26724,  15277,  32073) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_abs_epi16(test_vec[i].a);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_abs_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( 1970317028,   301341712, -1543435953,   702060283,
+                            -1644796775,   -72481548, -1431302686,  1782132537),
+      simde_mm256_set_epi32( 1970317028,   301341712,  1543435953,   702060283,
+                             1644796775,    72481548,  1431302686,  1782132537) },
+    { simde_mm256_set_epi32( 1982592299,   869396941,  -752678050, -1922269908,
+                            -1504659592,  1011656497,  -539122106,   300391966),
+      simde_mm256_set_epi32( 1982592299,   869396941,   752678050,  1922269908,
+                             1504659592,  1011656497,   539122106,   300391966) },
+    { simde_mm256_set_epi32(-1290940329,  -692126085,  -955685215,  -781654037,
+                            -1407415557,  2004918004,  -198864503,   245674448),
+      simde_mm256_set_epi32( 1290940329,   692126085,   955685215,   781654037,
+                             1407415557,  2004918004,   198864503,   245674448) },
+    { simde_mm256_set_epi32(  207505227, -1349978049,   783550841,   658276228,
+                              690987080,  -188858355,  -974217727,  1297946125),
+      simde_mm256_set_epi32(  207505227,  1349978049,   783550841,   658276228,
+                              690987080,   188858355,   974217727,  1297946125) },
+    { simde_mm256_set_epi32( 1869010060,  -949267815, -1012648606,  -514719873,
+                               26398131, -1554138074, -1745835342, -1170167525),
+      simde_mm256_set_epi32( 1869010060,   949267815,  1012648606,   514719873,
+                               26398131,  1554138074,  1745835342,  1170167525) },
+    { simde_mm256_set_epi32( 1256418937,  1399021528,  1712759731,  1667508222,
+                            -2021106510, -1631810501,  1418267815,  1570249895),
+      simde_mm256_set_epi32( 1256418937,  1399021528,  1712759731,  1667508222,
+                             2021106510,  1631810501,  1418267815,  1570249895) },
+    { simde_mm256_set_epi32( 1082255247,  -413058256, -1545876760,  1872247385,
+                             1688029598,   386781706,   931387587,  2052253836),
+      simde_mm256_set_epi32( 1082255247,   413058256,  1545876760,  1872247385,
+                             1688029598,   386781706,   931387587,  2052253836) },
+    { simde_mm256_set_epi32( -974990436,  1178959507,    46123020,   310529015,
+                              394557271,   265255363,  2078139560,   675519348),
+      simde_mm256_set_epi32(  974990436,  1178959507,    46123020,   310529015,
+                              394557271,   265255363,  2078139560,   675519348) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_abs_epi32(test_vec[i].a);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_abs_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -31,   68,  -42,  -24,  121,   46,   26,  -12,
+                             22,  -32,  -95,  -59,   29,  -50,   78,  123,
+                            -50, -111,  -27, -112,    5,   12,   54, -115,
+                            119,  -82,   11,  -13,  -18,  -71,    2,  110),
+      simde_mm256_set_epi8(  31,   68,   42,   24,  121,   46,   26,   12,
+                             22,   32,   95,   59,   29,   50,   78,  123,
+                             50,  111,   27,  112,    5,   12,   54,  115,
+                            119,   82,   11,   13,   18,   71,    2,  110) },
+    { simde_mm256_set_epi8( -51,    2,  -19,  124, -127,  -24,  -63,   -6,
+                             80,  -43, -100,   10,   33,   32, -126,  101,
+                             14,  -57,  109,    0, -101,  126, -102,   49,
+                             57,  -79,  107,  113,   45,  -49,  -56,  -82),
+      simde_mm256_set_epi8(  51,    2,   19,  124,  127,   24,   63,    6,
+                             80,   43,  100,   10,   33,   32,  126,  101,
+                             14,   57,  109,    0,  101,  126,  102,   49,
+                             57,   79,  107,  113,   45,   49,   56,   82) },
+    { simde_mm256_set_epi8(  21,  -19,   72,  -77,   17,   73, -108,   23,
+                             -1,   -1,   12,  -68,  -30, -120,   86,  -46,
+                            -72,   29,  -25,   27, -101,  -95,   38,  -51,
+                              5,  -80,  -64,   -4, -113,  -77,  115,   -1),
+      simde_mm256_set_epi8(  21,   19,   72,   77,   17,   73,  108,   23,
+                              1,    1,   12,   68,   30,  120,   86,   46,
+                             72,   29,   25,   27,  101,   95,   38,   51,
+                              5,   80,   64,    4,  113,   77,  115,    1) },
+    { simde_mm256_set_epi8(  39,   59,   16,  -90,    0,  -21,   48,   43,
+                            -75,   -2,   -3,  -90,  -30, -101,   42,  -16,
+                            -41, -114,   42,   47,  127,   16,   78,  -77,
+                             99,  -23,   56,   41,   78,  -13,   73,  111),
+      simde_mm256_set_epi8(  39,   59,   16,   90,    0,   21,   48,   43,
+                             75,    2,    3,   90,   30,  101,   42,   16,
+                             41,  114,   42,   47,  127,   16,   78,   77,
+                             99,   23,   56,   41,   78,   13,   73,  111) },
+    { simde_mm256_set_epi8(  20,  -68,  121,  -30,  -74,  116,  -46,   99,
+                             11,   22,   99,   13,  -73,   38,   50,   37,
+                            -62,  -35,  -96,  -21,  -26,  -40,   46,  -16,
+                             69,  -83,  109,    1,   37,  -87, -122,  -86),
+      simde_mm256_set_epi8(  20,   68,  121,   30,   74,  116,   46,   99,
+                             11,   22,   99,   13,   73,   38,   50,   37,
+                             62,   35,   96,   21,   26,   40,   46,   16,
+                             69,   83,  109,    1,   37,   87,  122,   86) },
+    { simde_mm256_set_epi8(  -1,   17,  -62,   -9,  108,  118,  -83,   69,
+                            -68,  114, -121,  -36,   29,   87,   -1,    3,
+                            106,   95, -100,  120,  121,   62,  -98, -118,
+                             13,    5,  120,  -16,   87,   43,   -5, INT8_MIN),
+      simde_mm256_set_epi8(   1,   17,   62,    9,  108,  118,   83,   69,
+                             68,  114,  121,   36,   29,   87,    1,    3,
+                            106,   95,  100,  120,  121,   62,   98,  118,
+                             13,    5,  120,   16,   87,   43,    5, INT8_MIN) },
+    { simde_mm256_set_epi8(-108,   85,   45,  124,   -6,  104,  -56,   18,
+                              0,   22,   53,   26,   54,   64,   91,  -16,
+                             49,  -74,  -39,  -17,  104, -115,   53,  -73,
+                             85, -121,   24, -122,  -30,   57,   51, -127),
+      simde_mm256_set_epi8( 108,   85,   45,  124,    6,  104,   56,   18,
+                              0,   22,   53,   26,   54,   64,   91,   16,
+                             49,   74,   39,   17,  104,  115,   53,   73,
+                             85,  121,   24,  122,   30,   57,   51,  127) },
+    { simde_mm256_set_epi8( 127,  -86,  -21,  -71,  -48,  -96,  -23,  -76,
+                            -71,  112,  -10,   30, -111,  -24,   90, -124,
+                            -36,   64,   55,  -47,   23,  -88,   31,   15,
+                             55,  -67,  -69,    4,  121, -121, -123,   83),
+      simde_mm256_set_epi8( 127,   86,   21,   71,   48,   96,   23,   76,
+                             71,  112,   10,   30,  111,   24,   90,  124,
+                             36,   64,   55,   47,   23,   88,   31,   15,
+                             55,   67,   69,    4,  121,  121,  123,   83) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_abs_epi8(test_vec[i].a);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_add_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(-26021,   4814,   1520,  29613,  23893,  23901,  -4748,  -8975,
+                            -27031,  29365, -16305,   4096,  32327, -10286,  27020,  -7678),
+      simde_mm256_set_epi16( 16806, -22901,   7565, -25722, -14442, -19470, -18153, -13224,
+                            -26269, -24179,   5736,  -6252,  -5484,  26968,   7779,   1721),
+      simde_mm256_set_epi16( -9215, -18087,   9085,   3891,   9451,   4431, -22901, -22199,
+                             12236,   5186, -10569,  -2156,  26843,  16682, -30737,  -5957) },
+    { simde_mm256_set_epi16( -5410,  -8518,  22536, -26531,   -103,  15890,  25941,  -6969,
+                            -24043,  10028, -15363,  -8404, -24339,    239,   6960,  23950),
+      simde_mm256_set_epi16( -3985,   6851,  20749,  -8064,   8435,  27351,  10123,  11698,
+                             -4556,  -5809, -13198,  12374, -23579, -27585, -10397,   8569),
+      simde_mm256_set_epi16( -9395,  -1667, -22251,  30941,   8332, -22295, -29472,   4729,
+                            -28599,   4219, -28561,   3970,  17618, -27346,  -3437,  32519) },
+    { simde_mm256_set_epi16(-26817,  10505, -30847, -22313,   -813,   5697, -31928,   9363,
+                             15635, -30454,   4567, -10018,  -7994, -28879,  32626,   6756),
+      simde_mm256_set_epi16( 18764,  -5279,  21275, -21469, -27805,   5845, -20561,   1106,
+                            -23499,   3197,  12889,   6118, -22509,  15963,   7798, -32286),
+      simde_mm256_set_epi16( -8053,   5226,  -9572,  21754, -28618,  11542,  13047,  10469,
+                             -7864, -27257,  17456,  -3900, -30503, -12916, -25112, -25530) },
+    { simde_mm256_set_epi16(-19979,  -9212, -31783,  29010, -20096, -11765, -27558,  12402,
+                            -30526, -27088, -22158,  12469, -31512,  28039,  14602,  23526),
+      simde_mm256_set_epi16(-25149,  26301,  11952, -28131,  -8741,   1346,  17365,  -5372,
+                              3468,  -6445,  -6903,   6708,  -5717, -15222,  28803,   8747),
+      simde_mm256_set_epi16( 20408,  17089, -19831,    879, -28837, -10419, -10193,   7030,
+                            -27058,  32003, -29061,  19177,  28307,  12817, -22131,  32273) },
+    { simde_mm256_set_epi16( 22073,   2322,   4611,   6605, -30266, -29880, -15477,  21386,
+                            -29390, -21598,  -9220,  -4087,   2269,   4653, -21343, -16576),
+      simde_mm256_set_epi16( -4754,   2778,  -1584, -26168,  17816, -16265, -11240, -22460,
+                              4829, -10241,   5544, -22475,  22760,  32392,  11315,  17058),
+      simde_mm256_set_epi16( 17319,   5100,   3027, -19563, -12450,  19391, -26717,  -1074,
+                            -24561, -31839,  -3676, -26562,  25029, -28491, -10028,    482) },
+    { simde_mm256_set_epi16(-20790,  -3383, -21290,  23216,  15633, -19054,  30505,  -4044,
+                             17129,  -1325, -19174,  23895,   2168,  26490,   9718,  10174),
+      simde_mm256_set_epi16( 16882, -12114,  -6759, -30312,  26211,  29435, -26995,  -6340,
+                            -27839, -29995, -18701,  26430,   3699,   7318,  32612, -16339),
+      simde_mm256_set_epi16( -3908, -15497, -28049,  -7096, -23692,  10381,   3510, -10384,
+                            -10710, -31320,  27661, -15211,   5867, -31728, -23206,  -6165) },
+    { simde_mm256_set_epi16( 13073,  18707, -25527, -27827, -32045,  16967, -19189, -30794,
+                              9437,  10553, -32606,   2753,  13078, -25221, -13761,  -7933),
+      simde_mm256_set_epi16(  9628,  -5168,   7820, -29655,  13831, -10363, -15694, -10072,
+                            -14624,    535,  27793,   -875, -15526,  26325, -12117, -16970),
+      simde_mm256_set_epi16( 22701,  13539, -17707,   8054, -18214,   6604,  30653,  24670,
+                             -5187,  11088,  -4813,   1878,  -2448,   1104, -25878, -24903) },
+    { simde_mm256_set_epi16( 32111, -16597, -32707,   2967,  26482,  25657,  -1544,   6501,
+                               942, -17535, -17831, -31349,   6790,  -9353,  -3128,    467),
+      simde_mm256_set_epi16(-14029,  25107, -14433,  12044, -22384, -12277,  -2005,  14895,
+                             -8257,  27187,  14309, -31228, -19868,  27113, -30066, -26692),
+      simde_mm256_set_epi16( 18082,   8510,  18396,  15011,   4098,  13380,  -3549,  21396,
+                             -7315,   9652,  -3522,   2959, -13078,  17760,  32342, -26225) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_add_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_add_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-2081645151, -1458475046,   -56032025,  1814308602,
+                              827100006,  1180488054, -1532300361,  1536242448),
+      simde_mm256_set_epi32(-1571294312,  -406503526,  1903580642,  -910594502,
+                            -1483636357,   847958603,  -633438291,   222875442),
+      simde_mm256_set_epi32(  642027833, -1864978572,  1847548617,   903714100,
+                             -656536351,  2028446657,  2129228644,  1759117890) },
+    { simde_mm256_set_epi32( 2035127801,   218715768, -1499182287,  -181296958,
+                              410558169,  2094235715,   913768502,   841373643),
+      simde_mm256_set_epi32( -111941296,  1501011347, -1581329539, -2058433462,
+                             -888634635,   553956824,   869951099, -1731751034),
+      simde_mm256_set_epi32( 1923186505,  1719727115,  1214455470,  2055236876,
+                             -478076466, -1646774757,  1783719601,  -890377391) },
+    { simde_mm256_set_epi32( 2001940899,  -251644800,     2482041,  -992939090,
+                            -1142081373,   890945555,    96101504,  1316349846),
+      simde_mm256_set_epi32(  694244246,  1678507619, -1086411614,  1743530475,
+                              -50366792,  1326778518,  1629995381,  1950467229),
+      simde_mm256_set_epi32(-1598782151,  1426862819, -1083929573,   750591385,
+                            -1192448165, -2077243223,  1726096885, -1028150221) },
+    { simde_mm256_set_epi32( 2004721430,   561801323,  -881217721, -2006423242,
+                            -1628134991, -1926692439,  1628103198,   835502509),
+      simde_mm256_set_epi32(-1040546784, -1374771019, -1798457410,  -596104155,
+                             -823111792,  -781049867,   657129729, -1717139401),
+      simde_mm256_set_epi32(  964174646,  -812969696,  1615292165,  1692439899,
+                             1843720513,  1587224990, -2009734369,  -881636892) },
+    { simde_mm256_set_epi32( 1318257868,  -463761220,  -928118141,  1325247076,
+                             1049334912,  1531168886,   172392187,  1611379884),
+      simde_mm256_set_epi32(  933985864,   570811421, -1602892942,   944915117,
+                              464636889,  1098346332,  1309998463,  1431579672),
+      simde_mm256_set_epi32(-2042723564,   107050201,  1763956213, -2024805103,
+                             1513971801, -1665452078,  1482390650, -1252007740) },
+    { simde_mm256_set_epi32( 1836130525,  1253289531,  1850232665, -1702744845,
+                             -101000315, -1041390299,  1753821881, -1962416316),
+      simde_mm256_set_epi32(-1729388632, -2046533378,  -904077580,   -43771082,
+                            -1577824501,  -802716805,  -518001600,  -784918140),
+      simde_mm256_set_epi32(  106741893,  -793243847,   946155085, -1746515927,
+                            -1678824816, -1844107104,  1235820281,  1547632840) },
+    { simde_mm256_set_epi32( 2123373507,  1547587514, -1208453784,  -970602567,
+                             1394512378,  2064802828, -1648986541, -1865789838),
+      simde_mm256_set_epi32( 1124124467,  1796610639,  1856743068,  2012627225,
+                             1950857672,  1448308219,  2069383759,  1628111161),
+      simde_mm256_set_epi32(-1047469322,  -950769143,   648289284,  1042024658,
+                             -949597246,  -781856249,   420397218,  -237678677) },
+    { simde_mm256_set_epi32(-1398725314,    98876069, -1106646572,  -146016069,
+                            -1601060488,  1132970466,  -240518305, -1278332970),
+      simde_mm256_set_epi32(  690872701,  -841782445,  -475565369,  -424398974,
+                             1503070753,   334879311,  1737064234,   550510258),
+      simde_mm256_set_epi32( -707852613,  -742906376, -1582211941,  -570415043,
+                              -97989735,  1467849777,  1496545929,  -727822712) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_add_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_add_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-3276502438092555194), INT64_C(-3677651146139134800),
+                             INT64_C( 2947207459774896587), INT64_C(-8155612196047886688)),
+      simde_mm256_set_epi64x(INT64_C(-1143639125619027015), INT64_C(-2679427173267717702),
+                             INT64_C(-4130093871329009880), INT64_C(-1043523837062780659)),
+      simde_mm256_set_epi64x(INT64_C(-4420141563711582209), INT64_C(-6357078319406852502),
+                             INT64_C(-1182886411554113293), INT64_C(-9199136033110667347)) },
+    { simde_mm256_set_epi64x(INT64_C( 3506448460106546595), INT64_C(-3147778929872586701),
+                             INT64_C(  -70128518615803153), INT64_C( 5172540418091928723)),
+      simde_mm256_set_epi64x(INT64_C( -890565047258242104), INT64_C( 8877878252817323120),
+                             INT64_C(-7651305320974529607), INT64_C(-2065984280885137494)),
+      simde_mm256_set_epi64x(INT64_C( 2615883412848304491), INT64_C( 5730099322944736419),
+                             INT64_C(-7721433839590332760), INT64_C( 3106556137206791229)) },
+    { simde_mm256_set_epi64x(INT64_C( 6560161392379352394), INT64_C(-2087362416307545154),
+                             INT64_C(-4602906160375900439), INT64_C( 4610702207583211319)),
+      simde_mm256_set_epi64x(INT64_C(-8348444033524846647), INT64_C(-6685863517920343865),
+                             INT64_C( 8693145805617745236), INT64_C(-1439374975783520027)),
+      simde_mm256_set_epi64x(INT64_C(-1788282641145494253), INT64_C(-8773225934227889019),
+                             INT64_C( 4090239645241844797), INT64_C( 3171327231799691292)) },
+    { simde_mm256_set_epi64x(INT64_C( 6332912106680377148), INT64_C(-5457863664389491350),
+                             INT64_C(-4915112148807867046), INT64_C(-3502113149438067384)),
+      simde_mm256_set_epi64x(INT64_C(-4800323206645672271), INT64_C(-5677524926964758602),
+                             INT64_C(-5173786707080590496), INT64_C( 7143165780760015688)),
+      simde_mm256_set_epi64x(INT64_C( 1532588900034704877), INT64_C( 7311355482355301664),
+                             INT64_C( 8357845217821094074), INT64_C( 3641052631321948304)) },
+    { simde_mm256_set_epi64x(INT64_C(-6516966429473242801), INT64_C(  771071141492232527),
+                             INT64_C(-3492025864933170743), INT64_C(-3294663373754965524)),
+      simde_mm256_set_epi64x(INT64_C(  465796493983246511), INT64_C(  910884005743659062),
+                             INT64_C( 8894728971496625052), INT64_C( -943722324411034353)),
+      simde_mm256_set_epi64x(INT64_C(-6051169935489996290), INT64_C( 1681955147235891589),
+                             INT64_C( 5402703106563454309), INT64_C(-4238385698165999877)) },
+    { simde_mm256_set_epi64x(INT64_C(  333596663075571681), INT64_C( 8307567900524849480),
+                             INT64_C(-7278473340627279718), INT64_C(-8891034022372336636)),
+      simde_mm256_set_epi64x(INT64_C(-2118614157127549191), INT64_C( 2778223687192146101),
+                             INT64_C(-6211033162315449871), INT64_C( 7121837588811055012)),
+      simde_mm256_set_epi64x(INT64_C(-1785017494051977510), INT64_C(-7360952485992556035),
+                             INT64_C( 4957237570766822027), INT64_C(-1769196433561281624)) },
+    { simde_mm256_set_epi64x(INT64_C( 7384881840099963301), INT64_C(-4281553793796622660),
+                             INT64_C( 3827207677150570847), INT64_C(-5900000431010085006)),
+      simde_mm256_set_epi64x(INT64_C( 8097325103820335458), INT64_C(  209922772338627680),
+                             INT64_C( 3679988405843718343), INT64_C( 6809188912603804776)),
+      simde_mm256_set_epi64x(INT64_C(-2964537129789252857), INT64_C(-4071631021457994980),
+                             INT64_C( 7507196082994289190), INT64_C(  909188481593719770)) },
+    { simde_mm256_set_epi64x(INT64_C( 4789549096436071199), INT64_C( 2849876668747697677),
+                             INT64_C(-9038550319126205868), INT64_C(-8091267207610691252)),
+      simde_mm256_set_epi64x(INT64_C( 4073951132673681191), INT64_C( 6603379275618125938),
+                             INT64_C(  295640429691675545), INT64_C( 7773915461762706943)),
+      simde_mm256_set_epi64x(INT64_C( 8863500229109752390), INT64_C(-8993488129343728001),
+                             INT64_C(-8742909889434530323), INT64_C( -317351745847984309)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_add_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_add_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(  95,  -72,  116,  -23,  -35,  114,  -85,  -34,
+                            -10,  -26,   76,  -87,   92,  -75,   87, -104,
+                             32,   20,   98,  122, -125,   98,  121,   82,
+                            -37,  117,  -69,   49,   66,  -47,   19,  -93),
+      simde_mm256_set_epi8(  28,  -31,   33,  118, -116,  -92,   62,  -99,
+                            -34,   33,   45,  -37,   -6,  104,   82,   36,
+                            -73,  -42,   13,  121,  -15,   37,   82,  -32,
+                            -28,  100,   19,  -24,  -31,   51,  124,   51),
+      simde_mm256_set_epi8( 123, -103, -107,   95,  105,   22,  -23,  123,
+                            -44,    7,  121, -124,   86,   29,  -87,  -68,
+                            -41,  -22,  111,  -13,  116, -121,  -53,   50,
+                            -65,  -39,  -50,   25,   35,    4, -113,  -42) },
+    { simde_mm256_set_epi8( -30,   83, -115,  -36,   73,   32,  -50,   -3,
+                            -36,  119,    7,   53,    0, -111, -116,   72,
+                            -26, -108,   70,  -23,  -94,  -12,   78,  114,
+                            -62,   40,  102,  -47,  -39,  -76,   56,  123),
+      simde_mm256_set_epi8( -44,  -23,   55,  -19,  -63,   30,   41,   43,
+                            -94,  -36,   67,  126,   15,  -61,  -96,  -68,
+                            -73, INT8_MIN,   58,  101,  -93,   29,  -67,  -50,
+                            103,  -30, -100,  -82,   33,  125,   60,  -39),
+      simde_mm256_set_epi8( -74,   60,  -60,  -55,   10,   62,   -9,   40,
+                            126,   83,   74,  -77,   15,   84,   44,    4,
+                            -99,   20, INT8_MIN,   78,   69,   17,   11,   64,
+                             41,   10,    2,  127,   -6,   49,  116,   84) },
+    { simde_mm256_set_epi8(  31,  -26,  106,  -25,  -32,  -78,   65,   26,
+                            -86,  111,  -59,  -47,  -54,  118,   80,   27,
+                             15,   93,   89,   21,  -76,   23,  -87,   98,
+                            -36,  -51,  -47,   25,  -87,    0,  -71,  -71),
+      simde_mm256_set_epi8(  99,  -91,   51,  -19, -102,   11, -107,  -64,
+                             23, -119,  -65,  -10,   20,  -62,  101,   72,
+                           -116,  -26,  -71,   25,  -82,   -5,   51,  -66,
+                            -23,  117,  -18,   -4,   10,  -33, -123,  -98),
+      simde_mm256_set_epi8(-126, -117,  -99,  -44,  122,  -67,  -42,  -38,
+                            -63,   -8, -124,  -57,  -34,   56,  -75,   99,
+                           -101,   67,   18,   46,   98,   18,  -36,   32,
+                            -59,   66,  -65,   21,  -77,  -33,   62,   87) },
+    { simde_mm256_set_epi8( 112,  -52, -100,   42, -119,   65,  -88,  -77,
+                            -87,  -91,  -53,   99,   99,  -77,   96,   35,
+                            -45,  105, -109,  108,   26,  -67,   10,  -63,
+                            -97, -118,   96,   24,   12,  -57,   84,  -70),
+      simde_mm256_set_epi8(  65, -120,   27,  -48,  -49,  -16,  -26,    9,
+                             20, -125,   14,   77,   83,   -1,  115,  -53,
+                             -5,   34,  -88,    7,  -99,    2,   85,  -90,
+                            -15,  -26,   88,  125,  -18,   23,  123,   67),
+      simde_mm256_set_epi8( -79,   84,  -73,   -6,   88,   49, -114,  -68,
+                            -67,   40,  -39,  -80,  -74,  -78,  -45,  -18,
+                            -50, -117,   59,  115,  -73,  -65,   95,  103,
+                           -112,  112,  -72, -107,   -6,  -34,  -49,   -3) },
+    { simde_mm256_set_epi8( -23,  -70,   61,   27, -108,  113,  116,   40,
+                             53,  100,  -21,  -83,  -19,  -71, -107,   28,
+                           -116, -102,   60, -113,  -59, -106,   87,   49,
+                            -14,  -57,  -23,  114,   30,   43,  -67, -116),
+      simde_mm256_set_epi8(  77,   74,   39,   74,  -18,  -83,  100,   38,
+                             28,   89,  -37,  109, -107,  103, -123,   90,
+                             47,  -56,  -56,   86,   80,   70,  -34,  -44,
+                             91,  -96,   91,  -35,  -24,   72,   21,  -87),
+      simde_mm256_set_epi8(  54,    4,  100,  101, -126,   30,  -40,   78,
+                             81,  -67,  -58,   26, -126,   32,   26,  118,
+                            -69,   98,    4,  -27,   21,  -36,   53,    5,
+                             77,  103,   68,   79,    6,  115,  -46,   53) },
+    { simde_mm256_set_epi8(  36,  -18,   -8,  123,  -82,  124,  -54,   83,
+                           -116,  -66,    7,   65, -105,  -48,  -22,    5,
+                              1,   77, -123,   46,  -76,  -39,   25,   -9,
+                            -98,   81,  -63,  112,  -28,  -65,  -36,   14),
+      simde_mm256_set_epi8(  99, -107,   -2,  -54,  113,  -59,    8,  -18,
+                            -99,  -96,  -87,  -24,  -30,  118,    5, -107,
+                             88,   -4,   60,  -84,   41,  -65,  -29,   38,
+                             72,  -61,  -23,   56,   68,   68,  -39,   19),
+      simde_mm256_set_epi8(-121, -125,  -10,   69,   31,   65,  -46,   65,
+                             41,   94,  -80,   41,  121,   70,  -17, -102,
+                             89,   73,  -63,  -38,  -35, -104,   -4,   29,
+                            -26,   20,  -86,  -88,   40,    3,  -75,   33) },
+    { simde_mm256_set_epi8( -58,   99,   64,   74, -100,   97,   32,  -71,
+                             70, -116,   14,  -97,   71,  -96,   12,   28,
+                            -29,  -38, -101,   41,  112,    5,  -40,  -61,
+                             61, -111, -114,   70,  -89,  107,    2,  -19),
+      simde_mm256_set_epi8(  75,   35,  -45,  -82,   11,  -66,  -11, -121,
+                           -105,   54,   63,   25,   65,  -91,  109, -112,
+                           -102,  -25,  102,   -5,  -24,  -79,  127,   -6,
+                            -39,  -13,   74,  -43,  -58,   92,    3,  102),
+      simde_mm256_set_epi8(  17, -122,   19,   -8,  -89,   31,   21,   64,
+                            -35,  -62,   77,  -72, -120,   69,  121,  -84,
+                            125,  -63,    1,   36,   88,  -74,   87,  -67,
+                             22, -124,  -40,   27,  109,  -57,    5,   83) },
+    { simde_mm256_set_epi8( -61,  -11,  -90,   77, -108,  -44,  -37,   43,
+                            -84,  -21,   92,   43,   95,   39,  -71,  -27,
+                           -126,  -29,  -38,   59, -126,  -35,  -57,  -17,
+                             13,   24,   53,  107,   82,  -37,  -68,  -22),
+      simde_mm256_set_epi8(   8,  -53,  123,   81,  105,   -3,  -79,  -93,
+                            -79,   43, -114,   63,  -95,  -91,  113,   20,
+                            -28,  -92,   62,   91,   43,  -93,   19,   41,
+                             29,  -18,  -83,   28,  -68,  -29,  -30, -121),
+      simde_mm256_set_epi8( -53,  -64,   33,  -98,   -3,  -47, -116,  -50,
+                             93,   22,  -22,  106,    0,  -52,   42,   -7,
+                            102, -121,   24, -106,  -83, INT8_MIN,  -38,   24,
+                             42,    6,  -30, -121,   14,  -66,  -98,  113) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_add_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_adds_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(-18951,  32718, -17439,   -290, -10670,  16584,  30862,   6688,
+                            -19566,  20200,  23187,  25856,  20049,   9423,  -8895, -31190),
+      simde_mm256_set_epi16( 20018,  -4822,   6958,  21693,    731, -23178,   7990, -22173,
+                             -1443,  20637,    527,  -5710,  -1692,  18701,   -677, -30863),
+      simde_mm256_set_epi16(  1067,  27896, -10481,  21403,  -9939,  -6594,  32767, -15485,
+                            -21009,  32767,  23714,  20146,  18357,  28124,  -9572, INT16_MIN) },
+    { simde_mm256_set_epi16(-27655,   4108,  12870, -22716,   2253,  -5717, -17933,   6972,
+                              8533,   1975, -26360, -29028,  -2013,  21112, -20041,   2245),
+      simde_mm256_set_epi16( 27756,   3776, -26728,   8595, -21364,  -5531, -15251, -23673,
+                             25137,  21203,   3672,  15397,  -4259,  18846, -15030,  30924),
+      simde_mm256_set_epi16(   101,   7884, -13858, -14121, -19111, -11248, INT16_MIN, -16701,
+                             32767,  23178, -22688, -13631,  -6272,  32767, INT16_MIN,  32767) },
+    { simde_mm256_set_epi16(-27263, -29872,  21046,  -3956, -16952,    761,   -637,  28933,
+                              8729,  21749,  25369,  -4621, -11348, -19087,   2975,   7943),
+      simde_mm256_set_epi16(-19228, -11020,    542,   3720, -20299,  28874, -32641,   1087,
+                             12586,  20748, -24298,  -7859, -23987,   2484,  -2450, -22803),
+      simde_mm256_set_epi16(INT16_MIN, INT16_MIN,  21588,   -236, INT16_MIN,  29635, INT16_MIN,  30020,
+                             21315,  32767,   1071, -12480, INT16_MIN, -16603,    525, -14860) },
+    { simde_mm256_set_epi16(-12207,  32674,   2767, -28872,  -5294,  22888,   2783,  29264,
+                              9343,  -7896,  12461,  -6729,  -7596,  27493,  21610,  11420),
+      simde_mm256_set_epi16(-11569, -23471,  12035,  13385, -16004,  -6519,   6541, -31021,
+                            -17371,  13372,  21707, -28156, -30572,  18245,  31171,  -4455),
+      simde_mm256_set_epi16(-23776,   9203,  14802, -15487, -21298,  16369,   9324,  -1757,
+                             -8028,   5476,  32767, INT16_MIN, INT16_MIN,  32767,  32767,   6965) },
+    { simde_mm256_set_epi16(  7050, -16588,   7515,  17295,  -7757, -14638,   5913,  26305,
+                             -4009,  -2910,  -9846,  -2506,  22790, -27262,  18965,   3054),
+      simde_mm256_set_epi16(-23572,  27720,   8044,  23174, -10973,  -9125,  14243,  -8019,
+                            -20490,  30164,  25276,   3443,  21409,  17205,  15143, -14323),
+      simde_mm256_set_epi16(-16522,  11132,  15559,  32767, -18730, -23763,  20156,  18286,
+                            -24499,  27254,  15430,    937,  32767, -10057,  32767, -11269) },
+    { simde_mm256_set_epi16(  -515,  20934,  16619, -18030,  14317,   6801,  16821,   7493,
+                             28483,  32224,  -2739,  32629,  32619,  -8073,  -4244,  20997),
+      simde_mm256_set_epi16( -2690,  -7409,    899,  19973,   -891,  -6099, -16224,  -1767,
+                            -26166,   9410,  32188, -25158, -24892,  22202,  16058, -16582),
+      simde_mm256_set_epi16( -3205,  13525,  17518,   1943,  13426,    702,    597,   5726,
+                              2317,  32767,  29449,   7471,   7727,  14129,  11814,   4415) },
+    { simde_mm256_set_epi16(-19882,   8230, -16181,  19962,  23259,  28808,  -3262,  26858,
+                            -20256,  -2790,  18411, -15276,  13189,  -2525,  28342, -26010),
+      simde_mm256_set_epi16( -6388,   4272, -25741,  32217,  -4356,  29851,  28925,  23061,
+                             14622,  -5457, -23042,  21490,  -2489,   9002,   2010,   1350),
+      simde_mm256_set_epi16(-26270,  12502, INT16_MIN,  32767,  18903,  32767,  25663,  32767,
+                             -5634,  -8247,  -4631,   6214,  10700,   6477,  30352, -24660) },
+    { simde_mm256_set_epi16(-27874,   3016, -10670, -15566,   2670,  25231,  -9443,  13705,
+                             -7089,  -1036, -29646,  10376, -30431,  14992,   5450,  10826),
+      simde_mm256_set_epi16(-31233,  -3607, -25285, -30247,  32271, -25825, -12587,  -8749,
+                             13345,  31945,  23647,  -5528, -11501,  11095,  29153,  16964),
+      simde_mm256_set_epi16(INT16_MIN,   -591, INT16_MIN, INT16_MIN,  32767,   -594, -22030,   4956,
+                              6256,  30909,  -5999,   4848, INT16_MIN,  26087,  32767,  27790) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_adds_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_adds_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(-107, -120,   24,   34,  110,   75,   19, -113,
+                            -17,  122,   42,   49, -104,  -48,  -43,  -52,
+                             -6,   18,  121,   78,  102, -115,  118,  -52,
+                              4,  111,   28,   -5,   66,  127,  -94,    2),
+      simde_mm256_set_epi8(  76,  -45,   55, -113,  -98,   82,    4,  -66,
+                            122,  -76,  -69, -112,   78, -110,  -35,   69,
+                             61,  -97,  107,  114,   35,   52,  116,  -46,
+                            -59,  -61, -118, INT8_MIN,  -57,   86, -116,  104),
+      simde_mm256_set_epi8( -31, INT8_MIN,   79,  -79,   12,  127,   23, INT8_MIN,
+                            105,   46,  -27,  -63,  -26, INT8_MIN,  -78,   17,
+                             55,  -79,  127,  127,  127,  -63,  127,  -98,
+                            -55,   50,  -90, INT8_MIN,    9,  127, INT8_MIN,  106) },
+    { simde_mm256_set_epi8(  59,   30,  -26,   78,  117,  -58, -106,   55,
+                            -60,  -55,  -77,   85, -111,    0,  115,  -93,
+                            -82,  -59, -122,  -93,  -49,  101,   86, -122,
+                           -127,  112,   81,  -78,   96,    5,  -64,   16),
+      simde_mm256_set_epi8( -66,    7,  -45,   72,   68,   78,    9,  -16,
+                            120,  -93,  -31,   80,  -91, -100,  -62,  -56,
+                             89,   31,   47,  125,   34,   29,  -41,   82,
+                             40,    4,   66,  -61,   48,  -96,   25,  -46),
+      simde_mm256_set_epi8(  -7,   37,  -71,  127,  127,   20,  -97,   39,
+                             60, INT8_MIN, -108,  127, INT8_MIN, -100,   53, INT8_MIN,
+                              7,  -28,  -75,   32,  -15,  127,   45,  -40,
+                            -87,  116,  127, INT8_MIN,  127,  -91,  -39,  -30) },
+    { simde_mm256_set_epi8(  42,   -8,   75, -116,  112,   -1,  -47,   36,
+                            -88,    4,  108,  123, INT8_MIN,  -93,   50, -111,
+                            -97,   64,  -44,   -2,  -21,  110, -110,  -13,
+                            -13, -109, -104,  114,  -75,   67,   -1,  -77),
+      simde_mm256_set_epi8(  62, -125,  -91,  -87,  -97,   58,  126,  -82,
+                             61, -111,  110,   52,   28, -114,   55,  -72,
+                            -87,   75,   86,  -41,   -4,  115,    6,  -80,
+                             40,  -37,  -95,  115, -122,  -96,  -92,    8),
+      simde_mm256_set_epi8( 104, INT8_MIN,  -16, INT8_MIN,   15,   57,   79,  -46,
+                            -27, -107,  127,  127, -100, INT8_MIN,  105, INT8_MIN,
+                           INT8_MIN,  127,   42,  -43,  -25,  127, -104,  -93,
+                             27, INT8_MIN, INT8_MIN,  127, INT8_MIN,  -29,  -93,  -69) },
+    { simde_mm256_set_epi8( 122, -108,  102,   22,    8,   87,   64,  -76,
+                            -97,   37,  -95,   52,  119,  119,  -95,   97,
+                            -10,   73,   58,   17,  -24,  -16,   10,  -76,
+                            -60,  -32,   88,   23,  -74,  -89,   34,  -51),
+      simde_mm256_set_epi8( -12,  -16,   57,   64,   23,  106, INT8_MIN,   40,
+                            105,  -34, -109,   94,   26, -113,   73,  -62,
+                            -20,  121,  114,   31,   75,   60,  117,  107,
+                           -121,  -45,  -46,   43,  -77,   68,  -46,  -96),
+      simde_mm256_set_epi8( 110, -124,  127,   86,   31,  127,  -64,  -36,
+                              8,    3, INT8_MIN,  127,  127,    6,  -22,   35,
+                            -30,  127,  127,   48,   51,   44,  127,   31,
+                           INT8_MIN,  -77,   42,   66, INT8_MIN,  -21,  -12, INT8_MIN) },
+    { simde_mm256_set_epi8( -12,   45,   28,    1,  -50,   49,   94,   27,
+                             54,  -34, -113,   19,  -54, -118,    4,   34,
+                            103, -123, -123,  -66,  -60,   89,  -54, -110,
+                             62,   67,  -64,  -55,   89,    7,   49,  -18),
+      simde_mm256_set_epi8( -98,  -18, -106, -115,  126,  -86,  108,  -30,
+                           -104,  -14,  122,  -35,   34,  -18,   19,   48,
+                             48,  -52,   80,  117,  120,  -47,   27,   91,
+                            -25,   17, -121,  -23,  100,   62,  -21,  -76),
+      simde_mm256_set_epi8(-110,   27,  -78, -114,   76,  -37,  127,   -3,
+                            -50,  -48,    9,  -16,  -20, INT8_MIN,   23,   82,
+                            127, INT8_MIN,  -43,   51,   60,   42,  -27,  -19,
+                             37,   84, INT8_MIN,  -78,  127,   69,   28,  -94) },
+    { simde_mm256_set_epi8( 118,  -20, -101,   36,   90,    0,  113,   17,
+                             87,   51, -111, -126,  -46,   -7,    4,  -60,
+                           -113, INT8_MIN,  -68,   -3,  -25,   75,  -46,   88,
+                            -41,  -43,   29,  -36,   22,  -56,   15,  -91),
+      simde_mm256_set_epi8(-104,   57,  122,  -71, -115,  -42,   67,  -99,
+                             41,   48,  -48,   97,  -24,   38,   85,  -58,
+                            117,  -25,  -52,  -94,  -91,   81,   42,   -3,
+                            117, -107, -102,   40, -110,   23,  -24,   55),
+      simde_mm256_set_epi8(  14,   37,   21,  -35,  -25,  -42,  127,  -82,
+                            127,   99, INT8_MIN,  -29,  -70,   31,   89, -118,
+                              4, INT8_MIN, -120,  -97, -116,  127,   -4,   85,
+                             76, INT8_MIN,  -73,    4,  -88,  -33,   -9,  -36) },
+    { simde_mm256_set_epi8(  86,  -22,  122, -116,   92,   30,   32,  -29,
+                             49,  -91,   73,    0,   22,  -35,  -96,  -34,
+                           -112,  -34,   13, -100,  -11,   46,  101,    4,
+                             -3,  -92,  -42, -121,    0,   70,  121,   58),
+      simde_mm256_set_epi8(  -7,   40,  116,  -66,  -21,  -46,    1,   33,
+                            -81,  -21,  -61,  -22,   48,   72,   83,   98,
+                            -82,  -40,   69,  -54,  -15, INT8_MIN,  -59,   34,
+                           -125,   94,   61,   50,  -79,  -23,  -65,   10),
+      simde_mm256_set_epi8(  79,   18,  127, INT8_MIN,   71,  -16,   33,    4,
+                            -32, -112,   12,  -22,   70,   37,  -13,   64,
+                           INT8_MIN,  -74,   82, INT8_MIN,  -26,  -82,   42,   38,
+                           INT8_MIN,    2,   19,  -71,  -79,   47,   56,   68) },
+    { simde_mm256_set_epi8(  84,  -93,   83,   89,  -36, -111,  -15,  -54,
+                            114,  -25,   16,  104, -117, -120,  -57,   57,
+                           -103,    8,   42,  -48,   24,   49,  -39,   43,
+                            -28,   92,   58,   39,  126, -120,  -91,  -95),
+      simde_mm256_set_epi8(  26,   97,   97,  -73,  -78,  103, -124, -124,
+                           -109,  106,  -76,  111,   46,   15,  127,  -41,
+                             44,  -93,  -34,   88, -120,  -49,   -5,    4,
+                            -46, INT8_MIN,  -86,    4,   63,  -62,   91,   34),
+      simde_mm256_set_epi8( 110,    4,  127,   16, -114,   -8, INT8_MIN, INT8_MIN,
+                              5,   81,  -60,  127,  -71, -105,   70,   16,
+                            -59,  -85,    8,   40,  -96,    0,  -44,   47,
+                            -74,  -36,  -28,   43,  127, INT8_MIN,    0,  -61) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_adds_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_adds_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( -9137,  -7492,  -6116, -24688, -27972,   -695, -32517,   2020,
+                              8082, -15109,  29560,  28803, -13280,   7252,  27221,  -4870),
+      simde_mm256_set_epi16( 19042, -14396, -19981, -19598,  25458, -19512,  29961,  17422,
+                             29324, -27903,   -453, -23861,  15981, -20423,  27942,   4176),
+      simde_mm256_set_epi16(    -1,     -1,     -1,     -1,  -2514,     -1,  -2556,  19442,
+                            -28130,     -1,     -1,     -1,     -1, -13171, -10373,   -694) },
+    { simde_mm256_set_epi16( 23432, -21048,  10113,  20806,  11437,  20968,   7501,  24790,
+                             24381,   8499, -23184, -27970,  18232,  -4478,   4240, -16004),
+      simde_mm256_set_epi16(-30359, -25389,  17271,  26964,  -7552,  -1181,   5724,  26917,
+                             28955,     57,  15661,   9217,  27329, -22284,  -1188,  31404),
+      simde_mm256_set_epi16( -6927,     -1,  27384, -17766,     -1,     -1,  13225, -13829,
+                            -12200,   8556,  -7523, -18753, -19975,     -1,     -1,     -1) },
+    { simde_mm256_set_epi16(-12654, -18129,  -5998,  -9245, -27817,  28601, -15515,  20530,
+                            -11261, -29106, -29556,     72, -30453,  22623, -13510,  30329),
+      simde_mm256_set_epi16( 25624,   3109, -14949, -22694,  11147,  14033, -29898, -18608,
+                             27770, -20130,   7352, -10910,  14963, -15939,   8422, -31413),
+      simde_mm256_set_epi16(    -1, -15020,     -1,     -1, -16670, -22902,     -1,     -1,
+                                -1,     -1, -22204, -10838, -15490,     -1,  -5088,  -1084) },
+    { simde_mm256_set_epi16(-17118, -29523,  13177, -29959,  30096, -25230,  25932,  11055,
+                             16689,  30257,  23059,  28951, -15453,  19195, -15395,   3316),
+      simde_mm256_set_epi16( -6151, -21324,   -973,  -7956,   7582,   2075,  32156,   2210,
+                              8115,    702,  -3926,  12266, -29954,  15825,   6198,  26644),
+      simde_mm256_set_epi16(    -1,     -1,     -1,     -1, -27858, -23155,  -7448,  13265,
+                             24804,  30959,     -1, -24319,     -1, -30516,  -9197,  29960) },
+    { simde_mm256_set_epi16(-25371, -12944,   1793,   7214,   6730,   4445,  29844, -30222,
+                            -11494,   7592,  13470,   1334,  23133,  13829,  31332,  -6508),
+      simde_mm256_set_epi16( 14154,  20499, -28097,  28816, -29916,  31060,  16413,   -961,
+                             13043, -30591, -28006, -18289, -22929,   5691,  -6226,   6095),
+      simde_mm256_set_epi16(-11217,     -1, -26304, -29506, -23186, -30031, -19279,     -1,
+                                -1, -22999, -14536, -16955,     -1,  19520,     -1,   -413) },
+    { simde_mm256_set_epi16( 32547, -25026, -29233, -20695,  -7452,  10682,  19897, -31766,
+                             -4904,  15811,  -7047,  -5857,  -2471,  -3489, -30067, -28989),
+      simde_mm256_set_epi16(-27317,   2396,   2420, -25738,  28335,  -2869,   2126,  -2494,
+                              4656,    867, -30484,  27836, -12633,    443,  18282, -24733),
+      simde_mm256_set_epi16(    -1, -22630, -26813,     -1,     -1,     -1,  22023,     -1,
+                              -248,  16678,     -1,     -1,     -1,  -3046, -11785,     -1) },
+    { simde_mm256_set_epi16( -2206, -20108, -18329, -11752,  18891, -23269, -23729, -15012,
+                              5468, -23497, -15175,  18126, -32570, -30259, -11337,  26955),
+      simde_mm256_set_epi16(-15533, -23215, -23167,  16769,  26168,  23107, -31630,  10076,
+                            -19756, -28684, -23782,  -2505,   2372,   5493,   8380,  19920),
+      simde_mm256_set_epi16(    -1,     -1,     -1,     -1, -20477,   -162,     -1,  -4936,
+                            -14288,     -1,     -1,     -1, -30198, -24766,  -2957, -18661) },
+    { simde_mm256_set_epi16(-15150, -14915,   7224, -23182,  -8545,  11730,   3928,  10445,
+                             12562, -15902,   8145, -32416,  22228, -11611,   4585, -29314),
+      simde_mm256_set_epi16( -1391,  13502, -12799,   7511, -31205, -32414, -21864,  23611,
+                            -16120,  30785, -27620,  -3632,   5683, -15057, -27029, -27572),
+      simde_mm256_set_epi16(    -1,  -1413,  -5575, -15671,     -1, -20684, -17936, -31480,
+                             -3558,     -1, -19475,     -1,  27911,     -1, -22444,     -1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_adds_epu16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_adds_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -55,  -79,  -35,   53,   38,  -11,   87,  -53,
+                              6,  -29,   35, -125,   80,  -36,    3,   91,
+                            -54,   81,  109, -110,   22, -107,  117,   12,
+                            122,   42,  126,  -78,    0,   54,   62,   42),
+      simde_mm256_set_epi8( -19,  -86,   56, -102,  -76,  105,   -8,   94,
+                             24,  -21, -101,  -67,  -48,  -67,  -69,  -31,
+                            -35,   -9,  -28,    8,  -43,   29,  112,   94,
+                            -17,  -61, -115,  -61,   44,  113,  -88,   37),
+      simde_mm256_set_epi8(  -1,   -1,   -1,  -49,  -38,   -1,   -1,   -1,
+                             30,   -1,  -66,   -1,   -1,   -1,  -66,   -1,
+                             -1,   -1,   -1, -102,  -21,  -78,  -27,  106,
+                             -1,  -19,   -1,   -1,   44,  -89,  -26,   79) },
+    { simde_mm256_set_epi8(  19, -118,  -16,  -89,  118,  -43,  -96,   14,
+                            -35,   44,   31,   14,   49,  106,  -35,   91,
+                            -43,   53,  127,   25,   46,  102,   85,   -4,
+                             32,   71,  -49,  101,   30,  -86,   14,  125),
+      simde_mm256_set_epi8(  59,  -78,  112,   90,  -93,   82,  106,   38,
+                             24,  -17,  -15,  -36,  -25, -105,  -85,  -51,
+                           -113,   98,  -53,  -57,   96,  -81,  -26,   68,
+                             43,  -92,  -53,   95,  109, -123,   21,  115),
+      simde_mm256_set_epi8(  78,   -1,   -1,   -1,   -1,   -1,   -1,   52,
+                            -11,   -1,   -1,  -22,   -1,   -1,   -1,   -1,
+                             -1, -105,   -1,  -32, -114,   -1,   -1,   -1,
+                             75,  -21,   -1,  -60, -117,   -1,   35,  -16) },
+    { simde_mm256_set_epi8( -15,   71,   -6, -100,   -7,   35,  117,   89,
+                             50,  -50,   89,    7,  -24,   58,  109,  115,
+                           -107,   22,   -6,   -3, -106,  -42, INT8_MIN,   83,
+                            -16,    5,  -62,   -1,  -57,  -17,   73,   18),
+      simde_mm256_set_epi8( -83,  -13,  -12,  -73,    9,  108,  -35,  -57,
+                              7, -110,  -17,   57,   14,  -78,   84,  -47,
+                             -7,  -13,   -1, -118,   41,   46,   17,   66,
+                             12,  -12,   -8, -117,  -38,   -4,   61,  -51),
+      simde_mm256_set_epi8(  -1,   -1,   -1,   -1,   -1, -113,   -1,   -1,
+                             57,   -1,   -1,   64,  -10,  -20,  -63,   -1,
+                             -1,   -1,   -1,   -1,  -65,   -1, -111, -107,
+                             -4,   -7,   -1,   -1,   -1,   -1, -122,  -33) },
+    { simde_mm256_set_epi8( -98,  -25,   36, -111, -104,  -91,   31,   50,
+                             45,   41, -116,   29,   38, -110,  -44,   90,
+                           -107,  -91,   -5,  -63,   71,    3,    7,   -1,
+                             42,  -75,  -51,  -88,   62,  -68,   73,   45),
+      simde_mm256_set_epi8( -39,  113,   -1, -119,  -74,  117,  107,  -78,
+                             76,   28,   61,  -63,   79,   51,   91,   42,
+                           -124, -111,  -53,  -47,  103,  -89,  -38,   67,
+                             44,   65, -116,  114,   50,  -90,   47,   23),
+      simde_mm256_set_epi8(  -1,   -1,   -1,   -1,   -1,   -1, -118,  -28,
+                            121,   69,  -55,  -34,  117,  -59,   -1, -124,
+                             -1,   -1,   -1,   -1,  -82,  -86,  -31,   -1,
+                             86,  -10,   -1,   -1,  112,   -1,  120,   68) },
+    { simde_mm256_set_epi8(  82,  -12, -115,  -57,  126, -102,  -53,  -32,
+                             99,  -35,  -98,  -37, INT8_MIN,    5, -104,   41,
+                            -99,  -94,  -43,  -77,   92,  -81,   59,  -80,
+                             83,   64, -124,  120,  -98,  -51,   -9,  106),
+      simde_mm256_set_epi8(  99,  -14,   45,   58, -119, -122,   93,   55,
+                             49,  -54,   71,  -78,  -38,  121,   81,   61,
+                            -56,  -59,   35,   87,  -90,   79,   99,   66,
+                            -95,  100,   96,  106,   63,  -57,   34,  -14),
+      simde_mm256_set_epi8( -75,   -1,  -70,   -1,   -1,   -1,   -1,   -1,
+                           -108,   -1,  -27,   -1,   -1,  126,  -23,  102,
+                             -1,   -1,   -8,   -1,   -1,   -2,  -98,  -14,
+                            -12,  -92,  -28,  -30,  -35,   -1,   -1,   -1) },
+    { simde_mm256_set_epi8(  74,  -30,   -6,  -34,   33,  -44,   42,  -83,
+                             75,   35,  126, -104,   83,   62,  105,   35,
+                            125,   50,   48,   85,   37,  -96,   90,   91,
+                           -124,    8,  126,   24,  -36,  -79,  108, -102),
+      simde_mm256_set_epi8(  79,   92, -100,  -47,   71,  -17,   49,   64,
+                             21,  121,  -56,   21,  -55,   45,  -10,  -89,
+                            121,  -95,  101,   18,  -71,   47,  -63,  113,
+                             -7,   82,  119,  -99,  -69, -114,   34, INT8_MIN),
+      simde_mm256_set_epi8(-103,   -1,   -1,   -1,  104,   -1,   91,  -19,
+                             96, -100,   -1,  -83,   -1,  107,   -1,  -54,
+                            -10,  -45, -107,  103,  -34,  -49,   -1,  -52,
+                             -1,   90,  -11,  -75,   -1,   -1, -114,   -1) },
+    { simde_mm256_set_epi8( -89,    5,  123,   -8,  -81,   62,  -69,  122,
+                             29,  104,  107, -122,   26, -114,  -41,  -11,
+                            -15,  -90,  -38,   76,   64,   20, -109,   45,
+                              9,   12,   38,  -60,  -87,  121,   88,   -7),
+      simde_mm256_set_epi8(  86,  100, -117,  -47,  -18,   74,   34,  -47,
+                            -52,  -94,  118,   46,  -88,   97,  -62,   59,
+                             78,   14,   34,  120,  -58,  -42,  111, -103,
+                            -13,  123,   57, -117,  -97,   30,  -57,   80),
+      simde_mm256_set_epi8(  -3,  105,   -1,   -1,   -1, -120,  -35,   -1,
+                            -23,   -1,  -31,  -76,  -62,  -17,   -1,   -1,
+                             -1,  -76,   -4,  -60,   -1,  -22,   -1,  -58,
+                             -4, -121,   95,   -1,   -1, -105,   -1,   -1) },
+    { simde_mm256_set_epi8(  83,  -78,  -96,   93,   16,   46,   -5,   88,
+                            -20,  -91,  -24,  -28,  111, -103,   40,   15,
+                            126,  -36,  101,  -84, -109,  -12,  -40,   12,
+                            100, -106,  -15,   49,  -81,  -50, -106,  109),
+      simde_mm256_set_epi8( 107,  126,  124,  118,   70, -111, -116,   54,
+                            112,  -66,  -27,  -61,  -99, -118,   76,  -54,
+                            -12,  -97,   27, -108,   26,    9,  -60, -113,
+                            114,   18,  -81,   14,  103,  121,   36,   74),
+      simde_mm256_set_epi8( -66,   -1,   -1,  -45,   86,  -65,   -1, -114,
+                             -1,   -1,   -1,   -1,   -1,   -1,  116,  -39,
+                             -1,   -1, INT8_MIN,   -1,  -83,   -3,   -1, -101,
+                            -42,  -88,   -1,   63,   -1,   -1,  -70,  -73) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_adds_epu8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_and_si256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 7107801869839905965), INT64_C(-8260327828956277571),
+                             INT64_C( 5425787823761435913), INT64_C(-4063359649849391889)),
+      simde_mm256_set_epi64x(INT64_C( 6644634877719685738), INT64_C( 4703160753444594845),
+                             INT64_C( 8223992265769202882), INT64_C( 9154630387413478522)),
+      simde_mm256_set_epi64x(INT64_C( 4621392662780583976), INT64_C(   91316125564503197),
+                             INT64_C( 4755877364942021632), INT64_C( 5118345121150157930)) },
+    { simde_mm256_set_epi64x(INT64_C(-8619470681146498427), INT64_C( -654678471523163524),
+                             INT64_C( 5962578954327671379), INT64_C( 1761168995688360821)),
+      simde_mm256_set_epi64x(INT64_C( 4372833152787438614), INT64_C(-3238096888384509676),
+                             INT64_C(-7246011123858446939), INT64_C(  923258652117748843)),
+      simde_mm256_set_epi64x(INT64_C(  585868264124596228), INT64_C(-3311808187656560620),
+                             INT64_C( 1310641250732556289), INT64_C(  598979687167330401)) },
+    { simde_mm256_set_epi64x(INT64_C(-8856203529159312579), INT64_C( 3882354603995284490),
+                             INT64_C( -572808981312625093), INT64_C(-4465499064405247286)),
+      simde_mm256_set_epi64x(INT64_C(-7440539471724698683), INT64_C(-2211769196551691347),
+                             INT64_C( 3749390476606735096), INT64_C( 6657082405851345541)),
+      simde_mm256_set_epi64x(INT64_C(-9216510235361828091), INT64_C( 2395955272752332808),
+                             INT64_C( 3461157343987761720), INT64_C( 4612270958768632448)) },
+    { simde_mm256_set_epi64x(INT64_C(-3198527071220604693), INT64_C(-4073049155683786100),
+                             INT64_C(-9192051648968476092), INT64_C(-1329850115283958450)),
+      simde_mm256_set_epi64x(INT64_C(-5737342211116692251), INT64_C(-4352315123810324211),
+                             INT64_C(-4881970363289505144), INT64_C( 4986225558747373535)),
+      simde_mm256_set_epi64x(INT64_C(-8070296050813370143), INT64_C(-4388449611455324148),
+                             INT64_C(-9210070617626201600), INT64_C( 4972572226845689166)) },
+    { simde_mm256_set_epi64x(INT64_C( 1243996811306024944), INT64_C( 5586693091878844491),
+                             INT64_C(-8769367274661638105), INT64_C( 6175923705547410234)),
+      simde_mm256_set_epi64x(INT64_C(-4233127425626628739), INT64_C(-5440412412367282802),
+                             INT64_C(-1073961387311848636), INT64_C(-1957047462969265530)),
+      simde_mm256_set_epi64x(INT64_C(   90212731152309616), INT64_C(  290413474877544458),
+                             INT64_C(-9220978623366135804), INT64_C( 4941866763957633538)) },
+    { simde_mm256_set_epi64x(INT64_C(-4819274385393751579), INT64_C(-8022320410567504896),
+                             INT64_C(-3764791600011440474), INT64_C(-6060556556440067391)),
+      simde_mm256_set_epi64x(INT64_C( 8930340723020853349), INT64_C( 2016264952124626904),
+                             INT64_C(-6244090273732507302), INT64_C( 2311624112734764483)),
+      simde_mm256_set_epi64x(INT64_C( 4111347834212868197), INT64_C( 1200831633205232640),
+                             INT64_C(-8556697487070361598), INT64_C( 2307111708193726657)) },
+    { simde_mm256_set_epi64x(INT64_C(   37574125837210566), INT64_C( 7018656479325034958),
+                             INT64_C(-5763841119160835638), INT64_C(-8492362778860376715)),
+      simde_mm256_set_epi64x(INT64_C(-7122794288828822963), INT64_C( -132865008334255954),
+                             INT64_C(-2967033773993447280), INT64_C(-8708994829565557818)),
+      simde_mm256_set_epi64x(INT64_C(    1196633824248388), INT64_C( 6928584481803077774),
+                             INT64_C(-8069685272012349312), INT64_C(-9069967040676101820)) },
+    { simde_mm256_set_epi64x(INT64_C( 1356718103321337941), INT64_C(-7590210446254490697),
+                             INT64_C(-5956084170736120714), INT64_C( 3691109739521910929)),
+      simde_mm256_set_epi64x(INT64_C( -356295236801745662), INT64_C(-6417722249127405530),
+                             INT64_C( 4170264353331250141), INT64_C( -131473486947148040)),
+      simde_mm256_set_epi64x(INT64_C( 1298170615592919040), INT64_C(-8743136623853397978),
+                             INT64_C( 2978991518058020948), INT64_C( 3614244805466392720)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_and_si256(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_andnot_si256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 8691215798938929047), INT64_C(-1885130455136691379),
+                             INT64_C( 1178992253419403278), INT64_C(  477963226882144830)),
+      simde_mm256_set_epi64x(INT64_C( 1505178511675359882), INT64_C(-8964565127149227367),
+                             INT64_C(-3739944041532653101), INT64_C( 7887892223974048898)),
+      simde_mm256_set_epi64x(INT64_C(  315833895376519176), INT64_C(  144489026796150928),
+                             INT64_C(-3746712863014944303), INT64_C( 7590091674991723648)) },
+    { simde_mm256_set_epi64x(INT64_C(-8181077625698965501), INT64_C( 8044840312023407553),
+                             INT64_C(-5168831872001662698), INT64_C(-8530532189240653474)),
+      simde_mm256_set_epi64x(INT64_C(-9005648118024000248), INT64_C( 3813502781990711332),
+                             INT64_C( 8965122196861348644), INT64_C( 4661499159038836804)),
+      simde_mm256_set_epi64x(INT64_C(   72342092822775048), INT64_C( 1173266936721580068),
+                             INT64_C( 4911739595623778848), INT64_C( 4620843576233312256)) },
+    { simde_mm256_set_epi64x(INT64_C(-4249307022193148722), INT64_C( 3474739438782859211),
+                             INT64_C( 7602453554697207458), INT64_C( 2398261019520272218)),
+      simde_mm256_set_epi64x(INT64_C( 7377159369944457557), INT64_C(-6615147814802003101),
+                             INT64_C( 1212570167270984342), INT64_C(-2772461195156215900)),
+      simde_mm256_set_epi64x(INT64_C( 2477122834650972433), INT64_C(-8934572112068859872),
+                             INT64_C( 1176187189982920724), INT64_C(-2844542086189899612)) },
+    { simde_mm256_set_epi64x(INT64_C(-2306774502149863361), INT64_C(-1641649846234510009),
+                             INT64_C(-7632053584493078253), INT64_C(-9121582133857059704)),
+      simde_mm256_set_epi64x(INT64_C( 2576541603256685853), INT64_C(-4543482429978103220),
+                             INT64_C( 3321695423692068561), INT64_C(-7755041307009309834)),
+      simde_mm256_set_epi64x(INT64_C( 2306131218715907328), INT64_C(   54129800329114120),
+                             INT64_C( 2884555836212168384), INT64_C( 1441167292377891702)) },
+    { simde_mm256_set_epi64x(INT64_C(-6268794813771904932), INT64_C( 3479348956686212057),
+                             INT64_C(-8245481068782334187), INT64_C( 2736938851835064303)),
+      simde_mm256_set_epi64x(INT64_C(-1830843415579914504), INT64_C( 4943072750407344973),
+                             INT64_C(  898569144604689630), INT64_C( 1115357353829915339)),
+      simde_mm256_set_epi64x(INT64_C( 5086544788366231200), INT64_C( 4940538994297479172),
+                             INT64_C(   29362734144028874), INT64_C(  720576593619505152)) },
+    { simde_mm256_set_epi64x(INT64_C(-8821025972550940208), INT64_C( 6651179697838049868),
+                             INT64_C(-3313415883838994103), INT64_C( -924299749197823328)),
+      simde_mm256_set_epi64x(INT64_C(-7738344352725867220), INT64_C(-8370716910445546219),
+                             INT64_C(-1443431107632227822), INT64_C( 3894133003773285531)),
+      simde_mm256_set_epi64x(INT64_C( 1155877277477938220), INT64_C(-8966665475568126703),
+                             INT64_C( 3022907110013014546), INT64_C(  288939636448302107)) },
+    { simde_mm256_set_epi64x(INT64_C( 2699132114122637545), INT64_C(-6884626271368959165),
+                             INT64_C(-4815068693335696898), INT64_C( -361196974748149948)),
+      simde_mm256_set_epi64x(INT64_C(-8983174404379339818), INT64_C( 4737561617402925162),
+                             INT64_C(-3068636545594615339), INT64_C( -251080089270823596)),
+      simde_mm256_set_epi64x(INT64_C(-9079186342334262506), INT64_C( 4722889593941168168),
+                             INT64_C( 4630267013636292609), INT64_C(  289139380558626832)) },
+    { simde_mm256_set_epi64x(INT64_C( 6178440789610204987), INT64_C(-6562179347297783827),
+                             INT64_C(-6365187829402899021), INT64_C( -572961649429609644)),
+      simde_mm256_set_epi64x(INT64_C(-6168650758172459737), INT64_C(-7004294031158265043),
+                             INT64_C(-5839553717957977920), INT64_C(-8301620178614769799)),
+      simde_mm256_set_epi64x(INT64_C(-6178792659106156540), INT64_C( 1873931821335711744),
+                             INT64_C(  600580262140645440), INT64_C(  342994869026825257)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_andnot_si256(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_avg_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( 30693,  27038, -17903,  -9347, -14142,   9318,   4536, -21533,
+                            -26198, -26226,  27170,  12590,  12185,  28635,  -5366,  -8168),
+      simde_mm256_set_epi16(  6648,  16201, -28497,  17063,  17317,  16369,   5262, -14452,
+                            -23576, -29308,  23925,  11932,   8458, -27180,  30499,  -7576),
+      simde_mm256_set_epi16( 18671,  21620, -23200, -28910, -31180,  12844,   4899, -17992,
+                            -24887, -27767,  25548,  12261,  10322, -32040, -20201,  -7872) },
+    { simde_mm256_set_epi16( 11585,  11999,  -8636, -30021, -26125, -24279,  -7944,  -9624,
+                             -3615,  -7123, -15445,  31570,  -3132,   5932,  18850,  -7144),
+      simde_mm256_set_epi16(-17713,  -8408, -25429, -28679,  -2791, -24138, -15408, -23414,
+                            -27790,  -5373,  19011,  29530,  27167, -14105, -18663,  21654),
+      simde_mm256_set_epi16( 29704, -30972, -17032, -29350, -14458, -24208, -11676, -16519,
+                            -15702,  -6248, -30985,  30550, -20750,  28682, -32674, -25513) },
+    { simde_mm256_set_epi16(  5851, -15297,   4805, -11786, -18046,  -3271, -17105,  14428,
+                             12774,  28108, -14282,  10042,  19157,   3372, -31161,   7444),
+      simde_mm256_set_epi16(-16120,  19486,  13256,  30363, -27087, -26945,  19591,  12532,
+                            -16855,  26471,  -6968,  23882,   4278, -31559,  23609, -10106),
+      simde_mm256_set_epi16( 27634, -30673,   9031, -23479, -22566, -15108, -31525,  13480,
+                             30728,  27290, -10625,  16962,  11718,  18675,  28992,  31437) },
+    { simde_mm256_set_epi16(-26473,   -839,  23410, -30536,  15320, -14273,  16782,  11218,
+                            -26806,  18444,  15528,  20759, -32718, -15547,  -8963,  11535),
+      simde_mm256_set_epi16( 16193,  -2691,   7661,   7292,  28446, -21282, -28491,  -6416,
+                            -11861,  -5408,  -2682,   6152, -23985,  26565,  -5380,  29041),
+      simde_mm256_set_epi16( 27628,  -1765,  15536,  21146,  21883, -17777,  26914, -30367,
+                            -19333, -26250, -26345,  13456, -28351, -27259,  -7171,  20288) },
+    { simde_mm256_set_epi16( -1788,  -9767, -18330,  13058, -17598,  23675,  16259,   1045,
+                             -4401,   5730, -27781,   4050,  -5773,  26379,  21538, -17451),
+      simde_mm256_set_epi16(-10448,  -3996,  -5461,  27370, -22632, -30577,  12651,   7263,
+                              9047, -22197,   -979,  21401, -17870,  20352, -16860, -26116),
+      simde_mm256_set_epi16( -6118,  -6881, -11895,  20214, -20115,  29317,  14455,   4154,
+                            -30445,  24535, -14380,  12726, -11821,  23366, -30429, -21783) },
+    { simde_mm256_set_epi16(  8986,  32754, -32099,  20100,   7714,   7970,   5413, -27606,
+                              3916,  32441, -14534,    916, -16683,  -7240, -26830,  13206),
+      simde_mm256_set_epi16( 28215,  -1293,  32149,  20605,  20418, -32674,  28889,  25217,
+                            -23864,  -1471,  13293, -27807,  -1154, -15922,  25915,  16669),
+      simde_mm256_set_epi16( 18601, -17037, -32743,  20353,  14066,  20416,  17151,  31574,
+                             22794, -17283,  32148,  19323,  -8918, -11581,  32311,  14938) },
+    { simde_mm256_set_epi16( -5405,   8759, -23516,  30358,  -6385,    571, -24039,    427,
+                            -13215, -24904,   -134,   6997,  18330,   2620,  17728,  11840),
+      simde_mm256_set_epi16( -9144, -30503,  27216, -11126,   6282,  14415,  -7634, -16157,
+                             14570, -31795,   1937, -23727,   1854,  23871, -10283,  12574),
+      simde_mm256_set_epi16( -7274,  21896, -30918, -23152,  32717,   7493, -15836,  24903,
+                            -32090, -28349, -31866,  24403,  10092,  13246, -29045,  12207) },
+    { simde_mm256_set_epi16( 12669,  31911,  23054,  31569, -10091,  16752, -12888, -10557,
+                            -17286,   9251,  16082,  26552,  24657, -16586,  10228, -11760),
+      simde_mm256_set_epi16(  6341, -22678,  -4719,  16568, -22089,  10011, -18880,  -3737,
+                             23445,  -8939,  -5331,   6467, -11404, -17828,  25342,  25448),
+      simde_mm256_set_epi16(  9505, -28151, -23600,  24069, -16090,  13382, -15884,  -7147,
+                            -29688, -32612, -27392,  16510, -26141, -17207,  17785, -25924) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_avg_epu16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_avg_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( 103,   67,   73,  -21,  123,   19,   13,   60,
+                             65,   28,   74,   46,  -51,   83,  -33,   57,
+                            -78, -115,   -1, -121,    4,   18,  103, -104,
+                            -15,  -68,  -19,  -20,  -34, -108,  -48,  -66),
+      simde_mm256_set_epi8( -78,   71,  116,  -91,   37,   30,  -95,   92,
+                            120, -102, -127,   24,   59,  -66,  -34,  -65,
+                             84,    0,  -64,   75,   27,  -88,  -26,   98,
+                            -18,   66, -120,   92,  116,  -41,  -88,  -70),
+      simde_mm256_set_epi8(-115,   69,   95,  -56,   80,   25,   87,   76,
+                             93,   91,  102,   35, -124, -119,  -33,  124,
+                           -125,   71,  -32,  105,   16,   93,  -89,  125,
+                            -16,  127,  -69,  -92,  -87,  -74,  -68,  -68) },
+    { simde_mm256_set_epi8( -46, -121,   -9,   49, -124,   87,  103,  -77,
+                            -75,  103,   48,  -39,  -21, -116,  -73,  -99,
+                             37,   66,   47,  119,   49,   86,  121,   83,
+                             15,  -96,  -43,  107,   61,   59,  127,   -8),
+      simde_mm256_set_epi8(-118,   31,  -95,  -60,   57,  -31,   53,   63,
+                            -13,    6,  -77,  -14,   91,  -68,   34,  -21,
+                            -31,  -16,    1,  -30,  -31,  -57,  -78,   50,
+                             -9,  122,  -51,  122, -118,  -87,   60,   18),
+      simde_mm256_set_epi8( -82,   83,  -52,  123,   95, -100,   78,  121,
+                            -44,   55,  114,  -26,  -93,  -92,  109,  -60,
+                           -125, -103,   24,  -83, -119, -113, -106,   67,
+                           -125, -115,  -47,  115,  100,  114,   94, -123) },
+    { simde_mm256_set_epi8(  38,   83,  102,   95,  -13,   -9, -100,   19,
+                             78,  -42,   91,   65,  -50,  -75,  109,  116,
+                             85,   84,   22,   68,   97,  -15,    7,  117,
+                            -21,   85,  -18,  -75,  -44,  -22,   88,   68),
+      simde_mm256_set_epi8( -76,   43,  118, -110,   -7,  -67,   21,   12,
+                            -54,   43,   19,  111,  -69,  106,  104,   70,
+                            -20,   62,   60,   55,  -30,   46,  -41, -106,
+                           -106,   31,   10,   79,  106, -120,   81,   34),
+      simde_mm256_set_epi8( 109,   63,  110,  121,  -10,  -38,   89,   16,
+                           -116, -127,   55,   88,  -59, -112,  107,   93,
+                            -95,   73,   41,   62,  -94, -112,  111, -122,
+                            -63,   58,  124, -126,  -97,  -71,   85,   51) },
+    { simde_mm256_set_epi8( -35, -121,   -1,  -33,   -2,  -46,   13,  -89,
+                             80,   30,    3,  125,  -50,  105,  -11,  -30,
+                             79,   23,   69,  -55,  -91,   83,    5,   99,
+                             -9,   85,  -20,   10,  -60,  -78,   89,   67),
+      simde_mm256_set_epi8( -99,  -27,  -72,   65,    8,   11,   89,   91,
+                            -36,  106,  -59,   35,  -84,   22,  111,  -14,
+                            -54, -106,  -21,  118, -103, -117,  112,  -64,
+                           -108,   71,   -3,  -14,   96,  107,   46,   16),
+      simde_mm256_set_epi8( -67,  -74,  -36, -112, -125,  111,   51, -127,
+                           -106,   68,  100,   80,  -67,   64,  -78,  -22,
+                           -115,   87, -104,  -96,  -97,  111,   59, -110,
+                            -58,   78,  -11,  126, -110, -113,   68,   42) },
+    { simde_mm256_set_epi8( -69,   38,   30,   34,   48,  -40,  -77,   95,
+                            -67,   -8,  -73,  -45,  -84,  -16,    2,   60,
+                            -67,    5, -123, -127, -119,  126,   -6,  -62,
+                             35,  -69,  -64,   45,  -67,  -92, -124,   96),
+      simde_mm256_set_epi8( -65, -115,  -49,   25,   43,    1,  -19,  -33,
+                             85,   40,  -56,   60,   23, -115,  116,    7,
+                             98,    3,   38,   85, -107,  -74,  125,   59,
+                             32,   47,  -29,  -78,   -7,    1,  -88,   46),
+      simde_mm256_set_epi8( -67,   90,  119,   30,   46,  109,  -48,  -97,
+                           -119, -112,  -64, -120,   98,  -65,   59,   34,
+                           -112,    4,   86,  107, -113, -102,  -68,  127,
+                             34,  117,  -46,  112,  -37,   83, -106,   71) },
+    { simde_mm256_set_epi8( 103,   83,   23,  -88,   35,  -12,  -24, -108,
+                             95,  -15,  -61,   51,  -16,  -67,   30,    6,
+                             54,   12,  102,   36,   42, -102,  100,   35,
+                            -33,  -59,  -74,   96,   58,  -45,   14, -122),
+      simde_mm256_set_epi8( -64,   83,   73,   78,  -40,   24,   46,  -36,
+                            -62,  -10,  -17,   92,   69,   46,  -38,   68,
+                            -67,  118,   54,   -8,   23,  -29,  121,  -28,
+                            -89,   75,   51,  -78,  -69,  -83,   50,  -53),
+      simde_mm256_set_epi8(-108,   83,   48,  123,  126, -122, -117,  -72,
+                           -111,  -12,  -39,   72, -101,  118,  124,   37,
+                            122,   65,   78, -114,   33,  -65,  111, -124,
+                            -61, -120,  117, -119,  123,  -64,   32,  -87) },
+    { simde_mm256_set_epi8(  97,  -93, -106,  119,   15,   34,   49,   70,
+                            -11,  -53,   52,  -29,   16,   12,  -56,   -6,
+                            -29,  -61,   -6, -104,   42,  -17,  -88,   75,
+                            120,  -58,  100,  -54, -115,   18,    8, -122),
+      simde_mm256_set_epi8( -25, -107,   -5,  -37,  123,  111,  111,  -38,
+                             91,  -75,    9,  -29,  -24,  -87,   76,  -50,
+                            -71,  110,  -46, -105,  -71,  113,  104,  -75,
+                           -105,  -51,  -28, -109,   58,   -7,   72,  -40),
+      simde_mm256_set_epi8( -92, -100,  -55,  -87,   69,   73,   80, -112,
+                            -88,  -64,   31,  -29,  124,   91, -118,  -28,
+                            -50, -103,  -26, -104,  114,  -80, -120, INT8_MIN,
+                           -120,  -54,  -92,  -81,  100, -122,   40,  -81) },
+    { simde_mm256_set_epi8( -33,   99,  -71,  -51,  113,  -41,   36,  102,
+                           -125,  -30,  -84,   69,  -87,   32, -126, -109,
+                            104,  126,   33,   -6,   76,   83,   61,  105,
+                            -23, -108,   69,  -90,  -32,  -33,  103,  -84),
+      simde_mm256_set_epi8( -98, -104,   30,  -79,   60,   35,  125,   93,
+                             96, -123, -103, -105,   32,  115,  -13,   97,
+                             84,  120,  -43,  114,   92,  -52,  -26,   -9,
+                            -74,  -80,   47,  -86,  -86, -114,   73,  -22),
+      simde_mm256_set_epi8( -65,  126,  108,  -65,   87,  125,   81,   98,
+                            114,  -76,  -93,  110,  101,   74,  -69,  122,
+                             94,  123,  123,  -74,   84, -112, -110,  -80,
+                            -48,  -94,   58,  -88,  -59,  -73,   88,  -53) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_avg_epu8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_bslli_epi128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r3;
+    simde__m256i r12;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -25,   97,   59,   48,   44,   96, -109,  -89,
+                            111, -104,   58,   89,   64, -127,  -25, -113,
+                             23,   13,  -46,   10,  -93,  -37,  -54,  -24,
+                            122,   82,  -24, -116,  100,  -99,   73,  -98),
+      simde_mm256_set_epi8(  48,   44,   96, -109,  -89,  111, -104,   58,
+                             89,   64, -127,  -25, -113,    0,    0,    0,
+                             10,  -93,  -37,  -54,  -24,  122,   82,  -24,
+                           -116,  100,  -99,   73,  -98,    0,    0,    0),
+      simde_mm256_set_epi8(  64, -127,  -25, -113,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                            100,  -99,   73,  -98,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8(  50,  -63,   35,  -93,  114,  -18,   25,   79,
+                            -67,   27, -101,  -86,   -2,   50,    9,   56,
+                             -4,    4,   38,   70,  114,  -78,  -87,  -99,
+                            -49,  -51,  112,  -14,  110,  126,  119,   -9),
+      simde_mm256_set_epi8( -93,  114,  -18,   25,   79,  -67,   27, -101,
+                            -86,   -2,   50,    9,   56,    0,    0,    0,
+                             70,  114,  -78,  -87,  -99,  -49,  -51,  112,
+                            -14,  110,  126,  119,   -9,    0,    0,    0),
+      simde_mm256_set_epi8(  -2,   50,    9,   56,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                            110,  126,  119,   -9,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8( -59,  -30,  -45, -100,   70,   69,  126, -109,
+                              2,  -65,  -56,   12,   18, -126,   75,   -9,
+                             23, -124,  119,   87,   15,  -49,  121,  -61,
+                            123,  -35,  -28,  -88,   40,   67, -101,  116),
+      simde_mm256_set_epi8(-100,   70,   69,  126, -109,    2,  -65,  -56,
+                             12,   18, -126,   75,   -9,    0,    0,    0,
+                             87,   15,  -49,  121,  -61,  123,  -35,  -28,
+                            -88,   40,   67, -101,  116,    0,    0,    0),
+      simde_mm256_set_epi8(  18, -126,   75,   -9,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                             40,   67, -101,  116,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8(  92,  -75,   87, -104,   95,  -72,  116,  -23,
+                           -125,   98,  121,   82,  -10,  -26,   76,  -87,
+                             66,  -47,   19,  -93,   32,   20,   98,  122,
+                            -55, INT8_MIN,    0,  -88,  -37,  117,  -69,   49),
+      simde_mm256_set_epi8(-104,   95,  -72,  116,  -23, -125,   98,  121,
+                             82,  -10,  -26,   76,  -87,    0,    0,    0,
+                            -93,   32,   20,   98,  122,  -55, INT8_MIN,    0,
+                            -88,  -37,  117,  -69,   49,    0,    0,    0),
+      simde_mm256_set_epi8( -10,  -26,   76,  -87,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                            -37,  117,  -69,   49,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8( -34,   33,   45,  -37,   -6,  104,   82,   36,
+                            -73,  -42,   13,  121,  -15,   37,   82,  -32,
+                            -28,  100,   19,  -24,  -31,   51,  124,   51,
+                            -35,  114,  -85,  -34,  122, -112,  -49,   30),
+      simde_mm256_set_epi8( -37,   -6,  104,   82,   36,  -73,  -42,   13,
+                            121,  -15,   37,   82,  -32,    0,    0,    0,
+                            -24,  -31,   51,  124,   51,  -35,  114,  -85,
+                            -34,  122, -112,  -49,   30,    0,    0,    0),
+      simde_mm256_set_epi8( -15,   37,   82,  -32,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                            122, -112,  -49,   30,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8( -94,  -12,   78,  114,  -36,  119,    7,   53,
+                            -39,  -76,   56,  123,  -26, -108,   70,  -23,
+                             19,   69,  -65,   52,  -62,   40,  102,  -47,
+                             28,  -31,   33,  118, -116,  -92,   62,  -99),
+      simde_mm256_set_epi8( 114,  -36,  119,    7,   53,  -39,  -76,   56,
+                            123,  -26, -108,   70,  -23,    0,    0,    0,
+                             52,  -62,   40,  102,  -47,   28,  -31,   33,
+                            118, -116,  -92,   62,  -99,    0,    0,    0),
+      simde_mm256_set_epi8( -26, -108,   70,  -23,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                           -116,  -92,   62,  -99,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8(  60,   -9,   66,  -52,   45,   13,   61,  -57,
+                            -75,  -58,    6,  119,  -26,  101, -101,  -55,
+                             73,   32,  -50,   -3,  126,  127,  117, -104,
+                              0, -111, -116,   72,  -30,   83, -115,  -36),
+      simde_mm256_set_epi8( -52,   45,   13,   61,  -57,  -75,  -58,    6,
+                            119,  -26,  101, -101,  -55,    0,    0,    0,
+                             -3,  126,  127,  117, -104,    0, -111, -116,
+                             72,  -30,   83, -115,  -36,    0,    0,    0),
+      simde_mm256_set_epi8( -26,  101, -101,  -55,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                            -30,   83, -115,  -36,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8(  33,  125,   60,  -39,  -73, INT8_MIN,   58,  101,
+                            -99,   85,  -66,  121,  103,  -30, -100,  -82,
+                           -126,   94,  -83,    0, -111,  -38,  -61,   63,
+                            -86, -114,  -81,  -85,  -45,  -82, -120,   13),
+      simde_mm256_set_epi8( -39,  -73, INT8_MIN,   58,  101,  -99,   85,  -66,
+                            121,  103,  -30, -100,  -82,    0,    0,    0,
+                              0, -111,  -38,  -61,   63,  -86, -114,  -81,
+                            -85,  -45,  -82, -120,   13,    0,    0,    0),
+      simde_mm256_set_epi8( 103,  -30, -100,  -82,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                            -45,  -82, -120,   13,    0,    0,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r;
+
+    r = simde_mm256_bslli_epi128(test_vec[i].a, 3);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r3);
+    r = simde_mm256_bslli_epi128(test_vec[i].a, 12);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r12);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_bsrli_epi128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r3;
+    simde__m256i r12;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -87,    0,  -71,  -71,   15,   93,   89,   21,
+                            -63,   30,   41,   43,  -36,  -51,  -47,   25,
+                             15,  -61,  -96,  -68,  -44,  -23,   55,  -19,
+                            -93,   29,  -67,  -50,  -94,  -36,   67,  126),
+      simde_mm256_set_epi8(   0,    0,    0,  -87,    0,  -71,  -71,   15,
+                             93,   89,   21,  -63,   30,   41,   43,  -36,
+                              0,    0,    0,   15,  -61,  -96,  -68,  -44,
+                            -23,   55,  -19,  -93,   29,  -67,  -50,  -94),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,  -87,    0,  -71,  -71,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,   15,  -61,  -96,  -68) },
+    { simde_mm256_set_epi8( -23,  117,  -18,   -4,   10,  -33, -123,  -98,
+                            -32,  -78,   65,   26,  -59,   33,    4,  -10,
+                            -54,  118,   80,   27,   31,  -26,  106,  -25,
+                            -76,   23,  -87,   98,  -86,  111,  -59,  -47),
+      simde_mm256_set_epi8(   0,    0,    0,  -23,  117,  -18,   -4,   10,
+                            -33, -123,  -98,  -32,  -78,   65,   26,  -59,
+                              0,    0,    0,  -54,  118,   80,   27,   31,
+                            -26,  106,  -25,  -76,   23,  -87,   98,  -86),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,  -23,  117,  -18,   -4,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,  -54,  118,   80,   27) },
+    { simde_mm256_set_epi8( -47,   71,  125, -126,  -97, -118,   96,   24,
+                             99,  -91,   51,  -19, -102,   11, -107,  -64,
+                             23, -119,  -65,  -10,   20,  -62,  101,   72,
+                           -116,  -26,  -71,   25,  -82,   -5,   51,  -66),
+      simde_mm256_set_epi8(   0,    0,    0,  -47,   71,  125, -126,  -97,
+                           -118,   96,   24,   99,  -91,   51,  -19, -102,
+                              0,    0,    0,   23, -119,  -65,  -10,   20,
+                            -62,  101,   72, -116,  -26,  -71,   25,  -82),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,  -47,   71,  125, -126,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,   23, -119,  -65,  -10) },
+    { simde_mm256_set_epi8(-119,   65,  -88,  -77, -118,  123, -104,   44,
+                             99,  -77,   96,   35,  112,  -52, -100,   42,
+                             26,  -67,   10,  -63,  -87,  -91,  -53,   99,
+                             12,  -57,   84,  -70,  -45,  105, -109,  108),
+      simde_mm256_set_epi8(   0,    0,    0, -119,   65,  -88,  -77, -118,
+                            123, -104,   44,   99,  -77,   96,   35,  112,
+                              0,    0,    0,   26,  -67,   10,  -63,  -87,
+                            -91,  -53,   99,   12,  -57,   84,  -70,  -45),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0, -119,   65,  -88,  -77,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,   26,  -67,   10,  -63) },
+    { simde_mm256_set_epi8( -28,  101,  -56,  -96,  109, -117,   54,  -76,
+                           INT8_MIN,   21,  -14,    0,  -14,   76,  -18,  -48,
+                             -9,  -22,  -33,   17,   14,  119,  -95,   89,
+                           -104,  -72,   10,   -2,  -38,    7,  -22,   79),
+      simde_mm256_set_epi8(   0,    0,    0,  -28,  101,  -56,  -96,  109,
+                           -117,   54,  -76, INT8_MIN,   21,  -14,    0,  -14,
+                              0,    0,    0,   -9,  -22,  -33,   17,   14,
+                            119,  -95,   89, -104,  -72,   10,   -2,  -38),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,  -28,  101,  -56,  -96,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,   -9,  -22,  -33,   17) },
+    { simde_mm256_set_epi8(  83,   -1,  115,  -53,   65, -120,   27,  -48,
+                            -99,    2,   85,  -90,   20, -125,   14,   77,
+                            -18,   23,  123,   67,   -5,   34,  -88,    7,
+                           -111,  108,  101,  -65,  -15,  -26,   88,  125),
+      simde_mm256_set_epi8(   0,    0,    0,   83,   -1,  115,  -53,   65,
+                           -120,   27,  -48,  -99,    2,   85,  -90,   20,
+                              0,    0,    0,  -18,   23,  123,   67,   -5,
+                             34,  -88,    7, -111,  108,  101,  -65,  -15),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,   83,   -1,  115,  -53,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,  -18,   23,  123,   67) },
+    { simde_mm256_set_epi8( -19,  -71, -107,   28,  -23,  -70,   61,   27,
+                            -59, -106,   87,   49,   53,  100,  -21,  -83,
+                             30,   43,  -67, -116, -116, -102,   60, -113,
+                            -49,  -16,  -26,    9,  -14,  -57,  -23,  114),
+      simde_mm256_set_epi8(   0,    0,    0,  -19,  -71, -107,   28,  -23,
+                            -70,   61,   27,  -59, -106,   87,   49,   53,
+                              0,    0,    0,   30,   43,  -67, -116, -116,
+                           -102,   60, -113,  -49,  -16,  -26,    9,  -14),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,  -19,  -71, -107,   28,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,   30,   43,  -67, -116) },
+    { simde_mm256_set_epi8(  63,  108,   88,  -63,   72,  -20,  -71,   -6,
+                             -9,  -32,   87,  -93,  -96,  -65,    3,  108,
+                            -93,   -8,  -39,   56, -119,  116,  -88, -103,
+                           -108,  113,  116,   40,  -55,   81,  -53,  110),
+      simde_mm256_set_epi8(   0,    0,    0,   63,  108,   88,  -63,   72,
+                            -20,  -71,   -6,   -9,  -32,   87,  -93,  -96,
+                              0,    0,    0,  -93,   -8,  -39,   56, -119,
+                            116,  -88, -103, -108,  113,  116,   40,  -55),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,   63,  108,   88,  -63,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,    0,  -93,   -8,  -39,   56) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r;
+
+    r = simde_mm256_bsrli_epi128(test_vec[i].a, 3);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r3);
+    r = simde_mm256_bsrli_epi128(test_vec[i].a, 12);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r12);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmpeq_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(  9762, -11923,   2766,  16296,   5195,   3697,  12675, -18998,
+                             26111, -22842, -18615,   1392,   7777,  26863, -25074,   1614),
+      simde_mm256_set_epi16(  9762,   1049,   2766,   9302,  -4046,  25425,  12675, -18998,
+                             26111,   6006, -11583,  11643,   9273, -31179,  22237, -13753),
+      simde_mm256_set_epi16(    -1,      0,     -1,      0,      0,      0,     -1,     -1,
+                                -1,      0,      0,      0,      0,      0,      0,      0) },
+    { simde_mm256_set_epi16( -2704,  22879, -10029, -20666,  23796, -12807,  27918,   1081,
+                            -18734, -21473, -19175,  -8125,  13981,   9496,  25645,  20491),
+      simde_mm256_set_epi16(-13827,  22879, -10029, -27683,  23286,  27316, -17521,   2076,
+                            -18734, -21473, -19175,  -2687,  13981, -24154, -26535,  23642),
+      simde_mm256_set_epi16(     0,     -1,     -1,      0,      0,      0,      0,      0,
+                                -1,     -1,     -1,      0,     -1,      0,      0,      0) },
+    { simde_mm256_set_epi16(-29776,  -2931, -12145, -13662,   7742,   4748,   8501, -18051,
+                             21442,  18738,  26732,  10162,   6985,  13614,  10450, -20402),
+      simde_mm256_set_epi16( -5382, -31399,  15205,  15634,   5675, -30148,   5761, -10363,
+                             -2671, -29363,  31080, -18090,   6985, -15117,  10450,   2745),
+      simde_mm256_set_epi16(     0,      0,      0,      0,      0,      0,      0,      0,
+                                 0,      0,      0,      0,     -1,      0,     -1,      0) },
+    { simde_mm256_set_epi16( 10694, -32675, -10068,   5509,  10050,   6562,  31584,   7435,
+                              4531, -25785, -13419,  22281,  26729,     71,  21279,   7793),
+      simde_mm256_set_epi16( 10694, -32675,  28979,   5509,  -9299, -24884, -18184,  10206,
+                              4531,   8747, -26172,  -4346, -26970, -27132,  21279,  -5440),
+      simde_mm256_set_epi16(    -1,     -1,      0,     -1,      0,      0,      0,      0,
+                                -1,      0,      0,      0,      0,      0,     -1,      0) },
+    { simde_mm256_set_epi16( -5168,  -3632, -31066, -12975,  25738, -14924,   2384,    342,
+                             10519, -12484,  -7334,  -3333,  13329,  24947,  30960,  10141),
+      simde_mm256_set_epi16( -7321,   -145,   6102,  23950,  16452, -19905,  29617, -17333,
+                             10519, -10249,  -7334,  24457,  13329,  17810,  15793,   1430),
+      simde_mm256_set_epi16(     0,      0,      0,      0,      0,      0,      0,      0,
+                                -1,      0,     -1,      0,     -1,      0,      0,      0) },
+    { simde_mm256_set_epi16(-10291,   5959,   5936, -16099, -11530,  31930,   6218,  15920,
+                            -26929,  -2492, -17686, -28940,  18572, -31204,  13319, -20560),
+      simde_mm256_set_epi16(-30210,  14759, -22456, -29773,  -7776,  11453,   6218,  15920,
+                             14560, -13006, -17686,  28214,   1723,  -3547, -22875,   6549),
+      simde_mm256_set_epi16(     0,      0,      0,      0,      0,      0,     -1,     -1,
+                                 0,      0,     -1,      0,      0,      0,      0,      0) },
+    { simde_mm256_set_epi16(-30646, -28731,  10734, -29015, -31842, -22799, -28368, -26921,
+                            -22980,   -853,   6190,   8694, -20175, -32718,   6249,   2532),
+      simde_mm256_set_epi16(-14688, -28731,  12979,  10381, -31389,  14860,  28535, -26921,
+                            -16092,  -4136, -19171,   -105, -20175,  -7155,  18073, -10211),
+      simde_mm256_set_epi16(     0,     -1,      0,      0,      0,      0,      0,     -1,
+                                 0,      0,      0,      0,     -1,      0,      0,      0) },
+    { simde_mm256_set_epi16(  9630, -18096,  -9924, -16012, -26113,   3063,  -2288,   6704,
+                             12134, -24085, -31681, -15397, -27618, -12395,  24545, -15399),
+      simde_mm256_set_epi16(-21920, -18096,  -9924,  25225, -26113, -31057,  -8614,   1225,
+                             22790, -24472, -13497,  -3301,  21005,  -5876,  -1492,  -3587),
+      simde_mm256_set_epi16(     0,     -1,     -1,      0,     -1,      0,      0,      0,
+                                 0,      0,      0,      0,      0,      0,      0,      0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cmpeq_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmpeq_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(  655826082,   614612782, -1542706325,  1399014512,
+                            -1869944788, -1237855931,  2039050123,   500740098),
+      simde_mm256_set_epi32(  655826082,   359478260,  1231387644,  1399014512,
+                             1177251516,   -88694408,  2039050123,  2026331482),
+      simde_mm256_set_epi32(         -1,           0,           0,          -1,
+                                      0,           0,          -1,           0) },
+    { simde_mm256_set_epi32( -447497499,    54852555,   766007516,  -836729271,
+                             -100819004,  1157210188,  1265469158,  1424068311),
+      simde_mm256_set_epi32(  646765157,  1282743043,  -358003192, -1192073430,
+                             -521040869, -1203212876,  1265469158,   304550094),
+      simde_mm256_set_epi32(          0,           0,           0,           0,
+                                      0,           0,          -1,           0) },
+    { simde_mm256_set_epi32(-1075249413,  1957502687, -1681055253,   367944502,
+                            -1988610237, -2079586291,  -644358417,  1285383413),
+      simde_mm256_set_epi32(  651620331,   326550349,  1542156066,   367944502,
+                             1494347753,   513299412,  -644358417,  -923212265),
+      simde_mm256_set_epi32(          0,           0,           0,          -1,
+                                      0,           0,          -1,           0) },
+    { simde_mm256_set_epi32( -998013306,  1700167530,   -47059972,  -549351161,
+                             1145905719,  -713644282,  2053726742,  1147003411),
+      simde_mm256_set_epi32( -998013306,  1744082106,   -47059972,  -549351161,
+                             1836440153,  -713644282,  1869768409,  1147003411),
+      simde_mm256_set_epi32(         -1,           0,          -1,          -1,
+                                      0,          -1,           0,          -1) },
+    { simde_mm256_set_epi32( -134969193,   -78851615,   440175996, -2109330413,
+                             1192491935,  1810142680,  -104896796, -1889606109),
+      simde_mm256_set_epi32( -134969193,   -78851615,   -63604799,   503763883,
+                            -1447155778,  1810142680,  -255671408,  -251137351),
+      simde_mm256_set_epi32(         -1,          -1,           0,           0,
+                                      0,          -1,           0,           0) },
+    { simde_mm256_set_epi32(-1882551714, -1173495368,  -409328925,  -277893145,
+                             1518739983,  -345465755,   896515201,   619793051),
+      simde_mm256_set_epi32(-1882551714,  1536136154, -1669402567,  -277893145,
+                             1518739983, -1372993973,   367534360,   619793051),
+      simde_mm256_set_epi32(         -1,           0,           0,          -1,
+                                     -1,           0,           0,          -1) },
+    { simde_mm256_set_epi32( 1271907632, -1858040709,  1552652398,  1805189320,
+                             -671428427,  1082415459,  -161457676,   856288576),
+      simde_mm256_set_epi32( 1271907632, -1371938782, -1804955722,   520704485,
+                             -671428427,   -11855835,  -887157298,   241467043),
+      simde_mm256_set_epi32(         -1,           0,           0,           0,
+                                     -1,           0,           0,           0) },
+    { simde_mm256_set_epi32( -584233577, -1297205022,  -244278307, -1530645511,
+                             1380270624,  1628969304,   294015325,   144359604),
+      simde_mm256_set_epi32( -130666658,  1507631463,  -244278307,  -448617551,
+                             1380270624, -1232092246,   514341782,   814959101),
+      simde_mm256_set_epi32(          0,           0,          -1,           0,
+                                     -1,           0,           0,           0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cmpeq_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmpeq_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 7391953075510195981), INT64_C(-6219711570190762132),
+                             INT64_C( 3156385850716793504), INT64_C( 5666645039261194869)),
+      simde_mm256_set_epi64x(INT64_C( 7391953075510195981), INT64_C(-6219711570190762132),
+                             INT64_C( 6901730134321363558), INT64_C(-6325353956762974230)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C( 7199132819837101112), INT64_C(-5121412049214569568),
+                             INT64_C(-3298231760108066552), INT64_C( 6726073060887693216)),
+      simde_mm256_set_epi64x(INT64_C(-7755833571316754318), INT64_C(-3386247549861170829),
+                             INT64_C(-3298231760108066552), INT64_C( 7450561812205312797)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C(-3294805616315281711), INT64_C(-7747963387633166229),
+                             INT64_C(-2120978824239500189), INT64_C(-4379066529183775961)),
+      simde_mm256_set_epi64x(INT64_C( 2321039102186598704), INT64_C( -250937745649122766),
+                             INT64_C( 2321204465438175826), INT64_C(-4379066529183775961)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                  -1)) },
+    { simde_mm256_set_epi64x(INT64_C(-7716591158197610775), INT64_C(-8902910271898354472),
+                             INT64_C( 5770406549078625298), INT64_C(-2632221959150587421)),
+      simde_mm256_set_epi64x(INT64_C(-7716591158197610775), INT64_C(-2636897775810657612),
+                             INT64_C( 9084223489968699083), INT64_C(-2632221959150587421)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                  -1)) },
+    { simde_mm256_set_epi64x(INT64_C( 2483422292157258027), INT64_C( 8214791020881177395),
+                             INT64_C(-3554369197018636413), INT64_C( 8664604215112863157)),
+      simde_mm256_set_epi64x(INT64_C( 2483422292157258027), INT64_C( 3253383009339611514),
+                             INT64_C( 8342053508048982280), INT64_C( 3277563790114415179)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C(-7679383571465891782), INT64_C( 2445475922511521547),
+                             INT64_C( 4950993730431798850), INT64_C( 9081920360126935583)),
+      simde_mm256_set_epi64x(INT64_C( 7694671243134824246), INT64_C( 5972004423273890144),
+                             INT64_C( 4692398279143803546), INT64_C( 2910681234237196627)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C(-1655358171425978135), INT64_C(-4359650665125226703),
+                             INT64_C(-5138089786652473252), INT64_C( 3627763070596744769)),
+      simde_mm256_set_epi64x(INT64_C( 6528216320682834986), INT64_C(-4359650665125226703),
+                             INT64_C( 5935224417682860074), INT64_C(-1337301111257773515)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C(-6230823063844730631), INT64_C(-7435839773259188151),
+                             INT64_C( 6528451455712733974), INT64_C(-5394843500204440332)),
+      simde_mm256_set_epi64x(INT64_C( 6920111496335722490), INT64_C(-6983273897125122589),
+                             INT64_C( 2003090123549138412), INT64_C(-5394843500204440332)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                  -1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cmpeq_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmpeq_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(  18,    7, -113,   75,   69,  -85, -106, -121,
+                            -64,   98,  -29,  109,   60,   60,  -91,  107,
+                            -77,  100,   25,  -49,  -50, -105,   75,   79,
+                            -24,  -47,   15, -102,   28,  -77, -111,  -57),
+      simde_mm256_set_epi8(  14,  -92,  121,  -48,  -32, -113,  -97,  -91,
+                            -64,   97,  -90,  -59,   60,  125,  114,  107,
+                            -77,  100,  -33,  -73,  -50,  -91,   52,   72,
+                            -24,  -69,   11,  -97,  113,  -77, -111,  -57),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,    0,    0,    0,
+                             -1,    0,    0,    0,   -1,    0,    0,   -1,
+                             -1,   -1,    0,    0,   -1,    0,    0,    0,
+                             -1,    0,    0,    0,    0,   -1,   -1,   -1) },
+    { simde_mm256_set_epi8(  -9,   35,  110,  -46,   71,  -52,  -60,   -2,
+                            -39,  111,   72,    0,  -20,  -53, -109,   72,
+                             18,    2,  123,  -46,  -89,   -1,   47,  -88,
+                             28,  -52,  112,   75,   39, -112,  -26,    2),
+      simde_mm256_set_epi8(  -9,   52,  -99,  -14,  -68, -106,  -60,  124,
+                             23,    4,   94,    0,  -87,  123,   81,   72,
+                             18,    2,  -96, -103,  -98,  -85,   47,  -88,
+                             28,   62,  -97, -119,   39,   75,   98,    2),
+      simde_mm256_set_epi8(  -1,    0,    0,    0,    0,    0,   -1,    0,
+                              0,    0,    0,   -1,    0,    0,    0,   -1,
+                             -1,   -1,    0,    0,    0,    0,   -1,   -1,
+                             -1,    0,    0,    0,   -1,    0,    0,   -1) },
+    { simde_mm256_set_epi8(-106,  -61,  -56,   51,  104,  111,  -71,   42,
+                           -125,  -51,  102,   42, -119,   67, -127,   78,
+                            -72,   61,  -79,  -18,   80, -107,  111,   90,
+                            -57,  -99,  -38,  -13, -100, -110,  -62,   -4),
+      simde_mm256_set_epi8( -72,  -40,  -56,  106,   87,   53,   11,  -58,
+                            -75,  -51,  -40,   42,   61,   67, -127,   78,
+                            -72,  -67,    9,  -18,   80, -107,  -20,   90,
+                            -82,  100,  -38,  -13,  -49,   -8,  -92,  -28),
+      simde_mm256_set_epi8(   0,    0,   -1,    0,    0,    0,    0,    0,
+                              0,   -1,    0,   -1,    0,   -1,   -1,   -1,
+                             -1,    0,    0,   -1,   -1,   -1,    0,   -1,
+                              0,    0,   -1,   -1,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8(  10,   57,  -56,   -1,  -81,   -1,  103,   73,
+                           -100,  114,  -82, -105,  -86,  -79,  -10,  119,
+                            -29,  -13,   84, -101,  -72,  -39,  -15,  -89,
+                             13,  -38,   -8,  -25,    3,  -19, -126,   85),
+      simde_mm256_set_epi8( -15,   45,  -56,   -1,   72,   -1, -124,  105,
+                           -100,  114,  -82,   12,  -53,  -27,  109,  119,
+                            -29,  -13,   -4,    3, -116,  -28,  -79,  -49,
+                             32, -100,  -19,  -25,   69,  -19,  104,    9),
+      simde_mm256_set_epi8(   0,    0,   -1,   -1,    0,   -1,    0,    0,
+                             -1,   -1,   -1,    0,    0,    0,    0,   -1,
+                             -1,   -1,    0,    0,    0,    0,    0,    0,
+                              0,    0,    0,   -1,    0,   -1,    0,    0) },
+    { simde_mm256_set_epi8(-113, -109,  -86,  113,   10,   11,   96,   91,
+                           -111,   -8,  -85,  -82,   29,  -15,   -1,   12,
+                            -84,   22,   91,  -26,  -36,   39, -115,   79,
+                            -99,  -95,   90,  -72,  -62,  -15,  -74,  -79),
+      simde_mm256_set_epi8(  32, -109,  -16,   34,   10,   11,  -78,   59,
+                            -11, -114, -123,  -61,  -62,   63,  -23,  -75,
+                            -74,   22,  -28, -121,   18,   39,   68,   79,
+                             41,  -48,   90,   90,   46,  -15,   54,    9),
+      simde_mm256_set_epi8(   0,   -1,    0,    0,   -1,   -1,    0,    0,
+                              0,    0,    0,    0,    0,    0,    0,    0,
+                              0,   -1,    0,    0,    0,   -1,    0,   -1,
+                              0,    0,   -1,    0,    0,   -1,    0,    0) },
+    { simde_mm256_set_epi8(-116,  -88,  -83,   46, -123,  -25,  -45,  110,
+                             57,   16,   91,   70,  -24,   14,  103, -101,
+                            -29,   16,   -5,   19, -105,  -65, -122,  -30,
+                             84,  -97,   30,   66,   65,   75,   -1,  -57),
+      simde_mm256_set_epi8(  29, -113,    9,   44, -123,  -45,  -45,  110,
+                             84,  -58,  -91,   87,   65,   14,  114,   68,
+                            -29,   12,    6, -122,  -45,  -65, -125,  -30,
+                             41,  -98,  -75,   40,  -47,   28,   60, -122),
+      simde_mm256_set_epi8(   0,    0,    0,    0,   -1,    0,   -1,   -1,
+                              0,    0,    0,    0,    0,   -1,    0,    0,
+                             -1,    0,    0,    0,    0,   -1,    0,   -1,
+                              0,    0,    0,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8( -86,   35,   78,  120,  -73,  -55,   43,   15,
+                            -19,    2,  -46,   77,  -15,  -84,  105, -108,
+                            -63, -101,  -25,  -69,  -75,    2, -121,  104,
+                            -14,   46,   54, -120,  115,  127, -124,  -18),
+      simde_mm256_set_epi8( -86,   35,    0,  120,  -73,  -65,   43,   15,
+                            -19, -115,  -46,   77,  -15,  -10,  -62,   75,
+                             55,   27,   80,   89, -121,    2,  -98,  -87,
+                              8,   26, -108, -120,  -38,   20,   51,   74),
+      simde_mm256_set_epi8(  -1,   -1,    0,   -1,   -1,    0,   -1,   -1,
+                             -1,    0,   -1,   -1,   -1,    0,    0,    0,
+                              0,    0,    0,    0,    0,   -1,    0,    0,
+                              0,    0,    0,   -1,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8( -58,  -37, -112,  -21,    2,  103, -113, -120,
+                            -64,  -76,   17, -102,  -14,  -54,    2,   50,
+                            107,  -46,   70,  -49, -100,   24,   38,  -86,
+                             25,  -41,  -70, -121,   13,  124,   25,    3),
+      simde_mm256_set_epi8( -58,  -82, -112,  -21,  -57,  103,  -45, -120,
+                             39, -115,   19, -102,    0,  -75,    2,  -10,
+                            107,   96,   82, -125, -100,   12, -127,  -86,
+                             57,  -41,  -70,  -82, -123,  -99,   25,  -33),
+      simde_mm256_set_epi8(  -1,    0,   -1,   -1,    0,   -1,    0,   -1,
+                              0,    0,    0,   -1,    0,    0,   -1,    0,
+                             -1,    0,    0,    0,   -1,    0,    0,   -1,
+                              0,   -1,   -1,    0,    0,    0,   -1,    0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cmpeq_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmpgt_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(  9352,    502, -31558, -17574,  20100,  32359,  10359,  28040,
+                             -6625, -30288,  18617,  29335,  32481, -24532,  13526,  16553),
+      simde_mm256_set_epi16( 18687,   6128, -15573, -17574,  20100, -20092,  10359, -18905,
+                            -28302, -30288,  18617,  -3132,  32481,  20979,  13526, -18932),
+      simde_mm256_set_epi16(     0,      0,      0,      0,      0,     -1,      0,     -1,
+                                -1,      0,      0,     -1,      0,      0,      0,     -1) },
+    { simde_mm256_set_epi16( 22993, -23202, -24833,   3089,  29974, -17233,  31567,  16872,
+                            -29171, -14215,  -1607,  22232,  -1088,   5436, -26116,  22928),
+      simde_mm256_set_epi16( 22993,  -3134,   2860,   3089,   1591,   8636,  21191,  18919,
+                             -6631,  26084,  -1607,  22232,  27829,  27949, -11297,  22928),
+      simde_mm256_set_epi16(     0,      0,      0,      0,     -1,      0,     -1,      0,
+                                 0,      0,      0,      0,      0,      0,      0,      0) },
+    { simde_mm256_set_epi16( -6446, -26155,  16982,   5542, -27606,  19974,    -41,  10715,
+                            -29866,   3135,  -2028, -27814,   4232, -29291,  -2311,  24964),
+      simde_mm256_set_epi16(  9560, -26155,  16982,   5542, -27606, -20427,  10623, -22107,
+                            -12344,  -9506,  -2028,  12811,   4232, -17512,  20198, -13150),
+      simde_mm256_set_epi16(     0,      0,      0,      0,      0,     -1,      0,     -1,
+                                 0,     -1,      0,      0,      0,      0,      0,     -1) },
+    { simde_mm256_set_epi16(-16812,   2922,  10099, -17930, -24608,  -6326, -25902,  27842,
+                            -25201,  -7529, -10290,  20546,  16414, -13801,   -730,  19028),
+      simde_mm256_set_epi16(-16812,  25571, -20745, -17930,   8422, -18626,  -4787,  27842,
+                            -20252, -24937, -10290,  19700, -32510, -13801,   -730, -12701),
+      simde_mm256_set_epi16(     0,      0,     -1,      0,      0,     -1,      0,      0,
+                                 0,     -1,      0,     -1,     -1,      0,      0,     -1) },
+    { simde_mm256_set_epi16( -2943,  28256,  22776,  16501, -24378, -29357, -10657,  25460,
+                            -23671,  13165,  -1518, -18388, -11430,   1312,  23079,  -2899),
+      simde_mm256_set_epi16( -2943,  -8068,   1569,  21746, -15477,   2857, -27458,   -426,
+                             30731,  16440,  11252, -18388, -11430, -11504,  23079,  21588),
+      simde_mm256_set_epi16(     0,     -1,     -1,      0,      0,      0,     -1,     -1,
+                                 0,      0,      0,      0,      0,     -1,      0,      0) },
+    { simde_mm256_set_epi16(  6649,  17893,  31758,   2108,  -6180, -15308,  31746, -18771,
+                            -18752,  32588,  31961,  -9605,  17884,    899, -17879,  26811),
+      simde_mm256_set_epi16(  6649,   -489,  31758, -11223,  -6180, -15308,  31746, -25007,
+                             -5094,  32588,  31961,  -9605, -20406,    899,  21164,  23902),
+      simde_mm256_set_epi16(     0,     -1,      0,     -1,      0,      0,      0,     -1,
+                                 0,      0,      0,      0,     -1,      0,      0,     -1) },
+    { simde_mm256_set_epi16( 20603,  25842, -14178,   1071, -26272,  -3917, -10115,  -9076,
+                             -3804,   1290,  -3383, -29271,  -1238, -12464,  -5685,   7229),
+      simde_mm256_set_epi16( 20603,  25842,   -214,   8328, -10377,  -3917, -10115,  -9076,
+                             -3804,   1290,   5308, -29271, -11642, -22294,  -5685,  25054),
+      simde_mm256_set_epi16(     0,      0,      0,      0,      0,      0,      0,      0,
+                                 0,      0,      0,      0,     -1,     -1,      0,      0) },
+    { simde_mm256_set_epi16( -4350,  30923,  16793, -26539,   3563,  11587,  13794,  12452,
+                            -28143,  18445, -24066,  19288,  24115,  -9530,  22688,  -7042),
+      simde_mm256_set_epi16(-29401,  30923,  16793, -26539,   3563,   1132,  -7281,  27734,
+                            -28143, -24905, -10949,  19288, -17714,  -9530, -27790, -10690),
+      simde_mm256_set_epi16(    -1,      0,      0,      0,      0,     -1,     -1,      0,
+                                 0,     -1,      0,      0,     -1,      0,     -1,     -1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cmpgt_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmpgt_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( 1173208052,    70540429,  -271046555, -2113262459,
+                             2081615446,  -734159677,   154764406,  2035548200),
+      simde_mm256_set_epi32(-1761575574,    70540429, -1326857366,   903638822,
+                             2081615446,  -838258299,  -491358628,  -459720142),
+      simde_mm256_set_epi32(         -1,           0,          -1,           0,
+                                      0,          -1,          -1,          -1) },
+    { simde_mm256_set_epi32(  140062453, -1316812331,   655711614,  1986991048,
+                             1504085505,   760381047, -1853612112,   536298540),
+      simde_mm256_set_epi32(  375372488, -1543469416,   655711614,  -693278037,
+                             1870609634, -1582763453, -1853612112,  1230459349),
+      simde_mm256_set_epi32(          0,          -1,           0,          -1,
+                                      0,          -1,           0,           0) },
+    { simde_mm256_set_epi32(  291855418,  1083993713,  1495992849, -1665231939,
+                              -79561613,  -633808519,  2025460741,   750446080),
+      simde_mm256_set_epi32(  291855418,   637759749,  -939978534, -1665231939,
+                            -2096474672,  1280362525,  1498953247,   750446080),
+      simde_mm256_set_epi32(          0,          -1,          -1,           0,
+                                     -1,           0,          -1,           0) },
+    { simde_mm256_set_epi32(-1285606333,  1111324180,   659644485,  1575326431,
+                             1271993699,  1998640291,   360941120,  1105563478),
+      simde_mm256_set_epi32(-1285606333,  -488529798, -1594975840,  -715011466,
+                             -778411091,  1125369081,  1270411933,  1105563478),
+      simde_mm256_set_epi32(          0,          -1,          -1,          -1,
+                                     -1,          -1,           0,           0) },
+    { simde_mm256_set_epi32(-1839274906,  1149059561,  1781776577,  1609147971,
+                             1734109879,   918459536,  -952725097, -1844146417),
+      simde_mm256_set_epi32( 1385895684,  1149059561,   497188974,  -414983187,
+                               86975123,  -943398257,  -952725097, -1305656658),
+      simde_mm256_set_epi32(          0,           0,          -1,          -1,
+                                     -1,          -1,           0,           0) },
+    { simde_mm256_set_epi32(-2000737944, -1136168995,  1163571391,   501717578,
+                            -1479377903,    24426956,  1299942552,   776437057),
+      simde_mm256_set_epi32( 1562132521, -1136168995,  1928870534,     9922940,
+                            -1479377903, -1945775953,  1299942552,   302610111),
+      simde_mm256_set_epi32(          0,           0,           0,          -1,
+                                      0,          -1,           0,          -1) },
+    { simde_mm256_set_epi32( -910897403,  1075803281,  1516219869,   932589844,
+                             2068233769,   511679656, -2021820453, -1574859628),
+      simde_mm256_set_epi32(-1847118426,  -477508762, -1072435420, -1438846736,
+                              665363195,    15143523, -2021820453, -1574859628),
+      simde_mm256_set_epi32(         -1,          -1,          -1,          -1,
+                                     -1,          -1,           0,           0) },
+    { simde_mm256_set_epi32(-1306119601,   529330023,  1893737094,  1170241460,
+                             1100544655, -1096864625,  1051174226,  1739148182),
+      simde_mm256_set_epi32(-1703414539,  -207164745,   977416365,  -520392756,
+                            -1706953691,   216420541,  1092348442,   434845277),
+      simde_mm256_set_epi32(         -1,          -1,          -1,          -1,
+                                     -1,           0,           0,          -1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cmpgt_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmpgt_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-4721364574191513408), INT64_C( 3363525020765874301),
+                             INT64_C(  411476295706714623), INT64_C(-6142190510688025589)),
+      simde_mm256_set_epi64x(INT64_C(-4721364574191513408), INT64_C( 2460350673371614221),
+                             INT64_C( 2356056517803719210), INT64_C( 1756973284994194492)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C( 3970864076251538921), INT64_C(-7131407396652685127),
+                             INT64_C(-7498629503733741460), INT64_C( -380281099652093202)),
+      simde_mm256_set_epi64x(INT64_C(-7716379879094892372), INT64_C(-7131407396652685127),
+                             INT64_C( 8198950453942033119), INT64_C(-2228884709862379961)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                  -1)) },
+    { simde_mm256_set_epi64x(INT64_C( 4639369293664024465), INT64_C(-2034706226608108012),
+                             INT64_C( 4883458616980074121), INT64_C(-6869092521904900485)),
+      simde_mm256_set_epi64x(INT64_C(-7325984019880054365), INT64_C(  570993423074268738),
+                             INT64_C( 6399292456261310316), INT64_C(-6869092521904900485)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C(-4848618951913541857), INT64_C( 3321242162052715851),
+                             INT64_C(  622652397393414032), INT64_C(-3881848110700746799)),
+      simde_mm256_set_epi64x(INT64_C(-3606919425553042097), INT64_C( 7858690231271485043),
+                             INT64_C( -150229284249155411), INT64_C(-3881848110700746799)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C(  915230610794981945), INT64_C(-3806179596037680329),
+                             INT64_C( 8750394264623291279), INT64_C(-1214637345139374867)),
+      simde_mm256_set_epi64x(INT64_C(-8076074322479053935), INT64_C(-3806179596037680329),
+                             INT64_C(  388586998499560824), INT64_C( 2782179788198979950)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C(-2662834928377800913), INT64_C( 3404129813576023514),
+                             INT64_C( 7671571362138331443), INT64_C(-4175690794422876986)),
+      simde_mm256_set_epi64x(INT64_C(-2662834928377800913), INT64_C( 3404129813576023514),
+                             INT64_C(-5515570493985240605), INT64_C(-4175690794422876986)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                  -1), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C(  972812586689833266), INT64_C( 8405425643069385802),
+                             INT64_C(-6778293217168448094), INT64_C(-4669792757708489757)),
+      simde_mm256_set_epi64x(INT64_C(-7194104730267287060), INT64_C( 8405425643069385802),
+                             INT64_C( 7365744009545278224), INT64_C( 1405538549716236367)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C( 4249189262233219819), INT64_C( 5306406017859900813),
+                             INT64_C(-6630417708603372548), INT64_C( 2702017981656199723)),
+      simde_mm256_set_epi64x(INT64_C( 2932206182600888256), INT64_C(-8867306575582258926),
+                             INT64_C( 1046210391731634388), INT64_C( 2702017981656199723)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                  -1),
+                             INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cmpgt_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cmpgt_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -98,   91,  -13,  -93,   -7,   87,  -41,  -38,
+                            -65,   70,   33,   35,  -42,  -52,  -87,  118,
+                              5,  -82,  -55,  -36,  -90, -109,  115,  -37,
+                           -120,  -41,  118,  113, -116, -117,   51,    7),
+      simde_mm256_set_epi8( -98,   44,   78,   94,   -7,  -17,   73,  -45,
+                             47,   87,  -92,   59,  -42,  -52,  -91,  118,
+                             60,  -17,   58,  -36,  -90, -109,  -31, -115,
+                            -95, -105,  -40,  113, -116, -117,   51,  113),
+      simde_mm256_set_epi8(   0,   -1,    0,    0,    0,   -1,    0,   -1,
+                              0,    0,   -1,    0,    0,    0,   -1,    0,
+                              0,    0,    0,    0,    0,    0,   -1,   -1,
+                              0,   -1,   -1,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8(-118,   78,   22,   20,   43,  121,   54, -102,
+                            -97,  101,   58,   47,  111,  -75,   53,  -26,
+                             23,  123, -108,  121,   43,  -27, INT8_MIN,  -89,
+                             75,   -5,  -93,  -74,  -33,  -78,  106,  -78),
+      simde_mm256_set_epi8( -12,   22,   77,   20,  -72,   27,  -74,   63,
+                            -97,  101,  -21,   31,   17,  -75,  -93,  -11,
+                              9,  123,   14,   47,   86,   88,   72,  -62,
+                             75,   49, -121,   87,  -33,  -49,   75,  115),
+      simde_mm256_set_epi8(   0,   -1,    0,    0,   -1,   -1,   -1,    0,
+                              0,    0,   -1,   -1,   -1,    0,   -1,    0,
+                             -1,    0,    0,   -1,    0,    0,    0,    0,
+                              0,    0,   -1,    0,    0,    0,   -1,    0) },
+    { simde_mm256_set_epi8( -86,  -63,   89,  -53,  -52,  -56,   82, -113,
+                            123,  110,   93,  -11,  -49,  -33,  -35,   33,
+                            -59,   62,  118,  -16,   16,  102,  -76,   20,
+                             82,   -7,  -86,  -53,   28,  -40,  -86, -123),
+      simde_mm256_set_epi8(  34,  -63,    5,  -32,  -52,  -44,  -79, -113,
+                            123,  110,   93,   93,  -49,  -90,  -35,   18,
+                              0,    7,  101,  -21,   50,   98,   40,   20,
+                             82,   -7,   25,   90,   68,  -44,  -86,  -22),
+      simde_mm256_set_epi8(   0,    0,   -1,    0,    0,    0,   -1,    0,
+                              0,    0,    0,    0,    0,   -1,    0,   -1,
+                              0,   -1,   -1,   -1,    0,   -1,    0,    0,
+                              0,    0,    0,    0,    0,   -1,    0,    0) },
+    { simde_mm256_set_epi8( -49,    5,  -13,  -32,   65,  -60,  -62,   37,
+                            -59,   92,   41,  127,  -76,  -51, -116,  -65,
+                            -91,   11,   70,   42, -119,  -61,  -47, -101,
+                            114,   97,  -34,   88, -105,  111,  -25,  -37),
+      simde_mm256_set_epi8( 106,   35,  -13,  -21, -120,  -68,  -62,  127,
+                            -59,   92,   41, -111,  -28,  114,   61,  -65,
+                           -102,   11, -124,  -45, -119,  -40,  -55,   16,
+                             60,   97,  -34,  -26,   28,   37,   -7,  -10),
+      simde_mm256_set_epi8(   0,    0,    0,    0,   -1,   -1,    0,    0,
+                              0,    0,    0,   -1,    0,    0,    0,    0,
+                             -1,    0,   -1,   -1,    0,    0,   -1,    0,
+                             -1,    0,    0,   -1,    0,   -1,    0,    0) },
+    { simde_mm256_set_epi8(  49,   94,  -34,  -13,  -17,  -69,   -3,   99,
+                            -95,  113,   61,  -39,  -87,  -86, -117,  -10,
+                           -122,  -75,   49,   43,   35,  106,   36, -107,
+                           -125,  -53,   23,  -72, -113,   67,  -98,  -54),
+      simde_mm256_set_epi8(  49,   94,  -34,  -13, INT8_MIN,   95,   -3,   99,
+                             -8,  -82,   61,   52, -124,  100, -117,  -10,
+                           -122,   49,   87, -114,   35,  106,   46, -107,
+                           -102,   -4, -119,  -72,  122,   67,  -54,  -54),
+      simde_mm256_set_epi8(   0,    0,    0,    0,   -1,    0,    0,    0,
+                              0,   -1,    0,    0,   -1,    0,    0,    0,
+                              0,    0,    0,   -1,    0,    0,    0,    0,
+                              0,    0,   -1,    0,    0,    0,    0,    0) },
+    { simde_mm256_set_epi8(  83,   22, -125,  118,  -95, -126,  124,   16,
+                            -36,   42,   63,   25,   11, -114,  -56,   76,
+                             31, -104,   -6,   27,   49,   92,   61,   11,
+                           -126,   79,  -59,   79,   63, -126,  -58,   30),
+      simde_mm256_set_epi8( -55,  123,   57,  -52, -119, -124,    2,   16,
+                            -36,   66,   22,   25,  -44,    0,  117,   95,
+                             31,  -46,  108,    7,  -52, -107,   61,   94,
+                           -107,  -11,   59,  -26,   48,   29,  -58,   30),
+      simde_mm256_set_epi8(  -1,    0,    0,   -1,   -1,    0,   -1,    0,
+                              0,    0,   -1,    0,   -1,    0,    0,    0,
+                              0,    0,    0,   -1,   -1,   -1,    0,    0,
+                              0,   -1,    0,   -1,   -1,    0,    0,    0) },
+    { simde_mm256_set_epi8( -99,  115,  -36,   -7,  -48,   -9,   92,  -45,
+                             75,  -71,  -81,   20,  -20,   52,   61,  115,
+                             33,    4, -117,   95,  125,   94,  -53,  -68,
+                            -75,   55,   76,   57,  -69,   89,   30,  -80),
+      simde_mm256_set_epi8( -99,  115,  -36,  -75,  -68,   -9,   92,  -45,
+                             49,  -71,  -81,   20,  -20,   52,  -93,  -83,
+                             33, -110,  116,   13,  -26,   92, -123,  -68,
+                           -108,   92, -111,   53,  -83,  -45,   66,  -80),
+      simde_mm256_set_epi8(   0,    0,    0,   -1,   -1,    0,    0,    0,
+                             -1,    0,    0,    0,    0,    0,   -1,   -1,
+                              0,   -1,    0,   -1,   -1,   -1,   -1,    0,
+                             -1,    0,   -1,   -1,   -1,   -1,    0,    0) },
+    { simde_mm256_set_epi8(  10,  -47,  105,   -5,  -45,   40,   12, -116,
+                             90,   74,   69,   29,  110,   17,  -45,  122,
+                            123, -121,  -81,   75,   57,   -2,   61,   -2,
+                            102,   -4,  108,   95,  121,  -70,  -91,   41),
+      simde_mm256_set_epi8(  10, -126,  105,   80,  -45,   40,   90,   29,
+                             25,   74,   69,   29, -124,   77,  -45,   79,
+                            123, -121,    9,   67,  -42,   -2,   34, INT8_MIN,
+                             79,   -4,  108,  120,  121,  -70,  -91,  106),
+      simde_mm256_set_epi8(   0,   -1,    0,    0,    0,    0,    0,    0,
+                             -1,    0,    0,    0,   -1,    0,    0,   -1,
+                              0,    0,    0,   -1,   -1,    0,   -1,   -1,
+                             -1,    0,    0,    0,    0,    0,    0,    0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_cmpgt_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i32gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const int32_t table[32] = {
+     2007895027,  -829299312,   383820229,  -515582232,
+     1317384406,  1962916072,  2046340519, -1712832678,
+      -63406598,   967928689,   247950592,  1356176394,
+     -855446148, -1277964867,  -629184109,  1847487725,
+    -1300596602,  1278660827, -1884064769, -1683937587,
+     -494381358,   290034711, -1901383782,   873776252,
+     1291338222, -1305600347,  1676228649,  -678548945,
+    -1241580122,   658182310,  1168993537, -1025662741
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(         25,          13,           8,          13,
+                                      1,          21,          12,          14),
+      simde_mm256_set_epi32(-1305600347, -1277964867,   -63406598, -1277964867,
+                             -829299312,   290034711,  -855446148,  -629184109) },
+    { simde_mm256_set_epi32(         13,           4,           7,           7,
+                                     15,          31,          11,           4),
+      simde_mm256_set_epi32(-1277964867,  1317384406, -1712832678, -1712832678,
+                             1847487725, -1025662741,  1356176394,  1317384406) },
+    { simde_mm256_set_epi32(          6,          19,          27,          18,
+                                     23,          19,          21,           8),
+      simde_mm256_set_epi32( 2046340519, -1683937587,  -678548945, -1884064769,
+                              873776252, -1683937587,   290034711,   -63406598) },
+    { simde_mm256_set_epi32(         18,           7,           7,           2,
+                                     25,          12,          31,           2),
+      simde_mm256_set_epi32(-1884064769, -1712832678, -1712832678,   383820229,
+                            -1305600347,  -855446148, -1025662741,   383820229) },
+    { simde_mm256_set_epi32(         12,           3,          28,          24,
+                                     25,          30,          19,          27),
+      simde_mm256_set_epi32( -855446148,  -515582232, -1241580122,  1291338222,
+                            -1305600347,  1168993537, -1683937587,  -678548945) },
+    { simde_mm256_set_epi32(         18,           7,          16,          15,
+                                     25,           8,          10,          30),
+      simde_mm256_set_epi32(-1884064769, -1712832678, -1300596602,  1847487725,
+                            -1305600347,   -63406598,   247950592,  1168993537) },
+    { simde_mm256_set_epi32(          8,          15,           3,          24,
+                                     10,          29,           6,          23),
+      simde_mm256_set_epi32(  -63406598,  1847487725,  -515582232,  1291338222,
+                              247950592,   658182310,  2046340519,   873776252) },
+    { simde_mm256_set_epi32(          8,          19,          28,          23,
+                                     12,           3,          23,          20),
+      simde_mm256_set_epi32(  -63406598, -1683937587, -1241580122,   873776252,
+                             -855446148,  -515582232,   873776252,  -494381358) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_i32gather_epi32(table, test_vec[i].vindex, 4);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i32gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const int64_t table[16] = {
+    INT64_C(  798934894463300133), INT64_C(-5299379537437197592),
+    INT64_C( 6281390634257325176), INT64_C(-4867678867779223805),
+    INT64_C( 7815624718604612566), INT64_C(-2145627117487466001),
+    INT64_C(    6250836183243760), INT64_C( -402852186061212586),
+    INT64_C(-4663047988760992869), INT64_C( 4422378450011731937),
+    INT64_C(-3729034870492016635), INT64_C( 8757114595669194705),
+    INT64_C(-5084293368143914364), INT64_C(-3413471557952636130),
+    INT64_C(-5373704756121388211), INT64_C( 1261559091691141428)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(          2,          10,           3,           1),
+      simde_mm256_set_epi64x(INT64_C( 6281390634257325176), INT64_C(-3729034870492016635),
+                             INT64_C(-4867678867779223805), INT64_C(-5299379537437197592)) },
+    { simde_mm_set_epi32(         14,           9,           8,           9),
+      simde_mm256_set_epi64x(INT64_C(-5373704756121388211), INT64_C( 4422378450011731937),
+                             INT64_C(-4663047988760992869), INT64_C( 4422378450011731937)) },
+    { simde_mm_set_epi32(          9,           3,           8,          14),
+      simde_mm256_set_epi64x(INT64_C( 4422378450011731937), INT64_C(-4867678867779223805),
+                             INT64_C(-4663047988760992869), INT64_C(-5373704756121388211)) },
+    { simde_mm_set_epi32(          6,           4,          11,           0),
+      simde_mm256_set_epi64x(INT64_C(    6250836183243760), INT64_C( 7815624718604612566),
+                             INT64_C( 8757114595669194705), INT64_C(  798934894463300133)) },
+    { simde_mm_set_epi32(         11,           1,           4,          13),
+      simde_mm256_set_epi64x(INT64_C( 8757114595669194705), INT64_C(-5299379537437197592),
+                             INT64_C( 7815624718604612566), INT64_C(-3413471557952636130)) },
+    { simde_mm_set_epi32(          8,           5,           2,           9),
+      simde_mm256_set_epi64x(INT64_C(-4663047988760992869), INT64_C(-2145627117487466001),
+                             INT64_C( 6281390634257325176), INT64_C( 4422378450011731937)) },
+    { simde_mm_set_epi32(          7,           8,          13,          12),
+      simde_mm256_set_epi64x(INT64_C( -402852186061212586), INT64_C(-4663047988760992869),
+                             INT64_C(-3413471557952636130), INT64_C(-5084293368143914364)) },
+    { simde_mm_set_epi32(         11,           7,          12,           9),
+      simde_mm256_set_epi64x(INT64_C( 8757114595669194705), INT64_C( -402852186061212586),
+                             INT64_C(-5084293368143914364), INT64_C( 4422378450011731937)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_i32gather_epi64(table, test_vec[i].vindex, 8);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i32gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const simde_float64 table[16] = {
+       -54.49,   -386.44,    367.84,    327.07,
+        98.24,   -239.79,    977.30,    919.23,
+      -849.57,   -714.00,    763.85,    -80.17,
+       -28.12,    527.91,    656.34,    686.32
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(          9,          15,           0,          13),
+      simde_mm256_set_pd(  -714.00,    686.32,    -54.49,    527.91) },
+    { simde_mm_set_epi32(         14,           5,           9,          14),
+      simde_mm256_set_pd(   656.34,   -239.79,   -714.00,    656.34) },
+    { simde_mm_set_epi32(         11,          13,          12,          14),
+      simde_mm256_set_pd(   -80.17,    527.91,    -28.12,    656.34) },
+    { simde_mm_set_epi32(          2,           5,           9,           9),
+      simde_mm256_set_pd(   367.84,   -239.79,   -714.00,   -714.00) },
+    { simde_mm_set_epi32(         10,           7,          11,           1),
+      simde_mm256_set_pd(   763.85,    919.23,    -80.17,   -386.44) },
+    { simde_mm_set_epi32(          9,          14,          12,           6),
+      simde_mm256_set_pd(  -714.00,    656.34,    -28.12,    977.30) },
+    { simde_mm_set_epi32(         13,           8,           6,          14),
+      simde_mm256_set_pd(   527.91,   -849.57,    977.30,    656.34) },
+    { simde_mm_set_epi32(         10,           8,           2,           0),
+      simde_mm256_set_pd(   763.85,   -849.57,    367.84,    -54.49) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_i32gather_pd(table, test_vec[i].vindex, 8);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i32gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const simde_float32 table[32] = {
+      -178.35f,   -139.46f,   -427.29f,   -454.73f,
+       821.09f,   -661.65f,    307.67f,    649.91f,
+       540.08f,    882.04f,    524.46f,    758.83f,
+        39.77f,    860.16f,   -246.33f,   -850.62f,
+      -411.00f,   -306.57f,    520.07f,   -164.54f,
+      -296.60f,    735.93f,   -816.68f,    354.88f,
+      -606.62f,   -403.48f,    602.73f,    644.97f,
+      -991.21f,   -867.86f,   -361.09f,     81.08f
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(         30,          12,          19,          10,
+                                      3,           3,           1,          12),
+      simde_mm256_set_ps(  -361.09f,     39.77f,   -164.54f,    524.46f,
+                           -454.73f,   -454.73f,   -139.46f,     39.77f) },
+    { simde_mm256_set_epi32(         31,          20,           0,          16,
+                                      0,          25,          17,          15),
+      simde_mm256_set_ps(    81.08f,   -296.60f,   -178.35f,   -411.00f,
+                           -178.35f,   -403.48f,   -306.57f,   -850.62f) },
+    { simde_mm256_set_epi32(          9,          16,          11,          13,
+                                      6,           7,           3,          29),
+      simde_mm256_set_ps(   882.04f,   -411.00f,    758.83f,    860.16f,
+                            307.67f,    649.91f,   -454.73f,   -867.86f) },
+    { simde_mm256_set_epi32(          8,          27,          28,          13,
+                                     17,          15,          12,          18),
+      simde_mm256_set_ps(   540.08f,    644.97f,   -991.21f,    860.16f,
+                           -306.57f,   -850.62f,     39.77f,    520.07f) },
+    { simde_mm256_set_epi32(          2,          26,           1,          12,
+                                      3,          25,          24,          14),
+      simde_mm256_set_ps(  -427.29f,    602.73f,   -139.46f,     39.77f,
+                           -454.73f,   -403.48f,   -606.62f,   -246.33f) },
+    { simde_mm256_set_epi32(         26,          13,          20,          22,
+                                      9,          29,          29,          17),
+      simde_mm256_set_ps(   602.73f,    860.16f,   -296.60f,   -816.68f,
+                            882.04f,   -867.86f,   -867.86f,   -306.57f) },
+    { simde_mm256_set_epi32(          5,           1,          23,          14,
+                                     14,          16,           6,          10),
+      simde_mm256_set_ps(  -661.65f,   -139.46f,    354.88f,   -246.33f,
+                           -246.33f,   -411.00f,    307.67f,    524.46f) },
+    { simde_mm256_set_epi32(         10,          31,           9,           6,
+                                      2,           6,          19,          27),
+      simde_mm256_set_ps(   524.46f,     81.08f,    882.04f,    307.67f,
+                           -427.29f,    307.67f,   -164.54f,    644.97f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_i32gather_ps(table, test_vec[i].vindex, 4);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i64gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const int32_t table[32] = {
+     2007895027,  -829299312,   383820229,  -515582232,
+     1317384406,  1962916072,  2046340519, -1712832678,
+      -63406598,   967928689,   247950592,  1356176394,
+     -855446148, -1277964867,  -629184109,  1847487725,
+    -1300596602,  1278660827, -1884064769, -1683937587,
+     -494381358,   290034711, -1901383782,   873776252,
+     1291338222, -1305600347,  1676228649,  -678548945,
+    -1241580122,   658182310,  1168993537, -1025662741
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(                   5), INT64_C(                  29),
+                             INT64_C(                  29), INT64_C(                   0)),
+      simde_mm_set_epi32( 1962916072,   658182310,   658182310,  2007895027) },
+    { simde_mm256_set_epi64x(INT64_C(                   6), INT64_C(                  12),
+                             INT64_C(                  19), INT64_C(                  24)),
+      simde_mm_set_epi32( 2046340519,  -855446148, -1683937587,  1291338222) },
+    { simde_mm256_set_epi64x(INT64_C(                  14), INT64_C(                  10),
+                             INT64_C(                  21), INT64_C(                   8)),
+      simde_mm_set_epi32( -629184109,   247950592,   290034711,   -63406598) },
+    { simde_mm256_set_epi64x(INT64_C(                   3), INT64_C(                   9),
+                             INT64_C(                  13), INT64_C(                   6)),
+      simde_mm_set_epi32( -515582232,   967928689, -1277964867,  2046340519) },
+    { simde_mm256_set_epi64x(INT64_C(                  25), INT64_C(                  10),
+                             INT64_C(                  28), INT64_C(                  31)),
+      simde_mm_set_epi32(-1305600347,   247950592, -1241580122, -1025662741) },
+    { simde_mm256_set_epi64x(INT64_C(                  27), INT64_C(                   6),
+                             INT64_C(                  21), INT64_C(                  30)),
+      simde_mm_set_epi32( -678548945,  2046340519,   290034711,  1168993537) },
+    { simde_mm256_set_epi64x(INT64_C(                  14), INT64_C(                  16),
+                             INT64_C(                  25), INT64_C(                  26)),
+      simde_mm_set_epi32( -629184109, -1300596602, -1305600347,  1676228649) },
+    { simde_mm256_set_epi64x(INT64_C(                  10), INT64_C(                  11),
+                             INT64_C(                  14), INT64_C(                   7)),
+      simde_mm_set_epi32(  247950592,  1356176394,  -629184109, -1712832678) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm256_i64gather_epi32(table, test_vec[i].vindex, 4);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i64gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const int64_t table[16] = {
+    INT64_C(  798934894463300133), INT64_C(-5299379537437197592),
+    INT64_C( 6281390634257325176), INT64_C(-4867678867779223805),
+    INT64_C( 7815624718604612566), INT64_C(-2145627117487466001),
+    INT64_C(    6250836183243760), INT64_C( -402852186061212586),
+    INT64_C(-4663047988760992869), INT64_C( 4422378450011731937),
+    INT64_C(-3729034870492016635), INT64_C( 8757114595669194705),
+    INT64_C(-5084293368143914364), INT64_C(-3413471557952636130),
+    INT64_C(-5373704756121388211), INT64_C( 1261559091691141428)
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(                   5), INT64_C(                  11),
+                             INT64_C(                  15), INT64_C(                  11)),
+      simde_mm256_set_epi64x(INT64_C(-2145627117487466001), INT64_C( 8757114595669194705),
+                             INT64_C( 1261559091691141428), INT64_C( 8757114595669194705)) },
+    { simde_mm256_set_epi64x(INT64_C(                  12), INT64_C(                   2),
+                             INT64_C(                  11), INT64_C(                  13)),
+      simde_mm256_set_epi64x(INT64_C(-5084293368143914364), INT64_C( 6281390634257325176),
+                             INT64_C( 8757114595669194705), INT64_C(-3413471557952636130)) },
+    { simde_mm256_set_epi64x(INT64_C(                  15), INT64_C(                   9),
+                             INT64_C(                  11), INT64_C(                   7)),
+      simde_mm256_set_epi64x(INT64_C( 1261559091691141428), INT64_C( 4422378450011731937),
+                             INT64_C( 8757114595669194705), INT64_C( -402852186061212586)) },
+    { simde_mm256_set_epi64x(INT64_C(                   2), INT64_C(                   3),
+                             INT64_C(                   1), INT64_C(                   4)),
+      simde_mm256_set_epi64x(INT64_C( 6281390634257325176), INT64_C(-4867678867779223805),
+                             INT64_C(-5299379537437197592), INT64_C( 7815624718604612566)) },
+    { simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   5),
+                             INT64_C(                   2), INT64_C(                   2)),
+      simde_mm256_set_epi64x(INT64_C(  798934894463300133), INT64_C(-2145627117487466001),
+                             INT64_C( 6281390634257325176), INT64_C( 6281390634257325176)) },
+    { simde_mm256_set_epi64x(INT64_C(                  13), INT64_C(                  14),
+                             INT64_C(                   1), INT64_C(                  13)),
+      simde_mm256_set_epi64x(INT64_C(-3413471557952636130), INT64_C(-5373704756121388211),
+                             INT64_C(-5299379537437197592), INT64_C(-3413471557952636130)) },
+    { simde_mm256_set_epi64x(INT64_C(                  13), INT64_C(                   9),
+                             INT64_C(                   8), INT64_C(                   4)),
+      simde_mm256_set_epi64x(INT64_C(-3413471557952636130), INT64_C( 4422378450011731937),
+                             INT64_C(-4663047988760992869), INT64_C( 7815624718604612566)) },
+    { simde_mm256_set_epi64x(INT64_C(                  11), INT64_C(                   8),
+                             INT64_C(                   2), INT64_C(                   4)),
+      simde_mm256_set_epi64x(INT64_C( 8757114595669194705), INT64_C(-4663047988760992869),
+                             INT64_C( 6281390634257325176), INT64_C( 7815624718604612566)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_i64gather_epi64(table, test_vec[i].vindex, 8);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i64gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const simde_float64 table[16] = {
+       -54.49,   -386.44,    367.84,    327.07,
+        98.24,   -239.79,    977.30,    919.23,
+      -849.57,   -714.00,    763.85,    -80.17,
+       -28.12,    527.91,    656.34,    686.32
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(                   7), INT64_C(                  10),
+                             INT64_C(                   3), INT64_C(                   6)),
+      simde_mm256_set_pd(   919.23,    763.85,    327.07,    977.30) },
+    { simde_mm256_set_epi64x(INT64_C(                   3), INT64_C(                  11),
+                             INT64_C(                  11), INT64_C(                  10)),
+      simde_mm256_set_pd(   327.07,    -80.17,    -80.17,    763.85) },
+    { simde_mm256_set_epi64x(INT64_C(                  14), INT64_C(                  15),
+                             INT64_C(                   8), INT64_C(                  10)),
+      simde_mm256_set_pd(   656.34,    686.32,   -849.57,    763.85) },
+    { simde_mm256_set_epi64x(INT64_C(                   7), INT64_C(                   2),
+                             INT64_C(                  12), INT64_C(                  12)),
+      simde_mm256_set_pd(   919.23,    367.84,    -28.12,    -28.12) },
+    { simde_mm256_set_epi64x(INT64_C(                   1), INT64_C(                  15),
+                             INT64_C(                  13), INT64_C(                  10)),
+      simde_mm256_set_pd(  -386.44,    686.32,    527.91,    763.85) },
+    { simde_mm256_set_epi64x(INT64_C(                   5), INT64_C(                   1),
+                             INT64_C(                   0), INT64_C(                   3)),
+      simde_mm256_set_pd(  -239.79,   -386.44,    -54.49,    327.07) },
+    { simde_mm256_set_epi64x(INT64_C(                  15), INT64_C(                   3),
+                             INT64_C(                   6), INT64_C(                  15)),
+      simde_mm256_set_pd(   686.32,    327.07,    977.30,    686.32) },
+    { simde_mm256_set_epi64x(INT64_C(                   7), INT64_C(                   6),
+                             INT64_C(                  15), INT64_C(                   9)),
+      simde_mm256_set_pd(   919.23,    977.30,    686.32,   -714.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_i64gather_pd(table, test_vec[i].vindex, 8);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i64gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const simde_float32 table[32] = {
+      -178.35f,   -139.46f,   -427.29f,   -454.73f,
+       821.09f,   -661.65f,    307.67f,    649.91f,
+       540.08f,    882.04f,    524.46f,    758.83f,
+        39.77f,    860.16f,   -246.33f,   -850.62f,
+      -411.00f,   -306.57f,    520.07f,   -164.54f,
+      -296.60f,    735.93f,   -816.68f,    354.88f,
+      -606.62f,   -403.48f,    602.73f,    644.97f,
+      -991.21f,   -867.86f,   -361.09f,     81.08f
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(                   3), INT64_C(                   0),
+                             INT64_C(                   3), INT64_C(                  18)),
+      simde_mm_set_ps(  -454.73f,   -178.35f,   -454.73f,    520.07f) },
+    { simde_mm256_set_epi64x(INT64_C(                  28), INT64_C(                  25),
+                             INT64_C(                  26), INT64_C(                  26)),
+      simde_mm_set_ps(  -991.21f,   -403.48f,    602.73f,    602.73f) },
+    { simde_mm256_set_epi64x(INT64_C(                  22), INT64_C(                  10),
+                             INT64_C(                  20), INT64_C(                  11)),
+      simde_mm_set_ps(  -816.68f,    524.46f,   -296.60f,    758.83f) },
+    { simde_mm256_set_epi64x(INT64_C(                  30), INT64_C(                  10),
+                             INT64_C(                   4), INT64_C(                  17)),
+      simde_mm_set_ps(  -361.09f,    524.46f,    821.09f,   -306.57f) },
+    { simde_mm256_set_epi64x(INT64_C(                  23), INT64_C(                   9),
+                             INT64_C(                  19), INT64_C(                   1)),
+      simde_mm_set_ps(   354.88f,    882.04f,   -164.54f,   -139.46f) },
+    { simde_mm256_set_epi64x(INT64_C(                  29), INT64_C(                   2),
+                             INT64_C(                  27), INT64_C(                  10)),
+      simde_mm_set_ps(  -867.86f,   -427.29f,    644.97f,    524.46f) },
+    { simde_mm256_set_epi64x(INT64_C(                   1), INT64_C(                  18),
+                             INT64_C(                  21), INT64_C(                   6)),
+      simde_mm_set_ps(  -139.46f,    520.07f,    735.93f,    307.67f) },
+    { simde_mm256_set_epi64x(INT64_C(                   6), INT64_C(                   7),
+                             INT64_C(                  18), INT64_C(                   3)),
+      simde_mm_set_ps(   307.67f,    649.91f,    520.07f,   -454.73f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm256_i64gather_ps(table, test_vec[i].vindex, 4);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_madd_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( 17641, -31171,   1401, -28617,  -9372,  21736, -13071,  17553,
+                              6911, -30617,  12438,  14131,  16875, -28453,  16307, -13540),
+      simde_mm256_set_epi16( -5777,  -6288, -22083, -29101,  13368, -13662,  -8012,  32161,
+                              5146,  27705, -17485, -26572,  22237, -15714,  18798, -31288),
+      simde_mm256_set_epi32(   94091191,   801845034,  -422242128,   669246885,
+                             -812679979,  -592967362,   822359817,   730178506) },
+    { simde_mm256_set_epi16(-25089,  25461,  -5148,  -6071,  -2349, -20496,    544, -30801,
+                             19191,  -9576,  30837,   4633,  14998,  19246,  31174, -11013),
+      simde_mm256_set_epi16(  1131,   5859,  19534,  -8740, -13422,   5836,   8721,   2558,
+                             15476, -27646,  13974,  14277,  22044,  16595,  10298,  32236),
+      simde_mm256_set_epi32(  120800340,   -47500492,   -88086378,   -74044734,
+                              561738012,   497061579,   650003282,   -33985216) },
+    { simde_mm256_set_epi16( 23027, -29700, -12980,  -4872,   2154, -19731, -14350,   1274,
+                             16488,  20631, -11696,  29771, -23678,  22024,  12260,   2520),
+      simde_mm256_set_epi16( -1750,  12739,  -4869,  -3855,  22880, -12143, -28591,   3448,
+                            -31079,  18361,   7367, -25808,    193,  18741,  11827, -28027),
+      simde_mm256_set_epi32( -418645550,    81981180,   288877053,   414673602,
+                             -133624761,  -854494400,   408181930,    74370980) },
+    { simde_mm256_set_epi16( 16690,  -1850, -25955,     97,  19305,   5026,   6866,  32688,
+                             26349,  30653, -25254,  26176,  -9110,    987, -27582,  -2513),
+      simde_mm256_set_epi16(-22150, -26581,  11717,   3429,   2603,  31520, -32568,  30240,
+                             12999, -11212,  23718, -16183,  -6209,  -3455, -17220,  21746),
+      simde_mm256_set_epi32( -320508650,  -303782122,   208670435,   764873232,
+                               -1170785, -1022580580,    53153905,   420314342) },
+    { simde_mm256_set_epi16(-28796, -13770,  -3387,  -6293,   3314,  29967,  -5860,  19559,
+                             14583, -12515,  10348,   -877,  28436,  23666, -27359, -17279),
+      simde_mm256_set_epi16(-22555, -16238,  18619, -18659,  -6813, -21091,  19134, -10569,
+                              8925,   5452,  16726, -15645, -24904, -23062,  15953, -22084),
+      simde_mm256_set_epi32(  873091040,    54358534,  -654612279,  -318844311,
+                               61921495,   186801313, -1253955436,   -54868691) },
+    { simde_mm256_set_epi16(-19243, -22546,  -3821,  23387, -29471,   9795,   -911,  -9028,
+                             21965,   8892,  -9512,   6980,  29664, -13394,  13637, -16066),
+      simde_mm256_set_epi16( 27619,  17341,  29702,  15302, -27210,   1838, -27709, -10809,
+                            -21589,   4172, -15426,  30463,  -8960, -14231,   2569,  -2506),
+      simde_mm256_set_epi32( -922442603,   244376532,   819909120,   122826551,
+                             -437104961,   359363852,   -75179426,    75294849) },
+    { simde_mm256_set_epi16(-14038, -26284,  29028,  15040, -29224,  -1033, -11511,  31643,
+                             19929,  28559,  10178,  15181, -31010,  25623, -31433,  -7685),
+      simde_mm256_set_epi16( -9621,   5690,  -9054,   1191,   5633,  13668, -13337,  23087,
+                             27456, -29458,  28353,   4674,   9406,   4669,  13613,   9680),
+      simde_mm256_set_epi32(  -14496362,  -244906872,  -178737836,   884064148,
+                             -294120398,   359532828,  -172046273,  -502288229) },
+    { simde_mm256_set_epi16( 12879, -15402,  -1599, -23642,  18445, -24561,  -3255,  -6336,
+                             -8643,  11867, -12161, -28869,  12520,   7705, -21391, -17244),
+      simde_mm256_set_epi16(-19165,   8607, -26710,  28292,  24283,  -5909,  25131,  -1623,
+                            -19028, -27692, -13728,  12302, -12091, -17591,  -7220,   4447),
+      simde_mm256_set_epi32( -379391049,  -626170174,   593030884,   -71518077,
+                             -164161960,  -188200230,  -286917975,    77758952) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_madd_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maddubs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -71,   84,  -31,  -72, -114,  114,   52,   71,
+                             86,  -58,   24,  -10, -119,  119,  -36, -110,
+                            119,   80,   12,  -24,  -56,  -74,  -31,  -27,
+                             31,  -44,   78,   94,  -46,  102,   25,  -92),
+      simde_mm256_set_epi8(  50,  100,  -44,   70,   31,  -44,   84, -102,
+                            -86,  -67,  -45,  125,  104,  -99,  111,  -15,
+                            -44,  -59,   76,   13,  -13,  -91,  113, -127,
+                             29, -122,  -14,  -19,  101,   65,   65,   98),
+      simde_mm256_set_epi16( 17650,   2980,   -614,  -2874, -20662,  29670,   2467,  22230,
+                             -9956,   3928, -19162,  -3658, -24965,  -2878,  27840,  17697) },
+    { simde_mm256_set_epi8( -44,   21,  -19,  -94,  -40,  115,  -30, -110,
+                             72, -106,   46,  104, -124,   47,   14,    7,
+                            -20, -127,   78,  119,  112,  -53,  -79,   75,
+                            -26,  -36,  -49,  108,  -23,  -34,   11,  -90),
+      simde_mm256_set_epi8( -83, -116,  -43,  -95,  -26,   80,  -17, -107,
+                             59,   24,  -83,   -8,   49,   51,   66, -102,
+                             97,   32,   63,   25,  -51,  -42,  126,  -38,
+                            -60,  -15,   79,  -44,    4,   30,   -9,   43),
+      simde_mm256_set_epi16(-20032, -25581,   3584, -19464,   7848,  -4650,   8865,    210,
+                             27020,   7889, -14238,  19452, -17100,  11601,   7592,   7039) },
+    { simde_mm256_set_epi8(-116,  -92,  -86,  121,   -3,   85, -118,  124,
+                            -92, -110,  -58, -111,   61, -103,   42,   90,
+                            -62,  -40, -111,    1, -124,   48,   82,  -64,
+                             89,  -61,   91, INT8_MIN,   22, -123,  -84,   69),
+      simde_mm256_set_epi8( -93,   31,  -33,  -44,    2,    4,  -74,   22,
+                           -108,   24,  -51,   99,  127,   -3,   96,   47,
+                             62,   12,   80,   21,  -39,  -38,   -5,  100,
+                             56,   37,   95,  105,   18,   57,   45,   43),
+      simde_mm256_set_epi16( -7936, -10934,    846,  -7484, -14208,   4257,   7288,   8262,
+                             14620,  11621,  -6972,  18790,  12199,  22085,   7977,  10707) },
+    { simde_mm256_set_epi8(  39,    7,  -77,   66,  105,  -83,  -41,  -10,
+                            -36,  113,  105,  -89,   87,   18,  -28,   58,
+                            -65,  102,    1,  125,   70,  -51,   51,   19,
+                             35,    0,   19,   76,   73,   76,   45,  -81),
+      simde_mm256_set_epi8( -95,  126,   18,  -87,  -68,  -32,   89,   44,
+                            -67,    4, -113,   20, -100,   30,  -43,   -6,
+                            -51,  -47,  -99,  -58,   85,   87,   20,  -95,
+                            -86,   29,  -54,   11,  -39,   51,   90,   28),
+      simde_mm256_set_epi16( -2823,  -2520, -12676,  29959, -14288,  -8525,  -8160, -10152,
+                            -14535,  -7349,  23785,   -785,  -3010,   -190,   1029,   8950) },
+    { simde_mm256_set_epi8( 115,   90,  110,  110,   12,   86,  -79, -100,
+                            -54,   82,  -67,  -99,  123,    5,  -20,   -5,
+                             71,  126,   -7,  -64,   79,  -25,   45,  118,
+                            -72,   12,   31,   40,  100,  -57,  -75, INT8_MIN),
+      simde_mm256_set_epi8(  35,  114,   47,  -29,   14,  113,  101,  -55,
+                           -126,  -25,   35,  125,  124,  -32,   68,   72,
+                             31,  -26,   55, -115,  118,   31,   60,  -93,
+                             54,   58,  -83,  -96,  -55,  -48, -122,  -66),
+      simde_mm256_set_epi16( 14285,   1980,   9886,   9297, -27502,  26240,  15092,  32767,
+                             -1075,  -8385,  16483,  -8274,  10632,  -6413, -15052, -30530) },
+    { simde_mm256_set_epi8( -89,   89,  -47,  -28,  -87,  116,   87,  -79,
+                            120,   -4,   91,   -3,   -1,  -35,  112,  -66,
+                            115,   25,  -66,   20,  -66,  -76,  -98,  -63,
+                            -12,  -14,   77,  107,   -4,  -99, -108, INT8_MIN),
+      simde_mm256_set_epi8( 114,  -85,   23,  -33,   -3, -107,  -84,   92,
+                             16, -127,  -92,  120,  -96,  -17,  -11,   24,
+                            -67,  -18,   -6, -126,  -36,  -38,   -1,   32,
+                             20, -110,  113, -113,  124,  118,   45,  114),
+      simde_mm256_set_epi16( 11473,  -2717, -12919,   8976, -30084,  21988, -28237,   3328,
+                             -8155,  -3660, -13680,   6018, -21740,  -3390,  32767,  21252) },
+    { simde_mm256_set_epi8(  77,  -85,   64,  -26,   47,   93,   24,  -96,
+                             -1,  -79,   40,  -35,   85,  104,   65,  -49,
+                            -43,  -44,   -6,   63,  -50,   -7,  -12,   51,
+                             79,  101,  125,   24, -122,   62, -101,  -14),
+      simde_mm256_set_epi8( -24,   95,    0,   26,   -7,  -31, -113,   30,
+                            -82,   29,  -41,   84,    1,  -77,   82,  124,
+                             82,  -45,  111,  -68,  -93,   22,   11,  118,
+                           -102,   80,   88, -108,  119,   -6,   26,   67),
+      simde_mm256_set_epi16( 14397,   5980,  -3212,   2088, -15777,  16924,  -7923,  30998,
+                              7926,  23466, -13680,   8702,     22,   8408,  15574,  20244) },
+    { simde_mm256_set_epi8(  61,   77, -124,  -51,   50,   94,  -35,   12,
+                             67,   66,   51,   67,  -78, -127,   58,   14,
+                             11,  -13,  -87,  118,   64,  -23,  112,  106,
+                           -111,  117, -110,  -44, -107,  106,   -8,    1),
+      simde_mm256_set_epi8( 120,  -78,   50,  -76,   26, -101,   76,    1,
+                           -118, -123,   -7,  -72,  -27,  107, -107,  119,
+                            -30,  -41,  -36,   -1,   24,    4,   16,  -89,
+                           -100,   24,   19,  -57,  -20,   64,    4,   96),
+      simde_mm256_set_epi16(  1314,  -8980,  -8194,  16808, -16024,  -5181,   8997,  -4540,
+                            -10293,  -6202,   2468,  -7642, -11692,  -9310,   3804,   1088) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_maddubs_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i32gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const int32_t table[32] = {
+     2007895027,  -829299312,   383820229,  -515582232,
+     1317384406,  1962916072,  2046340519, -1712832678,
+      -63406598,   967928689,   247950592,  1356176394,
+     -855446148, -1277964867,  -629184109,  1847487725,
+    -1300596602,  1278660827, -1884064769, -1683937587,
+     -494381358,   290034711, -1901383782,   873776252,
+     1291338222, -1305600347,  1676228649,  -678548945,
+    -1241580122,   658182310,  1168993537, -1025662741
+  };
+
+  const struct {
+    simde__m256i src;
+    simde__m256i vindex;
+    simde__m256i mask;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(  783323677,   554025647,  1138092804, -1648138563,
+                             -452388300,  -572848830,  1887642155,   227337939),
+      simde_mm256_set_epi32(         10,          18,          18,           4,
+                                     18,          11,          21,          16),
+      simde_mm256_set_epi32( -439359318,  1435721670,  1521532721,  -121972101,
+                             1989131740,  -967445797,  2080253830,  -867807685),
+      simde_mm256_set_epi32(  247950592,   554025647,  1138092804,  1317384406,
+                             -452388300,  1356176394,  1887642155, -1300596602) },
+    { simde_mm256_set_epi32( -736581564,  -311555366,   363374645,  1167638647,
+                              741556898,   316528639,  1939413572,  1491631752),
+      simde_mm256_set_epi32(         13,          18,          10,           8,
+                                      9,           2,           0,          13),
+      simde_mm256_set_epi32( 1331227198, -1951987254,   217864564, -1778814252,
+                            -1986508981,   929091525,  -103769656, -1247408213),
+      simde_mm256_set_epi32( -736581564, -1884064769,   363374645,   -63406598,
+                              967928689,   316528639,  2007895027, -1277964867) },
+    { simde_mm256_set_epi32( -652617539,  1158437909,  -432379677,  -582357892,
+                             1661320097, -1650509709, -1362431287, -1395238224),
+      simde_mm256_set_epi32(         20,          18,          23,          19,
+                                     30,          26,          20,          10),
+      simde_mm256_set_epi32(-1225562306,  1717793531,  2137309229, -1824421163,
+                            -2117305740,   242424982,  -209071665,   721878518),
+      simde_mm256_set_epi32( -494381358,  1158437909,  -432379677, -1683937587,
+                             1168993537, -1650509709,  -494381358, -1395238224) },
+    { simde_mm256_set_epi32(-1645249976,   398445524, -1521069445,  -597796744,
+                              856770835, -1672899763, -2100084153, -1257535562),
+      simde_mm256_set_epi32(          1,          25,           3,          27,
+                                     22,          24,          14,          28),
+      simde_mm256_set_epi32( -794051146,  -958397929,  -481647934, -1017485611,
+                            -1806416197, -1814126092,   321331549,  1674546826),
+      simde_mm256_set_epi32( -829299312, -1305600347,  -515582232,  -678548945,
+                            -1901383782,  1291338222, -2100084153, -1257535562) },
+    { simde_mm256_set_epi32(-1193803843,  1499574585,  2104475435, -2143482985,
+                             1735550009,  -101181083,    61782913, -1168538229),
+      simde_mm256_set_epi32(         19,          23,           0,           9,
+                                     16,           8,           5,          21),
+      simde_mm256_set_epi32( 1552497135, -1302042135,   721486439,  -967611146,
+                               56010840, -1133969910,   -83029800,  -490619508),
+      simde_mm256_set_epi32(-1193803843,   873776252,  2104475435,   967928689,
+                             1735550009,   -63406598,  1962916072,   290034711) },
+    { simde_mm256_set_epi32(-2081645151, -1458475046,   -56032025,  1814308602,
+                              827100006,  1180488054, -1532300361,  1536242448),
+      simde_mm256_set_epi32(         10,          12,          19,          15,
+                                     11,           4,          19,          28),
+      simde_mm256_set_epi32(-1642812539,  1974005781,  1459078699,  1345846682,
+                             -201294898,  -564057315,  1056751269,  -344320884),
+      simde_mm256_set_epi32(  247950592, -1458475046,   -56032025,  1814308602,
+                             1356176394,  1317384406, -1532300361, -1241580122) },
+    { simde_mm256_set_epi32(-1499182287,  -181296958,   410558169,  2094235715,
+                              913768502,   841373643,  -406503526,  1828649916),
+      simde_mm256_set_epi32(         24,          26,           2,          11,
+                                     27,          18,          13,          24),
+      simde_mm256_set_epi32(  553956824, -1581329539, -1731751034,  -888634635,
+                             -424096290,   869951099,  2035127801,   218715768),
+      simde_mm256_set_epi32(-1499182287,  1676228649,   383820229,  1356176394,
+                             -678548945,   841373643,  -406503526,  1828649916) },
+    { simde_mm256_set_epi32( 1950467229,   -50366792,  -736667030,  1629995381,
+                             2001940899,  -251644800,     2482041,  -992939090),
+      simde_mm256_set_epi32(         19,           3,          22,           0,
+                                      0,          19,          16,          10),
+      simde_mm256_set_epi32( -612846389,  -843762379,  1678507619, -1455000809,
+                             1743530475,   694244246,  1326778518, -1086411614),
+      simde_mm256_set_epi32(-1683937587,  -515582232,  -736667030,  2007895027,
+                             2001940899,  -251644800,     2482041,   247950592) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_i32gather_epi32(test_vec[i].src, table, test_vec[i].vindex, test_vec[i].mask, 4);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i32gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const simde_float64 table[16] = {
+       -54.49,   -386.44,    367.84,    327.07,
+        98.24,   -239.79,    977.30,    919.23,
+      -849.57,   -714.00,    763.85,    -80.17,
+       -28.12,    527.91,    656.34,    686.32
+  };
+
+  const struct {
+    simde__m256d src;
+    simde__m128i vindex;
+    simde__m256d mask;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   -16.68,    -49.42,   -419.70,    210.51),
+      simde_mm_set_epi32(          8,           9,           7,          12),
+      simde_mm256_set_pd(   326.12,    325.07,   -369.84,   -810.29),
+      simde_mm256_set_pd(   -16.68,    -49.42,    919.23,    -28.12) },
+    { simde_mm256_set_pd(   -25.96,     -1.40,   -618.55,   -849.94),
+      simde_mm_set_epi32(          1,           4,          11,           6),
+      simde_mm256_set_pd(   660.10,    816.77,   -957.60,   -553.53),
+      simde_mm256_set_pd(   -25.96,     -1.40,    -80.17,    977.30) },
+    { simde_mm256_set_pd(   869.21,   -487.23,   -595.50,   -676.79),
+      simde_mm_set_epi32(          6,           0,          12,          11),
+      simde_mm256_set_pd(  -654.34,    725.15,    919.14,   -680.44),
+      simde_mm256_set_pd(   977.30,   -487.23,   -595.50,    -80.17) },
+    { simde_mm256_set_pd(   393.18,   -868.88,   -870.05,   -914.33),
+      simde_mm_set_epi32(          8,          13,           2,          12),
+      simde_mm256_set_pd(  -905.10,   -765.86,    607.30,    460.12),
+      simde_mm256_set_pd(  -849.57,    527.91,   -870.05,   -914.33) },
+    { simde_mm256_set_pd(  -211.91,   -536.64,    445.36,   -798.63),
+      simde_mm_set_epi32(          0,           1,          11,          13),
+      simde_mm256_set_pd(   468.12,   -729.36,    412.28,    744.39),
+      simde_mm256_set_pd(  -211.91,   -386.44,    445.36,   -798.63) },
+    { simde_mm256_set_pd(  -671.25,   -773.24,    658.37,    749.59),
+      simde_mm_set_epi32(          4,          11,          11,           4),
+      simde_mm256_set_pd(   925.05,     54.06,    653.13,    675.26),
+      simde_mm256_set_pd(  -671.25,   -773.24,    658.37,    749.59) },
+    { simde_mm256_set_pd(   938.40,   -242.11,    860.87,   -892.07),
+      simde_mm_set_epi32(         10,           3,           9,           8),
+      simde_mm256_set_pd(   563.11,     38.64,   -964.56,   -683.95),
+      simde_mm256_set_pd(   938.40,   -242.11,   -714.00,   -849.57) },
+    { simde_mm256_set_pd(   188.47,   -828.38,    337.85,      9.78),
+      simde_mm_set_epi32(          8,           9,          15,          12),
+      simde_mm256_set_pd(    72.96,    920.27,    459.86,   -983.44),
+      simde_mm256_set_pd(   188.47,   -828.38,    337.85,    -28.12) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_mask_i32gather_pd(test_vec[i].src, table, test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i64gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const int64_t table[16] = {
+    INT64_C(  798934894463300133), INT64_C(-5299379537437197592),
+    INT64_C( 6281390634257325176), INT64_C(-4867678867779223805),
+    INT64_C( 7815624718604612566), INT64_C(-2145627117487466001),
+    INT64_C(    6250836183243760), INT64_C( -402852186061212586),
+    INT64_C(-4663047988760992869), INT64_C( 4422378450011731937),
+    INT64_C(-3729034870492016635), INT64_C( 8757114595669194705),
+    INT64_C(-5084293368143914364), INT64_C(-3413471557952636130),
+    INT64_C(-5373704756121388211), INT64_C( 1261559091691141428)
+  };
+
+  const struct {
+    simde__m256i src;
+    simde__m256i vindex;
+    simde__m256i mask;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-4753010830821558085), INT64_C(-6876502433744829982),
+                             INT64_C(-1033018251047718954), INT64_C( -874302726094829317)),
+      simde_mm256_set_epi64x(INT64_C(                  11), INT64_C(                  15),
+                             INT64_C(                   3), INT64_C(                  10)),
+      simde_mm256_set_epi64x(INT64_C( 5826319677859631604), INT64_C( 3296374464682193789),
+                             INT64_C(-2090057335118092511), INT64_C(-6007479479618454875)),
+      simde_mm256_set_epi64x(INT64_C(-4753010830821558085), INT64_C(-6876502433744829982),
+                             INT64_C(-4867678867779223805), INT64_C(-3729034870492016635)) },
+    { simde_mm256_set_epi64x(INT64_C(-3615428071606685222), INT64_C(-1822779713095081603),
+                             INT64_C( 1438295692671414983), INT64_C( 2364423555725593121)),
+      simde_mm256_set_epi64x(INT64_C(                  10), INT64_C(                  15),
+                             INT64_C(                   0), INT64_C(                  15)),
+      simde_mm256_set_epi64x(INT64_C(-3276502438092555194), INT64_C(-3677651146139134800),
+                             INT64_C( 2947207459774896587), INT64_C(-8155612196047886688)),
+      simde_mm256_set_epi64x(INT64_C(-3729034870492016635), INT64_C( 1261559091691141428),
+                             INT64_C( 1438295692671414983), INT64_C( 1261559091691141428)) },
+    { simde_mm256_set_epi64x(INT64_C( 6429003975960229249), INT64_C(-2352513734707730279),
+                             INT64_C( 6378923601291689677), INT64_C(-1873912341368951955)),
+      simde_mm256_set_epi64x(INT64_C(                   8), INT64_C(                  13),
+                             INT64_C(                   0), INT64_C(                  15)),
+      simde_mm256_set_epi64x(INT64_C( 5172540418091928723), INT64_C( 5061293610672754540),
+                             INT64_C(-6928434280584381882), INT64_C(-7608093622670408914)),
+      simde_mm256_set_epi64x(INT64_C( 6429003975960229249), INT64_C(-2352513734707730279),
+                             INT64_C(  798934894463300133), INT64_C( 1261559091691141428)) },
+    { simde_mm256_set_epi64x(INT64_C( 9220932225557361572), INT64_C(-6380132685502673833),
+                             INT64_C( 4896262508591603097), INT64_C( 3506448460106546595)),
+      simde_mm256_set_epi64x(INT64_C(                   3), INT64_C(                  13),
+                             INT64_C(                  15), INT64_C(                  11)),
+      simde_mm256_set_epi64x(INT64_C( 5999300176130641723), INT64_C( 1895153059153123929),
+                             INT64_C(-8129549063678581186), INT64_C(-7139666490808186935)),
+      simde_mm256_set_epi64x(INT64_C( 9220932225557361572), INT64_C(-6380132685502673833),
+                             INT64_C( 1261559091691141428), INT64_C( 8757114595669194705)) },
+    { simde_mm256_set_epi64x(INT64_C(-4729280190012473838), INT64_C(-8063077597351306956),
+                             INT64_C(-4273631496201392397), INT64_C( 2300810189573562825)),
+      simde_mm256_set_epi64x(INT64_C(                   5), INT64_C(                   8),
+                             INT64_C(                  14), INT64_C(                   0)),
+      simde_mm256_set_epi64x(INT64_C( 6560161392379352394), INT64_C(-2087362416307545154),
+                             INT64_C(-4602906160375900439), INT64_C( 4610702207583211319)),
+      simde_mm256_set_epi64x(INT64_C(-4729280190012473838), INT64_C(-4663047988760992869),
+                             INT64_C(-5373704756121388211), INT64_C( 2300810189573562825)) },
+    { simde_mm256_set_epi64x(INT64_C(-1308796083481853427), INT64_C( 6029032887993913365),
+                             INT64_C(-2777996362366313244), INT64_C(-6571136841105154530)),
+      simde_mm256_set_epi64x(INT64_C(                  14), INT64_C(                  13),
+                             INT64_C(                  15), INT64_C(                   3)),
+      simde_mm256_set_epi64x(INT64_C(-3502113149438067384), INT64_C( 3064048400159466890),
+                             INT64_C(-4783587207310713246), INT64_C( 5514039082184280717)),
+      simde_mm256_set_epi64x(INT64_C(-5373704756121388211), INT64_C( 6029032887993913365),
+                             INT64_C( 1261559091691141428), INT64_C(-6571136841105154530)) },
+    { simde_mm256_set_epi64x(INT64_C(-8231014834270227276), INT64_C( 8141858991163948841),
+                             INT64_C( -520308618775358296), INT64_C( 6332912106680377148)),
+      simde_mm256_set_epi64x(INT64_C(                  10), INT64_C(                  10),
+                             INT64_C(                  10), INT64_C(                  10)),
+      simde_mm256_set_epi64x(INT64_C(-2534740024105803480), INT64_C( 8497504459339007078),
+                             INT64_C( 5261528809791922030), INT64_C(-3583849261556016727)),
+      simde_mm256_set_epi64x(INT64_C(-3729034870492016635), INT64_C( 8141858991163948841),
+                             INT64_C( -520308618775358296), INT64_C(-3729034870492016635)) },
+    { simde_mm256_set_epi64x(INT64_C(-6516966429473242801), INT64_C(  771071141492232527),
+                             INT64_C(-3492025864933170743), INT64_C(-3294663373754965524)),
+      simde_mm256_set_epi64x(INT64_C(                   2), INT64_C(                   1),
+                             INT64_C(                  10), INT64_C(                   6)),
+      simde_mm256_set_epi64x(INT64_C( 6480548154427496305), INT64_C(-8111383580411421651),
+                             INT64_C(-4116337271921152801), INT64_C(-7340302282511664757)),
+      simde_mm256_set_epi64x(INT64_C(-6516966429473242801), INT64_C(-5299379537437197592),
+                             INT64_C(-3729034870492016635), INT64_C(    6250836183243760)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_i64gather_epi64(test_vec[i].src, table, test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i64gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const simde_float32 table[32] = {
+      -178.35f,   -139.46f,   -427.29f,   -454.73f,
+       821.09f,   -661.65f,    307.67f,    649.91f,
+       540.08f,    882.04f,    524.46f,    758.83f,
+        39.77f,    860.16f,   -246.33f,   -850.62f,
+      -411.00f,   -306.57f,    520.07f,   -164.54f,
+      -296.60f,    735.93f,   -816.68f,    354.88f,
+      -606.62f,   -403.48f,    602.73f,    644.97f,
+      -991.21f,   -867.86f,   -361.09f,     81.08f
+  };
+
+  const struct {
+    simde__m128 src;
+    simde__m256i vindex;
+    simde__m128 mask;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -275.15f,   -658.53f,    932.86f,   -606.54f),
+      simde_mm256_set_epi64x(INT64_C(                  11), INT64_C(                   3),
+                             INT64_C(                  23), INT64_C(                  15)),
+      simde_mm_set_ps(  -975.01f,   -490.03f,   -178.20f,    210.85f),
+      simde_mm_set_ps(   758.83f,   -454.73f,    354.88f,   -606.54f) },
+    { simde_mm_set_ps(  -617.01f,    924.78f,     84.31f,   -288.63f),
+      simde_mm256_set_epi64x(INT64_C(                   8), INT64_C(                  29),
+                             INT64_C(                  26), INT64_C(                  15)),
+      simde_mm_set_ps(  -260.09f,    562.28f,   -697.18f,   -474.56f),
+      simde_mm_set_ps(   540.08f,    924.78f,    602.73f,   -850.62f) },
+    { simde_mm_set_ps(  -476.25f,    110.90f,   -657.97f,    142.23f),
+      simde_mm256_set_epi64x(INT64_C(                  13), INT64_C(                  19),
+                             INT64_C(                  29), INT64_C(                  31)),
+      simde_mm_set_ps(  -762.53f,    899.73f,   -300.10f,    763.23f),
+      simde_mm_set_ps(   860.16f,    110.90f,   -867.86f,    142.23f) },
+    { simde_mm_set_ps(  -987.72f,    482.59f,    342.12f,   -677.60f),
+      simde_mm256_set_epi64x(INT64_C(                  23), INT64_C(                   6),
+                             INT64_C(                  25), INT64_C(                  22)),
+      simde_mm_set_ps(  -926.89f,   -132.29f,    448.74f,   -482.08f),
+      simde_mm_set_ps(   354.88f,    307.67f,    342.12f,   -816.68f) },
+    { simde_mm_set_ps(  -902.15f,   -800.39f,    799.11f,      9.41f),
+      simde_mm256_set_epi64x(INT64_C(                   5), INT64_C(                   8),
+                             INT64_C(                  28), INT64_C(                   2)),
+      simde_mm_set_ps(   -40.11f,    749.76f,   -237.90f,   -727.61f),
+      simde_mm_set_ps(  -661.65f,   -800.39f,   -991.21f,   -427.29f) },
+    { simde_mm_set_ps(   -90.95f,    353.02f,   -128.60f,     48.55f),
+      simde_mm256_set_epi64x(INT64_C(                  12), INT64_C(                  24),
+                             INT64_C(                  30), INT64_C(                   2)),
+      simde_mm_set_ps(  -703.91f,   -623.86f,   -390.88f,    482.23f),
+      simde_mm_set_ps(    39.77f,   -606.62f,   -361.09f,     48.55f) },
+    { simde_mm_set_ps(   966.91f,    410.74f,    208.42f,    282.37f),
+      simde_mm256_set_epi64x(INT64_C(                  13), INT64_C(                   7),
+                             INT64_C(                  14), INT64_C(                  26)),
+      simde_mm_set_ps(  -386.40f,    383.56f,   -661.93f,   -865.49f),
+      simde_mm_set_ps(   860.16f,    410.74f,   -246.33f,    602.73f) },
+    { simde_mm_set_ps(   235.99f,    798.61f,    106.73f,   -821.93f),
+      simde_mm256_set_epi64x(INT64_C(                   2), INT64_C(                   7),
+                             INT64_C(                  24), INT64_C(                  18)),
+      simde_mm_set_ps(  -982.08f,   -693.91f,    665.94f,   -630.65f),
+      simde_mm_set_ps(  -427.29f,    649.91f,    106.73f,    520.07f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm256_mask_i64gather_ps(test_vec[i].src, table, test_vec[i].vindex, test_vec[i].mask, 4);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_max_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( -6517, -17251, -24049,  30066,  15807, -25904, -23494,   4065,
+                             13582,  26147, -32438,  20691,  27979,  28623,   2099, -14004),
+      simde_mm256_set_epi16(-25919,  12168,  -5443, -15213,  17201, -25904,  15267,  29957,
+                             13582,  10424, -32438,  20691,  27979,  -1041,  18500, -26448),
+      simde_mm256_set_epi16( -6517,  12168,  -5443,  30066,  17201, -25904,  15267,  29957,
+                             13582,  26147, -32438,  20691,  27979,  28623,  18500, -14004) },
+    { simde_mm256_set_epi16(-28550, -29545,   5309,  -7751, -13075, -32041, -21059, -24625,
+                            -11209, -12770,  14833,  26745,   -940,  16174, -11966,  28324),
+      simde_mm256_set_epi16(-28550,   1134,  -8325, -25270, -25475, -25044, -21059, -14157,
+                              2197, -29265,  14833, -25845,   3754,   5521,  13151,  28985),
+      simde_mm256_set_epi16(-28550,   1134,   5309,  -7751, -13075, -25044, -21059, -14157,
+                              2197, -12770,  14833,  26745,   3754,  16174,  13151,  28985) },
+    { simde_mm256_set_epi16( 30265, -24188, -20706,  25127,  16806,  14862,  12314,  25682,
+                             -4559,   9499,  23870, -21942,  30219,   5660,  -4585,    591),
+      simde_mm256_set_epi16( 30265, -24188,  15760,  -4154,  29344, -31361,  12314, -22474,
+                             -4559, -15168,  -3165, -21942,  30219,   5660,  -2530,  -1957),
+      simde_mm256_set_epi16( 30265, -24188,  15760,  25127,  29344,  14862,  12314,  25682,
+                             -4559,   9499,  23870, -21942,  30219,   5660,  -2530,    591) },
+    { simde_mm256_set_epi16( 16554, -13733,  24658,  12980,  10536, -14104,   6838, -27265,
+                            -10642,  31270,  -2532,  -3832,   7442,   9774,  28612, -20994),
+      simde_mm256_set_epi16( 25753,  23041,  -5097,  -6928,  21715, -27436, -13378, -27265,
+                            -14168,   7111,  -2532,  -3832, -14561,   9774,  28612, -15712),
+      simde_mm256_set_epi16( 25753,  23041,  24658,  12980,  21715, -14104,   6838, -27265,
+                            -10642,  31270,  -2532,  -3832,   7442,   9774,  28612, -15712) },
+    { simde_mm256_set_epi16(-15532,  12552, -32049,  13114,  16250, -18850,  30882,  20418,
+                            -32523,  18169,  28615,   8314,  30410, -28693,  -7257, -19495),
+      simde_mm256_set_epi16(-15532,  12552, -32722, -17020, -21691, -18850, -26439, -19034,
+                            -32523,  26478,  28615,  -1154,   1768, -28693,  -7257, -27405),
+      simde_mm256_set_epi16(-15532,  12552, -32049,  13114,  16250, -18850,  30882,  20418,
+                            -32523,  26478,  28615,   8314,  30410, -28693,  -7257, -19495) },
+    { simde_mm256_set_epi16(-27844,  -3822,  15541, -19112,  16650,  10902,   1050,   2891,
+                               -18,  30096, -28910, -21438, -25517,   1357,  -7325, -25654),
+      simde_mm256_set_epi16(-12246, -20457,  15541, -29209,  -6663, -22858,   4393,  27470,
+                             27513,  19639,  -8131,  15861, -25517, -24995, -20157, -25654),
+      simde_mm256_set_epi16(-12246,  -3822,  15541, -19112,  16650,  10902,   4393,  27470,
+                             27513,  30096,  -8131,  15861, -25517,   1357,  -7325, -25654) },
+    { simde_mm256_set_epi16( -1403, -17518,  18443,  13777, -17354,  -8905,  10766,  29426,
+                             27452, -26441,  -7978,  23178,  29508,  18910,  -5132,   3743),
+      simde_mm256_set_epi16( 16189, -22924,  10478, -25263, -17354,  26717, -18212,   4232,
+                             27452, -12357,  31936,  14700,  29581, -12177,    936,  -4741),
+      simde_mm256_set_epi16( 16189, -17518,  18443,  13777, -17354,  26717,  10766,  29426,
+                             27452, -12357,  31936,  23178,  29581,  18910,    936,   3743) },
+    { simde_mm256_set_epi16(-26212,  16778, -27061, -31402,  16422,   2010, -16895,  22738,
+                             14223,  22829,  28547, -11970,  -4150, -17227,  19656,  30868),
+      simde_mm256_set_epi16( 28996,  16778, -27824,  -5293, -12973,   5504,  30522,  -5431,
+                             20533,  14170,  20081,   4607,   4471,  16949,  19656, -11038),
+      simde_mm256_set_epi16( 28996,  16778, -27061,  -5293,  16422,   5504,  30522,  22738,
+                             20533,  22829,  28547,   4607,   4471,  16949,  19656,  30868) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_max_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_max_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-2103570501,   191547694,  -793182369,  1510127879,
+                            -1475420884,  -445481201, -1564189196, -1498513265),
+      simde_mm256_set_epi32(-2103570501,   172786822,  -335581267,  1850681928,
+                             2099068605, -1947979757, -1564189196,    81643127),
+      simde_mm256_set_epi32(-2103570501,   191547694,  -335581267,  1850681928,
+                             2099068605,  -445481201, -1564189196,    81643127) },
+    { simde_mm256_set_epi32(-1384754120,  1142132468,   -60345011,  1272217245,
+                             1711466124,  2065094218,   719003817,  1414415720),
+      simde_mm256_set_epi32(   64874930,  1142132468,   -60345011,  -323890711,
+                            -1485572413,  -909656709,   719003817,  -421569813),
+      simde_mm256_set_epi32(   64874930,  1142132468,   -60345011,  1272217245,
+                             1711466124,  2065094218,   719003817,  1414415720) },
+    { simde_mm256_set_epi32( 1611617010, -1976565652,  1577412645, -1695428767,
+                             -846888326,   330213079,  1050853046,  1343799199),
+      simde_mm256_set_epi32( 1611617010,  -260046081,  1560658036, -1999453857,
+                             -846888326,  1381961226, -1408118422,  -782768363),
+      simde_mm256_set_epi32( 1611617010,  -260046081,  1577412645, -1695428767,
+                             -846888326,  1381961226,  1050853046,  1343799199) },
+    { simde_mm256_set_epi32(  135174930, -1037053286,  1492397534, -1396303279,
+                             1481827374,  2094905593,    30700057,   237346786),
+      simde_mm256_set_epi32(  305931712, -1037053286,  1492397534,  -147638177,
+                             -705724412, -1838134908,    30700057, -2033909790),
+      simde_mm256_set_epi32(  305931712, -1037053286,  1492397534,  -147638177,
+                             1481827374,  2094905593,    30700057,   237346786) },
+    { simde_mm256_set_epi32( -175384206,   766435389,  1982886297, -1272061639,
+                              -58774292,  1794808219, -1113041869, -1652620323),
+      simde_mm256_set_epi32( -175384206,   504377353,  1982886297, -1738231325,
+                             -144671188,  -336263338, -1503517802,    98440781),
+      simde_mm256_set_epi32( -175384206,   766435389,  1982886297, -1272061639,
+                              -58774292,  1794808219, -1113041869,    98440781) },
+    { simde_mm256_set_epi32(-1625847326,   164580162,   691099276, -1384722344,
+                              306203696,  -800515170,   -17179359, -1695597728),
+      simde_mm256_set_epi32(-1625847326,   156863955,   691099276,  -118136719,
+                              306203696,  1382948355,   -17179359,  -250170936),
+      simde_mm256_set_epi32(-1625847326,   164580162,   691099276,  -118136719,
+                              306203696,  1382948355,   -17179359,  -250170936) },
+    { simde_mm256_set_epi32( 1593134005,  1901098966,  1559582543,  2001924561,
+                              572096638, -1802564392, -1779371509,    34332106),
+      simde_mm256_set_epi32( 1321195524,  1901098966,  1439402071,  2001924561,
+                             1768997454,  1417326844,    98508525,  -106246758),
+      simde_mm256_set_epi32( 1593134005,  1901098966,  1559582543,  2001924561,
+                             1768997454,  1417326844,    98508525,    34332106) },
+    { simde_mm256_set_epi32( 1686813644,   678823253,  -725924594, -1344915906,
+                             -553168723,   -78432121,   618393360, -1250206952),
+      simde_mm256_set_epi32( 1686813644, -1978703884,  1932117865, -1969301390,
+                            -1504448118,   -78432121,   618393360,   379630611),
+      simde_mm256_set_epi32( 1686813644,   678823253,  1932117865, -1344915906,
+                             -553168723,   -78432121,   618393360,   379630611) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_max_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_max_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( 115,   47,   58,  -86,   42,   31,  -45,  -76,
+                            123,  120,  121,  -33,  -95,   50,  -35,   74,
+                           -110,   10,  -47,  101,   32,  -36,  112,   31,
+                             15,   33,  -90,   24,  126,  -20,  -17,  -76),
+      simde_mm256_set_epi8(  15,  -93,   52,  -86,  125,   31,  -45,  -88,
+                             47,   -9,  -23,  -58,  102,  -78,  -35,  118,
+                             50,   82,  -47,  -86,  -25,  -36,  123,   31,
+                             15,   33,  117,   24,  126,  -11,  -17,  -98),
+      simde_mm256_set_epi8( 115,   47,   58,  -86,  125,   31,  -45,  -76,
+                            123,  120,  121,  -33,  102,   50,  -35,  118,
+                             50,   82,  -47,  101,   32,  -36,  123,   31,
+                             15,   33,  117,   24,  126,  -11,  -17,  -76) },
+    { simde_mm256_set_epi8(  30,   76,   70,  105,  -43, -106,  -90,  -97,
+                             18,  -66,  112, -122,  118,  -90,   65,   32,
+                             65,  -10,   18,  105,   46,   20,  104,  -60,
+                            -49,   27, -108,   20,   86, -127,  -74,  -27),
+      simde_mm256_set_epi8(   0,   76,  -32,   23,  -43, -106, -118,  -97,
+                            107, -119,   70, -122,  -16,  -90,  -30,   56,
+                             65, -113,   18,  127, -125,   20, -113,  -60,
+                            -49,   39,  -49,   20,  -81, -127,  -74,   88),
+      simde_mm256_set_epi8(  30,   76,   70,  105,  -43, -106,  -90,  -97,
+                            107,  -66,  112, -122,  118,  -90,   65,   56,
+                             65,  -10,   18,  127,   46,   20,  104,  -60,
+                            -49,   39,  -49,   20,   86, -127,  -74,   88) },
+    { simde_mm256_set_epi8(  -2,  -36,  -45, -121,  -40,   58,   26,   85,
+                           -120,   88,   -6,  -16, -118,   18,  -49,   31,
+                           -109,   12,   72,   -5,  113,  -82,  -14,   34,
+                            -80,   48,   98,  -42,  -23, -112,   19,  107),
+      simde_mm256_set_epi8( -70,  -25,  -45,   89,   75,   58,   26,   51,
+                            -68,   88,   -6,  -48,   87,    4,   82,   31,
+                             46,    8,   46,   83,  112,  -60,  -14,   82,
+                              1,   65,  -48,  -42,  -56,   39,  -30,  107),
+      simde_mm256_set_epi8(  -2,  -25,  -45,   89,   75,   58,   26,   85,
+                            -68,   88,   -6,  -16,   87,   18,   82,   31,
+                             46,   12,   72,   83,  113,  -60,  -14,   82,
+                              1,   65,   98,  -42,  -23,   39,   19,  107) },
+    { simde_mm256_set_epi8(  -4,   40,   76,  -33,  -52,  -82,   77,   47,
+                            -95,  -26,   52,  -52,   40,  -17,  -42,    5,
+                            -17, -113,  -22,  -51, INT8_MIN, -101,  -20,  120,
+                             62,   10, -123,  -76,  -52,  109,  -40, -110),
+      simde_mm256_set_epi8(  76,   40,   76,  -33,   15,   19,  -99,  110,
+                             10, -112,   52,   31,   40,  -60, -106, -109,
+                            -17, -113,  -25,   42, INT8_MIN, -117,  -77,  120,
+                            122,    1,  -75,  -76,   79,  109,  -40, -123),
+      simde_mm256_set_epi8(  76,   40,   76,  -33,   15,   19,   77,  110,
+                             10,  -26,   52,   31,   40,  -17,  -42,    5,
+                            -17, -113,  -22,   42, INT8_MIN, -101,  -20,  120,
+                            122,   10,  -75,  -76,   79,  109,  -40, -110) },
+    { simde_mm256_set_epi8( -45,   78,  -74,   29,   59,  -26,   88,  -94,
+                            -52,  -39,  -55,  -39,   42,  -11,  -36,   62,
+                             30,   67, -123,   34,  -34,  -80,  -44,   23,
+                             71,  -15,  -14,  115,   27,  -35,  -34,   50),
+      simde_mm256_set_epi8( -75,   78,  -26,  115,   97,  -84,   88,  100,
+                           -112,  -42,  -55,   17,   80,   83,  -36,   20,
+                             63,   67,   60,   10, -124,  115,  123,  -23,
+                             71,   51,  -14,   34,   39,  -35,  121,  -66),
+      simde_mm256_set_epi8( -45,   78,  -26,  115,   97,  -26,   88,  100,
+                            -52,  -39,  -55,   17,   80,   83,  -36,   62,
+                             63,   67,   60,   34,  -34,  115,  123,   23,
+                             71,   51,  -14,  115,   39,  -35,  121,   50) },
+    { simde_mm256_set_epi8( -50,   83,  -79,   13,  -84,   74,  124, -102,
+                           -123,  122,   -4,  -30,  -18,   23, -121,  -76,
+                             88,   96,  -87,  -22,  -73,  -97,  -12,  -12,
+                             10,  -81,  -76,  -79,  -61,   90,   -7,   21),
+      simde_mm256_set_epi8(  84,   83,  -26,   13,  -84,   74,  124,   97,
+                            124,   93,   -4,   58,  -15,   23,   44,  109,
+                             88,   96,   46,  -75,  -73,  -27,  -12,  -91,
+                            -14,   56,  -76, -111,  -42,   90,   29,   21),
+      simde_mm256_set_epi8(  84,   83,  -26,   13,  -84,   74,  124,   97,
+                            124,  122,   -4,   58,  -15,   23,   44,  109,
+                             88,   96,   46,  -22,  -73,  -27,  -12,  -12,
+                             10,   56,  -76,  -79,  -42,   90,   29,   21) },
+    { simde_mm256_set_epi8(  -8,   57,   46, -121,  -32,  -32,   37,  -29,
+                             62,  123, -110,   13,  -63,  -50,   -1,   70,
+                            -39,  -24,   34,   20,  -48,  109,   29,  -36,
+                           -109,   31,  -97,   56,  107,   16,  -31,   50),
+      simde_mm256_set_epi8(  -8,  120,  -57,   76,   57,   50,  -73,   -8,
+                             62,  -76, -110,  -18,  -63,  -81, -106,   32,
+                            -18,   88,  -69,   20, -122,  -20,   29,   64,
+                           -109,   31,   99,   14,   33,  -47,  -31,   72),
+      simde_mm256_set_epi8(  -8,  120,   46,   76,   57,   50,   37,   -8,
+                             62,  123, -110,   13,  -63,  -50,   -1,   70,
+                            -18,   88,   34,   20,  -48,  109,   29,   64,
+                           -109,   31,   99,   56,  107,   16,  -31,   72) },
+    { simde_mm256_set_epi8(  56,   65, -113,  -52,   37,   -8,  106, -125,
+                             30,  -91,  -40,   39,   17,  -66,  -24,   -6,
+                            -17,    7,  -82, -116,  -87, -126,  -52,  -88,
+                            -27,   59, -106,  -11,   13,  -29,   82,  -34),
+      simde_mm256_set_epi8(-103, -118, -113,  -52,  -54,   84,  126,  116,
+                            -22,  -91,    3,   39,  -65,  -47,  -90,   -6,
+                            -13,    7,   60, -116,  126,   -5,  -52,  108,
+                            -17,   59,   -2, -105,  -83,  -29,   82,   94),
+      simde_mm256_set_epi8(  56,   65, -113,  -52,   37,   84,  126,  116,
+                             30,  -91,    3,   39,   17,  -47,  -24,   -6,
+                            -13,    7,   60, -116,  126,   -5,  -52,  108,
+                            -17,   59,   -2,  -11,   13,  -29,   82,   94) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_max_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_max_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( 16671,  26666, -19037,  -7208,   4061, -30951, -23044, -27058,
+                              2820,  -7857,  26590,   5078,  18093, -26879,  -8549,  14623),
+      simde_mm256_set_epi16( 16671,  26666, -31221,  -8611,  29551,  13525,  26482, -27058,
+                              3164,  -7857,  24433,   3244,  18093, -25982, -22701, -30155),
+      simde_mm256_set_epi16( 16671,  26666, -19037,  -7208,  29551, -30951, -23044, -27058,
+                              3164,  -7857,  26590,   5078,  18093, -25982,  -8549, -30155) },
+    { simde_mm256_set_epi16(  4549,   7002,  -5838,  29304, -18616,  25017,   8041,  -3690,
+                             26078, -19429,  17995, -15104, -10749,  25878, -21760, -13180),
+      simde_mm256_set_epi16(-27240,  13776, -22166,  29304, -21277,  25017,  22026,  17041,
+                            -23730,  -1897,  17995, -15104,  -2124,  25878, -23882, -13180),
+      simde_mm256_set_epi16(-27240,  13776,  -5838,  29304, -18616,  25017,  22026,  -3690,
+                            -23730,  -1897,  17995, -15104,  -2124,  25878, -21760, -13180) },
+    { simde_mm256_set_epi16(-15817, -31091, -18982,  24554,  19664,  16476, -18976,  -6129,
+                             -2208,  24884,   9913, -19292, -32567, -17835, -22218,  -2271),
+      simde_mm256_set_epi16(-31351,   8862, -18982, -19277,  18078,  -5002, -18927, -11697,
+                             -2208,  24884,   9913, -19292, -32567,   1150,  -9457,  -2271),
+      simde_mm256_set_epi16(-15817, -31091, -18982, -19277,  19664,  -5002, -18927,  -6129,
+                             -2208,  24884,   9913, -19292, -32567, -17835,  -9457,  -2271) },
+    { simde_mm256_set_epi16(-18379,  -5663, -29061,   4312,   3862,   2018, -17451,   1802,
+                            -15771,  -1151,   5212, -22365,  23746,  13645,  24553,  -1509),
+      simde_mm256_set_epi16(-18379,  -5663, -22181,  25117, -16196,   2018, -17451, -25566,
+                              2524, -11189, -18042, -28052,  -6554,  13645,  11133,  -1509),
+      simde_mm256_set_epi16(-18379,  -5663, -22181,  25117, -16196,   2018, -17451, -25566,
+                            -15771,  -1151, -18042, -22365,  -6554,  13645,  24553,  -1509) },
+    { simde_mm256_set_epi16(-12669, -23443,  -9400,   2141, -13454,   4880,  28875, -10042,
+                              6225,  20559,  17017,  -2438, -15329, -18717, -26302, -27330),
+      simde_mm256_set_epi16(-12669, -22299,  -9400,   2141, -18781,   4880,  28875,  22336,
+                              6225,  20559,  17017,  -2438, -30821, -11893,  -9690, -27330),
+      simde_mm256_set_epi16(-12669, -22299,  -9400,   2141, -13454,   4880,  28875, -10042,
+                              6225,  20559,  17017,  -2438, -15329, -11893,  -9690, -27330) },
+    { simde_mm256_set_epi16(  1006,  28149,  20477,  14068,   4106,  -1708,  29400,  26475,
+                              1346, -14125,   1463, -20431,   7848,  11603,   -999,  24930),
+      simde_mm256_set_epi16(  9480,  28149,  20477,  14068,   4106,  -1708,  26384,  22077,
+                              1346, -14125,  16331, -24425,  -6949,  31575,   -999,  24930),
+      simde_mm256_set_epi16(  9480,  28149,  20477,  14068,   4106,  -1708,  29400,  26475,
+                              1346, -14125,  16331, -20431,  -6949,  31575,   -999,  24930) },
+    { simde_mm256_set_epi16( 17706,  10969,  -6218, -18791, -26806,  13723,   8160, -30591,
+                             22683, -27524, -18765, -20955,  31169,  21782,  18545, -23376),
+      simde_mm256_set_epi16( 21089,  24589,  22146,  16045,   1661,  32483, -13511, -30591,
+                             22683,   7703, -12493, -18201,   9937,  21782,   2532,  -5569),
+      simde_mm256_set_epi16( 21089,  24589,  -6218, -18791, -26806,  32483, -13511, -30591,
+                             22683, -27524, -12493, -18201,  31169,  21782,  18545,  -5569) },
+    { simde_mm256_set_epi16(-14115,  30022,  11469,  -7464,  32360, -19798,   6522, -27775,
+                             18299,  -4105, -10772,  24290, -24265,  15351,   7030,  30279),
+      simde_mm256_set_epi16(-22744,  30022,  11469,  29213,  32360,   8527,   8148,  25342,
+                              6939, -28934, -10772,   4930, -24265,  -8965, -18120,  16676),
+      simde_mm256_set_epi16(-14115,  30022,  11469,  -7464,  32360, -19798,   8148, -27775,
+                             18299,  -4105, -10772,  24290, -24265,  -8965, -18120,  30279) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_max_epu16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_max_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1439674198,  1927220149, -1502536494,   512279364,
+                              295949027,  1285470729, -1734563676,  1525356576),
+      simde_mm256_set_epi32(-1439674198,  1927220149,  1524979517,  -839661130,
+                            -1654858253,   789700871,   634626456,  -534897032),
+      simde_mm256_set_epi32(-1439674198,  1927220149, -1502536494,  -839661130,
+                            -1654858253,  1285470729, -1734563676,  -534897032) },
+    { simde_mm256_set_epi32( 1672053415,  1263705702,  1281703107,  1665304278,
+                            -1095344619,  1345758986,  -435453903,   970943129),
+      simde_mm256_set_epi32(  883670007,  2052780480,  1281703107, -1958777802,
+                            -1095344619,  1345758986,  -643586910, -1058446886),
+      simde_mm256_set_epi32( 1672053415,  2052780480,  1281703107, -1958777802,
+                            -1095344619,  1345758986,  -435453903, -1058446886) },
+    { simde_mm256_set_epi32(  299692771,   450002340,  -680297755,   515762403,
+                              241333900,   756974826,   368659591,   706275368),
+      simde_mm256_set_epi32(-1641928784,   375654750,  2045424077, -1385964695,
+                            -2002684574,  2045506061,  -956809856,   -76988299),
+      simde_mm256_set_epi32(-1641928784,   450002340,  -680297755, -1385964695,
+                            -2002684574,  2045506061,  -956809856,   -76988299) },
+    { simde_mm256_set_epi32( 1503769623,  1918131042,  -691801018, -1539051512,
+                             1506179801,   119429473,  1494972108,   103402618),
+      simde_mm256_set_epi32(-1764752550,  2061811815, -1385658630, -1539051512,
+                            -1823545421,   902856073,  1494972108,  1251587234),
+      simde_mm256_set_epi32(-1764752550,  2061811815,  -691801018, -1539051512,
+                            -1823545421,   902856073,  1494972108,  1251587234) },
+    { simde_mm256_set_epi32(-1682870088,   319681402, -1561300972,   871252552,
+                             -355273689,   316296866,  -193473541,   -42975024),
+      simde_mm256_set_epi32(-1682870088,   319681402,  -549248326,   254369037,
+                               79677066, -1376285500,   470519168,   -42975024),
+      simde_mm256_set_epi32(-1682870088,   319681402,  -549248326,   871252552,
+                             -355273689, -1376285500,  -193473541,   -42975024) },
+    { simde_mm256_set_epi32(-1791844561,  1025184058, -1319813925,   212940823,
+                            -1958997000, -1248012172,  1655743239,  2080116856),
+      simde_mm256_set_epi32(-1791844561,  1025184058, -1319813925,  -962452705,
+                             1117561591, -1248012172,  1055436532,   852491067),
+      simde_mm256_set_epi32(-1791844561,  1025184058, -1319813925,  -962452705,
+                            -1958997000, -1248012172,  1655743239,  2080116856) },
+    { simde_mm256_set_epi32(  277246356,  1076201738,   538477246,  2003272274,
+                             1422669808,  1633820704,   203289592,  -997919583),
+      simde_mm256_set_epi32(  277246356,  1608680542, -1368680942,  -241179303,
+                             1422669808,  -981837968,  1081678305,  -997919583),
+      simde_mm256_set_epi32(  277246356,  1608680542, -1368680942,  -241179303,
+                             1422669808,  -981837968,  1081678305,  -997919583) },
+    { simde_mm256_set_epi32( 1058095744, -2122483765,  2130355064, -1866107068,
+                            -1078800260, -1764156955, -1771279466, -1114487405),
+      simde_mm256_set_epi32( -278205436,  1896042602, -1387602450, -1866107068,
+                              926293514, -1764156955, -1520504931, -1114487405),
+      simde_mm256_set_epi32( -278205436, -2122483765, -1387602450, -1866107068,
+                            -1078800260, -1764156955, -1520504931, -1114487405) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_max_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_max_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(  31, -108,  -16,   93, -120,   81,  -75,  -48,
+                            -11,  -94,  118,  -36,  -96,  107,  -13, -118,
+                            107,   13,  -82, -123,   97,  -17, -107,   63,
+                           -116,  -53, -109, -106,  125, -123, -114,  -12),
+      simde_mm256_set_epi8( -77,   24,  -15,   93,   23,   45,  -46,  -17,
+                            -81,  -94,   78, -114,  -96,   82,  -95, -118,
+                            107,   13,  -44, -100,  -47,   42, -107,   63,
+                             48,  -52,  -11, -100,  -47,  114, -114,  -12),
+      simde_mm256_set_epi8( -77, -108,  -15,   93, -120,   81,  -46,  -17,
+                            -11,  -94,  118,  -36,  -96,  107,  -13, -118,
+                            107,   13,  -44, -100,  -47,  -17, -107,   63,
+                           -116,  -52,  -11, -100,  -47, -123, -114,  -12) },
+    { simde_mm256_set_epi8( 113, -117,  -13,   19,  -67,   38,   17,  -78,
+                            -51,   80,  -37,   68,   16,  107,  110,  -91,
+                            107,  -69,   26,   55, -125,   79,   11,  117,
+                            -85,  -53,  -72,  -71,  -48, -104,  107,  -98),
+      simde_mm256_set_epi8( 113,  -76,  -13,  -88,  -67,  -88,   26,  -78,
+                            114,   42,  107,   68,   16,  -30,  110,   52,
+                            -72,   15,  -57,   55,  115,  -14,   11,  -19,
+                             43,    7,  -38,   42,  -48, -104,   34,   75),
+      simde_mm256_set_epi8( 113,  -76,  -13,  -88,  -67,  -88,   26,  -78,
+                            -51,   80,  -37,   68,   16,  -30,  110,  -91,
+                            -72,  -69,  -57,   55, -125,  -14,   11,  -19,
+                            -85,  -53,  -38,  -71,  -48, -104,  107,  -98) },
+    { simde_mm256_set_epi8( -78,  -84,  -96,   -6,   79, -110,   98,  -28,
+                            126,   35,   76,   18,   -2,   42,  -91,   82,
+                              8,   10,   18,  -43,   34,    9,  -88, -126,
+                             12,   73,  -63,  -69,   44,  -44,   60,   -9),
+      simde_mm256_set_epi8(  -8,  -39,   94,   -6,   79,   26,   16,  -28,
+                            -93,   35,   76,   32,   55,   10,  -91, -112,
+                              8,   51,  -11,  -43,   34,    9,  -88,   18,
+                             37,  -86,  -63,  -69,  119,  -44,  -42,   -9),
+      simde_mm256_set_epi8(  -8,  -39,  -96,   -6,   79, -110,   98,  -28,
+                            -93,   35,   76,   32,   -2,   42,  -91, -112,
+                              8,   51,  -11,  -43,   34,    9,  -88, -126,
+                             37,  -86,  -63,  -69,  119,  -44,  -42,   -9) },
+    { simde_mm256_set_epi8( -96, -108,  -57,  -76,   -4,   27,   -9,  120,
+                             93, -109, -106, -127,  -89,   50,  -60,   43,
+                           -104,   54, -109,  -20,  115,  -37,  -20, -108,
+                            -35,  112, -108,  -65,   98,  -63,    2,   -4),
+      simde_mm256_set_epi8(  16, -108,  -57,  -31,   -4,   27,   89,  -81,
+                             51,    5, -106,  -56,  -46,   50,  -58,   48,
+                             67,  111,   23, -127,   14, -108,   37, -116,
+                             60,   47, -108,  -65,   99,  -63,   44,  -67),
+      simde_mm256_set_epi8( -96, -108,  -57,  -31,   -4,   27,   -9,  -81,
+                             93, -109, -106,  -56,  -46,   50,  -58,   48,
+                           -104,  111, -109,  -20,  115,  -37,  -20, -108,
+                            -35,  112, -108,  -65,   99,  -63,   44,   -4) },
+    { simde_mm256_set_epi8(  95,  -49,   62,  118,  100,    5,   30,  -74,
+                            121,  -27, -103,   57,  -42, -121,  -53,   92,
+                           -120,   38,  -68,   25,  -53,  -69,   27,  -52,
+                            -63,   21,   57,  -90,   75,  -25,  -61, -125),
+      simde_mm256_set_epi8( -75,  120,  113,  -14,  -49,    5,   -8,  -74,
+                            -79,  -27, -103,  -96,   66, -115,   33,   35,
+                            -20,  -80,  -68,   25,   63,  -69, -103,  -52,
+                            -63,   68,   57,   39,   75,  -67,  -27, -125),
+      simde_mm256_set_epi8( -75,  -49,  113,  -14,  -49,    5,   -8,  -74,
+                            -79,  -27, -103,  -96,  -42, -115,  -53,   92,
+                            -20,  -80,  -68,   25,  -53,  -69, -103,  -52,
+                            -63,   68,   57,  -90,   75,  -25,  -27, -125) },
+    { simde_mm256_set_epi8(  71, -113,  127,   81,  105,  -36,   67,   64,
+                            -62,   84,  -17,  125,  115,   22,   84,   33,
+                            112,   64,  -35,  -56,  109,   78,   90,    0,
+                             45,    9,   47,   58,  124,  127,  121, -126),
+      simde_mm256_set_epi8(-114,   94,  127,   26,  105,  -36,   25,   64,
+                            -15,   66,  -95, -102,  115,  -68, -113,   33,
+                           -122,   64,  -37,  -56,   49,   78,    1,   98,
+                            123,    9,   -4,  -76,  124,  127,  121, -126),
+      simde_mm256_set_epi8(-114, -113,  127,   81,  105,  -36,   67,   64,
+                            -15,   84,  -17, -102,  115,  -68, -113,   33,
+                           -122,   64,  -35,  -56,  109,   78,   90,   98,
+                            123,    9,   -4,  -76,  124,  127,  121, -126) },
+    { simde_mm256_set_epi8(  -7,   89,  -64, -121,  -21,  -43, -103,   17,
+                             99, -125,   39,  108,  -98, -106,    4,  -31,
+                            -51,   95, -126,  -37,   60,   96,   84, -111,
+                             -3,  -36,  -45,   90,   74,   92, -102,   -8),
+      simde_mm256_set_epi8( -23,   89,  -64,  -49,  -21,  -43,  -98,   17,
+                             99, -125,  -43,   66,   93, -106, -126,  -31,
+                            -51,   38, -126,  -37,   60,   96,   84,   76,
+                            -50,   92,   19,   90,   62,  -97,   29,   -8),
+      simde_mm256_set_epi8(  -7,   89,  -64,  -49,  -21,  -43,  -98,   17,
+                             99, -125,  -43,  108,  -98, -106, -126,  -31,
+                            -51,   95, -126,  -37,   60,   96,   84, -111,
+                             -3,  -36,  -45,   90,   74,  -97, -102,   -8) },
+    { simde_mm256_set_epi8( -15,   25,    5,  -97,   18,   30,  119,   -5,
+                            -45,  -78,   14,  -92,   61,  -11,  -69,  -15,
+                             37,  -82, -123,   34,   77,    8,  -49,  -72,
+                            125,   59, -110,   14,  -77,    5,  -65,   30),
+      simde_mm256_set_epi8( -15,   71,  125,  -38,  -41,   43,   67, -118,
+                            -49,   90,   14,   49,   -6,  -37,  -69,  -51,
+                             37,  -61,   64,   34,  107,    8,  119,  -68,
+                            125,   65,  113,   14,  -78,    5,   30,   67),
+      simde_mm256_set_epi8( -15,   71,  125,  -38,  -41,   43,  119,   -5,
+                            -45,  -78,   14,  -92,   -6,  -11,  -69,  -15,
+                             37,  -61, -123,   34,  107,    8,  -49,  -68,
+                            125,   65, -110,   14,  -77,    5,  -65,   67) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_max_epu8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( 16128,  32116,  20342, -29956, -26735,  -5628,  19637,  23580,
+                             16773,  10088,  16756,  10175, -29796, -32610,  30111, -16673),
+      simde_mm256_set_epi16( 16128,  32116,  25119, -29956, -14814,  19015,  11036, -23602,
+                            -18463,  17456,  16756,  12518,  23704, -32610,  30111,  23240),
+      simde_mm256_set_epi16( 16128,  32116,  20342, -29956, -26735,  -5628,  11036, -23602,
+                            -18463,  10088,  16756,  10175, -29796, -32610,  30111, -16673) },
+    { simde_mm256_set_epi16( -9640, -10111,   8658,  -5434,    739, -14376, -26823, -17346,
+                             23085,  25238,  -8777,  -1272,  28254,  18142,  17124, -31676),
+      simde_mm256_set_epi16(-11327, -10300,   8658,  -5434, -22520,  28909, -28196,  26788,
+                             23085,  25238,  23497,  -1272,  30267,  18142,  17124, -31676),
+      simde_mm256_set_epi16(-11327, -10300,   8658,  -5434, -22520, -14376, -28196, -17346,
+                             23085,  25238,  -8777,  -1272,  28254,  18142,  17124, -31676) },
+    { simde_mm256_set_epi16(-27397, -18286,    433,  32527,  29324, -14275, -18554,  -4767,
+                             -5828,  22197, -13777,  -4325,  -6596,  -9648,  30843, -12029),
+      simde_mm256_set_epi16(  7417,  17517,  32747,   -495,  29324, -20904, -18554,   5788,
+                            -23164,  10979,  -8568,  25826,  13490,  -1880,   9670,   1659),
+      simde_mm256_set_epi16(-27397, -18286,    433,   -495,  29324, -20904, -18554,  -4767,
+                            -23164,  10979, -13777,  -4325,  -6596,  -9648,   9670, -12029) },
+    { simde_mm256_set_epi16(  4210, -11531, -20470, -32443,  29549,  26386,  11684, -16608,
+                            -24751,  21765,  21107,  28096,  10178,  20939,  21333,  27032),
+      simde_mm256_set_epi16(-24349, -11531, -21082, -32443,  29549,  26975,  11684, -16608,
+                            -30263,  23963,  21107,  19434, -11753,  20939, -30670,  27032),
+      simde_mm256_set_epi16(-24349, -11531, -21082, -32443,  29549,  26386,  11684, -16608,
+                            -30263,  21765,  21107,  19434, -11753,  20939, -30670,  27032) },
+    { simde_mm256_set_epi16(-23156,  -5329, -22850, -23499, -22736,  20568,  27411,  -9425,
+                            -21519, -25277,  -9861,  29443,   3969, -22247,  32198, -11204),
+      simde_mm256_set_epi16(-23156,  24509, -22850,  -8986,  17534,  20568,  27411,  -9425,
+                            -21519,  22214,  -9861,  -9715, -28350,  18750,  -7079, -11204),
+      simde_mm256_set_epi16(-23156,  -5329, -22850, -23499, -22736,  20568,  27411,  -9425,
+                            -21519, -25277,  -9861,  -9715, -28350, -22247,  -7079, -11204) },
+    { simde_mm256_set_epi16(-23963, -29866,  -3659, -11094,  31908, -11171,  15585,  25929,
+                             21868, -30623,  25503,  -6369,  29048,  12494, -18239,  -8403),
+      simde_mm256_set_epi16(  6617,  -2968,   3218, -14204,    246, -11171,  31921,  14517,
+                             16408,  11052,  25503,  14629, -28756,  12494,   5300,  -8403),
+      simde_mm256_set_epi16(-23963, -29866,  -3659, -14204,    246, -11171,  15585,  14517,
+                             16408, -30623,  25503,  -6369, -28756,  12494, -18239,  -8403) },
+    { simde_mm256_set_epi16(-29648, -27584,  -8314, -28387, -28972,   2265,  -7174, -22963,
+                             22120,  24679, -19958,  22093,   2334, -20582,   7608,  18376),
+      simde_mm256_set_epi16(  -268,   6120, -13003,  15286,  27472,  -7034,   9232,  23571,
+                            -25875,  32020,   9808,   2676,   2334,    328, -12819,  18376),
+      simde_mm256_set_epi16(-29648, -27584, -13003, -28387, -28972,  -7034,  -7174, -22963,
+                            -25875,  24679, -19958,   2676,   2334, -20582, -12819,  18376) },
+    { simde_mm256_set_epi16( -3738, -13292,  29475,  11829,  15230,  11205,   8365,   1077,
+                             -1138,  -4005, -25148,  -1823, -25121,  29755, -18477,    746),
+      simde_mm256_set_epi16( -3738,  16611,  29475,  -4629, -21670,  11205,   4237,  -6469,
+                            -25393,  -4005, -25148,  -5585, -15812,   9125, -18477, -14095),
+      simde_mm256_set_epi16( -3738, -13292,  29475,  -4629, -21670,  11205,   4237,  -6469,
+                            -25393,  -4005, -25148,  -5585, -25121,   9125, -18477, -14095) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( 1051696635,  1018872222, -1947064178,  1528933665,
+                            -1312369854,   785212210, -2026417515,  1998389839),
+      simde_mm256_set_epi32( 1902472346,  1018872222, -1571299110,  -875095779,
+                            -1312369854,  -157503108,   232566553,  1998389839),
+      simde_mm256_set_epi32( 1051696635,  1018872222, -1947064178,  -875095779,
+                            -1312369854,  -157503108, -2026417515,  1998389839) },
+    { simde_mm256_set_epi32( -407142441,   431799960,  1819847403, -2106343144,
+                            -2039152382,  -239116563,  -998007473, -2072865155),
+      simde_mm256_set_epi32( 1550225223,   228406616,   990165846, -2074205058,
+                            -2039152382,  -239116563,   759179728, -2072865155),
+      simde_mm256_set_epi32( -407142441,   228406616,   990165846, -2106343144,
+                            -2039152382,  -239116563,  -998007473, -2072865155) },
+    { simde_mm256_set_epi32( 1220942858,  1181352043,  -655040792,    -1195541,
+                             1497672040, -2053209873,  1226432979,  1266181330),
+      simde_mm256_set_epi32( 1190882732,  1181352043, -1975095756,    -1195541,
+                             1497672040, -1529799326, -1618048040, -1206170415),
+      simde_mm256_set_epi32( 1190882732,  1181352043, -1975095756,    -1195541,
+                             1497672040, -2053209873, -1618048040, -1206170415) },
+    { simde_mm256_set_epi32(-2009935923,  -931717417, -1764296568,  -606314220,
+                             -600105056,   144953697,  1254565448,  -358685238),
+      simde_mm256_set_epi32( -837854926,  -846937907,    41564178,  -606314220,
+                             1247749085,  1379155436,   936657117,   466273059),
+      simde_mm256_set_epi32(-2009935923,  -931717417, -1764296568,  -606314220,
+                             -600105056,   144953697,   936657117,  -358685238) },
+    { simde_mm256_set_epi32( -302406346,  1615997287,  2079391517, -1066094957,
+                            -2133469966, -2025105118,   168785206,  -266892733),
+      simde_mm256_set_epi32(-1671735695,  1615997287,  2079391517, -1098476494,
+                            -2133469966,   113889956, -1657221209,  -945736688),
+      simde_mm256_set_epi32(-1671735695,  1615997287,  2079391517, -1098476494,
+                            -2133469966, -2025105118, -1657221209,  -945736688) },
+    { simde_mm256_set_epi32( 1053855304,  -963118162,   292224122,  -564088598,
+                              504085496,  -361383289, -1451679474,   164121055),
+      simde_mm256_set_epi32( 1053855304,  -963118162,   292224122, -1601028676,
+                            -1363172821,  -361383289,  -679516413, -1868166393),
+      simde_mm256_set_epi32( 1053855304,  -963118162,   292224122, -1601028676,
+                            -1363172821,  -361383289, -1451679474, -1868166393) },
+    { simde_mm256_set_epi32(  515067610,  -957302919,   379078333,  1788606772,
+                            -1581151625,  -240949282,  -297265695,  -925551728),
+      simde_mm256_set_epi32(  332578734,  -957302919,  -561291716,  1788606772,
+                             1378849270, -2139668619, -1815782572,  1166674348),
+      simde_mm256_set_epi32(  332578734,  -957302919,  -561291716,  1788606772,
+                            -1581151625, -2139668619, -1815782572,  -925551728) },
+    { simde_mm256_set_epi32(  -11569568,  -491562913, -1048657220,   769439309,
+                             1110942412, -1528154334, -1687264660, -1565118131),
+      simde_mm256_set_epi32(  -11569568,  -491562913,  -236572226,   769439309,
+                             -421791566, -1528154334, -1267057078,   -79212163),
+      simde_mm256_set_epi32(  -11569568,  -491562913, -1048657220,   769439309,
+                             -421791566, -1528154334, -1687264660, -1565118131) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(  35,   40,   95,   28,   91,  -51,  -12,  -75,
+                             27,  -12,  -46, -109,  116,   77,   72,  -36,
+                              2,  -79,   30,  112,  -49,  110,    6,  -13,
+                            114,  102,  -64,   90,  -41,  113,   75,  -56),
+      simde_mm256_set_epi8(  54,   40,   95,   28,  -12,   65, -107,  -86,
+                              8,  -42,   41, -109, -101,  -35,  -13,   97,
+                           -105,  -79,   30,   27,  -49,  -85,  120,  -13,
+                            -74,  102,  -62,   40,   24,  113,   75,  -56),
+      simde_mm256_set_epi8(  35,   40,   95,   28,  -12,  -51, -107,  -86,
+                              8,  -42,  -46, -109, -101,  -35,  -13,  -36,
+                           -105,  -79,   30,   27,  -49,  -85,    6,  -13,
+                            -74,  102,  -64,   40,  -41,  113,   75,  -56) },
+    { simde_mm256_set_epi8(  13,  -47,  -33,   11, -102,   59,   48,  -37,
+                            -48,  -91,  -16,  127,  -33,   43,    6,  -66,
+                             55,  103,   29,  -42,  -95,  124, -100, -104,
+                           -109,  -32,  111,  -89,  -99,  -48,   88,  -74),
+      simde_mm256_set_epi8(  92,   17,  -15,   50,   16,   31,   60, -102,
+                             43,    9,   11,   96,  -11,   43,  -27,   94,
+                             91,  103, -127,  100,   36,  -90,  -69,  107,
+                             94,  -32, -105,   48,   52,  -48,  107,  -17),
+      simde_mm256_set_epi8(  13,  -47,  -33,   11, -102,   31,   48, -102,
+                            -48,  -91,  -16,   96,  -33,   43,  -27,  -66,
+                             55,  103, -127,  -42,  -95,  -90, -100, -104,
+                           -109,  -32, -105,  -89,  -99,  -48,   88,  -74) },
+    { simde_mm256_set_epi8( -50,   67,   80,  -90,   63,  -25, -125,   76,
+                             76,   96,   -9,  -27,  -25,   -5,  -12,  -45,
+                            -75,   22,   81,    4,   46,  118,  -79,   77,
+                            -68,   51,  -48, -124,  112,  -14,  -98, -106),
+      simde_mm256_set_epi8(  58,   67,   80,  -90,   18,  -10,  -50,  -19,
+                             76, -100,  -96,  -71,  122,   -5,   31,  -45,
+                            -75,   22,   81,    4, -111,  -11,  -21,   82,
+                             27,   98,  -48,   51,   41,  -91, -115, -106),
+      simde_mm256_set_epi8( -50,   67,   80,  -90,   18,  -25, -125,  -19,
+                             76, -100,  -96,  -71,  -25,   -5,  -12,  -45,
+                            -75,   22,   81,    4, -111,  -11,  -79,   77,
+                            -68,   51,  -48, -124,   41,  -91, -115, -106) },
+    { simde_mm256_set_epi8(-124,   27,  110,   16,  -83,  -50,   57,    0,
+                             46,  101,  104,  -81,   79,  -33,  -10,  114,
+                            -16,  -29,   -4,   20,  -33,   14,   54,   -8,
+                             29,   45,  -40,    4,   84, -107,   53,   26),
+      simde_mm256_set_epi8(  -7,   -1,  110,   67,  108,  -50,   57,    0,
+                            103,   25,  104,  -81,   65,   29,  102,   18,
+                            -16, -118,   -4,   74,  -13, -107,  -75,    2,
+                            100,   45,   49,  122,   64,   -4,  103,  122),
+      simde_mm256_set_epi8(-124,   -1,  110,   16,  -83,  -50,   57,    0,
+                             46,   25,  104,  -81,   65,  -33,  -10,   18,
+                            -16, -118,   -4,   20,  -33, -107,  -75,   -8,
+                             29,   45,  -40,    4,   64, -107,   53,   26) },
+    { simde_mm256_set_epi8(-107,  101,   62, -104,  -32,  -24,   58, -111,
+                            -59, -101,   35,  108,    2,   -2, -105,   89,
+                            -88,  127,   38,  -26,  -31,  -10,  -41,  -80,
+                             65, -108, -123,    1, -102,   -3,  -44,  -39),
+      simde_mm256_set_epi8(  43,  -58, -104,   48,  -54,  -24,   58,  -75,
+                            -59, -101,  -99,   92,   84,  -36,  110,   89,
+                            -88,  127,   38, -100,  -31,  -17,  -41,  -80,
+                             75,   21, -123,   -6,   83,   -3,  -44,  -39),
+      simde_mm256_set_epi8(-107,  -58, -104, -104,  -54,  -24,   58, -111,
+                            -59, -101,  -99,   92,    2,  -36, -105,   89,
+                            -88,  127,   38, -100,  -31,  -17,  -41,  -80,
+                             65, -108, -123,   -6, -102,   -3,  -44,  -39) },
+    { simde_mm256_set_epi8(-126,  -85,  -68,  -50, -106,  -76,  -73,  -82,
+                            -93,  -20,   34,   38,   29,   72,   65,   13,
+                             -6,   18,   31,  -95,  -54,   89,  -32,  106,
+                            -12,   14, -100,   48,   85,   96,  -22,  -19),
+      simde_mm256_set_epi8(  25,  -90,  -68,   68,   22,  -76,    3, -117,
+                            -93,   11,   34,  108,   41,   72,   65,   30,
+                             83,  -76,   44,  -95,   -3,   89,  -32, -125,
+                            -12,   14,  104,   73,  -83,   23,  -77,  -19),
+      simde_mm256_set_epi8(-126,  -90,  -68,  -50, -106,  -76,  -73, -117,
+                            -93,  -20,   34,   38,   29,   72,   65,   13,
+                             -6,  -76,   31,  -95,  -54,   89,  -32, -125,
+                            -12,   14, -100,   48,  -83,   23,  -77,  -19) },
+    { simde_mm256_set_epi8( 104,  -36,  107,   81,   60,   36, -126, -112,
+                             12,   57,  -76,   72,   91,   99,  -68,  107,
+                           -116,    1,   -8,  -43,  -14,   -7,  115,   44,
+                             92,  109,   77,  -61,   87,  -25, -100,  -96),
+      simde_mm256_set_epi8(  27,  -36,   40,   81,  113,   36,  -12, -112,
+                             12,   54,  -87,   66,   91,   -6,   32,  107,
+                           -116,  -39,  -30,  -43,  -14,   -7,  102,   13,
+                             79,    5,  111,  -61,   87,  -12, -100,  -57),
+      simde_mm256_set_epi8(  27,  -36,   40,   81,   60,   36, -126, -112,
+                             12,   54,  -87,   66,   91,   -6,  -68,  107,
+                           -116,  -39,  -30,  -43,  -14,   -7,  102,   13,
+                             79,    5,   77,  -61,   87,  -25, -100,  -96) },
+    { simde_mm256_set_epi8(  38,   97,   77, -113, -104,   -6,  -80,  -12,
+                            102,  -26, -114,   12,  -40,   79,   46,   57,
+                            -49,   84,   97,  111,  -45,   -6,   18,  -10,
+                             17,    3,  -81,  -60,  117,  -94,  117,  114),
+      simde_mm256_set_epi8(  59, -102,   77, -113,   -1, -127,  -11,   18,
+                            103,  -26,   82,   12,   86, -113,   84, -100,
+                            118,   19,   97,  111, -106,  107,    5,   82,
+                            -49,   16,   18,  -88,  119,  -94,  117,  -44),
+      simde_mm256_set_epi8(  38, -102,   77, -113, -104, -127,  -80,  -12,
+                            102,  -26, -114,   12,  -40, -113,   46, -100,
+                            -49,   19,   97,  111, -106,   -6,    5,  -10,
+                            -49,    3,  -81,  -88,  117,  -94,  117,  -44) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( 30940,  29800, -29885,  22149,  22000, -23053,  29195, -15653,
+                            -27659,  31926, -30830,   8946, -23843,  23359,  -3862,  18735),
+      simde_mm256_set_epi16(-20292,  17381, -29885,  -2486,  22000,  18558,  29195, -15653,
+                             -6373,  -7377, -30830,   8946, -23843,  23359,  21559, -21297),
+      simde_mm256_set_epi16( 30940,  17381, -29885,  22149,  22000,  18558,  29195, -15653,
+                            -27659,  31926, -30830,   8946, -23843,  23359,  21559,  18735) },
+    { simde_mm256_set_epi16(-23934,   7855,  -5830,  28555,  -4267,  25607,  16097,  32313,
+                             -1038,   2909, -11787,  -1420, -22806,  19114, -13805, -19235),
+      simde_mm256_set_epi16(-14923,  -2525,  -5830,   6958,  18716,   7845,  20247,   5877,
+                             21066,  -9643, -11787, -11733, -22806,  17048, -17029, -19235),
+      simde_mm256_set_epi16(-23934,   7855,  -5830,   6958,  18716,   7845,  16097,   5877,
+                             21066,   2909, -11787, -11733, -22806,  17048, -17029, -19235) },
+    { simde_mm256_set_epi16(-10930,  -8508,   1822, -16266,   8241, -13178,  -2422,  28474,
+                              6998,   8599,  15318, -28512,  11347,  29183,  -8247, -20400),
+      simde_mm256_set_epi16( 29510,  -8508, -16618,  -9843, -10665, -13178,  -8049,    463,
+                            -16899, -20713,  14386, -24854,  17503, -19446,  -8247, -16662),
+      simde_mm256_set_epi16( 29510,  -8508,   1822, -16266,   8241, -13178,  -8049,    463,
+                              6998,   8599,  14386, -28512,  11347,  29183,  -8247, -20400) },
+    { simde_mm256_set_epi16( 28465,  24703,  27535,  -7087,  19364, -27454,  23186,  18910,
+                            -28315, -30676, -22122, -10453,  26636,  22565,  28549,  15279),
+      simde_mm256_set_epi16( 13093,  18549,  -5110, -25480,  14906,  25931,  25547, -24990,
+                            -28315,  -2854,  23156,  22277,  25853, -26784,  28549, -12174),
+      simde_mm256_set_epi16( 13093,  18549,  27535, -25480,  14906,  25931,  23186,  18910,
+                            -28315, -30676,  23156,  22277,  25853,  22565,  28549,  15279) },
+    { simde_mm256_set_epi16(-19896,  21671, -23366,  12635,  14487, -24560,  -2018, -26215,
+                            -12616,  27142,  15137, -20739,  -8162,  14804, -14186,   3936),
+      simde_mm256_set_epi16(-19896,  28473, -23366, -21647,  14487, -22270,  -4687,  19371,
+                            -25691,  27142,  -5525, -20739,  28908, -15732, -14186,  11653),
+      simde_mm256_set_epi16(-19896,  21671, -23366,  12635,  14487, -24560,  -4687,  19371,
+                            -25691,  27142,  15137, -20739,  28908,  14804, -14186,   3936) },
+    { simde_mm256_set_epi16( 24876,  -1316,  23427, -19494,  26065, -29372,  19286,   7453,
+                             10354, -19943,  20666, -24103,   2874,  20452,   4778, -12404),
+      simde_mm256_set_epi16( 24876,  21557, -28803,  31065,  24376, -29372,  -5359,    795,
+                             10354, -19943,  20666,  11722,  -1609, -24859,  11356,   6031),
+      simde_mm256_set_epi16( 24876,  21557,  23427,  31065,  24376, -29372,  19286,    795,
+                             10354, -19943,  20666,  11722,   2874,  20452,   4778,   6031) },
+    { simde_mm256_set_epi16( -5451, -25773, -23752,  12506,  -9596, -30523,  18041,   2409,
+                            -17931,   7088,  12120,  -9477,   6392, -10914, -14620, -27513),
+      simde_mm256_set_epi16( -5451,  -4990,  -8863,  32336,  -9596,   6500, -27246,   2409,
+                             -8259,  22943,  19445,  -3689, -25140,   5909, -11008,  23614),
+      simde_mm256_set_epi16( -5451, -25773, -23752,  12506,  -9596,   6500,  18041,   2409,
+                            -17931,   7088,  12120,  -9477,   6392,   5909, -14620,  23614) },
+    { simde_mm256_set_epi16(-20857,  19092, -25703,  -5911,  30697,  27103,  -2046,  27226,
+                            -18270,   6867, -16257, -24746,  18406,  12965,  -5001,  -3495),
+      simde_mm256_set_epi16( 14686,  -5287, -10281, -14407,  31260, -32246,  27261, -21456,
+                             19780, -17754, -16257,  21052,  20976,  12965,  -5001,  28423),
+      simde_mm256_set_epi16( 14686,  19092, -25703, -14407,  30697,  27103,  27261,  27226,
+                             19780,   6867, -16257,  21052,  18406,  12965,  -5001,  28423) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epu16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1934611944,  1781167229,  1772880087, -1785485531,
+                            -1660644169,  -789047562, -1656185526,  1701057284),
+      simde_mm256_set_epi32( 1849841210,  1781167229, -1757037459, -1785485531,
+                              349946383, -2132172751,  2122152436,  1889587164),
+      simde_mm256_set_epi32( 1849841210,  1781167229,  1772880087, -1785485531,
+                              349946383, -2132172751,  2122152436,  1701057284) },
+    { simde_mm256_set_epi32(-1744236606,  1216808442,    73100936,   661219528,
+                            -1700573546,   698212969,  1191399313,   873952737),
+      simde_mm256_set_epi32( 1247723494,  1439994458,    73100936,  2017816360,
+                             -207378430,  -454250473,   354032224,  1080649497),
+      simde_mm256_set_epi32( 1247723494,  1216808442,    73100936,   661219528,
+                            -1700573546,   698212969,   354032224,   873952737) },
+    { simde_mm256_set_epi32(-1093009163,  -971089821,  1062382470, -1329320041,
+                             1220362115, -1520497586,   986180697, -1407967541),
+      simde_mm256_set_epi32(-1093009163, -1509640687, -1919854719,  1024463621,
+                             1220362115, -1548867592, -1249524202,  -174751360),
+      simde_mm256_set_epi32(-1093009163, -1509640687,  1062382470,  1024463621,
+                             1220362115, -1548867592,   986180697, -1407967541) },
+    { simde_mm256_set_epi32(-1711077731,  -562452796,  1082916047,  1127316644,
+                             -407568587,    24729739,  -282577788, -1316411079),
+      simde_mm256_set_epi32(-1711077731,  -562452796, -1305930731,  1982649791,
+                            -1032567297,  1006522648,  -282577788, -1316411079),
+      simde_mm256_set_epi32(-1711077731,  -562452796,  1082916047,  1127316644,
+                            -1032567297,    24729739,  -282577788, -1316411079) },
+    { simde_mm256_set_epi32( -825949185,  -759229402,   795419471, -1096898154,
+                            -1219008987,  -223525348,  1969209482,  -260238494),
+      simde_mm256_set_epi32( -896050678,  -759229402,  1124734461, -1096898154,
+                            -1331215880,  -223525348, -1565552943, -1191404497),
+      simde_mm256_set_epi32( -896050678,  -759229402,   795419471, -1096898154,
+                            -1331215880,  -223525348,  1969209482, -1191404497) },
+    { simde_mm256_set_epi32( 1830355341,   369177645,  1787157338,    30647547,
+                            -1021408521,   861254456,  -146900206,  -895694056),
+      simde_mm256_set_epi32( 1830355341,   369177645,  1041098986,    30647547,
+                             -183196099, -1087161583,  1267532454,  1289863485),
+      simde_mm256_set_epi32( 1830355341,   369177645,  1041098986,    30647547,
+                            -1021408521,   861254456,  1267532454,  1289863485) },
+    { simde_mm256_set_epi32( -100925946,  1629348197, -1499710061, -1362819438,
+                             2043121140, -1456596499, -1494946063,   864928940),
+      simde_mm256_set_epi32(  660099904,  -796048977, -1499710061, -1829005170,
+                            -1868273430, -1456596499, -1494946063, -1049920610),
+      simde_mm256_set_epi32(  660099904,  1629348197, -1499710061, -1829005170,
+                             2043121140, -1456596499, -1494946063,   864928940) },
+    { simde_mm256_set_epi32( -313352539,  -185925372, -2122769660, -1173563770,
+                            -1731739890,  1584481416,   556605960,  -165823837),
+      simde_mm256_set_epi32( -313352539,   816708165,  -248515742,   944136605,
+                             1992488449,  1584481416,   -41110619,   134963996),
+      simde_mm256_set_epi32( -313352539,   816708165, -2122769660,   944136605,
+                             1992488449,  1584481416,   556605960,   134963996) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(-116, -127, -120,   57,  -42,  -33,   99,   23,
+                             48,  -15,   92,   28,  -75,  -45,   98,   57,
+                             98,   99,  117,   76,   20, -113,   -4,   46,
+                            -29,  100,  -93, -117,   48,  -81, -123,  -54),
+      simde_mm256_set_epi8(   3,  -13, -120,  -56,  -69,  -33,   99,   23,
+                             48,  -35,  114,   28,  -75,  -50,  -59,   57,
+                            -79,  125,  -26,   76,   20, -113,   -4,   47,
+                            -59,   -8,  -31, -117,  102,   67,   18,   34),
+      simde_mm256_set_epi8(   3, -127, -120,   57,  -69,  -33,   99,   23,
+                             48,  -35,   92,   28,  -75,  -50,   98,   57,
+                             98,   99,  117,   76,   20, -113,   -4,   46,
+                            -59,  100,  -93, -117,   48,   67,   18,   34) },
+    { simde_mm256_set_epi8(-101,  -26,   98,   96,  105,  106,   -8, -121,
+                            -69,   86,    0,   69,   -2,  110,    5, -115,
+                           -123,   13,   86,  -16,   -3,   39,  109,  -43,
+                             90,    1,  -90,   43,   78,   69,  -56,   50),
+      simde_mm256_set_epi8(-101,  -26,   -8,   84,  105,  106,  -64, -121,
+                           -112,   86,    0,   80,  -96,  101,   31,   74,
+                           -123,  103,   86,  -15,  127,  117,  116,   55,
+                             90,  -10,  -21,   43,   79,  113,  -11,  -73),
+      simde_mm256_set_epi8(-101,  -26,   98,   84,  105,  106,  -64, -121,
+                           -112,   86,    0,   69,  -96,  101,    5,   74,
+                           -123,   13,   86,  -16,  127,   39,  109,   55,
+                             90,    1,  -90,   43,   78,   69,  -56,   50) },
+    { simde_mm256_set_epi8(  26, -109, -122,   20,  108, -126,  114,  -77,
+                            118,  -97,  -14,  125,  -64,  126,   41,   53,
+                            -28,   56,   46,  112, -101, -100,   32,  -36,
+                            -73,  -65,  118,   20, -124,   41,   86,   77),
+      simde_mm256_set_epi8(  60,  -22, -110,  -44,   91,  103,  -53,  -59,
+                            -48,  -66,  -95,  125,  -60,  126, -120, -119,
+                             -9,  -69,  -94,  -48,   58, -100,  -63,  -36,
+                             63,  -87,   62,  -33, -124,   93,   17,   83),
+      simde_mm256_set_epi8(  26, -109, -122,   20,   91,  103,  114,  -77,
+                            118,  -97,  -95,  125,  -64,  126,   41,   53,
+                            -28,   56,   46,  112,   58, -100,   32,  -36,
+                             63,  -87,   62,   20, -124,   41,   17,   77) },
+    { simde_mm256_set_epi8( -23,   35,  119,  -21,  117,  -43,  -19,  -26,
+                             57,   55,  -85,   22, -100, INT8_MIN, -107,  -58,
+                            -54,   25,  -54,  -82,  118,  -50,   51,   46,
+                             26,  -99, -119,   95,   99, -117,   40,  -77),
+      simde_mm256_set_epi8(-103,   84,  -35,  -20,  -82,  -43,  120,   56,
+                             57,   -2,   77,  -26,   29,   -7, -107,   23,
+                             98, -101,  -54,  -82, -122,  -13,   51,  -40,
+                            -72,  -20,   92,   91,   99,  -43,   40,  124),
+      simde_mm256_set_epi8(-103,   35,  119,  -21,  117,  -43,  120,   56,
+                             57,   55,   77,   22,   29, INT8_MIN, -107,   23,
+                             98,   25,  -54,  -82,  118,  -50,   51,   46,
+                             26,  -99,   92,   91,   99, -117,   40,  124) },
+    { simde_mm256_set_epi8( -17,   -9,   12,  -25,   86,   44,  -68,   31,
+                            -53, -117,   62,  -90,   74,   99,  -82,   44,
+                            118,   37,   96,  -46,   93,   89,   83,  -51,
+                            -55,    4,   92,  -65,   82,  110, -122, -102),
+      simde_mm256_set_epi8( -17,   -9,   36,  -25,  -83,  -34,  -68,   31,
+                             77,   99,   62,  -90,  116,  -76, -123,  -19,
+                            118,  -49,   96,   54,  -51,   42,  -87,  109,
+                            -55,    4,  -24,  -65,  -10,  104, -122,  -91),
+      simde_mm256_set_epi8( -17,   -9,   12,  -25,   86,   44,  -68,   31,
+                             77,   99,   62,  -90,   74,   99, -123,   44,
+                            118,   37,   96,   54,   93,   42,   83,  109,
+                            -55,    4,   92,  -65,   82,  104, -122, -102) },
+    { simde_mm256_set_epi8( -67,   11,  -71,  -58,  -90,   12,  -55,   85,
+                            -36,   24,   -6,  -58,  -32,   20, -100,   71,
+                             -7,   -7,  -24,  -71,  103,   94,   75,  -48,
+                           INT8_MIN,   70,  126,   38,  115,  -23,   60,  -16),
+      simde_mm256_set_epi8(  80,  -16,   21,  127,  -90, -115,  108,  -33,
+                             87, -110,   95,  -92,  -32,   70,   29,  116,
+                           -113,  -10,  -24, -110,  103,   65,  -17,  -48,
+                           -105,  -72,  -57,  -86, -102,   43,   60,   36),
+      simde_mm256_set_epi8(  80,   11,   21,  127,  -90,   12,  108,   85,
+                             87,   24,   95,  -92,  -32,   20,   29,   71,
+                           -113,  -10,  -24, -110,  103,   65,   75,  -48,
+                           INT8_MIN,   70,  126,   38,  115,   43,   60,   36) },
+    { simde_mm256_set_epi8( -83,  -99,   99,    4,  -10,  -87,    3,  -65,
+                            125,  -69,  -92,  -51,   12,  106,   -9,   57,
+                             -6,  -60,  -74,  -40,  -81, -103,   56, -123,
+                             45,  -23, -107,  -40,  -32,   86,   37,   -1),
+      simde_mm256_set_epi8(   4,  -99,   96,    4,   89,  -90,  -41,   65,
+                            125,   31,  -39,  -51,   41,  -47,   -9,  -73,
+                             -6,    9,  -34,   15, -117, -103,   56, -123,
+                             45,  -32,  116,  -40,  -32,   86,   81,   19),
+      simde_mm256_set_epi8(   4,  -99,   96,    4,   89,  -90,    3,   65,
+                            125,   31,  -92,  -51,   12,  106,   -9,   57,
+                             -6,    9,  -74,   15, -117, -103,   56, -123,
+                             45,  -32,  116,  -40,  -32,   86,   37,   19) },
+    { simde_mm256_set_epi8( -75,  119,  124,  -14,   73,    0,    7,  -16,
+                             19,   64, -105,   56,   -8, -101,   38,    1,
+                            -88,  -25,   26,   82, -101,   26,  -81,  120,
+                            -56,  104,  -49,  -56,  -40,   62,  -34, -106),
+      simde_mm256_set_epi8( -75,  -97,  124,  121,  -98,    0,   74,  -15,
+                            -64,   12,  102,  -63,   -8,  -29,  121,  -23,
+                            -88,   83,   28,   99,   26,   26, -103,  120,
+                             23,  -26,  -21,   25,   81,   62,   48,   82),
+      simde_mm256_set_epi8( -75,  119,  124,  121,   73,    0,    7,  -16,
+                             19,   12,  102,   56,   -8, -101,   38,    1,
+                            -88,   83,   26,   82,   26,   26, -103,  120,
+                             23,  104,  -49,   25,   81,   62,   48,   82) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epu8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_movemask_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    int32_t r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( 113,   26, -101,  -84,   40,  -90,  -59,   20,
+                             99,  -77,   59,  -69,  -71,  -18,  -21,  -59,
+                            -19,   11,  -13,  -25,   52,  127,  110,   99,
+                             28,  -12,   48,  -72,  106,   24,  102,   13),
+      INT32_C(  912240720) },
+    { simde_mm256_set_epi8(  26,   29, -121,  -80, -125,   44,   77,   33,
+                            107,   -3,  -94,  109,   74,    1,   22,  103,
+                              1,  -18, -127,   34,   84,  -70,   59,  127,
+                             97,   84,  -60,  -74,  -12,  116,   51,  124),
+      INT32_C(  945841208) },
+    { simde_mm256_set_epi8( -14,   14,  -17,   82,  -30,  -88,   58,  -41,
+                            -72,  -71,  127,  119,  -93,   -8,  -71,   80,
+                             70,  -82,  106,   80,  -47,   -1,  124,  -92,
+                            127,    6,   32,  -93,  -47,  -37,   57, -117),
+      INT32_C(-1378988771) },
+    { simde_mm256_set_epi8( -80,   85,   47,  112,   38,   83,  -81,   17,
+                             97,   34,  -57,   17,  121,  -61,  116,   70,
+                             88,   33,  125,  -10, -123,  -45,  -51,   19,
+                            -16,  -26,   96,   53,   92,  -53,   30,  101),
+      INT32_C(-2111562044) },
+    { simde_mm256_set_epi8( 114, -117, -119,  -94,   32,   44,  -56,  116,
+                            104,  -82,  -95,  125,   -8,  -91,   84,   60,
+                            -79,   63,  120, -127,  -66,   -5,   96,  -10,
+                            -31,  -86,   -2,   66, -108,  -61,  -71,  -24),
+      INT32_C( 1919720943) },
+    { simde_mm256_set_epi8( -14,   61,  -34, -106,   91,   17,   80,  -24,
+                             26,  -11,  -80,  -42,   23, -113,  -78,   46,
+                             70,   23,  -16,   57,  -20, -107,    7,  -62,
+                             56,   85,  -37,  -32, -122,  -55,   -1,  -77),
+      INT32_C(-1317655233) },
+    { simde_mm256_set_epi8(-119,  -12,   90,  -42,   14,   55,  -63,   26,
+                            -31, -119,  -59,  127,   12, -113,   78, -125,
+                            -24,  104,   92,   19,  127,  -88,   15,  -46,
+                             43,   67,   23,   44,  -51,  -82,  -28,   59),
+      INT32_C( -756710130) },
+    { simde_mm256_set_epi8( -54,  103,  117,   57,    9,  109,  -55,  108,
+                             61,   -5,  -66,   47,  -76,   74,  -53,   70,
+                             -1,   33,  -24,  108, -113,  -15,   56,  -82,
+                            -10,  -92, -113,  -52, -120,  -15,  121,   31),
+      INT32_C(-2106937860) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm256_movemask_epi8(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mul_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1231232956,  -478764639,  1076807055,   229299692,
+                            -1382057613,   415544430, -1590865658,   406065319),
+      simde_mm256_set_epi32(  220575931,  -590174258, -1885295094,   806443108,
+                             -740882059,   -63192931,  -342495459,  -848973539),
+      simde_mm256_set_epi64x(INT64_C(  282554565578462862), INT64_C(  184917156279922736),
+                             INT64_C(  -26259470492424330), INT64_C( -344738710936593941)) },
+    { simde_mm256_set_epi32( 1275448799,  -238873293,  -140768733,  2145454136,
+                            -1703087711,   569630703,  -412625796,  1897347716),
+      simde_mm256_set_epi32( 1957206373,  1699842991,  1022422328,  1419063010,
+                             1206651759,  -408203781,   603705368,  1048354209),
+      simde_mm256_set_epi64x(INT64_C( -406047092843139363), INT64_C( 3044534604049109360),
+                             INT64_C( -232525406738288043), INT64_C( 1989092464005136644)) },
+    { simde_mm256_set_epi32( -955982004,  2030450967,  -839617538,  1435230561,
+                             -271229910,  1891605031,   350801739, -1539339286),
+      simde_mm256_set_epi32( -989398127,  1504235476,   313601885,  2139130950,
+                              317446809,  1179495659,    60410088, -1067805933),
+      simde_mm256_set_epi64x(INT64_C( 3054276376839905292), INT64_C( 3070146113420962950),
+                             INT64_C( 2231139922607060429), INT64_C( 1643715622490783838)) },
+    { simde_mm256_set_epi32( 1509150666,  -239027387,  -190043543,  -276294711,
+                             -963958463,   981172237, -2076314308,  1162836146),
+      simde_mm256_set_epi32(  717813278, -1621206830,  -574305095,  -490439055,
+                             1392040543, -1251381674,  -117019715, -1110531587),
+      simde_mm256_set_epi64x(INT64_C(  387512832361453210), INT64_C(  135505716964338105),
+                             INT64_C(-1227820956419384738), INT64_C(-1291366270638343702)) },
+    { simde_mm256_set_epi32(-2070527784,  -890620391,   964957883,  -850941755,
+                             1742936403, -1240169518,   528171498,  -817578106),
+      simde_mm256_set_epi32( -973856570, -1761331043,  1377351000, -1182340336,
+                              211575959, -1427013533,  1777483282,  -691257032),
+      simde_mm256_set_epi64x(INT64_C( 1568677342197097813), INT64_C( 1006102760523129680),
+                             INT64_C( 1769738685400087094), INT64_C(  565156614981741392)) },
+    { simde_mm256_set_epi32(  376192141,   644300252, -1840004645,  -190051320,
+                             2109747843,   237644448, -1894857727,  1816423180),
+      simde_mm256_set_epi32(-1646660598,  -845460664,   915809169,   992535230,
+                               90838248, -1678896405,   628559396,  -550068762),
+      simde_mm256_set_epi64x(INT64_C( -544730518871287328), INT64_C( -188632630608003600),
+                             INT64_C( -398980409415409440), INT64_C( -999157649890703160)) },
+    { simde_mm256_set_epi32( 1762235008,  -141435115,  -539473684, -1547161726,
+                             -232838774,  1404320230, -2117202372,  -118454542),
+      simde_mm256_set_epi32(  830589444,  2138335860, -1258252454,   739634456,
+                             1483798973,  2136550314,  1511373461,   -31907870),
+      simde_mm256_set_epi64x(INT64_C( -302435778267723900), INT64_C(-1144334121554031056),
+                             INT64_C( 3000400828363052220), INT64_C(    3779632127045540)) },
+    { simde_mm256_set_epi32( 1954368282, -1682150014,  -708619386, -1584019714,
+                             -193625546, -1073586760, -2012201320,  -559189673),
+      simde_mm256_set_epi32(-1071428929, -1388278745, -1290201228, -1628361454,
+                             1164637508, -1495660157,   755161359,  1328990432),
+      simde_mm256_set_epi64x(INT64_C( 2335293110337652430), INT64_C( 2579356644653704156),
+                             INT64_C( 1605720942014721320), INT64_C( -743157725090208736)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mul_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mul_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( 1524834871,   742411322,  1766576180,   847937714,
+                              185569043,  -860305138,   927270673,   100904933),
+      simde_mm256_set_epi32(  -35866872,  -584722955,  -591167088,  2090399654,
+                              474504952,  1545801807,  1172842352,  -615830157),
+      simde_mm256_set_epi64x(INT64_C( 2754527406144828802), INT64_C( 1772528703959150956),
+                             INT64_C( 5309306970270919506), INT64_C(  371243086508606687)) },
+    { simde_mm256_set_epi32( 1353292478,  -172556151,   845073202, -1487053689,
+                              822146504,  1148287691, -1926464122, -1193595795),
+      simde_mm256_set_epi32( 1969655660,  -798541998,  -224793399,  1664829430,
+                              537903903,  1490514121,   120882210,  2018275285),
+      simde_mm256_set_epi64x(INT64_C(-4033041457574405406), INT64_C( 4674697209831054010),
+                             INT64_C( 1711539018405984611), INT64_C( 6259421450071652785)) },
+    { simde_mm256_set_epi32(-1824765006, -1986973219,  -909683159,  -253463038,
+                             -526456596,  1532672415,  -657627149,  -941037881),
+      simde_mm256_set_epi32(-1037710611,  1876427543, -1013527447,   106382952,
+                             1585987106,   936017374,  1538479074,  1181702701),
+      simde_mm256_set_epi64x(INT64_C( 4330783655163662811), INT64_C(  429947153486609616),
+                             INT64_C( 1434608009090538210), INT64_C( 3963347448668849915)) },
+    { simde_mm256_set_epi32( -598653321,  1639251919, -1854163229,  1999955108,
+                             -956364936,   528459241,  1907151078, -1357661336),
+      simde_mm256_set_epi32( 1656204066, -1444185475, -1926043733,  1718070865,
+                             -882234964, -1304924907,  1782017560,  -353876781),
+      simde_mm256_set_epi64x(INT64_C( 4673149570724564499), INT64_C( 3436064602362728420),
+                             INT64_C( 1580115531448766749), INT64_C(-6870555415100582216)) },
+    { simde_mm256_set_epi32(-1707702878, -1136755636,   592656213,  1729339302,
+                            -1417251188,  1449399328,  1937453271,  1629918266),
+      simde_mm256_set_epi32( 1576985148,  1626645459,  2069374305, -1185148505,
+                              382055686,  1497570633,   612659543,   -29259041),
+      simde_mm256_set_epi64x(INT64_C( 5137290655299851940), INT64_C( 5377931857374423882),
+                             INT64_C( 2170577869102734624), INT64_C( 6952755802251485830)) },
+    { simde_mm256_set_epi32( 1436855625, -1019214026, -1810999114, -1512542541,
+                            -1656579391,   -14679511,  -398991881,  1395312044),
+      simde_mm256_set_epi32( 1050857678,   559137638,  1474744406,  -263374485,
+                            -2133845745,  -851693457,   649418468, -1588358895),
+      simde_mm256_set_epi64x(INT64_C( 1831596946058576260), INT64_C(-7229140434303115311),
+                             INT64_C(-3708541120227795001), INT64_C( 3776563300306881644)) },
+    { simde_mm256_set_epi32(  766754278,  -660811779, -1841190422,   469947662,
+                            -1976241223,   673200663, -1359218512, -1491708560),
+      simde_mm256_set_epi32(  710525747,  -213970966, -2122262718,   660118655,
+                             1634273720,  1324009484,   873825305,  -726810733),
+      simde_mm256_set_epi64x(INT64_C(-3615768746183299006), INT64_C(  310221218559834610),
+                             INT64_C(  891324062447087892), INT64_C(-8444278017064067248)) },
+    { simde_mm256_set_epi32(-1180962391,  1122495217,  -465800648, -1299643165,
+                              983137961,  -460433802, -1404214012,  1529279701),
+      simde_mm256_set_epi32(-1648817017, -1722325409,   -63005684, -1173469233,
+                              829144498,  -259602999, -1680738813,  -845594481),
+      simde_mm256_set_epi64x(INT64_C( 2887778213211354479), INT64_C(-9096845600735893363),
+                             INT64_C(-2973004516371287898), INT64_C( 5275055827160728315)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mul_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mulhi_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(-20951,  31762,  -8828,  11984,  19112, -19314, -25919,  -9256,
+                             11051, -14270,  -4215, -27815, -12118,  30556,  -8020,   6724),
+      simde_mm256_set_epi16( -9507,   4423,  30750,  18959, -24045, -25294, -11383,  15545,
+                             31173,   3775,  -5821,  14032,  24625, -31094, -30844,  10682),
+      simde_mm256_set_epi16(  3039,   2143,  -4143,   3466,  -7013,   7454,   4501,  -2196,
+                              5256,   -822,    374,  -5956,  -4554, -14498,   3774,   1095) },
+    { simde_mm256_set_epi16( 19548,  -9528,   3250,  31894,  31141,   5228,    691, -24132,
+                            -30955, -21954,  11680, -14377,  -3275, -30266,  13027,  16435),
+      simde_mm256_set_epi16(-13492,  14840,  22926,  15648,  16099,   8776,  18644,  32369,
+                              1887,  -9654,  18568, -13467, -11999,  -6205,  25007,  25460),
+      simde_mm256_set_epi16( -4025,  -2158,   1136,   7615,   7649,    700,    196, -11920,
+                              -892,   3234,   3309,   2954,    599,   2865,   4970,   6384) },
+    { simde_mm256_set_epi16(-10178,  10023,   5695,  26000,  12680, -31836,  15947,  31980,
+                             -8568, -31097, -26839,  14262,  19471,  18836,   5305,  -5271),
+      simde_mm256_set_epi16( 10118,  26205,  29330,  13150,   1443, -18898, -29241, -18375,
+                             14953,   4687, -26501, -26415,  14046,  14698,  22034, -12649),
+      simde_mm256_set_epi16( -1572,   4007,   2548,   5216,    279,   9180,  -7116,  -8967,
+                             -1955,  -2224,  10852,  -5749,   4173,   4224,   1783,   1017) },
+    { simde_mm256_set_epi16( -5376,  -6244,  21181, -25752,   3399, -23416,  28124,  -5208,
+                              9717,  14668,  29168,  32692,  -6882,   3796, -30496,  -2228),
+      simde_mm256_set_epi16( 23881, -13321, -30890,  27548,  23987, -29757,   3847,  11682,
+                              8827, -23379,   9530, -17868, -16954,  14703,  31455,  13494),
+      simde_mm256_set_epi16( -1959,   1269,  -9984, -10825,   1244,  10632,   1650,   -929,
+                              1308,  -5233,   4241,  -8914,   1780,    851, -14638,   -459) },
+    { simde_mm256_set_epi16(-23292,  -3289,    103,     44,  16710, -19383, -32377,   4637,
+                             19055,  -2447,  24084,  18520, -25215,   4512, -26416,  -2075),
+      simde_mm256_set_epi16( 32363,  11209,  18577,  13980,   3377,   9580, -13770, -23586,
+                             11510,  28643, -11774,  21879,  19228, -14396, -25183, -19875),
+      simde_mm256_set_epi16(-11503,   -563,     29,      9,    861,  -2834,   6802,  -1669,
+                              3346,  -1070,  -4327,   6182,  -7398,   -992,  10150,    629) },
+    { simde_mm256_set_epi16( -4101, -27204,  21327,  -8798, -12515, -17334,  32045,  17868,
+                            -29572,    425,  21482, -31835,  15002, -14682, -15865,  -8944),
+      simde_mm256_set_epi16(-23842,  22803,   9340,  10283,   4158,  30583, -15396,  18498,
+                             10418, -12238, -16383, -24060, -15954, -31196, -18005, -17425),
+      simde_mm256_set_epi16(  1491,  -9466,   3039,  -1381,   -795,  -8090,  -7529,   5043,
+                             -4701,    -80,  -5371,  11687,  -3653,   6988,   4358,   2378) },
+    { simde_mm256_set_epi16( 11270,   6354,  -8203,  11677, -19252,  24387,  -7804,  -6329,
+                             20350,   9592,  -8270, -14412,  -1693, -22929,  19303, -21681),
+      simde_mm256_set_epi16(-26066,  11327, -30417,   7980, -30925, -27313,  -4659,   -542,
+                              1198,   1749,  23055, -17691,   1053, -27583,  30257, -10188),
+      simde_mm256_set_epi16( -4483,   1098,   3807,   1421,   9084, -10164,    554,     52,
+                               371,    255,  -2910,   3890,    -28,   9650,   8911,   3370) },
+    { simde_mm256_set_epi16(-16445,  11319, -15727,  11840,  24494, -11807, -12429,  17287,
+                             13929,  -7258,   5750,  14165, -19632,   3788, -24347,  32722),
+      simde_mm256_set_epi16( -9873,  27066,  10301,  20346, -15151, -14777,  -9377, -26981,
+                             31594, -14719,  21656, -31534, -18610,  27756,  20531, -29850),
+      simde_mm256_set_epi16(  2477,   4674,  -2472,   3675,  -5663,   2662,   1778,  -7118,
+                              6714,   1630,   1900,  -6816,   5574,   1604,  -7628, -14905) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mulhi_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mulhi_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(  9456,   7343,   2135,  -8386, -24160,  12384,  -1621,   2660,
+                             21883, -25809, -12429,  -6518,  21601, -18051,  20506,  15273),
+      simde_mm256_set_epi16(  5205,   4538, -19231,  19349,  -8923,  -4482,  -1189, -22374,
+                             17827, -20023, -21883,   -802,  16964, -14750,  25969, -25180),
+      simde_mm256_set_epi16(   751,    508,   1508,  16873, -29794,  11537,  -2781,   1751,
+                              5952,  27589, -30162,  -7241,   5591, -28739,   8125,   9404) },
+    { simde_mm256_set_epi16( 26785, -31084,  12067,  -6684,    957,  20781,  17996,  28943,
+                            -25957,  -4189, -20961, -27675, -29912,  -5977,  -5990,  -3717),
+      simde_mm256_set_epi16( 30822,  18038,  25572,  24792, -30220,   7289,  12572,  11193,
+                            -26462,  -1462, -20741,  -8741,  22467,   -763, -31668,     51),
+      simde_mm256_set_epi16( 12597,   9482,   4708,  22263,    515,   2311,   3452,   4943,
+                             23597,  -5558,  30467, -32725,  12212,  -6671,  30772,     48) },
+    { simde_mm256_set_epi16( -2413,  -1916,   1471,  -6849,  20264,  -8634,  32559,   3887,
+                            -24697,  19358,   2624,  24444, -29665, -16841,   1387,  29240),
+      simde_mm256_set_epi16( -1168, -22261,  27898, -10219,  13728,   9926, -12684, -11407,
+                             -7108, -13501, -13200, -27065,  28311,   3059,  16767, -26036),
+      simde_mm256_set_epi16( -3538, -23527,    626, -16001,   4244,   8618,  26257,   3210,
+                            -29127,  15370,   2095,  14349,  15495,   2272,    354,  17623) },
+    { simde_mm256_set_epi16( 12568,  -3753,  -4031,  -1118,  10940, -11926, -26547,  12988,
+                             -5911, -20980, -21647, -29593, -11442,  18243,   -494, -28785),
+      simde_mm256_set_epi16( 19208,  18177,   3767, -15908, -22707, -19253, -13131,  -3181,
+                            -25259, -11451, -17563,  17415,   7773,  24368,  13184, -27838),
+      simde_mm256_set_epi16(  3683,  17136,   3535, -16755,   7149, -27676,  31177,  12357,
+                            -28892, -28766,  32127,   9551,   6415,   6783,  13084,  21140) },
+    { simde_mm256_set_epi16( -7550,  22285, -23927,  -3911,  -6030,  30713, -14443,  -4120,
+                             -7362,   -840, -30079,  -5198,  27995,    155, -11051, -15015),
+      simde_mm256_set_epi16(  8840,  21146, -14122,  -8398, -20691,   3552, -14213,  25851,
+                            -15256,    655,  31277,   1164, -14611, -29532,  17074, -20376),
+      simde_mm256_set_epi16(  7821,   7190,  32642, -11808, -24818,   1664, -25524,  24225,
+                            -20905,    646,  16921,   1071,  21753,     85,  14194, -30723) },
+    { simde_mm256_set_epi16( 23388,  25233,   5767,  16367,  26684,  25677,  21589,  -1020,
+                             13700,  23349,  13815,   7754,   8113, -17186,  27791,   4520),
+      simde_mm256_set_epi16( 11373, -22874, -24365,  -6079, -13758,  -5744, -11206, -21082,
+                             26956, -13079,   -482,  -8093,  13334, -12628,  15476, -25650),
+      simde_mm256_set_epi16(  4058,  16425,   3622,  14848,  21082,  23426,  17897, -21774,
+                              5635,  18689,  13713,   6796,   1650, -26503,   6562,   2750) },
+    { simde_mm256_set_epi16( -9778,   4417,  17213,   7470, -14716,  16644, -16331,  25098,
+                            -29020, -15942, -29939, -18855,  -5055, -31496,  18902, -24254),
+      simde_mm256_set_epi16(-19090,  16777, -25804,  30306,  10971,  -3547,  12826,  14564,
+                             21027,  11417,  21070, -25906,  11966,  20145, -21159, -17587),
+      simde_mm256_set_epi16(-26020,   1130,  10435,   3454,   8507,  15743,   9629,   5577,
+                             11716,   8639,  11444,  28228,  11043,  10463,  12799,  30203) },
+    { simde_mm256_set_epi16( 19355, -32459, -26648, -28933, -13725, -25661, -13416,  14256,
+                             -5673,  15056, -12140, -12688,   3099,  -1149,  13400, -25332),
+      simde_mm256_set_epi16( 29418,  30406,  20839, -12096,  31192,  29157,  23759,    934,
+                              6919, -21156, -31774,   9913,   7851,   2895,  -1902, -20931),
+      simde_mm256_set_epi16(  8688,  15346,  12365,  29847,  24659,  17740,  18895,    203,
+                              6320,  10195,  27507,   7993,    371,   2844,  13011,  27363) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mulhi_epu16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mullo_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(-21633,  16795,  24134, -29024, -19516,  27044, -28509,   4125,
+                            -21256, -29138,  -5947,   6909, -20808,  20000, -11067,  22151),
+      simde_mm256_set_epi16( 19228,  10365,  16385,  14185,  23101,  -1415, -25922,   1255,
+                              2324,   5075,  -1039, -16316, -25869,  16984,  -2580, -21732),
+      simde_mm256_set_epi16( -2332,  16559,  -8634,  -8288, -16972,   5764,  26362,   -469,
+                             15200, -26134,  18549,  -5324, -30552,   6912, -20836, -23612) },
+    { simde_mm256_set_epi16(  6661, -25981,  -4343,  12187, -31122,  28654, -30955, -29800,
+                             32606, -16882,   8770,  29446, -13272,  -3670,  -4056,  12882),
+      simde_mm256_set_epi16(-31786,   6640, -22611,  20468,  -2261, -10374, -14608, -26585,
+                             12836,  12004, -12912, -31703,  -7613,  22755,  25947,  -1385),
+      simde_mm256_set_epi16( 20270, -23088,  26645,  13500, -18822,  14700,  -7760, -31704,
+                             17720, -14216,   7968, -31754, -16776, -17986,   9784, -15778) },
+    { simde_mm256_set_epi16(-14058,  11630,  -3894, -21698,  -7190, -24723,  26606,  13488,
+                             27864,  25301,  14801,  22493,  -8884,  23976, -28809,  25661),
+      simde_mm256_set_epi16(  3159, -30897,   -347, -11521, -27424,   5305, -21722, -29486,
+                             28565,  12493,  12149,  12463,  24057, -32029,   -899, -14597),
+      simde_mm256_set_epi16( 24186,   1778, -25038,  28354, -19264, -17979,  26452,  30816,
+                               440,   5265, -13435, -32749,  -9492,  23544,  12571,  30159) },
+    { simde_mm256_set_epi16(-12431,  20185,  15048, -12947,  31015, -25086,  26047, -16722,
+                             -7822, -16272,  24336,  19825, -20246,  -6476, -17786, -24777),
+      simde_mm256_set_epi16( 21169, -12197,  20738,  11334, -16276, -30289,   1595, -27998,
+                             -7760, -15513, -23548,   1757,  19744, -10709, -10089, -13830),
+      simde_mm256_set_epi16(-24799,  22307, -17008,  -6194,  23668,   5470,  -4859,  -6628,
+                             12384, -17136, -17344, -32627,  32576,  14396,   5386, -21834) },
+    { simde_mm256_set_epi16(-26425,  27055, -19211,  -2094,  -9700, -24523,  22851,   8092,
+                            -10238, -12889,  -7867,  15794,  21589,  16724,  15001,  27923),
+      simde_mm256_set_epi16( 18787,   -960,    315,  -4684,  21147,   6236,  -9032, -12097,
+                            -25012, -22250,  18743,  25247, -13471, -12601, -22713,  -4361),
+      simde_mm256_set_epi16(-11275, -20544, -22153, -22104,   1780, -29940, -17368,  21860,
+                             23704,  -5286,   4819,  30094,  23349,  24652,   3951,  -6315) },
+    { simde_mm256_set_epi16(-13851,   4785, -10661, -31837, -19708,  -7797,  -1915, -17521,
+                            -26641,   2534, -16981, -32194,  19505,  11176,  -5614,   6936),
+      simde_mm256_set_epi16( 11247,   6445, -27498,   9460,   8245,  30472,  -4172, -20038,
+                            -28467,  -4682,   1719, -22493, -15798, -31707,   3539,  29966),
+      simde_mm256_set_epi16( -3125, -28131,  13650,  25436, -28716, -22184,  -6012,   9446,
+                              6755,  -2172, -26819,  32378,  10282,  -4280, -10538,  29520) },
+    { simde_mm256_set_epi16(-17386,    -70, -16542,  21468, -17749, -17685, -18572,  17696,
+                            -10938,  26603,   8704,  21580,  23991,  -5611,  29257, -15736),
+      simde_mm256_set_epi16(  7956, -17617,  11720, -19840,   8156, -27171, -26340, -17200,
+                             21759,  22417,  -2272,  17870, -22123,  -7779,  25274,  -1973),
+      simde_mm256_set_epi16( 23480, -11994, -16752,  -6656,   8180,   9183,  25776, -22016,
+                             26810, -18149,  16384,  20776,  23171,    993,  -1270, -16936) },
+    { simde_mm256_set_epi16(-24342,  24564,  20403,  -7282,  -3544,  29251,  12036, -30380,
+                            -14260, -28254, -22090,   9215, -17387,   8068,  -7406,   3480),
+      simde_mm256_set_epi16( -6374,  17924,  -3770,  -1287,  22292,  -1793,  22709,  28425,
+                             16913,  -5674, -10902,  30461, -13786,  10729,  25135, -21915),
+      simde_mm256_set_epi16( 32196,  14288,  19954,    286, -31968, -18243, -25132,  16372,
+                             -6900,  12140, -19620,   7427,  32030, -11484, -27570,  19704) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mullo_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mullo_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1706597508,  2092848073,  1025677731,  -248843658,
+                             2034459947,  1804793283, -1349408012, -1332573470),
+      simde_mm256_set_epi32( -712593530, -1775904981, -1506021044,  -864041368,
+                            -1830683421, -1826575213,   580046583,  -841743643),
+      simde_mm256_set_epi32( -850929944, -1369251389,  -747040924, -2122071056,
+                             1327761697,   870458105, -2075899540,   357826602) },
+    { simde_mm256_set_epi32(  451193257,  -268344261, -1204517291,   874255963,
+                              478801291, -1982336590,   376909441,   508819931),
+      simde_mm256_set_epi32(-1693960145,  2140590523,   -40869028,  -643232910,
+                             -296291137,  -717574415, -1820411586,   -54282543),
+      simde_mm256_set_epi32(-1788862969,  1936351769,   329459084,  1317723526,
+                             -939346251,  1726317714, -2013889474,  1543613899) },
+    { simde_mm256_set_epi32(-1261005981,   484227925,  -155440131, -1827089060,
+                            -1611308599,   884082026,  -423443116,  1183752185),
+      simde_mm256_set_epi32(  210075549,  -965826059, -1987804971,   904247082,
+                             1812789925,   231093876, -1484948978,  1336664539),
+      simde_mm256_set_epi32(-1859813193, -1821350567,  1946360193,  -907819752,
+                              470962317,    -3485688, -1766534504,  1760539395) },
+    { simde_mm256_set_epi32(-1713166373, -1637981572,   863666417,  -774668868,
+                             1862483214,  1620779792,  1838071008,  1193152486),
+      simde_mm256_set_epi32( 1144796729,  2135859014, -1282002142,  -310189359,
+                            -1972691502,   664352399,  2021867309,   785561131),
+      simde_mm256_set_epi32(-1320152637,  1925313000,  1311449858,  -400449924,
+                             2137828220,   345896432,   154293088, -1341771870) },
+    { simde_mm256_set_epi32( 1851745529,   819162417,  1450828341, -1822899361,
+                              589759454, -1181183447,   555980078, -1316796401),
+      simde_mm256_set_epi32(-1413874158,  1323604875,   286479679,  1513201143,
+                             -580193095, -1140313629,   -25449476,  -606348014),
+      simde_mm256_set_epi32(-1277876350, -1282607973,   252265483,  1705296809,
+                             -691182738,  1938518875, -1262054584,  1246037006) },
+    { simde_mm256_set_epi32(-2106857030,  1339994050,   523896147,   672794026,
+                             -468462312,   -16909288,  -706697662, -2070626673),
+      simde_mm256_set_epi32( -768714129,   800329960,   279820344,   972429457,
+                             -324786010,  -343808623,   582333875,  1009777698),
+      simde_mm256_set_epi32(  274840486,  2134075344,  1369166376,  1923163466,
+                            -1584927344, -1334492776, -1303713242, -2020142338) },
+    { simde_mm256_set_epi32(-2101618957,  1653331999,   -66578061,  2032213284,
+                               17228503, -2118029175,  -125253235,   290331990),
+      simde_mm256_set_epi32( -764817967,    20964719, -1570845009,   687586901,
+                             -892995344,   -96834609,  1643726773,   -70715232),
+      simde_mm256_set_epi32(-1507454109,   563572849,  -331485283,   -34904844,
+                             -676859504,   243089863,   532782001, -1167219264) },
+    { simde_mm256_set_epi32( 1999321172, -1560063525, -1563690455,  -502478584,
+                             1283351173,   273860312,  1248467135, -1243576873),
+      simde_mm256_set_epi32( -757171552,   220349701,   442033313,  -482086437,
+                            -1248238585,  -787911823,   517686541,  -323907111),
+      simde_mm256_set_epi32( -726451072,   305569863,   892131273,   524845528,
+                             1617798563,   591269208,  -311182157,   348600895) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mullo_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_or_si256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 5540545308867698529), INT64_C(-1499897857080002342),
+                             INT64_C( 3508790842626868798), INT64_C(-6413459166292698503)),
+      simde_mm256_set_epi64x(INT64_C( -424268186462107151), INT64_C(-8763793484223553900),
+                             INT64_C(-1785117098092556496), INT64_C( 6623235205196537727)),
+      simde_mm256_set_epi64x(INT64_C(  -72063231359885327), INT64_C(-1193512335491662114),
+                             INT64_C( -596164003391107266), INT64_C(    -292607938797697)) },
+    { simde_mm256_set_epi64x(INT64_C(-1428711006905610909), INT64_C(-4281096564022662603),
+                             INT64_C( 2221416943278250211), INT64_C( -473478896277938307)),
+      simde_mm256_set_epi64x(INT64_C(-4926655813392344336), INT64_C(-4200105086616087104),
+                             INT64_C(-5069727581848461262), INT64_C(-3112458631920356400)),
+      simde_mm256_set_epi64x(INT64_C(  -23306434230624269), INT64_C(-4200028867321135115),
+                             INT64_C(-4614852611916531469), INT64_C( -148654522049363971)) },
+    { simde_mm256_set_epi64x(INT64_C( 7515848553921818370), INT64_C( 4743557738717993842),
+                             INT64_C(   11406171948492071), INT64_C(-9096712067511686905)),
+      simde_mm256_set_epi64x(INT64_C( 8983311390230704985), INT64_C(-6529093213785340926),
+                             INT64_C( 1115395393831226975), INT64_C(  320510736110981897)),
+      simde_mm256_set_epi64x(INT64_C( 9002601635787046747), INT64_C(-1876733369715302542),
+                             INT64_C( 1115397352371187583), INT64_C(-8794405465133090033)) },
+    { simde_mm256_set_epi64x(INT64_C( 5889473227533957838), INT64_C( 4978073355070147606),
+                             INT64_C( 2321839948765358202), INT64_C( 6512367253014511210)),
+      simde_mm256_set_epi64x(INT64_C( 6782130540897095758), INT64_C( 2877543121774880686),
+                             INT64_C(-7253745512547487373), INT64_C( 5100984165088867575)),
+      simde_mm256_set_epi64x(INT64_C( 6899514609795857102), INT64_C( 7493918859025166270),
+                             INT64_C(-4936554441366177413), INT64_C( 6839516012620283647)) },
+    { simde_mm256_set_epi64x(INT64_C(-2228694457294464249), INT64_C(-1408383008995609717),
+                             INT64_C( -971043149155143237), INT64_C( 6075551117667929733)),
+      simde_mm256_set_epi64x(INT64_C( 5686433120523646736), INT64_C( 3487746938679488037),
+                             INT64_C(-8419075525289582892), INT64_C( 5820815368075568357)),
+      simde_mm256_set_epi64x(INT64_C(-1154514716084142313), INT64_C( -254735551259803729),
+                             INT64_C( -310907326834933761), INT64_C( 6113550448769593061)) },
+    { simde_mm256_set_epi64x(INT64_C( 3858741696466296827), INT64_C(-4617218955052378685),
+                             INT64_C( 5486523197903089923), INT64_C(-7859072836796723194)),
+      simde_mm256_set_epi64x(INT64_C(-7387074962498190499), INT64_C( 6493386138138617941),
+                             INT64_C( 2433077220520446159), INT64_C(-8226685504104139516)),
+      simde_mm256_set_epi64x(INT64_C(-4755845780145856513), INT64_C(    -712643287990825),
+                             INT64_C( 7918471464523102671), INT64_C(-6917819303210289914)) },
+    { simde_mm256_set_epi64x(INT64_C( 5258866355296697328), INT64_C(-6173393507011139204),
+                             INT64_C( 5603980370228937917), INT64_C(-6960480160012071804)),
+      simde_mm256_set_epi64x(INT64_C( 3244947801423409984), INT64_C(-7934696001518407371),
+                             INT64_C( 4612883425447283927), INT64_C( 7368747644553051477)),
+      simde_mm256_set_epi64x(INT64_C( 7925068532809137136), INT64_C(-4903294820150281859),
+                             INT64_C( 5603981508396354815), INT64_C(  -42945836659261995)) },
+    { simde_mm256_set_epi64x(INT64_C(-2686623499869718747), INT64_C(-3735080799673455915),
+                             INT64_C( 3244429548453752433), INT64_C( 3668839244147953251)),
+      simde_mm256_set_epi64x(INT64_C( 1955532044786562010), INT64_C( 1999103972192055298),
+                             INT64_C(-6241375499967238231), INT64_C( 7518649502660029379)),
+      simde_mm256_set_epi64x(INT64_C(-2614495534262683649), INT64_C(-2324279629523387689),
+                             INT64_C(-5951876905866235911), INT64_C( 8863048864005353443)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_or_si256(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_packs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(   169,    492,   -251,   -364,    -42,   -217,    386,    119,
+                              -216,     74,   -131,    451,    391,     77,    410,    387),
+      simde_mm256_set_epi16(  -235,    163,    162,   -157,    462,   -306,    209,   -156,
+                               -86,   -425,    -63,    400,    420,    401,    454,    180),
+      simde_mm256_set_epi8(INT8_MIN,  127,  127, INT8_MIN,  127, INT8_MIN,  127, INT8_MIN,
+                            127,  127, INT8_MIN, INT8_MIN,  -42, INT8_MIN,  127,  119,
+                            -86, INT8_MIN,  -63,  127,  127,  127,  127,  127,
+                           INT8_MIN,   74, INT8_MIN,  127,  127,   77,  127,  127) },
+    { simde_mm256_set_epi16(   408,   -391,   -372,   -387,   -267,   -511,   -315,    -40,
+                               294,    486,   -338,   -457,    303,   -194,   -391,    156),
+      simde_mm256_set_epi16(  -477,    142,    143,   -191,   -170,    490,    345,   -300,
+                              -206,     76,    206,   -191,   -207,    -42,    389,   -371),
+      simde_mm256_set_epi8(INT8_MIN,  127,  127, INT8_MIN, INT8_MIN,  127,  127, INT8_MIN,
+                            127, INT8_MIN, INT8_MIN, INT8_MIN, INT8_MIN, INT8_MIN, INT8_MIN,  -40,
+                           INT8_MIN,   76,  127, INT8_MIN, INT8_MIN,  -42,  127, INT8_MIN,
+                            127,  127, INT8_MIN, INT8_MIN,  127, INT8_MIN, INT8_MIN,  127) },
+    { simde_mm256_set_epi16(  -188,   -422,    152,   -223,    -70,     38,    139,     30,
+                              -177,    381,    432,    511,   -268,   -128,    395,    473),
+      simde_mm256_set_epi16(  -457,    423,     73,   -384,   -330,    166,     26,   -317,
+                               346,    391,   -359,   -101,    274,   -462,   -182,    132),
+      simde_mm256_set_epi8(INT8_MIN,  127,   73, INT8_MIN, INT8_MIN,  127,   26, INT8_MIN,
+                           INT8_MIN, INT8_MIN,  127, INT8_MIN,  -70,   38,  127,   30,
+                            127,  127, INT8_MIN, -101,  127, INT8_MIN, INT8_MIN,  127,
+                           INT8_MIN,  127,  127,  127, INT8_MIN, INT8_MIN,  127,  127) },
+    { simde_mm256_set_epi16(  -277,    239,   -195,    452,   -144,   -107,   -181,    316,
+                              -281,   -300,   -174,   -105,    181,   -161,    202,    464),
+      simde_mm256_set_epi16(  -223,   -241,    417,     72,    -14,      5,    509,    -66,
+                                12,   -311,   -378,   -300,    510,   -106,   -222,    208),
+      simde_mm256_set_epi8(INT8_MIN, INT8_MIN,  127,   72,  -14,    5,  127,  -66,
+                           INT8_MIN,  127, INT8_MIN,  127, INT8_MIN, -107, INT8_MIN,  127,
+                             12, INT8_MIN, INT8_MIN, INT8_MIN,  127, -106, INT8_MIN,  127,
+                           INT8_MIN, INT8_MIN, INT8_MIN, -105,  127, INT8_MIN,  127,  127) },
+    { simde_mm256_set_epi16(   155,   -461,    -52,   -487,   -343,    153,    184,    370,
+                              -241,    -82,    296,   -226,    403,   -186,    388,    355),
+      simde_mm256_set_epi16(   323,   -361,   -179,    447,    386,   -249,     44,     -7,
+                              -222,      5,   -146,      0,   -245,   -142,    147,    -94),
+      simde_mm256_set_epi8( 127, INT8_MIN, INT8_MIN,  127,  127, INT8_MIN,   44,   -7,
+                            127, INT8_MIN,  -52, INT8_MIN, INT8_MIN,  127,  127,  127,
+                           INT8_MIN,    5, INT8_MIN,    0, INT8_MIN, INT8_MIN,  127,  -94,
+                           INT8_MIN,  -82,  127, INT8_MIN,  127, INT8_MIN,  127,  127) },
+    { simde_mm256_set_epi16(   402,   -174,    220,   -335,   -252,    -32,   -423,    353,
+                              -231,    121,    243,    296,    245,    376,   -221,   -438),
+      simde_mm256_set_epi16(   124,   -135,     48,     16,    175,    102,   -448,    505,
+                               304,   -335,    -14,    150,   -332,    223,    180,    304),
+      simde_mm256_set_epi8( 124, INT8_MIN,   48,   16,  127,  102, INT8_MIN,  127,
+                            127, INT8_MIN,  127, INT8_MIN, INT8_MIN,  -32, INT8_MIN,  127,
+                            127, INT8_MIN,  -14,  127, INT8_MIN,  127,  127,  127,
+                           INT8_MIN,  121,  127,  127,  127,  127, INT8_MIN, INT8_MIN) },
+    { simde_mm256_set_epi16(  -439,   -278,    330,    443,    189,    298,     28,     77,
+                              -213,    378,   -214,   -324,   -352,   -239,    144,    372),
+      simde_mm256_set_epi16(  -174,    427,    252,    223,   -184,    106,    385,    396,
+                               407,    409,    300,    434,   -382,    281,   -267,    303),
+      simde_mm256_set_epi8(INT8_MIN,  127,  127,  127, INT8_MIN,  106,  127,  127,
+                           INT8_MIN, INT8_MIN,  127,  127,  127,  127,   28,   77,
+                            127,  127,  127,  127, INT8_MIN,  127, INT8_MIN,  127,
+                           INT8_MIN,  127, INT8_MIN, INT8_MIN, INT8_MIN, INT8_MIN,  127,  127) },
+    { simde_mm256_set_epi16(    -9,    291,   -265,    -25,    -70,    258,   -252,    -80,
+                              -479,   -441,   -268,    304,   -175,    218,    148,   -379),
+      simde_mm256_set_epi16(   175,   -198,    181,    -97,     20,    342,     73,    371,
+                               406,    279,     95,     66,    453,    148,     66,     25),
+      simde_mm256_set_epi8( 127, INT8_MIN,  127,  -97,   20,  127,   73,  127,
+                             -9,  127, INT8_MIN,  -25,  -70,  127, INT8_MIN,  -80,
+                            127,  127,   95,   66,  127,  127,   66,   25,
+                           INT8_MIN, INT8_MIN, INT8_MIN,  127, INT8_MIN,  127,  127, INT8_MIN) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_packs_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_packs_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(      88333,       45590,        5378,       94237,
+                                  15985,       71170,       -1194,       61447),
+      simde_mm256_set_epi32(     -68446,       20513,      -15524,      -98337,
+                                 -25831,       49915,       18346,       51972),
+      simde_mm256_set_epi16(INT16_MIN,  20513, -15524, INT16_MIN,  32767,  32767,   5378,  32767,
+                            -25831,  32767,  18346,  32767,  15985,  32767,  -1194,  32767) },
+    { simde_mm256_set_epi32(      72871,      -55012,       78918,      -82631,
+                                 -59909,      -85784,      -41516,       75895),
+      simde_mm256_set_epi32(     -45778,       24238,        3003,       26575,
+                                 -34876,      -66390,      -31931,      -39916),
+      simde_mm256_set_epi16(INT16_MIN,  24238,   3003,  26575,  32767, INT16_MIN,  32767, INT16_MIN,
+                            INT16_MIN, INT16_MIN, -31931, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN,  32767) },
+    { simde_mm256_set_epi32(      36586,       50580,       20567,       74297,
+                                  36059,        9834,      -18774,       20440),
+      simde_mm256_set_epi32(       5325,       48078,      -33604,      -68125,
+                                 -20779,      -51594,      -90746,       98923),
+      simde_mm256_set_epi16(  5325,  32767, INT16_MIN, INT16_MIN,  32767,  32767,  20567,  32767,
+                            -20779, INT16_MIN, INT16_MIN,  32767,  32767,   9834, -18774,  20440) },
+    { simde_mm256_set_epi32(      29533,      -93267,       70782,       58917,
+                                 -14491,       34718,      -11718,       75731),
+      simde_mm256_set_epi32(     -59411,      -43450,       -8256,       43347,
+                                  34547,      -28863,        8410,      -61283),
+      simde_mm256_set_epi16(INT16_MIN, INT16_MIN,  -8256,  32767,  29533, INT16_MIN,  32767,  32767,
+                             32767, -28863,   8410, INT16_MIN, -14491,  32767, -11718,  32767) },
+    { simde_mm256_set_epi32(      35096,       25436,      -30643,       26486,
+                                 -69592,        4434,       89587,      -84772),
+      simde_mm256_set_epi32(     -81695,        3067,       94954,       -9501,
+                                 -52284,       74655,       84856,      -78084),
+      simde_mm256_set_epi16(INT16_MIN,   3067,  32767,  -9501,  32767,  25436, -30643,  26486,
+                            INT16_MIN,  32767,  32767, INT16_MIN, INT16_MIN,   4434,  32767, INT16_MIN) },
+    { simde_mm256_set_epi32(      48459,      -66826,       82178,      -52437,
+                                  51019,       63771,      -56324,         488),
+      simde_mm256_set_epi32(     -71050,      -41834,      -58598,      -50243,
+                                  16476,       -5715,      -75914,       -1584),
+      simde_mm256_set_epi16(INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN,  32767, INT16_MIN,  32767, INT16_MIN,
+                             16476,  -5715, INT16_MIN,  -1584,  32767,  32767, INT16_MIN,    488) },
+    { simde_mm256_set_epi32(      -8603,      -73725,      -48751,      -77756,
+                                 -65042,      -98741,       63862,       55013),
+      simde_mm256_set_epi32(     -45091,       99862,       32635,      -95134,
+                                  88490,       59767,      -41570,       -9908),
+      simde_mm256_set_epi16(INT16_MIN,  32767,  32635, INT16_MIN,  -8603, INT16_MIN, INT16_MIN, INT16_MIN,
+                             32767,  32767, INT16_MIN,  -9908, INT16_MIN, INT16_MIN,  32767,  32767) },
+    { simde_mm256_set_epi32(     -26240,      -54653,      -16122,       97508,
+                                 -57865,      -25002,      -97650,       45491),
+      simde_mm256_set_epi32(      23764,       43038,      -93366,      -59576,
+                                  81776,      -65733,       -9597,       -6505),
+      simde_mm256_set_epi16( 23764,  32767, INT16_MIN, INT16_MIN, -26240, INT16_MIN, -16122,  32767,
+                             32767, INT16_MIN,  -9597,  -6505, INT16_MIN, -25002, INT16_MIN,  32767) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_packs_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_packus_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(   -90,    235,    132,    -58,   -169,    219,    383,   -251,
+                               263,    164,    452,    395,   -304,    388,   -500,    433),
+      simde_mm256_set_epi16(  -137,   -245,   -428,   -235,    141,    -89,   -290,    436,
+                              -367,   -369,   -355,    489,    139,   -319,   -383,    243),
+      simde_mm256_set_epi8(   0,    0,    0,    0, -115,    0,    0,   -1,
+                              0,  -21, -124,    0,    0,  -37,   -1,    0,
+                              0,    0,    0,   -1, -117,    0,    0,  -13,
+                             -1,  -92,   -1,   -1,    0,   -1,    0,   -1) },
+    { simde_mm256_set_epi16(    65,    478,     83,   -277,   -252,     20,    119,   -423,
+                               270,    450,   -288,   -407,   -452,    396,   -347,   -202),
+      simde_mm256_set_epi16(    51,    389,    233,    463,     56,   -149,    500,   -445,
+                               178,   -117,   -234,     29,    -39,    394,    487,    384),
+      simde_mm256_set_epi8(  51,   -1,  -23,   -1,   56,    0,   -1,    0,
+                             65,   -1,   83,    0,    0,   20,  119,    0,
+                            -78,    0,    0,   29,    0,   -1,   -1,   -1,
+                             -1,   -1,    0,    0,    0,   -1,    0,    0) },
+    { simde_mm256_set_epi16(  -422,   -310,    468,   -321,   -156,    383,     65,   -297,
+                               264,     61,   -219,    -64,   -247,   -388,   -475,    373),
+      simde_mm256_set_epi16(   155,   -465,    -62,    155,    405,   -328,    265,   -178,
+                               388,   -266,    147,   -470,    141,    -83,   -190,    191),
+      simde_mm256_set_epi8(-101,    0,    0, -101,   -1,    0,   -1,    0,
+                              0,    0,   -1,    0,    0,   -1,   65,    0,
+                             -1,    0, -109,    0, -115,    0,    0,  -65,
+                             -1,   61,    0,    0,    0,    0,    0,   -1) },
+    { simde_mm256_set_epi16(   384,   -172,    174,    432,    -32,    161,    314,   -398,
+                               383,   -337,    271,   -343,   -107,   -335,     27,    284),
+      simde_mm256_set_epi16(    21,   -508,    -69,   -314,    415,   -325,     15,     59,
+                               114,    402,   -244,   -374,   -326,    249,    150,    360),
+      simde_mm256_set_epi8(  21,    0,    0,    0,   -1,    0,   15,   59,
+                             -1,    0,  -82,   -1,    0,  -95,   -1,    0,
+                            114,   -1,    0,    0,    0,   -7, -106,   -1,
+                             -1,    0,   -1,    0,    0,    0,   27,   -1) },
+    { simde_mm256_set_epi16(    22,   -185,   -459,    470,   -222,   -159,   -494,    -25,
+                               -99,    295,    -48,    307,   -223,    311,   -368,    437),
+      simde_mm256_set_epi16(   -69,    497,   -482,    120,    226,   -495,   -492,    -54,
+                               155,    453,    184,    317,    445,    250,    109,   -433),
+      simde_mm256_set_epi8(   0,   -1,    0,  120,  -30,    0,    0,    0,
+                             22,    0,    0,   -1,    0,    0,    0,    0,
+                           -101,   -1,  -72,   -1,   -1,   -6,  109,    0,
+                              0,   -1,    0,   -1,    0,   -1,    0,   -1) },
+    { simde_mm256_set_epi16(   500,   -431,    119,   -405,    143,    -94,    -38,    367,
+                              -352,    -80,    449,    412,    -20,    182,   -333,     30),
+      simde_mm256_set_epi16(  -193,    381,    496,     49,    -32,     47,    445,    459,
+                                35,   -394,   -200,   -376,    363,    423,    108,   -437),
+      simde_mm256_set_epi8(   0,   -1,   -1,   49,    0,   47,   -1,   -1,
+                             -1,    0,  119,    0, -113,    0,    0,   -1,
+                             35,    0,    0,    0,   -1,   -1,  108,    0,
+                              0,    0,   -1,   -1,    0,  -74,    0,   30) },
+    { simde_mm256_set_epi16(   121,    431,   -124,   -116,    399,    147,   -323,   -124,
+                              -182,    374,    -86,    214,     91,    258,    363,    -67),
+      simde_mm256_set_epi16(   485,    226,    140,    284,   -170,    263,    284,   -327,
+                               -25,   -188,    491,   -323,   -339,    -93,   -148,      0),
+      simde_mm256_set_epi8(  -1,  -30, -116,   -1,    0,   -1,   -1,    0,
+                            121,   -1,    0,    0,   -1, -109,    0,    0,
+                              0,    0,   -1,    0,    0,    0,    0,    0,
+                              0,   -1,    0,  -42,   91,   -1,   -1,    0) },
+    { simde_mm256_set_epi16(  -487,    -33,    485,    -23,    433,    279,    496,   -305,
+                               459,    429,     41,    -15,    196,    382,    447,   -282),
+      simde_mm256_set_epi16(   -19,   -417,    366,    190,     -3,   -315,    326,   -174,
+                               170,    183,    262,    146,     38,    472,     46,   -300),
+      simde_mm256_set_epi8(   0,    0,   -1,  -66,    0,    0,   -1,    0,
+                              0,    0,   -1,    0,   -1,   -1,   -1,    0,
+                            -86,  -73,   -1, -110,   38,   -1,   46,    0,
+                             -1,   -1,   41,    0,  -60,   -1,   -1,    0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_packus_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_packus_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(     -68018,       32429,      -68665,       27500,
+                                  34042,      -28113,       23513,      -74417),
+      simde_mm256_set_epi32(      94630,      -91456,       76644,       82256,
+                                 -26309,       49820,       18510,      -32877),
+      simde_mm256_set_epi16(    -1,      0,     -1,     -1,      0,  32429,      0,  27500,
+                                 0, -15716,  18510,      0, -31494,      0,  23513,      0) },
+    { simde_mm256_set_epi32(     -20971,       80177,      -49078,       62385,
+                                 -34796,       87636,      -79754,      -37476),
+      simde_mm256_set_epi32(      75472,       91994,       32605,       14527,
+                                 -24118,       52109,      -66097,      -24012),
+      simde_mm256_set_epi16(    -1,     -1,  32605,  14527,      0,     -1,      0,  -3151,
+                                 0, -13427,      0,      0,      0,     -1,      0,      0) },
+    { simde_mm256_set_epi32(     -30858,       54576,       11150,       29206,
+                                  40218,       35703,      -52131,      -44026),
+      simde_mm256_set_epi32(     -24801,        1229,       10218,        1983,
+                                 -38237,      -41041,      -32728,       -8451),
+      simde_mm256_set_epi16(     0,   1229,  10218,   1983,      0, -10960,  11150,  29206,
+                                 0,      0,      0,      0, -25318, -29833,      0,      0) },
+    { simde_mm256_set_epi32(     -75192,       89041,         310,      -29043,
+                                  61817,       38156,      -72914,       35196),
+      simde_mm256_set_epi32(      40690,      -92059,       39197,       52499,
+                                  43735,      -60696,      -36576,      -52531),
+      simde_mm256_set_epi16(-24846,      0, -26339, -13037,      0,     -1,    310,      0,
+                            -21801,      0,      0,      0,  -3719, -27380,      0, -30340) },
+    { simde_mm256_set_epi32(      70987,      -13427,      -80044,      -80278,
+                                 -81958,      -69159,      -42423,      -92274),
+      simde_mm256_set_epi32(     -69106,       19812,       81344,      -40704,
+                                  34207,      -86818,      -81382,       17342),
+      simde_mm256_set_epi16(     0,  19812,     -1,      0,     -1,      0,      0,      0,
+                            -31329,      0,      0,  17342,      0,      0,      0,      0) },
+    { simde_mm256_set_epi32(     -35274,      -74938,      -40061,      -56734,
+                                  43029,        6608,       54874,      -88596),
+      simde_mm256_set_epi32(       1881,      -27346,       54899,      -16830,
+                                  78245,      -36811,      -89204,      -43735),
+      simde_mm256_set_epi16(  1881,      0, -10637,      0,      0,      0,      0,      0,
+                                -1,      0,      0,      0, -22507,   6608, -10662,      0) },
+    { simde_mm256_set_epi32(     -64058,      -77043,       66286,       43742,
+                                  38056,      -41316,       92524,      -74632),
+      simde_mm256_set_epi32(      46616,      -61485,       -3188,      -51754,
+                                  69330,       90343,      -12797,      -88092),
+      simde_mm256_set_epi16(-18920,      0,      0,      0,      0,      0,     -1, -21794,
+                                -1,     -1,      0,      0, -27480,      0,     -1,      0) },
+    { simde_mm256_set_epi32(      50472,       67086,       56376,      -63632,
+                                 -76299,       11033,       -8981,      -16791),
+      simde_mm256_set_epi32(     -25209,       94419,      -33478,        5452,
+                                  30359,       67475,      -60867,       48152),
+      simde_mm256_set_epi16(     0,     -1,      0,   5452, -15064,     -1,  -9160,      0,
+                             30359,     -1,      0, -17384,      0,  11033,      0,      0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_packus_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_permute4x64_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r27;
+    simde__m256i r216;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 5784555773994064749), INT64_C(-1709092242191759274),
+                             INT64_C(-3840436897006461987), INT64_C(-6372582466433331279)),
+      simde_mm256_set_epi64x(INT64_C(-6372582466433331279), INT64_C(-3840436897006461987),
+                             INT64_C(-1709092242191759274), INT64_C( 5784555773994064749)),
+      simde_mm256_set_epi64x(INT64_C( 5784555773994064749), INT64_C(-3840436897006461987),
+                             INT64_C(-1709092242191759274), INT64_C(-6372582466433331279)) },
+    { simde_mm256_set_epi64x(INT64_C(-5415268525927430335), INT64_C(-1963608959800736466),
+                             INT64_C(-1248231404684066448), INT64_C(-7681024016566835382)),
+      simde_mm256_set_epi64x(INT64_C(-7681024016566835382), INT64_C(-1248231404684066448),
+                             INT64_C(-1963608959800736466), INT64_C(-5415268525927430335)),
+      simde_mm256_set_epi64x(INT64_C(-5415268525927430335), INT64_C(-1248231404684066448),
+                             INT64_C(-1963608959800736466), INT64_C(-7681024016566835382)) },
+    { simde_mm256_set_epi64x(INT64_C( 1303566319118034655), INT64_C(-3628683167345781146),
+                             INT64_C(-5873597354850266266), INT64_C(-7507243271011239813)),
+      simde_mm256_set_epi64x(INT64_C(-7507243271011239813), INT64_C(-5873597354850266266),
+                             INT64_C(-3628683167345781146), INT64_C( 1303566319118034655)),
+      simde_mm256_set_epi64x(INT64_C( 1303566319118034655), INT64_C(-5873597354850266266),
+                             INT64_C(-3628683167345781146), INT64_C(-7507243271011239813)) },
+    { simde_mm256_set_epi64x(INT64_C( 4919295370115955884), INT64_C(-7645062242588432072),
+                             INT64_C(-1511066675959637443), INT64_C(-2752168545771205792)),
+      simde_mm256_set_epi64x(INT64_C(-2752168545771205792), INT64_C(-1511066675959637443),
+                             INT64_C(-7645062242588432072), INT64_C( 4919295370115955884)),
+      simde_mm256_set_epi64x(INT64_C( 4919295370115955884), INT64_C(-1511066675959637443),
+                             INT64_C(-7645062242588432072), INT64_C(-2752168545771205792)) },
+    { simde_mm256_set_epi64x(INT64_C(-6383004826114286807), INT64_C( 8197968516026043974),
+                             INT64_C(-2128507634706940214), INT64_C( 3008372831099595240)),
+      simde_mm256_set_epi64x(INT64_C( 3008372831099595240), INT64_C(-2128507634706940214),
+                             INT64_C( 8197968516026043974), INT64_C(-6383004826114286807)),
+      simde_mm256_set_epi64x(INT64_C(-6383004826114286807), INT64_C(-2128507634706940214),
+                             INT64_C( 8197968516026043974), INT64_C( 3008372831099595240)) },
+    { simde_mm256_set_epi64x(INT64_C(-2741765466122091674), INT64_C(-7178420351512416962),
+                             INT64_C( 5161138490693599306), INT64_C( 8072096240345288351)),
+      simde_mm256_set_epi64x(INT64_C( 8072096240345288351), INT64_C( 5161138490693599306),
+                             INT64_C(-7178420351512416962), INT64_C(-2741765466122091674)),
+      simde_mm256_set_epi64x(INT64_C(-2741765466122091674), INT64_C( 5161138490693599306),
+                             INT64_C(-7178420351512416962), INT64_C( 8072096240345288351)) },
+    { simde_mm256_set_epi64x(INT64_C(-8668123827158895253), INT64_C( 5414403921504302471),
+                             INT64_C(-7550778347531965040), INT64_C(-7284740640121716742)),
+      simde_mm256_set_epi64x(INT64_C(-7284740640121716742), INT64_C(-7550778347531965040),
+                             INT64_C( 5414403921504302471), INT64_C(-8668123827158895253)),
+      simde_mm256_set_epi64x(INT64_C(-8668123827158895253), INT64_C(-7550778347531965040),
+                             INT64_C( 5414403921504302471), INT64_C(-7284740640121716742)) },
+    { simde_mm256_set_epi64x(INT64_C(-7722306479802615438), INT64_C( 6856653354181174861),
+                             INT64_C(-9016831046713648085), INT64_C( 5970573446414064187)),
+      simde_mm256_set_epi64x(INT64_C( 5970573446414064187), INT64_C(-9016831046713648085),
+                             INT64_C( 6856653354181174861), INT64_C(-7722306479802615438)),
+      simde_mm256_set_epi64x(INT64_C(-7722306479802615438), INT64_C(-9016831046713648085),
+                             INT64_C( 6856653354181174861), INT64_C( 5970573446414064187)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r;
+
+    r = simde_mm256_permute4x64_epi64(test_vec[i].a, 27);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r27);
+    r = simde_mm256_permute4x64_epi64(test_vec[i].a, 216);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r216);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_permute4x64_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d r27;
+    simde__m256d r216;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(    39.01,    499.36,   -645.74,    786.38),
+      simde_mm256_set_pd(   786.38,   -645.74,    499.36,     39.01),
+      simde_mm256_set_pd(    39.01,   -645.74,    499.36,    786.38) },
+    { simde_mm256_set_pd(  -751.28,    523.68,    606.05,   -931.67),
+      simde_mm256_set_pd(  -931.67,    606.05,    523.68,   -751.28),
+      simde_mm256_set_pd(  -751.28,    606.05,    523.68,   -931.67) },
+    { simde_mm256_set_pd(  -195.72,   -682.76,   -730.71,   -335.96),
+      simde_mm256_set_pd(  -335.96,   -730.71,   -682.76,   -195.72),
+      simde_mm256_set_pd(  -195.72,   -730.71,   -682.76,   -335.96) },
+    { simde_mm256_set_pd(  -530.94,   -609.90,   -322.80,    907.81),
+      simde_mm256_set_pd(   907.81,   -322.80,   -609.90,   -530.94),
+      simde_mm256_set_pd(  -530.94,   -322.80,   -609.90,    907.81) },
+    { simde_mm256_set_pd(  -962.84,    751.63,   -867.77,   -561.65),
+      simde_mm256_set_pd(  -561.65,   -867.77,    751.63,   -962.84),
+      simde_mm256_set_pd(  -962.84,   -867.77,    751.63,   -561.65) },
+    { simde_mm256_set_pd(   290.74,    257.08,    719.01,   -693.98),
+      simde_mm256_set_pd(  -693.98,    719.01,    257.08,    290.74),
+      simde_mm256_set_pd(   290.74,    719.01,    257.08,   -693.98) },
+    { simde_mm256_set_pd(   160.30,    556.13,   -828.25,   -648.56),
+      simde_mm256_set_pd(  -648.56,   -828.25,    556.13,    160.30),
+      simde_mm256_set_pd(   160.30,   -828.25,    556.13,   -648.56) },
+    { simde_mm256_set_pd(  -472.60,   -748.02,   -617.33,    307.48),
+      simde_mm256_set_pd(   307.48,   -617.33,   -748.02,   -472.60),
+      simde_mm256_set_pd(  -472.60,   -617.33,   -748.02,    307.48) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r;
+
+    r = simde_mm256_permute4x64_pd(test_vec[i].a, 27);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r27, 1);
+    r = simde_mm256_permute4x64_pd(test_vec[i].a, 216);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r216, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_permutevar8x32_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i idx;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1006772436,    -6734318,   456154510, -1575672020,
+                            -1292389048, -1595080465,   765806611, -1978718486),
+      simde_mm256_set_epi32(          1,    40450392,           3,           1,
+                                      7,           5,           2,           7),
+      simde_mm256_set_epi32(  765806611, -1978718486, -1292389048,   765806611,
+                            -1006772436,   456154510, -1595080465, -1006772436) },
+    { simde_mm256_set_epi32(  663432626,  -261154109,  -864931754,   552823511,
+                             -681369223,  -298522289,  1835556083, -1545235393),
+      simde_mm256_set_epi32(          4,           3,           4,           1,
+                                      2,           2,           3,           0),
+      simde_mm256_set_epi32(  552823511,  -681369223,   552823511,  1835556083,
+                             -298522289,  -298522289,  -681369223, -1545235393) },
+    { simde_mm256_set_epi32(-2092424045, -1757468407,   299358430,   -53275071,
+                             2138184292,  1024690442,  1194172470,  -523858127),
+      simde_mm256_set_epi32(          2,           5,           6,           5,
+                                      2,  1394322467,           2,           7),
+      simde_mm256_set_epi32( 1024690442,   299358430, -1757468407,   299358430,
+                             1024690442,  2138184292,  1024690442, -2092424045) },
+    { simde_mm256_set_epi32(-1309287420, -2082901678, -1316957685, -1806028686,
+                            -2000513488, -1452134219, -2065142393,   956980198),
+      simde_mm256_set_epi32(          5,   554025644,           2,           4,
+                                      3,           3,           2,           2),
+      simde_mm256_set_epi32(-1316957685, -1806028686, -1452134219, -1806028686,
+                            -2000513488, -2000513488, -1452134219, -1452134219) },
+    { simde_mm256_set_epi32( 1435721670,   148705837,  -121972101,  -439359318,
+                             -967445797,  1521532721,  -867807685,  1989131740),
+      simde_mm256_set_epi32(          4,           5,           2,           2,
+                                      0,           1,           2,           0),
+      simde_mm256_set_epi32( -439359318,  -121972101,  1521532721,  1521532721,
+                             1989131740,  -867807685,  1521532721,  1989131740) },
+    { simde_mm256_set_epi32( -103769656, -1247408213,  -736581564,  -311555366,
+                              363374645,  1167638647,   741556898,   316528639),
+      simde_mm256_set_epi32(          4,           2,           2,           6,
+                                      4,           4,           5,           3),
+      simde_mm256_set_epi32( -311555366,  1167638647,  1167638647, -1247408213,
+                             -311555366,  -311555366,  -736581564,   363374645) },
+    { simde_mm256_set_epi32(-1395238224,  1661320097,  1999237172, -1362431287,
+                            -1256563369,  1024570770,   636889022,  1122630355),
+      simde_mm256_set_epi32(          4,           6,           7,           5,
+                                      5,           4,           3,           3),
+      simde_mm256_set_epi32(-1362431287,  1661320097, -1395238224,  1999237172,
+                             1999237172, -1362431287, -1256563369, -1256563369) },
+    { simde_mm256_set_epi32( -442922600,  1549227190, -1769085124,  1106432174,
+                            -1225562306,  1717793531,  2137309229, -1824421163),
+      simde_mm256_set_epi32(          5,           3,           6,           7,
+                                      1,           1,           3,  -597796741),
+      simde_mm256_set_epi32(-1769085124, -1225562306,  1549227190,  -442922600,
+                             2137309229,  2137309229, -1225562306, -1225562306) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_permutevar8x32_epi32(test_vec[i].a, test_vec[i].idx);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_permutevar8x32_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256i idx;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   -13.54f,   -347.02f,      2.96f,   -712.00f,
+                            386.57f,    384.54f,    299.43f,   -564.68f),
+      simde_mm256_set_epi32(          7,           0,           1,           0,
+                               61782912,           5,           5,           7),
+      simde_mm256_set_ps(   -13.54f,   -564.68f,    299.43f,   -564.68f,
+                           -564.68f,      2.96f,      2.96f,    -13.54f) },
+    { simde_mm256_set_ps(   287.67f,    164.37f,    670.88f,    479.48f,
+                           -264.46f,   -350.87f,    652.45f,    413.32f),
+      simde_mm256_set_epi32(          3,           4,           1,           7,
+                                      6,           7,           2,           0),
+      simde_mm256_set_ps(  -264.46f,    479.48f,    652.45f,    287.67f,
+                            164.37f,    287.67f,   -350.87f,    413.32f) },
+    { simde_mm256_set_ps(   -41.29f,   -652.33f,   -468.78f,    130.78f,
+                           -184.93f,    709.82f,    616.94f,   -514.09f),
+      simde_mm256_set_epi32(          6,           4,           5,           2,
+                                      1,  1459078698,           7,           6),
+      simde_mm256_set_ps(  -652.33f,    130.78f,   -468.78f,    709.82f,
+                            616.94f,    709.82f,    -41.29f,   -652.33f) },
+    { simde_mm256_set_ps(   711.25f,    543.64f,    168.83f,   -256.72f,
+                            106.98f,   -250.53f,    959.12f,    414.97f),
+      simde_mm256_set_epi32(          3,           1,           3,           6,
+                                      4,           2,  -181296960,           2),
+      simde_mm256_set_ps(   106.98f,    959.12f,    106.98f,    543.64f,
+                           -256.72f,   -250.53f,    414.97f,   -250.53f) },
+    { simde_mm256_set_ps(   226.52f,   -758.11f,    540.55f,    156.30f,
+                           -965.54f,    467.50f,   -483.48f,    146.75f),
+      simde_mm256_set_epi32(          1,           3,           3,           6,
+                                      0,           0,           3,           0),
+      simde_mm256_set_ps(  -483.48f,   -965.54f,   -965.54f,   -758.11f,
+                            146.75f,    146.75f,   -965.54f,    146.75f) },
+    { simde_mm256_set_ps(   396.40f,    718.85f,    792.82f,   -425.23f,
+                            872.32f,   -175.25f,     22.80f,    308.90f),
+      simde_mm256_set_epi32(          7,           4,           5,           3,
+                                      7,  1684845627,           6,           3),
+      simde_mm256_set_ps(   396.40f,   -425.23f,    792.82f,    872.32f,
+                            396.40f,    872.32f,    718.85f,    872.32f) },
+    { simde_mm256_set_ps(   114.07f,    326.12f,    325.07f,   -369.84f,
+                           -810.29f,    -16.68f,    -49.42f,   -419.70f),
+      simde_mm256_set_epi32(          5,           6,           5,           0,
+                                      7,           1,           4,           3),
+      simde_mm256_set_ps(   325.07f,    326.12f,    325.07f,   -419.70f,
+                            114.07f,    -49.42f,   -369.84f,   -810.29f) },
+    { simde_mm256_set_ps(  -595.50f,   -676.79f,    612.31f,    296.66f,
+                            718.28f,    913.26f,    660.10f,    816.77f),
+      simde_mm256_set_epi32(          2,           4,   933985865,           0,
+                                      7,           4,           4,           4),
+      simde_mm256_set_ps(   913.26f,    296.66f,    660.10f,    816.77f,
+                           -595.50f,    296.66f,    296.66f,    296.66f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_permutevar8x32_ps(test_vec[i].a, test_vec[i].idx);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sad_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(  35,    3,  -41, INT8_MIN,  -98,  -47,  100,  -66,
+                            -10,   26,  -53,   49,  -84,  -60,  -63,  -69,
+                             29,  116,  -42,   81,   19,  101,   20,   24,
+                             20,  -14, -105,   86,  -64,   69, -114,  110),
+      simde_mm256_set_epi8(  63,   43,  -70,   55,   64,   99,    1,    3,
+                            -54, -106,  -24,  118,   -1,  -75,   85,   -7,
+                             49,   47,  -76,  100,  -18,  -94,  -38,  123,
+                           -116,  -28, -127,  -80,  114,  -62,  -62,  -26),
+      simde_mm256_set_epi64x(INT64_C(                 660), INT64_C(                 534),
+                             INT64_C(                 719), INT64_C(                 621)) },
+    { simde_mm256_set_epi8(  65,   88,   17,  124,   76, -104,  -10, -106,
+                            -18,   98,  -93,   91,  112,   75,  -26,  119,
+                            -23,   29,  -52,  -50, -126,  127,   11,   11,
+                             74,   47,  -20,   98,   76,   -9,  124,  109),
+      simde_mm256_set_epi8(  -1,   -6,  -37, -100, -106,   -4, -116,  -64,
+                           -117,   25,   24,    9,  114,   35,    8,   -9,
+                            -75,   52,  -90, -108,  -59,  121,   30,   16,
+                             -5,   32,   44,  -67,  -68, -105,   15,   64),
+      simde_mm256_set_epi64x(INT64_C(                 908), INT64_C(                 785),
+                             INT64_C(                 268), INT64_C(                 837)) },
+    { simde_mm256_set_epi8(  39,  120,  127,   75,   39,  -12,  -54,  -30,
+                             10,   52, -121,   72,  -84,  101,   26,  -50,
+                             62,  105,   71,   99,  120,  -90,   56,   39,
+                            125,  -27,  -30,    6,  -71,   94,  -11,  -34),
+      simde_mm256_set_epi8( -59,  -27, -101,  -32,  -35,    0, -102,  102,
+                             99,   95,   36,   26,  -81,   29,    4,   61,
+                           -122,  -53,   30,  -34,   85,  -77,  122,  -62,
+                             37,   47,   23,  105,   58,    4,  112,   26),
+      simde_mm256_set_epi64x(INT64_C(                1042), INT64_C(                 519),
+                             INT64_C(                 603), INT64_C(                1118)) },
+    { simde_mm256_set_epi8( -21,  -12,   23, -107,   90, -110,   83,  -79,
+                             -8,  113, -107, -101,  -60,  -24,  120,  -85,
+                            -17,  103,  -84,  117,  -65, -125,  -38,    1,
+                              1,  -48,   21,  -23,   31,   76,  -83, -113),
+      simde_mm256_set_epi8( 120,   -7,  -64,   25,   19,  -69,    2,  124,
+                              6,  -71,  -11,   66,   52,  -37,  -61, -123,
+                            -72,   32,  -42,   58,   34,  121, -104,   87,
+                           -124,    9,  113,    9,   28,  108,   60,   58),
+      simde_mm256_set_epi64x(INT64_C(                 659), INT64_C(                 769),
+                             INT64_C(                 546), INT64_C(                 879)) },
+    { simde_mm256_set_epi8( -20, -115,   81,  118, -120,  -85,   88,  -94,
+                           -115, -109,  -29,    6,  -68,   11,  -73,  -37,
+                            109,   60,  -35,   76,  -34,    4,    4,  -70,
+                             -2,  -13,   52,  124, -124, -125, -124,  -43),
+      simde_mm256_set_epi8(  68,   96,   25,  -58,  -77,   73, -114,  -25,
+                             46,  -51,  -71, -109,   69,   59,  -47,  -63,
+                              0,   46,   25, -121,   56,  -90,  -14,   35,
+                             48,   40,   84,  119,  107,  -63,   26,  -19),
+      simde_mm256_set_epi64x(INT64_C(                 613), INT64_C(                 555),
+                             INT64_C(                1095), INT64_C(                 663)) },
+    { simde_mm256_set_epi8( -98,  -17,    8,  -28,  -44,  -71,   41,   32,
+                             74,  -90,    1,   85, -115,   77,  -37,  -72,
+                            -37,    7,   12,  -86,  -67,    0,  -29,   -5,
+                             44,  -13,  112,   35,  -51,   57,  -29,   67),
+      simde_mm256_set_epi8( -79,  -71,  -66,  -23,   87,  -92,   82,   72,
+                            127,   64,   94,   49,   -8,   -2,   92,   26,
+                             60,   30,   34,   28,  -52,  111,  -53,  113,
+                             81,   83,  -90,   84,  -35, -110, -115,   34),
+      simde_mm256_set_epi64x(INT64_C(                 487), INT64_C(                 853),
+                             INT64_C(                 634), INT64_C(                 524)) },
+    { simde_mm256_set_epi8(  -1, -113,   50,  -74,   85,   69,   21,   29,
+                            -35,   98,   76,  109,  -63,  -33,  -78,   26,
+                             84,  -17,  -44,  -90,  -93, -105,  -32,  -94,
+                             21,   -3,  123, -103, -126,  -55,   -6,  -25),
+      simde_mm256_set_epi8(-101,  -70, -109,  -81,  -18,  112,  -87,  -10,
+                            -82,  -90,   87, -102,   99,   49,   -5,  -24,
+                             26,   41, -121, -109,   72,  -20,  -81,  105,
+                             33,   -7, -109, -122, -120,   28,  -10,  -37),
+      simde_mm256_set_epi64x(INT64_C(                 808), INT64_C(                 718),
+                             INT64_C(                 634), INT64_C(                 254)) },
+    { simde_mm256_set_epi8(  -5,   14,  116,   35,   -9,   19, -106,   91,
+                            -41,  -62,   70,   10,  -44,   -4,  -41, -122,
+                            -99,  -13,  -95,   73,   98,  -52,   52,  126,
+                            -61,   24,  -12,  117,   60,  -64,   53,   70),
+      simde_mm256_set_epi8( 119, -113,  -57,   33,  -55,   88, -112, -120,
+                            -30,  -39,   33,   43,  -37,  -48,   26,   64,
+                             96,  -61,  -69,  109,    8,   59,  -34,   49,
+                             61,  -57, -108, -124,  126,   40,   85,   34),
+      simde_mm256_set_epi64x(INT64_C(                 512), INT64_C(                 414),
+                             INT64_C(                 653), INT64_C(                 706)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sad_epu8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_shuffle_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -41,   85, -102,  115, -118,   62, -100,  102,
+                             -2,  -16,   67,   66, -100,   46,  -22,   57,
+                              6,  -91,   78,   96,   55,   10,   30,   60,
+                            -10,   36, -110,  -83,  -20,   50,    4, -109),
+      simde_mm256_set_epi8( -13,  -63,  -94,  -91,   15,  104,   20,  -93,
+                            -22,   -5, -107,  -96,  -45,  -29,   69,   28,
+                           -120,    3, -108,  -59,   69,  -46,  117,  124,
+                            -80,    4,  -59,  116,  -39,  -25,   55,   12),
+      simde_mm256_set_epi8(   0,    0,    0,    0,  -41,  102,   66,    0,
+                              0,    0,    0,    0,    0,    0,   67,  115,
+                              0,  -20,    0,    0, -110,    0, -110,   96,
+                              0,  -83,    0,  -83,    0,    0,  -10,   96) },
+    { simde_mm256_set_epi8( -48,   80,  -74,  123,    3,   86,  -78,  114,
+                           -100,   79,  -72,  -27,   46, -106,   95,   93,
+                             27,   51,  -30, -126,   56,  -80,  121,   16,
+                            -49,  -43,  118,  -96,  124,  -71,  -29,   59),
+      simde_mm256_set_epi8(  86,   33,   16,   46,  -24,   21,  119,  -56,
+                             49,    6,   40,   25, -103,    3,   73,   31,
+                             10,  -77, -102,  121,   63, -120, -119,   39,
+                             75, -115, -127,   19,   18, -125,  125,   33),
+      simde_mm256_set_epi8(  79,   95,   93,   80,    0,  -72, -100,    0,
+                             95,   79,  114,  -78,    0,   46,  -78,  -48,
+                            -80,    0,    0,  121,   27,    0,    0,  -49,
+                             56,    0,    0,  124,  -71,    0,  -30,  -29) },
+    { simde_mm256_set_epi8( 105,   84,  -33,   54,  -85,   46,  -51,  120,
+                           -115,  -72,    4, -103,  -68,  -91, INT8_MIN,  110,
+                            -51,   91,   47,  -73,  -36,  -47, -125,  118,
+                             23,   84,  -70,  -68,   53, -111,  -38,  -59),
+      simde_mm256_set_epi8(  45,  -31,    4,  -37,   -9,  -53,   61,   47,
+                            -56, -121,  -93,  -19, -101,  -35,   40,  -15,
+                            118,  123,  127,   64,   57,  -75,  111,   70,
+                             30,   -7,  106,   25,   16,   64,  -12,   -4),
+      simde_mm256_set_epi8( -33,    0, -103,    0,    0,    0,  -33,  105,
+                              0,    0,    0,    0,    0,    0,  120,    0,
+                             84,  -36,  -51,  -59, -125,    0,  -51,   84,
+                             91,    0,  -47, -125,  -59,  -59,    0,    0) },
+    { simde_mm256_set_epi8( 127,   90,  -91,   40,  -29,  -45,   18,   71,
+                            -88,  -94,  -39,   17,   33,   24,  -18,  123,
+                            -74,   68, -123,   93,  -49,  -40,   80,   23,
+                           INT8_MIN,  -89,   15,  100,  -71,  -86,  -85,  -87),
+      simde_mm256_set_epi8(  38,  -73,   55,   29,  124,  -97,   37,  -57,
+                             35,  103,  113,   76,  124,  -62, -111,  -37,
+                            120,   62,  -83,   33,   20, -117,    6,  -55,
+                            112,  -78,   43,  -61,   83,  -28,   93,  -50),
+      simde_mm256_set_epi8( -94,    0,  -88,  -91,   40,    0,  -39,    0,
+                             33,  -88,  -18,   40,   40,    0,    0,    0,
+                             23,   68,    0,  -85,  100,    0,  -89,    0,
+                            -87,    0,  -49,    0,  -71,    0, -123,    0) },
+    { simde_mm256_set_epi8( -79,   61,   38,    6, -100, -126,   12,  -92,
+                             86,   17,   18,  124,  104,   -2,  -23,  108,
+                             33, -121,  -87,   28,   56,   35,  -98, -117,
+                              3,  -29,   42,   15,  -95,    7,  -36,   66),
+      simde_mm256_set_epi8( -71,  -22,   16,   60,  119,  -47, -107,   -3,
+                             31, -120,   70,   99,    2, -118,   68,    2,
+                             71,   14,  -31,  -23,   92,   42,   52,   65,
+                             38,   52,   61,  -36,  -82,   54,   98,  -43),
+      simde_mm256_set_epi8(   0,    0,  108,    6,   86,    0,    0,    0,
+                            -79,    0,   17,  104,   -2,    0,  124,   -2,
+                              3, -121,    0,    0,   28,   35,   15,  -36,
+                            -29,   15,  -87,    0,    0,  -29,    7,    0) },
+    { simde_mm256_set_epi8(  77,    6,   11, -106,   -6, -103,  107,   72,
+                            -61,   89,   34, -123,   14,   27,  -12,   12,
+                            -59,   55,  -98,    0,   59,  -86,  -26,   88,
+                            -53,   93,   52,   74,  -88,  -84,   43,  101),
+      simde_mm256_set_epi8(  24,  -95,  -87,  101,  111, -117,   44,  -66,
+                            -98,   48,  127,   78,  121,   37,   -1, -101,
+                            -25,   27,  -23,  -44,  -54,  -37,   13,  -17,
+                             64,  -45,   79,  -63,   78,  106,   13,  113),
+      simde_mm256_set_epi8(  72,    0,    0,   34,   77,    0, -106,    0,
+                              0,   12,   77,    6,  107,   34,    0,    0,
+                              0,   59,    0,    0,    0,    0,  -98,    0,
+                            101,    0,  -59,    0,   55,  -86,  -98,   43) },
+    { simde_mm256_set_epi8( 107,   56,  -33,  -52, -127,  -38, -104,   27,
+                            -37,   60, -121,  -91,   52,  -92,   54,   13,
+                           -115,   -4,  -22,  110,  -12,   82,  -18,  -45,
+                            -31,  -12,  -31,  -78,  -52, -125, -123,   19),
+      simde_mm256_set_epi8(  33, -126,   -1,  -78,  -59,  -98,   35,  107,
+                            -33,   86,  -47,   38,   20,   53,   61,    2,
+                            -23,   73,  118,   45,   47,  -86,  -49, -118,
+                            101,  117,   62,  -76,  127, -118,  -85,   34),
+      simde_mm256_set_epi8(  54,    0,    0,    0,    0,    0,   52, -127,
+                              0,   60,    0,   60,  -91, -121,  -33,  -92,
+                              0,  -18,  -12,  -22, -115,    0,    0,    0,
+                            -31,  -31,   -4,    0, -115,    0,    0, -125) },
+    { simde_mm256_set_epi8( -43,   52,  -60,   19, INT8_MIN, -103,   46,   74,
+                            -60,  -89,  -35,   92,   25, INT8_MIN, -110,   11,
+                            119,   45,   82,   -4,   98,  117,  -98,   38,
+                             73,  -48,   53,   31,   34,   13,   69,  -96),
+      simde_mm256_set_epi8( 120,  -50,   34, -105,   90,  110,    7,   63,
+                            -85, -121,  -20,  120,  116,   99,   17,   91,
+                             81,   85,  106,  -93,  110, -108,   65,   62,
+                             -7, -117, -106,   32,  -80,  -93,   38,   99),
+      simde_mm256_set_epi8(  74,    0, INT8_MIN,    0, -103,   52,  -60,  -43,
+                              0,    0,    0,   74,   92,   25, -110, INT8_MIN,
+                             69,   53,  117,    0,   45,    0,   69,   45,
+                              0,    0,    0,  -96,    0,    0,  -48,   34) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_shuffle_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sllv_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1702744845,  1836130525, -1041390299,  1850232665,
+                            -1962416316,  -101000315, -1274339198,  1753821881),
+      simde_mm256_set_epi32(         14,          31,          33,           1,
+                                     19,          16,          33,          11),
+      simde_mm256_set_epi32(-1958952960,   INT32_MIN,           0,  -594501966,
+                              975175680,  -612040704,           0,  1234552832) },
+    { simde_mm256_set_epi32(  -43771082, -1729388632,  -802716805,  -904077580,
+                             -784918140, -1577824501, -1437125943,  -518001600),
+      simde_mm256_set_epi32(          9,          32,          28,          18,
+                                     18,          35,          18,          38),
+      simde_mm256_set_epi32( -935957504,           0, -1342177280,  2077229056,
+                             1712324608,           0,  -886833152,           0) },
+    { simde_mm256_set_epi32( -449944527,  -617845047,  1056799123,  -660117517,
+                             -357961525, -2094080503,  1547587514, -1242541241),
+      simde_mm256_set_epi32(         25,          28,          19,          32,
+                                      1,          39,          20,          36),
+      simde_mm256_set_epi32( 1644167168, -1879048192,  -862453760,           0,
+                             -715923050,           0,   -73400320,           0) },
+    { simde_mm256_set_epi32(    7211343,  -211647813,  -947846742,   798840659,
+                             -660757099,   649910545,  1796610639, -2010609889),
+      simde_mm256_set_epi32(         27,           4,          26,           8,
+                                      6,          31,          35,          29),
+      simde_mm256_set_epi32( 2013265920,   908602288, -1476395008, -1655221504,
+                              661218624,   INT32_MIN,           0,  -536870912) },
+    { simde_mm256_set_epi32(-1162800652,  -547819457,  1443689341,  1356545760,
+                             1679173409,   767496988,    98876069,  -486629395),
+      simde_mm256_set_epi32(          2,           7,          31,          33,
+                                     18,          34,          39,           8),
+      simde_mm256_set_epi32( -356235312, -1401413760,   INT32_MIN,           0,
+                            -1669070848,           0,           0,   -23073536) },
+    { simde_mm256_set_epi32( -856269884, -2104388432,   686200209,  -683435573,
+                            -1898876437,    12117664,  -841782445,    15233498),
+      simde_mm256_set_epi32(         37,          39,          16,          13,
+                                     16,          15,          38,           4),
+      simde_mm256_set_epi32(          0,           0, -1785659392,  1933139968,
+                             1911226368,  1934622720,           0,   243735968) },
+    { simde_mm256_set_epi32( -623852754, -1613151814,  -961612415, -1771397336,
+                             -242964327,  1496869133,  -396837171,  -547737288),
+      simde_mm256_set_epi32(         21,          31,          27,          19,
+                                     34,          36,           9,          22),
+      simde_mm256_set_epi32( 1707081728,           0,   134217728,  -113246208,
+                                      0,           0, -1317168640,  1308622848) },
+    { simde_mm256_set_epi32( 2146915585,   709653412, -1485490400,  1019284567,
+                             1139999951,  1605000601,   816408651,  -404898397),
+      simde_mm256_set_epi32(         27,           1,          33,          26,
+                                      6,          34,          25,  -207350834),
+      simde_mm256_set_epi32(  134217728,  1419306824,           0,  1543503872,
+                              -54447168,           0, -1778384896,           0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sllv_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sllv_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 3276114968258164921), INT64_C(    -370588835499611),
+                             INT64_C( 6710822807719183051), INT64_C( 1132994046595047085)),
+      simde_mm256_set_epi64x(INT64_C(                  44), INT64_C(                   7),
+                             INT64_C(                  34), INT64_C(                  58)),
+      simde_mm256_set_epi64x(INT64_C(-2050386875662729216), INT64_C(  -47435370943950208),
+                             INT64_C( 1352218071724457984), INT64_C(-5476377146882523136)) },
+    { simde_mm256_set_epi64x(INT64_C(-7063864345453087202), INT64_C(-3134774227055554561),
+                             INT64_C( 6560161392379352394), INT64_C(-2087362416307545154)),
+      simde_mm256_set_epi64x(INT64_C(                  60), INT64_C(                  70),
+                             INT64_C(                  46), INT64_C(                   3)),
+      simde_mm256_set_epi64x(INT64_C(-2305843009213693952), INT64_C(                   0),
+                             INT64_C( 3842274169588809728), INT64_C( 1747844743249190384)) },
+    { simde_mm256_set_epi64x(INT64_C(-8348444033524846647), INT64_C(-6685863517920343865),
+                             INT64_C( 8693145805617745236), INT64_C(-1439374975783520027)),
+      simde_mm256_set_epi64x(INT64_C(                  50), INT64_C(                  24),
+                             INT64_C(                  61), INT64_C(                  42)),
+      simde_mm256_set_epi64x(INT64_C(-4673610513303732224), INT64_C(-8233251607861526528),
+                             INT64_MIN, INT64_C( 6405125822771888128)) },
+    { simde_mm256_set_epi64x(INT64_C( 8141858991163948841), INT64_C( -520308618775358296),
+                             INT64_C( 6332912106680377148), INT64_C(-5457863664389491350)),
+      simde_mm256_set_epi64x(INT64_C(                  57), INT64_C(                  69),
+                             INT64_C(                  28), INT64_C(                  54)),
+      simde_mm256_set_epi64x(INT64_C( 5908722711110090752), INT64_C(                   0),
+                             INT64_C( 2307890247251263488), INT64_C( 6521212260432478208)) },
+    { simde_mm256_set_epi64x(INT64_C(-4800323206645672271), INT64_C(-5677524926964758602),
+                             INT64_C(-5173786707080590496), INT64_C( 7143165780760015688)),
+      simde_mm256_set_epi64x(INT64_C(                  50), INT64_C(                  28),
+                             INT64_C(                  30), INT64_C(                  50)),
+      simde_mm256_set_epi64x(INT64_C( 6540352558848802816), INT64_C(-8192768471923163136),
+                             INT64_C(-5245371025197105152), INT64_C(-3665930096679583744)) },
+    { simde_mm256_set_epi64x(INT64_C(-4116337271921152801), INT64_C(-7340302282511664757),
+                             INT64_C(-6516966429473242801), INT64_C(  771071141492232527)),
+      simde_mm256_set_epi64x(INT64_C(                  41), INT64_C(                  38),
+                             INT64_C(                  21), INT64_C(                  28)),
+      simde_mm256_set_epi64x(INT64_C(-2244554032058204160), INT64_C(-5057996754717245440),
+                             INT64_C(-5624499779261169664), INT64_C(-2102282635056250880)) },
+    { simde_mm256_set_epi64x(INT64_C(-8839401867219725616), INT64_C( 5857476847129243770),
+                             INT64_C( 1483627713489077053), INT64_C( 1059736758686629891)),
+      simde_mm256_set_epi64x(INT64_C(                  23), INT64_C(                  36),
+                             INT64_C(                  57), INT64_C(                  25)),
+      simde_mm256_set_epi64x(INT64_C( 7700795588022894592), INT64_C( 1399220493004832768),
+                             INT64_C( 8791026472627208192), INT64_C(-1206435285185855488)) },
+    { simde_mm256_set_epi64x(INT64_C( 6287230239399680168), INT64_C( 6179597534942410424),
+                             INT64_C(  333596663075571681), INT64_C( 8307567900524849480)),
+      simde_mm256_set_epi64x(INT64_C(                  53), INT64_C(                  55),
+                             INT64_C(                  65), INT64_C(                  33)),
+      simde_mm256_set_epi64x(INT64_C( 1513209474796486656), INT64_C( 6629298651489370112),
+                             INT64_C(                   0), INT64_C( -832793677658062848)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sllv_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_srav_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( -493278298,   608993017,   646855609,  1302982837,
+                            -1446118849,   268712433,  1658182029,  -853835868),
+      simde_mm256_set_epi32(          2,           1,           4,          39,
+                                     30,          17,           6,          25),
+      simde_mm256_set_epi32( -123319575,   304496508,    40428475,           0,
+                                     -2,        2050,    25909094,         -26) },
+    { simde_mm256_set_epi32( 1719426792,   593768869,  -996876926,  1510389436,
+                              891091226,  -566941345, -1373700898,   385746802),
+      simde_mm256_set_epi32(         15,          16,          14,          39,
+                                     29,          24,          37,           0),
+      simde_mm256_set_epi32(      52472,        9060,      -60845,           0,
+                                      1,         -34,          -1,   385746802) },
+    { simde_mm256_set_epi32(  509693453,  1115153798,  2147297876,   663538619,
+                              328798540, -2104451489,  -549316962, -1883894952),
+      simde_mm256_set_epi32(         30,          29,           7,          30,
+                                     26,           0,          35,          31),
+      simde_mm256_set_epi32(          0,           2,    16775764,           0,
+                                      4, -2104451489,          -1,          -1) },
+    { simde_mm256_set_epi32(  140839026,   948540664, -1996217447,  1537469047,
+                            -1404539393,    68834151,   164941898,  1810005740),
+      simde_mm256_set_epi32(         27,          38,           1,          16,
+                                     21,           1,          10,           7),
+      simde_mm256_set_epi32(          1,           0,  -998108724,       23459,
+                                   -670,    34417075,      161076,    14140669) },
+    { simde_mm256_set_epi32( -277206479, -1731144244,   -99452594,  1720547020,
+                               74390779,  1115660802, -1079949429, -1305674373),
+      simde_mm256_set_epi32(         37,          10,          32,          38,
+                                     24,          16,   576471079,          18),
+      simde_mm256_set_epi32(         -1,    -1690571,          -1,           0,
+                                      4,       17023,          -1,       -4981) },
+    { simde_mm256_set_epi32( 1288910735, -1638792002,  2058664848,  1318247749,
+                             1033857906,   590640338,  -977040768,  -950629272),
+      simde_mm256_set_epi32(         37,           1,          27,          20,
+                                     10,          30,          10,           9),
+      simde_mm256_set_epi32(          0,  -819396001,          15,        1257,
+                                1009626,           0,     -954142,    -1856698) },
+    { simde_mm256_set_epi32(  991880782,  1975948855,  -993414315, -1862241373,
+                            -1362786653,  -815442298, -2123345486,  1610989584),
+      simde_mm256_set_epi32(          0,           0,           0,           8,
+                                     10,          37,          18,          35),
+      simde_mm256_set_epi32(  991880782,  1975948855,  -993414315,    -7274381,
+                               -1330847,          -1,       -8100,           0) },
+    { simde_mm256_set_epi32( 1179880441,  1198818883, -1615488145,  -494650442,
+                             2094751203,   831737913, -1765330884,  1400979862),
+      simde_mm256_set_epi32( 1223952679,           1,           3,          19,
+                                     14,          27,          26,          21),
+      simde_mm256_set_epi32(          0,   599409441,  -201936019,        -944,
+                                 127853,           6,         -27,         668) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srav_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_srlv_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(  133076749,   685482355,  -171945551,  1278729031,
+                            -1745120659, -1734199671,   345583875,   633199534),
+      simde_mm256_set_epi32(         31,          22,          17,          24,
+                                     28,          24,          15,          16),
+      simde_mm256_set_epi32(          0,         163,       31456,          76,
+                                      9,         152,       10546,        9661) },
+    { simde_mm256_set_epi32( 1786055300,  -838248677,  2056545814,   139935924,
+                            -1624923852,  2004328801,  -162973167,  -386921804),
+      simde_mm256_set_epi32(         29,          15,          24,           9,
+                                     39,           0,          21,          35),
+      simde_mm256_set_epi32(          3,      105490,         122,      273312,
+                                      0,  2004328801,        1970,           0) },
+    { simde_mm256_set_epi32(  392855592,  1044627657,   445598146,  -185583296,
+                             1262253419,  1776194398, -1287335264,  -327585249),
+      simde_mm256_set_epi32(         32,          11,          33,          18,
+                                      3,          18,          14,          38),
+      simde_mm256_set_epi32(          0,      510072,           0,       15676,
+                              157781677,        6775,      183571,           0) },
+    { simde_mm256_set_epi32( 1224690541,     4181941,  -988864211,  1624310372,
+                            -1793044721, -1415380629,  -345357452,   281540544),
+      simde_mm256_set_epi32(         10,          37,   382209957,          37,
+                                     27,          29,          12,           1),
+      simde_mm256_set_epi32(    1195986,           0,           0,           0,
+                                     18,           5,      964260,   140770272) },
+    { simde_mm256_set_epi32( 1972738600, -1843926985,  1509978385,  1397943826,
+                             -755432252,  1995217700,  -414461352,  1462997378),
+      simde_mm256_set_epi32(         31,           2,          29,           1,
+                                     38,           9,          21,          34),
+      simde_mm256_set_epi32(          0,   612760077,           2,   698971913,
+                                      0,     3896909,        1850,           0) },
+    { simde_mm256_set_epi32(  897531236, -2090975950,  1458207372,  1545478371,
+                              832915712,   383623390, -1864495716,  -181508860),
+      simde_mm256_set_epi32(         22,           9,          30,          26,
+                                     34,          10,          26,          26),
+      simde_mm256_set_epi32(        213,     4304670,           1,          23,
+                                      0,      374632,          36,          61) },
+    { simde_mm256_set_epi32( -771479570,   997920883, -1592974151,  -718866839,
+                              275393955,   231439663, -1365975661,  1797268308),
+      simde_mm256_set_epi32(         18,           9,           1,           0,
+                                      3,          16,          33,  1069701922),
+      simde_mm256_set_epi32(      13441,     1949064,  1350996572,  -718866839,
+                               34424244,        3531,           0,           0) },
+    { simde_mm256_set_epi32( 1313940687,  -582908374, -1301838716, -1072455570,
+                              772767703,   442589623, -1999635708, -1821723537),
+      simde_mm256_set_epi32(         28,          25,          38,          38,
+                                      0,           0,           8,           0),
+      simde_mm256_set_epi32(          4,         110,           0,           0,
+                              772767703,   442589623,     8966139, -1821723537) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srlv_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_srlv_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( -476175336160393359), INT64_C( 6691058934250620939),
+                             INT64_C(-6064507600890811645), INT64_C(-7245693767147201009)),
+      simde_mm256_set_epi64x(INT64_C(                  59), INT64_C(                  54),
+                             INT64_C(                   2), INT64_C(                  37)),
+      simde_mm256_set_epi64x(INT64_C(                  31), INT64_C(                 371),
+                             INT64_C( 3095559118204684992), INT64_C(            81498367)) },
+    { simde_mm256_set_epi64x(INT64_C(-4522812407017527950), INT64_C(-5394909376511696088),
+                             INT64_C( 8152485861013651045), INT64_C( 1958596061267842559)),
+      simde_mm256_set_epi64x(INT64_C(                  13), INT64_C(                  32),
+                             INT64_C(                  14), INT64_C(                  58)),
+      simde_mm256_set_epi64x(INT64_C(    1699698689781741), INT64_C(          3038867073),
+                             INT64_C(     497588248352883), INT64_C(                   6)) },
+    { simde_mm256_set_epi64x(INT64_C(-2669864646284414868), INT64_C( 3622766863123083971),
+                             INT64_C(-5047660810357633012), INT64_C(-7419523585279137365)),
+      simde_mm256_set_epi64x(INT64_C(                   7), INT64_C(                  47),
+                             INT64_C(                  46), INT64_C( 3941300833661831582)),
+      simde_mm256_set_epi64x(INT64_C(  123256870526758880), INT64_C(               25741),
+                             INT64_C(              190412), INT64_C(                   0)) },
+    { simde_mm256_set_epi64x(INT64_C( -939839497667037839), INT64_C( 7812635673920807315),
+                             INT64_C(-6013173679638338681), INT64_C( 7075527556008000549)),
+      simde_mm256_set_epi64x(INT64_C(                   1), INT64_C(                  43),
+                             INT64_C(                  61), INT64_C(                  31)),
+      simde_mm256_set_epi64x(INT64_C( 8753452288021256888), INT64_C(              888193),
+                             INT64_C(                   5), INT64_C(          3294799270)) },
+    { simde_mm256_set_epi64x(INT64_C(-6839031260322107190), INT64_C( -689430155278790388),
+                             INT64_C(-1710689457003492940), INT64_C(-7673699112969637748)),
+      simde_mm256_set_epi64x(INT64_C(                   2), INT64_C(                   8),
+                             INT64_C(                  60), INT64_C(                   7)),
+      simde_mm256_set_epi64x(INT64_C( 2901928203346861106), INT64_C(   69364507493870161),
+                             INT64_C(                  14), INT64_C(   84164413755780577)) },
+    { simde_mm256_set_epi64x(INT64_C(  778998733284546494), INT64_C(  783470551603707810),
+                             INT64_C( 3507712262881302888), INT64_C( 6082723295856156968)),
+      simde_mm256_set_epi64x(INT64_C(                  68), INT64_C(                   4),
+                             INT64_C(                  17), INT64_C(                  13)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(   48966909475231738),
+                             INT64_C(      26761720755625), INT64_C(     742519933576191)) },
+    { simde_mm256_set_epi64x(INT64_C(-6046178861368593020), INT64_C( 2054786996471494825),
+                             INT64_C( 3387608833811456143), INT64_C( 1841276066997445713)),
+      simde_mm256_set_epi64x(INT64_C(                  68), INT64_C(                  22),
+                             INT64_C(                  25), INT64_C(                  59)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(        489899396055),
+                             INT64_C(        100958610588), INT64_C(                   3)) },
+    { simde_mm256_set_epi64x(INT64_C( 2115358733760636631), INT64_C( 1664474516866907956),
+                             INT64_C(-2771131905117796654), INT64_C( 5338186054180009122)),
+      simde_mm256_set_epi64x(INT64_C(                  59), INT64_C(                  20),
+                             INT64_C(                  61), INT64_C(                   8)),
+      simde_mm256_set_epi64x(INT64_C(                   3), INT64_C(       1587366597048),
+                             INT64_C(                   6), INT64_C(   20852289274140660)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srlv_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sub_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(  8412, -17012,  23841,   2299,  -3262,   5691,  27520,  12529,
+                             26064,  31227, -13846,   8424,  18036,   1774,  -6426, -26801),
+      simde_mm256_set_epi16( 26119,  15466,   3619,  15655,  19344,  26062,  -2783,  20653,
+                             -2191,  19240, -32159,  -3638,    799,   1996, -12350,  10707),
+      simde_mm256_set_epi16(-17707, -32478,  20222, -13356, -22606, -20371,  30303,  -8124,
+                             28255,  11987,  18313,  12062,  17237,   -222,   5924,  28028) },
+    { simde_mm256_set_epi16(-11200,   4323,   6792, -18604, -10399, -22236,     11,  11257,
+                             -5425,  -4589,   1305,  20921,  23589,  27277,   2281, -11955),
+      simde_mm256_set_epi16( 23973,  16225,  27190,  18279,  27459,  17434,   7727,  -9962,
+                            -24549,  -4944, -22122,  24270, -23504,  28401,  13878, -24871),
+      simde_mm256_set_epi16( 30363, -11902, -20398,  28653,  27678,  25866,  -7716,  21219,
+                             19124,    355,  23427,  -3349, -18443,  -1124, -11597,  12916) },
+    { simde_mm256_set_epi16( -5000,  16390, -30252,   3322,  31813, -15383,  -8581,  -2339,
+                            -10809, -21056, -12353, -27918,  14968,   5618, -30974,  10722),
+      simde_mm256_set_epi16( 25887, -24990, -11849,  11014,  22499, -28080, -31358,  16880,
+                             10675,  27263,   -680,  21838,  15630,  28900,  27717,    652),
+      simde_mm256_set_epi16(-30887, -24156, -18403,  -7692,   9314,  12697,  22777, -19219,
+                            -21484,  17217, -11673,  15780,   -662, -23282,   6845,  10070) },
+    { simde_mm256_set_epi16( -6353,  -1072,  -1957, -21095, -19453,  11494,   6294,  -1281,
+                             21713, -32530, -28676, -18872,    143,  23969, -26229,  13733),
+      simde_mm256_set_epi16(-14980,   3877, -29406,  -8005,  12681,  23331,  11499,  15825,
+                             -9939,  -1802,   9312,  15177,  28518, -29267,  32064, -20637),
+      simde_mm256_set_epi16(  8627,  -4949,  27449, -13090, -32134, -11837,  -5205, -17106,
+                             31652, -30728,  27548,  31487, -28375, -12300,   7243, -31166) },
+    { simde_mm256_set_epi16( 12784,  11584, -22888,  -5322,  10640, -31743,  -6681, -18056,
+                             22552, -29200, -25915,   -182,  24442, -31983, -10244, -20143),
+      simde_mm256_set_epi16(  5795,   2977, -22953,  17575,   2199,   3435,  -3151,    628,
+                            -11167, -18239,  -1589,   2580, -19513,  26222,   3409,  32252),
+      simde_mm256_set_epi16(  6989,   8607,     65, -22897,   8441,  30358,  -3530, -18684,
+                            -31817, -10961, -24326,  -2762, -21581,   7331, -13653,  13141) },
+    { simde_mm256_set_epi16( -8669,  12121, -30632,  28337,   4877,  18213,   4203, -21534,
+                             17388, -14515,  24290,  31902,  12801,  25922, -23367,  25332),
+      simde_mm256_set_epi16( 21894,   3900,  -7992,   1384, -25047,  -8934, -25357,  -7929,
+                              -247, -10524,   9168,  20257, -31357, -30443,  26163,  -2285),
+      simde_mm256_set_epi16(-30563,   8221, -22640,  26953,  29924,  27147,  29560, -13605,
+                             17635,  -3991,  15122,  11645, -21378,  -9171,  16006,  27617) },
+    { simde_mm256_set_epi16( -3215,  20377,  10204,   8007, -18431, -19505,   5296, -13752,
+                            -11507, -13877,   2345, -19168, -29294,  -7083,  11273,  -7915),
+      simde_mm256_set_epi16(-26528, -25932,  21523,   7451, -24694,  25371,  -6575,  28967,
+                             18763,   6014,  23356,   5405, -17441,  20270,    532, -26983),
+      simde_mm256_set_epi16( 23313, -19227, -11319,    556,   6263,  20660,  11871,  22817,
+                            -30270, -19891, -21011, -24573, -11853, -27353,  10741,  19068) },
+    { simde_mm256_set_epi16( 13380, -21142, -17132,  -6227,  15163,   -432,  21101, -15124,
+                            -30037,  11779,  10787, -24319, -19604,  24000, -26677,  -1291),
+      simde_mm256_set_epi16( 31781, -18554,  -6430, -13995, -25782, -12192,  15975,  -5821,
+                            -14763, -31658, -24025, -32178,   4089, -22083,    386,  24254),
+      simde_mm256_set_epi16(-18401,  -2588, -10702,   7768, -24591,  11760,   5126,  -9303,
+                            -15274, -22099, -30724,   7859, -23693, -19453, -27063, -25545) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sub_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sub_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(-1240338517, -2069285583,  -948433453,  1197491563,
+                             1526787751,   -85024059, -1348869597,  1594801836),
+      simde_mm256_set_epi32(  931541737, -1266974345,  -181460884,  1405636578,
+                              865211956, -1612666723,   858080428,  1018127500),
+      simde_mm256_set_epi32( 2123087042,  -802311238,  -766972569,  -208145015,
+                              661575795,  1527642664,  2088017271,   576674336) },
+    { simde_mm256_set_epi32(-2053165674,   444599308,  -507486117,  -374898081,
+                            -1627826709,   117991478,  1712381338,  1658004617),
+      simde_mm256_set_epi32( -339165003, -1106257043,  1224311375,  1965649998,
+                            -1835562678,  -779374875,  -651531078,   492505511),
+      simde_mm256_set_epi32(-1714000671,  1550856351, -1731797492,  1954419217,
+                              207735969,   897366353, -1931054880,  1165499106) },
+    { simde_mm256_set_epi32( 2024314032, -1122117927,  1101322337, -1922929193,
+                             -156951370,  -153427769,   -62593168,  2018771983),
+      simde_mm256_set_epi32(  187860488,  1024395059,  1545481568, -1964427312,
+                              785739769,    98150712,  -751216754,  -785223074),
+      simde_mm256_set_epi32( 1836453544, -2146512986,  -444159231,    41498119,
+                             -942691139,  -251578481,   688623586, -1490972239) },
+    { simde_mm256_set_epi32(  433509249, -1100154074, -1549142078,  1693741927,
+                              463518342,  -418787904,   209296564,   432210147),
+      simde_mm256_set_epi32(-2006839340,  -416201731, -1576621045,  -916226065,
+                              798993038,  1577273932,  -326832116,  -168143651),
+      simde_mm256_set_epi32(-1854618707,  -683952343,    27478967, -1684999304,
+                             -335474696, -1996061836,   536128680,   600353798) },
+    { simde_mm256_set_epi32( 2130115776,   373228679,  1377025660,  -699453404,
+                            -1291350629,  1766366708,  1355249674, -1435572493),
+      simde_mm256_set_epi32( 1394910974, -1205595492,    83843760,  -252906937,
+                            -1939573208,  1562603705,  -715536922,  1668369665),
+      simde_mm256_set_epi32(  735204802,  1578824171,  1293181900,  -446546467,
+                              648222579,   203763003,  2070786596,  1191025138) },
+    { simde_mm256_set_epi32(-1617795077,   152005774,  2100070225, -2006801091,
+                             1810159902, -1840960153,   604492214,  1616825767),
+      simde_mm256_set_epi32( 1913437258,  1844178644,   735491453,  1305405754,
+                             -539470764,   840215516,  -456706752, -1874135366),
+      simde_mm256_set_epi32(  763734961, -1692172870,  1364578772,   982760451,
+                            -1945336630,  1613791627,  1061198966,  -804006163) },
+    { simde_mm256_set_epi32( 2078376162,  -762820641,   812072484, -1515535255,
+                             1890177149,  1016148627, -2072361775,    72754145),
+      simde_mm256_set_epi32( 1694944067,  -501586508,  1453872790,  -193250650,
+                             1369957062,   411656512,  -862297276,   694614858),
+      simde_mm256_set_epi32(  383432095,  -261234133,  -641800306, -1322284605,
+                              520220087,   604492115, -1210064499,  -621860713) },
+    { simde_mm256_set_epi32( 1040391015, -1446898771, -1160735254, -1932643851,
+                             -520151531, -1343944693,  -283106819,   716089955),
+      simde_mm256_set_epi32(  584339240, -1702328471, -1738398605,   297765265,
+                            -1575167591,  1168565645,  -707380960,    97495404),
+      simde_mm256_set_epi32(  456051775,   255429700,   577663351,  2064558180,
+                             1055016060,  1782456958,   424274141,   618594551) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sub_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sub_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-5542555430912054031), INT64_C( 1025020125131888158),
+                             INT64_C(-3771899205500672502), INT64_C(-3521502223681912722)),
+      simde_mm256_set_epi64x(INT64_C(  826349835259465238), INT64_C(-6412259420917771867),
+                             INT64_C(-4577876768794026732), INT64_C( -924205637181123318)),
+      simde_mm256_set_epi64x(INT64_C(-6368905266171519269), INT64_C( 7437279546049660025),
+                             INT64_C(  805977563293354230), INT64_C(-2597296586500789404)) },
+    { simde_mm256_set_epi64x(INT64_C( 1598458698160472643), INT64_C(-4458266209581965881),
+                             INT64_C(  405075043825014840), INT64_C(-6288899521526635188)),
+      simde_mm256_set_epi64x(INT64_C( 6059113049841156878), INT64_C( 5462547271062356690),
+                             INT64_C(-4275941688077284653), INT64_C( 8352385415030251629)),
+      simde_mm256_set_epi64x(INT64_C(-4460654351680684235), INT64_C( 8525930593065229045),
+                             INT64_C( 4681016731902299493), INT64_C( 3805459137152664799)) },
+    { simde_mm256_set_epi64x(INT64_C(-7263352933358046698), INT64_C( 6538817680862155652),
+                             INT64_C( 7751221772198978844), INT64_C( 8570531835641788195)),
+      simde_mm256_set_epi64x(INT64_C( 1268449062720893871), INT64_C(-1123163129412289932),
+                             INT64_C(-2149331699550115210), INT64_C( 2404110888574631694)),
+      simde_mm256_set_epi64x(INT64_C(-8531801996078940569), INT64_C( 7661980810274445584),
+                             INT64_C(-8546190601960457562), INT64_C( 6166420947067156501)) },
+    { simde_mm256_set_epi64x(INT64_C( 5664350680765925768), INT64_C(  317419828776000376),
+                             INT64_C( 8586195628083493122), INT64_C( 2416889920189207369)),
+      simde_mm256_set_epi64x(INT64_C(-3476882332490443548), INT64_C(-4636525402979950910),
+                             INT64_C(-8486849087489713562), INT64_C(-4282148948491344578)),
+      simde_mm256_set_epi64x(INT64_C( 9141233013256369316), INT64_C( 4953945231755951286),
+                             INT64_C(-1373699358136344932), INT64_C( 6699038868680551947)) },
+    { simde_mm256_set_epi64x(INT64_C(-1944221500116456059), INT64_C(-7347184482799800477),
+                             INT64_C(-5995338306213260215), INT64_C(-6996391207071030605)),
+      simde_mm256_set_epi64x(INT64_C(-6982492507099466240), INT64_C( 6824942938461626466),
+                             INT64_C( 7711422134059650787), INT64_C( 6785971264658964551)),
+      simde_mm256_set_epi64x(INT64_C( 5038271006983010181), INT64_C( 4274616652448124673),
+                             INT64_C( 4739983633436640614), INT64_C( 4664381601979556460)) },
+    { simde_mm256_set_epi64x(INT64_C( 7263492745011988081), INT64_C( 1999369181248853706),
+                             INT64_C(-1331362451729647981), INT64_C(-4118799365198160924)),
+      simde_mm256_set_epi64x(INT64_C( 4886782064961849739), INT64_C( 5545066648088369624),
+                             INT64_C(-7794252492327387152), INT64_C( 7772215438088722877)),
+      simde_mm256_set_epi64x(INT64_C( 2376710680050138342), INT64_C(-3545697466839515918),
+                             INT64_C( 6462890040597739171), INT64_C( 6555729270422667815)) },
+    { simde_mm256_set_epi64x(INT64_C( 3680607023530357702), INT64_C(-7173008836905130468),
+                             INT64_C( 7858648065532886112), INT64_C( -291642644018790863)),
+      simde_mm256_set_epi64x(INT64_C(  966685504631602540), INT64_C( 4897693194649269405),
+                             INT64_C( 8284260507708581866), INT64_C(-1059999728126512005)),
+      simde_mm256_set_epi64x(INT64_C( 2713921518898755162), INT64_C( 6376042042155151743),
+                             INT64_C( -425612442175695754), INT64_C(  768357084107721142)) },
+    { simde_mm256_set_epi64x(INT64_C( 4016321405248960221), INT64_C( -901021831168464595),
+                             INT64_C(-6312457446291709421), INT64_C( 4899230041171320000)),
+      simde_mm256_set_epi64x(INT64_C(-7976882132815546468), INT64_C(-1700847571445351592),
+                             INT64_C( 3362505759064950293), INT64_C( 5030904557677196369)),
+      simde_mm256_set_epi64x(INT64_C(-6453540535645044927), INT64_C(  799825740276886997),
+                             INT64_C( 8771780868352891902), INT64_C( -131674516505876369)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sub_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sub_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -39,   93,  -24,  -81,   60,   58,   19,  109,
+                            -45,   72,  -64,  -57,  -60,  -51,  -25,   51,
+                             36,  -85,   -6, -124, -122,  120,   59,  -94,
+                             44,  -50,  -78,   97, -112,  -35,    0,  -41),
+      simde_mm256_set_epi8(  39,  -62,  122,  -97,  124,  -52,   50, -126,
+                             22,   -3, -123,  -21,   -5,   32,  -45,  114,
+                            -35,  -29, -123,  -53,  -54,  -32,  -89,  -12,
+                              5,  -72,  100,  -85,   98,   34,  -33,  -52),
+      simde_mm256_set_epi8( -78, -101,  110,   16,  -64,  110,  -31,  -21,
+                            -67,   75,   59,  -36,  -55,  -83,   20,  -63,
+                             71,  -56,  117,  -71,  -68, -104, -108,  -82,
+                             39,   22,   78,  -74,   46,  -69,   33,   11) },
+    { simde_mm256_set_epi8( -22,   81,  -29,  -65,  -56,  -59, -125,   93,
+                            -87,  -44,  127,   -4,  -40,   18,   97,   44,
+                           -107,   75,  -17,   45,  -63,  -20,   47,  101,
+                           -106,   56,  -46,  104,   42,   69,   31,   28),
+      simde_mm256_set_epi8( -47,  115,  103,  -69,   72,  -19,    1,  -33,
+                             36, -112,  125,   59,   42,   33,  -98,  -72,
+                             35,  -41,  124,  -10,  114,  -39,   -9,  -74,
+                            -97,  100,   97,  113,    6, -105,   58,   21),
+      simde_mm256_set_epi8(  25,  -34,  124,    4, INT8_MIN,  -40, -126,  126,
+                           -123,   68,    2,  -63,  -82,  -15,  -61,  116,
+                            114,  116,  115,   55,   79,   19,   56,  -81,
+                             -9,  -44,  113,   -9,   36,  -82,  -27,    7) },
+    { simde_mm256_set_epi8(  14, -121,  -75,   94,  -11,   50,  106,  -53,
+                            -31,   73,   17,   11,  -48,  -77,  -72,   94,
+                            110,  -39,   23,  -69,   89,  100,   94,   57,
+                             49,  -76,   88,   94,  123,  -19,  -44,   69),
+      simde_mm256_set_epi8( -52,  -20,  -65, -116,  115,   77,  -73,  -11,
+                             31,   67,  -16,  -25,   47,  -45,  -53,   51,
+                            -24,  -48,  -46,   83, -106,  -94, -107,  -16,
+                            -93,    2,   86,   42,   29,  -66,  -20,  111),
+      simde_mm256_set_epi8(  66, -101,  -10,  -46, -126,  -27,  -77,  -42,
+                            -62,    6,   33,   36,  -95,  -32,  -19,   43,
+                           -122,    9,   69,  104,  -61,  -62,  -55,   73,
+                           -114,  -78,    2,   52,   94,   47,  -24,  -42) },
+    { simde_mm256_set_epi8( 122,  -55,   36,   84,   -5,   57,  -71,  -97,
+                             99,  -92,  127,  -37,  -38,   90, -115,   64,
+                           -105,  -63,  -62,    7,   21,    2,  115,  -70,
+                            -58,  -83, -109,  111, -110,  121, -127,  -80),
+      simde_mm256_set_epi8(  59,  -67,  -99,  -83,  116,  -43,   53,  108,
+                            -76,  -82,   56, -124,   76,  -88,  126,  -82,
+                              2,  109,   94,    7,   48,  -49,  101,  -90,
+                            -92,  -24,   81, -126,   94,   48,   24,  106),
+      simde_mm256_set_epi8(  63,   12, -121,  -89, -121,  100, -124,   51,
+                            -81,  -10,   71,   87, -114,  -78,   15, -110,
+                           -107,   84,  100,    0,  -27,   51,   14,   20,
+                             34,  -59,   66,  -19,   52,   73,  105,   70) },
+    { simde_mm256_set_epi8( 120,   50,   62,   36,  -26,    8,  -70,  -56,
+                            -23,  -34,   60,  -19, -123,   95, -101,  -20,
+                           -108,   63,   88,   74,   16,  116, -119, -108,
+                             30,  -33,  -78, -100,   16,   39,  -17,  125),
+      simde_mm256_set_epi8( -81,  -98,  -90,  -45,  108,   60, -111,  -45,
+                             -3,  122,   38,   87,   34,  -51,  -16,   79,
+                             85,  111,  -55,  -90,   61,    2, -119,   86,
+                            -46,   80,  -92,  -48,   74,  -91,   22,   -5),
+      simde_mm256_set_epi8( -55, -108, -104,   81,  122,  -52,   41,  -11,
+                            -20,  100,   22, -106,   99, -110,  -85,  -99,
+                             63,  -48, -113,  -92,  -45,  114,    0,   62,
+                             76, -113,   14,  -52,  -58, -126,  -39, -126) },
+    { simde_mm256_set_epi8(  49,  -54,   18,  -81,  127,   83, INT8_MIN,  111,
+                            -34,   60,   38,  -33,   90, -109,   -3,   72,
+                            -71,   16,   35,  113, -103,   26,  105,   13,
+                             62,   10,  -75,  118,    3,  -20,    7,   72),
+      simde_mm256_set_epi8(  82,  -56,  120,   -8,   34, -117,   95,  -43,
+                            -14,  -43,   93,   25,  -50,  -61,   78,   13,
+                            120,  106,   48, -127, -109, -127,   42,  125,
+                             93, -109,  -77,   10,   43,   37,  121,   10),
+      simde_mm256_set_epi8( -33,    2, -102,  -73,   93,  -56,   33, -102,
+                            -20,  103,  -55,  -58, -116,  -48,  -81,   59,
+                             65,  -90,  -13,  -16,    6, -103,   63, -112,
+                            -31,  119,    2,  108,  -40,  -57, -114,   62) },
+    { simde_mm256_set_epi8(-118,   -2,  -59,  -99,   90,   91,  -61,   45,
+                             91,   -6,  -73,  -12,  -48,   46, -118,   34,
+                             98, -119,   99,  104, -113,  -13,   20,  123,
+                           -107,  -86,   85,  -16,  -42,  -66,  -26, -100),
+      simde_mm256_set_epi8(  43,    5,   50,  106,   42,  -67,   14,  105,
+                            -14,  -58,   71,  -83,   81,  -52,   17,  -69,
+                            101,  -22,   50,   27,   76,  -36,   26,  125,
+                              9,   14,  -73,   62,  105,  -29,  -34,   -6),
+      simde_mm256_set_epi8(  95,   -7, -109,   51,   48,  -98,  -75,  -60,
+                            105,   52,  112,   71,  127,   98,  121,  103,
+                             -3,  -97,   49,   77,   67,   23,   -6,   -2,
+                           -116, -100,  -98,  -78,  109,  -37,    8,  -94) },
+    { simde_mm256_set_epi8(-121,  119,   26,   64,  -15,   61,   20,  123,
+                            -48,  -77,  -52, -103, -124, -115,   -4, -125,
+                             50,  -97, -127,   24,   34,  -87,  -57,   96,
+                            -96,  -87,  -91,   19,  -96,  -75,  -20,  107),
+      simde_mm256_set_epi8( -38,  -78,   79, -111,  -77,  -15,  105,   21,
+                             69,  -36,   39,   47,  104, -102,   92, INT8_MIN,
+                            -65,   27, INT8_MIN,  -82,  103,   44,  117,  -64,
+                             25,  127,  -26,  -33,   41,  -53,   -9,   90),
+      simde_mm256_set_epi8( -83,  -59,  -53,  -81,   62,   76,  -85,  102,
+                           -117,  -41,  -91,  106,   28,  -13,  -96,    3,
+                            115, -124,    1,  106,  -69,  125,   82,  -96,
+                           -121,   42,  -65,   52,  119,  -22,  -11,   17) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sub_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_subs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(-14880,   3785, -27155,  25614, -21868,  -2778, -13766, -26909,
+                             21617, -19833,  -3764,  24752,  -9673,  32746,   -447,  31530),
+      simde_mm256_set_epi16(-15858,  18946,  10076,  -7104, -30989, -13570,   5489, -25665,
+                             29104, -17957,  12578,   8218,  23728,  28203, -18575,  12177),
+      simde_mm256_set_epi16(   978, -15161, INT16_MIN,  32718,   9121,  10792, -19255,  -1244,
+                             -7487,  -1876, -16342,  16534, INT16_MIN,   4543,  18128,  19353) },
+    { simde_mm256_set_epi16(  2320,   7775,  14836, -27011, -25610,  23464,   5301, -13311,
+                             13492,  21902,  -4145,   1979,  14346,  32441,   5439,  18082),
+      simde_mm256_set_epi16(-10160,   3093,   8311, -31509,  -3345, -13373,   8008, -28188,
+                             10193, -22973,  31113, -11627,  -5913,  28853,   8466,   3021),
+      simde_mm256_set_epi16( 12480,   4682,   6525,   4498, -22265,  32767,  -2707,  14877,
+                              3299,  32767, INT16_MIN,  13606,  20259,   3588,  -3027,  15061) },
+    { simde_mm256_set_epi16( 12526, -30388, -31777, -22955, -16873,  31361, -31786, -21823,
+                            -19064, -25070, -17176,   2025,  -6953,  -7901,  22907, -14452),
+      simde_mm256_set_epi16(  4839, -17853,   3248,   6068,  29226, -24951,  31731,  26937,
+                            -15927,  19839,  -9039, -11679, -27908,  -5977,  21507,  -8648),
+      simde_mm256_set_epi16(  7687, -12535, INT16_MIN, -29023, INT16_MIN,  32767, INT16_MIN, INT16_MIN,
+                             -3137, INT16_MIN,  -8137,  13704,  20955,  -1924,   1400,  -5804) },
+    { simde_mm256_set_epi16( 30955,  16193,   2112,  24876,  -7746,  20613, -13841,  14971,
+                             -6121,  24426,  14720,  -8168,  10691,   5570,  16801,  -1956),
+      simde_mm256_set_epi16(-19613, -27476, -20192,  26070,  21533, -26979, -18998,  -4950,
+                            -23775, -18463,  -7479,   7811,  32472,  14328,  -4572,  30233),
+      simde_mm256_set_epi16( 32767,  32767,  22304,  -1194, -29279,  32767,   5157,  19921,
+                             17654,  32767,  22199, -15979, -21781,  -8758,  21373, -32189) },
+    { simde_mm256_set_epi16(  6813,  -8302,  15440,  28800,  29283,  17331,   7953,     82,
+                            -11302,   8227,  -1963,  26050, -23266,  26100,  14271, -16392),
+      simde_mm256_set_epi16( 12766,   6533, -23209, -20818, -20532,   4425, -15805, -25562,
+                             15902, -16823, -11491,  -4456,   4436,  12271,  21756,  -9256),
+      simde_mm256_set_epi16( -5953, -14835,  32767,  32767,  32767,  12906,  23758,  25644,
+                            -27204,  25050,   9528,  30506, -27702,  13829,  -7485,  -7136) },
+    { simde_mm256_set_epi16(  5874, -21366, -21436,  22504, -13539,  31784,  19598,  19863,
+                            -31823,  24508,  14460,   3797,  15788,  -6915, -29925, -24025),
+      simde_mm256_set_epi16( -8441,  23994, -17114,  28829,  14378, -21362,  32703,  27109,
+                              4595,  -8194, -11294, -16163,  22287,  -7597,  -4934,  29036),
+      simde_mm256_set_epi16( 14315, INT16_MIN,  -4322,  -6325, -27917,  32767, -13105,  -7246,
+                            INT16_MIN,  32702,  25754,  19960,  -6499,    682, -24991, INT16_MIN) },
+    { simde_mm256_set_epi16(-22951, -22675, -21899,  19426,  16317, -11934,  28671,  -7532,
+                             -3658,  13092, -15610, -19667,  10992, -18258,  -5020,   5969),
+      simde_mm256_set_epi16( 31896,   1069,  -8469,  20009,  32163,   1284,  -9304,    166,
+                             32009,  23500,   7114, -20595,  14277,  19649, -12971, -15682),
+      simde_mm256_set_epi16(INT16_MIN, -23744, -13430,   -583, -15846, -13218,  32767,  -7698,
+                            INT16_MIN, -10408, -22724,    928,  -3285, INT16_MIN,   7951,  21651) },
+    { simde_mm256_set_epi16( -7430,  15875,  26071,  21523, -13253, -26375,   1898,  -5736,
+                              1425,  32290,  -2428,  -7036, -15332,   8157,  -8641, -31813),
+      simde_mm256_set_epi16( 25905,  32703, -21118,  -7066, -15520, -21042,   5803,     79,
+                            -17859,  12545,  10414,  -2001, -19662,  14344,  10307,  20864),
+      simde_mm256_set_epi16(INT16_MIN, -16828,  32767,  28589,   2267,  -5333,  -3905,  -5815,
+                             19284,  19745, -12842,  -5035,   4330,  -6187, -18948, INT16_MIN) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_subs_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_subs_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(  14,  104,   98,    1,   50,   80,  -50,   12,
+                             14,    8,   57,  -33,   46,  123,   26,   61,
+                            -79,   13, -124, -119,  -87,  -14,  -61,  -48,
+                            -73,  -93,  -84,   -6,  -22,  127,   80,  -19),
+      simde_mm256_set_epi8(  49,    9,   69,  115,  -64,  106,    2, -107,
+                             -9,   73,  117,  104,  -71,  -58,  -38,   98,
+                            -45,  -46,  -73,   -5,  -13, -124, -120, -117,
+                            102,   21,   74,   -9,  -90,  -72,  -35,   -2),
+      simde_mm256_set_epi8( -35,   95,   29, -114,  114,  -26,  -52,  119,
+                             23,  -65,  -60, INT8_MIN,  117,  127,   64,  -37,
+                            -34,   59,  -51, -114,  -74,  110,   59,   69,
+                           INT8_MIN, -114, INT8_MIN,    3,   68,  127,  115,  -17) },
+    { simde_mm256_set_epi8( 121,   80, -101,  111,  -51,   69,  -43,   40,
+                            -78,  -25,  -29,  114,   -4,  110,   17,  -91,
+                             96,  -37,  -10,   65,  124,  -45, -127,  -50,
+                            -86,  108, -115,  -81,  -52,   38,   73,  -58),
+      simde_mm256_set_epi8( -57,  -82,  -68, -104,  111,   21, -120,  -38,
+                            -68, -110,  117,  100,  126,   79,  -45, -122,
+                           -106,   59,   58, -121,  -72,  -24,    4,   30,
+                            -97,   23, -123,   69,   17,   82,  -55,  127),
+      simde_mm256_set_epi8( 127,  127,  -33,  127, INT8_MIN,   48,   77,   78,
+                            -10,   85, INT8_MIN,   14, INT8_MIN,   31,   62,   31,
+                            127,  -96,  -68,  127,  127,  -21, INT8_MIN,  -80,
+                             11,   85,    8, INT8_MIN,  -69,  -44,  127, INT8_MIN) },
+    { simde_mm256_set_epi8(  80,  -69,  -62,    1, -121,   31,  -75,   42,
+                             -7, -111,   82,  -99,  109,  -63, -111,  112,
+                             69,    2,   72,    4,    3,   66,   10,   44,
+                              1,   90,   -4,   12,   92,   10,  -54,   22),
+      simde_mm256_set_epi8(-112,  115,   58,  -35,  -34,   22,  -58,  104,
+                            -86,   55,   27,  -83,  -32,  -36,  -42,   68,
+                             61,   86,   17,   69,   -8,   83,  122,    3,
+                             61,  120,   43,  -24,   46,   97,  -36,  -38),
+      simde_mm256_set_epi8( 127, INT8_MIN, -120,   36,  -87,    9,  -17,  -62,
+                             79, INT8_MIN,   55,  -16,  127,  -27,  -69,   44,
+                              8,  -84,   55,  -65,   11,  -17, -112,   41,
+                            -60,  -30,  -47,   36,   46,  -87,  -18,   60) },
+    { simde_mm256_set_epi8(-114,   78,   71,   48,  -19,  120,   28,   36,
+                             95,   18,   46,  -26,  -34,   -6,  111,   52,
+                            -48,  -32, -109, -100,  -29,  -77,   94,  -52,
+                           -120,   47,  -69,  116,  -80,  -90,  -49,   96),
+      simde_mm256_set_epi8( -58,   24,  -98,  117,   82,  110,  -91,   11,
+                            -80,   31, -113,   80,   40,  -87,   20,  123,
+                            114,  -55,  -29,   53,  -78,    6,  -25,    0,
+                            -27,   41,   70,    8,   21,   22,  -59,  -40),
+      simde_mm256_set_epi8( -56,   54,  127,  -69, -101,   10,  119,   25,
+                            127,  -13,  127, -106,  -74,   81,   91,  -71,
+                           INT8_MIN,   23,  -80, INT8_MIN,   49,  -83,  119,  -52,
+                            -93,    6, INT8_MIN,  108, -101, -112,   10,  127) },
+    { simde_mm256_set_epi8( 126, -118,   81,  -97,   -4,  -37,   18, -107,
+                            -44,  126,  -19, -103,   60,   34,   33,  -66,
+                           -119,   65,  -73,  125,   33, -124,   71,   50,
+                            -41, -122,  -76,  -98,  -62,   21,   29,   97),
+      simde_mm256_set_epi8( -76,   15,    7, -113,    0,  -19,  -56,    7,
+                            103,   55,   -5,   34,  104,   38,   78,   72,
+                              5, -105,  -37,   54,  -42,   49,  114,  -10,
+                           INT8_MIN,   59,  -75, -108,  103, -102,  -41,  125),
+      simde_mm256_set_epi8( 127, INT8_MIN,   74,   16,   -4,  -18,   74, -114,
+                           INT8_MIN,   71,  -14, INT8_MIN,  -44,   -4,  -45, INT8_MIN,
+                           -124,  127,  -36,   71,   75, INT8_MIN,  -43,   60,
+                             87, INT8_MIN,   -1,   10, INT8_MIN,  123,   70,  -28) },
+    { simde_mm256_set_epi8( -31,   62,   44,  -65,  -80,   55,  -86,   61,
+                             46,   63,   48,  -44,   60,  -58,   80,   -9,
+                           -105,  -24, -106, -119,   88,   77,  -66, -123,
+                            -89,   73,   -1,  -91,   73,  -48,   49,  -30),
+      simde_mm256_set_epi8(  11,   68, -112,  -92,  -40,  -52, -119,  -13,
+                             56, -113,   16,  -30,  110,   92,  -24,   87,
+                            -11, -118,   11, -100,   51,  -16, -112, INT8_MIN,
+                             77,   -7,  -84, -118,  105, -100,   89,   28),
+      simde_mm256_set_epi8( -42,   -6,  127,   27,  -40,  107,   33,   74,
+                            -10,  127,   32,  -14,  -50, INT8_MIN,  104,  -96,
+                            -94,   94, -117,  -19,   37,   93,   46,    5,
+                           INT8_MIN,   80,   83,   27,  -32,   52,  -40,  -58) },
+    { simde_mm256_set_epi8( 125,   95,  -38,  119,  125,  -21,  102,   -3,
+                            -37,  -51,  -57,   98,  107,  -94,   22,  -62,
+                             68,  -92,  113,  -16,   59,   33,   86,  -39,
+                            -38, -114,   15,  -93,   20,  122,  -39,  -31),
+      simde_mm256_set_epi8( -76,  -47,  125,  -55,  -85,   17,  -23,  -13,
+                             -7,  -13,    9,  -62,  126,   90, -110,  -56,
+                            -28,   12,   32,   59,  -26, -105,  -56,  124,
+                            -76,   -3,  -44,   35,   21,   23,   22,   21),
+      simde_mm256_set_epi8( 127,  127, INT8_MIN,  127,  127,  -38,  125,   10,
+                            -30,  -38,  -66,  127,  -19, INT8_MIN,  127,   -6,
+                             96, -104,   81,  -75,   85,  127,  127, INT8_MIN,
+                             38, -111,   59, INT8_MIN,   -1,   99,  -61,  -52) },
+    { simde_mm256_set_epi8(-103, -120, -103,  121, INT8_MIN,   31,  107,    2,
+                             98,  120,  -49, -126,  -82,   89,   35,  121,
+                             16, INT8_MIN,  -67,  -37,   86,  -67,  -46,    8,
+                            -33,  -75,   81,  -50,  -75,  -19,  114,  -63),
+      simde_mm256_set_epi8(  24,  -82,  -98,   63,   62,  -75,   82,   77,
+                            -21,  111,   40,   64,  -99,   14,  -99,   18,
+                            113,   63,   -7,   20,  -20,   43,  -94,   41,
+                             89,   50,   96,  -69,    1, -113,   47,  -24),
+      simde_mm256_set_epi8(-127,  -38,   -5,   58, INT8_MIN,  106,   25,  -75,
+                            119,    9,  -89, INT8_MIN,   17,   75,  127,  103,
+                            -97, INT8_MIN,  -60,  -57,  106, -110,   48,  -33,
+                           -122, -125,  -15,   19,  -76,   94,   67,  -39) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_subs_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_subs_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(-25255, -22739, -16028, -22109, -19624, -20394, -16542,  -9079,
+                            -16276, -27105,  28701, -20473, -18458, -32275,   9641,  -1712),
+      simde_mm256_set_epi16(  6941,   8139,  20655,    257,   4396,   3578,  22790, -14098,
+                            -23539,  13073,  26383,  14312,  28364,  11704, -21727, -12396),
+      simde_mm256_set_epi16(-32196, -30878,  28853, -22366, -24020, -23972,  26204,   5019,
+                              7263,  25358,   2318,  30751,  18714,  21557,      0,  10684) },
+    { simde_mm256_set_epi16(   816, -19927,   8107,    522,   1245,  -9871, -24233,  31877,
+                            -17057,  -4187, -20340,  -1713, -26760, -16872, -15829,  -8954),
+      simde_mm256_set_epi16( 15876, -26019, -27845,  27125,  14929, -29543, -12733,  28409,
+                             32055,  25307,  -6184, -28775,  21264,  22711, -17957, -26318),
+      simde_mm256_set_epi16(     0,   6092,      0,      0,      0,  19672,      0,   3468,
+                             16424, -29494,      0,  27062,  17512,  25953,   2128,  17364) },
+    { simde_mm256_set_epi16( 11097, -21184,  30425,   3204,  25639, -32271, -18739, -21964,
+                             -3407,  23942,  29463, -32096,   8169, -22653,  22005,  22605),
+      simde_mm256_set_epi16( 20694, -18661,  32246, -27449,  14291,  20466,  22912, -28590,
+                            -24129,  12795,  11278,  21642,      9,  24893,  19651,  -1010),
+      simde_mm256_set_epi16(     0,      0,      0,      0,  11348,  12799,  23885,   6626,
+                             20722,  11147,  18185,  11798,   8160,  17990,   2354,      0) },
+    { simde_mm256_set_epi16(-23656,  -3380,  24739,   2640,  -9040,  30254, -28214,  30835,
+                            -24494,   -985,   2307,  -8399, -31686, -24531,  -5024,  -9261),
+      simde_mm256_set_epi16(  6112, -14207, -24634, -24757,  24683, -27839,   -637,   6276,
+                             30163,  13068,  12127,  19731, -18481,  10167, -19475, -24019),
+      simde_mm256_set_epi16(-29768,  10827,      0,      0,  31813,      0,      0,  24559,
+                             10879, -14053,      0, -28130,      0,  30838,  14451,  14758) },
+    { simde_mm256_set_epi16(-29140,  26129, -22657,  -7628, -26779,  14817,  25180, -12226,
+                            -22001,  18068,  -9356,    608,  27146,   4319, -13853,  11943),
+      simde_mm256_set_epi16(   747,  17146,  26059,  -2823,  -1674,  30748, -11514,  30641,
+                             31886,   -455, -15042, -29240, -15640, -16821, -31142,   5138),
+      simde_mm256_set_epi16(-29887,   8983,  16820,      0,      0,      0,      0,  22669,
+                             11649,      0,   5686,      0,      0,      0,  17289,   6805) },
+    { simde_mm256_set_epi16(-18514,  19756,  17859,  -5032,  -1304,  -4482, -23224, -14218,
+                            -26810,  14902,  -3063,  -8778, -22847, -24745, -29506, -26057),
+      simde_mm256_set_epi16( 22124,  26099,  -8528,  -5925,   2900, -31978,   -605, -21819,
+                            -11328,  25966, -12015,  -3531, -16338, -13368,   5114, -19517),
+      simde_mm256_set_epi16( 24898,      0,      0,    893,  -4204,  27496,      0,   7601,
+                                 0,      0,   8952,      0,      0,      0,  30916,      0) },
+    { simde_mm256_set_epi16( -9117, -31980, -16110,  13137, -12760, -24443, -24976,  22488,
+                             14094, -10124, -16519, -29552, -14521,   9893,   5577,  30186),
+      simde_mm256_set_epi16( -2450,  31740, -23402,  12644,    607, -31674, -20598,    116,
+                            -10182, -18446, -24922,  -4581,  23290,  21873,   9379,  -3739),
+      simde_mm256_set_epi16(     0,   1816,   7292,    493, -13367,   7231,      0,  22372,
+                                 0,   8322,   8403,      0,  27725,      0,      0,      0) },
+    { simde_mm256_set_epi16( -3811,    323,  14406,  18418,  16869,  -3397,  24268,  10792,
+                            -14305,  -8778, -25759,  -1293,  32592, -10784,    -19, -14577),
+      simde_mm256_set_epi16(  5493,  23367,  14074,    267, -21987,    432,  10529,    965,
+                            -20048, -25734,  16487, -27306,  20302, -13049,  19998,  -7848),
+      simde_mm256_set_epi16( -9304,      0,    332,  18151,      0,  -3829,  13739,   9827,
+                              5743,  16956,  23290,  26013,  12290,   2265, -20017,      0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_subs_epu16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_subs_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(  30, -100,    5,   47,  117,  -67,  -22,  -54,
+                            -58,   43,   -6, -126,  -85,  -12,  -12,  -32,
+                            -28,   16,   41,  -32,   67,   92,   26,  125,
+                             21,   22,   79, -119,    7,   36,   73, -119),
+      simde_mm256_set_epi8( 118,  -67,    8,  101, -108,  109,  108,  117,
+                             28,  -65,   48,  -76,  -96,  118,   88,   17,
+                             12,   86,  -69, -118,  -59,  -22,  113,  -79,
+                             23,  -89,   22, -127,    9,    4,   19,  -64),
+      simde_mm256_set_epi8(   0,    0,    0,    0,    0,   80,  126,   85,
+                            -86,    0,  -54,    0,   11,  126, -100,  -49,
+                            -40,    0,    0,   86,    0,    0,    0,    0,
+                              0,    0,   57,    8,    0,   32,   54,    0) },
+    { simde_mm256_set_epi8(   5,   29, -116,   65,   41,  -31,   76,  112,
+                             93,   59,   42,   -3,   62,  -11,  -92,  126,
+                            -56,   13, -104,   47,   47,  -32,  -21, -119,
+                             14,   -5,   10,  -14,   97,  122,  -31,  120),
+      simde_mm256_set_epi8( -99, -127,   96,  -56,  -46,  -35,   -2,  -67,
+                             41, -127,  -12,   64,   -4,  123,    8,   70,
+                            -82,  -52,  -38,  118,    1,   48, -100,    6,
+                            -85,  -37,  -13,   77,   36,  -84,  100,   78),
+      simde_mm256_set_epi8(   0,    0,   44,    0,    0,    4,    0,    0,
+                             52,    0,    0,  -67,    0,  122, -100,   56,
+                             26,    0,    0,    0,   46,  -80,   79, -125,
+                              0,   32,    0,  -91,   61,    0,  125,   42) },
+    { simde_mm256_set_epi8(  76,  112,  -11, -111,  -80,  -67,  -68, -103,
+                            -99, -115,   94,  -30,   54, -111,  108,   76,
+                              0, -121,  -85,  -38,  -88,  -55,  112,  -51,
+                           -114,  -81,  116,  -59,  -10,  -19,  -44,  -97),
+      simde_mm256_set_epi8(  22,  -71, -104,   85,  -55,  120, -114,  -98,
+                            116,  -28, -120,  113,   48, -126,   58,  -45,
+                            104,   45,  -41,  -61,    8,   68,  -59,   -6,
+                           -105,  -63,  -92,   94,  103,   40,   88,  -48),
+      simde_mm256_set_epi8(  54,    0,   93,   60,    0,   69,   46,    0,
+                             41,    0,    0,  113,    6,   15,   50,    0,
+                              0,   90,    0,   23,  -96, -123,    0,    0,
+                              0,    0,    0,  103, -113,  -59,  124,    0) },
+    { simde_mm256_set_epi8( -63,  -57,  -66,   13,  -68,  -59,  -28,   51,
+                            -20,  -88,  -52,   28,  -91,    5,  -17, -122,
+                            -22,   96,  -85,  127,  -52,  -16,   43,   30,
+                             94,  102,   48,  -79,   35,  106,   91,   77),
+      simde_mm256_set_epi8(  25, -117,   88,   49,  127,  -27,   75,   56,
+                             21,   45,  -45,  -20,    1,   15,   -5,   50,
+                            -40,   78,  -40, -120,   48,   33,   33,   96,
+                             72,   96,  -22,  -73,  -64,   80,  120,   46),
+      simde_mm256_set_epi8( -88,   60,  102,    0,   61,    0, -103,    0,
+                            -41,  123,    0,    0,  -92,    0,    0,   84,
+                             18,   18,    0,    0, -100,  -49,   10,    0,
+                             22,    6,    0,    0,    0,   26,    0,   31) },
+    { simde_mm256_set_epi8(  30,   85,   78,   44,   53,   77,   76,   73,
+                             94,  -17,   42,  -50,   15,  -12,   58, INT8_MIN,
+                            -31,  -50, -127,  -84,   -9,  -94,   65,  -67,
+                             76,   12,   97,  -14,  -99,  106,  113,  -78),
+      simde_mm256_set_epi8(-105,  104,   38,   24,   61, -123,   10,    4,
+                             60,   12,  -24,    2,  -16,  122,   51, -104,
+                             84,   44, -117,   39,  -75,    6,  127,   92,
+                             60,   73,   79,  -41,   29, -111,   81,   74),
+      simde_mm256_set_epi8(   0,    0,   40,   20,    0,    0,   66,   69,
+                             34,  -29,    0,  -52,    0,  122,    7,    0,
+                           -115,  -94,    0, -123,   66, -100,    0,   97,
+                             16,    0,   18,   27, INT8_MIN,    0,   32,  104) },
+    { simde_mm256_set_epi8(  63,  -40,  -97,  -96,   40,   42, -122,  -85,
+                            -21,  100,    9, -109,  -94, -106,  105,  -82,
+                             28,   90,  101,   71,   78,   49,   97,  121,
+                             51, -125,  104,  -27,   38,  104,  -20,   59),
+      simde_mm256_set_epi8(  52,   26, -119,  -84,  119,  -65,   20, -127,
+                            110,   73,  111,  -21, -109,   73,  -15,   39,
+                            119,  -38,  -65,  -61,   67,  -19,  121,  127,
+                            -94,   35, -105,   28,  -32,   39,  -76,   61),
+      simde_mm256_set_epi8(  11,  -66,   22,    0,    0,    0,  114,   42,
+                            125,   27,    0,    0,   15,   77,    0, -121,
+                              0,    0,    0,    0,   11,    0,    0,    0,
+                              0,   96,    0,  -55,    0,   65,   56,    0) },
+    { simde_mm256_set_epi8( 115, -125, -104,   69,   18,  123,   94,  -88,
+                            108,   -5,   -1,   83,   54,   74,   -3,    6,
+                           -116,  -20,  -16,  -15,  -54,   55,   49,   -2,
+                            117,   45, -120,  -64,  -10,    4, -114, -114),
+      simde_mm256_set_epi8( -86,   78,  -12,  -22,   86,  -69,  -24,   -4,
+                             21,  -16,  -99,   46, -103,   27,  -90,   -7,
+                             62,  -43,   46,   28, -113,   25,    2,  -42,
+                            -40,  -10,  -51,   15,   58,  -66,  -79,  113),
+      simde_mm256_set_epi8(   0,   53,    0,    0,    0,    0,    0,    0,
+                             87,   11,   98,   37,    0,   47,   87,    0,
+                             78,   23,  -62,  -43,   59,   30,   47,   40,
+                              0,    0,    0,  -79,  -68,    0,    0,   29) },
+    { simde_mm256_set_epi8( -33, -109,   97,   40,    6,   95, -106, -105,
+                            -19,   90,  115,   36,    0,   17,   64,   80,
+                           INT8_MIN,   -3,  -26,  -13,   37,   81,   89,   49,
+                             31,   71, -122,   46,  -60,   57,  -43,   54),
+      simde_mm256_set_epi8( -37,   35,   10,   92,  -79,  122, -118,    7,
+                           -100, -114,  -99,   26,  -21,    9,   97,    9,
+                             -6,  -33,  -61,   52,  -46,  -76,  -52,   96,
+                           -100,    6,  -61,   54,   20,  -56,   17, -108),
+      simde_mm256_set_epi8(   4,  112,   87,    0,    0,    0,   12, -112,
+                             81,    0,    0,   10,    0,    8,    0,   71,
+                              0,   30,   35,  -65,    0,    0,    0,    0,
+                              0,   65,    0,    0,  -80,    0,  -60,    0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_subs_epu8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_unpackhi_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(-25441,  -9825,  -2535, -12497,  -6862, -31666,  21882,  25831,
+                            -21790,   7779,  -1735,  28344, -10550,  12451,  -7598,  21022),
+      simde_mm256_set_epi16(  7536,  21673,  27615, -16210,  13493, -10917, -17428, -20961,
+                             20186,  31807,  22355,  13206, -30778, -18828,   -779,  -8229),
+      simde_mm256_set_epi16(  7536, -25441,  21673,  -9825,  27615,  -2535, -16210, -12497,
+                             20186, -21790,  31807,   7779,  22355,  -1735,  13206,  28344) },
+    { simde_mm256_set_epi16( 21799,  31344,   7424,    942,  24943, -27596,  20835,  25586,
+                             25937, -31327,  15856,  -8181, -17212,   3204,  22261,   7779),
+      simde_mm256_set_epi16(  6133,  -7775,  18153,  18539,  18384,   1216,  -8031, -31075,
+                            -30795,  -7193, -14414,  13678,  27064,  15050, -15507,  20316),
+      simde_mm256_set_epi16(  6133,  21799,  -7775,  31344,  18153,   7424,  18539,    942,
+                            -30795,  25937,  -7193, -31327, -14414,  15856,  13678,  -8181) },
+    { simde_mm256_set_epi16( 14262,  28550,   -370,   -402,    135,  23166,  32581,  -1953,
+                             28633, -32671, -19774,   8712, -26982,  -7000,  -3166, -28724),
+      simde_mm256_set_epi16(-10080,  -7433, -17728, -14141,   9553,  27735, -26147, -19505,
+                             -3479,  28281,  28133, -14780, -23016, -18453,  -5950,   3551),
+      simde_mm256_set_epi16(-10080,  14262,  -7433,  28550, -17728,   -370, -14141,   -402,
+                             -3479,  28633,  28281, -32671,  28133, -19774, -14780,   8712) },
+    { simde_mm256_set_epi16( 13014, -20766,   8509, -29630, -10151, -13462,  29620,  28409,
+                            -14355, -15571,   4926,  28242,  11771,   2688,  11882, -30284),
+      simde_mm256_set_epi16( 31786,   8064,  24169,   5876,  21222,   5183,   -457,  27767,
+                            -17341, -11095,  -3178, -14710, -23291,  11541,   5715, -17238),
+      simde_mm256_set_epi16( 31786,  13014,   8064, -20766,  24169,   8509,   5876, -29630,
+                            -17341, -14355, -11095, -15571,  -3178,   4926, -14710,  28242) },
+    { simde_mm256_set_epi16(  3523,  11372,   3167, -25432,  21717,  -2031,  30194,  17145,
+                             15008,   4562,  20799,   4564,  21030,  -8503,  14014, -10767),
+      simde_mm256_set_epi16(  3038,  -5403,  -9947, -30755,  20984, -18276,    445,  -4629,
+                            -30369, -30745, -18141,   5291,  29346,  28721,  18121,  23862),
+      simde_mm256_set_epi16(  3038,   3523,  -5403,  11372,  -9947,   3167, -30755, -25432,
+                            -30369,  15008, -30745,   4562, -18141,  20799,   5291,   4564) },
+    { simde_mm256_set_epi16(-14633, -24934,  12680,  -7623,  21482,   3270,  16244,  31219,
+                             12917, -31983, -26738,    982,  11303, -27331,  31053, -15030),
+      simde_mm256_set_epi16( -9221, -30524, -18342, -20786,  31503,    -27,  17196, -16779,
+                            -15201,  11038,  12322, -13280,   8909, -16609,  21892,  -5802),
+      simde_mm256_set_epi16( -9221, -14633, -30524, -24934, -18342,  12680, -20786,  -7623,
+                            -15201,  12917,  11038, -31983,  12322, -26738, -13280,    982) },
+    { simde_mm256_set_epi16(-29920, -22726,  18611,  16437,  32715,  -7536,  13585,  12269,
+                             -5108, -11197, -19477, -17181,   5785,   5260,   5076,   8740),
+      simde_mm256_set_epi16(-10040,  10830,  23993, -32133,  24661, -25745, -24969,   2976,
+                             11875,  23302,  -3022, -31987,  10132,  -5304, -29518, -32337),
+      simde_mm256_set_epi16(-10040, -29920,  10830, -22726,  23993,  18611, -32133,  16437,
+                             11875,  -5108,  23302, -11197,  -3022, -19477, -31987, -17181) },
+    { simde_mm256_set_epi16( 26827, -16461, -16601,  11378, -31157,   9842, -30839,  24514,
+                             28646,   6739, -12282, -13289,  10249, -22536, -14851,  -7553),
+      simde_mm256_set_epi16( 14008,  23285,   -734,  10151, -22419,   -437,  -1174, -25594,
+                            -30746,  22357, -14199, -12349,  -1691,  10501, -19556,  23488),
+      simde_mm256_set_epi16( 14008,  26827,  23285, -16461,   -734, -16601,  10151,  11378,
+                            -30746,  28646,  22357,   6739, -14199, -12282, -12349, -13289) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_unpackhi_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_unpackhi_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( 1917895714,   192765686,   375136588,  -749692438,
+                              109896802,   191739974,   299227977,   258099171),
+      simde_mm256_set_epi32(-1633348648, -1684673675, -1165447768,  1659856146,
+                              636189245, -2115209898, -1373319056, -1332843508),
+      simde_mm256_set_epi32(-1633348648,  1917895714, -1684673675,   192765686,
+                              636189245,   109896802, -2115209898,   191739974) },
+    { simde_mm256_set_epi32(  285999692,  -849654666,   675864195,   832198904,
+                               -7779674, -1977211735, -1038037163,   581390211),
+      simde_mm256_set_epi32(  993461696,  1235094235,  1479416862, -1608073392,
+                            -1989874928,  1134840957,  1784767252,    90382010),
+      simde_mm256_set_epi32(  993461696,   285999692,  1235094235,  -849654666,
+                            -1989874928,    -7779674,  1134840957, -1977211735) },
+    { simde_mm256_set_epi32(-1453659956,  -903558037,  1502706258,  -449705784,
+                               44002357,   804335995,   -84134853,     4211531),
+      simde_mm256_set_epi32( 1490292927,   605991700, -1553986420,   104342904,
+                               84146509,   108277105,   395148596, -1480517639),
+      simde_mm256_set_epi32( 1490292927, -1453659956,   605991700,  -903558037,
+                               84146509,    44002357,   108277105,   804335995) },
+    { simde_mm256_set_epi32(  641006333, -1500783151, -1360953646,   361984757,
+                            -1798449925, -1021397206, -1730900669,  1904332575),
+      simde_mm256_set_epi32(  105920568,  1102083798,  1996262417,  -315317896,
+                            -1550856241,   508084249,   469620010,   876093449),
+      simde_mm256_set_epi32(  105920568,   641006333,  1102083798, -1500783151,
+                            -1550856241, -1798449925,   508084249, -1021397206) },
+    { simde_mm256_set_epi32(-2041863309,  1291468441,   224493809,  -633047392,
+                              709662425,  1721261581,     9181122,  1029412511),
+      simde_mm256_set_epi32( -949676724,  -965871477,   105418561,  1764766431,
+                             1246492296,  1642156357,  1628847816,   210602535),
+      simde_mm256_set_epi32( -949676724, -2041863309,  -965871477,  1291468441,
+                             1246492296,   709662425,  1642156357,  1721261581) },
+    { simde_mm256_set_epi32(  607168608,  -237357084,   608056127, -1506912555,
+                              226183713,   949145280,  -643808204, -1179752699),
+      simde_mm256_set_epi32( 1048415498, -1381426205,  -237476298, -1794919839,
+                            -1624769524,  1030514065,   641565544,   200778359),
+      simde_mm256_set_epi32( 1048415498,   607168608, -1381426205,  -237357084,
+                            -1624769524,   226183713,  1030514065,   949145280) },
+    { simde_mm256_set_epi32( 1441942350,  1238305882, -1269231543, -1231999100,
+                              411328463,  -177557090,   125174178,  -570030291),
+      simde_mm256_set_epi32(-2095672514,  1056461255,  1951847351, -1145290014,
+                              357885041, -1824859151,   698807928,   327311082),
+      simde_mm256_set_epi32(-2095672514,  1441942350,  1056461255,  1238305882,
+                              357885041,   411328463, -1824859151,  -177557090) },
+    { simde_mm256_set_epi32( -255070802, -2114906436, -1814749348, -1878142181,
+                             1249697087, -1029108304,  1866795892,   974494703),
+      simde_mm256_set_epi32(-1711335700,  -480415088,  1857798887, -1005763599,
+                               57435366,  1896772234, -1279394707,  1080387986),
+      simde_mm256_set_epi32(-1711335700,  -255070802,  -480415088, -2114906436,
+                               57435366,  1249697087,  1896772234, -1029108304) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_unpackhi_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_unpackhi_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 1127486054580655544), INT64_C( 3441342146533158830),
+                             INT64_C(-8700901474660792043), INT64_C(-5424726226098448110)),
+      simde_mm256_set_epi64x(INT64_C(  468236941827163506), INT64_C( -256790389048303670),
+                             INT64_C(-6309685070751395406), INT64_C(  901649280098914473)),
+      simde_mm256_set_epi64x(INT64_C(  468236941827163506), INT64_C( 1127486054580655544),
+                             INT64_C(-6309685070751395406), INT64_C(-8700901474660792043)) },
+    { simde_mm256_set_epi64x(INT64_C(-8572630129765557330), INT64_C(-1269813700322388706),
+                             INT64_C(-7511847884492229007), INT64_C( 8282409083850235808)),
+      simde_mm256_set_epi64x(INT64_C( 3661643221676349885), INT64_C(-7867080866272208128),
+                             INT64_C( 7663103314862099798), INT64_C( 5993557255481351465)),
+      simde_mm256_set_epi64x(INT64_C( 3661643221676349885), INT64_C(-8572630129765557330),
+                             INT64_C( 7663103314862099798), INT64_C(-7511847884492229007)) },
+    { simde_mm256_set_epi64x(INT64_C( 8912656876635578366), INT64_C( 2138471554402599157),
+                             INT64_C( -216164905909545350), INT64_C( 7579718837655612498)),
+      simde_mm256_set_epi64x(INT64_C(-5089066492885409170), INT64_C( 2696084842585583191),
+                             INT64_C(-6713618974253446378), INT64_C(  113945075605544177)),
+      simde_mm256_set_epi64x(INT64_C(-5089066492885409170), INT64_C( 8912656876635578366),
+                             INT64_C(-6713618974253446378), INT64_C( -216164905909545350)) },
+    { simde_mm256_set_epi64x(INT64_C(-6242484431000761321), INT64_C( 6920683878754261649),
+                             INT64_C( 1268084204954383705), INT64_C(  897796011672979519)),
+      simde_mm256_set_epi64x(INT64_C( 7802882592587071902), INT64_C(-8341983666966910520),
+                             INT64_C( 7398458702236236378), INT64_C(-4228043519126560730)),
+      simde_mm256_set_epi64x(INT64_C( 7802882592587071902), INT64_C(-6242484431000761321),
+                             INT64_C( 7398458702236236378), INT64_C( 1268084204954383705)) },
+    { simde_mm256_set_epi64x(INT64_C( 3270636556271784183), INT64_C(-6361555212931034782),
+                             INT64_C(-6610245438117276236), INT64_C( 7734544492809958996)),
+      simde_mm256_set_epi64x(INT64_C( 6307826247148960694), INT64_C( 5072040750645325386),
+                             INT64_C(  361616571263281952), INT64_C( 1207992620779615795)),
+      simde_mm256_set_epi64x(INT64_C( 6307826247148960694), INT64_C( 3270636556271784183),
+                             INT64_C(  361616571263281952), INT64_C(-6610245438117276236)) },
+    { simde_mm256_set_epi64x(INT64_C(-3689126342840667469), INT64_C( 8845409215430070613),
+                             INT64_C(-6639353675427202934), INT64_C( 7570748468421241886)),
+      simde_mm256_set_epi64x(INT64_C(-8523102655278108841), INT64_C(-2248586113568527314),
+                             INT64_C( 1638664468381455373), INT64_C( -167720222430867797)),
+      simde_mm256_set_epi64x(INT64_C(-8523102655278108841), INT64_C(-3689126342840667469),
+                             INT64_C( 1638664468381455373), INT64_C(-6639353675427202934)) },
+    { simde_mm256_set_epi64x(INT64_C( 5758889939280060566), INT64_C( 8621191045554458607),
+                             INT64_C( 3792508369362531252), INT64_C(-6369035430191729754)),
+      simde_mm256_set_epi64x(INT64_C(-4163734430066330248), INT64_C(-6480924216292434351),
+                             INT64_C(-5865801116866482982), INT64_C( 3868567344002415795)),
+      simde_mm256_set_epi64x(INT64_C(-4163734430066330248), INT64_C( 5758889939280060566),
+                             INT64_C(-5865801116866482982), INT64_C( 3792508369362531252)) },
+    { simde_mm256_set_epi64x(INT64_C( 3874322050456857564), INT64_C(-7304309621699148544),
+                             INT64_C( 1260945466202705078), INT64_C(-5256021492043288987)),
+      simde_mm256_set_epi64x(INT64_C(-3025166562589619688), INT64_C(-1631386592047136887),
+                             INT64_C( 4899395192736269601), INT64_C( -972133815754887005)),
+      simde_mm256_set_epi64x(INT64_C(-3025166562589619688), INT64_C( 3874322050456857564),
+                             INT64_C( 4899395192736269601), INT64_C( 1260945466202705078)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_unpackhi_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_unpackhi_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -41,   33,    0,  -96,   72,   86,  -28,   62,
+                             88,  -27,  -70,  -17,  -49,  -71,  100,  -79,
+                             49,    5,  -77,   75,   49,   95, -115,  -82,
+                            -59,  -69,   76,   47,   53,  -93,   17,   56),
+      simde_mm256_set_epi8(  61,   93,  -88,   86,   45, -119,  -10,  -13,
+                            101,  109,  125,  -44,   -5,  -30,  -16,   42,
+                            -71,  -58,   58,    6,   56,  -41,  -13, -102,
+                             30,  -47,  -95,  126,   93,   45,   31,   57),
+      simde_mm256_set_epi8(  61,  -41,   93,   33,  -88,    0,   86,  -96,
+                             45,   72, -119,   86,  -10,  -28,  -13,   62,
+                            -71,   49,  -58,    5,   58,  -77,    6,   75,
+                             56,   49,  -41,   95,  -13, -115, -102,  -82) },
+    { simde_mm256_set_epi8( 108, -100,  -53,   43,   85,  -50,  -23,  -44,
+                            -35,   15,   24,  -61,  -41,   34, -101,  -52,
+                            -49,  -35,   -2,   62,  -96,   91, -110,  122,
+                             33,  117,   63,  -52,  112,  126,   97,  -71),
+      simde_mm256_set_epi8(  28,   42,   90,   54,   47, -106, -122,  -92,
+                            -40,    2,  -71,  -66,  -78,  -58,   83,   68,
+                            -30,   82, -124,   -6,  117,   17,   83,  -90,
+                            -79,  -11,   87,  -33,   11,   -1,   83,   91),
+      simde_mm256_set_epi8(  28,  108,   42, -100,   90,  -53,   54,   43,
+                             47,   85, -106,  -50, -122,  -23,  -92,  -44,
+                            -30,  -49,   82,  -35, -124,   -2,   -6,   62,
+                            117,  -96,   17,   91,   83, -110,  -90,  122) },
+    { simde_mm256_set_epi8( -68,   55,  112,  120,   -4,   36,  -52,   18,
+                             36,   19,   12, -105, -101,   61,  -78,   71,
+                            113,   14,  -57,  -58,   40,  -29,  -36, -123,
+                            -59,  -90,  -15, INT8_MIN,  -26,   52,  -27,  -42),
+      simde_mm256_set_epi8(  43,    0,  -94, -120,  -40,    1,  -89,   63,
+                            123,   54,   89,   72,  -56,  -76,   63,  -99,
+                             16, -114,  106,   43,   91,  108,   72, -100,
+                            -47,   25,   51,  -91,  -72,   64,  -86,   87),
+      simde_mm256_set_epi8(  43,  -68,    0,   55,  -94,  112, -120,  120,
+                            -40,   -4,    1,   36,  -89,  -52,   63,   18,
+                             16,  113, -114,   14,  106,  -57,   43,  -58,
+                             91,   40,  108,  -29,   72,  -36, -100, -123) },
+    { simde_mm256_set_epi8( -58,  -21,  -22,  -84,   57,  122, -116,  -33,
+                            -31,   91,  104,   -6,   74,  -38,  -15,   73,
+                             95,   18,   -8,  -23,   87,  -68,  -80,  -61,
+                             80,  -61,   91, -103,   42,  -87, -126,   41),
+      simde_mm256_set_epi8(  22,   69,  -47, -114,   31,  -25,   16,   99,
+                            -48,  -96,  105,  -87,  -88,  -44,   33,    9,
+                           -106,   76,  -78,   -9, -105,   51,   68,   48,
+                             -6,  -67,   79,  -50, -117,   15,  -71,   12),
+      simde_mm256_set_epi8(  22,  -58,   69,  -21,  -47,  -22, -114,  -84,
+                             31,   57,  -25,  122,   16, -116,   99,  -33,
+                           -106,   95,   76,   18,  -78,   -8,   -9,  -23,
+                           -105,   87,   51,  -68,   68,  -80,   48,  -61) },
+    { simde_mm256_set_epi8(  63, -114,  -30,  124,  -51,   39,  -24,   26,
+                             53,  -13,  -69,  -87,   51,   64,  106,  -39,
+                             70,   46,   59,  -24,   66,  -51,  122,   92,
+                            -31,   80, -108,   47,  -29, -101,  -40,  110),
+      simde_mm256_set_epi8(  61,  -25,  -95,  -69, INT8_MIN,  116,  114,  -91,
+                            -15,  -74,  102,   38,    8,  -25, -101,  -87,
+                            -59,   47,   41,  -17,   93,  100,   17,  -29,
+                             -9,   85,   70,    8,   18,  -97,   86,  -76),
+      simde_mm256_set_epi8(  61,   63,  -25, -114,  -95,  -30,  -69,  124,
+                           INT8_MIN,  -51,  116,   39,  114,  -24,  -91,   26,
+                            -59,   70,   47,   46,   41,   59,  -17,  -24,
+                             93,   66,  100,  -51,   17,  122,  -29,   92) },
+    { simde_mm256_set_epi8(  43,   26,   59,   63,  120,  -95,  126,   58,
+                            -46,   66,  -61,  -62,  -45,   54,  -22, -100,
+                            -88,  -21,    8,  100,   54,  -46,   81,  -93,
+                              7,  -36,  -56,  114,   72,  -57,   58,  -12),
+      simde_mm256_set_epi8( 108,  -15,  -19,   11,   19,  118,  -52,  114,
+                            -78,  -51,  -79,   71, -114, -107,  -19,   36,
+                             83,   66, -106,   77,  -21,  -35,  -35,  -98,
+                              3,  -78, -105, -117,  -63,    7, -106, -121),
+      simde_mm256_set_epi8( 108,   43,  -15,   26,  -19,   59,   11,   63,
+                             19,  120,  118,  -95,  -52,  126,  114,   58,
+                             83,  -88,   66,  -21, -106,    8,   77,  100,
+                            -21,   54,  -35,  -46,  -35,   81,  -98,  -93) },
+    { simde_mm256_set_epi8( -73,   44,  -97,   46, -126,    8,  119, -124,
+                             14,  119,   45,  106,   37,   87,   90,  127,
+                           -123,   74,   71,    5,   44,  -31,   33,  -42,
+                            -35,    4,  126,  -47,  -41,  -69,  -13,  -86),
+      simde_mm256_set_epi8( -63,  -56,  -99,  -87,   55,  -96,  -26,   94,
+                            -99,  111,  -79,  -13,   72,  -66,   46,   88,
+                             68,  -95,   70,   29,  -48,  -97,   40,   44,
+                             38,  110,  -40,   47, -106,   49,  104,  -90),
+      simde_mm256_set_epi8( -63,  -73,  -56,   44,  -99,  -97,  -87,   46,
+                             55, -126,  -96,    8,  -26,  119,   94, -124,
+                             68, -123,  -95,   74,   70,   71,   29,    5,
+                            -48,   44,  -97,  -31,   40,   33,   44,  -42) },
+    { simde_mm256_set_epi8(   5,   44,   45,   39,   91,  -96,  -43,   10,
+                            -61,   49,  -40,   74,   19,  -37,   48,   55,
+                            -95,  -51,  -57,  -20,    1,  -60,   30,  103,
+                             67,  101,  -10, -109,    8, -110,   34,   -5),
+      simde_mm256_set_epi8(-106,   73,   95, -100,   22,   -8,  -65,  -26,
+                            -95,   61,  -81,   13, -105,   42,  -93,   43,
+                            106,  -57,   84,   66,   28,  -73,  -49,   26,
+                             80,    2,  103,   70,   14, -117,   55,  -24),
+      simde_mm256_set_epi8(-106,    5,   73,   44,   95,   45, -100,   39,
+                             22,   91,   -8,  -96,  -65,  -43,  -26,   10,
+                            106,  -95,  -57,  -51,   84,  -57,   66,  -20,
+                             28,    1,  -73,  -60,  -49,   30,   26,  103) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_unpackhi_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_unpacklo_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16( -8706, -11077,  18173, -15297,  -2969, -25010,  17809, -11208,
+                            -23490,  -7971,  22429,   9124,  -5058, -24741, -29910,  14366),
+      simde_mm256_set_epi16( 32322,   3685, -25116,   2878,  19964, -23831,  28236,  11675,
+                             32375,  23168, -13571,   7840,  -1112,   3783,  21625,  25782),
+      simde_mm256_set_epi16( 19964,  -2969, -23831, -25010,  28236,  17809,  11675, -11208,
+                             -1112,  -5058,   3783, -24741,  21625, -29910,  25782,  14366) },
+    { simde_mm256_set_epi16( -6026,  20068, -13121, -19949, -20110, -30171, -26349,  32714,
+                              4338, -14893,  16184,   5758, -17432,  21221, -10550, -17182),
+      simde_mm256_set_epi16(-28393, -12188,  10417, -23014,   7463, -11352,  15792,  12814,
+                             22417,   5985,  19917, -22899, -19398, -32647, -14209,  17229),
+      simde_mm256_set_epi16(  7463, -20110, -11352, -30171,  15792, -26349,  12814,  32714,
+                            -19398, -17432, -32647,  21221, -14209, -10550,  17229, -17182) },
+    { simde_mm256_set_epi16(-32023,  31511, -12317, -15713,  28713, -19472,   9364, -30551,
+                            -28540,   7228,    118,  12407,  21906,   8985,   5169,   8081),
+      simde_mm256_set_epi16( 11036,   6437, -31075, -26330, -17929,  19764, -11581, -20381,
+                            -14908, -21619, -29275,  -1424, -11427, -31872, -29344, -20381),
+      simde_mm256_set_epi16(-17929,  28713,  19764, -19472, -11581,   9364, -20381, -30551,
+                            -11427,  21906, -31872,   8985, -29344,   5169, -20381,   8081) },
+    { simde_mm256_set_epi16( 21275, -12740, -13476,  -2226,   7649,  -6739, -18109,  14440,
+                             19237,  20655, -24776,  26965, -30880, -10633, -19503,   2364),
+      simde_mm256_set_epi16(  8872, -22228,  25922,  14904,   4008, -12033,  32094, -13411,
+                              8884, -17755,  -6705,   3720,   5312,  23177, -32289, -18704),
+      simde_mm256_set_epi16(  4008,   7649, -12033,  -6739,  32094, -18109, -13411,  14440,
+                              5312, -30880,  23177, -10633, -32289, -19503, -18704,   2364) },
+    { simde_mm256_set_epi16( 23964, -21866,    781,  24715, -31296,   4670,  -2715,   1840,
+                             24427,   7640,  -9611,   2870, -10131,  -8269,  10665,  24336),
+      simde_mm256_set_epi16(-20628, -23676, -21768,  30057, -11636,   5601,  19600, -23518,
+                             -8497, -11012,    558,  -8713, -13632,  27324,  -6208,  -8646),
+      simde_mm256_set_epi16(-11636, -31296,   5601,   4670,  19600,  -2715, -23518,   1840,
+                            -13632, -10131,  27324,  -8269,  -6208,  10665,  -8646,  24336) },
+    { simde_mm256_set_epi16(   426, -29256,  13616,  11804, -20880, -30056,  24795, -24031,
+                             -7131, -30574,  32766,  -9701,  22272, -12851,  -4236,  -5050),
+      simde_mm256_set_epi16( 31662,    783,  29518, -18849, -23541,  11528,  25714,   5213,
+                             -2639,   1472,  30544,  27217,   9835,  12802, -28434, -26520),
+      simde_mm256_set_epi16(-23541, -20880,  11528, -30056,  25714,  24795,   5213, -24031,
+                              9835,  22272,  12802, -12851, -28434,  -4236, -26520,  -5050) },
+    { simde_mm256_set_epi16(-30494,   4336, -13084,  10800, -23539,  22946,   -106,  31940,
+                             18404,   2573,  11011,  15063, -10179,  11544,  -9698,   4681),
+      simde_mm256_set_epi16(-31026, -27067, -24360,  29587, -19826, -20706,  24059,  12512,
+                             -1823, -32518, -32171,   5243,  22334,  17350, -19212,   3004),
+      simde_mm256_set_epi16(-19826, -23539, -20706,  22946,  24059,   -106,  12512,  31940,
+                             22334, -10179,  17350,  11544, -19212,  -9698,   3004,   4681) },
+    { simde_mm256_set_epi16( 27795, -31747, -18346, -24973, -29338, -15177, -27179, -30891,
+                             -9180,  30106,  30505,  11847, -18050, -10986,  -4940, -24339),
+      simde_mm256_set_epi16( 11987,  11509, -18424,  19505, -23521,  28297, -12505,  10145,
+                             26005,    181, -29146,  -4689,  15428,  23380,  24115,  22275),
+      simde_mm256_set_epi16(-23521, -29338,  28297, -15177, -12505, -27179,  10145, -30891,
+                             15428, -18050,  23380, -10986,  24115,  -4940,  22275, -24339) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_unpacklo_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_unpacklo_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( 1230770360, -1545105323,  -283307193, -1327662951,
+                              730460659, -1133251327,  1680309774, -1041714068),
+      simde_mm256_set_epi32(  712050543,  1103563341,   371579532, -1614324062,
+                             1955169567, -1043230473,   438609812, -1303589055),
+      simde_mm256_set_epi32(  371579532,  -283307193, -1614324062, -1327662951,
+                              438609812,  1680309774, -1303589055, -1041714068) },
+    { simde_mm256_set_epi32( 1853233239,  -306575652,   539894357, -1044969785,
+                             -111649715,  1168490654,   484895382,  -759235654),
+      simde_mm256_set_epi32( 2005063986,  1298438408,   -86965909,   137669824,
+                             -156433732, -1998413462, -1554596715,   717286736),
+      simde_mm256_set_epi32(  -86965909,   539894357,   137669824, -1044969785,
+                            -1554596715,   484895382,   717286736,  -759235654) },
+    { simde_mm256_set_epi32(-2054827696, -2115441802, -1364846873,  -767453623,
+                            -1623836974,  2060568263,    67007939,  1324127640),
+      simde_mm256_set_epi32( -827311759,  1694602704,   261573907,   830910545,
+                            -1864160413,  -833288246, -1219499058,   663815955),
+      simde_mm256_set_epi32(  261573907, -1364846873,   830910545,  -767453623,
+                            -1219499058,    67007939,   663815955,  1324127640) },
+    { simde_mm256_set_epi32( 1618638177,  1061894230, -1992481285, -1262288423,
+                            -2107167905, -1194484631,  1012011494, -1752925841),
+      simde_mm256_set_epi32(  -21161692, -1348216800,   -91715308,   644793853,
+                             -190150002,  -531685325,  1357107110,  1421418248),
+      simde_mm256_set_epi32(  -91715308, -1992481285,   644793853, -1262288423,
+                             1357107110,  1012011494,  1421418248, -1752925841) },
+    { simde_mm256_set_epi32(-1417399248,  -607164425,  -970158722,  -753081646,
+                              199957235,   380618333,  1308247523,   603780950),
+      simde_mm256_set_epi32(  188304409,   308243142,  1955037168,  -273704822,
+                            -1172926510,  1543570591,  -458649149, -1578720193),
+      simde_mm256_set_epi32( 1955037168,  -970158722,  -273704822,  -753081646,
+                             -458649149,  1308247523, -1578720193,   603780950) },
+    { simde_mm256_set_epi32( 1064370340, -1829883092, -1754984974, -1687537514,
+                             -449406312, -1511122539, -1498309622,  1613658908),
+      simde_mm256_set_epi32(-1509254694, -1655925019,   124636393,   903567121,
+                             1686766150,  1366484756, -1894922286,    48373693),
+      simde_mm256_set_epi32(  124636393, -1754984974,   903567121, -1687537514,
+                            -1894922286, -1498309622,    48373693,  1613658908) },
+    { simde_mm256_set_epi32(-1743793589,    74370534, -2063689088,   485568804,
+                             1728783124, -1016918066,  -441846145, -1218724445),
+      simde_mm256_set_epi32(  907347300,  -212915489,   436608004, -1952060534,
+                             -348416285,  -925255552,  2084186549,   381148358),
+      simde_mm256_set_epi32(  436608004, -2063689088, -1952060534,   485568804,
+                             2084186549,  -441846145,   381148358, -1218724445) },
+    { simde_mm256_set_epi32(  235983935,  -473251354, -2123280371,   980105622,
+                             -227640405,   141831404, -1762241273,  1334613625),
+      simde_mm256_set_epi32( 1249211163,   834006067,  1849803245,  -212641999,
+                            -1359143946, -1662034927, -1506871082,  1358801979),
+      simde_mm256_set_epi32( 1849803245, -2123280371,  -212641999,   980105622,
+                            -1506871082, -1762241273,  1358801979,  1334613625) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_unpacklo_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_unpacklo_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-2875321248954723606), INT64_C(-2397556605475016723),
+                             INT64_C(-8628357396721118414), INT64_C(-2648135181445070064)),
+      simde_mm256_set_epi64x(INT64_C(-5451830340713331444), INT64_C(  485122859775991104),
+                             INT64_C(-6981970990903600556), INT64_C( -103248125659335146)),
+      simde_mm256_set_epi64x(INT64_C(  485122859775991104), INT64_C(-2397556605475016723),
+                             INT64_C( -103248125659335146), INT64_C(-2648135181445070064)) },
+    { simde_mm256_set_epi64x(INT64_C(  374050087245283948), INT64_C(-2826133302427207375),
+                             INT64_C(-2878038310297812722), INT64_C( 3628183735332950389)),
+      simde_mm256_set_epi64x(INT64_C(  817053073662945808), INT64_C(-6120453350065026785),
+                             INT64_C(-2345349386190372842), INT64_C(  445192632005894153)),
+      simde_mm256_set_epi64x(INT64_C(-6120453350065026785), INT64_C(-2826133302427207375),
+                             INT64_C(  445192632005894153), INT64_C( 3628183735332950389)) },
+    { simde_mm256_set_epi64x(INT64_C( 5844424558767072150), INT64_C(-1549591283976085560),
+                             INT64_C(-5034053006251908029), INT64_C( 3851059386351948980)),
+      simde_mm256_set_epi64x(INT64_C( 2647635213808683025), INT64_C(-6526117732009965204),
+                             INT64_C(-6145639411410683186), INT64_C( 4680895948651401618)),
+      simde_mm256_set_epi64x(INT64_C(-6526117732009965204), INT64_C(-1549591283976085560),
+                             INT64_C( 4680895948651401618), INT64_C( 3851059386351948980)) },
+    { simde_mm256_set_epi64x(INT64_C( -231933362759242685), INT64_C( 1566226446378468167),
+                             INT64_C( 6342561870041413571), INT64_C( -471031331039928633)),
+      simde_mm256_set_epi64x(INT64_C( 9081164748816752230), INT64_C( 9198912944385646745),
+                             INT64_C(-4333321438492839584), INT64_C( 4438499144860844131)),
+      simde_mm256_set_epi64x(INT64_C( 9198912944385646745), INT64_C( 1566226446378468167),
+                             INT64_C( 4438499144860844131), INT64_C( -471031331039928633)) },
+    { simde_mm256_set_epi64x(INT64_C(-6195694295143041824), INT64_C( -595067827987560574),
+                             INT64_C(  -56932731997222564), INT64_C(-3842292700608410223)),
+      simde_mm256_set_epi64x(INT64_C( 4672643777810837587), INT64_C( 3730267153305637619),
+                             INT64_C( 3472889198724009363), INT64_C(  945946188646385671)),
+      simde_mm256_set_epi64x(INT64_C( 3730267153305637619), INT64_C( -595067827987560574),
+                             INT64_C(  945946188646385671), INT64_C(-3842292700608410223)) },
+    { simde_mm256_set_epi64x(INT64_C( 3717324906004031636), INT64_C(-1375186288698991856),
+                             INT64_C(-5745857479455314342), INT64_C( 1853690489798276316)),
+      simde_mm256_set_epi64x(INT64_C( 8162084670606004468), INT64_C(-1259193297567702242),
+                             INT64_C(-6222768036651464793), INT64_C(-5515484461655035224)),
+      simde_mm256_set_epi64x(INT64_C(-1259193297567702242), INT64_C(-1375186288698991856),
+                             INT64_C(-5515484461655035224), INT64_C( 1853690489798276316)) },
+    { simde_mm256_set_epi64x(INT64_C(-7871566603247033899), INT64_C( 4644228372481810963),
+                             INT64_C(-5383669716307630186), INT64_C(-2045680206850191425)),
+      simde_mm256_set_epi64x(INT64_C( 1934224430686189810), INT64_C( 3565639028551891471),
+                             INT64_C(  258459053060263235), INT64_C(-1574809471803607838)),
+      simde_mm256_set_epi64x(INT64_C( 3565639028551891471), INT64_C( 4644228372481810963),
+                             INT64_C(-1574809471803607838), INT64_C(-2045680206850191425)) },
+    { simde_mm256_set_epi64x(INT64_C(-6759038009223010273), INT64_C( 6996716397432742008),
+                             INT64_C(-3519991467769056013), INT64_C( 2787878348298283595)),
+      simde_mm256_set_epi64x(INT64_C(-4603713164200089264), INT64_C( 4820497304541624000),
+                             INT64_C(-8603652608797449076), INT64_C( 7182649501265759317)),
+      simde_mm256_set_epi64x(INT64_C( 4820497304541624000), INT64_C( 6996716397432742008),
+                             INT64_C( 7182649501265759317), INT64_C( 2787878348298283595)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_unpacklo_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_unpacklo_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8( -83,   60,  101, -113,   40,  -15,  -91,   43,
+                            -84, -115,  -99, -103,   20,   17,   -4,   40,
+                           -120,   69,   76,   88,  -89,   92,    7,  -20,
+                             99,   33,   58,   73,  -80,   27,    1,  113),
+      simde_mm256_set_epi8(  31,  -59,   82, -110,    8,  -25,  114,  -95,
+                             44,  -45, -107,  -48,   59,   81,  -80,  -42,
+                            106,  -56,  -32,   35,   61,   48,    8,  -74,
+                            118,  111,   19,   -3,   25,   -9,  100,   57),
+      simde_mm256_set_epi8(  44,  -84,  -45, -115, -107,  -99,  -48, -103,
+                             59,   20,   81,   17,  -80,   -4,  -42,   40,
+                            118,   99,  111,   33,   19,   58,   -3,   73,
+                             25,  -80,   -9,   27,  100,    1,   57,  113) },
+    { simde_mm256_set_epi8(-118,  116,  127,  -53,  -75,  108,   20,  -25,
+                             -3,  -19,  -19,   15,   57,  102,   67,   91,
+                            107,  -61,   -7,  -77,   65,  110,    9,  -61,
+                             29,   40,   72, -105,    5,  -93,   25,   48),
+      simde_mm256_set_epi8( -60,   82,  116,  125, -113,  -22,  -30,  -45,
+                            -99,   99,   30, INT8_MIN,   -9, -116,   15,  -83,
+                            -76,   34,  -44,   79,  -32,   29,   -9,   23,
+                             65,   15,   22,    2, -126,   65,   86,   66),
+      simde_mm256_set_epi8( -99,   -3,   99,  -19,   30,  -19, INT8_MIN,   15,
+                             -9,   57, -116,  102,   15,   67,  -83,   91,
+                             65,   29,   15,   40,   22,   72,    2, -105,
+                           -126,    5,   65,  -93,   86,   25,   66,   48) },
+    { simde_mm256_set_epi8(  53,   18,   35,   65, -104,  -96,  -83,  -94,
+                             79,   73,   81,  123,   67,  -68,  -46, -100,
+                             63,  -48,   50,  -63,   -3, -103, -112,  -27,
+                             -4,  101, -120,   69,   45, -117,  -99, -122),
+      simde_mm256_set_epi8( -97,  -13,  -14, -106,  -42,   13,  -94,  115,
+                             49,   61,   -3, -125,   77,   49,   -3,  -48,
+                             32,   50,    7,  102,  -95,   15,   26,    8,
+                             25,   29,  -70,  -63, -115,  -33,  -10, -111),
+      simde_mm256_set_epi8(  49,   79,   61,   73,   -3,   81, -125,  123,
+                             77,   67,   49,  -68,   -3,  -46,  -48, -100,
+                             25,   -4,   29,  101,  -70, -120,  -63,   69,
+                           -115,   45,  -33, -117,  -10,  -99, -111, -122) },
+    { simde_mm256_set_epi8( -32, -114, -117,   57,   -3,  -11,  106,   49,
+                           -113,  111,  108, -101,  -53,   80,   37,  -38,
+                            -22, -104,  -90,   47, -101,  -67,  -29,  -38,
+                             77,    8,  -20,   59,   18,  -30,   90,  -68),
+      simde_mm256_set_epi8(-109,  -55,   -3,  -68,  120,   18,   -5,  -56,
+                             20,  -49,   47,  100,   43,   10,   45, -109,
+                             58,   -6,   80,  -12,   81,   42, -111,  -71,
+                            -23,   28,   40,   41,  -54,    3,   33,  101),
+      simde_mm256_set_epi8(  20, -113,  -49,  111,   47,  108,  100, -101,
+                             43,  -53,   10,   80,   45,   37, -109,  -38,
+                            -23,   77,   28,    8,   40,  -20,   41,   59,
+                            -54,   18,    3,  -30,   33,   90,  101,  -68) },
+    { simde_mm256_set_epi8( 124,  -34,   -4,   -4,   75,   33,  -22,   -3,
+                           -101,  -30,  -38, -116,   14,  -94,  -22,  -34,
+                            113,   86,  -53,  -62,   62, INT8_MIN,  -73,  -43,
+                             24,   37,  -52,   57,  -20, -113,    8,  -41),
+      simde_mm256_set_epi8( -50, -113,    4, -100,  -72,  108,  -23,  -92,
+                             39,  -94,    0,  -11,   89, -116,  -41,  -53,
+                              5,  123,   14,  -38,  -41,  -43,  -54,  -60,
+                            -98,   96,  -62,  -56,   41,  -60,  -91,   44),
+      simde_mm256_set_epi8(  39, -101,  -94,  -30,    0,  -38,  -11, -116,
+                             89,   14, -116,  -94,  -41,  -22,  -53,  -34,
+                            -98,   24,   96,   37,  -62,  -52,  -56,   57,
+                             41,  -20,  -60, -113,  -91,    8,   44,  -41) },
+    { simde_mm256_set_epi8(  28,   -9,  -14,  -88,   14,   -5,  -14,   -6,
+                             77, -122,   64,   39,   18,  127, -118,  -77,
+                             36,  -10,   94,    4,   40,  121, -126,  -64,
+                            -33, -105,  102, -109,  111,   32, -114,  121),
+      simde_mm256_set_epi8( -36,   66,  116,   66,   22,  -74,   61,  -56,
+                             15,  -86,  -19,   68,  -37,  116,  -66,   29,
+                            -63,   64,  -67,   96,   -1,  -64,  113,  -32,
+                            106,   24,  -37,   29,   58,   32, -127,   36),
+      simde_mm256_set_epi8(  15,   77,  -86, -122,  -19,   64,   68,   39,
+                            -37,   18,  116,  127,  -66, -118,   29,  -77,
+                            106,  -33,   24, -105,  -37,  102,   29, -109,
+                             58,  111,   32,   32, -127, -114,   36,  121) },
+    { simde_mm256_set_epi8(  45,  -55,  -35,  123,   66,  109,   42,  -71,
+                            104,   80,  -33, -106, -124,  -42,   81,   77,
+                            108,   63,   -4,   95,  -76,  -71, -104,  -65,
+                              2,  -88,   72,  -33,   40,   75,  108,  111),
+      simde_mm256_set_epi8(-106,    4,   -4,   94,  -73,  -20,  -35,  -42,
+                             18,  124,  -81,  106,   72,  -36,  -54,   -5,
+                             92,  -26,  -78,  -72,  -13,   10,  -71,  -11,
+                             39,   41,   32,   72,  -66,   48,  117,   57),
+      simde_mm256_set_epi8(  18,  104,  124,   80,  -81,  -33,  106, -106,
+                             72, -124,  -36,  -42,  -54,   81,   -5,   77,
+                             39,    2,   41,  -88,   32,   72,   72,  -33,
+                            -66,   40,   48,   75,  117,  108,   57,  111) },
+    { simde_mm256_set_epi8(  82,  -50,  -80,   35,  -87,  -88,  -84,  -45,
+                             97,    7,  -45,  117, -108,   71,   16,  116,
+                             79,   23,   75, -106,   56,  -78,  111,   11,
+                            118,  -45,   -6,  -71,  -96,   90,   99,   70),
+      simde_mm256_set_epi8(-111,   80,  -45,  -62,   56,   46,  -22,  -42,
+                            -28,  -79,  -92, -110,  -21,    4,  120,  -61,
+                            102,   16,  -89,    4,  -95, -114,   24,  -71,
+                             31,   -2,  114,  -40,   98,  -36,  -15,  -25),
+      simde_mm256_set_epi8( -28,   97,  -79,    7,  -92,  -45, -110,  117,
+                            -21, -108,    4,   71,  120,   16,  -61,  116,
+                             31,  118,   -2,  -45,  114,   -6,  -40,  -71,
+                             98,  -96,  -36,   90,  -15,   99,  -25,   70) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_unpacklo_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_xor_si256(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 5900314553544268742), INT64_C( 2805193154111590554),
+                             INT64_C(-2743822136177214217), INT64_C(-6564555378735752570)),
+      simde_mm256_set_epi64x(INT64_C(-4278944341914983943), INT64_C( 7337364267648062818),
+                             INT64_C(-5082929699922281817), INT64_C(-6627373878938427556)),
+      simde_mm256_set_epi64x(INT64_C(-7675257354430989761), INT64_C( 4845171309285688824),
+                             INT64_C( 6962057133958678096), INT64_C(   63284847757444570)) },
+    { simde_mm256_set_epi64x(INT64_C(-5864313202338618089), INT64_C(-4876498468373602741),
+                             INT64_C( 1592145703431256996), INT64_C(-6907205807928492341)),
+      simde_mm256_set_epi64x(INT64_C( 3989815784573695725), INT64_C(-4074910724625433018),
+                             INT64_C( 2714525823763465797), INT64_C(  644923428686244926)),
+      simde_mm256_set_epi64x(INT64_C(-7366927571944221702), INT64_C( 8872144265608667149),
+                             INT64_C( 3725495925047885281), INT64_C(-6280385571977981195)) },
+    { simde_mm256_set_epi64x(INT64_C( 7659748235037436420), INT64_C(-9212674674669389745),
+                             INT64_C(-7628844208226227537), INT64_C( 8516900046322609139)),
+      simde_mm256_set_epi64x(INT64_C( -279096123050918620), INT64_C(-7426344088954609562),
+                             INT64_C( 6750415770333164558), INT64_C(-2383159873485111849)),
+      simde_mm256_set_epi64x(INT64_C(-7607538674472282336), INT64_C( 1789708424789760041),
+                             INT64_C(-3778891739121181023), INT64_C(-6278216003077450204)) },
+    { simde_mm256_set_epi64x(INT64_C(-1602241413741400087), INT64_C(-6473188143935276039),
+                             INT64_C( 8959214694819215356), INT64_C(-4504712785847431646)),
+      simde_mm256_set_epi64x(INT64_C( 2955523095281321762), INT64_C( 5697617328513981953),
+                             INT64_C( 1985995936766403241), INT64_C(  470039516223251621)),
+      simde_mm256_set_epi64x(INT64_C(-4555512567401617205), INT64_C(-1641388993900173832),
+                             INT64_C( 7483340478452864341), INT64_C(-4036947215107396985)) },
+    { simde_mm256_set_epi64x(INT64_C(-7145252090538140987), INT64_C(-4539952521823472066),
+                             INT64_C( 3344679936302637841), INT64_C(-4631350139215788026)),
+      simde_mm256_set_epi64x(INT64_C( 7867733635613641415), INT64_C( 8363254703294102586),
+                             INT64_C( 3898971592001947062), INT64_C(-8826931064724265313)),
+      simde_mm256_set_epi64x(INT64_C(-1010713854130286590), INT64_C(-5409132202407032316),
+                             INT64_C( 1761293035933296295), INT64_C( 4195757677578137241)) },
+    { simde_mm256_set_epi64x(INT64_C(-2188707163266478228), INT64_C(-2394313367553358757),
+                             INT64_C(-2362871117390847467), INT64_C( 4876693846676698114)),
+      simde_mm256_set_epi64x(INT64_C( 7821070391431832489), INT64_C(  958169289040556109),
+                             INT64_C( 6278303461986204951), INT64_C( 6206689183513334682)),
+      simde_mm256_set_epi64x(INT64_C(-8274765652070716219), INT64_C(-3203843525444619242),
+                             INT64_C(-8641169081750675710), INT64_C( 1553717522064025496)) },
+    { simde_mm256_set_epi64x(INT64_C(-1962982808804132098), INT64_C( 3107694346442783203),
+                             INT64_C( 4535537810127955070), INT64_C(-4386688638955031550)),
+      simde_mm256_set_epi64x(INT64_C(-1151097438549810591), INT64_C( 3701652487383851408),
+                             INT64_C( 1336849592333719661), INT64_C(-6083901822871594838)),
+      simde_mm256_set_epi64x(INT64_C( 1496443517456062623), INT64_C( 1764943597444175987),
+                             INT64_C( 3205443651902307347), INT64_C( 7534234559973747880)) },
+    { simde_mm256_set_epi64x(INT64_C(-8326782743726336668), INT64_C( 4426450490414546803),
+                             INT64_C( -884512876949497371), INT64_C(-5381400669174903410)),
+      simde_mm256_set_epi64x(INT64_C( 6961715599607479665), INT64_C(  -72691238870822453),
+                             INT64_C(-6136634849878787585), INT64_C(-1369187083863783128)),
+      simde_mm256_set_epi64x(INT64_C(-1374257293554554859), INT64_C(-4354885247220748616),
+                             INT64_C( 6444614952578424858), INT64_C( 6462321333521400998)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_xor_si256(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm_i32gather_epi32",         test_simde_mm_i32gather_epi32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_i64gather_epi32",         test_simde_mm_i64gather_epi32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_mask_i32gather_ps",       test_simde_mm_mask_i32gather_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sllv_epi32",              test_simde_mm_sllv_epi32,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_srav_epi32",              test_simde_mm_srav_epi32,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_srlv_epi64",              test_simde_mm_srlv_epi64,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_abs_epi16",            test_simde_mm256_abs_epi16,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_abs_epi32",            test_simde_mm256_abs_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_abs_epi8",             test_simde_mm256_abs_epi8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_add_epi16",            test_simde_mm256_add_epi16,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_add_epi32",            test_simde_mm256_add_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_add_epi64",            test_simde_mm256_add_epi64,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_add_epi8",             test_simde_mm256_add_epi8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_adds_epi16",           test_simde_mm256_adds_epi16,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_adds_epi8",            test_simde_mm256_adds_epi8,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_adds_epu16",           test_simde_mm256_adds_epu16,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_adds_epu8",            test_simde_mm256_adds_epu8,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_and_si256",            test_simde_mm256_and_si256,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_andnot_si256",         test_simde_mm256_andnot_si256,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_avg_epu16",            test_simde_mm256_avg_epu16,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_avg_epu8",             test_simde_mm256_avg_epu8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_bslli_epi128",         test_simde_mm256_bslli_epi128,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_bsrli_epi128",         test_simde_mm256_bsrli_epi128,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmpeq_epi16",          test_simde_mm256_cmpeq_epi16,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmpeq_epi32",          test_simde_mm256_cmpeq_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmpeq_epi64",          test_simde_mm256_cmpeq_epi64,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmpeq_epi8",           test_simde_mm256_cmpeq_epi8,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmpgt_epi16",          test_simde_mm256_cmpgt_epi16,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmpgt_epi32",          test_simde_mm256_cmpgt_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmpgt_epi64",          test_simde_mm256_cmpgt_epi64,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cmpgt_epi8",           test_simde_mm256_cmpgt_epi8,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_i32gather_epi32",      test_simde_mm256_i32gather_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_i32gather_epi64",      test_simde_mm256_i32gather_epi64,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_i32gather_pd",         test_simde_mm256_i32gather_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_i32gather_ps",         test_simde_mm256_i32gather_ps,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_i64gather_epi32",      test_simde_mm256_i64gather_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_i64gather_epi64",      test_simde_mm256_i64gather_epi64,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_i64gather_pd",         test_simde_mm256_i64gather_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_i64gather_ps",         test_simde_mm256_i64gather_ps,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_madd_epi16",           test_simde_mm256_madd_epi16,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_maddubs_epi16",        test_simde_mm256_maddubs_epi16,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_i32gather_epi32", test_simde_mm256_mask_i32gather_epi32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_i32gather_pd",    test_simde_mm256_mask_i32gather_pd,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_i64gather_epi64", test_simde_mm256_mask_i64gather_epi64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_i64gather_ps",    test_simde_mm256_mask_i64gather_ps,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_max_epi16",            test_simde_mm256_max_epi16,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_max_epi32",            test_simde_mm256_max_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_max_epi8",             test_simde_mm256_max_epi8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_max_epu16",            test_simde_mm256_max_epu16,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_max_epu32",            test_simde_mm256_max_epu32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_max_epu8",             test_simde_mm256_max_epu8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_min_epi16",            test_simde_mm256_min_epi16,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_min_epi32",            test_simde_mm256_min_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_min_epi8",             test_simde_mm256_min_epi8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_min_epu16",            test_simde_mm256_min_epu16,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_min_epu32",            test_simde_mm256_min_epu32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_min_epu8",             test_simde_mm256_min_epu8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_movemask_epi8",        test_simde_mm256_movemask_epi8,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mul_epi32",            test_simde_mm256_mul_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mul_epu32",            test_simde_mm256_mul_epu32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mulhi_epi16",          test_simde_mm256_mulhi_epi16,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mulhi_epu16",          test_simde_mm256_mulhi_epu16,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mullo_epi16",          test_simde_mm256_mullo_epi16,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mullo_epi32",          test_simde_mm256_mullo_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_or_si256",             test_simde_mm256_or_si256,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_packs_epi16",          test_simde_mm256_packs_epi16,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_packs_epi32",          test_simde_mm256_packs_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_packus_epi16",         test_simde_mm256_packus_epi16,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_packus_epi32",         test_simde_mm256_packus_epi32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_permute4x64_epi64",    test_simde_mm256_permute4x64_epi64,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_permute4x64_pd",       test_simde_mm256_permute4x64_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_permutevar8x32_epi32", test_simde_mm256_permutevar8x32_epi32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_permutevar8x32_ps",    test_simde_mm256_permutevar8x32_ps,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sad_epu8",             test_simde_mm256_sad_epu8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_shuffle_epi8",         test_simde_mm256_shuffle_epi8,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sllv_epi32",           test_simde_mm256_sllv_epi32,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sllv_epi64",           test_simde_mm256_sllv_epi64,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_srav_epi32",           test_simde_mm256_srav_epi32,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_srlv_epi32",           test_simde_mm256_srlv_epi32,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_srlv_epi64",           test_simde_mm256_srlv_epi64,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sub_epi16",            test_simde_mm256_sub_epi16,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sub_epi32",            test_simde_mm256_sub_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sub_epi64",            test_simde_mm256_sub_epi64,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_sub_epi8",             test_simde_mm256_sub_epi8,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_subs_epi16",           test_simde_mm256_subs_epi16,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_subs_epi8",            test_simde_mm256_subs_epi8,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_subs_epu16",           test_simde_mm256_subs_epu16,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_subs_epu8",            test_simde_mm256_subs_epu8,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_unpackhi_epi16",       test_simde_mm256_unpackhi_epi16,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_unpackhi_epi32",       test_simde_mm256_unpackhi_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_unpackhi_epi64",       test_simde_mm256_unpackhi_epi64,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_unpackhi_epi8",        test_simde_mm256_unpackhi_epi8,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_unpacklo_epi16",       test_simde_mm256_unpacklo_epi16,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_unpacklo_epi32",       test_simde_mm256_unpacklo_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_unpacklo_epi64",       test_simde_mm256_unpacklo_epi64,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_unpacklo_epi8",        test_simde_mm256_unpacklo_epi8,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_xor_si256",            test_simde_mm256_xor_si256,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_avx2_test_suite = {
+  (char*) "/avx2",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
@@ -0,0 +1,9374 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../avx512f.h"
+
+static MunitResult
+test_simde_mm512_abs_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[9] = {
+    { simde_mm512_set_epi32( -515582232,  2033064692,   383820229,   500059771,
+                             -829299312,    84686477,  2007895027,  -289865106,
+                            -1712832678,  1350171741,  2046340519,  -996420037,
+                             1962916072, -2058922281,  1317384406, -1445770942),
+      simde_mm512_set_epi32(  515582232,  2033064692,   383820229,   500059771,
+                              829299312,    84686477,  2007895027,   289865106,
+                             1712832678,  1350171741,  2046340519,   996420037,
+                             1962916072,  2058922281,  1317384406,  1445770942) },
+    { simde_mm512_set_epi32( 1356176394,   555778661,   247950592, -1686201807,
+                              967928689,   768592046,   -63406598,  -624994939,
+                             1847487725,  1881224344,  -629184109, -1909680003,
+                            -1277964867,  1153591783,  -855446148, -2115452422),
+      simde_mm512_set_epi32( 1356176394,   555778661,   247950592,  1686201807,
+                              967928689,   768592046,    63406598,   624994939,
+                             1847487725,  1881224344,   629184109,  1909680003,
+                             1277964867,  1153591783,   855446148,  2115452422) },
+    { simde_mm512_set_epi32(-1683937587,      -62276, -1884064769, -1205999845,
+                             1278660827,    95469820, -1300596602, -1847296158,
+                              873776252,  1969745336, -1901383782,  1531025987,
+                              290034711,  -326573862,  -494381358,   367872179),
+      simde_mm512_set_epi32( 1683937587,       62276,  1884064769,  1205999845,
+                             1278660827,    95469820,  1300596602,  1847296158,
+                              873776252,  1969745336,  1901383782,  1531025987,
+                              290034711,   326573862,   494381358,   367872179) },
+    { simde_mm512_set_epi32( -678548945,  2131775155,  1676228649,  1324566895,
+                            -1305600347,  1479467049,  1291338222, -2088916928,
+                            -1025662741,  -422039824,  1168993537,   631867050,
+                              658182310,    15413291, -1241580122,  -493147408),
+      simde_mm512_set_epi32(  678548945,  2131775155,  1676228649,  1324566895,
+                             1305600347,  1479467049,  1291338222,  2088916928,
+                             1025662741,   422039824,  1168993537,   631867050,
+                              658182310,    15413291,  1241580122,   493147408) },
+    { simde_mm512_set_epi32( 1462500224,  1784650872,  1427438312,   218462448,
+                              347896290, -1233857949,   186016525, -1222233563,
+                             1434916998,  -499567743,  1819716933,  -902777898,
+                              492306179,   -15613193,  2034146954, -1133344804),
+      simde_mm512_set_epi32( 1462500224,  1784650872,  1427438312,   218462448,
+                              347896290,  1233857949,   186016525,  1222233563,
+                             1434916998,   499567743,  1819716933,   902777898,
+                              492306179,    15613193,  2034146954,  1133344804) },
+    { simde_mm512_set_epi32(  953480278,   627995062, -1806357124,   -93796334,
+                                1455386,   910187504,   834066927,  1754084791,
+                             -868233590,  -448311291,   -11880479,   169829449,
+                              121415650,  1029665220, -1085700465,  1665999771),
+      simde_mm512_set_epi32(  953480278,   627995062,  1806357124,    93796334,
+                                1455386,   910187504,   834066927,  1754084791,
+                              868233590,   448311291,    11880479,   169829449,
+                              121415650,  1029665220,  1085700465,  1665999771) },
+    { simde_mm512_set_epi32( 2141907897,  -794760780, -1183779298, -1847043452,
+                             -599771183,   396893967,   935181060,  2038924627,
+                             1399470388, -1592785154,  -258181479,   293729615,
+                            -1251163138,  -745620659,   290814750,   692156251),
+      simde_mm512_set_epi32( 2141907897,   794760780,  1183779298,  1847043452,
+                              599771183,   396893967,   935181060,  2038924627,
+                             1399470388,  1592785154,   258181479,   293729615,
+                             1251163138,   745620659,   290814750,   692156251) },
+    { simde_mm512_set_epi32( -608231026, -1110162330,   217931390, -1494257797,
+                             -280437239,   -72036202,  -531934363,  2071458740,
+                             1635106429,  1119728413, -1675434260,  1561750630,
+                            -2040592882,  -649930580, -2132131122,  -687161748),
+      simde_mm512_set_epi32(  608231026,  1110162330,   217931390,  1494257797,
+                              280437239,    72036202,   531934363,  2071458740,
+                             1635106429,  1119728413,  1675434260,  1561750630,
+                             2040592882,   649930580,  2132131122,   687161748) },
+    { simde_mm512_set_epi32(  INT32_MIN,   INT32_MAX,           0,          -1,
+                                      1, -2147483647,   INT32_MIN,   INT32_MIN,
+                             -580943722,   INT32_MIN,   172643283,  -993212451,
+                              INT32_MAX,   INT32_MIN,          -2,   INT32_MIN),
+      simde_mm512_set_epi32(  INT32_MIN,   INT32_MAX,           0,           1,
+                                      1,  2147483647,   INT32_MIN,   INT32_MIN,
+                              580943722,   INT32_MIN,   172643283,   993212451,
+                              INT32_MAX,   INT32_MIN,           2,   INT32_MIN) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_abs_epi32(test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_add_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(-1236468233,  1040205976, -1607813346,  1673171249,
+                             1297135674,  -151109054,  1645149922,  -229701835,
+                              269671901,  1957968125,  -889212892, -1536936433,
+                              838332124,  1661178745,   768484189, -1703559765),
+      simde_mm512_set_epi32(-1873615483,   343291272, -1879757549, -1874689230,
+                            -1545894799, -1262455021, -1749620765,   791425716,
+                              579790769,   466050901,   -34974859,   839154619,
+                             1535276339,  -601838349, -1633144051,  1240946121),
+      simde_mm512_set_epi32( 1184883580,  1383497248,   807396401,  -201517981,
+                             -248759125, -1413564075,  -104470843,   561723881,
+                              849462670, -1870948270,  -924187751,  -697781814,
+                            -1921358833,  1059340396,  -864659862,  -462613644) },
+    { simde_mm512_set_epi32( -680456008,   -27595825, -1611582090, -1452599211,
+                             1230575021,  2013709726,  1642807701, -2130011262,
+                             -928387603,  1508416343,   587913967, -1658253539,
+                             1738831511, -1035863430,  -773019134,  -949374168),
+      simde_mm512_set_epi32( -204850270,  1483213179,   570529393,  1502527466,
+                              577201983,  -432703292,  1192470968,  1720179563,
+                             1849590724,  -559621757,  -359569463, -1703134874,
+                             -458048814,  1675182569,   326413788,  -135665601),
+      simde_mm512_set_epi32( -885306278,  1455617354, -1041052697,    49928255,
+                             1807777004,  1581006434, -1459688627,  -409831699,
+                              921203121,   948794586,   228344504,   933578883,
+                             1280782697,   639319139,  -446605346, -1085039769) },
+    { simde_mm512_set_epi32( 1183693655,  1498354285,  -962167552, -1275486532,
+                             1360737168,  -311768414,   830509493, -1232936501,
+                             -935930079,  1282578332,   334610609,  2016253600,
+                              193638493, -1932836054,   490336860,   529322910),
+      simde_mm512_set_epi32(-1567017534,  1079776012,  1558118810,  2037115285,
+                             -379373658,  1323630404, -1001160009,  1486017577,
+                             1970317028,   301341712, -1543435953,   702060283,
+                            -1644796775,   -72481548, -1431302686,  1782132537),
+      simde_mm512_set_epi32( -383323879, -1716836999,   595951258,   761628753,
+                              981363510,  1011861990,  -170650516,   253081076,
+                             1034386949,  1583920044, -1208825344, -1576653413,
+                            -1451158282, -2005317602,  -940965826, -1983511849) },
+    { simde_mm512_set_epi32(-1767025239,  1718179688,  2097365993,  1980423479,
+                             1342712331,   935235000,  1127711169, -1151131533,
+                            -1922269908,  1982592299,  1011656497,  -752678050,
+                              300391966, -1504659592,   637019836,  -539122106),
+      simde_mm512_set_epi32( -955685215,  -781654037, -1407415557,  2004918004,
+                             -198864503,   245674448,   869396941,  1429965134,
+                             1758141637,  -862266657,  1391789743, -1011629139,
+                             1735226247,   -71612868, -1290940329,  -692126085),
+      simde_mm512_set_epi32( 1572256842,   936525651,   689950436,  -309625813,
+                             1143847828,  1180909448,  1997108110,   278833601,
+                             -164128271,  1120325642, -1891521056, -1764307189,
+                             2035618213, -1576272460,  -653920493, -1231248191) },
+    { simde_mm512_set_epi32( -188858355,   783550841,  1297946125,   690987080,
+                             -902557803,  -974217727,  1311758542,  1114164940,
+                            -1278560700, -1510316403,  1379398407,  2102747623,
+                            -1349978049,  1538525967,   658276228,   207505227),
+      simde_mm512_set_epi32(   26398131, -1554138074, -1745835342, -1170167525,
+                              496859987,  1698030903,   866774568,   351669045,
+                             1570249895, -2021106510,  -961851294,  1418267815,
+                             1869010060,  -949267815, -1012648606,  -514719873),
+      simde_mm512_set_epi32( -162460224,  -770587233,  -447889217,  -479180445,
+                             -405697816,   723813176, -2116434186,  1465833985,
+                              291689195,   763544383,   417547113,  -773951858,
+                              519032011,   589258152,  -354372378,  -307214646) },
+    { simde_mm512_set_epi32(  931387587,  2052253836,  1399021528, -1205273572,
+                             1667508222,  1256418937, -1631810501,  1712759731,
+                              744526759,  -808619790,  1082255247,  -413058256,
+                            -1545876760,  1872247385,  1688029598,   386781706),
+      simde_mm512_set_epi32( 1928206671,  2078139560,   -30275272,   851518371,
+                             1924311453, -1122264150,  1853782007,   -66836922,
+                             1178959507,  -914358104,   310529015,  -974990436,
+                              265255363,    46123020,   675519348,   394557271),
+      simde_mm512_set_epi32(-1435373038,  -164573900,  1368746256,  -353755201,
+                             -703147621,   134154787,   221971506,  1645922809,
+                             1923486266, -1722977894,  1392784262, -1388048692,
+                            -1280621397,  1918370405, -1931418350,   781338977) },
+    { simde_mm512_set_epi32( 1605924073,  -579687458,  -152679255,  1555388312,
+                              538206842, -2090698414,  -613041359,  1120998307,
+                              -93826524,   484516214,  -249212192,  -568250917,
+                             -516719565, -1210708615,  2056310558,  -463203352),
+      simde_mm512_set_epi32( -596179147,     9538632,  -426490135, -1561047438,
+                            -1037539631,  -642500485, -1935393123,   323338036,
+                              755842503, -1433489493,  -429548599,  1022837452,
+                             2122282392, -1245313417,  -497840676,  1226886909),
+      simde_mm512_set_epi32( 1009744926,  -570148826,  -579169390,    -5659126,
+                             -499332789,  1561768397,  1746532814,  1444336343,
+                              662015979,  -948973279,  -678760791,   454586535,
+                             1605562827,  1838945264,  1558469882,   763683557) },
+    { simde_mm512_set_epi32(-1216333211, -1558331954,  1742904494,   561855705,
+                            -1847934145, -1655325063,  -743536627, -2107724544,
+                              257775893, -1273517726,  -590491367, -1459570247,
+                             -722913299, -1054987989, -1562623106,   264478908),
+      simde_mm512_set_epi32(  182420894, -1931036391,  -987691786,  -378147076,
+                              535194343,  -525188838, -1435515439,  -898215909,
+                            -1618321384,   214389946, -1710516800,  -783843966,
+                              348284232,  1671771117, -1359268930,   394903542),
+      simde_mm512_set_epi32(-1033912317,   805598951,   755212708,   183708629,
+                            -1312739802,  2114453395,  2115915230,  1289026843,
+                            -1360545491, -1059127780,  1993959129,  2051553083,
+                             -374629067,   616783128,  1373075260,   659382450) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_add_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_add_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 3750196192501047569), INT64_C( 6287230239399680168),
+                            INT64_C( 6179597534942410424), INT64_C(  333596663075571681),
+                            INT64_C( 1154111112410446777), INT64_C(-3667197126362924481),
+                            INT64_C( 5142661707219720589), INT64_C( 4968829795462841469)),
+      simde_mm512_set_epi64(INT64_C( -653875549282842857), INT64_C( 4882994046181898233),
+                            INT64_C( 2615605095763017057), INT64_C( 5596268675965987750),
+                            INT64_C( 3827207677150570847), INT64_C(-5900000431010085006),
+                            INT64_C(-7946577756895753363), INT64_C(-5317683929105041471)),
+      simde_mm512_set_epi64(INT64_C( 3096320643218204712), INT64_C(-7276519788127973215),
+                            INT64_C( 8795202630705427481), INT64_C( 5929865339041559431),
+                            INT64_C( 4981318789561017624), INT64_C( 8879546516336542129),
+                            INT64_C(-2803916049676032774), INT64_C( -348854133642200002)) },
+    { simde_mm512_set_epi64(INT64_C( 5208189116215325173), INT64_C(-5819902545325254339),
+                            INT64_C( 7384881840099963301), INT64_C(-4281553793796622660),
+                            INT64_C(-8091267207610691252), INT64_C(-3742375416971520354),
+                            INT64_C( 3711621816085609031), INT64_C( 3161228725998701478)),
+      simde_mm512_set_epi64(INT64_C( -561390283070179136), INT64_C( 4789549096436071199),
+                            INT64_C( 2849876668747697677), INT64_C(-9038550319126205868),
+                            INT64_C(  708420059460173548), INT64_C( 8069116679647674487),
+                            INT64_C( 4091471778546810381), INT64_C(-6897458702541690290)),
+      simde_mm512_set_epi64(INT64_C( 4646798833145146037), INT64_C(-1030353448889183140),
+                            INT64_C(-8211985564861890638), INT64_C( 5126639960786723088),
+                            INT64_C(-7382847148150517704), INT64_C( 4326741262676154133),
+                            INT64_C( 7803093594632419412), INT64_C(-3736229976542988812)) },
+    { simde_mm512_set_epi64(INT64_C( 8021094725646257762), INT64_C(  604899011619034360),
+                            INT64_C(-8573688649032144265), INT64_C(-6032450758809857177),
+                            INT64_C( 5906600025523308427), INT64_C( -697114843270862701),
+                            INT64_C( -514393457865895719), INT64_C(-1615465594915187459)),
+      simde_mm512_set_epi64(INT64_C(-7435207910129919966), INT64_C( 7389693186148018737),
+                            INT64_C( 4791726662214646094), INT64_C(-5607828731185914629),
+                            INT64_C( 8930735599577334620), INT64_C( 1981292778914340722),
+                            INT64_C( 8669170832803906902), INT64_C( 7947467476381412008)),
+      simde_mm512_set_epi64(INT64_C(  585886815516337796), INT64_C( 7994592197767053097),
+                            INT64_C(-3781961986817498171), INT64_C( 6806464583713779810),
+                            INT64_C(-3609408448608908569), INT64_C( 1284177935643478021),
+                            INT64_C( 8154777374938011183), INT64_C( 6332001881466224549)) },
+    { simde_mm512_set_epi64(INT64_C( 8841898196903058757), INT64_C( 4440385895571682514),
+                            INT64_C(-4196358142074385304), INT64_C( 2475924432007611617),
+                            INT64_C(-9201555782576738429), INT64_C( 1166328906840630450),
+                            INT64_C( 3720696537805509074), INT64_C( 5535829456944497854)),
+      simde_mm512_set_epi64(INT64_C(-3502297998383533227), INT64_C( 6919147580408825507),
+                            INT64_C( 9190454855619072434), INT64_C(-1425845883655247443),
+                            INT64_C( 2458357720825454928), INT64_C( 3503828901323288445),
+                            INT64_C( 8486635711465013955), INT64_C(-7998265793301256626)),
+      simde_mm512_set_epi64(INT64_C( 5339600198519525530), INT64_C(-7087210597729043595),
+                            INT64_C( 4994096713544687130), INT64_C( 1050078548352364174),
+                            INT64_C(-6743198061751283501), INT64_C( 4670157808163918895),
+                            INT64_C(-6239411824439028587), INT64_C(-2462436336356758772)) },
+    { simde_mm512_set_epi64(INT64_C( 8996887910973395001), INT64_C(-7582038411997789802),
+                            INT64_C( 4921882369770528658), INT64_C(-6513116793647148216),
+                            INT64_C(-5385179582468926210), INT64_C( 7681169428067883122),
+                            INT64_C( 5067547908483876419), INT64_C(-6938468746050389066)),
+      simde_mm512_set_epi64(INT64_C(-6466664633534435069), INT64_C( 8142456605082126631),
+                            INT64_C(-9177436016578376820), INT64_C(-1482085652164744069),
+                            INT64_C( 2944124298968736776), INT64_C( 5492099368723846925),
+                            INT64_C(-7448330867555937871), INT64_C( 2719571292922286701)),
+      simde_mm512_set_epi64(INT64_C( 2530223277438959932), INT64_C(  560418193084336829),
+                            INT64_C(-4255553646807848162), INT64_C(-7995202445811892285),
+                            INT64_C(-2441055283500189434), INT64_C(-5273475276917821569),
+                            INT64_C(-2380782959072061452), INT64_C(-4218897453128102365)) },
+    { simde_mm512_set_epi64(INT64_C(-4260308388620590387), INT64_C( 4504626200240094894),
+                            INT64_C( 4436448278033086392), INT64_C(-6247804572393077072),
+                            INT64_C( 7671049105804187419), INT64_C( 8832797013995634868),
+                            INT64_C(-6978994800826015391), INT64_C( -699964418482500940)),
+      simde_mm512_set_epi64(INT64_C( 1804155882476306709), INT64_C(-1448680986917466128),
+                            INT64_C( 3613616262354239039), INT64_C(-3781610043454859355),
+                            INT64_C( -797074186611032024), INT64_C( 7628696851194005954),
+                            INT64_C(-1406967929844763285), INT64_C(-8659346573370273120)),
+      simde_mm512_set_epi64(INT64_C(-2456152506144283678), INT64_C( 3055945213322628766),
+                            INT64_C( 8050064540387325431), INT64_C( 8417329457861615189),
+                            INT64_C( 6873974919193155395), INT64_C(-1985250208519910794),
+                            INT64_C(-8385962730670778676), INT64_C( 9087433081856777556)) },
+    { simde_mm512_set_epi64(INT64_C( -851993960423268837), INT64_C( 3953754838043067426),
+                            INT64_C( 7459515412193594002), INT64_C( 4486641624805749230),
+                            INT64_C(-4247139444805533084), INT64_C(-7701068434080857749),
+                            INT64_C(-1483298961488349248), INT64_C( 1814364407220122554)),
+      simde_mm512_set_epi64(INT64_C(-7425737745388137680), INT64_C( 3516273874537880411),
+                            INT64_C(-1796505339865142348), INT64_C( 5260005821319729077),
+                            INT64_C( 6283525896183284932), INT64_C(-8106271530573639080),
+                            INT64_C(-2894374354403455067), INT64_C(-6994487636800148254)),
+      simde_mm512_set_epi64(INT64_C(-8277731705811406517), INT64_C( 7470028712580947837),
+                            INT64_C( 5663010072328451654), INT64_C(-8700096627584073309),
+                            INT64_C( 2036386451377751848), INT64_C( 2639404109055054787),
+                            INT64_C(-4377673315891804315), INT64_C(-5180123229580025700)) },
+    { simde_mm512_set_epi64(INT64_C(-6534394317531721631), INT64_C(-7919606094808757086),
+                            INT64_C( 6004123016287853096), INT64_C( 8569394771410317585),
+                            INT64_C(-8007948119638645500), INT64_C( -169775010619688646),
+                            INT64_C(-8226313324759432030), INT64_C(-1718591896349476167)),
+      simde_mm512_set_epi64(INT64_C(-5626756206818736694), INT64_C( 3854867307962449202),
+                            INT64_C( 6262952975071584483), INT64_C( 3577345743748178142),
+                            INT64_C(-3909775221303485037), INT64_C(-1454098485465188970),
+                            INT64_C( 3479122396695786686), INT64_C(-1044618360778931222)),
+      simde_mm512_set_epi64(INT64_C( 6285593549359093291), INT64_C(-4064738786846307884),
+                            INT64_C(-6179668082350114037), INT64_C(-6300003558551055889),
+                            INT64_C( 6529020732767421079), INT64_C(-1623873496084877616),
+                            INT64_C(-4747190928063645344), INT64_C(-2763210257128407389)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_add_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_add_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(   380.05,   -510.14,    -44.80,   -498.89,
+                           -889.35,   -372.73,   -693.29,    966.82),
+      simde_mm512_set_pd(   104.43,    498.48,    830.61,    920.93,
+                              8.12,     -8.61,   -898.97,   -613.97),
+      simde_mm512_set_pd(   484.48,    -11.66,    785.81,    422.04,
+                           -881.23,   -381.34,  -1592.26,    352.85) },
+    { simde_mm512_set_pd(   460.02,   -479.86,   -371.36,   -841.97,
+                           -151.54,   -763.55,   -120.79,    905.42),
+      simde_mm512_set_pd(    93.26,    404.78,    667.86,    800.68,
+                            404.99,    627.13,    286.21,   -803.69),
+      simde_mm512_set_pd(   553.28,    -75.08,    296.50,    -41.29,
+                            253.45,   -136.42,    165.42,    101.73) },
+    { simde_mm512_set_pd(  -375.12,   -304.97,    862.22,    552.92,
+                            811.01,    187.23,    803.55,    428.70),
+      simde_mm512_set_pd(   648.79,    819.85,    253.62,    426.29,
+                            369.78,   -946.93,   -840.04,   -772.78),
+      simde_mm512_set_pd(   273.67,    514.88,   1115.84,    979.21,
+                           1180.79,   -759.70,    -36.49,   -344.08) },
+    { simde_mm512_set_pd(   -11.22,   -238.15,   -155.67,    625.23,
+                           -824.83,   -369.83,    130.99,   -916.32),
+      simde_mm512_set_pd(   493.94,   -544.25,   -525.32,    837.15,
+                           -363.96,    378.15,   -575.07,   -266.77),
+      simde_mm512_set_pd(   482.72,   -782.40,   -680.99,   1462.38,
+                          -1188.79,      8.32,   -444.08,  -1183.09) },
+    { simde_mm512_set_pd(  -367.23,     97.31,   -927.98,   -606.55,
+                            704.98,   -955.73,    243.85,   -531.64),
+      simde_mm512_set_pd(   110.29,    215.40,    235.90,   -102.52,
+                            930.55,   -100.03,   -941.04,    835.46),
+      simde_mm512_set_pd(  -256.94,    312.71,   -692.08,   -709.07,
+                           1635.53,  -1055.76,   -697.19,    303.82) },
+    { simde_mm512_set_pd(  -943.12,   -980.68,    706.93,    409.17,
+                            814.13,    317.01,   -468.30,     -1.63),
+      simde_mm512_set_pd(   823.95,    320.05,    594.91,    234.91,
+                             60.49,    602.58,   -195.08,   -372.82),
+      simde_mm512_set_pd(  -119.17,   -660.63,   1301.84,    644.08,
+                            874.62,    919.59,   -663.38,   -374.45) },
+    { simde_mm512_set_pd(   207.83,     74.36,    947.05,    -92.85,
+                           -921.32,    524.53,   -956.40,   -662.74),
+      simde_mm512_set_pd(   483.69,   -641.13,    830.61,   -236.38,
+                           -699.24,    898.48,   -889.18,   -109.37),
+      simde_mm512_set_pd(   691.52,   -566.77,   1777.66,   -329.23,
+                          -1620.56,   1423.01,  -1845.58,   -772.11) },
+    { simde_mm512_set_pd(  -323.59,    237.24,     78.03,    524.65,
+                           -152.21,    633.82,    854.50,    208.47),
+      simde_mm512_set_pd(   263.36,    -64.39,    884.93,    531.06,
+                            734.78,    -16.45,    -65.17,    791.11),
+      simde_mm512_set_pd(   -60.23,    172.85,    962.96,   1055.71,
+                            582.57,    617.37,    789.33,    999.58) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_add_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_add_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(  -102.95f,   -184.47f,   -279.49f,    310.07f,
+                           -654.34f,    552.32f,   -788.29f,     87.50f,
+                            185.15f,    622.63f,    992.04f,    -25.07f,
+                            382.89f,    124.56f,    415.69f,   -799.02f),
+      simde_mm512_set_ps(  -169.25f,   -704.58f,    269.39f,   -297.77f,
+                            423.58f,    822.53f,   -851.77f,    342.70f,
+                             22.51f,     58.10f,    914.35f,    -20.08f,
+                           -709.12f,   -166.45f,   -236.13f,   -240.91f),
+      simde_mm512_set_ps(  -272.20f,   -889.05f,    -10.10f,     12.30f,
+                           -230.76f,   1374.85f,  -1640.06f,    430.20f,
+                            207.66f,    680.73f,   1906.39f,    -45.15f,
+                           -326.23f,    -41.89f,    179.56f,  -1039.93f) },
+    { simde_mm512_set_ps(  -864.68f,   -611.78f,   -662.90f,    884.25f,
+                           -391.28f,   -589.58f,    257.07f,   -990.61f,
+                           -331.20f,    468.46f,   -655.30f,    511.12f,
+                            878.39f,   -590.92f,   -321.72f,    257.83f),
+      simde_mm512_set_ps(  -909.98f,   -359.51f,   -847.47f,     78.12f,
+                            182.19f,   -240.60f,    739.10f,   -144.16f,
+                            507.27f,    173.74f,    456.57f,   -358.46f,
+                            560.22f,   -479.40f,    216.09f,    229.50f),
+      simde_mm512_set_ps( -1774.66f,   -971.29f,  -1510.37f,    962.37f,
+                           -209.09f,   -830.18f,    996.17f,  -1134.77f,
+                            176.07f,    642.20f,   -198.73f,    152.66f,
+                           1438.61f,  -1070.32f,   -105.63f,    487.33f) },
+    { simde_mm512_set_ps(  -785.92f,   -148.14f,   -391.77f,   -783.06f,
+                            618.32f,   -544.75f,    274.65f,   -210.51f,
+                            740.86f,    790.05f,      3.68f,   -540.02f,
+                             49.53f,   -411.65f,    244.67f,    878.27f),
+      simde_mm512_set_ps(   686.33f,    665.35f,    650.32f,   -452.32f,
+                            778.83f,    605.63f,   -416.44f,    266.02f,
+                           -771.48f,   -133.09f,   -462.68f,    881.29f,
+                            688.89f,   -937.13f,    807.51f,   -920.19f),
+      simde_mm512_set_ps(   -99.59f,    517.21f,    258.55f,  -1235.38f,
+                           1397.15f,     60.88f,   -141.79f,     55.51f,
+                            -30.62f,    656.96f,   -459.00f,    341.27f,
+                            738.42f,  -1348.78f,   1052.18f,    -41.92f) },
+    { simde_mm512_set_ps(   178.84f,    175.11f,   -206.08f,   -981.70f,
+                            386.74f,      8.51f,   -942.12f,    119.56f,
+                            548.76f,   -864.05f,   -967.17f,   -655.72f,
+                            977.46f,   -800.94f,    817.75f,    652.21f),
+      simde_mm512_set_ps(   403.02f,   -401.51f,    422.09f,    946.10f,
+                           -670.47f,   -649.93f,    938.95f,    553.28f,
+                           -593.88f,   -272.16f,    234.21f,   -972.14f,
+                            985.57f,    299.01f,   -207.97f,   -811.35f),
+      simde_mm512_set_ps(   581.86f,   -226.40f,    216.01f,    -35.60f,
+                           -283.73f,   -641.42f,     -3.17f,    672.84f,
+                            -45.12f,  -1136.21f,   -732.96f,  -1627.86f,
+                           1963.03f,   -501.93f,    609.78f,   -159.14f) },
+    { simde_mm512_set_ps(  -181.51f,   -608.70f,    272.02f,    468.45f,
+                            892.16f,    786.04f,    -80.64f,    371.02f,
+                            489.66f,   -426.40f,   -425.69f,   -625.55f,
+                            -40.50f,    737.83f,   -125.21f,    121.10f),
+      simde_mm512_set_ps(   171.14f,   -939.55f,   -873.64f,     30.67f,
+                            -65.42f,    561.77f,    -34.30f,   -903.38f,
+                             49.95f,    131.36f,   -480.21f,    913.53f,
+                           -886.88f,   -304.07f,   -538.00f,   -473.23f),
+      simde_mm512_set_ps(   -10.37f,  -1548.25f,   -601.62f,    499.12f,
+                            826.74f,   1347.81f,   -114.94f,   -532.36f,
+                            539.61f,   -295.04f,   -905.90f,    287.98f,
+                           -927.38f,    433.76f,   -663.21f,   -352.13f) },
+    { simde_mm512_set_ps(  -540.81f,   -276.01f,    375.33f,   -579.53f,
+                           -857.61f,    392.47f,    433.73f,   -233.26f,
+                             24.56f,    926.85f,    800.42f,    674.92f,
+                           -558.96f,   -507.94f,   -534.18f,     57.15f),
+      simde_mm512_set_ps(   598.15f,    536.94f,    445.20f,   -265.84f,
+                           -539.43f,    441.84f,    846.32f,    338.08f,
+                            -26.96f,   -467.13f,   -884.53f,    -67.02f,
+                            -63.06f,    483.64f,   -726.38f,    501.35f),
+      simde_mm512_set_ps(    57.34f,    260.93f,    820.53f,   -845.37f,
+                          -1397.04f,    834.31f,   1280.05f,    104.82f,
+                             -2.40f,    459.72f,    -84.11f,    607.90f,
+                           -622.02f,    -24.30f,  -1260.56f,    558.50f) },
+    { simde_mm512_set_ps(   328.92f,   -611.61f,   -649.12f,   -164.07f,
+                           -156.96f,    474.73f,   -472.38f,    909.27f,
+                           -535.58f,   -818.09f,    592.48f,   -179.10f,
+                            493.35f,    869.83f,   -890.70f,    162.47f),
+      simde_mm512_set_ps(   262.91f,    991.60f,   -405.90f,   -562.64f,
+                            860.70f,   -532.77f,    505.16f,    790.05f,
+                            193.84f,    483.94f,    270.01f,   -160.30f,
+                            710.76f,    210.74f,   -974.64f,    938.44f),
+      simde_mm512_set_ps(   591.83f,    379.99f,  -1055.02f,   -726.71f,
+                            703.74f,    -58.04f,     32.78f,   1699.32f,
+                           -341.74f,   -334.15f,    862.49f,   -339.40f,
+                           1204.11f,   1080.57f,  -1865.34f,   1100.91f) },
+    { simde_mm512_set_ps(   349.18f,   -356.70f,   -298.37f,    183.68f,
+                           -295.45f,    851.15f,    686.68f,   -831.77f,
+                           -546.53f,    -11.64f,    897.87f,   -735.12f,
+                            108.90f,   -121.59f,    604.79f,   -649.87f),
+      simde_mm512_set_ps(  -939.75f,     34.29f,    -10.10f,    422.63f,
+                           -154.14f,    749.53f,   -683.72f,     57.90f,
+                            752.00f,    712.51f,    151.70f,   -681.22f,
+                           -119.87f,     41.53f,    259.96f,   -160.71f),
+      simde_mm512_set_ps(  -590.57f,   -322.41f,   -308.47f,    606.31f,
+                           -449.59f,   1600.68f,      2.96f,   -773.87f,
+                            205.47f,    700.87f,   1049.57f,  -1416.34f,
+                            -10.97f,    -80.06f,    864.75f,   -810.58f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_add_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_and_si512(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( 1892327110,   103779545,   401288039,  1604744152,
+                              274233281,  1467291224,  -186686825,  1258413072,
+                             -647018496,  -322202808,   302152658, -1476448344,
+                              483160139,   663807490, -1454696694,   553044989),
+      simde_mm512_set_epi32(  212860878,   145686253,   364594388,   418546062,
+                              427390866,  -559896750,  -148672814,  1204602110,
+                            -1120100199, -1632924331,   759078793,  1498112528,
+                              951052766,   581200861,  1235209277,  -790774872),
+      simde_mm512_set_epi32(    9084614,     3050697,   363528260,   413270408,
+                              274233216,  1444939344,  -201104750,  1124123664,
+                            -1725169664, -1937014464,      138112,    21701120,
+                              411852874,   578839040,   151716872,    13929384) },
+    { simde_mm512_set_epi32( -700943367,   195877659,   573448281,  2000705032,
+                              825531890, -1130977412,   386162255, -1451535985,
+                              618996806,  -430172808,  2002224555,  1082432112,
+                            -1352385828, -1967796187,   500355746,  -924200576),
+      simde_mm512_set_epi32( -109401555, -1764312888,  1672443462, -1788572952,
+                              309527655, -1226010319,   904417883,  -403108538,
+                             2136006211,  1924195720,   266887999,  -522469201,
+                              186089333,   -23356485,  1833616803,  -544289453),
+      simde_mm512_set_epi32( -801627607,    42244104,   573448256,   356516360,
+                              271582306, -1266384592,   352342603, -1585905402,
+                              608175170,  1645217032,   121635115,  1082163232,
+                              184826452, -1970171871,   222478498,  -930561792) },
+    { simde_mm512_set_epi32( -456554502,   353642189,   597976130, -1534245465,
+                             -540267693,  1329071379,   968544433,  -341680988,
+                            -1668103428, -1203916306, -1208368183,  -945956109,
+                            -1714538674,  1918852179, -1067676991,  -849619240),
+      simde_mm512_set_epi32( -805788444, -1816327777,  1752152362, -1369123580,
+                            -1992064690, -1765554125,  1351970650, -2083690966,
+                            -1619238810, -1654606655,  1463094214,  -827746092,
+                             1034044812, -1193799574,  1045163164, -1255286533),
+      simde_mm512_set_epi32( -993491744,   286523533,   539238402, -1543224060,
+                            -1992294078,   100663315,   277889040, -2088745952,
+                            -1676656540, -1742688064,   389088192,  -964060976,
+                              427951372,   811077698,     4753536, -2062954280) },
+    { simde_mm512_set_epi32( -929540032, -2036640602,   299621227,  -251002194,
+                             1781091159, -1981335277, -1416041207,   249932516,
+                              905209767,  1304737773,   212553764,  1979599464,
+                             -600275458,  1832802890,  1497028584, -1561684171),
+      simde_mm512_set_epi32(  833135578,  1499140649,  -175729933,  1498018547,
+                            -1276808023,  -971469903, -2120127925,  -426357417,
+                              232454375,    65897045,  -421740134,  -714188990,
+                            -2023311003, -1006790581,  -112514601,  1341482366),
+      simde_mm512_set_epi32(    8912960,     1773600,   293769827,  1359479458,
+                              572604417, -2147481327, -2122291191,   109316164,
+                               97542311,    29655621,    76038144,  1433289280,
+                            -2078244508,  1094457418,  1493828032,    48235828) },
+    { simde_mm512_set_epi32( 1685903714, -1535820611,   171559167, -1342216375,
+                            -1670205801, -1431177609,  -470592357, -1193676377,
+                             1559624828,  -298929903, -1144927108, -1796873233,
+                            -1793732042,   -81194338,   393545092, -1539381986),
+      simde_mm512_set_epi32( -248670967,  1218020457,  -961192436,  -874156557,
+                             2070150147, -1931169329,   547155264,  1168402441,
+                             1920460856, -1954431731, -1999142287,    41354281,
+                             1537378353, -1824656196,   970582120, -1928679597),
+      simde_mm512_set_epi32( 1613533440,     1115177,    36784140, -1947900607,
+                              409119747, -2002735033,   546325504,     8413185,
+                             1349904440, -1979666175, -2000584592,     6619177,
+                              285245488, -1826025316,   290521088, -2079677166) },
+    { simde_mm512_set_epi32(   39562098,  -498973108, -1893445578, -1069017774,
+                             1593747215, -1626992900,  1067808874, -1808733516,
+                             1648346319,   910246929,  1407713866, -1002226582,
+                             1680384358, -1647582291,  -157328470,  -565302935),
+      simde_mm512_set_epi32( -822177107,  -743071703,  -330054034, -1486235983,
+                              -35033143,    55036453, -1934068347,  -104733590,
+                            -1521245019,  1710025286,  1117063612, -1739463994,
+                            -1275302859, -1897268267,   770355706,  1758840019),
+      simde_mm512_set_epi32(   39485984, -1040187384, -1946140634, -2142759920,
+                             1558718217,    50727460,   211841024, -1878990816,
+                              538150021,   608190464,  1115684872, -2143215550,
+                              539500580, -1932926075,   613028266,  1212416065) },
+    { simde_mm512_set_epi32(  502398732, -1886147983,  -601387697, -1845974098,
+                            -1024346447, -1407820826,   609891671, -1650369864,
+                            -1035998795,   547614754,   308823182,  -175209021,
+                              784217609, -1233525625,   168517723,   701531994),
+      simde_mm512_set_epi32(-1490550113,   245356719, -1124699977,   847768511,
+                              -10360787, -1260078602,  1560851003,  -903868606,
+                            -1376712711, -1422030660, -1451699317,   966385669,
+                             -199132678,  -193096358,  1872163111, -1967812530),
+      simde_mm512_set_epi32(   85983756,   244549665, -1675231225,   276868014,
+                            -1033789407, -1543235098,    67645459, -2011166208,
+                            -2144271951,   539066400,     6832266,   831029249,
+                              606089224, -1267104766,   167927811,   143687754) },
+    { simde_mm512_set_epi32(  386699311,  -547329959,   598135894,  -302430389,
+                             1024057333,  1086462064, -1247208517,    76626283,
+                             1890103850,  -764045856,   743099355,  1475149665,
+                            -1530382371,   976477870, -1874833365,   441249230),
+      simde_mm512_set_epi32(  319830139,   887578584,   966747192,  1637630311,
+                            -1208917749, -1321539690,  -125200516,   645117416,
+                            -1749055774,   957373254,  1095499719,  -485426413,
+                              352297577,  1419714114,  -860712972,   281320817),
+      simde_mm512_set_epi32(  318771243,   341854296,   562447376,  1637368131,
+                              889274625,      131088, -1333193928,    68235624,
+                              279478818,   269488448,     4901827,  1124137729,
+                               80224841,   269688322, -2147483616,   272928064) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_and_si512(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_andnot_si512(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(-1946187176,   266500871,    27076093, -2071162058,
+                            -2048404626,   737948932,  -401709157, -1935102674,
+                             1393297030,  -745438435,   698266920,  -786678650,
+                             1167132169,   480781145,  -350423575, -1277293496),
+      simde_mm512_set_epi32(  410944594,  1468796572, -1666186055,  -496869674,
+                              495913260,  -908866130,  1422304599,  1091072580,
+                             1383252300, -2103484662, -1544270599,  1134159713,
+                             1860330764,   275348005,   270556777,   390023434),
+      simde_mm512_set_epi32(  268436482,  1342964888, -1675624448,  1650609344,
+                              403179520, -1073493846,   348160068,  1090540096,
+                                7520584,      941058, -2107619119,    42058593,
+                              711090436,     4282404,   270535168,    69288194) },
+    { simde_mm512_set_epi32(  768042720,  -968323784, -1351523691, -1299550173,
+                             1711895905,   517892253,  1529196490,   294325445,
+                             -444061427,  1413604512, -1034815891,  -733401106,
+                             -686576687,  -513428216, -1120279976,   245312201),
+      simde_mm512_set_epi32(-1046747205, -1258125464,  -231852408,  1937736942,
+                              917503816, -1233647910, -1105693070,   384771206,
+                              182278073,   841973094,  1982443238,  -353604219,
+                            -1440526728, -1211553009,  -318582195,  -240359020),
+      simde_mm512_set_epi32(-1072135909,   822215232,  1343099912,  1098220748,
+                              279349768, -1608513982, -1541910480,   107225090,
+                              173364912,   573446470,   875038850,   715407361,
+                              673203240,   378014215,  1073876997,  -249544428) },
+    { simde_mm512_set_epi32(  135959764,  -636210358, -1574784604,   768687507,
+                            -1754294863,  1612769837, -1110718043, -1826019395,
+                            -1416246095,   -38362172,  1605107770, -1010849623,
+                              328072800, -1711881653,   924536921, -2017616215),
+      simde_mm512_set_epi32( -646827417,  -419799401,   769940786,   405382057,
+                            -1346593957,   937189883,    29913782,  1264809823,
+                              339418157, -2107726175, -1297153919,  -911241606,
+                            -1171670063, -1237142735,    25638768,    69160696),
+      simde_mm512_set_epi32( -782228957,   619334805,   230968338,   271090216,
+                              680528458,   400294354,       12818,  1212305474,
+                              338300940,    38274081, -1610415999,   134219346,
+                            -1474297455,   637546800,     8660768,      147536) },
+    { simde_mm512_set_epi32(  917329380,  1935576435,  1353896725,  1105943253,
+                              -33301402, -1248408967,  1439136952,  1016191074,
+                              433568391,   226236675, -1428411970,  -263487019,
+                             1550954487,   697208183,  1549230455,  -795020494),
+      simde_mm512_set_epi32( 2091739646,  1137285604,  -958689045,    40341384,
+                            -1061940838,  -221642190,  1808942799, -1676138838,
+                             -957933880,  -199427407,  -415120152,   304335802,
+                             -723774098,  -824510853, -1768014481,  1542213130),
+      simde_mm512_set_epi32( 1207969818,     8458372, -2042035990,    33850632,
+                               11796888,  1112014850,   705692231, -2146949496,
+                             -970980280,  -268377424,  1157743680,    35670570,
+                            -2138304504,  -967806456, -2105009144,   190843912) },
+    { simde_mm512_set_epi32( -189882830,  -953494642,   663557010,    11921398,
+                             -748662141,  -452165295,   969171118, -2053292321,
+                              357012846, -1951059192,   484933375,   654880251,
+                             -336121287,  -236672883,  1861336414,  1680236889),
+      simde_mm512_set_epi32(  -51292923, -1024809403, -1280832315,   -70240598,
+                            -1207642260,   232299828,  -549232156,  2088374483,
+                            -1444576488,   146034286,  -250319908,  -889783424,
+                              623394211, -1245685302,  -373699599,   899335800),
+      simde_mm512_set_epi32(  139542789,    12592193, -1876947899,   -79687672,
+                              671384940,   147856420,  -972881600,  2019688448,
+                            -1465908720,       19558,  -519044864,  -923381248,
+                               67636610,    67129666, -2130165087,   295208480) },
+    { simde_mm512_set_epi32(  790503227,   841167693,  -221609701, -1537363222,
+                            -1464210628, -1375469591, -1540134970,   -90909047,
+                              639816045,   181288872,   340463217,   830715338,
+                             1711253190, -1219951248,   509700335, -1643248050),
+      simde_mm512_set_epi32(-1397601503,   891487257,  -759091845,  -265133231,
+                             1457375815,  -217704586, -1077082198,   607749685,
+                            -1042192739, -1055633264,  -171788396,  -807597641,
+                            -1178251233,  -379180919,     9118806, -1535831344),
+      simde_mm512_set_epi32(-2136981504,    83887120,       76896,  1344422161,
+                             1447297091,  1359216662,   466354216,    69795892,
+                            -1044306288, -1055899632,  -511659644,  -832829387,
+                            -1744809959,  1210460297,     9045008,   544280720) },
+    { simde_mm512_set_epi32(  696580981, -1892782678,   858260854, -1597585809,
+                             -124633591,   548653929,   321318779,  -569110534,
+                             1559547385,  1829635129, -1227707361, -1256595389,
+                              916268312,  1680691211,  1115516849,  -987561235),
+      simde_mm512_set_epi32( -386095375, -1259512089,  -853294643,  -123812755,
+                             -207187117,    43225406,  -177186465,  -657215674,
+                            -1895762559,  1526098612, -1738974118,  -554701991,
+                             -636296733,  1398972838,  1847895663,  1191043404),
+      simde_mm512_set_epi32(-1065876352,   817959493,  -872169335,  1477967872,
+                               52724050,    33558550,  -464515068,    12820484,
+                            -2097139712,   317745796,   134828096,  1256590104,
+                             -939343645,   323133860,   738230350,    48029952) },
+    { simde_mm512_set_epi32(-1849778539,  1195080057,   930035006, -1077266410,
+                            -1801940003,  1857623483, -1148254180,  -906153216,
+                             -451437132,   951968874,  -449206382,   596029657,
+                             -592023195, -1584774198,   427846512,    64524697),
+      simde_mm512_set_epi32( 1253516716,  1971472880,  -701723516,  1078673704,
+                             1036502700,  -535884187,  1410891826,  -535705633,
+                             1405241650,  1751918514,   457782574,   684896334,
+                             -762696259, -1681533261,  -965907794,  1217547372),
+      simde_mm512_set_epi32( 1241588008,   813695104, -1073706880,  1073824040,
+                              692536352, -2147087804,  1141932066,   536921311,
+                              314589186,  1077937040,   440406060,   139460614,
+                               34081944,   440767537,  -965934962,  1208110180) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_andnot_si512(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cmp_pd_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__mmask8 eq;
+    simde__mmask8 lt;
+    simde__mmask8 le;
+    simde__mmask8 neq;
+    simde__mmask8 nlt;
+    simde__mmask8 gt;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(   -84.55,     50.91,    -47.96,    -97.13,
+                             84.76,    -63.40,    -69.23,     73.05),
+      simde_mm512_set_pd(   -84.55,     50.91,    -47.96,    -86.15,
+                            -48.78,    -63.40,     23.31,     73.05),
+      UINT8_C(0xe5),
+      UINT8_C(0x12),
+      UINT8_C(0xf7),
+      UINT8_C(0x1a),
+      UINT8_C(0xed),
+      UINT8_C(0x08) },
+    { simde_mm512_set_pd(    30.36,    -16.63,     15.78,     -1.87,
+                             43.28,     72.32,     14.09,    -28.92),
+      simde_mm512_set_pd(    48.68,    -16.63,     15.78,      8.41,
+                             87.30,     72.32,     98.41,    -28.92),
+      UINT8_C(0x65),
+      UINT8_C(0x9a),
+      UINT8_C(0xff),
+      UINT8_C(0x9a),
+      UINT8_C(0x65),
+      UINT8_C(0x00) },
+    { simde_mm512_set_pd(   -21.82,    -62.96,      5.13,     89.10,
+                            -68.00,     11.92,    -77.96,     -9.63),
+      simde_mm512_set_pd(   -21.82,    -62.96,      5.13,     89.10,
+                            -68.00,    -86.46,    -77.96,     -9.63),
+      UINT8_C(0xfb),
+      UINT8_C(0x00),
+      UINT8_C(0xfb),
+      UINT8_C(0x04),
+      UINT8_C(0xff),
+      UINT8_C(0x04) },
+    { simde_mm512_set_pd(   -35.48,     16.85,     29.08,    -51.83,
+                              0.00,     89.63,     37.49,     30.40),
+      simde_mm512_set_pd(    89.37,    -56.46,     29.08,    -22.48,
+                            -10.18,     78.43,     37.49,     -6.19),
+      UINT8_C(0x22),
+      UINT8_C(0x90),
+      UINT8_C(0xb2),
+      UINT8_C(0xdd),
+      UINT8_C(0x6f),
+      UINT8_C(0x4d) },
+    { simde_mm512_set_pd(   -39.36,    -59.39,    -42.54,     -2.67,
+                            -11.36,     49.40,    -60.43,    -15.73),
+      simde_mm512_set_pd(    49.26,    -59.39,    -74.74,     -8.49,
+                            -47.53,     49.40,    -60.43,    -15.73),
+      UINT8_C(0x47),
+      UINT8_C(0x80),
+      UINT8_C(0xc7),
+      UINT8_C(0xb8),
+      UINT8_C(0x7f),
+      UINT8_C(0x38) },
+    { simde_mm512_set_pd(    94.49,     56.96,     49.07,    -17.92,
+                             42.83,    -43.62,     -1.24,      3.18),
+      simde_mm512_set_pd(   -89.93,     68.42,    -33.90,    -17.92,
+                             39.89,     21.78,     -1.24,      3.18),
+      UINT8_C(0x13),
+      UINT8_C(0x44),
+      UINT8_C(0x57),
+      UINT8_C(0xec),
+      UINT8_C(0xbb),
+      UINT8_C(0xa8) },
+    { simde_mm512_set_pd(   -18.93,     95.33,    -51.14,      1.14,
+                            -80.44,    -50.62,     11.40,    -16.26),
+      simde_mm512_set_pd(   -18.93,    -73.89,    -51.14,    -87.01,
+                            -80.44,     31.93,     11.40,    -16.26),
+      UINT8_C(0xab),
+      UINT8_C(0x04),
+      UINT8_C(0xaf),
+      UINT8_C(0x54),
+      UINT8_C(0xfb),
+      UINT8_C(0x50) },
+    { simde_mm512_set_pd(    24.27,    -30.60,      6.90,    -12.44,
+                             43.05,     -1.76,    -16.57,    -59.78),
+      simde_mm512_set_pd(    24.27,    -30.60,      6.90,     85.47,
+                            -59.01,     -1.76,    -16.57,    -59.78),
+      UINT8_C(0xe7),
+      UINT8_C(0x10),
+      UINT8_C(0xf7),
+      UINT8_C(0x18),
+      UINT8_C(0xef),
+      UINT8_C(0x08) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_uint8(simde_mm512_cmp_pd_mask(test_vec[i].a, test_vec[i].b, simde_CMP_EQ_OQ), ==, test_vec[i].eq);
+    munit_assert_uint8(simde_mm512_cmp_pd_mask(test_vec[i].a, test_vec[i].b, simde_CMP_LT_OS), ==, test_vec[i].lt);
+    munit_assert_uint8(simde_mm512_cmp_pd_mask(test_vec[i].a, test_vec[i].b, simde_CMP_LE_OS), ==, test_vec[i].le);
+    munit_assert_uint8(simde_mm512_cmp_pd_mask(test_vec[i].a, test_vec[i].b, simde_CMP_NEQ_UQ), ==, test_vec[i].neq);
+    munit_assert_uint8(simde_mm512_cmp_pd_mask(test_vec[i].a, test_vec[i].b, simde_CMP_NLT_US), ==, test_vec[i].nlt);
+    munit_assert_uint8(simde_mm512_cmp_pd_mask(test_vec[i].a, test_vec[i].b, simde_CMP_GT_OQ), ==, test_vec[i].gt);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cmp_ps_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__mmask16 eq;
+    simde__mmask16 lt;
+    simde__mmask16 le;
+    simde__mmask16 neq;
+    simde__mmask16 nlt;
+    simde__mmask16 gt;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(   -96.66f,    -66.56f,    -54.21f,      1.59f,
+                             -4.95f,     27.90f,    -88.36f,     90.93f,
+                              8.26f,     66.04f,     -5.80f,    -57.91f,
+                             72.68f,    -56.69f,     94.40f,     -6.53f),
+      simde_mm512_set_ps(    38.57f,    -66.56f,     49.12f,    -93.08f,
+                             -4.95f,     27.90f,     35.92f,    -55.14f,
+                              8.26f,      2.13f,    -17.46f,    -57.91f,
+                            -46.08f,     64.48f,     60.02f,     14.47f),
+      UINT16_C(0x4c90),
+      UINT16_C(0xa205),
+      UINT16_C(0xee95),
+      UINT16_C(0xb36f),
+      UINT16_C(0x5dfa),
+      UINT16_C(0x116a) },
+    { simde_mm512_set_ps(   -14.81f,     86.14f,    -57.66f,     95.14f,
+                            -96.02f,    -13.11f,     -1.16f,    -20.82f,
+                             80.51f,     18.74f,     71.54f,     46.09f,
+                             98.04f,     29.70f,      4.32f,     12.24f),
+      simde_mm512_set_ps(   -14.81f,     86.14f,    -57.66f,      9.00f,
+                             40.93f,    -13.11f,     69.55f,     13.10f,
+                             74.05f,    -66.96f,    -79.54f,     46.09f,
+                             98.04f,     29.70f,     13.10f,     46.00f),
+      UINT16_C(0xe41c),
+      UINT16_C(0x0b03),
+      UINT16_C(0xef1f),
+      UINT16_C(0x1be3),
+      UINT16_C(0xf4fc),
+      UINT16_C(0x10e0) },
+    { simde_mm512_set_ps(    47.87f,    -67.64f,     88.80f,     53.21f,
+                            -88.28f,     73.60f,    -14.76f,     49.94f,
+                             71.47f,     16.29f,     35.96f,    -30.72f,
+                             34.27f,     60.94f,     96.64f,    -93.23f),
+      simde_mm512_set_ps(    47.87f,    -67.64f,     26.33f,     53.21f,
+                             58.48f,     73.60f,    -20.72f,     13.47f,
+                              9.09f,     16.29f,    -44.67f,    -86.55f,
+                             34.27f,     18.44f,     77.66f,     17.67f),
+      UINT16_C(0xd448),
+      UINT16_C(0x0801),
+      UINT16_C(0xdc49),
+      UINT16_C(0x2bb7),
+      UINT16_C(0xf7fe),
+      UINT16_C(0x23b6) },
+    { simde_mm512_set_ps(    97.31f,     -4.14f,    -88.26f,     38.46f,
+                            -78.99f,    -43.36f,    -30.18f,      4.24f,
+                            -14.90f,    -83.83f,    -53.73f,     28.79f,
+                              8.69f,     -0.06f,    -29.03f,    -87.17f),
+      simde_mm512_set_ps(    97.31f,    -28.87f,    -88.26f,     40.76f,
+                            -78.99f,    -43.36f,    -30.18f,      4.24f,
+                            -14.90f,     29.79f,    -53.73f,     28.79f,
+                             72.67f,     72.12f,     29.14f,     69.63f),
+      UINT16_C(0xafb0),
+      UINT16_C(0x104f),
+      UINT16_C(0xbfff),
+      UINT16_C(0x504f),
+      UINT16_C(0xefb0),
+      UINT16_C(0x4000) },
+    { simde_mm512_set_ps(    48.69f,     -8.89f,     16.81f,    -87.39f,
+                             83.94f,     21.87f,     74.08f,    -51.08f,
+                            -34.35f,    -45.16f,    -62.56f,    -82.25f,
+                            -84.46f,     -9.08f,    -10.20f,     80.61f),
+      simde_mm512_set_ps(    48.69f,     50.83f,     -6.01f,    -31.89f,
+                            -47.63f,     87.94f,    -33.21f,    -31.79f,
+                            -51.96f,    -17.34f,    -62.56f,    -82.25f,
+                            -91.47f,     66.42f,    -10.20f,     30.11f),
+      UINT16_C(0x8032),
+      UINT16_C(0x5544),
+      UINT16_C(0xd576),
+      UINT16_C(0x7fcd),
+      UINT16_C(0xaabb),
+      UINT16_C(0x2a89) },
+    { simde_mm512_set_ps(    57.30f,    -52.28f,     35.22f,     88.76f,
+                            -76.84f,     62.52f,     52.56f,     65.21f,
+                             96.07f,     97.65f,     24.72f,     45.74f,
+                            -59.08f,    -26.33f,     -1.53f,    -44.99f),
+      simde_mm512_set_ps(    95.98f,     26.27f,     68.46f,     88.76f,
+                            -76.84f,     62.52f,     52.56f,     62.81f,
+                            -64.59f,     97.65f,     43.12f,     45.74f,
+                             -0.75f,     15.16f,    -20.75f,      5.91f),
+      UINT16_C(0x1e50),
+      UINT16_C(0xe02d),
+      UINT16_C(0xfe7d),
+      UINT16_C(0xe1af),
+      UINT16_C(0x1fd2),
+      UINT16_C(0x0182) },
+    { simde_mm512_set_ps(    97.06f,    -27.20f,    -76.94f,     -1.49f,
+                            -89.20f,     45.57f,     30.09f,     75.76f,
+                             -5.84f,    -21.01f,    -98.49f,    -94.79f,
+                             98.32f,    -42.36f,    -67.89f,    -52.93f),
+      simde_mm512_set_ps(    53.34f,    -27.20f,    -76.94f,     96.17f,
+                            -95.14f,     55.15f,     30.09f,    -70.57f,
+                             -5.84f,     49.05f,     47.11f,     96.24f,
+                             98.32f,     96.82f,     45.12f,    -52.93f),
+      UINT16_C(0x6289),
+      UINT16_C(0x1476),
+      UINT16_C(0x76ff),
+      UINT16_C(0x9d76),
+      UINT16_C(0xeb89),
+      UINT16_C(0x8900) },
+    { simde_mm512_set_ps(   -97.79f,     57.94f,     43.78f,    -21.20f,
+                            -28.94f,     61.90f,      3.16f,    -27.23f,
+                             -7.69f,     80.09f,    -99.00f,     83.72f,
+                             84.22f,    -31.82f,    -28.77f,    -95.93f),
+      simde_mm512_set_ps(   -97.79f,     57.94f,     43.78f,     85.18f,
+                            -87.37f,     50.63f,    -18.24f,    -27.23f,
+                             -7.69f,     80.09f,    -99.00f,     83.72f,
+                              1.71f,    -37.84f,     88.20f,    -95.93f),
+      UINT16_C(0xe1f1),
+      UINT16_C(0x1002),
+      UINT16_C(0xf1f3),
+      UINT16_C(0x1e0e),
+      UINT16_C(0xeffd),
+      UINT16_C(0x0e0c) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_uint16(simde_mm512_cmp_ps_mask(test_vec[i].a, test_vec[i].b, simde_CMP_EQ_OQ), ==, test_vec[i].eq);
+    munit_assert_uint16(simde_mm512_cmp_ps_mask(test_vec[i].a, test_vec[i].b, simde_CMP_LT_OS), ==, test_vec[i].lt);
+    munit_assert_uint16(simde_mm512_cmp_ps_mask(test_vec[i].a, test_vec[i].b, simde_CMP_LE_OS), ==, test_vec[i].le);
+    munit_assert_uint16(simde_mm512_cmp_ps_mask(test_vec[i].a, test_vec[i].b, simde_CMP_NEQ_UQ), ==, test_vec[i].neq);
+    munit_assert_uint16(simde_mm512_cmp_ps_mask(test_vec[i].a, test_vec[i].b, simde_CMP_NLT_US), ==, test_vec[i].nlt);
+    munit_assert_uint16(simde_mm512_cmp_ps_mask(test_vec[i].a, test_vec[i].b, simde_CMP_GT_OQ), ==, test_vec[i].gt);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cmpeq_epi32_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( 1013998595,  1985396453, -1850057983,  1900510892,
+                              441188947,  -474776394, -1882551714, -1173495368,
+                            -1372993973, -1669402567, -1338060427,  -924443137,
+                              324747197,   367534360,   253323372,  -605806158),
+      simde_mm512_set_epi32( 1013998595,  1407844134,  1119733311,  1900510892,
+                              441188947,  -112251424, -1839875446, -1651792580,
+                             -671428427, -1669402567, -1338060427,   856288576,
+                              324747197,   367534360,   253323372,   534263114),
+      UINT16_C(0x986e) },
+    { simde_mm512_set_epi32( -609503328,   -11855835,  -887157298,   241467043,
+                            -1858040709, -1305074676,  1805189320,  1271907632,
+                             2122170344, -1853515641,  -403461247,   269043403,
+                              416312149, -1371938782, -1804955722,   520704485),
+      simde_mm512_set_epi32(  699251129,  1536836312,  1168315557,   241467043,
+                            -1858040709, -1492539564,   750582578,  1271907632,
+                              144359604, -1853515641,   469331844,   269043403,
+                              416312149,  -318948009,  1763245275,    98025278),
+      UINT16_C(0x1958) },
+    { simde_mm512_set_epi32(  814959101,  -685074596,  -698252064,   514341782,
+                             -584233577, -1297205022,  -244278307, -1530645511,
+                            -1850757673,  1439050395,  1507631463,  -527065771,
+                             -448617551,  -130666658, -1232092246,   268218061),
+      simde_mm512_set_epi32(  814959101,   121075315,  -698252064,   514341782,
+                             -584233577, -1297205022,  -241476601,  -459756645,
+                             1319368611,  -647718283,  1507631463,  -527065771,
+                            -1935647544,  -130666658, -1154014572,   268218061),
+      UINT16_C(0xbc35) },
+    { simde_mm512_set_epi32(-1472736234,  -393738262,  1847867149, -1388230602,
+                             -983269524,  1721073192,  1040919200, -1448139449,
+                             1283415240, -1090949448, -1337838185,   176078949,
+                            -1590396348,   829533354,  1606934269,  2144696934),
+      simde_mm512_set_epi32(-1472736234, -1192421664,  1847867149,  -767929424,
+                              910937244,  1566035920,  1957206788, -1448139449,
+                             1283415240, -1090949448,  1734719102,  1368824605,
+                            -1590396348,  1781216478,  1606934269,  2144696934),
+      UINT16_C(0xa1cb) },
+    { simde_mm512_set_epi32(-1625801949, -1916681228,  1901400898,   630124524,
+                            -2070046606,   -16223364,  1694298483, -1805795723,
+                             -767131713, -1550790959, -1803963303,  1935972459,
+                             -493828865,   756298851, -1019580879,  1748157223),
+      simde_mm512_set_epi32(-1625801949,    83601614,  1901400898,   630124524,
+                             -480607859,  1478573214,  -806015755, -1805795723,
+                              702071346,   540409028, -1803963303,  1935972459,
+                            -1876342633,   540447529, -1622810890, -2004570845),
+      UINT16_C(0xb130) },
+    { simde_mm512_set_epi32(   24138154,  -624109017,   217733676,  -906298437,
+                             1525741300,   616908723,   416654923,  1362624467,
+                               47755747,  1343527470,    27494881,  -612861933,
+                             2097141773, -1216994135,  -933046588, -1942365325),
+      simde_mm512_set_epi32(   24138154, -1244101122,   217733676,  1960360083,
+                                5405912,   616908723,  -143963118,  1362624467,
+                             -717949152,  1703526517,    27494881,  1193220986,
+                            -1754882500,  -594493166,  -933046588, -1010182912),
+      UINT16_C(0xa522) },
+    { simde_mm512_set_epi32(-1478770906, -2071715363,  -780393376, -1820098898,
+                            -1681276236,   830180569,  1138226891,  -613950607,
+                             1912655080,  -542053581,  -827566068,   320675715,
+                             2017385376,  1764199861,  1543910776,  -729032161),
+      simde_mm512_set_epi32(-1399877368, -2071715363,  -562830773,  1942285687,
+                             1710552214,   763117286,  1138226891, -1085155029,
+                               40298829,  -542053581,   892224047,   825601218,
+                             2017385376,  1933487739,  1543910776,  -729032161),
+      UINT16_C(0x424b) },
+    { simde_mm512_set_epi32(  632756586,  2114549363,  -557041358,   591529553,
+                             -369080065,  1962846413, -1299026373, -1797918405,
+                              818810938,  1222650156,   336717579, -1787995820,
+                              -74265022,   569381733,   264303135,  1152743056),
+      simde_mm512_set_epi32( 1791555258,  2114549363,  -557041358,   591529553,
+                             1092534111, -1660597606,   677695785,  1025149267,
+                             1525167850,   523078052,   336717579, -1787995820,
+                              -74265022,  -703059070,   264303135,  1152743056),
+      UINT16_C(0x703b) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_cmpeq_epi32_mask(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cmpeq_epi64_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 1338134646845768719), INT64_C(-3426026205077380629),
+                            INT64_C(-5694422916251574184), INT64_C(-6747755950006511412),
+                            INT64_C( 7647975196002653823), INT64_C(-8343103500565987957),
+                            INT64_C(-7280204227881154288), INT64_C( 4362525577260169718)),
+      simde_mm512_set_epi64(INT64_C( 7432687403009213455), INT64_C(-3426026205044091591),
+                            INT64_C(-4741316304005554088), INT64_C( 6163086316664505533),
+                            INT64_C( 3916931397856112185), INT64_C(-7153693968151986805),
+                            INT64_C( -744864682675063392), INT64_C(-1936192273353892112)),
+      UINT8_C(0x00) },
+    { simde_mm512_set_epi64(INT64_C( -768662018875271712), INT64_C( 4052509171128810849),
+                            INT64_C( 7245068963922437424), INT64_C(-1937952943976343704),
+                            INT64_C(-3064137612168325192), INT64_C( 4325570055240166069),
+                            INT64_C(-5417470971570887796), INT64_C( 8611917773425815877)),
+      simde_mm512_set_epi64(INT64_C( -768662018875271712), INT64_C( 4052509171128810849),
+                            INT64_C( 2551892362029557040), INT64_C(-8123474709491869848),
+                            INT64_C( 7527007600941668280), INT64_C( -527338745261423968),
+                            INT64_C(-5417470970902073792), INT64_C(-7278792206750594464)),
+      UINT8_C(0xc0) },
+    { simde_mm512_set_epi64(INT64_C( 6739257242896909602), INT64_C( 5622214830586330732),
+                            INT64_C(-6980677778938541597), INT64_C(-3748618346985304190),
+                            INT64_C(-4015285175199451335), INT64_C(  623931607819903528),
+                            INT64_C(-1400348868368822533), INT64_C( 7670705545576789277)),
+      simde_mm512_set_epi64(INT64_C( 6739257242896909602), INT64_C( 4317263090295975317),
+                            INT64_C( 2828342443482008035), INT64_C(-7739734268914577534),
+                            INT64_C(-5283214195912329415), INT64_C( 4658367420967527996),
+                            INT64_C(-1400348868368822533), INT64_C( 7670705545576789277)),
+      UINT8_C(0x83) },
+    { simde_mm512_set_epi64(INT64_C(-6808743277190067930), INT64_C(  832823211247174518),
+                            INT64_C( 3556784926863539993), INT64_C( 4576438004043282971),
+                            INT64_C(-4513515268873129830), INT64_C( 8514506215160612355),
+                            INT64_C(-2703448316076656762), INT64_C( 4662773759246020079)),
+      simde_mm512_set_epi64(INT64_C(-6808743277190067930), INT64_C(-3704948060693560458),
+                            INT64_C( 3556784924425088007), INT64_C( 4576438006029040614),
+                            INT64_C(-4513515270075482014), INT64_C( 3156386513122559491),
+                            INT64_C(-2703448315582941629), INT64_C(-8537695783811827898)),
+      UINT8_C(0x80) },
+    { simde_mm512_set_epi64(INT64_C(-2326945141185183221), INT64_C(-2520802081667422183),
+                            INT64_C(-3318128803969078261), INT64_C(-2606614679097768023),
+                            INT64_C( 8859610161002564611), INT64_C(-6462013384187664896),
+                            INT64_C(  369526060830274186), INT64_C( 4084515913414077587)),
+      simde_mm512_set_epi64(INT64_C(-2326945137744480624), INT64_C( 7828066603460841338),
+                            INT64_C( 1774764693172153355), INT64_C(-2606614679097768023),
+                            INT64_C( 8859610161002564611), INT64_C( 1886850645304404257),
+                            INT64_C(  369526060830274186), INT64_C( 4084515913414077587)),
+      UINT8_C(0x1b) },
+    { simde_mm512_set_epi64(INT64_C(-7101089221922300717), INT64_C( 5456584927933119859),
+                            INT64_C( 2379179745399983036), INT64_C(-5388754618285482320),
+                            INT64_C( 2576217024505993094), INT64_C( -393541288306697756),
+                            INT64_C(-3855535298257400213), INT64_C(-6182017007132072810)),
+      simde_mm512_set_epi64(INT64_C( 2197373635133922515), INT64_C( 5456584927933119859),
+                            INT64_C(-5921315912684506099), INT64_C(-8310268193463824075),
+                            INT64_C(-5238651084972599418), INT64_C(-6226364998394868817),
+                            INT64_C(-3855535298257400213), INT64_C(-4894617079805169759)),
+      UINT8_C(0x42) },
+    { simde_mm512_set_epi64(INT64_C( -613513551394870778), INT64_C( 2427955269561311160),
+                            INT64_C(-8386792804071189845), INT64_C( 6509409321262371011),
+                            INT64_C( 5689553838572487763), INT64_C(  -48624787129370503),
+                            INT64_C(-6187146910466260087), INT64_C(-5494552260905876089)),
+      simde_mm512_set_epi64(INT64_C(-1612733772753429097), INT64_C(  875799765764104120),
+                            INT64_C( 5604769173667893931), INT64_C(-7176088102938226493),
+                            INT64_C( 5689553838572487763), INT64_C(  -48624787129370503),
+                            INT64_C(-6187146909651280474), INT64_C( 6919915360877725063)),
+      UINT8_C(0x0c) },
+    { simde_mm512_set_epi64(INT64_C(  779520740812131468), INT64_C( 6506088604393132922),
+                            INT64_C( 8901275926151446014), INT64_C( 7420925443319702825),
+                            INT64_C( 8251174306915572253), INT64_C( 1845420292509091919),
+                            INT64_C(-1808466538404175232), INT64_C( 5718492325710626410)),
+      simde_mm512_set_epi64(INT64_C( 1918080024221468541), INT64_C( 2775033122612437483),
+                            INT64_C( 8901275928271336186), INT64_C(-3293679042800474839),
+                            INT64_C(-3757919148826928611), INT64_C( 1845420292625641815),
+                            INT64_C(-1808466538404175232), INT64_C( 5718492323610776435)),
+      UINT8_C(0x02) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_mm512_cmpeq_epi64_mask(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cmpgt_epi32_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( -307567840, -1977662295,  1575936699,   926109024,
+                              222230630,  -814322282,  1678317079,    15832533,
+                             -578736029, -1863855208,  -385655948,  1922868474,
+                              371223549,  1673168349, -1294116387,  1859145026),
+      simde_mm512_set_epi32(  612893174, -1977662295,  1317305959,   926109024,
+                              222230630,  1220113047,  1678317079,   886456489,
+                             -578736029,  1224677360,  -385655948,  1922868474,
+                              371223549, -1854790794,  -832359326,  1859145026),
+      UINT16_C(0x2004) },
+    { simde_mm512_set_epi32(  206237209,  -289976330,   704667794, -1480324947,
+                             1918931397, -1360758724,  -124609685, -1946019623,
+                             1442848257,   230975103, -1239320647,  1731353504,
+                            -2117297275,   626803432,    58018841, -1022105142),
+      simde_mm512_set_epi32( 1681362629,  -708534906, -1923589297,   545453619,
+                             1918931397, -1360758724, -1774195559,  -613156922,
+                             2068791784,  1506911582,  -105294120,  1731353504,
+                            -1711515248, -1911699335,  2084527631, -1022105142),
+      UINT16_C(0x6204) },
+    { simde_mm512_set_epi32(-1505582452,   165707045,  1130569328, -1109656731,
+                             1842846758,   303668449,  1994713749,  -894595192,
+                             1388792295,   756413378,  1104774984,   104276412,
+                             -740333388,  -434543132,  1594765295,  1823829293),
+      simde_mm512_set_epi32(-1505582452,   165707045, -1782800831, -1109656731,
+                             1757058621, -1834694366,   187468121, -2012815868,
+                             1388792295,   756413378,  1866031754, -1801870211,
+                             -740333388,  -434543132,  -943866866, -2141226699),
+      UINT16_C(0x2f13) },
+    { simde_mm512_set_epi32(   -2676261,  -422405675,  -132869286, -1809166842,
+                             -151428732, -1957295041,    41939265,   277384597,
+                             1609674805,   696232357,  -808920354,  -673107445,
+                             1838463896,  1323748514,  1112937894,   874171112),
+      simde_mm512_set_epi32(   -2676261, -1532106900,  -132869286, -1809166842,
+                             1458128964, -1957295041,    41939265, -1309112641,
+                             -480697528,   696232357,   841180067,  -673107445,
+                             -589133804,  1323748514, -1026411031,   874171112),
+      UINT16_C(0x418a) },
+    { simde_mm512_set_epi32(-1612650678, -1697485630, -1651514729,  -674344894,
+                             1075759639,   -47822252,  1879959246, -1648980971,
+                             1931300084,   551991102,  -394473885, -1327194473,
+                              261718850, -2130544530, -1101788310,   661895670),
+      simde_mm512_set_epi32(  660314323, -1697485630, -1651514729,  -674344894,
+                             1075759639,   873888349,  -313714986,   425092067,
+                              940800984,   551991102,  -352397735, -1327194473,
+                              261718850, -2130544530, -1405658287,  1918101936),
+      UINT16_C(0x0282) },
+    { simde_mm512_set_epi32(  651230083,  2026448793,  1142194927, -1520118974,
+                             1869645658, -1150126471,  1744922181,   500556914,
+                              -99436500, -1597600429,  1512567981, -1551289491,
+                             2042830542,  -749075168,   586328026, -2054884508),
+      simde_mm512_set_epi32( 1733831903, -1190326341,  1328452174, -1156221748,
+                             1869645658,  1916626869,  1744922181,   500556914,
+                             2014003256,   737454758,  1512567981,  -839494572,
+                             2042830542,  -848808244,   458487746, -2054884508),
+      UINT16_C(0x4006) },
+    { simde_mm512_set_epi32(  259579826, -2089985181,  -265467578,  1852819560,
+                              102847730,  -409417867, -1799422378,  1485824124,
+                              713944177,   373026855,   171044966,  2031715884,
+                              441810514, -1619690326,   283086057,   987419763),
+      simde_mm512_set_epi32(  259579826, -2089985181,   845973574,  1761092573,
+                              795194711,  -409417867,   -13908814,  -423313095,
+                            -1228898484,  2094652027,   171044966,  2031715884,
+                            -1112716833, -1619690326,  1522848376,  -127755720),
+      UINT16_C(0x1189) },
+    { simde_mm512_set_epi32(  168943808, -1375125812,  1060506569,   804512716,
+                             2081294396,   457272771,  2080552621,   435766757,
+                             -333813267,  1247274217, -1337310466,  1387027806,
+                            -2077451151, -1256485271,  1326356500,   409042126),
+      simde_mm512_set_epi32(  168943808,   938556342,  1060506569,   804512716,
+                             2081294396,   457272771,  2080552621,   435766757,
+                             1877119398,  1247274217, -1915695050,   669628256,
+                            -2077451151,  -915849844,  1326356500,   409042126),
+      UINT16_C(0x0030) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_cmpgt_epi32_mask(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cmpgt_epi64_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(-1070725266826228311), INT64_C( -348238074741056451),
+                            INT64_C( 2570040136196824084), INT64_C( 6469677713034593893),
+                            INT64_C( 1844335320139420304), INT64_C( 2258852963168820606),
+                            INT64_C( 5799339939080307759), INT64_C(-7394645932920415092)),
+      simde_mm512_set_epi64(INT64_C(-1070725269212975381), INT64_C( 8756837484606463037),
+                            INT64_C(-2413942701238903788), INT64_C( 6287048110106494565),
+                            INT64_C( 1844335320139420304), INT64_C( 2258852965867218219),
+                            INT64_C( 5799339939080307759), INT64_C( 1494168187581228924)),
+      UINT8_C(0xb0) },
+    { simde_mm512_set_epi64(INT64_C(-1720628373732979667), INT64_C( 4891984578020185260),
+                            INT64_C( 6285690629238691156), INT64_C( 3361108757255178741),
+                            INT64_C( 7428747045956050290), INT64_C(-2761712275336029970),
+                            INT64_C( 1565998451810031584), INT64_C( 7525129795560377933)),
+      simde_mm512_set_epi64(INT64_C(-1720628372376041459), INT64_C(-7157028008873356116),
+                            INT64_C( 6285690629238691156), INT64_C( 3361108760052855336),
+                            INT64_C( 7428747047348655678), INT64_C(-2761712275336029970),
+                            INT64_C( 3882719311809402848), INT64_C( 7525129795560377933)),
+      UINT8_C(0x40) },
+    { simde_mm512_set_epi64(INT64_C(-6752208018552453871), INT64_C(-4176013079027714533),
+                            INT64_C(-2049300186439111159), INT64_C(-3081747319423630228),
+                            INT64_C(-4011237672464765203), INT64_C(  -69684818361814647),
+                            INT64_C(  210127732273409321), INT64_C( -298786374986835949)),
+      simde_mm512_set_epi64(INT64_C(-6752208018552453871), INT64_C(-4176013082214978820),
+                            INT64_C(-2049300186439111159), INT64_C(-3081747319265922006),
+                            INT64_C(  664708066097409773), INT64_C( 8201938546056917385),
+                            INT64_C(-3364061828603876055), INT64_C( -298786378039436991)),
+      UINT8_C(0x43) },
+    { simde_mm512_set_epi64(INT64_C(-2110369234032182734), INT64_C(  302968836981214418),
+                            INT64_C(-9076393148096332812), INT64_C(-3153191798733002651),
+                            INT64_C(-3907778122342453324), INT64_C(-7565909479523619993),
+                            INT64_C(-5698808992523063514), INT64_C(  186669036011598213)),
+      simde_mm512_set_epi64(INT64_C(-5042545713408820686), INT64_C( 5629200408369346708),
+                            INT64_C( 5229290544260037620), INT64_C(-3153191798733002651),
+                            INT64_C(-5655665893941890206), INT64_C( 8534061568843574119),
+                            INT64_C( 3265811730266877734), INT64_C(  186669034058974721)),
+      UINT8_C(0x89) },
+    { simde_mm512_set_epi64(INT64_C(-6629150663926199844), INT64_C(-2977606495574705464),
+                            INT64_C(-6797917264123295356), INT64_C( 5284782664883059938),
+                            INT64_C( 1392941823206110083), INT64_C( 5490847652466690031),
+                            INT64_C(-4624149898019848856), INT64_C( 3060234659211942412)),
+      simde_mm512_set_epi64(INT64_C(-6629150663926199844), INT64_C( 6425240361880238792),
+                            INT64_C(-6797917264277874311), INT64_C( 8699287643797535970),
+                            INT64_C( 1392941825625787508), INT64_C( 5490847652466690031),
+                            INT64_C(-6990679540995572376), INT64_C( 3060234658800011590)),
+      UINT8_C(0x23) },
+    { simde_mm512_set_epi64(INT64_C(-4038746790776573691), INT64_C(-4037177060109252954),
+                            INT64_C(-9004290151851964387), INT64_C( 6437955178137894329),
+                            INT64_C( 2211869861455373343), INT64_C(-7870296170125461620),
+                            INT64_C( 7200806104855716069), INT64_C( 1904643804704063844)),
+      simde_mm512_set_epi64(INT64_C( 6765975504678761539), INT64_C(-4037177061812379579),
+                            INT64_C( 4748358982942378013), INT64_C(  257000247053237689),
+                            INT64_C( 2211869861455373343), INT64_C(-3343250174552180852),
+                            INT64_C( 5456377706562618399), INT64_C( 1904643804704063844)),
+      UINT8_C(0x52) },
+    { simde_mm512_set_epi64(INT64_C( 3502218024001688123), INT64_C(-3339930453859458093),
+                            INT64_C( -137376162480124954), INT64_C(-2098219503487228237),
+                            INT64_C(  -50174206932836177), INT64_C(-8197790388111058426),
+                            INT64_C( 3138727981936503422), INT64_C( 4171775060319729973)),
+      simde_mm512_set_epi64(INT64_C( 7652672130191413819), INT64_C(-3339930455813221232),
+                            INT64_C(-4091923130828452890), INT64_C(-2098219505032519305),
+                            INT64_C( 1772485797524644015), INT64_C(-8197790388111058426),
+                            INT64_C( 3100273219885034110), INT64_C(-7899625567590221515)),
+      UINT8_C(0x73) },
+    { simde_mm512_set_epi64(INT64_C( 2135410387141778413), INT64_C(  373555312202146447),
+                            INT64_C( -636537098288151890), INT64_C(-2426577432037897452),
+                            INT64_C( 5604453217395392466), INT64_C(-4548426832119722772),
+                            INT64_C( -655615632452479577), INT64_C( 5952376642601229461)),
+      simde_mm512_set_epi64(INT64_C(  104912978324402367), INT64_C(  373555312202146447),
+                            INT64_C( -636537099977519976), INT64_C(-2426577431214594409),
+                            INT64_C( 5604453215732355247), INT64_C(  388665824439269055),
+                            INT64_C(-4879808674937563737), INT64_C( 5952376640741779816)),
+      UINT8_C(0xab) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_mm512_cmpgt_epi64_mask(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_div_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(   265.36,    360.88,    859.06,    312.25,
+                            911.66,    183.61,    394.52,    293.34),
+      simde_mm512_set_pd(   639.06,    314.31,    252.93,    219.67,
+                            983.19,    588.92,    532.86,    573.05),
+      simde_mm512_set_pd(     0.42,      1.15,      3.40,      1.42,
+                              0.93,      0.31,      0.74,      0.51) },
+    { simde_mm512_set_pd(    62.26,    734.77,    283.06,    224.37,
+                            968.73,    450.65,    313.00,    221.53),
+      simde_mm512_set_pd(   848.81,    920.76,    840.19,    537.54,
+                            136.80,    485.63,    201.41,    755.82),
+      simde_mm512_set_pd(     0.07,      0.80,      0.34,      0.42,
+                              7.08,      0.93,      1.55,      0.29) },
+    { simde_mm512_set_pd(   587.40,     31.81,     67.50,    531.13,
+                            439.36,      7.68,    711.76,    332.96),
+      simde_mm512_set_pd(   102.85,      9.44,    181.66,     41.43,
+                             62.69,    609.89,     54.52,    300.78),
+      simde_mm512_set_pd(     5.71,      3.37,      0.37,     12.82,
+                              7.01,      0.01,     13.06,      1.11) },
+    { simde_mm512_set_pd(   984.37,     23.35,    224.30,    943.38,
+                            217.62,    720.21,    410.36,     38.46),
+      simde_mm512_set_pd(   780.89,     15.33,    694.18,    869.20,
+                            265.42,     31.23,    280.20,    508.56),
+      simde_mm512_set_pd(     1.26,      1.52,      0.32,      1.09,
+                              0.82,     23.06,      1.46,      0.08) },
+    { simde_mm512_set_pd(   239.18,    144.48,    210.51,    503.80,
+                            335.53,    219.74,    781.74,    908.09),
+      simde_mm512_set_pd(   475.97,     58.05,      6.33,     84.93,
+                            846.92,    490.83,    701.38,    464.53),
+      simde_mm512_set_pd(     0.50,      2.49,     33.26,      5.93,
+                              0.40,      0.45,      1.11,      1.95) },
+    { simde_mm512_set_pd(   840.03,    289.02,    512.92,    503.36,
+                             42.98,    837.44,    540.92,    665.02),
+      simde_mm512_set_pd(   709.54,    380.95,    639.07,     85.34,
+                            302.09,    999.23,    797.63,    372.80),
+      simde_mm512_set_pd(     1.18,      0.76,      0.80,      5.90,
+                              0.14,      0.84,      0.68,      1.78) },
+    { simde_mm512_set_pd(   346.91,    304.32,     31.63,    220.07,
+                            813.69,    999.08,    930.41,    742.95),
+      simde_mm512_set_pd(   488.60,    313.42,    635.03,    500.32,
+                            432.64,    422.79,    511.48,    435.77),
+      simde_mm512_set_pd(     0.71,      0.97,      0.05,      0.44,
+                              1.88,      2.36,      1.82,      1.70) },
+    { simde_mm512_set_pd(   773.50,    248.33,    660.30,    503.46,
+                            694.34,    174.73,    292.83,    648.19),
+      simde_mm512_set_pd(   908.21,    726.42,     11.60,    970.27,
+                            742.29,    497.55,     16.89,    622.61),
+      simde_mm512_set_pd(     0.85,      0.34,     56.92,      0.52,
+                              0.94,      0.35,     17.34,      1.04) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_div_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_div_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(   522.66f,    311.68f,    911.65f,    126.97f,
+                            505.67f,    955.45f,     11.59f,    463.32f,
+                            924.37f,    306.04f,    216.47f,    315.97f,
+                             33.98f,    117.42f,    955.85f,    522.08f),
+      simde_mm512_set_ps(   156.48f,    615.32f,    564.82f,    411.64f,
+                            770.76f,    457.20f,    489.24f,    688.96f,
+                            436.18f,    635.39f,    288.50f,    913.55f,
+                            938.98f,    753.95f,    401.71f,    982.88f),
+      simde_mm512_set_ps(     3.34f,      0.51f,      1.61f,      0.31f,
+                              0.66f,      2.09f,      0.02f,      0.67f,
+                              2.12f,      0.48f,      0.75f,      0.35f,
+                              0.04f,      0.16f,      2.38f,      0.53f) },
+    { simde_mm512_set_ps(   177.13f,     79.76f,    343.92f,    337.23f,
+                            496.56f,    386.86f,    633.67f,    709.47f,
+                            237.32f,    938.51f,    689.35f,    919.29f,
+                            904.27f,    376.07f,    857.42f,     76.69f),
+      simde_mm512_set_ps(    17.12f,    898.30f,    469.87f,    639.10f,
+                            207.11f,    945.90f,    499.07f,    417.84f,
+                            762.07f,    295.77f,    409.30f,    482.87f,
+                            793.06f,    567.97f,    228.02f,    661.14f),
+      simde_mm512_set_ps(    10.35f,      0.09f,      0.73f,      0.53f,
+                              2.40f,      0.41f,      1.27f,      1.70f,
+                              0.31f,      3.17f,      1.68f,      1.90f,
+                              1.14f,      0.66f,      3.76f,      0.12f) },
+    { simde_mm512_set_ps(   756.83f,    354.18f,    472.15f,    956.80f,
+                            264.46f,     50.60f,    263.34f,    580.42f,
+                            917.60f,    340.23f,    685.89f,    737.91f,
+                            825.50f,    269.08f,    438.61f,    882.83f),
+      simde_mm512_set_ps(    21.52f,    316.12f,    591.60f,    941.36f,
+                            101.26f,    591.51f,    757.33f,    507.28f,
+                            350.93f,    307.80f,    695.83f,    248.29f,
+                            517.59f,    504.95f,    871.53f,    464.93f),
+      simde_mm512_set_ps(    35.17f,      1.12f,      0.80f,      1.02f,
+                              2.61f,      0.09f,      0.35f,      1.14f,
+                              2.61f,      1.11f,      0.99f,      2.97f,
+                              1.59f,      0.53f,      0.50f,      1.90f) },
+    { simde_mm512_set_ps(   905.05f,     19.92f,    950.84f,    725.31f,
+                            630.31f,    855.33f,    853.48f,    708.87f,
+                             58.10f,    506.58f,    900.44f,    813.43f,
+                            474.85f,    661.04f,     67.22f,    891.68f),
+      simde_mm512_set_ps(   358.58f,    788.58f,    405.20f,    981.49f,
+                            532.01f,    329.90f,    893.84f,    519.78f,
+                            175.37f,    291.44f,    194.56f,    658.22f,
+                            656.74f,    186.51f,     47.62f,    366.45f),
+      simde_mm512_set_ps(     2.52f,      0.03f,      2.35f,      0.74f,
+                              1.18f,      2.59f,      0.95f,      1.36f,
+                              0.33f,      1.74f,      4.63f,      1.24f,
+                              0.72f,      3.54f,      1.41f,      2.43f) },
+    { simde_mm512_set_ps(   277.20f,    528.01f,    907.89f,    990.98f,
+                            115.51f,    782.29f,    559.01f,    837.87f,
+                            876.05f,     59.91f,    568.68f,    374.21f,
+                            588.90f,    742.19f,    276.52f,    345.99f),
+      simde_mm512_set_ps(   739.97f,     87.42f,    727.45f,    293.89f,
+                            316.27f,    690.30f,    382.41f,     66.79f,
+                            557.20f,     87.90f,    181.46f,     68.27f,
+                            233.74f,    303.04f,    720.48f,    330.65f),
+      simde_mm512_set_ps(     0.37f,      6.04f,      1.25f,      3.37f,
+                              0.37f,      1.13f,      1.46f,     12.54f,
+                              1.57f,      0.68f,      3.13f,      5.48f,
+                              2.52f,      2.45f,      0.38f,      1.05f) },
+    { simde_mm512_set_ps(    94.78f,    446.67f,     47.98f,    590.39f,
+                            946.84f,    931.15f,    735.52f,    610.08f,
+                            123.79f,    336.59f,    675.94f,     69.68f,
+                            697.05f,    980.24f,    952.17f,    935.97f),
+      simde_mm512_set_ps(   260.05f,    400.43f,     69.24f,    536.16f,
+                            401.66f,    721.82f,    187.75f,    572.25f,
+                            478.90f,    894.23f,    723.60f,    967.52f,
+                            872.30f,    396.69f,    157.40f,    291.90f),
+      simde_mm512_set_ps(     0.36f,      1.12f,      0.69f,      1.10f,
+                              2.36f,      1.29f,      3.92f,      1.07f,
+                              0.26f,      0.38f,      0.93f,      0.07f,
+                              0.80f,      2.47f,      6.05f,      3.21f) },
+    { simde_mm512_set_ps(    74.18f,    335.59f,    577.47f,    650.12f,
+                             36.43f,    852.15f,    302.85f,    155.66f,
+                            152.46f,    597.81f,    790.69f,    622.36f,
+                            352.53f,    891.42f,    886.30f,    325.00f),
+      simde_mm512_set_ps(   133.84f,    242.78f,    313.55f,    839.48f,
+                            790.00f,    925.02f,    853.04f,    621.44f,
+                            752.71f,    485.57f,    623.98f,    225.90f,
+                            116.40f,    418.06f,    168.93f,    410.63f),
+      simde_mm512_set_ps(     0.55f,      1.38f,      1.84f,      0.77f,
+                              0.05f,      0.92f,      0.36f,      0.25f,
+                              0.20f,      1.23f,      1.27f,      2.76f,
+                              3.03f,      2.13f,      5.25f,      0.79f) },
+    { simde_mm512_set_ps(   564.29f,    161.23f,    788.35f,    805.71f,
+                            855.77f,    927.00f,    934.04f,    528.24f,
+                            911.50f,    652.91f,    316.24f,    380.32f,
+                            164.59f,    568.08f,    914.72f,    639.04f),
+      simde_mm512_set_ps(   116.90f,    134.25f,    889.65f,    836.93f,
+                            439.49f,    771.63f,    287.74f,    850.08f,
+                            115.77f,     47.77f,    392.10f,     81.76f,
+                            607.50f,    219.34f,    561.81f,     62.32f),
+      simde_mm512_set_ps(     4.83f,      1.20f,      0.89f,      0.96f,
+                              1.95f,      1.20f,      3.25f,      0.62f,
+                              7.87f,     13.67f,      0.81f,      4.65f,
+                              0.27f,      2.59f,      1.63f,     10.25f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_div_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_fmadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d c;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(   -63.89,     27.56,     82.81,    -51.63,
+                            -46.63,     74.92,    -53.75,    -59.17),
+      simde_mm512_set_pd(   -62.48,    -56.90,    -40.66,     38.60,
+                             89.37,     87.89,    -26.21,      5.75),
+      simde_mm512_set_pd(   205.66,    291.34,    766.47,    172.54,
+                            -94.79,   -968.63,   -767.20,   -119.39),
+      simde_mm512_set_pd(  4197.51,  -1276.82,  -2600.58,  -1820.38,
+                          -4262.11,   5616.09,    641.59,   -459.62) },
+    { simde_mm512_set_pd(   -21.82,     60.36,     13.42,    -65.97,
+                             96.07,    -93.47,    -71.02,    -61.01),
+      simde_mm512_set_pd(    55.54,    -39.59,    -20.19,      1.55,
+                             79.59,     55.21,     90.24,    -62.79),
+      simde_mm512_set_pd(   237.63,   -547.12,   -970.42,     82.97,
+                           -706.37,   -381.68,    377.05,    333.37),
+      simde_mm512_set_pd(  -974.25,  -2936.77,  -1241.37,    -19.28,
+                           6939.84,  -5542.16,  -6031.79,   4164.19) },
+    { simde_mm512_set_pd(    94.47,    -26.49,    -97.71,     26.89,
+                            -71.65,    -69.34,    -93.63,     98.29),
+      simde_mm512_set_pd(    -0.29,     99.99,      6.09,      7.56,
+                             35.50,     84.32,      0.10,     -4.82),
+      simde_mm512_set_pd(  -544.51,    973.94,   -945.49,   -160.00,
+                            527.70,    780.00,    723.67,   -945.64),
+      simde_mm512_set_pd(  -571.91,  -1674.80,  -1540.54,     43.29,
+                          -2015.88,  -5066.75,    714.31,  -1419.40) },
+    { simde_mm512_set_pd(     2.90,     31.69,     79.36,     83.12,
+                            -27.48,    -23.62,    -85.18,     64.74),
+      simde_mm512_set_pd(   -42.68,    -43.84,     70.28,    -21.55,
+                              9.29,    -69.42,    -66.78,     23.69),
+      simde_mm512_set_pd(  -480.40,    621.78,   -929.73,    506.92,
+                            440.25,    412.72,    919.26,     70.33),
+      simde_mm512_set_pd(  -604.17,   -767.51,   4647.69,  -1284.32,
+                            184.96,   2052.42,   6607.58,   1604.02) },
+    { simde_mm512_set_pd(    68.66,     68.67,     42.66,     61.17,
+                              1.15,     59.48,     11.80,      3.74),
+      simde_mm512_set_pd(   -68.86,     16.97,     69.04,     56.47,
+                             -4.64,     38.42,     17.74,     68.04),
+      simde_mm512_set_pd(  -262.81,   -380.71,   -619.25,   -489.01,
+                           -310.38,   -143.89,   -599.24,    342.85),
+      simde_mm512_set_pd( -4990.74,    784.62,   2326.00,   2965.26,
+                           -315.72,   2141.33,   -389.91,    597.32) },
+    { simde_mm512_set_pd(    11.49,    -90.99,     -1.73,    -23.89,
+                            -15.84,    -18.42,    -83.04,    -93.70),
+      simde_mm512_set_pd(    79.16,     60.37,    -90.82,    -60.50,
+                             79.78,     62.51,     -5.74,     44.73),
+      simde_mm512_set_pd(   289.61,    416.23,   -577.76,   -353.56,
+                           -635.61,    463.76,   -944.18,    114.47),
+      simde_mm512_set_pd(  1199.16,  -5076.84,   -420.64,   1091.79,
+                          -1899.33,   -687.67,   -467.53,  -4076.73) },
+    { simde_mm512_set_pd(    41.03,     48.82,    -28.15,     55.21,
+                             22.90,     19.34,    -56.33,     26.64),
+      simde_mm512_set_pd(    69.72,    -64.70,     39.00,     29.33,
+                            -74.02,     -5.14,    -58.71,      9.65),
+      simde_mm512_set_pd(  -757.11,    550.19,    262.62,    603.81,
+                           -188.78,   -564.68,    138.91,    462.67),
+      simde_mm512_set_pd(  2103.50,  -2608.46,   -835.23,   2223.12,
+                          -1883.84,   -664.09,   3446.04,    719.75) },
+    { simde_mm512_set_pd(   -48.90,     11.52,     26.61,     84.14,
+                              3.09,     51.44,     87.69,     17.99),
+      simde_mm512_set_pd(    95.64,    -45.71,    -94.25,     16.91,
+                             -9.02,     -7.40,     96.83,     56.63),
+      simde_mm512_set_pd(   -63.17,    835.36,    383.99,   -157.78,
+                           -784.32,    -78.34,   -931.84,    222.67),
+      simde_mm512_set_pd( -4739.97,    308.78,  -2124.00,   1265.03,
+                           -812.19,   -459.00,   7559.18,   1241.44) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_fmadd_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_fmadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 c;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(    -5.71f,     26.29f,    -95.57f,    -84.02f,
+                              5.71f,     50.84f,    -68.60f,    -35.73f,
+                            -76.71f,    -69.01f,    -68.34f,     13.93f,
+                             12.97f,     61.11f,     62.43f,     52.99f),
+      simde_mm512_set_ps(   -17.26f,     46.51f,      0.70f,    -62.80f,
+                             54.95f,    -90.08f,    -95.45f,     80.58f,
+                             60.44f,     86.14f,      9.66f,    -97.91f,
+                             25.13f,    -65.60f,     92.58f,    -22.57f),
+      simde_mm512_set_ps(  -282.24f,   -857.13f,   -803.79f,     28.86f,
+                            834.57f,    961.73f,    702.26f,    329.94f,
+                           -691.16f,    579.18f,   -216.01f,   -969.01f,
+                           -950.09f,    -85.24f,    662.86f,    337.82f),
+      simde_mm512_set_ps(  -183.69f,    365.62f,   -870.69f,   5305.32f,
+                           1148.33f,  -3617.94f,   7250.13f,  -2549.18f,
+                          -5327.51f,  -5365.34f,   -876.17f,  -2332.90f,
+                           -624.15f,  -4094.06f,   6442.63f,   -858.16f) },
+    { simde_mm512_set_ps(   -52.82f,     74.00f,     80.92f,    -64.83f,
+                             52.67f,    -83.36f,    -98.18f,     64.12f,
+                             10.80f,     73.71f,     80.47f,      6.89f,
+                            -73.24f,    -42.96f,     78.30f,     -0.09f),
+      simde_mm512_set_ps(   -55.70f,     84.99f,    -12.12f,    -71.05f,
+                             88.36f,    -57.73f,     18.86f,     68.43f,
+                            -70.15f,    -19.42f,     41.11f,     62.85f,
+                            -68.92f,    -82.13f,     49.65f,    -19.90f),
+      simde_mm512_set_ps(   654.25f,    936.72f,   -947.98f,   -654.06f,
+                           -744.71f,    687.57f,   -587.88f,    172.56f,
+                           -550.08f,    616.25f,    613.85f,    467.60f,
+                             59.29f,   -641.28f,    301.87f,    234.16f),
+      simde_mm512_set_ps(  3596.32f,   7225.98f,  -1928.73f,   3952.11f,
+                           3909.21f,   5499.94f,  -2439.55f,   4560.29f,
+                          -1307.70f,   -815.20f,   3921.97f,    900.64f,
+                           5106.99f,   2887.02f,   4189.47f,    235.95f) },
+    { simde_mm512_set_ps(    96.87f,     87.22f,     47.87f,    -68.86f,
+                             63.55f,     -9.27f,    -67.26f,     88.57f,
+                             37.57f,     97.39f,     32.17f,    -62.14f,
+                             60.89f,    -82.05f,     82.31f,    -34.60f),
+      simde_mm512_set_ps(   -95.39f,    -16.79f,    -31.57f,     -2.29f,
+                            -95.96f,    -43.49f,     35.15f,    -85.31f,
+                             14.09f,    -55.61f,     40.59f,     59.72f,
+                             48.40f,     -2.97f,     20.58f,     25.70f),
+      simde_mm512_set_ps(  -689.63f,   -797.15f,    824.34f,    121.51f,
+                            675.25f,   -987.23f,    209.09f,   -319.16f,
+                           -964.69f,   -122.22f,   -315.33f,   -484.11f,
+                            302.60f,    976.03f,   -400.25f,   -976.42f),
+      simde_mm512_set_ps( -9930.06f,  -2261.57f,   -686.92f,    279.20f,
+                          -5423.01f,   -584.08f,  -2155.10f,  -7875.07f,
+                           -435.33f,  -5538.08f,    990.45f,  -4195.11f,
+                           3249.68f,   1219.72f,   1293.69f,  -1865.64f) },
+    { simde_mm512_set_ps(   -47.61f,     40.20f,    -74.45f,    -60.44f,
+                              0.53f,    -61.88f,     -2.07f,    -57.11f,
+                             23.23f,    -60.66f,    -19.02f,     80.93f,
+                             66.62f,    -40.56f,     15.27f,     57.20f),
+      simde_mm512_set_ps(    78.93f,     94.33f,     58.30f,     52.58f,
+                             82.54f,     51.46f,     10.86f,     58.76f,
+                             -3.75f,    -19.23f,      7.72f,    -71.00f,
+                             -6.17f,     81.94f,     82.39f,     97.61f),
+      simde_mm512_set_ps(   280.77f,    447.38f,   -897.72f,     17.60f,
+                           -612.57f,   -877.06f,   -682.54f,   -122.90f,
+                            548.24f,    671.52f,   -278.05f,    638.26f,
+                            580.78f,    343.60f,    143.87f,   -349.61f),
+      simde_mm512_set_ps( -3477.09f,   4239.45f,  -5238.15f,  -3160.34f,
+                           -568.82f,  -4061.40f,   -705.02f,  -3478.68f,
+                            461.13f,   1838.01f,   -424.88f,  -5107.77f,
+                            169.73f,  -2979.89f,   1401.97f,   5233.68f) },
+    { simde_mm512_set_ps(    21.57f,    -67.24f,     66.00f,    -28.68f,
+                            -87.13f,     14.12f,     22.09f,     58.47f,
+                              5.21f,    -75.46f,    -52.84f,     35.68f,
+                            -21.24f,     36.28f,     65.72f,     59.59f),
+      simde_mm512_set_ps(    71.65f,    -38.36f,     85.30f,     97.19f,
+                            -70.61f,     27.26f,    -84.21f,     41.30f,
+                             25.36f,     96.09f,    -92.08f,    -31.18f,
+                             75.18f,    -11.83f,    -41.16f,     32.98f),
+      simde_mm512_set_ps(   255.53f,    905.49f,   -199.77f,   -795.90f,
+                           -780.51f,   -730.51f,   -973.60f,   -519.90f,
+                            213.71f,   -302.45f,    589.25f,    798.66f,
+                           -728.33f,    -30.51f,     13.03f,   -573.38f),
+      simde_mm512_set_ps(  1801.02f,   3484.82f,   5430.03f,  -3583.31f,
+                           5371.74f,   -345.60f,  -2833.80f,   1894.91f,
+                            345.84f,  -7553.40f,   5454.76f,   -313.84f,
+                          -2325.15f,   -459.70f,  -2692.01f,   1391.90f) },
+    { simde_mm512_set_ps(    49.74f,     87.49f,    -21.00f,     37.63f,
+                             35.88f,    -74.89f,     77.58f,     24.55f,
+                            -86.21f,    -12.45f,     16.46f,    -51.53f,
+                            -21.07f,      2.34f,    -89.08f,    -77.79f),
+      simde_mm512_set_ps(     0.45f,     54.49f,    -99.01f,    -46.92f,
+                            -67.05f,    -91.22f,    -57.71f,     49.99f,
+                              1.60f,     95.41f,    -46.63f,     35.60f,
+                             -7.31f,     95.48f,     93.88f,     75.58f),
+      simde_mm512_set_ps(  -242.53f,    213.34f,    655.71f,    518.02f,
+                           -165.80f,   -745.15f,   -782.35f,     44.72f,
+                            180.56f,    945.79f,    719.21f,    603.31f,
+                            710.25f,    387.50f,    811.51f,    147.40f),
+      simde_mm512_set_ps(  -220.15f,   4980.67f,   2734.92f,  -1247.58f,
+                          -2571.55f,   6086.32f,  -5259.49f,   1271.97f,
+                             42.62f,   -242.06f,    -48.32f,  -1231.16f,
+                            864.27f,    610.92f,  -7551.32f,  -5731.97f) },
+    { simde_mm512_set_ps(    98.95f,     66.35f,     68.68f,     73.20f,
+                             71.10f,     73.46f,    -42.01f,    -61.83f,
+                            -16.40f,      1.46f,    -26.79f,     35.39f,
+                             82.18f,    -13.97f,     98.57f,     -9.42f),
+      simde_mm512_set_ps(    60.39f,    -14.08f,    -31.11f,    -67.15f,
+                            -77.13f,     88.71f,     -5.63f,    -91.99f,
+                             81.19f,     24.91f,    -76.75f,     33.14f,
+                             82.99f,     44.76f,    -31.86f,    -31.52f),
+      simde_mm512_set_ps(    85.04f,    -18.70f,   -451.99f,    620.05f,
+                            203.74f,    316.49f,   -890.92f,   -488.01f,
+                            886.02f,    403.77f,     55.43f,    -95.53f,
+                           -572.78f,    812.51f,   -765.75f,    208.38f),
+      simde_mm512_set_ps(  6060.63f,   -952.91f,  -2588.62f,  -4295.33f,
+                          -5280.20f,   6833.13f,   -654.40f,   5199.73f,
+                           -445.50f,    440.14f,   2111.56f,   1077.29f,
+                           6247.34f,    187.21f,  -3906.19f,    505.30f) },
+    { simde_mm512_set_ps(   -79.31f,     80.44f,     85.05f,     -0.16f,
+                              8.15f,     44.69f,     69.88f,    -12.98f,
+                             49.97f,    -50.29f,    -65.32f,      6.01f,
+                            -88.58f,    -10.74f,     18.49f,    -17.34f),
+      simde_mm512_set_ps(   -16.80f,     14.88f,     95.19f,    -63.22f,
+                             10.66f,    -47.19f,    -85.27f,    -88.01f,
+                             98.47f,    -43.06f,     36.30f,     -9.74f,
+                             63.14f,    -20.28f,     13.65f,    -63.51f),
+      simde_mm512_set_ps(  -349.39f,   -139.37f,   -818.57f,   -113.88f,
+                           -735.65f,   -204.00f,    866.70f,    383.68f,
+                            797.27f,   -536.05f,    -79.39f,    552.76f,
+                           -151.93f,   -983.85f,   -938.48f,   -843.39f),
+      simde_mm512_set_ps(   983.02f,   1057.58f,   7277.34f,   -103.76f,
+                           -648.77f,  -2312.92f,  -5091.97f,   1526.05f,
+                           5717.82f,   1629.44f,  -2450.51f,    494.22f,
+                          -5744.87f,   -766.04f,   -686.09f,    257.87f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_fmadd_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_kand(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { UINT16_C(0xb095),
+      UINT16_C(0x1e85),
+      UINT16_C(0x1085) },
+    { UINT16_C(0xfdff),
+      UINT16_C(0xd9ee),
+      UINT16_C(0xd9ee) },
+    { UINT16_C(0x4a8e),
+      UINT16_C(0x2393),
+      UINT16_C(0x0282) },
+    { UINT16_C(0x8f03),
+      UINT16_C(0xb191),
+      UINT16_C(0x8101) },
+    { UINT16_C(0xb280),
+      UINT16_C(0x0b9f),
+      UINT16_C(0x0280) },
+    { UINT16_C(0xeeac),
+      UINT16_C(0x3090),
+      UINT16_C(0x2080) },
+    { UINT16_C(0x4be0),
+      UINT16_C(0x39e0),
+      UINT16_C(0x09e0) },
+    { UINT16_C(0xd3ab),
+      UINT16_C(0x4911),
+      UINT16_C(0x4101) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_kand(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_kandn(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { UINT16_C(0x765a),
+      UINT16_C(0xd78f),
+      UINT16_C(0x8185) },
+    { UINT16_C(0xf539),
+      UINT16_C(0x91fe),
+      UINT16_C(0x00c6) },
+    { UINT16_C(0x161c),
+      UINT16_C(0x024f),
+      UINT16_C(0x0043) },
+    { UINT16_C(0x251b),
+      UINT16_C(0xaa4a),
+      UINT16_C(0x8a40) },
+    { UINT16_C(0x3a0e),
+      UINT16_C(0x6452),
+      UINT16_C(0x4450) },
+    { UINT16_C(0xa184),
+      UINT16_C(0x6227),
+      UINT16_C(0x4223) },
+    { UINT16_C(0xdc6e),
+      UINT16_C(0x1880),
+      UINT16_C(0x0080) },
+    { UINT16_C(0xf85b),
+      UINT16_C(0xc4c0),
+      UINT16_C(0x0480) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_kandn(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_knot(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { UINT16_C(0xd5fe),
+      UINT16_C(0x2a01) },
+    { UINT16_C(0x857f),
+      UINT16_C(0x7a80) },
+    { UINT16_C(0xa836),
+      UINT16_C(0x57c9) },
+    { UINT16_C(0x3a8c),
+      UINT16_C(0xc573) },
+    { UINT16_C(0xefc6),
+      UINT16_C(0x1039) },
+    { UINT16_C(0x481f),
+      UINT16_C(0xb7e0) },
+    { UINT16_C(0x876a),
+      UINT16_C(0x7895) },
+    { UINT16_C(0x9381),
+      UINT16_C(0x6c7e) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_knot(test_vec[i].a);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_kor(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { UINT16_C(0x5edd),
+      UINT16_C(0x4f0f),
+      UINT16_C(0x5fdf) },
+    { UINT16_C(0x9919),
+      UINT16_C(0xc79f),
+      UINT16_C(0xdf9f) },
+    { UINT16_C(0xa9d8),
+      UINT16_C(0x8e7b),
+      UINT16_C(0xaffb) },
+    { UINT16_C(0x5b18),
+      UINT16_C(0xa792),
+      UINT16_C(0xff9a) },
+    { UINT16_C(0xd084),
+      UINT16_C(0x9b2e),
+      UINT16_C(0xdbae) },
+    { UINT16_C(0x01bd),
+      UINT16_C(0xf599),
+      UINT16_C(0xf5bd) },
+    { UINT16_C(0x58a7),
+      UINT16_C(0xd5c1),
+      UINT16_C(0xdde7) },
+    { UINT16_C(0xf656),
+      UINT16_C(0x0c12),
+      UINT16_C(0xfe56) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_kor(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_kxnor(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { UINT16_C(0x9a0a),
+      UINT16_C(0x4192),
+      UINT16_C(0x2467) },
+    { UINT16_C(0x6b8d),
+      UINT16_C(0x5732),
+      UINT16_C(0xc340) },
+    { UINT16_C(0x4b31),
+      UINT16_C(0x1423),
+      UINT16_C(0xa0ed) },
+    { UINT16_C(0x262e),
+      UINT16_C(0xadfe),
+      UINT16_C(0x742f) },
+    { UINT16_C(0x7a26),
+      UINT16_C(0xf108),
+      UINT16_C(0x74d1) },
+    { UINT16_C(0xc8e8),
+      UINT16_C(0x957f),
+      UINT16_C(0xa268) },
+    { UINT16_C(0xca5b),
+      UINT16_C(0x32b4),
+      UINT16_C(0x0710) },
+    { UINT16_C(0x300e),
+      UINT16_C(0xd9ee),
+      UINT16_C(0x161f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_kxnor(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_kxor(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { UINT16_C(0xc2a0),
+      UINT16_C(0x1bc7),
+      UINT16_C(0xd967) },
+    { UINT16_C(0xe140),
+      UINT16_C(0x94d4),
+      UINT16_C(0x7594) },
+    { UINT16_C(0xb7db),
+      UINT16_C(0x5a01),
+      UINT16_C(0xedda) },
+    { UINT16_C(0xe4f0),
+      UINT16_C(0x5ccb),
+      UINT16_C(0xb83b) },
+    { UINT16_C(0xe5c5),
+      UINT16_C(0x69eb),
+      UINT16_C(0x8c2e) },
+    { UINT16_C(0xf494),
+      UINT16_C(0x90e1),
+      UINT16_C(0x6475) },
+    { UINT16_C(0x7183),
+      UINT16_C(0x4c99),
+      UINT16_C(0x3d1a) },
+    { UINT16_C(0x43c4),
+      UINT16_C(0x5e34),
+      UINT16_C(0x1df0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_kxor(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_add_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(-1971611604, -1732769026,  1892457514, -1992185677,
+                            -1448752285,  1672699939,  -748055700,   448596673,
+                             1837840052, -1855167041,  -229839152,  -463091552,
+                              242721113, -2146045440,  -637015473,  -135602415),
+      UINT16_C(0x274a),
+      simde_mm512_set_epi32( 1099439056,  -806296055,   344133197,  1409250251,
+                              -81614841, -1660791386,  -236562307,  -300451005,
+                             -373670629, -1804504024,   895806381,  -306604772,
+                            -1936049009,  -980003023,  -221779598,   506183052),
+      simde_mm512_set_epi32( 1223473658, -1483732478, -1598094484,  1064065217,
+                            -1988843367,  -136292445,  -917386386, -1543972552,
+                              475650925, -1788377766,   801687638,  1346821844,
+                             1537235933,  -397929047, -1705259087,  -894171395),
+      simde_mm512_set_epi32(-1971611604, -1732769026, -1253961287, -1992185677,
+                            -1448752285, -1797083831, -1153948693, -1844423557,
+                             1837840052,   702085506,  -229839152,  -463091552,
+                             -398813076, -2146045440, -1927038685,  -135602415) },
+    { simde_mm512_set_epi32(-1747916283,   619640955, -1260840457, -1933703359,
+                             -457188338,    21857582,  -290626522, -1638809232,
+                             -640789174,   189647712,   303510185,   540124895,
+                             -844868638, -2014685594, -1367553453,  1316606822),
+      UINT16_C(0xc7ef),
+      simde_mm512_set_epi32(  700441382, -1650415128,  1145362707,  1492925612,
+                            -1780004763,  1220798776,  -351822627,   998169149,
+                             1879431363,  1183583903, -1486159123,  -472212695,
+                             1908738286,  1032949318,  -495581803,  1670774474),
+      simde_mm512_set_epi32(-1696110853,  -391020550,  -638367019,  -967048346,
+                            -1671356231,   598404414,  1201671196,  -966574006,
+                             1390132458, -2098996677, -2018204850,   219690347,
+                             1260639150,   197064071, -1758052583,  1101360528),
+      simde_mm512_set_epi32( -995669471, -2041435678, -1260840457, -1933703359,
+                             -457188338,  1819203190,   849848569,    31595143,
+                            -1025403475,  -915412774,   790603323,   540124895,
+                            -1125589860,  1230013389,  2041332910, -1522832294) },
+    { simde_mm512_set_epi32(-1125916025,  -458998181,  -794101390,   502181148,
+                            -1007311283, -1797989589, -1393861589,  1596439013,
+                             2118637522,  1770840578,  1778233763,  -234480590,
+                            -1582993132,   147553105,   732107561, -1322545601),
+      UINT16_C(0xb3df),
+      simde_mm512_set_epi32( -881137004,  -359372456, -1705307442,    99644333,
+                             1565875549,  -311108367, -1771474251, -1068560384,
+                              495819654, -2063200525, -1189622696,  1101440651,
+                              375973780,  -946424846,   509806265, -1721523827),
+      simde_mm512_set_epi32(-1978718486, -1292389048, -1445500309,   765806611,
+                              335839946, -1821929733,  1653724298,  2011940807,
+                             -354492742,  1476958301,    -6734318,  1700127943,
+                            -1575672020, -1006772436, -1595080465,   456154510),
+      simde_mm512_set_epi32( 1435111806,  -458998181,  1144159545,   865450944,
+                            -1007311283, -1797989589,  -117749953,   943380423,
+                              141326912,  -586242224,  1778233763, -1493398702,
+                            -1199698240, -1953197282, -1085274200, -1265369317) },
+    { simde_mm512_set_epi32(  917847398,  1835556083,   393289173,    40450399,
+                              -75630160,  1577160257,  1735442673, -1879362077,
+                             -261154109,  1359863936,   552823511,   663432626,
+                             -298522289,  -864931754, -1545235393,  -681369223),
+      UINT16_C(0x3072),
+      simde_mm512_set_epi32( -635116172, -1575871414,   818506652, -2108970997,
+                             -280325510,   682924121,  -255228957,  -275501286,
+                            -2092424045, -1757468407,   299358430,   -53275071,
+                             2138184292,  1024690442,  1194172470,  -523858127),
+      simde_mm512_set_epi32(-1822222635, -1347484590, -1540027267,   844699622,
+                            -1475133861,   511082978, -2021545769,  -482626646,
+                            -1452134219, -1316957685,   956980198, -2000513488,
+                             1120292242, -2065142393,  1229777761,  1394322467),
+      simde_mm512_set_epi32(  917847398,  1835556083,  -721520615, -1264271375,
+                              -75630160,  1577160257,  1735442673, -1879362077,
+                             -261154109,  1220541204,  1256338628, -2053788559,
+                             -298522289,  -864931754, -1871017065,  -681369223) },
+    { simde_mm512_set_epi32( -452388300,  -572848830,  1887642155,   227337939,
+                             1343055858,  -374618998, -1309287420, -2082901678,
+                             1989131740,  -967445797,  2080253830,  -867807685,
+                              783323677,   554025647,  1138092804, -1648138563),
+      UINT16_C(0xfad3),
+      simde_mm512_set_epi32(-1926059102,  -604180471,   148705837, -1398685888,
+                             -439359318,  1435721670,  1521532721,  -121972101,
+                              741556898,   316528639,  1939413572,  1491631752,
+                             1446578450,   302193101, -1983476920, -1014279286),
+      simde_mm512_set_epi32(-1986508981,   929091525,  -103769656, -1247408213,
+                             -736581564,  -311555366,   363374645,  1167638647,
+                              142108538,   636889022, -1946757718,  1856298900,
+                             1331227198, -1951987254,   217864564, -1778814252),
+      simde_mm512_set_epi32(  382399213,   324911054,    44936181,  1648873195,
+                            -1175940882,  -374618998,  1884907366, -2082901678,
+                              883665436,   953417661,  2080253830,  -947036644,
+                              783323677,   554025647, -1765612356,  1501873758) },
+    { simde_mm512_set_epi32(-1650509709,  -432379677, -1395238224,  1661320097,
+                             1999237172, -1362431287, -1256563369,  1024570770,
+                              242424982,  2137309229,   721878518, -2117305740,
+                             1158437909,  -209071665,  -582357892,  -652617539),
+      UINT16_C(0x4660),
+      simde_mm512_set_epi32( 1549227190,   857120123,  1106432174,  -442922600,
+                             1717793531, -1769085124, -1824421163, -1225562306,
+                            -1672899763, -1521069445, -1257535562,   856770835,
+                            -2136864063, -2100084153,  -901783293,   618473785),
+      simde_mm512_set_epi32(-1814126092,  -481647934,  1674546826, -1806416197,
+                              398445524,   321331549,  -597796744, -1645249976,
+                              631040976,   512527401,   906483589, -1028466520,
+                             -958397929,  1821506709, -1017485611,  -794051146),
+      simde_mm512_set_epi32(-1650509709,   375472189, -1395238224,  1661320097,
+                             1999237172, -1447753575,  1872749389,  1024570770,
+                              242424982, -1008542044,  -351051973, -2117305740,
+                             1158437909,  -209071665,  -582357892,  -652617539) },
+    { simde_mm512_set_epi32( 2104475435, -2143482985,  1735550009,  -101181083,
+                               61782913, -1168538229,   445045623,  -204996141,
+                              721486439,  -967611146,    56010840, -1133969910,
+                              -83029800,  -490619508, -1193803843,  1499574585),
+      UINT16_C(0x6e3a),
+      simde_mm512_set_epi32( -131384785,  -919379437,   937788932, -1466904565,
+                            -1970366532,  -541103565,  1552497135, -1302042135,
+                              -56032025,  1814308602,   827100006,  1180488054,
+                            -1532300361,  1536242448,  -945869044,   330514730),
+      simde_mm512_set_epi32( 1459078699,  1345846682,  -201294898,  -564057315,
+                             1056751269,  -344320884, -2081645151, -1458475046,
+                              847958603,  1903580642,   222875442, -1483636357,
+                            -2005880904,  -633438291, -1642812539,  1974005781),
+      simde_mm512_set_epi32( 2104475435,   426467245,   736494034,  -101181083,
+                             -913615263,  -885424449,  -529148016,  -204996141,
+                              721486439,  -967611146,  1049975448,  -303148303,
+                              756786031,  -490619508,  1706285713,  1499574585) },
+    { simde_mm512_set_epi32( 2094235715, -1499182287,   841373643,   410558169,
+                             1828649916,   913768502, -1571294312,  -406503526,
+                             -888634635,   553956824,   869951099, -1731751034,
+                              218715768,  -424096290,  -181296958,  2035127801),
+      UINT16_C(0xc1ad),
+      simde_mm512_set_epi32( 1316349846, -1142081373,  1481953088,    96101504,
+                             -111941296,  1501011347, -1581329539, -2058433462,
+                             1629995381,  1950467229,  -251644800,  -736667030,
+                             -992939090,  2001940899,   890945555,     2482041),
+      simde_mm512_set_epi32(-1455000809,  -612846389,   694244246,  1678507619,
+                            -1086411614,  1743530475,   -50366792,  1326778518,
+                            -1291094247,  1628103198,  1684845624, -1047030006,
+                              677156551,  1407920889,  -843762379, -1456920980),
+      simde_mm512_set_epi32( -138650963, -1754927762,   841373643,   410558169,
+                             1828649916,   913768502, -1571294312,  -731654944,
+                              338901134,   553956824,  1433200824, -1731751034,
+                             -315782539,  -885105508,  -181296958, -1454438939) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_add_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_add_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 4286037560311691815), INT64_C(-3087509560160409618),
+                            INT64_C(  994025786284254393), INT64_C( 7719208605272649123),
+                            INT64_C(-2552993660325025276), INT64_C(-8392238856557866151),
+                            INT64_C( 1743413311403659368), INT64_C( 9117719559087336144)),
+      UINT8_C(0xbd),
+      simde_mm512_set_epi64(INT64_C(-5591354706664120210), INT64_C( 3319012012232630711),
+                            INT64_C(-8588369967300561809), INT64_C( 4594334772207279704),
+                            INT64_C(-5334091757751501090), INT64_C(-3003266771742483936),
+                            INT64_C(-5507252634461707008), INT64_C( 5643332283260831274)),
+      simde_mm512_set_epi64(INT64_C(-2936581138579494234), INT64_C( 8785922606958545527),
+                            INT64_C( 3175064424535957480), INT64_C(   -4143745711000788),
+                            INT64_C( 2249171307896958250), INT64_C(  148594263487915382),
+                            INT64_C( -190409635631640419), INT64_C( 7148980674763180301)),
+      simde_mm512_set_epi64(INT64_C(-8527935845243614444), INT64_C(-3087509560160409618),
+                            INT64_C(-5413305542764604329), INT64_C( 4590191026496278916),
+                            INT64_C(-3084920449854542840), INT64_C(-2854672508254568554),
+                            INT64_C( 1743413311403659368), INT64_C(-5654431115685540041)) },
+    { simde_mm512_set_epi64(INT64_C( 2737526060336085450), INT64_C( 7609010965878390292),
+                            INT64_C( 7358035604000566913), INT64_C(-7324728763338231118),
+                            INT64_C(-5047660810357633012), INT64_C(-7419523585279137365),
+                            INT64_C(-5641030365497456713), INT64_C(-1989406590823607688)),
+      UINT8_C(0xca),
+      simde_mm512_set_epi64(INT64_C(-5483480133728948977), INT64_C(-7276177281412672178),
+                            INT64_C(-2669864646284414868), INT64_C( 3622766863123083971),
+                            INT64_C(-6013173679638338681), INT64_C( 7075527556008000549),
+                            INT64_C(-1198720979547031348), INT64_C( 3006010176453103673)),
+      simde_mm512_set_epi64(INT64_C( 7141000315289469689), INT64_C(  837422171211519221),
+                            INT64_C( -939839497667037839), INT64_C( 7812635673920807315),
+                            INT64_C( 3542733171564405069), INT64_C(-6751729593525295379),
+                            INT64_C( 5924186847835220224), INT64_C( -179175291367617712)),
+      simde_mm512_set_epi64(INT64_C( 1657520181560520712), INT64_C(-6438755110201152957),
+                            INT64_C( 7358035604000566913), INT64_C(-7324728763338231118),
+                            INT64_C(-2470440508073933612), INT64_C(-7419523585279137365),
+                            INT64_C( 4725465868288188876), INT64_C(-1989406590823607688)) },
+    { simde_mm512_set_epi64(INT64_C( 2630068270139303351), INT64_C(-2137965840142029668),
+                            INT64_C(  152575414875467098), INT64_C(-9187620043148176140),
+                            INT64_C( 8774118843101819964), INT64_C( 8784156442800441157),
+                            INT64_C(-3435824706764173512), INT64_C(-1490030223312326064)),
+      UINT8_C(0x0d),
+      simde_mm512_set_epi64(INT64_C( 2054786996471494825), INT64_C( 3387608833811456143),
+                            INT64_C( 1841276066997445713), INT64_C( 6110137868581922441),
+                            INT64_C( 6414979106057030638), INT64_C(-1436022080202301996),
+                            INT64_C( 7306767223442031249), INT64_C(-6046178861368593020)),
+      simde_mm512_set_epi64(INT64_C(-8479531705654246408), INT64_C( 1984608816361849743),
+                            INT64_C(-2183182788711586111), INT64_C(-1128164201361377738),
+                            INT64_C(-1138587191587290315), INT64_C(-6452976600590872748),
+                            INT64_C(-6089860159096197385), INT64_C(-8427948158257435084)),
+      simde_mm512_set_epi64(INT64_C( 2630068270139303351), INT64_C(-2137965840142029668),
+                            INT64_C(  152575414875467098), INT64_C(-9187620043148176140),
+                            INT64_C( 5276391914469740323), INT64_C(-7888998680793174744),
+                            INT64_C(-3435824706764173512), INT64_C( 3972617054083523512)) },
+    { simde_mm512_set_epi64(INT64_C(-8715443910892330889), INT64_C(-6634809094002943354),
+                            INT64_C(-3088382635112406867), INT64_C(-5767292717751333517),
+                            INT64_C( 4678036677203337261), INT64_C( 4734722769701130694),
+                            INT64_C( -770819819784299887), INT64_C(-1194489617865015840)),
+      UINT8_C(0xfa),
+      simde_mm512_set_epi64(INT64_C(  568520208325329000), INT64_C(-5537285821468424283),
+                            INT64_C(-5100253521996337716), INT64_C(-2701311745461845895),
+                            INT64_C( -756918033728713211), INT64_C( -250538921046247143),
+                            INT64_C(-7365033822859256390), INT64_C(-7006379762365317318)),
+      simde_mm512_set_epi64(INT64_C(-3312774293371337254), INT64_C( 3229338773293786868),
+                            INT64_C(  984454868633229835), INT64_C( 7283749695918299011),
+                            INT64_C( -918056016806535130), INT64_C( 5182451662800515208),
+                            INT64_C( 7977733555778286874), INT64_C(  357401933419771427)),
+      simde_mm512_set_epi64(INT64_C(-2744254085046008254), INT64_C(-2307947048174637415),
+                            INT64_C(-4115798653363107881), INT64_C( 4582437950456453116),
+                            INT64_C(-1674974050535248341), INT64_C( 4734722769701130694),
+                            INT64_C(  612699732919030484), INT64_C(-1194489617865015840)) },
+    { simde_mm512_set_epi64(INT64_C(-7045417283795025342), INT64_C(-7491800467982646286),
+                            INT64_C( 4945684313807748429), INT64_C(-6631343692257298880),
+                            INT64_C( 8141762751472865456), INT64_C(-6485654110510222181),
+                            INT64_C(  565770502352595631), INT64_C(-4391244481366121686)),
+      UINT8_C(0xa2),
+      simde_mm512_set_epi64(INT64_C(  751646557813421449), INT64_C(-1995099082159150968),
+                            INT64_C(-8565500625775089078), INT64_C(-7245309004285424536),
+                            INT64_C(-8310924864632303362), INT64_C(-2330616163278784923),
+                            INT64_C(-4518520068933861653), INT64_C(-7845820543615712462)),
+      simde_mm512_set_epi64(INT64_C( 6656296508789332767), INT64_C( 8205912856745573577),
+                            INT64_C( 8860558865659538263), INT64_C(-7126110888945551651),
+                            INT64_C( 6195454451579190948), INT64_C( -801632382285403383),
+                            INT64_C(-7116943219345874375), INT64_C(-3542681631301045783)),
+      simde_mm512_set_epi64(INT64_C( 7407943066602754216), INT64_C(-7491800467982646286),
+                            INT64_C(  295058239884449185), INT64_C(-6631343692257298880),
+                            INT64_C( 8141762751472865456), INT64_C(-6485654110510222181),
+                            INT64_C( 6811280785429815588), INT64_C(-4391244481366121686)) },
+    { simde_mm512_set_epi64(INT64_C(-2522036353020850017), INT64_C(-2164975800075003949),
+                            INT64_C(-8238957404748550464), INT64_C( 1829535173998453533),
+                            INT64_C(-3868190130722999028), INT64_C( 8802987724621889066),
+                            INT64_C( 2892675651594359565), INT64_C(  603729043228057713)),
+      UINT8_C(0xc7),
+      simde_mm512_set_epi64(INT64_C(-2561242261412421980), INT64_C( 1689493388386501844),
+                            INT64_C(-3913103380851632181), INT64_C(  496279430845170523),
+                            INT64_C( 3202525690628400136), INT64_C( 1919701165285805507),
+                            INT64_C( 5123949021403489649), INT64_C( 6591392389463587324)),
+      simde_mm512_set_epi64(INT64_C( 2209594500789403417), INT64_C(-5446549191175712923),
+                            INT64_C(-3405359164192835430), INT64_C(-3090190219858961475),
+                            INT64_C( 3144862050531218803), INT64_C( 8562926251339251894),
+                            INT64_C( 3560901838629433511), INT64_C( 3343454317899947790)),
+      simde_mm512_set_epi64(INT64_C( -351647760623018563), INT64_C(-3757055802789211079),
+                            INT64_C(-8238957404748550464), INT64_C( 1829535173998453533),
+                            INT64_C(-3868190130722999028), INT64_C(-7964116657084494215),
+                            INT64_C( 8684850860032923160), INT64_C(-8511897366346016502)) },
+    { simde_mm512_set_epi64(INT64_C(-1151299725896496878), INT64_C(-6678158583858305132),
+                            INT64_C(-1758748231506694054), INT64_C( 6967040328715989468),
+                            INT64_C( 8967346287778527371), INT64_C(-1060603635120769703),
+                            INT64_C( 3660961437594578291), INT64_C(-7703694145506344877)),
+      UINT8_C(0x15),
+      simde_mm512_set_epi64(INT64_C(  679161491587088704), INT64_C( 1059002121928832183),
+                            INT64_C( 2967328179776319289), INT64_C(-2667188924439068790),
+                            INT64_C( 4755134425363382308), INT64_C( 2170498390739825505),
+                            INT64_C(-8013700147337865164), INT64_C( -202072041966112808)),
+      simde_mm512_set_epi64(INT64_C( 2779517405719110801), INT64_C( 5116942394178767901),
+                            INT64_C( 4520568586106174401), INT64_C(-8366477772268909144),
+                            INT64_C(  406005334804925963), INT64_C(-6324824331109507328),
+                            INT64_C( 4646406834874423889), INT64_C(-7447512107247472703)),
+      simde_mm512_set_epi64(INT64_C(-1151299725896496878), INT64_C(-6678158583858305132),
+                            INT64_C(-1758748231506694054), INT64_C( 7413077377001573682),
+                            INT64_C( 8967346287778527371), INT64_C(-4154325940369681823),
+                            INT64_C( 3660961437594578291), INT64_C(-7649584149213585511)) },
+    { simde_mm512_set_epi64(INT64_C( 5707005392403431305), INT64_C( 7469178489591840193),
+                            INT64_C( 3649656326085266385), INT64_C( 6573003918882737266),
+                            INT64_C( 5641261035980783190), INT64_C( 3834982013920569681),
+                            INT64_C(-5232765572046710565), INT64_C(-5299210971784231921)),
+      UINT8_C(0x0d),
+      simde_mm512_set_epi64(INT64_C( 7196082445190797353), INT64_C(-7087867897196889168),
+                            INT64_C( 5998940357252740970), INT64_C(-5729316045459936221),
+                            INT64_C(-4144343033765146307), INT64_C(-6060107617802753063),
+                            INT64_C( 7985035026923151468), INT64_C( 5977558493389573088)),
+      simde_mm512_set_epi64(INT64_C(-6462837804299040846), INT64_C( 4595680370900673367),
+                            INT64_C(-7844650539577745302), INT64_C(-3158325144812083536),
+                            INT64_C( 8256673779044900687), INT64_C(-5100326849686572262),
+                            INT64_C(-8537033548536227485), INT64_C(-2704040777147601606)),
+      simde_mm512_set_epi64(INT64_C( 5707005392403431305), INT64_C( 7469178489591840193),
+                            INT64_C( 3649656326085266385), INT64_C( 6573003918882737266),
+                            INT64_C( 4112330745279754380), INT64_C( 7286309606220226291),
+                            INT64_C(-5232765572046710565), INT64_C( 3273517716241971482)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_add_epi64(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_add_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 src;
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(  -500.71f,   -734.63f,    307.89f,   -931.83f,
+                            765.97f,   -393.70f,    338.41f,   -585.56f,
+                            756.34f,   -240.18f,      5.83f,   -106.13f,
+                            122.55f,    864.52f,    721.10f,    205.46f),
+      UINT16_C(0x4a96),
+      simde_mm512_set_ps(   -41.32f,   -503.71f,    447.35f,   -541.91f,
+                            344.23f,   -175.31f,   -402.29f,    497.76f,
+                           -718.54f,    -74.00f,    106.76f,   -814.45f,
+                           -603.08f,     33.20f,    654.58f,    448.74f),
+      simde_mm512_set_ps(   693.78f,   -246.96f,   -396.72f,    858.65f,
+                            746.51f,    -31.17f,    630.97f,   -761.53f,
+                            220.81f,    717.44f,   -648.76f,   -996.23f,
+                           -474.65f,    818.79f,   -248.25f,   -782.25f),
+      simde_mm512_set_ps(  -500.71f,   -750.67f,    307.89f,   -931.83f,
+                           1090.74f,   -393.70f,    228.68f,   -585.56f,
+                           -497.73f,   -240.18f,      5.83f,  -1810.68f,
+                            122.55f,    851.99f,    406.33f,    205.46f) },
+    { simde_mm512_set_ps(    96.43f,    508.20f,    541.44f,   -138.26f,
+                            459.36f,   -798.24f,    967.10f,    443.99f,
+                            787.58f,   -766.45f,    726.01f,   -359.77f,
+                            619.45f,   -973.94f,   -668.55f,    716.03f),
+      UINT16_C(0x8b9a),
+      simde_mm512_set_ps(  -767.74f,    435.90f,   -444.63f,    350.38f,
+                           -392.86f,    848.35f,    213.42f,   -255.51f,
+                            773.70f,   -519.08f,    934.57f,    -51.60f,
+                           -648.26f,   -108.28f,   -785.81f,    886.17f),
+      simde_mm512_set_ps(  -599.52f,   -699.33f,   -684.30f,   -977.60f,
+                            685.06f,   -908.63f,   -495.83f,     42.32f,
+                           -570.15f,    161.83f,    855.88f,    704.32f,
+                            -49.93f,     64.95f,    547.56f,    780.01f),
+      simde_mm512_set_ps( -1367.26f,    508.20f,    541.44f,   -138.26f,
+                            292.20f,   -798.24f,   -282.41f,   -213.19f,
+                            203.55f,   -766.45f,    726.01f,    652.72f,
+                           -698.19f,   -973.94f,   -238.25f,    716.03f) },
+    { simde_mm512_set_ps(  -957.32f,   -706.08f,   -284.98f,   -750.47f,
+                            -69.44f,   -328.09f,   -866.14f,   -409.86f,
+                           -319.79f,    509.36f,    564.10f,    907.08f,
+                            222.22f,   -150.74f,   -607.41f,    415.92f),
+      UINT16_C(0x3e5b),
+      simde_mm512_set_ps(   575.37f,    955.40f,   -132.83f,    360.64f,
+                           -880.38f,    160.02f,    660.04f,   -964.86f,
+                           -688.67f,    879.99f,    961.60f,    653.97f,
+                           -274.92f,    846.63f,   -310.40f,   -610.02f),
+      simde_mm512_set_ps(   803.65f,     97.32f,    784.30f,    181.01f,
+                            681.12f,     48.42f,   -913.91f,    345.06f,
+                            -77.07f,   -981.31f,   -870.52f,   -441.17f,
+                           -673.22f,   -514.83f,    662.40f,    -10.29f),
+      simde_mm512_set_ps(  -957.32f,   -706.08f,    651.47f,    541.65f,
+                           -199.26f,    208.44f,   -253.87f,   -409.86f,
+                           -319.79f,   -101.32f,    564.10f,    212.80f,
+                           -948.14f,   -150.74f,    352.00f,   -620.31f) },
+    { simde_mm512_set_ps(  -283.99f,    948.32f,    -19.10f,   -490.35f,
+                           -826.17f,    437.39f,   -512.36f,   -982.93f,
+                           -884.30f,   -559.95f,     16.81f,   -232.29f,
+                            -98.84f,   -130.25f,   -248.64f,    637.23f),
+      UINT16_C(0x3b4a),
+      simde_mm512_set_ps(   322.69f,   -528.39f,   -407.95f,    864.03f,
+                           -218.92f,   -995.24f,    -42.52f,    980.01f,
+                           -229.81f,    367.77f,    424.52f,   -108.02f,
+                            434.59f,    425.88f,    487.93f,    655.95f),
+      simde_mm512_set_ps(   419.57f,    255.69f,    954.05f,   -160.84f,
+                            473.63f,    902.10f,    231.53f,   -601.00f,
+                            474.06f,    874.58f,    917.82f,   -967.21f,
+                           -870.56f,     20.76f,   -480.51f,    396.88f),
+      simde_mm512_set_ps(  -283.99f,    948.32f,    546.10f,    703.19f,
+                            254.71f,    437.39f,    189.01f,    379.01f,
+                           -884.30f,   1242.35f,     16.81f,   -232.29f,
+                           -435.97f,   -130.25f,      7.42f,    637.23f) },
+    { simde_mm512_set_ps(   146.91f,   -645.39f,   -239.53f,   -295.46f,
+                            763.93f,   -681.95f,   -150.67f,   -491.01f,
+                           -282.57f,    114.00f,      5.02f,    244.46f,
+                           -641.84f,   -455.79f,   -913.11f,    675.77f),
+      UINT16_C(0xacff),
+      simde_mm512_set_ps(  -193.11f,    177.06f,   -416.08f,     92.30f,
+                           -898.60f,   -407.92f,   -798.62f,      6.91f,
+                             44.24f,    973.25f,    612.67f,   -875.90f,
+                            595.96f,    813.96f,   -484.62f,    283.25f),
+      simde_mm512_set_ps(   995.87f,   -909.70f,     95.90f,     83.41f,
+                           -519.54f,   -764.08f,    466.01f,    -86.06f,
+                           -724.80f,   -443.12f,    172.50f,   -513.32f,
+                           -176.16f,    419.43f,    837.70f,    351.39f),
+      simde_mm512_set_ps(   802.76f,   -645.39f,   -320.18f,   -295.46f,
+                          -1418.14f,  -1172.00f,   -150.67f,   -491.01f,
+                           -680.56f,    530.13f,    785.17f,  -1389.22f,
+                            419.80f,   1233.39f,    353.08f,    634.64f) },
+    { simde_mm512_set_ps(   412.24f,    -15.63f,     -7.06f,    579.99f,
+                           -878.19f,   -299.42f,    197.81f,    705.14f,
+                           -296.30f,    966.89f,    791.93f,   -357.00f,
+                            778.22f,    669.27f,     99.52f,   -423.12f),
+      UINT16_C(0xffdf),
+      simde_mm512_set_ps(  -880.02f,    435.81f,   -833.36f,    103.47f,
+                           -944.87f,   -832.42f,   -532.39f,    -76.24f,
+                            321.69f,    -28.19f,   -963.04f,     16.89f,
+                           -181.94f,     96.26f,   -959.38f,    583.83f),
+      simde_mm512_set_ps(  -255.29f,    421.87f,    960.98f,   -245.60f,
+                           -955.03f,    457.41f,   -287.23f,    -24.73f,
+                           -665.93f,    375.33f,   -323.61f,    186.23f,
+                           -939.05f,    825.91f,    915.76f,    735.16f),
+      simde_mm512_set_ps( -1135.31f,    857.68f,    127.62f,   -142.13f,
+                          -1899.90f,   -375.01f,   -819.62f,   -100.97f,
+                           -344.24f,    347.14f,    791.93f,    203.12f,
+                          -1120.99f,    922.17f,    -43.62f,   1318.99f) },
+    { simde_mm512_set_ps(     2.86f,    523.21f,    805.44f,   -785.95f,
+                            647.52f,   -158.25f,    450.80f,    575.44f,
+                            371.67f,    663.14f,   -604.64f,   -286.84f,
+                           -712.08f,    335.96f,   -142.88f,    934.66f),
+      UINT16_C(0xc83c),
+      simde_mm512_set_ps(  -308.25f,    553.99f,   -310.73f,    -40.14f,
+                            633.04f,    697.01f,    608.25f,   -354.20f,
+                            778.76f,    887.89f,   -601.75f,   -402.92f,
+                             39.92f,    749.63f,    601.47f,   -970.23f),
+      simde_mm512_set_ps(   -51.84f,    986.15f,    340.57f,   -156.66f,
+                           -283.30f,     39.66f,   -782.25f,    958.58f,
+                            522.37f,    653.68f,   -855.14f,   -933.06f,
+                           -815.97f,    651.70f,   -396.49f,    914.84f),
+      simde_mm512_set_ps(  -360.09f,   1540.14f,    805.44f,   -785.95f,
+                            349.74f,   -158.25f,    450.80f,    575.44f,
+                            371.67f,    663.14f,  -1456.89f,  -1335.98f,
+                           -776.05f,   1401.33f,   -142.88f,    934.66f) },
+    { simde_mm512_set_ps(   145.48f,    439.02f,   -775.90f,    995.17f,
+                           -166.42f,    431.12f,    257.81f,    442.72f,
+                            576.78f,    777.11f,     54.08f,   -423.23f,
+                           -918.00f,    853.72f,   -949.48f,    123.26f),
+      UINT16_C(0x48d8),
+      simde_mm512_set_ps(   818.41f,   -747.49f,   -256.20f,     94.73f,
+                           -501.32f,    -98.75f,     56.36f,   -283.81f,
+                           -474.02f,    574.53f,   -422.81f,   -499.33f,
+                           -546.11f,   -324.07f,    -73.67f,    466.82f),
+      simde_mm512_set_ps(  -764.23f,   -525.18f,    647.58f,    -21.91f,
+                             26.49f,   -280.08f,    146.49f,    456.58f,
+                           -597.23f,    -42.54f,    828.07f,    907.79f,
+                           -922.29f,    177.27f,   -338.05f,   -709.06f),
+      simde_mm512_set_ps(   145.48f,  -1272.67f,   -775.90f,    995.17f,
+                           -474.83f,    431.12f,    257.81f,    442.72f,
+                          -1071.25f,    531.99f,     54.08f,    408.46f,
+                          -1468.40f,    853.72f,   -949.48f,    123.26f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_mask_add_ps(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_cmpeq_epi32_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { UINT16_C(0x13bb),
+      simde_mm512_set_epi32(-1196304753,  -763082660,   844654410, -1070397887,
+                             1836375521,  -559409270,   458027369,  -954410567,
+                              809682067,  1000846921,  1423443173, -1577686127,
+                             -385418109,  2015185129, -1015060271, -2006296783),
+      simde_mm512_set_epi32(-1196304753,  1381902121,   844654410,  -311364679,
+                             1836375521,  1688199332,   -77174395,  1763035531,
+                              809682067,  -837741377,  -617268182, -1577686127,
+                             -385418109,  1519968807, -1015060271, -2006296783),
+      UINT16_C(0x009b) },
+    { UINT16_C(0x07fa),
+      simde_mm512_set_epi32(  669100731,   831053107, -1552921338, -2112026426,
+                              503019300,  2067336910, -1740438418,   972660539,
+                            -1450726545, -1925625607, -1731291361,  2083141705,
+                             1520023554,  2133043990, -1256084885,  1870480628),
+      simde_mm512_set_epi32(  669100731,  1611257575, -1552921338,  -896790561,
+                             -772348508,  -541189571, -1740438418,   972660539,
+                            -1450726545, -1925625607, -1019388436, -1625920157,
+                             -379874963,  2133043990, -1292601012,  1870480628),
+      UINT16_C(0x03c0) },
+    { UINT16_C(0xe18d),
+      simde_mm512_set_epi32( -159527484,   262621160, -1171799155,  1999280536,
+                            -1663720885, -1184441861,   269958844,   625007447,
+                             1516647555, -2086748672, -2065891059,   468967521,
+                             1028443778, -1268131262,  -588666076,  -521621183),
+      simde_mm512_set_epi32( -159527484,    95341020, -1171799155, -1999145359,
+                            -1746091195, -1184441861, -1769235174,  1510242379,
+                              770471537,  1022311107, -2065891059,   468967521,
+                             1028443778, -1638141021,  -588666076,  -521621183),
+      UINT16_C(0xa009) },
+    { UINT16_C(0x8f54),
+      simde_mm512_set_epi32(-1987740421,  -604445563, -1556804946,  -903798472,
+                             1240418771,    -2782550,   697476460,  1680625246,
+                               -2683300, -2019223702,  -356608136,  -343013297,
+                             1105096498, -1186269015, -1144913680, -1463619164),
+      simde_mm512_set_epi32(-1987740421,   921532560, -1556804946,  -903798472,
+                             1240418771,    -2782550,   697476460,   122006530,
+                            -1643588630, -2019223702, -1150944081,  -343013297,
+                            -1879550184, -2046608643,    94273061, -1463619164),
+      UINT16_C(0x8e50) },
+    { UINT16_C(0xeb1f),
+      simde_mm512_set_epi32( -240512596,   529606656, -1699110456, -1191900434,
+                              237221678,  2082656160, -1588802034,   649574493,
+                              736460967, -1620755921,  -541955406,   393974905,
+                            -1968389801,  1274782646, -1242258688, -1788472656),
+      simde_mm512_set_epi32( -240512596,  -975748375, -1699110456, -1670316519,
+                              729364122,  -174904201, -1588802034,   649574493,
+                              736460967, -1620755921,  -541955406,   393974905,
+                              399172289,  1274782646, -1200051874, -1788472656),
+      UINT16_C(0xa315) },
+    { UINT16_C(0x698a),
+      simde_mm512_set_epi32(-1401077550,   540519128, -1497928929,  1427830896,
+                             -739253097, -1094314946,  -199864861, -1206143425,
+                            -1000414092,  -411383471, -1558134471,  1083378773,
+                              501258554,  1807176278,  -564341439,   723743201),
+      simde_mm512_set_epi32(-1401077550,   540519128, -1533659575,  1427830896,
+                             -739253097, -1094314946,  -199864861, -1206143425,
+                            -1000414092,  -694789818, -1558134471,  1083378773,
+                             -123720707,  1807176278,  -564341439, -1673534938),
+      UINT16_C(0x4982) },
+    { UINT16_C(0xdfbc),
+      simde_mm512_set_epi32(-1430169141,  -859286897,  2070830581,  -807412447,
+                             -985762064,   275166228,  1392093899,   483961477,
+                             -207198446,   574490080,   845293706,  -449105827,
+                             1154794474,      484843,  2037668890,  -874374822),
+      simde_mm512_set_epi32( -931643316, -1233871958,  2070830581,  -807412447,
+                             -985762064,   275166228,  1392093899,  -359867390,
+                             -882917369,   574490080, -1108207178,  -449105827,
+                             -175069324,      484843,  2037668890,  -874374822),
+      UINT16_C(0x1e14) },
+    { UINT16_C(0xc225),
+      simde_mm512_set_epi32( -367976047, -1052259052,   916273015,  -928373974,
+                            -1107296024,   747915846,  -578274968,  -239410129,
+                             -771286897,  -139195124, -1903514510,  2093831011,
+                             1778015446,   345169311,   123786174, -1348449096),
+      simde_mm512_set_epi32(-1243022090, -1052259052,   916273015,  -928373974,
+                            -1107296024,  1369524639,  -578274968,    73794982,
+                             -771286897,  -139195124, -1903514510,  2093831011,
+                            -1754273829, -1525987798, -1679775313, -1348449096),
+      UINT16_C(0x4221) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_mask_cmpeq_epi32_mask(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    munit_assert_uint16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_cmpgt_epi64_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C(0x63),
+      simde_mm512_set_epi64(INT64_C( -441929939900057113), INT64_C( 3427502710144385820),
+                            INT64_C( 1263216972106596093), INT64_C(   42618704342302761),
+                            INT64_C(-8977662150387717344), INT64_C( 2094673096113937066),
+                            INT64_C(-2839100526933443738), INT64_C( 2432918636854086985)),
+      simde_mm512_set_epi64(INT64_C( -441929939900057113), INT64_C( 3427502712313449620),
+                            INT64_C( 1263216972106596093), INT64_C(   42618704342302761),
+                            INT64_C( 7782782737347814139), INT64_C( 2094673097669880306),
+                            INT64_C(-3912274551961945242), INT64_C( 6512114751832994068)),
+      UINT8_C(0x02) },
+    { UINT8_C(0xbd),
+      simde_mm512_set_epi64(INT64_C(-8399308840209774213), INT64_C( 4174591984779750090),
+                            INT64_C(-2050884515475354103), INT64_C(-6179799672628496986),
+                            INT64_C( -303608740295335008), INT64_C(  555868818857747124),
+                            INT64_C( -849303426178642302), INT64_C(-5199961323714631387)),
+      simde_mm512_set_epi64(INT64_C( 4726803304210705551), INT64_C( 4174591984779750090),
+                            INT64_C(-4561364491581854060), INT64_C(  458466722966918244),
+                            INT64_C( -303608740190227419), INT64_C(  555868816162941466),
+                            INT64_C( -849303426178642302), INT64_C( 8133538886056421669)),
+      UINT8_C(0x24) },
+    { UINT8_C(0x80),
+      simde_mm512_set_epi64(INT64_C( 5938003952582872668), INT64_C(-5790916884969152653),
+                            INT64_C( -889765801432149516), INT64_C(-2235069865503755019),
+                            INT64_C(  411476295706714623), INT64_C(-6142190510688025589),
+                            INT64_C(-1430520223324142038), INT64_C(-9000705041389486887)),
+      simde_mm512_set_epi64(INT64_C( 5938003951846843627), INT64_C(-5790916884969152653),
+                            INT64_C( -889765801432149516), INT64_C( 3363525020765874301),
+                            INT64_C(  411476295706714623), INT64_C(-6142190514629335284),
+                            INT64_C(-1430520223324142038), INT64_C(-9000705041389486887)),
+      UINT8_C(0x80) },
+    { UINT8_C(0x4c),
+      simde_mm512_set_epi64(INT64_C( 3970864076251538921), INT64_C(-7131407396652685127),
+                            INT64_C(-7498629503733741460), INT64_C( -380281099652093202),
+                            INT64_C( 2502557245150572335), INT64_C(-7386972595618061112),
+                            INT64_C( 1627728756449379311), INT64_C(  183328290842172366)),
+      simde_mm512_set_epi64(INT64_C( 4873539380076422633), INT64_C(-7131407396652685127),
+                            INT64_C( 6870925433260460140), INT64_C( 4327117083850648302),
+                            INT64_C(-6095248707032120082), INT64_C( -137923993110584120),
+                            INT64_C( 3774906436951527310), INT64_C(  183328290842172366)),
+      UINT8_C(0x08) },
+    { UINT8_C(0xc0),
+      simde_mm512_set_epi64(INT64_C( 4883458616980074121), INT64_C(-6869092521904900485),
+                            INT64_C( 6994585496560867400), INT64_C( 6170922000710592096),
+                            INT64_C( 6018321486195907221), INT64_C(-2807962093785074871),
+                            INT64_C( 4639369293664024465), INT64_C(-2034706226608108012)),
+      simde_mm512_set_epi64(INT64_C( -210241105652158839), INT64_C(-6869092522280819126),
+                            INT64_C( 6994585496560867400), INT64_C( 6170922000710592096),
+                            INT64_C( 3321242162052715851), INT64_C(  622652396923630409),
+                            INT64_C( 4639369293664024465), INT64_C(-2034706226608108012)),
+      UINT8_C(0xc0) },
+    { UINT8_C(0x6e),
+      simde_mm512_set_epi64(INT64_C( 8025415432098644766), INT64_C( -199045228957494150),
+                            INT64_C(-8687485633592765282), INT64_C(-3574840750367406981),
+                            INT64_C(-3259218049165580828), INT64_C(  970464891906272544),
+                            INT64_C(-8058799110642579645), INT64_C(-1709670697248870214)),
+      simde_mm512_set_epi64(INT64_C( 8025415429865030893), INT64_C(-8730855652989649069),
+                            INT64_C(-8687485631038933630), INT64_C(-8470016016447798149),
+                            INT64_C(-3259218049165580828), INT64_C(  915230611752332576),
+                            INT64_C(-3806179596037680329), INT64_C( 8750394264623291279)),
+      UINT8_C(0x44) },
+    { UINT8_C(0x20),
+      simde_mm512_set_epi64(INT64_C(  605493788526272533), INT64_C( 5547172026432476742),
+                            INT64_C( 1009657250751186225), INT64_C( -439437996533343201),
+                            INT64_C( 3404129813576023514), INT64_C( 7671571362138331443),
+                            INT64_C(-4175690794422876986), INT64_C( 2173636126145720675)),
+      simde_mm512_set_epi64(INT64_C( 8159118712634368021), INT64_C( 5547172026432476742),
+                            INT64_C( 1009657251307497576), INT64_C(-2662834929497138145),
+                            INT64_C( 3404129813576023514), INT64_C( -239609911484311245),
+                            INT64_C( 5493168888060831945), INT64_C( 2173636127115818391)),
+      UINT8_C(0x00) },
+    { UINT8_C(0xd1),
+      simde_mm512_set_epi64(INT64_C( 9165400497327645741), INT64_C( 5196402204713108717),
+                            INT64_C(-6123045442841126911), INT64_C( 2737629713005072915),
+                            INT64_C(-4669792757708489757), INT64_C(-7664049616935329059),
+                            INT64_C(-1493252337333025799), INT64_C(-2531539644231358315)),
+      simde_mm512_set_epi64(INT64_C( 1249115294757124573), INT64_C( 5196402204713108717),
+                            INT64_C( 8405425643069385802), INT64_C( 2737629713005072915),
+                            INT64_C(-4669792757708489757), INT64_C(-7664049617295022115),
+                            INT64_C(-4942591669976546311), INT64_C( 3887794291132950677)),
+      UINT8_C(0x80) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_mm512_mask_cmpgt_epi64_mask(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_compress_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( -515582232,  2033064692,   383820229,   500059771,
+                             -829299312,    84686477,  2007895027,  -289865106,
+                            -1712832678,  1350171741,  2046340519,  -996420037,
+                             1962916072, -2058922281,  1317384406, -1445770942),
+      UINT16_C(0x7886),
+      simde_mm512_set_epi32( 1356176394,   555778661,   247950592, -1686201807,
+                              967928689,   768592046,   -63406598,  -624994939,
+                             1847487725,  1881224344,  -629184109, -1909680003,
+                            -1277964867,  1153591783,  -855446148, -2115452422),
+      simde_mm512_set_epi32( -515582232,  2033064692,   383820229,   500059771,
+                             -829299312,    84686477,  2007895027,  -289865106,
+                            -1712832678,   555778661,   247950592, -1686201807,
+                              967928689,  1847487725,  1153591783,  -855446148) },
+    { simde_mm512_set_epi32(     -62276,  -494381358, -1205999845, -1683937587,
+                               95469820, -1884064769, -1847296158,  1278660827,
+                             1969745336,  1291338222,  1531025987,   873776252,
+                             -326573862, -1901383782,   367872179,   290034711),
+      UINT16_C(0x3225),
+      simde_mm512_set_epi32( 2131775155, -1241580122,  1324566895,  -678548945,
+                             1479467049,  1676228649, -2088916928, -1305600347,
+                             -422039824,   186016525,   631867050, -1025662741,
+                               15413291,  1168993537,  -493147408,   658182310),
+      simde_mm512_set_epi32(     -62276,  -494381358, -1205999845, -1683937587,
+                               95469820, -1884064769, -1847296158,  1278660827,
+                             1969745336,  1291338222,  1324566895,  -678548945,
+                            -2088916928,   631867050,  1168993537,   658182310) },
+    { simde_mm512_set_epi32( 2034146954, -1133344804,  1462500224,  1784650872,
+                             1427438312,   218462448,   347896290, -1233857949,
+                              834066927,  1754084791,  1434916998,  -499567743,
+                             1819716933,  -902777898,   492306179,   -15613193),
+      UINT16_C(0x37d1),
+      simde_mm512_set_epi32(-1085700465,  1665999771,   953480278,   627995062,
+                            -1806357124,   -93796334,     1455386,   910187504,
+                              935181060,  2038924627,  -868233590,  -448311291,
+                              -11880479,   169829449,   121415650,  1029665220),
+      simde_mm512_set_epi32( 2034146954, -1133344804,  1462500224,  1784650872,
+                             1427438312,   218462448,   347896290,   953480278,
+                              627995062,   -93796334,     1455386,   910187504,
+                              935181060,  2038924627,  -448311291,  1029665220) },
+    { simde_mm512_set_epi32(  692156251, -1251163138,  -794760780,   290814750,
+                            -1847043452,  2141907897,   396893967, -1183779298,
+                             2071458740,  -280437239, -1592785154,  -531934363,
+                              293729615,  1399470388,  -745620659,  -258181479),
+      UINT16_C(0x4242),
+      simde_mm512_set_epi32( -687161748, -2040592882, -1110162330, -2132131122,
+                            -1494257797,  -608231026,   -72036202,   217931390,
+                             -229701835,  1297135674,  1119728413,  1645149922,
+                             1561750630,  1635106429,  -649930580, -1675434260),
+      simde_mm512_set_epi32(  692156251, -1251163138,  -794760780,   290814750,
+                            -1847043452,  2141907897,   396893967, -1183779298,
+                             2071458740,  -280437239, -1592785154,  -531934363,
+                            -2040592882,   -72036202,  1297135674,  -649930580) },
+    { simde_mm512_set_epi32(  838332124,  1661178745,   768484189, -1703559765,
+                            -1236468233,  1040205976, -1607813346,  1673171249,
+                            -1545894799, -1262455021, -1749620765,   791425716,
+                              269671901,  1957968125,  -889212892, -1536936433),
+      UINT16_C(0x3576),
+      simde_mm512_set_epi32( 1535276339,  -601838349, -1633144051,  1240946121,
+                            -1873615483,   343291272, -1879757549, -1874689230,
+                             1230575021,  2013709726,  1642807701, -2130011262,
+                              579790769,   466050901,   -34974859,   839154619),
+      simde_mm512_set_epi32(  838332124,  1661178745,   768484189, -1703559765,
+                            -1236468233,  1040205976, -1607813346, -1633144051,
+                             1240946121,   343291272, -1874689230,  2013709726,
+                             1642807701, -2130011262,   466050901,   -34974859) },
+    { simde_mm512_set_epi32(-1035863430,   587913967,  -949374168,  1738831511,
+                              -27595825,  -773019134, -1452599211,  -680456008,
+                             -432703292,   570529393,  1720179563,   577201983,
+                             1508416343,  1192470968, -1658253539,  -928387603),
+      UINT16_C(0x9ebc),
+      simde_mm512_set_epi32( 1675182569,  -359569463,  -135665601,  -458048814,
+                             1483213179,   326413788,  1502527466,  -204850270,
+                             -311768414,  -962167552, -1232936501,  1360737168,
+                             -559621757,   830509493, -1703134874,  1849590724),
+      simde_mm512_set_epi32(-1035863430,   587913967,  -949374168,  1738831511,
+                              -27595825,  -773019134,  1675182569,  -458048814,
+                             1483213179,   326413788,  1502527466,  -311768414,
+                            -1232936501,  1360737168,  -559621757,   830509493) },
+    { simde_mm512_set_epi32(  334610609,  2016253600,   193638493, -1932836054,
+                              490336860,   529322910,  1183693655,  1498354285,
+                             1558118810,  2037115285,  -379373658,  1323630404,
+                            -1001160009,  1486017577,  -935930079,  1282578332),
+      UINT16_C(0x55a9),
+      simde_mm512_set_epi32(-1543435953,   702060283, -1644796775,   -72481548,
+                            -1431302686,  1782132537, -1567017534,  1079776012,
+                             2097365993,  1980423479,  1342712331,   935235000,
+                             1127711169, -1151131533,  1970317028,   301341712),
+      simde_mm512_set_epi32(  334610609,  2016253600,   193638493, -1932836054,
+                              490336860,   529322910,  1183693655,  1498354285,
+                              702060283,   -72481548,  1782132537,  1079776012,
+                             2097365993,  1342712331,  1127711169,   301341712) },
+    { simde_mm512_set_epi32( -752678050, -1922269908, -1504659592,  1011656497,
+                             -539122106,   300391966,  1718179688,   637019836,
+                             2004918004,  -955685215,   245674448, -1407415557,
+                             1429965134,  -198864503,  1982592299,   869396941),
+      UINT16_C(0x0979),
+      simde_mm512_set_epi32(-1011629139,  1758141637,   -71612868,  1391789743,
+                             -692126085,  1735226247,  -781654037, -1290940329,
+                              690987080,  -188858355,  -974217727,  1297946125,
+                             1114164940,  -902557803,  -862266657,  1311758542),
+      simde_mm512_set_epi32( -752678050, -1922269908, -1504659592,  1011656497,
+                             -539122106,   300391966,  1718179688,   637019836,
+                             2004918004,  -692126085, -1290940329,  -188858355,
+                             -974217727,  1297946125,  1114164940,  1311758542) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_compress_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_compress_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 4722054792953783817), INT64_C( 1478040827992175563),
+                            INT64_C( -350533070329064026), INT64_C(-1016027368036795581),
+                            INT64_C(-1604903128540285912), INT64_C( 3847459113931478300),
+                            INT64_C(-8315267173793245391), INT64_C( -952536119823843956)),
+      UINT8_C(0x4a),
+      simde_mm512_set_epi64(INT64_C( 5254779351438723586), INT64_C(-6863763543633930047),
+                            INT64_C(-8542017213972850781), INT64_C(-3940144522914637512),
+                            INT64_C( 2042905169693738330), INT64_C( 3443222188164308692),
+                            INT64_C( 6602378062368085417), INT64_C(-7324032006471022851)),
+      simde_mm512_set_epi64(INT64_C( 4722054792953783817), INT64_C( 1478040827992175563),
+                            INT64_C( -350533070329064026), INT64_C(-1016027368036795581),
+                            INT64_C(-1604903128540285912), INT64_C(-6863763543633930047),
+                            INT64_C( 2042905169693738330), INT64_C( 6602378062368085417)) },
+    { simde_mm512_set_epi64(INT64_C(-7507243271011239813), INT64_C(-5415268525927430335),
+                            INT64_C(-1963608959800736466), INT64_C(-1248231404684066448),
+                            INT64_C(-2752168545771205792), INT64_C( 1303566319118034655),
+                            INT64_C(-3628683167345781146), INT64_C(-5873597354850266266)),
+      UINT8_C(0x1c),
+      simde_mm512_set_epi64(INT64_C( 3008372831099595240), INT64_C( 4919295370115955884),
+                            INT64_C(-7645062242588432072), INT64_C(-1511066675959637443),
+                            INT64_C( 8072096240345288351), INT64_C(-6383004826114286807),
+                            INT64_C( 8197968516026043974), INT64_C(-2128507634706940214)),
+      simde_mm512_set_epi64(INT64_C(-7507243271011239813), INT64_C(-5415268525927430335),
+                            INT64_C(-1963608959800736466), INT64_C(-1248231404684066448),
+                            INT64_C(-2752168545771205792), INT64_C(-1511066675959637443),
+                            INT64_C( 8072096240345288351), INT64_C(-6383004826114286807)) },
+    { simde_mm512_set_epi64(INT64_C(-1679420471777018087), INT64_C(-4153441017122035973),
+                            INT64_C( 2570127391568644821), INT64_C(-4151403742310096711),
+                            INT64_C(-9015122079932102673), INT64_C(  943562857002024170),
+                            INT64_C(  846383742438384462), INT64_C( 4730307450125931438)),
+      UINT8_C(0xb5),
+      simde_mm512_set_epi64(INT64_C(-4835772501581349285), INT64_C(-3410639499255960292),
+                            INT64_C(-4326369014879823061), INT64_C(-5986589938309154331),
+                            INT64_C( 9099478870839321090), INT64_C( 7637455860788501554),
+                            INT64_C(-6798903731585057967), INT64_C( 3144378034621746751)),
+      simde_mm512_set_epi64(INT64_C(-1679420471777018087), INT64_C(-4153441017122035973),
+                            INT64_C( 2570127391568644821), INT64_C(-4835772501581349285),
+                            INT64_C(-4326369014879823061), INT64_C(-5986589938309154331),
+                            INT64_C( 7637455860788501554), INT64_C( 3144378034621746751)) },
+    { simde_mm512_set_epi64(INT64_C(-1543492945093392711), INT64_C(  427969154880563860),
+                            INT64_C(-1336200259187305778), INT64_C(-4589431901515326115),
+                            INT64_C(-8861378778311306102), INT64_C( 4730651575025769350),
+                            INT64_C(-4064863758586491816), INT64_C(-7393888535873788012)),
+      UINT8_C(0xf1),
+      simde_mm512_set_epi64(INT64_C(-5550768692168687377), INT64_C( 3289114351621842666),
+                            INT64_C(-7825128615995544981), INT64_C( 8641219967888687818),
+                            INT64_C( 6343487600614355935), INT64_C( 7301993918141226682),
+                            INT64_C(-4324054682846020078), INT64_C( 1959168705092200236)),
+      simde_mm512_set_epi64(INT64_C(-1543492945093392711), INT64_C(  427969154880563860),
+                            INT64_C(-1336200259187305778), INT64_C(-5550768692168687377),
+                            INT64_C( 3289114351621842666), INT64_C(-7825128615995544981),
+                            INT64_C( 8641219967888687818), INT64_C( 1959168705092200236)) },
+    { simde_mm512_set_epi64(INT64_C( 7883653349208593471), INT64_C(  173733141732998502),
+                            INT64_C( 6773851724759244245), INT64_C(-8071798653838296656),
+                            INT64_C( 5840571136169575395), INT64_C( 2849421435803212483),
+                            INT64_C(-3714853596149093673), INT64_C(-2926458525289486001)),
+      UINT8_C(0xaa),
+      simde_mm512_set_epi64(INT64_C(-6768316184637104074), INT64_C(-9057961456667662988),
+                            INT64_C( 2933136766163053468), INT64_C(-1183269009361300870),
+                            INT64_C(-7548269329544795945), INT64_C( -228814685434534765),
+                            INT64_C( 4401011937213143262), INT64_C(-2249953521070630300)),
+      simde_mm512_set_epi64(INT64_C( 7883653349208593471), INT64_C(  173733141732998502),
+                            INT64_C( 6773851724759244245), INT64_C(-8071798653838296656),
+                            INT64_C(-6768316184637104074), INT64_C( 2933136766163053468),
+                            INT64_C(-7548269329544795945), INT64_C( 4401011937213143262)) },
+    { simde_mm512_set_epi64(INT64_C( 5281855266237426723), INT64_C(-7826386620408462254),
+                            INT64_C(-6614366745868560410), INT64_C(-6335651689706126878),
+                            INT64_C(-7756834139022173180), INT64_C(-6236868977029492213),
+                            INT64_C( 4110198655624058416), INT64_C( 4811618543582342535)),
+      UINT8_C(0x7b),
+      simde_mm512_set_epi64(INT64_C(-2460366989263770876), INT64_C(  976409016987621940),
+                            INT64_C(-1608976342982647253), INT64_C(-8945994586450466830),
+                            INT64_C(-4155148057246122191), INT64_C(-3727205624303338020),
+                            INT64_C( 2379522037090494342), INT64_C(-7078701226578111971)),
+      simde_mm512_set_epi64(INT64_C( 5281855266237426723), INT64_C(-7826386620408462254),
+                            INT64_C(  976409016987621940), INT64_C(-1608976342982647253),
+                            INT64_C(-8945994586450466830), INT64_C(-4155148057246122191),
+                            INT64_C( 2379522037090494342), INT64_C(-7078701226578111971)) },
+    { simde_mm512_set_epi64(INT64_C(-8518968500490120310), INT64_C(-8272360849562341367),
+                            INT64_C(  638686709535588160), INT64_C(-1887033900567142458),
+                            INT64_C( 1560682217638248567), INT64_C( 3184962625349736447),
+                            INT64_C( 8329717866650173064), INT64_C( 6213007134150564301)),
+      UINT8_C(0x92),
+      simde_mm512_set_epi64(INT64_C(  935721179853451988), INT64_C(-8531991105676193851),
+                            INT64_C( -445687275789611093), INT64_C(-3163593724233119014),
+                            INT64_C( 4821660663260274007), INT64_C(  610351523829262270),
+                            INT64_C(-8361260730189291628), INT64_C( 5717577281298696650)),
+      simde_mm512_set_epi64(INT64_C(-8518968500490120310), INT64_C(-8272360849562341367),
+                            INT64_C(  638686709535588160), INT64_C(-1887033900567142458),
+                            INT64_C( 1560682217638248567), INT64_C(  935721179853451988),
+                            INT64_C(-3163593724233119014), INT64_C(-8361260730189291628)) },
+    { simde_mm512_set_epi64(INT64_C(-2501208097065150275), INT64_C(-7088885218022889245),
+                            INT64_C(-5992502540547802207), INT64_C( 8586658273620062921),
+                            INT64_C(-7835829226145880258), INT64_C( 1041207371560697901),
+                            INT64_C( 3100444628672608884), INT64_C( 4975452937687519695)),
+      UINT8_C(0xd4),
+      simde_mm512_set_epi64(INT64_C(-3873129750895711943), INT64_C( 6653880115981098363),
+                            INT64_C( 4752090006424226200), INT64_C( 7377867039451244348),
+                            INT64_C(-2567517462485566904), INT64_C(-7185049768797252997),
+                            INT64_C(-5401074111490209517), INT64_C(-9177761264387800505)),
+      simde_mm512_set_epi64(INT64_C(-2501208097065150275), INT64_C(-7088885218022889245),
+                            INT64_C(-5992502540547802207), INT64_C( 8586658273620062921),
+                            INT64_C(-3873129750895711943), INT64_C( 6653880115981098363),
+                            INT64_C( 7377867039451244348), INT64_C(-7185049768797252997)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_compress_epi64(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_compress_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 src;
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(  -758.11f,    540.55f,    156.30f,   -965.54f,
+                            467.50f,   -483.48f,    146.75f,    176.26f,
+                            411.01f,   -298.41f,    432.65f,     10.24f,
+                            456.79f,   -961.58f,   -949.15f,    226.52f),
+      UINT16_C(0x266c),
+      simde_mm512_set_ps(   792.82f,   -425.23f,    872.32f,   -175.25f,
+                             22.80f,    308.90f,   -883.04f,   -179.71f,
+                            876.62f,     24.97f,    522.88f,     -7.73f,
+                           -592.25f,    217.58f,    396.40f,    718.85f),
+      simde_mm512_set_ps(  -758.11f,    540.55f,    156.30f,   -965.54f,
+                            467.50f,   -483.48f,    146.75f,    176.26f,
+                            411.01f,    872.32f,    308.90f,   -883.04f,
+                             24.97f,    522.88f,   -592.25f,    217.58f) },
+    { simde_mm512_set_ps(  -810.29f,    -16.68f,    -49.42f,   -419.70f,
+                            210.51f,   -628.00f,    138.50f,    531.66f,
+                           -849.94f,    264.44f,    687.79f,    985.15f,
+                            114.07f,    326.12f,    325.07f,   -369.84f),
+      UINT16_C(0xfd7f),
+      simde_mm512_set_ps(   913.26f,    660.10f,    816.77f,   -957.60f,
+                           -553.53f,    -25.96f,     -1.40f,   -618.55f,
+                           -680.44f,    869.21f,   -487.23f,   -595.50f,
+                           -676.79f,    612.31f,    296.66f,    718.28f),
+      simde_mm512_set_ps(  -810.29f,    -16.68f,    913.26f,    660.10f,
+                            816.77f,   -957.60f,   -553.53f,    -25.96f,
+                           -618.55f,    869.21f,   -487.23f,   -595.50f,
+                           -676.79f,    612.31f,    296.66f,    718.28f) },
+    { simde_mm512_set_ps(  -870.05f,   -914.33f,    811.95f,    103.93f,
+                           -391.06f,    408.41f,   -654.34f,    725.15f,
+                           -167.35f,    213.45f,   -905.10f,   -765.86f,
+                            607.30f,    460.12f,    393.18f,   -868.88f),
+      UINT16_C(0x60fe),
+      simde_mm512_set_ps(   412.28f,    744.39f,   -211.91f,   -536.64f,
+                            445.36f,   -798.63f,   -449.81f,    506.41f,
+                            658.37f,    749.59f,   -272.38f,   -669.70f,
+                            292.10f,   -683.94f,    468.12f,   -729.36f),
+      simde_mm512_set_ps(  -870.05f,   -914.33f,    811.95f,    103.93f,
+                           -391.06f,    408.41f,   -654.34f,    744.39f,
+                           -211.91f,    658.37f,    749.59f,   -272.38f,
+                           -669.70f,    292.10f,   -683.94f,    468.12f) },
+    { simde_mm512_set_ps(   628.91f,    481.08f,    -19.20f,    925.05f,
+                             54.06f,    653.13f,    675.26f,   -671.25f,
+                             38.64f,   -964.56f,   -683.95f,    938.40f,
+                           -242.11f,    860.87f,   -892.07f,    797.77f),
+      UINT16_C(0x82bb),
+      simde_mm512_set_ps(  -828.38f,    337.85f,      9.78f,   -520.82f,
+                             30.21f,    734.13f,   -943.42f,    563.11f,
+                           -886.93f,   -633.35f,     38.19f,     72.96f,
+                            920.27f,    459.86f,   -983.44f,    188.47f),
+      simde_mm512_set_ps(   628.91f,    481.08f,    -19.20f,    925.05f,
+                             54.06f,    653.13f,    675.26f,   -671.25f,
+                           -828.38f,   -943.42f,   -886.93f,     38.19f,
+                             72.96f,    920.27f,   -983.44f,    188.47f) },
+    { simde_mm512_set_ps(   304.83f,     47.83f,    648.02f,    -66.61f,
+                           -807.57f,   -712.81f,   -695.74f,    823.73f,
+                            509.84f,    389.78f,   -178.77f,    -68.49f,
+                            650.14f,    188.60f,   -244.25f,   -724.99f),
+      UINT16_C(0x5bc4),
+      simde_mm512_set_ps(   828.31f,   -223.63f,   -367.62f,     75.06f,
+                           -444.51f,   -421.80f,   -787.18f,    291.04f,
+                            136.66f,    967.79f,    176.04f,   -211.21f,
+                           -665.78f,    675.86f,   -307.53f,    489.70f),
+      simde_mm512_set_ps(   304.83f,     47.83f,    648.02f,    -66.61f,
+                           -807.57f,   -712.81f,   -695.74f,    823.73f,
+                           -223.63f,     75.06f,   -444.51f,   -787.18f,
+                            291.04f,    136.66f,    967.79f,    675.86f) },
+    { simde_mm512_set_ps(  -562.14f,    575.40f,   -913.52f,   -191.33f,
+                           -747.17f,    310.12f,   -205.36f,    679.12f,
+                            573.43f,    382.15f,   -383.51f,    827.10f,
+                           -887.28f,    106.35f,   -985.39f,    265.13f),
+      UINT16_C(0x0c57),
+      simde_mm512_set_ps(  -821.66f,   -985.04f,    198.93f,    918.15f,
+                           -816.43f,   -270.81f,   -979.27f,    -38.13f,
+                           -371.51f,    925.77f,    942.52f,   -505.51f,
+                           -954.31f,    846.67f,   -499.09f,   -904.59f),
+      simde_mm512_set_ps(  -562.14f,    575.40f,   -913.52f,   -191.33f,
+                           -747.17f,    310.12f,   -205.36f,    679.12f,
+                            573.43f,   -816.43f,   -270.81f,    925.77f,
+                           -505.51f,    846.67f,   -499.09f,   -904.59f) },
+    { simde_mm512_set_ps(   -36.14f,   -525.00f,    237.77f,    471.44f,
+                           -711.33f,   -790.12f,   -501.36f,     48.51f,
+                           -226.19f,    -35.61f,    944.15f,   -350.90f,
+                            960.25f,    714.62f,   -682.28f,   -860.63f),
+      UINT16_C(0x1ccd),
+      simde_mm512_set_ps(   649.95f,     73.95f,   -442.41f,   -700.24f,
+                            761.43f,   -763.39f,   -404.63f,    184.24f,
+                           -233.74f,   -220.30f,    561.92f,    989.63f,
+                            710.56f,    463.17f,   -416.83f,   -464.24f),
+      simde_mm512_set_ps(   -36.14f,   -525.00f,    237.77f,    471.44f,
+                           -711.33f,   -790.12f,   -501.36f,     48.51f,
+                           -700.24f,    761.43f,   -763.39f,   -233.74f,
+                           -220.30f,    710.56f,    463.17f,   -464.24f) },
+    { simde_mm512_set_ps(  -804.90f,   -831.06f,    365.89f,    556.85f,
+                            463.74f,    -53.73f,    914.51f,   -540.52f,
+                            506.40f,   -151.69f,   -992.06f,    819.43f,
+                            857.02f,   -203.02f,   -691.51f,   -793.87f),
+      UINT16_C(0x9f6e),
+      simde_mm512_set_ps(  -973.64f,   -734.82f,   -113.70f,   -809.59f,
+                            942.66f,   -785.16f,    628.18f,    605.33f,
+                           -609.86f,     53.87f,    200.63f,   -231.63f,
+                            229.22f,   -674.84f,   -352.09f,    -75.75f),
+      simde_mm512_set_ps(  -804.90f,   -831.06f,    365.89f,    556.85f,
+                            463.74f,   -973.64f,   -809.59f,    942.66f,
+                           -785.16f,    628.18f,    605.33f,     53.87f,
+                            200.63f,    229.22f,   -674.84f,   -352.09f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_mask_compress_ps(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_compressstoreu_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(  215094961,  1218205922,  -455669834, -1117662342,
+                             -590165152, -1321901784,  1978479432, -1204616090,
+                            -1517349489, -1910898353,   179528990,   758321487,
+                             -813050630,   909025737,  -767098594,   282616300),
+      UINT16_C(0x92d0),
+      simde_mm512_set_epi32( 1508870198,   108451697, -1888578660,   212081709,
+                             -958409457,  2070965471, -1709047306,  -219727477,
+                            -2127122310, -2058083627,  2037449533,  1363800104,
+                            -1594834941,   345433995, -2122422097,   246739191),
+      simde_mm512_set_epi32(  215094961,  1218205922,  -455669834, -1117662342,
+                             -590165152, -1321901784,  1978479432, -1204616090,
+                            -1517349489, -1910898353,  1508870198,   212081709,
+                            -1709047306, -2127122310, -2058083627,  1363800104) },
+    { simde_mm512_set_epi32( 2050533704,    77671525,  1220714650,  1934256381,
+                             -761947132, -1694651633, -1855472919, -2070105175,
+                             1410081041,  1156895839,  1887639720,   873160593,
+                            -1793116488,  1463859863,  -924842015,  1438799671),
+      UINT16_C(0xf7c1),
+      simde_mm512_set_epi32(  646855609,  1302982837, -1446118849,   268712433,
+                             1658182029,  -853835868,  2079360125,  1197369235,
+                              -38877417, -1238119772, -1157302279,  -152242266,
+                              -39322271,  1136910646,  -493278298,   608993017),
+      simde_mm512_set_epi32( 2050533704,    77671525,  1220714650,  1934256381,
+                             -761947132, -1694651633,   646855609,  1302982837,
+                            -1446118849,   268712433,  -853835868,  2079360125,
+                             1197369235,   -38877417, -1238119772,   608993017) },
+    { simde_mm512_set_epi32( -996876926,  1510389436,   891091226,  -566941345,
+                            -1373700898,   385746802, -1850206814,    70601581,
+                              736030919,    48876454,  1212626024,   856814069,
+                            -1355051656,  1585387837,  1719426792,   593768869),
+      UINT16_C(0xd3e7),
+      simde_mm512_set_epi32(-2104451489,  2147297876, -1883894952,   328798540,
+                             -871339678,  -549316962,   864179296,  1885305415,
+                            -1605939750, -1240241586,  -130708861,   222230720,
+                             1115153798,  -279086305,   663538619,   509693453),
+      simde_mm512_set_epi32( -996876926,  1510389436,   891091226,  -566941345,
+                            -1373700898, -2104451489,  2147297876,   328798540,
+                              864179296,  1885305415, -1605939750, -1240241586,
+                             -130708861,  -279086305,   663538619,   509693453) },
+    { simde_mm512_set_epi32(   68834151, -1996217447,  1810005740, -1404539393,
+                             1033126007,   164941898, -1328447987,  1878737630,
+                            -1137240835,  -119766560,  -941126046,  -376129895,
+                              948540664,  1867556647,  1537469047,   140839026),
+      UINT16_C(0x4556),
+      simde_mm512_set_epi32(   74390779,  1115660802, -1079949429, -1305674373,
+                             1462773907,  1375237485,   488526041,  -162309698,
+                             -240178520,  2018448624, -1786243038,  1850413967,
+                             -277206479, -1731144244,   -99452594,  1720547020),
+      simde_mm512_set_epi32(   68834151, -1996217447,  1810005740, -1404539393,
+                             1033126007,   164941898, -1328447987,  1878737630,
+                            -1137240835,  1115660802,  1375237485,  -162309698,
+                             2018448624,  1850413967, -1731144244,   -99452594) },
+    { simde_mm512_set_epi32( -977040768,  -950629272,   576471079,   612779233,
+                             2079348917,  -205651108,   461305672,   -79929486,
+                              866292169, -1125363246,  1288910735, -1638792002,
+                             2058664848,  1318247749,  1033857906,   590640338),
+      UINT16_C(0x19d2),
+      simde_mm512_set_epi32( 2139819519, -2123345486,  -331980615,   675719597,
+                            -2142404156, -2037223549,   271557110,   394355890,
+                             1975948855,   671367875, -1862241373,   991880782,
+                             -815442298,  -993414315,  1610989584, -1362786653),
+      simde_mm512_set_epi32( -977040768,  -950629272,   576471079,   612779233,
+                             2079348917,  -205651108,   461305672,   -79929486,
+                              866292169,   675719597, -2142404156,   394355890,
+                             1975948855,   671367875,   991880782,  1610989584) },
+    { simde_mm512_set_epi32(  611196818, -1765330884, -1106783416,  1145965040,
+                             2024005968, -1516453176,  1495215997,   572381010,
+                             1198818883,  1788411621,  -494650442,  1179880441,
+                              831737913, -1615488145,  1400979862,  2094751203),
+      UINT16_C(0x970d),
+      simde_mm512_set_epi32(  720915340,  1895813412, -1476105093, -2136788335,
+                            -1623141122,  -345074957,  -208430990, -1253834829,
+                             -171945551,  1278729031, -1745120659, -1734199671,
+                              345583875,   633199534,  1223952679, -1505637689),
+      simde_mm512_set_epi32(  611196818, -1765330884, -1106783416,  1145965040,
+                             2024005968, -1516453176,  1495215997,   572381010,
+                              720915340, -2136788335,  -345074957,  -208430990,
+                            -1253834829,   345583875,   633199534, -1505637689) },
+    { simde_mm512_set_epi32( 1048815017, -1623556434,  1032941108,   479082424,
+                            -1454680361,   -59570512,   685482355, -2036292600,
+                             2056545814,   139935924, -1624923852,  2004328801,
+                             -162973167,  -386921804,  -991930345, -1230560563),
+      UINT16_C(0x3940),
+      simde_mm512_set_epi32( -337297327,  1575751664,   841360600,  1211301439,
+                             -880474701, -1999448155,  1786055300,  -838248677,
+                             1776194398,   445598146,  -327585249,  1262253419,
+                            -2016161237, -1287335264,   420062775,  1584300309),
+      simde_mm512_set_epi32( 1048815017, -1623556434,  1032941108,   479082424,
+                            -1454680361,   -59570512,   685482355, -2036292600,
+                             2056545814,   139935924, -1624923852,   841360600,
+                             1211301439,  -880474701,  -838248677,   445598146) },
+    { simde_mm512_set_epi32( -896924638,  -198370303, -1000748398,   920555283,
+                             1493643758,  1736803774,   392855592,  1044627657,
+                            -1415380629,  -988864211,   281540544, -1793044721,
+                            -1049119814,  -345357452,  -835625445,   422439632),
+      UINT16_C(0x04c4),
+      simde_mm512_set_epi32( 2026969947, -1728939299,  1681845172,   818696309,
+                                4181941,  -418281495,  1624310372,  1224690541,
+                             -414461352,  1462997378,   382209957, -1887388419,
+                             2125098210,  -673899044,   586027824, -1628531059),
+      simde_mm512_set_epi32( -896924638,  -198370303, -1000748398,   920555283,
+                             1493643758,  1736803774,   392855592,  1044627657,
+                            -1415380629,  -988864211,   281540544, -1793044721,
+                             -418281495,  -414461352,  1462997378,  -673899044) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = test_vec[i].src;
+    simde_mm512_mask_compressstoreu_epi32((int32_t*) &r, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_compressstoreu_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d src;
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(   287.37,    368.37,    708.36,   -922.76,
+                           -385.26,    461.94,    155.84,   -719.44),
+      UINT8_C(0x00),
+      simde_mm512_set_pd(  -412.24,   -824.29,    -89.68,   -930.36,
+                           -621.31,   -405.72,   -814.69,   -828.06),
+      simde_mm512_set_pd(   287.37,    368.37,    708.36,   -922.76,
+                           -385.26,    461.94,    155.84,   -719.44) },
+    { simde_mm512_set_pd(   267.49,   -293.56,   -999.19,   -785.28,
+                            278.72,    945.60,   -288.98,    803.27),
+      UINT8_C(0xa3),
+      simde_mm512_set_pd(   888.28,    572.10,   -577.44,   -508.43,
+                           -406.78,    769.91,   -651.09,    -35.00),
+      simde_mm512_set_pd(   267.49,   -293.56,   -999.19,   -785.28,
+                            888.28,   -577.44,   -651.09,    -35.00) },
+    { simde_mm512_set_pd(  -298.91,   -174.23,    796.36,   -614.94,
+                           -635.41,   -261.01,   -697.09,    158.94),
+      UINT8_C(0x04),
+      simde_mm512_set_pd(   827.50,    852.17,    360.02,    180.14,
+                            330.48,    -34.26,   -701.66,    336.36),
+      simde_mm512_set_pd(  -298.91,   -174.23,    796.36,   -614.94,
+                           -635.41,   -261.01,   -697.09,    -34.26) },
+    { simde_mm512_set_pd(   136.15,    874.11,    638.40,   -686.07,
+                            -49.43,   -596.38,    341.18,    -43.86),
+      UINT8_C(0xe8),
+      simde_mm512_set_pd(  -879.87,    686.08,    -32.18,   -985.10,
+                           -514.03,   -260.59,    810.36,    344.78),
+      simde_mm512_set_pd(   136.15,    874.11,    638.40,   -686.07,
+                           -879.87,    686.08,    -32.18,   -514.03) },
+    { simde_mm512_set_pd(  -242.31,   -768.37,    496.73,   -782.13,
+                            984.84,   -871.56,   -218.35,    -65.51),
+      UINT8_C(0x81),
+      simde_mm512_set_pd(   538.03,   -266.15,    489.35,    971.26,
+                            676.00,    390.40,    330.36,   -810.99),
+      simde_mm512_set_pd(  -242.31,   -768.37,    496.73,   -782.13,
+                            984.84,   -871.56,    538.03,   -810.99) },
+    { simde_mm512_set_pd(  -128.34,    767.68,     17.63,   -979.38,
+                           -821.33,    476.58,   -563.75,    533.20),
+      UINT8_C(0x50),
+      simde_mm512_set_pd(   609.12,     15.82,    116.89,   -379.93,
+                           -137.07,    226.25,    147.45,   -130.77),
+      simde_mm512_set_pd(  -128.34,    767.68,     17.63,   -979.38,
+                           -821.33,    476.58,     15.82,   -379.93) },
+    { simde_mm512_set_pd(  -122.15,    278.73,   -700.04,   -532.56,
+                            913.99,    755.91,   -517.61,   -489.79),
+      UINT8_C(0xf5),
+      simde_mm512_set_pd(  -881.03,     31.46,     17.23,   -376.14,
+                            765.69,    -65.39,    234.80,    169.67),
+      simde_mm512_set_pd(  -122.15,    278.73,   -881.03,     31.46,
+                             17.23,   -376.14,    -65.39,    169.67) },
+    { simde_mm512_set_pd(  -175.49,   -714.69,    858.66,   -646.14,
+                           -738.43,    441.34,   -531.15,    253.40),
+      UINT8_C(0x9c),
+      simde_mm512_set_pd(   970.29,   -339.17,   -822.68,   -472.80,
+                            643.48,    493.27,    240.55,   -195.70),
+      simde_mm512_set_pd(  -175.49,   -714.69,    858.66,   -646.14,
+                            970.29,   -472.80,    643.48,    493.27) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = test_vec[i].src;
+    simde_mm512_mask_compressstoreu_pd((simde_float64*) &r, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_expand_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( 2045220798, -2003548347,  -799965278,   181374776,
+                             -346924696,   182415952,   612360488,   816702903,
+                              788739145,   961454223,   428705491,  -758143919,
+                             1422627332, -1048779127,  2042883737, -1138412484),
+      UINT16_C(0xa6d7),
+      simde_mm512_set_epi32( -334349946, -1007903276,  1701239315, -1447378287,
+                            -1407735716,   262550916,   478417378,  -171542359,
+                              462077748,   492520335,  -508311854,   387540673,
+                             -262671198,  -645204426,  1493603714,  1242893294),
+      simde_mm512_set_epi32(  478417378, -2003548347,  -171542359,   181374776,
+                             -346924696,   462077748,   492520335,   816702903,
+                             -508311854,   387540673,   428705491,  -262671198,
+                             1422627332,  -645204426,  1493603714,  1242893294) },
+    { simde_mm512_set_epi32(-1713402028,  -265097989,  1698983671, -1502450696,
+                            -1582797260, -1417906061,   382796792, -1962284595,
+                            -1544786872,   527194758,  -719070117,   933486765,
+                            -1342802476,  1656491379,  1403077429,   992462861),
+      UINT16_C(0xca1e),
+      simde_mm512_set_epi32( 1102388549,   -33730106,  -179470475,   938285713,
+                             -278113787,  1866694112, -2029222416,  2137776247,
+                            -1289249822,   395397029, -1187495311, -1392955956,
+                             -628948153, -1742208903,  1089190290, -1762385875),
+      simde_mm512_set_epi32(-1289249822,   395397029,  1698983671, -1502450696,
+                            -1187495311, -1417906061, -1392955956, -1962284595,
+                            -1544786872,   527194758,  -719070117,  -628948153,
+                            -1742208903,  1089190290, -1762385875,   992462861) },
+    { simde_mm512_set_epi32(-1063192295,  -176233713,  2109513146,   -58333139,
+                             1052426042, -1714805566,   148684904, -1631299910,
+                              697460468,  -771315372, -1236690421,   751889025,
+                             -367929469,   229211260,    58936837,  1695880129),
+      UINT16_C(0xa64f),
+      simde_mm512_set_epi32( 1524330632,  -213751574, -1327434470,  1206633556,
+                              864417315,  1857460838,   -24230438,    83214122,
+                            -1744320726,  -372636686,  1151506862,   398163277,
+                            -1543980021,  -679872960, -1302978522, -1060418054),
+      simde_mm512_set_epi32(   83214122,  -176233713, -1744320726,   -58333139,
+                             1052426042,  -372636686,  1151506862, -1631299910,
+                              697460468,   398163277, -1236690421,   751889025,
+                            -1543980021,  -679872960, -1302978522, -1060418054) },
+    { simde_mm512_set_epi32( -285444965,  1895651861,   958327471, -1510059022,
+                             -163110102,   131728710,    16777794, -1022416280,
+                            -1942869880,   175006351,   357182026,  -464520204,
+                              262196328, -1994311024,  -418639696, -1686929959),
+      UINT16_C(0x9b1f),
+      simde_mm512_set_epi32(-1745095067, -1935037986,   -54968597,  -542638862,
+                             -699219150, -1052049937,  -618842743, -1826747448,
+                              874609865,  1549789800,  -753718441,  1910587972,
+                              -94669091,  2063009623,  1755402494, -1659176986),
+      simde_mm512_set_epi32( -618842743,  1895651861,   958327471, -1826747448,
+                              874609865,   131728710,  1549789800,  -753718441,
+                            -1942869880,   175006351,   357182026,  1910587972,
+                              -94669091,  2063009623,  1755402494, -1659176986) },
+    { simde_mm512_set_epi32( 1442491647, -1333952860,  -186644584,  1970121481,
+                            -1657042471,  1682154041,  -824844845, -2046823959,
+                             -113879085,  -587207348,  1784901312,  -504072710,
+                              641901341, -1918281756,   443490978,   425971852),
+      UINT16_C(0x5ea4),
+      simde_mm512_set_epi32(    3554858,  -900633198,  -676064499,  2049605298,
+                            -1171136399,   673503533, -1684926305,   140566621,
+                              287704276,  -596335685,   653613003,   393365833,
+                             1356596059,  -911090379,   378893580,   115549059),
+      simde_mm512_set_epi32( 1442491647,   287704276,  -186644584,  -596335685,
+                              653613003,   393365833,  1356596059, -2046823959,
+                             -911090379,  -587207348,   378893580,  -504072710,
+                              641901341,   115549059,   443490978,   425971852) },
+    { simde_mm512_set_epi32(  745646117,  -570956792,   446965257,  -272396861,
+                             1193012348, -1275648655,  1534678132, -1657751044,
+                              514461309,  -717914343, -1268123554,   541577061,
+                             -792871967,  -307611494,  -719490978,   418094013),
+      UINT16_C(0x4912),
+      simde_mm512_set_epi32(  732220255,  1837438323,  1993711630, -1460567882,
+                              829087067,   327872679,   778458620,  -584311026,
+                             2137417620,  -268057857,  1001549914, -1554879962,
+                              418378204,  -409490483, -1889350713,  1622140484),
+      simde_mm512_set_epi32(  745646117, -1554879962,   446965257,  -272396861,
+                              418378204, -1275648655,  1534678132,  -409490483,
+                              514461309,  -717914343, -1268123554, -1889350713,
+                             -792871967,  -307611494,  1622140484,   418094013) },
+    { simde_mm512_set_epi32( 2087873008,   217381003,  -246941028,  -115116711,
+                              852384007,  -398824077, -1793656067, -1764327341,
+                              158129607,   992756032,   246568145, -1376521033,
+                              690884930,   127070009,  -621003315,  -101449846),
+      UINT16_C(0x1f32),
+      simde_mm512_set_epi32( 1107141008,  -352059356,   505358537,  1570419553,
+                            -1865834964, -1519495116,   -47048564,  1737650136,
+                              647156826, -1629018991,  1191380991,   757697565,
+                             1052526893, -1784284223, -1947972405,   716557736),
+      simde_mm512_set_epi32( 2087873008,   217381003,  -246941028,   647156826,
+                            -1629018991,  1191380991,   757697565,  1052526893,
+                              158129607,   992756032, -1784284223, -1947972405,
+                              690884930,   127070009,   716557736,  -101449846) },
+    { simde_mm512_set_epi32( 1844841995,   689290517,   -42443008,    94530483,
+                              178461265, -1472612921,  1930948545,  1081825894,
+                             1328765738,  -646840439,  1739053635,  1276919233,
+                              849751831, -2070819887,  1530396733,   742493298),
+      UINT16_C(0x8dc7),
+      simde_mm512_set_epi32( 1313458438,   115539542,   892901330, -1279301295,
+                            -1218348177,  -985458469, -1233818702, -1796029425,
+                             1675468507, -2147117015, -1650272845,  1554987952,
+                             1396737144, -1630668950, -1333960343,  1886006307),
+      simde_mm512_set_epi32(-1796029425,   689290517,   -42443008,    94530483,
+                             1675468507, -2147117015,  1930948545, -1650272845,
+                             1554987952,  1396737144,  1739053635,  1276919233,
+                              849751831, -1630668950, -1333960343,  1886006307) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_expand_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_expand_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d src;
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -323.59,    237.24,     78.03,    524.65,
+                           -152.21,    633.82,    854.50,    208.47),
+      UINT8_C(0xfc),
+      simde_mm512_set_pd(   263.36,    -64.39,    884.93,    531.06,
+                            734.78,    -16.45,    -65.17,    791.11),
+      simde_mm512_set_pd(   884.93,    531.06,    734.78,    -16.45,
+                            -65.17,    791.11,    854.50,    208.47) },
+    { simde_mm512_set_pd(  -893.85,      0.48,    386.89,    548.47,
+                            686.26,    735.63,    850.46,    892.18),
+      UINT8_C(0x2d),
+      simde_mm512_set_pd(   742.58,    191.50,     48.31,    803.96,
+                            916.49,    687.84,    333.68,   -243.75),
+      simde_mm512_set_pd(  -893.85,      0.48,    916.49,    548.47,
+                            687.84,    333.68,    850.46,   -243.75) },
+    { simde_mm512_set_pd(  -401.38,    946.10,   -575.14,    477.53,
+                            401.73,   -271.11,    710.27,    755.56),
+      UINT8_C(0x34),
+      simde_mm512_set_pd(  -245.93,    -41.02,   -108.23,   -927.82,
+                            861.61,     20.48,    847.32,   -955.10),
+      simde_mm512_set_pd(  -401.38,    946.10,     20.48,    847.32,
+                            401.73,   -955.10,    710.27,    755.56) },
+    { simde_mm512_set_pd(  -577.28,    488.17,    -37.59,    719.73,
+                           -981.00,   -839.81,    550.93,   -725.38),
+      UINT8_C(0x1b),
+      simde_mm512_set_pd(  -183.90,    991.32,    421.96,   -178.90,
+                           -349.62,   -773.17,   -832.59,     61.18),
+      simde_mm512_set_pd(  -577.28,    488.17,    -37.59,   -349.62,
+                           -773.17,   -839.81,   -832.59,     61.18) },
+    { simde_mm512_set_pd(   479.46,   -628.08,   -198.87,    672.90,
+                            397.61,    423.78,    468.40,    993.00),
+      UINT8_C(0x5d),
+      simde_mm512_set_pd(   957.93,   -424.56,   -806.87,   -534.08,
+                            668.41,   -136.04,   -772.87,   -494.63),
+      simde_mm512_set_pd(   479.46,   -534.08,   -198.87,    668.41,
+                           -136.04,   -772.87,    468.40,   -494.63) },
+    { simde_mm512_set_pd(  -233.75,    126.75,    -71.29,   -180.81,
+                           -989.71,   -832.81,    268.21,   -159.18),
+      UINT8_C(0x1f),
+      simde_mm512_set_pd(  -811.48,   -875.95,     15.65,   -882.92,
+                            746.96,    213.09,   -307.78,    150.81),
+      simde_mm512_set_pd(  -233.75,    126.75,    -71.29,   -882.92,
+                            746.96,    213.09,   -307.78,    150.81) },
+    { simde_mm512_set_pd(   863.54,   -699.63,    970.43,    846.74,
+                            349.58,    639.65,   -658.84,   -299.79),
+      UINT8_C(0x8d),
+      simde_mm512_set_pd(   102.57,    918.82,   -840.58,    842.23,
+                            646.48,   -741.82,    559.23,   -638.75),
+      simde_mm512_set_pd(   646.48,   -699.63,    970.43,    846.74,
+                           -741.82,    559.23,   -658.84,   -638.75) },
+    { simde_mm512_set_pd(   148.85,    977.46,    464.71,    472.53,
+                            910.96,    948.60,   -157.49,   -492.69),
+      UINT8_C(0x8d),
+      simde_mm512_set_pd(  -804.44,      3.77,   -233.47,   -398.80,
+                            932.48,    838.85,   -359.79,    962.68),
+      simde_mm512_set_pd(   932.48,    977.46,    464.71,    472.53,
+                            838.85,   -359.79,   -157.49,    962.68) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_mask_expand_pd(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_expandloadu_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(  529075429, -1614513282,  1455010061, -1335829080,
+                               69530248, -1013352332,  1058824159, -1136672302,
+                              289640578,  1201487856,  1300753348,  2056337483,
+                            -2041777427,    14389287,  1437944291, -2062464198),
+      UINT16_C(0x884a),
+      simde_mm512_set_epi32( 1228463502,  -985601784,  -288709820, -1266694724,
+                            -1994182010,  -250051122,  -294435184,  -455660621,
+                            -1696348258,   299718612,  -683646173, -1308139726,
+                              586559109,   307294994,  -762339971,  -799453249),
+      simde_mm512_set_epi32(-1308139726, -1614513282,  1455010061, -1335829080,
+                              586559109, -1013352332,  1058824159, -1136672302,
+                              289640578,   307294994,  1300753348,  2056337483,
+                             -762339971,    14389287,  -799453249, -2062464198) },
+    { simde_mm512_set_epi32(  901909504, -1122074758, -1947103578, -1867842025,
+                              272212673,  -876558852,  -586302553, -1411083284,
+                              469448266, -1804249128, -1453815558, -2001483430,
+                              538216930,   231243203,  -411604507,  1236745430),
+      UINT16_C(0x99ce),
+      simde_mm512_set_epi32( 1461709764,  1578541700, -1654974055, -1963362954,
+                             -310703271,  2073977861,  2079256978, -1763905435,
+                             1319166410,  1634158305,   239545717, -1341998838,
+                            -1780708668, -1977282292,  1202790645,  -986206569),
+      simde_mm512_set_epi32(-1763905435, -1122074758, -1947103578,  1319166410,
+                             1634158305,  -876558852,  -586302553,   239545717,
+                            -1341998838, -1780708668, -1453815558, -2001483430,
+                            -1977282292,  1202790645,  -986206569,  1236745430) },
+    { simde_mm512_set_epi32(-1633163061, -1724901684,   584456209,   316898888,
+                              -79052919,  1854220818,     8748407,  -414854202,
+                            -1467436912,   -30935046,  1091044294,  -690816384,
+                             -239463426, -2027720872,   916352054, -1996671501),
+      UINT16_C(0x27d0),
+      simde_mm512_set_epi32(-1820775921,   718554108,  1570626044, -1278705773,
+                              506284621,   493961717, -1758967634, -1658404779,
+                            -1386758912,  -554546058,   859403456,  1932535953,
+                              768047576,  1427066545,  -259700397,   521588677),
+      simde_mm512_set_epi32(-1633163061, -1724901684,  -554546058,   316898888,
+                              -79052919,   859403456,  1932535953,   768047576,
+                             1427066545,  -259700397,  1091044294,   521588677,
+                             -239463426, -2027720872,   916352054, -1996671501) },
+    { simde_mm512_set_epi32( 1441775876, -1447767946,  -620429540, -1517136584,
+                             1087332437,   901952903,  1418378167,   315885549,
+                              970965333, -1748466723,   -30611057,  1763843832,
+                             1891679621,  -190882446,  -747879106,  2138129058),
+      UINT16_C(0x380e),
+      simde_mm512_set_epi32(-1683122609, -1660979174,   752849111, -1163645850,
+                              -82956450, -1354453758, -1494242403,  -240920538,
+                            -1040025026,   274505525,  1119811624,   111284485,
+                            -1264853156,  1194109399,  1260690889,   872546625),
+      simde_mm512_set_epi32( 1441775876, -1447767946,  1119811624,   111284485,
+                            -1264853156,   901952903,  1418378167,   315885549,
+                              970965333, -1748466723,   -30611057,  1763843832,
+                             1194109399,  1260690889,   872546625,  2138129058) },
+    { simde_mm512_set_epi32(-1802894206,  -870773579, -1931314034,  1836543023,
+                             2023581368, -1710979177,  -438916138, -1035035827,
+                            -1986169301, -1421440674, -1342831990, -1159979512,
+                             1584034457,   350451681, -1801748013, -2087225469),
+      UINT16_C(0xcd3e),
+      simde_mm512_set_epi32( -211064408,  1085339849, -1904805570, -1605294077,
+                             1873085347,  -253371455, -1203462452,  1302307094,
+                              688106760, -1434713303,  1317351460, -2096790848,
+                            -2015106268,   887900307, -1756708796,  2087355171),
+      simde_mm512_set_epi32(-1203462452,  1302307094, -1931314034,  1836543023,
+                              688106760, -1434713303,  -438916138,  1317351460,
+                            -1986169301, -1421440674, -2096790848, -2015106268,
+                              887900307, -1756708796,  2087355171, -2087225469) },
+    { simde_mm512_set_epi32(  249775899,   558388656,  -833386892, -1646857173,
+                              -62717989, -1813731043, -1981845055,  -566456054,
+                             -258294578, -1639953644,   263276491,  -989368890,
+                             2099379874,   809025820,  -752089254,  1770084154),
+      UINT16_C(0x4f9c),
+      simde_mm512_set_epi32( 1717628764,  1895555413, -1540209124,  1778805603,
+                              282323492, -2056500586,  -645513925,  1831380900,
+                             -872347577,  -560386679,  -507176755,    52833409,
+                            -1960204803,   590512595,  2054296445, -1387998618),
+      simde_mm512_set_epi32(  249775899,  1831380900,  -833386892, -1646857173,
+                             -872347577,  -560386679,  -507176755,    52833409,
+                            -1960204803, -1639953644,   263276491,   590512595,
+                             2054296445, -1387998618,  -752089254,  1770084154) },
+    { simde_mm512_set_epi32( -537087793,  -429012929,  -382226391, -1516368569,
+                            -1776975949, -2054481645, -2123783840, -1578730360,
+                             1710043724,   599897839, -2060134703, -1057861939,
+                             -314924170,   773392483, -1754699058, -1805611260),
+      UINT16_C(0xc454),
+      simde_mm512_set_epi32( 1648576748,  -966148412, -2120506007,   -34736858,
+                              551980129,  -622844704,  -484354787, -1034702903,
+                              810099057,   350772185, -1919800665, -2063249643,
+                              637243234, -2087178257,  2010841624, -1719324351),
+      simde_mm512_set_epi32(-1919800665, -2063249643,  -382226391, -1516368569,
+                            -1776975949,   637243234, -2123783840, -1578730360,
+                             1710043724, -2087178257, -2060134703,  2010841624,
+                             -314924170, -1719324351, -1754699058, -1805611260) },
+    { simde_mm512_set_epi32( 1150898810,   452027213,   209214432,  1313473758,
+                              259689370, -1733895477, -1823438756, -1314709410,
+                              312723785,  1548598450,  1997849248,  -771464753,
+                               67604606,  -215205306,  -426276451,   520031992),
+      UINT16_C(0x3d51),
+      simde_mm512_set_epi32( -390735813,   818940158,  2024776127, -1521637428,
+                              530270672,  2127814153,   451758668, -2053805155,
+                             -336074994,   601168402,   906673493, -1106766693,
+                             -938592978,  -667710162,  1149692465,  -209351329),
+      simde_mm512_set_epi32( 1150898810,   452027213,  -336074994,   601168402,
+                              906673493, -1106766693, -1823438756,  -938592978,
+                              312723785,  -667710162,  1997849248,  1149692465,
+                               67604606,  -215205306,  -426276451,  -209351329) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_expandloadu_epi32(test_vec[i].src, test_vec[i].k, (int32_t const*) &(test_vec[i].a));
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_loadu_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( -805974429,   844145432,  1177966395, -1758866140,
+                             1734154635,  -629340914, -1687487475,  1727679570,
+                             -283076244,  -311813411, -1844444151, -2121422396,
+                            -1539472310,  -238210556, -2039463661,   401278304),
+      UINT16_C(0xbd84),
+      simde_mm512_set_epi32(-1017892600, -2100350150,  1065006686,  2023903170,
+                            -2131409159,  1875320954,  1992986603,  -475548711,
+                            -1732659802,   988367694,  2091973502, -1421529272,
+                             -573336333,  -116758674,  1207258152,   115888898),
+      simde_mm512_set_epi32(-1017892600,   844145432,  1065006686,  2023903170,
+                            -2131409159,  1875320954, -1687487475,  -475548711,
+                            -1732659802,  -311813411, -1844444151, -2121422396,
+                            -1539472310,  -116758674, -2039463661,   401278304) },
+    { simde_mm512_set_epi32(-1588869986,   908596941, -2026165483,  1446738005,
+                            -1196889421,  -539904652, -1372887641, -1363485548,
+                             -626953066,   765475741, -1533245487, -1146601725,
+                              -13230832,  -521404783,   420226668,  -879406269),
+      UINT16_C(0xb558),
+      simde_mm512_set_epi32( -364131671,  1017730950,   766753928,   684340952,
+                              250540007,   441849573,  -136622104,  1780943488,
+                               68815691, -1824722670, -1894601662,  1091185302,
+                             -480011318,    -1149552,   385620240, -1672280755),
+      simde_mm512_set_epi32( -364131671,   908596941,   766753928,   684340952,
+                            -1196889421,   441849573, -1372887641,  1780943488,
+                             -626953066, -1824722670, -1533245487,  1091185302,
+                             -480011318,  -521404783,   420226668,  -879406269) },
+    { simde_mm512_set_epi32( 2063883385,   999801096, -2051819107,  -124792509,
+                            -1313453424, -1222292672,   720729635, -1127825669,
+                              287927118,  -802508777,  -532857355,  -436623690,
+                            -1320952725,  1803111607,  2070063389, -2018271651),
+      UINT16_C(0x350e),
+      simde_mm512_set_epi32( -900508458,  -222186732,  -462571340,   -80968288,
+                            -1939479688,   879528925,  1034849767,  1124479052,
+                            -1368276986,  -934469782, -1363405181,  1125778951,
+                            -1937130173, -1032419448,  2060937784,   230641102),
+      simde_mm512_set_epi32( 2063883385,   999801096,  -462571340,   -80968288,
+                            -1313453424,   879528925,   720729635,  1124479052,
+                              287927118,  -802508777,  -532857355,  -436623690,
+                            -1937130173, -1032419448,  2060937784, -2018271651) },
+    { simde_mm512_set_epi32(  705590002,   -91898990,  -522823030, -1137255113,
+                             -336327009,  1799133367, -1599638024,  1933855198,
+                            -1870305187, -1193537400,  1750650811,  2092972396,
+                             1938673775,    61402491,  1208694225,  -451360644),
+      UINT16_C(0x8e05),
+      simde_mm512_set_epi32(  606303775,  1933823893,  -212063488,  1405463364,
+                              792473359,   223650968,  1061004916,   686726481,
+                              335647871,  -160764696,  -381179913,  1635473074,
+                             1109441638,  -800126322,  1261656663,  1071332051),
+      simde_mm512_set_epi32(  606303775,   -91898990,  -522823030, -1137255113,
+                              792473359,   223650968,  1061004916,  1933855198,
+                            -1870305187, -1193537400,  1750650811,  2092972396,
+                             1938673775,  -800126322,  1208694225,  1071332051) },
+    { simde_mm512_set_epi32( -430383921,   698611948,  1295797826, -1373237479,
+                            -2072035056,  -112407804,  1147466119,   -17482642,
+                             1076234202, -1107207982,   932141357,  1870909758,
+                             -271926091,  1288206484, -1937905001, -1490856861),
+      UINT16_C(0x13a9),
+      simde_mm512_set_epi32( 1316033023,  -850193024,  -537930526,  1345664858,
+                             1741743192,   293028405, -1717812854, -1773435562,
+                             1764971287,  -633502597,  -347662842,   584574621,
+                            -1823413421,  -606779333,  2000349897,  1900332911),
+      simde_mm512_set_epi32( -430383921,   698611948,  1295797826,  1345664858,
+                            -2072035056,  -112407804, -1717812854, -1773435562,
+                             1764971287, -1107207982,  -347662842,  1870909758,
+                            -1823413421,  1288206484, -1937905001,  1900332911) },
+    { simde_mm512_set_epi32( 1945701752,  2026964269, -1238553919,  -860425316,
+                             -452984022, -1370322222,   171564203,   464473498,
+                             -586219088,  -910263894,   535110826, -1198990961,
+                             -679894752, -1985255370,  2032293307,  1914397624),
+      UINT16_C(0x6fad),
+      simde_mm512_set_epi32( -445481201,  -793182369, -1498513265, -1475420884,
+                              330287443, -1564189196,  1051246591,  -342229084,
+                             2099068605, -1947979757,   881510183,    81643127,
+                              191547694,  1782765008,  1510127879, -2103570501),
+      simde_mm512_set_epi32( 1945701752,  -793182369, -1498513265,  -860425316,
+                              330287443, -1564189196,  1051246591,  -342229084,
+                             2099068605,  -910263894,   881510183, -1198990961,
+                              191547694,  1782765008,  2032293307, -2103570501) },
+    { simde_mm512_set_epi32(-1783978464, -2051003460,  -575456244,  1143847983,
+                              172786822,   957978378,  1850681928,  -610599083,
+                             1711466124,  2065094218,   719003817,  1414415720,
+                             -635562822,  -315280870,   186118508,  1705466597),
+      UINT16_C(0xbd7b),
+      simde_mm512_set_epi32( -729456025,   853979173,   135294331,   439980976,
+                            -1384754120,  1142132468,   -60345011,  1272217245,
+                             -421569813, -1485572413,  1021700931,  1015625069,
+                             -743326726,   385151545,  -339656717, -1690918260),
+      simde_mm512_set_epi32( -729456025, -2051003460,   135294331,   439980976,
+                            -1384754120,  1142132468,  1850681928,  1272217245,
+                             1711466124, -1485572413,  1021700931,  1015625069,
+                             -743326726,  -315280870,  -339656717, -1690918260) },
+    { simde_mm512_set_epi32(  593412699, -1522403265,  1225422554,    36925286,
+                               64874930, -1439840745,  1543004544,  -323890711,
+                             1343799199,  -846888326,  -152190734,  1050853046,
+                            -1291920475,   489215772, -1630623414,  1427968726),
+      UINT16_C(0xf60f),
+      simde_mm512_set_epi32(-1408118422,  -782768363, -1976565652,   914693872,
+                            -1695428767,  1611617010,   330213079,  1577412645,
+                            -1050794986,  1307879023,  -860898025,  -260046081,
+                             1560658036, -1999453857, -1214402913,  1381961226),
+      simde_mm512_set_epi32(-1408118422,  -782768363, -1976565652,   914693872,
+                               64874930,  1611617010,   330213079,  -323890711,
+                             1343799199,  -846888326,  -152190734,  1050853046,
+                             1560658036, -1999453857, -1214402913,  1381961226) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_loadu_epi32(test_vec[i].src, test_vec[i].k, (int32_t const*) &(test_vec[i].a));
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_loadu_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d src;
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -730.89,    545.78,    807.06,   -527.03,
+                            451.21,    902.69,   -502.40,   -786.91),
+      UINT8_C(0x13),
+      simde_mm512_set_pd(  -633.60,   -751.43,    140.93,    798.65,
+                            119.05,   -201.20,   -801.41,   -947.90),
+      simde_mm512_set_pd(  -730.89,    545.78,    807.06,    798.65,
+                            451.21,    902.69,   -801.41,   -947.90) },
+    { simde_mm512_set_pd(  -457.22,     82.05,   -487.81,     52.26,
+                            320.46,   -193.78,   -481.69,   -123.60),
+      UINT8_C(0x00),
+      simde_mm512_set_pd(  -473.43,    102.45,    438.22,   -951.86,
+                            -86.61,    287.97,    299.19,    520.08),
+      simde_mm512_set_pd(  -457.22,     82.05,   -487.81,     52.26,
+                            320.46,   -193.78,   -481.69,   -123.60) },
+    { simde_mm512_set_pd(   288.96,   -290.93,    434.52,   -251.83,
+                            413.80,   -866.58,    886.88,   -629.58),
+      UINT8_C(0xf4),
+      simde_mm512_set_pd(  -260.16,   -960.61,    643.01,     48.73,
+                            400.20,    162.15,    463.73,   -314.17),
+      simde_mm512_set_pd(  -260.16,   -960.61,    643.01,     48.73,
+                            413.80,    162.15,    886.88,   -629.58) },
+    { simde_mm512_set_pd(  -841.99,   -554.25,   -169.52,   -502.23,
+                              8.82,    307.26,   -550.99,   -480.92),
+      UINT8_C(0x5e),
+      simde_mm512_set_pd(  -256.42,   -911.05,    602.34,    428.77,
+                            344.95,   -141.92,   -989.37,    165.55),
+      simde_mm512_set_pd(  -841.99,   -911.05,   -169.52,    428.77,
+                            344.95,   -141.92,   -989.37,   -480.92) },
+    { simde_mm512_set_pd(   920.96,   -592.74,    891.89,   -304.50,
+                            328.13,   -750.28,   -228.57,    412.02),
+      UINT8_C(0x03),
+      simde_mm512_set_pd(  -703.76,   -186.03,   -384.26,   -605.88,
+                           -468.67,   -653.44,   -324.51,    -54.84),
+      simde_mm512_set_pd(   920.96,   -592.74,    891.89,   -304.50,
+                            328.13,   -750.28,   -324.51,    -54.84) },
+    { simde_mm512_set_pd(  -761.65,     38.32,    -24.47,    410.53,
+                            345.45,   -211.43,     91.10,   -991.87),
+      UINT8_C(0xc4),
+      simde_mm512_set_pd(  -542.71,    -53.34,     15.73,    723.77,
+                            231.52,   -118.25,    248.23,    708.27),
+      simde_mm512_set_pd(  -542.71,    -53.34,    -24.47,    410.53,
+                            345.45,   -118.25,     91.10,   -991.87) },
+    { simde_mm512_set_pd(  -452.67,    132.45,    934.72,    -70.06,
+                            845.59,   -849.82,   -675.48,   -593.78),
+      UINT8_C(0xd8),
+      simde_mm512_set_pd(   728.56,    876.15,   -252.44,   -889.31,
+                            748.67,   -290.20,    255.43,    378.27),
+      simde_mm512_set_pd(   728.56,    876.15,    934.72,   -889.31,
+                            748.67,   -849.82,   -675.48,   -593.78) },
+    { simde_mm512_set_pd(  -832.15,    -89.36,    233.97,    479.69,
+                           -735.28,    910.90,    312.81,    958.85),
+      UINT8_C(0xf0),
+      simde_mm512_set_pd(  -826.75,    142.83,    731.98,   -463.85,
+                           -762.43,   -372.93,     73.14,   -909.74),
+      simde_mm512_set_pd(  -826.75,    142.83,    731.98,   -463.85,
+                           -735.28,    910.90,    312.81,    958.85) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_mask_loadu_pd(test_vec[i].src, test_vec[i].k, (simde_float64 const*) &(test_vec[i].a));
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_max_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 src;
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(  -431.39f,   -877.60f,    675.13f,   -715.52f,
+                            932.98f,    509.61f,   -471.16f,    373.44f,
+                           -930.34f,   -262.49f,   -862.29f,   -947.87f,
+                            261.67f,     82.02f,   -316.53f,   -164.45f),
+      UINT16_C(0x5947),
+      simde_mm512_set_ps(   792.14f,   -528.82f,    418.44f,   -517.81f,
+                            193.91f,    821.61f,   -645.19f,   -514.12f,
+                           -576.80f,   -143.03f,   -944.86f,   -196.25f,
+                            121.46f,    836.02f,   -543.34f,   -197.27f),
+      simde_mm512_set_ps(  -925.68f,    -98.15f,   -833.48f,   -992.40f,
+                            883.82f,   -511.02f,   -455.08f,    765.51f,
+                            -90.63f,     33.29f,    713.03f,    698.42f,
+                            136.80f,    259.09f,   -225.52f,    385.51f),
+      simde_mm512_set_ps(  -431.39f,    -98.15f,    675.13f,   -517.81f,
+                            883.82f,    509.61f,   -471.16f,    765.51f,
+                           -930.34f,     33.29f,   -862.29f,   -947.87f,
+                            261.67f,    836.02f,   -225.52f,    385.51f) },
+    { simde_mm512_set_ps(  -497.52f,    598.86f,    439.14f,   -232.80f,
+                           -556.44f,    279.84f,    727.24f,   -422.77f,
+                           -722.43f,   -560.50f,   -460.48f,   -418.47f,
+                           -513.00f,   -740.72f,    364.38f,     -6.99f),
+      UINT16_C(0x6182),
+      simde_mm512_set_ps(  -884.29f,   -738.96f,    828.86f,   -242.29f,
+                           -742.78f,   -930.24f,    194.95f,    184.47f,
+                           -949.96f,     48.96f,   -733.58f,     11.42f,
+                            -82.83f,    574.03f,   -861.83f,    951.95f),
+      simde_mm512_set_ps(    32.26f,   -191.76f,   -412.14f,    502.73f,
+                            337.11f,    939.03f,    266.87f,   -914.70f,
+                           -788.09f,   -401.33f,    471.80f,    593.21f,
+                           -371.79f,     15.40f,   -647.06f,    -90.49f),
+      simde_mm512_set_ps(  -497.52f,   -191.76f,    828.86f,   -232.80f,
+                           -556.44f,    279.84f,    727.24f,    184.47f,
+                           -788.09f,   -560.50f,   -460.48f,   -418.47f,
+                           -513.00f,   -740.72f,   -647.06f,     -6.99f) },
+    { simde_mm512_set_ps(   798.48f,    384.39f,    635.00f,    -29.55f,
+                           -926.68f,    738.94f,   -483.09f,    381.59f,
+                            653.91f,    997.07f,   -328.72f,    -86.23f,
+                            260.21f,    -86.21f,   -917.16f,    825.30f),
+      UINT16_C(0x91e5),
+      simde_mm512_set_ps(  -535.71f,   -549.94f,   -371.66f,   -455.82f,
+                           -454.32f,   -564.99f,   -865.30f,    -87.32f,
+                            734.56f,    703.40f,    424.31f,   -511.99f,
+                            240.91f,    972.82f,   -868.67f,    -18.99f),
+      simde_mm512_set_ps(  -540.44f,   -938.02f,   -103.14f,   -282.06f,
+                            688.31f,    248.32f,    969.43f,    401.45f,
+                            978.02f,   -945.84f,   -867.91f,   -616.96f,
+                           -695.46f,   -963.65f,    -89.69f,    433.39f),
+      simde_mm512_set_ps(  -535.71f,    384.39f,    635.00f,   -282.06f,
+                           -926.68f,    738.94f,   -483.09f,    401.45f,
+                            978.02f,    703.40f,    424.31f,    -86.23f,
+                            260.21f,    972.82f,   -917.16f,    433.39f) },
+    { simde_mm512_set_ps(   217.66f,    709.56f,    671.34f,   -133.10f,
+                           -417.18f,   -496.54f,   -543.63f,   -531.67f,
+                           -945.26f,   -825.28f,    511.35f,    608.96f,
+                           -433.50f,    689.38f,   -755.44f,    759.33f),
+      UINT16_C(0x84fd),
+      simde_mm512_set_ps(  -176.82f,    462.27f,    786.96f,    379.55f,
+                            996.14f,     56.20f,   -701.95f,   -805.67f,
+                            367.54f,    502.87f,     83.05f,    462.15f,
+                           -354.48f,    750.00f,   -731.53f,    159.30f),
+      simde_mm512_set_ps(  -184.43f,   -400.59f,    541.45f,   -847.89f,
+                            814.38f,     58.72f,     86.39f,    461.37f,
+                            -71.86f,    933.89f,    123.84f,    987.67f,
+                            770.75f,    305.80f,    984.28f,   -232.22f),
+      simde_mm512_set_ps(  -176.82f,    709.56f,    671.34f,   -133.10f,
+                           -417.18f,     58.72f,   -543.63f,   -531.67f,
+                            367.54f,    933.89f,    123.84f,    987.67f,
+                            770.75f,    750.00f,   -755.44f,    159.30f) },
+    { simde_mm512_set_ps(  -209.21f,    882.83f,   -735.07f,   -171.00f,
+                            942.25f,   -777.86f,   -123.72f,    821.56f,
+                           -653.67f,   -419.25f,    529.73f,   -562.34f,
+                           -376.23f,    591.76f,   -893.66f,    684.50f),
+      UINT16_C(0xff1d),
+      simde_mm512_set_ps(   639.71f,    485.41f,    428.47f,   -292.72f,
+                           -475.66f,    684.24f,   -669.37f,   -800.52f,
+                            960.06f,    174.05f,    216.02f,   -519.21f,
+                            272.28f,   -878.51f,    -49.15f,    286.32f),
+      simde_mm512_set_ps(   352.98f,    779.89f,   -572.78f,   -577.49f,
+                            488.74f,    -45.14f,   -602.95f,    641.80f,
+                           -491.71f,   -134.77f,   -455.77f,    843.63f,
+                           -271.01f,    198.78f,    528.01f,     47.69f),
+      simde_mm512_set_ps(   639.71f,    779.89f,    428.47f,   -292.72f,
+                            488.74f,    684.24f,   -602.95f,    641.80f,
+                           -653.67f,   -419.25f,    529.73f,    843.63f,
+                            272.28f,    198.78f,   -893.66f,    286.32f) },
+    { simde_mm512_set_ps(  -106.13f,   -287.61f,   -861.38f,    328.99f,
+                            121.24f,    892.08f,    409.88f,   -438.05f,
+                            701.59f,    244.79f,   -261.85f,    316.33f,
+                           -827.44f,   -815.15f,   -251.80f,    954.75f),
+      UINT16_C(0x52f8),
+      simde_mm512_set_ps(  -347.46f,   -427.20f,    251.19f,   -664.31f,
+                             -5.22f,    767.44f,    320.98f,   -400.93f,
+                           -170.24f,    202.35f,   -263.94f,    281.14f,
+                           -585.85f,    681.20f,    333.79f,   -945.01f),
+      simde_mm512_set_ps(   887.70f,   -671.94f,    561.42f,   -675.25f,
+                           -499.65f,   -399.56f,   -773.39f,    643.40f,
+                            223.06f,   -819.59f,   -356.39f,    286.78f,
+                            251.51f,     10.65f,    116.81f,    798.17f),
+      simde_mm512_set_ps(  -106.13f,   -427.20f,   -861.38f,   -664.31f,
+                            121.24f,    892.08f,    320.98f,   -438.05f,
+                            223.06f,    202.35f,   -263.94f,    286.78f,
+                            251.51f,   -815.15f,   -251.80f,    954.75f) },
+    { simde_mm512_set_ps(    17.58f,    319.93f,   -783.30f,    284.79f,
+                           -701.35f,    490.50f,   -150.51f,    578.04f,
+                            987.22f,   -183.87f,   -666.70f,    -76.66f,
+                            437.24f,   -982.14f,    362.97f,   -344.50f),
+      UINT16_C(0x3ddb),
+      simde_mm512_set_ps(   723.29f,    760.64f,   -523.11f,   -349.65f,
+                            978.30f,   -235.62f,    977.45f,   -978.98f,
+                           -453.31f,    721.83f,    770.72f,    658.39f,
+                           -430.88f,   -120.99f,   -576.24f,   -314.85f),
+      simde_mm512_set_ps(  -147.48f,   -587.59f,    -97.20f,   -336.67f,
+                           -704.64f,   -488.09f,    348.78f,    914.64f,
+                            853.67f,    763.12f,   -645.38f,    -61.55f,
+                            991.29f,    368.58f,   -644.84f,   -104.02f),
+      simde_mm512_set_ps(    17.58f,    319.93f,    -97.20f,   -336.67f,
+                            978.30f,   -235.62f,   -150.51f,    914.64f,
+                            853.67f,    763.12f,   -666.70f,    658.39f,
+                            991.29f,   -982.14f,   -576.24f,   -104.02f) },
+    { simde_mm512_set_ps(  -749.41f,    918.84f,   -974.78f,    348.82f,
+                            210.08f,    535.72f,   -428.69f,   -237.79f,
+                            324.25f,   -164.66f,   -877.82f,    747.79f,
+                            122.69f,    563.65f,    340.55f,    -49.21f),
+      UINT16_C(0x8839),
+      simde_mm512_set_ps(   280.21f,   -771.96f,   -846.60f,    858.37f,
+                            242.54f,     96.94f,   -814.10f,   -221.28f,
+                           -200.02f,    119.52f,     27.95f,    561.34f,
+                           -639.16f,   -625.62f,   -856.29f,    616.51f),
+      simde_mm512_set_ps(   622.40f,    452.07f,   -917.70f,    -28.86f,
+                           -780.92f,   -304.08f,    394.16f,   -865.57f,
+                            140.85f,    200.19f,    788.02f,   -229.93f,
+                           -946.66f,   -955.76f,     12.61f,    343.06f),
+      simde_mm512_set_ps(   622.40f,    918.84f,   -974.78f,    348.82f,
+                            242.54f,    535.72f,   -428.69f,   -237.79f,
+                            324.25f,   -164.66f,    788.02f,    561.34f,
+                           -639.16f,    563.65f,    340.55f,    616.51f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_mask_max_ps(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_mov_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(  124772334,  2114058617,  1025282522,  1374017592,
+                            -1680614182, -1727593333, -1919775959,   390023368,
+                             1005641580,  -395156279,  1815959106,   719344228,
+                             1651779562,   -89357338, -1613655954,  -296268024),
+      UINT16_C(0xf27c),
+      simde_mm512_set_epi32( -695743652,  1607417462,  -876930100,  2045090105,
+                             1273480067, -2010727399,  1140606553, -1055573594,
+                            -1144018881,  1016098996,   990770429,  1166143114,
+                             1510640107,  1640987265,  1678057142, -1957591976),
+      simde_mm512_set_epi32( -695743652,  1607417462,  -876930100,  2045090105,
+                            -1680614182, -1727593333,  1140606553,   390023368,
+                             1005641580,  1016098996,   990770429,  1166143114,
+                             1510640107,  1640987265, -1613655954,  -296268024) },
+    { simde_mm512_set_epi32( 1116545315, -1250397710,  1062902017, -1320277088,
+                            -1715608179,  -323948499,  1609476963,  1229199143,
+                             -471537475,   620957990,  -112947721, -1086960854,
+                              942655489,   -29275892,  -810420010, -1978259524),
+      UINT16_C(0x0ab1),
+      simde_mm512_set_epi32(  544760427, -1137813183,  1150245437,   520033770,
+                             1065256793, -1638001444, -1516364305, -1314948994,
+                              288562995, -1663083307,  1112585701,  -912881507,
+                             -701214411, -1021246743,  -343096794,  -440393685),
+      simde_mm512_set_epi32( 1116545315, -1250397710,  1062902017, -1320277088,
+                             1065256793,  -323948499, -1516364305,  1229199143,
+                              288562995,   620957990,  1112585701,  -912881507,
+                              942655489,   -29275892,  -810420010,  -440393685) },
+    { simde_mm512_set_epi32(   -4710290, -1864619687,  -292074326,  -732237917,
+                              954539703,  -186684527,   809199477, -1050117612,
+                             1059385928, -1207559530,   179833350, -1237203961,
+                            -1857042284,  -534186838,  2059841889,   513696704),
+      UINT16_C(0x3e34),
+      simde_mm512_set_epi32( 1930843169,  1200586577,  1833851392, -1034621059,
+                             2088728962,  1883299272,   695790595,   755576634,
+                              569982695,  1683889833, -1922600490,   -26007960,
+                             1060631185,  -657036586,  1776042816,  1762159651),
+      simde_mm512_set_epi32(   -4710290, -1864619687,  1833851392, -1034621059,
+                             2088728962,  1883299272,   695790595, -1050117612,
+                             1059385928, -1207559530, -1922600490,   -26007960,
+                            -1857042284,  -657036586,  2059841889,   513696704) },
+    { simde_mm512_set_epi32(  884772719, -1906382054,   837091682,  -247291494,
+                             1868587076, -2038572105,  -817489987,  2073820340,
+                             -242565468, -1326646759,  -484310008,  -735879471,
+                            -1455030985,    72731463,   411703756,  1304697744),
+      UINT16_C(0x1ef0),
+      simde_mm512_set_epi32(  629285719, -1317773497,  1304202190, -1506624313,
+                            -1664289536,   436709475,  1776870814,  1458581116,
+                             -170146959,   908981039,   200648094,  1551661652,
+                            -1620917144,  1985453867, -1323235278, -1826658196),
+      simde_mm512_set_epi32(  884772719, -1906382054,   837091682, -1506624313,
+                            -1664289536,   436709475,  1776870814,  2073820340,
+                             -170146959,   908981039,   200648094,  1551661652,
+                            -1455030985,    72731463,   411703756,  1304697744) },
+    { simde_mm512_set_epi32( -578346711, -1405495676, -2137281372,  -997292737,
+                            -1087342159, -2143714441,  1021297899,   271248860,
+                             -111558521,  -338323183,  1669539692, -1634335519,
+                             -849378597,  1012946065,   -35859622,  1247582968),
+      UINT16_C(0xf6cf),
+      simde_mm512_set_epi32( 1613028805,  -455748283,   988226755,  1762392840,
+                            -1650040165, -1655712862,   572441178,  2077737955,
+                            -1704864446,  1562739384,  1831262339,  1910449740,
+                             -832826393,  1050615213,  -296056087, -1596541205),
+      simde_mm512_set_epi32( 1613028805,  -455748283,   988226755,  1762392840,
+                            -1087342159, -1655712862,   572441178,   271248860,
+                            -1704864446,  1562739384,  1669539692, -1634335519,
+                             -832826393,  1050615213,  -296056087, -1596541205) },
+    { simde_mm512_set_epi32( 2018417929,   102127897, -1119178203,  1385430117,
+                             -804943280,  1388926402,  -588013911,  -384679897,
+                             1568845026,  1789528010,   909167802,   213070401,
+                              197786316,   902254071, -1847999681, -2072290197),
+      UINT16_C(0x997f),
+      simde_mm512_set_epi32( -480166167,  -245308216,   863300372, -1770887042,
+                             -235776105,  -659497519, -1865682856,  1609352190,
+                             1286118204, -1966923673,  1088321064,  -781345875,
+                              -24735335, -1181000287,  1725812757,  -820526740),
+      simde_mm512_set_epi32( -480166167,   102127897, -1119178203, -1770887042,
+                             -235776105,  1388926402,  -588013911,  1609352190,
+                             1568845026, -1966923673,  1088321064,  -781345875,
+                              -24735335, -1181000287,  1725812757,  -820526740) },
+    { simde_mm512_set_epi32( -250018401,   303986683,  -743305564,  1039514609,
+                              632194338,  1292423096,  2101056014, -1291469026,
+                              540898393,  -790788577,  1431421942,  -981250029,
+                             1974824003,  1924192202,  -916896436,   309678453),
+      UINT16_C(0xb3f9),
+      simde_mm512_set_epi32( -816153039,   -86296883,  -138198970,  1805154236,
+                            -1706987151, -1303634365,  -234443108,  1945745469,
+                               98234844,   572055215,    37078848, -1186252535,
+                             -703716459, -2132026397, -1102610982,  -685030518),
+      simde_mm512_set_epi32( -816153039,   303986683,  -138198970,  1805154236,
+                              632194338,  1292423096,  -234443108,  1945745469,
+                               98234844,   572055215,    37078848, -1186252535,
+                             -703716459,  1924192202,  -916896436,  -685030518) },
+    { simde_mm512_set_epi32( 1180172728,  1262622692,  1293015868,  1559467476,
+                             1003289864,  2029376970,  -592450123, -1554489099,
+                            -1380108808,  1581001966,   329964296,  -636965033,
+                             1945799085, -1841064120,  -295077772,  1581073508),
+      UINT16_C(0xe3d8),
+      simde_mm512_set_epi32(-2068157226,  2065155584, -1995729102,  -562824014,
+                              825068492, -1111303103,  1521737348, -1055647572,
+                            -1510173106,  1092577322,  1742607318,   266176281,
+                             -560252641,   184869199,  1224336912,  1185781505),
+      simde_mm512_set_epi32(-2068157226,  2065155584, -1995729102,  1559467476,
+                             1003289864,  2029376970,  1521737348, -1055647572,
+                            -1510173106,  1092577322,   329964296,   266176281,
+                             -560252641, -1841064120,  -295077772,  1581073508) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_mov_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_mov_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d src;
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -223.77,   -528.90,   -442.98,   -268.48,
+                           -365.66,    267.16,   -361.46,    690.79),
+      UINT8_C(0xec),
+      simde_mm512_set_pd(   794.35,    887.06,   -336.16,   -629.21,
+                           -658.73,    241.91,    351.04,    881.71),
+      simde_mm512_set_pd(   794.35,    887.06,   -336.16,   -268.48,
+                           -658.73,    241.91,   -361.46,    690.79) },
+    { simde_mm512_set_pd(  -261.93,   -176.40,    301.25,   -574.92,
+                           -214.70,   -442.65,   -714.81,     -0.59),
+      UINT8_C(0x3e),
+      simde_mm512_set_pd(    37.75,   -155.19,    220.91,   -733.18,
+                            963.20,   -813.22,   -968.35,    851.47),
+      simde_mm512_set_pd(  -261.93,   -176.40,    220.91,   -733.18,
+                            963.20,   -813.22,   -968.35,     -0.59) },
+    { simde_mm512_set_pd(   980.33,   -662.34,   -163.66,    801.20,
+                           -606.55,     67.58,    126.43,    164.82),
+      UINT8_C(0x81),
+      simde_mm512_set_pd(  -970.71,   -831.13,   -485.16,    689.24,
+                            245.08,   -830.79,    -33.95,    -32.75),
+      simde_mm512_set_pd(  -970.71,   -662.34,   -163.66,    801.20,
+                           -606.55,     67.58,    126.43,    -32.75) },
+    { simde_mm512_set_pd(  -788.37,    548.80,    -81.90,   -108.96,
+                              4.19,    216.48,   -146.56,    134.99),
+      UINT8_C(0x79),
+      simde_mm512_set_pd(  -535.60,    930.30,   -310.82,    664.03,
+                           -603.90,    926.12,    971.81,    428.42),
+      simde_mm512_set_pd(  -788.37,    930.30,   -310.82,    664.03,
+                           -603.90,    216.48,   -146.56,    428.42) },
+    { simde_mm512_set_pd(   921.41,   -166.69,    826.24,   -438.76,
+                              6.15,    355.60,   -583.09,   -974.70),
+      UINT8_C(0x4c),
+      simde_mm512_set_pd(   752.42,    532.99,    237.94,   -375.74,
+                            700.10,    857.96,    880.31,    570.36),
+      simde_mm512_set_pd(   921.41,    532.99,    826.24,   -438.76,
+                            700.10,    857.96,   -583.09,   -974.70) },
+    { simde_mm512_set_pd(   152.56,    796.31,     41.76,   -657.18,
+                            399.50,   -510.99,    684.52,    179.16),
+      UINT8_C(0xf4),
+      simde_mm512_set_pd(  -309.68,    373.96,   -248.10,     -6.04,
+                            135.10,   -927.91,   -982.63,    615.40),
+      simde_mm512_set_pd(  -309.68,    373.96,   -248.10,     -6.04,
+                            399.50,   -927.91,    684.52,    179.16) },
+    { simde_mm512_set_pd(   193.04,    593.84,   -938.86,   -314.92,
+                           -987.97,     31.53,   -238.44,   -146.83),
+      UINT8_C(0x3f),
+      simde_mm512_set_pd(  -939.69,   -896.88,   -864.89,    836.68,
+                           -110.96,     54.77,    -82.44,    855.84),
+      simde_mm512_set_pd(   193.04,    593.84,   -864.89,    836.68,
+                           -110.96,     54.77,    -82.44,    855.84) },
+    { simde_mm512_set_pd(    40.58,   -127.65,   -439.98,    447.15,
+                            405.27,   -991.30,    690.45,     63.83),
+      UINT8_C(0x29),
+      simde_mm512_set_pd(   177.05,   -595.82,    525.48,    774.03,
+                            155.73,   -898.51,   -113.42,   -867.65),
+      simde_mm512_set_pd(    40.58,   -127.65,    525.48,    447.15,
+                            155.73,   -991.30,    690.45,   -867.65) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_mask_mov_pd(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_mullo_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( 2106157572,   509435696,  -881993402,   327888937,
+                            -1986000490,  1124072202,  -794350685,   254881094,
+                              246923740, -1515941452,  -860490861,  1258833665,
+                            -1150991353, -1488079669,   864064322, -1655319739),
+      UINT16_C(0x6291),
+      simde_mm512_set_epi32( -494774515, -1568018247,  -395151367,  -946475032,
+                             -482411336, -1971197006,  1834680475,  -724187815,
+                             -931437317,   579359386,  2049770636, -1356001824,
+                             1119006824,  -999816561,   290101916,  -957510492),
+      simde_mm512_set_epi32( 1725913763, -1196839502,  -936531614,  2000183807,
+                             -521171088,  -649897384,  -925442254,  -747301653,
+                             1748788301,  1414921220,   897866549,   905387594,
+                              531741918,  1821315496,  -922736714, -1253838983),
+      simde_mm512_set_epi32( 2106157572,   498558370,   734678610,   327888937,
+                            -1986000490,  1124072202,   987702086,   254881094,
+                              593718143, -1515941452,  -860490861, -1379515712,
+                            -1150991353, -1488079669,   864064322, -1887398524) },
+    { simde_mm512_set_epi32( -901584496,  -734351962,  1766640873,   -31530909,
+                              873909932,  1014275022,   377962479,   186488552,
+                              798827817,  -248427445,  -955367525,  1655622143,
+                            -1182568961,   767464577,   745383590, -1596725183),
+      UINT16_C(0xad5c),
+      simde_mm512_set_epi32(-1962035623,  -964411132,  1238802754, -1901805126,
+                            -1565282871,  -331250440,  1981626904,  1017901521,
+                             1378036889,  1380883150,   784223921, -1386628275,
+                             1128078638,   702669022, -1070243318,  -640806591),
+      simde_mm512_set_epi32(  878222604,  -371770672,  1264794558,   203160451,
+                            -1251065463, -1691060638,   719057445,   840579300,
+                              514526031,  -124604867, -1746366725, -1222944514,
+                             -879216720,  1268482357,  -795554192,  -899441725),
+      simde_mm512_set_epi32(-1341054676,  -734351962,  -151264004,   -31530909,
+                             2057701777,  -826329360,   377962479,   121837092,
+                              798827817,  -479271146,  -955367525, -1551282586,
+                              681111968, -1367512074,   745383590, -1596725183) },
+    { simde_mm512_set_epi32(-2109796060, -1455502670,  1365758144,  1363289981,
+                             1557070758,  1927968454, -2082330951,  2044228069,
+                            -1363653088,  -725264761,   875875862,   453691341,
+                            -1287937363, -1432202823,  -608983233, -1167635006),
+      UINT16_C(0xb4f1),
+      simde_mm512_set_epi32(-2005611038, -1695333800, -1417723493,  1581682336,
+                            -1278973532, -1868361699, -1392996818,  -389735683,
+                             1073821545,  -559998895, -1698822937,  1260136573,
+                              -68042684,  1514011257,  -169039076,   152310739),
+      simde_mm512_set_epi32(   66420292,   715004965,  -720822795,   976113910,
+                              166407238,   566986450, -2107914264, -1863474979,
+                              436574851,  -284610661, -2039582738, -2028631144,
+                             2136915470,   574780166,  -869731926,  -265801134),
+      simde_mm512_set_epi32( 1806035976, -1455502670,  -794077097, -2061562432,
+                             1557070758, -2077137462, -2082330951,  2044228069,
+                              989955259,  2040764427,  1175107522,   536144184,
+                            -1287937363, -1432202823,  -608983233, -1119514730) },
+    { simde_mm512_set_epi32(-1780944881,  -185218371,    46092624,   808703791,
+                            -1884758143,  -431697186,  1337489582,  1925498956,
+                            -2083120656, -1481814028,  -148121734,  -957310937,
+                              841232100,  -846166999,  -498902813,  1700526743),
+      UINT16_C(0x874f),
+      simde_mm512_set_epi32(  722829942,  -840373682,  1928421340,  -153763482,
+                             1411710216,   112932144,   459090465,  1114118584,
+                             1743664304,  -921293458,   970020829,  -471163027,
+                            -1888000963,  1826120405,  -328734417,  -582197848),
+      simde_mm512_set_epi32( -655184364, -1347561731, -1132174614,   342725432,
+                            -1493613083,   179075390,  -255153346,  -218614023,
+                            -1797253959, -1423536942,  1872048333,   796209327,
+                             1576633059,   -58865925,  -226891752, -1386420078),
+      simde_mm512_set_epi32( -538548936,  -185218371,    46092624,   808703791,
+                            -1884758143, -1178955360,   163462910,  1726862328,
+                            -2083120656,  1297968188,  -148121734,  -957310937,
+                            -2145788905,    43689175,   -95980440, -1697797680) },
+    { simde_mm512_set_epi32(  150716122,  1801463379,  1342898405,  -351906700,
+                              470524464, -2052278572,   -22686977,     1441579,
+                             2032639490,  1707065006,  -512573328,  1594903921,
+                            -1326782796, -1165582537, -1458796018,   122318635),
+      UINT16_C(0xa035),
+      simde_mm512_set_epi32(-1402240128,  -878705565,  1241590246, -1871541870,
+                              991987947,  1181492490,  -814657831,   986238317,
+                            -1543239971, -1066628689,  -661140998,  -508509337,
+                              228208008,  1293997611,   506141936,  1506096009),
+      simde_mm512_set_epi32(-1057949432,  -147407290,  1484524392, -1304108629,
+                             1359096902, -1619499945,   104567458,  1387384923,
+                             -670904921,  -515555918,  1414873428,   983133459,
+                              633674661,   228941792,  1080562425, -1742825094),
+      simde_mm512_set_epi32( 1044618240,  1801463379,  2024662896,  -351906700,
+                              470524464, -2052278572,   -22686977,     1441579,
+                             2032639490,  1707065006, -1273446392,   568351653,
+                            -1326782796,  -454272352, -1458796018,    97873994) },
+    { simde_mm512_set_epi32( -806926344,  -945329144, -1660927844,  1070417542,
+                            -1258948654,   119550623,  1497571228, -1731761745,
+                            -1639143146,  1228366495,  -882782521, -1488457993,
+                              614495967,    33300051, -1894245395, -1693877706),
+      UINT16_C(0x93aa),
+      simde_mm512_set_epi32( -367912168, -1745942042, -1458455068,  1278290856,
+                             1231289408,    20704692,  1385896028,  -591867713,
+                            -1035303899,   231961870,  -698645597, -2038809590,
+                             -125453425,  -907734351, -1112833474, -1291525749),
+      simde_mm512_set_epi32(-1552554670,  1572334101,   737089837, -1802099468,
+                              540374792,  -273370694, -1865552458,   112699427,
+                            -1084075044,   703894403, -1217116896, -1139343430,
+                              570446924, -1163150613,  1917436552,  -716806165),
+      simde_mm512_set_epi32( -704567888,  -945329144, -1660927844,  1030831136,
+                            -1258948654,   119550623, -1854112408,   684384797,
+                             1376489164,  1228366495, -1597545632, -1488457993,
+                            -1489069452,    33300051,  2071866608, -1693877706) },
+    { simde_mm512_set_epi32(-1629202575, -1449795171,  1831072019,   245890266,
+                             -953655393, -1845389255,  2127269840,   422068679,
+                              768127616, -1254572149, -1726169904,   521452335,
+                             -148879922,   534549981,  1656420427,  1426020241),
+      UINT16_C(0x11c9),
+      simde_mm512_set_epi32( 1563072003,  1821877205,  1391733955,  -769951602,
+                              659913441,  1041452055,   303179125,   428341767,
+                            -1595252748,  1337189262,  -232230333,   788826452,
+                             -934506078, -1447681025, -1139466364,  -485356136),
+      simde_mm512_set_epi32( 1488285449,  -417708540,  -714443011,  1460992255,
+                             1647290981,  1108470230, -1462430684,  -903468567,
+                              549152862,  -629042841,  -402150753,  -833541431,
+                             1477241850,  2056446267,  -247006471, -1226943661),
+      simde_mm512_set_epi32(-1629202575, -1449795171,  1831072019, -1824610958,
+                             -953655393, -1845389255,  2127269840, -1495814305,
+                             -465151080, -1949172702, -1726169904,   521452335,
+                             1745743412,   534549981,  1656420427,  1393733704) },
+    { simde_mm512_set_epi32( -248843658, -1706597508,  1804793283,  1025677731,
+                            -1332573470,  2034459947, -1205906155, -1349408012,
+                            -1506021044,  -864041368, -1830683421, -1826575213,
+                              580046583,  -841743643,  2092848073,  -925396294),
+      UINT16_C(0x635c),
+      simde_mm512_set_epi32(  571445844,  2041686414, -1705191965,  -491561281,
+                             1222887733, -1993141868,  -712593530, -1775904981,
+                            -1982336590, -1204517291,   508819931,   478801291,
+                              572821470,   376909441, -1084484264, -1729622476),
+      simde_mm512_set_epi32(-1459027214,  2071461367,  1967036029,  -445920040,
+                             -268344261, -1140773549,   874255963,   451193257,
+                             -296291137,  -717574415, -1820411586,   -54282543,
+                              704685004, -1903974461,   571480866, -1467837254),
+      simde_mm512_set_epi32( -248843658,   167636482,  1352757719,  1025677731,
+                            -1332573470,  2034459947,  -459413342,   441609827,
+                            -1506021044,  1157774341, -1830683421,   542949499,
+                             -390267160,   908170051,  2092848073,  -925396294) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_mullo_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_reduce_add_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i a;
+    int32_t r;
+  } test_vec[8] = {
+    { UINT16_C(0x5d64),
+      simde_mm512_set_epi32( 1224935404, -1992929623, -2125571948,  -372086523,
+                             -167960281,  -478461482,  -520452489,  1085115266,
+                              306999383,   736038314, -1702679664,    46513601,
+                            -1645439087,  -196247644,  1847202484,     2956230),
+      INT32_C( 1205755659) },
+    { UINT16_C(0x48c5),
+      simde_mm512_set_epi32(  997757205,   261959324,  1222169250,  -629754205,
+                             1045020622, -2102550173,   561059537,   -67585842,
+                            -1001582810,  -954221096,  -255840082,  1405415398,
+                             1885270831,  -896672713,  -173173639,  1650850110),
+      INT32_C(  105353437) },
+    { UINT16_C(0x8bea),
+      simde_mm512_set_epi32( -509420403, -1296989307,  -596874119,  -572983400,
+                             1827542141,  -711146356,  -110568447,  -544510731,
+                              986072276, -1444986023, -1678264756,  1355937074,
+                            -1275692735,  1620202190,  1202482646,   506751281),
+      INT32_C(-1547346032) },
+    { UINT16_C(0x7dba),
+      simde_mm512_set_epi32( -861885557,  -840743552,   640000035, -1969086503,
+                              648750735,   415159950,   945451350,  1617136961,
+                             -944088437,  -144490970,   -89945777,   713308702,
+                             1872140208, -2051955843,  1502174452,   667159551),
+      INT32_C( -730160522) },
+    { UINT16_C(0x4080),
+      simde_mm512_set_epi32(-1779848142,   -57467118,   225510020, -1211469494,
+                             -536504230,   761920836,  -158768863, -1051176296,
+                             1931249318,  1633398966,  -292613949,  -542482918,
+                             -226399353,  -433929382,  -838828645,  -579427175),
+      INT32_C( 1873782200) },
+    { UINT16_C(0x1d3d),
+      simde_mm512_set_epi32(-1742539083,   954360215, -1085897014,  -260583073,
+                             -772070345, -1052289072, -1640067511,    86164391,
+                             -791165584,  1974258628, -1110014645,   891277717,
+                              787146983, -2131374276,  -464671406,  1920788692),
+      INT32_C(-1640953628) },
+    { UINT16_C(0x850f),
+      simde_mm512_set_epi32(-1335403308,   939200646, -1712420458, -2083492866,
+                            -1251493168,  1418026274,   244768495,  1615017195,
+                            -1619029432,  1069763489,   309383685,   968137202,
+                              281245118,  -306228227, -1998596919,   749863436),
+      INT32_C(  423923569) },
+    { UINT16_C(0xa29b),
+      simde_mm512_set_epi32(-1853085912,  1234630062,  -770049133,   483142942,
+                               29654916,   463226182,  -867461855,    89463651,
+                             1409834444,  -937093069,  1261606057,  1656980505,
+                             -297677128,  1247217305,  -203785969,  1086530418),
+      INT32_C(  161285370) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm512_mask_reduce_add_epi32(test_vec[i].k, test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_reduce_add_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512 a;
+    simde_float32 r;
+  } test_vec[8] = {
+    { UINT16_C(0x631c),
+      simde_mm512_set_ps(   808.19f,   -645.14f,   -708.64f,    368.30f,
+                           -643.51f,    790.87f,    107.92f,   -252.52f,
+                            -15.34f,   -273.42f,   -708.09f,     -7.41f,
+                            785.00f,   -143.11f,   -110.84f,   -694.35f),
+        -863.90f },
+    { UINT16_C(0x6e96),
+      simde_mm512_set_ps(   454.18f,   -530.50f,   -207.46f,    765.91f,
+                           -712.05f,    160.05f,   -887.21f,    387.71f,
+                           -987.38f,   -557.68f,   -643.22f,     85.61f,
+                            706.94f,   -747.80f,   -750.82f,   -883.22f),
+       -4577.56f },
+    { UINT16_C(0x9f37),
+      simde_mm512_set_ps(   -36.75f,    661.21f,   -597.25f,     40.14f,
+                            293.65f,   -303.79f,    934.20f,   -851.15f,
+                           -838.10f,   -658.17f,    633.82f,    808.50f,
+                            522.24f,    318.96f,   -743.12f,    115.22f),
+        1209.68f },
+    { UINT16_C(0x03bd),
+      simde_mm512_set_ps(    94.92f,    614.33f,    558.35f,   -198.37f,
+                            771.92f,     61.95f,    298.09f,   -489.33f,
+                           -436.51f,    527.68f,    108.39f,    943.72f,
+                           -812.41f,    793.74f,     -1.62f,    474.56f),
+         880.25f },
+    { UINT16_C(0x139c),
+      simde_mm512_set_ps(   532.68f,    102.91f,   -376.88f,   -443.68f,
+                            748.93f,    992.25f,   -829.36f,   -460.17f,
+                            413.45f,    981.34f,    853.85f,    440.19f,
+                            733.17f,   -197.70f,    298.65f,    -46.39f),
+        -344.10f },
+    { UINT16_C(0x5d38),
+      simde_mm512_set_ps(  -671.13f,     54.91f,    774.52f,     27.23f,
+                             -6.67f,   -265.01f,   -682.02f,    768.22f,
+                           -136.09f,    981.06f,    707.40f,    361.82f,
+                           -137.50f,    -71.33f,     11.60f,   -792.50f),
+        1510.40f },
+    { UINT16_C(0x9b76),
+      simde_mm512_set_ps(   731.60f,    607.55f,   -825.56f,    396.50f,
+                           -136.29f,    588.74f,    156.33f,   -326.29f,
+                            386.47f,    929.72f,    -80.75f,     33.16f,
+                            717.08f,    165.37f,   -504.46f,   -349.12f),
+        1364.89f },
+    { UINT16_C(0xade7),
+      simde_mm512_set_ps(   146.86f,    174.28f,   -454.35f,   -488.60f,
+                           -493.87f,    339.53f,   -566.77f,   -810.52f,
+                            -50.99f,    909.63f,   -583.60f,    578.65f,
+                           -644.67f,   -924.76f,   -225.22f,   -462.47f),
+       -2609.76f }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 r = simde_mm512_mask_reduce_add_ps(test_vec[i].k, test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_reduce_mul_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512d a;
+    simde_float64 r;
+  } test_vec[8] = {
+    { UINT8_C(0x2a),
+      simde_mm512_set_pd(    -1.94,      2.04,      0.56,      0.96,
+                              0.18,     -1.51,      2.25,      1.53),
+           0.23 },
+    { UINT8_C(0x71),
+      simde_mm512_set_pd(    -1.72,     -1.44,     -2.35,      1.68,
+                             -1.26,     -2.40,     -0.53,     -1.61),
+          -9.15 },
+    { UINT8_C(0xb9),
+      simde_mm512_set_pd(    -1.18,     -0.59,      2.27,      0.79,
+                              1.41,     -1.60,      0.44,     -2.63),
+           7.85 },
+    { UINT8_C(0x26),
+      simde_mm512_set_pd(    -0.14,      1.39,     -1.77,     -1.75,
+                             -0.61,      1.48,      2.48,      1.48),
+          -6.50 },
+    { UINT8_C(0x17),
+      simde_mm512_set_pd(     2.18,      1.05,      1.39,     -1.33,
+                              2.79,     -2.85,      2.79,      2.26),
+          23.90 },
+    { UINT8_C(0xdd),
+      simde_mm512_set_pd(    -1.80,      2.29,      0.83,     -1.03,
+                              2.98,     -1.84,      1.03,     -1.46),
+          33.99 },
+    { UINT8_C(0xef),
+      simde_mm512_set_pd(     1.66,     -2.33,     -1.61,      2.71,
+                             -2.68,     -0.33,     -1.91,     -0.57),
+           6.00 },
+    { UINT8_C(0xc0),
+      simde_mm512_set_pd(    -2.17,     -2.04,      0.22,      1.43,
+                             -2.05,      0.80,     -1.90,      0.76),
+           4.43 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 r = simde_mm512_mask_reduce_mul_pd(test_vec[i].k, test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_storeu_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( 1633974088,  1598035965,  1484443741, -2038246635,
+                              189042852,  -657683981,   948900066,  1851582551,
+                              343595489,  1151627760,   607994215,  -628224093,
+                             1639178623,  1383349921,  -824836013, -1878869561),
+      UINT16_C(0x7caa),
+      simde_mm512_set_epi32(  353834517,  -468967365,  2112579325, -1258433501,
+                             1805784770,  2103433847,   992040665,  -607271070,
+                             1198708455, -1430131928, -1424889357,   634614248,
+                             2119865032, -1261339191,  -426260356,  -101512766),
+      simde_mm512_set_epi32( 1633974088,  -468967365,  2112579325, -1258433501,
+                             1805784770,  2103433847,   948900066,  1851582551,
+                             1198708455,  1151627760, -1424889357,  -628224093,
+                             2119865032,  1383349921,  -426260356, -1878869561) },
+    { simde_mm512_set_epi32( -541765170, -1242729791, -1017335511, -1679978931,
+                             1366121667,  2001581292,  1241020571, -1349648358,
+                             1496473787,    26161128, -1719101063, -2145424638,
+                             1652084610, -1369889927,   276872667,  1455280648),
+      UINT16_C(0x4ae2),
+      simde_mm512_set_epi32(  963658982,  -633896982,   414096959,  1052070477,
+                             -345036736, -1659986670,  1900017940,  -332684759,
+                            -1779604466,  -755194745,  -902129949,  -975171895,
+                             -246652752, -1433078490,   -29263062,  1416737415),
+      simde_mm512_set_epi32( -541765170,  -633896982, -1017335511, -1679978931,
+                             -345036736,  2001581292,  1900017940, -1349648358,
+                            -1779604466,  -755194745,  -902129949, -2145424638,
+                             1652084610, -1369889927,   -29263062,  1455280648) },
+    { simde_mm512_set_epi32( 2091821117,  1555066411,  1189046297,   144878278,
+                            -1160983816, -1133616301, -1647282770,  -235527512,
+                              660399168,  -477746254,   359766975, -1039250942,
+                              824320026, -2030843138, -1217319023,  1907407323),
+      UINT16_C(0x9159),
+      simde_mm512_set_epi32(  152051295,   972330621, -1678353496,   347458561,
+                              884233614,  -271644741,   940211897,   356468386,
+                             1366994999,  -462437866,   162550027,   -57892401,
+                            -1224612284, -1600777116, -1333557735, -1642733680),
+      simde_mm512_set_epi32(  152051295,  1555066411,  1189046297,   347458561,
+                            -1160983816, -1133616301, -1647282770,   356468386,
+                              660399168,  -462437866,   359766975,   -57892401,
+                            -1224612284, -2030843138, -1217319023, -1642733680) },
+    { simde_mm512_set_epi32( -665842667,   544703723,  -219165757,   524849636,
+                              668051011,  2039075477,  -387485515,   554830797,
+                            -2083083583,   820939084, -1125644311, -1105757567,
+                             1501284236, -1249337838, -2123190536,  -455614173),
+      UINT16_C(0x3a7b),
+      simde_mm512_set_epi32( 1915395721,  2079549753, -1043772033,  -592326047,
+                            -1828919129,  1409539640, -2082494891,   624047806,
+                              964747288,  -507621243,  1101133916,  -401121430,
+                               93463446,   700650946,   317176387,   212866996),
+      simde_mm512_set_epi32( -665842667,   544703723, -1043772033,  -592326047,
+                            -1828919129,  2039075477, -2082494891,   554830797,
+                            -2083083583,  -507621243,  1101133916,  -401121430,
+                               93463446, -1249337838,   317176387,   212866996) },
+    { simde_mm512_set_epi32( -490135933,  1411225245,  -299600359, -1558071327,
+                             1857819022,  2128099320,  2028683073,   138436908,
+                             -740679645,  -128621118, -1524734476,   935313400,
+                            -1323276842, -1221469764, -1244992342, -1285319508),
+      UINT16_C(0xee98),
+      simde_mm512_set_epi32(  310242791,  -985056739, -1946241881,  1295047700,
+                              446554002,  1011904640,  1919108019,   521207890,
+                             1425857496,  1042202185,  1432324418,   290729967,
+                               -6123344,  1011877305,  1928177303, -1282799874),
+      simde_mm512_set_epi32(  310242791,  -985056739, -1946241881, -1558071327,
+                              446554002,  1011904640,  1919108019,   138436908,
+                             1425857496,  -128621118, -1524734476,   290729967,
+                               -6123344, -1221469764, -1244992342, -1285319508) },
+    { simde_mm512_set_epi32(  978254079,  -273175142,  1107621917,  -566172212,
+                              836639109, -1520980306, -1345580727, -1035756506,
+                            -1961123289, -2085527620,  1186339254,  1034740989,
+                             -270412949,  -880871490,  1085742703,  1073814468),
+      UINT16_C(0xdffe),
+      simde_mm512_set_epi32( 1429155113, -2000811204, -1404807192,  1130587143,
+                             1284394391,   385002634,   947654357,  -887260120,
+                             1460658771,  -323325588, -1852532299,  -506315662,
+                            -1946679441,  -142326169, -1779664305,   674282984),
+      simde_mm512_set_epi32( 1429155113, -2000811204,  1107621917,  1130587143,
+                             1284394391,   385002634,   947654357,  -887260120,
+                             1460658771,  -323325588, -1852532299,  -506315662,
+                            -1946679441,  -142326169, -1779664305,  1073814468) },
+    { simde_mm512_set_epi32(  720418990,  -328984751, -1121554275,   725864832,
+                             2143250917,  -553165382,  -740114211,   942320782,
+                            -1956009381,   585122775, -1504073875, -1435153438,
+                             1069404514,  1879040660,  -239717596, -1022971091),
+      UINT16_C(0x1fdd),
+      simde_mm512_set_epi32( 1756467249,   935677121,   140829893, -1596293711,
+                             1921257536, -1248892827, -1153514882,  1610987119,
+                             -555004375,  1123900262,  -609746778,  2090337325,
+                              466268045,  2107835652,  -850017602,  2097765324),
+      simde_mm512_set_epi32(  720418990,  -328984751, -1121554275, -1596293711,
+                             1921257536, -1248892827, -1153514882,  1610987119,
+                             -555004375,  1123900262, -1504073875,  2090337325,
+                              466268045,  2107835652,  -239717596,  2097765324) },
+    { simde_mm512_set_epi32( 1708610579,  1845403338,   124447128,  -486916605,
+                             -159062908,  -868509447,  -566262853,    93421090,
+                             1697742783, -1383930778, -1017074226,   380305487,
+                            -1170394879,   682555439, -1288554488,   675500416),
+      UINT16_C(0xc6f6),
+      simde_mm512_set_epi32( 2027551800, -2120951672, -1038182899,  -143270143,
+                             1607812904,     4328264, -1784732349,  1985530296,
+                             -786218488,   344237858,  1589728518,  -190903435,
+                             -657472925, -1412957488,  -944399684,  1634727566),
+      simde_mm512_set_epi32( 2027551800, -2120951672,   124447128,  -486916605,
+                             -159062908,     4328264, -1784732349,    93421090,
+                             -786218488,   344237858,  1589728518,  -190903435,
+                            -1170394879, -1412957488,  -944399684,   675500416) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = test_vec[i].src;
+    simde_mm512_mask_storeu_epi32((int32_t*) &r, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_storeu_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(-6055946355483081425), INT64_C( 4853783625896557186),
+                            INT64_C(  514617114012690912), INT64_C(-1713570476190183543),
+                            INT64_C(-6884218148359436187), INT64_C(-4185407898182012748),
+                            INT64_C(  649665961809853322), INT64_C( 8484195426737002113)),
+      UINT8_C(0x7e),
+      simde_mm512_set_epi64(INT64_C( 3076630999738246931), INT64_C(-1036763509340564570),
+                            INT64_C(-2966684463454558609), INT64_C(-7751420132661106162),
+                            INT64_C( 3450016289773005565), INT64_C( 7024174477706369071),
+                            INT64_C( 1149086498494810866), INT64_C( 4840320126946327898)),
+      simde_mm512_set_epi64(INT64_C(-6055946355483081425), INT64_C(-1036763509340564570),
+                            INT64_C(-2966684463454558609), INT64_C(-7751420132661106162),
+                            INT64_C( 3450016289773005565), INT64_C( 7024174477706369071),
+                            INT64_C( 1149086498494810866), INT64_C( 8484195426737002113)) },
+    { simde_mm512_set_epi64(INT64_C( -715041684645800371), INT64_C(-6961647427917163456),
+                            INT64_C( 2496832767234750766), INT64_C(  368604956017642608),
+                            INT64_C(   85739943200158784), INT64_C( 2642597370462526070),
+                            INT64_C( 5064860995807867725), INT64_C( 3527943573194299422)),
+      UINT8_C(0xdc),
+      simde_mm512_set_epi64(INT64_C(-6284367776604922142), INT64_C( -653632591525073958),
+                            INT64_C(-3252163265795492667), INT64_C( -253599854633066296),
+                            INT64_C( 2068673116016057141), INT64_C(-7482835130919861538),
+                            INT64_C(-5711201384074479238), INT64_C( 3932043024626939281)),
+      simde_mm512_set_epi64(INT64_C(-6284367776604922142), INT64_C( -653632591525073958),
+                            INT64_C( 2496832767234750766), INT64_C( -253599854633066296),
+                            INT64_C( 2068673116016057141), INT64_C(-7482835130919861538),
+                            INT64_C( 5064860995807867725), INT64_C( 3527943573194299422)) },
+    { simde_mm512_set_epi64(INT64_C( 7506893386553804282), INT64_C(-7511541978112698160),
+                            INT64_C( 5864889963766841775), INT64_C( 1073297951980938940),
+                            INT64_C(  477804370913003557), INT64_C( 8210851048072427979),
+                            INT64_C( 1637507433745649310), INT64_C( 8423007222816193235)),
+      UINT8_C(0x60),
+      simde_mm512_set_epi64(INT64_C( 2551952529061620607), INT64_C(-2049339894196195151),
+                            INT64_C( 6549954102141468266), INT64_C(-3714133731515318874),
+                            INT64_C(-4589035877697660792), INT64_C(-4844214915258324297),
+                            INT64_C(-6555570320512139763), INT64_C(-3679393483742196708)),
+      simde_mm512_set_epi64(INT64_C( 7506893386553804282), INT64_C(-2049339894196195151),
+                            INT64_C( 6549954102141468266), INT64_C( 1073297951980938940),
+                            INT64_C(  477804370913003557), INT64_C( 8210851048072427979),
+                            INT64_C( 1637507433745649310), INT64_C( 8423007222816193235)) },
+    { simde_mm512_set_epi64(INT64_C(-7103740449117011540), INT64_C(-2934188494185274894),
+                            INT64_C( 1840661842333354808), INT64_C( 1526108859332033330),
+                            INT64_C( 5980046319189059161), INT64_C( 3840809936229764686),
+                            INT64_C( 1149608126825451052), INT64_C( -602847118516868402)),
+      UINT8_C(0x44),
+      simde_mm512_set_epi64(INT64_C( 1354784715127214039), INT64_C(-4872447662241080358),
+                            INT64_C(-7506746059944658889), INT64_C(-3800704964255455553),
+                            INT64_C( 4432960423680528321), INT64_C(-1118524826979916264),
+                            INT64_C(-5402490668863133694), INT64_C( 2130573478404590375)),
+      simde_mm512_set_epi64(INT64_C(-7103740449117011540), INT64_C(-4872447662241080358),
+                            INT64_C( 1840661842333354808), INT64_C( 1526108859332033330),
+                            INT64_C( 5980046319189059161), INT64_C(-1118524826979916264),
+                            INT64_C( 1149608126825451052), INT64_C( -602847118516868402)) },
+    { simde_mm512_set_epi64(INT64_C( 7009392765444516069), INT64_C( 7492491227100011721),
+                            INT64_C(-9087092864758092377), INT64_C( -857343791179512188),
+                            INT64_C( 2894273782256736028), INT64_C(-6731076395942240352),
+                            INT64_C( 5634391785085340051), INT64_C( 2767721709642081607)),
+      UINT8_C(0x6a),
+      simde_mm512_set_epi64(INT64_C( 8628637959328192410), INT64_C(-7833464926154094164),
+                            INT64_C( 4894701958239711211), INT64_C(-2294667309025148989),
+                            INT64_C( 8323663958741049000), INT64_C( 7853151108108844294),
+                            INT64_C(-8291987892625526274), INT64_C( 8443555238732140174)),
+      simde_mm512_set_epi64(INT64_C( 7009392765444516069), INT64_C(-7833464926154094164),
+                            INT64_C( 4894701958239711211), INT64_C( -857343791179512188),
+                            INT64_C( 8323663958741049000), INT64_C(-6731076395942240352),
+                            INT64_C(-8291987892625526274), INT64_C( 2767721709642081607)) },
+    { simde_mm512_set_epi64(INT64_C( 3465765399012709324), INT64_C(-6696721379667955531),
+                            INT64_C(-3198349928702496525), INT64_C( 4096249208443490735),
+                            INT64_C(-7414148770301020950), INT64_C(-8135468133353743058),
+                            INT64_C( 4233015799718424092), INT64_C(-2205133757718541041)),
+      UINT8_C(0x5c),
+      simde_mm512_set_epi64(INT64_C(    4855790696620328), INT64_C( 2689028523487294244),
+                            INT64_C(-4307177138534095117), INT64_C( 6249845077460878894),
+                            INT64_C(-7165617218161909495), INT64_C( -369362012780311456),
+                            INT64_C(-7203855916888223340), INT64_C(  459251265131271986)),
+      simde_mm512_set_epi64(INT64_C( 3465765399012709324), INT64_C( 2689028523487294244),
+                            INT64_C(-3198349928702496525), INT64_C( 6249845077460878894),
+                            INT64_C(-7165617218161909495), INT64_C( -369362012780311456),
+                            INT64_C( 4233015799718424092), INT64_C(-2205133757718541041)) },
+    { simde_mm512_set_epi64(INT64_C(-5523471056345310071), INT64_C(-4581121659173490681),
+                            INT64_C(-5195322264586159792), INT64_C(-5658058217819061636),
+                            INT64_C(-4177871369475427712), INT64_C(-1603848386210667618),
+                            INT64_C( 3262488096375221850), INT64_C(-7108466721867650653)),
+      UINT8_C(0x71),
+      simde_mm512_set_epi64(INT64_C( 7426215780417277434), INT64_C(-6115378581677985007),
+                            INT64_C(-2752015419927941704), INT64_C( -858843472540808369),
+                            INT64_C(-4800855182842988209), INT64_C(-7532061363231007482),
+                            INT64_C( 5813866749876380392), INT64_C( 6415035644218515403)),
+      simde_mm512_set_epi64(INT64_C(-5523471056345310071), INT64_C(-6115378581677985007),
+                            INT64_C(-2752015419927941704), INT64_C( -858843472540808369),
+                            INT64_C(-4177871369475427712), INT64_C(-1603848386210667618),
+                            INT64_C( 3262488096375221850), INT64_C( 6415035644218515403)) },
+    { simde_mm512_set_epi64(INT64_C( 6242962018755275151), INT64_C(-4843235451425287888),
+                            INT64_C( 2281919880223183199), INT64_C(-6820846199903309271),
+                            INT64_C( 9022789075087167385), INT64_C( 5985381450895825202),
+                            INT64_C(-8433896443797423896), INT64_C(-2028123567506954411)),
+      UINT8_C(0xfb),
+      simde_mm512_set_epi64(INT64_C( 6193953954325421446), INT64_C( 2552504209919027075),
+                            INT64_C( 4468866456951155189), INT64_C( 4202294519531794169),
+                            INT64_C(    2640190699207694), INT64_C( 8563889930986283190),
+                            INT64_C(-5274372447538664128), INT64_C( 8293240864212746737)),
+      simde_mm512_set_epi64(INT64_C( 6193953954325421446), INT64_C( 2552504209919027075),
+                            INT64_C( 4468866456951155189), INT64_C( 4202294519531794169),
+                            INT64_C(    2640190699207694), INT64_C( 5985381450895825202),
+                            INT64_C(-5274372447538664128), INT64_C( 8293240864212746737)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = test_vec[i].src;
+    simde_mm512_mask_storeu_epi64((int64_t*) &r, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_storeu_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d src;
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -579.22,    902.71,    907.60,    329.55,
+                           -154.00,   -891.78,    946.20,     13.77),
+      UINT8_C(0x27),
+      simde_mm512_set_pd(  -348.50,    242.78,   -960.96,    617.70,
+                            508.79,   -764.87,   -420.27,   -999.65),
+      simde_mm512_set_pd(  -579.22,    902.71,   -960.96,    329.55,
+                           -154.00,   -764.87,   -420.27,   -999.65) },
+    { simde_mm512_set_pd(   -38.87,    531.98,    335.98,   -520.67,
+                           -198.80,    912.29,     19.14,   -103.62),
+      UINT8_C(0xa7),
+      simde_mm512_set_pd(  -941.26,   -453.03,    708.30,    655.53,
+                           -643.20,    358.69,    808.49,   -946.42),
+      simde_mm512_set_pd(  -941.26,    531.98,    708.30,   -520.67,
+                           -198.80,    358.69,    808.49,   -946.42) },
+    { simde_mm512_set_pd(  -584.61,    808.70,    946.80,    135.63,
+                           -704.44,     54.47,    620.02,   -375.41),
+      UINT8_C(0x12),
+      simde_mm512_set_pd(  -681.89,    463.60,   -848.97,    744.30,
+                           -833.79,   -112.01,   -283.19,   -944.86),
+      simde_mm512_set_pd(  -584.61,    808.70,    946.80,    744.30,
+                           -704.44,     54.47,   -283.19,   -375.41) },
+    { simde_mm512_set_pd(   987.32,   -301.46,    945.35,    355.29,
+                            -68.93,    872.29,   -432.02,    722.94),
+      UINT8_C(0x89),
+      simde_mm512_set_pd(   483.59,   -331.85,    493.49,   -102.47,
+                            504.29,   -379.24,   -618.60,    966.86),
+      simde_mm512_set_pd(   483.59,   -301.46,    945.35,    355.29,
+                            504.29,    872.29,   -432.02,    966.86) },
+    { simde_mm512_set_pd(   568.19,     40.50,    180.69,   -794.71,
+                           -238.25,   -638.52,    -78.38,   -524.16),
+      UINT8_C(0x10),
+      simde_mm512_set_pd(  -129.92,    967.24,    836.92,    954.48,
+                           -437.41,    172.19,    373.14,    404.57),
+      simde_mm512_set_pd(   568.19,     40.50,    180.69,    954.48,
+                           -238.25,   -638.52,    -78.38,   -524.16) },
+    { simde_mm512_set_pd(   117.47,    123.86,    820.99,    251.31,
+                            122.17,   -629.83,   -497.33,    702.75),
+      UINT8_C(0x6a),
+      simde_mm512_set_pd(   517.36,    980.35,    151.78,    226.31,
+                           -403.07,    792.78,    -93.47,    493.58),
+      simde_mm512_set_pd(   117.47,    980.35,    151.78,    251.31,
+                           -403.07,   -629.83,    -93.47,    702.75) },
+    { simde_mm512_set_pd(   850.57,    149.30,   -584.67,   -145.62,
+                            476.82,   -576.50,    260.88,   -915.22),
+      UINT8_C(0x89),
+      simde_mm512_set_pd(  -859.85,    267.51,     86.96,    208.68,
+                            615.91,    -73.38,   -848.36,   -578.41),
+      simde_mm512_set_pd(  -859.85,    149.30,   -584.67,   -145.62,
+                            615.91,   -576.50,    260.88,   -578.41) },
+    { simde_mm512_set_pd(   174.92,   -628.62,    451.21,   -210.56,
+                            933.85,    431.74,    903.99,    -72.91),
+      UINT8_C(0x1b),
+      simde_mm512_set_pd(   833.96,   -233.19,    147.87,    516.03,
+                           -262.51,    253.14,    896.98,   -695.12),
+      simde_mm512_set_pd(   174.92,   -628.62,    451.21,    516.03,
+                           -262.51,    431.74,    896.98,   -695.12) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = test_vec[i].src;
+    simde_mm512_mask_storeu_pd((simde_float64*) &r, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_storeu_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 src;
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(   577.07f,    279.21f,    678.69f,    711.94f,
+                           -976.33f,   -637.20f,     97.88f,   -806.63f,
+                           -403.50f,    493.20f,   -891.85f,   -739.41f,
+                           -865.74f,    248.60f,    264.65f,   -599.37f),
+      UINT16_C(0x34d6),
+      simde_mm512_set_ps(   893.67f,   -834.45f,   -571.47f,   -814.78f,
+                            -28.90f,    451.20f,   -994.76f,    529.43f,
+                           -519.90f,   -537.58f,   -837.76f,   -568.50f,
+                            416.33f,   -469.49f,   -252.75f,    697.01f),
+      simde_mm512_set_ps(   577.07f,    279.21f,   -571.47f,   -814.78f,
+                           -976.33f,    451.20f,     97.88f,   -806.63f,
+                           -519.90f,   -537.58f,   -891.85f,   -568.50f,
+                           -865.74f,   -469.49f,   -252.75f,   -599.37f) },
+    { simde_mm512_set_ps(  -783.82f,   -535.81f,   -378.00f,    -15.14f,
+                           -901.98f,    808.48f,    415.74f,    776.60f,
+                            429.71f,    327.05f,   -340.56f,   -280.70f,
+                            603.59f,   -696.15f,   -477.39f,     17.70f),
+      UINT16_C(0x5a36),
+      simde_mm512_set_ps(  -941.56f,    515.02f,    355.72f,    423.83f,
+                           -851.83f,    213.09f,    293.66f,   -874.49f,
+                            268.96f,   -608.42f,   -400.22f,   -601.75f,
+                           -186.11f,   -688.81f,   -553.24f,   -835.62f),
+      simde_mm512_set_ps(  -783.82f,    515.02f,   -378.00f,    423.83f,
+                           -851.83f,    808.48f,    293.66f,    776.60f,
+                            429.71f,    327.05f,   -400.22f,   -601.75f,
+                            603.59f,   -688.81f,   -553.24f,     17.70f) },
+    { simde_mm512_set_ps(   778.99f,    -43.31f,   -444.14f,   -484.06f,
+                             71.49f,   -155.12f,    971.52f,    900.29f,
+                           -748.43f,   -816.65f,    845.71f,   -929.21f,
+                           -642.28f,    796.24f,     99.67f,    349.24f),
+      UINT16_C(0x5948),
+      simde_mm512_set_ps(   289.15f,   -877.32f,    156.07f,   -826.67f,
+                           -982.40f,   -511.81f,    340.92f,    -12.07f,
+                           -845.37f,    673.59f,   -698.01f,   -277.75f,
+                           -868.35f,   -920.14f,     69.48f,   -789.77f),
+      simde_mm512_set_ps(   778.99f,   -877.32f,   -444.14f,   -826.67f,
+                           -982.40f,   -155.12f,    971.52f,    -12.07f,
+                           -748.43f,    673.59f,    845.71f,   -929.21f,
+                           -868.35f,    796.24f,     99.67f,    349.24f) },
+    { simde_mm512_set_ps(   888.72f,    -64.79f,    -16.27f,    147.11f,
+                           -167.55f,    688.88f,   -417.11f,   -608.71f,
+                            764.52f,   -290.86f,    483.99f,    734.75f,
+                           -841.61f,    219.34f,   -805.74f,    -24.40f),
+      UINT16_C(0x7a5c),
+      simde_mm512_set_ps(    67.25f,    963.44f,   -482.29f,   -102.99f,
+                            279.46f,    331.18f,   -436.78f,   -546.54f,
+                           -707.75f,   -775.75f,    355.15f,    468.49f,
+                           -659.69f,   -274.86f,   -397.85f,    562.37f),
+      simde_mm512_set_ps(   888.72f,    963.44f,   -482.29f,   -102.99f,
+                            279.46f,    688.88f,   -436.78f,   -608.71f,
+                            764.52f,   -775.75f,    483.99f,    468.49f,
+                           -659.69f,   -274.86f,   -805.74f,    -24.40f) },
+    { simde_mm512_set_ps(   627.84f,    933.80f,    629.33f,   -494.39f,
+                            273.93f,    233.69f,   -446.26f,    612.12f,
+                           -692.54f,    400.93f,   -912.50f,    599.46f,
+                            998.34f,    686.70f,    115.05f,   -969.77f),
+      UINT16_C(0x3af4),
+      simde_mm512_set_ps(   134.89f,     64.32f,     43.98f,    852.03f,
+                            956.47f,   -575.18f,   -685.67f,    859.39f,
+                             90.87f,    858.24f,    213.65f,    337.42f,
+                            661.53f,   -126.28f,    190.54f,    347.16f),
+      simde_mm512_set_ps(   627.84f,    933.80f,     43.98f,    852.03f,
+                            956.47f,    233.69f,   -685.67f,    612.12f,
+                             90.87f,    858.24f,    213.65f,    337.42f,
+                            998.34f,   -126.28f,    115.05f,   -969.77f) },
+    { simde_mm512_set_ps(  -162.17f,   -644.59f,   -605.89f,    357.76f,
+                            738.63f,    732.13f,    485.25f,    612.27f,
+                           -591.95f,   -500.66f,    510.58f,    850.49f,
+                            782.84f,   -902.88f,    661.65f,   -342.03f),
+      UINT16_C(0xdbd5),
+      simde_mm512_set_ps(  -190.60f,    820.57f,    394.97f,   -213.41f,
+                            -97.79f,    480.02f,   -736.08f,   -990.47f,
+                           -398.41f,    152.94f,   -539.36f,    392.86f,
+                            817.18f,    753.65f,     12.97f,     99.13f),
+      simde_mm512_set_ps(  -190.60f,    820.57f,   -605.89f,   -213.41f,
+                            -97.79f,    732.13f,   -736.08f,   -990.47f,
+                           -398.41f,    152.94f,    510.58f,    392.86f,
+                            782.84f,    753.65f,    661.65f,     99.13f) },
+    { simde_mm512_set_ps(  -130.52f,    339.94f,   -828.46f,    297.57f,
+                           -260.64f,   -858.24f,   -921.45f,    952.88f,
+                           -736.93f,    933.35f,   -505.54f,   -358.26f,
+                            816.87f,    980.75f,   -956.99f,    116.22f),
+      UINT16_C(0xbfe6),
+      simde_mm512_set_ps(   807.90f,    301.66f,   -926.20f,   -700.93f,
+                           -957.37f,    942.21f,    500.78f,    142.51f,
+                            783.98f,    412.19f,    607.60f,   -942.55f,
+                           -608.27f,   -963.80f,    280.79f,   -407.32f),
+      simde_mm512_set_ps(   807.90f,    339.94f,   -926.20f,   -700.93f,
+                           -957.37f,    942.21f,    500.78f,    142.51f,
+                            783.98f,    412.19f,    607.60f,   -358.26f,
+                            816.87f,   -963.80f,    280.79f,    116.22f) },
+    { simde_mm512_set_ps(    84.93f,   -225.87f,   -260.92f,   -302.26f,
+                            313.01f,   -731.95f,    569.30f,    425.77f,
+                           -653.01f,    274.46f,   -368.39f,    348.89f,
+                            508.40f,    356.07f,    554.77f,   -340.69f),
+      UINT16_C(0x04c0),
+      simde_mm512_set_ps(   -57.85f,    909.76f,   -670.58f,    -26.19f,
+                            490.34f,    522.83f,   -830.83f,    -15.00f,
+                            283.19f,   -668.65f,     44.67f,   -275.14f,
+                           -951.95f,    377.74f,   -565.35f,   -386.81f),
+      simde_mm512_set_ps(    84.93f,   -225.87f,   -260.92f,   -302.26f,
+                            313.01f,    522.83f,    569.30f,    425.77f,
+                            283.19f,   -668.65f,   -368.39f,    348.89f,
+                            508.40f,    356.07f,    554.77f,   -340.69f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = test_vec[i].src;
+    simde_mm512_mask_storeu_ps((simde_float32*) &r, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_sub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d src;
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -179.35,    384.27,    346.62,   -538.42,
+                           -592.03,   -185.14,   -529.62,   -786.78),
+      UINT8_C(0x03),
+      simde_mm512_set_pd(   864.29,    106.26,    775.32,    584.56,
+                           -788.75,    391.26,   -310.60,    978.02),
+      simde_mm512_set_pd(   939.11,   -676.96,    521.24,    -20.78,
+                             77.33,   -939.24,    720.05,    745.61),
+      simde_mm512_set_pd(  -179.35,    384.27,    346.62,   -538.42,
+                           -592.03,   -185.14,  -1030.65,    232.41) },
+    { simde_mm512_set_pd(  -676.16,     95.70,     39.63,   -446.60,
+                             13.73,   -389.79,    361.00,    876.14),
+      UINT8_C(0xab),
+      simde_mm512_set_pd(  -599.55,      1.61,   -429.93,   -630.38,
+                           -872.71,   -517.76,    642.07,   -104.91),
+      simde_mm512_set_pd(   205.65,    597.92,    632.85,   -923.81,
+                            578.24,   -530.17,   -701.69,    776.75),
+      simde_mm512_set_pd(  -805.20,     95.70,  -1062.78,   -446.60,
+                          -1450.95,   -389.79,   1343.76,   -881.66) },
+    { simde_mm512_set_pd(  -354.69,    173.32,   -962.31,    215.94,
+                            366.28,   -558.07,   -972.10,    789.11),
+      UINT8_C(0x08),
+      simde_mm512_set_pd(  -151.88,    -33.35,    139.64,    -70.42,
+                            717.03,   -760.27,    812.62,    -83.42),
+      simde_mm512_set_pd(   128.72,   -168.50,    568.80,    475.90,
+                           -460.39,   -308.64,    803.48,    423.52),
+      simde_mm512_set_pd(  -354.69,    173.32,   -962.31,    215.94,
+                           1177.42,   -558.07,   -972.10,    789.11) },
+    { simde_mm512_set_pd(   -81.73,   -540.95,    646.78,    266.85,
+                            690.42,    612.77,    907.27,    235.91),
+      UINT8_C(0x71),
+      simde_mm512_set_pd(   169.67,    210.20,   -923.96,   -387.01,
+                            284.00,    -39.64,     57.73,    579.61),
+      simde_mm512_set_pd(  -873.64,   -471.39,   -722.17,    145.97,
+                             63.91,    726.00,   -382.58,    947.30),
+      simde_mm512_set_pd(   -81.73,    681.59,   -201.79,   -532.98,
+                            690.42,    612.77,    907.27,   -367.69) },
+    { simde_mm512_set_pd(   176.74,     -2.67,   -200.75,    942.32,
+                             83.15,   -540.37,    587.73,   -101.90),
+      UINT8_C(0xfd),
+      simde_mm512_set_pd(  -712.55,   -935.66,   -410.60,    735.51,
+                           -362.90,   -255.01,   -328.37,    884.53),
+      simde_mm512_set_pd(     3.25,    180.01,   -110.79,   -699.16,
+                           -690.28,   -368.45,    967.71,   -888.59),
+      simde_mm512_set_pd(  -715.80,  -1115.67,   -299.81,   1434.67,
+                            327.38,    113.44,    587.73,   1773.12) },
+    { simde_mm512_set_pd(  -587.32,   -424.06,    357.63,    842.36,
+                            465.01,    488.64,    321.63,    -45.47),
+      UINT8_C(0xd9),
+      simde_mm512_set_pd(  -590.18,    -53.96,   -885.44,   -529.98,
+                            919.51,   -835.70,    562.36,    779.32),
+      simde_mm512_set_pd(   821.61,    844.33,    536.61,   -320.59,
+                            766.34,    300.70,    640.64,   -785.37),
+      simde_mm512_set_pd( -1411.79,   -898.29,    357.63,   -209.39,
+                            153.17,    488.64,    321.63,   1564.69) },
+    { simde_mm512_set_pd(   -10.34,    195.12,   -690.67,     71.85,
+                           -726.07,    628.74,   -748.24,   -664.78),
+      UINT8_C(0xf2),
+      simde_mm512_set_pd(   378.24,   -583.99,     34.68,   -576.32,
+                            -43.09,    193.88,   -993.78,   -945.09),
+      simde_mm512_set_pd(  -246.36,   -926.05,   -283.36,    727.51,
+                           -691.62,    417.57,   -491.60,   -563.09),
+      simde_mm512_set_pd(   624.60,    342.06,    318.04,  -1303.83,
+                           -726.07,    628.74,   -502.18,   -664.78) },
+    { simde_mm512_set_pd(   723.81,   -281.21,    650.19,   -832.55,
+                           -220.76,    577.17,    734.52,   -669.90),
+      UINT8_C(0x14),
+      simde_mm512_set_pd(  -709.18,    -13.26,    626.04,   -642.30,
+                            744.81,   -725.30,     18.86,   -330.73),
+      simde_mm512_set_pd(   609.52,    663.77,   -329.48,   -671.60,
+                           -138.59,   -348.58,    628.12,    701.63),
+      simde_mm512_set_pd(   723.81,   -281.21,    650.19,     29.30,
+                           -220.76,   -376.72,    734.52,   -669.90) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_mask_sub_pd(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_add_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(0xe41d),
+      simde_mm512_set_epi32( -139377740,   657129729,  2004721430,   561801323,
+                             -881217721, -2006423242, -1628134991, -1926692439,
+                            -1374771019,  1195771988,  -596104155, -1040546784,
+                             -781049867, -1798457410, -1717139401,  -823111792),
+      simde_mm512_set_epi32( 1318257868,  -463761220,  -928118141,  1325247076,
+                             1049334912,  1531168886,   172392187,  1611379884,
+                              944915117,   933985864,  1098346332, -1602892942,
+                             1431579672,   464636889, -2035724044,  1309998463),
+      simde_mm512_set_epi32( 1178880128,   193368509,  1076603289,           0,
+                                      0,  -475254356,           0,           0,
+                                      0,           0,           0,  1651527570,
+                              650529805, -1333820521,           0,   486886671) },
+    { UINT16_C(0xc7b9),
+      simde_mm512_set_epi32(-1702744845,  1836130525, -1041390299,  1850232665,
+                            -1962416316,  -101000315, -1274339198,  1753821881,
+                              708482351,  -467773722,   317146121,   619449433,
+                              -79491200,   616423219,  1253289531,   166551473),
+      simde_mm512_set_epi32( -904077580,   -43771082, -1577824501,  -802716805,
+                             -518001600,  -784918140, -1773013459, -1437125943,
+                             2064802828, -1208453784, -1865789838,  1394512378,
+                            -1850322198, -1648986541, -1729388632, -2046533378),
+      simde_mm512_set_epi32( 1688144871,  1792359443,           0,           0,
+                                      0,  -885918455,  1247614639,   316695938,
+                            -1521682117,           0, -1548643717,  2013961811,
+                            -1929813398,           0,           0, -1879981905) },
+    { UINT16_C(0xe9d4),
+      simde_mm512_set_epi32( -660117517,  -449944527, -2094080503,  1056799123,
+                            -1242541241,  -357961525,  2123373507,  1547587514,
+                             1448308219,  1856743068,  1628111161,  1950857672,
+                             1264411980,  2069383759,  -617845047,  -293790980),
+      simde_mm512_set_epi32( -947846742,   798840659,  -660757099,   649910545,
+                             1796610639, -2010609889,  2012627225,  1124124467,
+                            -1601060488,  1132970466,  -240518305, -1278332970,
+                             -203564467, -1997125381,     7211343,  -211647813),
+      simde_mm512_set_epi32(-1607964259,   348896132,  1540129694,           0,
+                              554069398,           0,           0, -1623255315,
+                             -152752269, -1305253762,           0,   672524702,
+                                      0,    72258378,           0,           0) },
+    { UINT16_C(0x25c8),
+      simde_mm512_set_epi32( 1443689341,  1356545760,  1679173409,   767496988,
+                               98876069,  -486629395,  -146016069, -1398725314,
+                             1503070753,   334879311,  1737064234,   550510258,
+                             -109725088,  -755091777, -1162800652,  -547819457),
+      simde_mm512_set_epi32(   12117664,   686200209,    15233498, -1898876437,
+                              690872701,  -841782445,  -475565369,  -424398974,
+                              709884416,   449010893,  1741339718,  -660523841,
+                            -2104388432,  -762870172,  -683435573,  -856269884),
+      simde_mm512_set_epi32(          0,           0,  1694406907,           0,
+                                      0, -1328411840,           0, -1823124288,
+                            -2082012127,   783890204,           0,           0,
+                             2080853776,           0,           0,           0) },
+    { UINT16_C(0xefaa),
+      simde_mm512_set_epi32( 1496869133,  -961612415,  -547737288,  -242964327,
+                             1485208887,  -396837171,  -436304217,  1752935277,
+                             1204325914,  -558347117,  1178424249,   404393836,
+                            -1613151814,  -266274234, -1771397336,  -623852754),
+      simde_mm512_set_epi32( 1139999951,  1605000601,   816408651,  -404898397,
+                             -732899395, -1384368077,   -16328069,  -548939025,
+                            -1892808142,  -481024450, -1662333145,  2023638985,
+                             2146915585,   709653412, -1485490400,  1019284567),
+      simde_mm512_set_epi32(-1658098212,   643388186,   268671363,           0,
+                              752309492, -1781205248,  -452632286,  1203996252,
+                             -688482228,           0,  -483908896,           0,
+                              533763771,           0,  1038079560,           0) },
+    { UINT16_C(0x5015),
+      simde_mm512_set_epi32(  263795733,   535699117,  -207350834,  -724884536,
+                             2067042107,  -497576848, -1781458343,  1396820921,
+                             1459863058,  1073512762,   762779956, -1101121351,
+                                 -86285, -1877331547,  1562485193,  -995032373),
+      simde_mm512_set_epi32( 1979766090,  -729871501,   310172606,  1527406599,
+                                5658345,  -486001935, -1340387529, -1071697604,
+                             -506192668,  1403743607, -1083056610,  -646802682,
+                            -1011304930, -1529962021,    21876735, -1644684083),
+      simde_mm512_set_epi32(          0,  -194172384,           0,   802522063,
+                                      0,           0,           0,           0,
+                                      0,           0,           0, -1747924033,
+                                      0,   887673728,           0,  1655250840) },
+    { UINT16_C(0x16b1),
+      simde_mm512_set_epi32(  713404361,   840689034, -1113765689, -1943773598,
+                             1283837268, -1556673907,  -304727835,  2024030733,
+                             1474496002,     7626556, -1270757910,   193820010,
+                            -1144388726, -1021729446,  -815399259,  1149566280),
+      simde_mm512_set_epi32( -834429931, -1402447447, -1916432482,   911881396,
+                             1895674269,  1940242217,  -121143791,  1683100840,
+                             -455669834, -1117662342,  -590165152, -1321901784,
+                             1978479432, -1204616090,  1225045139,  1663147886),
+      simde_mm512_set_epi32(          0,           0,           0, -1031892202,
+                                      0,   383568310,  -425871626,           0,
+                             1018826168,           0, -1860923062, -1128081774,
+                                      0,           0,           0, -1482253130) },
+    { UINT16_C(0xa948),
+      simde_mm512_set_epi32(  758321487, -1517349489,   909025737,   179528990,
+                              282616300,  -813050630,  1218205922,  -767098594,
+                              212081709,  1508870198,  2070965471, -1888578660,
+                             -219727477,  -958409457, -1910898353, -1709047306),
+      simde_mm512_set_epi32( 1363800104, -2127122310,   345433995,  2037449533,
+                              246739191, -1594834941,   108451697, -2122422097,
+                             1220714650,  1934256381,  -761947132, -1694651633,
+                            -1855472919, -2070105175, -2058083627, -1116630320),
+      simde_mm512_set_epi32( 2122121591,           0,  1254459732,           0,
+                              529355491,           0,           0,  1405446605,
+                                      0,  -851840717,           0,           0,
+                            -2075200396,           0,           0,           0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_add_epi32(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_add_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { UINT8_C(0x59),
+      simde_mm512_set_pd(     0.48,    386.89,    548.47,   -148.67,
+                            735.63,    850.46,    892.18,   -893.85),
+      simde_mm512_set_pd(   191.50,     48.31,    803.96,    686.26,
+                            687.84,    333.68,   -243.75,    742.58),
+      simde_mm512_set_pd(     0.00,    435.20,      0.00,    537.59,
+                           1423.47,      0.00,      0.00,   -151.27) },
+    { UINT8_C(0x96),
+      simde_mm512_set_pd(   946.10,   -575.14,    477.53,    545.11,
+                           -271.11,    710.27,    755.56,   -401.38),
+      simde_mm512_set_pd(   -41.02,   -108.23,   -927.82,    401.73,
+                             20.48,    847.32,   -955.10,   -245.93),
+      simde_mm512_set_pd(   905.08,      0.00,      0.00,    946.84,
+                              0.00,   1557.59,   -199.54,      0.00) },
+    { UINT8_C(0xea),
+      simde_mm512_set_pd(   488.17,    -37.59,    719.73,   -174.92,
+                           -839.81,    550.93,   -725.38,   -577.28),
+      simde_mm512_set_pd(   991.32,    421.96,   -178.90,   -981.00,
+                           -773.17,   -832.59,     61.18,   -183.90),
+      simde_mm512_set_pd(  1479.49,    384.37,    540.83,      0.00,
+                          -1612.98,      0.00,   -664.20,      0.00) },
+    { UINT8_C(0x36),
+      simde_mm512_set_pd(  -628.08,   -198.87,    672.90,    -64.57,
+                            423.78,    468.40,    993.00,    479.46),
+      simde_mm512_set_pd(  -424.56,   -806.87,   -534.08,    397.61,
+                           -136.04,   -772.87,   -494.63,    957.93),
+      simde_mm512_set_pd(     0.00,      0.00,    138.82,    333.04,
+                              0.00,   -304.47,    498.37,      0.00) },
+    { UINT8_C(0xc3),
+      simde_mm512_set_pd(   126.75,    -71.29,   -180.81,   -404.80,
+                           -832.81,    268.21,   -159.18,   -233.75),
+      simde_mm512_set_pd(  -875.95,     15.65,   -882.92,   -989.71,
+                            213.09,   -307.78,    150.81,   -811.48),
+      simde_mm512_set_pd(  -749.20,    -55.64,      0.00,      0.00,
+                              0.00,      0.00,     -8.37,  -1045.23) },
+    { UINT8_C(0x9e),
+      simde_mm512_set_pd(  -699.63,    970.43,    846.74,    756.18,
+                            639.65,   -658.84,   -299.79,    863.54),
+      simde_mm512_set_pd(   918.82,   -840.58,    842.23,    349.58,
+                           -741.82,    559.23,   -638.75,    102.57),
+      simde_mm512_set_pd(   219.19,      0.00,      0.00,   1105.76,
+                           -102.17,    -99.61,   -938.54,      0.00) },
+    { UINT8_C(0x62),
+      simde_mm512_set_pd(   977.46,    464.71,    472.53,    553.48,
+                            948.60,   -157.49,   -492.69,    148.85),
+      simde_mm512_set_pd(     3.77,   -233.47,   -398.80,    910.96,
+                            838.85,   -359.79,    962.68,   -804.44),
+      simde_mm512_set_pd(     0.00,    231.24,     73.73,      0.00,
+                              0.00,      0.00,    469.99,      0.00) },
+    { UINT8_C(0x7e),
+      simde_mm512_set_pd(   145.57,   -709.75,    708.17,   -603.61,
+                           -911.46,   -438.92,    317.70,    536.53),
+      simde_mm512_set_pd(  -374.18,    605.81,   -605.07,   -400.69,
+                            808.50,   -428.88,    -23.30,   -774.56),
+      simde_mm512_set_pd(     0.00,   -103.94,    103.10,  -1004.30,
+                           -102.96,   -867.80,    294.40,      0.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_maskz_add_pd(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_add_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { UINT16_C(0x5332),
+      simde_mm512_set_ps(   185.89f,    888.93f,    -96.56f,    468.09f,
+                            898.42f,    835.11f,   -982.23f,   -677.24f,
+                            845.26f,   -869.90f,    154.17f,   -639.42f,
+                           -341.04f,   -405.30f,    172.23f,   -120.67f),
+      simde_mm512_set_ps(   298.35f,    537.69f,    561.54f,   -328.65f,
+                            602.47f,    245.59f,    980.21f,   -625.53f,
+                            168.69f,    134.29f,    138.13f,    496.62f,
+                           -831.93f,   -184.12f,    387.72f,    808.03f),
+      simde_mm512_set_ps(     0.00f,   1426.62f,      0.00f,    139.44f,
+                              0.00f,      0.00f,     -2.02f,  -1302.77f,
+                              0.00f,      0.00f,    292.30f,   -142.80f,
+                              0.00f,      0.00f,    559.95f,      0.00f) },
+    { UINT16_C(0x385c),
+      simde_mm512_set_ps(   928.31f,    -26.49f,     -2.08f,    -23.93f,
+                            528.93f,    130.39f,   -695.70f,    390.73f,
+                           -572.37f,    863.53f,   -323.61f,    789.33f,
+                            -72.21f,   -941.85f,    -59.72f,   -347.22f),
+      simde_mm512_set_ps(  -856.96f,   -228.42f,    281.97f,    696.51f,
+                           -247.77f,   -409.59f,    521.39f,   -847.30f,
+                            513.44f,    753.92f,    807.87f,    961.81f,
+                           -297.53f,   -887.93f,   -239.33f,    695.86f),
+      simde_mm512_set_ps(     0.00f,      0.00f,    279.89f,    672.58f,
+                            281.16f,      0.00f,      0.00f,      0.00f,
+                              0.00f,   1617.45f,      0.00f,   1751.14f,
+                           -369.74f,  -1829.78f,      0.00f,      0.00f) },
+    { UINT16_C(0xc83f),
+      simde_mm512_set_ps(   -48.52f,    718.46f,    868.71f,   -912.67f,
+                              8.63f,   -946.12f,    526.56f,     -5.42f,
+                           -803.44f,    171.39f,    685.36f,   -128.82f,
+                            955.84f,    -19.74f,    760.95f,    597.57f),
+      simde_mm512_set_ps(   358.81f,   -884.83f,   -720.32f,    677.03f,
+                           -261.95f,    712.36f,    302.70f,    218.89f,
+                           -413.21f,   -849.67f,    611.26f,    996.84f,
+                           -446.97f,    610.54f,   -198.69f,   -373.64f),
+      simde_mm512_set_ps(   310.29f,   -166.37f,      0.00f,      0.00f,
+                           -253.32f,      0.00f,      0.00f,      0.00f,
+                              0.00f,      0.00f,   1296.62f,    868.02f,
+                            508.87f,    590.80f,    562.26f,    223.93f) },
+    { UINT16_C(0xa94b),
+      simde_mm512_set_ps(  -129.45f,   -739.37f,    429.63f,    632.15f,
+                            380.84f,   -749.11f,   -153.35f,   -691.29f,
+                            853.01f,   -126.60f,    929.46f,     -7.14f,
+                            472.75f,   -187.61f,   -325.09f,   -167.75f),
+      simde_mm512_set_ps(   290.58f,    553.96f,   -652.36f,   -938.63f,
+                           -239.22f,   -180.13f,   -718.99f,   -280.11f,
+                           -461.94f,   -562.91f,     39.68f,    -99.94f,
+                           -761.92f,    455.42f,   -272.65f,     33.59f),
+      simde_mm512_set_ps(   161.13f,      0.00f,   -222.73f,      0.00f,
+                            141.62f,      0.00f,      0.00f,   -971.40f,
+                              0.00f,   -689.51f,      0.00f,      0.00f,
+                           -289.17f,      0.00f,   -597.74f,   -134.16f) },
+    { UINT16_C(0x3595),
+      simde_mm512_set_ps(  -630.61f,   -275.04f,   -394.67f,   -171.15f,
+                            -93.43f,     -9.46f,    774.45f,   -922.01f,
+                            672.70f,    997.17f,    363.76f,    363.06f,
+                            825.25f,    501.47f,   -487.24f,   -298.66f),
+      simde_mm512_set_ps(   872.02f,    269.35f,    532.38f,   -147.45f,
+                            402.20f,   -965.79f,   -333.98f,    736.18f,
+                           -606.91f,    342.72f,    342.22f,     11.25f,
+                            710.39f,    325.44f,   -717.61f,   -285.06f),
+      simde_mm512_set_ps(     0.00f,      0.00f,    137.71f,   -318.60f,
+                              0.00f,   -975.25f,      0.00f,   -185.83f,
+                             65.79f,      0.00f,      0.00f,    374.31f,
+                              0.00f,    826.91f,      0.00f,   -583.72f) },
+    { UINT16_C(0xa76a),
+      simde_mm512_set_ps(   844.27f,   -967.21f,    -10.18f,    637.21f,
+                           -265.17f,   -926.84f,   -756.41f,   -716.52f,
+                           -267.32f,    226.67f,    -41.22f,     95.09f,
+                            844.07f,   -115.13f,   -449.23f,    270.08f),
+      simde_mm512_set_ps(    33.44f,    770.56f,   -578.96f,    712.35f,
+                             54.41f,    526.33f,    620.23f,    861.89f,
+                            -58.73f,    383.67f,    816.20f,    404.35f,
+                           -695.44f,   -752.78f,    734.25f,    -90.41f),
+      simde_mm512_set_ps(   877.71f,      0.00f,   -589.14f,      0.00f,
+                              0.00f,   -400.51f,   -136.18f,    145.37f,
+                              0.00f,    610.34f,    774.98f,      0.00f,
+                            148.63f,      0.00f,    285.02f,      0.00f) },
+    { UINT16_C(0x9935),
+      simde_mm512_set_ps(   243.84f,    103.31f,   -150.65f,    810.53f,
+                           -268.12f,   -117.28f,    701.63f,     -4.48f,
+                           -222.96f,   -451.30f,    -90.02f,    420.92f,
+                           -107.42f,   -451.28f,   -220.02f,   -380.72f),
+      simde_mm512_set_ps(   -99.17f,   -956.19f,   -331.77f,    279.04f,
+                            956.01f,   -890.85f,   -521.48f,   -268.79f,
+                            921.58f,   -625.21f,    909.68f,    -87.11f,
+                           -279.45f,   -327.49f,   -161.89f,   -975.86f),
+      simde_mm512_set_ps(   144.67f,      0.00f,      0.00f,   1089.57f,
+                            687.89f,      0.00f,      0.00f,   -273.27f,
+                              0.00f,      0.00f,    819.66f,    333.81f,
+                              0.00f,   -778.77f,      0.00f,  -1356.58f) },
+    { UINT16_C(0x7f79),
+      simde_mm512_set_ps(   310.50f,    860.94f,     69.91f,   -775.06f,
+                            310.57f,    854.49f,   -710.89f,    187.86f,
+                           -960.03f,   -598.65f,    685.97f,      1.01f,
+                             79.10f,    -99.36f,   -411.16f,   -809.74f),
+      simde_mm512_set_ps(   637.45f,   -689.83f,    191.26f,   -820.98f,
+                           -431.55f,    792.05f,   -487.28f,   -370.59f,
+                           -625.29f,   -149.08f,     39.43f,    -20.04f,
+                           -950.38f,    297.95f,     46.13f,   -917.15f),
+      simde_mm512_set_ps(     0.00f,    171.11f,    261.17f,  -1596.04f,
+                           -120.98f,   1646.54f,  -1198.17f,   -182.73f,
+                              0.00f,   -747.73f,    725.40f,    -19.03f,
+                           -871.28f,      0.00f,      0.00f,  -1726.89f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_maskz_add_ps(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_compress_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(0x3562),
+      simde_mm512_set_epi32(-1278560700, -1510316403,  1379398407,  2102747623,
+                            -1349978049,  1538525967,   658276228,   207505227,
+                               26398131, -1554138074, -1745835342, -1170167525,
+                              496859987,  1698030903,   866774568,   351669045),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0,
+                                      0,  1379398407,  2102747623,  1538525967,
+                              207505227, -1554138074, -1745835342,   866774568) },
+    { UINT16_C(0xd20a),
+      simde_mm512_set_epi32(-2021106510, -1631810501,  1418267815,  1570249895,
+                             -949267815,  -961851294,  -514719873,  1869010060,
+                             2052253836,  1688029598, -1205273572,   931387587,
+                             1256418937,  1399021528,  1712759731,  1667508222),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0,
+                                      0,           0, -2021106510, -1631810501,
+                             1570249895,  -514719873,  1256418937,  1712759731) },
+    { UINT16_C(0x79c3),
+      simde_mm512_set_epi32( 1853782007,   -66836922,   744526759,  -808619790,
+                             1082255247,  -413058256, -1545876760,  1872247385,
+                              675519348,   394557271,  1928206671,  2078139560,
+                              -30275272,   851518371,  1924311453, -1122264150),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,   -66836922,
+                              744526759,  -808619790,  1082255247,  1872247385,
+                              675519348,   394557271,  1924311453, -1122264150) },
+    { UINT16_C(0x0d79),
+      simde_mm512_set_epi32( 1120998307,   538206842,  -914358104,  -613041359,
+                             -974990436,  1178959507,    46123020,   310529015,
+                             -463203352,  -516719565,  -579687458,  2056310558,
+                             1555388312,  1605924073, -2090698414,  -152679255),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0,
+                             -974990436,  1178959507,   310529015,  -516719565,
+                             -579687458,  2056310558,  1555388312,  -152679255) },
+    { UINT16_C(0x9bc9),
+      simde_mm512_set_epi32(-1037539631,  -642500485, -1935393123,   323338036,
+                              -93826524,   484516214,  -249212192,  -568250917,
+                             2122282392, -1245313417,  -497840676,  1226886909,
+                             -596179147,     9538632,  -426490135, -1561047438),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0, -1037539631,
+                              323338036,   -93826524,  -249212192,  -568250917,
+                             2122282392, -1245313417,  -596179147, -1561047438) },
+    { UINT16_C(0xb9b9),
+      simde_mm512_set_epi32(-1655325063,  1742904494, -2107724544, -1847934145,
+                            -1433489493,  -743536627,  1022837452,   755842503,
+                            -1054987989,  -590491367,   264478908,  -722913299,
+                            -1558331954, -1562623106,   561855705, -1216333211),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                                      0,           0, -1655325063, -2107724544,
+                            -1847934145, -1433489493,   755842503, -1054987989,
+                              264478908,  -722913299, -1558331954, -1216333211) },
+    { UINT16_C(0x6018),
+      simde_mm512_set_epi32( -987691786,  -378147076,   535194343,  -525188838,
+                            -1435515439,  -898215909,   257775893, -1273517726,
+                            -1710516800,  -783843966,   348284232,  1671771117,
+                            -1359268930,   394903542,   182420894, -1931036391),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                                      0,           0,           0,           0,
+                                      0,           0,           0,           0,
+                             -378147076,   535194343,  1671771117, -1359268930) },
+    { UINT16_C(0x65bf),
+      simde_mm512_set_epi32(-1992185677, -1971611604,  1672699939,  1892457514,
+                              448596673, -1448752285,   214389946,  -748055700,
+                             -463091552,  1837840052, -2146045440,  -229839152,
+                             -135602415,   242721113, -1732769026,  -637015473),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                                      0, -1971611604,  1672699939, -1448752285,
+                             -748055700,  -463091552, -2146045440,  -229839152,
+                             -135602415,   242721113, -1732769026,  -637015473) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_compress_epi32(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_compress_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { UINT8_C(0x95),
+      simde_mm512_set_pd(  -712.00,    386.57,    384.54,    299.43,
+                            526.85,    -13.54,   -347.02,      2.96),
+      simde_mm512_set_pd(     0.00,      0.00,      0.00,      0.00,
+                           -712.00,    299.43,    -13.54,      2.96) },
+    { UINT8_C(0x8b),
+      simde_mm512_set_pd(   248.39,   -621.79,   -155.56,   -209.43,
+                            826.05,    507.06,   -566.02,    100.89),
+      simde_mm512_set_pd(     0.00,      0.00,      0.00,      0.00,
+                            248.39,    826.05,   -566.02,    100.89) },
+    { UINT8_C(0x58),
+      simde_mm512_set_pd(  -264.46,   -350.87,    652.45,    413.32,
+                            287.67,    164.37,    670.88,    479.48),
+      simde_mm512_set_pd(     0.00,      0.00,      0.00,      0.00,
+                              0.00,   -350.87,    413.32,    287.67) },
+    { UINT8_C(0x0b),
+      simde_mm512_set_pd(  -106.27,    395.14,   -171.68,    815.82,
+                            842.44,   -550.38,    891.42,    101.97),
+      simde_mm512_set_pd(     0.00,      0.00,      0.00,      0.00,
+                              0.00,    842.44,    891.42,    101.97) },
+    { UINT8_C(0xe7),
+      simde_mm512_set_pd(   130.78,   -184.93,    709.82,    616.94,
+                           -178.48,    -41.29,   -652.33,   -468.78),
+      simde_mm512_set_pd(     0.00,      0.00,    130.78,   -184.93,
+                            709.82,    -41.29,   -652.33,   -468.78) },
+    { UINT8_C(0x9a),
+      simde_mm512_set_pd(   459.86,   -219.32,    110.79,     -4.69,
+                           -285.96,    -86.73,   -480.70,   -733.41),
+      simde_mm512_set_pd(     0.00,      0.00,      0.00,      0.00,
+                            459.86,     -4.69,   -285.96,   -480.70) },
+    { UINT8_C(0x3a),
+      simde_mm512_set_pd(   106.98,   -250.53,    959.12,    414.97,
+                            711.25,    543.64,    168.83,   -256.72),
+      simde_mm512_set_pd(     0.00,      0.00,      0.00,      0.00,
+                            959.12,    414.97,    711.25,    168.83) },
+    { UINT8_C(0xc2),
+      simde_mm512_set_pd(   639.34,   -592.27,   -556.72,   -406.34,
+                            710.31,   -747.56,    561.17,    694.37),
+      simde_mm512_set_pd(     0.00,      0.00,      0.00,      0.00,
+                              0.00,    639.34,   -592.27,    561.17) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_maskz_compress_pd(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_expand_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(0x3a),
+      simde_mm512_set_epi64(INT64_C(-1364501361098792957), INT64_C(-4883472262847769097),
+                            INT64_C(-1527177203775296454), INT64_C( 9122828159984634636),
+                            INT64_C( 3587758886649155901), INT64_C(-3979735836352617662),
+                            INT64_C(-6817217926479273230), INT64_C(-6175940661672266779)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 3587758886649155901), INT64_C(-3979735836352617662),
+                            INT64_C(-6817217926479273230), INT64_C(                   0),
+                            INT64_C(-6175940661672266779), INT64_C(                   0)) },
+    { UINT8_C(0xde),
+      simde_mm512_set_epi64(INT64_C(-8189751884073700978), INT64_C( 8256673779044900687),
+                            INT64_C(-5100326849686572262), INT64_C(-8537033548536227485),
+                            INT64_C( 5414310369726196003), INT64_C( 9021326145838144091),
+                            INT64_C(-8932751215642448742), INT64_C(-5395580939235059909)),
+      simde_mm512_set_epi64(INT64_C(-5100326849686572262), INT64_C(-8537033548536227485),
+                            INT64_C(                   0), INT64_C( 5414310369726196003),
+                            INT64_C( 9021326145838144091), INT64_C(-8932751215642448742),
+                            INT64_C(-5395580939235059909), INT64_C(                   0)) },
+    { UINT8_C(0xf8),
+      simde_mm512_set_epi64(INT64_C(-3950230099682616111), INT64_C(-5102647161351714795),
+                            INT64_C(-4931966606732335854), INT64_C( 2437620225014921117),
+                            INT64_C( 2119061848393177077), INT64_C(-1033899043407490259),
+                            INT64_C(  651938672160626937), INT64_C( 5183415850633362004)),
+      simde_mm512_set_epi64(INT64_C( 2437620225014921117), INT64_C( 2119061848393177077),
+                            INT64_C(-1033899043407490259), INT64_C(  651938672160626937),
+                            INT64_C( 5183415850633362004), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(0x3b),
+      simde_mm512_set_epi64(INT64_C(-3960665127499172516), INT64_C( 1782164781068249475),
+                            INT64_C(-3511656694957992780), INT64_C(-5819007533055464288),
+                            INT64_C(-4118982102829861330), INT64_C(-6980923224656829832),
+                            INT64_C(-1101086798651901557), INT64_C( -500294609580267518)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(-5819007533055464288), INT64_C(-4118982102829861330),
+                            INT64_C(-6980923224656829832), INT64_C(                   0),
+                            INT64_C(-1101086798651901557), INT64_C( -500294609580267518)) },
+    { UINT8_C(0xca),
+      simde_mm512_set_epi64(INT64_C(-1394452441778804721), INT64_C( 9141293135546341388),
+                            INT64_C( 7248245846004635245), INT64_C( 6225254318695129809),
+                            INT64_C( 1876246840127448515), INT64_C( 7456030562438814612),
+                            INT64_C( 8220020167494774542), INT64_C( 6031059172566432600)),
+      simde_mm512_set_epi64(INT64_C( 1876246840127448515), INT64_C( 7456030562438814612),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 8220020167494774542), INT64_C(                   0),
+                            INT64_C( 6031059172566432600), INT64_C(                   0)) },
+    { UINT8_C(0x4a),
+      simde_mm512_set_epi64(INT64_C( 8320524021971877193), INT64_C( 7662290900056458491),
+                            INT64_C( 3602909761502190676), INT64_C( 7745765256555760694),
+                            INT64_C( 8997619344501756581), INT64_C( 4611630759572680080),
+                            INT64_C(-1721325513265157975), INT64_C(-9152713138170240324)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C( 4611630759572680080),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(-1721325513265157975), INT64_C(                   0),
+                            INT64_C(-9152713138170240324), INT64_C(                   0)) },
+    { UINT8_C(0xf1),
+      simde_mm512_set_epi64(INT64_C( -127329170019404856), INT64_C( 7864991736954393345),
+                            INT64_C(  169827792524783673), INT64_C( 4384711073333419409),
+                            INT64_C(-7248579974940311513), INT64_C(-9171578363016156874),
+                            INT64_C(-5623954203292193619), INT64_C( 8433346605396182980)),
+      simde_mm512_set_epi64(INT64_C( 4384711073333419409), INT64_C(-7248579974940311513),
+                            INT64_C(-9171578363016156874), INT64_C(-5623954203292193619),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( 8433346605396182980)) },
+    { UINT8_C(0x56),
+      simde_mm512_set_epi64(INT64_C(-6525554514568850968), INT64_C( 1193666641171128627),
+                            INT64_C(-3469281977000464766), INT64_C( 5456809212693734592),
+                            INT64_C(-1546774659814798094), INT64_C(-5668515236471974348),
+                            INT64_C( 2846645803112473331), INT64_C( 2111450274081582536)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(-1546774659814798094),
+                            INT64_C(                   0), INT64_C(-5668515236471974348),
+                            INT64_C(                   0), INT64_C( 2846645803112473331),
+                            INT64_C( 2111450274081582536), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_expand_epi64(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_expand_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 r;
+  } test_vec[8] = {
+    { UINT16_C(0xc1e2),
+      simde_mm512_set_ps(  -400.69f,   -911.46f,   -438.92f,    317.70f,
+                            536.53f,    145.57f,   -709.75f,    708.17f,
+                            172.80f,    808.50f,   -428.88f,    -23.30f,
+                           -774.56f,   -374.18f,    605.81f,   -605.07f),
+      simde_mm512_set_ps(   808.50f,   -428.88f,      0.00f,      0.00f,
+                              0.00f,      0.00f,      0.00f,    -23.30f,
+                           -774.56f,   -374.18f,    605.81f,      0.00f,
+                              0.00f,      0.00f,   -605.07f,      0.00f) },
+    { UINT16_C(0xa96d),
+      simde_mm512_set_ps(  -799.02f,   -102.95f,   -184.47f,   -279.49f,
+                            310.07f,   -654.34f,    552.32f,   -788.29f,
+                            342.70f,    185.15f,    622.63f,    992.04f,
+                            -25.07f,    382.89f,    124.56f,    415.69f),
+      simde_mm512_set_ps(  -788.29f,      0.00f,    342.70f,      0.00f,
+                            185.15f,      0.00f,      0.00f,    622.63f,
+                              0.00f,    992.04f,    -25.07f,      0.00f,
+                            382.89f,    124.56f,      0.00f,    415.69f) },
+    { UINT16_C(0x362f),
+      simde_mm512_set_ps(  -236.13f,   -240.91f,   -169.25f,   -704.58f,
+                            269.39f,   -297.77f,    423.58f,    822.53f,
+                            257.07f,   -990.61f,     22.51f,     58.10f,
+                            914.35f,    -20.08f,   -709.12f,   -166.45f),
+      simde_mm512_set_ps(     0.00f,      0.00f,    822.53f,    257.07f,
+                              0.00f,   -990.61f,     22.51f,      0.00f,
+                              0.00f,      0.00f,     58.10f,      0.00f,
+                            914.35f,    -20.08f,   -709.12f,   -166.45f) },
+    { UINT16_C(0x52bb),
+      simde_mm512_set_ps(  -590.92f,   -321.72f,    257.83f,   -864.68f,
+                           -611.78f,   -662.90f,    884.25f,   -391.28f,
+                           -240.60f,    739.10f,   -144.16f,   -331.20f,
+                            468.46f,   -655.30f,    511.12f,    878.39f),
+      simde_mm512_set_ps(     0.00f,   -391.28f,      0.00f,   -240.60f,
+                              0.00f,      0.00f,    739.10f,      0.00f,
+                           -144.16f,      0.00f,   -331.20f,    468.46f,
+                           -655.30f,      0.00f,    511.12f,    878.39f) },
+    { UINT16_C(0xcc6b),
+      simde_mm512_set_ps(   560.22f,   -479.40f,    216.09f,    229.50f,
+                           -909.98f,   -359.51f,   -847.47f,     78.12f,
+                            618.32f,   -544.75f,    274.65f,   -210.51f,
+                            507.27f,    173.74f,    456.57f,   -358.46f),
+      simde_mm512_set_ps(    78.12f,    618.32f,      0.00f,      0.00f,
+                           -544.75f,    274.65f,      0.00f,      0.00f,
+                              0.00f,   -210.51f,    507.27f,      0.00f,
+                            173.74f,      0.00f,    456.57f,   -358.46f) },
+    { UINT16_C(0xb52d),
+      simde_mm512_set_ps(  -540.02f,     49.53f,   -411.65f,    244.67f,
+                            878.27f,   -785.92f,   -148.14f,   -391.77f,
+                           -452.32f,    778.83f,    605.63f,   -416.44f,
+                            266.02f,    740.86f,    790.05f,      3.68f),
+      simde_mm512_set_ps(  -391.77f,      0.00f,   -452.32f,    778.83f,
+                              0.00f,    605.63f,      0.00f,   -416.44f,
+                              0.00f,      0.00f,    266.02f,      0.00f,
+                            740.86f,    790.05f,      0.00f,      3.68f) },
+    { UINT16_C(0x6c5d),
+      simde_mm512_set_ps(  -462.68f,    881.29f,    688.89f,   -937.13f,
+                            807.51f,   -920.19f,    686.33f,    665.35f,
+                           -206.08f,   -981.70f,    386.74f,      8.51f,
+                           -942.12f,    119.56f,   -771.48f,   -133.09f),
+      simde_mm512_set_ps(     0.00f,    665.35f,   -206.08f,      0.00f,
+                           -981.70f,    386.74f,      0.00f,      0.00f,
+                              0.00f,      8.51f,      0.00f,   -942.12f,
+                            119.56f,   -771.48f,      0.00f,   -133.09f) },
+    { UINT16_C(0xa1ba),
+      simde_mm512_set_ps(  -864.05f,   -967.17f,   -655.72f,    977.46f,
+                           -800.94f,    817.75f,    652.21f,    178.84f,
+                           -401.51f,    422.09f,    946.10f,   -670.47f,
+                           -649.93f,    938.95f,    553.28f,    548.76f),
+      simde_mm512_set_ps(  -401.51f,      0.00f,    422.09f,      0.00f,
+                              0.00f,      0.00f,      0.00f,    946.10f,
+                           -670.47f,      0.00f,   -649.93f,    938.95f,
+                            553.28f,      0.00f,    548.76f,      0.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_maskz_expand_ps(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_expandloadu_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 r;
+  } test_vec[8] = {
+    { UINT16_C(0xe4e1),
+      simde_mm512_set_ps(   784.30f,    181.01f,    681.12f,     48.42f,
+                           -913.91f,    345.06f,   -688.67f,    879.99f,
+                           -870.52f,   -441.17f,   -673.22f,   -514.83f,
+                            662.40f,    -10.29f,    803.65f,     97.32f),
+      simde_mm512_set_ps(  -870.52f,   -441.17f,   -673.22f,      0.00f,
+                              0.00f,   -514.83f,      0.00f,      0.00f,
+                            662.40f,    -10.29f,    803.65f,      0.00f,
+                              0.00f,      0.00f,      0.00f,     97.32f) },
+    { UINT16_C(0x3330),
+      simde_mm512_set_ps(   -19.10f,   -490.35f,   -826.17f,    437.39f,
+                           -512.36f,   -982.93f,   -624.75f,    -77.07f,
+                             16.81f,   -232.29f,    -98.84f,   -130.25f,
+                           -248.64f,    637.23f,   -283.99f,    948.32f),
+      simde_mm512_set_ps(     0.00f,      0.00f,    -98.84f,   -130.25f,
+                              0.00f,      0.00f,   -248.64f,    637.23f,
+                              0.00f,      0.00f,   -283.99f,    948.32f,
+                              0.00f,      0.00f,      0.00f,      0.00f) },
+    { UINT16_C(0x74a6),
+      simde_mm512_set_ps(  -528.39f,   -407.95f,    864.03f,   -218.92f,
+                           -995.24f,    -42.52f,    980.01f,   -884.30f,
+                            367.77f,    424.52f,   -108.02f,    434.59f,
+                            425.88f,    487.93f,    655.95f,    322.69f),
+      simde_mm512_set_ps(     0.00f,    367.77f,    424.52f,   -108.02f,
+                              0.00f,    434.59f,      0.00f,      0.00f,
+                            425.88f,      0.00f,    487.93f,      0.00f,
+                              0.00f,    655.95f,    322.69f,      0.00f) },
+    { UINT16_C(0x3b4a),
+      simde_mm512_set_ps(   419.57f,    255.69f,    954.05f,   -160.84f,
+                            473.63f,    902.10f,    231.53f,   -601.00f,
+                            474.06f,    874.58f,    917.82f,   -967.21f,
+                           -870.56f,     20.76f,   -480.51f,    396.88f),
+      simde_mm512_set_ps(     0.00f,      0.00f,    474.06f,    874.58f,
+                            917.82f,      0.00f,   -967.21f,   -870.56f,
+                              0.00f,     20.76f,      0.00f,      0.00f,
+                           -480.51f,      0.00f,    396.88f,      0.00f) },
+    { UINT16_C(0xe76b),
+      simde_mm512_set_ps(   146.91f,   -645.39f,   -239.53f,   -295.46f,
+                            763.93f,   -681.95f,   -150.67f,   -491.01f,
+                           -282.57f,    114.00f,      5.02f,    244.46f,
+                           -641.84f,   -455.79f,   -913.11f,    675.77f),
+      simde_mm512_set_ps(  -681.95f,   -150.67f,   -491.01f,      0.00f,
+                              0.00f,   -282.57f,    114.00f,      5.02f,
+                              0.00f,    244.46f,   -641.84f,      0.00f,
+                           -455.79f,      0.00f,   -913.11f,    675.77f) },
+    { UINT16_C(0x7953),
+      simde_mm512_set_ps(   283.25f,   -193.11f,    177.06f,   -416.08f,
+                             92.30f,   -898.60f,   -407.92f,   -798.62f,
+                            -86.06f,     44.24f,    973.25f,    612.67f,
+                           -875.90f,    595.96f,    813.96f,   -484.62f),
+      simde_mm512_set_ps(     0.00f,   -798.62f,    -86.06f,     44.24f,
+                            973.25f,      0.00f,      0.00f,    612.67f,
+                              0.00f,   -875.90f,      0.00f,    595.96f,
+                              0.00f,      0.00f,    813.96f,   -484.62f) },
+    { UINT16_C(0xa685),
+      simde_mm512_set_ps(   837.70f,    351.39f,    995.87f,   -909.70f,
+                             95.90f,     83.41f,   -519.54f,   -764.08f,
+                            705.14f,   -199.45f,   -724.80f,   -443.12f,
+                            172.50f,   -513.32f,   -176.16f,    419.43f),
+      simde_mm512_set_ps(  -199.45f,      0.00f,   -724.80f,      0.00f,
+                              0.00f,   -443.12f,    172.50f,      0.00f,
+                           -513.32f,      0.00f,      0.00f,      0.00f,
+                              0.00f,   -176.16f,      0.00f,    419.43f) },
+    { UINT16_C(0x2cad),
+      simde_mm512_set_ps(    99.52f,   -423.12f,    412.24f,    -15.63f,
+                             -7.06f,    579.99f,   -878.19f,   -299.42f,
+                           -532.39f,    -76.24f,   -296.30f,    966.89f,
+                            791.93f,   -357.00f,    778.22f,    669.27f),
+      simde_mm512_set_ps(     0.00f,      0.00f,   -532.39f,      0.00f,
+                            -76.24f,   -296.30f,      0.00f,      0.00f,
+                            966.89f,      0.00f,    791.93f,      0.00f,
+                           -357.00f,    778.22f,      0.00f,    669.27f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_maskz_expandloadu_ps(test_vec[i].k, (simde_float32 const*) &(test_vec[i].a));
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_loadu_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(0xe2),
+      simde_mm512_set_epi64(INT64_C(  131855741037682658), INT64_C(  630621470509034833),
+                            INT64_C( 5698767517740167824), INT64_C( 2045059013387276945),
+                            INT64_C(-1558968550399318926), INT64_C(  580571906847003290),
+                            INT64_C( 6409798604059712081), INT64_C( 6364400111742466297)),
+      simde_mm512_set_epi64(INT64_C(  131855741037682658), INT64_C(  630621470509034833),
+                            INT64_C( 5698767517740167824), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 6409798604059712081), INT64_C(                   0)) },
+    { UINT8_C(0x6a),
+      simde_mm512_set_epi64(INT64_C( 1386314408040773876), INT64_C( 1313966700302017588),
+                            INT64_C( 1303169605186041951), INT64_C(-3031063267071997564),
+                            INT64_C(-7385467634027400948), INT64_C( 5726993987217387981),
+                            INT64_C(-6769220490770522453), INT64_C(-6216179076578844137)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C( 1313966700302017588),
+                            INT64_C( 1303169605186041951), INT64_C(                   0),
+                            INT64_C(-7385467634027400948), INT64_C(                   0),
+                            INT64_C(-6769220490770522453), INT64_C(                   0)) },
+    { UINT8_C(0x4d),
+      simde_mm512_set_epi64(INT64_C(-4780478423791369251), INT64_C( 3942478422874454654),
+                            INT64_C( 4437721340827135900), INT64_C(-4837110140715004871),
+                            INT64_C( 4287017176887600022), INT64_C( -753269428238491587),
+                            INT64_C( 8516431800324448569), INT64_C( -252433660190746213)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C( 3942478422874454654),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 4287017176887600022), INT64_C( -753269428238491587),
+                            INT64_C(                   0), INT64_C( -252433660190746213)) },
+    { UINT8_C(0x1b),
+      simde_mm512_set_epi64(INT64_C(-2178987430928212819), INT64_C( 5548687689228759049),
+                            INT64_C( 2293129302983881187), INT64_C( -621358017174763690),
+                            INT64_C(-3316154782979541567), INT64_C( 5772266901302882902),
+                            INT64_C(  424040895936128433), INT64_C( 3914522935523001798)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( -621358017174763690),
+                            INT64_C(-3316154782979541567), INT64_C(                   0),
+                            INT64_C(  424040895936128433), INT64_C( 3914522935523001798)) },
+    { UINT8_C(0xc8),
+      simde_mm512_set_epi64(INT64_C(  -73784782471873696), INT64_C( 8879008045963265029),
+                            INT64_C( 3391225822906845365), INT64_C( 6459460719784422255),
+                            INT64_C(  442452553553772168), INT64_C(-6982961093294470334),
+                            INT64_C( 2968248791619522648), INT64_C( 1315134863728778142)),
+      simde_mm512_set_epi64(INT64_C(  -73784782471873696), INT64_C( 8879008045963265029),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(  442452553553772168), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(0x0b),
+      simde_mm512_set_epi64(INT64_C( 3349581409197707012), INT64_C( 1612159431189564883),
+                            INT64_C( 5190351746692898929), INT64_C(-5879239906723750397),
+                            INT64_C(-5832708589883750904), INT64_C( 1863909558290504217),
+                            INT64_C(-6825549980086020307), INT64_C(-3457108077318208116)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(-5832708589883750904), INT64_C(                   0),
+                            INT64_C(-6825549980086020307), INT64_C(-3457108077318208116)) },
+    { UINT8_C(0x9a),
+      simde_mm512_set_epi64(INT64_C(-7642342438554837558), INT64_C(-5750189884558906679),
+                            INT64_C(-8192203585757409297), INT64_C( 8148644084696839397),
+                            INT64_C( 6335700502619037421), INT64_C( 6842458451521599446),
+                            INT64_C( 6698356019599438289), INT64_C( 2457136352853953752)),
+      simde_mm512_set_epi64(INT64_C(-7642342438554837558), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( 8148644084696839397),
+                            INT64_C( 6335700502619037421), INT64_C(                   0),
+                            INT64_C( 6698356019599438289), INT64_C(                   0)) },
+    { UINT8_C(0x10),
+      simde_mm512_set_epi64(INT64_C( 2654410278488610907), INT64_C( 5674491571334365824),
+                            INT64_C( 6182184824538431406), INT64_C( 7597786213054591228),
+                            INT64_C( 3323248805029785489), INT64_C( 1467131943887114084),
+                            INT64_C( 6673955253277083815), INT64_C(-8295837958440897696)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( 7597786213054591228),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_loadu_epi64(test_vec[i].k, (int64_t const*) &(test_vec[i].a));
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_loadu_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 r;
+  } test_vec[8] = {
+    { UINT16_C(0xd496),
+      simde_mm512_set_ps(  -331.44f,   -959.70f,   -502.54f,    899.83f,
+                           -442.07f,   -574.31f,   -543.54f,    982.86f,
+                           -931.69f,    880.06f,    173.75f,   -479.78f,
+                           -191.55f,   -268.88f,    962.29f,   -997.27f),
+      simde_mm512_set_ps(  -331.44f,   -959.70f,      0.00f,    899.83f,
+                              0.00f,   -574.31f,      0.00f,      0.00f,
+                           -931.69f,      0.00f,      0.00f,   -479.78f,
+                              0.00f,   -268.88f,    962.29f,      0.00f) },
+    { UINT16_C(0xa552),
+      simde_mm512_set_ps(  -145.52f,    517.88f,   -797.84f,   -155.21f,
+                           -482.62f,    -52.05f,   -639.03f,   -366.41f,
+                           -681.31f,   -445.49f,   -227.65f,     29.83f,
+                            592.85f,    162.80f,    820.08f,    312.53f),
+      simde_mm512_set_ps(  -145.52f,      0.00f,   -797.84f,      0.00f,
+                              0.00f,    -52.05f,      0.00f,   -366.41f,
+                              0.00f,   -445.49f,      0.00f,     29.83f,
+                              0.00f,      0.00f,    820.08f,      0.00f) },
+    { UINT16_C(0xa320),
+      simde_mm512_set_ps(  -669.30f,    -66.67f,    146.39f,   -532.93f,
+                           -737.71f,    599.43f,    869.62f,   -571.38f,
+                            802.58f,    758.39f,   -410.21f,    306.83f,
+                            860.41f,    826.90f,    964.11f,   -693.57f),
+      simde_mm512_set_ps(  -669.30f,      0.00f,    146.39f,      0.00f,
+                              0.00f,      0.00f,    869.62f,   -571.38f,
+                              0.00f,      0.00f,   -410.21f,      0.00f,
+                              0.00f,      0.00f,      0.00f,      0.00f) },
+    { UINT16_C(0x1ae3),
+      simde_mm512_set_ps(  -105.37f,   -183.84f,   -445.90f,    583.69f,
+                           -557.74f,    861.18f,    741.76f,   -538.49f,
+                            511.85f,    239.27f,   -494.83f,    803.99f,
+                            828.82f,   -472.11f,    657.99f,   -401.53f),
+      simde_mm512_set_ps(     0.00f,      0.00f,      0.00f,    583.69f,
+                           -557.74f,      0.00f,    741.76f,      0.00f,
+                            511.85f,    239.27f,   -494.83f,      0.00f,
+                              0.00f,      0.00f,    657.99f,   -401.53f) },
+    { UINT16_C(0x83a2),
+      simde_mm512_set_ps(   423.89f,    151.68f,   -601.85f,    431.34f,
+                           -886.33f,    756.81f,    450.65f,   -373.98f,
+                           -767.18f,   -370.30f,   -254.05f,    286.08f,
+                             23.91f,    -60.52f,    781.72f,     58.76f),
+      simde_mm512_set_ps(   423.89f,      0.00f,      0.00f,      0.00f,
+                              0.00f,      0.00f,    450.65f,   -373.98f,
+                           -767.18f,      0.00f,   -254.05f,      0.00f,
+                              0.00f,      0.00f,    781.72f,      0.00f) },
+    { UINT16_C(0xc7b4),
+      simde_mm512_set_ps(  -528.34f,    873.80f,   -509.75f,   -241.13f,
+                            373.35f,   -649.43f,   -848.17f,   -559.65f,
+                             80.66f,    455.60f,    830.70f,      8.76f,
+                           -919.04f,    242.72f,    832.75f,    387.53f),
+      simde_mm512_set_ps(  -528.34f,    873.80f,      0.00f,      0.00f,
+                              0.00f,   -649.43f,   -848.17f,   -559.65f,
+                             80.66f,      0.00f,    830.70f,      8.76f,
+                              0.00f,    242.72f,      0.00f,      0.00f) },
+    { UINT16_C(0x58a2),
+      simde_mm512_set_ps(   922.59f,   -515.20f,    969.45f,    887.42f,
+                            483.29f,    619.88f,    248.65f,   -298.92f,
+                            160.76f,    599.87f,     33.73f,   -268.45f,
+                           -465.42f,    784.21f,   -684.24f,    309.75f),
+      simde_mm512_set_ps(     0.00f,   -515.20f,      0.00f,    887.42f,
+                            483.29f,      0.00f,      0.00f,      0.00f,
+                            160.76f,      0.00f,     33.73f,      0.00f,
+                              0.00f,      0.00f,   -684.24f,      0.00f) },
+    { UINT16_C(0x7e83),
+      simde_mm512_set_ps(   351.55f,   -652.58f,   -625.79f,    218.38f,
+                           -857.15f,    744.31f,    547.29f,   -621.69f,
+                            941.53f,    670.04f,   -577.88f,   -726.32f,
+                           -345.19f,    858.12f,    920.26f,   -614.85f),
+      simde_mm512_set_ps(     0.00f,   -652.58f,   -625.79f,    218.38f,
+                           -857.15f,    744.31f,    547.29f,      0.00f,
+                            941.53f,      0.00f,      0.00f,      0.00f,
+                              0.00f,      0.00f,    920.26f,   -614.85f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_maskz_loadu_ps(test_vec[i].k, (simde_float32 const*) &(test_vec[i].a));
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_min_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(0xc08a),
+      simde_mm512_set_epi32(-1054580812,  -263307528, -1711077731,  -562452796,
+                             1082916047,  1127316644,  -407568587,    24729739,
+                             1876745287,  1495174205,  1982649791, -1144189063,
+                             1006522648, -1305930731,  -564473184, -1032567297),
+      simde_mm512_set_epi32(  791524578, -1958419601,   -34319812,  -937557445,
+                             -393063987, -1887787130,  1561059849,  -238698284,
+                            -1015948162, -1587486043, -1320796590, -1479252578,
+                            -1831687637,  -504208673,  1603910439,   647529960),
+      simde_mm512_set_epi32(  791524578, -1958419601,           0,           0,
+                                      0,           0,           0,           0,
+                             1876745287,           0,           0,           0,
+                             1006522648,           0,  1603910439,           0) },
+    { UINT16_C(0x342d),
+      simde_mm512_set_epi32( -759229402,  1028563266, -1096898154,  -825949185,
+                             -223525348,   795419471,  -260238494, -1219008987,
+                             -896050678, -1861571237,  1124734461,   934853649,
+                            -1331215880,  1653408200, -1565552943, -1191404497),
+      simde_mm512_set_epi32(-1547557767, -1196650117, -1376880780, -1473883942,
+                            -1651701492,   698160138,  -957843980, -1801377423,
+                               30647547,  1830355341,   861254456,  1787157338,
+                             -895694056, -1021408521,   282020182,  -146900206),
+      simde_mm512_set_epi32(          0,           0, -1376880780, -1473883942,
+                                      0,   698160138,           0,           0,
+                                      0,           0,   861254456,           0,
+                            -1331215880,  1653408200,           0, -1191404497) },
+    { UINT16_C(0x988e),
+      simde_mm512_set_epi32( 1448127405,  1544532628, -1087161583,  1041098986,
+                             1289863485,  -183196099,  -425452682,  1267532454,
+                             1378866009, -1087426127,  1067061112,  2098354417,
+                            -1631954522,   131326109,  1728002011,  1371898144),
+      simde_mm512_set_epi32(-1499710061, -1362819438,  2043121140, -1456596499,
+                            -1494946063,   864928940,   686770860,  1339406208,
+                             1862911011,  1539121547, -1049920610, -1868273430,
+                             1866613206,  1472206873,  -100925946,  1629348197),
+      simde_mm512_set_epi32( 1448127405,           0,           0,  1041098986,
+                             1289863485,           0,           0,           0,
+                             1378866009,           0,           0,           0,
+                             1866613206,   131326109,  1728002011,           0) },
+    { UINT16_C(0x5e22),
+      simde_mm512_set_epi32( -459217278,    26146699, -1328023549,  -230693575,
+                             2048934070,   487344353,   660099904,  -796048977,
+                             1584481416, -2122769660,  -165823837, -1731739890,
+                              212104130,   556605960,   732974196,  1076915381),
+      simde_mm512_set_epi32( 1992488449, -1902289971,   -41110619,   134963996,
+                             -185925372,  -136853804, -1173563770,  -313352539,
+                              114121096, -1834308514,   561182608,   651550325,
+                             1324619028,   816708165,  -248515742,   944136605),
+      simde_mm512_set_epi32(          0,    26146699,           0,   134963996,
+                             2048934070,   487344353,   660099904,           0,
+                                      0,           0,   561182608,           0,
+                                      0,           0,   732974196,           0) },
+    { UINT16_C(0xc711),
+      simde_mm512_set_epi32( -317983769,   880766563,   485765304,  1779983885,
+                              767479072, -1623996598,  -182665578,  -772576116,
+                               32407842,  1421491071,  1632945334,  -193711236,
+                             1897569196,   682018068,  1672690619, -1175524411),
+      simde_mm512_set_epi32( 1185835600,  -771785564,  2131108003,  -774162037,
+                              438142896, -2094248671,  1811784301,  1241585255,
+                             1478589942, -2049716973,  -253337547,  1556815461,
+                             -233902254,  -492291369, -1195802761, -1543980720),
+      simde_mm512_set_epi32( 1185835600,   880766563,           0,           0,
+                                      0, -2094248671,  1811784301,  1241585255,
+                                      0,           0,           0,  1556815461,
+                                      0,           0,           0, -1543980720) },
+    { UINT16_C(0xcb46),
+      simde_mm512_set_epi32(-1090821898,  1756275069, -1799112216, -1321240447,
+                              643018513,  -508887486,  2042852422, -1336594576,
+                             -325777470,   452309206, -2033582157,  1175973945,
+                              539805812,   945150944,  -123382724,  1921747362),
+      simde_mm512_set_epi32( 2141720530,  -511064705,  -844176325,  -395813869,
+                             1527861480,   725817132,   395293230,  -230826346,
+                            -1880016722,  1039908399, -1997440737,   -14555028,
+                              238534938,  -156987444,   210718339, -1980474666),
+      simde_mm512_set_epi32( 2141720530,  1756275069,           0,           0,
+                              643018513,           0,   395293230, -1336594576,
+                                      0,   452309206,           0,           0,
+                                      0,   945150944,   210718339,           0) },
+    { UINT16_C(0x0a23),
+      simde_mm512_set_epi32( 1076807055,   229299692, -1382057613,   415544430,
+                            -1590865658,   406065319,  -899189447,   158189932,
+                              985579665,  1778077663,  1287350176, -1947372391,
+                              337261185,   781168632, -1231232956,  -478764639),
+      simde_mm512_set_epi32(  -63192931, -1885295094,  -848973539,  -740882059,
+                            -2027087208,  -342495459,  -282080927,   235793335,
+                            -1703087711,   569630703,  -412625796,  1897347716,
+                             -590174258,  1356814024,   806443108,   220575931),
+      simde_mm512_set_epi32(          0,           0,           0,           0,
+                            -2027087208,           0,  -899189447,           0,
+                                      0,           0,  1287350176,           0,
+                                      0,           0,   806443108,   220575931) },
+    { UINT16_C(0x528f),
+      simde_mm512_set_epi32( 1206651759,  -408203781,   603705368,  1048354209,
+                             -238873293,  2038369774,  2145454136,  1275448799,
+                            -1095729125,   -60455251,   935547101,  1818904460,
+                             1957206373,  1699842991,  1022422328,  1419063010),
+      simde_mm512_set_epi32(-1539339286,  -271229910,  1422371665,   350801739,
+                              155860891,  -404133170,  1094991312,  -351017216,
+                             2107567306, -1627676278,  2030450967,   791384439,
+                             1435230561,  -955982004,  1891605031,  -839617538),
+      simde_mm512_set_epi32(          0,  -408203781,           0,   350801739,
+                                      0,           0,  1094991312,           0,
+                             2107567306,           0,           0,           0,
+                             1435230561,  1699842991,  1022422328,  1419063010) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_min_epu32(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_mov_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(0xd4),
+      simde_mm512_set_epi64(INT64_C( 7454043406951767674), INT64_C( 6877292040782034133),
+                            INT64_C(-6389611485863328960), INT64_C(-5521836631645185406),
+                            INT64_C( 1699389729053924456), INT64_C(-9144687537832467273),
+                            INT64_C( 4300620372976069729), INT64_C(-8787685756180438002)),
+      simde_mm512_set_epi64(INT64_C( 7454043406951767674), INT64_C( 6877292040782034133),
+                            INT64_C(                   0), INT64_C(-5521836631645185406),
+                            INT64_C(                   0), INT64_C(-9144687537832467273),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(0x78),
+      simde_mm512_set_epi64(INT64_C( 4490647794105904142), INT64_C(-6368160499722268883),
+                            INT64_C( 6639148808972076980), INT64_C( 8060694901253840111),
+                            INT64_C( 2263605914575903578), INT64_C( 5065358812773900729),
+                            INT64_C(-6124670624207031269), INT64_C(-6393693264779451114)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(-6368160499722268883),
+                            INT64_C( 6639148808972076980), INT64_C( 8060694901253840111),
+                            INT64_C( 2263605914575903578), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(0xfb),
+      simde_mm512_set_epi64(INT64_C( 4210610069161576878), INT64_C( 6117306153128280359),
+                            INT64_C(-2849877912612175919), INT64_C(-1237222643617389232),
+                            INT64_C( 6199841030076380624), INT64_C(-8091280897394613071),
+                            INT64_C(-6721961468649080681), INT64_C(-1224849635584731086)),
+      simde_mm512_set_epi64(INT64_C( 4210610069161576878), INT64_C( 6117306153128280359),
+                            INT64_C(-2849877912612175919), INT64_C(-1237222643617389232),
+                            INT64_C( 6199841030076380624), INT64_C(                   0),
+                            INT64_C(-6721961468649080681), INT64_C(-1224849635584731086)) },
+    { UINT8_C(0xd1),
+      simde_mm512_set_epi64(INT64_C( 8058428440775063541), INT64_C(-3023761117151087343),
+                            INT64_C(   72788052027256321), INT64_C(-1292524050693938808),
+                            INT64_C( 6450259825968388159), INT64_C(  841458934404350254),
+                            INT64_C(-5980753488944274212), INT64_C(-4530116270018234102)),
+      simde_mm512_set_epi64(INT64_C( 8058428440775063541), INT64_C(-3023761117151087343),
+                            INT64_C(                   0), INT64_C(-1292524050693938808),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-4530116270018234102)) },
+    { UINT8_C(0x71),
+      simde_mm512_set_epi64(INT64_C(   93848414410733297), INT64_C(-7596821431630556633),
+                            INT64_C(-2739799050113901933), INT64_C(-4779289151629902757),
+                            INT64_C(-4451941763432947734), INT64_C( 5534994708970924047),
+                            INT64_C( -621389871961230172), INT64_C(-9166590689461995743)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(-7596821431630556633),
+                            INT64_C(-2739799050113901933), INT64_C(-4779289151629902757),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-9166590689461995743)) },
+    { UINT8_C(0x55),
+      simde_mm512_set_epi64(INT64_C(-1249902276596743824), INT64_C( 6713893895712213451),
+                            INT64_C(-9088571980083481541), INT64_C(-6852585789139274645),
+                            INT64_C(-8824483931245071181), INT64_C( 5088764623580156495),
+                            INT64_C( 1479391218881906181), INT64_C( 5068524848516397681)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C( 6713893895712213451),
+                            INT64_C(                   0), INT64_C(-6852585789139274645),
+                            INT64_C(                   0), INT64_C( 5088764623580156495),
+                            INT64_C(                   0), INT64_C( 5068524848516397681)) },
+    { UINT8_C(0x83),
+      simde_mm512_set_epi64(INT64_C( -338418922020851063), INT64_C( 1259271824529932726),
+                            INT64_C(-8169141627549334593), INT64_C( 6712391530970503215),
+                            INT64_C( 7858640408431240983), INT64_C( 6622438544631811401),
+                            INT64_C( 1976845791037694282), INT64_C( 9033180920522317760)),
+      simde_mm512_set_epi64(INT64_C( -338418922020851063), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 1976845791037694282), INT64_C( 9033180920522317760)) },
+    { UINT8_C(0x86),
+      simde_mm512_set_epi64(INT64_C( 2012418567458403661), INT64_C(-2281462654320713802),
+                            INT64_C( 4327098626920590165), INT64_C( 2978487717218968476),
+                            INT64_C(-8179925776801303731), INT64_C(-4912012075956049439),
+                            INT64_C( 1467232996902176738), INT64_C( 6911330100309261185)),
+      simde_mm512_set_epi64(INT64_C( 2012418567458403661), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-4912012075956049439),
+                            INT64_C( 1467232996902176738), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_mov_epi64(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_mov_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 r;
+  } test_vec[8] = {
+    { UINT16_C(0xeff7),
+      simde_mm512_set_ps(   168.28f,   -613.06f,    508.97f,   -179.37f,
+                           -710.15f,   -401.81f,    993.87f,   -565.54f,
+                            460.56f,    380.84f,   -665.78f,   -621.74f,
+                           -548.52f,    344.97f,   -346.07f,   -751.92f),
+      simde_mm512_set_ps(   168.28f,   -613.06f,    508.97f,      0.00f,
+                           -710.15f,   -401.81f,    993.87f,   -565.54f,
+                            460.56f,    380.84f,   -665.78f,   -621.74f,
+                              0.00f,    344.97f,   -346.07f,   -751.92f) },
+    { UINT16_C(0x8efa),
+      simde_mm512_set_ps(    -2.50f,    177.66f,   -503.32f,   -133.02f,
+                            398.29f,   -385.84f,    800.95f,   -801.51f,
+                           -438.85f,    125.52f,    831.30f,    492.50f,
+                           -586.38f,    988.40f,   -231.72f,   -851.90f),
+      simde_mm512_set_ps(    -2.50f,      0.00f,      0.00f,      0.00f,
+                            398.29f,   -385.84f,    800.95f,      0.00f,
+                           -438.85f,    125.52f,    831.30f,    492.50f,
+                           -586.38f,      0.00f,   -231.72f,      0.00f) },
+    { UINT16_C(0x1b67),
+      simde_mm512_set_ps(  -765.73f,    155.43f,   -653.79f,   -197.79f,
+                           -544.12f,   -900.00f,    322.49f,   -748.65f,
+                            308.83f,   -113.27f,   -220.36f,    103.32f,
+                            401.27f,    487.90f,     67.24f,   -610.45f),
+      simde_mm512_set_ps(     0.00f,      0.00f,      0.00f,   -197.79f,
+                           -544.12f,      0.00f,    322.49f,   -748.65f,
+                              0.00f,   -113.27f,   -220.36f,      0.00f,
+                              0.00f,    487.90f,     67.24f,   -610.45f) },
+    { UINT16_C(0xba09),
+      simde_mm512_set_ps(  -865.94f,     -7.43f,   -642.03f,    658.81f,
+                           -584.67f,   -578.14f,    725.71f,    504.92f,
+                            475.48f,    489.50f,    908.19f,   -459.84f,
+                            -89.47f,   -449.47f,   -576.63f,   -299.11f),
+      simde_mm512_set_ps(  -865.94f,      0.00f,   -642.03f,    658.81f,
+                           -584.67f,      0.00f,    725.71f,      0.00f,
+                              0.00f,      0.00f,      0.00f,      0.00f,
+                            -89.47f,      0.00f,      0.00f,   -299.11f) },
+    { UINT16_C(0xe107),
+      simde_mm512_set_ps(   241.16f,    714.80f,    122.32f,   -901.80f,
+                           -894.87f,   -211.78f,   -231.97f,   -831.60f,
+                            -41.57f,   -485.36f,   -767.17f,   -184.54f,
+                            853.29f,   -873.17f,    896.63f,   -844.88f),
+      simde_mm512_set_ps(   241.16f,    714.80f,    122.32f,      0.00f,
+                              0.00f,      0.00f,      0.00f,   -831.60f,
+                              0.00f,      0.00f,      0.00f,      0.00f,
+                              0.00f,   -873.17f,    896.63f,   -844.88f) },
+    { UINT16_C(0xa70a),
+      simde_mm512_set_ps(   398.44f,    800.86f,   -559.05f,    408.23f,
+                           -879.16f,   -501.40f,   -111.10f,    718.93f,
+                           -933.21f,    382.75f,    -59.04f,   -739.66f,
+                            650.42f,   -392.07f,    871.30f,   -955.11f),
+      simde_mm512_set_ps(   398.44f,      0.00f,   -559.05f,      0.00f,
+                              0.00f,   -501.40f,   -111.10f,    718.93f,
+                              0.00f,      0.00f,      0.00f,      0.00f,
+                            650.42f,      0.00f,    871.30f,      0.00f) },
+    { UINT16_C(0x759b),
+      simde_mm512_set_ps(   516.25f,   -855.06f,   -339.57f,    519.85f,
+                             -6.16f,   -549.45f,    -40.48f,    -33.01f,
+                            135.43f,     42.28f,    621.30f,   -725.07f,
+                           -785.65f,    556.82f,    808.23f,    750.03f),
+      simde_mm512_set_ps(     0.00f,   -855.06f,   -339.57f,    519.85f,
+                              0.00f,   -549.45f,      0.00f,    -33.01f,
+                            135.43f,      0.00f,      0.00f,   -725.07f,
+                           -785.65f,      0.00f,    808.23f,    750.03f) },
+    { UINT16_C(0x2c66),
+      simde_mm512_set_ps(   361.24f,    299.22f,     57.54f,    544.07f,
+                            702.17f,   -344.11f,    778.14f,   -540.79f,
+                           -963.94f,   -894.89f,    957.48f,    222.31f,
+                            568.10f,   -877.20f,    533.12f,   -866.01f),
+      simde_mm512_set_ps(     0.00f,      0.00f,     57.54f,      0.00f,
+                            702.17f,   -344.11f,      0.00f,      0.00f,
+                              0.00f,   -894.89f,    957.48f,      0.00f,
+                              0.00f,   -877.20f,    533.12f,      0.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_maskz_mov_ps(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_sub_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(0x49),
+      simde_mm512_set_epi64(INT64_C(-5120385296405857034), INT64_C(-3788820646399579776),
+                            INT64_C( 5758889939280060566), INT64_C( 8621191045554458607),
+                            INT64_C(-5256021492043288987), INT64_C(-6569285689931827880),
+                            INT64_C( 4587371769508622744), INT64_C( 7644135628875964867)),
+      simde_mm512_set_epi64(INT64_C(-7493854681974552207), INT64_C( 3874322050456857564),
+                            INT64_C(-7304309621699148544), INT64_C( 1260945466202705078),
+                            INT64_C( 1329909994836850310), INT64_C(-5065987138348879094),
+                            INT64_C( 4417262821471692425), INT64_C( -736073955064011272)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(-7663142696856437340),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(-6585931486880139297), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( 8380209583939976139)) },
+    { UINT8_C(0xb5),
+      simde_mm512_set_epi64(INT64_C( 2950320836706376808), INT64_C( 1446214206997947791),
+                            INT64_C(-6387221458429567591), INT64_C(-5757006111533872040),
+                            INT64_C(  965335476783734719), INT64_C(-7384374163224801107),
+                            INT64_C(-7125770136371898164), INT64_C(-2524531606210402758)),
+      simde_mm512_set_epi64(INT64_C( 4274391955053826706), INT64_C( 4409033613724849616),
+                            INT64_C( 1871074367963193379), INT64_C( 4518313306845287421),
+                            INT64_C(-2656969241446191002), INT64_C( 8804267911776901020),
+                            INT64_C(-1278306436328834212), INT64_C(  641607511691167824)),
+      simde_mm512_set_epi64(INT64_C(-1324071118347449898), INT64_C(                   0),
+                            INT64_C(-8258295826392760970), INT64_C( 8171424655330392155),
+                            INT64_C(                   0), INT64_C( 2258101998707849489),
+                            INT64_C(                   0), INT64_C(-3166139117901570582)) },
+    { UINT8_C(0x41),
+      simde_mm512_set_epi64(INT64_C( 4136067368230354891), INT64_C( 4714716597286989071),
+                            INT64_C(  406196087150606771), INT64_C( 2108107315305007255),
+                            INT64_C(-1992313568553248741), INT64_C(-4368258854092279573),
+                            INT64_C( 8736971714350569825), INT64_C(-5373897270050576305)),
+      simde_mm512_set_epi64(INT64_C(-7105802247802712147), INT64_C(-5466573558146795753),
+                            INT64_C( 4687989937147041346), INT64_C(  311108357148104517),
+                            INT64_C( 5713187192155460252), INT64_C( 4598231028310053093),
+                            INT64_C( -259651572805689978), INT64_C(-4300246611551132973)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(-8265453918275766792),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-1073650658499443332)) },
+    { UINT8_C(0x9b),
+      simde_mm512_set_epi64(INT64_C(  655369763851972634), INT64_C( 6070563633902138693),
+                            INT64_C(-4800580322828949144), INT64_C(-7448762871117261202),
+                            INT64_C(-6841220686464287357), INT64_C(-8223583291384395930),
+                            INT64_C(-5526639048487224639), INT64_C( 7952892905943817305)),
+      simde_mm512_set_epi64(INT64_C(  794208214050338151), INT64_C( 3034947132264044681),
+                            INT64_C(-3022581158156090069), INT64_C( 5562506087257862806),
+                            INT64_C(-1542300148967808038), INT64_C( 5550946279198186172),
+                            INT64_C(-8038236761159267957), INT64_C( 2239526924273726323)),
+      simde_mm512_set_epi64(INT64_C( -138838450198365517), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( 5435475115334427608),
+                            INT64_C(-5298920537496479319), INT64_C(                   0),
+                            INT64_C( 2511597712672043318), INT64_C( 5713365981670090982)) },
+    { UINT8_C(0x04),
+      simde_mm512_set_epi64(INT64_C( 5848647290198110052), INT64_C(-3890228934453079820),
+                            INT64_C( -147094650222794711), INT64_C(-3796492863872791751),
+                            INT64_C( 8166939009415690197), INT64_C( 1740021380202563799),
+                            INT64_C( 8652254672652724344), INT64_C( 3101341405260938684)),
+      simde_mm512_set_epi64(INT64_C( 3009712059479428826), INT64_C(   39141302345974472),
+                            INT64_C( 8997907266055301885), INT64_C(-7213963358018278690),
+                            INT64_C(-2335285098357682567), INT64_C(-5157490581890502428),
+                            INT64_C( 6452769636458890396), INT64_C(-2894184241688346379)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( 6897511962093066227),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(0x48),
+      simde_mm512_set_epi64(INT64_C( 7645101286037160228), INT64_C( 1079723693007739698),
+                            INT64_C( 1332936516614746792), INT64_C( 2916505996145082407),
+                            INT64_C( 4323557935345654779), INT64_C(-2575368209704796728),
+                            INT64_C( 1128975536605150749), INT64_C(-4521405801574665760)),
+      simde_mm512_set_epi64(INT64_C( 4785910478226172119), INT64_C( 2780820785034045028),
+                            INT64_C( 9112713596982996878), INT64_C( 6040129965269436687),
+                            INT64_C( 3299411723490765497), INT64_C( 7516753615648084301),
+                            INT64_C( 7800230567613143231), INT64_C(  191483107454184559)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(-1701097092026305330),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 1024146211854889282), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(0xd6),
+      simde_mm512_set_epi64(INT64_C(-5193532355100907834), INT64_C( 5250294447509666910),
+                            INT64_C( -933729510497669270), INT64_C(-4742161518388923720),
+                            INT64_C(-2441792898286192244), INT64_C(-2071901825142334802),
+                            INT64_C( 3481248417657687248), INT64_C(-5756495656570966310)),
+      simde_mm512_set_epi64(INT64_C(-7762217340958232541), INT64_C( 4085449906641687413),
+                            INT64_C(-6892087126111335530), INT64_C( -983682572626953543),
+                            INT64_C(-1511950793537694782), INT64_C(-6805474800225377134),
+                            INT64_C( 7123834686745388804), INT64_C(-6221532862437494056)),
+      simde_mm512_set_epi64(INT64_C( 2568684985857324707), INT64_C( 1164844540867979497),
+                            INT64_C(                   0), INT64_C(-3758478945761970177),
+                            INT64_C(                   0), INT64_C( 4733572975083042332),
+                            INT64_C(-3642586269087701556), INT64_C(                   0)) },
+    { UINT8_C(0xca),
+      simde_mm512_set_epi64(INT64_C( 5013021200947795131), INT64_C( 6313241444025343566),
+                            INT64_C(-8418854849159962403), INT64_C(-7535707480521793701),
+                            INT64_C( 5619545558513102235), INT64_C( 9112851880215387808),
+                            INT64_C( -312983924823726922), INT64_C( 5115460527421569612)),
+      simde_mm512_set_epi64(INT64_C(-3477313991636112558), INT64_C( 7101764653720564947),
+                            INT64_C( 6476689734019494199), INT64_C( 9097850026845276990),
+                            INT64_C( 4555415756484020773), INT64_C(-2969353325164444205),
+                            INT64_C(-1703248747856112923), INT64_C(-8745201537114415536)),
+      simde_mm512_set_epi64(INT64_C( 8490335192583907689), INT64_C( -788523209695221381),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 1064129802029081462), INT64_C(                   0),
+                            INT64_C( 1390264823032386001), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_sub_epi64(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_max_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(  241333900,   756974826,   368659591,   706275368,
+                             2091678350,  -418455266,  -771903254,  -350445259,
+                              -76988299, -2002684574,  -860327838,  -956809856,
+                              299692771,   450002340,  -680297755,   515762403),
+      simde_mm512_set_epi32(  511257745,  2130870839,   375654750,   417384842,
+                            -1385964695, -1641928784,  2045506061,  2045424077,
+                             1494972108,   103402618, -1216603550,  -958056618,
+                            -1112172323,  1781321333,   968959367,  -463645577),
+      simde_mm512_set_epi32(  511257745,  2130870839,   375654750,   706275368,
+                             2091678350,  -418455266,  2045506061,  2045424077,
+                             1494972108,   103402618,  -860327838,  -956809856,
+                              299692771,  1781321333,   968959367,   515762403) },
+    { simde_mm512_set_epi32( 1115753657,  1612620959,  1503769623,  1918131042,
+                             -691801018, -1539051512,  1506179801,   119429473,
+                             -225682097,  1049838804,  -250740198,  1138386618,
+                             -383119483,    15539491,  1166755113, -1426826882),
+      simde_mm512_set_epi32( 2061811815,   117827502,  -865418729, -1764752550,
+                              902856073, -1385658630,  1251587234, -1823545421,
+                              724136882,   191674502,  -685297504, -1198077243,
+                            -2045260989,   218422844,  1817446499,  1280722812),
+      simde_mm512_set_epi32( 2061811815,  1612620959,  1503769623,  1918131042,
+                              902856073, -1385658630,  1506179801,   119429473,
+                              724136882,  1049838804,  -250740198,  1138386618,
+                             -383119483,   218422844,  1817446499,  1280722812) },
+    { simde_mm512_set_epi32(-1682870088,   319681402, -1561300972,   871252552,
+                             -355273689,   316296866,  -193473541,   -42975024,
+                              254369037,  1985853652, -1376285500,  -549248326,
+                               48183699,    79677066,  -586912458,   470519168),
+      simde_mm512_set_epi32( 1960201830, -1956766775,   944804715, -1574288913,
+                             1916914763,  -342395632,   -13860508,  -215197809,
+                            -1486095375,  1082651623, -2092442120,   781060175,
+                             -878775679,  -909398867,  1078948816, -1901019302),
+      simde_mm512_set_epi32( 1960201830,   319681402,   944804715,   871252552,
+                             1916914763,   316296866,   -13860508,   -42975024,
+                              254369037,  1985853652, -1376285500,   781060175,
+                               48183699,    79677066,  1078948816,   470519168) },
+    { simde_mm512_set_epi32(-1319813925,   212940823, -1958997000, -1248012172,
+                             1655743239,  2080116856,  2121102885, -1473958558,
+                              397144144, -1876935113,  1918231524,  -498586708,
+                              -58664289,  -670038202, -1791844561,  1025184058),
+      simde_mm512_set_epi32( -612117198,   920552208,   852491067,  1117561591,
+                              819722860,  1055436532,   439299953,  1449934531,
+                              -23077738,  -387116961,  -106042956,  1827766679,
+                             -202206223,   231760031,  -962452705,   488247937),
+      simde_mm512_set_epi32( -612117198,   920552208,   852491067,  1117561591,
+                             1655743239,  2080116856,  2121102885,  1449934531,
+                              397144144,  -387116961,  1918231524,  1827766679,
+                              -58664289,   231760031,  -962452705,  1025184058) },
+    { simde_mm512_set_epi32(-1802149501,  1341447070,  -906652640,  1448219078,
+                            -1174813401,   152279440, -1281871913,   899588046,
+                             1422669808,  1633820704,   203289592,  -997919583,
+                            -1530624682, -1086105658, -2034442167, -1264837516),
+      simde_mm512_set_epi32(  -35789187,  -947238591, -1842970398,  1081678305,
+                              277246356,  1076201738,   538477246,  2003272274,
+                             -984430906,  1469762683,  1608680542, -1766240001,
+                             -241179303,   959493199,  -981837968, -1368680942),
+      simde_mm512_set_epi32(  -35789187,  1341447070,  -906652640,  1448219078,
+                              277246356,  1076201738,   538477246,  2003272274,
+                             1422669808,  1633820704,  1608680542,  -997919583,
+                             -241179303,   959493199,  -981837968, -1264837516) },
+    { simde_mm512_set_epi32( -850054327, -1993743477, -1059841129,  1975970377,
+                             -150920966,  1867879712,  -176094672,  2065440894,
+                            -1771279466, -1114487405, -2144330114,  1234395465,
+                             -814219430, -1290112497,  1169369476,  1600503699),
+      simde_mm512_set_epi32( -651890355, -1635611656,  1058095744, -2122483765,
+                             2130355064, -1866107068, -1078800260, -1764156955,
+                             -971569074, -1520504931,  1595815257,  -409840616,
+                               49458171, -1837933074,   604294903,   799317760),
+      simde_mm512_set_epi32( -651890355, -1635611656,  1058095744,  1975970377,
+                             2130355064,  1867879712,  -176094672,  2065440894,
+                             -971569074, -1114487405,  1595815257,  1234395465,
+                               49458171, -1290112497,  1169369476,  1600503699) },
+    { simde_mm512_set_epi32( 1896042602, -1904796043,  1838274373,  -278205436,
+                             -862136783, -1387602450,  -303277064,   926293514,
+                             -952916360,   570687176,  1881207845, -1708465691,
+                             1407086161,  -158389837, -1903352929,   587758407),
+      simde_mm512_set_epi32( 2127341671,   603623014,  1149773298,  -704098127,
+                              567527205,   473506058,   213220374,  1933380386,
+                              589848348,  1540224181,   469029523,  1951221980,
+                               45162096,  -814872845,  1919336538,  -680440888),
+      simde_mm512_set_epi32( 2127341671,   603623014,  1838274373,  -278205436,
+                              567527205,   473506058,   213220374,  1933380386,
+                              589848348,  1540224181,  1881207845,  1951221980,
+                             1407086161,  -158389837,  1919336538,   587758407) },
+    { simde_mm512_set_epi32( 1890236772, -2050148402,   967408335, -1222946053,
+                              -17133097,   813609355, -1524328902,    84310651,
+                              148253073, -1679953055, -1758862821,  -760514429,
+                            -1227374040,   415096583,    -9922619,  -198870803),
+      simde_mm512_set_epi32(-1468495733,  -708379350,    77646744,   536356976,
+                             -333952864,    27093867,   915336292,  -197028438,
+                              -54574755,   725290245,  -757724444,  -305193415,
+                            -1631015284, -1627782708,   -84267226, -1060172633),
+      simde_mm512_set_epi32( 1890236772,  -708379350,   967408335,   536356976,
+                              -17133097,   813609355,   915336292,    84310651,
+                              148253073,   725290245,  -757724444,  -305193415,
+                            -1227374040,   415096583,    -9922619,  -198870803) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_max_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_max_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( 1229879697,   146570542,  1257393347,  1208285530,
+                            -1092383529, -1595098311,  1627152537,  1472723830,
+                              184557690,  -963387151,  -460369410,   395112136,
+                            -1861689089,  1630976551,  1815579730,  2128093681),
+      simde_mm512_set_epi32( -794431361,  -550828354,   929504726, -1585668968,
+                            -1814007897, -1647290186, -1642212400,  -326826249,
+                              614906731,   722013024,   888761327,  1539015012,
+                             1632222048,  1584240432,   231857931, -1707396901),
+      simde_mm512_set_epi32( -794431361,  -550828354,  1257393347, -1585668968,
+                            -1092383529, -1595098311, -1642212400,  -326826249,
+                              614906731,  -963387151,  -460369410,  1539015012,
+                            -1861689089,  1630976551,  1815579730, -1707396901) },
+    { simde_mm512_set_epi32(-2118747730,  1799362823,   933067561,  1800935740,
+                              270482586, -1280966404,  -183442082,  1544679730,
+                            -1899557030,  1514317210,   -13658796,  -309257325,
+                              380013393,   739482322,  -410881185,  1413581243),
+      simde_mm512_set_epi32( -974710978,  2030396791, -1077331283,  1110453544,
+                             1338998892,   133390609,  2003606866,  1858643411,
+                              148693472,  -911285571, -1614719720,   985986604,
+                            -1654623156,  1790161046, -1158143768,  2011367545),
+      simde_mm512_set_epi32( -974710978,  2030396791, -1077331283,  1800935740,
+                             1338998892, -1280966404,  -183442082,  1858643411,
+                            -1899557030,  -911285571,   -13658796,  -309257325,
+                            -1654623156,  1790161046,  -410881185,  2011367545) },
+    { simde_mm512_set_epi32(-1256828668,   779530573, -1137454972,  1894948502,
+                             1850341613,   511348840,   547660291,   527951579,
+                              698715498,  -905556757, -1322412586,   459471155,
+                             -834449242,  1072137036,  1281423333,  -402918189),
+      simde_mm512_set_epi32(-1894777357,  -595224248,   318164717,    59351866,
+                             2054954830,   988651411, -1846154414,  1671209145,
+                             -212957961,  1015662737, -1983132213,  -859259787,
+                             2086441855,   972729918,  1756960657,  -180489209),
+      simde_mm512_set_epi32(-1256828668,  -595224248, -1137454972,  1894948502,
+                             2054954830,   988651411, -1846154414,  1671209145,
+                             -212957961,  -905556757, -1322412586,  -859259787,
+                             -834449242,  1072137036,  1756960657,  -180489209) },
+    { simde_mm512_set_epi32(-1904433616,   -38471295, -2093384689,   179472585,
+                             -790274656, -1486068337,  1487933716,   262670047,
+                            -1750707726,  -157600382,   -78709077,  1313150229,
+                            -1788808577, -1478578829,  1672277430,  -207737310),
+      simde_mm512_set_epi32( 2024009444,  -852572439,  1194124518, -2084022807,
+                             -144474508,   579564981,   892807918,  1856090965,
+                            -1502870367,   489543684, -1751761323,   419205778,
+                              390366765,  -139840466,  -170110106,   322138324),
+      simde_mm512_set_epi32(-1904433616,   -38471295, -2093384689, -2084022807,
+                             -144474508, -1486068337,  1487933716,  1856090965,
+                            -1502870367,  -157600382,   -78709077,  1313150229,
+                            -1788808577,  -139840466,  -170110106,  -207737310) },
+    { simde_mm512_set_epi32(-1378993920,   899266917,  1340077682, -2078577136,
+                             -552716552,   778397871,  1419064602,  -253494252,
+                             1281167862,  -224565679, -1897145866,  -115940214,
+                            -1348994231,  1449379464,  1281203558,  1622021526),
+      simde_mm512_set_epi32( -100700861,  1822862514,  1729699307,  1092445714,
+                            -2121628854,  -208292606,  1681011066,  1090283386,
+                            -1810662742,   576007586, -1652208167, -1415531799,
+                              389975930,  -272267574,   -53825222, -2018741586),
+      simde_mm512_set_epi32( -100700861,  1822862514,  1729699307, -2078577136,
+                             -552716552,  -208292606,  1681011066,  -253494252,
+                            -1810662742,  -224565679, -1652208167,  -115940214,
+                            -1348994231,  -272267574,   -53825222, -2018741586) },
+    { simde_mm512_set_epi32(  898640164,  -938992792,  -791094017,  -179483320,
+                             1965177626, -1005419927,    86311457,   339032225,
+                             1622256842,   444359615,  1076366601,    40550028,
+                            -1833664233,  -734191247,  1646210674,  -707024576),
+      simde_mm512_set_epi32(  345995783,  -960631086,   674266589,  2101203540,
+                             2007436725,  1330067969,  -999312028, -1459061683,
+                            -2058836150,   945517288,  1804873740,  1055192643,
+                             1097492263,  1039796569,   741168842,    90094097),
+      simde_mm512_set_epi32(  898640164,  -938992792,  -791094017,  -179483320,
+                             2007436725, -1005419927,  -999312028, -1459061683,
+                            -2058836150,   945517288,  1804873740,  1055192643,
+                            -1833664233,  -734191247,  1646210674,  -707024576) },
+    { simde_mm512_set_epi32(   50239321, -1788526952,  -503916624,  -979688596,
+                            -1694640935, -1468061978, -1496010469,  1100252417,
+                             1423732292,   734435376, -1242598691,   825990492,
+                             1405391405,   256261276,  -521651567,  1259683578),
+      simde_mm512_set_epi32( -956963873,   126155661,   574790052,  -620470730,
+                             1359374121, -1883929564,  -898418763, -1751095938,
+                             -700120439,   756692391, -1941365658,  1110534375,
+                             -669905149,  1743800640,   480636820,  -690598203),
+      simde_mm512_set_epi32( -956963873, -1788526952,  -503916624,  -620470730,
+                            -1694640935, -1468061978,  -898418763, -1751095938,
+                             -700120439,   756692391, -1242598691,  1110534375,
+                             -669905149,  1743800640,  -521651567,  -690598203) },
+    { simde_mm512_set_epi32(  688361789, -1482755406,   -30594773, -1234849757,
+                            -1622273977,   195206441,  -385404529, -1610048428,
+                             1427545804,   995934115, -1607492167,  -540060974,
+                            -1370261898,  1901447502,  -403626553,   696364185),
+      simde_mm512_set_epi32(-1544805850,   491274509,   -99475551,  -900079510,
+                             -200369104,  1432414957,   494522306, -1187798145,
+                              -38650749,  -569670036, -1390955582,  1404316684,
+                             1345930984, -1714788279, -2102674226, -1766541394),
+      simde_mm512_set_epi32(-1544805850, -1482755406,   -30594773,  -900079510,
+                             -200369104,  1432414957,  -385404529, -1187798145,
+                              -38650749,  -569670036, -1390955582,  -540060974,
+                            -1370261898, -1714788279,  -403626553, -1766541394) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_max_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_max_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(   319.44,    461.99,    559.33,   -903.01,
+                           -780.39,     20.04,   -176.57,   -452.80),
+      simde_mm512_set_pd(   612.56,   -457.96,     94.83,    -88.23,
+                           -601.86,    801.92,    636.74,    388.42),
+      simde_mm512_set_pd(   612.56,    461.99,    559.33,    -88.23,
+                           -601.86,    801.92,    636.74,    388.42) },
+    { simde_mm512_set_pd(  -575.28,   -346.94,    430.71,    797.09,
+                           -681.36,     73.55,    576.38,     24.76),
+      simde_mm512_set_pd(  -928.48,   -925.94,    508.22,   -592.47,
+                           -763.58,   -578.71,    778.41,   -288.65),
+      simde_mm512_set_pd(  -575.28,   -346.94,    508.22,    797.09,
+                           -681.36,     73.55,    778.41,     24.76) },
+    { simde_mm512_set_pd(  -190.68,   -555.69,   -243.19,    799.96,
+                           -861.62,    277.33,    893.31,   -405.50),
+      simde_mm512_set_pd(  -793.65,   -329.39,   -447.11,     72.71,
+                            187.82,   -101.76,    496.90,    402.60),
+      simde_mm512_set_pd(  -190.68,   -329.39,   -243.19,    799.96,
+                            187.82,    277.33,    893.31,    402.60) },
+    { simde_mm512_set_pd(   871.14,   -182.14,    935.03,   -822.90,
+                            -27.73,    689.52,    520.65,    484.12),
+      simde_mm512_set_pd(   432.60,    727.43,    852.32,    338.88,
+                           -107.34,    801.15,   -432.15,    430.17),
+      simde_mm512_set_pd(   871.14,    727.43,    935.03,    338.88,
+                            -27.73,    801.15,    520.65,    484.12) },
+    { simde_mm512_set_pd(   679.69,   -919.54,   -324.31,     44.27,
+                           -743.24,   -318.64,    886.31,   -326.63),
+      simde_mm512_set_pd(   953.26,    379.42,    332.54,    402.61,
+                           -109.43,    -83.29,    521.36,    527.25),
+      simde_mm512_set_pd(   953.26,    379.42,    332.54,    402.61,
+                           -109.43,    -83.29,    886.31,    527.25) },
+    { simde_mm512_set_pd(  -161.67,    713.27,     43.69,    434.63,
+                            839.31,   -102.29,   -501.90,    713.93),
+      simde_mm512_set_pd(   146.38,    737.39,   -467.67,    701.00,
+                           -471.51,    422.83,    181.78,    793.30),
+      simde_mm512_set_pd(   146.38,    737.39,     43.69,    701.00,
+                            839.31,    422.83,    181.78,    793.30) },
+    { simde_mm512_set_pd(   770.45,    636.49,    962.88,    713.03,
+                            196.95,    533.00,     78.36,   -503.12),
+      simde_mm512_set_pd(   426.29,    834.97,    717.00,   -988.08,
+                            217.51,   -144.71,    716.60,   -733.77),
+      simde_mm512_set_pd(   770.45,    834.97,    962.88,    713.03,
+                            217.51,    533.00,    716.60,   -503.12) },
+    { simde_mm512_set_pd(  -851.31,   -460.45,    145.10,    -44.10,
+                            496.32,    158.97,    530.53,     71.25),
+      simde_mm512_set_pd(   -21.96,   -769.77,    571.05,    326.34,
+                           -139.92,   -725.51,   -687.30,   -280.87),
+      simde_mm512_set_pd(   -21.96,   -460.45,    571.05,    326.34,
+                            496.32,    158.97,    530.53,     71.25) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_max_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_max_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(  -195.74f,      8.69f,   -687.17f,    805.04f,
+                            284.94f,   -804.75f,    929.23f,   -877.70f,
+                            228.51f,   -851.30f,   -329.50f,    754.52f,
+                            456.82f,    451.47f,    558.85f,    568.12f),
+      simde_mm512_set_ps(   622.27f,    914.40f,    475.78f,     95.30f,
+                            259.01f,   -600.80f,    934.93f,   -221.45f,
+                           -803.60f,    223.43f,    387.43f,   -812.07f,
+                            231.11f,   -725.31f,   -945.89f,    971.90f),
+      simde_mm512_set_ps(   622.27f,    914.40f,    475.78f,    805.04f,
+                            284.94f,   -600.80f,    934.93f,   -221.45f,
+                            228.51f,    223.43f,    387.43f,    754.52f,
+                            456.82f,    451.47f,    558.85f,    971.90f) },
+    { simde_mm512_set_ps(  -205.40f,    -63.86f,    193.87f,    -75.05f,
+                            781.60f,   -277.53f,    -67.05f,    855.88f,
+                           -230.74f,    392.29f,    -95.76f,    680.63f,
+                            549.95f,    410.02f,   -320.94f,   -856.16f),
+      simde_mm512_set_ps(   393.61f,    -69.64f,   -210.29f,    981.24f,
+                            883.47f,   -181.25f,   -895.97f,    643.80f,
+                            306.73f,   -179.78f,   -965.11f,    162.34f,
+                           -332.87f,   -369.72f,   -321.58f,   -293.29f),
+      simde_mm512_set_ps(   393.61f,    -63.86f,    193.87f,    981.24f,
+                            883.47f,   -181.25f,    -67.05f,    855.88f,
+                            306.73f,    392.29f,    -95.76f,    680.63f,
+                            549.95f,    410.02f,   -320.94f,   -293.29f) },
+    { simde_mm512_set_ps(   113.90f,    177.81f,    908.23f,    514.05f,
+                            880.25f,   -627.15f,   -320.47f,   -626.35f,
+                           -605.69f,   -864.56f,   -721.02f,    173.77f,
+                           -709.49f,   -441.35f,   -215.03f,    287.93f),
+      simde_mm512_set_ps(   159.04f,   -736.33f,    868.22f,    156.29f,
+                            194.68f,    582.29f,    124.19f,    876.16f,
+                            658.45f,    652.18f,    312.61f,    -78.80f,
+                           -418.42f,    406.52f,    857.58f,    823.55f),
+      simde_mm512_set_ps(   159.04f,    177.81f,    908.23f,    514.05f,
+                            880.25f,    582.29f,    124.19f,    876.16f,
+                            658.45f,    652.18f,    312.61f,    173.77f,
+                           -418.42f,    406.52f,    857.58f,    823.55f) },
+    { simde_mm512_set_ps(   220.75f,   -738.80f,    702.49f,    284.15f,
+                            -28.50f,    291.82f,   -217.27f,   -197.11f,
+                           -521.54f,   -833.19f,   -797.75f,   -455.53f,
+                           -905.27f,    122.57f,   -422.74f,   -806.84f),
+      simde_mm512_set_ps(  -115.13f,    316.11f,    398.76f,   -631.14f,
+                           -955.43f,   -396.47f,   -599.56f,   -618.47f,
+                            655.25f,    -86.93f,    324.01f,    617.03f,
+                            -44.01f,   -219.14f,   -753.21f,   -379.93f),
+      simde_mm512_set_ps(   220.75f,    316.11f,    702.49f,    284.15f,
+                            -28.50f,    291.82f,   -217.27f,   -197.11f,
+                            655.25f,    -86.93f,    324.01f,    617.03f,
+                            -44.01f,    122.57f,   -422.74f,   -379.93f) },
+    { simde_mm512_set_ps(   982.75f,   -982.10f,    -72.43f,   -833.08f,
+                           -827.92f,    242.38f,    288.25f,    528.93f,
+                           -719.20f,   -788.61f,   -769.92f,   -243.50f,
+                            673.48f,    903.54f,    184.63f,    989.11f),
+      simde_mm512_set_ps(    -4.70f,   -569.88f,    533.01f,   -353.72f,
+                           -137.13f,   -633.92f,    978.71f,   -158.16f,
+                            348.32f,    831.38f,   -362.98f,    591.86f,
+                            677.24f,    399.68f,   -104.68f,    -58.39f),
+      simde_mm512_set_ps(   982.75f,   -569.88f,    533.01f,   -353.72f,
+                           -137.13f,    242.38f,    978.71f,    528.93f,
+                            348.32f,    831.38f,   -362.98f,    591.86f,
+                            677.24f,    903.54f,    184.63f,    989.11f) },
+    { simde_mm512_set_ps(   925.98f,    278.36f,   -397.95f,     84.07f,
+                           -957.35f,    531.08f,   -362.67f,   -978.71f,
+                            213.06f,    493.50f,    540.50f,    995.28f,
+                            443.56f,   -732.58f,    -82.13f,    299.33f),
+      simde_mm512_set_ps(   714.85f,   -271.36f,    138.16f,   -142.66f,
+                            576.83f,   -964.94f,   -948.37f,    506.72f,
+                            -22.54f,   -380.00f,   -455.75f,    473.44f,
+                            280.00f,    239.48f,    719.10f,    543.73f),
+      simde_mm512_set_ps(   925.98f,    278.36f,    138.16f,     84.07f,
+                            576.83f,    531.08f,   -362.67f,    506.72f,
+                            213.06f,    493.50f,    540.50f,    995.28f,
+                            443.56f,    239.48f,    719.10f,    543.73f) },
+    { simde_mm512_set_ps(  -205.28f,    680.90f,    347.24f,    357.49f,
+                             16.82f,   -222.21f,   -717.39f,    417.97f,
+                           -934.21f,   -327.17f,      0.34f,   -506.09f,
+                            595.44f,   -849.70f,    801.90f,   -268.40f),
+      simde_mm512_set_ps(  -164.86f,    739.69f,    309.01f,   -785.08f,
+                           -758.98f,   -596.02f,    748.43f,   -602.51f,
+                            993.83f,    665.98f,   -845.82f,    689.96f,
+                            -21.73f,    -72.96f,   -664.42f,    674.91f),
+      simde_mm512_set_ps(  -164.86f,    739.69f,    347.24f,    357.49f,
+                             16.82f,   -222.21f,    748.43f,    417.97f,
+                            993.83f,    665.98f,      0.34f,    689.96f,
+                            595.44f,    -72.96f,    801.90f,    674.91f) },
+    { simde_mm512_set_ps(  -710.01f,    932.92f,    665.39f,    895.45f,
+                            827.10f,    302.63f,   -947.62f,    501.76f,
+                            419.95f,   -160.00f,    203.64f,    600.26f,
+                           -548.02f,    898.04f,    442.33f,   -940.67f),
+      simde_mm512_set_ps(  -641.81f,   -876.02f,    190.70f,     64.51f,
+                           -615.95f,    451.26f,    121.12f,    787.14f,
+                            230.82f,   -206.32f,   -534.92f,   -417.64f,
+                           -535.99f,   -201.98f,    266.60f,    753.52f),
+      simde_mm512_set_ps(  -641.81f,    932.92f,    665.39f,    895.45f,
+                            827.10f,    451.26f,    121.12f,    787.14f,
+                            419.95f,   -160.00f,    203.64f,    600.26f,
+                           -535.99f,    898.04f,    442.33f,    753.52f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_max_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_min_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( 1221510447,    66258120,  -426958801,   970813970,
+                             1715671586, -1317148985,  -690003177,  -973545076,
+                               26074086,  1789770694,  2112739144, -1120051443,
+                              153183346,   626209865, -1151115259,  1413819608),
+      simde_mm512_set_epi32(-1952201530,   528083716, -1805113303,  -150280546,
+                              535584137,  -609783469,   118768123,  2112735010,
+                             -831893146,  -265131234, -1263501126,  -910630363,
+                            -1651941223,   583445473, -1268746158, -1086632307),
+      simde_mm512_set_epi32(-1952201530,    66258120, -1805113303,  -150280546,
+                              535584137, -1317148985,  -690003177,  -973545076,
+                             -831893146,  -265131234, -1263501126, -1120051443,
+                            -1651941223,   583445473, -1268746158, -1086632307) },
+    { simde_mm512_set_epi32( 1851503929,   514330530, -1643599531,  2078667026,
+                             1160283699,  -946771528,  1905620909, -1578450790,
+                            -1151991739,   -26344051, -2062723344,   -47747627,
+                             1510057515,  1313196082, -2078952225,  -555815210),
+      simde_mm512_set_epi32( 1610582362, -1391435004, -1515820261,   591937436,
+                             1413433910,  1433193313, -1679400352,  1768618119,
+                            -1821907727,  2138403895,  1610017645,  1332868535,
+                              335551014,  -145983101,  -954481422,  1670748159),
+      simde_mm512_set_epi32( 1610582362, -1391435004, -1643599531,   591937436,
+                             1160283699,  -946771528, -1679400352, -1578450790,
+                            -1821907727,   -26344051, -2062723344,   -47747627,
+                              335551014,  -145983101, -2078952225,  -555815210) },
+    { simde_mm512_set_epi32(-1335677115, -1028139959, -1723701102,   290617915,
+                             -831063980, -1710505786, -1868993968, -1603985590,
+                              198829073,   273340249,  1995299527,   619045141,
+                             1036392166,   680058600,   956298816, -1277550338),
+      simde_mm512_set_epi32( 1670262545,  1004279020,   867828958,  1371453190,
+                             1174023827,  -693171943,  -607435017,   308078541,
+                              968404017,  -945249145,  -764227996,   595571161,
+                            -1546912201, -1135698923,  1041826463,   670380537),
+      simde_mm512_set_epi32(-1335677115, -1028139959, -1723701102,   290617915,
+                             -831063980, -1710505786, -1868993968, -1603985590,
+                              198829073,  -945249145,  -764227996,   595571161,
+                            -1546912201, -1135698923,   956298816, -1277550338) },
+    { simde_mm512_set_epi32( -466080144, -1684266788, -1212189164, -2077665715,
+                            -1274132338,  1516749861,   291105599,  -887588649,
+                            -1503850157,  -138698032,  -195458740,  1068056287,
+                              445875732,  1820488371,  1990193789, -1065473739),
+      simde_mm512_set_epi32(  356014960, -1044485210,  1533529029,  1543487320,
+                             -999782263,  1022005972,   973128093,  -792813234,
+                             2052218514, -1192944183,  1129641770,   791639162,
+                              270167338,    68575511,  -249778805,  1299063261),
+      simde_mm512_set_epi32( -466080144, -1684266788, -1212189164, -2077665715,
+                            -1274132338,  1022005972,   291105599,  -887588649,
+                            -1503850157, -1192944183,  -195458740,   791639162,
+                              270167338,    68575511,  -249778805, -1065473739) },
+    { simde_mm512_set_epi32( -654167246,  1717081811,   751366241,  -257900520,
+                               44897635,   550757195,  1443029598,   715936478,
+                            -1944931347,   -75384099,   974250595,  -946634483,
+                               -7283914,   392065084,  1021652571,  1078454927),
+      simde_mm512_set_epi32( -844964965,  1256632721,   544343564,   157955654,
+                            -1181483247,  -103447388,   127305802,   -53811300,
+                             1389717051,   446531935,   850548514,  1572865989,
+                             2119363274,  1859850627,   692424246,  1768243187),
+      simde_mm512_set_epi32( -844964965,  1256632721,   544343564,  -257900520,
+                            -1181483247,  -103447388,   127305802,   -53811300,
+                            -1944931347,   -75384099,   850548514,  -946634483,
+                               -7283914,   392065084,   692424246,  1078454927) },
+    { simde_mm512_set_epi32( 1976954342,   -19257007, -1669294650,  -383551509,
+                             1993225006,   959949590,  1670064307,  -904279378,
+                             1209843630, -1294919443, -1357570549,  -420544009,
+                             -637100234,   -59518396,  1376620579, -2066033497),
+      simde_mm512_set_epi32(-1722491412, -1360693192,    33443302,   502904343,
+                             1654384856, -2030882856, -1192469413,  1440037500,
+                            -1764500292,  -878490324,  2078360731,  -662577362,
+                             1057407251,  1143982812,  -617781368, -1389261595),
+      simde_mm512_set_epi32(-1722491412, -1360693192, -1669294650,  -383551509,
+                             1654384856, -2030882856, -1192469413,  -904279378,
+                            -1764500292, -1294919443, -1357570549,  -662577362,
+                             -637100234,   -59518396,  -617781368, -2066033497) },
+    { simde_mm512_set_epi32( -834489128,  -914802090,  1175742927,  -734693377,
+                            -1105187591,  1402847360,  -816083154,  1880310756,
+                            -1693166412,  -267709603, -1297758357,  1163535971,
+                            -2101575315, -1824633621,  1411494965, -1624505725),
+      simde_mm512_set_epi32(  669859466,   115145356,  1710363284,   736988039,
+                              -14458888,  -323968002,   121026835, -1006453251,
+                            -1473655404,  -128722863,  1427010860,  1265865959,
+                              656033960,  -784701012,   590981739, -2092794195),
+      simde_mm512_set_epi32( -834489128,  -914802090,  1175742927,  -734693377,
+                            -1105187591,  -323968002,  -816083154, -1006453251,
+                            -1693166412,  -267709603, -1297758357,  1163535971,
+                            -2101575315, -1824633621,   590981739, -2092794195) },
+    { simde_mm512_set_epi32( 1248046636,  -269021977,  1566135245,  -880066906,
+                             1382975130,  1982161106,  1408510617,  -922460993,
+                             1957987821,  1552098517,  -852842131,  1298391664,
+                             -160908123,   449786678,  1445772319,  1764091956),
+      simde_mm512_set_epi32(-1931463319,   689314153, -1326459687,  -695695364,
+                              253970332, -1809732259, -1377927505,  1287012058,
+                            -1753984112,   758095329,  1516427257,   857083897,
+                             -874157328,   236484625, -1865258938, -1812341398),
+      simde_mm512_set_epi32(-1931463319,  -269021977, -1326459687,  -880066906,
+                              253970332, -1809732259, -1377927505,  -922460993,
+                            -1753984112,   758095329,  -852842131,   857083897,
+                             -874157328,   236484625, -1865258938, -1812341398) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_min_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_min_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( -293878783,  -467409718,   589660288, -1257550512,
+                             -887513816,  -971303375,  1668674389,  -978254056,
+                              940339443, -1429829828, -1948088063,   906274579,
+                              190194123, -1069282702,  1502725099,  -840359139),
+      simde_mm512_set_epi32( -602342714,  -535520185,  -101062471,  1734233040,
+                            -2142863834,  1944665328,  -366713902,   476479752,
+                             1363275738,  1469210532, -1708408540, -1879667054,
+                             -351218154, -1749497942, -1123305018, -1509111467),
+      simde_mm512_set_epi32( -602342714,  -535520185,   589660288,  1734233040,
+                            -2142863834,  1944665328,  1668674389,   476479752,
+                              940339443,  1469210532, -1948088063,   906274579,
+                              190194123, -1749497942,  1502725099, -1509111467) },
+    { simde_mm512_set_epi32(  173738861,   504877823,   978251636,   671027310,
+                             -326275873,  2087294076,  1682316660,  1357911423,
+                                4489906,  1786344453,   426686223,  -586492863,
+                             1997624038,  -590820003,  1980832738, -1207766504),
+      simde_mm512_set_epi32( -795020837, -1504522252, -1319646162, -1031580158,
+                              -14029095,  1022186207,   769557631,  -190881340,
+                            -2010659388,  2125764165,  -288942839, -1578654924,
+                              648242195,   746771743,   377303257, -1140347264),
+      simde_mm512_set_epi32(  173738861,   504877823,   978251636,   671027310,
+                             -326275873,  1022186207,   769557631,  1357911423,
+                                4489906,  1786344453,   426686223, -1578654924,
+                              648242195,   746771743,   377303257, -1207766504) },
+    { simde_mm512_set_epi32(-1285808100, -1903637552, -2002393990,   167120848,
+                              821742481,  -405605138,  -410013999,   508193543,
+                             -531225089,   -87771432, -1939173161,   770282968,
+                            -1360886516, -1266555901, -1194859345,  -950571190),
+      simde_mm512_set_epi32(-1485876973, -2029396465,  -156695617,   -35621793,
+                              208336697, -1382194428, -1348913019,  2109449421,
+                              745366720,  -684332684,  1504106305, -1928002896,
+                              701578167,    72310868, -1947813727,  -249570942),
+      simde_mm512_set_epi32(-1485876973, -2029396465, -2002393990,   167120848,
+                              208336697, -1382194428, -1348913019,   508193543,
+                              745366720,  -684332684,  1504106305,   770282968,
+                              701578167,    72310868, -1947813727,  -950571190) },
+    { simde_mm512_set_epi32(-1574038726,  1802787798,   -32988954,   409689843,
+                            -2012267428,   223163261,  1926985422,   -24459550,
+                            -1197469562,  1865250240,  1929803080, -1866135640,
+                            -1709606019,   750591208, -1550937802,  -241003778),
+      simde_mm512_set_epi32( 1291341328,  1625789011,  -514358024,   952663575,
+                            -1778840890, -1641268374,   -98058968,  1317103456,
+                              619992147, -1672178765, -1321664806,  2135673646,
+                            -1713232117,  -287150685,  2049976174,   131208419),
+      simde_mm512_set_epi32( 1291341328,  1625789011,  -514358024,   409689843,
+                            -2012267428,   223163261,  1926985422,  1317103456,
+                              619992147,  1865250240,  1929803080,  2135673646,
+                            -1713232117,   750591208,  2049976174,   131208419) },
+    { simde_mm512_set_epi32( -287600323,  -932655160, -1985210812,  -152212173,
+                            -2054516511, -1218302479,   163686211, -1306841040,
+                             1224738800,   807405488,  -124049919, -1250460430,
+                            -1692749960,   323000120,  -666968426, -1461249454),
+      simde_mm512_set_epi32( 1351758672,  1754202135,  -246725991,   589400605,
+                             -843046742,  -296611432,  -772357934,  -561369952,
+                             1889514617, -1633006863, -1072929087, -1394378263,
+                              726867043,   446208495,   401009433,  1368207442),
+      simde_mm512_set_epi32( 1351758672,  1754202135, -1985210812,   589400605,
+                            -2054516511, -1218302479,   163686211, -1306841040,
+                             1224738800,   807405488, -1072929087, -1394378263,
+                              726867043,   323000120,   401009433,  1368207442) },
+    { simde_mm512_set_epi32( -204327780,  1266476225,  1562907647, -1964274273,
+                             1013219016, -1976745191,  -949389113, -1529214071,
+                             1866052018, -1496334019,  -985845950,  2097900605,
+                            -1035255055, -1487525249, -1996369675,  1181369305),
+      simde_mm512_set_epi32( -328693400, -1799145614,  -338620035,  -787572269,
+                            -1019744369,   828032628,  -726544730,    40686407,
+                              174971222,  -471034264,  1882102906, -1149786394,
+                              528286920,     2913275,   173277416,  1392526804),
+      simde_mm512_set_epi32( -328693400,  1266476225,  1562907647, -1964274273,
+                             1013219016,   828032628,  -949389113,    40686407,
+                              174971222, -1496334019,  1882102906,  2097900605,
+                              528286920,     2913275,   173277416,  1181369305) },
+    { simde_mm512_set_epi32( 2027713640, -1958521211,  1441834483,  1913373403,
+                            -1812628298, -2020465934, -1562551489,  -253081297,
+                            -1107667729,   218319731,   938715721,  1967842886,
+                             1814665968, -1606760645,  -662784927,  -540474433),
+      simde_mm512_set_epi32(  911716428, -1329839131, -1730552238,  1528907902,
+                             1412934863,  -417602769,  1043428400,  -639055285,
+                            -1694833261,   232113664,  1318271424,   -88862858,
+                            -1585624794,  1277182130,  -471271862,   -36837409),
+      simde_mm512_set_epi32(  911716428, -1958521211,  1441834483,  1528907902,
+                             1412934863, -2020465934,  1043428400,  -639055285,
+                            -1694833261,   218319731,   938715721,  1967842886,
+                             1814665968,  1277182130,  -662784927,  -540474433) },
+    { simde_mm512_set_epi32(-1882024894, -2027432197,   536932029,   976219737,
+                              320120747,  -409394877,  -495850823,   462493582,
+                              -30363324, -1623782809,  -675185768,  1754666172,
+                             1753677240,  -495879457,  -240657644,  1501388572),
+      simde_mm512_set_epi32( -279616505,  1054965305,   -68023459,  -772408716,
+                            -1494594902,  -904678179,  1789168697, -2139906437,
+                             2001850923,  1226579621, -1115990422,  1380637269,
+                            -1961898908, -2062859624, -1568530769,  -382046325),
+      simde_mm512_set_epi32(-1882024894,  1054965305,   536932029,   976219737,
+                              320120747,  -904678179,  1789168697,   462493582,
+                             2001850923,  1226579621, -1115990422,  1380637269,
+                             1753677240, -2062859624, -1568530769,  1501388572) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_min_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_min_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -818.74,     29.60,   -800.06,     66.35,
+                            166.71,    804.38,   -634.92,   -937.43),
+      simde_mm512_set_pd(  -206.22,     39.40,   -293.23,    116.79,
+                           -144.61,    222.58,    141.90,    -23.17),
+      simde_mm512_set_pd(  -818.74,     29.60,   -800.06,     66.35,
+                           -144.61,    222.58,   -634.92,   -937.43) },
+    { simde_mm512_set_pd(   429.25,   -282.36,   -245.65,   -950.96,
+                           -738.96,    750.33,   -357.87,    -51.08),
+      simde_mm512_set_pd(   294.13,    -63.98,    189.41,    392.04,
+                            124.53,   -727.66,    182.68,   -375.43),
+      simde_mm512_set_pd(   294.13,   -282.36,   -245.65,   -950.96,
+                           -738.96,   -727.66,   -357.87,   -375.43) },
+    { simde_mm512_set_pd(  -447.35,    -20.49,   -531.03,    318.34,
+                            192.28,   -349.44,    503.42,   -318.49),
+      simde_mm512_set_pd(  -354.36,   -116.53,    -41.63,    -81.19,
+                             33.18,   -670.26,    169.63,    617.01),
+      simde_mm512_set_pd(  -447.35,   -116.53,   -531.03,    -81.19,
+                             33.18,   -670.26,    169.63,   -318.49) },
+    { simde_mm512_set_pd(   612.09,   -503.42,   -456.03,   -631.36,
+                             14.46,    577.62,   -710.13,    297.12),
+      simde_mm512_set_pd(   712.64,    688.18,   -218.66,   -526.65,
+                           -216.25,    178.26,   -997.09,    636.76),
+      simde_mm512_set_pd(   612.09,   -503.42,   -456.03,   -631.36,
+                           -216.25,    178.26,   -997.09,    297.12) },
+    { simde_mm512_set_pd(  -593.00,    839.59,    185.88,   -253.97,
+                            765.12,    319.29,    498.15,   -839.30),
+      simde_mm512_set_pd(    46.50,   -935.45,   -154.95,    913.97,
+                            931.89,   -692.67,   -720.89,   -253.84),
+      simde_mm512_set_pd(  -593.00,   -935.45,   -154.95,   -253.97,
+                            765.12,   -692.67,   -720.89,   -839.30) },
+    { simde_mm512_set_pd(   290.09,   -291.59,   -792.39,    381.20,
+                           -957.88,    756.19,    831.87,    -23.84),
+      simde_mm512_set_pd(  -654.79,   -770.70,   -291.92,    234.34,
+                            324.89,     99.86,    132.26,     18.37),
+      simde_mm512_set_pd(  -654.79,   -770.70,   -792.39,    234.34,
+                           -957.88,     99.86,    132.26,    -23.84) },
+    { simde_mm512_set_pd(     6.63,    663.06,    -81.32,    974.38,
+                            389.87,    -14.08,   -228.93,   -196.33),
+      simde_mm512_set_pd(  -253.58,     57.55,    -26.89,    831.69,
+                            430.07,    759.64,   -608.03,    826.87),
+      simde_mm512_set_pd(  -253.58,     57.55,    -81.32,    831.69,
+                            389.87,    -14.08,   -608.03,   -196.33) },
+    { simde_mm512_set_pd(  -969.06,    785.23,    972.54,   -111.69,
+                            212.85,    934.77,    816.60,   -613.20),
+      simde_mm512_set_pd(  -417.31,    749.22,   -392.90,   -415.32,
+                           -480.63,   -302.44,    341.56,   -437.39),
+      simde_mm512_set_pd(  -969.06,    749.22,   -392.90,   -415.32,
+                           -480.63,   -302.44,    341.56,   -613.20) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_min_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_min_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(   304.35f,    994.97f,   -159.07f,   -373.72f,
+                             93.65f,    983.77f,    550.20f,   -641.90f,
+                           -878.63f,    546.89f,   -584.69f,   -532.16f,
+                            120.47f,    315.94f,    684.41f,     -5.70f),
+      simde_mm512_set_ps(   976.16f,   -363.29f,    744.68f,    877.41f,
+                           -897.72f,    536.13f,    915.88f,   -556.12f,
+                            284.30f,   -765.37f,   -983.63f,   -980.56f,
+                            825.75f,    699.75f,    -86.68f,    277.36f),
+      simde_mm512_set_ps(   304.35f,   -363.29f,   -159.07f,   -373.72f,
+                           -897.72f,    536.13f,    550.20f,   -641.90f,
+                           -878.63f,   -765.37f,   -983.63f,   -980.56f,
+                            120.47f,    315.94f,    -86.68f,     -5.70f) },
+    { simde_mm512_set_ps(  -375.18f,   -421.49f,    -57.53f,   -209.52f,
+                           -940.88f,   -407.14f,    502.38f,    296.05f,
+                            168.74f,    479.86f,    555.22f,   -708.74f,
+                            396.02f,   -706.95f,   -129.99f,   -610.03f),
+      simde_mm512_set_ps(  -407.12f,   -969.29f,   -241.32f,   -493.62f,
+                           -928.55f,    529.17f,   -579.19f,    409.49f,
+                            -78.24f,   -201.73f,   -899.09f,    644.22f,
+                             94.64f,   -494.26f,   -705.22f,    -66.48f),
+      simde_mm512_set_ps(  -407.12f,   -969.29f,   -241.32f,   -493.62f,
+                           -940.88f,   -407.14f,   -579.19f,    296.05f,
+                            -78.24f,   -201.73f,   -899.09f,   -708.74f,
+                             94.64f,   -706.95f,   -705.22f,   -610.03f) },
+    { simde_mm512_set_ps(   484.08f,   -672.31f,   -476.85f,    586.40f,
+                           -538.60f,   -927.42f,   -735.93f,     81.76f,
+                             96.47f,    527.55f,    849.29f,    215.09f,
+                            550.39f,    506.35f,    314.74f,      5.23f),
+      simde_mm512_set_ps(  -855.30f,      2.89f,   -802.59f,    354.94f,
+                           -482.96f,    690.96f,   -286.30f,   -970.05f,
+                           -284.84f,   -792.02f,   -344.43f,    409.73f,
+                           -956.11f,   -589.81f,    232.50f,   -829.99f),
+      simde_mm512_set_ps(  -855.30f,   -672.31f,   -802.59f,    354.94f,
+                           -538.60f,   -927.42f,   -735.93f,   -970.05f,
+                           -284.84f,   -792.02f,   -344.43f,    215.09f,
+                           -956.11f,   -589.81f,    232.50f,   -829.99f) },
+    { simde_mm512_set_ps(   663.84f,      1.76f,    -71.64f,    556.95f,
+                           -484.32f,   -362.36f,    369.52f,    717.27f,
+                           -360.35f,   -374.50f,   -365.20f,    786.87f,
+                            739.69f,    -65.07f,    185.36f,    553.90f),
+      simde_mm512_set_ps(  -189.50f,   -588.06f,    420.61f,   -126.04f,
+                           -129.38f,    756.37f,    731.87f,   -840.45f,
+                            765.09f,   -752.97f,    171.33f,   -879.57f,
+                           -215.93f,    392.39f,    433.81f,    616.27f),
+      simde_mm512_set_ps(  -189.50f,   -588.06f,    -71.64f,   -126.04f,
+                           -484.32f,   -362.36f,    369.52f,   -840.45f,
+                           -360.35f,   -752.97f,   -365.20f,   -879.57f,
+                           -215.93f,    -65.07f,    185.36f,    553.90f) },
+    { simde_mm512_set_ps(  -359.75f,   -289.83f,   -407.68f,    628.24f,
+                           -825.90f,   -674.87f,    742.65f,   -966.51f,
+                            763.66f,    796.20f,   -107.80f,    -49.25f,
+                           -973.11f,    -76.45f,   -971.32f,   -194.16f),
+      simde_mm512_set_ps(   535.12f,   -261.03f,    829.30f,    590.07f,
+                            674.73f,    -21.51f,   -841.61f,    844.21f,
+                            583.24f,    435.51f,   -307.82f,   -287.77f,
+                             22.05f,     99.56f,   -512.21f,    685.77f),
+      simde_mm512_set_ps(  -359.75f,   -289.83f,   -407.68f,    590.07f,
+                           -825.90f,   -674.87f,   -841.61f,   -966.51f,
+                            583.24f,    435.51f,   -307.82f,   -287.77f,
+                           -973.11f,    -76.45f,   -971.32f,   -194.16f) },
+    { simde_mm512_set_ps(  -680.39f,   -163.10f,    171.48f,    837.32f,
+                            446.34f,    777.17f,    418.26f,    923.21f,
+                           -642.47f,    625.13f,    214.89f,    431.14f,
+                            646.02f,   -686.12f,    114.32f,   -190.64f),
+      simde_mm512_set_ps(  -837.78f,      5.71f,   -905.22f,    807.79f,
+                            483.68f,    933.57f,   -953.78f,   -353.44f,
+                            975.46f,    -23.80f,    684.29f,   -559.06f,
+                           -695.46f,   -788.05f,   -976.42f,    179.37f),
+      simde_mm512_set_ps(  -837.78f,   -163.10f,   -905.22f,    807.79f,
+                            446.34f,    777.17f,   -953.78f,   -353.44f,
+                           -642.47f,    -23.80f,    214.89f,   -559.06f,
+                           -695.46f,   -788.05f,   -976.42f,   -190.64f) },
+    { simde_mm512_set_ps(   318.58f,     12.52f,    178.93f,   -764.03f,
+                            410.44f,    872.59f,    172.56f,   -937.29f,
+                            263.40f,   -668.67f,    759.85f,   -586.44f,
+                              1.09f,   -741.27f,   -155.11f,   -754.38f),
+      simde_mm512_set_ps(  -441.62f,    560.14f,    853.21f,    757.67f,
+                            902.49f,   -272.43f,   -968.41f,   -509.33f,
+                            484.10f,   -827.03f,   -699.48f,   -414.69f,
+                           -391.44f,    421.24f,   -675.73f,    771.59f),
+      simde_mm512_set_ps(  -441.62f,     12.52f,    178.93f,   -764.03f,
+                            410.44f,   -272.43f,   -968.41f,   -937.29f,
+                            263.40f,   -827.03f,   -699.48f,   -586.44f,
+                           -391.44f,   -741.27f,   -675.73f,   -754.38f) },
+    { simde_mm512_set_ps(   438.25f,    953.36f,   -721.33f,   -372.14f,
+                            101.54f,    953.24f,   -200.76f,   -146.69f,
+                            126.23f,   -405.97f,    189.38f,    126.83f,
+                            731.52f,   -415.01f,      7.02f,   -140.26f),
+      simde_mm512_set_ps(   476.85f,   -558.81f,    -30.85f,   -585.23f,
+                            658.44f,   -740.83f,   -181.64f,    351.00f,
+                            413.25f,    694.47f,    944.87f,   -982.02f,
+                           -643.05f,    850.87f,    629.81f,   -166.05f),
+      simde_mm512_set_ps(   438.25f,   -558.81f,   -721.33f,   -585.23f,
+                            101.54f,   -740.83f,   -200.76f,   -146.69f,
+                            126.23f,   -405.97f,    189.38f,   -982.02f,
+                           -643.05f,   -415.01f,      7.02f,   -166.05f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_min_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mul_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -921.00,   -342.86,    159.06,      4.21,
+                           -547.78,    452.28,   -902.14,   -735.35),
+      simde_mm512_set_pd(   526.42,    202.55,   -996.83,   -102.38,
+                           -881.62,   -695.83,    955.82,   -720.45),
+      simde_mm512_set_pd(-484832.82, -69446.29, -158555.78,   -431.02,
+                         482933.80, -314709.99, -862283.45, 529782.91) },
+    { simde_mm512_set_pd(  -590.89,    710.68,   -859.30,    219.58,
+                           -696.68,   -581.05,    -67.26,   -417.95),
+      simde_mm512_set_pd(  -475.08,     32.29,    673.32,    921.79,
+                            723.17,   -982.00,    196.30,    431.21),
+      simde_mm512_set_pd(280720.02,  22947.86, -578583.88, 202406.65,
+                         -503818.08, 570591.10, -13203.14, -180224.22) },
+    { simde_mm512_set_pd(   658.70,   -879.53,   -728.76,    792.53,
+                            266.92,   -913.35,    537.34,     16.59),
+      simde_mm512_set_pd(  -564.02,    704.05,   -664.17,   -802.13,
+                           -894.87,    470.98,   -903.11,     92.19),
+      simde_mm512_set_pd(-371519.97, -619233.10, 484020.53, -635712.09,
+                         -238858.70, -430169.58, -485277.13,   1529.43) },
+    { simde_mm512_set_pd(  -424.94,   -646.18,   -177.75,    690.12,
+                            927.72,   -799.73,   -875.31,   -225.75),
+      simde_mm512_set_pd(   825.05,    276.89,    718.04,    688.58,
+                            298.84,   -716.10,   -916.79,    530.59),
+      simde_mm512_set_pd(-350596.75, -178920.78, -127631.61, 475202.83,
+                         277239.84, 572686.65, 802475.45, -119780.69) },
+    { simde_mm512_set_pd(   115.72,    469.14,   -769.81,    211.64,
+                            320.19,   -475.89,    702.63,   -933.99),
+      simde_mm512_set_pd(   749.02,    -77.54,   -256.05,    364.89,
+                            -58.79,   -886.03,    441.14,    394.24),
+      simde_mm512_set_pd( 86676.59, -36377.12, 197109.85,  77225.32,
+                         -18823.97, 421652.82, 309958.20, -368216.22) },
+    { simde_mm512_set_pd(  -859.02,    -24.31,    486.99,   -764.15,
+                            -45.48,    503.77,   -567.40,    372.95),
+      simde_mm512_set_pd(   562.54,   -322.41,    -29.69,    902.61,
+                           -954.10,   -421.89,   -622.06,   -201.90),
+      simde_mm512_set_pd(-483233.11,   7837.79, -14458.73, -689729.43,
+                          43392.47, -212535.53, 352956.84, -75298.60) },
+    { simde_mm512_set_pd(  -465.97,   -106.15,    -65.43,    302.68,
+                            361.12,   -828.27,    152.96,   -683.09),
+      simde_mm512_set_pd(   681.83,    823.14,    829.53,    910.77,
+                            132.09,     82.12,    -81.28,    540.36),
+      simde_mm512_set_pd(-317712.33, -87376.31, -54276.15, 275671.86,
+                          47700.34, -68017.53, -12432.59, -369114.51) },
+    { simde_mm512_set_pd(   114.14,   -738.03,    918.32,   -251.65,
+                           -252.65,    432.43,   -828.09,     33.69),
+      simde_mm512_set_pd(  -338.11,   -998.61,   -102.60,   -757.96,
+                            915.55,   -618.89,    659.05,   -367.73),
+      simde_mm512_set_pd(-38591.88, 737004.14, -94219.63, 190740.63,
+                         -231313.71, -267626.60, -545752.71, -12388.82) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_mul_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mul_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(     8.44f,     18.44f,    -91.42f,    -10.51f,
+                            -20.83f,     74.77f,    -69.86f,    -65.08f,
+                             35.44f,     -1.19f,    -33.52f,      5.69f,
+                             20.42f,    -13.98f,     94.76f,     66.94f),
+      simde_mm512_set_ps(   -63.97f,    -81.93f,    -91.07f,    -69.50f,
+                            -28.47f,     45.72f,     15.89f,    -40.51f,
+                             45.55f,    -67.76f,     71.99f,     25.19f,
+                             58.38f,    -28.19f,     92.80f,    -60.14f),
+      simde_mm512_set_ps(  -539.91f,  -1510.79f,   8325.62f,    730.45f,
+                            593.03f,   3418.48f,  -1110.08f,   2636.39f,
+                           1614.29f,     80.63f,  -2413.10f,    143.33f,
+                           1192.12f,    394.10f,   8793.73f,  -4025.77f) },
+    { simde_mm512_set_ps(    42.04f,     86.34f,     53.20f,    -21.44f,
+                              4.34f,     97.66f,     98.89f,    -56.88f,
+                            -25.20f,     51.40f,     50.28f,    -54.79f,
+                            -87.72f,     31.92f,    -62.87f,     81.05f),
+      simde_mm512_set_ps(    32.19f,      9.51f,      2.80f,    -46.01f,
+                             64.41f,    -52.45f,     31.95f,     88.39f,
+                             16.96f,    -87.01f,     21.22f,    -91.12f,
+                             76.71f,    -99.18f,    -49.65f,    -51.83f),
+      simde_mm512_set_ps(  1353.27f,    821.09f,    148.96f,    986.45f,
+                            279.54f,  -5122.27f,   3159.54f,  -5027.62f,
+                           -427.39f,  -4472.31f,   1066.94f,   4992.46f,
+                          -6729.00f,  -3165.83f,   3121.50f,  -4200.82f) },
+    { simde_mm512_set_ps(     3.99f,     96.00f,     70.10f,     43.77f,
+                             61.67f,     -9.30f,    -48.50f,     93.87f,
+                             57.86f,    -77.16f,    -82.73f,     82.90f,
+                            -43.82f,      4.86f,     71.83f,    -38.07f),
+      simde_mm512_set_ps(    47.23f,    -30.11f,     47.90f,    -13.99f,
+                             86.84f,     87.87f,    -78.07f,     48.82f,
+                            -21.89f,    -63.81f,    -78.46f,     37.22f,
+                             35.00f,     96.30f,    -55.89f,    -28.08f),
+      simde_mm512_set_ps(   188.45f,  -2890.56f,   3357.79f,   -612.34f,
+                           5355.42f,   -817.19f,   3786.40f,   4582.73f,
+                          -1266.56f,   4923.58f,   6491.00f,   3085.54f,
+                          -1533.70f,    468.02f,  -4014.58f,   1069.01f) },
+    { simde_mm512_set_ps(    91.03f,     57.26f,     74.94f,     37.27f,
+                             38.31f,     76.34f,     57.86f,      5.76f,
+                            -15.36f,     60.70f,     -0.39f,     -8.31f,
+                             51.16f,    -79.67f,     28.20f,     54.39f),
+      simde_mm512_set_ps(   -10.17f,     92.90f,    -87.40f,    -50.34f,
+                            -48.77f,     28.95f,    -82.96f,     34.71f,
+                             37.58f,     50.62f,     28.40f,    -34.18f,
+                            -31.38f,     22.30f,     67.75f,     64.04f),
+      simde_mm512_set_ps(  -925.78f,   5319.45f,  -6549.76f,  -1876.17f,
+                          -1868.38f,   2210.04f,  -4800.07f,    199.93f,
+                           -577.23f,   3072.63f,    -11.08f,    284.04f,
+                          -1605.40f,  -1776.64f,   1910.55f,   3483.14f) },
+    { simde_mm512_set_ps(   -36.97f,    -66.92f,      8.42f,     57.59f,
+                             65.85f,     49.81f,    -10.88f,    -11.99f,
+                            -43.59f,    -60.10f,     37.82f,     59.93f,
+                            -77.18f,    -93.74f,     61.57f,    -58.69f),
+      simde_mm512_set_ps(     6.73f,    -83.16f,     35.01f,     30.78f,
+                            -40.01f,     71.55f,     -5.09f,    -62.14f,
+                             16.82f,    -35.58f,     88.61f,     37.15f,
+                            -76.14f,     -3.17f,    -48.62f,     12.42f),
+      simde_mm512_set_ps(  -248.81f,   5565.07f,    294.78f,   1772.62f,
+                          -2634.66f,   3563.91f,     55.38f,    745.06f,
+                           -733.18f,   2138.36f,   3351.23f,   2226.40f,
+                           5876.49f,    297.16f,  -2993.53f,   -728.93f) },
+    { simde_mm512_set_ps(   -29.95f,      1.43f,     85.81f,    -79.96f,
+                             26.87f,      6.00f,    -77.76f,     83.01f,
+                             20.11f,     81.65f,    -83.84f,    -81.23f,
+                             38.19f,     59.43f,    -58.34f,     41.92f),
+      simde_mm512_set_ps(   -67.59f,    -12.46f,     73.85f,     22.91f,
+                              2.23f,    -43.49f,     59.49f,    -67.13f,
+                             77.79f,     15.01f,     90.96f,     -7.87f,
+                             43.73f,     52.00f,    -82.23f,    -11.93f),
+      simde_mm512_set_ps(  2024.32f,    -17.82f,   6337.07f,  -1831.88f,
+                             59.92f,   -260.94f,  -4625.94f,  -5572.46f,
+                           1564.36f,   1225.57f,  -7626.09f,    639.28f,
+                           1670.05f,   3090.36f,   4797.30f,   -500.11f) },
+    { simde_mm512_set_ps(   -36.37f,     32.62f,     79.79f,    -80.04f,
+                              0.25f,    -74.61f,    -69.57f,    -96.45f,
+                             -4.86f,      1.27f,      0.86f,     29.13f,
+                            -21.49f,      1.71f,    -72.66f,     67.32f),
+      simde_mm512_set_ps(   -83.40f,    -17.68f,    -38.21f,    -23.71f,
+                             -1.51f,     33.90f,    -31.59f,     75.72f,
+                             73.81f,     -8.87f,     84.66f,    -93.93f,
+                             53.61f,     19.21f,     77.54f,     27.49f),
+      simde_mm512_set_ps(  3033.26f,   -576.72f,  -3048.78f,   1897.75f,
+                             -0.38f,  -2529.28f,   2197.72f,  -7303.19f,
+                           -358.72f,    -11.26f,     72.81f,  -2736.18f,
+                          -1152.08f,     32.85f,  -5634.06f,   1850.63f) },
+    { simde_mm512_set_ps(   -67.51f,     88.44f,    -93.84f,    -61.92f,
+                             80.76f,    -81.01f,     13.71f,      2.02f,
+                            -54.86f,     97.67f,     33.66f,      6.87f,
+                             12.22f,    -18.42f,    -38.88f,    -16.54f),
+      simde_mm512_set_ps(   -99.11f,    -63.26f,     61.29f,    -77.28f,
+                            -52.61f,      4.80f,     32.44f,     -3.18f,
+                             -0.38f,    -72.79f,    -67.83f,    -85.14f,
+                             39.96f,     88.64f,     98.95f,    -55.38f),
+      simde_mm512_set_ps(  6690.92f,  -5594.71f,  -5751.45f,   4785.18f,
+                          -4248.78f,   -388.85f,    444.75f,     -6.42f,
+                             20.85f,  -7109.40f,  -2283.16f,   -584.91f,
+                            488.31f,  -1632.75f,  -3847.18f,    915.99f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_mul_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mullo_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( -561478009, -1758906442,  1276070292,   347728745,
+                              348917920, -1397336415,  -701327244,  1726450220,
+                             1444073111,   979964495,  1473364010,   920533354,
+                             -667015385,   373253520,   831030180,  1045134572),
+      simde_mm512_set_epi32( -451014956, -1998522548,  1922184030, -1732951240,
+                            -1916291015,   663119453, -1736730415,    94615086,
+                               19863962, -1111082641,  -352262244,  1388157800,
+                              222798984,  1843194792,   636827980,  1911586740),
+      simde_mm512_set_epi32( 1195166156,   339551240,  -676495272,   -91948552,
+                             1505932192,  1141350013,   160388788,  -270918680,
+                              573965782,   884770625,  1446444952,   776765712,
+                            -1997879112,  1670764160,  -909469520, -1991448080) },
+    { simde_mm512_set_epi32(-2024379492,  1879253111,   252128674,  1565117431,
+                              624605748,  1572047811,  2061448374,   578528429,
+                             1454289765, -1698891143,  1321940383, -1990786419,
+                              521833309,   810098892,   -41183393,   163440867),
+      simde_mm512_set_epi32(-1526402265,     6750252,  1095152713, -2121854435,
+                             1248851569,  1578387544, -1652485728, -1731135515,
+                             -902388770,  2120952777,  -771598985,   221324652,
+                            -1650347427,   754348003, -2141584908,  1260177348),
+      simde_mm512_set_epi32( -524322620,  1349162100,  -244454606,  -940279557,
+                            -1570363148,   977462024,  -877197376, -1458751039,
+                             -251207530,  2063989761,  -226379799,   705721468,
+                             1879591625,   437815524,  -334912116,   256033484) },
+    { simde_mm512_set_epi32(  354867440,   977735551, -1226880879, -1512528369,
+                             -453451661,  -575023713,  1217476252, -1685007253,
+                             -820134838,  2100118988, -1938030167,  1407878053,
+                              983221926, -1039672048,  1554187560,   136109959),
+      simde_mm512_set_epi32(-1073634812,   272529271, -1179927569,   682807346,
+                              -97800752, -1045527004,  -268724804,  1397743010,
+                            -2012685380,   240000393,   511357542,  1092654547,
+                              612116523,  1572953361, -1008973758, -1562486509),
+      simde_mm512_set_epi32(-1026341952,  -805421815,   374450783,   967483118,
+                              993334384, -2063252388,   -27203952, -1223963978,
+                            -1137077160, -1974831572,  -887477418,    42568191,
+                            -1754182174,   920944144, -1579510704,  -387152379) },
+    { simde_mm512_set_epi32( 1333667192,  -541931596,  -110909841,  1265085263,
+                            -1564761840, -1382174538,   786134799,   660143613,
+                             1982978100,    78513877,   533701306,    69047361,
+                              738597074,  -537580131, -1261674685,  -511383737),
+      simde_mm512_set_epi32( 1932914473,  1902936810, -1993400532,   716831565,
+                             -305267230, -1708250049,  1510980325, -2026662577,
+                            -1286598964, -1595572270, -1986170028, -1418240971,
+                              173390671,  -187875185, -1410742483, -1629053898),
+      simde_mm512_set_epi32(  705103928,  -154930552,  -475460588,   356252611,
+                             -509542368,   283231434, -1632410005,  -189685229,
+                             -708107920,  1756251578,   206369544,  -794948235,
+                             2075987662, -1877689677,   452252615,   717360378) },
+    { simde_mm512_set_epi32( -595032259, -1997467893, -1077728201, -1030672832,
+                             1605292513,  -814529657,   912909222,   376846165,
+                            -1728653791, -1219597204,   404602000,   711905969,
+                              901089333,  1491719529,   287336951,  1223529459),
+      simde_mm512_set_epi32(  675106682,   -39740296,  -614492517,  -647009862,
+                             1419281618,  -992885177,  1345555302,  2070595201,
+                              619715759,   139976510, -1583337376,  -106231196,
+                             1434164015,  -814487926,  1415690621,  1343896489),
+      simde_mm512_set_epi32(  -61520366,  1796522280,  -327352499,   926145152,
+                              322449042,   745088113,  1725814308, -2138071083,
+                             -216531825,  -299608536,   142718464,  -859818204,
+                             -800909125,  -923508582,   -67224421,  -593646485) },
+    { simde_mm512_set_epi32( 2138583165, -1839856471, -1550214228,   405422073,
+                            -1661717171, -1569784635,  1843135903,   113930509,
+                              -77879142,   341119418, -1434059554,  -584716674,
+                             1701944740,  1168355785,  -541855410,  1111803490),
+      simde_mm512_set_epi32(  151263221,  -621915085,  1865504510,  1874242881,
+                             1642318419,   436291832, -1260303467,  1834162063,
+                               62738733,  1179414799, -1701056605, -1373662235,
+                            -1960253273,  -392498821,  -820106717,  1759920994),
+      simde_mm512_set_epi32( -246046047, -1614257749,  1285569704,   570131257,
+                               92473847, -1855895848,   594795147,   729043267,
+                             1999068434,  -586734618,  1355629402,   539144374,
+                             -778406404, -1427200877,  1951713706,  1783338884) },
+    { simde_mm512_set_epi32(  -68039552,  -493293876,   250957790,  1636661022,
+                            -1872279893,   -60219093,  1755416212,   790881764,
+                            -1359225381, -1980490631, -2075393997, -1734149558,
+                             2060024977,  1472462085,   900589199,  1942968188),
+      simde_mm512_set_epi32(-1618523234,   171990908, -1944076745,    90927672,
+                             1675911384, -1518306368,   823929785,  2019968630,
+                              148736197,   851626328, -1064260941,  1221683036,
+                             -158074748,    96462143,  1328078406,  2133790511),
+      simde_mm512_set_epi32(-1381648640,   766598864,  1541205170, -1249416560,
+                            -1561345976,   508070208,  -897245964,    71323416,
+                             -742583929,  1274464920,  1442185641, -1817200488,
+                             1574154948,  -901006021, -1563095782,   -51031100) },
+    { simde_mm512_set_epi32( 1098881612,  -465777853,   603813789,  1855392755,
+                              577753730,  1749204092,  1308221301,  1407131008,
+                            -1397591461,  1594889486,  1828378645, -1465607201,
+                             -831204495,   -76502773,  -865036729,   899688134),
+      simde_mm512_set_epi32( -749844669,   -32338033, -1826060258,   364229877,
+                             -118807599,  -779553668, -1013007956,   790636215,
+                              -26982845,  -671551772,   823718231,  -264111198,
+                              717017450, -1739771204,  -387338740, -1418621849),
+      simde_mm512_set_epi32(  794326500,   943060845, -1228444570,  1824803727,
+                            -1805082078,  2044296208,    -7098468,  1121916544,
+                             -209399855,  -982137736,  1973629987, -1063434210,
+                            -1376072246,   135219732,   973753684, -2012618326) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mullo_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_or_si512(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( 1526221816,   383462225,   699927303,  1531162913,
+                             2140590523, -1031705753,  -643232910, -1693960145,
+                            -1611308599,   884082026,  -423443116,  1183752185,
+                             -385739878,  -952803005,  1349659840, -2069070912),
+      simde_mm512_set_epi32(-1869062278,   951650170,  -758463141,  1695689119,
+                            -1261005981,   484227925,  -155440131, -1827089060,
+                             1336664539,  1812789925,  1235714382, -1484948978,
+                              298341087, -1173309616,  1828038427,  -627636530),
+      simde_mm512_set_epi32( -621256710,  1056649083,   -67448993,  2136193471,
+                               -2698245,  -555877513,    -4379649, -1692861057,
+                             -536878629,  2092892143,  -270023330,  -402653185,
+                             -104180769,   -13240493,  2096607195,  -557875250) },
+    { simde_mm512_set_epi32(    9707601,  -903060203,  -965826059,  -421510761,
+                              904247082,   210075549,   231093876, -1987804971,
+                             1838071008,  1193152486, -1047966290, -1020248738,
+                            -1804353422, -1861589631,  -971562156, -1613955078),
+      simde_mm512_set_epi32( 1835088962,  2021867309, -1713166373, -1637981572,
+                              863666417,  -774668868,  1862483214,  1620779792,
+                             2135859014,   861876314,  -310189359,  1144796729,
+                              664352399, -1282002142,   785561131, -1972691502),
+      simde_mm512_set_epi32( 1844788307,   -89161923,  -537939969,   -16882689,
+                              939505659,  -573079619,  1875328894,  -375413803,
+                             2144255974,  2002731006,  -309596161,  -952352897,
+                            -1208224001, -1281460317,  -287852673, -1611661318) },
+    { simde_mm512_set_epi32( 1851745529,   819162417,  1450828341, -1822899361,
+                              589759454, -1181183447,   555980078, -1316796401,
+                             -923072893, -1090403193,  1336345635,  -115729993,
+                            -1381829663,  -838870217,    65285243, -1125353687),
+      simde_mm512_set_epi32( 1513201143, -1413874158, -1140313629,   286479679,
+                             -606348014,  -580193095,  2093896908,   -25449476,
+                              523896147,   672794026,  -468462312,   -16909288,
+                             -706697662, -2070626673,  1323604875,  1339030582),
+      simde_mm512_set_epi32( 2122317311, -1141113037,   -25562121, -1822697601,
+                              -67117090,   -33884487,  2112869870,     -267265,
+                             -537196589, -1088698961,  -273164997,        -577,
+                              -35457053,  -838860865,  1340391419,    -1048769) },
+    { simde_mm512_set_epi32( -343808623,   279820344,  1009777698,  -324786010,
+                              120512288,   582333875, -2106857030,  1339994050,
+                               17228503, -2118029175,  -125253235,   290331990,
+                              800329960, -1745983624,   972429457,  -768714129),
+      simde_mm512_set_epi32(  -70715232,  -892995344,   391891584,  1643726773,
+                            -2101618957,  1653331999,   -66578061,  2032213284,
+                             1248467135, -1243576873,    20964719, -1804329674,
+                              687586901,  -764817967,   -96834609, -1570845009),
+      simde_mm512_set_epi32(  -70648399,  -621938440,  1065352866,  -302157897,
+                            -2017468429,  1656749503,   -26478085,  2147467238,
+                             1265564415, -1243482657,  -104862225, -1786897034,
+                              805289725,  -672141319,   -67208225,  -226566417) },
+    { simde_mm512_set_epi32(-2049404639, -1825522467,  1999321172, -1560063525,
+                            -1563690455,  -502478584,  1283351173,   273860312,
+                              729297470,   517686541,  1414062765,  1412774814,
+                             -726048132,  -487093000,  2033258647,  -644739113),
+      simde_mm512_set_epi32(  220349701,  1133894998,  -482086437,  -757171552,
+                             -787911823,   442033313,  -323907111, -1248238585,
+                             1290008730,  1963204449,  -349222184, -2057275174,
+                              816954030,  1441465918, -1493249826,  1134991993),
+      simde_mm512_set_epi32(-1912941275,  -743047713,  -143918625,  -203457541,
+                             -204735623,   -94573143,  -318770211, -1243879713,
+                             1878784702,  2145345389,    -9442563,  -713720866,
+                             -189138178,  -134246658,      -12065,  -608788481) },
+    { simde_mm512_set_epi32(  738130976,  -749560604, -1109479203, -2134023075,
+                              552879543,  1383589716,   835678919,   217778521,
+                              939056788,   -98782635,   230133552, -2040479678,
+                             -442900609,  -415629963, -2019301748,  1542092115),
+      simde_mm512_set_epi32(   71274202,  -822683320, -1855107199,   562801761,
+                             -504432736, -1450236579,   275597809,  1066060717,
+                             -996770469,  1950919221,   517213936, -1172154141,
+                             -110240397,  -759849091,  1267845816,  1009069163),
+      simde_mm512_set_epi32(  805306106,  -537469460, -1107296291, -1580209027,
+                             -503384137,   -67115171,   837778423,  1073466365,
+                             -134283297,   -27477387,   536317936, -1100818205,
+                              -33693825,  -138543235,  -810291524,  2146401659) },
+    { simde_mm512_set_epi32( -135520206,  -977913171,  1649013712, -1180387937,
+                             -687828072,  -724675747,  -332647704, -1431089821,
+                             -944357640, -2096765686,   230624462,  1115274499,
+                             -400368912,  1517326649,  1156568512, -1147076445),
+      simde_mm512_set_epi32(    2655706,  1530701095, -2117993326,   804579591,
+                            -1088098348,  -310277777,  -487643588, -1012749967,
+                             2137668286,   515203466,    40399741, -1973378189,
+                             1749919856,  1780788994,  1104445601, -2083038350),
+      simde_mm512_set_epi32( -135485958,  -541147217,  -473301038, -1074463329,
+                              -14352420,   -36709505,  -286312708,  -340529805,
+                                -114946, -1615469174,   268402687,  -897990797,
+                             -395314448,  2054471483,  1174394337, -1141416973) },
+    { simde_mm512_set_epi32(  -57142519,   259698227, -1438700740,    74624720,
+                            -1489648251,  1219068785,  1136057475,   367587361,
+                             1516278659,   986775146,   560722777,   263893982,
+                            -1897315326,  2091590173,  2037042783, -1520172976),
+      simde_mm512_set_epi32( 1501641754,  1187665426,  1371249842,  1498790606,
+                             1159048023,  1791691798,   540595489, -1149736838,
+                              780128334, -1517029334,   792897454,  1579087819,
+                             1770385779,   669980217,  1828959479, -1688894237),
+      simde_mm512_set_epi32(  -40288485,  1341849139,   -71319618,  1568128734,
+                             -415895593,  1793822583,  1673452963, -1074202501,
+                             2122306511, -1076625814,   795604991,  1606350815,
+                             -269617805,  2146383421,  2104229631, -1082817293) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_or_si512(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_add_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    int32_t r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( -518908365,     1366791,  -327914723, -2128678005,
+                             -226088602, -1861750341,  1414574477,  1196625541,
+                             1524579665, -1089833836, -1094093299,  1139304184,
+                             2141668838, -1371607037,  2026708001,  -537414690),
+      INT32_C(  288538599) },
+    { simde_mm512_set_epi32(-1569559003,  1323975883,  2045632212,   812054364,
+                            -1119394587, -1960218774,  1893911514,  1355264188,
+                             1936567176, -1763285379,  -478433159, -2132558048,
+                             -598010623,  1566930897, -1949042928,  -564802473),
+      INT32_C(-1200968740) },
+    { simde_mm512_set_epi32(-1075030062,  -840493629,  1277430727, -1762381565,
+                            -1829832988,  -489730042,  -874812915, -1731404221,
+                             1896396789,  -558523508, -1761024703,   426518283,
+                              450121183,  1174756994,   898433312,  -505634821),
+      INT32_C(-1010243870) },
+    { simde_mm512_set_epi32( 1345800399,  1511859274,  -251366140,   566494935,
+                             2041626706, -1915424482, -1147447210,  -294853088,
+                             -689633449,   837227960, -2012247282,   254926652,
+                            -1021508771,  2103072279,   154314837, -1719937419),
+      INT32_C( -237094799) },
+    { simde_mm512_set_epi32( 1304778356, -1614674755, -1620613076,   877890692,
+                              999687583,   -70485711,   361707456,  1747177789,
+                               18136405,  1074020617,  -207729922,  1715670257,
+                             1224425238,  1689680880, -1437355184,  1004923260),
+      INT32_C(-1522694707) },
+    { simde_mm512_set_epi32( 1081627825,  -313665105,   981922624,   464345203,
+                             -993496779,   755523285,   202542295, -1847440378,
+                              854218202, -1384935837,  -813415894,  1656740370,
+                             1640675452,  1835929117,  -820622285,  -432947456),
+      INT32_C(-1427966657) },
+    { simde_mm512_set_epi32(  114519820,  1750572003,  -625528279,  1158444837,
+                             -869641267,  1343548117,   755402620,   241036913,
+                            -1402637350,   257274127, -1818988542,   455307784,
+                              245395369,   465452664,   481815491, -1453183475),
+      INT32_C( 1098790832) },
+    { simde_mm512_set_epi32(  366034611,  -576881425,  2125076276,   -92272934,
+                             1444479075, -1620345113,  1835045983,   780898637,
+                             1935188554,  1071047976,  -979041341,   -82721411,
+                              100865613,  1812066183,  1128466307, -1610507366),
+      INT32_C( -952534967) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm512_reduce_add_epi32(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_add_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    int64_t r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 4142337515506199842), INT64_C(-6746909008465961618),
+                            INT64_C( 8557548970053931275), INT64_C( 2546171658152974995),
+                            INT64_C(-3420153411082174653), INT64_C(-5548707698589124275),
+                            INT64_C(-5638378056769180798), INT64_C(-1565350541656820180)),
+      INT64_C(-7673440572850155412) },
+    { simde_mm512_set_epi64(INT64_C( 5778798339926845721), INT64_C(-6493232814591596813),
+                            INT64_C( -866644441330069771), INT64_C( 3463220054202067235),
+                            INT64_C( 6036417046686627730), INT64_C(-7843189511903251748),
+                            INT64_C( 8284725422739956996), INT64_C( 9000962142951865433)),
+      INT64_C(-1085687835027106833) },
+    { simde_mm512_set_epi64(INT64_C(  -57345366476684496), INT64_C(-5220896176071796238),
+                            INT64_C( 2881458096556199092), INT64_C( 1047952436973025972),
+                            INT64_C(-8968362882214993284), INT64_C( 1645333461206990384),
+                            INT64_C( 2404933635931807407), INT64_C(-1892650964759719872)),
+      INT64_C(-8159577758855171035) },
+    { simde_mm512_set_epi64(INT64_C(-5199388752971221717), INT64_C(-6289746662997335766),
+                            INT64_C(-3559430224350325600), INT64_C( 8861209898316106384),
+                            INT64_C( 2582503134071552073), INT64_C(-5448331099111325878),
+                            INT64_C(-5093514922757956931), INT64_C( 5768352792300646940)),
+      INT64_C(-8378345837499860495) },
+    { simde_mm512_set_epi64(INT64_C( 4189706209081692055), INT64_C(-9156394517567955156),
+                            INT64_C(-2593960026135380862), INT64_C(-6186794496434428683),
+                            INT64_C(-4494416871268453038), INT64_C( 2090662948105607932),
+                            INT64_C(-8167521557268003512), INT64_C(-6972944911558222975)),
+      INT64_C( 5601824924373958993) },
+    { simde_mm512_set_epi64(INT64_C(-4984380572565543903), INT64_C( 5416188988530450676),
+                            INT64_C( 5065664313609619793), INT64_C(   92183630130248340),
+                            INT64_C(-8196561064388075017), INT64_C( 8964764595841456375),
+                            INT64_C( 2221588541343483322), INT64_C(-1034708951398500092)),
+      INT64_C( 7544739481103139494) },
+    { simde_mm512_set_epi64(INT64_C(-1124647461808037994), INT64_C( 8416425346209838687),
+                            INT64_C(-8334515206069192763), INT64_C(-8031178065604682174),
+                            INT64_C( -328457957656030545), INT64_C( 8641252784258460341),
+                            INT64_C( 1669999103726861844), INT64_C(-7924396409860150711)),
+      INT64_C(-7015517866802933315) },
+    { simde_mm512_set_epi64(INT64_C( 6800417529261012973), INT64_C(-1367401874155173086),
+                            INT64_C(-8027277234296179311), INT64_C( 2211742575205336118),
+                            INT64_C(-6051809848847577214), INT64_C(-7784051119454453892),
+                            INT64_C( 5667423730766254009), INT64_C( 7997022828823826058)),
+      INT64_C( -553933412696954345) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int64_t r = simde_mm512_reduce_add_epi64(test_vec[i].a);
+    munit_assert_int64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_add_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde_float64 r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -695.11,   -986.17,   -492.75,    752.95,
+                            662.50,   -611.55,    723.80,   -882.30),
+       -1528.63 },
+    { simde_mm512_set_pd(  -517.44,   -805.93,   -495.30,   -491.75,
+                           -617.54,     55.73,    -66.17,    237.81),
+       -2700.59 },
+    { simde_mm512_set_pd(   181.07,     94.05,   -380.35,     20.63,
+                            313.11,    360.09,    121.88,    737.38),
+        1447.86 },
+    { simde_mm512_set_pd(  -296.06,   -637.83,    948.84,    899.06,
+                            -74.90,    285.12,   -517.45,   -807.80),
+        -201.02 },
+    { simde_mm512_set_pd(  -276.69,    251.36,   -210.65,    722.76,
+                            109.39,   -945.33,    654.46,    531.64),
+         836.94 },
+    { simde_mm512_set_pd(   167.21,   -364.73,   -108.77,   -683.03,
+                           -620.52,   -581.28,   -170.59,    314.23),
+       -2047.48 },
+    { simde_mm512_set_pd(  -805.21,   -131.92,    715.54,   -873.14,
+                            152.44,    235.90,   -318.12,     62.08),
+        -962.43 },
+    { simde_mm512_set_pd(  -534.15,    599.47,    642.77,   -840.06,
+                           -914.29,    -19.08,    878.09,   -101.59),
+        -288.84 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 r = simde_mm512_reduce_add_pd(test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_add_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde_float32 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(   343.03f,   -669.84f,    798.60f,   -551.67f,
+                            349.17f,    585.60f,   -738.77f,   -114.18f,
+                           -901.74f,   -552.61f,   -737.80f,   -571.79f,
+                            127.59f,   -195.96f,   -939.20f,   -187.88f),
+       -3957.45f },
+    { simde_mm512_set_ps(  -292.10f,   -873.15f,   -624.25f,   -831.83f,
+                           -794.23f,    801.05f,    605.63f,    534.94f,
+                           -461.38f,    823.43f,    164.66f,    844.65f,
+                            709.86f,    402.01f,   -562.77f,   -171.44f),
+         275.08f },
+    { simde_mm512_set_ps(  -441.08f,   -702.70f,   -332.75f,    918.62f,
+                           -582.21f,   -259.73f,    865.97f,    341.92f,
+                            133.02f,    299.39f,   -988.05f,   -596.59f,
+                            741.90f,   -833.49f,   -224.43f,   -137.79f),
+       -1798.00f },
+    { simde_mm512_set_ps(  -130.08f,   -788.09f,    930.27f,   -293.65f,
+                           -942.77f,   -928.23f,    372.45f,    912.58f,
+                           -953.45f,   -598.10f,   -919.87f,    753.49f,
+                            287.61f,    640.49f,   -255.14f,    114.86f),
+       -1797.63f },
+    { simde_mm512_set_ps(   223.19f,   -944.42f,   -632.45f,    407.38f,
+                            376.28f,   -281.91f,    725.26f,   -458.43f,
+                            852.61f,   -664.21f,   -584.10f,    164.39f,
+                            799.28f,    590.66f,   -261.41f,   -829.62f),
+        -517.50f },
+    { simde_mm512_set_ps(  -534.45f,    924.56f,   -300.78f,    177.35f,
+                            161.58f,   -184.22f,    255.90f,     36.36f,
+                           -857.27f,   -376.24f,    950.90f,    -79.11f,
+                            709.15f,    575.53f,    423.50f,   -476.75f),
+        1406.01f },
+    { simde_mm512_set_ps(  -524.20f,    235.80f,   -282.76f,   -868.87f,
+                            514.57f,    332.32f,    932.88f,   -437.78f,
+                            687.35f,    138.11f,    508.37f,   -892.51f,
+                           -149.77f,   -961.33f,    781.66f,   -375.09f),
+        -361.25f },
+    { simde_mm512_set_ps(  -773.66f,   -848.88f,   -393.05f,   -472.08f,
+                            856.45f,   -756.43f,   -823.67f,   -859.03f,
+                            320.28f,    348.81f,   -788.47f,    294.47f,
+                            760.22f,    127.66f,    420.06f,    711.05f),
+       -1876.27f }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 r = simde_mm512_reduce_add_ps(test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_max_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    int32_t r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(-1344938270,  -889195547, -1566577892,    47111820,
+                              206101255,  1762530646,   492081337,  1143535388,
+                             1718277037,  -440356917,   835251697, -2125878743,
+                              346663806,  2119260868,   316920038,   966531007),
+      INT32_C( 2119260868) },
+    { simde_mm512_set_epi32( 1500004831,   274886681, -2029766167, -1319653403,
+                             -745193705, -1390298191, -1175737137,  -190910480,
+                              317128375,  -903689558,   635276946, -1911914746,
+                            -1662345256,  1253465638,  1158242516, -1451953618),
+      INT32_C( 1500004831) },
+    { simde_mm512_set_epi32(  221403231,  1634434541,   594101950,  1740918638,
+                              821876933,  1190205949,  1251578194,  -732282042,
+                            -1334634867,   727631982,  1479127500,  -396935961,
+                              963471887, -1097233254,   430825583,  1833523513),
+      INT32_C( 1833523513) },
+    { simde_mm512_set_epi32( -550758752,  -139572666,   886982256,  1017976644,
+                            -2032817476,  -637293605,  -756500173,  1270118510,
+                              329180177, -1434888267,  -450004911,  -322716374,
+                             -173579660,  1853865204, -1107904772, -1611747050),
+      INT32_C( 1853865204) },
+    { simde_mm512_set_epi32(-2083575302,   351575472,   745914527,   806932605,
+                                3352109, -1852691414,   128675988, -1649333393,
+                             -139012720,   240269142,  1065129206,  1141911150,
+                              691935703,   682740218,   895855974,  -867719427),
+      INT32_C( 1141911150) },
+    { simde_mm512_set_epi32( 1792301229,  -100292097,  1912101983,   754910218,
+                             -261508337,   757061763,   993691549, -2028300024,
+                              194789041,  -741942488,   453270957, -1989066986,
+                            -1975029140,  1821761817,  -594232100, -1350740210),
+      INT32_C( 1912101983) },
+    { simde_mm512_set_epi32(   74007941,   774140690,   628552499,  -956028099,
+                             2095039304,   -93823561, -1806319827,  -346903872,
+                              923286573,  2111970987, -1215947574,  -570547340,
+                            -1934536455,  1411018042,  2068807726,  -286309719),
+      INT32_C( 2111970987) },
+    { simde_mm512_set_epi32(  661919812,   346630894,   -27708000,  1055781344,
+                             -820154114,  1614734207,  1285717342,  1102818618,
+                            -1813542234,  -793902570,  -384924030,  1777059939,
+                             -514860688, -1831424267,  1148611404,   787554874),
+      INT32_C( 1777059939) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm512_reduce_max_epi32(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_max_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    uint32_t r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32( -184494642,  1657901881,   742883170,   648954899,
+                             1273863189,  -700389051,  -236311031,   133610796,
+                             -251344339,   111435942,  1729543742,  -818601010,
+                              194258684,   422138056,   991625368,  1956592524),
+      UINT32_C(4110472654) },
+    { simde_mm512_set_epi32(-1398928781,  2031346616,  1764648246,  1675096812,
+                              768190343,  1395569330, -1973555388,  -298480093,
+                            -2031800210,  -889616824,  -619930928,  1560956376,
+                            -1527856263, -1692743595, -1167484087,   442091019),
+      UINT32_C(3996487203) },
+    { simde_mm512_set_epi32(-1783172877,  1640074791,   407305452,  1174466522,
+                              -25399821, -1825836937,  1470948152,   -62728163,
+                             1890526559, -1057918510,  -510437489,   667415237,
+                             1919520941,  1661113543,  1810493300,  -769162486),
+      UINT32_C(4269567475) },
+    { simde_mm512_set_epi32(-1396391493,   587454336,   325391384,  -166016207,
+                            -1069183378,   494196305,   991547755,   351442774,
+                             -517557700,   976488009,  -191254233,   900474930,
+                              694659472,   619029238, -1630444354,  -147843227),
+      UINT32_C(4147124069) },
+    { simde_mm512_set_epi32( -896079754,    -4893191,   825209956,  -291317125,
+                            -1931181648,  1925366502,  1814249181,  1775368687,
+                             -295525541,  1884022391,  -383922994, -2105603317,
+                             1244654690,  1291287661,  1059830327,  1080230147),
+      UINT32_C(4290074105) },
+    { simde_mm512_set_epi32( -981918192, -1961289719, -1130950848, -1254840684,
+                             -463511320,   -81777475,  1096290684,  1285093014,
+                             1692973905, -2097618346,  -204761680, -1269227245,
+                            -1761833792,  -152678728,  1914898679,     -336996),
+      UINT32_C(4294630300) },
+    { simde_mm512_set_epi32(-1184959010,  1047086947, -2049824715,  2112217606,
+                             1869136313, -2086711091,  2019770550, -1657294127,
+                             2137701099, -1412213736,   670354146,  1600878801,
+                            -1402660146,   662208331,  2024159271,   171214664),
+      UINT32_C(3110008286) },
+    { simde_mm512_set_epi32(  623843177,   973369370,  -336368240,  1231436789,
+                             1576478927,  -312754400, -1514775790,  1249736922,
+                             1478646849,  2137970675,  -974808096,  -587163034,
+                             1667179546, -1357052867, -2033508642,  1437825730),
+      UINT32_C(3982212896) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_mm512_reduce_max_epu32(test_vec[i].a);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_max_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde_float64 r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -118.56,    814.84,   -543.96,   -889.80,
+                           -858.39,   -670.38,    223.33,    768.14),
+         814.84 },
+    { simde_mm512_set_pd(   725.95,   -267.84,    288.99,    162.38,
+                           -769.23,    315.24,   -772.12,    530.62),
+         725.95 },
+    { simde_mm512_set_pd(  -654.43,    950.13,    955.21,   -576.77,
+                            -71.43,   -277.39,   -474.72,    -29.40),
+         955.21 },
+    { simde_mm512_set_pd(   913.08,    442.93,   -470.30,   -998.03,
+                           -786.83,   -765.87,   -867.65,   -503.22),
+         913.08 },
+    { simde_mm512_set_pd(   866.83,    -38.07,   -993.83,    301.62,
+                            192.58,   -354.37,   -312.03,   -325.10),
+         866.83 },
+    { simde_mm512_set_pd(  -947.05,   -730.33,    -82.95,   -696.04,
+                           -301.70,   -376.07,   -837.01,    304.04),
+         304.04 },
+    { simde_mm512_set_pd(  -915.86,    453.92,    749.37,   -977.06,
+                            424.18,   -696.03,   -396.93,   -788.24),
+         749.37 },
+    { simde_mm512_set_pd(  -740.15,    688.06,    273.36,    430.07,
+                            315.29,    569.86,   -168.18,   -157.81),
+         688.06 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 r = simde_mm512_reduce_max_pd(test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_max_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde_float32 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(   870.40f,    363.33f,   -460.75f,     57.96f,
+                            476.89f,   -984.77f,    375.07f,     54.40f,
+                            141.75f,   -385.08f,   -972.71f,    505.36f,
+                           -702.58f,   -133.64f,   -478.24f,   -218.77f),
+         870.40f },
+    { simde_mm512_set_ps(  -566.07f,    659.54f,   -343.77f,    780.02f,
+                            487.23f,    794.09f,    253.57f,    984.04f,
+                            965.62f,   -359.24f,    319.41f,    350.91f,
+                           -799.82f,   -253.86f,    672.46f,   -662.79f),
+         984.04f },
+    { simde_mm512_set_ps(   271.05f,    881.62f,   -984.92f,    835.97f,
+                            532.73f,   -534.53f,    882.59f,   -740.73f,
+                            212.08f,   -471.52f,   -460.38f,    409.49f,
+                           -170.80f,   -881.85f,    223.36f,   -351.64f),
+         882.59f },
+    { simde_mm512_set_ps(   762.00f,   -181.94f,   -798.45f,    961.47f,
+                            287.55f,   -737.39f,   -211.27f,   -985.06f,
+                           -372.66f,   -646.99f,   -926.09f,    221.72f,
+                           -847.45f,    416.63f,    762.00f,   -755.86f),
+         961.47f },
+    { simde_mm512_set_ps(  -839.37f,    784.44f,   -260.81f,     28.89f,
+                            796.19f,    958.75f,     41.51f,    746.92f,
+                           -923.06f,     13.00f,   -699.27f,   -384.10f,
+                            405.43f,   -678.80f,    618.68f,   -153.22f),
+         958.75f },
+    { simde_mm512_set_ps(   474.82f,    -65.24f,     72.12f,    373.37f,
+                           -946.37f,    -37.57f,   -188.66f,    713.34f,
+                           -159.86f,   -390.77f,    252.59f,   -987.99f,
+                            230.88f,    440.89f,    859.17f,   -275.50f),
+         859.17f },
+    { simde_mm512_set_ps(  -308.34f,    366.73f,   -853.17f,    246.60f,
+                            905.02f,   -120.57f,   -844.80f,    773.23f,
+                            622.42f,    901.12f,    635.78f,   -919.86f,
+                            136.61f,   -356.18f,   -220.25f,    331.26f),
+         905.02f },
+    { simde_mm512_set_ps(  -427.39f,   -153.31f,    828.73f,    466.53f,
+                           -441.86f,   -925.10f,   -955.22f,    884.38f,
+                            902.41f,   -514.45f,   -745.57f,    967.04f,
+                            608.94f,   -868.54f,    330.49f,   -971.59f),
+         967.04f }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 r = simde_mm512_reduce_max_ps(test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_min_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    int32_t r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(  179542649,  1065912615,  1267564819,   310607137,
+                             1432332911, -1027750219,  1345360426,   -74128652,
+                            -1949229312,  -349171132, -1570272443,  -790099952,
+                             1445007406,  -401246264,   822487065, -1727837921),
+      INT32_C(-1949229312) },
+    { simde_mm512_set_epi32(  898751173,  -849662025,  1298275129,   391428796,
+                             -733383581, -1301730598,   981409474,   633703830,
+                             -154983279, -2010905432, -1422996104, -2038264733,
+                            -1130004370,  1767169846,  -590249098, -1917320039),
+      INT32_C(-2038264733) },
+    { simde_mm512_set_epi32(  519662105,   272692476, -2079834954,  2020338837,
+                              584694345, -1251132017,  1584177432, -1160293952,
+                            -2136535196, -1179997271,   769721563,  -137675473,
+                             -930634771, -1680004879,  1987804992,   968191814),
+      INT32_C(-2136535196) },
+    { simde_mm512_set_epi32( -442396444,  -974654720,  2136646952,  -472706489,
+                            -1465722607,   555282043, -1237023395,  -807907305,
+                            -1297781710,  -164151443,  -877748121, -1380341696,
+                              278144622,  1997926834,  -807316376, -1924752144),
+      INT32_C(-1924752144) },
+    { simde_mm512_set_epi32(  649541405,  2090804679,   593981772,  2093126107,
+                             2017373473,   344655561,  1890724803,  1407475150,
+                             1042162327,   318463255, -1694980290, -1885542849,
+                              738216296,   366480777, -1799236583,   959554553),
+      INT32_C(-1885542849) },
+    { simde_mm512_set_epi32( 1761536364, -1321392634,   941858443,  1443959420,
+                            -1593320382,   562538780,  1390490287,    65219087,
+                               42615810, -1175842756,  1546269761,   529024611,
+                            -1372167467,  1192157673, -1669198684,   640957916),
+      INT32_C(-1669198684) },
+    { simde_mm512_set_epi32(-1017568635,   236712972,  -986210816,  1001055832,
+                             -883084214, -1465111707,  2010224125, -1787012120,
+                             -891613713, -1640988850,  1315573105,  -417601068,
+                             1082314214,  1087590337,  1292241814,   -90608824),
+      INT32_C(-1787012120) },
+    { simde_mm512_set_epi32( -795517192,  -757482294, -1536580817, -2053608598,
+                             1871391934,  -361173050,  2032533403,   413247845,
+                             -863795949, -1912804754,  -152373863,  -504045134,
+                             1262118385, -1556461066,  1532555343, -1034537770),
+      INT32_C(-2053608598) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm512_reduce_min_epi32(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_min_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    uint32_t r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(-1004824169,  -245882567, -2116380645, -1994291216,
+                              883176973,  1798889420,  -195891501,  -616790107,
+                             1702182580,  2139794210, -1060281461, -1492773663,
+                             -222497659,   219651237,  -527387626,   521617620),
+      UINT32_C( 219651237) },
+    { simde_mm512_set_epi32(  434685968,  -558745884,   562233266,  -979491989,
+                             -547958490,   339033346,  -381061587,   799723402,
+                             -286397787,  1238381855,  -382646242,  2053449393,
+                              -58316683,   820680028,  -272714526,   315022659),
+      UINT32_C( 315022659) },
+    { simde_mm512_set_epi32(-2137444790, -1868685046,   427856395,  -717962221,
+                             1651875366,  -995631780,   571295136,  1999459068,
+                             -572438366, -2010420709,   798900171, -1691037545,
+                             1442244032, -2123932431,   194480970, -1450935175),
+      UINT32_C( 194480970) },
+    { simde_mm512_set_epi32( 2026775191,  1517160255, -1417155464,  1952649563,
+                             1364552355,  1855209790,  -108292576, -1331485085,
+                             1624582570,  2132434980,   593975127,  -307100894,
+                             1713582782,   494657867,  1847384904,  1971127561),
+      UINT32_C( 494657867) },
+    { simde_mm512_set_epi32( -993138893,  -648157009, -2038940766,  -750206777,
+                            -1864564521,   615250564, -1401720685,   751743585,
+                              -81734798,   667056799,  -891246604,   385713643,
+                             1646452684,  -572291637,  1010439021,    95970475),
+      UINT32_C(  95970475) },
+    { simde_mm512_set_epi32( -318152916, -1520234819,  1338685461, -1566960397,
+                             1631788501,   949088176,  2093757058,   639399526,
+                            -1041485979, -1445691396,   709173020, -1790185683,
+                            -1647894297, -1774661016,  -578009390,   406002669),
+      UINT32_C( 406002669) },
+    { simde_mm512_set_epi32( 1926887350,   613449019,   110574101,   601324790,
+                             -926579875, -1620811407,  -669884116,  -363732033,
+                             1974355230, -1964039096,  1546346005,   550615943,
+                             1223492063,  -322499928,   706846392,  -780965957),
+      UINT32_C( 110574101) },
+    { simde_mm512_set_epi32( 2079183941,  1859721147,  1686588687,   833902686,
+                              179362861,  1732545903,  1834253711, -1214225916,
+                              499051631,  -388967853,  -181245237, -1560127958,
+                             -793528226,   243774814,  1499749945,  -515305205),
+      UINT32_C( 179362861) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_mm512_reduce_min_epu32(test_vec[i].a);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_min_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde_float64 r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(  -495.94,   -947.45,    436.57,   -750.20,
+                           -756.95,   -524.27,   -516.77,   -364.67),
+        -947.45 },
+    { simde_mm512_set_pd(   491.72,    166.61,   -195.28,   -549.95,
+                           -251.91,   -150.79,   -567.87,    920.89),
+        -567.87 },
+    { simde_mm512_set_pd(    14.56,    -57.52,    217.24,   -976.19,
+                           -544.62,    201.00,   -225.98,     44.64),
+        -976.19 },
+    { simde_mm512_set_pd(  -285.28,    669.03,   -486.86,    741.43,
+                            124.88,    485.46,   -756.24,   -637.01),
+        -756.24 },
+    { simde_mm512_set_pd(   719.61,    693.67,    506.85,   -944.39,
+                           -671.79,   -873.75,    170.01,    198.48),
+        -944.39 },
+    { simde_mm512_set_pd(   270.46,   -172.10,   -827.00,    355.72,
+                            188.24,   -804.08,    712.89,    823.12),
+        -827.00 },
+    { simde_mm512_set_pd(   996.80,   -159.98,     -2.60,    954.64,
+                           -595.26,   -345.79,   -679.66,   -729.15),
+        -729.15 },
+    { simde_mm512_set_pd(   528.65,    979.44,    681.19,    224.63,
+                           -510.97,     34.00,   -849.48,   -275.13),
+        -849.48 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 r = simde_mm512_reduce_min_pd(test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_min_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde_float32 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(  -396.96f,    627.83f,   -829.14f,    557.50f,
+                           -773.25f,    564.84f,   -370.64f,   -113.47f,
+                           -290.90f,   -377.46f,   -688.63f,   -913.82f,
+                            556.02f,    408.82f,    -65.17f,    500.33f),
+        -913.82f },
+    { simde_mm512_set_ps(   325.52f,    585.99f,   -780.64f,    320.42f,
+                            581.60f,   -731.66f,    431.48f,    529.94f,
+                           -917.32f,   -596.01f,   -705.20f,    572.66f,
+                            215.18f,   -396.16f,   -133.30f,   -614.82f),
+        -917.32f },
+    { simde_mm512_set_ps(  -410.74f,   -899.60f,    116.58f,    -46.67f,
+                            927.58f,    499.26f,    -58.95f,    131.67f,
+                           -895.64f,    -82.41f,    183.01f,   -133.88f,
+                           -732.58f,    490.61f,     98.26f,   -363.82f),
+        -899.60f },
+    { simde_mm512_set_ps(  -421.39f,    276.47f,      5.20f,    379.14f,
+                           -500.05f,    583.22f,   -653.61f,   -705.20f,
+                           -617.37f,    346.00f,    542.32f,    741.50f,
+                            473.27f,    529.91f,   -476.74f,   -968.40f),
+        -968.40f },
+    { simde_mm512_set_ps(   416.92f,    806.99f,    481.08f,   -539.67f,
+                            764.04f,    909.76f,    649.99f,     21.19f,
+                           -158.11f,     71.16f,    112.30f,   -517.84f,
+                           -262.40f,    855.06f,    447.10f,    892.54f),
+        -539.67f },
+    { simde_mm512_set_ps(   321.50f,   -163.35f,    449.74f,   -242.54f,
+                            404.50f,    482.52f,    341.00f,    816.85f,
+                            614.61f,    899.49f,    711.94f,    447.26f,
+                           -762.20f,    816.57f,    652.19f,    506.15f),
+        -762.20f },
+    { simde_mm512_set_ps(  -787.21f,   -847.81f,   -453.71f,    435.62f,
+                           -493.52f,    332.10f,     28.98f,   -502.86f,
+                           -794.35f,   -471.18f,    514.59f,    215.11f,
+                            639.85f,   -161.50f,   -525.86f,    364.97f),
+        -847.81f },
+    { simde_mm512_set_ps(   348.70f,   -934.06f,   -489.11f,   -753.46f,
+                            624.96f,    -49.11f,    245.48f,   -965.98f,
+                           -755.95f,    955.71f,     23.61f,   -427.55f,
+                           -590.30f,    525.71f,    486.56f,   -917.90f),
+        -965.98f }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 r = simde_mm512_reduce_min_ps(test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_mul_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    int32_t r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(-1432503067,  1969463202,  -416285744,  -128209511,
+                            -1274860314,   412547839,  1423016174, -1879263672,
+                               64833532,  1868991917,   327766617,   515160572,
+                             -644095737, -2146154490,   225631716,   175583824),
+      INT32_C( -891289600) },
+    { simde_mm512_set_epi32(-1927094085,  1094664126,   753614289,  -981725403,
+                              610286409,   831085347,  2101391203,  -651298570,
+                              837823808, -1499927754,   697336833,  -437798536,
+                             1478004208, -1698300086,  1601864465,  -671305391),
+      INT32_C(  726794240) },
+    { simde_mm512_set_epi32( -206503308,   379784097,  -104134124,   144117099,
+                              223444476,  -731793215,  1287452214, -1278777746,
+                              426977282,   167459480, -1189059026,  -827622380,
+                             1648851779,  1561923116, -1504230233,  2064953883),
+      INT32_C(  -53870592) },
+    { simde_mm512_set_epi32(  319637285,   275491810,  1139590989,  1591901342,
+                              838952258, -1531354380,  1881470322,  -645287779,
+                            -1255093804, -1903502242,   379941859,  1623783794,
+                             -881097663, -1785582553,  -568119463, -2007470415),
+      INT32_C(-1315593216) },
+    { simde_mm512_set_epi32(  600854305, -1641423590,  1714681619,   -16132380,
+                             1919574265, -2054977259,  1729501400,  1932820128,
+                             -754071093,   153728288, -1919753131,   738844949,
+                             -523762328,   423940190, -1661738745,  1434849084),
+      INT32_C( -146800640) },
+    { simde_mm512_set_epi32(   34903705,  1229657982,  1546678738, -1142993106,
+                             -210677863,   668737351, -1207847985,   347130440,
+                             -676701449,   373706035,  1410538779,   952193253,
+                             -430870233, -1738499404,  1530664221, -1618320613),
+      INT32_C( 1611407104) },
+    { simde_mm512_set_epi32(-1284743744, -1748239627,   119153208,   761119025,
+                             -131089590,   289360967,  -348843779,   859037909,
+                             1423616222,   268020157,   876916074, -1122703443,
+                              993787472,  1382925548, -1968493053,   706978049),
+      INT32_C( 1992556544) },
+    { simde_mm512_set_epi32( -421344939,  1884279494,  1046997315,  2082846598,
+                            -1574469042, -1689595808,    25321150,  -967474090,
+                            -1240338517, -2069285583,  -948433453,  1197491563,
+                             1526787751,   -85024059, -1348869597,  1594801836),
+      INT32_C( -798625792) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm512_reduce_mul_epi32(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_mul_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    int64_t r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 6037163133502894825), INT64_C(-6926350830518984596),
+                            INT64_C( 4372824316523451956), INT64_C(  110313676055332012),
+                            INT64_C(-2179636271768960417), INT64_C(-6991462478592317386),
+                            INT64_C( 7354621846648726665), INT64_C(-5441613375723933182)),
+      INT64_C( 1971787543647254784) },
+    { simde_mm512_set_epi64(INT64_C(-4693974698729166646), INT64_C( 2118980421044101333),
+                            INT64_C( 3257751660253652892), INT64_C(-8818279422655198196),
+                            INT64_C(-3347389598224776625), INT64_C( 2115295065304172874),
+                            INT64_C(-3920562662313136966), INT64_C( 7680408638397524986)),
+      INT64_C(-1169586611010046208) },
+    { simde_mm512_set_epi64(INT64_C( -674100997070855993), INT64_C( -268835607494261745),
+                            INT64_C(-4751337816790609374), INT64_C( 8442402460748267701),
+                            INT64_C(-3372507422108848135), INT64_C( 7884786693087778702),
+                            INT64_C( 8694362567446746841), INT64_C( 4730143422141328855)),
+      INT64_C(  377417000658930420) },
+    { simde_mm512_set_epi64(INT64_C( 8656838736583089080), INT64_C( 4399743276758079051),
+                            INT64_C(-8437151060221327864), INT64_C(  421554099664596320),
+                            INT64_C(  898921897977381091), INT64_C(-4467320593899555251),
+                            INT64_C( 1475858208243758126), INT64_C(-5679109074318457640)),
+      INT64_C(-4683155509932294144) },
+    { simde_mm512_set_epi64(INT64_C(  999579133019484172), INT64_C( 1861908050163333926),
+                            INT64_C(-6653514560173739161), INT64_C( 1990796123862322624),
+                            INT64_C(-1787572821668332564), INT64_C(-3935160982629642284),
+                            INT64_C( 6774339957491674123), INT64_C( -722171481276044658)),
+      INT64_C(-5158249092777459712) },
+    { simde_mm512_set_epi64(INT64_C( 9148777594986890375), INT64_C( 5914280179048329252),
+                            INT64_C(-5546308717457662476), INT64_C( 5820753030604056307),
+                            INT64_C(-7185766991798735397), INT64_C(  741435043123608921),
+                            INT64_C( 4732981620827224779), INT64_C( 1621416397442892223)),
+      INT64_C( 6948659782735693424) },
+    { simde_mm512_set_epi64(INT64_C(-1086227021951621378), INT64_C( 6711331809667275440),
+                            INT64_C( 7165593151168869928), INT64_C( 5538006516660553190),
+                            INT64_C( 6473923120100527948), INT64_C( 6648412599739216169),
+                            INT64_C( 5981456369581920882), INT64_C(-5177993209055250945)),
+      INT64_C(-7543380902816583680) },
+    { simde_mm512_set_epi64(INT64_C( 9019732937966527805), INT64_C( 7774577582074572135),
+                            INT64_C( 2596274291433459111), INT64_C(-2669719204836518338),
+                            INT64_C( 3608698163547256189), INT64_C(-8049350101491493804),
+                            INT64_C(-8855477409457687232), INT64_C(-6948376947192796018)),
+      INT64_C( 2670011676365235200) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int64_t r = simde_mm512_reduce_mul_epi64(test_vec[i].a);
+    munit_assert_int64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_mul_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde_float64 r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(     2.47,      2.28,      2.03,     -2.02,
+                             -0.05,     -0.44,     -0.52,     -2.16),
+          -0.57 },
+    { simde_mm512_set_pd(     2.30,     -1.46,      2.05,      2.91,
+                             -2.36,     -0.04,     -2.10,      2.43),
+           9.65 },
+    { simde_mm512_set_pd(     2.40,      0.66,      2.63,     -2.18,
+                             -0.97,      2.44,      2.37,     -0.31),
+         -15.79 },
+    { simde_mm512_set_pd(    -1.87,     -0.84,      2.73,      0.65,
+                              1.00,     -2.07,     -0.77,     -1.88),
+          -8.35 },
+    { simde_mm512_set_pd(    -0.39,      1.27,      0.01,      0.60,
+                             -0.42,      0.69,     -0.80,      1.07),
+          -0.00 },
+    { simde_mm512_set_pd(     0.91,     -0.86,     -0.84,     -0.26,
+                              0.75,      2.09,      1.43,      2.16),
+          -0.83 },
+    { simde_mm512_set_pd(    -2.67,      1.77,     -2.52,      2.83,
+                             -1.01,      2.51,     -1.38,      1.16),
+         136.77 },
+    { simde_mm512_set_pd(     2.17,     -2.38,      1.62,     -1.53,
+                              2.17,     -1.05,      0.41,     -1.03),
+          12.32 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float64 r = simde_mm512_reduce_mul_pd(test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_mul_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde_float32 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(    -1.13f,      1.27f,     -0.24f,      0.73f,
+                              1.21f,      0.26f,     -0.40f,      1.87f,
+                             -0.35f,     -0.73f,     -1.16f,     -1.86f,
+                              0.90f,     -0.14f,      0.78f,      1.04f),
+           0.00f },
+    { simde_mm512_set_ps(     1.38f,      0.44f,      0.32f,      0.87f,
+                              1.77f,     -1.77f,     -1.58f,      1.95f,
+                             -1.51f,     -0.58f,      0.96f,      1.13f,
+                              0.71f,      1.50f,     -0.82f,     -1.38f),
+           1.87f },
+    { simde_mm512_set_ps(     1.06f,     -1.14f,      1.18f,      1.60f,
+                             -1.32f,     -1.14f,     -0.89f,      1.47f,
+                              0.79f,     -0.97f,      0.45f,     -1.94f,
+                             -1.35f,     -1.84f,      1.19f,      0.24f),
+           2.13f },
+    { simde_mm512_set_ps(    -0.44f,      0.01f,      1.99f,     -0.22f,
+                             -0.59f,      1.64f,      1.54f,      1.04f,
+                              1.27f,     -0.28f,      1.99f,      0.81f,
+                             -0.03f,     -2.00f,     -1.69f,     -0.72f),
+           0.00f },
+    { simde_mm512_set_ps(     1.18f,      0.44f,     -0.16f,      0.51f,
+                             -0.82f,      1.95f,      1.97f,     -1.16f,
+                              1.72f,      1.29f,     -1.65f,      0.94f,
+                              0.57f,      1.87f,     -1.88f,      0.72f),
+          -0.77f },
+    { simde_mm512_set_ps(     0.82f,     -0.08f,     -0.09f,      1.51f,
+                             -1.88f,      1.62f,      1.75f,     -1.06f,
+                             -0.08f,      0.11f,      0.68f,     -0.91f,
+                              1.44f,      0.96f,     -0.04f,      0.58f),
+          -0.00f },
+    { simde_mm512_set_ps(     0.32f,     -1.41f,     -1.92f,      1.16f,
+                              1.57f,      1.35f,     -0.77f,      1.31f,
+                              0.09f,      1.75f,      0.70f,     -0.79f,
+                              1.79f,     -1.79f,     -0.58f,      0.67f),
+           0.23f },
+    { simde_mm512_set_ps(    -0.86f,      0.00f,      0.21f,     -1.94f,
+                             -1.18f,      1.27f,     -1.83f,     -1.73f,
+                              0.40f,      0.01f,      1.25f,      1.68f,
+                              1.34f,     -1.80f,      1.53f,      0.11f),
+           0.00f }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_float32 r = simde_mm512_reduce_mul_ps(test_vec[i].a);
+    munit_assert_double_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_sqrt_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(   679.16,    409.52,    608.77,     55.13,
+                             15.56,    269.99,     40.43,    133.46),
+      simde_mm512_set_pd(    26.06,     20.24,     24.67,      7.42,
+                              3.94,     16.43,      6.36,     11.55) },
+    { simde_mm512_set_pd(   377.00,    745.11,    739.15,      3.11,
+                            370.33,    123.70,    186.79,    238.27),
+      simde_mm512_set_pd(    19.42,     27.30,     27.19,      1.76,
+                             19.24,     11.12,     13.67,     15.44) },
+    { simde_mm512_set_pd(   188.72,    463.86,    865.52,    715.88,
+                            190.14,    891.42,    803.18,    782.98),
+      simde_mm512_set_pd(    13.74,     21.54,     29.42,     26.76,
+                             13.79,     29.86,     28.34,     27.98) },
+    { simde_mm512_set_pd(   874.02,    788.75,    838.38,    896.80,
+                             15.25,    862.83,    244.45,    755.39),
+      simde_mm512_set_pd(    29.56,     28.08,     28.95,     29.95,
+                              3.91,     29.37,     15.63,     27.48) },
+    { simde_mm512_set_pd(   234.25,    729.92,    263.69,    308.74,
+                            194.40,    117.83,    177.73,    308.32),
+      simde_mm512_set_pd(    15.31,     27.02,     16.24,     17.57,
+                             13.94,     10.85,     13.33,     17.56) },
+    { simde_mm512_set_pd(   666.98,     53.39,    543.53,    479.87,
+                            829.61,    858.27,    450.49,     83.40),
+      simde_mm512_set_pd(    25.83,      7.31,     23.31,     21.91,
+                             28.80,     29.30,     21.22,      9.13) },
+    { simde_mm512_set_pd(   898.46,    918.95,     25.00,    406.68,
+                            118.54,    141.97,    127.49,    429.01),
+      simde_mm512_set_pd(    29.97,     30.31,      5.00,     20.17,
+                             10.89,     11.92,     11.29,     20.71) },
+    { simde_mm512_set_pd(   122.87,    275.22,    612.06,    592.50,
+                            114.75,    151.68,    119.11,    270.68),
+      simde_mm512_set_pd(    11.08,     16.59,     24.74,     24.34,
+                             10.71,     12.32,     10.91,     16.45) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_sqrt_pd(test_vec[i].a);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_sqrt_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(   912.73f,    476.93f,    106.48f,     64.34f,
+                            490.87f,    713.94f,     54.54f,    295.59f,
+                            821.29f,    388.03f,    353.01f,    920.99f,
+                            180.97f,    981.35f,     56.44f,    621.13f),
+      simde_mm512_set_ps(    30.21f,     21.84f,     10.32f,      8.02f,
+                             22.16f,     26.72f,      7.39f,     17.19f,
+                             28.66f,     19.70f,     18.79f,     30.35f,
+                             13.45f,     31.33f,      7.51f,     24.92f) },
+    { simde_mm512_set_ps(   590.82f,    658.35f,    955.25f,    397.53f,
+                            636.30f,    840.28f,    395.19f,    832.80f,
+                            953.48f,    797.61f,    370.71f,    166.96f,
+                            794.85f,    686.33f,    838.11f,     87.83f),
+      simde_mm512_set_ps(    24.31f,     25.66f,     30.91f,     19.94f,
+                             25.22f,     28.99f,     19.88f,     28.86f,
+                             30.88f,     28.24f,     19.25f,     12.92f,
+                             28.19f,     26.20f,     28.95f,      9.37f) },
+    { simde_mm512_set_ps(   576.85f,    754.24f,    625.52f,    797.69f,
+                            234.46f,    327.85f,     16.66f,    969.69f,
+                            489.34f,    606.62f,    972.77f,    465.79f,
+                            314.31f,     97.28f,    786.30f,    404.03f),
+      simde_mm512_set_ps(    24.02f,     27.46f,     25.01f,     28.24f,
+                             15.31f,     18.11f,      4.08f,     31.14f,
+                             22.12f,     24.63f,     31.19f,     21.58f,
+                             17.73f,      9.86f,     28.04f,     20.10f) },
+    { simde_mm512_set_ps(    67.08f,    985.19f,      1.21f,    289.50f,
+                            984.00f,    407.28f,    286.16f,     26.06f,
+                            489.22f,    318.76f,    708.30f,    170.11f,
+                            112.24f,    450.43f,    437.37f,    924.44f),
+      simde_mm512_set_ps(     8.19f,     31.39f,      1.10f,     17.01f,
+                             31.37f,     20.18f,     16.92f,      5.10f,
+                             22.12f,     17.85f,     26.61f,     13.04f,
+                             10.59f,     21.22f,     20.91f,     30.40f) },
+    { simde_mm512_set_ps(   260.74f,    690.94f,    689.63f,    626.46f,
+                            287.72f,    669.33f,    142.67f,    104.38f,
+                            546.16f,     65.18f,    845.21f,    147.07f,
+                            536.45f,    267.46f,    988.16f,    514.66f),
+      simde_mm512_set_ps(    16.15f,     26.29f,     26.26f,     25.03f,
+                             16.96f,     25.87f,     11.94f,     10.22f,
+                             23.37f,      8.07f,     29.07f,     12.13f,
+                             23.16f,     16.35f,     31.44f,     22.69f) },
+    { simde_mm512_set_ps(   728.50f,    597.34f,    525.03f,    114.83f,
+                            623.78f,    311.20f,    933.44f,    441.09f,
+                              3.81f,    769.17f,    697.48f,    214.74f,
+                            415.38f,    298.92f,    993.82f,    731.52f),
+      simde_mm512_set_ps(    26.99f,     24.44f,     22.91f,     10.72f,
+                             24.98f,     17.64f,     30.55f,     21.00f,
+                              1.95f,     27.73f,     26.41f,     14.65f,
+                             20.38f,     17.29f,     31.52f,     27.05f) },
+    { simde_mm512_set_ps(   233.99f,     47.01f,    289.83f,    371.96f,
+                            835.76f,    752.43f,    932.15f,    162.36f,
+                            196.19f,    854.46f,    752.39f,    770.20f,
+                            686.43f,    165.79f,    830.84f,    536.47f),
+      simde_mm512_set_ps(    15.30f,      6.86f,     17.02f,     19.29f,
+                             28.91f,     27.43f,     30.53f,     12.74f,
+                             14.01f,     29.23f,     27.43f,     27.75f,
+                             26.20f,     12.88f,     28.82f,     23.16f) },
+    { simde_mm512_set_ps(   143.77f,    855.41f,    716.49f,     65.66f,
+                            335.71f,    664.82f,     85.13f,    104.98f,
+                            949.35f,    236.66f,    363.90f,    951.85f,
+                            296.08f,    757.53f,    732.95f,    758.67f),
+      simde_mm512_set_ps(    11.99f,     29.25f,     26.77f,      8.10f,
+                             18.32f,     25.78f,      9.23f,     10.25f,
+                             30.81f,     15.38f,     19.08f,     30.85f,
+                             17.21f,     27.52f,     27.07f,     27.54f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_sqrt_ps(test_vec[i].a);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_sub_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(  575328027,   192066860,  -886449404,  -263332738,
+                             1189693547, -1373531157,  -526285155,   401990049,
+                             1876525153, -1295900152, -1768233816,  -207450164,
+                            -1899971491,   -76464232,  -697287540,  1505764871),
+      simde_mm512_set_epi32( -337356303,   -79949951,   290349683, -1060416830,
+                              934702982,   -24183186,     8870526,  2135291999,
+                             -389935649,  -227971463, -1482643365, -1508329493,
+                            -1201867069,  -190418397, -1017680465,   858110297),
+      simde_mm512_set_epi32(  912684330,   272016811, -1176799087,   797084092,
+                              254990565, -1349347971,  -535155681, -1733301950,
+                            -2028506494, -1067928689,  -285590451,  1300879329,
+                             -698104422,   113954165,   320392925,   647654574) },
+    { simde_mm512_set_epi32(  771426944,   778734004, -1161770813,   -17683586,
+                            -1713523761,  -660544777,  1843775044,   626093143,
+                            -1360121781,  -201357424,   852930274,   557681730,
+                             -665203862,  1941204729,  -940719315,   322858578),
+      simde_mm512_set_epi32( -986384695, -1526387435, -1085209563, -1163384093,
+                            -1255369993,   887676904, -1235352580,  1653797093,
+                             1583945460,   431166474,   -29922185,  2083135360,
+                             -208222582,  1390810175,   374586538, -1136405335),
+      simde_mm512_set_epi32( 1757811639, -1989845857,   -76561250,  1145700507,
+                             -458153768, -1548221681, -1215839672, -1027703950,
+                             1350900055,  -632523898,   882852459, -1525453630,
+                             -456981280,   550394554, -1315305853,  1459263913) },
+    { simde_mm512_set_epi32(  230894700,   207592616,  1423308817,  1978811129,
+                              983568850,  1363087828,  1378279113,   918476273,
+                               29224427,   199158501, -1188883285,  1375254684,
+                             1187601718, -1990227993,    14696410,  1923248177),
+      simde_mm512_set_epi32( 1407847622,  1064598003,   846562065, -1752300586,
+                              740791613,  2035139914,  -651851811,   566270498,
+                             1167319888, -1305868866,  -888974256,   252972949,
+                              -59847297, -2051724999,  -958947686,   831054393),
+      simde_mm512_set_epi32(-1176952922,  -857005387,   576746752,  -563855581,
+                              242777237,  -672052086,  2030130924,   352205775,
+                            -1138095461,  1505027367,  -299909029,  1122281735,
+                             1247449015,    61497006,   973644096,  1092193784) },
+    { simde_mm512_set_epi32(  807586848,  2064646117,  1434773846,  -996201698,
+                              303691808,   583909151,  -860323532, -1097948676,
+                             -334703549, -1276396317,   379131020,   332669476,
+                            -1202016562,    12680638,  1127005813,  -604272444),
+      simde_mm512_set_epi32(-1934458449,   778263302,   764476622,   664070984,
+                            -1960794310,  1219706933,  2144068240,   890318829,
+                             2022773593,  -873111683,  1572438651,  1998250193,
+                            -1636365408,  -657970610,  -198016243,  1616223087),
+      simde_mm512_set_epi32(-1552921999,  1286382815,   670297224, -1660272682,
+                            -2030481178,  -635797782,  1290575524, -1988267505,
+                             1937490154,  -403284634, -1193307631, -1665580717,
+                              434348846,   670651248,  1325022056,  2074471765) },
+    { simde_mm512_set_epi32(  671721464,  -973217153, -1229301636,   573231446,
+                              798506014,  -543593955,   594058097,    55198860,
+                             -490329577,  -247079803,  1758183347, -1087951758,
+                            -2041895310, -2021040190,  1877350995,  -804860905),
+      simde_mm512_set_epi32( -714923141,  -110810875,   531298866,  -686632917,
+                            -1881072734,  1239598781,   258420205,    97662308,
+                              -48093273,  -148318682,   -76899322,   918051573,
+                             -930492477, -1469186485, -1281598528, -2014947499),
+      simde_mm512_set_epi32( 1386644605,  -862406278, -1760600502,  1259864363,
+                            -1615388548, -1783192736,   335637892,   -42463448,
+                             -442236304,   -98761121,  1835082669, -2006003331,
+                            -1111402833,  -551853705, -1136017773,  1210086594) },
+    { simde_mm512_set_epi32( 1917895714,   192765686,   375136588,  -749692438,
+                              109896802,   191739974,   299227977,   258099171,
+                             1659856146, -1633348648, -2115209898, -1165447768,
+                            -1332843508,   636189245,   698874806, -1373319056),
+      simde_mm512_set_epi32(  675864195,   832198904,    -7779674, -1977211735,
+                            -1038037163,   581390211, -1684673675,  1287592052,
+                             1134840957,  1479416862,    90382010, -1989874928,
+                              661438482,  1784767252,   285999692,  -849654666),
+      simde_mm512_set_epi32( 1242031519,  -639433218,   382916262,  1227519297,
+                             1147933965,  -389650237,  1983901652, -1029492881,
+                              525015189,  1182201786,  2089375388,   824427160,
+                            -1994281990, -1148578007,   412875114,  -523664390) },
+    { simde_mm512_set_epi32(   44002357,   804335995,   -84134853,     4211531,
+                             1235094235,   229399570, -1608073392,   993461696,
+                            -1480517639,    84146509,   705925200,   395148596,
+                            -1453659956,  -903558037,  1502706258,  -449705784),
+      simde_mm512_set_epi32(-1730900669,  1904332575,   605991700,   301546266,
+                              104342904,  1490292927,   108277105, -1553986420,
+                              463152036,   469620010,   641006333, -1500783151,
+                            -1360953646,   361984757, -1798449925, -1021397206),
+      simde_mm512_set_epi32( 1774903026, -1099996580,  -690126553,  -297334735,
+                             1130751331, -1260893357, -1716350497, -1747519180,
+                            -1943669675,  -385473501,    64918867,  1895931747,
+                              -92706310, -1265542794,  -993811113,   571691422) },
+    { simde_mm512_set_epi32( 1102083798,  1235809406,  -315317896,   105920568,
+                              508084249,  1996262417,   876093449, -1550856241,
+                            -2041863309,  1291468441,   224493809,  -633047392,
+                              709662425,  1721261581,     9181122,  1029412511),
+      simde_mm512_set_epi32(  753106389,   285561817,   460968232,  1846504232,
+                             1382526965, -1772697246, -2062022297,   835668145,
+                             1764766431,  -949676724,  1642156357,   105418561,
+                              210602535,  1246492296,  1886086341,  1628847816),
+      simde_mm512_set_epi32(  348977409,   950247589,  -776286128, -1740583664,
+                             -874442716,  -526007633, -1356851550,  1908442910,
+                              488337556, -2053822131, -1417662548,  -738465953,
+                              499059890,   474769285, -1876905219,  -599435305) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_sub_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_sub_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(-6881832959282356124), INT64_C(-8639984431596556385),
+                            INT64_C(  311718818763998467), INT64_C(-4148386401924122447),
+                            INT64_C( 2611581182385477333), INT64_C(  971451651171995328),
+                            INT64_C(-2765135177961281787), INT64_C(-1878103167289627676)),
+      simde_mm512_set_epi64(INT64_C( 4426024211300509238), INT64_C(  862336488319745036),
+                            INT64_C(-3678190200443534488), INT64_C( 2607769318575454180),
+                            INT64_C( 4386275028904417965), INT64_C(-7733425525822329513),
+                            INT64_C(-5933180369809282969), INT64_C(-7709122006398169846)),
+      simde_mm512_set_epi64(INT64_C( 7138886903126686254), INT64_C( 8944423153793250195),
+                            INT64_C( 3989909019207532955), INT64_C(-6756155720499576627),
+                            INT64_C(-1774693846518940632), INT64_C( 8704877176994324841),
+                            INT64_C( 3168045191848001182), INT64_C( 5831018839108542170)) },
+    { simde_mm512_set_epi64(INT64_C( 1766642300616356254), INT64_C(  537619004538619693),
+                            INT64_C( 4439834343940019405), INT64_C( 4625429276223826937),
+                            INT64_C( 1405790393166259313), INT64_C(-2412401757014002056),
+                            INT64_C( 6193095237205691482), INT64_C(-5451307965173649532)),
+      simde_mm512_set_epi64(INT64_C(-8694601998915323172), INT64_C( 4537466542890602999),
+                            INT64_C(-4918983152366087362), INT64_C(-7837710371399478345),
+                            INT64_C( 8017827305421642735), INT64_C( 2321057343196960645),
+                            INT64_C(-6663821698447224962), INT64_C( 5350744377010998433)),
+      simde_mm512_set_epi64(INT64_C(-7985499774177872190), INT64_C(-3999847538351983306),
+                            INT64_C(-9087926577403444849), INT64_C(-5983604426086246334),
+                            INT64_C(-6612036912255383422), INT64_C(-4733459100210962701),
+                            INT64_C(-5589827138056635172), INT64_C( 7644691731524903651)) },
+    { simde_mm512_set_epi64(INT64_C(-7999881646806066293), INT64_C(-1095520750574430532),
+                            INT64_C(-7794289097680497893), INT64_C( 5367408121837325744),
+                            INT64_C( -889369376162186131), INT64_C( 6038326012091027256),
+                            INT64_C(-8548150563865340590), INT64_C(-5784668734562058833)),
+      simde_mm512_set_epi64(INT64_C(-2063367090388178597), INT64_C(-4319721762628626708),
+                            INT64_C( 8146574714848658151), INT64_C( 4640231066918741222),
+                            INT64_C(-3319660592166473008), INT64_C(-3337201735433313562),
+                            INT64_C(-3293568649568300722), INT64_C(  520802007493983518)),
+      simde_mm512_set_epi64(INT64_C(-5936514556417887696), INT64_C( 3224201012054196176),
+                            INT64_C( 2505880261180395572), INT64_C(  727177054918584522),
+                            INT64_C( 2430291216004286877), INT64_C(-9071216326185210798),
+                            INT64_C(-5254581914297039868), INT64_C(-6305470742056042351)) },
+    { simde_mm512_set_epi64(INT64_C( 1127486054580655544), INT64_C( 3441342146533158830),
+                            INT64_C(-8700901474660792043), INT64_C(-5424726226098448110),
+                            INT64_C( 3590861504814154389), INT64_C( 2889439027170253247),
+                            INT64_C(-7364501773519960241), INT64_C(-9132138136685956660)),
+      simde_mm512_set_epi64(INT64_C( 8001383378018337540), INT64_C(-5096084992909397376),
+                            INT64_C( 4343810530204417755), INT64_C( 7960202991167032638),
+                            INT64_C(-1269813700322388706), INT64_C(-7511847884492229007),
+                            INT64_C( 8282409083850235808), INT64_C(-8335382864853359736)),
+      simde_mm512_set_epi64(INT64_C(-6873897323437681996), INT64_C( 8537427139442556206),
+                            INT64_C( 5402032068844341818), INT64_C( 5061814856444070868),
+                            INT64_C( 4860675205136543095), INT64_C(-8045457162047069362),
+                            INT64_C( 2799833216339355567), INT64_C( -796755271832596924)) },
+    { simde_mm512_set_epi64(INT64_C(-5696772562370644533), INT64_C(  492521149286498208),
+                            INT64_C( 4842451887137765744), INT64_C(-8572630129765557330),
+                            INT64_C( 3420850426190398370), INT64_C(-7931299461293617187),
+                            INT64_C(-2658654088485575535), INT64_C(-1187797861647928304)),
+      simde_mm512_set_epi64(INT64_C( 3228970015556919827), INT64_C(-5920071554345678727),
+                            INT64_C( 2466945364589726473), INT64_C( 4220606225954424092),
+                            INT64_C( -216164905909545350), INT64_C( 7579718837655612498),
+                            INT64_C(-7616757879756990002), INT64_C(-1429767305008928035)),
+      simde_mm512_set_epi64(INT64_C(-8925742577927564360), INT64_C( 6412592703632176935),
+                            INT64_C( 2375506522548039271), INT64_C( 5653507717989570194),
+                            INT64_C( 3637015332099943720), INT64_C( 2935725774760321931),
+                            INT64_C( 4958103791271414467), INT64_C(  241969443360999731)) },
+    { simde_mm512_set_epi64(INT64_C( 5431232237264989980), INT64_C(-4505035761328533391),
+                            INT64_C( 8912656876635578366), INT64_C( 2138471554402599157),
+                            INT64_C( 7772018937492381713), INT64_C(-2506004229905627197),
+                            INT64_C( 4512868887164879100), INT64_C( -410659801275929887)),
+      simde_mm512_set_epi64(INT64_C(  897796011672979519), INT64_C( 6707405457755276435),
+                            INT64_C(-6667016698506936848), INT64_C( 5462224312105456291),
+                            INT64_C(  901370238372870354), INT64_C(-6242484431000761321),
+                            INT64_C( 6920683878754261649), INT64_C( 1268084204954383705)),
+      simde_mm512_set_epi64(INT64_C( 4533436225592010461), INT64_C( 7234302854625741790),
+                            INT64_C(-2867070498567036402), INT64_C(-3323752757702857134),
+                            INT64_C( 6870648699119511359), INT64_C( 3736480201095134124),
+                            INT64_C(-2407814991589382549), INT64_C(-1678744006230313592)) },
+    { simde_mm512_set_epi64(INT64_C( 7150380983168313651), INT64_C( 8670460385893640288),
+                            INT64_C(-5751032563577957875), INT64_C(  833623492832041725),
+                            INT64_C(-8460617231394684535), INT64_C(-8290888877447871645),
+                            INT64_C( -251646339551473900), INT64_C( 1890087894769313141)),
+      simde_mm512_set_epi64(INT64_C( 3270636556271784183), INT64_C(-6361555212931034782),
+                            INT64_C(-6610245438117276236), INT64_C( 7734544492809958996),
+                            INT64_C( 1514461903265379957), INT64_C(-5060462232394642632),
+                            INT64_C( 2222229652629212838), INT64_C( 2885221039529464690)),
+      simde_mm512_set_epi64(INT64_C( 3879744426896529468), INT64_C(-3414728474884876546),
+                            INT64_C(  859212874539318361), INT64_C(-6900920999977917271),
+                            INT64_C( 8471664939049487124), INT64_C(-3230426645053229013),
+                            INT64_C(-2473875992180686738), INT64_C( -995133144760151549)) },
+    { simde_mm512_set_epi64(INT64_C(-7168272335059163507), INT64_C(  795706808036721200),
+                            INT64_C( 7844344981216344155), INT64_C( 7706469809587988195),
+                            INT64_C( 8845409215430070613), INT64_C(-6639353675427202934),
+                            INT64_C( 7570748468421241886), INT64_C( 3328999834315025492)),
+      simde_mm512_set_epi64(INT64_C(-1734356387908326697), INT64_C(-6315226818240727898),
+                            INT64_C( 4417557383554540376), INT64_C(-3689126342840667469),
+                            INT64_C( 3792508369362531252), INT64_C(-6369035430191729754),
+                            INT64_C(-2885207194247456448), INT64_C(-2459198293130355894)),
+      simde_mm512_set_epi64(INT64_C(-5433915947150836810), INT64_C( 7110933626277449098),
+                            INT64_C( 3426787597661803779), INT64_C(-7051147921280895952),
+                            INT64_C( 5052900846067539361), INT64_C( -270318245235473180),
+                            INT64_C(-7990788411040853282), INT64_C( 5788198127445381386)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_sub_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_sub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(   177.39,   -503.93,    -21.48,   -520.72,
+                            469.07,    166.23,    191.52,    666.83),
+      simde_mm512_set_pd(  -555.09,    276.21,   -551.75,    521.52,
+                             64.00,   -609.19,    296.14,   -229.42),
+      simde_mm512_set_pd(   732.48,   -780.14,    530.27,  -1042.24,
+                            405.07,    775.42,   -104.62,    896.25) },
+    { simde_mm512_set_pd(   760.88,   -889.60,   -263.05,   -573.74,
+                            456.17,    649.62,    619.72,   -665.77),
+      simde_mm512_set_pd(   927.69,    284.98,    110.21,    718.24,
+                            839.36,    122.08,     33.58,    226.28),
+      simde_mm512_set_pd(  -166.81,  -1174.58,   -373.26,  -1291.98,
+                           -383.19,    527.54,    586.14,   -892.05) },
+    { simde_mm512_set_pd(  -418.83,   -776.45,    765.17,   -468.74,
+                            340.81,    555.92,   -950.87,   -359.90),
+      simde_mm512_set_pd(   576.31,    951.87,     25.79,   -775.70,
+                           -940.32,   -408.37,    139.61,    830.33),
+      simde_mm512_set_pd(  -995.14,  -1728.32,    739.38,    306.96,
+                           1281.13,    964.29,  -1090.48,  -1190.23) },
+    { simde_mm512_set_pd(   747.72,    411.55,   -390.31,    303.84,
+                            486.69,   -550.43,   -495.89,    242.25),
+      simde_mm512_set_pd(   204.78,    328.59,   -333.06,    113.30,
+                             22.85,   -693.98,   -242.07,    539.93),
+      simde_mm512_set_pd(   542.94,     82.96,    -57.25,    190.54,
+                            463.84,    143.55,   -253.82,   -297.68) },
+    { simde_mm512_set_pd(  -146.55,   -524.92,    622.82,   -388.08,
+                           -919.25,    405.22,   -816.89,    460.91),
+      simde_mm512_set_pd(  -297.46,   -590.70,    620.54,    -34.75,
+                            558.02,    781.09,   -893.59,    507.95),
+      simde_mm512_set_pd(   150.91,     65.78,      2.28,   -353.33,
+                          -1477.27,   -375.87,     76.70,    -47.04) },
+    { simde_mm512_set_pd(   437.38,    572.58,    908.61,    448.25,
+                            178.33,    411.96,    783.40,   -742.72),
+      simde_mm512_set_pd(   972.00,   -368.21,    684.21,    953.64,
+                            985.01,    964.64,    976.75,   -540.96),
+      simde_mm512_set_pd(  -534.62,    940.79,    224.40,   -505.39,
+                           -806.68,   -552.68,   -193.35,   -201.76) },
+    { simde_mm512_set_pd(   561.40,   -938.46,    455.19,    544.77,
+                            820.88,    487.93,    986.55,    435.31),
+      simde_mm512_set_pd(   470.80,    286.63,    912.41,    894.92,
+                           -716.49,    210.87,    855.53,   -302.43),
+      simde_mm512_set_pd(    90.60,  -1225.09,   -457.22,   -350.15,
+                           1537.37,    277.06,    131.02,    737.74) },
+    { simde_mm512_set_pd(  -121.15,     53.66,   -690.20,    245.77,
+                             73.09,   -225.11,    -89.44,    -63.26),
+      simde_mm512_set_pd(  -254.79,    352.53,   -195.88,   -970.50,
+                            549.50,    556.60,     33.42,    264.31),
+      simde_mm512_set_pd(   133.64,   -298.87,   -494.32,   1216.27,
+                           -476.41,   -781.71,   -122.86,   -327.57) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_sub_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_sub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { simde_mm512_set_ps(   312.79f,    464.53f,    761.29f,   -593.66f,
+                            506.35f,   -693.43f,    978.67f,    732.62f,
+                           -930.48f,    133.60f,    190.00f,   -686.03f,
+                            427.64f,    -49.52f,   -941.79f,    -51.04f),
+      simde_mm512_set_ps(  -177.26f,    719.09f,    -31.66f,    827.56f,
+                              7.22f,   -239.33f,   -693.05f,     65.55f,
+                           -216.45f,   -981.03f,   -950.83f,     48.86f,
+                            939.97f,    192.05f,   -913.29f,    951.86f),
+      simde_mm512_set_ps(   490.05f,   -254.56f,    792.95f,  -1421.22f,
+                            499.13f,   -454.10f,   1671.72f,    667.07f,
+                           -714.03f,   1114.63f,   1140.83f,   -734.89f,
+                           -512.33f,   -241.57f,    -28.50f,  -1002.90f) },
+    { simde_mm512_set_ps(   117.06f,   -623.75f,    663.40f,    579.35f,
+                           -854.45f,   -988.53f,    196.25f,    385.59f,
+                           -590.01f,   -137.29f,   -124.45f,    239.65f,
+                           -452.10f,   -901.41f,    358.00f,    818.86f),
+      simde_mm512_set_ps(   424.11f,    547.88f,   -753.44f,    411.08f,
+                            940.20f,     64.20f,   -596.03f,   -538.52f,
+                            990.01f,    529.94f,    509.03f,    676.22f,
+                            371.50f,   -276.50f,     66.14f,    789.86f),
+      simde_mm512_set_ps(  -307.05f,  -1171.63f,   1416.84f,    168.27f,
+                          -1794.65f,  -1052.73f,    792.28f,    924.11f,
+                          -1580.02f,   -667.23f,   -633.48f,   -436.57f,
+                           -823.60f,   -624.91f,    291.86f,     29.00f) },
+    { simde_mm512_set_ps(   -94.16f,    386.76f,    139.59f,   -463.41f,
+                            271.86f,    481.31f,   -270.85f,   -523.19f,
+                            238.54f,   -688.85f,   -206.56f,   -642.85f,
+                           -460.31f,    817.15f,    623.51f,   -101.13f),
+      simde_mm512_set_ps(  -685.11f,   -301.20f,   -224.45f,   -598.48f,
+                            -99.65f,    560.15f,   -659.58f,    146.51f,
+                           -591.19f,    211.85f,    939.92f,   -459.05f,
+                           -168.96f,    543.28f,     47.61f,    552.89f),
+      simde_mm512_set_ps(   590.95f,    687.96f,    364.04f,    135.07f,
+                            371.51f,    -78.84f,    388.73f,   -669.70f,
+                            829.73f,   -900.70f,  -1146.48f,   -183.80f,
+                           -291.35f,    273.87f,    575.90f,   -654.02f) },
+    { simde_mm512_set_ps(  -402.04f,    359.70f,   -494.33f,   -742.48f,
+                           -883.58f,   -393.82f,    366.60f,   -439.69f,
+                           -419.47f,   -825.27f,   -133.02f,   -888.32f,
+                           -524.72f,    837.01f,   -267.74f,    543.01f),
+      simde_mm512_set_ps(   233.80f,   -241.58f,   -924.96f,    377.21f,
+                           -291.67f,    480.60f,     32.43f,    987.44f,
+                            154.20f,    513.00f,   -425.18f,    448.97f,
+                            266.40f,   -363.12f,   -112.14f,    353.79f),
+      simde_mm512_set_ps(  -635.84f,    601.28f,    430.63f,  -1119.69f,
+                           -591.91f,   -874.42f,    334.17f,  -1427.13f,
+                           -573.67f,  -1338.27f,    292.16f,  -1337.29f,
+                           -791.12f,   1200.13f,   -155.60f,    189.22f) },
+    { simde_mm512_set_ps(  -865.55f,    830.42f,   -536.07f,   -591.39f,
+                           -300.98f,    678.68f,    438.57f,   -419.28f,
+                            280.40f,    -76.90f,    628.62f,   -675.32f,
+                            781.13f,    795.38f,   -791.54f,    147.64f),
+      simde_mm512_set_ps(  -956.32f,   -944.57f,    764.11f,    964.89f,
+                           -526.23f,    -97.97f,   -270.76f,    468.12f,
+                           -250.55f,   -471.74f,    968.73f,   -478.79f,
+                            425.36f,    965.46f,   -955.95f,    718.58f),
+      simde_mm512_set_ps(    90.77f,   1774.99f,  -1300.18f,  -1556.28f,
+                            225.25f,    776.65f,    709.33f,   -887.40f,
+                            530.95f,    394.84f,   -340.11f,   -196.53f,
+                            355.77f,   -170.08f,    164.41f,   -570.94f) },
+    { simde_mm512_set_ps(   292.19f,    284.77f,    161.60f,    621.18f,
+                            909.85f,    152.96f,   -558.42f,   -902.21f,
+                            704.37f,    268.31f,    -17.44f,   -353.06f,
+                            247.29f,   -766.82f,    870.99f,   -147.60f),
+      simde_mm512_set_ps(   162.63f,    619.14f,    643.20f,    408.15f,
+                            736.27f,    937.92f,    992.00f,   -708.62f,
+                            685.02f,    378.43f,     19.78f,   -406.91f,
+                            784.45f,   -447.00f,   -462.63f,     28.23f),
+      simde_mm512_set_ps(   129.56f,   -334.37f,   -481.60f,    213.03f,
+                            173.58f,   -784.96f,  -1550.42f,   -193.59f,
+                             19.35f,   -110.12f,    -37.22f,     53.85f,
+                           -537.16f,   -319.82f,   1333.62f,   -175.83f) },
+    { simde_mm512_set_ps(   687.46f,   -311.97f,    967.59f,   -488.37f,
+                           -306.66f,    921.74f,    739.26f,   -205.02f,
+                            827.82f,    -54.04f,   -221.44f,    368.91f,
+                           -572.06f,   -869.34f,    492.23f,    132.75f),
+      simde_mm512_set_ps(   768.87f,     74.25f,   -162.48f,   -660.35f,
+                           -120.99f,    159.49f,   -554.44f,    938.22f,
+                           -310.12f,      2.65f,   -715.84f,   -156.15f,
+                            444.68f,   -685.92f,    858.80f,    722.34f),
+      simde_mm512_set_ps(   -81.41f,   -386.22f,   1130.07f,    171.98f,
+                           -185.67f,    762.25f,   1293.70f,  -1143.24f,
+                           1137.94f,    -56.69f,    494.40f,    525.06f,
+                          -1016.74f,   -183.42f,   -366.57f,   -589.59f) },
+    { simde_mm512_set_ps(   325.45f,    826.72f,   -645.16f,   -574.81f,
+                            473.70f,   -581.63f,   -989.29f,    880.40f,
+                            891.99f,     19.54f,   -343.19f,    817.79f,
+                            538.79f,    856.66f,    618.63f,    379.78f),
+      simde_mm512_set_ps(    37.56f,    671.67f,   -706.94f,    316.62f,
+                           -308.78f,     31.41f,    916.82f,    238.09f,
+                           -225.43f,    536.76f,   -345.34f,    779.97f,
+                            240.95f,   -773.63f,    256.36f,    873.01f),
+      simde_mm512_set_ps(   287.89f,    155.05f,     61.78f,   -891.43f,
+                            782.48f,   -613.04f,  -1906.11f,    642.31f,
+                           1117.42f,   -517.22f,      2.15f,     37.82f,
+                            297.84f,   1630.29f,    362.27f,   -493.23f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_sub_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_xor_si512(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(  684627298,  -996269366,  1373207207,  1708363245,
+                              137109340, -1183461794,  1411437138, -1543055726,
+                            -2029835439, -1078250419, -1748337065,  -980719245,
+                            -1466200968, -1822276662, -1233296903,  -181035751),
+      simde_mm512_set_epi32(-1135398278,  -723853749,   370700308,  -340837468,
+                            -1608209175,  -471318837,  1463640300, -1657972365,
+                            -1022638523,  -948764087,    36416574,   632024794,
+                            -1878809862,   150157937, -1365391818, -2097601257),
+      simde_mm512_set_epi32(-1801607400,   272956545,  1203833523, -1904429495,
+                            -1475824715,  1520300181,    52277950,   959156193,
+                             1141435668,  2026386948, -1780362647,  -534739031,
+                              949497474, -1684964933,   417376207,  2009905166) },
+    { simde_mm512_set_epi32(-1776228708, -1444861265,  1982995319, -1198445581,
+                              784529133,  1581978106,   658865734,   928951377,
+                            -1086513262,   561232816, -1640670275,   169154650,
+                             1783424111,  -900404732, -2144992975, -1189611441),
+      simde_mm512_set_epi32(-1175159337,  1571703648, -1296949882,  -554872648,
+                              838237275,  -282594217,   217273351, -1239910115,
+                            -1048835178, -1738060254,   123501860, -1258232364,
+                             -972431258,   -64982130, -1125698546, -1729080475),
+      simde_mm512_set_epi32(  802462539,  -196124209,  -998242575,  1719434059,
+                              523537078, -1318263379,   733358657, -2126064308,
+                             2118194180, -1189808750, -1721162087, -1089077874,
+                            -1404763127,   913611146,  1019295039,   568830762) },
+    { simde_mm512_set_epi32(-1629821978,   109439603,  -373050900,  1501966313,
+                            -1507156563,  -193479687,  2085979724,   120109052,
+                            -1682651358,  1323797022,  -466641407,   688136344,
+                             1079288489,  1326579909,   451028133,   462400712),
+      simde_mm512_set_epi32(-1663633644, -1327801659, -1057040068,   798144062,
+                              778743982,  1655825169, -1078320234,   429279238,
+                            -1732201533,    74030280, -1982712700,  1232946690,
+                             -485746899,   299216695,   889148731,   511925015),
+      simde_mm512_set_epi32(   34346226, -1235308362,   691890384,  1981061591,
+                            -2009060093, -1765386008, -1007704614,   515833850,
+                               57963745,  1250825942,  1845340805,  1618568858,
+                            -1554467452,  1590145010,   773681566,    84735967) },
+    { simde_mm512_set_epi32(-1678394310,  1831849486,  1520272822,  1947221975,
+                            -1237326177,   907800065,   135620109, -2055180042,
+                             1151334588,   -67254719,  1503835519,  1105479955,
+                             1767753340,  -500042484,  2049231559, -1854319523),
+      simde_mm512_set_epi32( -557469523, -2046606245,  -550148804,  -572300779,
+                             1135443767,   964654082,   467310752, -1396052767,
+                              466287895,   223091172, -1903012966,  1461781436,
+                            -1336815602,  1445107437,  -509598098,  1747324780),
+      simde_mm512_set_epi32( 1160776855,  -349402539, -2052530038, -1443668542,
+                             -174941784,   258251267,   332398253,   692689943,
+                             1599407531,  -156115035,  -684661019,   382028463,
+                             -653519246, -1273797663, -1685787479,  -111191247) },
+    { simde_mm512_set_epi32( 1056012187, -1509448578, -1021355540, -1361579006,
+                             1285465001,   240797088,  1274245197,  1820984853,
+                            -1486677846,   311259551,  -647224198, -1416518778,
+                             -457042551,   621279998,   723566474,  -164218397),
+      simde_mm512_set_epi32(-1252954982,  1875365262,  2036359777,   765459504,
+                              947167632,  -268010758,   221075565,   861858131,
+                            -1468127196,  -318788711, -1938730186,   911660388,
+                             1030613316,  -922534029,  -205941703, -1976919579),
+      simde_mm512_set_epi32(-1952441599,  -910136848, -1166066803, -2092431310,
+                             1961493049,   -27508902,  1188964384,  1607790406,
+                              253571214,   -26027514,  1427994444, -1647872286,
+                             -642777907,  -335231603,  -661050445,  2082250758) },
+    { simde_mm512_set_epi32(  -35242639,  -225804967,   282218955,  1620900723,
+                              145832447,   -16924748,   -79754968, -1428796642,
+                            -1127473427,  -567028154, -1613305465,  -674281990,
+                              508765800,  -455155274, -2061119243,  -613086128),
+      simde_mm512_set_epi32( -566424107,  1428389277,  1496094171, -1330527266,
+                             1098565328,   450398249,    -1342900,  -591881042,
+                            -2067347823, -1790452511,  -620050139,  1321237853,
+                            -1290509385,  1765890246,   506178937,      323501),
+      simde_mm512_set_epi32(  601567396, -1482096444,  1241433104,  -802342739,
+                             1238105903,  -467322979,    81038180,  1986975664,
+                              940234876,  1265896103,  1155276962, -1727055705,
+                            -1387837985, -1918912144, -1693549172,  -613293059) },
+    { simde_mm512_set_epi32(-1774216534,  -867651774, -1547914160, -1289020021,
+                            -1428536324,  1893981289,  1771542466, -1687055994,
+                             2108492916,   608264443,  -150057498,  -235666285,
+                             -819941328,   929676050,   781708332, -1539084539),
+      simde_mm512_set_epi32( -481570043,  1087149428,   744672869,   264138047,
+                             1504766344, -1876078582,   596979483,   923381887,
+                            -1435789412,   -81878507, -1642358401,  1540462911,
+                            -1735951068,  -681844965, -1611355671, -1689311233),
+      simde_mm512_set_epi32( 1970555311, -1937491402, -1881245131, -1131056972,
+                             -211113356,  -523334557,  1241692377, -1401413127,
+                             -674849816,  -547372306,  1763038361, -1440375380,
+                             1470614804,  -533568503, -1318894139,  1057769722) },
+    { simde_mm512_set_epi32(-1386606150, -1829975869, -1098663570,  2122291451,
+                              381571429,  2013037999,    63025895,  1998984782,
+                             1975981263,  1156373062, -1934304769,  1464412126,
+                             1568436931,  1214818761,  1051386314,   765778303),
+      simde_mm512_set_epi32( 1623984843,  1504806439,  2021630211,  -391626471,
+                            -1986807030,  -745565304,   901323759,  -959494867,
+                             1797311150,   478000168,  1331923588,   194444860,
+                            -2028259920, -1763304774,  -770016630,  -390175001),
+      simde_mm512_set_epi32( -845800591,  -883077404,  -956557203, -1764238878,
+                            -1624380817, -1535961561,   913877256, -1310108829,
+                              518512225,  1485925998, -1009298565,  1558174178,
+                             -630765709,  -561073293,  -323970240,  -988102760) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_xor_si512(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm512_abs_epi32",                 test_simde_mm512_abs_epi32,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_add_epi32",                 test_simde_mm512_add_epi32,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_add_epi64",                 test_simde_mm512_add_epi64,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_add_pd",                    test_simde_mm512_add_pd,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_add_ps",                    test_simde_mm512_add_ps,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_and_si512",                 test_simde_mm512_and_si512,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_andnot_si512",              test_simde_mm512_andnot_si512,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_cmp_pd_mask",               test_simde_mm512_cmp_pd_mask,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_cmp_ps_mask",               test_simde_mm512_cmp_ps_mask,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_cmpeq_epi32_mask",          test_simde_mm512_cmpeq_epi32_mask,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_cmpeq_epi64_mask",          test_simde_mm512_cmpeq_epi64_mask,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_cmpgt_epi32_mask",          test_simde_mm512_cmpgt_epi32_mask,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_cmpgt_epi64_mask",          test_simde_mm512_cmpgt_epi64_mask,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_div_pd",                    test_simde_mm512_div_pd,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_div_ps",                    test_simde_mm512_div_ps,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_fmadd_pd",                  test_simde_mm512_fmadd_pd,                  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_fmadd_ps",                  test_simde_mm512_fmadd_ps,                  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_kand",                      test_simde_mm512_kand,                      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_kandn",                     test_simde_mm512_kandn,                     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_knot",                      test_simde_mm512_knot,                      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_kor",                       test_simde_mm512_kor,                       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_kxnor",                     test_simde_mm512_kxnor,                     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_kxor",                      test_simde_mm512_kxor,                      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_add_epi32",            test_simde_mm512_mask_add_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_add_epi64",            test_simde_mm512_mask_add_epi64,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_add_ps",               test_simde_mm512_mask_add_ps,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_cmpeq_epi32_mask",     test_simde_mm512_mask_cmpeq_epi32_mask,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_cmpgt_epi64_mask",     test_simde_mm512_mask_cmpgt_epi64_mask,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_compress_epi32",       test_simde_mm512_mask_compress_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_compress_epi64",       test_simde_mm512_mask_compress_epi64,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_compress_ps",          test_simde_mm512_mask_compress_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_compressstoreu_epi32", test_simde_mm512_mask_compressstoreu_epi32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_compressstoreu_pd",    test_simde_mm512_mask_compressstoreu_pd,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_expand_epi32",         test_simde_mm512_mask_expand_epi32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_expand_pd",            test_simde_mm512_mask_expand_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_expandloadu_epi32",    test_simde_mm512_mask_expandloadu_epi32,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_loadu_epi32",          test_simde_mm512_mask_loadu_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_loadu_pd",             test_simde_mm512_mask_loadu_pd,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_max_ps",               test_simde_mm512_mask_max_ps,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_mov_epi32",            test_simde_mm512_mask_mov_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_mov_pd",               test_simde_mm512_mask_mov_pd,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_mullo_epi32",          test_simde_mm512_mask_mullo_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_reduce_add_epi32",     test_simde_mm512_mask_reduce_add_epi32,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_reduce_add_ps",        test_simde_mm512_mask_reduce_add_ps,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_reduce_mul_pd",        test_simde_mm512_mask_reduce_mul_pd,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_storeu_epi32",         test_simde_mm512_mask_storeu_epi32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_storeu_epi64",         test_simde_mm512_mask_storeu_epi64,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_storeu_pd",            test_simde_mm512_mask_storeu_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_storeu_ps",            test_simde_mm512_mask_storeu_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mask_sub_pd",               test_simde_mm512_mask_sub_pd,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_add_epi32",           test_simde_mm512_maskz_add_epi32,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_add_pd",              test_simde_mm512_maskz_add_pd,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_add_ps",              test_simde_mm512_maskz_add_ps,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_compress_epi32",      test_simde_mm512_maskz_compress_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_compress_pd",         test_simde_mm512_maskz_compress_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_expand_epi64",        test_simde_mm512_maskz_expand_epi64,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_expand_ps",           test_simde_mm512_maskz_expand_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_expandloadu_ps",      test_simde_mm512_maskz_expandloadu_ps,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_loadu_epi64",         test_simde_mm512_maskz_loadu_epi64,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_loadu_ps",            test_simde_mm512_maskz_loadu_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_min_epu32",           test_simde_mm512_maskz_min_epu32,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_mov_epi64",           test_simde_mm512_maskz_mov_epi64,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_mov_ps",              test_simde_mm512_maskz_mov_ps,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_maskz_sub_epi64",           test_simde_mm512_maskz_sub_epi64,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_max_epi32",                 test_simde_mm512_max_epi32,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_max_epu32",                 test_simde_mm512_max_epu32,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_max_pd",                    test_simde_mm512_max_pd,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_max_ps",                    test_simde_mm512_max_ps,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_min_epi32",                 test_simde_mm512_min_epi32,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_min_epu32",                 test_simde_mm512_min_epu32,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_min_pd",                    test_simde_mm512_min_pd,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_min_ps",                    test_simde_mm512_min_ps,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mul_pd",                    test_simde_mm512_mul_pd,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mul_ps",                    test_simde_mm512_mul_ps,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_mullo_epi32",               test_simde_mm512_mullo_epi32,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_or_si512",                  test_simde_mm512_or_si512,                  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_add_epi32",          test_simde_mm512_reduce_add_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_add_epi64",          test_simde_mm512_reduce_add_epi64,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_add_pd",             test_simde_mm512_reduce_add_pd,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_add_ps",             test_simde_mm512_reduce_add_ps,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_max_epi32",          test_simde_mm512_reduce_max_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_max_epu32",          test_simde_mm512_reduce_max_epu32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_max_pd",             test_simde_mm512_reduce_max_pd,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_max_ps",             test_simde_mm512_reduce_max_ps,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_min_epi32",          test_simde_mm512_reduce_min_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_min_epu32",          test_simde_mm512_reduce_min_epu32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_min_pd",             test_simde_mm512_reduce_min_pd,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_min_ps",             test_simde_mm512_reduce_min_ps,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_mul_epi32",          test_simde_mm512_reduce_mul_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_mul_epi64",          test_simde_mm512_reduce_mul_epi64,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_mul_pd",             test_simde_mm512_reduce_mul_pd,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_reduce_mul_ps",             test_simde_mm512_reduce_mul_ps,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_sqrt_pd",                   test_simde_mm512_sqrt_pd,                   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_sqrt_ps",                   test_simde_mm512_sqrt_ps,                   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_sub_epi32",                 test_simde_mm512_sub_epi32,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_sub_epi64",                 test_simde_mm512_sub_epi64,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_sub_pd",                    test_simde_mm512_sub_pd,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_sub_ps",                    test_simde_mm512_sub_ps,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm512_xor_si512",                 test_simde_mm512_xor_si512,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_avx512f_test_suite = {
+  (char*) "/avx512f",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
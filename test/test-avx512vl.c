@@ -0,0 +1,854 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../avx512vl.h"
+
+static MunitResult
+test_simde_mm_mask_compress_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 src;
+    simde__mmask8 k;
+    simde__m128 a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -709.65f,   -790.84f,   -681.84f,   -870.88f),
+      UINT8_C(0x7e),
+      simde_mm_set_ps(  -783.41f,   -813.08f,   -471.04f,    -42.20f),
+      simde_mm_set_ps(  -709.65f,   -783.41f,   -813.08f,   -471.04f) },
+    { simde_mm_set_ps(  -425.93f,    631.08f,   -638.63f,   -224.14f),
+      UINT8_C(0x1b),
+      simde_mm_set_ps(  -624.40f,   -655.37f,    746.05f,    828.73f),
+      simde_mm_set_ps(  -425.93f,   -624.40f,    746.05f,    828.73f) },
+    { simde_mm_set_ps(  -993.64f,   -410.26f,    596.10f,    916.68f),
+      UINT8_C(0x48),
+      simde_mm_set_ps(    15.68f,   -163.12f,    190.86f,   -800.18f),
+      simde_mm_set_ps(  -993.64f,   -410.26f,    596.10f,     15.68f) },
+    { simde_mm_set_ps(  -674.71f,     57.75f,   -624.26f,    627.59f),
+      UINT8_C(0x23),
+      simde_mm_set_ps(  -992.20f,    944.31f,    -61.38f,    888.75f),
+      simde_mm_set_ps(  -674.71f,     57.75f,    -61.38f,    888.75f) },
+    { simde_mm_set_ps(   854.60f,    440.76f,    701.06f,   -519.48f),
+      UINT8_C(0xd0),
+      simde_mm_set_ps(   111.12f,    199.00f,    440.85f,    335.34f),
+      simde_mm_set_ps(   854.60f,    440.76f,    701.06f,   -519.48f) },
+    { simde_mm_set_ps(   846.98f,    880.57f,   -691.37f,   -434.15f),
+      UINT8_C(0xcb),
+      simde_mm_set_ps(   314.77f,    627.40f,    313.89f,    -36.81f),
+      simde_mm_set_ps(   846.98f,    314.77f,    313.89f,    -36.81f) },
+    { simde_mm_set_ps(   805.22f,    673.33f,   -462.02f,   -664.41f),
+      UINT8_C(0x1b),
+      simde_mm_set_ps(   425.83f,   -980.98f,    476.99f,     64.93f),
+      simde_mm_set_ps(   805.22f,    425.83f,    476.99f,     64.93f) },
+    { simde_mm_set_ps(   123.99f,    809.90f,    640.23f,   -491.80f),
+      UINT8_C(0x02),
+      simde_mm_set_ps(  -324.59f,   -401.03f,   -406.72f,   -459.42f),
+      simde_mm_set_ps(   123.99f,    809.90f,    640.23f,   -406.72f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_mask_compress_ps(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_compressstoreu_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i src;
+    simde__mmask8 k;
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1926059102,  -604180471,   148705837, -1398685888),
+      UINT8_C(0x44),
+      simde_mm_set_epi32( 1446578450,   302193101, -1983476920, -1014279286),
+      simde_mm_set_epi32(-1926059102,  -604180471,   148705837,   302193101) },
+    { simde_mm_set_epi32(  316528639,   363374645,  1491631752,   741556898),
+      UINT8_C(0xab),
+      simde_mm_set_epi32( -311555366,  -103769656,  1167638647,  -736581564),
+      simde_mm_set_epi32(  316528639,  -311555366,  1167638647,  -736581564) },
+    { simde_mm_set_epi32(  217864564, -1778814252, -1986508981,   929091525),
+      UINT8_C(0x7a),
+      simde_mm_set_epi32(-1946757718,  1856298900,  1331227198, -1951987254),
+      simde_mm_set_epi32(  217864564, -1778814252, -1946757718,  1331227198) },
+    { simde_mm_set_epi32(-1256563369,  1024570770,   636889022,  1122630355),
+      UINT8_C(0x73),
+      simde_mm_set_epi32(-1395238224,  1661320097,  1999237172, -1362431287),
+      simde_mm_set_epi32(-1256563369,  1024570770,  1999237172, -1362431287) },
+    { simde_mm_set_epi32( -652617539,  1158437909,  -432379677,  -582357892),
+      UINT8_C(0x2d),
+      simde_mm_set_epi32(-2117305740,   242424982,  -209071665,   721878518),
+      simde_mm_set_epi32( -652617539, -2117305740,   242424982,   721878518) },
+    { simde_mm_set_epi32( 1717793531, -1769085124, -1824421163, -1225562306),
+      UINT8_C(0x03),
+      simde_mm_set_epi32( 1549227190,   857120123,  1106432174,  -442922600),
+      simde_mm_set_epi32( 1717793531, -1769085124,  1106432174,  -442922600) },
+    { simde_mm_set_epi32(-2100084153, -1257535562,   618473785, -2136864063),
+      UINT8_C(0x48),
+      simde_mm_set_epi32(-1521069445,  -597796744,   856770835, -1672899763),
+      simde_mm_set_epi32(-2100084153, -1257535562,   618473785, -1521069445) },
+    { simde_mm_set_epi32( 1674546826, -1806416197,   398445524,   321331549),
+      UINT8_C(0x17),
+      simde_mm_set_epi32(-1017485611,  -794051146, -1814126092,  -481647934),
+      simde_mm_set_epi32( 1674546826,  -794051146, -1814126092,  -481647934) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = test_vec[i].src;
+    simde_mm_mask_compressstoreu_epi32((int32_t*) &r, test_vec[i].k, test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_expand_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i src;
+    simde__mmask8 k;
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32( 1356545760, -1162800652,   767496988,  1443689341),
+      UINT8_C(0xb2),
+      simde_mm_set_epi32( -755091777,  1737064234,  -547819457,  -109725088),
+      simde_mm_set_epi32( 1356545760, -1162800652,  -109725088,  1443689341) },
+    { simde_mm_set_epi32( -475565369,  -424398974,  1503070753,   334879311),
+      UINT8_C(0xa0),
+      simde_mm_set_epi32(   15233498, -1898876437,   690872701,  -841782445),
+      simde_mm_set_epi32( -475565369,  -424398974,  1503070753,   334879311) },
+    { simde_mm_set_epi32( -856269884, -2104388432,   686200209,  -683435573),
+      UINT8_C(0xcd),
+      simde_mm_set_epi32( -660523841,   709884416,  -762870172,  1741339718),
+      simde_mm_set_epi32(  709884416,  -762870172,   686200209,  1741339718) },
+    { simde_mm_set_epi32( 1752935277,  1485208887,  -127588920,  -436304217),
+      UINT8_C(0x81),
+      simde_mm_set_epi32( -242964327,  1496869133,  -396837171,  -547737288),
+      simde_mm_set_epi32( 1752935277,  1485208887,  -127588920,  -547737288) },
+    { simde_mm_set_epi32(-1613151814,  -266274234, -1771397336,  -623852754),
+      UINT8_C(0x7b),
+      simde_mm_set_epi32( 1204325914,  -558347117,  1178424249,   404393836),
+      simde_mm_set_epi32( -558347117,  -266274234,  1178424249,   404393836) },
+    { simde_mm_set_epi32(-1384368077,   816408651,  -548939025,  -732899395),
+      UINT8_C(0x57),
+      simde_mm_set_epi32( 1605000601, -1485490400,  -404898397,  1139999951),
+      simde_mm_set_epi32(-1384368077, -1485490400,  -404898397,  1139999951) },
+    { simde_mm_set_epi32(-1662333145,  2023638985,  2146915585,   709653412),
+      UINT8_C(0xb9),
+      simde_mm_set_epi32(  441249706, -1781458343, -1892808142,  -481024450),
+      simde_mm_set_epi32(-1892808142,  2023638985,  2146915585,  -481024450) },
+    { simde_mm_set_epi32( -207350834,  -724884536,  2067042107,  -497576848),
+      UINT8_C(0xf3),
+      simde_mm_set_epi32( 1562485193,  -995032373,   263795733,   535699117),
+      simde_mm_set_epi32( -207350834,  -724884536,   263795733,   535699117) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mask_expand_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskz_compress_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { UINT8_C(0x56),
+      simde_mm_set_epi64x(INT64_C( 6602378062368085417), INT64_C(-7324032006471022851)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C( 6602378062368085417)) },
+    { UINT8_C(0x26),
+      simde_mm_set_epi64x(INT64_C(-7681024016566835382), INT64_C( 5784555773994064749)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(-7681024016566835382)) },
+    { UINT8_C(0x41),
+      simde_mm_set_epi64x(INT64_C(   93877602893765111), INT64_C(-7038632051985097714)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(-7038632051985097714)) },
+    { UINT8_C(0xe2),
+      simde_mm_set_epi64x(INT64_C(-5873597354850266266), INT64_C(-7507243271011239813)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(-5873597354850266266)) },
+    { UINT8_C(0x60),
+      simde_mm_set_epi64x(INT64_C( 2319818763434612042), INT64_C(-8653008737648823639)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(0x13),
+      simde_mm_set_epi64x(INT64_C(-7645062242588432072), INT64_C(-1511066675959637443)),
+      simde_mm_set_epi64x(INT64_C(-7645062242588432072), INT64_C(-1511066675959637443)) },
+    { UINT8_C(0xca),
+      simde_mm_set_epi64x(INT64_C(-7088478995784268395), INT64_C( 6412066679601226534)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(-7088478995784268395)) },
+    { UINT8_C(0xc3),
+      simde_mm_set_epi64x(INT64_C(-6383004826114286807), INT64_C( 8197968516026043974)),
+      simde_mm_set_epi64x(INT64_C(-6383004826114286807), INT64_C( 8197968516026043974)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_maskz_compress_epi64(test_vec[i].k, test_vec[i].a);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskz_expand_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m128d a;
+    simde__m128d r;
+  } test_vec[8] = {
+    { UINT8_C(0xb9),
+      simde_mm_set_pd(   761.43,   -763.39),
+      simde_mm_set_pd(     0.00,   -763.39) },
+    { UINT8_C(0x37),
+      simde_mm_set_pd(    73.95,   -442.41),
+      simde_mm_set_pd(    73.95,   -442.41) },
+    { UINT8_C(0xf1),
+      simde_mm_set_pd(  -416.83,   -464.24),
+      simde_mm_set_pd(     0.00,   -464.24) },
+    { UINT8_C(0x4a),
+      simde_mm_set_pd(   989.63,    710.56),
+      simde_mm_set_pd(   710.56,      0.00) },
+    { UINT8_C(0xcd),
+      simde_mm_set_pd(  -233.74,   -220.30),
+      simde_mm_set_pd(     0.00,   -220.30) },
+    { UINT8_C(0x1e),
+      simde_mm_set_pd(   914.51,   -540.52),
+      simde_mm_set_pd(  -540.52,      0.00) },
+    { UINT8_C(0x77),
+      simde_mm_set_pd(   556.85,    463.74),
+      simde_mm_set_pd(   556.85,    463.74) },
+    { UINT8_C(0x0d),
+      simde_mm_set_pd(  -804.90,   -831.06),
+      simde_mm_set_pd(     0.00,   -831.06) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_maskz_expand_pd(test_vec[i].k, test_vec[i].a);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskz_expandloadu_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { UINT8_C(0xa4),
+      simde_mm_set_epi32( 1197369235,  1658182029,  1156895839,  2079360125),
+      simde_mm_set_epi32(          0,  2079360125,           0,           0) },
+    { UINT8_C(0xa6),
+      simde_mm_set_epi32(  646855609,  1302982837, -1446118849,   268712433),
+      simde_mm_set_epi32(          0, -1446118849,   268712433,           0) },
+    { UINT8_C(0xa6),
+      simde_mm_set_epi32( 1136910646, -1157302279,   608993017,   -39322271),
+      simde_mm_set_epi32(          0,   608993017,   -39322271,           0) },
+    { UINT8_C(0x6d),
+      simde_mm_set_epi32(  165935041, -1850206814,   -38877417, -1238119772),
+      simde_mm_set_epi32(-1850206814,   -38877417,           0, -1238119772) },
+    { UINT8_C(0x82),
+      simde_mm_set_epi32(  891091226,  -566941345, -1373700898,   385746802),
+      simde_mm_set_epi32(          0,           0,   385746802,           0) },
+    { UINT8_C(0x3d),
+      simde_mm_set_epi32(  593768869, -1355051656,  1510389436,  1719426792),
+      simde_mm_set_epi32(-1355051656,  1510389436,           0,  1719426792) },
+    { UINT8_C(0x60),
+      simde_mm_set_epi32(  736030919,    48876454,  1212626024,   856814069),
+      simde_mm_set_epi32(          0,           0,           0,           0) },
+    { UINT8_C(0x4c),
+      simde_mm_set_epi32( -549316962, -1883894952,  1885305415,  -871339678),
+      simde_mm_set_epi32( 1885305415,  -871339678,           0,           0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_maskz_expandloadu_epi32(test_vec[i].k, (int32_t const*) &(test_vec[i].a));
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskz_mov_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m128 a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { UINT8_C(0x24),
+      simde_mm_set_ps(   704.40f,    279.33f,    945.75f,   -196.53f),
+      simde_mm_set_ps(     0.00f,    279.33f,      0.00f,      0.00f) },
+    { UINT8_C(0xb4),
+      simde_mm_set_ps(   338.05f,    583.36f,   -294.47f,   -829.27f),
+      simde_mm_set_ps(     0.00f,    583.36f,      0.00f,      0.00f) },
+    { UINT8_C(0x85),
+      simde_mm_set_ps(  -340.35f,    976.72f,    -28.87f,   -412.48f),
+      simde_mm_set_ps(     0.00f,    976.72f,      0.00f,   -412.48f) },
+    { UINT8_C(0xf3),
+      simde_mm_set_ps(  -313.37f,    399.17f,   -900.64f,   -104.44f),
+      simde_mm_set_ps(     0.00f,      0.00f,   -900.64f,   -104.44f) },
+    { UINT8_C(0x95),
+      simde_mm_set_ps(  -514.29f,    878.71f,    504.24f,    711.38f),
+      simde_mm_set_ps(     0.00f,    878.71f,      0.00f,    711.38f) },
+    { UINT8_C(0x55),
+      simde_mm_set_ps(   717.90f,     -3.42f,    688.69f,    452.10f),
+      simde_mm_set_ps(     0.00f,     -3.42f,      0.00f,    452.10f) },
+    { UINT8_C(0x97),
+      simde_mm_set_ps(   764.01f,    305.53f,    501.35f,    -67.84f),
+      simde_mm_set_ps(     0.00f,    305.53f,    501.35f,    -67.84f) },
+    { UINT8_C(0x57),
+      simde_mm_set_ps(   628.61f,      5.74f,    110.28f,   -124.29f),
+      simde_mm_set_ps(     0.00f,      5.74f,    110.28f,   -124.29f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_maskz_mov_ps(test_vec[i].k, test_vec[i].a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_compress_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i src;
+    simde__mmask8 k;
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( -204850270,  1483213179,   570529393,  1502527466,
+                              577201983,  -432703292,  1192470968,  1720179563),
+      UINT8_C(0xb5),
+      simde_mm256_set_epi32( 1849590724,  -559621757,  -359569463, -1703134874,
+                             -458048814,  1675182569,   326413788,  -135665601),
+      simde_mm256_set_epi32( -204850270,  1483213179,   570529393,  1849590724,
+                             -359569463, -1703134874,  1675182569,  -135665601) },
+    { simde_mm256_set_epi32( 1498354285,   490336860, -1275486532,  1183693655,
+                             -311768414,  -962167552, -1232936501,  1360737168),
+      UINT8_C(0x29),
+      simde_mm256_set_epi32( 1282578332, -1001160009,  2016253600,  -935930079,
+                            -1932836054,   334610609,   529322910,   193638493),
+      simde_mm256_set_epi32( 1498354285,   490336860, -1275486532,  1183693655,
+                             -311768414,  2016253600, -1932836054,   193638493) },
+    { simde_mm256_set_epi32(-1431302686,  1782132537, -1567017534,  1079776012,
+                             1558118810,  2037115285,  -379373658,  1323630404),
+      UINT8_C(0x0b),
+      simde_mm256_set_epi32( 1127711169, -1151131533,  1970317028,   301341712,
+                            -1543435953,   702060283, -1644796775,   -72481548),
+      simde_mm256_set_epi32(-1431302686,  1782132537, -1567017534,  1079776012,
+                             1558118810, -1543435953, -1644796775,   -72481548) },
+    { simde_mm256_set_epi32( -539122106,   300391966,  1718179688,   637019836,
+                             1980423479, -1767025239,   935235000,  2097365993),
+      UINT8_C(0xd0),
+      simde_mm256_set_epi32( 1429965134,  -198864503,  1982592299,   869396941,
+                             -752678050, -1922269908, -1504659592,  1011656497),
+      simde_mm256_set_epi32( -539122106,   300391966,  1718179688,   637019836,
+                             1980423479,  1429965134,  -198864503,   869396941) },
+    { simde_mm256_set_epi32( 1735226247,   -71612868, -1290940329,  -692126085,
+                             -955685215,  -781654037, -1407415557,  2004918004),
+      UINT8_C(0x0d),
+      simde_mm256_set_epi32( -902557803,  -974217727,  1311758542,  1114164940,
+                             1758141637,  -862266657,  1391789743, -1011629139),
+      simde_mm256_set_epi32( 1735226247,   -71612868, -1290940329,  -692126085,
+                             -955685215,  1758141637,  -862266657, -1011629139) },
+    { simde_mm256_set_epi32( 1538525967,  1379398407,   207505227, -1349978049,
+                              783550841,   658276228,   690987080,  -188858355),
+      UINT8_C(0x1b),
+      simde_mm256_set_epi32( 1698030903, -1745835342,   351669045,   496859987,
+                            -1510316403,   866774568,  2102747623, -1278560700),
+      simde_mm256_set_epi32( 1538525967,  1379398407,   207505227, -1349978049,
+                              496859987, -1510316403,  2102747623, -1278560700) },
+    { simde_mm256_set_epi32( -961851294,  1418267815,  1869010060,  -949267815,
+                            -1012648606,  -514719873,    26398131, -1554138074),
+      UINT8_C(0xc3),
+      simde_mm256_set_epi32( 1399021528, -1205273572,  1667508222,  1256418937,
+                            -1631810501,  1712759731,  1570249895, -2021106510),
+      simde_mm256_set_epi32( -961851294,  1418267815,  1869010060,  -949267815,
+                             1399021528, -1205273572,  1570249895, -2021106510) },
+    { simde_mm256_set_epi32( -413058256,   744526759,  1872247385,  1082255247,
+                              386781706, -1545876760,  2052253836,  1688029598),
+      UINT8_C(0xa8),
+      simde_mm256_set_epi32(  851518371,  1928206671, -1122264150,   -30275272,
+                              -66836922,  1924311453,  -808619790,  1853782007),
+      simde_mm256_set_epi32( -413058256,   744526759,  1872247385,  1082255247,
+                              386781706,   851518371, -1122264150,   -66836922) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_compress_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_compressstoreu_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i src;
+    simde__mmask8 k;
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(-4153441017122035973), INT64_C( 2570127391568644821),
+                             INT64_C(-4151403742310096711), INT64_C( 5083454156658707484)),
+      UINT8_C(0x3b),
+      simde_mm256_set_epi64x(INT64_C(  943562857002024170), INT64_C(  846383742438384462),
+                             INT64_C( 4730307450125931438), INT64_C(-1679420471777018087)),
+      simde_mm256_set_epi64x(INT64_C(-4153441017122035973), INT64_C(  943562857002024170),
+                             INT64_C( 4730307450125931438), INT64_C(-1679420471777018087)) },
+    { simde_mm256_set_epi64x(INT64_C( 2156851610496787079), INT64_C(-7722306479802615438),
+                             INT64_C( 6856653354181174861), INT64_C(-9016831046713648085)),
+      UINT8_C(0x02),
+      simde_mm256_set_epi64x(INT64_C(-1007086463478147118), INT64_C(  633735762176487843),
+                             INT64_C(-5680290101051690732), INT64_C(-1971382175586381015)),
+      simde_mm256_set_epi64x(INT64_C( 2156851610496787079), INT64_C(-7722306479802615438),
+                             INT64_C( 6856653354181174861), INT64_C(-5680290101051690732)) },
+    { simde_mm256_set_epi64x(INT64_C(-3784454611539826344), INT64_C(-7324239692915772499),
+                             INT64_C( 6725384276544904433), INT64_C(-7608423970524688384)),
+      UINT8_C(0x8a),
+      simde_mm256_set_epi64x(INT64_C( 2129529200875802355), INT64_C(-5109390572797909365),
+                             INT64_C( 1614795092602041330), INT64_C( 2189601238044352909)),
+      simde_mm256_set_epi64x(INT64_C(-3784454611539826344), INT64_C(-7324239692915772499),
+                             INT64_C( 2129529200875802355), INT64_C( 1614795092602041330)) },
+    { simde_mm256_set_epi64x(INT64_C(-5550768692168687377), INT64_C( 3289114351621842666),
+                             INT64_C(-7825128615995544981), INT64_C( 8641219967888687818)),
+      UINT8_C(0xf1),
+      simde_mm256_set_epi64x(INT64_C( 6343487600614355935), INT64_C( 7301993918141226682),
+                             INT64_C(-4324054682846020078), INT64_C( 1959168705092200236)),
+      simde_mm256_set_epi64x(INT64_C(-5550768692168687377), INT64_C( 3289114351621842666),
+                             INT64_C(-7825128615995544981), INT64_C( 1959168705092200236)) },
+    { simde_mm256_set_epi64x(INT64_C( 7883653349208593471), INT64_C(  173733141732998502),
+                             INT64_C( 6773851724759244245), INT64_C(-8071798653838296656)),
+      UINT8_C(0x1a),
+      simde_mm256_set_epi64x(INT64_C( 5840571136169575395), INT64_C( 2849421435803212483),
+                             INT64_C(-3714853596149093673), INT64_C(-2926458525289486001)),
+      simde_mm256_set_epi64x(INT64_C( 7883653349208593471), INT64_C(  173733141732998502),
+                             INT64_C( 5840571136169575395), INT64_C(-3714853596149093673)) },
+    { simde_mm256_set_epi64x(INT64_C( 5128931708204650289), INT64_C(-2727803185181615030),
+                             INT64_C( 3515459304084449291), INT64_C(-1203988897001596839)),
+      UINT8_C(0x5b),
+      simde_mm256_set_epi64x(INT64_C(-8682472961409829974), INT64_C(-8986892840101533431),
+                             INT64_C( 1285734670873597505), INT64_C( 9183431607985604874)),
+      simde_mm256_set_epi64x(INT64_C( 5128931708204650289), INT64_C(-8682472961409829974),
+                             INT64_C( 1285734670873597505), INT64_C( 9183431607985604874)) },
+    { simde_mm256_set_epi64x(INT64_C( 5988569396963331474), INT64_C(-5787402244684190879),
+                             INT64_C( 3627957253906306773), INT64_C( 2195084678807227517)),
+      UINT8_C(0xf2),
+      simde_mm256_set_epi64x(INT64_C(-5623346647752150702), INT64_C(-5656290184801931150),
+                             INT64_C(-8592140003324055371), INT64_C(-8869719038561199130)),
+      simde_mm256_set_epi64x(INT64_C( 5988569396963331474), INT64_C(-5787402244684190879),
+                             INT64_C( 3627957253906306773), INT64_C(-8592140003324055371)) },
+    { simde_mm256_set_epi64x(INT64_C(-7078701226578111971), INT64_C(-2460366989263770876),
+                             INT64_C(  976409016987621940), INT64_C(-1608976342982647253)),
+      UINT8_C(0xc6),
+      simde_mm256_set_epi64x(INT64_C( -523866180963800918), INT64_C(-4155148057246122191),
+                             INT64_C(-3727205624303338020), INT64_C( 2379522037090494342)),
+      simde_mm256_set_epi64x(INT64_C(-7078701226578111971), INT64_C(-2460366989263770876),
+                             INT64_C(-4155148057246122191), INT64_C(-3727205624303338020)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = test_vec[i].src;
+    simde_mm256_mask_compressstoreu_epi64((int64_t*) &r, test_vec[i].k, test_vec[i].a);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_expand_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 src;
+    simde__mmask8 k;
+    simde__m256 a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   507.06f,   -566.02f,    100.89f,    248.39f,
+                           -621.79f,   -155.56f,   -209.43f,    -23.98f),
+      UINT8_C(0xd8),
+      simde_mm256_set_ps(   670.88f,    479.48f,   -264.46f,   -350.87f,
+                            652.45f,    413.32f,   -865.65f,    826.05f),
+      simde_mm256_set_ps(   652.45f,    413.32f,    100.89f,   -865.65f,
+                            826.05f,   -155.56f,   -209.43f,    -23.98f) },
+    { simde_mm256_set_ps(   891.42f,    101.97f,   -106.27f,    395.14f,
+                           -171.68f,    815.82f,   -894.40f,    287.67f),
+      UINT8_C(0x10),
+      simde_mm256_set_ps(  -468.78f,    130.78f,   -184.93f,    709.82f,
+                            616.94f,   -514.09f,    842.44f,   -550.38f),
+      simde_mm256_set_ps(   891.42f,    101.97f,   -106.27f,   -550.38f,
+                           -171.68f,    815.82f,   -894.40f,    287.67f) },
+    { simde_mm256_set_ps(  -733.41f,    459.86f,   -219.32f,    110.79f,
+                             -4.69f,    140.77f,   -178.48f,    -41.29f),
+      UINT8_C(0x32),
+      simde_mm256_set_ps(   106.98f,   -250.53f,    959.12f,    414.97f,
+                           -600.47f,   -285.96f,    -86.73f,   -480.70f),
+      simde_mm256_set_ps(  -733.41f,    459.86f,   -285.96f,    -86.73f,
+                             -4.69f,    140.77f,   -480.70f,    -41.29f) },
+    { simde_mm256_set_ps(   639.34f,   -592.27f,   -556.72f,   -406.34f,
+                            558.73f,    711.25f,    543.64f,    168.83f),
+      UINT8_C(0x7b),
+      simde_mm256_set_ps(  -483.48f,    146.75f,    176.26f,   -502.30f,
+                            710.31f,   -747.56f,    561.17f,    694.37f),
+      simde_mm256_set_ps(   639.34f,    176.26f,   -502.30f,    710.31f,
+                           -747.56f,    711.25f,    561.17f,    694.37f) },
+    { simde_mm256_set_ps(   456.79f,   -961.58f,   -949.15f,    226.52f,
+                           -758.11f,    540.55f,    156.30f,   -965.54f),
+      UINT8_C(0x6a),
+      simde_mm256_set_ps(    22.80f,    308.90f,   -883.04f,   -179.71f,
+                            411.01f,   -298.41f,    432.65f,     10.24f),
+      simde_mm256_set_ps(   456.79f,    411.01f,   -298.41f,    226.52f,
+                            432.65f,    540.55f,     10.24f,   -965.54f) },
+    { simde_mm256_set_ps(    -7.73f,   -592.25f,    217.58f,    396.40f,
+                            718.85f,    792.82f,   -425.23f,    872.32f),
+      UINT8_C(0x19),
+      simde_mm256_set_ps(   210.51f,   -628.00f,    138.50f,    531.66f,
+                           -678.74f,    876.62f,     24.97f,    522.88f),
+      simde_mm256_set_ps(    -7.73f,   -592.25f,    217.58f,    876.62f,
+                             24.97f,    792.82f,   -425.23f,    522.88f) },
+    { simde_mm256_set_ps(   985.15f,    114.07f,    326.12f,    325.07f,
+                           -369.84f,   -810.29f,    -16.68f,    -49.42f),
+      UINT8_C(0xb5),
+      simde_mm256_set_ps(  -957.60f,   -553.53f,    -25.96f,     -1.40f,
+                           -618.55f,   -849.94f,    264.44f,    687.79f),
+      simde_mm256_set_ps(    -1.40f,    114.07f,   -618.55f,   -849.94f,
+                           -369.84f,    264.44f,    -16.68f,    687.79f) },
+    { simde_mm256_set_ps(  -487.23f,   -595.50f,   -676.79f,    612.31f,
+                            296.66f,    718.28f,    913.26f,    660.10f),
+      UINT8_C(0x48),
+      simde_mm256_set_ps(   103.93f,   -391.06f,    408.41f,   -654.34f,
+                            725.15f,    919.14f,   -680.44f,    869.21f),
+      simde_mm256_set_ps(  -487.23f,   -680.44f,   -676.79f,    612.31f,
+                            869.21f,    718.28f,    913.26f,    660.10f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_mask_expand_ps(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_expandloadu_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d src;
+    simde__mmask8 k;
+    simde__m256d a;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   819.43,    857.02,   -203.02,   -691.51),
+      UINT8_C(0x8a),
+      simde_mm256_set_pd(   605.33,    506.40,   -151.69,   -992.06),
+      simde_mm256_set_pd(  -151.69,    857.02,   -992.06,   -691.51) },
+    { simde_mm256_set_pd(  -113.70,   -809.59,    942.66,   -785.16),
+      UINT8_C(0x29),
+      simde_mm256_set_pd(  -352.09,    -75.75,   -973.64,   -734.82),
+      simde_mm256_set_pd(  -973.64,   -809.59,    942.66,   -734.82) },
+    { simde_mm256_set_pd(    53.87,    200.63,   -231.63,    229.22),
+      UINT8_C(0x60),
+      simde_mm256_set_pd(   357.55,   -304.60,    395.71,   -609.86),
+      simde_mm256_set_pd(    53.87,    200.63,   -231.63,    229.22) },
+    { simde_mm256_set_pd(   -61.14,   -109.32,   -217.34,   -493.53),
+      UINT8_C(0xc9),
+      simde_mm256_set_pd(    -7.43,   -851.13,   -489.37,    998.32),
+      simde_mm256_set_pd(  -489.37,   -109.32,   -217.34,    998.32) },
+    { simde_mm256_set_pd(  -429.77,   -960.81,    176.96,    280.93),
+      UINT8_C(0x9c),
+      simde_mm256_set_pd(   551.17,    411.57,   -805.57,     70.61),
+      simde_mm256_set_pd(  -805.57,     70.61,    176.96,    280.93) },
+    { simde_mm256_set_pd(   343.37,   -488.45,   -373.46,   -193.51),
+      UINT8_C(0x28),
+      simde_mm256_set_pd(  -606.54,   -677.32,    188.55,    379.58),
+      simde_mm256_set_pd(   379.58,   -488.45,   -373.46,   -193.51) },
+    { simde_mm256_set_pd(  -178.20,    210.85,   -275.15,   -658.53),
+      UINT8_C(0xfd),
+      simde_mm256_set_pd(    85.47,     26.62,   -975.01,   -490.03),
+      simde_mm256_set_pd(    26.62,   -975.01,   -275.15,   -490.03) },
+    { simde_mm256_set_pd(   924.78,     84.31,   -288.63,    234.52),
+      UINT8_C(0x11),
+      simde_mm256_set_pd(   562.28,   -697.18,   -474.56,   -617.01),
+      simde_mm256_set_pd(   924.78,     84.31,   -288.63,   -617.01) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_mask_expandloadu_pd(test_vec[i].src, test_vec[i].k, (simde_float64 const*) &(test_vec[i].a));
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_mov_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i src;
+    simde__mmask8 k;
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32( -515582232,  2033064692,   383820229,   500059771,
+                             -829299312,    84686477,  2007895027,  -289865106),
+      UINT8_C(0xfa),
+      simde_mm256_set_epi32(-1712832678,  1350171741,  2046340519,  -996420037,
+                             1962916072, -2058922281,  1317384406, -1445770942),
+      simde_mm256_set_epi32(-1712832678,  1350171741,  2046340519,  -996420037,
+                             1962916072,    84686477,  1317384406,  -289865106) },
+    { simde_mm256_set_epi32(  555778661,  -855446148, -1686201807,  1356176394,
+                              768592046,   247950592,  -624994939,   967928689),
+      UINT8_C(0x62),
+      simde_mm256_set_epi32( 1881224344, -1300596602, -1909680003,  1847487725,
+                             1153591783,  -629184109, -2115452422, -1277964867),
+      simde_mm256_set_epi32(  555778661, -1300596602, -1909680003,  1356176394,
+                              768592046,   247950592, -2115452422,   967928689) },
+    { simde_mm256_set_epi32( -494381358,   367872179, -1683937587,      -62276,
+                            -1884064769, -1205999845,  1278660827,    95469820),
+      UINT8_C(0xa5),
+      simde_mm256_set_epi32( 1291338222, -2088916928,   873776252,  1969745336,
+                            -1901383782,  1531025987,   290034711,  -326573862),
+      simde_mm256_set_epi32( 1291338222,   367872179,   873776252,      -62276,
+                            -1884064769,  1531025987,  1278660827,  -326573862) },
+    { simde_mm256_set_epi32( -493147408,   658182310,  2131775155, -1241580122,
+                             1324566895,  -678548945,  1479467049,  1676228649),
+      UINT8_C(0x63),
+      simde_mm256_set_epi32(-1222233563,   347896290,  -422039824,   186016525,
+                              631867050, -1025662741,    15413291,  1168993537),
+      simde_mm256_set_epi32( -493147408,   347896290,  -422039824, -1241580122,
+                             1324566895,  -678548945,    15413291,  1168993537) },
+    { simde_mm256_set_epi32(  492306179,   -15613193,  2034146954, -1133344804,
+                             1462500224,  1784650872,  1427438312,   218462448),
+      UINT8_C(0x7c),
+      simde_mm256_set_epi32(    1455386,   910187504,   834066927,  1754084791,
+                             1434916998,  -499567743,  1819716933,  -902777898),
+      simde_mm256_set_epi32(  492306179,   910187504,   834066927,  1754084791,
+                             1434916998,  -499567743,  1427438312,   218462448) },
+    { simde_mm256_set_epi32( 1029665220,   -11880479,  1665999771,   121415650,
+                              627995062, -1085700465,   -93796334,   953480278),
+      UINT8_C(0x84),
+      simde_mm256_set_epi32(  396893967, -1183779298,  2038924627,  -599771183,
+                             -448311291,   935181060,   169829449,  -868233590),
+      simde_mm256_set_epi32(  396893967,   -11880479,  1665999771,   121415650,
+                              627995062,   935181060,   -93796334,   953480278) },
+    { simde_mm256_set_epi32( -258181479,   293729615, -1251163138,  -745620659,
+                              290814750,   692156251,  2141907897,  -794760780),
+      UINT8_C(0x8e),
+      simde_mm256_set_epi32(  217931390, -1494257797,  -280437239,   -72036202,
+                             -531934363,  2071458740,  1399470388, -1592785154),
+      simde_mm256_set_epi32(  217931390,   293729615, -1251163138,  -745620659,
+                             -531934363,  2071458740,  1399470388,  -794760780) },
+    { simde_mm256_set_epi32( 1561750630,  1635106429,  -649930580, -1675434260,
+                             -687161748, -2040592882, -1110162330, -2132131122),
+      UINT8_C(0x98),
+      simde_mm256_set_epi32( 1673171249, -1236468233,  -151109054, -1607813346,
+                             -229701835,  1297135674,  1119728413,  1645149922),
+      simde_mm256_set_epi32( 1673171249,  1635106429,  -649930580, -1607813346,
+                             -229701835, -2040592882, -1110162330, -2132131122) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_mov_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maskz_compress_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m256d a;
+    simde__m256d r;
+  } test_vec[8] = {
+    { UINT8_C(0xf7),
+      simde_mm256_set_pd(   227.90,   -459.63,    552.99,    159.71),
+      simde_mm256_set_pd(     0.00,   -459.63,    552.99,    159.71) },
+    { UINT8_C(0xa3),
+      simde_mm256_set_pd(    75.28,    922.90,    536.13,    602.61),
+      simde_mm256_set_pd(     0.00,      0.00,    536.13,    602.61) },
+    { UINT8_C(0xe9),
+      simde_mm256_set_pd(   805.36,   -326.70,   -421.39,   -958.49),
+      simde_mm256_set_pd(     0.00,      0.00,    805.36,   -958.49) },
+    { UINT8_C(0x79),
+      simde_mm256_set_pd(  -711.60,    447.86,      2.77,   -387.38),
+      simde_mm256_set_pd(     0.00,      0.00,   -711.60,   -387.38) },
+    { UINT8_C(0x9d),
+      simde_mm256_set_pd(   137.92,    197.67,    -22.54,    348.76),
+      simde_mm256_set_pd(     0.00,    137.92,    197.67,    348.76) },
+    { UINT8_C(0x72),
+      simde_mm256_set_pd(  -421.81,   -514.51,   -886.22,    364.20),
+      simde_mm256_set_pd(     0.00,      0.00,      0.00,   -886.22) },
+    { UINT8_C(0x98),
+      simde_mm256_set_pd(  -192.25,     76.35,    385.85,    696.56),
+      simde_mm256_set_pd(     0.00,      0.00,      0.00,   -192.25) },
+    { UINT8_C(0xab),
+      simde_mm256_set_pd(  -612.76,   -676.62,    993.71,   -613.69),
+      simde_mm256_set_pd(     0.00,   -612.76,    993.71,   -613.69) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_maskz_compress_pd(test_vec[i].k, test_vec[i].a);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maskz_expand_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { UINT8_C(0xdd),
+      simde_mm256_set_epi64x(INT64_C( 7946688788758146291), INT64_C( -433793046557121243),
+                             INT64_C( 7532607624236754756), INT64_C( 2451616388398915714)),
+      simde_mm256_set_epi64x(INT64_C( -433793046557121243), INT64_C( 7532607624236754756),
+                             INT64_C(                   0), INT64_C( 2451616388398915714)) },
+    { UINT8_C(0x2d),
+      simde_mm256_set_epi64x(INT64_C( 3042908531165386470), INT64_C( 1362132218367708249),
+                             INT64_C( -341412103703371981), INT64_C( 5382837548230729649)),
+      simde_mm256_set_epi64x(INT64_C( 1362132218367708249), INT64_C( -341412103703371981),
+                             INT64_C(                   0), INT64_C( 5382837548230729649)) },
+    { UINT8_C(0xfe),
+      simde_mm256_set_epi64x(INT64_C( -187995363134955608), INT64_C(-3447642422033719564),
+                             INT64_C(-3371197738620006645), INT64_C(-6172408921641194432)),
+      simde_mm256_set_epi64x(INT64_C(-3447642422033719564), INT64_C(-3371197738620006645),
+                             INT64_C(-6172408921641194432), INT64_C(                   0)) },
+    { UINT8_C(0xba),
+      simde_mm256_set_epi64x(INT64_C(-4168706280555275325), INT64_C( 8868260622034826600),
+                             INT64_C(-8013506334024625670), INT64_C(-7947073324826855853)),
+      simde_mm256_set_epi64x(INT64_C(-8013506334024625670), INT64_C(                   0),
+                             INT64_C(-7947073324826855853), INT64_C(                   0)) },
+    { UINT8_C(0x4c),
+      simde_mm256_set_epi64x(INT64_C(-2653624266859406596), INT64_C(-2835183143186701263),
+                             INT64_C(-8994007274519430765), INT64_C(-5336673990089248565)),
+      simde_mm256_set_epi64x(INT64_C(-8994007274519430765), INT64_C(-5336673990089248565),
+                             INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(0x1f),
+      simde_mm256_set_epi64x(INT64_C( 4828077824195041871), INT64_C( 7974650756147331353),
+                             INT64_C( 8378869901839003131), INT64_C( 8887935569406656825)),
+      simde_mm256_set_epi64x(INT64_C( 4828077824195041871), INT64_C( 7974650756147331353),
+                             INT64_C( 8378869901839003131), INT64_C( 8887935569406656825)) },
+    { UINT8_C(0x5f),
+      simde_mm256_set_epi64x(INT64_C( -874302726094829317), INT64_C(   30972486428558011),
+                             INT64_C(-4070970757711308973), INT64_C(-2837930130154923759)),
+      simde_mm256_set_epi64x(INT64_C( -874302726094829317), INT64_C(   30972486428558011),
+                             INT64_C(-4070970757711308973), INT64_C(-2837930130154923759)) },
+    { UINT8_C(0x21),
+      simde_mm256_set_epi64x(INT64_C(  424669486520377325), INT64_C( -627134238149237442),
+                             INT64_C( 4866071101992200660), INT64_C(-5490398296854642312)),
+      simde_mm256_set_epi64x(INT64_C(                   0), INT64_C(                   0),
+                             INT64_C(                   0), INT64_C(-5490398296854642312)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_maskz_expand_epi64(test_vec[i].k, test_vec[i].a);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm_mask_compress_ps",             test_simde_mm_mask_compress_ps,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_mask_compressstoreu_epi32",    test_simde_mm_mask_compressstoreu_epi32,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_mask_expand_epi32",            test_simde_mm_mask_expand_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maskz_compress_epi64",         test_simde_mm_maskz_compress_epi64,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maskz_expand_pd",              test_simde_mm_maskz_expand_pd,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maskz_expandloadu_epi32",      test_simde_mm_maskz_expandloadu_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maskz_mov_ps",                 test_simde_mm_maskz_mov_ps,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_compress_epi32",       test_simde_mm256_mask_compress_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_compressstoreu_epi64", test_simde_mm256_mask_compressstoreu_epi64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_expand_ps",            test_simde_mm256_mask_expand_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_expandloadu_pd",       test_simde_mm256_mask_expandloadu_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_mask_mov_epi32",            test_simde_mm256_mask_mov_epi32,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_maskz_compress_pd",         test_simde_mm256_maskz_compress_pd,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_maskz_expand_epi64",        test_simde_mm256_maskz_expand_epi64,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_avx512vl_test_suite = {
+  (char*) "/avx512vl",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
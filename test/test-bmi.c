@@ -0,0 +1,380 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../bmi.h"
+
+static MunitResult
+test_simde_andn_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t b;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0xfdf316ee), UINT32_C(0x40000010), UINT32_C(0x00000010) },
+    { UINT32_C(0x28200420), UINT32_C(0xffd7df5d), UINT32_C(0xd7d7db5d) },
+    { UINT32_C(0xa3fbffff), UINT32_C(0x20408018), UINT32_C(0x00000000) },
+    { UINT32_C(0x04000000), UINT32_C(0xbd75891f), UINT32_C(0xb975891f) },
+    { UINT32_C(0x548a833b), UINT32_C(0x00900008), UINT32_C(0x00100000) },
+    { UINT32_C(0x00023010), UINT32_C(0xf37fff1f), UINT32_C(0xf37dcf0f) },
+    { UINT32_C(0xf78ef7f7), UINT32_C(0x100a1000), UINT32_C(0x00000000) },
+    { UINT32_C(0x502050c0), UINT32_C(0x76af24f3), UINT32_C(0x268f2433) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_andn_u32(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_andn_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0xd197adfb41949fd0), UINT64_C(0x0802002004003482), UINT64_C(0x0800000004002002) },
+    { UINT64_C(0x1430002010384608), UINT64_C(0x6fe7e7ddffbdef4e), UINT64_C(0x6bc7e7ddef85a946) },
+    { UINT64_C(0x5cf6f7effbf5fe6f), UINT64_C(0x01023c3002042872), UINT64_C(0x0100081000000010) },
+    { UINT64_C(0x0020604084180408), UINT64_C(0x3207876dc8bf5ed2), UINT64_C(0x3207872d48a75ad2) },
+    { UINT64_C(0x8dd17193da12856f), UINT64_C(0x0121012000304040), UINT64_C(0x0020002000204000) },
+    { UINT64_C(0x0201040480000041), UINT64_C(0x67ef387cbbff9ff7), UINT64_C(0x65ee38783bff9fb6) },
+    { UINT64_C(0xebe36cb6ddaba9af), UINT64_C(0x00200a0000205810), UINT64_C(0x0000020000005010) },
+    { UINT64_C(0x0008644883020618), UINT64_C(0x47ced3f3f1bf1c7a), UINT64_C(0x47c693b370bd1862) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_andn_u64(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_bextr_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t start;
+    uint32_t len;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0xc5a5f7ed),     0,     8, UINT32_C(0x000000ed) },
+    { UINT32_C(0x1205a103),     4,     0, UINT32_C(0x00000000) },
+    { UINT32_C(0x1a2dc9f1),    13,     7, UINT32_C(0x0000006e) },
+    { UINT32_C(0x00044002),    30,     9, UINT32_C(0x00000000) },
+    { UINT32_C(0x9af7a69a),    40,     3, UINT32_C(0x00000000) },
+    { UINT32_C(0x0c302840),     9,    64, UINT32_C(0x00061814) },
+    { UINT32_C(0xbc07c54d),   258,    12, UINT32_C(0x00000153) },
+    { UINT32_C(0x28140100),    63,   517, UINT32_C(0x00000000) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_bextr_u32(test_vec[i].a, test_vec[i].start, test_vec[i].len);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_bextr_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint32_t start;
+    uint32_t len;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x8f2c6ec7eb6dd5f7),     0,     8, UINT64_C(0x00000000000000f7) },
+    { UINT64_C(0x000180a0010a950c),     4,     0, UINT64_C(0x0000000000000000) },
+    { UINT64_C(0x2c1180d168325282),    13,     7, UINT64_C(0x0000000000000012) },
+    { UINT64_C(0x0822004000018002),    30,     9, UINT64_C(0x0000000000000100) },
+    { UINT64_C(0x5daefff5ef7bef7b),    40,     3, UINT64_C(0x0000000000000007) },
+    { UINT64_C(0x000321021604050a),     9,    64, UINT64_C(0x00000190810b0202) },
+    { UINT64_C(0x0bfad74d74165555),   258,    12, UINT64_C(0x0000000000000555) },
+    { UINT64_C(0x0000420060008000),    63,   517, UINT64_C(0x0000000000000000) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_bextr_u64(test_vec[i].a, test_vec[i].start, test_vec[i].len);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_blsi_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x200ea573), UINT32_C(0x00000001) },
+    { UINT32_C(0x91820040), UINT32_C(0x00000040) },
+    { UINT32_C(0xb6fdd63d), UINT32_C(0x00000001) },
+    { UINT32_C(0x080193a5), UINT32_C(0x00000001) },
+    { UINT32_C(0xe30117d2), UINT32_C(0x00000002) },
+    { UINT32_C(0x00701000), UINT32_C(0x00001000) },
+    { UINT32_C(0x7e2bfef3), UINT32_C(0x00000001) },
+    { UINT32_C(0x00010040), UINT32_C(0x00000040) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_blsi_u32(test_vec[i].a);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_blsi_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x0dc5b16effe5892f), UINT64_C(0x0000000000000001) },
+    { UINT64_C(0x875800a204000300), UINT64_C(0x0000000000000100) },
+    { UINT64_C(0x72dff5e7af5cdf7f), UINT64_C(0x0000000000000001) },
+    { UINT64_C(0x00200000589a8502), UINT64_C(0x0000000000000002) },
+    { UINT64_C(0x4311e5096e8f7658), UINT64_C(0x0000000000000008) },
+    { UINT64_C(0x8941004000882200), UINT64_C(0x0000000000000200) },
+    { UINT64_C(0xfdfdf7ed9f7cff6f), UINT64_C(0x0000000000000001) },
+    { UINT64_C(0x0090140220327891), UINT64_C(0x0000000000000001) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_blsi_u64(test_vec[i].a);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_blsmsk_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x84630ea6), UINT32_C(0x00000003) },
+    { UINT32_C(0x02000000), UINT32_C(0x03ffffff) },
+    { UINT32_C(0xff55f7ff), UINT32_C(0x00000001) },
+    { UINT32_C(0x60080286), UINT32_C(0x00000003) },
+    { UINT32_C(0xea880477), UINT32_C(0x00000001) },
+    { UINT32_C(0x010c5001), UINT32_C(0x00000001) },
+    { UINT32_C(0xc457bdda), UINT32_C(0x00000003) },
+    { UINT32_C(0xb6291600), UINT32_C(0x000003ff) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_blsmsk_u32(test_vec[i].a);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_blsmsk_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x4c70f30afec0e6dc), UINT64_C(0x0000000000000007) },
+    { UINT64_C(0x0402403200208020), UINT64_C(0x000000000000003f) },
+    { UINT64_C(0xb58fd76f7dedfde8), UINT64_C(0x000000000000000f) },
+    { UINT64_C(0x004ce040244c9181), UINT64_C(0x0000000000000001) },
+    { UINT64_C(0x9c27dd34161ac0e2), UINT64_C(0x0000000000000003) },
+    { UINT64_C(0x0020102a04010441), UINT64_C(0x0000000000000001) },
+    { UINT64_C(0xcef777fff99f3eef), UINT64_C(0x0000000000000001) },
+    { UINT64_C(0x01a9420440858e0d), UINT64_C(0x0000000000000001) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_blsmsk_u64(test_vec[i].a);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_blsr_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x95ce8481), UINT32_C(0x95ce8480) },
+    { UINT32_C(0x00011400), UINT32_C(0x00011000) },
+    { UINT32_C(0xfaeff7fc), UINT32_C(0xfaeff7f8) },
+    { UINT32_C(0x40830648), UINT32_C(0x40830640) },
+    { UINT32_C(0x36632910), UINT32_C(0x36632900) },
+    { UINT32_C(0x80080004), UINT32_C(0x80080000) },
+    { UINT32_C(0xcff1dc7f), UINT32_C(0xcff1dc7e) },
+    { UINT32_C(0xd99020a8), UINT32_C(0xd99020a0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_blsr_u32(test_vec[i].a);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_blsr_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0xa6b6285016d38b94), UINT64_C(0xa6b6285016d38b90) },
+    { UINT64_C(0x0000060002010488), UINT64_C(0x0000060002010480) },
+    { UINT64_C(0xfffbfe5effb39fde), UINT64_C(0xfffbfe5effb39fdc) },
+    { UINT64_C(0x00081080a0284f90), UINT64_C(0x00081080a0284f80) },
+    { UINT64_C(0x028030c59bc5df42), UINT64_C(0x028030c59bc5df40) },
+    { UINT64_C(0x2003082088340180), UINT64_C(0x2003082088340100) },
+    { UINT64_C(0xebf8f9feef767ffb), UINT64_C(0xebf8f9feef767ffa) },
+    { UINT64_C(0x00ec448d38300910), UINT64_C(0x00ec448d38300900) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_blsr_u64(test_vec[i].a);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_tzcnt_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x00000000),  32 },
+    { UINT32_C(0x00000001),   0 },
+    { UINT32_C(0x05e7a8d7),   0 },
+    { UINT32_C(0x0005e000),  13 },
+    { UINT32_C(0xae81f400),  10 },
+    { UINT32_C(0x3a839c00),  10 },
+    { UINT32_C(0xb6000000),  25 },
+    { UINT32_C(0xffffffff),   0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_tzcnt_u32(test_vec[i].a);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_tzcnt_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x0000000000000000),  64 },
+    { UINT64_C(0x0000000000000001),   0 },
+    { UINT64_C(0x002078c834af3d46),   1 },
+    { UINT64_C(0x00000030856c0000),  18 },
+    { UINT64_C(0xf4860ce5740fa000),  13 },
+    { UINT64_C(0x00596ec91ea00000),  21 },
+    { UINT64_C(0xcdd8000000000000),  51 },
+    { UINT64_C(0xffffffffffffffff),   0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_tzcnt_u64(test_vec[i].a);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/andn_u32",         test_simde_andn_u32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/andn_u64",         test_simde_andn_u64,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/bextr_u32",        test_simde_bextr_u32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/bextr_u64",        test_simde_bextr_u64,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/blsi_u32",         test_simde_blsi_u32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/blsi_u64",         test_simde_blsi_u64,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/blsmsk_u32",       test_simde_blsmsk_u32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/blsmsk_u64",       test_simde_blsmsk_u64,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/blsr_u32",         test_simde_blsr_u32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/blsr_u64",         test_simde_blsr_u64,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/tzcnt_u32",        test_simde_tzcnt_u32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/tzcnt_u64",        test_simde_tzcnt_u64,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_bmi_test_suite = {
+  (char*) "/bmi",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
@@ -0,0 +1,514 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../bmi2.h"
+
+static MunitResult
+test_simde_bzhi_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t index;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0xfdf79eff),     0, UINT32_C(0x00000000) },
+    { UINT32_C(0xc4808193),     5, UINT32_C(0x00000013) },
+    { UINT32_C(0x75cf6654),    17, UINT32_C(0x00016654) },
+    { UINT32_C(0x28200420),    31, UINT32_C(0x28200420) },
+    { UINT32_C(0xffd7df5d),    32, UINT32_C(0xffd7df5d) },
+    { UINT32_C(0x8100c1a2),    47, UINT32_C(0x8100c1a2) },
+    { UINT32_C(0x21bbf65d),    64, UINT32_C(0x21bbf65d) },
+    { UINT32_C(0x20000010),   483, UINT32_C(0x20000010) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_bzhi_u32(test_vec[i].a, test_vec[i].index);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_bzhi_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint32_t index;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0xfe44f7af5dfbbf7b),     0, UINT64_C(0x0000000000000000) },
+    { UINT64_C(0x01042a0204180090),     5, UINT64_C(0x0000000000000010) },
+    { UINT64_C(0xedef100ea0dfc109),    17, UINT64_C(0x000000000001c109) },
+    { UINT64_C(0x2200008e00023010),    31, UINT64_C(0x0000000000023010) },
+    { UINT64_C(0xafae7eaff37fff1f),    32, UINT64_C(0x00000000f37fff1f) },
+    { UINT64_C(0x00812240c1020000),    47, UINT64_C(0x00002240c1020000) },
+    { UINT64_C(0xe770a4f5a68af797),    64, UINT64_C(0xe770a4f5a68af797) },
+    { UINT64_C(0x20002000300a00c0),   483, UINT64_C(0x20002000300a00c0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_bzhi_u64(test_vec[i].a, test_vec[i].index);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mulx_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t b;
+    uint32_t lo;
+    uint32_t hi;
+  } test_vec[8] = {
+    { UINT32_C(0x41949fd0), UINT32_C(0x7d5dbdfa), UINT32_C(0x63b0a120), UINT32_C(0x201d95b1) },
+    { UINT32_C(0x00200400), UINT32_C(0xcd3e5e18), UINT32_C(0xbc786000), UINT32_C(0x0019ab00) },
+    { UINT32_C(0xffbdef4e), UINT32_C(0x3375f44d), UINT32_C(0xdcdd5276), UINT32_C(0x3368ac88) },
+    { UINT32_C(0x93d08020), UINT32_C(0x009404d0), UINT32_C(0x6de89a00), UINT32_C(0x00557751) },
+    { UINT32_C(0xda12856f), UINT32_C(0x737df7f7), UINT32_C(0x4acfd719), UINT32_C(0x6261a036) },
+    { UINT32_C(0x00200444), UINT32_C(0x09000183), UINT32_C(0x946672cc), UINT32_C(0x00012026) },
+    { UINT32_C(0xbbff9ff7), UINT32_C(0xd5a3a8ae), UINT32_C(0xe5fdd1e2), UINT32_C(0x9ce3dfba) },
+    { UINT32_C(0x00020001), UINT32_C(0x80080850), UINT32_C(0x90a80850), UINT32_C(0x00010010) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t hi;
+    uint32_t lo = simde_mulx_u32(test_vec[i].a, test_vec[i].b, &hi);
+    munit_assert_uint32(lo, ==, test_vec[i].lo);
+    munit_assert_uint32(hi, ==, test_vec[i].hi);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mulx_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t lo;
+    uint64_t hi;
+  } test_vec[8] = {
+    { UINT64_C(0x2e1a7d5d8125d469), UINT64_C(0xf7cffbffd6d5b7bf),
+      UINT64_C(0x99fbfbb5e76d8957), UINT64_C(0x2ca103c2a2351d39) },
+    { UINT64_C(0x80044c0010044840), UINT64_C(0x0126080002045081),
+      UINT64_C(0x25cc99ab09bc6840), UINT64_C(0x009308ef6b749656) },
+    { UINT64_C(0x6b8cedff9af7a69a), UINT64_C(0x6268d9269c372844),
+      UINT64_C(0x0a83a1b27ee650e8), UINT64_C(0x2957ff973773cde9) },
+    { UINT64_C(0x00d1850abc000508), UINT64_C(0x2051001028140100),
+      UINT64_C(0x3b440c05a4a50800), UINT64_C(0x001a72ec7d1e9a77) },
+    { UINT64_C(0x810c2ac3ca2c50d4), UINT64_C(0x1eedfef5efefd7ff),
+      UINT64_C(0x9a71d98afbf28f2c), UINT64_C(0x0f9765cc94f9cfa2) },
+    { UINT64_C(0x0800004000001002), UINT64_C(0x00186040c0000604),
+      UINT64_C(0xa6364d8180604c08), UINT64_C(0x0000c3020c181061) },
+    { UINT64_C(0x5daefff5ef7bef7b), UINT64_C(0x2393e90fb606b79a),
+      UINT64_C(0x761f7c81b7a0fcfe), UINT64_C(0x0d050dc5a0cb2b8c) },
+    { UINT64_C(0x0012d50c10000400), UINT64_C(0x0000420060008000),
+      UINT64_C(0xf18e098002000000), UINT64_C(0x00000004daf42c0d) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t hi;
+    uint64_t lo = simde_mulx_u64(test_vec[i].a, test_vec[i].b, &hi);
+    munit_assert_uint64(lo, ==, test_vec[i].lo);
+    munit_assert_uint64(hi, ==, test_vec[i].hi);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_pdep_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t b;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x200ea573), UINT32_C(0x91820040), UINT32_C(0x90020040) },
+    { UINT32_C(0x10488000), UINT32_C(0xe77937f3), UINT32_C(0x20400000) },
+    { UINT32_C(0xfafef6a6), UINT32_C(0x00000450), UINT32_C(0x00000440) },
+    { UINT32_C(0x562850a0), UINT32_C(0x118d20d2), UINT32_C(0x00090000) },
+    { UINT32_C(0xffe5892f), UINT32_C(0x04000300), UINT32_C(0x04000300) },
+    { UINT32_C(0x0c480400), UINT32_C(0xee8ffe58), UINT32_C(0x40010000) },
+    { UINT32_C(0xf3edfe3f), UINT32_C(0x923c3000), UINT32_C(0x003c3000) },
+    { UINT32_C(0x000c4800), UINT32_C(0x39be799d), UINT32_C(0x30240000) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_pdep_u32(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_pdep_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x883a9d9d84630ea6), UINT64_C(0x0000001402000000), UINT64_C(0x0000001400000000) },
+    { UINT64_C(0x0041010400104322), UINT64_C(0xdaffff8debff7df7), UINT64_C(0x0802080000820c42) },
+    { UINT64_C(0x7cbf7fadf32cfc1d), UINT64_C(0x0188000204002040), UINT64_C(0x0008000204000040) },
+    { UINT64_C(0x0102068980000c10), UINT64_C(0xde9d22ffb6bb9e00), UINT64_C(0x4600000002808000) },
+    { UINT64_C(0x4c70f30afec0e6dc), UINT64_C(0x0402403200208020), UINT64_C(0x0002401200200000) },
+    { UINT64_C(0x8004400004481040), UINT64_C(0x9c77df3ebf7fcceb), UINT64_C(0x0000000824040400) },
+    { UINT64_C(0x5fb9bfeff5b7eff7), UINT64_C(0x0014264ab0001000), UINT64_C(0x0014264a30001000) },
+    { UINT64_C(0x0004000301012a6c), UINT64_C(0xf5a9ee2446d78ecd), UINT64_C(0x3000400004450648) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_pdep_u64(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_pext_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t b;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x95ce8481), UINT32_C(0x00011400), UINT32_C(0x00000001) },
+    { UINT32_C(0x40830240), UINT32_C(0xb76b3df4), UINT32_C(0x00000c08) },
+    { UINT32_C(0xdafd3f5d), UINT32_C(0x46810038), UINT32_C(0x000000bb) },
+    { UINT32_C(0x0c004000), UINT32_C(0xdbd074aa), UINT32_C(0x00002080) },
+    { UINT32_C(0x16d38b94), UINT32_C(0x02010488), UINT32_C(0x0000001a) },
+    { UINT32_C(0xa0018680), UINT32_C(0xfbf7ffd2), UINT32_C(0x02801868) },
+    { UINT32_C(0xcbbdadce), UINT32_C(0xa14648d3), UINT32_C(0x0000153a) },
+    { UINT32_C(0x440060f8), UINT32_C(0x39348bd0), UINT32_C(0x00000007) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_pext_u32(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_pext_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0xf76fd4c6e6985568), UINT64_C(0x0818808c08001001), UINT64_C(0x00000000000000ea) },
+    { UINT64_C(0x000100c014000405), UINT64_C(0xcfeeff7f9f92eb5f), UINT64_C(0x00000000080a0005) },
+    { UINT64_C(0xbfd7bcfff4ffff5f), UINT64_C(0x00c09011268d1a55), UINT64_C(0x00000000000ff7ff) },
+    { UINT64_C(0x00200b02060913b0), UINT64_C(0x730450d4b7ce68dd), UINT64_C(0x0000000000018828) },
+    { UINT64_C(0xe8d08f308428dbf6), UINT64_C(0x0800820004800020), UINT64_C(0x000000000000003d) },
+    { UINT64_C(0x0060000020000000), UINT64_C(0xf7b98efcfbf9bfdf), UINT64_C(0x0000010001000000) },
+    { UINT64_C(0x7ebbd9adfffef7eb), UINT64_C(0x01810010e244c702), UINT64_C(0x0000000000006fff) },
+    { UINT64_C(0x00040a0002a50409), UINT64_C(0x751bf6c7bffcc974), UINT64_C(0x000000000400a900) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_pext_u64(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_rorx_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x04484712), UINT32_C(0x38902242) },
+    { UINT32_C(0xc8a92e0c), UINT32_C(0x70664549) },
+    { UINT32_C(0xfa0e4785), UINT32_C(0x3c2fd072) },
+    { UINT32_C(0xc6bfa837), UINT32_C(0x41be35fd) },
+    { UINT32_C(0x14d5bd2d), UINT32_C(0xe968a6ad) },
+    { UINT32_C(0xd6bd1eda), UINT32_C(0xf6d6b5e8) },
+    { UINT32_C(0xf5f25588), UINT32_C(0xac47af92) },
+    { UINT32_C(0x85bcc62a), UINT32_C(0x31542de6) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_rorx_u32(test_vec[i].a, 13);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_rorx_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0xf5d7d0d525d4d18f), UINT64_C(0x86a92ea68c7faebe) },
+    { UINT64_C(0x21358c34db85cbac), UINT64_C(0x61a6dc2e5d6109ac) },
+    { UINT64_C(0x208e8b6016055666), UINT64_C(0x5b00b02ab3310474) },
+    { UINT64_C(0xb810cc8684a89c8d), UINT64_C(0x64342544e46dc086) },
+    { UINT64_C(0x8f5a80d5446ed85f), UINT64_C(0x06aa2376c2fc7ad4) },
+    { UINT64_C(0xe50c2d4df6facf4e), UINT64_C(0x6a6fb7d67a772861) },
+    { UINT64_C(0x607a0f8c44b05660), UINT64_C(0x7c622582b30303d0) },
+    { UINT64_C(0xb978da7e23db7665), UINT64_C(0xd3f11edbb32dcbc6) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_rorx_u64(test_vec[i].a, 45);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_sarx_i32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    int32_t a;
+    uint32_t count;
+    int32_t r;
+  } test_vec[8] = {
+    { INT32_C( -484178524),     0, INT32_C( -484178524) },
+    { INT32_C(-1148161640),     1, INT32_C( -574080820) },
+    { INT32_C(  698599929),     7, INT32_C(    5457811) },
+    { INT32_C( -598304458),    17, INT32_C(      -4565) },
+    { INT32_C(  419759733),    31, INT32_C(          0) },
+    { INT32_C(-1714723665),    32, INT32_C(-1714723665) },
+    { INT32_C(  -30834250),    35, INT32_C(   -3854282) },
+    { INT32_C( -187139652),   200, INT32_C(    -731015) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_sarx_i32(test_vec[i].a, test_vec[i].count);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_sarx_i64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    int64_t a;
+    uint64_t count;
+    int64_t r;
+  } test_vec[8] = {
+    { INT64_C(-2594186148123397667),     0, INT64_C(-2594186148123397667) },
+    { INT64_C(-1536965519794109948),     1, INT64_C( -768482759897054974) },
+    { INT64_C(-6880867271272683725),    13, INT64_C(    -839949618075279) },
+    { INT64_C(-3645958814987709031),    40, INT64_C(            -3315981) },
+    { INT64_C(-8499636897364441960),    63, INT64_C(                  -1) },
+    { INT64_C(-5658662387492053765),    64, INT64_C(-5658662387492053765) },
+    { INT64_C( 4281181935333475500),    70, INT64_C(   66893467739585554) },
+    { INT64_C( 8293765203335372497),   200, INT64_C(   32397520325528798) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int64_t r = simde_sarx_i64(test_vec[i].a, test_vec[i].count);
+    munit_assert_int64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_shlx_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t count;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x62a2d855),     0, UINT32_C(0x62a2d855) },
+    { UINT32_C(0x48f0b48b),     1, UINT32_C(0x91e16916) },
+    { UINT32_C(0x77931ec0),     7, UINT32_C(0xc98f6000) },
+    { UINT32_C(0x5a059c95),    17, UINT32_C(0x392a0000) },
+    { UINT32_C(0x7e0a831c),    31, UINT32_C(0x00000000) },
+    { UINT32_C(0xfcef4337),    32, UINT32_C(0xfcef4337) },
+    { UINT32_C(0xbbdafe5c),    35, UINT32_C(0xded7f2e0) },
+    { UINT32_C(0x123f5f0e),   200, UINT32_C(0x3f5f0e00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_shlx_u32(test_vec[i].a, test_vec[i].count);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_shlx_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t count;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0xef5ad16bff838419),     0, UINT64_C(0xef5ad16bff838419) },
+    { UINT64_C(0x23758c98b54aaeb8),     1, UINT64_C(0x46eb19316a955d70) },
+    { UINT64_C(0x6c41ef23bf603a29),    13, UINT64_C(0x3de477ec07452000) },
+    { UINT64_C(0xa88757600cfc25b6),    40, UINT64_C(0xfc25b60000000000) },
+    { UINT64_C(0x2bfd6f4754e05131),    63, UINT64_C(0x8000000000000000) },
+    { UINT64_C(0xb28b09f89a639e0e),    64, UINT64_C(0xb28b09f89a639e0e) },
+    { UINT64_C(0xa18c3e658a5ad2f7),    70, UINT64_C(0x630f996296b4bdc0) },
+    { UINT64_C(0x1a6224d18f035bdd),   200, UINT64_C(0x6224d18f035bdd00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_shlx_u64(test_vec[i].a, test_vec[i].count);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_shrx_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t count;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x5cd0b458),     0, UINT32_C(0x5cd0b458) },
+    { UINT32_C(0x9a135f95),     1, UINT32_C(0x4d09afca) },
+    { UINT32_C(0xaea6a11d),     7, UINT32_C(0x015d4d42) },
+    { UINT32_C(0x361c985d),    17, UINT32_C(0x00001b0e) },
+    { UINT32_C(0x7cbe6536),    31, UINT32_C(0x00000000) },
+    { UINT32_C(0xb2084d16),    32, UINT32_C(0xb2084d16) },
+    { UINT32_C(0x6c9e755e),    35, UINT32_C(0x0d93ceab) },
+    { UINT32_C(0xaeaea993),   200, UINT32_C(0x00aeaea9) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_shrx_u32(test_vec[i].a, test_vec[i].count);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_shrx_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t count;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x6fac792e08c02d14),     0, UINT64_C(0x6fac792e08c02d14) },
+    { UINT64_C(0xc6b8e089e7914275),     1, UINT64_C(0x635c7044f3c8a13a) },
+    { UINT64_C(0xbb94b341366c004c),    13, UINT64_C(0x0005dca59a09b360) },
+    { UINT64_C(0x536609ea6c44439d),    40, UINT64_C(0x0000000000536609) },
+    { UINT64_C(0xa23448eb43f76412),    63, UINT64_C(0x0000000000000001) },
+    { UINT64_C(0x8e6f11a3cb2cb305),    64, UINT64_C(0x8e6f11a3cb2cb305) },
+    { UINT64_C(0xbf506f752c3c7f78),    70, UINT64_C(0x02fd41bdd4b0f1fd) },
+    { UINT64_C(0xe6de78cda26c3ef8),   200, UINT64_C(0x00e6de78cda26c3e) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_shrx_u64(test_vec[i].a, test_vec[i].count);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/bzhi_u32", test_simde_bzhi_u32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/bzhi_u64", test_simde_bzhi_u64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mulx_u32", test_simde_mulx_u32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mulx_u64", test_simde_mulx_u64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/pdep_u32", test_simde_pdep_u32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/pdep_u64", test_simde_pdep_u64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/pext_u32", test_simde_pext_u32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/pext_u64", test_simde_pext_u64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/rorx_u32", test_simde_rorx_u32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/rorx_u64", test_simde_rorx_u64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/sarx_i32", test_simde_sarx_i32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/sarx_i64", test_simde_sarx_i64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/shlx_u32", test_simde_shlx_u32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/shlx_u64", test_simde_shlx_u64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/shrx_u32", test_simde_shrx_u32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/shrx_u64", test_simde_shrx_u64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_bmi2_test_suite = {
+  (char*) "/bmi2",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
@@ -0,0 +1,117 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../clmul.h"
+
+static MunitResult
+test_simde_mm_clmulepi64_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r00;
+    simde__m128i r01;
+    simde__m128i r10;
+    simde__m128i r11;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu64x(UINT64_C(0xcf600bf96b21162b), UINT64_C(0x81e3e1547fff0eee)),
+      simde_x_mm_set_epu64x(UINT64_C(0xe0ba179adaf10644), UINT64_C(0x63b4c68f4e5546fd)),
+      simde_x_mm_set_epu64x(UINT64_C(0x319c17ab6083909e), UINT64_C(0xc7863d914a055986)),
+      simde_x_mm_set_epu64x(UINT64_C(0x2b1462b1b8d929bf), UINT64_C(0xbd68be865759fd4f)),
+      simde_x_mm_set_epu64x(UINT64_C(0x70e8a069e94500df), UINT64_C(0x19487de03f57e438)),
+      simde_x_mm_set_epu64x(UINT64_C(0x4df1474f6a782e11), UINT64_C(0x78fc3d47720e286c)) },
+    { simde_x_mm_set_epu64x(UINT64_C(0xd3566e6c5d970a9a), UINT64_C(0xbadc1a0883bf5f6c)),
+      simde_x_mm_set_epu64x(UINT64_C(0xb184103bff12dff1), UINT64_C(0x7db6e7210c05465e)),
+      simde_x_mm_set_epu64x(UINT64_C(0x358469f7153816e0), UINT64_C(0x41680111669f7dc8)),
+      simde_x_mm_set_epu64x(UINT64_C(0x26f2d64be0e41be3), UINT64_C(0x9d45851eb513b8ac)),
+      simde_x_mm_set_epu64x(UINT64_C(0x417d1d37fac2533f), UINT64_C(0x7e34b663d83d8d2c)),
+      simde_x_mm_set_epu64x(UINT64_C(0x7e4d21381be9c1b2), UINT64_C(0x0e978ba038f62dfa)) },
+    { simde_x_mm_set_epu64x(UINT64_C(0x93cc740dd8a62aba), UINT64_C(0x048732ebbe6aca7e)),
+      simde_x_mm_set_epu64x(UINT64_C(0x64b640cb635d5b2b), UINT64_C(0xa5a296086de0b798)),
+      simde_x_mm_set_epu64x(UINT64_C(0x02c73cb07d8c8bcd), UINT64_C(0x42a2e4027d7f9110)),
+      simde_x_mm_set_epu64x(UINT64_C(0x5919b2b9f81b9541), UINT64_C(0x647a0a3f3af26570)),
+      simde_x_mm_set_epu64x(UINT64_C(0x01a1b7101826c231), UINT64_C(0x165e19ae419350b2)),
+      simde_x_mm_set_epu64x(UINT64_C(0x34944d1310ffe456), UINT64_C(0x08fb4e335593435e)) },
+    { simde_x_mm_set_epu64x(UINT64_C(0xa8b1f9ed6b009ca3), UINT64_C(0xb4725061d392a394)),
+      simde_x_mm_set_epu64x(UINT64_C(0xd5d5a7309b29afc6), UINT64_C(0xd929c7ecb53ac242)),
+      simde_x_mm_set_epu64x(UINT64_C(0x796694194fb63f90), UINT64_C(0x1d8e422f8bad8a28)),
+      simde_x_mm_set_epu64x(UINT64_C(0x71022567efa99e99), UINT64_C(0x0d37e65c03681786)),
+      simde_x_mm_set_epu64x(UINT64_C(0x7e796abaf81fa414), UINT64_C(0xb8fa725c38ec2a78)),
+      simde_x_mm_set_epu64x(UINT64_C(0x76835cec7d2f6e34), UINT64_C(0x6666aeb5c046a38a)) },
+    { simde_x_mm_set_epu64x(UINT64_C(0xee4f752c5cbfd160), UINT64_C(0xabf64af3c319ccf4)),
+      simde_x_mm_set_epu64x(UINT64_C(0xc0fee8d4161b4e12), UINT64_C(0x922a49f43860088d)),
+      simde_x_mm_set_epu64x(UINT64_C(0x5e02f4bf02f9af9f), UINT64_C(0x52246e3756b14284)),
+      simde_x_mm_set_epu64x(UINT64_C(0x7804887688313943), UINT64_C(0x95194a0b1eddafe0)),
+      simde_x_mm_set_epu64x(UINT64_C(0x7f60b8081f26c8b2), UINT64_C(0x00584302dba3cea8)),
+      simde_x_mm_set_epu64x(UINT64_C(0x4ceebf3593795b78), UINT64_C(0x1a77292e5616f4c0)) },
+    { simde_x_mm_set_epu64x(UINT64_C(0x50f1702b39c4bfb6), UINT64_C(0x99993247872bb1d8)),
+      simde_x_mm_set_epu64x(UINT64_C(0x66c05e37b8885f38), UINT64_C(0xd2a19807c7341267)),
+      simde_x_mm_set_epu64x(UINT64_C(0x625f534eea73e909), UINT64_C(0x94cc895fbfd66808)),
+      simde_x_mm_set_epu64x(UINT64_C(0x39c8086b7c1412dd), UINT64_C(0xa3f43853571b2942)),
+      simde_x_mm_set_epu64x(UINT64_C(0x366abede460d367c), UINT64_C(0xc25ecae954a0e040)),
+      simde_x_mm_set_epu64x(UINT64_C(0x1ffc03932d0ddef3), UINT64_C(0x144f2ef0429ca210)) },
+    { simde_x_mm_set_epu64x(UINT64_C(0x5670c2935b1d71a5), UINT64_C(0xa80da3c2b7d51e54)),
+      simde_x_mm_set_epu64x(UINT64_C(0x5b27b696be8057dd), UINT64_C(0xa4a01045d68379d3)),
+      simde_x_mm_set_epu64x(UINT64_C(0x43e65edb388d1f90), UINT64_C(0xb011290ac24c4cbc)),
+      simde_x_mm_set_epu64x(UINT64_C(0x208e491b35f072df), UINT64_C(0xb5f19307c8c00e7f)),
+      simde_x_mm_set_epu64x(UINT64_C(0x242dd8886edd5a00), UINT64_C(0x2be6a70a3b9b23e4)),
+      simde_x_mm_set_epu64x(UINT64_C(0x12b963df09de2a4d), UINT64_C(0x8679ab1f9a17f089)) },
+    { simde_x_mm_set_epu64x(UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff)),
+      simde_x_mm_set_epu64x(UINT64_C(0xf025480cdaf1f4c1), UINT64_C(0x888477a524c10e9a)),
+      simde_x_mm_set_epu64x(UINT64_C(0x787c2d631c40fa76), UINT64_C(0x787c2d631c40fa76)),
+      simde_x_mm_set_epu64x(UINT64_C(0x787c2d631c40fa76), UINT64_C(0x787c2d631c40fa76)),
+      simde_x_mm_set_epu64x(UINT64_C(0x501cc7fbb650ac40), UINT64_C(0xafe3380449af53bf)),
+      simde_x_mm_set_epu64x(UINT64_C(0x501cc7fbb650ac40), UINT64_C(0xafe3380449af53bf)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r;
+    r = simde_mm_clmulepi64_si128(test_vec[i].a, test_vec[i].b, 0x00);
+    simde_assert_m128i_u64(r, ==, test_vec[i].r00);
+    r = simde_mm_clmulepi64_si128(test_vec[i].a, test_vec[i].b, 0x01);
+    simde_assert_m128i_u64(r, ==, test_vec[i].r01);
+    r = simde_mm_clmulepi64_si128(test_vec[i].a, test_vec[i].b, 0x10);
+    simde_assert_m128i_u64(r, ==, test_vec[i].r10);
+    r = simde_mm_clmulepi64_si128(test_vec[i].a, test_vec[i].b, 0x11);
+    simde_assert_m128i_u64(r, ==, test_vec[i].r11);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm_clmulepi64_si128", test_simde_mm_clmulepi64_si128, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_clmul_test_suite = {
+  (char*) "/clmul",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
@@ -0,0 +1,268 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../f16c.h"
+
+static MunitResult
+test_simde_mm_cvtph_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16(  5856, -24123,   7630,  20091, -10148,  -8266,  -9837, -10063),
+      simde_mm_set_ps(  -139.50f,   -493.50f,   -178.38f,   -150.12f) },
+    { simde_mm_set_epi16( 31224, -21081, -15205, -10693,  -7893,  21459,  25194,  25108),
+      simde_mm_set_ps(  -661.50f,     62.59f,    821.00f,    778.00f) },
+    { simde_mm_set_epi16(  3783,  27904, -25730, -26063,  25316,  23412,  24632,  24110),
+      simde_mm_set_ps(   882.00f,    238.50f,    540.00f,    395.50f) },
+    { simde_mm_set_epi16( -9601,  27027, -29140, -26499,  25272,  25299,  20729,  20720),
+      simde_mm_set_ps(   860.00f,    873.50f,     39.78f,     39.50f) },
+    { simde_mm_set_epi16(-28749,  29695, -18403,  -6373,  -9014,  -8417,  -8596,  24666),
+      simde_mm_set_ps(  -306.50f,   -455.75f,   -411.00f,    557.00f) },
+    { simde_mm_set_epi16(-29013,  12186,  23361, -26045,  25024,  -7881,  -9054,  24891),
+      simde_mm_set_ps(   736.00f,   -667.50f,   -296.50f,    669.50f) },
+    { simde_mm_set_epi16( 25577,  14377,  20211,  18799,  -8626,  24592,  -8003,  23799),
+      simde_mm_set_ps(  -403.50f,    520.00f,   -606.50f,    317.75f) },
+    { simde_mm_set_epi16( 17837,  27905,   9641, -31062,  -7480,  25132,  -7234,  24990),
+      simde_mm_set_ps(  -868.00f,    790.00f,   -991.00f,    719.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_cvtph_ps(test_vec[i].a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtps_ph(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128i rn;
+    simde__m128i rd;
+    simde__m128i ru;
+    simde__m128i rz;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  6507.61f,  24624.35f,    -59.58f,    183.70f),
+      simde_mm_set_epi16(     0,      0,      0,      0,  28251,  30211, -11405,  22974),
+      simde_mm_set_epi16(     0,      0,      0,      0,  28250,  30211, -11405,  22973),
+      simde_mm_set_epi16(     0,      0,      0,      0,  28251,  30212, -11406,  22974),
+      simde_mm_set_epi16(     0,      0,      0,      0,  28250,  30211, -11406,  22973) },
+    { simde_mm_set_ps(   805.77f,    724.38f,    327.07f,   -933.16f),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25164,  25001,  23836,  -7350),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25163,  25000,  23836,  -7349),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25164,  25001,  23837,  -7350),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25163,  25000,  23836,  -7350) },
+    { simde_mm_set_ps(   919.23f,  11707.00f,    829.54f,   -239.79f),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25390,  29111,  25211,  -9346),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25390,  29111,  25211,  -9345),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25391,  29112,  25212,  -9346),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25390,  29111,  25211,  -9346) },
+    { simde_mm_set_ps(  -632.28f,   -714.00f,   -399.28f,    914.42f),
+      simde_mm_set_epi16(     0,      0,      0,      0,  -7951,  -7788,  -8643,  25381),
+      simde_mm_set_epi16(     0,      0,      0,      0,  -7951,  -7788,  -8642,  25380),
+      simde_mm_set_epi16(     0,      0,      0,      0,  -7952,  -7788,  -8643,  25381),
+      simde_mm_set_epi16(     0,      0,      0,      0,  -7952,  -7788,  -8643,  25380) },
+    { simde_mm_set_ps(   890.16f,    116.05f,    -80.17f, -10755.00f),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25332,  22337, -11005,  -3776),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25332,  22336, -11005,  -3775),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25333,  22337, -11006,  -3776),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25332,  22336, -11006,  -3776) },
+    { simde_mm_set_ps( 61819.74f,    281.47f,    288.91f,    527.91f),
+      simde_mm_set_epi16(     0,      0,      0,      0,  31628,  23654,  23684,  24608),
+      simde_mm_set_epi16(     0,      0,      0,      0,  31627,  23653,  23683,  24607),
+      simde_mm_set_epi16(     0,      0,      0,      0,  31628,  23654,  23684,  24608),
+      simde_mm_set_epi16(     0,      0,      0,      0,  31627,  23653,  23683,  24607) },
+    { simde_mm_set_ps(   890.43f,    -45.04f,     99.80f,   -516.17f),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25333, -11871,  22077,  -8184),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25332, -11870,  22076,  -8183),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25333, -11871,  22077,  -8184),
+      simde_mm_set_epi16(     0,      0,      0,      0,  25332, -11871,  22076,  -8184) },
+    { simde_mm_set_ps(   228.15f,  17505.33f,   -815.09f,    875.10f),
+      simde_mm_set_epi16(     0,      0,      0,      0,  23329,  29766,  -7586,  25302),
+      simde_mm_set_epi16(     0,      0,      0,      0,  23329,  29766,  -7585,  25302),
+      simde_mm_set_epi16(     0,      0,      0,      0,  23330,  29767,  -7586,  25303),
+      simde_mm_set_epi16(     0,      0,      0,      0,  23329,  29766,  -7586,  25302) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r;
+
+    r = simde_mm_cvtps_ph(test_vec[i].a, simde_MM_FROUND_TO_NEAREST_INT);
+    simde_assert_m128i_u16(r, ==, test_vec[i].rn);
+    r = simde_mm_cvtps_ph(test_vec[i].a, simde_MM_FROUND_TO_NEG_INF);
+    simde_assert_m128i_u16(r, ==, test_vec[i].rd);
+    r = simde_mm_cvtps_ph(test_vec[i].a, simde_MM_FROUND_TO_POS_INF);
+    simde_assert_m128i_u16(r, ==, test_vec[i].ru);
+    r = simde_mm_cvtps_ph(test_vec[i].a, simde_MM_FROUND_TO_ZERO);
+    simde_assert_m128i_u16(r, ==, test_vec[i].rz);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtph_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( -7232,  -9966,  24810,  24149,  -7966,  23696,  -8119,  24196),
+      simde_mm256_set_ps(  -992.00f,   -162.25f,    629.00f,    405.25f,
+                           -625.00f,    292.00f,   -548.50f,    417.00f) },
+    { simde_mm_set_epi16( 24719,  -9062,  -7557,  24023,  24961,  23645,  25444,  -9692),
+      simde_mm256_set_ps(   583.50f,   -294.50f,   -829.50f,    373.75f,
+                            704.50f,    279.25f,    946.00f,   -196.50f) },
+    { simde_mm_set_epi16(-10617,  24116,  -8879,  25505, -12488,  -8590,  -7651,  23880),
+      simde_mm256_set_ps(  -104.44f,    397.00f,   -340.25f,    976.50f,
+                            -28.88f,   -412.50f,   -782.50f,    338.00f) },
+    { simde_mm_set_epi16( -8187,  25309,  24545,  24975,  22157,  -8987,  24125,  -7415),
+      simde_mm256_set_ps(  -514.50f,    878.50f,    504.25f,    711.50f,
+                            104.81f,   -313.25f,    399.25f,   -900.50f) },
+    { simde_mm_set_epi16( 24533, -11203,  24629,  24988, -15657,  24929,  24336,  25542),
+      simde_mm256_set_ps(   501.25f,    -67.81f,    538.50f,    718.00f,
+                             -3.42f,    688.50f,    452.00f,    995.00f) },
+    { simde_mm_set_epi16( -7392,  24809,  17853,  22244, -10299,  -7672,  25080,  23750),
+      simde_mm256_set_ps(  -912.00f,    628.50f,      5.74f,    110.25f,
+                           -124.31f,   -772.00f,    764.00f,    305.50f) },
+    { simde_mm_set_epi16( -7331, -12216,  23100,  23590,  -8110,  25534,  24971,  -8840),
+      simde_mm256_set_ps(  -942.50f,    -34.25f,    199.50f,    265.50f,
+                           -553.00f,    991.00f,    709.50f,   -350.00f) },
+    { simde_mm_set_epi16( 23603,  25182,  -7605,  25115,  25036, -14587,  -9736,  -7459),
+      simde_mm256_set_ps(   268.75f,    815.00f,   -805.50f,    781.50f,
+                            742.00f,     -7.02f,   -191.00f,   -878.50f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_cvtph_ps(test_vec[i].a);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_cvtps_ph(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m128i rn;
+    simde__m128i rd;
+    simde__m128i ru;
+    simde__m128i rz;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   719.20f,   -564.81f,    194.32f, -66771.23f,
+                            467.94f,  34805.76f,  71986.34f,   -845.15f),
+      simde_mm_set_epi16( 24990,  -8086,  23059,  -1024,  24400,  30784,  31744,  -7526),
+      simde_mm_set_epi16( 24990,  -8086,  23058,  -1024,  24399,  30783,  31743,  -7525),
+      simde_mm_set_epi16( 24991,  -8087,  23059,  -1025,  24400,  30784,  31744,  -7526),
+      simde_mm_set_epi16( 24990,  -8087,  23058,  -1025,  24399,  30783,  31743,  -7526) },
+    { simde_mm256_set_ps( 53416.94f,   -432.27f,   -353.64f,    236.27f,
+                            706.14f,     51.00f,   -762.14f,   -898.53f),
+      simde_mm_set_epi16( 31365,  -8511,  -8825,  23394,  24964,  21088,  -7692,  -7419),
+      simde_mm_set_epi16( 31365,  -8510,  -8825,  23394,  24964,  21088,  -7691,  -7418),
+      simde_mm_set_epi16( 31366,  -8511,  -8826,  23395,  24965,  21088,  -7692,  -7419),
+      simde_mm_set_epi16( 31365,  -8511,  -8826,  23394,  24964,  21088,  -7692,  -7419) },
+    { simde_mm256_set_ps( 65921.76f,   -284.65f,    -62.47f,  38449.56f,
+                            710.98f,   -864.23f,   -696.76f,   -799.56f),
+      simde_mm_set_epi16( 31744,  -9101, -11313,  30898,  24974,  -7488,  -7822,  -7617),
+      simde_mm_set_epi16( 31743,  -9101, -11312,  30897,  24973,  -7487,  -7822,  -7616),
+      simde_mm_set_epi16( 31744,  -9102, -11313,  30898,  24974,  -7488,  -7823,  -7617),
+      simde_mm_set_epi16( 31743,  -9102, -11313,  30897,  24973,  -7488,  -7823,  -7617) },
+    { simde_mm256_set_ps(  -165.24f,    217.41f,    333.12f,   -768.03f,
+                            -43.07f,     79.80f,   -267.80f,    579.85f),
+      simde_mm_set_epi16( -9942,  23243,  23860,  -7680, -11934,  21757,  -9169,  24712),
+      simde_mm_set_epi16( -9942,  23243,  23860,  -7679, -11933,  21756,  -9168,  24711),
+      simde_mm_set_epi16( -9943,  23244,  23861,  -7680, -11934,  21757,  -9169,  24712),
+      simde_mm_set_epi16( -9943,  23243,  23860,  -7680, -11934,  21756,  -9169,  24711) },
+    { simde_mm256_set_ps(-73492.81f,    371.10f,    182.75f,  75052.15f,
+                            469.24f,    836.26f,    329.66f,    593.70f),
+      simde_mm_set_epi16( -1024,  24012,  22966,  31744,  24405,  25225,  23847,  24739),
+      simde_mm_set_epi16( -1024,  24012,  22966,  31743,  24404,  25224,  23846,  24739),
+      simde_mm_set_epi16( -1025,  24013,  22966,  31744,  24405,  25225,  23847,  24740),
+      simde_mm_set_epi16( -1025,  24012,  22966,  31743,  24404,  25224,  23846,  24739) },
+    { simde_mm256_set_ps(  -505.83f,   -392.76f, -63007.28f,   -714.78f,
+                           -844.82f,    841.48f,   -775.87f,  76690.24f),
+      simde_mm_set_epi16( -8217,  -8669,  -1103,  -7786,  -7526,  25235,  -7664,  31744),
+      simde_mm_set_epi16( -8216,  -8668,  -1103,  -7786,  -7526,  25234,  -7664,  31743),
+      simde_mm_set_epi16( -8217,  -8669,  -1104,  -7787,  -7527,  25235,  -7665,  31744),
+      simde_mm_set_epi16( -8217,  -8669,  -1104,  -7787,  -7527,  25234,  -7665,  31743) },
+    { simde_mm256_set_ps(   300.75f,   -103.69f, -77527.32f,    797.73f,
+                           -564.25f, -63064.69f,   -873.45f,    511.68f),
+      simde_mm_set_epi16( 23731, -10629,  -1024,  25147,  -8088,  -1101,  -7469,  24575),
+      simde_mm_set_epi16( 23731, -10628,  -1024,  25147,  -8087,  -1101,  -7469,  24574),
+      simde_mm_set_epi16( 23731, -10629,  -1025,  25148,  -8088,  -1102,  -7470,  24575),
+      simde_mm_set_epi16( 23731, -10629,  -1025,  25147,  -8088,  -1102,  -7470,  24574) },
+    { simde_mm256_set_ps(   922.90f,    602.61f,    227.90f,  25572.47f,
+                            291.70f, -44816.82f,   -127.17f,     92.34f),
+      simde_mm_set_epi16( 25398,  24757,  23327,  30270,  23695,  -1671, -10253,  21957),
+      simde_mm_set_epi16( 25397,  24757,  23327,  30270,  23694,  -1671, -10253,  21957),
+      simde_mm_set_epi16( 25398,  24758,  23328,  30271,  23695,  -1672, -10254,  21958),
+      simde_mm_set_epi16( 25397,  24757,  23327,  30270,  23694,  -1672, -10254,  21957) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r;
+
+    r = simde_mm256_cvtps_ph(test_vec[i].a, simde_MM_FROUND_TO_NEAREST_INT);
+    simde_assert_m128i_u16(r, ==, test_vec[i].rn);
+    r = simde_mm256_cvtps_ph(test_vec[i].a, simde_MM_FROUND_TO_NEG_INF);
+    simde_assert_m128i_u16(r, ==, test_vec[i].rd);
+    r = simde_mm256_cvtps_ph(test_vec[i].a, simde_MM_FROUND_TO_POS_INF);
+    simde_assert_m128i_u16(r, ==, test_vec[i].ru);
+    r = simde_mm256_cvtps_ph(test_vec[i].a, simde_MM_FROUND_TO_ZERO);
+    simde_assert_m128i_u16(r, ==, test_vec[i].rz);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm_cvtph_ps",    test_simde_mm_cvtph_ps,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtps_ph",    test_simde_mm_cvtps_ph,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtph_ps", test_simde_mm256_cvtph_ps, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_cvtps_ph", test_simde_mm256_cvtps_ph, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_f16c_test_suite = {
+  (char*) "/f16c",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
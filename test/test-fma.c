@@ -0,0 +1,1968 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../fma.h"
+
+static MunitResult
+test_simde_mm_fmadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -80.55,     46.38),
+      simde_mm_set_pd(   -77.57,     47.10),
+      simde_mm_set_pd(    47.70,    -89.61),
+      simde_mm_set_pd(  6295.96,   2094.89) },
+    { simde_mm_set_pd(   -69.56,     61.05),
+      simde_mm_set_pd(    39.02,     85.41),
+      simde_mm_set_pd(    32.19,     79.32),
+      simde_mm_set_pd( -2682.04,   5293.60) },
+    { simde_mm_set_pd(   -76.60,     82.08),
+      simde_mm_set_pd(   -57.64,    -44.82),
+      simde_mm_set_pd(   -11.32,     -8.69),
+      simde_mm_set_pd(  4403.90,  -3687.52) },
+    { simde_mm_set_pd(    36.19,    -97.05),
+      simde_mm_set_pd(    50.58,     81.96),
+      simde_mm_set_pd(     8.74,    -14.11),
+      simde_mm_set_pd(  1839.23,  -7968.33) },
+    { simde_mm_set_pd(   -40.96,     -8.19),
+      simde_mm_set_pd(    41.07,     15.87),
+      simde_mm_set_pd(   -19.65,     99.08),
+      simde_mm_set_pd( -1701.88,    -30.90) },
+    { simde_mm_set_pd(     2.88,     53.56),
+      simde_mm_set_pd(   -12.39,    -90.17),
+      simde_mm_set_pd(   -49.53,     68.98),
+      simde_mm_set_pd(   -85.21,  -4760.53) },
+    { simde_mm_set_pd(    30.11,    -80.12),
+      simde_mm_set_pd(     2.86,     91.65),
+      simde_mm_set_pd(    37.87,     59.19),
+      simde_mm_set_pd(   123.98,  -7283.81) },
+    { simde_mm_set_pd(    50.25,    -97.90),
+      simde_mm_set_pd(    -5.60,    -61.59),
+      simde_mm_set_pd(   -31.46,     25.66),
+      simde_mm_set_pd(  -312.86,   6055.32) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fmadd_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  /* (1 + 2^-30) * (1 - 2^-30) is 1 - 2^-60, which would round to 1.0
+     before the addition if the operation weren't fused. */
+  simde__m128d r = simde_mm_fmadd_pd(simde_mm_set1_pd(1.0 + 0x1p-30), simde_mm_set1_pd(1.0 - 0x1p-30), simde_mm_set1_pd(-1.0));
+  munit_assert_double(simde_mm_cvtsd_f64(r), ==, -0x1p-60);
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    30.80f,     74.89f,    -99.29f,     36.59f),
+      simde_mm_set_ps(   -14.28f,     75.40f,    -93.30f,    -51.58f),
+      simde_mm_set_ps(    25.21f,     -5.97f,     -1.93f,     45.13f),
+      simde_mm_set_ps(  -414.61f,   5640.74f,   9261.83f,  -1842.18f) },
+    { simde_mm_set_ps(    38.36f,    -89.02f,     54.59f,     50.91f),
+      simde_mm_set_ps(    63.00f,     88.97f,    -98.96f,    -27.75f),
+      simde_mm_set_ps(   -83.56f,    -28.97f,     15.26f,    -30.56f),
+      simde_mm_set_ps(  2333.12f,  -7949.08f,  -5386.97f,  -1443.31f) },
+    { simde_mm_set_ps(   -98.54f,    -84.35f,    -55.81f,    -47.48f),
+      simde_mm_set_ps(    -2.07f,    -47.44f,     97.98f,    -40.48f),
+      simde_mm_set_ps(   -80.03f,     53.14f,     70.92f,    -47.74f),
+      simde_mm_set_ps(   123.95f,   4054.70f,  -5397.34f,   1874.25f) },
+    { simde_mm_set_ps(   -63.36f,     26.07f,    -90.86f,    -42.52f),
+      simde_mm_set_ps(    37.40f,     -4.20f,     64.76f,    -36.24f),
+      simde_mm_set_ps(   -63.18f,    -76.22f,    -90.42f,     26.74f),
+      simde_mm_set_ps( -2432.84f,   -185.71f,  -5974.51f,   1567.66f) },
+    { simde_mm_set_ps(    41.24f,     13.63f,    -73.14f,     43.04f),
+      simde_mm_set_ps(    15.15f,    -91.93f,    -85.46f,     24.47f),
+      simde_mm_set_ps(    -8.21f,     19.76f,    -83.55f,    -97.90f),
+      simde_mm_set_ps(   616.58f,  -1233.25f,   6166.99f,    955.29f) },
+    { simde_mm_set_ps(   -29.60f,    -95.82f,     49.30f,    -60.12f),
+      simde_mm_set_ps(    99.59f,     -6.59f,     51.73f,    -52.09f),
+      simde_mm_set_ps(   -42.66f,     19.43f,     -5.29f,    -95.06f),
+      simde_mm_set_ps( -2990.52f,    650.88f,   2545.00f,   3036.59f) },
+    { simde_mm_set_ps(    44.74f,    -82.99f,    -48.33f,    -19.62f),
+      simde_mm_set_ps(    24.30f,    -53.22f,     25.47f,    -79.34f),
+      simde_mm_set_ps(    10.60f,      8.21f,    -77.92f,    -23.31f),
+      simde_mm_set_ps(  1097.78f,   4424.94f,  -1308.89f,   1533.34f) },
+    { simde_mm_set_ps(    39.69f,    -38.54f,    -24.05f,     96.00f),
+      simde_mm_set_ps(    56.91f,      2.10f,     79.68f,    -42.33f),
+      simde_mm_set_ps(     2.32f,     84.19f,     29.69f,    -58.75f),
+      simde_mm_set_ps(  2261.08f,      3.26f,  -1886.61f,  -4122.43f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fmadd_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  /* (1 + 2^-13) * (1 - 2^-13) is 1 - 2^-26, which would round to 1.0f
+     before the addition if the operation weren't fused. */
+  simde__m128 r = simde_mm_fmadd_ps(simde_mm_set1_ps(1.0f + 0x1p-13f), simde_mm_set1_ps(1.0f - 0x1p-13f), simde_mm_set1_ps(-1.0f));
+  munit_assert_float(simde_mm_cvtss_f32(r), ==, -0x1p-26f);
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmadd_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -94.33,    -94.78),
+      simde_mm_set_pd(   -29.21,    -47.37),
+      simde_mm_set_pd(    51.41,     64.90),
+      simde_mm_set_pd(   -94.33,   4554.63) },
+    { simde_mm_set_pd(   -63.33,    -41.20),
+      simde_mm_set_pd(   -25.20,     -0.25),
+      simde_mm_set_pd(   -38.38,    -90.05),
+      simde_mm_set_pd(   -63.33,    -79.75) },
+    { simde_mm_set_pd(    50.11,    -23.06),
+      simde_mm_set_pd(    54.23,     78.91),
+      simde_mm_set_pd(   -24.78,     82.31),
+      simde_mm_set_pd(    50.11,  -1737.35) },
+    { simde_mm_set_pd(    67.92,     92.44),
+      simde_mm_set_pd(   -45.58,     77.40),
+      simde_mm_set_pd(   -36.38,      9.70),
+      simde_mm_set_pd(    67.92,   7164.56) },
+    { simde_mm_set_pd(    55.34,     99.48),
+      simde_mm_set_pd(   -71.46,      9.40),
+      simde_mm_set_pd(   -22.60,     76.74),
+      simde_mm_set_pd(    55.34,   1011.85) },
+    { simde_mm_set_pd(    73.97,    -65.27),
+      simde_mm_set_pd(    11.16,    -52.73),
+      simde_mm_set_pd(    98.92,    -31.21),
+      simde_mm_set_pd(    73.97,   3410.48) },
+    { simde_mm_set_pd(    74.57,     44.96),
+      simde_mm_set_pd(   -34.93,     25.63),
+      simde_mm_set_pd(   -21.26,     15.59),
+      simde_mm_set_pd(    74.57,   1167.91) },
+    { simde_mm_set_pd(    61.22,    -45.37),
+      simde_mm_set_pd(   -13.86,     42.19),
+      simde_mm_set_pd(   -70.45,     93.64),
+      simde_mm_set_pd(    61.22,  -1820.52) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fmadd_sd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmadd_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    91.96f,    -93.41f,    -70.54f,    -91.74f),
+      simde_mm_set_ps(    60.41f,      8.72f,     28.65f,     16.39f),
+      simde_mm_set_ps(    30.82f,      9.58f,     73.27f,     28.27f),
+      simde_mm_set_ps(    91.96f,    -93.41f,    -70.54f,  -1475.35f) },
+    { simde_mm_set_ps(   -63.08f,    -51.44f,    -42.72f,     85.73f),
+      simde_mm_set_ps(   -44.00f,    -31.23f,     20.41f,     15.96f),
+      simde_mm_set_ps(    93.52f,      3.78f,     97.47f,     72.60f),
+      simde_mm_set_ps(   -63.08f,    -51.44f,    -42.72f,   1440.85f) },
+    { simde_mm_set_ps(    48.04f,    -92.24f,     80.71f,     96.10f),
+      simde_mm_set_ps(   -44.18f,     -6.59f,     50.32f,     49.83f),
+      simde_mm_set_ps(   -97.85f,    -83.84f,     51.89f,     48.65f),
+      simde_mm_set_ps(    48.04f,    -92.24f,     80.71f,   4837.31f) },
+    { simde_mm_set_ps(   -16.77f,    -54.79f,     39.18f,    -68.45f),
+      simde_mm_set_ps(    17.04f,     18.44f,    -18.73f,     30.04f),
+      simde_mm_set_ps(   -70.59f,     85.78f,      4.59f,     93.19f),
+      simde_mm_set_ps(   -16.77f,    -54.79f,     39.18f,  -1963.05f) },
+    { simde_mm_set_ps(    59.06f,     86.59f,    -55.43f,     75.41f),
+      simde_mm_set_ps(    -4.90f,    -85.97f,    -38.20f,    -55.55f),
+      simde_mm_set_ps(    44.24f,    -56.90f,    -84.92f,    -16.23f),
+      simde_mm_set_ps(    59.06f,     86.59f,    -55.43f,  -4205.26f) },
+    { simde_mm_set_ps(    58.72f,    -59.51f,    -48.05f,     74.03f),
+      simde_mm_set_ps(    63.63f,     59.47f,     15.07f,     94.57f),
+      simde_mm_set_ps(   -42.71f,     -0.23f,    -89.36f,    -49.53f),
+      simde_mm_set_ps(    58.72f,    -59.51f,    -48.05f,   6951.49f) },
+    { simde_mm_set_ps(    27.65f,     99.35f,    -18.59f,    -29.95f),
+      simde_mm_set_ps(   -65.37f,     92.11f,     73.89f,    -93.77f),
+      simde_mm_set_ps(   -21.38f,     20.21f,     31.30f,    -98.49f),
+      simde_mm_set_ps(    27.65f,     99.35f,    -18.59f,   2709.92f) },
+    { simde_mm_set_ps(   -77.11f,     74.26f,     24.51f,      0.43f),
+      simde_mm_set_ps(    62.76f,     53.40f,    -89.70f,     73.90f),
+      simde_mm_set_ps(    23.52f,     34.18f,     62.31f,     27.55f),
+      simde_mm_set_ps(   -77.11f,     74.26f,     24.51f,     59.33f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fmadd_ss(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmaddsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(     9.43,     90.92),
+      simde_mm_set_pd(    41.70,    -92.82),
+      simde_mm_set_pd(    50.21,      6.00),
+      simde_mm_set_pd(   443.44,  -8445.19) },
+    { simde_mm_set_pd(    22.91,    -12.91),
+      simde_mm_set_pd(   -34.27,    -22.22),
+      simde_mm_set_pd(    23.70,    -31.23),
+      simde_mm_set_pd(  -761.43,    318.09) },
+    { simde_mm_set_pd(    63.99,     59.03),
+      simde_mm_set_pd(    79.48,    -54.87),
+      simde_mm_set_pd(   -17.38,     -1.77),
+      simde_mm_set_pd(  5068.55,  -3237.21) },
+    { simde_mm_set_pd(    51.32,     22.89),
+      simde_mm_set_pd(   -34.44,     66.49),
+      simde_mm_set_pd(    -1.12,     52.08),
+      simde_mm_set_pd( -1768.58,   1469.88) },
+    { simde_mm_set_pd(    66.02,     84.03),
+      simde_mm_set_pd(   -77.05,     -2.45),
+      simde_mm_set_pd(   -60.16,     48.08),
+      simde_mm_set_pd( -5147.00,   -253.95) },
+    { simde_mm_set_pd(    79.93,    -38.75),
+      simde_mm_set_pd(    71.75,     66.07),
+      simde_mm_set_pd(    28.14,     98.23),
+      simde_mm_set_pd(  5763.12,  -2658.44) },
+    { simde_mm_set_pd(   -97.32,     64.78),
+      simde_mm_set_pd(    27.70,    -21.78),
+      simde_mm_set_pd(   -32.87,    -19.09),
+      simde_mm_set_pd( -2728.63,  -1391.82) },
+    { simde_mm_set_pd(   -49.27,    -71.02),
+      simde_mm_set_pd(   -27.57,     36.72),
+      simde_mm_set_pd(   -71.01,    -93.60),
+      simde_mm_set_pd(  1287.36,  -2514.25) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fmaddsub_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmaddsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    71.80f,    -85.67f,    -39.10f,     21.74f),
+      simde_mm_set_ps(    72.16f,     95.45f,     20.15f,     42.27f),
+      simde_mm_set_ps(   -46.29f,     70.36f,    -59.07f,     -6.10f),
+      simde_mm_set_ps(  5134.80f,  -8247.56f,   -846.93f,    925.05f) },
+    { simde_mm_set_ps(    99.91f,    -23.51f,    -62.17f,     45.00f),
+      simde_mm_set_ps(    28.62f,     26.79f,    -75.74f,     13.47f),
+      simde_mm_set_ps(   -23.54f,     15.28f,    -73.88f,    -76.31f),
+      simde_mm_set_ps(  2835.88f,   -645.11f,   4634.88f,    682.46f) },
+    { simde_mm_set_ps(    -2.67f,     21.04f,     68.56f,     58.85f),
+      simde_mm_set_ps(    53.34f,    -71.37f,     43.53f,     72.70f),
+      simde_mm_set_ps(    64.37f,    -20.01f,     98.71f,     34.05f),
+      simde_mm_set_ps(   -78.05f,  -1481.61f,   3083.13f,   4244.34f) },
+    { simde_mm_set_ps(   -43.97f,    -51.59f,    -42.97f,     91.64f),
+      simde_mm_set_ps(    71.69f,    -33.22f,    -68.97f,     54.84f),
+      simde_mm_set_ps(   -74.53f,    -88.87f,     78.20f,    -12.94f),
+      simde_mm_set_ps( -3226.74f,   1802.69f,   3041.84f,   5038.48f) },
+    { simde_mm_set_ps(    -5.74f,     74.60f,     82.68f,     56.39f),
+      simde_mm_set_ps(   -33.33f,    -66.28f,     25.98f,    -82.24f),
+      simde_mm_set_ps(    65.35f,    -67.64f,     27.54f,     98.25f),
+      simde_mm_set_ps(   256.66f,  -4876.85f,   2175.57f,  -4735.76f) },
+    { simde_mm_set_ps(    96.11f,    -15.97f,     67.43f,      2.17f),
+      simde_mm_set_ps(    93.45f,    -19.60f,     75.81f,    -30.90f),
+      simde_mm_set_ps(    55.23f,     95.15f,     -2.09f,      3.67f),
+      simde_mm_set_ps(  9036.71f,    217.86f,   5109.78f,    -70.72f) },
+    { simde_mm_set_ps(   -86.65f,    -79.55f,     60.48f,    -54.60f),
+      simde_mm_set_ps(    82.06f,      8.06f,     90.89f,     43.43f),
+      simde_mm_set_ps(    -9.67f,     86.54f,    -43.60f,    -11.91f),
+      simde_mm_set_ps( -7120.17f,   -727.71f,   5453.43f,  -2359.37f) },
+    { simde_mm_set_ps(     4.33f,     14.85f,     78.92f,    -66.65f),
+      simde_mm_set_ps(   -65.55f,    -22.75f,    -11.10f,     84.35f),
+      simde_mm_set_ps(   -29.14f,    -78.44f,     93.94f,    -42.51f),
+      simde_mm_set_ps(  -312.97f,   -259.40f,   -782.07f,  -5579.42f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fmaddsub_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -78.30,     23.18),
+      simde_mm_set_pd(   -97.12,    -74.21),
+      simde_mm_set_pd(   -64.27,    -99.86),
+      simde_mm_set_pd(  7668.77,  -1620.33) },
+    { simde_mm_set_pd(    -2.54,     89.34),
+      simde_mm_set_pd(    60.68,      7.01),
+      simde_mm_set_pd(   -80.72,     10.20),
+      simde_mm_set_pd(   -73.41,    616.07) },
+    { simde_mm_set_pd(    11.06,    -16.77),
+      simde_mm_set_pd(   -37.25,     47.59),
+      simde_mm_set_pd(   -31.45,     65.78),
+      simde_mm_set_pd(  -380.54,   -863.86) },
+    { simde_mm_set_pd(    67.25,     73.56),
+      simde_mm_set_pd(    19.18,    -23.34),
+      simde_mm_set_pd(    18.31,     66.00),
+      simde_mm_set_pd(  1271.55,  -1782.89) },
+    { simde_mm_set_pd(    24.09,     80.68),
+      simde_mm_set_pd(   -64.78,      8.84),
+      simde_mm_set_pd(    36.18,    -43.46),
+      simde_mm_set_pd( -1596.73,    756.67) },
+    { simde_mm_set_pd(    11.83,     96.74),
+      simde_mm_set_pd(    67.84,    -23.58),
+      simde_mm_set_pd(   -42.78,    -22.65),
+      simde_mm_set_pd(   845.33,  -2258.48) },
+    { simde_mm_set_pd(   -46.57,    -33.26),
+      simde_mm_set_pd(     5.41,     69.38),
+      simde_mm_set_pd(    61.63,     79.98),
+      simde_mm_set_pd(  -313.57,  -2387.56) },
+    { simde_mm_set_pd(    91.25,     -6.30),
+      simde_mm_set_pd(   -39.88,     93.81),
+      simde_mm_set_pd(   -67.32,     89.99),
+      simde_mm_set_pd( -3571.73,   -680.99) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fmsub_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    22.54f,    -74.31f,     89.24f,     76.92f),
+      simde_mm_set_ps(    70.86f,     79.05f,    -18.58f,     38.04f),
+      simde_mm_set_ps(    80.52f,     82.51f,    -32.55f,     46.90f),
+      simde_mm_set_ps(  1516.66f,  -5956.72f,  -1625.53f,   2879.14f) },
+    { simde_mm_set_ps(    95.60f,    -33.26f,    -24.84f,    -96.58f),
+      simde_mm_set_ps(    91.83f,    -91.75f,     39.21f,    -45.26f),
+      simde_mm_set_ps(    12.31f,    -46.04f,    -14.28f,    -13.48f),
+      simde_mm_set_ps(  8766.64f,   3097.64f,   -959.70f,   4384.69f) },
+    { simde_mm_set_ps(    11.55f,     60.90f,     40.11f,     41.20f),
+      simde_mm_set_ps(   -78.99f,     17.97f,    -69.39f,     64.46f),
+      simde_mm_set_ps(   -20.30f,    -45.56f,      5.17f,    -37.13f),
+      simde_mm_set_ps(  -892.03f,   1139.93f,  -2788.40f,   2692.88f) },
+    { simde_mm_set_ps(    96.10f,      2.33f,    -97.93f,     80.44f),
+      simde_mm_set_ps(     9.91f,     23.79f,     29.82f,     31.02f),
+      simde_mm_set_ps(    52.45f,     36.52f,     43.54f,    -63.02f),
+      simde_mm_set_ps(   899.90f,     18.91f,  -2963.81f,   2558.27f) },
+    { simde_mm_set_ps(    21.78f,     49.18f,      7.10f,    -66.11f),
+      simde_mm_set_ps(    35.67f,    -67.26f,     32.40f,     19.85f),
+      simde_mm_set_ps(   -83.84f,     19.87f,    -14.17f,    -85.31f),
+      simde_mm_set_ps(   860.73f,  -3327.72f,    244.21f,  -1226.97f) },
+    { simde_mm_set_ps(    71.25f,    -12.73f,    -92.28f,      9.76f),
+      simde_mm_set_ps(   -50.63f,    -49.78f,    -29.40f,    -65.34f),
+      simde_mm_set_ps(    88.29f,     48.68f,     99.40f,    -90.03f),
+      simde_mm_set_ps( -3695.68f,    585.02f,   2613.63f,   -547.69f) },
+    { simde_mm_set_ps(   -71.77f,    -22.93f,    -39.53f,    -85.49f),
+      simde_mm_set_ps(    17.33f,    -50.45f,    -29.31f,    -73.92f),
+      simde_mm_set_ps(     8.16f,    -93.60f,    -14.04f,    -77.43f),
+      simde_mm_set_ps( -1251.93f,   1250.42f,   1172.66f,   6396.85f) },
+    { simde_mm_set_ps(   -81.60f,    -80.80f,      8.08f,    -37.84f),
+      simde_mm_set_ps(   -44.22f,    -11.43f,    -75.08f,    -37.07f),
+      simde_mm_set_ps(     8.66f,     55.18f,     61.74f,    -64.67f),
+      simde_mm_set_ps(  3599.69f,    868.36f,   -668.39f,   1467.40f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fmsub_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmsub_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -27.21,    -21.76),
+      simde_mm_set_pd(    72.20,     32.41),
+      simde_mm_set_pd(    83.94,    -14.41),
+      simde_mm_set_pd(   -27.21,   -690.83) },
+    { simde_mm_set_pd(   -70.78,    -99.07),
+      simde_mm_set_pd(    15.99,    -16.00),
+      simde_mm_set_pd(    26.77,     -6.36),
+      simde_mm_set_pd(   -70.78,   1591.48) },
+    { simde_mm_set_pd(    10.57,    -92.18),
+      simde_mm_set_pd(    34.33,     88.02),
+      simde_mm_set_pd(    58.34,    -58.61),
+      simde_mm_set_pd(    10.57,  -8055.07) },
+    { simde_mm_set_pd(    58.52,     47.99),
+      simde_mm_set_pd(    66.20,      7.62),
+      simde_mm_set_pd(   -28.04,    -37.53),
+      simde_mm_set_pd(    58.52,    403.21) },
+    { simde_mm_set_pd(   -76.92,     72.61),
+      simde_mm_set_pd(    42.10,     74.71),
+      simde_mm_set_pd(    27.29,     34.24),
+      simde_mm_set_pd(   -76.92,   5390.45) },
+    { simde_mm_set_pd(   -76.64,    -23.24),
+      simde_mm_set_pd(   -23.43,     34.21),
+      simde_mm_set_pd(    53.40,     38.91),
+      simde_mm_set_pd(   -76.64,   -833.95) },
+    { simde_mm_set_pd(    98.01,    -85.15),
+      simde_mm_set_pd(    14.33,    -60.31),
+      simde_mm_set_pd(    57.51,    -44.03),
+      simde_mm_set_pd(    98.01,   5179.43) },
+    { simde_mm_set_pd(    -0.38,    -66.68),
+      simde_mm_set_pd(   -20.30,     40.97),
+      simde_mm_set_pd(    32.28,    -55.43),
+      simde_mm_set_pd(    -0.38,  -2676.45) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fmsub_sd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmsub_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(   -24.77f,     91.83f,     16.72f,     44.20f),
+      simde_mm_set_ps(   -66.30f,     -7.10f,     35.91f,     -2.67f),
+      simde_mm_set_ps(    69.56f,    -44.67f,     45.04f,     90.45f),
+      simde_mm_set_ps(   -24.77f,     91.83f,     16.72f,   -208.46f) },
+    { simde_mm_set_ps(    95.58f,    -78.76f,      6.12f,    -26.03f),
+      simde_mm_set_ps(    37.94f,     70.84f,    -81.35f,     -9.64f),
+      simde_mm_set_ps(   -58.32f,    -87.55f,    -67.81f,    -30.58f),
+      simde_mm_set_ps(    95.58f,    -78.76f,      6.12f,    281.51f) },
+    { simde_mm_set_ps(   -92.44f,     76.02f,     98.18f,     55.80f),
+      simde_mm_set_ps(   -32.90f,     52.22f,    -16.32f,     64.44f),
+      simde_mm_set_ps(    47.29f,     13.20f,    -52.58f,    -91.73f),
+      simde_mm_set_ps(   -92.44f,     76.02f,     98.18f,   3687.48f) },
+    { simde_mm_set_ps(    18.02f,    -35.22f,    -17.99f,     85.28f),
+      simde_mm_set_ps(   -37.75f,     23.15f,    -38.63f,     24.48f),
+      simde_mm_set_ps(    -0.62f,     29.36f,      9.36f,    -10.46f),
+      simde_mm_set_ps(    18.02f,    -35.22f,    -17.99f,   2098.11f) },
+    { simde_mm_set_ps(   -36.07f,     95.27f,    -70.20f,     73.07f),
+      simde_mm_set_ps(   -32.88f,     -7.52f,      5.55f,    -11.95f),
+      simde_mm_set_ps(    45.70f,     91.68f,    -49.49f,     20.72f),
+      simde_mm_set_ps(   -36.07f,     95.27f,    -70.20f,   -893.91f) },
+    { simde_mm_set_ps(    -1.40f,     47.14f,     95.94f,      4.96f),
+      simde_mm_set_ps(   -56.10f,     46.81f,    -71.77f,    -81.39f),
+      simde_mm_set_ps(   -22.68f,    -17.67f,    -67.18f,     46.37f),
+      simde_mm_set_ps(    -1.40f,     47.14f,     95.94f,   -450.06f) },
+    { simde_mm_set_ps(   -33.11f,     -1.08f,    -38.34f,    -96.76f),
+      simde_mm_set_ps(    27.01f,    -56.02f,    -85.98f,    -92.29f),
+      simde_mm_set_ps(   -11.63f,     -6.83f,    -70.90f,    -23.17f),
+      simde_mm_set_ps(   -33.11f,     -1.08f,    -38.34f,   8953.15f) },
+    { simde_mm_set_ps(   -97.67f,     31.10f,     75.54f,    -56.87f),
+      simde_mm_set_ps(    55.88f,     -0.16f,     24.08f,     64.45f),
+      simde_mm_set_ps(   -43.85f,      7.47f,     97.00f,     41.10f),
+      simde_mm_set_ps(   -97.67f,     31.10f,     75.54f,  -3706.37f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fmsub_ss(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmsubadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    19.50,     62.87),
+      simde_mm_set_pd(   -63.54,     77.02),
+      simde_mm_set_pd(    63.09,    -35.44),
+      simde_mm_set_pd( -1302.12,   4806.81) },
+    { simde_mm_set_pd(    72.87,     93.82),
+      simde_mm_set_pd(    98.40,    -74.51),
+      simde_mm_set_pd(     7.55,      3.37),
+      simde_mm_set_pd(  7162.86,  -6987.16) },
+    { simde_mm_set_pd(   -99.15,    -18.96),
+      simde_mm_set_pd(    34.30,    -38.30),
+      simde_mm_set_pd(   -15.78,    -86.10),
+      simde_mm_set_pd( -3385.07,    640.07) },
+    { simde_mm_set_pd(   -83.97,    -61.23),
+      simde_mm_set_pd(     1.35,    -13.80),
+      simde_mm_set_pd(   -22.15,    -97.08),
+      simde_mm_set_pd(   -91.21,    747.89) },
+    { simde_mm_set_pd(   -63.44,      3.88),
+      simde_mm_set_pd(   -96.52,     58.18),
+      simde_mm_set_pd(   -36.03,    -82.99),
+      simde_mm_set_pd(  6159.26,    142.75) },
+    { simde_mm_set_pd(   -67.42,    -36.53),
+      simde_mm_set_pd(    34.14,      8.82),
+      simde_mm_set_pd(   -89.64,     32.71),
+      simde_mm_set_pd( -2212.08,   -289.48) },
+    { simde_mm_set_pd(     8.05,    -43.46),
+      simde_mm_set_pd(   -80.90,     75.48),
+      simde_mm_set_pd(    75.46,     42.70),
+      simde_mm_set_pd(  -726.71,  -3237.66) },
+    { simde_mm_set_pd(    96.83,    -85.75),
+      simde_mm_set_pd(    50.15,    -55.30),
+      simde_mm_set_pd(    20.03,      2.17),
+      simde_mm_set_pd(  4835.99,   4744.14) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fmsubadd_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fmsubadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    16.73f,     32.65f,     23.43f,     18.06f),
+      simde_mm_set_ps(   -97.83f,     60.55f,     -2.42f,    -42.43f),
+      simde_mm_set_ps(   -33.13f,     62.08f,     -6.54f,     61.76f),
+      simde_mm_set_ps( -1603.57f,   2039.04f,    -50.16f,   -704.53f) },
+    { simde_mm_set_ps(    55.45f,    -55.40f,     93.04f,     53.91f),
+      simde_mm_set_ps(    66.88f,    -66.40f,    -47.04f,     29.31f),
+      simde_mm_set_ps(    89.11f,     37.66f,     27.69f,     52.26f),
+      simde_mm_set_ps(  3619.39f,   3716.22f,  -4404.29f,   1632.36f) },
+    { simde_mm_set_ps(   -77.77f,    -48.62f,    -26.89f,     20.12f),
+      simde_mm_set_ps(    -7.93f,    -71.06f,    -52.62f,      2.07f),
+      simde_mm_set_ps(   -56.54f,     66.85f,    -21.09f,    -22.46f),
+      simde_mm_set_ps(   673.26f,   3521.79f,   1436.04f,     19.19f) },
+    { simde_mm_set_ps(    44.48f,      7.12f,      7.46f,    -25.84f),
+      simde_mm_set_ps(   -82.80f,     46.80f,    -11.57f,     62.13f),
+      simde_mm_set_ps(   -95.19f,     84.46f,    -88.94f,     44.30f),
+      simde_mm_set_ps( -3587.75f,    417.68f,      2.63f,  -1561.14f) },
+    { simde_mm_set_ps(    95.48f,     -1.11f,    -10.79f,     18.38f),
+      simde_mm_set_ps(   -73.08f,    -27.60f,      5.55f,    -80.11f),
+      simde_mm_set_ps(    83.29f,    -70.73f,     87.86f,    -98.78f),
+      simde_mm_set_ps( -7060.97f,    -40.09f,   -147.74f,  -1571.20f) },
+    { simde_mm_set_ps(    43.41f,     43.22f,     61.57f,      0.73f),
+      simde_mm_set_ps(   -77.79f,    -56.91f,    -34.74f,     -7.51f),
+      simde_mm_set_ps(   -54.01f,     93.36f,     82.81f,     70.12f),
+      simde_mm_set_ps( -3322.85f,  -2366.29f,  -2221.75f,     64.64f) },
+    { simde_mm_set_ps(   -41.43f,     77.09f,    -70.49f,    -60.74f),
+      simde_mm_set_ps(    64.70f,    -87.86f,     99.80f,    -62.89f),
+      simde_mm_set_ps(    70.28f,     43.88f,    -32.64f,     78.67f),
+      simde_mm_set_ps( -2750.80f,  -6729.25f,  -7002.26f,   3898.61f) },
+    { simde_mm_set_ps(   -81.73f,    -87.50f,     21.49f,     36.28f),
+      simde_mm_set_ps(    44.67f,     65.68f,     44.54f,    -88.90f),
+      simde_mm_set_ps(   -90.25f,     49.11f,     86.28f,     61.32f),
+      simde_mm_set_ps( -3560.63f,  -5697.89f,    870.88f,  -3163.97f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fmsubadd_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fnmadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    92.43,     59.91),
+      simde_mm_set_pd(    21.59,     -8.89),
+      simde_mm_set_pd(   -65.25,     69.39),
+      simde_mm_set_pd( -2060.81,    601.99) },
+    { simde_mm_set_pd(   -79.30,    -58.68),
+      simde_mm_set_pd(    86.54,     68.36),
+      simde_mm_set_pd(   -33.27,     16.75),
+      simde_mm_set_pd(  6829.35,   4028.11) },
+    { simde_mm_set_pd(   -53.53,     95.20),
+      simde_mm_set_pd(    73.15,     17.43),
+      simde_mm_set_pd(    24.95,    -40.73),
+      simde_mm_set_pd(  3940.67,  -1700.07) },
+    { simde_mm_set_pd(    -7.74,    -99.16),
+      simde_mm_set_pd(    52.87,    -47.65),
+      simde_mm_set_pd(    -6.49,    -29.39),
+      simde_mm_set_pd(   402.72,  -4754.36) },
+    { simde_mm_set_pd(     6.60,     89.64),
+      simde_mm_set_pd(    35.79,     80.53),
+      simde_mm_set_pd(   -90.89,     93.55),
+      simde_mm_set_pd(  -327.10,  -7125.16) },
+    { simde_mm_set_pd(    -4.29,    -35.02),
+      simde_mm_set_pd(    11.67,     86.50),
+      simde_mm_set_pd(    40.39,     65.81),
+      simde_mm_set_pd(    90.45,   3095.04) },
+    { simde_mm_set_pd(    77.15,    -66.28),
+      simde_mm_set_pd(   -64.85,     81.81),
+      simde_mm_set_pd(   -19.58,    -17.39),
+      simde_mm_set_pd(  4983.60,   5404.98) },
+    { simde_mm_set_pd(    11.07,     -6.84),
+      simde_mm_set_pd(    23.82,     46.76),
+      simde_mm_set_pd(    76.98,    -56.48),
+      simde_mm_set_pd(  -186.71,    263.36) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fnmadd_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fnmadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    48.75f,     -7.54f,    -68.15f,     24.38f),
+      simde_mm_set_ps(   -19.38f,    -32.69f,    -24.67f,     81.35f),
+      simde_mm_set_ps(     8.92f,    -32.28f,     70.88f,     12.21f),
+      simde_mm_set_ps(   953.69f,   -278.76f,  -1610.38f,  -1971.10f) },
+    { simde_mm_set_ps(    99.99f,    -10.23f,      2.67f,     73.15f),
+      simde_mm_set_ps(   -14.32f,     72.16f,     14.79f,     23.98f),
+      simde_mm_set_ps(   -22.15f,    -39.03f,     46.72f,    -16.86f),
+      simde_mm_set_ps(  1409.71f,    699.17f,      7.23f,  -1771.00f) },
+    { simde_mm_set_ps(    39.39f,      2.53f,     47.20f,     20.96f),
+      simde_mm_set_ps(   -99.48f,    -79.18f,    -88.34f,     71.74f),
+      simde_mm_set_ps(    96.31f,     -2.17f,     92.81f,      7.03f),
+      simde_mm_set_ps(  4014.83f,    198.16f,   4262.46f,  -1496.64f) },
+    { simde_mm_set_ps(   -63.73f,     -8.86f,     82.37f,    -94.34f),
+      simde_mm_set_ps(    90.64f,     98.26f,     93.20f,     98.99f),
+      simde_mm_set_ps(   -55.89f,    -60.79f,    -36.69f,     75.33f),
+      simde_mm_set_ps(  5720.60f,    809.79f,  -7713.57f,   9414.05f) },
+    { simde_mm_set_ps(     0.21f,    -64.04f,    -13.69f,     39.02f),
+      simde_mm_set_ps(   -52.05f,     -8.02f,     -3.12f,     16.42f),
+      simde_mm_set_ps(   -51.78f,     53.15f,     30.21f,     36.39f),
+      simde_mm_set_ps(   -40.85f,   -460.45f,    -12.50f,   -604.32f) },
+    { simde_mm_set_ps(    66.83f,    -22.32f,    -87.52f,     41.68f),
+      simde_mm_set_ps(    29.22f,     52.98f,      5.09f,    -72.23f),
+      simde_mm_set_ps(   -95.45f,    -91.83f,     37.41f,     -8.74f),
+      simde_mm_set_ps( -2048.22f,   1090.68f,    482.89f,   3001.81f) },
+    { simde_mm_set_ps(    90.99f,    -20.30f,     85.24f,     66.02f),
+      simde_mm_set_ps(   -69.56f,    -30.12f,    -18.88f,    -64.08f),
+      simde_mm_set_ps(   -91.14f,    -37.61f,     71.16f,     11.52f),
+      simde_mm_set_ps(  6238.12f,   -649.05f,   1680.49f,   4242.08f) },
+    { simde_mm_set_ps(     7.14f,     -2.55f,     30.68f,    -88.95f),
+      simde_mm_set_ps(     6.96f,     28.69f,     90.60f,     -9.85f),
+      simde_mm_set_ps(     7.18f,    -24.83f,     70.21f,     93.09f),
+      simde_mm_set_ps(   -42.51f,     48.33f,  -2709.40f,   -783.07f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fnmadd_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fnmadd_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    29.76,     94.15),
+      simde_mm_set_pd(    81.78,     19.93),
+      simde_mm_set_pd(    31.07,    -42.22),
+      simde_mm_set_pd(    29.76,  -1918.63) },
+    { simde_mm_set_pd(   -19.76,     52.97),
+      simde_mm_set_pd(   -58.29,      0.21),
+      simde_mm_set_pd(   -91.77,     -1.78),
+      simde_mm_set_pd(   -19.76,    -12.90) },
+    { simde_mm_set_pd(   -99.75,     23.65),
+      simde_mm_set_pd(   -74.91,     -7.85),
+      simde_mm_set_pd(   -52.17,    -61.18),
+      simde_mm_set_pd(   -99.75,    124.47) },
+    { simde_mm_set_pd(   -22.45,    -68.59),
+      simde_mm_set_pd(    -4.27,    -38.09),
+      simde_mm_set_pd(   -63.70,    -20.29),
+      simde_mm_set_pd(   -22.45,  -2632.88) },
+    { simde_mm_set_pd(   -74.73,    -95.84),
+      simde_mm_set_pd(    65.16,     81.37),
+      simde_mm_set_pd(   -90.42,     81.33),
+      simde_mm_set_pd(   -74.73,   7879.83) },
+    { simde_mm_set_pd(    -7.99,      7.31),
+      simde_mm_set_pd(     9.36,    -65.42),
+      simde_mm_set_pd(    56.95,     10.73),
+      simde_mm_set_pd(    -7.99,    488.95) },
+    { simde_mm_set_pd(   -10.09,     61.53),
+      simde_mm_set_pd(    25.98,     79.67),
+      simde_mm_set_pd(   -46.58,    -24.04),
+      simde_mm_set_pd(   -10.09,  -4926.14) },
+    { simde_mm_set_pd(   -49.07,     91.40),
+      simde_mm_set_pd(   -13.07,    -67.04),
+      simde_mm_set_pd(    58.69,    -21.56),
+      simde_mm_set_pd(   -49.07,   6105.90) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fnmadd_sd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fnmadd_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    70.50f,    -71.70f,     89.15f,     76.03f),
+      simde_mm_set_ps(   -85.45f,    -48.29f,     17.75f,     75.79f),
+      simde_mm_set_ps(   -97.38f,     68.51f,     39.18f,     70.44f),
+      simde_mm_set_ps(    70.50f,    -71.70f,     89.15f,  -5691.87f) },
+    { simde_mm_set_ps(   -47.54f,    -28.25f,    -15.98f,     -4.61f),
+      simde_mm_set_ps(   -63.80f,     83.75f,     60.03f,    -83.47f),
+      simde_mm_set_ps(    47.52f,    -46.22f,    -27.48f,     99.14f),
+      simde_mm_set_ps(   -47.54f,    -28.25f,    -15.98f,   -285.66f) },
+    { simde_mm_set_ps(   -31.25f,     65.85f,     -8.39f,     94.46f),
+      simde_mm_set_ps(    91.11f,     90.81f,     94.47f,     65.83f),
+      simde_mm_set_ps(    71.27f,     65.41f,     70.16f,    -19.84f),
+      simde_mm_set_ps(   -31.25f,     65.85f,     -8.39f,  -6238.14f) },
+    { simde_mm_set_ps(   -95.10f,    -46.99f,     44.60f,    -50.12f),
+      simde_mm_set_ps(    43.99f,     80.13f,     61.52f,    -29.10f),
+      simde_mm_set_ps(    45.65f,    -12.67f,    -31.59f,    -48.46f),
+      simde_mm_set_ps(   -95.10f,    -46.99f,     44.60f,  -1506.95f) },
+    { simde_mm_set_ps(   -34.97f,    -76.05f,    -16.56f,    -42.50f),
+      simde_mm_set_ps(   -35.09f,    -53.73f,     92.14f,     13.75f),
+      simde_mm_set_ps(    91.66f,    -74.23f,      6.44f,    -88.30f),
+      simde_mm_set_ps(   -34.97f,    -76.05f,    -16.56f,    496.08f) },
+    { simde_mm_set_ps(   -61.75f,    -13.91f,    -50.67f,    -71.32f),
+      simde_mm_set_ps(   -12.56f,      6.42f,     57.85f,    -24.19f),
+      simde_mm_set_ps(    91.88f,    -44.85f,     69.08f,    -90.01f),
+      simde_mm_set_ps(   -61.75f,    -13.91f,    -50.67f,  -1815.24f) },
+    { simde_mm_set_ps(   -68.23f,    -72.77f,     21.22f,    -61.06f),
+      simde_mm_set_ps(    94.97f,    -61.94f,    -77.80f,     26.97f),
+      simde_mm_set_ps(   -91.63f,    -77.48f,    -76.00f,    -95.96f),
+      simde_mm_set_ps(   -68.23f,    -72.77f,     21.22f,   1550.83f) },
+    { simde_mm_set_ps(    32.44f,    -93.50f,      9.54f,    -34.58f),
+      simde_mm_set_ps(   -36.16f,    -10.62f,     98.76f,     -9.09f),
+      simde_mm_set_ps(   -96.19f,     25.31f,     10.29f,     42.84f),
+      simde_mm_set_ps(    32.44f,    -93.50f,      9.54f,   -271.49f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fnmadd_ss(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fnmsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    62.19,    -33.55),
+      simde_mm_set_pd(   -77.11,      0.63),
+      simde_mm_set_pd(    -7.02,    -95.06),
+      simde_mm_set_pd(  4802.49,    116.20) },
+    { simde_mm_set_pd(   -38.28,    -43.25),
+      simde_mm_set_pd(   -82.20,     22.87),
+      simde_mm_set_pd(    41.98,     42.78),
+      simde_mm_set_pd( -3188.60,    946.35) },
+    { simde_mm_set_pd(    71.59,     19.77),
+      simde_mm_set_pd(   -11.75,     25.56),
+      simde_mm_set_pd(    96.03,     -9.52),
+      simde_mm_set_pd(   745.15,   -495.80) },
+    { simde_mm_set_pd(    82.17,     99.06),
+      simde_mm_set_pd(    -5.25,    -25.86),
+      simde_mm_set_pd(   -33.92,     48.55),
+      simde_mm_set_pd(   465.31,   2513.14) },
+    { simde_mm_set_pd(    42.50,    -13.11),
+      simde_mm_set_pd(   -26.21,     45.01),
+      simde_mm_set_pd(    64.26,    -73.65),
+      simde_mm_set_pd(  1049.66,    663.73) },
+    { simde_mm_set_pd(    45.42,    -16.32),
+      simde_mm_set_pd(   -86.70,    -51.32),
+      simde_mm_set_pd(    66.84,    -44.20),
+      simde_mm_set_pd(  3871.07,   -793.34) },
+    { simde_mm_set_pd(   -95.66,     81.03),
+      simde_mm_set_pd(    63.99,    -70.85),
+      simde_mm_set_pd(    41.29,    -25.25),
+      simde_mm_set_pd(  6079.99,   5766.23) },
+    { simde_mm_set_pd(    -7.01,    -95.13),
+      simde_mm_set_pd(   -34.61,    -76.62),
+      simde_mm_set_pd(    77.46,    -57.28),
+      simde_mm_set_pd(  -320.08,  -7231.58) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fnmsub_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fnmsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(     2.25f,      0.01f,    -81.60f,    -63.97f),
+      simde_mm_set_ps(    65.14f,     14.16f,     12.15f,      1.74f),
+      simde_mm_set_ps(    89.25f,     53.84f,    -25.27f,    -14.01f),
+      simde_mm_set_ps(  -235.82f,    -53.98f,   1016.71f,    125.32f) },
+    { simde_mm_set_ps(    21.24f,     21.33f,     83.37f,     69.96f),
+      simde_mm_set_ps(    76.66f,     77.92f,    -14.45f,    -35.23f),
+      simde_mm_set_ps(   -57.55f,    -68.85f,     48.10f,     37.54f),
+      simde_mm_set_ps( -1570.71f,  -1593.18f,   1156.60f,   2427.15f) },
+    { simde_mm_set_ps(    84.84f,    -77.99f,     -2.47f,     12.95f),
+      simde_mm_set_ps(   -28.92f,     34.31f,     77.30f,    -85.48f),
+      simde_mm_set_ps(   -64.77f,     38.01f,    -66.91f,    -55.06f),
+      simde_mm_set_ps(  2518.34f,   2637.83f,    257.84f,   1162.03f) },
+    { simde_mm_set_ps(   -50.24f,     74.94f,    -70.34f,    -39.75f),
+      simde_mm_set_ps(   -54.57f,    -58.85f,    -37.30f,    -55.77f),
+      simde_mm_set_ps(     2.65f,    -84.85f,    -45.68f,     21.43f),
+      simde_mm_set_ps( -2744.25f,   4495.07f,  -2578.00f,  -2238.29f) },
+    { simde_mm_set_ps(   -23.16f,    -41.90f,     32.98f,     -9.28f),
+      simde_mm_set_ps(    42.94f,    -70.98f,    -80.91f,     99.40f),
+      simde_mm_set_ps(   -86.19f,     25.83f,     28.87f,    -91.81f),
+      simde_mm_set_ps(  1080.68f,  -2999.89f,   2639.54f,   1014.24f) },
+    { simde_mm_set_ps(   -38.44f,    -13.27f,     60.53f,     -5.33f),
+      simde_mm_set_ps(   -94.46f,     76.44f,    -32.60f,    -66.27f),
+      simde_mm_set_ps(    67.53f,    -10.19f,     96.67f,     -6.73f),
+      simde_mm_set_ps( -3698.57f,   1024.55f,   1876.61f,   -346.49f) },
+    { simde_mm_set_ps(   -18.99f,     99.47f,     -9.48f,     55.47f),
+      simde_mm_set_ps(   -56.09f,     34.86f,     42.32f,     88.55f),
+      simde_mm_set_ps(    20.21f,    -12.27f,     18.79f,     85.25f),
+      simde_mm_set_ps( -1085.36f,  -3455.25f,    382.40f,  -4997.12f) },
+    { simde_mm_set_ps(     7.97f,     58.16f,     75.95f,     13.67f),
+      simde_mm_set_ps(    78.86f,      2.61f,    -68.57f,     81.17f),
+      simde_mm_set_ps(   -17.98f,    -82.54f,      9.21f,     74.23f),
+      simde_mm_set_ps(  -610.53f,    -69.26f,   5198.68f,  -1183.82f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fnmsub_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fnmsub_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d c;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    -5.25,     54.87),
+      simde_mm_set_pd(   -89.96,    -24.68),
+      simde_mm_set_pd(   -17.67,    -83.52),
+      simde_mm_set_pd(    -5.25,   1437.71) },
+    { simde_mm_set_pd(   -56.02,    -98.80),
+      simde_mm_set_pd(    78.88,     19.55),
+      simde_mm_set_pd(    26.43,    -96.57),
+      simde_mm_set_pd(   -56.02,   2028.11) },
+    { simde_mm_set_pd(    60.86,    -65.16),
+      simde_mm_set_pd(   -85.81,    -60.94),
+      simde_mm_set_pd(   -57.95,    -90.90),
+      simde_mm_set_pd(    60.86,  -3879.95) },
+    { simde_mm_set_pd(    37.02,    -88.33),
+      simde_mm_set_pd(     8.84,     50.27),
+      simde_mm_set_pd(    80.08,     65.59),
+      simde_mm_set_pd(    37.02,   4374.76) },
+    { simde_mm_set_pd(    20.82,     71.91),
+      simde_mm_set_pd(    91.51,     34.62),
+      simde_mm_set_pd(    55.34,    -22.38),
+      simde_mm_set_pd(    20.82,  -2467.14) },
+    { simde_mm_set_pd(    97.90,    -64.02),
+      simde_mm_set_pd(   -47.91,    -88.22),
+      simde_mm_set_pd(   -78.80,     73.27),
+      simde_mm_set_pd(    97.90,  -5721.11) },
+    { simde_mm_set_pd(     7.55,     49.30),
+      simde_mm_set_pd(    88.79,     36.14),
+      simde_mm_set_pd(    69.20,     -7.02),
+      simde_mm_set_pd(     7.55,  -1774.68) },
+    { simde_mm_set_pd(   -13.93,     84.01),
+      simde_mm_set_pd(    22.98,    -22.58),
+      simde_mm_set_pd(   -26.25,    -44.39),
+      simde_mm_set_pd(   -13.93,   1941.34) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_fnmsub_sd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_fnmsub_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 c;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    69.58f,     22.90f,     -8.56f,     29.65f),
+      simde_mm_set_ps(   -55.48f,     69.70f,    -38.75f,    -11.86f),
+      simde_mm_set_ps(   -41.45f,     -1.63f,     84.15f,     -4.92f),
+      simde_mm_set_ps(    69.58f,     22.90f,     -8.56f,    356.57f) },
+    { simde_mm_set_ps(    29.97f,    -13.20f,     73.53f,    -41.77f),
+      simde_mm_set_ps(   -22.56f,    -38.67f,    -75.48f,    -36.01f),
+      simde_mm_set_ps(    -0.35f,     99.78f,     72.91f,    -40.11f),
+      simde_mm_set_ps(    29.97f,    -13.20f,     73.53f,  -1464.03f) },
+    { simde_mm_set_ps(    -9.51f,    -32.97f,    -28.31f,     29.31f),
+      simde_mm_set_ps(   -50.97f,     -6.50f,     59.12f,    -77.98f),
+      simde_mm_set_ps(    89.43f,     52.53f,    -48.38f,     83.03f),
+      simde_mm_set_ps(    -9.51f,    -32.97f,    -28.31f,   2202.56f) },
+    { simde_mm_set_ps(    42.08f,     41.49f,    -15.66f,     88.58f),
+      simde_mm_set_ps(   -68.68f,     99.64f,    -32.48f,    -73.80f),
+      simde_mm_set_ps(   -46.12f,    -57.67f,      4.16f,    -50.53f),
+      simde_mm_set_ps(    42.08f,     41.49f,    -15.66f,   6587.73f) },
+    { simde_mm_set_ps(    20.37f,      3.48f,    -33.65f,    -65.14f),
+      simde_mm_set_ps(   -24.53f,    -73.13f,     40.54f,     47.40f),
+      simde_mm_set_ps(    71.08f,     38.16f,    -70.76f,    -34.96f),
+      simde_mm_set_ps(    20.37f,      3.48f,    -33.65f,   3122.60f) },
+    { simde_mm_set_ps(    13.94f,    -26.31f,     32.41f,     20.09f),
+      simde_mm_set_ps(    18.70f,    -15.34f,     80.30f,     34.88f),
+      simde_mm_set_ps(   -68.64f,    -59.52f,    -22.73f,     -1.91f),
+      simde_mm_set_ps(    13.94f,    -26.31f,     32.41f,   -698.83f) },
+    { simde_mm_set_ps(    42.39f,     77.53f,    -60.66f,    -67.50f),
+      simde_mm_set_ps(    30.66f,    -68.59f,    -69.92f,     91.70f),
+      simde_mm_set_ps(   -36.40f,      3.15f,      7.30f,    -99.66f),
+      simde_mm_set_ps(    42.39f,     77.53f,    -60.66f,   6289.41f) },
+    { simde_mm_set_ps(    71.89f,    -56.80f,    -26.40f,     64.41f),
+      simde_mm_set_ps(     0.13f,      1.99f,     99.37f,    -14.06f),
+      simde_mm_set_ps(    38.36f,     33.34f,    -18.79f,    -15.94f),
+      simde_mm_set_ps(    71.89f,    -56.80f,    -26.40f,    921.54f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_fnmsub_ss(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fmadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d c;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   -93.43,     50.51,    -38.53,     92.71),
+      simde_mm256_set_pd(    41.09,      7.52,     70.59,    -10.07),
+      simde_mm256_set_pd(   -57.00,     95.80,    -59.23,      1.61),
+      simde_mm256_set_pd( -3896.04,    475.64,  -2779.06,   -931.98) },
+    { simde_mm256_set_pd(   -24.00,    -82.19,     26.64,     94.49),
+      simde_mm256_set_pd(    -9.54,     34.96,    -22.08,    -44.35),
+      simde_mm256_set_pd(    81.14,      5.72,    -40.26,     10.44),
+      simde_mm256_set_pd(   310.10,  -2867.64,   -628.47,  -4180.19) },
+    { simde_mm256_set_pd(   -90.81,    -54.26,    -41.43,     20.74),
+      simde_mm256_set_pd(   -90.74,     13.73,    -80.72,    -54.27),
+      simde_mm256_set_pd(     9.01,     31.25,     35.59,     13.48),
+      simde_mm256_set_pd(  8249.11,   -713.74,   3379.82,  -1112.08) },
+    { simde_mm256_set_pd(    90.23,     25.31,     23.44,    -91.32),
+      simde_mm256_set_pd(    88.15,    -33.54,     37.41,     74.69),
+      simde_mm256_set_pd(    87.82,     82.50,    -71.63,    -89.27),
+      simde_mm256_set_pd(  8041.59,   -766.40,    805.26,  -6909.96) },
+    { simde_mm256_set_pd(    97.33,     -8.65,     77.02,    -20.30),
+      simde_mm256_set_pd(    93.72,     44.74,     -2.02,     31.13),
+      simde_mm256_set_pd(    31.42,    -11.88,     64.46,     23.45),
+      simde_mm256_set_pd(  9153.19,   -398.88,    -91.12,   -608.49) },
+    { simde_mm256_set_pd(    42.07,     -7.26,     27.93,     38.80),
+      simde_mm256_set_pd(   -57.74,     78.69,    -67.20,    -73.95),
+      simde_mm256_set_pd(   -79.74,     33.72,     34.35,    -90.92),
+      simde_mm256_set_pd( -2508.86,   -537.57,  -1842.55,  -2960.18) },
+    { simde_mm256_set_pd(    46.35,     80.20,    -65.65,    -85.66),
+      simde_mm256_set_pd(   -33.54,     85.18,    -48.18,     37.74),
+      simde_mm256_set_pd(   -17.59,    -48.01,     85.80,     47.87),
+      simde_mm256_set_pd( -1572.17,   6783.43,   3248.82,  -3184.94) },
+    { simde_mm256_set_pd(    37.84,     56.67,    -55.37,    -88.70),
+      simde_mm256_set_pd(   -18.04,     69.48,     74.08,    -20.13),
+      simde_mm256_set_pd(    31.75,     87.60,     21.41,    -40.83),
+      simde_mm256_set_pd(  -650.88,   4025.03,  -4080.40,   1744.70) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_fmadd_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fmadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 c;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(    76.03f,     51.26f,     77.64f,    -26.31f,
+                            -78.35f,     79.99f,     36.40f,     34.74f),
+      simde_mm256_set_ps(    -9.87f,     37.35f,     39.99f,    -98.43f,
+                            -67.29f,     94.91f,    -89.22f,     67.74f),
+      simde_mm256_set_ps(    16.66f,    -63.54f,     25.33f,    -87.69f,
+                            -64.60f,     98.82f,     -7.65f,     29.58f),
+      simde_mm256_set_ps(  -733.76f,   1851.02f,   3130.15f,   2502.00f,
+                           5207.57f,   7690.67f,  -3255.26f,   2382.87f) },
+    { simde_mm256_set_ps(    16.68f,     57.84f,    -75.09f,     -5.59f,
+                             -9.55f,    -79.95f,     48.53f,    -66.84f),
+      simde_mm256_set_ps(    21.88f,     68.12f,    -64.61f,    -54.96f,
+                            -39.94f,     51.46f,     14.63f,     12.32f),
+      simde_mm256_set_ps(   -29.01f,     13.87f,     69.06f,     -6.45f,
+                             22.05f,     66.15f,     84.21f,     45.83f),
+      simde_mm256_set_ps(   335.95f,   3953.93f,   4920.62f,    300.78f,
+                            403.48f,  -4048.08f,    794.20f,   -777.64f) },
+    { simde_mm256_set_ps(    12.29f,    -89.80f,     92.48f,     15.81f,
+                             61.20f,    -51.49f,     40.98f,    -63.56f),
+      simde_mm256_set_ps(    31.98f,     -4.65f,     49.55f,    -88.63f,
+                             37.78f,     30.89f,    -76.32f,    -47.99f),
+      simde_mm256_set_ps(    56.59f,      2.66f,     57.98f,     88.01f,
+                            -54.81f,     52.43f,     89.79f,     -6.77f),
+      simde_mm256_set_ps(   449.62f,    420.23f,   4640.36f,  -1313.23f,
+                           2257.33f,  -1538.10f,  -3037.80f,   3043.47f) },
+    { simde_mm256_set_ps(   -98.30f,    -94.38f,      8.70f,     34.90f,
+                            -92.86f,    -78.99f,     75.45f,    -44.26f),
+      simde_mm256_set_ps(    40.84f,    -62.19f,      5.47f,    -90.63f,
+                             86.75f,     99.34f,    -77.40f,    -81.50f),
+      simde_mm256_set_ps(    19.90f,      7.26f,      0.53f,     28.27f,
+                            -55.24f,     88.29f,     23.66f,    -22.52f),
+      simde_mm256_set_ps( -3994.67f,   5876.75f,     48.12f,  -3134.72f,
+                          -8110.85f,  -7758.58f,  -5816.17f,   3584.67f) },
+    { simde_mm256_set_ps(    81.56f,    -67.81f,    -68.31f,    -62.53f,
+                            -58.03f,    -51.98f,    -81.30f,     62.01f),
+      simde_mm256_set_ps(    47.37f,    -52.87f,    -36.87f,    -45.64f,
+                            -85.96f,     62.84f,    -44.32f,     67.74f),
+      simde_mm256_set_ps(    85.18f,    -98.39f,    -23.86f,     73.54f,
+                              2.58f,      8.06f,     33.96f,     31.07f),
+      simde_mm256_set_ps(  3948.68f,   3486.72f,   2494.73f,   2927.41f,
+                           4990.84f,  -3258.36f,   3637.18f,   4231.63f) },
+    { simde_mm256_set_ps(    85.06f,    -69.95f,     52.87f,      7.15f,
+                             73.17f,     54.04f,    -43.15f,    -24.20f),
+      simde_mm256_set_ps(    27.15f,     17.74f,    -56.11f,      1.55f,
+                             -0.21f,    -24.15f,    -84.42f,    -11.08f),
+      simde_mm256_set_ps(    92.28f,     20.87f,    -22.17f,    -87.20f,
+                            -24.67f,    -31.81f,    -62.02f,     15.89f),
+      simde_mm256_set_ps(  2401.66f,  -1220.04f,  -2988.71f,    -76.12f,
+                            -40.04f,  -1336.88f,   3580.70f,    284.03f) },
+    { simde_mm256_set_ps(     1.67f,     95.31f,    -35.14f,    -71.04f,
+                             63.09f,     27.08f,     42.45f,     42.60f),
+      simde_mm256_set_ps(    82.72f,    -18.35f,    -58.40f,    -51.02f,
+                             44.16f,    -10.22f,     69.24f,    -10.65f),
+      simde_mm256_set_ps(    68.17f,    -59.13f,     97.93f,     59.92f,
+                            -57.92f,    -82.02f,     65.76f,    -79.21f),
+      simde_mm256_set_ps(   206.31f,  -1808.07f,   2150.11f,   3684.38f,
+                           2728.13f,   -358.78f,   3005.00f,   -532.90f) },
+    { simde_mm256_set_ps(    87.56f,    -93.88f,    -68.84f,    -84.07f,
+                             85.34f,    -96.53f,     77.45f,    -59.51f),
+      simde_mm256_set_ps(    42.64f,     24.88f,     20.17f,     79.76f,
+                            -30.72f,    -13.71f,     72.02f,     20.40f),
+      simde_mm256_set_ps(   -57.93f,    -28.56f,     45.07f,    -24.44f,
+                            -65.93f,     90.76f,    -41.30f,     87.31f),
+      simde_mm256_set_ps(  3675.63f,  -2364.29f,  -1343.43f,  -6729.86f,
+                          -2687.57f,   1414.19f,   5536.65f,  -1126.69f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_fmadd_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fmaddsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d c;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(     3.80,    -57.01,    -40.62,     19.44),
+      simde_mm256_set_pd(    68.08,    -64.16,    -45.32,     62.08),
+      simde_mm256_set_pd(    15.77,    -71.84,     84.89,     -6.43),
+      simde_mm256_set_pd(   274.47,   3729.60,   1925.79,   1213.27) },
+    { simde_mm256_set_pd(   -53.35,    -47.73,     10.09,     76.43),
+      simde_mm256_set_pd(   -23.96,     74.73,    -51.67,    -39.50),
+      simde_mm256_set_pd(   -79.18,     -8.72,    -76.47,    -18.92),
+      simde_mm256_set_pd(  1199.09,  -3558.14,   -597.82,  -3000.07) },
+    { simde_mm256_set_pd(    89.95,     63.01,     68.60,    -79.87),
+      simde_mm256_set_pd(   -89.90,    -17.13,    -59.68,     67.00),
+      simde_mm256_set_pd(   -96.60,    -91.93,    -68.87,    -80.83),
+      simde_mm256_set_pd( -8183.11,   -987.43,  -4162.92,  -5270.46) },
+    { simde_mm256_set_pd(   -17.15,     -2.89,     38.86,    -76.40),
+      simde_mm256_set_pd(    -4.64,    -66.97,     52.63,     21.83),
+      simde_mm256_set_pd(    23.66,     68.11,    -55.04,    -63.02),
+      simde_mm256_set_pd(   103.24,    125.43,   1990.16,  -1604.79) },
+    { simde_mm256_set_pd(   -86.14,      4.97,    -73.05,    -55.79),
+      simde_mm256_set_pd(   -92.64,    -82.03,    -71.37,     49.02),
+      simde_mm256_set_pd(    -3.67,     88.97,     64.50,     89.71),
+      simde_mm256_set_pd(  7976.34,   -496.66,   5278.08,  -2824.54) },
+    { simde_mm256_set_pd(    68.75,    -82.13,     32.35,    -88.01),
+      simde_mm256_set_pd(   -49.33,    -82.58,    -80.80,     90.11),
+      simde_mm256_set_pd(    22.03,      2.75,     78.00,     82.08),
+      simde_mm256_set_pd( -3369.41,   6779.55,  -2535.88,  -8012.66) },
+    { simde_mm256_set_pd(    23.32,    -75.52,     93.20,    -64.32),
+      simde_mm256_set_pd(    45.26,     19.59,    -91.83,    -91.79),
+      simde_mm256_set_pd(    36.59,    -19.03,     29.67,      2.96),
+      simde_mm256_set_pd(  1092.05,  -1460.41,  -8528.89,   5900.97) },
+    { simde_mm256_set_pd(    91.68,    -21.26,     97.58,     14.18),
+      simde_mm256_set_pd(    43.59,     41.95,     70.75,    -71.18),
+      simde_mm256_set_pd(    28.47,    -98.42,     43.27,     72.94),
+      simde_mm256_set_pd(  4024.80,   -793.44,   6947.06,  -1082.27) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_fmaddsub_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fmaddsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 c;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   -30.71f,     84.63f,      2.65f,     24.00f,
+                            -46.67f,    -68.54f,    -31.30f,     87.24f),
+      simde_mm256_set_ps(   -98.20f,     58.88f,    -30.55f,     36.63f,
+                             68.58f,     84.69f,    -22.54f,    -77.76f),
+      simde_mm256_set_ps(    95.94f,    -73.44f,     60.06f,    -15.37f,
+                            -71.28f,    -84.98f,      3.92f,    -63.35f),
+      simde_mm256_set_ps(  3111.66f,   5056.45f,    -20.90f,    894.49f,
+                          -3271.91f,  -5719.67f,    709.42f,  -6720.43f) },
+    { simde_mm256_set_ps(   -37.14f,     67.55f,    -10.69f,     34.42f,
+                              1.39f,    -26.56f,     85.20f,     91.95f),
+      simde_mm256_set_ps(   -98.66f,     -2.40f,    -97.05f,    -12.37f,
+                             62.68f,     84.03f,      5.28f,    -19.54f),
+      simde_mm256_set_ps(    80.52f,    -15.04f,    -68.05f,    -91.87f,
+                            -17.36f,    -34.01f,      2.36f,     58.08f),
+      simde_mm256_set_ps(  3744.75f,   -147.08f,    969.41f,   -333.91f,
+                             69.77f,  -2197.83f,    452.22f,  -1854.78f) },
+    { simde_mm256_set_ps(   -64.98f,    -37.21f,    -29.71f,     82.70f,
+                             53.28f,      9.83f,    -92.81f,     32.07f),
+      simde_mm256_set_ps(    -5.45f,    -25.06f,     11.26f,     71.78f,
+                            -62.10f,    -86.84f,     38.21f,     21.20f),
+      simde_mm256_set_ps(    73.86f,     85.35f,     29.57f,    -95.09f,
+                              0.44f,     79.37f,     71.61f,     86.16f),
+      simde_mm256_set_ps(   428.00f,    847.13f,   -304.96f,   6031.30f,
+                          -3308.25f,   -933.01f,  -3474.66f,    593.72f) },
+    { simde_mm256_set_ps(    27.37f,     22.01f,     81.60f,     48.04f,
+                              9.67f,    -74.32f,     56.04f,    -72.66f),
+      simde_mm256_set_ps(    26.56f,    -94.72f,     -6.59f,    -45.14f,
+                             11.56f,    -40.99f,     70.59f,     10.61f),
+      simde_mm256_set_ps(    52.29f,     46.31f,    -23.65f,      1.56f,
+                              0.18f,    -15.56f,    -10.76f,    -82.58f),
+      simde_mm256_set_ps(   779.24f,  -2131.10f,   -561.39f,  -2170.09f,
+                            111.97f,   3061.94f,   3945.10f,   -688.34f) },
+    { simde_mm256_set_ps(    16.38f,    -86.02f,      9.96f,    -62.12f,
+                            -17.78f,     42.94f,    -96.21f,    -73.44f),
+      simde_mm256_set_ps(    36.97f,     -1.93f,    -90.21f,    -46.94f,
+                             33.58f,    -42.99f,     36.18f,    -46.69f),
+      simde_mm256_set_ps(    79.32f,    -17.55f,     36.06f,     64.30f,
+                            -96.45f,    -70.46f,     44.06f,    -21.67f),
+      simde_mm256_set_ps(   684.89f,    183.57f,   -862.43f,   2851.61f,
+                           -693.50f,  -1775.53f,  -3436.82f,   3450.58f) },
+    { simde_mm256_set_ps(    87.61f,     10.84f,    -67.16f,    -23.55f,
+                             21.59f,     90.53f,     78.09f,    -74.74f),
+      simde_mm256_set_ps(   -37.22f,     -0.65f,    -29.27f,     23.34f,
+                            -74.56f,    -57.35f,     20.92f,    -94.12f),
+      simde_mm256_set_ps(    80.63f,    -14.63f,     20.46f,     90.90f,
+                              0.69f,    -37.39f,    -81.81f,     48.74f),
+      simde_mm256_set_ps( -3180.21f,      7.58f,   1986.23f,   -640.56f,
+                          -1609.06f,  -5154.51f,   1551.83f,   6985.79f) },
+    { simde_mm256_set_ps(    81.92f,      7.06f,     56.42f,     75.50f,
+                            -28.93f,      2.33f,     70.99f,     49.23f),
+      simde_mm256_set_ps(    -4.63f,     99.60f,     87.12f,     34.24f,
+                            -48.01f,    -77.85f,      0.99f,    -29.68f),
+      simde_mm256_set_ps(   -11.95f,     40.68f,    -29.98f,    -13.07f,
+                             61.45f,    -74.45f,     64.82f,     30.80f),
+      simde_mm256_set_ps(  -391.24f,    662.50f,   4885.33f,   2598.19f,
+                           1450.38f,   -106.94f,    135.10f,  -1491.95f) },
+    { simde_mm256_set_ps(    66.90f,     48.25f,    -38.25f,    -77.19f,
+                              3.20f,     81.84f,     41.97f,    -89.51f),
+      simde_mm256_set_ps(   -52.67f,    -61.10f,     52.31f,    -56.53f,
+                             58.05f,     58.94f,    -47.90f,     94.91f),
+      simde_mm256_set_ps(   -49.85f,    -57.93f,    -39.03f,    -44.93f,
+                             68.67f,     69.14f,     66.97f,    -94.87f),
+      simde_mm256_set_ps( -3573.47f,  -2890.15f,  -2039.89f,   4408.48f,
+                            254.43f,   4754.51f,  -1943.39f,  -8400.52f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_fmaddsub_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fmsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d c;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(    32.35,     25.34,    -41.87,    -14.58),
+      simde_mm256_set_pd(   -20.88,     10.31,     40.42,     -9.61),
+      simde_mm256_set_pd(    43.09,      0.63,     11.91,    -57.07),
+      simde_mm256_set_pd(  -718.56,    260.63,  -1704.30,    197.18) },
+    { simde_mm256_set_pd(   -52.27,     23.93,    -87.60,     79.51),
+      simde_mm256_set_pd(   -37.40,    -22.55,    -55.21,     52.02),
+      simde_mm256_set_pd(    63.29,    -35.29,     -1.83,     -0.63),
+      simde_mm256_set_pd(  1891.61,   -504.33,   4838.23,   4136.74) },
+    { simde_mm256_set_pd(    89.46,    -85.50,    -31.52,    -48.16),
+      simde_mm256_set_pd(    25.90,    -95.82,     19.90,    -77.95),
+      simde_mm256_set_pd(    92.97,     10.58,    -87.33,     48.55),
+      simde_mm256_set_pd(  2224.04,   8182.03,   -539.92,   3705.52) },
+    { simde_mm256_set_pd(   -34.03,      1.48,     14.85,     86.27),
+      simde_mm256_set_pd(    56.05,     95.94,     91.52,    -21.24),
+      simde_mm256_set_pd(   -82.32,    -19.17,      0.96,    -49.02),
+      simde_mm256_set_pd( -1825.06,    161.16,   1358.11,  -1783.35) },
+    { simde_mm256_set_pd(    84.72,     -5.36,    -49.75,    -50.72),
+      simde_mm256_set_pd(    35.21,     18.08,     72.99,    -74.21),
+      simde_mm256_set_pd(   -14.10,     -0.51,      1.00,    -24.60),
+      simde_mm256_set_pd(  2997.09,    -96.40,  -3632.25,   3788.53) },
+    { simde_mm256_set_pd(   -42.08,    -39.98,    -10.72,    -70.08),
+      simde_mm256_set_pd(   -91.23,     85.35,    -56.29,    -81.21),
+      simde_mm256_set_pd(   -89.02,    -82.27,     28.81,     20.96),
+      simde_mm256_set_pd(  3927.98,  -3330.02,    574.62,   5670.24) },
+    { simde_mm256_set_pd(     3.10,    -63.12,    -83.42,     21.25),
+      simde_mm256_set_pd(    59.51,     85.42,     58.68,    -44.07),
+      simde_mm256_set_pd(    41.96,     69.39,     -9.20,     54.29),
+      simde_mm256_set_pd(   142.52,  -5461.10,  -4885.89,   -990.78) },
+    { simde_mm256_set_pd(   -11.07,     21.74,     27.65,     -7.42),
+      simde_mm256_set_pd(   -35.32,     23.74,    -48.02,     85.12),
+      simde_mm256_set_pd(    -8.39,     77.89,    -73.05,     74.86),
+      simde_mm256_set_pd(   399.38,    438.22,  -1254.70,   -706.45) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_fmsub_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fmsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 c;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(    85.25f,     97.03f,    -13.96f,     53.77f,
+                            -89.16f,     19.77f,    -82.68f,     -6.90f),
+      simde_mm256_set_ps(    80.77f,    -57.68f,     19.29f,     85.05f,
+                              8.48f,    -27.92f,     19.61f,    -70.78f),
+      simde_mm256_set_ps(     3.78f,    -86.10f,    -34.27f,     77.66f,
+                             99.69f,     39.33f,    -71.10f,     79.45f),
+      simde_mm256_set_ps(  6881.86f,  -5510.59f,   -235.02f,   4495.48f,
+                           -855.77f,   -591.31f,  -1550.25f,    408.93f) },
+    { simde_mm256_set_ps(    27.74f,      0.63f,     83.24f,    -42.90f,
+                            -60.94f,      4.94f,     61.13f,     17.07f),
+      simde_mm256_set_ps(   -74.37f,     67.90f,    -88.48f,    -36.38f,
+                            -88.99f,     44.66f,    -57.90f,     40.69f),
+      simde_mm256_set_ps(   -48.07f,    -74.10f,    -74.36f,      7.99f,
+                             -8.88f,    -41.94f,     63.49f,    -44.47f),
+      simde_mm256_set_ps( -2014.95f,    116.88f,  -7290.72f,   1552.71f,
+                           5431.93f,    262.56f,  -3602.92f,    739.05f) },
+    { simde_mm256_set_ps(    78.95f,      9.90f,     15.61f,    -83.39f,
+                             80.53f,    -19.08f,    -98.14f,     84.50f),
+      simde_mm256_set_ps(     9.19f,    -28.80f,     88.54f,     98.78f,
+                             -7.42f,     97.49f,    -90.70f,     83.75f),
+      simde_mm256_set_ps(     6.09f,     89.32f,    -25.05f,     -9.33f,
+                            -98.97f,     68.28f,     93.48f,    -15.60f),
+      simde_mm256_set_ps(   719.46f,   -374.44f,   1407.16f,  -8227.93f,
+                           -498.56f,  -1928.39f,   8807.82f,   7092.48f) },
+    { simde_mm256_set_ps(    26.39f,     46.35f,     75.97f,     49.84f,
+                             31.12f,     94.93f,     33.29f,     49.94f),
+      simde_mm256_set_ps(   -43.32f,    -93.34f,     99.47f,     -2.61f,
+                             73.62f,     53.33f,      2.75f,    -21.84f),
+      simde_mm256_set_ps(    47.68f,     -1.79f,    -32.23f,     55.69f,
+                             -5.25f,    -84.24f,     -1.09f,     85.51f),
+      simde_mm256_set_ps( -1190.89f,  -4324.52f,   7588.97f,   -185.77f,
+                           2296.30f,   5146.86f,     92.64f,  -1176.20f) },
+    { simde_mm256_set_ps(   -19.13f,     58.85f,    -76.56f,     51.38f,
+                              5.11f,     36.28f,     65.13f,     83.82f),
+      simde_mm256_set_ps(   -87.98f,    -49.58f,    -35.23f,     27.04f,
+                             34.95f,     62.98f,    -91.01f,    -79.32f),
+      simde_mm256_set_ps(    41.83f,    -75.18f,    -97.80f,    -47.73f,
+                             73.34f,    -13.29f,    -10.32f,     -7.98f),
+      simde_mm256_set_ps(  1641.23f,  -2842.60f,   2795.01f,   1437.05f,
+                            105.25f,   2298.20f,  -5917.16f,  -6640.62f) },
+    { simde_mm256_set_ps(    14.59f,     15.57f,     72.70f,    -33.51f,
+                            -24.65f,     -2.71f,     62.92f,    -22.59f),
+      simde_mm256_set_ps(   -94.29f,     68.91f,    -22.05f,     36.61f,
+                            -99.37f,    -74.77f,      0.46f,     48.56f),
+      simde_mm256_set_ps(    56.04f,    -98.83f,    -83.93f,     15.45f,
+                            -67.27f,     -4.16f,     71.46f,    -74.07f),
+      simde_mm256_set_ps( -1431.73f,   1171.76f,  -1519.10f,  -1242.25f,
+                           2516.74f,    206.79f,    -42.52f,  -1022.90f) },
+    { simde_mm256_set_ps(    35.72f,     34.84f,     94.30f,    -75.44f,
+                            -61.33f,    -99.78f,     26.80f,     61.21f),
+      simde_mm256_set_ps(   -56.16f,     85.43f,    -42.92f,    -27.23f,
+                            -31.68f,    -47.92f,    -79.30f,     -1.28f),
+      simde_mm256_set_ps(   -38.47f,     97.11f,    -34.55f,    -59.43f,
+                            -41.32f,     62.05f,     69.93f,    -84.02f),
+      simde_mm256_set_ps( -1967.57f,   2879.27f,  -4012.81f,   2113.66f,
+                           1984.25f,   4719.41f,  -2195.17f,      5.67f) },
+    { simde_mm256_set_ps(    96.76f,     93.30f,    -33.63f,     42.58f,
+                             77.90f,    -27.74f,     87.77f,     34.59f),
+      simde_mm256_set_ps(    57.11f,     46.46f,    -87.03f,    -38.81f,
+                            -96.09f,     44.94f,     11.53f,     -9.62f),
+      simde_mm256_set_ps(    61.97f,     69.82f,     87.27f,     73.90f,
+                             44.35f,    -39.27f,     76.54f,     64.44f),
+      simde_mm256_set_ps(  5463.99f,   4264.90f,   2839.55f,  -1726.43f,
+                          -7529.76f,  -1207.37f,    935.45f,   -397.20f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_fmsub_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fmsubadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d c;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(    77.62,    -25.01,     52.53,    -62.98),
+      simde_mm256_set_pd(   -57.45,     -6.31,     61.04,     75.02),
+      simde_mm256_set_pd(    46.29,     75.32,     27.36,    -32.49),
+      simde_mm256_set_pd( -4505.56,    233.13,   3179.07,  -4757.25) },
+    { simde_mm256_set_pd(    14.00,     68.98,    -91.19,    -48.18),
+      simde_mm256_set_pd(   -57.22,    -40.82,    -72.05,    -44.01),
+      simde_mm256_set_pd(   -41.43,    -54.60,    -86.58,     43.91),
+      simde_mm256_set_pd(  -759.65,  -2870.36,   6656.82,   2164.31) },
+    { simde_mm256_set_pd(    61.05,    -41.05,    -30.74,    -47.56),
+      simde_mm256_set_pd(    52.69,     81.07,    -29.87,     60.59),
+      simde_mm256_set_pd(    67.63,     27.87,     52.75,     34.67),
+      simde_mm256_set_pd(  3149.09,  -3300.05,    865.45,  -2846.99) },
+    { simde_mm256_set_pd(   -20.72,    -59.41,     95.43,     92.18),
+      simde_mm256_set_pd(    92.12,     95.33,    -64.37,     91.38),
+      simde_mm256_set_pd(   -47.44,    -66.54,     80.94,    -20.92),
+      simde_mm256_set_pd( -1861.29,  -5730.10,  -6223.77,   8402.49) },
+    { simde_mm256_set_pd(   -82.05,     48.31,     24.91,     -8.51),
+      simde_mm256_set_pd(   -11.21,     -8.58,     46.54,    -46.03),
+      simde_mm256_set_pd(   -17.23,     36.68,     77.89,     50.85),
+      simde_mm256_set_pd(   937.01,   -377.82,   1081.42,    442.57) },
+    { simde_mm256_set_pd(   -42.53,     87.25,     94.65,    -81.73),
+      simde_mm256_set_pd(    44.94,    -87.69,     32.37,    -27.40),
+      simde_mm256_set_pd(   -74.49,     87.61,     40.25,     -7.61),
+      simde_mm256_set_pd( -1836.81,  -7563.34,   3023.57,   2231.79) },
+    { simde_mm256_set_pd(   -29.53,     32.40,     28.89,    -68.51),
+      simde_mm256_set_pd(    37.84,     71.98,    -99.38,     10.86),
+      simde_mm256_set_pd(    46.28,    -73.72,    -52.45,     62.25),
+      simde_mm256_set_pd( -1163.70,   2258.43,  -2818.64,   -681.77) },
+    { simde_mm256_set_pd(    33.08,    -95.74,    -41.98,     55.12),
+      simde_mm256_set_pd(    40.86,    -66.14,     95.02,    -63.47),
+      simde_mm256_set_pd(   -25.41,    -50.11,     57.94,    -28.44),
+      simde_mm256_set_pd(  1377.06,   6282.13,  -4046.88,  -3526.91) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_fmsubadd_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fmsubadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 c;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   -44.19f,    -77.26f,     99.12f,    -35.20f,
+                            -64.28f,    -11.18f,     28.85f,     73.93f),
+      simde_mm256_set_ps(    -8.68f,      7.18f,     57.35f,     47.66f,
+                             22.25f,      5.45f,     -0.77f,    -69.28f),
+      simde_mm256_set_ps(    26.91f,     64.69f,    -16.58f,    -32.83f,
+                             36.13f,    -78.79f,    -27.00f,     12.06f),
+      simde_mm256_set_ps(   356.66f,   -490.04f,   5701.11f,  -1710.46f,
+                          -1466.36f,   -139.72f,      4.79f,  -5109.81f) },
+    { simde_mm256_set_ps(    95.99f,     45.79f,    -21.68f,    -85.53f,
+                             36.57f,    -18.38f,    -55.52f,     85.58f),
+      simde_mm256_set_ps(   -88.13f,    -93.30f,    -97.29f,     94.12f,
+                            -43.63f,     31.47f,    -19.82f,    -41.24f),
+      simde_mm256_set_ps(    -0.45f,    -32.04f,    -50.13f,     24.63f,
+                             11.84f,    -66.48f,     87.53f,     84.63f),
+      simde_mm256_set_ps( -8459.15f,  -4304.25f,   2159.38f,  -8025.45f,
+                          -1607.39f,   -644.90f,   1012.88f,  -3444.69f) },
+    { simde_mm256_set_ps(    75.18f,    -45.48f,    -49.79f,    -97.97f,
+                             48.98f,    -73.47f,     51.31f,     89.10f),
+      simde_mm256_set_ps(   -26.13f,     44.24f,     39.09f,     96.74f,
+                            -28.82f,    -29.72f,      3.14f,    -76.82f),
+      simde_mm256_set_ps(     6.65f,     31.61f,    -33.35f,      3.53f,
+                             82.55f,     19.18f,     84.36f,     90.79f),
+      simde_mm256_set_ps( -1971.10f,  -1980.43f,  -1912.94f,  -9474.09f,
+                          -1494.15f,   2202.71f,     76.75f,  -6753.87f) },
+    { simde_mm256_set_ps(    83.66f,     33.86f,    -68.67f,     58.94f,
+                             67.11f,    -67.57f,    -70.68f,    -15.55f),
+      simde_mm256_set_ps(    23.81f,    -91.46f,    -87.73f,      0.50f,
+                             81.08f,    -91.29f,     92.96f,     40.56f),
+      simde_mm256_set_ps(   -58.50f,    -31.97f,    -75.74f,    -83.14f,
+                             58.11f,    -10.13f,     75.51f,    -43.91f),
+      simde_mm256_set_ps(  2050.44f,  -3128.81f,   6100.16f,    -53.67f,
+                           5383.17f,   6158.34f,  -6645.92f,   -674.62f) },
+    { simde_mm256_set_ps(    16.07f,     49.69f,     50.28f,    -29.66f,
+                              2.79f,     32.57f,     -7.41f,     43.00f),
+      simde_mm256_set_ps(    61.13f,    -57.97f,     32.72f,    -72.36f,
+                             70.54f,     27.97f,     70.88f,    -90.58f),
+      simde_mm256_set_ps(   -50.74f,    -58.59f,     -8.87f,     46.59f,
+                            -23.75f,     64.39f,    -66.82f,    -35.89f),
+      simde_mm256_set_ps(  1033.10f,  -2939.12f,   1654.03f,   2192.79f,
+                            220.56f,    975.37f,   -458.40f,  -3930.83f) },
+    { simde_mm256_set_ps(   -62.43f,     52.98f,    -90.87f,     27.25f,
+                             50.86f,    -74.06f,    -65.89f,     63.60f),
+      simde_mm256_set_ps(    29.44f,    -83.31f,      7.46f,    -75.82f,
+                            -70.18f,    -28.33f,     71.51f,     17.03f),
+      simde_mm256_set_ps(     1.97f,    -32.57f,      0.42f,    -12.95f,
+                             70.47f,    -93.60f,     58.42f,    -34.59f),
+      simde_mm256_set_ps( -1839.91f,  -4446.33f,   -678.31f,  -2079.04f,
+                          -3639.82f,   2004.52f,  -4770.21f,   1048.52f) },
+    { simde_mm256_set_ps(    96.55f,     94.20f,     66.50f,    -80.63f,
+                             61.09f,     52.19f,    -89.56f,    -95.12f),
+      simde_mm256_set_ps(   -94.01f,     13.43f,     83.44f,     12.71f,
+                            -57.91f,    -34.90f,     29.19f,    -47.83f),
+      simde_mm256_set_ps(   -36.71f,     37.63f,     83.68f,    -26.76f,
+                             -5.84f,     75.22f,      4.29f,    -13.36f),
+      simde_mm256_set_ps( -9039.96f,   1302.74f,   5465.08f,  -1051.57f,
+                          -3531.88f,  -1746.21f,  -2618.55f,   4536.23f) },
+    { simde_mm256_set_ps(    72.66f,    -66.68f,    -48.04f,    -32.51f,
+                            -83.23f,    -85.75f,     19.17f,     91.03f),
+      simde_mm256_set_ps(   -73.94f,     20.26f,     42.66f,    -99.57f,
+                            -92.40f,    -92.64f,     34.07f,    -64.42f),
+      simde_mm256_set_ps(    35.40f,      9.70f,     62.40f,    -83.15f,
+                             18.72f,     36.09f,     95.82f,     90.75f),
+      simde_mm256_set_ps( -5407.88f,  -1341.24f,  -2111.79f,   3153.87f,
+                           7671.73f,   7979.97f,    557.30f,  -5773.40f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_fmsubadd_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fnmadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d c;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   -74.01,    -48.54,     81.83,    -23.28),
+      simde_mm256_set_pd(    93.32,    -95.12,     51.96,     -8.24),
+      simde_mm256_set_pd(   -27.48,    -26.68,     42.27,    -70.19),
+      simde_mm256_set_pd(  6879.13,  -4643.80,  -4209.62,   -262.02) },
+    { simde_mm256_set_pd(    40.39,    -21.92,     80.74,     -2.44),
+      simde_mm256_set_pd(     8.45,     69.98,    -62.09,     18.28),
+      simde_mm256_set_pd(   -69.68,     96.57,    -49.58,    -78.43),
+      simde_mm256_set_pd(  -410.98,   1630.53,   4963.57,    -33.83) },
+    { simde_mm256_set_pd(   -51.36,     32.55,     67.88,     56.45),
+      simde_mm256_set_pd(    14.71,    -34.80,    -97.44,    -59.34),
+      simde_mm256_set_pd(   -21.42,     64.30,     41.02,    -51.12),
+      simde_mm256_set_pd(   734.09,   1197.04,   6655.25,   3298.62) },
+    { simde_mm256_set_pd(    56.37,     -3.03,    -73.58,    -70.00),
+      simde_mm256_set_pd(   -57.74,     18.01,     95.32,     89.22),
+      simde_mm256_set_pd(    89.27,    -98.06,    -15.19,     83.66),
+      simde_mm256_set_pd(  3344.07,    -43.49,   6998.46,   6329.06) },
+    { simde_mm256_set_pd(   -74.84,    -15.07,     12.01,     50.86),
+      simde_mm256_set_pd(    41.60,     52.60,     14.46,     46.29),
+      simde_mm256_set_pd(   -70.47,    -74.39,     10.43,    -22.93),
+      simde_mm256_set_pd(  3042.87,    718.29,   -163.23,  -2377.24) },
+    { simde_mm256_set_pd(    37.72,     16.98,    -80.18,      2.77),
+      simde_mm256_set_pd(   -44.15,     87.04,     87.43,    -77.76),
+      simde_mm256_set_pd(    59.15,    -29.59,      8.09,     15.94),
+      simde_mm256_set_pd(  1724.49,  -1507.53,   7018.23,    231.34) },
+    { simde_mm256_set_pd(     9.88,     23.57,    -34.55,    -44.04),
+      simde_mm256_set_pd(    77.06,    -51.74,    -34.09,     17.15),
+      simde_mm256_set_pd(   -65.89,     77.25,    -26.66,     21.98),
+      simde_mm256_set_pd(  -827.24,   1296.76,  -1204.47,    777.27) },
+    { simde_mm256_set_pd(    49.11,     56.55,    -90.93,    -92.62),
+      simde_mm256_set_pd(     8.95,     31.35,    -66.72,    -46.29),
+      simde_mm256_set_pd(    -6.23,     -6.64,      9.08,    -90.92),
+      simde_mm256_set_pd(  -445.76,  -1779.48,  -6057.77,  -4378.30) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_fnmadd_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fnmadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 c;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   -42.39f,    -66.63f,     37.36f,    -93.60f,
+                            -71.13f,     66.68f,    -95.59f,     47.93f),
+      simde_mm256_set_ps(   -88.69f,     49.03f,     64.88f,     38.98f,
+                            -14.03f,      7.68f,    -88.39f,    -69.29f),
+      simde_mm256_set_ps(    15.75f,    -87.69f,    -89.21f,     16.19f,
+                             98.05f,    -47.22f,     36.33f,    -45.46f),
+      simde_mm256_set_ps( -3743.82f,   3179.18f,  -2513.13f,   3664.72f,
+                           -899.90f,   -559.32f,  -8412.87f,   3275.61f) },
+    { simde_mm256_set_ps(   -86.12f,    -80.12f,    -21.54f,     82.27f,
+                            -64.90f,    -91.43f,     38.16f,    -58.66f),
+      simde_mm256_set_ps(    41.70f,    -89.13f,     24.52f,     43.24f,
+                             74.38f,     25.72f,     89.96f,     25.32f),
+      simde_mm256_set_ps(   -50.30f,     80.02f,     46.48f,     85.55f,
+                            -39.27f,    -21.21f,     86.56f,     13.74f),
+      simde_mm256_set_ps(  3540.90f,  -7061.08f,    574.64f,  -3471.80f,
+                           4787.99f,   2330.37f,  -3346.31f,   1499.01f) },
+    { simde_mm256_set_ps(    74.21f,    -53.87f,    -87.32f,    -19.12f,
+                            -60.28f,    -62.28f,     63.87f,    -11.19f),
+      simde_mm256_set_ps(    60.82f,    -89.76f,    -18.50f,    -36.23f,
+                             -6.39f,     80.13f,    -87.74f,    -40.08f),
+      simde_mm256_set_ps(    49.84f,     92.14f,     62.82f,     12.09f,
+                             48.94f,    -22.32f,    -58.40f,      0.89f),
+      simde_mm256_set_ps( -4463.61f,  -4743.23f,  -1552.60f,   -680.63f,
+                           -336.25f,   4968.18f,   5545.55f,   -447.61f) },
+    { simde_mm256_set_ps(     5.95f,     83.46f,     43.68f,    -87.99f,
+                            -18.38f,     57.81f,    -34.92f,     16.97f),
+      simde_mm256_set_ps(    99.64f,     84.80f,     76.17f,     85.05f,
+                            -99.74f,      2.31f,     89.44f,     47.13f),
+      simde_mm256_set_ps(   -96.46f,     30.67f,    -80.81f,     90.39f,
+                            -91.68f,    -22.23f,    -80.00f,     20.25f),
+      simde_mm256_set_ps(  -689.32f,  -7046.74f,  -3407.92f,   7573.94f,
+                          -1924.90f,   -155.77f,   3043.24f,   -779.55f) },
+    { simde_mm256_set_ps(    15.39f,     49.17f,     25.64f,    -89.45f,
+                             70.58f,     -7.53f,     43.32f,    -92.65f),
+      simde_mm256_set_ps(    56.58f,      2.26f,     63.43f,    -28.29f,
+                             69.27f,     43.85f,      3.77f,    -28.88f),
+      simde_mm256_set_ps(    50.49f,     43.73f,      0.82f,    -64.15f,
+                             88.53f,      5.29f,     43.71f,     81.94f),
+      simde_mm256_set_ps(  -820.28f,    -67.39f,  -1625.53f,  -2594.69f,
+                          -4800.55f,    335.48f,   -119.61f,  -2593.79f) },
+    { simde_mm256_set_ps(    68.56f,     61.99f,     95.61f,    -91.58f,
+                             48.66f,    -90.56f,    -95.67f,     26.06f),
+      simde_mm256_set_ps(    76.28f,     15.11f,     12.96f,     84.23f,
+                            -40.39f,     25.07f,    -89.61f,     58.76f),
+      simde_mm256_set_ps(   -38.86f,     65.50f,     34.41f,     76.47f,
+                             98.08f,    -60.19f,     34.86f,     -2.44f),
+      simde_mm256_set_ps( -5268.62f,   -871.17f,  -1204.70f,   7790.25f,
+                           2063.46f,   2210.15f,  -8538.13f,  -1533.73f) },
+    { simde_mm256_set_ps(   -42.53f,    -34.79f,    -22.39f,     46.35f,
+                             -0.97f,     63.45f,     71.96f,     90.03f),
+      simde_mm256_set_ps(   -70.97f,     64.65f,     36.81f,     84.23f,
+                             16.17f,    -93.36f,    -19.87f,    -20.42f),
+      simde_mm256_set_ps(    65.27f,    -32.17f,     80.86f,    -32.54f,
+                             53.19f,     17.76f,    -42.74f,     -7.03f),
+      simde_mm256_set_ps( -2953.08f,   2217.00f,    905.04f,  -3936.60f,
+                             68.87f,   5941.45f,   1387.11f,   1831.38f) },
+    { simde_mm256_set_ps(    44.92f,      3.48f,      6.57f,    -50.92f,
+                             24.81f,     78.36f,     86.06f,    -13.87f),
+      simde_mm256_set_ps(     2.22f,    -33.55f,     -6.46f,    -67.34f,
+                             81.98f,    -44.74f,     32.44f,     78.22f),
+      simde_mm256_set_ps(    89.16f,     14.94f,     32.02f,      4.59f,
+                             27.56f,     29.51f,     -3.19f,     -5.96f),
+      simde_mm256_set_ps(   -10.56f,    131.69f,     74.46f,  -3424.36f,
+                          -2006.36f,   3535.34f,  -2794.98f,   1078.95f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_fnmadd_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fnmsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256d a;
+    simde__m256d b;
+    simde__m256d c;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(   -72.04,    -15.72,    -99.74,    -42.75),
+      simde_mm256_set_pd(   -34.40,    -26.02,    -91.27,     85.85),
+      simde_mm256_set_pd(    74.08,     25.32,     77.71,     -1.95),
+      simde_mm256_set_pd( -2552.26,   -434.35,  -9180.98,   3672.04) },
+    { simde_mm256_set_pd(   -99.94,    -57.81,    -62.90,     71.95),
+      simde_mm256_set_pd(    71.14,     21.28,      0.30,    -99.39),
+      simde_mm256_set_pd(    81.71,     82.50,     59.60,     74.40),
+      simde_mm256_set_pd(  7028.02,   1147.70,    -40.73,   7076.71) },
+    { simde_mm256_set_pd(    53.93,     69.48,     18.49,    -33.09),
+      simde_mm256_set_pd(    36.07,     12.07,     61.32,    -94.14),
+      simde_mm256_set_pd(    27.80,    -91.63,     40.54,     82.89),
+      simde_mm256_set_pd( -1973.06,   -746.99,  -1174.35,  -3197.98) },
+    { simde_mm256_set_pd(   -44.81,     21.38,    -84.61,     88.57),
+      simde_mm256_set_pd(    63.68,    -48.75,      9.83,     86.93),
+      simde_mm256_set_pd(   -75.32,     -6.92,     82.79,     30.07),
+      simde_mm256_set_pd(  2928.82,   1049.19,    748.93,  -7729.46) },
+    { simde_mm256_set_pd(   -82.04,     85.99,    -61.92,    -68.47),
+      simde_mm256_set_pd(   -49.13,     -2.61,    -70.28,    -40.18),
+      simde_mm256_set_pd(     2.43,    -59.23,     12.94,     57.23),
+      simde_mm256_set_pd( -4033.06,    283.66,  -4364.68,  -2808.35) },
+    { simde_mm256_set_pd(    45.77,    -97.96,    -41.45,     65.38),
+      simde_mm256_set_pd(    74.35,    -27.49,     85.82,     74.54),
+      simde_mm256_set_pd(    59.49,    -19.01,    -98.85,     98.57),
+      simde_mm256_set_pd( -3462.49,  -2673.91,   3656.09,  -4972.00) },
+    { simde_mm256_set_pd(   -25.67,     86.45,     18.97,     78.25),
+      simde_mm256_set_pd(    84.64,     95.53,    -81.45,     14.48),
+      simde_mm256_set_pd(    13.95,    -37.64,     98.40,     71.67),
+      simde_mm256_set_pd(  2158.76,  -8220.93,   1446.71,  -1204.73) },
+    { simde_mm256_set_pd(     2.00,     69.40,    -51.56,    -15.81),
+      simde_mm256_set_pd(    65.27,     17.35,      1.41,     46.55),
+      simde_mm256_set_pd(    35.64,      8.98,     85.54,     97.88),
+      simde_mm256_set_pd(  -166.18,  -1213.07,    -12.84,    638.08) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_fnmsub_pd(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256d_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_fnmsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256 a;
+    simde__m256 b;
+    simde__m256 c;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(   -98.80f,    -15.03f,     80.46f,    -54.50f,
+                             67.37f,     38.74f,     34.98f,    -67.24f),
+      simde_mm256_set_ps(   -81.84f,    -81.18f,    -57.54f,    -70.09f,
+                             32.57f,      6.71f,    -94.65f,    -21.70f),
+      simde_mm256_set_ps(   -25.97f,     82.93f,    -34.06f,    -40.52f,
+                            -99.03f,    -99.15f,    -30.70f,     -3.89f),
+      simde_mm256_set_ps( -8059.82f,  -1303.07f,   4663.73f,  -3779.38f,
+                          -2095.21f,   -160.80f,   3341.56f,  -1455.22f) },
+    { simde_mm256_set_ps(    50.91f,    -12.51f,    -69.79f,     38.98f,
+                             47.43f,     29.00f,    -59.47f,    -28.66f),
+      simde_mm256_set_ps(    43.57f,     24.99f,    -60.81f,    -20.24f,
+                             78.64f,     95.71f,      1.55f,     50.68f),
+      simde_mm256_set_ps(   -41.40f,    -35.88f,     80.34f,     75.52f,
+                             43.02f,     59.83f,     73.39f,    -14.04f),
+      simde_mm256_set_ps( -2176.75f,    348.50f,  -4324.27f,    713.44f,
+                          -3772.92f,  -2835.42f,     18.79f,   1466.53f) },
+    { simde_mm256_set_ps(    89.70f,      2.36f,    -48.64f,     61.60f,
+                            -61.98f,     -5.02f,    -81.17f,    -28.22f),
+      simde_mm256_set_ps(    -1.30f,    -16.38f,     76.27f,    -91.59f,
+                             18.03f,    -47.84f,     72.24f,    -24.80f),
+      simde_mm256_set_ps(   -21.34f,    -57.63f,    -49.98f,     96.11f,
+                             16.93f,      6.16f,     -8.53f,    -70.52f),
+      simde_mm256_set_ps(   137.95f,     96.29f,   3759.75f,   5545.83f,
+                           1100.57f,   -246.32f,   5872.25f,   -629.34f) },
+    { simde_mm256_set_ps(   -87.42f,    -41.42f,     79.94f,    -55.51f,
+                             47.57f,     43.47f,     81.91f,      7.30f),
+      simde_mm256_set_ps(   -21.18f,     64.74f,     -9.69f,     98.45f,
+                            -64.63f,     21.80f,    -58.25f,     26.65f),
+      simde_mm256_set_ps(    95.16f,     94.17f,     -5.20f,     46.56f,
+                             72.42f,    -99.71f,      3.19f,    -48.73f),
+      simde_mm256_set_ps( -1946.72f,   2587.36f,    779.82f,   5418.40f,
+                           3002.03f,   -847.94f,   4768.07f,   -145.82f) },
+    { simde_mm256_set_ps(   -54.92f,    -91.17f,    -61.98f,    -37.67f,
+                            -50.71f,     18.78f,    -13.46f,     60.09f),
+      simde_mm256_set_ps(    64.46f,     25.32f,    -62.55f,    -52.09f,
+                             62.42f,     96.08f,     57.98f,    -10.51f),
+      simde_mm256_set_ps(    55.94f,    -55.98f,     74.32f,    -52.41f,
+                            -32.93f,    -25.33f,    -42.28f,    -69.45f),
+      simde_mm256_set_ps(  3484.20f,   2364.40f,  -3951.17f,  -1909.82f,
+                           3198.25f,  -1779.05f,    822.69f,    701.00f) },
+    { simde_mm256_set_ps(   -13.70f,     47.07f,    -21.48f,    -89.37f,
+                             26.72f,     31.13f,    -12.13f,      9.09f),
+      simde_mm256_set_ps(    37.84f,     90.02f,    -70.86f,    -37.53f,
+                             63.44f,    -78.91f,    -99.80f,    -78.50f),
+      simde_mm256_set_ps(    25.40f,    -54.91f,    -95.11f,    -68.63f,
+                             12.55f,    -28.87f,    -35.32f,     37.37f),
+      simde_mm256_set_ps(   493.01f,  -4182.33f,  -1426.96f,  -3285.43f,
+                          -1707.67f,   2485.34f,  -1175.25f,    676.20f) },
+    { simde_mm256_set_ps(   -43.04f,     39.24f,    -63.50f,     14.12f,
+                             12.27f,    -16.27f,     64.59f,      6.35f),
+      simde_mm256_set_ps(    37.51f,    -72.47f,     92.77f,     35.11f,
+                             23.15f,    -72.84f,     52.96f,    -64.17f),
+      simde_mm256_set_ps(   -12.65f,     94.24f,    -67.09f,      5.90f,
+                            -34.95f,      2.64f,     58.63f,    -62.70f),
+      simde_mm256_set_ps(  1627.08f,   2749.48f,   5957.98f,   -501.65f,
+                           -249.10f,  -1187.75f,  -3479.32f,    470.18f) },
+    { simde_mm256_set_ps(    76.02f,    -31.49f,     -8.35f,    -73.06f,
+                            -77.20f,      1.99f,    -24.62f,    -45.84f),
+      simde_mm256_set_ps(    95.60f,     40.25f,     97.08f,    -18.20f,
+                             97.84f,    -33.55f,    -59.76f,    -20.92f),
+      simde_mm256_set_ps(    85.45f,    -51.62f,     22.14f,      2.24f,
+                            -24.09f,    -85.12f,     -6.09f,     35.94f),
+      simde_mm256_set_ps( -7352.96f,   1319.09f,    788.48f,  -1331.93f,
+                           7577.34f,    151.88f,  -1465.20f,   -994.91f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_fnmsub_ps(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+    simde_assert_m256_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm_fmadd_pd",       test_simde_mm_fmadd_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmadd_ps",       test_simde_mm_fmadd_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmadd_sd",       test_simde_mm_fmadd_sd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmadd_ss",       test_simde_mm_fmadd_ss,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmaddsub_pd",    test_simde_mm_fmaddsub_pd,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmaddsub_ps",    test_simde_mm_fmaddsub_ps,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmsub_pd",       test_simde_mm_fmsub_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmsub_ps",       test_simde_mm_fmsub_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmsub_sd",       test_simde_mm_fmsub_sd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmsub_ss",       test_simde_mm_fmsub_ss,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmsubadd_pd",    test_simde_mm_fmsubadd_pd,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fmsubadd_ps",    test_simde_mm_fmsubadd_ps,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fnmadd_pd",      test_simde_mm_fnmadd_pd,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fnmadd_ps",      test_simde_mm_fnmadd_ps,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fnmadd_sd",      test_simde_mm_fnmadd_sd,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fnmadd_ss",      test_simde_mm_fnmadd_ss,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fnmsub_pd",      test_simde_mm_fnmsub_pd,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fnmsub_ps",      test_simde_mm_fnmsub_ps,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fnmsub_sd",      test_simde_mm_fnmsub_sd,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_fnmsub_ss",      test_simde_mm_fnmsub_ss,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fmadd_pd",    test_simde_mm256_fmadd_pd,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fmadd_ps",    test_simde_mm256_fmadd_ps,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fmaddsub_pd", test_simde_mm256_fmaddsub_pd, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fmaddsub_ps", test_simde_mm256_fmaddsub_ps, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fmsub_pd",    test_simde_mm256_fmsub_pd,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fmsub_ps",    test_simde_mm256_fmsub_ps,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fmsubadd_pd", test_simde_mm256_fmsubadd_pd, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fmsubadd_ps", test_simde_mm256_fmsubadd_ps, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fnmadd_pd",   test_simde_mm256_fnmadd_pd,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fnmadd_ps",   test_simde_mm256_fnmadd_ps,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fnmsub_pd",   test_simde_mm256_fnmsub_pd,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm256_fnmsub_ps",   test_simde_mm256_fnmsub_ps,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_fma_test_suite = {
+  (char*) "/fma",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
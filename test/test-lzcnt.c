@@ -0,0 +1,94 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../lzcnt.h"
+
+static MunitResult
+test_simde_lzcnt_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x00000000),  32 },
+    { UINT32_C(0x00000001),  31 },
+    { UINT32_C(0x05e7a8d7),   5 },
+    { UINT32_C(0x0005e000),  13 },
+    { UINT32_C(0xae81f400),   0 },
+    { UINT32_C(0x3a839c00),   2 },
+    { UINT32_C(0xb6000000),   0 },
+    { UINT32_C(0xffffffff),   0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_lzcnt_u32(test_vec[i].a);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_lzcnt_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x0000000000000000),  64 },
+    { UINT64_C(0x0000000000000001),  63 },
+    { UINT64_C(0x002078c834af3d46),  10 },
+    { UINT64_C(0x00000030856c0000),  26 },
+    { UINT64_C(0xf4860ce5740fa000),   0 },
+    { UINT64_C(0x00596ec91ea00000),   9 },
+    { UINT64_C(0xcdd8000000000000),   0 },
+    { UINT64_C(0xffffffffffffffff),   0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_lzcnt_u64(test_vec[i].a);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/lzcnt_u32",        test_simde_lzcnt_u32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/lzcnt_u64",        test_simde_lzcnt_u64,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_lzcnt_test_suite = {
+  (char*) "/lzcnt",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
@@ -0,0 +1,150 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../popcnt.h"
+
+static MunitResult
+test_simde_bit_scan_forward(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    int32_t a;
+    int32_t r;
+  } test_vec[8] = {
+    {           0,  -1 },
+    {           1,   0 },
+    {    99068119,   0 },
+    {      385024,  13 },
+    { -1367215104,  10 },
+    {   981703680,  10 },
+    { -1241513984,  25 },
+    {          -1,   0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_bit_scan_forward(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_bit_scan_reverse(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    int32_t a;
+    int32_t r;
+  } test_vec[8] = {
+    {           0,  -1 },
+    {           1,   0 },
+    {    99068119,  26 },
+    {      385024,  18 },
+    { -1367215104,  31 },
+    {   981703680,  29 },
+    { -1241513984,  31 },
+    {          -1,  31 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_bit_scan_reverse(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_popcnt_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t a;
+    int32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x00000000),   0 },
+    { UINT32_C(0x00000001),   1 },
+    { UINT32_C(0x05e7a8d7),  17 },
+    { UINT32_C(0x0005e000),   5 },
+    { UINT32_C(0xae81f400),  12 },
+    { UINT32_C(0x3a839c00),  11 },
+    { UINT32_C(0xb6000000),   5 },
+    { UINT32_C(0xffffffff),  32 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm_popcnt_u32(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_popcnt_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t a;
+    int64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x0000000000000000),   0 },
+    { UINT64_C(0x0000000000000001),   1 },
+    { UINT64_C(0x002078c834af3d46),  25 },
+    { UINT64_C(0x00000030856c0000),   9 },
+    { UINT64_C(0xf4860ce5740fa000),  25 },
+    { UINT64_C(0x00596ec91ea00000),  19 },
+    { UINT64_C(0xcdd8000000000000),   9 },
+    { UINT64_C(0xffffffffffffffff),  64 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int64_t r = simde_mm_popcnt_u64(test_vec[i].a);
+    munit_assert_int64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/bit_scan_forward", test_simde_bit_scan_forward, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/bit_scan_reverse", test_simde_bit_scan_reverse, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_popcnt_u32", test_simde_mm_popcnt_u32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_popcnt_u64", test_simde_mm_popcnt_u64, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_popcnt_test_suite = {
+  (char*) "/popcnt",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
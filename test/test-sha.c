@@ -0,0 +1,396 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "test.h"
+#include "../sha.h"
+
+static MunitResult
+test_simde_mm_sha1msg1_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x4b4f657f), UINT32_C(0x9e224376), UINT32_C(0x81e3a1d6), UINT32_C(0x3ef902ef)),
+      simde_x_mm_set_epu32(UINT32_C(0xe1b2fc27), UINT32_C(0x4530129d), UINT32_C(0x7c0456d6), UINT32_C(0x1d57a3ae)),
+      simde_x_mm_set_epu32(UINT32_C(0xcaacc4a9), UINT32_C(0xa0db4199), UINT32_C(0x60515df1), UINT32_C(0x7bc91072)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x1295e420), UINT32_C(0x396f3d01), UINT32_C(0xb9f28071), UINT32_C(0x145e6d20)),
+      simde_x_mm_set_epu32(UINT32_C(0x6f594407), UINT32_C(0xc117395c), UINT32_C(0xdcb9710d), UINT32_C(0x55e04f5c)),
+      simde_x_mm_set_epu32(UINT32_C(0xab676451), UINT32_C(0x2d315021), UINT32_C(0xd6abc476), UINT32_C(0xd549547c)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x4dd4b9af), UINT32_C(0xd5905188), UINT32_C(0xc2aa995d), UINT32_C(0xbb89cc33)),
+      simde_x_mm_set_epu32(UINT32_C(0x0e4ee059), UINT32_C(0x00ba8261), UINT32_C(0x17035e52), UINT32_C(0xbea72517)),
+      simde_x_mm_set_epu32(UINT32_C(0x8f7e20f2), UINT32_C(0x6e199dbb), UINT32_C(0xcce47904), UINT32_C(0xbb334e52)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x9137a370), UINT32_C(0x255cc97b), UINT32_C(0xd5323cca), UINT32_C(0x3c7ce65d)),
+      simde_x_mm_set_epu32(UINT32_C(0x219ab4f9), UINT32_C(0x782edd40), UINT32_C(0x7b0abb9e), UINT32_C(0x1bbba201)),
+      simde_x_mm_set_epu32(UINT32_C(0x44059fba), UINT32_C(0x19202f26), UINT32_C(0xf4a88833), UINT32_C(0x44523b1d)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe3d62b6b), UINT32_C(0x1dcb3b2e), UINT32_C(0x24b26087), UINT32_C(0xb7808b8f)),
+      simde_x_mm_set_epu32(UINT32_C(0x7c356729), UINT32_C(0x03cad7fb), UINT32_C(0xea1f6d88), UINT32_C(0x66446c6e)),
+      simde_x_mm_set_epu32(UINT32_C(0xc7644bec), UINT32_C(0xaa4bb0a1), UINT32_C(0x588707ae), UINT32_C(0xb44a5c74)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xc6773145), UINT32_C(0xcc5ab076), UINT32_C(0x3a72ed94), UINT32_C(0x35b595f5)),
+      simde_x_mm_set_epu32(UINT32_C(0x19a243b7), UINT32_C(0x9dd41ecf), UINT32_C(0x73c1d03a), UINT32_C(0x0b09ede6)),
+      simde_x_mm_set_epu32(UINT32_C(0xfc05dcd1), UINT32_C(0xf9ef2583), UINT32_C(0x23d0ae23), UINT32_C(0xa8618b3a)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xb94dc10a), UINT32_C(0xde32924e), UINT32_C(0xb483396f), UINT32_C(0xd427753b)),
+      simde_x_mm_set_epu32(UINT32_C(0xf31f5b3e), UINT32_C(0x820122e8), UINT32_C(0x607baee2), UINT32_C(0x433f74bb)),
+      simde_x_mm_set_epu32(UINT32_C(0x0dcef865), UINT32_C(0x0a15e775), UINT32_C(0x479c6251), UINT32_C(0x562657d3)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x79d79198), UINT32_C(0x1a7d5a09), UINT32_C(0x8301d754), UINT32_C(0x0e1148aa)),
+      simde_x_mm_set_epu32(UINT32_C(0x561bea63), UINT32_C(0x2d6e7db9), UINT32_C(0xfeeb6ea0), UINT32_C(0x4706d72f)),
+      simde_x_mm_set_epu32(UINT32_C(0xfad646cc), UINT32_C(0x146c12a3), UINT32_C(0xd51a3d37), UINT32_C(0x237f3513)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sha1msg1_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sha1msg2_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x8a01c13a), UINT32_C(0xd04fe368), UINT32_C(0x625ab63d), UINT32_C(0x9b763645)),
+      simde_x_mm_set_epu32(UINT32_C(0x2eec5282), UINT32_C(0x0dfd21b6), UINT32_C(0xf6d08061), UINT32_C(0x69d92738)),
+      simde_x_mm_set_epu32(UINT32_C(0x0ff9c119), UINT32_C(0x4d3ec612), UINT32_C(0x1707220a), UINT32_C(0x291feeb9)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe19198c6), UINT32_C(0x7b2aabc7), UINT32_C(0x71164d63), UINT32_C(0xb043801e)),
+      simde_x_mm_set_epu32(UINT32_C(0x0523e2c4), UINT32_C(0xb58a648f), UINT32_C(0x640ab82e), UINT32_C(0xb1c608cb)),
+      simde_x_mm_set_epu32(UINT32_C(0xa837f892), UINT32_C(0x3e4027d2), UINT32_C(0x81a08b51), UINT32_C(0x30e8f118)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x0a37c59a), UINT32_C(0xf385b742), UINT32_C(0x87cd1358), UINT32_C(0x4ae679b3)),
+      simde_x_mm_set_epu32(UINT32_C(0x3c2095a5), UINT32_C(0x0e3c44b0), UINT32_C(0xa5175632), UINT32_C(0x404510bd)),
+      simde_x_mm_set_epu32(UINT32_C(0x08170254), UINT32_C(0xad25c2e0), UINT32_C(0x8f1007cb), UINT32_C(0x85e2f7ce)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x13731094), UINT32_C(0x49210f1f), UINT32_C(0xb799e5f5), UINT32_C(0x68e94ac6)),
+      simde_x_mm_set_epu32(UINT32_C(0x781b7c76), UINT32_C(0x1ea44999), UINT32_C(0x2de842b5), UINT32_C(0x44d66581)),
+      simde_x_mm_set_epu32(UINT32_C(0x1baeb21a), UINT32_C(0xc9929b54), UINT32_C(0xe69f00e9), UINT32_C(0xe68ff1b8)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe0b41c3d), UINT32_C(0x59c957a4), UINT32_C(0xc41e2b45), UINT32_C(0x1dc9d108)),
+      simde_x_mm_set_epu32(UINT32_C(0xdea7883e), UINT32_C(0x9a5a8392), UINT32_C(0x127dc6d1), UINT32_C(0x59b30864)),
+      simde_x_mm_set_epu32(UINT32_C(0xf5dd3f5e), UINT32_C(0x976922ea), UINT32_C(0x3b5a4643), UINT32_C(0xd029dcad)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x6e46ecda), UINT32_C(0xb60e5bc6), UINT32_C(0x52580d88), UINT32_C(0x0a86ae12)),
+      simde_x_mm_set_epu32(UINT32_C(0x160685cb), UINT32_C(0x5c0b1652), UINT32_C(0x38ed89a4), UINT32_C(0x00b989db)),
+      simde_x_mm_set_epu32(UINT32_C(0x649bf510), UINT32_C(0x1dc7a4c5), UINT32_C(0xa5c308a6), UINT32_C(0xdc3ab604)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xd43c206f), UINT32_C(0x1793f4e1), UINT32_C(0xe65f2e09), UINT32_C(0x65a536a0)),
+      simde_x_mm_set_epu32(UINT32_C(0x43077cd8), UINT32_C(0xc7f5ef0c), UINT32_C(0xa6521b37), UINT32_C(0xff96b8ec)),
+      simde_x_mm_set_epu32(UINT32_C(0x27939ec6), UINT32_C(0x6383dfad), UINT32_C(0x33932dca), UINT32_C(0x846d50cc)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x3271e0b8), UINT32_C(0x6afbdd5e), UINT32_C(0x72a9c64c), UINT32_C(0x325bbd2b)),
+      simde_x_mm_set_epu32(UINT32_C(0xe5a8fa7f), UINT32_C(0xba56f2ba), UINT32_C(0xfa66a3ee), UINT32_C(0xc2383559)),
+      simde_x_mm_set_epu32(UINT32_C(0x104e2405), UINT32_C(0x213afd61), UINT32_C(0x6123e62b), UINT32_C(0x442b325c)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sha1msg2_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sha1nexte_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x9bcb9274), UINT32_C(0x4c5bf96c), UINT32_C(0xbc1eb625), UINT32_C(0x92f4b2b9)),
+      simde_x_mm_set_epu32(UINT32_C(0x4599887f), UINT32_C(0x736c346f), UINT32_C(0xeedc97e4), UINT32_C(0xc4e8dba0)),
+      simde_x_mm_set_epu32(UINT32_C(0x6c8c6d1c), UINT32_C(0x736c346f), UINT32_C(0xeedc97e4), UINT32_C(0xc4e8dba0)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x51349497), UINT32_C(0x8dfea4f9), UINT32_C(0xd305b10d), UINT32_C(0x21ece669)),
+      simde_x_mm_set_epu32(UINT32_C(0x1047602a), UINT32_C(0x631a58fc), UINT32_C(0x93f2b09c), UINT32_C(0x7c1b136a)),
+      simde_x_mm_set_epu32(UINT32_C(0xe494854f), UINT32_C(0x631a58fc), UINT32_C(0x93f2b09c), UINT32_C(0x7c1b136a)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe757a169), UINT32_C(0x44d8c152), UINT32_C(0xc2e36737), UINT32_C(0xa048fb90)),
+      simde_x_mm_set_epu32(UINT32_C(0x50b257eb), UINT32_C(0xac7a28cc), UINT32_C(0xbc1125f1), UINT32_C(0x2d02a704)),
+      simde_x_mm_set_epu32(UINT32_C(0xca884045), UINT32_C(0xac7a28cc), UINT32_C(0xbc1125f1), UINT32_C(0x2d02a704)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x0203baff), UINT32_C(0x7155fe45), UINT32_C(0x8eb4ecfa), UINT32_C(0x8f722df3)),
+      simde_x_mm_set_epu32(UINT32_C(0xb5f0f423), UINT32_C(0xec3e9bd2), UINT32_C(0x1fd2356b), UINT32_C(0xd25e03cb)),
+      simde_x_mm_set_epu32(UINT32_C(0x7671e2e2), UINT32_C(0xec3e9bd2), UINT32_C(0x1fd2356b), UINT32_C(0xd25e03cb)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x6d573f8d), UINT32_C(0x1eff1262), UINT32_C(0x3094d9ff), UINT32_C(0x2d4114fe)),
+      simde_x_mm_set_epu32(UINT32_C(0x0d034286), UINT32_C(0xad9a8e2b), UINT32_C(0x8a6ec4de), UINT32_C(0xfe49f7b8)),
+      simde_x_mm_set_epu32(UINT32_C(0x68591269), UINT32_C(0xad9a8e2b), UINT32_C(0x8a6ec4de), UINT32_C(0xfe49f7b8)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x90c379cb), UINT32_C(0x74e7d66b), UINT32_C(0xf0e48847), UINT32_C(0xb80d4971)),
+      simde_x_mm_set_epu32(UINT32_C(0x04242177), UINT32_C(0x3020cd97), UINT32_C(0xc6f5b407), UINT32_C(0x2f031805)),
+      simde_x_mm_set_epu32(UINT32_C(0xe854ffe9), UINT32_C(0x3020cd97), UINT32_C(0xc6f5b407), UINT32_C(0x2f031805)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xddcae0ce), UINT32_C(0x0c1e2969), UINT32_C(0xbe59154e), UINT32_C(0x2d977115)),
+      simde_x_mm_set_epu32(UINT32_C(0xce2d0387), UINT32_C(0xab34a1f8), UINT32_C(0xf53d2914), UINT32_C(0x21bbf840)),
+      simde_x_mm_set_epu32(UINT32_C(0x859fbbba), UINT32_C(0xab34a1f8), UINT32_C(0xf53d2914), UINT32_C(0x21bbf840)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x53924c43), UINT32_C(0x79abd8d0), UINT32_C(0x327fe3e7), UINT32_C(0x1b204e2b)),
+      simde_x_mm_set_epu32(UINT32_C(0x8e018e17), UINT32_C(0x013e99eb), UINT32_C(0x6366abed), UINT32_C(0x9b010427)),
+      simde_x_mm_set_epu32(UINT32_C(0x62e62127), UINT32_C(0x013e99eb), UINT32_C(0x6366abed), UINT32_C(0x9b010427)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sha1nexte_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sha1rnds4_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r0;
+    simde__m128i r1;
+    simde__m128i r2;
+    simde__m128i r3;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0xd3f6f6a2), UINT32_C(0x01fd7530), UINT32_C(0x4d6ab902), UINT32_C(0x35e3ea28)),
+      simde_x_mm_set_epu32(UINT32_C(0xa5a0816d), UINT32_C(0x9cf674f8), UINT32_C(0xdf9e5f3b), UINT32_C(0xe8050256)),
+      simde_x_mm_set_epu32(UINT32_C(0xac19382a), UINT32_C(0x299bc8fa), UINT32_C(0xf1db20b3), UINT32_C(0x2d1b229a)),
+      simde_x_mm_set_epu32(UINT32_C(0x3c72175c), UINT32_C(0x9cbc4913), UINT32_C(0x9e91137b), UINT32_C(0x833359e0)),
+      simde_x_mm_set_epu32(UINT32_C(0x6ad9e1ec), UINT32_C(0xf7f6219b), UINT32_C(0x7515a45d), UINT32_C(0xee61c2f0)),
+      simde_x_mm_set_epu32(UINT32_C(0x02b92358), UINT32_C(0xb13e114e), UINT32_C(0xd1b9fab3), UINT32_C(0xda158f6d)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x46e14f80), UINT32_C(0xd3fa22c0), UINT32_C(0x98a4ad60), UINT32_C(0x40ef35b6)),
+      simde_x_mm_set_epu32(UINT32_C(0x8989416e), UINT32_C(0x9cc41641), UINT32_C(0xee0fc887), UINT32_C(0x8debcb5f)),
+      simde_x_mm_set_epu32(UINT32_C(0x078e784c), UINT32_C(0x24c31b8e), UINT32_C(0xbc1d9fc6), UINT32_C(0x5436b821)),
+      simde_x_mm_set_epu32(UINT32_C(0x7744f2d2), UINT32_C(0x9f77628c), UINT32_C(0x0fc8e1e9), UINT32_C(0x780fb5cb)),
+      simde_x_mm_set_epu32(UINT32_C(0x4d8001fd), UINT32_C(0x564fdcda), UINT32_C(0xce558732), UINT32_C(0xb16f450c)),
+      simde_x_mm_set_epu32(UINT32_C(0x318300de), UINT32_C(0xe87d3a70), UINT32_C(0x02f1c919), UINT32_C(0x8ef1eb58)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x3f14ea77), UINT32_C(0x1ce2c7a4), UINT32_C(0xcf16f873), UINT32_C(0x9df15b92)),
+      simde_x_mm_set_epu32(UINT32_C(0x0e1cd614), UINT32_C(0x17453fc9), UINT32_C(0x6e3e1d64), UINT32_C(0xd84e9395)),
+      simde_x_mm_set_epu32(UINT32_C(0x3ba02304), UINT32_C(0x82940939), UINT32_C(0x3836a78c), UINT32_C(0xb6141db1)),
+      simde_x_mm_set_epu32(UINT32_C(0xd2d86eb6), UINT32_C(0xe0cce4e6), UINT32_C(0xb39e71c7), UINT32_C(0x6b665d38)),
+      simde_x_mm_set_epu32(UINT32_C(0x4152e9d4), UINT32_C(0x6c19c5dd), UINT32_C(0x431fc073), UINT32_C(0x47722f62)),
+      simde_x_mm_set_epu32(UINT32_C(0x28fd5320), UINT32_C(0x2d441402), UINT32_C(0xe6c758f7), UINT32_C(0x824892c5)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xfe2a6829), UINT32_C(0x128070b4), UINT32_C(0x19b5f61e), UINT32_C(0xc37e7c31)),
+      simde_x_mm_set_epu32(UINT32_C(0x17608a11), UINT32_C(0x4494c953), UINT32_C(0xd700d6f3), UINT32_C(0x08ba4163)),
+      simde_x_mm_set_epu32(UINT32_C(0xe3d8c70b), UINT32_C(0x1c438266), UINT32_C(0x6386ff47), UINT32_C(0x824ba13f)),
+      simde_x_mm_set_epu32(UINT32_C(0xab01ffc4), UINT32_C(0x5bf74497), UINT32_C(0x7526d930), UINT32_C(0x04f4dd63)),
+      simde_x_mm_set_epu32(UINT32_C(0xe99469b2), UINT32_C(0x706c75a9), UINT32_C(0x28e1e2a7), UINT32_C(0x1fdf7018)),
+      simde_x_mm_set_epu32(UINT32_C(0x4b31c8ff), UINT32_C(0xf7709101), UINT32_C(0x684fc068), UINT32_C(0x5bd712f0)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x0b8bbb23), UINT32_C(0x0fe7022c), UINT32_C(0xb5e8a706), UINT32_C(0xdf9936f9)),
+      simde_x_mm_set_epu32(UINT32_C(0xc4b3e971), UINT32_C(0x1d10e937), UINT32_C(0x1ad384a9), UINT32_C(0x8919a51f)),
+      simde_x_mm_set_epu32(UINT32_C(0x27c344d0), UINT32_C(0xe9f44faf), UINT32_C(0x38f57977), UINT32_C(0x19a97f90)),
+      simde_x_mm_set_epu32(UINT32_C(0xfdee2ab7), UINT32_C(0x9e292264), UINT32_C(0x1f262450), UINT32_C(0x82a6f351)),
+      simde_x_mm_set_epu32(UINT32_C(0xfd9a484b), UINT32_C(0x5a7c34bb), UINT32_C(0xcd6d66d6), UINT32_C(0x994c0c36)),
+      simde_x_mm_set_epu32(UINT32_C(0xe655e883), UINT32_C(0x69e43ec6), UINT32_C(0x124f0b88), UINT32_C(0xd98928de)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x7f378a73), UINT32_C(0xc3a2fb25), UINT32_C(0xe6805dbd), UINT32_C(0x9d53e5cb)),
+      simde_x_mm_set_epu32(UINT32_C(0xdf24de25), UINT32_C(0x310b313f), UINT32_C(0x914ba042), UINT32_C(0x2cb546d4)),
+      simde_x_mm_set_epu32(UINT32_C(0x26a68c7e), UINT32_C(0x8a75b455), UINT32_C(0xc1b0bd03), UINT32_C(0x3fda8107)),
+      simde_x_mm_set_epu32(UINT32_C(0x6f7fc8df), UINT32_C(0x81658b77), UINT32_C(0xf4b0f733), UINT32_C(0x3b5856e2)),
+      simde_x_mm_set_epu32(UINT32_C(0xd8556db6), UINT32_C(0xbadf71c5), UINT32_C(0x9aae15a0), UINT32_C(0x472d39c7)),
+      simde_x_mm_set_epu32(UINT32_C(0x583cd8d8), UINT32_C(0x16ed5fd0), UINT32_C(0x27d9de64), UINT32_C(0x523a8c6f)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xb1f61540), UINT32_C(0x124e26ed), UINT32_C(0xaeedcc9f), UINT32_C(0x412bbd8f)),
+      simde_x_mm_set_epu32(UINT32_C(0x94d1ab66), UINT32_C(0x31422e32), UINT32_C(0x95fb01c6), UINT32_C(0xc1fc071c)),
+      simde_x_mm_set_epu32(UINT32_C(0x63de5089), UINT32_C(0x46b339fa), UINT32_C(0xc30660e1), UINT32_C(0x1c611aa9)),
+      simde_x_mm_set_epu32(UINT32_C(0xf5239be2), UINT32_C(0x7f3cb79e), UINT32_C(0x4ee8c2c3), UINT32_C(0x8ffda5c6)),
+      simde_x_mm_set_epu32(UINT32_C(0xc5f8cc93), UINT32_C(0x873e7dbd), UINT32_C(0x129e34c9), UINT32_C(0xd947ef39)),
+      simde_x_mm_set_epu32(UINT32_C(0x0a15409b), UINT32_C(0x0bb1efa0), UINT32_C(0x8211a9fb), UINT32_C(0xe6dfdb53)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x05d6ff75), UINT32_C(0xea966f65), UINT32_C(0xca63a897), UINT32_C(0x5b8252cc)),
+      simde_x_mm_set_epu32(UINT32_C(0x1b8c6005), UINT32_C(0xa4fe6818), UINT32_C(0xb7ccd804), UINT32_C(0x230ba77b)),
+      simde_x_mm_set_epu32(UINT32_C(0xa3ea9ba1), UINT32_C(0xc745cc41), UINT32_C(0x68f23a6c), UINT32_C(0xc2fc4032)),
+      simde_x_mm_set_epu32(UINT32_C(0x7ea336c7), UINT32_C(0x7124c2c3), UINT32_C(0x0f0958d6), UINT32_C(0x302f73e1)),
+      simde_x_mm_set_epu32(UINT32_C(0x7050d808), UINT32_C(0xfbd188cf), UINT32_C(0xf6f4bf16), UINT32_C(0x8c029d91)),
+      simde_x_mm_set_epu32(UINT32_C(0x1ffa01c6), UINT32_C(0x8d49c72f), UINT32_C(0x02324006), UINT32_C(0x4711a96e)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r;
+    r = simde_mm_sha1rnds4_epu32(test_vec[i].a, test_vec[i].b, 0);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r0);
+    r = simde_mm_sha1rnds4_epu32(test_vec[i].a, test_vec[i].b, 1);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r1);
+    r = simde_mm_sha1rnds4_epu32(test_vec[i].a, test_vec[i].b, 2);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r2);
+    r = simde_mm_sha1rnds4_epu32(test_vec[i].a, test_vec[i].b, 3);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r3);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sha256msg1_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x8e8f4ff9), UINT32_C(0x75417c69), UINT32_C(0x88304177), UINT32_C(0x0e78fad9)),
+      simde_x_mm_set_epu32(UINT32_C(0x05180a1c), UINT32_C(0x60c8a895), UINT32_C(0xc266c765), UINT32_C(0x2c23b29c)),
+      simde_x_mm_set_epu32(UINT32_C(0x600a8a37), UINT32_C(0xa674112c), UINT32_C(0x0b89319c), UINT32_C(0xfcc48579)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xcd715e08), UINT32_C(0x9f875d69), UINT32_C(0xa7455cd2), UINT32_C(0x8c126770)),
+      simde_x_mm_set_epu32(UINT32_C(0x2e3431a1), UINT32_C(0x9766198d), UINT32_C(0x821ca1a5), UINT32_C(0xb0b2b00d)),
+      simde_x_mm_set_epu32(UINT32_C(0x6ee5bd55), UINT32_C(0xff3e578a), UINT32_C(0xbedadfc8), UINT32_C(0x72a4f062)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xa1a2839b), UINT32_C(0x040f90be), UINT32_C(0x4292cb38), UINT32_C(0x97498071)),
+      simde_x_mm_set_epu32(UINT32_C(0x0f5abd5d), UINT32_C(0xbdf366b3), UINT32_C(0x70cda4aa), UINT32_C(0xaa67f6dd)),
+      simde_x_mm_set_epu32(UINT32_C(0xf551df4a), UINT32_C(0x87a18dda), UINT32_C(0xdb39376d), UINT32_C(0x6162ecc6)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x4a2e940b), UINT32_C(0xd581b0c9), UINT32_C(0x91b70070), UINT32_C(0x7533d974)),
+      simde_x_mm_set_epu32(UINT32_C(0xa6938292), UINT32_C(0x50c98180), UINT32_C(0x457623d8), UINT32_C(0x4f1cc2e1)),
+      simde_x_mm_set_epu32(UINT32_C(0x45f48629), UINT32_C(0x90550deb), UINT32_C(0x76e04088), UINT32_C(0xa83d83d7)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xa0d16feb), UINT32_C(0x7683703c), UINT32_C(0x9ca22721), UINT32_C(0xf4b7d85c)),
+      simde_x_mm_set_epu32(UINT32_C(0xb5a92610), UINT32_C(0x10b7c24f), UINT32_C(0x4308627c), UINT32_C(0x39ff2723)),
+      simde_x_mm_set_epu32(UINT32_C(0x295644c0), UINT32_C(0x0f24d752), UINT32_C(0x46d49c68), UINT32_C(0xce1d3fde)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x161ccf56), UINT32_C(0x446e2d73), UINT32_C(0x8bd31a20), UINT32_C(0x6fb46929)),
+      simde_x_mm_set_epu32(UINT32_C(0xe697198d), UINT32_C(0x9e7721dd), UINT32_C(0xb3e6d62a), UINT32_C(0xad4a82eb)),
+      simde_x_mm_set_epu32(UINT32_C(0x7865fd60), UINT32_C(0xe1a85366), UINT32_C(0xf12ce30f), UINT32_C(0x069a50ad)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x6668f686), UINT32_C(0x8b1337c5), UINT32_C(0x9015f5d4), UINT32_C(0xd4e4e6c9)),
+      simde_x_mm_set_epu32(UINT32_C(0xdb995d0a), UINT32_C(0x8aa3fded), UINT32_C(0xe3516d12), UINT32_C(0x68c110a3)),
+      simde_x_mm_set_epu32(UINT32_C(0x764a708b), UINT32_C(0xc8b38e6c), UINT32_C(0xe79b1827), UINT32_C(0x9b3c981d)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x389c78a2), UINT32_C(0x008aafea), UINT32_C(0xed1013b0), UINT32_C(0x4ac4a328)),
+      simde_x_mm_set_epu32(UINT32_C(0xa0099a82), UINT32_C(0xc815651b), UINT32_C(0x840f0a29), UINT32_C(0xb126b9b7)),
+      simde_x_mm_set_epu32(UINT32_C(0x0fc7eeae), UINT32_C(0x5dd4e9ac), UINT32_C(0x6cfad430), UINT32_C(0xc358bc3d)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sha256msg1_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sha256msg2_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0xd7484066), UINT32_C(0xcd53a372), UINT32_C(0x4c1c5dbb), UINT32_C(0xd15981de)),
+      simde_x_mm_set_epu32(UINT32_C(0xae6a0b53), UINT32_C(0x86b6b82a), UINT32_C(0x2fbac792), UINT32_C(0xc4615701)),
+      simde_x_mm_set_epu32(UINT32_C(0xb1407bed), UINT32_C(0x956b4a76), UINT32_C(0x91049635), UINT32_C(0x5c8b4001)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x6952c6b4), UINT32_C(0x618830d5), UINT32_C(0xe63269a5), UINT32_C(0xb364e858)),
+      simde_x_mm_set_epu32(UINT32_C(0x632d5f5c), UINT32_C(0xb964b6a1), UINT32_C(0xcad1ac66), UINT32_C(0xb429a9fb)),
+      simde_x_mm_set_epu32(UINT32_C(0x756a32a2), UINT32_C(0xa04d2415), UINT32_C(0xea8fe049), UINT32_C(0x810f9b0b)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xd024eb44), UINT32_C(0xd76fe030), UINT32_C(0x577e7e0e), UINT32_C(0xafc624ce)),
+      simde_x_mm_set_epu32(UINT32_C(0xfeed9ee4), UINT32_C(0x38a319d0), UINT32_C(0xf791722b), UINT32_C(0x26429dcc)),
+      simde_x_mm_set_epu32(UINT32_C(0xe8081eb4), UINT32_C(0x3e74f4e3), UINT32_C(0xd40fd9da), UINT32_C(0x9fa25851)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x03552723), UINT32_C(0x09f2f8ba), UINT32_C(0x969f4a6a), UINT32_C(0x475e98c7)),
+      simde_x_mm_set_epu32(UINT32_C(0xd2f35464), UINT32_C(0x5bafa510), UINT32_C(0x67c9987e), UINT32_C(0x1d7df979)),
+      simde_x_mm_set_epu32(UINT32_C(0x01c5923a), UINT32_C(0xe9c31661), UINT32_C(0x57299a5c), UINT32_C(0x6d9b6612)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x8b73b9be), UINT32_C(0xdcb87ff0), UINT32_C(0x79487af5), UINT32_C(0x1fa6af4c)),
+      simde_x_mm_set_epu32(UINT32_C(0x27ef4cc1), UINT32_C(0x92c4c4e5), UINT32_C(0xab126817), UINT32_C(0x6d8b5563)),
+      simde_x_mm_set_epu32(UINT32_C(0x66a0ad88), UINT32_C(0x70407218), UINT32_C(0xc939c7ce), UINT32_C(0x1a717957)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xbe6c8566), UINT32_C(0x6412d8fd), UINT32_C(0xcecb4e39), UINT32_C(0x6c25d9d5)),
+      simde_x_mm_set_epu32(UINT32_C(0x7e9a5e2e), UINT32_C(0x8e8a530b), UINT32_C(0x4d3cea1d), UINT32_C(0x97ad0cb3)),
+      simde_x_mm_set_epu32(UINT32_C(0x05123efc), UINT32_C(0x4f767e2d), UINT32_C(0x3398a442), UINT32_C(0xcfecedd5)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xfec65137), UINT32_C(0x627583ce), UINT32_C(0x893a8e34), UINT32_C(0x32a11a14)),
+      simde_x_mm_set_epu32(UINT32_C(0x80582acc), UINT32_C(0xa816a072), UINT32_C(0x0d71723a), UINT32_C(0xed4ed585)),
+      simde_x_mm_set_epu32(UINT32_C(0x5f60fa4a), UINT32_C(0x2f1745dd), UINT32_C(0x995a5461), UINT32_C(0xb6be1eb5)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe6729873), UINT32_C(0xb6a443ff), UINT32_C(0x7baf46fd), UINT32_C(0x009cb8b3)),
+      simde_x_mm_set_epu32(UINT32_C(0x234f138f), UINT32_C(0xcf17428f), UINT32_C(0xa9369340), UINT32_C(0x911407d2)),
+      simde_x_mm_set_epu32(UINT32_C(0x318d6c93), UINT32_C(0xcf4e217b), UINT32_C(0xe76ded07), UINT32_C(0x49c2946c)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sha256msg2_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sha256rnds2_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i k;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0xdeb96e10), UINT32_C(0x44cca760), UINT32_C(0x0a679ee5), UINT32_C(0x24b97cf0)),
+      simde_x_mm_set_epu32(UINT32_C(0xbeac3a34), UINT32_C(0x377bde6d), UINT32_C(0x10fb9e83), UINT32_C(0x2a2dd588)),
+      simde_x_mm_set_epu32(UINT32_C(0x1ef47061), UINT32_C(0x5fb0e062), UINT32_C(0x60a48601), UINT32_C(0xdab0fee2)),
+      simde_x_mm_set_epu32(UINT32_C(0x5d2b9ec4), UINT32_C(0xb9266881), UINT32_C(0xc8d03cb8), UINT32_C(0xf0536897)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xe593d5ae), UINT32_C(0xb13a5a55), UINT32_C(0x7f05934b), UINT32_C(0xfa7048ab)),
+      simde_x_mm_set_epu32(UINT32_C(0x8999c238), UINT32_C(0x7a2f3f1f), UINT32_C(0xc4dffe69), UINT32_C(0x9a0f56bb)),
+      simde_x_mm_set_epu32(UINT32_C(0xf5ff97f9), UINT32_C(0x57ab421a), UINT32_C(0xf70eeea0), UINT32_C(0xbf94f989)),
+      simde_x_mm_set_epu32(UINT32_C(0x78c30f6e), UINT32_C(0xb9301fe7), UINT32_C(0xd40f7540), UINT32_C(0x2c23c498)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x26e6e7f9), UINT32_C(0xbf11c2fc), UINT32_C(0x157a10f4), UINT32_C(0xf1872b9c)),
+      simde_x_mm_set_epu32(UINT32_C(0x28bc3237), UINT32_C(0xed28fd89), UINT32_C(0xfb0821fc), UINT32_C(0x00229bd7)),
+      simde_x_mm_set_epu32(UINT32_C(0xdcb03872), UINT32_C(0x40da87d1), UINT32_C(0xedf5f3a2), UINT32_C(0x50f1d38d)),
+      simde_x_mm_set_epu32(UINT32_C(0x5303e7f6), UINT32_C(0x675a5e82), UINT32_C(0x07f2ac7d), UINT32_C(0x4e6093f7)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x03c5fd95), UINT32_C(0xf5778c9a), UINT32_C(0x338e8053), UINT32_C(0xc289b80f)),
+      simde_x_mm_set_epu32(UINT32_C(0x30944360), UINT32_C(0x8f8b00fb), UINT32_C(0xb872b301), UINT32_C(0x11458ce1)),
+      simde_x_mm_set_epu32(UINT32_C(0x7ce70bd4), UINT32_C(0x927fcc9a), UINT32_C(0x22eca747), UINT32_C(0x54012f68)),
+      simde_x_mm_set_epu32(UINT32_C(0x6b33e036), UINT32_C(0xd39502b9), UINT32_C(0xa6439f8a), UINT32_C(0x7f5e38aa)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x8972a0c5), UINT32_C(0x426c4d72), UINT32_C(0x723e2710), UINT32_C(0x0fe78af3)),
+      simde_x_mm_set_epu32(UINT32_C(0x29175d9f), UINT32_C(0xd185af3e), UINT32_C(0x81e7d8c1), UINT32_C(0xfd7e5812)),
+      simde_x_mm_set_epu32(UINT32_C(0x36cef0c2), UINT32_C(0x0e14f5a7), UINT32_C(0x09778c02), UINT32_C(0xd606632a)),
+      simde_x_mm_set_epu32(UINT32_C(0xc8879c6f), UINT32_C(0xcc2ac19d), UINT32_C(0xb40fc994), UINT32_C(0x09b47df7)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x1ee40718), UINT32_C(0x48221726), UINT32_C(0x35c3a77d), UINT32_C(0x4ed99e3d)),
+      simde_x_mm_set_epu32(UINT32_C(0x360954fc), UINT32_C(0xe81a2328), UINT32_C(0x9a706445), UINT32_C(0x47e65b53)),
+      simde_x_mm_set_epu32(UINT32_C(0x12f306cc), UINT32_C(0xf0c64fd4), UINT32_C(0x7003e3d8), UINT32_C(0x463ec1a3)),
+      simde_x_mm_set_epu32(UINT32_C(0xf977752b), UINT32_C(0x311ced8e), UINT32_C(0x54c28b57), UINT32_C(0xac06e7cf)) },
+    { simde_x_mm_set_epu32(UINT32_C(0xa1dd8de4), UINT32_C(0x46bf8c7b), UINT32_C(0x51029cf8), UINT32_C(0x534810f2)),
+      simde_x_mm_set_epu32(UINT32_C(0x520aa6bb), UINT32_C(0xe6aec72d), UINT32_C(0x998cb145), UINT32_C(0x7a4f9c24)),
+      simde_x_mm_set_epu32(UINT32_C(0xc017feaf), UINT32_C(0xad2f0179), UINT32_C(0xceddb397), UINT32_C(0xc7102457)),
+      simde_x_mm_set_epu32(UINT32_C(0x86214a83), UINT32_C(0x1945d004), UINT32_C(0x44be63f0), UINT32_C(0xb1b4001f)) },
+    { simde_x_mm_set_epu32(UINT32_C(0x816059ba), UINT32_C(0x6b9f439a), UINT32_C(0xe6ad9a9d), UINT32_C(0xaea8591c)),
+      simde_x_mm_set_epu32(UINT32_C(0x886f44c2), UINT32_C(0x9cde0f00), UINT32_C(0xb270fc41), UINT32_C(0x8c1a9200)),
+      simde_x_mm_set_epu32(UINT32_C(0x57f102e9), UINT32_C(0x13ed2f6b), UINT32_C(0x3dca92b7), UINT32_C(0x900ed3ea)),
+      simde_x_mm_set_epu32(UINT32_C(0x6b2bfe92), UINT32_C(0x7b6152c6), UINT32_C(0xc67c7b34), UINT32_C(0x2575b073)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sha256rnds2_epu32(test_vec[i].a, test_vec[i].b, test_vec[i].k);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitTest test_suite_tests[] = {
+  { (char*) "/mm_sha1msg1_epu32",    test_simde_mm_sha1msg1_epu32,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sha1msg2_epu32",    test_simde_mm_sha1msg2_epu32,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sha1nexte_epu32",   test_simde_mm_sha1nexte_epu32,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sha1rnds4_epu32",   test_simde_mm_sha1rnds4_epu32,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sha256msg1_epu32",  test_simde_mm_sha256msg1_epu32,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sha256msg2_epu32",  test_simde_mm_sha256msg2_epu32,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sha256rnds2_epu32", test_simde_mm_sha256rnds2_epu32, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+const MunitSuite simde_sha_test_suite = {
+  (char*) "/sha",
+  test_suite_tests,
+  NULL,
+  1,
+  MUNIT_SUITE_OPTION_NONE
+};
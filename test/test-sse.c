@@ -4339,6 +4339,47 @@ test_simde_mm_stream_ps(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm_prefetch(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  /* Prefetching is only a hint; make sure each hint compiles and
+     leaves the data alone. */
+  SIMDE__ALIGN(64) simde_float32 buf[64];
+  for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+    buf[i] = (simde_float32) i;
+  }
+
+  for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i += 16) {
+    simde_mm_prefetch((char const*) &(buf[i]), simde_MM_HINT_NTA);
+    simde_mm_prefetch((char const*) &(buf[i]), simde_MM_HINT_T0);
+    simde_mm_prefetch((char const*) &(buf[i]), simde_MM_HINT_T1);
+    simde_mm_prefetch((char const*) &(buf[i]), simde_MM_HINT_T2);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+    munit_assert_float(buf[i], ==, (simde_float32) i);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sfence(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  SIMDE__ALIGN(16) simde_float32 buf[4];
+  simde__m128 a = simde_mm_set_ps(4.0f, 3.0f, 2.0f, 1.0f);
+  simde_mm_stream_ps(buf, a);
+  simde_mm_sfence();
+  simde__m128 r = simde_mm_load_ps(buf);
+  simde_assert_m128_f32(r, ==, a);
+
+  return MUNIT_OK;
+}
+
 static MunitTest test_suite_tests[] = {
   { (char*) "/mm_set_ps",        test_simde_mm_set_ps,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
   { (char*) "/mm_set1_ps",       test_simde_mm_set1_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
@@ -4461,6 +4502,8 @@ static MunitTest test_suite_tests[] = {
   { (char*) "/mm_xor_ps",        test_simde_mm_xor_ps,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
   { (char*) "/mm_stream_pi",     test_simde_mm_stream_pi,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
   { (char*) "/mm_stream_ps",     test_simde_mm_stream_ps,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_prefetch",      test_simde_mm_prefetch,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sfence",        test_simde_mm_sfence,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
   { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
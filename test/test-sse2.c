@@ -7107,6 +7107,1475 @@ test_simde_mm_xor_si128(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm_sad_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0xce, 0x91, 0xe5, 0x90, 0x05, 0x0c, 0x36, 0x8d,
+			0x77, 0xae, 0x0b, 0xf3, 0xee, 0xb9, 0x02, 0x6e),
+      simde_mm_set_epi8(0xe1, 0x44, 0xd6, 0xe8, 0x79, 0x2e, 0x1a, 0xf4,
+			0x16, 0xe0, 0xa1, 0xc5, 0x1d, 0xce, 0x4e, 0x7b),
+      simde_mm_set_epi64x(INT64_C(                 480), INT64_C(                 662)) },
+    { simde_mm_set_epi8(0x74, 0xff, 0xb8, 0xe8, 0x85, 0x47, 0x56, 0xd7,
+			0x4e, 0x85, 0xb0, 0xd6, 0xa9, 0xd3, 0x49, 0x42),
+      simde_mm_set_epi8(0x99, 0xe8, 0x3f, 0x5a, 0x50, 0x79, 0xfc, 0x5d,
+			0x79, 0xf8, 0xad, 0xa7, 0xc4, 0x9b, 0xd6, 0x3b),
+      simde_mm_set_epi64x(INT64_C(                 714), INT64_C(                 439)) },
+    { simde_mm_set_epi8(0x39, 0xb1, 0x6b, 0x71, 0x2d, 0xcf, 0xc8, 0xae,
+			0xfc, 0x38, 0x7d, 0xfa, 0xda, 0xbf, 0x55, 0x85),
+      simde_mm_set_epi8(0x50, 0xd5, 0x9c, 0x0a, 0x21, 0x20, 0x82, 0x65,
+			0x0e, 0xc7, 0x6d, 0x00, 0x9b, 0x7e, 0x9a, 0x31),
+      simde_mm_set_epi64x(INT64_C(                 541), INT64_C(                 928)) },
+    { simde_mm_set_epi8(0xb3, 0xd3, 0xcd, 0xbd, 0x44, 0xc2, 0x69, 0xe7,
+			0xcd, 0x02, 0xed, 0x7c, 0x81, 0xe8, 0xc1, 0xfa),
+      simde_mm_set_epi8(0x6e, 0x1e, 0x6c, 0xed, 0x70, 0x21, 0x34, 0x98,
+			0xda, 0x7f, 0x69, 0x93, 0x8e, 0x2c, 0x98, 0x7d),
+      simde_mm_set_epi64x(INT64_C(                 732), INT64_C(                 660)) },
+    { simde_mm_set_epi8(0x4c, 0x36, 0xd0, 0xdb, 0x05, 0xb0, 0xc0, 0xfc,
+			0xb2, 0x7a, 0x78, 0x86, 0x91, 0xe4, 0x7f, 0x62),
+      simde_mm_set_epi8(0x9b, 0xa1, 0x26, 0xcd, 0xff, 0xff, 0x0c, 0xbc,
+			0x8f, 0xb3, 0x73, 0xff, 0xb8, 0x1d, 0xe7, 0x1b),
+      simde_mm_set_epi64x(INT64_C(                 943), INT64_C(                 631)) },
+    { simde_mm_set_epi8(0x11, 0x49, 0x94, 0x17, 0xec, 0x88, 0xe0, 0xda,
+			0xe2, 0x88, 0x56, 0xd2, 0x15, 0xed, 0x48, 0xb3),
+      simde_mm_set_epi8(0x34, 0x14, 0xc4, 0x7c, 0x75, 0x67, 0xed, 0xb8,
+			0x8e, 0xab, 0x2f, 0x9a, 0x5b, 0x41, 0x9a, 0x43),
+      simde_mm_set_epi64x(INT64_C(                 436), INT64_C(                 650)) },
+    { simde_mm_set_epi8(0xb2, 0x2e, 0x1e, 0xa5, 0x58, 0x2e, 0xe0, 0x29,
+			0x4c, 0xf8, 0x41, 0xee, 0x83, 0x7d, 0xa8, 0x40),
+      simde_mm_set_epi8(0xd7, 0x8e, 0x2a, 0x2f, 0x7f, 0x10, 0x4e, 0xb3,
+			0x63, 0xe9, 0x38, 0x29, 0x4e, 0xf3, 0x49, 0x6f),
+      simde_mm_set_epi64x(INT64_C(                 616), INT64_C(                 557)) },
+    { simde_mm_set_epi8(0x27, 0x3b, 0x10, 0xa6, 0x00, 0xeb, 0x30, 0x2b,
+			0xb5, 0xfe, 0xfd, 0xa6, 0xe2, 0x9b, 0x2a, 0xf0),
+      simde_mm_set_epi8(0xc2, 0xdd, 0xa0, 0xeb, 0xe6, 0xd8, 0x2e, 0xf0,
+			0x45, 0xad, 0x6d, 0x01, 0x25, 0xa9, 0x86, 0xaa),
+      simde_mm_set_epi64x(INT64_C(                 978), INT64_C(                 867)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sad_epu8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_shuffle_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(  347896290, -1233857949,   186016525, -1222233563),
+      simde_mm_set_epi32(  186016525, -1222233563,   347896290, -1233857949) },
+    { simde_mm_set_epi32( 1462500224,  1784650872,  1427438312,   218462448),
+      simde_mm_set_epi32( 1427438312,   218462448,  1462500224,  1784650872) },
+    { simde_mm_set_epi32(  492306179,   -15613193,  2034146954, -1133344804),
+      simde_mm_set_epi32( 2034146954, -1133344804,   492306179,   -15613193) },
+    { simde_mm_set_epi32( 1434916998,  -499567743,  1819716933,  -902777898),
+      simde_mm_set_epi32( 1819716933,  -902777898,  1434916998,  -499567743) },
+    { simde_mm_set_epi32(    1455386,   910187504,   834066927,  1754084791),
+      simde_mm_set_epi32(  834066927,  1754084791,     1455386,   910187504) },
+    { simde_mm_set_epi32(  953480278,   627995062, -1806357124,   -93796334),
+      simde_mm_set_epi32(-1806357124,   -93796334,   953480278,   627995062) },
+    { simde_mm_set_epi32(  121415650,  1029665220, -1085700465,  1665999771),
+      simde_mm_set_epi32(-1085700465,  1665999771,   121415650,  1029665220) },
+    { simde_mm_set_epi32( -868233590,  -448311291,   -11880479,   169829449),
+      simde_mm_set_epi32(  -11880479,   169829449,  -868233590,  -448311291) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_shuffle_epi32(test_vec[i].a, 0x4e);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_shufflehi_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( -9152,  14289,   6056,   7951,  14269, -17660,  31111, -31405),
+      simde_mm_set_epi16(  7951,   6056,  14289,  -9152,  14269, -17660,  31111, -31405) },
+    { simde_mm_set_epi16( 32682,  -5191, -12128,  -5708, -18064,  -2530, -28184,  23172),
+      simde_mm_set_epi16( -5708, -12128,  -5191,  32682, -18064,  -2530, -28184,  23172) },
+    { simde_mm_set_epi16(-19092, -15362, -11378, -17587,   4437,  31518,  10561,  30555),
+      simde_mm_set_epi16(-17587, -11378, -15362, -19092,   4437,  31518,  10561,  30555) },
+    { simde_mm_set_epi16( 21354,  14644, -24304,   1790,  -3940,  30361,   4481,  -2737),
+      simde_mm_set_epi16(  1790, -24304,  14644,  21354,  -3940,  30361,   4481,  -2737) },
+    { simde_mm_set_epi16( -4280,  -8695,  -1100, -12138,  -8117,  21349,  31607,  -3148),
+      simde_mm_set_epi16(-12138,  -1100,  -8695,  -4280,  -8117,  21349,  31607,  -3148) },
+    { simde_mm_set_epi16( -9281,   8590, -16940,  17510,   3325,  24190, -22801,  28539),
+      simde_mm_set_epi16( 17510, -16940,   8590,  -9281,   3325,  24190, -22801,  28539) },
+    { simde_mm_set_epi16(-31137,   1550,  -9918, -10068, -32534,  17102, -10486, -16788),
+      simde_mm_set_epi16(-10068,  -9918,   1550, -31137, -32534,  17102, -10486, -16788) },
+    { simde_mm_set_epi16( 24949, -16771,  17085, -19683, -25566,  -6420,  23830,  27750),
+      simde_mm_set_epi16(-19683,  17085, -16771,  24949, -25566,  -6420,  23830,  27750) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_shufflehi_epi16(test_vec[i].a, 0x1b);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_shufflelo_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 19792, -18374,  -2306,  16962,  25102,   -286,  -3505,   1845),
+      simde_mm_set_epi16( 19792, -18374,  -2306,  16962,  25102,  -3505,   1845,   -286) },
+    { simde_mm_set_epi16(-18868,   -521,  15872,  18584, -24534, -18658,  25530, -28367),
+      simde_mm_set_epi16(-18868,   -521,  15872,  18584, -24534,  25530, -28367, -18658) },
+    { simde_mm_set_epi16( 12791,  -4388,  25347, -27783,  11726,   9053, -25995, -16981),
+      simde_mm_set_epi16( 12791,  -4388,  25347, -27783,  11726, -25995, -16981,   9053) },
+    { simde_mm_set_epi16(  4114,  -8739,  29876,  14589, -13569, -20444, -23452,  13839),
+      simde_mm_set_epi16(  4114,  -8739,  29876,  14589, -13569, -23452,  13839, -20444) },
+    { simde_mm_set_epi16(-23589, -31631, -19264,  30483, -26698,  -6173,  12076,  12980),
+      simde_mm_set_epi16(-23589, -31631, -19264,  30483, -26698,  12076,  12980,  -6173) },
+    { simde_mm_set_epi16(-28590,  -6779,   5238,  13704, -28683,  11539, -28606, -31950),
+      simde_mm_set_epi16(-28590,  -6779,   5238,  13704, -28683, -28606, -31950,  11539) },
+    { simde_mm_set_epi16( 23426,  30003,  -9184, -21261, -24920,  13069,  18935,  21961),
+      simde_mm_set_epi16( 23426,  30003,  -9184, -21261, -24920,  18935,  21961,  13069) },
+    { simde_mm_set_epi16(  8846,  -6223,   7111,  24405,   -534,  21365,  12804,  31675),
+      simde_mm_set_epi16(  8846,  -6223,   7111,  24405,   -534,  12804,  31675,  21365) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_shufflelo_epi16(test_vec[i].a, 0xd2);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sll_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 18777,   5549,  30726, -14946,  25067,  16789, -32502, -25726),
+      simde_mm_set_epi64x(0, 6),
+      simde_mm_set_epi16( 22080,  27456,    384,  26496,  31424,  25920,  17024,  -8064) },
+    { simde_mm_set_epi16(  -422,  -5169, -11796, -22014, -22165,   6229, -10383,   4280),
+      simde_mm_set_epi64x(0, 8),
+      simde_mm_set_epi16( 23040, -12544,  -5120,    512,  27392,  21760,  28928, -18432) },
+    { simde_mm_set_epi16(  8970,  -9489, -25303,   3869,  26532,  30359, -15807,  -1414),
+      simde_mm_set_epi64x(0, 13),
+      simde_mm_set_epi16( 16384,  -8192,   8192, -24576, INT16_MIN,  -8192,   8192,  16384) },
+    { simde_mm_set_epi16( 26247,  -9365,   8807,  26431,  23016, -25769,  18195, -22088),
+      simde_mm_set_epi64x(0, 4),
+      simde_mm_set_epi16( 26736, -18768,   9840,  29680, -24960, -19088,  28976, -25728) },
+    { simde_mm_set_epi16( -3126,  15266,  22632,   2427,   8705, -27023,  22926, -16406),
+      simde_mm_set_epi64x(0, 8),
+      simde_mm_set_epi16(-13824, -24064,  26624,  31488,    256,  28928, -29184,  -5632) },
+    { simde_mm_set_epi16( 25561,  16873,  -5487,  26569,  -2071,  -6081,  -6990, -17710),
+      simde_mm_set_epi64x(0, 2),
+      simde_mm_set_epi16(-28828,   1956, -21948, -24796,  -8284, -24324, -27960,  -5304) },
+    { simde_mm_set_epi16( 12672, -28235, -18814,  -7733,  28222, -31804,  -8540,  -9853),
+      simde_mm_set_epi64x(0, 8),
+      simde_mm_set_epi16(INT16_MIN, -19200, -32256, -13568,  15872, -15360, -23552, -32000) },
+    { simde_mm_set_epi16(-19463, -24900,  18061, -17577,  -4758, -13662, -14682,  32000),
+      simde_mm_set_epi64x(0, 5),
+      simde_mm_set_epi16( 32544, -10368, -11872,  27360, -21184,  21568, -11072, -24576) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sll_epi16(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sll_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(  193638493, -1932836054,   490336860,   529322910),
+      simde_mm_set_epi64x(0, 5),
+      simde_mm_set_epi32( 1901464480, -1721211584, -1489089664,  -241536064) },
+    { simde_mm_set_epi32( 1282578332, -1001160009,  2016253600,  -935930079),
+      simde_mm_set_epi64x(0, 1),
+      simde_mm_set_epi32(-1729810632, -2002320018,  -262460096, -1871860158) },
+    { simde_mm_set_epi32( 1558118810,  2037115285,  -379373658,  1323630404),
+      simde_mm_set_epi64x(0, 10),
+      simde_mm_set_epi32( 2080794624, -1348054016, -1931569152, -1812131840) },
+    { simde_mm_set_epi32( 1782132537, -1644796775,  1079776012, -1431302686),
+      simde_mm_set_epi64x(0, 28),
+      simde_mm_set_epi32(-1879048192, -1879048192, -1073741824,   536870912) },
+    { simde_mm_set_epi32( 1970317028,   301341712, -1543435953,   702060283),
+      simde_mm_set_epi64x(0, 9),
+      simde_mm_set_epi32( -514996224,  -331866112,    34774528, -1322387968) },
+    { simde_mm_set_epi32(  935235000,  2097365993, -1151131533,  1342712331),
+      simde_mm_set_epi64x(0, 11),
+      simde_mm_set_epi32( -194134016,   438257664,   419665920,  1095784448) },
+    { simde_mm_set_epi32(  637019836,  -539122106, -1767025239,  1718179688),
+      simde_mm_set_epi64x(0, 10),
+      simde_mm_set_epi32( -526716928,  1989744640, -1252613120, -1520590848) },
+    { simde_mm_set_epi32( -752678050, -1922269908, -1504659592,  1011656497),
+      simde_mm_set_epi64x(0, 11),
+      simde_mm_set_epi32(  408612864,  1676238848, -2051293184,  1698269184) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sll_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sll_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C( -854116536474619440), INT64_C( 3734031430267406670)),
+      simde_mm_set_epi64x(0, 11),
+      simde_mm_set_epi64x(INT64_C( 3210020302386790400), INT64_C(-8102421401815060480)) },
+    { simde_mm_set_epi64x(INT64_C(-3357178522697346985), INT64_C( 8611057261680879265)),
+      simde_mm_set_epi64x(0, 67),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm_set_epi64x(INT64_C( 5977691432376583085), INT64_C( 7452739986249172540)),
+      simde_mm_set_epi64x(0, 5),
+      simde_mm_set_epi64x(INT64_C( 6818685098955142560), INT64_C(-1319993398250649728)) },
+    { simde_mm_set_epi64x(INT64_C( 4785301983042211733), INT64_C(-3703407090934490930)),
+      simde_mm_set_epi64x(0, 33),
+      simde_mm_set_epi64x(INT64_C(-7752912493269221376), INT64_C(-7178823997432266752)) },
+    { simde_mm_set_epi64x(INT64_C( -811140457517807239), INT64_C( 5574636159535915080)),
+      simde_mm_set_epi64x(0, 52),
+      simde_mm_set_epi64x(INT64_C(-7525514977336098816), INT64_C(  324259173170675712)) },
+    { simde_mm_set_epi64x(INT64_C( 6607918713691173639), INT64_C(  891228166659045439)),
+      simde_mm_set_epi64x(0, 11),
+      simde_mm_set_epi64x(INT64_C(-6892624463287273472), INT64_C( -992377979520550912)) },
+    { simde_mm_set_epi64x(INT64_C( 3722768422916197173), INT64_C(-5491376389666216307)),
+      simde_mm_set_epi64x(0, 35),
+      simde_mm_set_epi64x(INT64_C(-6363487695385133056), INT64_C( 3446155761149804544)) },
+    { simde_mm_set_epi64x(INT64_C(-5025831250689864269), INT64_C( 7292987198531480242)),
+      simde_mm_set_epi64x(0, 6),
+      simde_mm_set_epi64x(INT64_C(-8058550791088935744), INT64_C( 5582578863275945088)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sll_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_srl_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 28518, -11124, -14485,  21145, -15452,  13666,  -7855,   -129),
+      simde_mm_set_epi64x(0, 2),
+      simde_mm_set_epi16(  7129,  13603,  12762,   5286,  12521,   3416,  14420,  16351) },
+    { simde_mm_set_epi16(-30840,  23730, -24900, -29637,  21641,   3239,  23960,   7335),
+      simde_mm_set_epi64x(0, 11),
+      simde_mm_set_epi16(    16,     11,     19,     17,     10,      1,     11,      3) },
+    { simde_mm_set_epi16( 21347,  24536, -18392,   -996,  25444,  10238,  19171,  28281),
+      simde_mm_set_epi64x(0, 7),
+      simde_mm_set_epi16(   166,    191,    368,    504,    198,     79,    149,    220) },
+    { simde_mm_set_epi16(  5901, -11766, -23589, -13592,  31314,  -6004,  25757,  18846),
+      simde_mm_set_epi64x(0, 5),
+      simde_mm_set_epi16(   184,   1680,   1310,   1623,    978,   1860,    804,    588) },
+    { simde_mm_set_epi16( 11360, -27737, -12339,  28914,  16513,  -6257,  -6303,  15152),
+      simde_mm_set_epi64x(0, 7),
+      simde_mm_set_epi16(    88,    295,    415,    225,    129,    463,    462,    118) },
+    { simde_mm_set_epi16(-17125, -25686,   -462,   2360,  -1020,   9798,  29362, -22115),
+      simde_mm_set_epi64x(0, 11),
+      simde_mm_set_epi16(    23,     19,     31,      1,     31,      4,     14,     21) },
+    { simde_mm_set_epi16( 10307, -25740,   6020,  30551,  29422,   6479,  31709,  -7000),
+      simde_mm_set_epi64x(0, 3),
+      simde_mm_set_epi16(  1288,   4974,    752,   3818,   3677,    809,   3963,   7317) },
+    { simde_mm_set_epi16(-14878, -11364,  17989,  32403,    703, -14324,   4738,  19447),
+      simde_mm_set_epi64x(0, 12),
+      simde_mm_set_epi16(    12,     13,      4,      7,      0,     12,      1,      4) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_srl_epi16(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_srl_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(  538206842, -2090698414,  -613041359,  1120998307),
+      simde_mm_set_epi64x(0, 25),
+      simde_mm_set_epi32(         16,          65,         109,          33) },
+    { simde_mm_set_epi32( -579687458,  2056310558,  1555388312,  1605924073),
+      simde_mm_set_epi64x(0, 12),
+      simde_mm_set_epi32(     907050,      502028,      379733,      392071) },
+    { simde_mm_set_epi32( -249212192,  -568250917,  -516719565, -1210708615),
+      simde_mm_set_epi64x(0, 28),
+      simde_mm_set_epi32(         15,          13,          14,          11) },
+    { simde_mm_set_epi32(  323338036, -1037539631,   484516214, -1935393123),
+      simde_mm_set_epi64x(0, 15),
+      simde_mm_set_epi32(       9867,       99408,       14786,       72008) },
+    { simde_mm_set_epi32( -596179147,     9538632,  -426490135, -1561047438),
+      simde_mm_set_epi64x(0, 16),
+      simde_mm_set_epi32(      56439,         145,       59028,       41716) },
+    { simde_mm_set_epi32(-1245313417,  -429548599,  1226886909,  2122282392),
+      simde_mm_set_epi64x(0, 16),
+      simde_mm_set_epi32(      46534,       58981,       18720,       32383) },
+    { simde_mm_set_epi32( -743536627, -2107724544,   755842503, -1433489493),
+      simde_mm_set_epi64x(0, 3),
+      simde_mm_set_epi32(  443928833,   273405344,    94480312,   357684725) },
+    { simde_mm_set_epi32(  561855705, -1216333211, -1655325063,  1742904494),
+      simde_mm_set_epi64x(0, 14),
+      simde_mm_set_epi32(      34292,      187904,      161110,      106378) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_srl_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_srl_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(-3104888973808490197), INT64_C(-6711415135979462468)),
+      simde_mm_set_epi64x(0, 13),
+      simde_mm_set_epi64x(INT64_C(    1872785046374641), INT64_C(    1432535270719005)) },
+    { simde_mm_set_epi64x(INT64_C(-5469716981186837039), INT64_C(-6268806476821866219)),
+      simde_mm_set_epi64x(0, 19),
+      simde_mm_set_epi64x(INT64_C(      24751714882893), INT64_C(      23227572625899)) },
+    { simde_mm_set_epi64x(INT64_C(-4242103915481010436), INT64_C( 2298642203958984986)),
+      simde_mm_set_epi64x(0, 14),
+      simde_mm_set_epi64x(INT64_C(     866982431532503), INT64_C(     140297986081481)) },
+    { simde_mm_set_epi64x(INT64_C( 1696097798312846664), INT64_C(-8293738143795170370)),
+      simde_mm_set_epi64x(0, 25),
+      simde_mm_set_epi64x(INT64_C(         50547653386), INT64_C(        302583155927)) },
+    { simde_mm_set_epi64x(INT64_C(-6950637418483067718), INT64_C(-7346613711747449470)),
+      simde_mm_set_epi64x(0, 44),
+      simde_mm_set_epi64x(INT64_C(              653478), INT64_C(              630969)) },
+    { simde_mm_set_epi64x(INT64_C( 7184191535918652458), INT64_C( 1926708042475621219)),
+      simde_mm_set_epi64x(0, 39),
+      simde_mm_set_epi64x(INT64_C(            13067968), INT64_C(             3504661)) },
+    { simde_mm_set_epi64x(INT64_C(-2735960619421606127), INT64_C(-8468007357031904514)),
+      simde_mm_set_epi64x(0, 9),
+      simde_mm_set_epi64x(INT64_C(   30685123934156143), INT64_C(   19489720149761029)) },
+    { simde_mm_set_epi64x(INT64_C(-1988963069056043340), INT64_C(-9217194976464802096)),
+      simde_mm_set_epi64x(0, 35),
+      simde_mm_set_epi64x(INT64_C(           478984468), INT64_C(           268615232)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_srl_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_comieq_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -80.55,     46.38),
+      simde_mm_set_pd(   -77.57,     46.38),
+      1 },
+    { simde_mm_set_pd(    61.05,     47.70),
+      simde_mm_set_pd(    85.41,    -69.56),
+      0 },
+    { simde_mm_set_pd(    32.19,     79.32),
+      simde_mm_set_pd(   -76.60,     82.08),
+      0 },
+    { simde_mm_set_pd(    -8.69,    -57.64),
+      simde_mm_set_pd(   -97.05,    -11.32),
+      0 },
+    { simde_mm_set_pd(    50.58,     81.96),
+      simde_mm_set_pd(     8.74,    -14.11),
+      0 },
+    { simde_mm_set_pd(    15.87,    -40.96),
+      simde_mm_set_pd(    99.08,    -40.96),
+      1 },
+    { simde_mm_set_pd(     2.88,     53.56),
+      simde_mm_set_pd(   -12.39,     53.56),
+      1 },
+    { simde_mm_set_pd(   -80.12,    -49.53),
+      simde_mm_set_pd(    91.65,     30.11),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_comieq_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_comige_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    37.87,     59.19),
+      simde_mm_set_pd(    50.25,    -97.90),
+      1 },
+    { simde_mm_set_pd(    25.66,     -5.60),
+      simde_mm_set_pd(    36.59,    -31.46),
+      1 },
+    { simde_mm_set_pd(    30.80,     74.89),
+      simde_mm_set_pd(   -93.30,     74.89),
+      1 },
+    { simde_mm_set_pd(    45.13,    -14.28),
+      simde_mm_set_pd(    -5.97,    -14.28),
+      1 },
+    { simde_mm_set_pd(    54.59,     50.91),
+      simde_mm_set_pd(    38.36,     50.91),
+      1 },
+    { simde_mm_set_pd(    88.97,    -98.96),
+      simde_mm_set_pd(   -30.56,     63.00),
+      0 },
+    { simde_mm_set_pd(   -83.56,    -28.97),
+      simde_mm_set_pd(   -55.81,    -28.97),
+      1 },
+    { simde_mm_set_pd(   -40.48,    -98.54),
+      simde_mm_set_pd(   -47.44,    -98.54),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_comige_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_comigt_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    70.92,    -47.74),
+      simde_mm_set_pd(   -80.03,     53.14),
+      0 },
+    { simde_mm_set_pd(    26.07,    -90.86),
+      simde_mm_set_pd(   -36.24,    -90.86),
+      0 },
+    { simde_mm_set_pd(    37.40,     -4.20),
+      simde_mm_set_pd(   -90.42,     26.74),
+      0 },
+    { simde_mm_set_pd(    43.04,    -63.18),
+      simde_mm_set_pd(    13.63,    -63.18),
+      0 },
+    { simde_mm_set_pd(   -85.46,     24.47),
+      simde_mm_set_pd(    15.15,    -91.93),
+      1 },
+    { simde_mm_set_pd(    19.76,    -83.55),
+      simde_mm_set_pd(   -60.12,    -83.55),
+      0 },
+    { simde_mm_set_pd(   -29.60,    -95.82),
+      simde_mm_set_pd(    51.73,    -95.82),
+      0 },
+    { simde_mm_set_pd(   -95.06,     99.59),
+      simde_mm_set_pd(    19.43,     -5.29),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_comigt_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_comile_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -48.33,    -19.62),
+      simde_mm_set_pd(    44.74,    -82.99),
+      0 },
+    { simde_mm_set_pd(   -53.22,     25.47),
+      simde_mm_set_pd(   -23.31,     25.47),
+      1 },
+    { simde_mm_set_pd(    10.60,      8.21),
+      simde_mm_set_pd(   -24.05,      8.21),
+      1 },
+    { simde_mm_set_pd(   -42.33,     39.69),
+      simde_mm_set_pd(     2.10,     39.69),
+      1 },
+    { simde_mm_set_pd(    29.69,    -58.75),
+      simde_mm_set_pd(     2.32,    -58.75),
+      1 },
+    { simde_mm_set_pd(    50.51,    -38.53),
+      simde_mm_set_pd(   -10.07,    -93.43),
+      0 },
+    { simde_mm_set_pd(    41.09,      7.52),
+      simde_mm_set_pd(   -59.23,      7.52),
+      1 },
+    { simde_mm_set_pd(    94.49,    -57.00),
+      simde_mm_set_pd(   -82.19,    -57.00),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_comile_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_comilt_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -22.08,    -44.35),
+      simde_mm_set_pd(    -9.54,     34.96),
+      1 },
+    { simde_mm_set_pd(     5.72,    -40.26),
+      simde_mm_set_pd(    20.74,     81.14),
+      1 },
+    { simde_mm_set_pd(   -90.81,    -54.26),
+      simde_mm_set_pd(   -80.72,    -54.26),
+      0 },
+    { simde_mm_set_pd(    13.48,    -90.74),
+      simde_mm_set_pd(    31.25,     35.59),
+      1 },
+    { simde_mm_set_pd(    23.44,    -91.32),
+      simde_mm_set_pd(    90.23,     25.31),
+      1 },
+    { simde_mm_set_pd(   -33.54,     37.41),
+      simde_mm_set_pd(   -89.27,     88.15),
+      1 },
+    { simde_mm_set_pd(    87.82,     82.50),
+      simde_mm_set_pd(    77.02,    -20.30),
+      0 },
+    { simde_mm_set_pd(    31.13,     97.33),
+      simde_mm_set_pd(    44.74,     97.33),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_comilt_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_comineq_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    64.46,     23.45),
+      simde_mm_set_pd(    31.42,     23.45),
+      0 },
+    { simde_mm_set_pd(    -7.26,     27.93),
+      simde_mm_set_pd(   -73.95,     27.93),
+      0 },
+    { simde_mm_set_pd(   -57.74,     78.69),
+      simde_mm_set_pd(    34.35,    -90.92),
+      1 },
+    { simde_mm_set_pd(   -85.66,    -79.74),
+      simde_mm_set_pd(    80.20,    -65.65),
+      1 },
+    { simde_mm_set_pd(   -48.18,     37.74),
+      simde_mm_set_pd(   -33.54,     37.74),
+      0 },
+    { simde_mm_set_pd(   -48.01,     85.80),
+      simde_mm_set_pd(   -88.70,     85.80),
+      0 },
+    { simde_mm_set_pd(    37.84,     56.67),
+      simde_mm_set_pd(    74.08,    -20.13),
+      1 },
+    { simde_mm_set_pd(   -40.83,    -18.04),
+      simde_mm_set_pd(    87.60,    -18.04),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_comineq_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_div_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   579.85,    925.95),
+      simde_mm_set_pd(  -267.80,   -176.87),
+      simde_mm_set_pd(    -2.17,     -5.24) },
+    { simde_mm_set_pd(    79.80,    373.02),
+      simde_mm_set_pd(   -43.07,   -346.15),
+      simde_mm_set_pd(    -1.85,     -1.08) },
+    { simde_mm_set_pd(  -768.03,   -880.53),
+      simde_mm_set_pd(   333.12,   -824.29),
+      simde_mm_set_pd(    -2.31,      1.07) },
+    { simde_mm_set_pd(   217.41,    827.85),
+      simde_mm_set_pd(  -165.24,    328.47),
+      simde_mm_set_pd(    -1.32,      2.52) },
+    { simde_mm_set_pd(   593.70,    519.84),
+      simde_mm_set_pd(   329.66,    925.32),
+      simde_mm_set_pd(     1.80,      0.56) },
+    { simde_mm_set_pd(   836.26,    396.36),
+      simde_mm_set_pd(   469.24,   -115.89),
+      simde_mm_set_pd(     1.78,     -3.42) },
+    { simde_mm_set_pd(    41.90,   -270.63),
+      simde_mm_set_pd(   182.75,    745.23),
+      simde_mm_set_pd(     0.23,     -0.36) },
+    { simde_mm_set_pd(   371.10,    915.11),
+      simde_mm_set_pd(  -630.30,    915.15),
+      simde_mm_set_pd(    -0.59,      1.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_div_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_div_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(  -327.13,    702.35),
+      simde_mm_set_pd(  -775.87,   -424.97),
+      simde_mm_set_pd(  -327.13,     -1.65) },
+    { simde_mm_set_pd(   841.48,    192.09),
+      simde_mm_set_pd(  -844.82,    980.00),
+      simde_mm_set_pd(   841.48,      0.20) },
+    { simde_mm_set_pd(  -714.78,     22.79),
+      simde_mm_set_pd(  -172.47,   -992.85),
+      simde_mm_set_pd(  -714.78,     -0.02) },
+    { simde_mm_set_pd(  -392.76,     -6.63),
+      simde_mm_set_pd(  -505.83,   -579.56),
+      simde_mm_set_pd(  -392.76,      0.01) },
+    { simde_mm_set_pd(   511.68,    434.80),
+      simde_mm_set_pd(  -873.45,     -1.15),
+      simde_mm_set_pd(   511.68,   -378.09) },
+    { simde_mm_set_pd(  -217.24,   -854.67),
+      simde_mm_set_pd(  -564.25,    829.31),
+      simde_mm_set_pd(  -217.24,     -1.03) },
+    { simde_mm_set_pd(   797.73,   -788.42),
+      simde_mm_set_pd(  -619.76,   -232.09),
+      simde_mm_set_pd(   797.73,      3.40) },
+    { simde_mm_set_pd(  -103.69,   -501.64),
+      simde_mm_set_pd(   300.75,    230.37),
+      simde_mm_set_pd(  -103.69,     -2.18) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_div_sd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_move_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C( 8264854761125944234), INT64_C( 7961933098206373446)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C( 7961933098206373446)) },
+    { simde_mm_set_epi64x(INT64_C( 8281584593952171176), INT64_C( -130031302265986141)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C( -130031302265986141)) },
+    { simde_mm_set_epi64x(INT64_C( 1139263109219731468), INT64_C( 2901333507869800279)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C( 2901333507869800279)) },
+    { simde_mm_set_epi64x(INT64_C( 5063592529253892264), INT64_C( 1333711967204070300)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C( 1333711967204070300)) },
+    { simde_mm_set_epi64x(INT64_C( 2311580787077708114), INT64_C(-2632992586879396957)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(-2632992586879396957)) },
+    { simde_mm_set_epi64x(INT64_C( 6897391377109396446), INT64_C( -655752405447256168)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C( -655752405447256168)) },
+    { simde_mm_set_epi64x(INT64_C(-2219293629794087559), INT64_C( 8831786600861275112)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C( 8831786600861275112)) },
+    { simde_mm_set_epi64x(INT64_C( -402981851592842890), INT64_C(-1070358210677756453)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(-1070358210677756453)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_move_epi64(test_vec[i].a);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_move_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   364.20,    623.76),
+      simde_mm_set_pd(  -514.51,   -886.22),
+      simde_mm_set_pd(   364.20,   -886.22) },
+    { simde_mm_set_pd(    61.89,   -421.81),
+      simde_mm_set_pd(   385.85,    696.56),
+      simde_mm_set_pd(    61.89,    696.56) },
+    { simde_mm_set_pd(  -192.25,     76.35),
+      simde_mm_set_pd(  -613.69,   -282.19),
+      simde_mm_set_pd(  -192.25,   -282.19) },
+    { simde_mm_set_pd(  -676.62,    993.71),
+      simde_mm_set_pd(  -365.04,   -612.76),
+      simde_mm_set_pd(  -676.62,   -612.76) },
+    { simde_mm_set_pd(  -681.84,   -870.88),
+      simde_mm_set_pd(  -709.65,   -790.84),
+      simde_mm_set_pd(  -681.84,   -790.84) },
+    { simde_mm_set_pd(  -471.04,    -42.20),
+      simde_mm_set_pd(  -783.41,   -813.08),
+      simde_mm_set_pd(  -471.04,   -813.08) },
+    { simde_mm_set_pd(  -224.14,    305.29),
+      simde_mm_set_pd(   631.08,   -638.63),
+      simde_mm_set_pd(  -224.14,   -638.63) },
+    { simde_mm_set_pd(   828.73,   -425.93),
+      simde_mm_set_pd(  -655.37,    746.05),
+      simde_mm_set_pd(   828.73,    746.05) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_move_sd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_movemask_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    int32_t r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   344.04,   -624.40),
+      1 },
+    { simde_mm_set_pd(   596.10,    916.68),
+      0 },
+    { simde_mm_set_pd(  -993.64,   -410.26),
+      3 },
+    { simde_mm_set_pd(   190.86,   -800.18),
+      1 },
+    { simde_mm_set_pd(    15.68,   -163.12),
+      1 },
+    { simde_mm_set_pd(   627.59,   -175.09),
+      1 },
+    { simde_mm_set_pd(    57.75,   -624.26),
+      1 },
+    { simde_mm_set_pd(   888.75,   -674.71),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm_movemask_pd(test_vec[i].a);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_or_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   944.31,    -61.38),
+      simde_mm_set_pd(   -84.24,   -992.20),
+      simde_x_mm_set_epu64x(UINT64_C(0xc0dd8f7ee9f7ee9f), UINT64_C(0xc0cfb1bbdf9bbdfb)) },
+    { simde_mm_set_pd(   701.06,   -519.48),
+      simde_mm_set_pd(   854.60,    440.76),
+      simde_x_mm_set_epu64x(UINT64_C(0x408ffcfeedcfeedd), UINT64_C(0xc0fbbffffffffffc)) },
+    { simde_mm_set_pd(   440.85,    335.34),
+      simde_mm_set_pd(   111.12,    199.00),
+      simde_x_mm_set_epu64x(UINT64_C(0x407bcfbf9dfbf9da), UINT64_C(0x407cf570a3d70a3d)) },
+    { simde_mm_set_pd(  -434.15,     78.19),
+      simde_mm_set_pd(   880.57,   -691.37),
+      simde_x_mm_set_epu64x(UINT64_C(0xc0fba6ef7e6ef7e7), UINT64_C(0xc0d79efdf7cfdf7d)) },
+    { simde_mm_set_pd(   -36.81,    846.98),
+      simde_mm_set_pd(   627.40,    313.89),
+      simde_x_mm_set_epu64x(UINT64_C(0xc0c3ffbf377bf37b), UINT64_C(0x40fbffff7abff7ae)) },
+    { simde_mm_set_pd(  -567.95,    314.77),
+      simde_mm_set_pd(  -462.02,   -664.41),
+      simde_x_mm_set_epu64x(UINT64_C(0xc0fdffd9fb9d9fba), UINT64_C(0xc0f7ef57ef957ef9)) },
+    { simde_mm_set_pd(   805.22,    673.33),
+      simde_mm_set_pd(   476.99,     64.93),
+      simde_x_mm_set_epu64x(UINT64_C(0x40fdefd78f7d78f6), UINT64_C(0x40d53ba7dfba7dfd)) },
+    { simde_mm_set_pd(   425.83,   -980.98),
+      simde_mm_set_pd(  -491.80,   -229.39),
+      simde_x_mm_set_epu64x(UINT64_C(0xc07ebdcfeedcfeed), UINT64_C(0xc0eeafffeb7ffeb4)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_castpd_si128(simde_mm_or_pd(test_vec[i].a, test_vec[i].b));
+    simde_assert_m128i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sqrt_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   672.35,    471.35),
+      simde_mm_set_pd(    25.93,     21.71) },
+    { simde_mm_set_pd(   332.65,      8.68),
+      simde_mm_set_pd(    18.24,      2.95) },
+    { simde_mm_set_pd(   545.77,    458.44),
+      simde_mm_set_pd(    23.36,     21.41) },
+    { simde_mm_set_pd(    67.06,    614.24),
+      simde_mm_set_pd(     8.19,     24.78) },
+    { simde_mm_set_pd(   618.94,    823.13),
+      simde_mm_set_pd(    24.88,     28.69) },
+    { simde_mm_set_pd(   992.80,    205.61),
+      simde_mm_set_pd(    31.51,     14.34) },
+    { simde_mm_set_pd(    83.76,    796.22),
+      simde_mm_set_pd(     9.15,     28.22) },
+    { simde_mm_set_pd(   644.65,    461.69),
+      simde_mm_set_pd(    25.39,     21.49) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_sqrt_pd(test_vec[i].a);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sqrt_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(     7.31,    923.88),
+      simde_mm_set_pd(   405.81,    315.03),
+      simde_mm_set_pd(     7.31,     17.75) },
+    { simde_mm_set_pd(   964.99,    573.64),
+      simde_mm_set_pd(   255.43,    403.25),
+      simde_mm_set_pd(   964.99,     20.08) },
+    { simde_mm_set_pd(   845.70,    347.59),
+      simde_mm_set_pd(   641.58,    936.57),
+      simde_mm_set_pd(   845.70,     30.60) },
+    { simde_mm_set_pd(    71.50,    589.00),
+      simde_mm_set_pd(   415.81,    194.94),
+      simde_mm_set_pd(    71.50,     13.96) },
+    { simde_mm_set_pd(    52.38,    458.16),
+      simde_mm_set_pd(   373.84,    591.68),
+      simde_mm_set_pd(    52.38,     24.32) },
+    { simde_mm_set_pd(   512.54,    865.69),
+      simde_mm_set_pd(   343.78,    106.83),
+      simde_mm_set_pd(   512.54,     10.34) },
+    { simde_mm_set_pd(   475.00,    257.23),
+      simde_mm_set_pd(   191.99,    577.67),
+      simde_mm_set_pd(   475.00,     24.03) },
+    { simde_mm_set_pd(   800.86,    389.89),
+      simde_mm_set_pd(   125.69,    163.74),
+      simde_mm_set_pd(   800.86,     12.80) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_sqrt_sd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ucomieq_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    11.16,    -52.73),
+      simde_mm_set_pd(    98.92,    -31.21),
+      0 },
+    { simde_mm_set_pd(    25.63,     74.57),
+      simde_mm_set_pd(    15.59,     74.57),
+      1 },
+    { simde_mm_set_pd(    61.22,    -45.37),
+      simde_mm_set_pd(   -13.86,    -45.37),
+      1 },
+    { simde_mm_set_pd(   -91.74,    -70.45),
+      simde_mm_set_pd(   -93.41,    -70.45),
+      1 },
+    { simde_mm_set_pd(    28.65,     16.39),
+      simde_mm_set_pd(    60.41,     16.39),
+      1 },
+    { simde_mm_set_pd(     9.58,     73.27),
+      simde_mm_set_pd(    85.73,     73.27),
+      1 },
+    { simde_mm_set_pd(   -63.08,    -51.44),
+      simde_mm_set_pd(    20.41,    -51.44),
+      1 },
+    { simde_mm_set_pd(    72.60,    -44.00),
+      simde_mm_set_pd(     3.78,    -44.00),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_ucomieq_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ucomige_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    80.71,     96.10),
+      simde_mm_set_pd(    48.04,    -92.24),
+      1 },
+    { simde_mm_set_pd(    -6.59,     50.32),
+      simde_mm_set_pd(    48.65,     50.32),
+      1 },
+    { simde_mm_set_pd(   -97.85,    -83.84),
+      simde_mm_set_pd(    39.18,    -83.84),
+      1 },
+    { simde_mm_set_pd(    30.04,    -16.77),
+      simde_mm_set_pd(    18.44,    -18.73),
+      1 },
+    { simde_mm_set_pd(     4.59,     93.19),
+      simde_mm_set_pd(   -70.59,     85.78),
+      1 },
+    { simde_mm_set_pd(    86.59,    -55.43),
+      simde_mm_set_pd(   -55.55,     59.06),
+      0 },
+    { simde_mm_set_pd(    -4.90,    -85.97),
+      simde_mm_set_pd(   -84.92,    -85.97),
+      1 },
+    { simde_mm_set_pd(    74.03,     44.24),
+      simde_mm_set_pd(   -59.51,     44.24),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_ucomige_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ucomigt_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    15.07,     94.57),
+      simde_mm_set_pd(    63.63,     59.47),
+      1 },
+    { simde_mm_set_pd(    -0.23,    -89.36),
+      simde_mm_set_pd(   -29.95,    -42.71),
+      0 },
+    { simde_mm_set_pd(    27.65,     99.35),
+      simde_mm_set_pd(    73.89,    -93.77),
+      1 },
+    { simde_mm_set_pd(   -98.49,    -65.37),
+      simde_mm_set_pd(    20.21,    -65.37),
+      0 },
+    { simde_mm_set_pd(    24.51,      0.43),
+      simde_mm_set_pd(   -77.11,     74.26),
+      0 },
+    { simde_mm_set_pd(    53.40,    -89.70),
+      simde_mm_set_pd(    27.55,     62.76),
+      0 },
+    { simde_mm_set_pd(    23.52,     34.18),
+      simde_mm_set_pd(     9.43,     34.18),
+      0 },
+    { simde_mm_set_pd(     6.00,     41.70),
+      simde_mm_set_pd(   -12.91,     50.21),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_ucomigt_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ucomile_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -34.27,    -22.22),
+      simde_mm_set_pd(    23.70,    -31.23),
+      0 },
+    { simde_mm_set_pd(   -54.87,     63.99),
+      simde_mm_set_pd(    -1.77,     63.99),
+      1 },
+    { simde_mm_set_pd(    51.32,     22.89),
+      simde_mm_set_pd(   -34.44,     66.49),
+      1 },
+    { simde_mm_set_pd(    84.03,     -1.12),
+      simde_mm_set_pd(    -2.45,     -1.12),
+      1 },
+    { simde_mm_set_pd(   -60.16,     48.08),
+      simde_mm_set_pd(    79.93,    -38.75),
+      0 },
+    { simde_mm_set_pd(    98.23,     71.75),
+      simde_mm_set_pd(    64.78,     71.75),
+      1 },
+    { simde_mm_set_pd(    27.70,    -21.78),
+      simde_mm_set_pd(   -32.87,    -21.78),
+      1 },
+    { simde_mm_set_pd(    36.72,    -49.27),
+      simde_mm_set_pd(   -93.60,    -27.57),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_ucomile_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ucomilt_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -39.10,     21.74),
+      simde_mm_set_pd(    71.80,     21.74),
+      0 },
+    { simde_mm_set_pd(    95.45,     20.15),
+      simde_mm_set_pd(    -6.10,     72.16),
+      1 },
+    { simde_mm_set_pd(   -46.29,     70.36),
+      simde_mm_set_pd(   -62.17,     70.36),
+      0 },
+    { simde_mm_set_pd(    13.47,     99.91),
+      simde_mm_set_pd(    26.79,    -75.74),
+      0 },
+    { simde_mm_set_pd(   -73.88,    -76.31),
+      simde_mm_set_pd(   -23.54,     15.28),
+      1 },
+    { simde_mm_set_pd(    21.04,     68.56),
+      simde_mm_set_pd(    72.70,     68.56),
+      0 },
+    { simde_mm_set_pd(    53.34,    -71.37),
+      simde_mm_set_pd(    98.71,    -71.37),
+      0 },
+    { simde_mm_set_pd(    91.64,     64.37),
+      simde_mm_set_pd(   -51.59,    -42.97),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_ucomilt_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ucomineq_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -68.97,     54.84),
+      simde_mm_set_pd(    71.69,    -33.22),
+      1 },
+    { simde_mm_set_pd(   -88.87,     78.20),
+      simde_mm_set_pd(    56.39,     78.20),
+      0 },
+    { simde_mm_set_pd(    -5.74,     74.60),
+      simde_mm_set_pd(    25.98,     74.60),
+      0 },
+    { simde_mm_set_pd(    98.25,    -33.33),
+      simde_mm_set_pd(   -67.64,    -33.33),
+      0 },
+    { simde_mm_set_pd(    67.43,      2.17),
+      simde_mm_set_pd(    96.11,    -15.97),
+      1 },
+    { simde_mm_set_pd(   -19.60,     75.81),
+      simde_mm_set_pd(     3.67,     93.45),
+      1 },
+    { simde_mm_set_pd(    55.23,     95.15),
+      simde_mm_set_pd(    60.48,    -54.60),
+      1 },
+    { simde_mm_set_pd(    43.43,    -86.65),
+      simde_mm_set_pd(     8.06,     90.89),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_ucomineq_sd(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_xor_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(  -652.33,   -468.78),
+      simde_mm_set_pd(  -178.48,    -41.29),
+      simde_x_mm_set_epu64x(UINT64_C(0x00e22dfffffffffe), UINT64_C(0x0039e96459164591)) },
+    { simde_mm_set_pd(    -4.69,    140.77),
+      simde_mm_set_pd(  -219.32,    110.79),
+      simde_x_mm_set_epu64x(UINT64_C(0x0079a8b22c8b22c9), UINT64_C(0x003a2a2c8b22c8b2)) },
+    { simde_mm_set_pd(  -733.41,    459.86),
+      simde_mm_set_pd(   -86.73,   -480.70),
+      simde_x_mm_set_epu64x(UINT64_C(0x00d345fffffffffe), UINT64_C(0x8002b6f1bc6f1bc5)) },
+    { simde_mm_set_pd(  -600.47,   -285.96),
+      simde_mm_set_pd(   959.12,    414.97),
+      simde_x_mm_set_epu64x(UINT64_C(0x800f3b374dd374df), UINT64_C(0x800830d9364d9363)) },
+    { simde_mm_set_pd(   106.98,   -250.53),
+      simde_mm_set_pd(   168.83,   -256.72),
+      simde_x_mm_set_epu64x(UINT64_C(0x003fa4370dc370dc), UINT64_C(0x001f5b70dc370dc5)) },
+    { simde_mm_set_pd(   711.25,    543.64),
+      simde_mm_set_pd(  -406.34,    558.73),
+      simde_x_mm_set_epu64x(UINT64_C(0x80ff5f70a3d70a3d), UINT64_C(0x000188c9b26c9b21)) },
+    { simde_mm_set_pd(  -592.27,   -556.72),
+      simde_mm_set_pd(   694.37,    639.34),
+      simde_x_mm_set_epu64x(UINT64_C(0x800730dd374dd375), UINT64_C(0x80029f7adeb7ade9)) },
+    { simde_mm_set_pd(  -747.56,    561.17),
+      simde_mm_set_pd(  -502.30,    710.31),
+      simde_x_mm_set_epu64x(UINT64_C(0x00f838b62d8b62d9), UINT64_C(0x0007bb26c9b26c9b)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_castpd_si128(simde_mm_xor_pd(test_vec[i].a, test_vec[i].b));
+    simde_assert_m128i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskmoveu_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i mask;
+    simde__m128i dst;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0xce, 0x91, 0xe5, 0x90, 0x05, 0x0c, 0x36, 0x8d,
+			0x77, 0xae, 0x0b, 0xf3, 0xee, 0xb9, 0x02, 0x6e),
+      simde_mm_set_epi8(0xe1, 0x44, 0xd6, 0xe8, 0x79, 0x2e, 0x1a, 0xf4,
+			0x16, 0xe0, 0xa1, 0xc5, 0x1d, 0xce, 0x4e, 0x7b),
+      simde_mm_set_epi8(0x74, 0xff, 0xb8, 0xe8, 0x85, 0x47, 0x56, 0xd7,
+			0x4e, 0x85, 0xb0, 0xd6, 0xa9, 0xd3, 0x49, 0x42),
+      simde_mm_set_epi8(0xce, 0xff, 0xe5, 0x90, 0x85, 0x47, 0x56, 0x8d,
+			0x4e, 0xae, 0x0b, 0xf3, 0xa9, 0xb9, 0x49, 0x42) },
+    { simde_mm_set_epi8(0x99, 0xe8, 0x3f, 0x5a, 0x50, 0x79, 0xfc, 0x5d,
+			0x79, 0xf8, 0xad, 0xa7, 0xc4, 0x9b, 0xd6, 0x3b),
+      simde_mm_set_epi8(0x39, 0xb1, 0x6b, 0x71, 0x2d, 0xcf, 0xc8, 0xae,
+			0xfc, 0x38, 0x7d, 0xfa, 0xda, 0xbf, 0x55, 0x85),
+      simde_mm_set_epi8(0x50, 0xd5, 0x9c, 0x0a, 0x21, 0x20, 0x82, 0x65,
+			0x0e, 0xc7, 0x6d, 0x00, 0x9b, 0x7e, 0x9a, 0x31),
+      simde_mm_set_epi8(0x50, 0xe8, 0x9c, 0x0a, 0x21, 0x79, 0xfc, 0x5d,
+			0x79, 0xc7, 0x6d, 0xa7, 0xc4, 0x9b, 0x9a, 0x3b) },
+    { simde_mm_set_epi8(0xb3, 0xd3, 0xcd, 0xbd, 0x44, 0xc2, 0x69, 0xe7,
+			0xcd, 0x02, 0xed, 0x7c, 0x81, 0xe8, 0xc1, 0xfa),
+      simde_mm_set_epi8(0x6e, 0x1e, 0x6c, 0xed, 0x70, 0x21, 0x34, 0x98,
+			0xda, 0x7f, 0x69, 0x93, 0x8e, 0x2c, 0x98, 0x7d),
+      simde_mm_set_epi8(0x4c, 0x36, 0xd0, 0xdb, 0x05, 0xb0, 0xc0, 0xfc,
+			0xb2, 0x7a, 0x78, 0x86, 0x91, 0xe4, 0x7f, 0x62),
+      simde_mm_set_epi8(0x4c, 0x36, 0xd0, 0xbd, 0x05, 0xb0, 0xc0, 0xe7,
+			0xcd, 0x7a, 0x78, 0x7c, 0x81, 0xe4, 0xc1, 0x62) },
+    { simde_mm_set_epi8(0x9b, 0xa1, 0x26, 0xcd, 0xff, 0xff, 0x0c, 0xbc,
+			0x8f, 0xb3, 0x73, 0xff, 0xb8, 0x1d, 0xe7, 0x1b),
+      simde_mm_set_epi8(0x11, 0x49, 0x94, 0x17, 0xec, 0x88, 0xe0, 0xda,
+			0xe2, 0x88, 0x56, 0xd2, 0x15, 0xed, 0x48, 0xb3),
+      simde_mm_set_epi8(0x34, 0x14, 0xc4, 0x7c, 0x75, 0x67, 0xed, 0xb8,
+			0x8e, 0xab, 0x2f, 0x9a, 0x5b, 0x41, 0x9a, 0x43),
+      simde_mm_set_epi8(0x34, 0x14, 0x26, 0x7c, 0xff, 0xff, 0x0c, 0xbc,
+			0x8f, 0xb3, 0x2f, 0xff, 0x5b, 0x1d, 0x9a, 0x1b) },
+    { simde_mm_set_epi8(0xb2, 0x2e, 0x1e, 0xa5, 0x58, 0x2e, 0xe0, 0x29,
+			0x4c, 0xf8, 0x41, 0xee, 0x83, 0x7d, 0xa8, 0x40),
+      simde_mm_set_epi8(0xd7, 0x8e, 0x2a, 0x2f, 0x7f, 0x10, 0x4e, 0xb3,
+			0x63, 0xe9, 0x38, 0x29, 0x4e, 0xf3, 0x49, 0x6f),
+      simde_mm_set_epi8(0x27, 0x3b, 0x10, 0xa6, 0x00, 0xeb, 0x30, 0x2b,
+			0xb5, 0xfe, 0xfd, 0xa6, 0xe2, 0x9b, 0x2a, 0xf0),
+      simde_mm_set_epi8(0xb2, 0x2e, 0x10, 0xa6, 0x00, 0xeb, 0x30, 0x29,
+			0xb5, 0xf8, 0xfd, 0xa6, 0xe2, 0x7d, 0x2a, 0xf0) },
+    { simde_mm_set_epi8(0xc2, 0xdd, 0xa0, 0xeb, 0xe6, 0xd8, 0x2e, 0xf0,
+			0x45, 0xad, 0x6d, 0x01, 0x25, 0xa9, 0x86, 0xaa),
+      simde_mm_set_epi8(0x14, 0xbc, 0x79, 0xe2, 0xb6, 0x74, 0xd2, 0x63,
+			0x0b, 0x16, 0x63, 0x0d, 0xb7, 0x26, 0x32, 0x25),
+      simde_mm_set_epi8(0x57, 0x2b, 0xfb, 0x80, 0x6a, 0x5f, 0x9c, 0x78,
+			0x55, 0x14, 0xfa, 0xe8, 0x0d, 0x05, 0x78, 0xf0),
+      simde_mm_set_epi8(0x57, 0xdd, 0xfb, 0xeb, 0xe6, 0x5f, 0x2e, 0x78,
+			0x55, 0x14, 0xfa, 0xe8, 0x25, 0x05, 0x78, 0xf0) },
+    { simde_mm_set_epi8(0x1d, 0x57, 0xff, 0x03, 0xff, 0x11, 0xc2, 0xf7,
+			0x79, 0x3e, 0x9e, 0x8a, 0xbc, 0x72, 0x87, 0xdc),
+      simde_mm_set_epi8(0x55, 0x87, 0x18, 0x86, 0xe2, 0x39, 0x33, 0x81,
+			0x6c, 0x76, 0xad, 0x45, 0xca, 0x30, 0xb3, 0xd6),
+      simde_mm_set_epi8(0x00, 0x16, 0x35, 0x1a, 0x36, 0x40, 0x5b, 0xf0,
+			0x31, 0xb6, 0xd9, 0xef, 0x68, 0x8d, 0x35, 0xb7),
+      simde_mm_set_epi8(0x00, 0x57, 0x35, 0x03, 0xff, 0x40, 0x5b, 0xf7,
+			0x31, 0xb6, 0x9e, 0xef, 0xbc, 0x8d, 0x87, 0xdc) },
+    { simde_mm_set_epi8(0x38, 0xd4, 0xf4, 0x56, 0x25, 0x6e, 0x71, 0xb6,
+			0x94, 0x55, 0x2d, 0x7c, 0xfa, 0x68, 0xc8, 0x12),
+      simde_mm_set_epi8(0x07, 0x3c, 0xa7, 0xe2, 0x3d, 0x5f, 0x71, 0xc4,
+			0xbf, 0x49, 0x86, 0x8f, 0x63, 0x4d, 0x23, 0x9b),
+      simde_mm_set_epi8(0xcc, 0x3f, 0xce, 0x8a, 0xe5, 0x47, 0x50, 0x05,
+			0xff, 0x4a, 0xb7, 0xe1, 0x0a, 0x1f, 0x64, 0x49),
+      simde_mm_set_epi8(0xcc, 0x3f, 0xf4, 0x56, 0xe5, 0x47, 0x50, 0xb6,
+			0x94, 0x4a, 0x2d, 0x7c, 0x0a, 0x1f, 0x64, 0x12) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int8_t dst[16];
+    simde_mm_storeu_si128((simde__m128i*) dst, test_vec[i].dst);
+    simde_mm_maskmoveu_si128(test_vec[i].a, test_vec[i].mask, dst);
+    simde__m128i r = simde_mm_loadu_si128((simde__m128i*) dst);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_clflush(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  /* Flushing a line only evicts it from the cache; the data must still
+     be there afterwards. */
+  SIMDE__ALIGN(64) int32_t buf[64];
+  for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+    buf[i] = (int32_t) (i * 7);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i += 16) {
+    simde_mm_clflush(&(buf[i]));
+  }
+  simde_mm_mfence();
+
+  for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+    munit_assert_int32(buf[i], ==, (int32_t) (i * 7));
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_lfence(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  SIMDE__ALIGN(16) int32_t buf[4] = { 1, 2, 3, 4 };
+  simde__m128i a = simde_mm_load_si128((simde__m128i*) buf);
+  simde_mm_lfence();
+  simde__m128i b = simde_mm_load_si128((simde__m128i*) buf);
+  simde__m128i e = simde_mm_set_epi32(4, 3, 2, 1);
+  simde_assert_m128i_i32(a, ==, b);
+  simde_assert_m128i_i32(b, ==, e);
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mfence(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  SIMDE__ALIGN(16) int32_t buf[4] = { 0, 0, 0, 0 };
+  simde__m128i a = simde_mm_set_epi32(-4, 3, -2, 1);
+  simde_mm_stream_si128((simde__m128i*) buf, a);
+  simde_mm_mfence();
+  simde__m128i r = simde_mm_load_si128((simde__m128i*) buf);
+  simde_assert_m128i_i32(r, ==, a);
+
+  return MUNIT_OK;
+}
+
 #define SIMDE_TEST_FUNC(name) \
   { (char*) "/"#name, test_simde_##name, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 
@@ -7301,6 +8770,42 @@ static MunitTest test_suite_tests[] = {
 
   SIMDE_TEST_FUNC(mm_xor_si128),
 
+  SIMDE_TEST_FUNC(mm_sad_epu8),
+  SIMDE_TEST_FUNC(mm_shuffle_epi32),
+  SIMDE_TEST_FUNC(mm_shufflehi_epi16),
+  SIMDE_TEST_FUNC(mm_shufflelo_epi16),
+  SIMDE_TEST_FUNC(mm_sll_epi16),
+  SIMDE_TEST_FUNC(mm_sll_epi32),
+  SIMDE_TEST_FUNC(mm_sll_epi64),
+  SIMDE_TEST_FUNC(mm_srl_epi16),
+  SIMDE_TEST_FUNC(mm_srl_epi32),
+  SIMDE_TEST_FUNC(mm_srl_epi64),
+  SIMDE_TEST_FUNC(mm_comieq_sd),
+  SIMDE_TEST_FUNC(mm_comige_sd),
+  SIMDE_TEST_FUNC(mm_comigt_sd),
+  SIMDE_TEST_FUNC(mm_comile_sd),
+  SIMDE_TEST_FUNC(mm_comilt_sd),
+  SIMDE_TEST_FUNC(mm_comineq_sd),
+  SIMDE_TEST_FUNC(mm_div_pd),
+  SIMDE_TEST_FUNC(mm_div_sd),
+  SIMDE_TEST_FUNC(mm_move_epi64),
+  SIMDE_TEST_FUNC(mm_move_sd),
+  SIMDE_TEST_FUNC(mm_movemask_pd),
+  SIMDE_TEST_FUNC(mm_or_pd),
+  SIMDE_TEST_FUNC(mm_sqrt_pd),
+  SIMDE_TEST_FUNC(mm_sqrt_sd),
+  SIMDE_TEST_FUNC(mm_ucomieq_sd),
+  SIMDE_TEST_FUNC(mm_ucomige_sd),
+  SIMDE_TEST_FUNC(mm_ucomigt_sd),
+  SIMDE_TEST_FUNC(mm_ucomile_sd),
+  SIMDE_TEST_FUNC(mm_ucomilt_sd),
+  SIMDE_TEST_FUNC(mm_ucomineq_sd),
+  SIMDE_TEST_FUNC(mm_xor_pd),
+  SIMDE_TEST_FUNC(mm_maskmoveu_si128),
+  SIMDE_TEST_FUNC(mm_clflush),
+  SIMDE_TEST_FUNC(mm_lfence),
+  SIMDE_TEST_FUNC(mm_mfence),
+
   { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
 
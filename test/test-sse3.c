@@ -26,8 +26,473 @@
 
 #include <stdio.h>
 
+static MunitResult
+test_simde_mm_addsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(  -178.35,   -150.12),
+      simde_mm_set_pd(  -139.46,   -493.44),
+      simde_mm_set_pd(  -317.81,    343.32) },
+    { simde_mm_set_pd(  -427.29,   -816.90),
+      simde_mm_set_pd(  -454.73,    661.68),
+      simde_mm_set_pd(  -882.02,  -1478.58) },
+    { simde_mm_set_pd(   821.09,    778.20),
+      simde_mm_set_pd(  -661.65,     62.58),
+      simde_mm_set_pd(   159.44,    715.62) },
+    { simde_mm_set_pd(   307.67,    302.88),
+      simde_mm_set_pd(   649.91,    217.08),
+      simde_mm_set_pd(   957.58,     85.80) },
+    { simde_mm_set_pd(   540.08,    395.41),
+      simde_mm_set_pd(   882.04,    238.50),
+      simde_mm_set_pd(  1422.12,    156.91) },
+    { simde_mm_set_pd(   524.46,    493.53),
+      simde_mm_set_pd(   758.83,    696.14),
+      simde_mm_set_pd(  1283.29,   -202.61) },
+    { simde_mm_set_pd(    39.77,     39.51),
+      simde_mm_set_pd(   860.16,    873.45),
+      simde_mm_set_pd(   899.93,   -833.94) },
+    { simde_mm_set_pd(  -246.33,    648.59),
+      simde_mm_set_pd(  -850.62,   -215.12),
+      simde_mm_set_pd( -1096.95,    863.71) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_addsub_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_addsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -306.57f,   -455.66f,   -411.00f,    557.23f),
+      simde_mm_set_ps(  -164.54f,   -833.46f,    520.07f,    -95.27f),
+      simde_mm_set_ps(  -471.11f,    377.80f,    109.07f,    652.50f) },
+    { simde_mm_set_ps(   735.93f,   -667.39f,   -296.60f,    669.36f),
+      simde_mm_set_ps(   354.88f,    718.84f,   -816.68f,    715.47f),
+      simde_mm_set_ps(  1090.81f,  -1386.23f,  -1113.28f,    -46.11f) },
+    { simde_mm_set_ps(  -403.48f,    520.03f,   -606.62f,    317.66f),
+      simde_mm_set_ps(   644.97f,   -997.31f,    602.73f,   -797.32f),
+      simde_mm_set_ps(   241.49f,   1517.34f,     -3.89f,   1114.98f) },
+    { simde_mm_set_ps(  -867.86f,    790.20f,   -991.21f,    719.08f),
+      simde_mm_set_ps(    81.08f,   -117.91f,   -361.09f,    876.93f),
+      simde_mm_set_ps(  -786.78f,    908.11f,  -1352.30f,   -157.85f) },
+    { simde_mm_set_ps(   -59.58f,    -54.49f,    183.70f,   -844.05f),
+      simde_mm_set_ps(  -580.51f,    -70.88f,   -386.44f,   -688.25f),
+      simde_mm_set_ps(  -640.09f,     16.39f,   -202.74f,   -155.80f) },
+    { simde_mm_set_ps(   327.07f,     37.18f,   -933.16f,    367.84f),
+      simde_mm_set_ps(   805.77f,     98.24f,    724.38f,     78.35f),
+      simde_mm_set_ps(  1132.84f,    -61.06f,   -208.78f,    289.49f) },
+    { simde_mm_set_ps(   829.54f,   -446.21f,   -239.79f,   -372.43f),
+      simde_mm_set_ps(   919.23f,   -244.89f,    499.57f,    977.30f),
+      simde_mm_set_ps(  1748.77f,   -201.32f,    259.78f,  -1349.73f) },
+    { simde_mm_set_ps(  -399.28f,   -849.57f,    914.42f,   -492.15f),
+      simde_mm_set_ps(  -632.28f,    165.73f,   -714.00f,   -345.98f),
+      simde_mm_set_ps( -1031.56f,  -1015.30f,    200.42f,   -146.17f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_addsub_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hadd_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   144.33,    763.85),
+      simde_mm_set_pd(   -80.17,    776.38),
+      simde_mm_set_pd(   696.21,    908.18) },
+    { simde_mm_set_pd(   116.05,    724.43),
+      simde_mm_set_pd(   890.16,    -28.12),
+      simde_mm_set_pd(   862.04,    840.48) },
+    { simde_mm_set_pd(   527.91,   -867.04),
+      simde_mm_set_pd(   288.91,    889.40),
+      simde_mm_set_pd(  1178.31,   -339.13) },
+    { simde_mm_set_pd(   281.47,    656.34),
+      simde_mm_set_pd(   686.32,   -366.09),
+      simde_mm_set_pd(   320.23,    937.81) },
+    { simde_mm_set_pd(  -516.17,   -858.82),
+      simde_mm_set_pd(    99.80,     99.85),
+      simde_mm_set_pd(   199.65,  -1374.99) },
+    { simde_mm_set_pd(   -45.04,    303.01),
+      simde_mm_set_pd(   890.43,    178.37),
+      simde_mm_set_pd(  1068.80,    257.97) },
+    { simde_mm_set_pd(   875.10,   -746.40),
+      simde_mm_set_pd(  -815.09,    631.43),
+      simde_mm_set_pd(  -183.66,    128.70) },
+    { simde_mm_set_pd(   428.22,    199.39),
+      simde_mm_set_pd(   228.15,    -17.46),
+      simde_mm_set_pd(   210.69,    627.61) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_hadd_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hadd_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -624.77f,    291.89f,   -548.65f,    416.97f),
+      simde_mm_set_ps(  -992.25f,   -162.29f,    628.84f,    405.15f),
+      simde_mm_set_ps( -1154.54f,   1033.99f,   -332.88f,   -131.68f) },
+    { simde_mm_set_ps(   704.40f,    279.33f,    945.75f,   -196.53f),
+      simde_mm_set_ps(   583.36f,   -294.47f,   -829.27f,    373.76f),
+      simde_mm_set_ps(   288.89f,   -455.51f,    983.73f,    749.22f) },
+    { simde_mm_set_ps(   -28.87f,   -412.48f,   -782.41f,    338.05f),
+      simde_mm_set_ps(  -104.44f,    397.07f,   -340.35f,    976.72f),
+      simde_mm_set_ps(   292.63f,    636.37f,   -441.35f,   -444.36f) },
+    { simde_mm_set_ps(   104.82f,   -313.37f,    399.17f,   -900.64f),
+      simde_mm_set_ps(  -514.29f,    878.71f,    504.24f,    711.38f),
+      simde_mm_set_ps(   364.42f,   1215.62f,   -208.55f,   -501.47f) },
+    { simde_mm_set_ps(    -3.42f,    688.69f,    452.10f,    994.88f),
+      simde_mm_set_ps(   501.35f,    -67.84f,    538.74f,    717.90f),
+      simde_mm_set_ps(   433.51f,   1256.64f,    685.27f,   1446.98f) },
+    { simde_mm_set_ps(  -124.29f,   -771.83f,    764.01f,    305.53f),
+      simde_mm_set_ps(  -911.99f,    628.61f,      5.74f,    110.28f),
+      simde_mm_set_ps(  -283.38f,    116.02f,   -896.12f,   1069.54f) },
+    { simde_mm_set_ps(  -553.07f,    990.98f,    709.63f,   -349.94f),
+      simde_mm_set_ps(  -942.37f,    -34.24f,    199.54f,    265.41f),
+      simde_mm_set_ps(  -976.61f,    464.95f,    437.91f,    359.69f) },
+    { simde_mm_set_ps(   741.94f,     -7.02f,   -191.01f,   -878.44f),
+      simde_mm_set_ps(   268.63f,    814.77f,   -805.37f,    781.57f),
+      simde_mm_set_ps(  1083.40f,    -23.80f,    734.92f,  -1069.45f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_hadd_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hsub_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(  -845.15,     53.41),
+      simde_mm_set_pd(   789.67,    303.65),
+      simde_mm_set_pd(  -486.02,    898.56) },
+    { simde_mm_set_pd(  -343.33,    830.81),
+      simde_mm_set_pd(   467.94,   -122.63),
+      simde_mm_set_pd(  -590.57,   1174.14) },
+    { simde_mm_set_pd(   202.64,    344.09),
+      simde_mm_set_pd(   194.32,   -624.75),
+      simde_mm_set_pd(  -819.07,    141.45) },
+    { simde_mm_set_pd(  -564.81,   -910.64),
+      simde_mm_set_pd(   719.20,   -795.78),
+      simde_mm_set_pd( -1514.98,   -345.83) },
+    { simde_mm_set_pd(  -898.53,    908.19),
+      simde_mm_set_pd(  -762.14,    740.61),
+      simde_mm_set_pd(  1502.75,   1806.72) },
+    { simde_mm_set_pd(    51.00,    110.20),
+      simde_mm_set_pd(   706.14,    361.23),
+      simde_mm_set_pd(  -344.91,     59.20) },
+    { simde_mm_set_pd(   236.27,   -497.08),
+      simde_mm_set_pd(  -353.64,    572.71),
+      simde_mm_set_pd(   926.35,   -733.35) },
+    { simde_mm_set_pd(  -432.27,    175.86),
+      simde_mm_set_pd(   402.06,     71.77),
+      simde_mm_set_pd(  -330.29,    608.13) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_hsub_pd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hsub_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -696.76f,     56.18f,   -799.56f,     55.31f),
+      simde_mm_set_ps(   710.98f,    294.18f,   -864.23f,    555.07f),
+      simde_mm_set_ps(  -416.80f,   1419.30f,    752.94f,    854.87f) },
+    { simde_mm_set_ps(   -62.47f,    904.65f,   -735.89f,   -833.49f),
+      simde_mm_set_ps(   823.87f,   -144.75f,   -284.65f,   -485.61f),
+      simde_mm_set_ps(  -968.62f,   -200.96f,    967.12f,    -97.60f) },
+    { simde_mm_set_ps(  -267.80f,   -176.87f,    579.85f,    925.95f),
+      simde_mm_set_ps(   -43.07f,   -346.15f,     79.80f,    373.02f),
+      simde_mm_set_ps(  -303.08f,    293.22f,     90.93f,    346.10f) },
+    { simde_mm_set_ps(   333.12f,   -824.29f,   -768.03f,   -880.53f),
+      simde_mm_set_ps(  -165.24f,    328.47f,    217.41f,    827.85f),
+      simde_mm_set_ps(   493.71f,    610.44f,  -1157.41f,   -112.50f) },
+    { simde_mm_set_ps(   329.66f,    925.32f,    593.70f,    519.84f),
+      simde_mm_set_ps(   469.24f,   -115.89f,    836.26f,    396.36f),
+      simde_mm_set_ps(  -585.13f,   -439.90f,    595.66f,    -73.86f) },
+    { simde_mm_set_ps(   182.75f,    745.23f,     41.90f,   -270.63f),
+      simde_mm_set_ps(  -630.30f,    915.15f,    371.10f,    915.11f),
+      simde_mm_set_ps(  1545.45f,    544.01f,    562.48f,   -312.53f) },
+    { simde_mm_set_ps(  -775.87f,   -424.97f,   -327.13f,    702.35f),
+      simde_mm_set_ps(  -844.82f,    980.00f,    841.48f,    192.09f),
+      simde_mm_set_ps(  1824.82f,   -649.39f,    350.90f,   1029.48f) },
+    { simde_mm_set_ps(  -172.47f,   -992.85f,   -714.78f,     22.79f),
+      simde_mm_set_ps(  -505.83f,   -579.56f,   -392.76f,     -6.63f),
+      simde_mm_set_ps(   -73.73f,    386.13f,   -820.38f,    737.57f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_hsub_ps(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_movedup_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   511.68,    434.80),
+      simde_mm_set_pd(   434.80,    434.80) },
+    { simde_mm_set_pd(  -873.45,     -1.15),
+      simde_mm_set_pd(    -1.15,     -1.15) },
+    { simde_mm_set_pd(  -217.24,   -854.67),
+      simde_mm_set_pd(  -854.67,   -854.67) },
+    { simde_mm_set_pd(  -564.25,    829.31),
+      simde_mm_set_pd(   829.31,    829.31) },
+    { simde_mm_set_pd(   797.73,   -788.42),
+      simde_mm_set_pd(  -788.42,   -788.42) },
+    { simde_mm_set_pd(  -619.76,   -232.09),
+      simde_mm_set_pd(  -232.09,   -232.09) },
+    { simde_mm_set_pd(  -103.69,   -501.64),
+      simde_mm_set_pd(  -501.64,   -501.64) },
+    { simde_mm_set_pd(   300.75,    230.37),
+      simde_mm_set_pd(   230.37,    230.37) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_movedup_pd(test_vec[i].a);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_movehdup_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -127.17f,     18.32f,     92.34f,    727.39f),
+      simde_mm_set_ps(  -127.17f,   -127.17f,     92.34f,     92.34f) },
+    { simde_mm_set_ps(   291.70f,    970.31f,    141.14f,   -292.99f),
+      simde_mm_set_ps(   291.70f,    291.70f,    141.14f,    141.14f) },
+    { simde_mm_set_ps(   227.90f,   -459.63f,    552.99f,    159.71f),
+      simde_mm_set_ps(   227.90f,    227.90f,    552.99f,    552.99f) },
+    { simde_mm_set_ps(   922.90f,    536.13f,    602.61f,    274.63f),
+      simde_mm_set_ps(   922.90f,    922.90f,    602.61f,    602.61f) },
+    { simde_mm_set_ps(  -421.39f,   -958.49f,    927.03f,     75.28f),
+      simde_mm_set_ps(  -421.39f,   -421.39f,    927.03f,    927.03f) },
+    { simde_mm_set_ps(  -387.38f,    160.44f,    805.36f,   -326.70f),
+      simde_mm_set_ps(  -387.38f,   -387.38f,    805.36f,    805.36f) },
+    { simde_mm_set_ps(  -567.40f,   -711.60f,    447.86f,      2.77f),
+      simde_mm_set_ps(  -567.40f,   -567.40f,    447.86f,    447.86f) },
+    { simde_mm_set_ps(   137.92f,    197.67f,    -22.54f,    348.76f),
+      simde_mm_set_ps(   137.92f,    137.92f,    -22.54f,    -22.54f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_movehdup_ps(test_vec[i].a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_moveldup_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -514.51f,   -886.22f,    364.20f,    623.76f),
+      simde_mm_set_ps(  -886.22f,   -886.22f,    623.76f,    623.76f) },
+    { simde_mm_set_ps(   385.85f,    696.56f,     61.89f,   -421.81f),
+      simde_mm_set_ps(   696.56f,    696.56f,   -421.81f,   -421.81f) },
+    { simde_mm_set_ps(  -613.69f,   -282.19f,   -192.25f,     76.35f),
+      simde_mm_set_ps(  -282.19f,   -282.19f,     76.35f,     76.35f) },
+    { simde_mm_set_ps(  -365.04f,   -612.76f,   -676.62f,    993.71f),
+      simde_mm_set_ps(  -612.76f,   -612.76f,    993.71f,    993.71f) },
+    { simde_mm_set_ps(  -709.65f,   -790.84f,   -681.84f,   -870.88f),
+      simde_mm_set_ps(  -790.84f,   -790.84f,   -870.88f,   -870.88f) },
+    { simde_mm_set_ps(  -783.41f,   -813.08f,   -471.04f,    -42.20f),
+      simde_mm_set_ps(  -813.08f,   -813.08f,    -42.20f,    -42.20f) },
+    { simde_mm_set_ps(   631.08f,   -638.63f,   -224.14f,    305.29f),
+      simde_mm_set_ps(  -638.63f,   -638.63f,    305.29f,    305.29f) },
+    { simde_mm_set_ps(  -655.37f,    746.05f,    828.73f,   -425.93f),
+      simde_mm_set_ps(   746.05f,    746.05f,   -425.93f,   -425.93f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_moveldup_ps(test_vec[i].a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_lddqu_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint8_t a[17];
+    simde__m128i r;
+  } test_vec[8] = {
+    { { 0xf3, 0x6e, 0x90, 0x8d, 0xc5, 0x7b, 0xe8, 0xf4,
+	  0xd6, 0x42, 0xe8, 0xd7, 0xa7, 0x3b, 0x5a, 0x5d, 0xfa },
+      simde_mm_set_epi8(0xfa, 0x5d, 0x5a, 0x3b, 0xa7, 0xd7, 0xe8, 0x42,
+			0xd6, 0xf4, 0xe8, 0x7b, 0xc5, 0x8d, 0x90, 0x6e) },
+    { { 0x85, 0x71, 0xae, 0x00, 0x31, 0x0a, 0x65, 0x7c,
+	  0xfa, 0xbd, 0xe7, 0x93, 0x7d, 0xed, 0x98, 0x86, 0x62 },
+      simde_mm_set_epi8(0x62, 0x86, 0x98, 0xed, 0x7d, 0x93, 0xe7, 0xbd,
+			0xfa, 0x7c, 0x65, 0x0a, 0x31, 0x00, 0xae, 0x71) },
+    { { 0xdb, 0xfc, 0xff, 0x1b, 0xcd, 0xbc, 0xd2, 0xb3,
+	  0x17, 0xda, 0x9a, 0x43, 0x7c, 0xb8, 0xee, 0x40, 0xa5 },
+      simde_mm_set_epi8(0xa5, 0x40, 0xee, 0xb8, 0x7c, 0x43, 0x9a, 0xda,
+			0x17, 0xb3, 0xd2, 0xbc, 0xcd, 0x1b, 0xff, 0xfc) },
+    { { 0x29, 0x29, 0x6f, 0x2f, 0xb3, 0xa6, 0xf0, 0xa6,
+	  0x2b, 0x01, 0xaa, 0xeb, 0xf0, 0x0d, 0x25, 0xe2, 0x63 },
+      simde_mm_set_epi8(0x63, 0xe2, 0x25, 0x0d, 0xf0, 0xeb, 0xaa, 0x01,
+			0x2b, 0xa6, 0xf0, 0xa6, 0xb3, 0x2f, 0x6f, 0x29) },
+    { { 0xe8, 0xf0, 0x80, 0x78, 0x8a, 0xdc, 0x03, 0xf7,
+	  0x45, 0xd6, 0x86, 0x81, 0xef, 0xb7, 0x1a, 0xf0, 0x7c },
+      simde_mm_set_epi8(0x7c, 0xf0, 0x1a, 0xb7, 0xef, 0x81, 0x86, 0xd6,
+			0x45, 0xf7, 0x03, 0xdc, 0x8a, 0x78, 0x80, 0xf0) },
+    { { 0x12, 0x56, 0xb6, 0x8f, 0x9b, 0xe2, 0xc4, 0xe1,
+	  0x49, 0x8a, 0x05, 0x04, 0x53, 0xd1, 0x0f, 0x1e, 0x84 },
+      simde_mm_set_epi8(0x84, 0x1e, 0x0f, 0xd1, 0x53, 0x04, 0x05, 0x8a,
+			0x49, 0xe1, 0xc4, 0xe2, 0x9b, 0x8f, 0xb6, 0x56) },
+    { { 0xb9, 0xb4, 0x1e, 0x5b, 0xfe, 0x4d, 0x99, 0x4f,
+	  0x34, 0xfe, 0x65, 0xb4, 0x09, 0x96, 0x7e, 0x7b, 0x8e },
+      simde_mm_set_epi8(0x8e, 0x7b, 0x7e, 0x96, 0x09, 0xb4, 0x65, 0xfe,
+			0x34, 0x4f, 0x99, 0x4d, 0xfe, 0x5b, 0x1e, 0xb4) },
+    { { 0x66, 0xce, 0x6c, 0x0e, 0xac, 0xec, 0x66, 0x7d,
+	  0x1d, 0xe2, 0x35, 0x3a, 0x42, 0x1e, 0x31, 0xf7, 0x98 },
+      simde_mm_set_epi8(0x98, 0xf7, 0x31, 0x1e, 0x42, 0x3a, 0x35, 0xe2,
+			0x1d, 0x7d, 0x66, 0xec, 0xac, 0x0e, 0x6c, 0xce) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_lddqu_si128((simde__m128i const*) &(test_vec[i].a[1]));
+    simde_assert_m128i_u8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_loaddup_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde_float64 a;
+    simde__m128d r;
+  } test_vec[8] = {
+    {   -150.12,
+      simde_mm_set_pd(  -150.12,   -150.12) },
+    {   -178.35,
+      simde_mm_set_pd(  -178.35,   -178.35) },
+    {   -493.44,
+      simde_mm_set_pd(  -493.44,   -493.44) },
+    {   -139.46,
+      simde_mm_set_pd(  -139.46,   -139.46) },
+    {   -816.90,
+      simde_mm_set_pd(  -816.90,   -816.90) },
+    {   -427.29,
+      simde_mm_set_pd(  -427.29,   -427.29) },
+    {    661.68,
+      simde_mm_set_pd(   661.68,    661.68) },
+    {   -454.73,
+      simde_mm_set_pd(  -454.73,   -454.73) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_loaddup_pd(&(test_vec[i].a));
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitTest test_suite_tests[] = {
-  /* { (char*) "/sse2/mm_set_epi8",      test_simde_mm_set_epi8,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }, */
+  { (char*) "/mm_addsub_pd",     test_simde_mm_addsub_pd,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_addsub_ps",     test_simde_mm_addsub_ps,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hadd_pd",       test_simde_mm_hadd_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hadd_ps",       test_simde_mm_hadd_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hsub_pd",       test_simde_mm_hsub_pd,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hsub_ps",       test_simde_mm_hsub_ps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_movedup_pd",    test_simde_mm_movedup_pd,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_movehdup_ps",   test_simde_mm_movehdup_ps,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_moveldup_ps",   test_simde_mm_moveldup_ps,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_lddqu_si128",   test_simde_mm_lddqu_si128,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_loaddup_pd",    test_simde_mm_loaddup_pd,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
   { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
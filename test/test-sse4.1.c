@@ -214,10 +214,2408 @@ test_simde_mm_min_epi8(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm_blend_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16(-12655,  -6768,   1292,  13965,  30638,   3059,  -4423,    622),
+      simde_mm_set_epi16( -7868, -10520,  31022,   6900,   5856, -24123,   7630,  20091),
+      simde_mm_set_epi16( -7868,  -6768,  31022,  13965,  30638, -24123,   7630,    622) },
+    { simde_mm_set_epi16( 29951, -18200, -31417,  22231,  20101, -20266, -22061,  18754),
+      simde_mm_set_epi16(-26136,  16218,  20601,   -931,  31224, -21081, -15205, -10693),
+      simde_mm_set_epi16(-26136, -18200,  20601,  22231,  20101, -21081, -15205,  18754) },
+    { simde_mm_set_epi16( 14769,  27505,  11727, -14162,   -968,  32250,  -9537,  21893),
+      simde_mm_set_epi16( 20693, -25590,   8480, -32155,   3783,  27904, -25730, -26063),
+      simde_mm_set_epi16( 20693,  27505,   8480, -14162,   -968,  27904, -25730,  21893) },
+    { simde_mm_set_epi16(-19501, -12867,  17602,  27111, -13054,  -4740, -32280, -15878),
+      simde_mm_set_epi16( 28190,  27885,  28705,  13464,  -9601,  27027, -29140, -26499),
+      simde_mm_set_epi16( 28190, -12867,  28705,  27111, -13054,  27027, -29140, -15878) },
+    { simde_mm_set_epi16( 19510, -12069,   1456, -16132, -19846,  30854, -28188,  32610),
+      simde_mm_set_epi16(-25695,   9933,     -1,   3260, -28749,  29695, -18403,  -6373),
+      simde_mm_set_epi16(-25695, -12069,     -1, -16132, -19846,  29695, -18403,  32610) },
+    { simde_mm_set_epi16(  4425, -27625,  -4984,  -7974,  -7544,  22226,   5613,  18611),
+      simde_mm_set_epi16( 13332, -15236,  30055,  -4680, -29013,  12186,  23361, -26045),
+      simde_mm_set_epi16( 13332, -27625,  30055,  -7974,  -7544,  12186,  23361,  18611) },
+    { simde_mm_set_epi16(-19922,   7845,  22574,  -8151,  19704,  16878, -31875, -22464),
+      simde_mm_set_epi16(-10354,  10799,  32528,  20147,  25577,  14377,  20211,  18799),
+      simde_mm_set_epi16(-10354,   7845,  32528,  -8151,  19704,  14377,  20211, -22464) },
+    { simde_mm_set_epi16( 10043,   4262,    235,  12331, -18946,   -602,  -7525,  10992),
+      simde_mm_set_epi16(-15651, -24341,  -6440,  12016,  17837,  27905,   9641, -31062),
+      simde_mm_set_epi16(-15651,   4262,  -6440,  12331, -18946,  27905,   9641,  10992) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_blend_epi16(test_vec[i].a, test_vec[i].b, 0xa6);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_blend_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   183.70,   -844.05),
+      simde_mm_set_pd(   -59.58,    -54.49),
+      simde_mm_set_pd(   -59.58,   -844.05) },
+    { simde_mm_set_pd(  -386.44,   -688.25),
+      simde_mm_set_pd(  -580.51,    -70.88),
+      simde_mm_set_pd(  -580.51,   -688.25) },
+    { simde_mm_set_pd(  -933.16,    367.84),
+      simde_mm_set_pd(   327.07,     37.18),
+      simde_mm_set_pd(   327.07,    367.84) },
+    { simde_mm_set_pd(   724.38,     78.35),
+      simde_mm_set_pd(   805.77,     98.24),
+      simde_mm_set_pd(   805.77,     78.35) },
+    { simde_mm_set_pd(  -239.79,   -372.43),
+      simde_mm_set_pd(   829.54,   -446.21),
+      simde_mm_set_pd(   829.54,   -372.43) },
+    { simde_mm_set_pd(   499.57,    977.30),
+      simde_mm_set_pd(   919.23,   -244.89),
+      simde_mm_set_pd(   919.23,    977.30) },
+    { simde_mm_set_pd(   914.42,   -492.15),
+      simde_mm_set_pd(  -399.28,   -849.57),
+      simde_mm_set_pd(  -399.28,   -492.15) },
+    { simde_mm_set_pd(  -714.00,   -345.98),
+      simde_mm_set_pd(  -632.28,    165.73),
+      simde_mm_set_pd(  -632.28,   -345.98) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_blend_pd(test_vec[i].a, test_vec[i].b, 2);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_blend_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(   -80.17f,    776.38f,    144.33f,    763.85f),
+      simde_mm_set_ps(   890.16f,    -28.12f,    116.05f,    724.43f),
+      simde_mm_set_ps(   -80.17f,    -28.12f,    116.05f,    763.85f) },
+    { simde_mm_set_ps(   288.91f,    889.40f,    527.91f,   -867.04f),
+      simde_mm_set_ps(   686.32f,   -366.09f,    281.47f,    656.34f),
+      simde_mm_set_ps(   288.91f,   -366.09f,    281.47f,   -867.04f) },
+    { simde_mm_set_ps(    99.80f,     99.85f,   -516.17f,   -858.82f),
+      simde_mm_set_ps(   890.43f,    178.37f,    -45.04f,    303.01f),
+      simde_mm_set_ps(    99.80f,    178.37f,    -45.04f,   -858.82f) },
+    { simde_mm_set_ps(  -815.09f,    631.43f,    875.10f,   -746.40f),
+      simde_mm_set_ps(   228.15f,    -17.46f,    428.22f,    199.39f),
+      simde_mm_set_ps(  -815.09f,    -17.46f,    428.22f,   -746.40f) },
+    { simde_mm_set_ps(  -624.77f,    291.89f,   -548.65f,    416.97f),
+      simde_mm_set_ps(  -992.25f,   -162.29f,    628.84f,    405.15f),
+      simde_mm_set_ps(  -624.77f,   -162.29f,    628.84f,    416.97f) },
+    { simde_mm_set_ps(   704.40f,    279.33f,    945.75f,   -196.53f),
+      simde_mm_set_ps(   583.36f,   -294.47f,   -829.27f,    373.76f),
+      simde_mm_set_ps(   704.40f,   -294.47f,   -829.27f,   -196.53f) },
+    { simde_mm_set_ps(   -28.87f,   -412.48f,   -782.41f,    338.05f),
+      simde_mm_set_ps(  -104.44f,    397.07f,   -340.35f,    976.72f),
+      simde_mm_set_ps(   -28.87f,    397.07f,   -340.35f,    338.05f) },
+    { simde_mm_set_ps(   104.82f,   -313.37f,    399.17f,   -900.64f),
+      simde_mm_set_ps(  -514.29f,    878.71f,    504.24f,    711.38f),
+      simde_mm_set_ps(   104.82f,    878.71f,    504.24f,   -900.64f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_blend_ps(test_vec[i].a, test_vec[i].b, 6);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_blendv_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d mask;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   452.10,    994.88),
+      simde_mm_set_pd(    -3.42,    688.69),
+      simde_mm_set_pd(   538.74,    717.90),
+      simde_mm_set_pd(   452.10,    994.88) },
+    { simde_mm_set_pd(   501.35,    -67.84),
+      simde_mm_set_pd(   764.01,    305.53),
+      simde_mm_set_pd(  -124.29,   -771.83),
+      simde_mm_set_pd(   764.01,    305.53) },
+    { simde_mm_set_pd(     5.74,    110.28),
+      simde_mm_set_pd(  -911.99,    628.61),
+      simde_mm_set_pd(   709.63,   -349.94),
+      simde_mm_set_pd(     5.74,    628.61) },
+    { simde_mm_set_pd(  -553.07,    990.98),
+      simde_mm_set_pd(   199.54,    265.41),
+      simde_mm_set_pd(  -942.37,    -34.24),
+      simde_mm_set_pd(   199.54,    265.41) },
+    { simde_mm_set_pd(  -191.01,   -878.44),
+      simde_mm_set_pd(   741.94,     -7.02),
+      simde_mm_set_pd(  -805.37,    781.57),
+      simde_mm_set_pd(   741.94,   -878.44) },
+    { simde_mm_set_pd(   268.63,    814.77),
+      simde_mm_set_pd(  -845.15,     53.41),
+      simde_mm_set_pd(   789.67,    303.65),
+      simde_mm_set_pd(   268.63,    814.77) },
+    { simde_mm_set_pd(  -343.33,    830.81),
+      simde_mm_set_pd(   467.94,   -122.63),
+      simde_mm_set_pd(   202.64,    344.09),
+      simde_mm_set_pd(  -343.33,    830.81) },
+    { simde_mm_set_pd(   194.32,   -624.75),
+      simde_mm_set_pd(  -564.81,   -910.64),
+      simde_mm_set_pd(   719.20,   -795.78),
+      simde_mm_set_pd(   194.32,   -910.64) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_blendv_pd(test_vec[i].a, test_vec[i].b, test_vec[i].mask);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_blendv_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 mask;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -762.14f,    740.61f,   -898.53f,    908.19f),
+      simde_mm_set_ps(   706.14f,    361.23f,     51.00f,    110.20f),
+      simde_mm_set_ps(  -353.64f,    572.71f,    236.27f,   -497.08f),
+      simde_mm_set_ps(   706.14f,    740.61f,   -898.53f,    110.20f) },
+    { simde_mm_set_ps(   402.06f,     71.77f,   -432.27f,    175.86f),
+      simde_mm_set_ps(  -696.76f,     56.18f,   -799.56f,     55.31f),
+      simde_mm_set_ps(   710.98f,    294.18f,   -864.23f,    555.07f),
+      simde_mm_set_ps(   402.06f,     71.77f,   -799.56f,    175.86f) },
+    { simde_mm_set_ps(   -62.47f,    904.65f,   -735.89f,   -833.49f),
+      simde_mm_set_ps(   823.87f,   -144.75f,   -284.65f,   -485.61f),
+      simde_mm_set_ps(  -267.80f,   -176.87f,    579.85f,    925.95f),
+      simde_mm_set_ps(   823.87f,   -144.75f,   -735.89f,   -833.49f) },
+    { simde_mm_set_ps(   -43.07f,   -346.15f,     79.80f,    373.02f),
+      simde_mm_set_ps(   333.12f,   -824.29f,   -768.03f,   -880.53f),
+      simde_mm_set_ps(  -165.24f,    328.47f,    217.41f,    827.85f),
+      simde_mm_set_ps(   333.12f,   -346.15f,     79.80f,    373.02f) },
+    { simde_mm_set_ps(   329.66f,    925.32f,    593.70f,    519.84f),
+      simde_mm_set_ps(   469.24f,   -115.89f,    836.26f,    396.36f),
+      simde_mm_set_ps(   182.75f,    745.23f,     41.90f,   -270.63f),
+      simde_mm_set_ps(   329.66f,    925.32f,    593.70f,    396.36f) },
+    { simde_mm_set_ps(  -630.30f,    915.15f,    371.10f,    915.11f),
+      simde_mm_set_ps(  -775.87f,   -424.97f,   -327.13f,    702.35f),
+      simde_mm_set_ps(  -844.82f,    980.00f,    841.48f,    192.09f),
+      simde_mm_set_ps(  -775.87f,    915.15f,    371.10f,    915.11f) },
+    { simde_mm_set_ps(  -172.47f,   -992.85f,   -714.78f,     22.79f),
+      simde_mm_set_ps(  -505.83f,   -579.56f,   -392.76f,     -6.63f),
+      simde_mm_set_ps(  -873.45f,     -1.15f,    511.68f,    434.80f),
+      simde_mm_set_ps(  -505.83f,   -579.56f,   -714.78f,     22.79f) },
+    { simde_mm_set_ps(  -564.25f,    829.31f,   -217.24f,   -854.67f),
+      simde_mm_set_ps(  -619.76f,   -232.09f,    797.73f,   -788.42f),
+      simde_mm_set_ps(   300.75f,    230.37f,   -103.69f,   -501.64f),
+      simde_mm_set_ps(  -564.25f,    829.31f,    797.73f,   -788.42f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_blendv_ps(test_vec[i].a, test_vec[i].b, test_vec[i].mask);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_extract_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x72, 0xb2, 0xa9, 0x9d, 0xbd, 0x1b, 0x9b, 0xaa,
+			0x6e, 0x7e, 0x77, 0xf7, 0xfc, 0x04, 0x26, 0x46),
+      27 },
+    { simde_mm_set_epi8(0x72, 0xee, 0x19, 0x4f, 0x7b, 0xdd, 0xe4, 0xa8,
+			0xfe, 0x32, 0x09, 0x38, 0x32, 0xc1, 0x23, 0xa3),
+      221 },
+    { simde_mm_set_epi8(0x0f, 0xcf, 0x79, 0xc3, 0x02, 0xbf, 0xc8, 0x0c,
+			0x28, 0x43, 0x9b, 0x74, 0x17, 0x84, 0x77, 0x57),
+      191 },
+    { simde_mm_set_epi8(0x46, 0x45, 0x7e, 0x93, 0xc9, 0x80, 0x00, 0xa8,
+			0x12, 0x82, 0x4b, 0xf7, 0xc5, 0xe2, 0xd3, 0x9c),
+      128 },
+    { simde_mm_set_epi8(0x20, 0x14, 0x62, 0x7a, 0x83, 0x62, 0x79, 0x52,
+			0xdb, 0x75, 0xbb, 0x31, 0x42, 0xd1, 0x13, 0xa3),
+      98 },
+    { simde_mm_set_epi8(0x5f, 0xb8, 0x74, 0xe9, 0xdd, 0x72, 0xab, 0xde,
+			0xf6, 0xe6, 0x4c, 0xa9, 0x5c, 0xb5, 0x57, 0x98),
+      114 },
+    { simde_mm_set_epi8(0xe1, 0x33, 0x7c, 0x33, 0xb7, 0xd6, 0x0d, 0x79,
+			0x7a, 0x90, 0xcf, 0x1e, 0xe4, 0x64, 0x13, 0xe8),
+      214 },
+    { simde_mm_set_epi8(0xfa, 0x68, 0x52, 0x24, 0x1c, 0xe1, 0x21, 0x76,
+			0xf1, 0x25, 0x52, 0xe0, 0xde, 0x21, 0x2d, 0xdb),
+      225 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_extract_epi8(test_vec[i].a, 10);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_extract_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int32_t r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1037539631,  -642500485, -1935393123,   323338036),
+      INT32_C( -642500485) },
+    { simde_mm_set_epi32( -596179147,     9538632,  -426490135, -1561047438),
+      INT32_C(    9538632) },
+    { simde_mm_set_epi32( 2122282392, -1245313417,  -497840676,  1226886909),
+      INT32_C(-1245313417) },
+    { simde_mm_set_epi32(  755842503, -1433489493,  -429548599,  1022837452),
+      INT32_C(-1433489493) },
+    { simde_mm_set_epi32(-1847934145, -1655325063,  -743536627, -2107724544),
+      INT32_C(-1655325063) },
+    { simde_mm_set_epi32(-1216333211, -1558331954,  1742904494,   561855705),
+      INT32_C(-1558331954) },
+    { simde_mm_set_epi32( -722913299, -1054987989, -1562623106,   264478908),
+      INT32_C(-1054987989) },
+    { simde_mm_set_epi32(  257775893, -1273517726,  -590491367, -1459570247),
+      INT32_C(-1273517726) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm_extract_epi32(test_vec[i].a, 2);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_extract_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    int32_t r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(   596.10f,    916.68f,    344.04f,   -624.40f),
+      INT32_C( 1135346975) },
+    { simde_mm_set_ps(   190.86f,   -800.18f,   -993.64f,   -410.26f),
+      INT32_C( -998741770) },
+    { simde_mm_set_ps(   627.59f,   -175.09f,     15.68f,   -163.12f),
+      INT32_C( 1098572104) },
+    { simde_mm_set_ps(   888.75f,   -674.71f,     57.75f,   -624.26f),
+      INT32_C( 1114046464) },
+    { simde_mm_set_ps(   -84.24f,   -992.20f,    944.31f,    -61.38f),
+      INT32_C( 1147933655) },
+    { simde_mm_set_ps(   854.60f,    440.76f,    701.06f,   -519.48f),
+      INT32_C( 1143948247) },
+    { simde_mm_set_ps(   111.12f,    199.00f,    440.85f,    335.34f),
+      INT32_C( 1138519245) },
+    { simde_mm_set_ps(   880.57f,   -691.37f,   -434.15f,     78.19f),
+      INT32_C(-1009183949) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int32_t r = simde_mm_extract_ps(test_vec[i].a, 1);
+    munit_assert_int32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_insert_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int8_t i;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0xfb, 0x22, 0xa8, 0x07, 0x9d, 0x02, 0x55, 0xa6,
+			0xf1, 0xe6, 0x58, 0x7d, 0xee, 0x17, 0x7b, 0x43),
+      INT8_C(  77),
+      simde_mm_set_epi8(0xfb, 0x22, 0xa8, 0x07, 0x9d, 0x02, 0x55, 0xa6,
+			0xf1, 0xe6, 0x4d, 0x7d, 0xee, 0x17, 0x7b, 0x43) },
+    { simde_mm_set_epi8(0xcf, 0xf0, 0xe6, 0x09, 0xf2, 0xc7, 0xe9, 0x72,
+			0x53, 0xff, 0x73, 0xcb, 0x41, 0x88, 0x1b, 0xd0),
+      INT8_C(-116),
+      simde_mm_set_epi8(0xcf, 0xf0, 0xe6, 0x09, 0xf2, 0xc7, 0xe9, 0x72,
+			0x53, 0xff, 0x8c, 0xcb, 0x41, 0x88, 0x1b, 0xd0) },
+    { simde_mm_set_epi8(0x35, 0x64, 0xeb, 0xad, 0xed, 0xb9, 0x95, 0x1c,
+			0x8c, 0x9a, 0x3c, 0x8f, 0xc5, 0x96, 0x57, 0x31),
+      INT8_C(  27),
+      simde_mm_set_epi8(0x35, 0x64, 0xeb, 0xad, 0xed, 0xb9, 0x95, 0x1c,
+			0x8c, 0x9a, 0x1b, 0x8f, 0xc5, 0x96, 0x57, 0x31) },
+    { simde_mm_set_epi8(0xa3, 0xf8, 0xd9, 0x38, 0x89, 0x74, 0xa8, 0x99,
+			0x94, 0x71, 0x74, 0x28, 0xc9, 0x51, 0xcb, 0x6e),
+      INT8_C( -93),
+      simde_mm_set_epi8(0xa3, 0xf8, 0xd9, 0x38, 0x89, 0x74, 0xa8, 0x99,
+			0x94, 0x71, 0xa3, 0x28, 0xc9, 0x51, 0xcb, 0x6e) },
+    { simde_mm_set_epi8(0x48, 0xec, 0xb9, 0xfa, 0xa7, 0x90, 0x0a, 0x02,
+			0xa0, 0xbf, 0x03, 0x6c, 0x3f, 0x6c, 0x58, 0xc1),
+      INT8_C( -79),
+      simde_mm_set_epi8(0x48, 0xec, 0xb9, 0xfa, 0xa7, 0x90, 0x0a, 0x02,
+			0xa0, 0xbf, 0xb1, 0x6c, 0x3f, 0x6c, 0x58, 0xc1) },
+    { simde_mm_set_epi8(0xe8, 0x48, 0x15, 0xa9, 0x2f, 0xc8, 0xc8, 0x56,
+			0xca, 0xb4, 0x06, 0xfd, 0x5b, 0xa0, 0x5b, 0xdd),
+      INT8_C( -44),
+      simde_mm_set_epi8(0xe8, 0x48, 0x15, 0xa9, 0x2f, 0xc8, 0xc8, 0x56,
+			0xca, 0xb4, 0xd4, 0xfd, 0x5b, 0xa0, 0x5b, 0xdd) },
+    { simde_mm_set_epi8(0x4d, 0x4a, 0x27, 0x4a, 0xee, 0xad, 0x64, 0x26,
+			0x1c, 0x59, 0xdb, 0x6d, 0x95, 0x67, 0x85, 0x5a),
+      INT8_C( 112),
+      simde_mm_set_epi8(0x4d, 0x4a, 0x27, 0x4a, 0xee, 0xad, 0x64, 0x26,
+			0x1c, 0x59, 0x70, 0x6d, 0x95, 0x67, 0x85, 0x5a) },
+    { simde_mm_set_epi8(0xb4, 0xd9, 0x19, 0xf7, 0x8c, 0xbe, 0x07, 0x41,
+			0xe4, 0xbf, 0xdc, 0x0e, 0x01, 0x4d, 0x85, 0x2e),
+      INT8_C(   5),
+      simde_mm_set_epi8(0xb4, 0xd9, 0x19, 0xf7, 0x8c, 0xbe, 0x07, 0x41,
+			0xe4, 0xbf, 0x05, 0x0e, 0x01, 0x4d, 0x85, 0x2e) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_insert_epi8(test_vec[i].a, test_vec[i].i, 5);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_insert_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int32_t i;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32( 1316606822,  -844868638,   619640955, -1367553453),
+      INT32_C(-2014685594),
+      simde_mm_set_epi32( 1316606822,  -844868638, -2014685594, -1367553453) },
+    { simde_mm_set_epi32( -640789174,   189647712,   303510185,   540124895),
+      INT32_C( -351822627),
+      simde_mm_set_epi32( -640789174,   189647712,  -351822627,   540124895) },
+    { simde_mm_set_epi32( 1220798776,  1145362707,   998169149, -1780004763),
+      INT32_C( 1492925612),
+      simde_mm_set_epi32( 1220798776,  1145362707,  1492925612, -1780004763) },
+    { simde_mm_set_epi32( -495581803,  1670774474,   700441382, -1650415128),
+      INT32_C( 1908738286),
+      simde_mm_set_epi32( -495581803,  1670774474,  1908738286, -1650415128) },
+    { simde_mm_set_epi32( -472212695,  1879431363,  1032949318, -1486159123),
+      INT32_C( 1183583903),
+      simde_mm_set_epi32( -472212695,  1879431363,  1183583903, -1486159123) },
+    { simde_mm_set_epi32(-1671356231,   598404414,  1201671196,  -966574006),
+      INT32_C( -638367019),
+      simde_mm_set_epi32(-1671356231,   598404414,  -638367019,  -966574006) },
+    { simde_mm_set_epi32( -391020550, -1758052583,  -967048346, -1696110853),
+      INT32_C( 1101360528),
+      simde_mm_set_epi32( -391020550, -1758052583,  1101360528, -1696110853) },
+    { simde_mm_set_epi32(-2018204850,   219690347,  1260639150,   197064071),
+      INT32_C( 1390132458),
+      simde_mm_set_epi32(-2018204850,   219690347,  1390132458,   197064071) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_insert_epi32(test_vec[i].a, test_vec[i].i, 1);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_insert_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int64_t i;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(-5986589938309154331), INT64_C(-9015122079932102673)),
+      INT64_C(-4326369014879823061),
+      simde_mm_set_epi64x(INT64_C(-4326369014879823061), INT64_C(-9015122079932102673)) },
+    { simde_mm_set_epi64x(INT64_C(-4835772501581349285), INT64_C(-3410639499255960292)),
+      INT64_C( 3144378034621746751),
+      simde_mm_set_epi64x(INT64_C( 3144378034621746751), INT64_C(-3410639499255960292)) },
+    { simde_mm_set_epi64x(INT64_C( 7637455860788501554), INT64_C(-6798903731585057967)),
+      INT64_C( 9099478870839321090),
+      simde_mm_set_epi64x(INT64_C( 9099478870839321090), INT64_C(-6798903731585057967)) },
+    { simde_mm_set_epi64x(INT64_C( 6725384276544904433), INT64_C(-7608423970524688384)),
+      INT64_C(-7324239692915772499),
+      simde_mm_set_epi64x(INT64_C(-7324239692915772499), INT64_C(-7608423970524688384)) },
+    { simde_mm_set_epi64x(INT64_C( 2189601238044352909), INT64_C(-3784454611539826344)),
+      INT64_C( 1614795092602041330),
+      simde_mm_set_epi64x(INT64_C( 1614795092602041330), INT64_C(-3784454611539826344)) },
+    { simde_mm_set_epi64x(INT64_C( 2129529200875802355), INT64_C(-5109390572797909365)),
+      INT64_C( 7102691778522499015),
+      simde_mm_set_epi64x(INT64_C( 7102691778522499015), INT64_C(-5109390572797909365)) },
+    { simde_mm_set_epi64x(INT64_C(-6208376552747087853), INT64_C( 1442421587233443579)),
+      INT64_C(-8498531182358055608),
+      simde_mm_set_epi64x(INT64_C(-8498531182358055608), INT64_C( 1442421587233443579)) },
+    { simde_mm_set_epi64x(INT64_C(-6767459791834063060), INT64_C(-6850818431207318130)),
+      INT64_C(  -28923673870736185),
+      simde_mm_set_epi64x(INT64_C(  -28923673870736185), INT64_C(-6850818431207318130)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_insert_epi64(test_vec[i].a, test_vec[i].i, 1);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_insert_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(  -660.04f,   -694.79f,    509.17f,   -451.48f),
+      simde_mm_set_ps(  -127.93f,    523.72f,    160.40f,    931.42f),
+      simde_mm_set_ps(     0.00f,   -694.79f,      0.00f,   -451.48f) },
+    { simde_mm_set_ps(   181.55f,    469.06f,   -571.91f,   -498.03f),
+      simde_mm_set_ps(  -792.53f,   -816.08f,   -749.75f,    800.06f),
+      simde_mm_set_ps(     0.00f,    469.06f,      0.00f,   -498.03f) },
+    { simde_mm_set_ps(   181.41f,   -428.63f,    930.19f,   -706.91f),
+      simde_mm_set_ps(    25.60f,    207.07f,   -782.87f,   -540.87f),
+      simde_mm_set_ps(     0.00f,   -428.63f,      0.00f,   -706.91f) },
+    { simde_mm_set_ps(   665.00f,   -177.13f,   -671.75f,    853.70f),
+      simde_mm_set_ps(   569.34f,   -146.81f,    736.02f,    -96.86f),
+      simde_mm_set_ps(     0.00f,   -177.13f,      0.00f,    853.70f) },
+    { simde_mm_set_ps(  -898.40f,   -137.98f,    322.39f,   -289.83f),
+      simde_mm_set_ps(   262.55f,   -195.77f,   -806.64f,    215.89f),
+      simde_mm_set_ps(     0.00f,   -137.98f,      0.00f,   -289.83f) },
+    { simde_mm_set_ps(   716.13f,   -320.31f,    322.98f,    -46.01f),
+      simde_mm_set_ps(   754.14f,   -862.46f,   -133.59f,    154.96f),
+      simde_mm_set_ps(     0.00f,   -320.31f,      0.00f,    -46.01f) },
+    { simde_mm_set_ps(   261.66f,    947.22f,   -811.37f,   -576.64f),
+      simde_mm_set_ps(   286.97f,   -508.57f,   -454.42f,   -350.52f),
+      simde_mm_set_ps(     0.00f,    947.22f,      0.00f,   -576.64f) },
+    { simde_mm_set_ps(    -1.44f,    597.84f,    368.03f,   -672.83f),
+      simde_mm_set_ps(  -771.23f,    197.61f,   -845.01f,   -128.86f),
+      simde_mm_set_ps(     0.00f,    597.84f,      0.00f,   -672.83f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_insert_ps(test_vec[i].a, test_vec[i].b, 0x9a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ceil_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(     7.00,    -80.55),
+      simde_mm_set_pd(     7.00,    -80.00) },
+    { simde_mm_set_pd(     4.50,     47.70),
+      simde_mm_set_pd(     5.00,     48.00) },
+    { simde_mm_set_pd(    -4.00,    -10.00),
+      simde_mm_set_pd(    -4.00,    -10.00) },
+    { simde_mm_set_pd(    -8.50,    -76.60),
+      simde_mm_set_pd(    -8.00,    -76.00) },
+    { simde_mm_set_pd(    36.19,      8.50),
+      simde_mm_set_pd(    37.00,      9.00) },
+    { simde_mm_set_pd(    -8.00,      1.50),
+      simde_mm_set_pd(    -8.00,      2.00) },
+    { simde_mm_set_pd(    41.07,     -2.50),
+      simde_mm_set_pd(    42.00,     -2.00) },
+    { simde_mm_set_pd(     2.88,    -19.65),
+      simde_mm_set_pd(     3.00,    -19.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_ceil_pd(test_vec[i].a);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ceil_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(     2.86f,     30.11f,    -49.53f,     -9.00f),
+      simde_mm_set_ps(     3.00f,     31.00f,    -49.00f,     -9.00f) },
+    { simde_mm_set_ps(    -6.50f,     -5.00f,     50.25f,     -6.50f),
+      simde_mm_set_ps(    -6.00f,     -5.00f,     51.00f,     -6.00f) },
+    { simde_mm_set_ps(   -14.28f,    -93.30f,     30.80f,      1.00f),
+      simde_mm_set_ps(   -14.00f,    -93.00f,     31.00f,      1.00f) },
+    { simde_mm_set_ps(    38.36f,     54.59f,      9.00f,     -3.00f),
+      simde_mm_set_ps(    39.00f,     55.00f,      9.00f,     -3.00f) },
+    { simde_mm_set_ps(    -9.00f,     -2.00f,      2.00f,    -98.96f),
+      simde_mm_set_ps(    -9.00f,     -2.00f,      2.00f,    -98.00f) },
+    { simde_mm_set_ps(     6.50f,     97.98f,    -98.54f,      4.50f),
+      simde_mm_set_ps(     7.00f,     98.00f,    -98.00f,      5.00f) },
+    { simde_mm_set_ps(     5.00f,     -1.00f,     -5.50f,     70.92f),
+      simde_mm_set_ps(     5.00f,     -1.00f,     -5.00f,     71.00f) },
+    { simde_mm_set_ps(    -6.50f,    -90.42f,      7.50f,     64.76f),
+      simde_mm_set_ps(    -6.00f,    -90.00f,      8.00f,     65.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_ceil_ps(test_vec[i].a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ceil_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    41.24,      9.50),
+      simde_mm_set_pd(    15.15,      2.50),
+      simde_mm_set_pd(    41.24,      3.00) },
+    { simde_mm_set_pd(    -6.50,      6.00),
+      simde_mm_set_pd(     0.50,     49.30),
+      simde_mm_set_pd(    -6.50,     50.00) },
+    { simde_mm_set_pd(    99.59,     51.73),
+      simde_mm_set_pd(     8.50,      6.00),
+      simde_mm_set_pd(    99.59,      6.00) },
+    { simde_mm_set_pd(     1.00,     -4.50),
+      simde_mm_set_pd(    24.30,      6.00),
+      simde_mm_set_pd(     1.00,      6.00) },
+    { simde_mm_set_pd(    -5.50,     -7.50),
+      simde_mm_set_pd(    39.69,      7.50),
+      simde_mm_set_pd(    -5.50,      8.00) },
+    { simde_mm_set_pd(     5.50,     79.68),
+      simde_mm_set_pd(     2.32,     -1.00),
+      simde_mm_set_pd(     5.50,     -1.00) },
+    { simde_mm_set_pd(   -93.43,    -38.53),
+      simde_mm_set_pd(    41.09,     70.59),
+      simde_mm_set_pd(   -93.43,     71.00) },
+    { simde_mm_set_pd(   -57.00,    -59.23),
+      simde_mm_set_pd(   -24.00,     26.64),
+      simde_mm_set_pd(   -57.00,     27.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_ceil_sd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_ceil_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(   -10.00f,      7.50f,     -9.54f,    -22.08f),
+      simde_mm_set_ps(   -90.74f,    -80.72f,    -90.81f,     -2.00f),
+      simde_mm_set_ps(   -10.00f,      7.50f,     -9.54f,     -2.00f) },
+    { simde_mm_set_ps(    -6.00f,     23.44f,      9.01f,     -8.00f),
+      simde_mm_set_ps(     5.50f,    -71.63f,     -1.00f,      6.50f),
+      simde_mm_set_ps(    -6.00f,     23.44f,      9.01f,      7.00f) },
+    { simde_mm_set_ps(    93.72f,     -4.00f,     -5.00f,     77.02f),
+      simde_mm_set_ps(    42.07f,     27.93f,     31.42f,      8.00f),
+      simde_mm_set_ps(    93.72f,     -4.00f,     -5.00f,      8.00f) },
+    { simde_mm_set_ps(    -4.00f,      3.50f,     -2.00f,    -67.20f),
+      simde_mm_set_ps(     7.50f,    -48.18f,     46.35f,     -5.00f),
+      simde_mm_set_ps(    -4.00f,      3.50f,     -2.00f,     -5.00f) },
+    { simde_mm_set_ps(    37.84f,    -55.37f,    -17.59f,     85.80f),
+      simde_mm_set_ps(     5.00f,     21.41f,     -0.50f,     -5.00f),
+      simde_mm_set_ps(    37.84f,    -55.37f,    -17.59f,     -5.00f) },
+    { simde_mm_set_ps(    76.03f,     77.64f,    -78.35f,     36.40f),
+      simde_mm_set_ps(    -9.87f,     39.99f,    -67.29f,    -89.22f),
+      simde_mm_set_ps(    76.03f,     77.64f,    -78.35f,    -89.00f) },
+    { simde_mm_set_ps(    16.66f,     25.33f,    -64.60f,      3.00f),
+      simde_mm_set_ps(    -0.50f,    -75.09f,     -9.55f,     -8.00f),
+      simde_mm_set_ps(    16.66f,     25.33f,    -64.60f,     -8.00f) },
+    { simde_mm_set_ps(    21.88f,      1.50f,    -39.94f,      6.00f),
+      simde_mm_set_ps(   -29.01f,      9.00f,     -2.50f,      3.50f),
+      simde_mm_set_ps(    21.88f,      1.50f,    -39.94f,      4.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_ceil_ss(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_floor_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    -3.50,     40.98),
+      simde_mm_set_pd(    -4.00,     40.00) },
+    { simde_mm_set_pd(    12.29,      0.50),
+      simde_mm_set_pd(    12.00,      0.00) },
+    { simde_mm_set_pd(    -2.50,     -7.00),
+      simde_mm_set_pd(    -3.00,     -7.00) },
+    { simde_mm_set_pd(    31.98,     49.55),
+      simde_mm_set_pd(    31.00,     49.00) },
+    { simde_mm_set_pd(   -54.81,     89.79),
+      simde_mm_set_pd(   -55.00,     89.00) },
+    { simde_mm_set_pd(    56.59,      5.50),
+      simde_mm_set_pd(    56.00,      5.00) },
+    { simde_mm_set_pd(   -92.86,     -8.50),
+      simde_mm_set_pd(   -93.00,     -9.00) },
+    { simde_mm_set_pd(   -98.30,      8.70),
+      simde_mm_set_pd(   -99.00,      8.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_floor_pd(test_vec[i].a);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_floor_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    40.84f,      5.47f,      3.50f,    -77.40f),
+      simde_mm_set_ps(    40.00f,      5.00f,      3.00f,    -78.00f) },
+    { simde_mm_set_ps(     3.00f,     -1.00f,    -55.24f,     -6.50f),
+      simde_mm_set_ps(     3.00f,     -1.00f,    -56.00f,     -7.00f) },
+    { simde_mm_set_ps(    81.56f,    -68.31f,    -58.03f,    -81.30f),
+      simde_mm_set_ps(    81.00f,    -69.00f,    -59.00f,    -82.00f) },
+    { simde_mm_set_ps(    47.37f,    -36.87f,      9.00f,      9.50f),
+      simde_mm_set_ps(    47.00f,    -37.00f,      9.00f,      9.00f) },
+    { simde_mm_set_ps(    85.18f,      4.00f,      2.58f,     33.96f),
+      simde_mm_set_ps(    85.00f,      4.00f,      2.00f,     33.00f) },
+    { simde_mm_set_ps(    85.06f,     52.87f,     73.17f,     -8.50f),
+      simde_mm_set_ps(    85.00f,     52.00f,     73.00f,     -9.00f) },
+    { simde_mm_set_ps(    -3.00f,      0.00f,     -0.21f,    -84.42f),
+      simde_mm_set_ps(    -3.00f,      0.00f,     -1.00f,    -85.00f) },
+    { simde_mm_set_ps(    -8.50f,     -2.00f,     -4.00f,      4.50f),
+      simde_mm_set_ps(    -9.00f,     -2.00f,     -4.00f,      4.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_floor_ps(test_vec[i].a);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_floor_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    63.09,     -4.50),
+      simde_mm_set_pd(     5.00,     -3.00),
+      simde_mm_set_pd(    63.09,     -3.00) },
+    { simde_mm_set_pd(    44.16,     69.24),
+      simde_mm_set_pd(    -4.00,    -10.00),
+      simde_mm_set_pd(    44.16,    -10.00) },
+    { simde_mm_set_pd(   -57.92,     65.76),
+      simde_mm_set_pd(    -0.50,     97.93),
+      simde_mm_set_pd(   -57.92,     97.00) },
+    { simde_mm_set_pd(    85.34,     -8.00),
+      simde_mm_set_pd(    87.56,    -68.84),
+      simde_mm_set_pd(    85.34,    -69.00) },
+    { simde_mm_set_pd(   -30.72,      6.00),
+      simde_mm_set_pd(     8.00,     -6.50),
+      simde_mm_set_pd(   -30.72,     -7.00) },
+    { simde_mm_set_pd(   -65.93,    -41.30),
+      simde_mm_set_pd(   -57.93,     -4.50),
+      simde_mm_set_pd(   -65.93,     -5.00) },
+    { simde_mm_set_pd(     7.00,     -7.00),
+      simde_mm_set_pd(   -63.33,      3.00),
+      simde_mm_set_pd(     7.00,      3.00) },
+    { simde_mm_set_pd(     5.50,    -25.20),
+      simde_mm_set_pd(    54.23,     -1.00),
+      simde_mm_set_pd(     5.50,     -1.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_floor_sd(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_floor_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(    -7.00f,      6.00f,     67.92f,     -5.50f),
+      simde_mm_set_ps(    73.97f,     -1.50f,     -3.00f,      7.50f),
+      simde_mm_set_ps(    -7.00f,      6.00f,     67.92f,      7.00f) },
+    { simde_mm_set_ps(     0.50f,      2.50f,      6.00f,     11.16f),
+      simde_mm_set_ps(   -70.45f,    -13.86f,     -3.00f,      2.50f),
+      simde_mm_set_ps(     0.50f,      2.50f,      6.00f,      2.00f) },
+    { simde_mm_set_ps(     4.00f,     28.65f,     91.96f,    -70.54f),
+      simde_mm_set_ps(   -63.08f,     -5.50f,     30.82f,     73.27f),
+      simde_mm_set_ps(     4.00f,     28.65f,     91.96f,     73.00f) },
+    { simde_mm_set_ps(     2.00f,     97.47f,    -44.00f,      2.50f),
+      simde_mm_set_ps(    -7.50f,     -8.50f,     48.04f,     -9.00f),
+      simde_mm_set_ps(     2.00f,     97.47f,    -44.00f,     -9.00f) },
+    { simde_mm_set_ps(   -16.77f,     -3.00f,    -10.00f,      8.00f),
+      simde_mm_set_ps(    -6.00f,      3.00f,     17.04f,      6.50f),
+      simde_mm_set_ps(   -16.77f,     -3.00f,    -10.00f,      6.00f) },
+    { simde_mm_set_ps(    -4.90f,    -38.20f,     59.06f,     -6.00f),
+      simde_mm_set_ps(    -4.50f,    -48.05f,     44.24f,    -84.92f),
+      simde_mm_set_ps(    -4.90f,    -38.20f,     59.06f,    -85.00f) },
+    { simde_mm_set_ps(   -42.71f,     -3.00f,     -2.00f,      0.00f),
+      simde_mm_set_ps(    -7.50f,     73.89f,      6.50f,    -18.59f),
+      simde_mm_set_ps(   -42.71f,     -3.00f,     -2.00f,    -19.00f) },
+    { simde_mm_set_ps(    -5.00f,     -5.00f,    -21.38f,     31.30f),
+      simde_mm_set_ps(    23.52f,     62.31f,      1.00f,     -2.00f),
+      simde_mm_set_ps(    -5.00f,     -5.00f,    -21.38f,     -2.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_floor_ss(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_round_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    41.70,     -7.50),
+      simde_mm_set_pd(    42.00,     -8.00) },
+    { simde_mm_set_pd(    -6.50,      9.50),
+      simde_mm_set_pd(    -6.00,     10.00) },
+    { simde_mm_set_pd(    -5.50,    -34.27),
+      simde_mm_set_pd(    -6.00,    -34.00) },
+    { simde_mm_set_pd(    79.48,     -2.50),
+      simde_mm_set_pd(    79.00,     -2.00) },
+    { simde_mm_set_pd(     9.50,      6.50),
+      simde_mm_set_pd(    10.00,      6.00) },
+    { simde_mm_set_pd(     4.50,    -34.44),
+      simde_mm_set_pd(     4.00,    -34.00) },
+    { simde_mm_set_pd(     7.50,     66.02),
+      simde_mm_set_pd(     8.00,     66.00) },
+    { simde_mm_set_pd(    -1.00,      5.00),
+      simde_mm_set_pd(    -1.00,      5.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_round_pd(test_vec[i].a, simde_MM_FROUND_TO_NEAREST_INT);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_round_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(     1.00f,    -97.32f,      4.50f,     -5.00f),
+      simde_mm_set_ps(     1.00f,    -97.00f,      4.00f,     -5.00f) },
+    { simde_mm_set_ps(     4.00f,     -1.00f,    -49.27f,     -3.00f),
+      simde_mm_set_ps(     4.00f,     -1.00f,    -49.00f,     -3.00f) },
+    { simde_mm_set_ps(    -5.00f,     20.15f,      2.00f,      9.00f),
+      simde_mm_set_ps(    -5.00f,     20.00f,      2.00f,      9.00f) },
+    { simde_mm_set_ps(    99.91f,    -62.17f,    -46.29f,    -59.07f),
+      simde_mm_set_ps(   100.00f,    -62.00f,    -46.00f,    -59.00f) },
+    { simde_mm_set_ps(    -6.00f,    -73.88f,     -1.00f,    -75.74f),
+      simde_mm_set_ps(    -6.00f,    -74.00f,     -1.00f,    -76.00f) },
+    { simde_mm_set_ps(    53.34f,     43.53f,     -9.50f,      2.00f),
+      simde_mm_set_ps(    53.00f,     44.00f,    -10.00f,      2.00f) },
+    { simde_mm_set_ps(     0.50f,    -42.97f,     64.37f,     98.71f),
+      simde_mm_set_ps(     0.00f,    -43.00f,     64.00f,     99.00f) },
+    { simde_mm_set_ps(     3.50f,      4.00f,     71.69f,    -68.97f),
+      simde_mm_set_ps(     4.00f,      4.00f,     72.00f,    -69.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_round_ps(test_vec[i].a, simde_MM_FROUND_TO_NEAREST_INT);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_round_sd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(    -3.50,     82.68),
+      simde_mm_set_pd(   -33.33,     25.98),
+      simde_mm_set_pd(    -3.50,     25.00) },
+    { simde_mm_set_pd(    65.35,     27.54),
+      simde_mm_set_pd(    96.11,     67.43),
+      simde_mm_set_pd(    65.35,     67.00) },
+    { simde_mm_set_pd(    -5.50,     -1.00),
+      simde_mm_set_pd(    55.23,     -2.09),
+      simde_mm_set_pd(    -5.50,     -2.00) },
+    { simde_mm_set_pd(     6.00,     10.00),
+      simde_mm_set_pd(     8.00,     90.89),
+      simde_mm_set_pd(     6.00,     90.00) },
+    { simde_mm_set_pd(     1.50,    -43.60),
+      simde_mm_set_pd(     4.33,     78.92),
+      simde_mm_set_pd(     1.50,     78.00) },
+    { simde_mm_set_pd(    -1.50,    -11.10),
+      simde_mm_set_pd(   -29.14,     93.94),
+      simde_mm_set_pd(    -1.50,     93.00) },
+    { simde_mm_set_pd(    -4.00,      0.00),
+      simde_mm_set_pd(    -2.00,    -45.32),
+      simde_mm_set_pd(    -4.00,    -45.00) },
+    { simde_mm_set_pd(    -2.50,     -0.50),
+      simde_mm_set_pd(   -53.35,     10.09),
+      simde_mm_set_pd(    -2.50,     10.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_round_sd(test_vec[i].a, test_vec[i].b, simde_MM_FROUND_TO_ZERO);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_round_ss(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(     5.50f,     -1.50f,      0.00f,    -51.67f),
+      simde_mm_set_ps(   -89.90f,      6.50f,     89.95f,     -2.00f),
+      simde_mm_set_ps(     5.50f,     -1.50f,      0.00f,     -2.00f) },
+    { simde_mm_set_ps(   -17.15f,      8.50f,    -96.60f,    -68.87f),
+      simde_mm_set_ps(    23.66f,    -55.04f,     -4.64f,      3.50f),
+      simde_mm_set_ps(   -17.15f,      8.50f,    -96.60f,      3.00f) },
+    { simde_mm_set_ps(    10.00f,     -3.50f,    -86.14f,     -1.00f),
+      simde_mm_set_ps(    -2.50f,     -4.00f,     -3.67f,     64.50f),
+      simde_mm_set_ps(    10.00f,     -3.50f,    -86.14f,     64.00f) },
+    { simde_mm_set_ps(    22.03f,     78.00f,    -49.33f,    -80.80f),
+      simde_mm_set_ps(     3.00f,    -91.83f,      2.00f,     93.20f),
+      simde_mm_set_ps(    22.03f,     78.00f,    -49.33f,     93.00f) },
+    { simde_mm_set_ps(    91.68f,     -8.00f,     -9.00f,     -9.50f),
+      simde_mm_set_ps(    28.47f,     43.27f,     43.59f,     70.75f),
+      simde_mm_set_ps(    91.68f,     -8.00f,     -9.00f,     70.00f) },
+    { simde_mm_set_ps(   -30.71f,      2.65f,    -46.67f,    -31.30f),
+      simde_mm_set_ps(   -98.20f,      0.00f,     68.58f,     -6.00f),
+      simde_mm_set_ps(   -30.71f,      2.65f,    -46.67f,     -6.00f) },
+    { simde_mm_set_ps(     2.00f,     60.06f,     -6.00f,     -2.50f),
+      simde_mm_set_ps(   -37.14f,    -10.69f,      1.39f,      1.50f),
+      simde_mm_set_ps(     2.00f,     60.06f,     -6.00f,      1.00f) },
+    { simde_mm_set_ps(   -98.66f,      2.50f,     62.68f,      5.28f),
+      simde_mm_set_ps(    80.52f,    -68.05f,    -17.36f,      2.36f),
+      simde_mm_set_ps(   -98.66f,      2.50f,     62.68f,      2.00f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_round_ss(test_vec[i].a, test_vec[i].b, simde_MM_FROUND_TO_ZERO);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_dp_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128d a;
+    simde__m128d b;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(   -80.55,     46.38),
+      simde_mm_set_pd(   -77.57,     47.10),
+      simde_mm_set_pd(     0.00,   8432.76) },
+    { simde_mm_set_pd(    47.70,    -89.61),
+      simde_mm_set_pd(   -69.56,     61.05),
+      simde_mm_set_pd(     0.00,  -8788.70) },
+    { simde_mm_set_pd(    39.02,     85.41),
+      simde_mm_set_pd(    32.19,     79.32),
+      simde_mm_set_pd(     0.00,   8030.77) },
+    { simde_mm_set_pd(   -76.60,     82.08),
+      simde_mm_set_pd(   -57.64,    -44.82),
+      simde_mm_set_pd(     0.00,    736.40) },
+    { simde_mm_set_pd(   -11.32,     -8.69),
+      simde_mm_set_pd(    36.19,    -97.05),
+      simde_mm_set_pd(     0.00,    433.69) },
+    { simde_mm_set_pd(    50.58,     81.96),
+      simde_mm_set_pd(     8.74,    -14.11),
+      simde_mm_set_pd(     0.00,   -714.39) },
+    { simde_mm_set_pd(   -40.96,     -8.19),
+      simde_mm_set_pd(    41.07,     15.87),
+      simde_mm_set_pd(     0.00,  -1812.20) },
+    { simde_mm_set_pd(   -19.65,     99.08),
+      simde_mm_set_pd(     2.88,     53.56),
+      simde_mm_set_pd(     0.00,   5250.13) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_dp_pd(test_vec[i].a, test_vec[i].b, 0x31);
+    simde_assert_m128_f64_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_dp_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128 a;
+    simde__m128 b;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(   -49.53f,     68.98f,    -12.39f,    -90.17f),
+      simde_mm_set_ps(     2.86f,     91.65f,     30.11f,    -80.12f),
+      simde_mm_set_ps(     0.00f,   6709.70f,      0.00f,   6709.70f) },
+    { simde_mm_set_ps(    50.25f,    -97.90f,     37.87f,     59.19f),
+      simde_mm_set_ps(   -31.46f,     25.66f,     -5.60f,    -61.59f),
+      simde_mm_set_ps(     0.00f,  -5438.45f,      0.00f,  -5438.45f) },
+    { simde_mm_set_ps(    30.80f,     74.89f,    -99.29f,     36.59f),
+      simde_mm_set_ps(   -14.28f,     75.40f,    -93.30f,    -51.58f),
+      simde_mm_set_ps(     0.00f,   6936.62f,      0.00f,   6936.62f) },
+    { simde_mm_set_ps(    25.21f,     -5.97f,     -1.93f,     45.13f),
+      simde_mm_set_ps(    38.36f,    -89.02f,     54.59f,     50.91f),
+      simde_mm_set_ps(     0.00f,   3159.27f,      0.00f,   3159.27f) },
+    { simde_mm_set_ps(    63.00f,     88.97f,    -98.96f,    -27.75f),
+      simde_mm_set_ps(   -83.56f,    -28.97f,     15.26f,    -30.56f),
+      simde_mm_set_ps(     0.00f,  -5926.37f,      0.00f,  -5926.37f) },
+    { simde_mm_set_ps(   -98.54f,    -84.35f,    -55.81f,    -47.48f),
+      simde_mm_set_ps(    -2.07f,    -47.44f,     97.98f,    -40.48f),
+      simde_mm_set_ps(     0.00f,  -3342.30f,      0.00f,  -3342.30f) },
+    { simde_mm_set_ps(   -80.03f,     53.14f,     70.92f,    -47.74f),
+      simde_mm_set_ps(   -63.36f,     26.07f,    -90.86f,    -42.52f),
+      simde_mm_set_ps(     0.00f,    656.81f,      0.00f,    656.81f) },
+    { simde_mm_set_ps(    37.40f,     -4.20f,     64.76f,    -36.24f),
+      simde_mm_set_ps(   -63.18f,    -76.22f,    -90.42f,     26.74f),
+      simde_mm_set_ps(     0.00f,  -9187.59f,      0.00f,  -9187.59f) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_dp_ps(test_vec[i].a, test_vec[i].b, 0xb5);
+    simde_assert_m128_f32_equal(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_minpos_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( -9152,  14289,   6056,   7951,  14269, -17660,  31111, -31405),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      5,   6056) },
+    { simde_mm_set_epi16(   770,    769,      0,    256,    256,    514,    256,    512),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      5,      0) },
+    { simde_mm_set_epi16(-19092, -15362, -11378, -17587,   4437,  31518,  10561,  30555),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      3,   4437) },
+    { simde_mm_set_epi16(   770,    256,    256,    514,      0,    513,    257,    259),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      3,      0) },
+    { simde_mm_set_epi16( -4280,  -8695,  -1100, -12138,  -8117,  21349,  31607,  -3148),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      2,  21349) },
+    { simde_mm_set_epi16(   771,    258,    256,      2,      1,    514,    515,    771),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      3,      1) },
+    { simde_mm_set_epi16(-31137,   1550,  -9918, -10068, -32534,  17102, -10486, -16788),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      6,   1550) },
+    { simde_mm_set_epi16(   257,    513,    513,    769,      2,    512,    258,      2),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      0,      2) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_minpos_epu16(test_vec[i].a);
+    simde_assert_m128i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mpsadbw_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x4d, 0x50, 0xb8, 0x3a, 0xf6, 0xfe, 0x42, 0x42,
+			0x62, 0x0e, 0xfe, 0xe2, 0xf2, 0x4f, 0x07, 0x35),
+      simde_mm_set_epi8(0xb6, 0x4c, 0xfd, 0xf7, 0x3e, 0x00, 0x48, 0x98,
+			0xa0, 0x2a, 0xb7, 0x1e, 0x63, 0xba, 0x91, 0x31),
+      simde_mm_set_epi16(   563,    327,    413,    451,    303,    219,    543,    357) },
+    { simde_mm_set_epi8(0x31, 0xf7, 0xee, 0xdc, 0x63, 0x03, 0x93, 0x79,
+			0x2d, 0xce, 0x23, 0x5d, 0x9a, 0x75, 0xbd, 0xab),
+      simde_mm_set_epi8(0x10, 0x12, 0xdd, 0xdd, 0x74, 0xb4, 0x38, 0xfd,
+			0xca, 0xff, 0xb0, 0x24, 0xa4, 0x64, 0x36, 0x0f),
+      simde_mm_set_epi16(   169,    181,    458,    469,    371,    490,    322,    404) },
+    { simde_mm_set_epi8(0xa3, 0xdb, 0x84, 0x71, 0xb4, 0xc0, 0x77, 0x13,
+			0x97, 0xb6, 0xe7, 0xe3, 0x2f, 0x2c, 0x32, 0xb4),
+      simde_mm_set_epi8(0x90, 0x52, 0xe5, 0x85, 0x14, 0x76, 0x35, 0x88,
+			0x8f, 0xf5, 0x2d, 0x13, 0x90, 0x42, 0x83, 0x32),
+      simde_mm_set_epi16(   418,    451,    342,    164,    333,    519,    567,    465) },
+    { simde_mm_set_epi8(0x5b, 0x82, 0x75, 0x33, 0xdc, 0x20, 0xac, 0xf3,
+			0x9e, 0xa8, 0x33, 0x0d, 0x49, 0xf7, 0x55, 0xc9),
+      simde_mm_set_epi8(0x22, 0x8e, 0xe7, 0xb1, 0x1b, 0xc7, 0x5f, 0x55,
+			0xfd, 0xea, 0x53, 0x75, 0x32, 0x04, 0x7b, 0xbb),
+      simde_mm_set_epi16(   375,    541,    322,    450,    484,    216,    237,    297) },
+    { simde_mm_set_epi8(0x49, 0x59, 0x15, 0xad, 0x78, 0x06, 0xc5, 0x9e,
+			0x61, 0xeb, 0x41, 0x95, 0x81, 0x0a, 0x9b, 0x82),
+      simde_mm_set_epi8(0xd7, 0x71, 0x10, 0xb8, 0xfe, 0x5a, 0xeb, 0xcf,
+			0x9f, 0xf1, 0x35, 0x76, 0xa9, 0x6b, 0x18, 0x55),
+      simde_mm_set_epi16(   412,    385,    261,    458,    323,    282,    380,    111) },
+    { simde_mm_set_epi8(0x67, 0xa4, 0x76, 0x97, 0xc2, 0x41, 0xfa, 0x7a,
+			0xd1, 0xec, 0xaa, 0x02, 0xc7, 0x69, 0xb3, 0x28),
+      simde_mm_set_epi8(0xc8, 0xa9, 0xed, 0xed, 0x59, 0xe8, 0x9b, 0x57,
+			0x23, 0x0a, 0xda, 0xef, 0x9d, 0x29, 0x0f, 0x1d),
+      simde_mm_set_epi16(   349,    422,    464,    363,    396,    339,    373,    685) },
+    { simde_mm_set_epi8(0x22, 0x67, 0x67, 0x3f, 0xe6, 0x35, 0x78, 0xc4,
+			0x47, 0x13, 0xa9, 0xb8, 0x66, 0x87, 0xdb, 0x6b),
+      simde_mm_set_epi8(0xf3, 0xca, 0x3b, 0xa2, 0x58, 0x68, 0x09, 0x7b,
+			0x22, 0x01, 0x96, 0x71, 0x59, 0x8e, 0xbf, 0xea),
+      simde_mm_set_epi16(   375,    271,    362,    361,    226,    454,    419,    145) },
+    { simde_mm_set_epi8(0xe4, 0xb2, 0xba, 0xd2, 0x63, 0xd9, 0x41, 0xe9,
+			0x13, 0x74, 0xad, 0xdc, 0xf7, 0xe9, 0xe8, 0x3f),
+      simde_mm_set_epi8(0x6e, 0x3e, 0x83, 0xc4, 0xde, 0xa4, 0xd9, 0x83,
+			0xea, 0x91, 0x67, 0xc9, 0x9a, 0x7c, 0x39, 0x66),
+      simde_mm_set_epi16(   306,    133,    320,    277,    409,    426,    168,    333) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mpsadbw_epu8(test_vec[i].a, test_vec[i].b, 5);
+    simde_assert_m128i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpeq_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(-3561813423550613875), INT64_C( 8623843478771139182)),
+      simde_mm_set_epi64x(INT64_C(-2214408822805619980), INT64_C( 1648495331598290555)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm_set_epi64x(INT64_C( 8430660336268826327), INT64_C( 5658122942879582530)),
+      simde_mm_set_epi64x(INT64_C( 8430660336268826327), INT64_C( 5658122942879582530)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C(-7356560334179926947), INT64_C( 8788965608883213883)),
+      simde_mm_set_epi64x(INT64_C( 4157222064883746990), INT64_C( -272329261090646651)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm_set_epi64x(INT64_C( 5824733260392989285), INT64_C( 1064939686272604721)),
+      simde_mm_set_epi64x(INT64_C(-5488817308048397849), INT64_C(-3674113226969660934)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm_set_epi64x(INT64_C( 7934899360517665944), INT64_C(-2702325168932611971)),
+      simde_mm_set_epi64x(INT64_C( 5491806434736783612), INT64_C(-5586019868431057054)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm_set_epi64x(INT64_C(-7232456860375249732), INT64_C(-8091996563311827173)),
+      simde_mm_set_epi64x(INT64_C(-7232456860375249732), INT64_C(-8091996563311827173)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C( 1245689602418204890), INT64_C(-2123351763994195789)),
+      simde_mm_set_epi64x(INT64_C( 3752840428331199928), INT64_C(-8166381159303767485)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm_set_epi64x(INT64_C(-5607510790531784663), INT64_C( 5546255433770838080)),
+      simde_mm_set_epi64x(INT64_C(-2914345525378527565), INT64_C( 7199347229397829999)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cmpeq_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepi8_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x27, 0x3b, 0x10, 0xa6, 0x00, 0xeb, 0x30, 0x2b,
+			0xb5, 0xfe, 0xfd, 0xa6, 0xe2, 0x9b, 0x2a, 0xf0),
+      simde_mm_set_epi16(   -75,     -2,     -3,    -90,    -30,   -101,     42,    -16) },
+    { simde_mm_set_epi8(0xc2, 0xdd, 0xa0, 0xeb, 0xe6, 0xd8, 0x2e, 0xf0,
+			0x45, 0xad, 0x6d, 0x01, 0x25, 0xa9, 0x86, 0xaa),
+      simde_mm_set_epi16(    69,    -83,    109,      1,     37,    -87,   -122,    -86) },
+    { simde_mm_set_epi8(0x14, 0xbc, 0x79, 0xe2, 0xb6, 0x74, 0xd2, 0x63,
+			0x0b, 0x16, 0x63, 0x0d, 0xb7, 0x26, 0x32, 0x25),
+      simde_mm_set_epi16(    11,     22,     99,     13,    -73,     38,     50,     37) },
+    { simde_mm_set_epi8(0x57, 0x2b, 0xfb, 0x80, 0x6a, 0x5f, 0x9c, 0x78,
+			0x55, 0x14, 0xfa, 0xe8, 0x0d, 0x05, 0x78, 0xf0),
+      simde_mm_set_epi16(    85,     20,     -6,    -24,     13,      5,    120,    -16) },
+    { simde_mm_set_epi8(0x1d, 0x57, 0xff, 0x03, 0xff, 0x11, 0xc2, 0xf7,
+			0x79, 0x3e, 0x9e, 0x8a, 0xbc, 0x72, 0x87, 0xdc),
+      simde_mm_set_epi16(   121,     62,    -98,   -118,    -68,    114,   -121,    -36) },
+    { simde_mm_set_epi8(0x55, 0x87, 0x18, 0x86, 0xe2, 0x39, 0x33, 0x81,
+			0x6c, 0x76, 0xad, 0x45, 0xca, 0x30, 0xb3, 0xd6),
+      simde_mm_set_epi16(   108,    118,    -83,     69,    -54,     48,    -77,    -42) },
+    { simde_mm_set_epi8(0x00, 0x16, 0x35, 0x1a, 0x36, 0x40, 0x5b, 0xf0,
+			0x31, 0xb6, 0xd9, 0xef, 0x68, 0x8d, 0x35, 0xb7),
+      simde_mm_set_epi16(    49,    -74,    -39,    -17,    104,   -115,     53,    -73) },
+    { simde_mm_set_epi8(0x38, 0xd4, 0xf4, 0x56, 0x25, 0x6e, 0x71, 0xb6,
+			0x94, 0x55, 0x2d, 0x7c, 0xfa, 0x68, 0xc8, 0x12),
+      simde_mm_set_epi16(  -108,     85,     45,    124,     -6,    104,    -56,     18) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepi8_epi16(test_vec[i].a);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepi8_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x07, 0x3c, 0xa7, 0xe2, 0x3d, 0x5f, 0x71, 0xc4,
+			0xbf, 0x49, 0x86, 0x8f, 0x63, 0x4d, 0x23, 0x9b),
+      simde_mm_set_epi32(         99,          77,          35,        -101) },
+    { simde_mm_set_epi8(0xcc, 0x3f, 0xce, 0x8a, 0xe5, 0x47, 0x50, 0x05,
+			0xff, 0x4a, 0xb7, 0xe1, 0x0a, 0x1f, 0x64, 0x49),
+      simde_mm_set_epi32(         10,          31,         100,          73) },
+    { simde_mm_set_epi8(0xdc, 0x40, 0x37, 0xd1, 0x17, 0xa8, 0x1f, 0x0f,
+			0x37, 0xbd, 0xbb, 0x04, 0x79, 0x87, 0x85, 0x53),
+      simde_mm_set_epi32(        121,        -121,        -123,          83) },
+    { simde_mm_set_epi8(0x7f, 0xaa, 0xeb, 0xb9, 0xd0, 0xa0, 0xe9, 0xb4,
+			0xb9, 0x70, 0xf6, 0x1e, 0x91, 0xe8, 0x5a, 0x84),
+      simde_mm_set_epi32(       -111,         -24,          90,        -124) },
+    { simde_mm_set_epi8(0xb5, 0x6c, 0xc3, 0xfe, 0xd3, 0x8e, 0xbb, 0x4d,
+			0x11, 0x55, 0x7b, 0x1e, 0x29, 0x41, 0x77, 0x5b),
+      simde_mm_set_epi32(         41,          65,         119,          91) },
+    { simde_mm_set_epi8(0x53, 0x6a, 0x39, 0x34, 0xa1, 0x10, 0x06, 0xfe,
+			0xf0, 0x9c, 0x76, 0x99, 0x11, 0x81, 0xf5, 0x4f),
+      simde_mm_set_epi32(         17,        -127,         -11,          79) },
+    { simde_mm_set_epi8(0xef, 0x48, 0xde, 0x09, 0xfb, 0xb4, 0xd0, 0x96,
+			0xe0, 0x4b, 0x53, 0x65, 0x7b, 0x77, 0xf3, 0xb4),
+      simde_mm_set_epi32(        123,         119,         -13,         -76) },
+    { simde_mm_set_epi8(0xdb, 0xbf, 0x21, 0x8e, 0xbd, 0xd4, 0x44, 0x66,
+			0x0c, 0xfd, 0x5e, 0x7e, 0xa6, 0xef, 0x6f, 0x7b),
+      simde_mm_set_epi32(        -90,         -17,         111,         123) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepi8_epi32(test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepi8_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x86, 0x5f, 0x06, 0x0e, 0xd9, 0x42, 0xd8, 0xac,
+			0x80, 0xea, 0x42, 0xce, 0xd7, 0x0a, 0xbe, 0x6c),
+      simde_mm_set_epi64x(INT64_C(                 -66), INT64_C(                 108)) },
+    { simde_mm_set_epi8(0x61, 0x75, 0xbe, 0x7d, 0x42, 0xbd, 0xb3, 0x1d,
+			0x9c, 0x22, 0xe6, 0xec, 0x5d, 0x16, 0x6c, 0x66),
+      simde_mm_set_epi64x(INT64_C(                 108), INT64_C(                 102)) },
+    { simde_mm_set_epi8(0x4d, 0x50, 0xb8, 0x3a, 0xf6, 0xfe, 0x42, 0x42,
+			0x62, 0x0e, 0xfe, 0xe2, 0xf2, 0x4f, 0x07, 0x35),
+      simde_mm_set_epi64x(INT64_C(                   7), INT64_C(                  53)) },
+    { simde_mm_set_epi8(0xb6, 0x4c, 0xfd, 0xf7, 0x3e, 0x00, 0x48, 0x98,
+			0xa0, 0x2a, 0xb7, 0x1e, 0x63, 0xba, 0x91, 0x31),
+      simde_mm_set_epi64x(INT64_C(                -111), INT64_C(                  49)) },
+    { simde_mm_set_epi8(0x31, 0xf7, 0xee, 0xdc, 0x63, 0x03, 0x93, 0x79,
+			0x2d, 0xce, 0x23, 0x5d, 0x9a, 0x75, 0xbd, 0xab),
+      simde_mm_set_epi64x(INT64_C(                 -67), INT64_C(                 -85)) },
+    { simde_mm_set_epi8(0x10, 0x12, 0xdd, 0xdd, 0x74, 0xb4, 0x38, 0xfd,
+			0xca, 0xff, 0xb0, 0x24, 0xa4, 0x64, 0x36, 0x0f),
+      simde_mm_set_epi64x(INT64_C(                  54), INT64_C(                  15)) },
+    { simde_mm_set_epi8(0xa3, 0xdb, 0x84, 0x71, 0xb4, 0xc0, 0x77, 0x13,
+			0x97, 0xb6, 0xe7, 0xe3, 0x2f, 0x2c, 0x32, 0xb4),
+      simde_mm_set_epi64x(INT64_C(                  50), INT64_C(                 -76)) },
+    { simde_mm_set_epi8(0x90, 0x52, 0xe5, 0x85, 0x14, 0x76, 0x35, 0x88,
+			0x8f, 0xf5, 0x2d, 0x13, 0x90, 0x42, 0x83, 0x32),
+      simde_mm_set_epi64x(INT64_C(                -125), INT64_C(                  50)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepi8_epi64(test_vec[i].a);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepi16_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 23426,  30003,  -9184, -21261, -24920,  13069,  18935,  21961),
+      simde_mm_set_epi32(     -24920,       13069,       18935,       21961) },
+    { simde_mm_set_epi16(  8846,  -6223,   7111,  24405,   -534,  21365,  12804,  31675),
+      simde_mm_set_epi32(       -534,       21365,       12804,       31675) },
+    { simde_mm_set_epi16( 18777,   5549,  30726, -14946,  25067,  16789, -32502, -25726),
+      simde_mm_set_epi32(      25067,       16789,      -32502,      -25726) },
+    { simde_mm_set_epi16(-10383,   4280,   -422,  -5169, -24591,  13686, -22165,   6229),
+      simde_mm_set_epi32(     -24591,       13686,      -22165,        6229) },
+    { simde_mm_set_epi16( 26532,  30359, -15807,  -1414, -11796, -22014, -14487, -19672),
+      simde_mm_set_epi32(     -11796,      -22014,      -14487,      -19672) },
+    { simde_mm_set_epi16(-14167,  -4627,  23016, -25769,   8970,  -9489, -25303,   3869),
+      simde_mm_set_epi32(       8970,       -9489,      -25303,        3869) },
+    { simde_mm_set_epi16(  8807,  26431,  -6603,  30916,  18195, -22088,  26247,  -9365),
+      simde_mm_set_epi32(      18195,      -22088,       26247,       -9365) },
+    { simde_mm_set_epi16( -3126,  15266,  22632,   2427,   8705, -27023,  22926, -16406),
+      simde_mm_set_epi32(       8705,      -27023,       22926,      -16406) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepi16_epi32(test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepi16_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( -6990, -17710,  25561,  16873,   4980, -21028,  -2071,  -6081),
+      simde_mm_set_epi64x(INT64_C(               -2071), INT64_C(               -6081)) },
+    { simde_mm_set_epi16( 28222, -31804,  -8540,  -9853,  -5487,  26569, -25988,  14694),
+      simde_mm_set_epi64x(INT64_C(              -25988), INT64_C(               14694)) },
+    { simde_mm_set_epi16( 20763,  13200,  -4758, -13662,  12672, -28235, -18814,  -7733),
+      simde_mm_set_epi64x(INT64_C(              -18814), INT64_C(               -7733)) },
+    { simde_mm_set_epi16( 18061, -17577,  22863,   4717, -14682,  32000, -19463, -24900),
+      simde_mm_set_epi64x(INT64_C(              -19463), INT64_C(              -24900)) },
+    { simde_mm_set_epi16(  2954, -20387, -29493,  17194,   7481,  -3492,   8076, -11362),
+      simde_mm_set_epi64x(INT64_C(                8076), INT64_C(              -11362)) },
+    { simde_mm_set_epi16(-14282, -10463,  19570, -26724,   5105, -16207,  30765, -26976),
+      simde_mm_set_epi64x(INT64_C(               30765), INT64_C(              -26976)) },
+    { simde_mm_set_epi16( -5789,  14246,  20196,   -188, -15277, -32073,  22674, -11223),
+      simde_mm_set_epi64x(INT64_C(               22674), INT64_C(              -11223)) },
+    { simde_mm_set_epi16(-23911,  13762,  16476,   4876,  23775,    410,  31083,  -5739),
+      simde_mm_set_epi64x(INT64_C(               31083), INT64_C(               -5739)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepi16_epi64(test_vec[i].a);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepi32_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1644796775,   -72481548, -1431302686,  1782132537),
+      simde_mm_set_epi64x(INT64_C(         -1431302686), INT64_C(          1782132537)) },
+    { simde_mm_set_epi32( 1970317028,   301341712, -1543435953,   702060283),
+      simde_mm_set_epi64x(INT64_C(         -1543435953), INT64_C(           702060283)) },
+    { simde_mm_set_epi32( 1342712331,   935235000,  1127711169, -1151131533),
+      simde_mm_set_epi64x(INT64_C(          1127711169), INT64_C(         -1151131533)) },
+    { simde_mm_set_epi32(-1767025239,  1718179688,  2097365993,  1980423479),
+      simde_mm_set_epi64x(INT64_C(          2097365993), INT64_C(          1980423479)) },
+    { simde_mm_set_epi32(  300391966, -1504659592,   637019836,  -539122106),
+      simde_mm_set_epi64x(INT64_C(           637019836), INT64_C(          -539122106)) },
+    { simde_mm_set_epi32(-1922269908,  1982592299,  1011656497,  -752678050),
+      simde_mm_set_epi64x(INT64_C(          1011656497), INT64_C(          -752678050)) },
+    { simde_mm_set_epi32( -198864503,   245674448,   869396941,  1429965134),
+      simde_mm_set_epi64x(INT64_C(           869396941), INT64_C(          1429965134)) },
+    { simde_mm_set_epi32( -955685215,  -781654037, -1407415557,  2004918004),
+      simde_mm_set_epi64x(INT64_C(         -1407415557), INT64_C(          2004918004)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepi32_epi64(test_vec[i].a);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepu8_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x67, 0x6d, 0x73, 0x87, 0xfb, 0xbb, 0x46, 0x3c,
+			0xb3, 0x0d, 0xd0, 0x57, 0xd6, 0xbe, 0xfe, 0x7b),
+      simde_mm_set_epi16(   179,     13,    208,     87,    214,    190,    254,    123) },
+    { simde_mm_set_epi8(0x68, 0xcb, 0x1c, 0xc5, 0xcc, 0x9a, 0xda, 0xdf,
+			0x52, 0xf5, 0x06, 0xaf, 0xc3, 0xb3, 0xc3, 0xad),
+      simde_mm_set_epi16(    82,    245,      6,    175,    195,    179,    195,    173) },
+    { simde_mm_set_epi8(0xca, 0x34, 0x0f, 0x95, 0xc5, 0xee, 0x9e, 0x01,
+			0x4e, 0x2f, 0xd8, 0xce, 0x42, 0x68, 0xce, 0xcc),
+      simde_mm_set_epi16(    78,     47,    216,    206,     66,    104,    206,    204) },
+    { simde_mm_set_epi8(0xf4, 0xbe, 0x40, 0x0d, 0x2e, 0xb4, 0x09, 0x79,
+			0x4d, 0x5d, 0x16, 0x0d, 0x29, 0x2f, 0xa0, 0x48),
+      simde_mm_set_epi16(    77,     93,     22,     13,     41,     47,    160,     72) },
+    { simde_mm_set_epi8(0xaf, 0x88, 0xf8, 0x3f, 0x5b, 0xb4, 0x0b, 0x0f,
+			0x27, 0x3c, 0x7f, 0x84, 0x0c, 0x5e, 0x47, 0x4b),
+      simde_mm_set_epi16(    39,     60,    127,    132,     12,     94,     71,     75) },
+    { simde_mm_set_epi8(0xb3, 0xca, 0xb6, 0x44, 0xa5, 0xfa, 0x66, 0x8d,
+			0x52, 0x37, 0xf3, 0x07, 0x7d, 0x55, 0x61, 0xe7),
+      simde_mm_set_epi16(    82,     55,    243,      7,    125,     85,     97,    231) },
+    { simde_mm_set_epi8(0x1d, 0x9d, 0x7b, 0x53, 0x65, 0x35, 0xe5, 0x37,
+			0x33, 0xa9, 0xee, 0x28, 0x14, 0xf6, 0x0b, 0x35),
+      simde_mm_set_epi16(    51,    169,    238,     40,     20,    246,     11,     53) },
+    { simde_mm_set_epi8(0x01, 0x92, 0xcd, 0xb3, 0xa3, 0x5d, 0xbc, 0x26,
+			0x97, 0xf0, 0xaa, 0xb2, 0xba, 0x40, 0xa9, 0x1b),
+      simde_mm_set_epi16(   151,    240,    170,    178,    186,     64,    169,     27) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepu8_epi16(test_vec[i].a);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepu8_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x6f, 0x66, 0xd4, 0x8c, 0xc7, 0x6b, 0x52, 0x99,
+			0xc3, 0xa4, 0x35, 0x62, 0xe1, 0x51, 0xff, 0x7f),
+      simde_mm_set_epi32(        225,          81,         255,         127) },
+    { simde_mm_set_epi8(0x5d, 0x98, 0x1c, 0xa7, 0x87, 0x88, 0x5c, 0xb2,
+			0xc6, 0xab, 0x50, 0x62, 0x54, 0x89, 0x0c, 0xa7),
+      simde_mm_set_epi32(         84,         137,          12,         167) },
+    { simde_mm_set_epi8(0x63, 0x64, 0x27, 0xfe, 0x4a, 0xe3, 0x6e, 0x79,
+			0x9e, 0xbc, 0x8c, 0x3b, 0x66, 0x16, 0xa3, 0xb3),
+      simde_mm_set_epi32(        102,          22,         163,         179) },
+    { simde_mm_set_epi8(0x37, 0x83, 0xd8, 0xc3, 0x7a, 0x52, 0xe8, 0x8c,
+			0x53, 0x63, 0x5f, 0xd8, 0xb8, 0x28, 0xfc, 0x1c),
+      simde_mm_set_epi32(        184,          40,         252,          28) },
+    { simde_mm_set_epi8(0xa3, 0xdb, 0xca, 0xe8, 0x6f, 0x98, 0x3a, 0x59,
+			0x64, 0x9d, 0x49, 0x9e, 0x17, 0x0d, 0xd2, 0x0a),
+      simde_mm_set_epi32(         23,          13,         210,          10) },
+    { simde_mm_set_epi8(0x2c, 0x60, 0x93, 0xa7, 0xcf, 0xcd, 0x70, 0xf2,
+			0x40, 0x81, 0xe7, 0x8f, 0xe7, 0x61, 0x3b, 0x30),
+      simde_mm_set_epi32(        231,          97,          59,          48) },
+    { simde_mm_set_epi8(0x72, 0xb2, 0xa9, 0x9d, 0xbd, 0x1b, 0x9b, 0xaa,
+			0x6e, 0x7e, 0x77, 0xf7, 0xfc, 0x04, 0x26, 0x46),
+      simde_mm_set_epi32(        252,           4,          38,          70) },
+    { simde_mm_set_epi8(0x72, 0xee, 0x19, 0x4f, 0x7b, 0xdd, 0xe4, 0xa8,
+			0xfe, 0x32, 0x09, 0x38, 0x32, 0xc1, 0x23, 0xa3),
+      simde_mm_set_epi32(         50,         193,          35,         163) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepu8_epi32(test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepu8_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x0f, 0xcf, 0x79, 0xc3, 0x02, 0xbf, 0xc8, 0x0c,
+			0x28, 0x43, 0x9b, 0x74, 0x17, 0x84, 0x77, 0x57),
+      simde_mm_set_epi64x(INT64_C(                 119), INT64_C(                  87)) },
+    { simde_mm_set_epi8(0x46, 0x45, 0x7e, 0x93, 0xc9, 0x80, 0x00, 0xa8,
+			0x12, 0x82, 0x4b, 0xf7, 0xc5, 0xe2, 0xd3, 0x9c),
+      simde_mm_set_epi64x(INT64_C(                 211), INT64_C(                 156)) },
+    { simde_mm_set_epi8(0x20, 0x14, 0x62, 0x7a, 0x83, 0x62, 0x79, 0x52,
+			0xdb, 0x75, 0xbb, 0x31, 0x42, 0xd1, 0x13, 0xa3),
+      simde_mm_set_epi64x(INT64_C(                  19), INT64_C(                 163)) },
+    { simde_mm_set_epi8(0x5f, 0xb8, 0x74, 0xe9, 0xdd, 0x72, 0xab, 0xde,
+			0xf6, 0xe6, 0x4c, 0xa9, 0x5c, 0xb5, 0x57, 0x98),
+      simde_mm_set_epi64x(INT64_C(                  87), INT64_C(                 152)) },
+    { simde_mm_set_epi8(0xe1, 0x33, 0x7c, 0x33, 0xb7, 0xd6, 0x0d, 0x79,
+			0x7a, 0x90, 0xcf, 0x1e, 0xe4, 0x64, 0x13, 0xe8),
+      simde_mm_set_epi64x(INT64_C(                  19), INT64_C(                 232)) },
+    { simde_mm_set_epi8(0xfa, 0x68, 0x52, 0x24, 0x1c, 0xe1, 0x21, 0x76,
+			0xf1, 0x25, 0x52, 0xe0, 0xde, 0x21, 0x2d, 0xdb),
+      simde_mm_set_epi64x(INT64_C(                  45), INT64_C(                 219)) },
+    { simde_mm_set_epi8(0xc2, 0x28, 0x66, 0xd1, 0xd9, 0xb4, 0x38, 0x7b,
+			0x8c, 0xa4, 0x3e, 0x9d, 0x13, 0x45, 0xbf, 0x34),
+      simde_mm_set_epi64x(INT64_C(                 191), INT64_C(                  52)) },
+    { simde_mm_set_epi8(0xdc, 0x77, 0x07, 0x35, 0x00, 0x91, 0x8c, 0x48,
+			0xe6, 0x94, 0x46, 0xe9, 0xa2, 0xf4, 0x4e, 0x72),
+      simde_mm_set_epi64x(INT64_C(                  78), INT64_C(                 114)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepu8_epi64(test_vec[i].a);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepu16_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 32383,  30104, -19002,   1655,  -7597, -29220,  18720, -12547),
+      simde_mm_set_epi32(      57939,       36316,       18720,       52989) },
+    { simde_mm_set_epi16( 11533,  15815, -21874, -20565,  -6555, -25655,  15607,  17100),
+      simde_mm_set_epi32(      58981,       39881,       15607,       17100) },
+    { simde_mm_set_epi16(-28198, -15553, -25259, -16775, -11346, -30707, -32162, -21248),
+      simde_mm_set_epi32(      54190,       34829,       33374,       44288) },
+    { simde_mm_set_epi16(-18560,  14949, -23779, -16946,  26594, -25426,   8573,  15577),
+      simde_mm_set_epi32(      26594,       40110,        8573,       15577) },
+    { simde_mm_set_epi16(-11031,  14317, -16098,  10539, -23844,  17278,   4035, -24388),
+      simde_mm_set_epi32(      41692,       17278,        4035,       41148) },
+    { simde_mm_set_epi16(  3933,  22805, -19433, -22174,  -9011, -12007, -22272, -17991),
+      simde_mm_set_epi32(      56525,       53529,       43264,       47545) },
+    { simde_mm_set_epi16(  8166,  27367,  -8014,  16666, -21905, -14895, -13706,  20507),
+      simde_mm_set_epi32(      43631,       50641,       51830,       20507) },
+    { simde_mm_set_epi16(  2783, -31330, -29466, -18151, -15071,   1270,  -5771,  -4356),
+      simde_mm_set_epi32(      50465,        1270,       59765,       61180) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepu16_epi32(test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepu16_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16(  5314,  25928,  25509,  13293, -20741,  13246,   6025, -16394),
+      simde_mm_set_epi64x(INT64_C(                6025), INT64_C(               49142)) },
+    { simde_mm_set_epi16(-24694,  24600,   3271,  21690, -26101, -27200, -11961,  32130),
+      simde_mm_set_epi64x(INT64_C(               53575), INT64_C(               32130)) },
+    { simde_mm_set_epi16(-22107, -13469,  25523,  24611, -11415, -27796,   6845,   2753),
+      simde_mm_set_epi64x(INT64_C(                6845), INT64_C(                2753)) },
+    { simde_mm_set_epi16(-30085, -26580, -26440,   2814,  28876, -25558, -30399, -22349),
+      simde_mm_set_epi64x(INT64_C(               35137), INT64_C(               43187)) },
+    { simde_mm_set_epi16(  3703, -24231, -32747,  -3584,  -9721,  -5553,  -2070,  -8431),
+      simde_mm_set_epi64x(INT64_C(               63466), INT64_C(               57105)) },
+    { simde_mm_set_epi16( 28043,  14004, -28308,  26047,  -3508,  -4400,  -7067, -14176),
+      simde_mm_set_epi64x(INT64_C(               58469), INT64_C(               51360)) },
+    { simde_mm_set_epi16( -1246, -22521, -25342,  21926,  -3610,  22653,  -4585,  31555),
+      simde_mm_set_epi64x(INT64_C(               60951), INT64_C(               31555)) },
+    { simde_mm_set_epi16( 16776,   7120, -12304,  -6647,   5251,   3661,  21503,  29643),
+      simde_mm_set_epi64x(INT64_C(               21503), INT64_C(               29643)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepu16_epi64(test_vec[i].a);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cvtepu32_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1936049009,  -980003023,  -221779598,   506183052),
+      simde_mm_set_epi64x(INT64_C(          4073187698), INT64_C(           506183052)) },
+    { simde_mm_set_epi32( -373670629, -1804504024,   895806381,  -306604772),
+      simde_mm_set_epi64x(INT64_C(           895806381), INT64_C(          3988362524)) },
+    { simde_mm_set_epi32(-1988843367,  -136292445,  -917386386, -1543972552),
+      simde_mm_set_epi64x(INT64_C(          3377580910), INT64_C(          2750994744)) },
+    { simde_mm_set_epi32( 1223473658, -1483732478, -1598094484,  1064065217),
+      simde_mm_set_epi64x(INT64_C(          2696872812), INT64_C(          1064065217)) },
+    { simde_mm_set_epi32( 1537235933,  -397929047, -1705259087,  -894171395),
+      simde_mm_set_epi64x(INT64_C(          2589708209), INT64_C(          3400795901)) },
+    { simde_mm_set_epi32(  475650925, -1788377766,   801687638,  1346821844),
+      simde_mm_set_epi64x(INT64_C(           801687638), INT64_C(          1346821844)) },
+    { simde_mm_set_epi32(-1638809232,  -457188338,  1296705354,  -290626522),
+      simde_mm_set_epi64x(INT64_C(          1296705354), INT64_C(          4004340774)) },
+    { simde_mm_set_epi32(-1933703359, -1747916283,    21857582, -1260840457),
+      simde_mm_set_epi64x(INT64_C(            21857582), INT64_C(          3034126839)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cvtepu32_epi64(test_vec[i].a);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_max_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x4e, 0x79, 0xd3, 0x66, 0xcd, 0xa4, 0x53, 0xe2,
+			0x24, 0xee, 0xf8, 0x7b, 0xae, 0x7c, 0xca, 0x53),
+      simde_mm_set_epi8(0x20, 0x31, 0xa6, 0xdf, 0xd9, 0xce, 0x55, 0x4a,
+			0x87, 0xea, 0x56, 0x66, 0x12, 0x17, 0x32, 0xa9),
+      simde_mm_set_epi8(0x4e, 0x79, 0xd3, 0x66, 0xd9, 0xce, 0x55, 0x4a,
+			0x24, 0xee, 0x56, 0x7b, 0x12, 0x7c, 0x32, 0x53) },
+    { simde_mm_set_epi8(0x3b, 0x7e, 0xda, 0x3d, 0x95, 0xe7, 0x48, 0x65,
+			0x0b, 0x4d, 0xcb, 0x60, 0xeb, 0x07, 0x9c, 0xdd),
+      simde_mm_set_epi8(0x3b, 0x7e, 0xda, 0x3d, 0x95, 0xe7, 0x48, 0x65,
+			0x0b, 0x4d, 0xcb, 0x60, 0xeb, 0x07, 0x9c, 0xdd),
+      simde_mm_set_epi8(0x3b, 0x7e, 0xda, 0x3d, 0x95, 0xe7, 0x48, 0x65,
+			0x0b, 0x4d, 0xcb, 0x60, 0xeb, 0x07, 0x9c, 0xdd) },
+    { simde_mm_set_epi8(0x58, 0xfc, 0x3c, 0xac, 0x29, 0xbf, 0xe3, 0x26,
+			0x48, 0xc3, 0xe9, 0x38, 0x44, 0x44, 0xd9, 0x13),
+      simde_mm_set_epi8(0x63, 0x95, 0xfe, 0xca, 0x71, 0xc5, 0x08, 0xee,
+			0x9d, 0xa0, 0xa9, 0xe8, 0xe2, 0x76, 0x05, 0x95),
+      simde_mm_set_epi8(0x63, 0xfc, 0x3c, 0xca, 0x71, 0xc5, 0x08, 0x26,
+			0x48, 0xc3, 0xe9, 0x38, 0x44, 0x76, 0x05, 0x13) },
+    { simde_mm_set_epi8(0xe3, 0xda, 0x9b, 0x29, 0x70, 0x05, 0xd8, 0xc3,
+			0x3d, 0x91, 0x8e, 0x46, 0xa7, 0x6b, 0x02, 0xed),
+      simde_mm_set_epi8(0xc6, 0x63, 0x40, 0x4a, 0x9c, 0x61, 0x20, 0xb9,
+			0x46, 0x8c, 0x0e, 0x9f, 0x47, 0xa0, 0x0c, 0x1c),
+      simde_mm_set_epi8(0xe3, 0x63, 0x40, 0x4a, 0x70, 0x61, 0x20, 0xc3,
+			0x46, 0x91, 0x0e, 0x46, 0x47, 0x6b, 0x0c, 0x1c) },
+    { simde_mm_set_epi8(0xc6, 0x5c, 0x03, 0x66, 0x9a, 0xe7, 0x66, 0xfb,
+			0x23, 0xaa, 0xed, 0x3e, 0xd9, 0xf3, 0x4a, 0xd5),
+      simde_mm_set_epi8(0x41, 0xa5, 0x6d, 0x90, 0x4b, 0x23, 0xd3, 0xae,
+			0xe8, 0xb1, 0x7f, 0xfa, 0x97, 0x36, 0x3f, 0x19),
+      simde_mm_set_epi8(0x41, 0x5c, 0x6d, 0x66, 0x4b, 0x23, 0x66, 0xfb,
+			0x23, 0xb1, 0x7f, 0x3e, 0xd9, 0x36, 0x4a, 0x19) },
+    { simde_mm_set_epi8(0x0d, 0x18, 0x35, 0x6b, 0x52, 0xdb, 0xbc, 0xea,
+			0x0b, 0xbe, 0xf5, 0x87, 0x87, 0xb4, 0xa3, 0x4e),
+      simde_mm_set_epi8(0x0d, 0x18, 0x35, 0x6b, 0x52, 0xdb, 0xbc, 0xea,
+			0x0b, 0xbe, 0xf5, 0x87, 0x87, 0xb4, 0xa3, 0x4e),
+      simde_mm_set_epi8(0x0d, 0x18, 0x35, 0x6b, 0x52, 0xdb, 0xbc, 0xea,
+			0x0b, 0xbe, 0xf5, 0x87, 0x87, 0xb4, 0xa3, 0x4e) },
+    { simde_mm_set_epi8(0xac, 0xeb, 0x5c, 0x2b, 0x5f, 0x27, 0xb9, 0xe5,
+			0x82, 0xe3, 0xda, 0x3b, 0x82, 0xdd, 0xc7, 0xef),
+      simde_mm_set_epi8(0xd0, 0xaa, 0xf9, 0x72, 0x1d, 0xee, 0xad, 0x1c,
+			0xc3, 0xf5, 0xa6, 0x4d, 0x94, 0xd4, 0xdb, 0x2b),
+      simde_mm_set_epi8(0xd0, 0xeb, 0x5c, 0x72, 0x5f, 0x27, 0xb9, 0x1c,
+			0xc3, 0xf5, 0xda, 0x4d, 0x94, 0xdd, 0xdb, 0x2b) },
+    { simde_mm_set_epi8(0x2b, 0xa3, 0x13, 0x29, 0xb1, 0x2b, 0x8e, 0x3f,
+			0xbc, 0xe3, 0xe2, 0x87, 0xe4, 0xa4, 0x3e, 0x5b),
+      simde_mm_set_epi8(0x69, 0xfd, 0xb1, 0xa3, 0xf2, 0x06, 0x1c, 0x32,
+			0xa1, 0xa5, 0x71, 0x14, 0x08, 0xcb, 0x7b, 0x51),
+      simde_mm_set_epi8(0x69, 0xfd, 0x13, 0x29, 0xf2, 0x2b, 0x1c, 0x3f,
+			0xbc, 0xe3, 0x71, 0x14, 0x08, 0xcb, 0x7b, 0x5b) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_max_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_max_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1771474251, -1068560384,  2118637522,  1770840578),
+      simde_mm_set_epi32(-1705307442,    99644333,  1565875549,  -311108367),
+      simde_mm_set_epi32(-1705307442,    99644333,  2118637522,  1770840578) },
+    { simde_mm_set_epi32(  509806265, -1721523827,  -881137004,  -359372456),
+      simde_mm_set_epi32(  509806265, -1721523827,  -881137004,  -359372456),
+      simde_mm_set_epi32(  509806265, -1721523827,  -881137004,  -359372456) },
+    { simde_mm_set_epi32(-1189622696,  1101440651,   375973780,  -946424846),
+      simde_mm_set_epi32( 1653724298,  2011940807,   495819654, -2063200525),
+      simde_mm_set_epi32( 1653724298,  2011940807,   495819654,  -946424846) },
+    { simde_mm_set_epi32(-1445500309,   765806611,   335839946, -1821929733),
+      simde_mm_set_epi32(-1595080465,   456154510, -1978718486, -1292389048),
+      simde_mm_set_epi32(-1445500309,   765806611,   335839946, -1292389048) },
+    { simde_mm_set_epi32(   -6734318,  1700127943, -1575672020, -1006772436),
+      simde_mm_set_epi32(  263631839,  1735442673,  -354492742,  1476958301),
+      simde_mm_set_epi32(  263631839,  1735442673,  -354492742,  1476958301) },
+    { simde_mm_set_epi32( 1577160257,   393289173, -1879362077,   -75630160),
+      simde_mm_set_epi32( 1577160257,   393289173, -1879362077,   -75630160),
+      simde_mm_set_epi32( 1577160257,   393289173, -1879362077,   -75630160) },
+    { simde_mm_set_epi32( 1835556083, -1545235393,    40450399,   917847398),
+      simde_mm_set_epi32( -864931754,   552823511,  -681369223,  -298522289),
+      simde_mm_set_epi32( 1835556083,   552823511,    40450399,   917847398) },
+    { simde_mm_set_epi32( 1359863936,  -255228957,   663432626,  -261154109),
+      simde_mm_set_epi32(  682924121,   818506652,  -275501286,  -280325510),
+      simde_mm_set_epi32( 1359863936,   818506652,   663432626,  -261154109) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_max_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_max_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16(-24046,   7242,  18221, -24522, -32181, -22517,  -9692,  -6796),
+      simde_mm_set_epi16( 15635, -30454,   4567, -10018,  -7994, -28879,  32626,   6756),
+      simde_mm_set_epi16(-24046, -30454,  18221, -10018,  -7994, -22517,  -9692,  -6796) },
+    { simde_mm_set_epi16(-26817,  10505, -30847, -22313,   -813,   5697, -31928,   9363),
+      simde_mm_set_epi16(-26817,  10505, -30847, -22313,   -813,   5697, -31928,   9363),
+      simde_mm_set_epi16(-26817,  10505, -30847, -22313,   -813,   5697, -31928,   9363) },
+    { simde_mm_set_epi16(  7798, -32286, -23499,   3197,  -7365, -19542, -22509,  15963),
+      simde_mm_set_epi16(-20561,   1106,  18764,  -5279,  12889,   6118, -27805,   5845),
+      simde_mm_set_epi16(-20561, -32286, -23499,  -5279,  -7365, -19542, -22509,  15963) },
+    { simde_mm_set_epi16(-31512,  28039,  14602,  23526,  21275, -21469,  17094,  19858),
+      simde_mm_set_epi16(-20096, -11765, -27558,  12402, -30526, -27088, -22158,  12469),
+      simde_mm_set_epi16(-20096, -11765, -27558,  23526, -30526, -21469, -22158,  19858) },
+    { simde_mm_set_epi16( 20493,  26610,  -5717, -15222, -19979,  -9212, -31783,  29010),
+      simde_mm_set_epi16( -6903,   6708,  -8741,   1346,  28803,   8747,   3468,  -6445),
+      simde_mm_set_epi16( -6903,  26610,  -5717, -15222, -19979,  -9212, -31783,  -6445) },
+    { simde_mm_set_epi16( 11952, -28131,   8453, -15697,  17365,  -5372, -25149,  26301),
+      simde_mm_set_epi16( 11952, -28131,   8453, -15697,  17365,  -5372, -25149,  26301),
+      simde_mm_set_epi16( 11952, -28131,   8453, -15697,  17365,  -5372, -25149,  26301) },
+    { simde_mm_set_epi16( 30351, -16932, -14763,  -3365,  31742,  10118, -13242,  20027),
+      simde_mm_set_epi16( -6705,  -5974,  21907,  24518,  23216, -16591,  -1862,  -9605),
+      simde_mm_set_epi16( -6705,  -5974, -14763,  -3365,  31742, -16591,  -1862,  -9605) },
+    { simde_mm_set_epi16(-29390, -21598,  -9220,  -4087,   2269,   4653, -21343, -16576),
+      simde_mm_set_epi16( 22073,   2322,   4611,   6605, -30266, -29880, -15477,  21386),
+      simde_mm_set_epi16(-29390, -21598,  -9220,  -4087, -30266, -29880, -15477, -16576) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_max_epu16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_max_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(  741556898,   316528639,  1939413572,  1491631752),
+      simde_mm_set_epi32( -736581564,  -311555366,   363374645,  1167638647),
+      simde_mm_set_epi32( -736581564,  -311555366,  1939413572,  1491631752) },
+    { simde_mm_set_epi32(-1986508981,   929091525,  -103769656, -1247408213),
+      simde_mm_set_epi32(-1986508981,   929091525,  -103769656, -1247408213),
+      simde_mm_set_epi32(-1986508981,   929091525,  -103769656, -1247408213) },
+    { simde_mm_set_epi32( 1331227198, -1951987254,   217864564, -1778814252),
+      simde_mm_set_epi32(  142108538,   636889022, -1946757718,  1856298900),
+      simde_mm_set_epi32( 1331227198, -1951987254, -1946757718, -1778814252) },
+    { simde_mm_set_epi32( 1024570770,  1999237172,  1122630355, -1256563369),
+      simde_mm_set_epi32( 1661320097, -1650509709, -1362431287, -1395238224),
+      simde_mm_set_epi32( 1661320097, -1650509709, -1362431287, -1256563369) },
+    { simde_mm_set_epi32( -652617539,  1158437909,  -432379677,  -582357892),
+      simde_mm_set_epi32(-2117305740,   242424982,  -209071665,   721878518),
+      simde_mm_set_epi32( -652617539,  1158437909,  -209071665,  -582357892) },
+    { simde_mm_set_epi32(-1225562306,  1717793531,  2137309229, -1824421163),
+      simde_mm_set_epi32(-1225562306,  1717793531,  2137309229, -1824421163),
+      simde_mm_set_epi32(-1225562306,  1717793531,  2137309229, -1824421163) },
+    { simde_mm_set_epi32( -442922600,  1549227190, -1769085124,  1106432174),
+      simde_mm_set_epi32(  618473785, -2136864063,   857120123,  -901783293),
+      simde_mm_set_epi32( -442922600, -2136864063, -1769085124,  -901783293) },
+    { simde_mm_set_epi32(  856770835, -1672899763, -2100084153, -1257535562),
+      simde_mm_set_epi32(-1645249976,   398445524, -1521069445,  -597796744),
+      simde_mm_set_epi32(-1645249976, -1672899763, -1521069445,  -597796744) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_max_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_min_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1806416197, -1814126092,   321331549,  1674546826),
+      simde_mm_set_epi32( -794051146,  -958397929,  -481647934, -1017485611),
+      simde_mm_set_epi32(-1806416197, -1814126092,  -481647934, -1017485611) },
+    { simde_mm_set_epi32(-1028466520,   631040976,  1821506709,   906483589),
+      simde_mm_set_epi32(-1028466520,   631040976,  1821506709,   906483589),
+      simde_mm_set_epi32(-1028466520,   631040976,  1821506709,   906483589) },
+    { simde_mm_set_epi32(  445045623,  -204996141,   512527401,   388712032),
+      simde_mm_set_epi32( 1735550009,  -101181083,    61782913, -1168538229),
+      simde_mm_set_epi32(  445045623,  -204996141,    61782913, -1168538229) },
+    { simde_mm_set_epi32(-1193803843,  1499574585,  2104475435, -2143482985),
+      simde_mm_set_epi32(   56010840, -1133969910,   -83029800,  -490619508),
+      simde_mm_set_epi32(-1193803843, -1133969910,   -83029800, -2143482985) },
+    { simde_mm_set_epi32( 1552497135, -1302042135,   721486439,  -967611146),
+      simde_mm_set_epi32(  937788932, -1466904565, -1970366532,  -541103565),
+      simde_mm_set_epi32(  937788932, -1466904565, -1970366532,  -967611146) },
+    { simde_mm_set_epi32( -945869044,   330514730,  -131384785,  -919379437),
+      simde_mm_set_epi32( -945869044,   330514730,  -131384785,  -919379437),
+      simde_mm_set_epi32( -945869044,   330514730,  -131384785,  -919379437) },
+    { simde_mm_set_epi32(  827100006,  1180488054, -1532300361,  1536242448),
+      simde_mm_set_epi32(-2081645151, -1458475046,   -56032025,  1814308602),
+      simde_mm_set_epi32(-2081645151, -1458475046, -1532300361,  1536242448) },
+    { simde_mm_set_epi32( -201294898,  -564057315,  1056751269,  -344320884),
+      simde_mm_set_epi32(-1642812539,  1974005781,  1459078699,  1345846682),
+      simde_mm_set_epi32(-1642812539,  -564057315,  1056751269,  -344320884) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_min_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_min_epu16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16(  3400, -12494, -22639, -32389, -30608, -20552,  -9666,  32685),
+      simde_mm_set_epi16(-13895,  28218, -23977,  -3176,  12938, -11701,  29046,  21986),
+      simde_mm_set_epi16(  3400,  28218, -23977, -32389,  12938, -20552,  29046,  21986) },
+    { simde_mm_set_epi16( 13943,     54,  12838,  22475,  -6203,  16282,  27902,  -1092),
+      simde_mm_set_epi16( 13943,     54,  12838,  22475,  -6203,  16282,  27902,  -1092),
+      simde_mm_set_epi16( 13943,     54,  12838,  22475,  -6203,  16282,  27902,  -1092) },
+    { simde_mm_set_epi16(-22876,  19249,  -2767, -24382,   6264, -24871,  31955, -32701),
+      simde_mm_set_epi16( -6472, -12834,  13274,  26235,  31053, -27143,   3337,  22136),
+      simde_mm_set_epi16(-22876,  19249,  13274,  26235,   6264, -27143,   3337,  22136) },
+    { simde_mm_set_epi16(  8452, -18984, -24130, -11395, -26425, -27770, -13560, -32011),
+      simde_mm_set_epi16( 22903, -25197,  22612, -12480, -31410, -13238,  -1709,  -5808),
+      simde_mm_set_epi16(  8452, -25197,  22612, -12480, -31410, -27770, -13560, -32011) },
+    { simde_mm_set_epi16(-17427,  14499,  13594, -16365,   1466,  25728,  20085,  -6250),
+      simde_mm_set_epi16( 30547,  12707,  -3840,  13440,     37,  -8327, -15152,  -3154),
+      simde_mm_set_epi16( 30547,  12707,  13594,  13440,     37,  25728,  20085,  -6250) },
+    { simde_mm_set_epi16( 29761, -15203,   -769,  30392, -11241,  23146,  24871, -16011),
+      simde_mm_set_epi16( 29761, -15203,   -769,  30392, -11241,  23146,  24871, -16011),
+      simde_mm_set_epi16( 29761, -15203,   -769,  30392, -11241,  23146,  24871, -16011) },
+    { simde_mm_set_epi16( 26604,  10731,  10593,  21398,  20245,   2198, -16578, -21342),
+      simde_mm_set_epi16( -9352, -19253, -12875,  13621,  25611,   -413, -22202,  29463),
+      simde_mm_set_epi16( 26604,  10731,  10593,  13621,  20245,   2198, -22202,  29463) },
+    { simde_mm_set_epi16( 21483,  11001,  25708, -19400, -22231,   9836,  10332, -26937),
+      simde_mm_set_epi16( 24842,  -7650,  12748, -15955, -15977, -26870, -19701,  30489),
+      simde_mm_set_epi16( 21483,  11001,  12748, -19400, -22231,   9836,  10332,  30489) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_min_epu16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_min_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32( -881217721, -2006423242, -1628134991, -1926692439),
+      simde_mm_set_epi32( -139377740,   657129729,  2004721430,   561801323),
+      simde_mm_set_epi32( -881217721,   657129729,  2004721430,   561801323) },
+    { simde_mm_set_epi32( -781049867, -1798457410, -1717139401,  -823111792),
+      simde_mm_set_epi32( -781049867, -1798457410, -1717139401,  -823111792),
+      simde_mm_set_epi32( -781049867, -1798457410, -1717139401,  -823111792) },
+    { simde_mm_set_epi32(-1374771019,  1195771988,  -596104155, -1040546784),
+      simde_mm_set_epi32( 1049334912,  1531168886,   172392187,  1611379884),
+      simde_mm_set_epi32( 1049334912,  1195771988,   172392187,  1611379884) },
+    { simde_mm_set_epi32( 1318257868,  -463761220,  -928118141,  1325247076),
+      simde_mm_set_epi32( 1431579672,   464636889, -2035724044,  1309998463),
+      simde_mm_set_epi32( 1318257868,   464636889, -2035724044,  1309998463) },
+    { simde_mm_set_epi32(  944915117,   933985864,  1098346332, -1602892942),
+      simde_mm_set_epi32( 1753821881, -1962416316,   570811421, -1274339198),
+      simde_mm_set_epi32(  944915117,   933985864,   570811421, -1602892942) },
+    { simde_mm_set_epi32( 1850232665, -1702744845,  -101000315, -1041390299),
+      simde_mm_set_epi32( 1850232665, -1702744845,  -101000315, -1041390299),
+      simde_mm_set_epi32( 1850232665, -1702744845,  -101000315, -1041390299) },
+    { simde_mm_set_epi32(  166551473,   -79491200,  1836130525,  1253289531),
+      simde_mm_set_epi32(  619449433,   708482351,   616423219,   317146121),
+      simde_mm_set_epi32(  166551473,   708482351,   616423219,   317146121) },
+    { simde_mm_set_epi32(-1437125943,  -518001600,  -467773722, -1773013459),
+      simde_mm_set_epi32( -802716805,  -904077580,  -784918140, -1577824501),
+      simde_mm_set_epi32(-1437125943,  -904077580,  -784918140, -1773013459) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_min_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mul_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-2046533378, -1850322198,   -43771082, -1729388632),
+      simde_mm_set_epi32( 1394512378,  2064802828, -1648986541, -1865789838),
+      simde_mm_set_epi64x(INT64_C(-3820550507141575944), INT64_C( 3226675735538321616)) },
+    { simde_mm_set_epi32( 2123373507,  1547587514, -1208453784,  -970602567),
+      simde_mm_set_epi32( 2123373507,  1547587514, -1208453784,  -970602567),
+      simde_mm_set_epi64x(INT64_C( 2395027113488700196), INT64_C(  942069343066989489)) },
+    { simde_mm_set_epi32(-2094080503,  1056799123, -1242541241,  -357961525),
+      simde_mm_set_epi32( -617845047,  -293790980,  -660117517,  -449944527),
+      simde_mm_set_epi64x(INT64_C( -310478050009310540), INT64_C(  161062829050323675)) },
+    { simde_mm_set_epi32( 1628111161,  1950857672,  1264411980,  2069383759),
+      simde_mm_set_epi32( 2012627225,  1124124467,  1448308219,  1856743068),
+      simde_mm_set_epi64x(INT64_C( 2193006840729860824), INT64_C( 3842313949555032612)) },
+    { simde_mm_set_epi32( -660757099,   649910545,  1796610639, -2010609889),
+      simde_mm_set_epi32(    7211343,  -211647813,  -947846742,   798840659),
+      simde_mm_set_epi64x(INT64_C( -137552145494888085), INT64_C(-1606156928720676851)) },
+    { simde_mm_set_epi32( -240518305, -1278332970,  -203564467, -1997125381),
+      simde_mm_set_epi32( -240518305, -1278332970,  -203564467, -1997125381),
+      simde_mm_set_epi64x(INT64_C( 1634135182189020900), INT64_C( 3988509787434395161)) },
+    { simde_mm_set_epi32(-1106646572,  -146016069, -1601060488,  1132970466),
+      simde_mm_set_epi32( -486629395,  1679173409, -1398725314,    98876069),
+      simde_mm_set_epi64x(INT64_C( -245186300351509221), INT64_C(  112023665971178154)) },
+    { simde_mm_set_epi32( 1356545760, -1162800652,   767496988,  1443689341),
+      simde_mm_set_epi32( -755091777,  1737064234,  -547819457,  -109725088),
+      simde_mm_set_epi64x(INT64_C(-2019859423861080568), INT64_C( -158408939985887008)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mul_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mullo_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(  334879311,  -475565369,   550510258,  1503070753),
+      simde_mm_set_epi32( -841782445,    15233498,  -424398974,   690872701),
+      simde_mm_set_epi32( 1829883037,  -895904650,  1618625636, -1888226531) },
+    { simde_mm_set_epi32(  686200209,  -683435573, -1898876437,    12117664),
+      simde_mm_set_epi32(  686200209,  -683435573, -1898876437,    12117664),
+      simde_mm_set_epi32( 1743658017,  -693745927,  -395883079,  1438901248) },
+    { simde_mm_set_epi32( -762870172,  1741339718,  -856269884, -2104388432),
+      simde_mm_set_epi32(  449010893,  -127588920,  -660523841,   709884416),
+      simde_mm_set_epi32( -788623852,  2067215536,   213272380,  -310124544) },
+    { simde_mm_set_epi32( 1485208887,  -396837171,  -436304217,  1752935277),
+      simde_mm_set_epi32( 1496869133,  -961612415,  -547737288,  -242964327),
+      simde_mm_set_epi32(  725084875,  1084773965,  -685151352, -1684210651) },
+    { simde_mm_set_epi32(-1613151814,  -266274234, -1771397336,  -623852754),
+      simde_mm_set_epi32( 1204325914,  -558347117,  1178424249,   404393836),
+      simde_mm_set_epi32(-1378494236,  1133280818,   556727272,   264571240) },
+    { simde_mm_set_epi32( -732899395, -1384368077,   -16328069,  -548939025),
+      simde_mm_set_epi32( -732899395, -1384368077,   -16328069,  -548939025),
+      simde_mm_set_epi32(-1813053047,  1807637033,    37336857, -1915884767) },
+    { simde_mm_set_epi32( 1139999951,  1605000601,   816408651,  -404898397),
+      simde_mm_set_epi32( 2146915585,   709653412, -1485490400,  1019284567),
+      simde_mm_set_epi32( 1229242319, -1264865020,   299640416,  1562515045) },
+    { simde_mm_set_epi32(-1892808142,  -481024450, -1662333145,  2023638985),
+      simde_mm_set_epi32( 1396820921,  2067042107,   441249706, -1781458343),
+      simde_mm_set_epi32( -955448286,  -195464630,  -521733914, -1704304927) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mullo_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_packus_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(  263795733,   535699117,  -207350834,  -724884536),
+      simde_mm_set_epi32(   -3666664,     1489804,    -1943423,        -169),
+      simde_x_mm_set_epu32(UINT32_C(0x0000ffff), UINT32_C(0x00000000), UINT32_C(0xffffffff), UINT32_C(0x00000000)) },
+    { simde_mm_set_epi32(   -2617945,    -2093160,     2851295,     2096704),
+      simde_mm_set_epi32(    2983216,     3866730,     -949223,      605805),
+      simde_x_mm_set_epu32(UINT32_C(0xffffffff), UINT32_C(0x0000ffff), UINT32_C(0x00000000), UINT32_C(0xffffffff)) },
+    { simde_mm_set_epi32( -126413117,  -191245253,     2734591,  -205585511),
+      simde_mm_set_epi32(      85677,      -20455,      -39478,      -30896),
+      simde_x_mm_set_epu32(UINT32_C(0xffff0000), UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0xffff0000)) },
+    { simde_mm_set_epi32(  -48646060,   -34805178,    63250960,    40119914),
+      simde_mm_set_epi32( -203849815,   287391570,   178351090,   210172258),
+      simde_x_mm_set_epu32(UINT32_C(0x0000ffff), UINT32_C(0xffffffff), UINT32_C(0x00000000), UINT32_C(0xffffffff)) },
+    { simde_mm_set_epi32(     189277,     1439937,     -997783,    -1240975),
+      simde_mm_set_epi32(     462811,      473691,      -29577,      410913),
+      simde_x_mm_set_epu32(UINT32_C(0xffffffff), UINT32_C(0x0000ffff), UINT32_C(0xffffffff), UINT32_C(0x00000000)) },
+    { simde_mm_set_epi32(     -85599,       74770,       55656,      -50930),
+      simde_mm_set_epi32(     -36021,      -80683,      120756,      -73524),
+      simde_x_mm_set_epu32(UINT32_C(0x00000000), UINT32_C(0xffff0000), UINT32_C(0x0000ffff), UINT32_C(0xd9680000)) },
+    { simde_mm_set_epi32(   19034467,   -11985916,   -17463475,     3360858),
+      simde_mm_set_epi32(      43830,      185137,     -198499,      221930),
+      simde_x_mm_set_epu32(UINT32_C(0xab36ffff), UINT32_C(0x0000ffff), UINT32_C(0xffff0000), UINT32_C(0x0000ffff)) },
+    { simde_mm_set_epi32(      -6706,      -29249,      -58316,      -52156),
+      simde_mm_set_epi32(      46047,        3309,      -57635,        6472),
+      simde_x_mm_set_epu32(UINT32_C(0xb3df0ced), UINT32_C(0x00001948), UINT32_C(0x00000000), UINT32_C(0x00000000)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_packus_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_stream_load_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1594834941,   345433995, -2122422097,   246739191),
+      simde_mm_set_epi32(-1594834941,   345433995, -2122422097,   246739191) },
+    { simde_mm_set_epi32(-2127122310, -2058083627,  2037449533,  1363800104),
+      simde_mm_set_epi32(-2127122310, -2058083627,  2037449533,  1363800104) },
+    { simde_mm_set_epi32(-2070105175,  -761947132, -1116630320, -1855472919),
+      simde_mm_set_epi32(-2070105175,  -761947132, -1116630320, -1855472919) },
+    { simde_mm_set_epi32( 1934256381,  2050533704, -1694651633,  1220714650),
+      simde_mm_set_epi32( 1934256381,  2050533704, -1694651633,  1220714650) },
+    { simde_mm_set_epi32( 1438799671, -1793116488,    77671525,  -924842015),
+      simde_mm_set_epi32( 1438799671, -1793116488,    77671525,  -924842015) },
+    { simde_mm_set_epi32(  873160593,  1410081041,  1463859863,  1887639720),
+      simde_mm_set_epi32(  873160593,  1410081041,  1463859863,  1887639720) },
+    { simde_mm_set_epi32( 1197369235,  1658182029,  1156895839,  2079360125),
+      simde_mm_set_epi32( 1197369235,  1658182029,  1156895839,  2079360125) },
+    { simde_mm_set_epi32(  268712433,   646855609,  -853835868, -1446118849),
+      simde_mm_set_epi32(  268712433,   646855609,  -853835868, -1446118849) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_stream_load_si128(&(test_vec[i].a));
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_testc_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x244c7ef9), UINT32_C(0xfda7fd61), UINT32_C(0x4da9f0b5), UINT32_C(0xe2992ba6)),
+      simde_x_mm_set_epu32(UINT32_C(0xf6ecf7a6), UINT32_C(0xfdaec717), UINT32_C(0x43c3e136), UINT32_C(0xbb04f7f9)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0x91b815a2), UINT32_C(0x04354b6d), UINT32_C(0xb633caa4), UINT32_C(0x09e3f7c1)),
+      simde_x_mm_set_epu32(UINT32_C(0x2404e818), UINT32_C(0xda002012), UINT32_C(0x080c345a), UINT32_C(0x161c0032)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0x667c5ee8), UINT32_C(0x236431a5), UINT32_C(0xc494dd82), UINT32_C(0x5a06b6bc)),
+      simde_x_mm_set_epu32(UINT32_C(0x40441468), UINT32_C(0x230031a5), UINT32_C(0x84108d00), UINT32_C(0x5a06103c)),
+      1 },
+    { simde_x_mm_set_epu32(UINT32_C(0xffffffff), UINT32_C(0x705f7a47), UINT32_C(0xffffffff), UINT32_C(0x02e9cba6)),
+      simde_x_mm_set_epu32(UINT32_C(0x8fb60b58), UINT32_C(0x1399114c), UINT32_C(0xcc106962), UINT32_C(0x00000000)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0x278ccbbb), UINT32_C(0x1e614e0d), UINT32_C(0x82909e5f), UINT32_C(0x7ffd2a54)),
+      simde_x_mm_set_epu32(UINT32_C(0xf8358a83), UINT32_C(0x0d3ef8c0), UINT32_C(0x4277e586), UINT32_C(0xef5d7b1f)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0x38c7d3e7), UINT32_C(0xb0d17e0d), UINT32_C(0xa0474dda), UINT32_C(0xb6136a4e)),
+      simde_x_mm_set_epu32(UINT32_C(0x01100008), UINT32_C(0x4b2200e0), UINT32_C(0x4fb80204), UINT32_C(0x09840031)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0x89042399), UINT32_C(0x5ba3ea77), UINT32_C(0xac486dff), UINT32_C(0x041a5367)),
+      simde_x_mm_set_epu32(UINT32_C(0x09002301), UINT32_C(0x43a38a62), UINT32_C(0x08400872), UINT32_C(0x00081060)),
+      1 },
+    { simde_x_mm_set_epu32(UINT32_C(0xffffffff), UINT32_C(0x1d1e50d9), UINT32_C(0xffffffff), UINT32_C(0xbc3714fd)),
+      simde_x_mm_set_epu32(UINT32_C(0x51f8756d), UINT32_C(0xbfa1478b), UINT32_C(0xf65359be), UINT32_C(0x00000000)),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_testc_si128(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_testnzc_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x427fa202), UINT32_C(0xfa12794e), UINT32_C(0xb22cfd7b), UINT32_C(0x046f1cfb)),
+      simde_x_mm_set_epu32(UINT32_C(0x98d0d5cc), UINT32_C(0x95881822), UINT32_C(0x668d76cc), UINT32_C(0xef7a2a31)),
+      1 },
+    { simde_x_mm_set_epu32(UINT32_C(0x784f14f0), UINT32_C(0xf2744556), UINT32_C(0x6e4b138f), UINT32_C(0xf1af2aa8)),
+      simde_x_mm_set_epu32(UINT32_C(0x03b04805), UINT32_C(0x018a0208), UINT32_C(0x1134e440), UINT32_C(0x0a105552)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0xc5c38a80), UINT32_C(0xc7568c68), UINT32_C(0x225c4027), UINT32_C(0x248644e1)),
+      simde_x_mm_set_epu32(UINT32_C(0x40808a80), UINT32_C(0x46128c40), UINT32_C(0x201c4022), UINT32_C(0x200444c0)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0xffffffff), UINT32_C(0xbcec51d2), UINT32_C(0xffffffff), UINT32_C(0x9e5204be)),
+      simde_x_mm_set_epu32(UINT32_C(0x804d81c4), UINT32_C(0x86926f83), UINT32_C(0x102fa1f6), UINT32_C(0x00000000)),
+      1 },
+    { simde_x_mm_set_epu32(UINT32_C(0x7f8b0dff), UINT32_C(0x817051b2), UINT32_C(0xec3660b9), UINT32_C(0x2846a9ad)),
+      simde_x_mm_set_epu32(UINT32_C(0xcf655686), UINT32_C(0xc4c9b355), UINT32_C(0x6005c010), UINT32_C(0xaec586a3)),
+      1 },
+    { simde_x_mm_set_epu32(UINT32_C(0x75c69637), UINT32_C(0x280442c3), UINT32_C(0x910073a3), UINT32_C(0x3b1ee64e)),
+      simde_x_mm_set_epu32(UINT32_C(0x02194140), UINT32_C(0x50a3a110), UINT32_C(0x20a00850), UINT32_C(0x40010931)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0x444e09f0), UINT32_C(0x246e1f92), UINT32_C(0xa59cc2c8), UINT32_C(0xbe07d348)),
+      simde_x_mm_set_epu32(UINT32_C(0x444a09e0), UINT32_C(0x20021010), UINT32_C(0x84840008), UINT32_C(0x12014100)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0xffffffff), UINT32_C(0x47748643), UINT32_C(0xffffffff), UINT32_C(0xe2843bb6)),
+      simde_x_mm_set_epu32(UINT32_C(0xb543ffb3), UINT32_C(0x9f40d4fe), UINT32_C(0x6a98fee5), UINT32_C(0x00000000)),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_testnzc_si128(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_testz_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(0x80a33291), UINT32_C(0x2af84b8c), UINT32_C(0xeb6e92f3), UINT32_C(0xa8046c7b)),
+      simde_x_mm_set_epu32(UINT32_C(0xa641cac7), UINT32_C(0x14993103), UINT32_C(0x70ffd124), UINT32_C(0x48f40927)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0x98a23689), UINT32_C(0xf5c051b1), UINT32_C(0x25bddbae), UINT32_C(0x97fb926d)),
+      simde_x_mm_set_epu32(UINT32_C(0x20598172), UINT32_C(0x0220a408), UINT32_C(0x48020041), UINT32_C(0x00040500)),
+      1 },
+    { simde_x_mm_set_epu32(UINT32_C(0x3d916e34), UINT32_C(0x1c8e37b8), UINT32_C(0xa94b56d7), UINT32_C(0xfc7306b0)),
+      simde_x_mm_set_epu32(UINT32_C(0x04804814), UINT32_C(0x14862288), UINT32_C(0x28030481), UINT32_C(0x9c3206a0)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0xffffffff), UINT32_C(0x7777a161), UINT32_C(0xffffffff), UINT32_C(0xe8f00ab4)),
+      simde_x_mm_set_epu32(UINT32_C(0x6a750a84), UINT32_C(0xce09571b), UINT32_C(0x7a946616), UINT32_C(0x00000000)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0x322624d8), UINT32_C(0x4832fe3f), UINT32_C(0xcb8505b3), UINT32_C(0x88d2d7a5)),
+      simde_x_mm_set_epu32(UINT32_C(0x1909a637), UINT32_C(0x5e6e8115), UINT32_C(0xebe54051), UINT32_C(0x5dec0ff0)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0xec79721f), UINT32_C(0x4b3c756b), UINT32_C(0x87d3d22b), UINT32_C(0xb344d2a0)),
+      simde_x_mm_set_epu32(UINT32_C(0x10800940), UINT32_C(0x14428000), UINT32_C(0x680c0154), UINT32_C(0x088b0942)),
+      1 },
+    { simde_x_mm_set_epu32(UINT32_C(0x678585be), UINT32_C(0xc459ca92), UINT32_C(0x3e43c0c9), UINT32_C(0x590731ee)),
+      simde_x_mm_set_epu32(UINT32_C(0x64050400), UINT32_C(0xc4114a12), UINT32_C(0x36428001), UINT32_C(0x48020022)),
+      0 },
+    { simde_x_mm_set_epu32(UINT32_C(0xffffffff), UINT32_C(0x10c7f7c0), UINT32_C(0xffffffff), UINT32_C(0xc177b3ba)),
+      simde_x_mm_set_epu32(UINT32_C(0xc50f212d), UINT32_C(0x60d10264), UINT32_C(0x95204f0f), UINT32_C(0x00000000)),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_testz_si128(test_vec[i].a, test_vec[i].b);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitTest test_suite_tests[] = {
-  { (char*) "/mm_blendv_epi8",    test_simde_mm_blendv_epi8,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
-  { (char*) "/mm_extract_epi64",  test_simde_mm_extract_epi64,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
-  { (char*) "/mm_min_epi8",       test_simde_mm_min_epi8,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_blendv_epi8",        test_simde_mm_blendv_epi8,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_extract_epi64",      test_simde_mm_extract_epi64,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_min_epi8",           test_simde_mm_min_epi8,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_blend_epi16",        test_simde_mm_blend_epi16,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_blend_pd",           test_simde_mm_blend_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_blend_ps",           test_simde_mm_blend_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_blendv_pd",          test_simde_mm_blendv_pd,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_blendv_ps",          test_simde_mm_blendv_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_extract_epi8",       test_simde_mm_extract_epi8,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_extract_epi32",      test_simde_mm_extract_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_extract_ps",         test_simde_mm_extract_ps,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_insert_epi8",        test_simde_mm_insert_epi8,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_insert_epi32",       test_simde_mm_insert_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_insert_epi64",       test_simde_mm_insert_epi64,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_insert_ps",          test_simde_mm_insert_ps,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_ceil_pd",            test_simde_mm_ceil_pd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_ceil_ps",            test_simde_mm_ceil_ps,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_ceil_sd",            test_simde_mm_ceil_sd,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_ceil_ss",            test_simde_mm_ceil_ss,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_floor_pd",           test_simde_mm_floor_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_floor_ps",           test_simde_mm_floor_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_floor_sd",           test_simde_mm_floor_sd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_floor_ss",           test_simde_mm_floor_ss,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_round_pd",           test_simde_mm_round_pd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_round_ps",           test_simde_mm_round_ps,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_round_sd",           test_simde_mm_round_sd,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_round_ss",           test_simde_mm_round_ss,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_dp_pd",              test_simde_mm_dp_pd,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_dp_ps",              test_simde_mm_dp_ps,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_minpos_epu16",       test_simde_mm_minpos_epu16,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_mpsadbw_epu8",       test_simde_mm_mpsadbw_epu8,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpeq_epi64",        test_simde_mm_cmpeq_epi64,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepi8_epi16",      test_simde_mm_cvtepi8_epi16,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepi8_epi32",      test_simde_mm_cvtepi8_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepi8_epi64",      test_simde_mm_cvtepi8_epi64,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepi16_epi32",     test_simde_mm_cvtepi16_epi32,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepi16_epi64",     test_simde_mm_cvtepi16_epi64,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepi32_epi64",     test_simde_mm_cvtepi32_epi64,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepu8_epi16",      test_simde_mm_cvtepu8_epi16,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepu8_epi32",      test_simde_mm_cvtepu8_epi32,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepu8_epi64",      test_simde_mm_cvtepu8_epi64,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepu16_epi32",     test_simde_mm_cvtepu16_epi32,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepu16_epi64",     test_simde_mm_cvtepu16_epi64,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cvtepu32_epi64",     test_simde_mm_cvtepu32_epi64,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_max_epi8",           test_simde_mm_max_epi8,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_max_epi32",          test_simde_mm_max_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_max_epu16",          test_simde_mm_max_epu16,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_max_epu32",          test_simde_mm_max_epu32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_min_epi32",          test_simde_mm_min_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_min_epu16",          test_simde_mm_min_epu16,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_min_epu32",          test_simde_mm_min_epu32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_mul_epi32",          test_simde_mm_mul_epi32,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_mullo_epi32",        test_simde_mm_mullo_epi32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_packus_epi32",       test_simde_mm_packus_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_stream_load_si128",  test_simde_mm_stream_load_si128,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_testc_si128",        test_simde_mm_testc_si128,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_testnzc_si128",      test_simde_mm_testnzc_si128,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_testz_si128",        test_simde_mm_testz_si128,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
   { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
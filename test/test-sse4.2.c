@@ -26,8 +26,1156 @@
 
 #include <stdio.h>
 
+static MunitResult
+test_simde_mm_cmpestra(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x61, 0x00, 0x62, 0x63, 0x63, 0x61, 0x61, 0x61,
+			0x62, 0x61, 0x62, 0x63, 0x00, 0x62, 0x63, 0x62),
+      3,
+      simde_mm_set_epi8(0x63, 0x63, 0x63, 0x61, 0x00, 0x62, 0x63, 0x61,
+			0x61, 0x63, 0x61, 0x62, 0x63, 0x63, 0x63, 0x62),
+      -18,
+      1 },
+    { simde_mm_set_epi8(0x65, 0x65, 0x63, 0x64, 0x61, 0x61, 0x62, 0x64,
+			0x61, 0x64, 0x63, 0x65, 0x65, 0x63, 0x64, 0x64),
+      -5,
+      simde_mm_set_epi8(0x62, 0x63, 0x00, 0x61, 0x61, 0x62, 0x64, 0x65,
+			0x64, 0x64, 0x62, 0x65, 0x65, 0x64, 0x64, 0x65),
+      4,
+      0 },
+    { simde_mm_set_epi8(0x61, 0x62, 0x67, 0x61, 0x64, 0x67, 0x66, 0x61,
+			0x63, 0x64, 0x62, 0x00, 0x67, 0x00, 0x66, 0x64),
+      -16,
+      simde_mm_set_epi8(0x61, 0x63, 0x66, 0x64, 0x64, 0x66, 0x67, 0x63,
+			0x67, 0x62, 0x63, 0x64, 0x65, 0x61, 0x64, 0x63),
+      5,
+      0 },
+    { simde_mm_set_epi8(0x67, 0x63, 0x64, 0x66, 0x66, 0x68, 0x61, 0x61,
+			0x68, 0x62, 0x61, 0x65, 0x61, 0x67, 0x68, 0x65),
+      -15,
+      simde_mm_set_epi8(0x68, 0x65, 0x66, 0x69, 0x62, 0x00, 0x63, 0x66,
+			0x62, 0x61, 0x62, 0x62, 0x68, 0x69, 0x00, 0x69),
+      -1,
+      0 },
+    { simde_mm_set_epi8(0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x61, 0x61,
+			0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62),
+      8,
+      simde_mm_set_epi8(0x61, 0x63, 0x61, 0x61, 0x63, 0x61, 0x61, 0x62,
+			0x61, 0x63, 0x61, 0x61, 0x62, 0x63, 0x61, 0x63),
+      -4,
+      0 },
+    { simde_mm_set_epi8(0x63, 0x64, 0x62, 0x65, 0x63, 0x61, 0x64, 0x61,
+			0x62, 0x65, 0x62, 0x62, 0x64, 0x64, 0x65, 0x61),
+      -17,
+      simde_mm_set_epi8(0x62, 0x00, 0x63, 0x64, 0x62, 0x65, 0x63, 0x61,
+			0x64, 0x61, 0x62, 0x65, 0x62, 0x62, 0x64, 0x64),
+      -15,
+      0 },
+    { simde_mm_set_epi8(0x00, 0x00, 0x65, 0x00, 0x65, 0x63, 0x61, 0x67,
+			0x61, 0x61, 0x67, 0x61, 0x64, 0x66, 0x64, 0x65),
+      9,
+      simde_mm_set_epi8(0x63, 0x64, 0x66, 0x66, 0x65, 0x67, 0x61, 0x61,
+			0x64, 0x64, 0x65, 0x61, 0x64, 0x62, 0x65, 0x66),
+      8,
+      0 },
+    { simde_mm_set_epi8(0x69, 0x64, 0x00, 0x64, 0x62, 0x62, 0x65, 0x62,
+			0x61, 0x66, 0x65, 0x64, 0x66, 0x64, 0x62, 0x66),
+      4,
+      simde_mm_set_epi8(0x68, 0x63, 0x61, 0x62, 0x61, 0x62, 0x68, 0x64,
+			0x66, 0x67, 0x66, 0x69, 0x00, 0x66, 0x64, 0x63),
+      -1,
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpestra(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb, simde_SIDD_SBYTE_OPS | simde_SIDD_CMP_EQUAL_ORDERED);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestrc(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x61, 0x61, 0x63, 0x00, 0x62, 0x63, 0x61, 0x62,
+			0x61, 0x62, 0x63, 0x61, 0x63, 0x61, 0x62, 0x63),
+      -8,
+      simde_mm_set_epi8(0x00, 0x63, 0x61, 0x62, 0x61, 0x63, 0x61, 0x61,
+			0x62, 0x61, 0x63, 0x00, 0x61, 0x62, 0x00, 0x61),
+      -17,
+      1 },
+    { simde_mm_set_epi8(0x65, 0x64, 0x65, 0x61, 0x65, 0x64, 0x64, 0x64,
+			0x65, 0x63, 0x63, 0x63, 0x64, 0x64, 0x62, 0x62),
+      -10,
+      simde_mm_set_epi8(0x65, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61,
+			0x63, 0x64, 0x62, 0x61, 0x61, 0x63, 0x61, 0x61),
+      -5,
+      1 },
+    { simde_mm_set_epi8(0x65, 0x67, 0x65, 0x62, 0x66, 0x61, 0x66, 0x65,
+			0x66, 0x63, 0x65, 0x62, 0x67, 0x67, 0x67, 0x63),
+      -6,
+      simde_mm_set_epi8(0x61, 0x64, 0x65, 0x62, 0x66, 0x62, 0x66, 0x67,
+			0x62, 0x65, 0x65, 0x65, 0x62, 0x66, 0x64, 0x67),
+      0,
+      0 },
+    { simde_mm_set_epi8(0x62, 0x62, 0x63, 0x64, 0x64, 0x62, 0x62, 0x67,
+			0x61, 0x63, 0x61, 0x61, 0x61, 0x66, 0x67, 0x67),
+      10,
+      simde_mm_set_epi8(0x67, 0x64, 0x65, 0x61, 0x61, 0x65, 0x61, 0x66,
+			0x65, 0x65, 0x68, 0x67, 0x69, 0x67, 0x62, 0x69),
+      -1,
+      0 },
+    { simde_mm_set_epi8(0x61, 0x62, 0x62, 0x61, 0x61, 0x62, 0x62, 0x63,
+			0x63, 0x61, 0x62, 0x62, 0x63, 0x61, 0x62, 0x63),
+      -19,
+      simde_mm_set_epi8(0x63, 0x62, 0x63, 0x62, 0x61, 0x61, 0x62, 0x62,
+			0x62, 0x61, 0x61, 0x61, 0x62, 0x61, 0x62, 0x63),
+      6,
+      1 },
+    { simde_mm_set_epi8(0x65, 0x62, 0x65, 0x61, 0x64, 0x61, 0x63, 0x64,
+			0x64, 0x62, 0x64, 0x63, 0x62, 0x61, 0x63, 0x61),
+      17,
+      simde_mm_set_epi8(0x64, 0x63, 0x65, 0x62, 0x65, 0x61, 0x64, 0x61,
+			0x63, 0x64, 0x64, 0x62, 0x64, 0x63, 0x62, 0x61),
+      -6,
+      1 },
+    { simde_mm_set_epi8(0x64, 0x62, 0x66, 0x66, 0x61, 0x62, 0x66, 0x00,
+			0x67, 0x65, 0x67, 0x00, 0x64, 0x61, 0x66, 0x66),
+      -12,
+      simde_mm_set_epi8(0x63, 0x61, 0x64, 0x62, 0x61, 0x65, 0x64, 0x64,
+			0x63, 0x62, 0x63, 0x00, 0x65, 0x67, 0x67, 0x64),
+      -17,
+      1 },
+    { simde_mm_set_epi8(0x69, 0x00, 0x67, 0x68, 0x64, 0x63, 0x64, 0x68,
+			0x69, 0x68, 0x62, 0x63, 0x00, 0x65, 0x68, 0x68),
+      -1,
+      simde_mm_set_epi8(0x62, 0x69, 0x61, 0x63, 0x63, 0x66, 0x64, 0x64,
+			0x65, 0x67, 0x63, 0x65, 0x69, 0x64, 0x67, 0x63),
+      -9,
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpestrc(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb, simde_SIDD_UBYTE_OPS | simde_SIDD_CMP_EQUAL_ANY);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestri(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x62, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62,
+			0x63, 0x61, 0x61, 0x63, 0x63, 0x61, 0x63, 0x62),
+      -20,
+      simde_mm_set_epi8(0x63, 0x63, 0x63, 0x00, 0x61, 0x61, 0x62, 0x61,
+			0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x00, 0x63),
+      -15,
+      6 },
+    { simde_mm_set_epi8(0x63, 0x62, 0x63, 0x64, 0x65, 0x61, 0x61, 0x65,
+			0x64, 0x63, 0x61, 0x62, 0x62, 0x63, 0x62, 0x61),
+      5,
+      simde_mm_set_epi8(0x62, 0x65, 0x62, 0x63, 0x00, 0x65, 0x62, 0x63,
+			0x65, 0x00, 0x63, 0x64, 0x63, 0x63, 0x61, 0x61),
+      9,
+      7 },
+    { simde_mm_set_epi8(0x66, 0x65, 0x61, 0x66, 0x64, 0x63, 0x62, 0x00,
+			0x62, 0x62, 0x66, 0x67, 0x61, 0x63, 0x61, 0x61),
+      -4,
+      simde_mm_set_epi8(0x66, 0x67, 0x67, 0x65, 0x66, 0x62, 0x65, 0x66,
+			0x66, 0x67, 0x63, 0x66, 0x66, 0x61, 0x67, 0x66),
+      11,
+      8 },
+    { simde_mm_set_epi8(0x67, 0x67, 0x62, 0x64, 0x67, 0x63, 0x67, 0x68,
+			0x62, 0x69, 0x66, 0x64, 0x63, 0x61, 0x61, 0x61),
+      -8,
+      simde_mm_set_epi8(0x00, 0x62, 0x63, 0x61, 0x61, 0x65, 0x68, 0x68,
+			0x61, 0x65, 0x69, 0x63, 0x68, 0x68, 0x64, 0x69),
+      -19,
+      6 },
+    { simde_mm_set_epi8(0x63, 0x62, 0x63, 0x62, 0x61, 0x63, 0x63, 0x62,
+			0x61, 0x61, 0x63, 0x00, 0x61, 0x63, 0x61, 0x62),
+      -12,
+      simde_mm_set_epi8(0x61, 0x63, 0x63, 0x63, 0x63, 0x61, 0x63, 0x62,
+			0x63, 0x61, 0x63, 0x62, 0x62, 0x62, 0x62, 0x63),
+      3,
+      2 },
+    { simde_mm_set_epi8(0x64, 0x62, 0x63, 0x62, 0x62, 0x64, 0x62, 0x63,
+			0x63, 0x64, 0x61, 0x65, 0x64, 0x62, 0x63, 0x00),
+      15,
+      simde_mm_set_epi8(0x61, 0x64, 0x64, 0x62, 0x63, 0x62, 0x62, 0x64,
+			0x62, 0x63, 0x63, 0x64, 0x61, 0x65, 0x64, 0x62),
+      -9,
+      6 },
+    { simde_mm_set_epi8(0x61, 0x62, 0x65, 0x66, 0x65, 0x63, 0x65, 0x65,
+			0x63, 0x64, 0x65, 0x61, 0x64, 0x67, 0x62, 0x61),
+      6,
+      simde_mm_set_epi8(0x63, 0x62, 0x67, 0x00, 0x62, 0x00, 0x64, 0x61,
+			0x61, 0x61, 0x64, 0x62, 0x65, 0x67, 0x66, 0x62),
+      -8,
+      7 },
+    { simde_mm_set_epi8(0x61, 0x61, 0x68, 0x65, 0x66, 0x00, 0x63, 0x63,
+			0x69, 0x64, 0x66, 0x67, 0x67, 0x69, 0x66, 0x63),
+      20,
+      simde_mm_set_epi8(0x68, 0x62, 0x69, 0x64, 0x65, 0x61, 0x68, 0x64,
+			0x61, 0x68, 0x63, 0x64, 0x67, 0x63, 0x68, 0x65),
+      14,
+      7 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpestri(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb, simde_SIDD_UWORD_OPS | simde_SIDD_CMP_RANGES | simde_SIDD_MOST_SIGNIFICANT);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestrm(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x61, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61,
+			0x62, 0x61, 0x61, 0x62, 0x62, 0x00, 0x61, 0x61),
+      -2,
+      simde_mm_set_epi8(0x62, 0x00, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
+			0x61, 0x62, 0x61, 0x00, 0x61, 0x61, 0x00, 0x62),
+      -14,
+      simde_mm_set_epi8(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00) },
+    { simde_mm_set_epi8(0x61, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x62,
+			0x61, 0x63, 0x61, 0x62, 0x61, 0x63, 0x63, 0x62),
+      0,
+      simde_mm_set_epi8(0x00, 0x61, 0x63, 0x61, 0x63, 0x63, 0x62, 0x63,
+			0x63, 0x63, 0x62, 0x61, 0x63, 0x61, 0x62, 0x61),
+      -4,
+      simde_mm_set_epi8(0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+			0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff) },
+    { simde_mm_set_epi8(0x00, 0x62, 0x63, 0x62, 0x62, 0x64, 0x62, 0x64,
+			0x63, 0x63, 0x00, 0x63, 0x64, 0x63, 0x63, 0x61),
+      -1,
+      simde_mm_set_epi8(0x62, 0x62, 0x61, 0x00, 0x63, 0x62, 0x64, 0x63,
+			0x00, 0x61, 0x63, 0x61, 0x61, 0x63, 0x61, 0x64),
+      -17,
+      simde_mm_set_epi8(0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00) },
+    { simde_mm_set_epi8(0x61, 0x65, 0x64, 0x65, 0x62, 0x62, 0x64, 0x63,
+			0x63, 0x65, 0x63, 0x64, 0x64, 0x65, 0x63, 0x62),
+      2,
+      simde_mm_set_epi8(0x63, 0x64, 0x65, 0x61, 0x65, 0x64, 0x65, 0x62,
+			0x62, 0x64, 0x63, 0x63, 0x65, 0x63, 0x64, 0x64),
+      -4,
+      simde_mm_set_epi8(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00) },
+    { simde_mm_set_epi8(0x61, 0x61, 0x62, 0x62, 0x62, 0x00, 0x00, 0x61,
+			0x61, 0x62, 0x62, 0x62, 0x61, 0x00, 0x62, 0x62),
+      3,
+      simde_mm_set_epi8(0x62, 0x61, 0x62, 0x62, 0x61, 0x61, 0x61, 0x62,
+			0x61, 0x61, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62),
+      1,
+      simde_mm_set_epi8(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00) },
+    { simde_mm_set_epi8(0x63, 0x61, 0x61, 0x63, 0x63, 0x61, 0x62, 0x62,
+			0x61, 0x63, 0x62, 0x61, 0x62, 0x63, 0x63, 0x62),
+      3,
+      simde_mm_set_epi8(0x61, 0x61, 0x61, 0x63, 0x61, 0x61, 0x63, 0x63,
+			0x61, 0x62, 0x62, 0x61, 0x63, 0x62, 0x61, 0x62),
+      19,
+      simde_mm_set_epi8(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00) },
+    { simde_mm_set_epi8(0x61, 0x64, 0x63, 0x63, 0x63, 0x61, 0x61, 0x64,
+			0x64, 0x61, 0x61, 0x61, 0x64, 0x61, 0x61, 0x64),
+      -3,
+      simde_mm_set_epi8(0x62, 0x64, 0x61, 0x61, 0x62, 0x64, 0x61, 0x63,
+			0x63, 0x64, 0x64, 0x00, 0x62, 0x61, 0x61, 0x64),
+      -1,
+      simde_mm_set_epi8(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00) },
+    { simde_mm_set_epi8(0x64, 0x62, 0x63, 0x61, 0x64, 0x61, 0x62, 0x65,
+			0x64, 0x63, 0x64, 0x64, 0x63, 0x62, 0x65, 0x63),
+      -1,
+      simde_mm_set_epi8(0x61, 0x62, 0x61, 0x64, 0x62, 0x63, 0x61, 0x64,
+			0x61, 0x62, 0x65, 0x64, 0x63, 0x64, 0x64, 0x63),
+      4,
+      simde_mm_set_epi8(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cmpestrm(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb, simde_SIDD_UBYTE_OPS | simde_SIDD_CMP_EQUAL_ORDERED | simde_SIDD_UNIT_MASK);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestro(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x00, 0x61, 0x00, 0x63, 0x62, 0x62, 0x62, 0x63,
+			0x63, 0x62, 0x63, 0x61, 0x62, 0x62, 0x63, 0x61),
+      0,
+      simde_mm_set_epi8(0x61, 0x63, 0x62, 0x62, 0x62, 0x61, 0x63, 0x63,
+			0x63, 0x62, 0x63, 0x61, 0x63, 0x63, 0x63, 0x63),
+      -10,
+      1 },
+    { simde_mm_set_epi8(0x64, 0x61, 0x62, 0x62, 0x62, 0x61, 0x63, 0x65,
+			0x64, 0x65, 0x65, 0x64, 0x64, 0x62, 0x65, 0x61),
+      20,
+      simde_mm_set_epi8(0x65, 0x62, 0x62, 0x65, 0x63, 0x65, 0x61, 0x64,
+			0x65, 0x63, 0x61, 0x65, 0x64, 0x00, 0x61, 0x00),
+      5,
+      1 },
+    { simde_mm_set_epi8(0x65, 0x63, 0x64, 0x61, 0x65, 0x61, 0x67, 0x66,
+			0x62, 0x61, 0x67, 0x67, 0x64, 0x62, 0x00, 0x66),
+      1,
+      simde_mm_set_epi8(0x64, 0x67, 0x66, 0x67, 0x63, 0x64, 0x62, 0x64,
+			0x66, 0x63, 0x64, 0x61, 0x64, 0x67, 0x66, 0x64),
+      -5,
+      1 },
+    { simde_mm_set_epi8(0x65, 0x68, 0x61, 0x62, 0x68, 0x64, 0x66, 0x64,
+			0x61, 0x69, 0x69, 0x63, 0x63, 0x62, 0x00, 0x65),
+      2,
+      simde_mm_set_epi8(0x69, 0x67, 0x65, 0x68, 0x61, 0x66, 0x69, 0x66,
+			0x61, 0x61, 0x64, 0x61, 0x63, 0x63, 0x66, 0x68),
+      19,
+      1 },
+    { simde_mm_set_epi8(0x62, 0x63, 0x63, 0x63, 0x00, 0x61, 0x62, 0x00,
+			0x63, 0x62, 0x00, 0x61, 0x61, 0x61, 0x62, 0x00),
+      -13,
+      simde_mm_set_epi8(0x61, 0x61, 0x63, 0x63, 0x62, 0x63, 0x61, 0x61,
+			0x62, 0x63, 0x00, 0x63, 0x61, 0x61, 0x00, 0x62),
+      7,
+      1 },
+    { simde_mm_set_epi8(0x62, 0x61, 0x63, 0x64, 0x63, 0x62, 0x61, 0x64,
+			0x64, 0x65, 0x64, 0x00, 0x62, 0x65, 0x63, 0x63),
+      20,
+      simde_mm_set_epi8(0x61, 0x63, 0x62, 0x61, 0x63, 0x64, 0x63, 0x62,
+			0x61, 0x64, 0x64, 0x65, 0x64, 0x00, 0x62, 0x65),
+      7,
+      0 },
+    { simde_mm_set_epi8(0x67, 0x67, 0x63, 0x63, 0x61, 0x64, 0x67, 0x66,
+			0x65, 0x65, 0x65, 0x67, 0x67, 0x65, 0x65, 0x63),
+      -20,
+      simde_mm_set_epi8(0x62, 0x66, 0x64, 0x00, 0x65, 0x65, 0x66, 0x67,
+			0x63, 0x61, 0x64, 0x67, 0x64, 0x00, 0x61, 0x67),
+      -8,
+      1 },
+    { simde_mm_set_epi8(0x63, 0x62, 0x67, 0x63, 0x63, 0x61, 0x67, 0x61,
+			0x65, 0x62, 0x00, 0x61, 0x62, 0x64, 0x67, 0x66),
+      -15,
+      simde_mm_set_epi8(0x64, 0x63, 0x69, 0x66, 0x67, 0x61, 0x66, 0x65,
+			0x00, 0x67, 0x61, 0x62, 0x68, 0x68, 0x63, 0x69),
+      18,
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpestro(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb, simde_SIDD_SWORD_OPS | simde_SIDD_CMP_EQUAL_ANY | simde_SIDD_MASKED_NEGATIVE_POLARITY);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestrs(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x61, 0x61, 0x62, 0x62, 0x61, 0x61, 0x63, 0x62,
+			0x62, 0x62, 0x63, 0x00, 0x61, 0x62, 0x63, 0x62),
+      -10,
+      simde_mm_set_epi8(0x62, 0x61, 0x63, 0x62, 0x62, 0x61, 0x63, 0x62,
+			0x62, 0x63, 0x61, 0x61, 0x63, 0x00, 0x63, 0x61),
+      -4,
+      1 },
+    { simde_mm_set_epi8(0x63, 0x65, 0x61, 0x64, 0x61, 0x62, 0x63, 0x62,
+			0x61, 0x64, 0x65, 0x63, 0x62, 0x62, 0x61, 0x65),
+      -7,
+      simde_mm_set_epi8(0x62, 0x65, 0x64, 0x62, 0x65, 0x62, 0x65, 0x64,
+			0x64, 0x00, 0x61, 0x63, 0x62, 0x61, 0x63, 0x64),
+      4,
+      1 },
+    { simde_mm_set_epi8(0x63, 0x66, 0x63, 0x67, 0x65, 0x67, 0x64, 0x67,
+			0x66, 0x62, 0x62, 0x61, 0x67, 0x67, 0x64, 0x67),
+      14,
+      simde_mm_set_epi8(0x65, 0x00, 0x61, 0x64, 0x62, 0x67, 0x62, 0x67,
+			0x66, 0x64, 0x64, 0x64, 0x67, 0x67, 0x63, 0x63),
+      6,
+      1 },
+    { simde_mm_set_epi8(0x61, 0x65, 0x61, 0x63, 0x68, 0x62, 0x69, 0x63,
+			0x68, 0x62, 0x66, 0x64, 0x68, 0x63, 0x68, 0x65),
+      -11,
+      simde_mm_set_epi8(0x64, 0x69, 0x62, 0x63, 0x69, 0x00, 0x65, 0x67,
+			0x66, 0x62, 0x63, 0x64, 0x68, 0x62, 0x67, 0x62),
+      -2,
+      1 },
+    { simde_mm_set_epi8(0x00, 0x61, 0x62, 0x00, 0x62, 0x63, 0x61, 0x62,
+			0x61, 0x00, 0x62, 0x61, 0x61, 0x00, 0x61, 0x62),
+      6,
+      simde_mm_set_epi8(0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x61,
+			0x62, 0x00, 0x63, 0x63, 0x62, 0x63, 0x63, 0x61),
+      18,
+      1 },
+    { simde_mm_set_epi8(0x62, 0x61, 0x63, 0x63, 0x63, 0x62, 0x63, 0x00,
+			0x63, 0x61, 0x65, 0x64, 0x65, 0x61, 0x62, 0x62),
+      -1,
+      simde_mm_set_epi8(0x63, 0x61, 0x62, 0x61, 0x63, 0x63, 0x63, 0x62,
+			0x63, 0x00, 0x63, 0x61, 0x65, 0x64, 0x65, 0x61),
+      -16,
+      1 },
+    { simde_mm_set_epi8(0x00, 0x63, 0x67, 0x67, 0x62, 0x63, 0x64, 0x67,
+			0x62, 0x67, 0x65, 0x65, 0x64, 0x66, 0x62, 0x61),
+      -4,
+      simde_mm_set_epi8(0x63, 0x65, 0x65, 0x66, 0x67, 0x63, 0x67, 0x62,
+			0x61, 0x61, 0x63, 0x65, 0x62, 0x66, 0x65, 0x63),
+      14,
+      1 },
+    { simde_mm_set_epi8(0x67, 0x66, 0x67, 0x64, 0x69, 0x63, 0x61, 0x64,
+			0x64, 0x68, 0x63, 0x68, 0x64, 0x64, 0x61, 0x65),
+      2,
+      simde_mm_set_epi8(0x66, 0x61, 0x68, 0x64, 0x62, 0x69, 0x69, 0x69,
+			0x66, 0x69, 0x67, 0x66, 0x61, 0x69, 0x64, 0x67),
+      20,
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpestrs(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb, simde_SIDD_UBYTE_OPS | simde_SIDD_CMP_EQUAL_ANY);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestrz(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x62, 0x61, 0x63, 0x61, 0x63, 0x61, 0x63, 0x61,
+			0x61, 0x63, 0x61, 0x62, 0x61, 0x62, 0x62, 0x62),
+      11,
+      simde_mm_set_epi8(0x63, 0x61, 0x00, 0x63, 0x62, 0x62, 0x61, 0x62,
+			0x63, 0x61, 0x62, 0x62, 0x63, 0x61, 0x62, 0x62),
+      -2,
+      1 },
+    { simde_mm_set_epi8(0x65, 0x62, 0x61, 0x63, 0x65, 0x63, 0x62, 0x63,
+			0x63, 0x00, 0x62, 0x65, 0x63, 0x64, 0x61, 0x62),
+      -3,
+      simde_mm_set_epi8(0x61, 0x61, 0x62, 0x63, 0x64, 0x61, 0x62, 0x61,
+			0x64, 0x64, 0x61, 0x64, 0x62, 0x62, 0x61, 0x64),
+      -19,
+      0 },
+    { simde_mm_set_epi8(0x62, 0x62, 0x63, 0x61, 0x66, 0x67, 0x61, 0x67,
+			0x00, 0x67, 0x64, 0x63, 0x66, 0x63, 0x61, 0x64),
+      -1,
+      simde_mm_set_epi8(0x62, 0x66, 0x66, 0x62, 0x61, 0x67, 0x63, 0x63,
+			0x67, 0x61, 0x65, 0x66, 0x66, 0x61, 0x62, 0x63),
+      11,
+      0 },
+    { simde_mm_set_epi8(0x61, 0x69, 0x00, 0x61, 0x65, 0x69, 0x62, 0x68,
+			0x68, 0x65, 0x68, 0x67, 0x68, 0x61, 0x64, 0x63),
+      1,
+      simde_mm_set_epi8(0x66, 0x61, 0x62, 0x62, 0x62, 0x69, 0x66, 0x64,
+			0x69, 0x63, 0x63, 0x68, 0x65, 0x61, 0x69, 0x65),
+      9,
+      0 },
+    { simde_mm_set_epi8(0x61, 0x61, 0x63, 0x61, 0x62, 0x63, 0x61, 0x63,
+			0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 0x63),
+      -11,
+      simde_mm_set_epi8(0x63, 0x61, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62,
+			0x62, 0x62, 0x61, 0x61, 0x63, 0x63, 0x63, 0x62),
+      -13,
+      0 },
+    { simde_mm_set_epi8(0x65, 0x63, 0x65, 0x63, 0x65, 0x65, 0x62, 0x62,
+			0x64, 0x00, 0x61, 0x63, 0x61, 0x61, 0x63, 0x62),
+      -1,
+      simde_mm_set_epi8(0x61, 0x65, 0x65, 0x63, 0x65, 0x63, 0x65, 0x65,
+			0x62, 0x62, 0x64, 0x00, 0x61, 0x63, 0x61, 0x61),
+      0,
+      1 },
+    { simde_mm_set_epi8(0x63, 0x61, 0x64, 0x63, 0x65, 0x66, 0x67, 0x66,
+			0x61, 0x66, 0x00, 0x65, 0x67, 0x65, 0x00, 0x64),
+      -13,
+      simde_mm_set_epi8(0x66, 0x64, 0x64, 0x65, 0x63, 0x66, 0x64, 0x00,
+			0x64, 0x62, 0x66, 0x64, 0x66, 0x00, 0x61, 0x63),
+      13,
+      0 },
+    { simde_mm_set_epi8(0x63, 0x00, 0x63, 0x69, 0x00, 0x64, 0x61, 0x61,
+			0x68, 0x65, 0x68, 0x67, 0x62, 0x69, 0x62, 0x66),
+      14,
+      simde_mm_set_epi8(0x61, 0x64, 0x68, 0x68, 0x64, 0x00, 0x66, 0x67,
+			0x66, 0x00, 0x61, 0x66, 0x69, 0x63, 0x61, 0x69),
+      18,
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpestrz(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb, simde_SIDD_UWORD_OPS | simde_SIDD_CMP_EQUAL_ANY);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistra(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x62, 0x00, 0x61, 0x62, 0x63, 0x62, 0x63, 0x63,
+			0x62, 0x61, 0x61, 0x61, 0x63, 0x63, 0x62, 0x63),
+      simde_mm_set_epi8(0x61, 0x62, 0x61, 0x61, 0x63, 0x61, 0x00, 0x61,
+			0x62, 0x62, 0x62, 0x62, 0x00, 0x63, 0x62, 0x00),
+      0 },
+    { simde_mm_set_epi8(0x00, 0x64, 0x61, 0x65, 0x64, 0x61, 0x64, 0x61,
+			0x64, 0x63, 0x64, 0x65, 0x64, 0x63, 0x63, 0x62),
+      simde_mm_set_epi8(0x63, 0x62, 0x63, 0x65, 0x61, 0x00, 0x62, 0x61,
+			0x61, 0x64, 0x65, 0x64, 0x64, 0x00, 0x65, 0x61),
+      0 },
+    { simde_mm_set_epi8(0x66, 0x62, 0x66, 0x66, 0x62, 0x66, 0x61, 0x65,
+			0x61, 0x61, 0x66, 0x65, 0x64, 0x65, 0x62, 0x65),
+      simde_mm_set_epi8(0x67, 0x66, 0x63, 0x64, 0x63, 0x63, 0x61, 0x67,
+			0x67, 0x62, 0x63, 0x67, 0x67, 0x65, 0x64, 0x63),
+      0 },
+    { simde_mm_set_epi8(0x61, 0x66, 0x63, 0x62, 0x62, 0x68, 0x61, 0x65,
+			0x68, 0x66, 0x62, 0x64, 0x67, 0x63, 0x68, 0x69),
+      simde_mm_set_epi8(0x61, 0x69, 0x69, 0x63, 0x65, 0x65, 0x65, 0x65,
+			0x64, 0x62, 0x67, 0x66, 0x68, 0x63, 0x67, 0x68),
+      0 },
+    { simde_mm_set_epi8(0x62, 0x63, 0x61, 0x61, 0x63, 0x61, 0x00, 0x00,
+			0x62, 0x62, 0x63, 0x63, 0x61, 0x61, 0x63, 0x62),
+      simde_mm_set_epi8(0x61, 0x62, 0x61, 0x61, 0x63, 0x63, 0x61, 0x63,
+			0x63, 0x62, 0x63, 0x61, 0x63, 0x62, 0x62, 0x62),
+      1 },
+    { simde_mm_set_epi8(0x64, 0x61, 0x64, 0x64, 0x64, 0x63, 0x65, 0x62,
+			0x61, 0x64, 0x64, 0x00, 0x64, 0x64, 0x64, 0x62),
+      simde_mm_set_epi8(0x61, 0x65, 0x64, 0x61, 0x64, 0x64, 0x64, 0x63,
+			0x65, 0x62, 0x61, 0x64, 0x64, 0x00, 0x64, 0x64),
+      0 },
+    { simde_mm_set_epi8(0x66, 0x65, 0x66, 0x67, 0x63, 0x62, 0x63, 0x62,
+			0x65, 0x62, 0x64, 0x62, 0x65, 0x67, 0x65, 0x62),
+      simde_mm_set_epi8(0x62, 0x00, 0x64, 0x66, 0x65, 0x67, 0x65, 0x65,
+			0x67, 0x67, 0x00, 0x67, 0x62, 0x61, 0x61, 0x63),
+      0 },
+    { simde_mm_set_epi8(0x69, 0x63, 0x64, 0x69, 0x68, 0x61, 0x64, 0x61,
+			0x68, 0x64, 0x65, 0x67, 0x61, 0x61, 0x65, 0x69),
+      simde_mm_set_epi8(0x63, 0x63, 0x61, 0x00, 0x64, 0x63, 0x00, 0x67,
+			0x66, 0x65, 0x69, 0x63, 0x62, 0x63, 0x68, 0x69),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpistra(test_vec[i].a, test_vec[i].b, simde_SIDD_UBYTE_OPS | simde_SIDD_CMP_RANGES | simde_SIDD_NEGATIVE_POLARITY);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistrc(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x00, 0x63, 0x00, 0x61, 0x62, 0x63, 0x61, 0x63,
+			0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x61, 0x62),
+      simde_mm_set_epi8(0x61, 0x63, 0x61, 0x00, 0x61, 0x63, 0x63, 0x62,
+			0x61, 0x62, 0x62, 0x61, 0x62, 0x63, 0x62, 0x61),
+      0 },
+    { simde_mm_set_epi8(0x64, 0x65, 0x63, 0x65, 0x65, 0x63, 0x64, 0x61,
+			0x65, 0x65, 0x64, 0x61, 0x64, 0x62, 0x64, 0x65),
+      simde_mm_set_epi8(0x64, 0x65, 0x63, 0x61, 0x64, 0x63, 0x62, 0x64,
+			0x62, 0x65, 0x62, 0x63, 0x62, 0x61, 0x62, 0x61),
+      1 },
+    { simde_mm_set_epi8(0x62, 0x64, 0x66, 0x66, 0x67, 0x62, 0x67, 0x62,
+			0x61, 0x67, 0x66, 0x67, 0x63, 0x65, 0x66, 0x65),
+      simde_mm_set_epi8(0x65, 0x67, 0x63, 0x64, 0x64, 0x67, 0x65, 0x63,
+			0x67, 0x62, 0x64, 0x66, 0x67, 0x00, 0x64, 0x64),
+      0 },
+    { simde_mm_set_epi8(0x63, 0x69, 0x00, 0x67, 0x61, 0x62, 0x63, 0x68,
+			0x67, 0x62, 0x67, 0x67, 0x66, 0x61, 0x66, 0x67),
+      simde_mm_set_epi8(0x63, 0x67, 0x63, 0x65, 0x66, 0x64, 0x68, 0x00,
+			0x67, 0x69, 0x66, 0x61, 0x61, 0x63, 0x61, 0x62),
+      0 },
+    { simde_mm_set_epi8(0x61, 0x63, 0x62, 0x62, 0x62, 0x63, 0x61, 0x63,
+			0x00, 0x62, 0x62, 0x61, 0x61, 0x00, 0x62, 0x61),
+      simde_mm_set_epi8(0x00, 0x61, 0x62, 0x63, 0x61, 0x61, 0x63, 0x63,
+			0x63, 0x61, 0x61, 0x61, 0x62, 0x63, 0x61, 0x61),
+      0 },
+    { simde_mm_set_epi8(0x64, 0x65, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63,
+			0x62, 0x65, 0x65, 0x65, 0x62, 0x65, 0x65, 0x65),
+      simde_mm_set_epi8(0x63, 0x63, 0x64, 0x65, 0x64, 0x64, 0x64, 0x64,
+			0x63, 0x63, 0x62, 0x65, 0x65, 0x65, 0x62, 0x65),
+      0 },
+    { simde_mm_set_epi8(0x67, 0x65, 0x66, 0x61, 0x63, 0x67, 0x67, 0x66,
+			0x65, 0x63, 0x63, 0x66, 0x67, 0x63, 0x62, 0x65),
+      simde_mm_set_epi8(0x00, 0x64, 0x61, 0x61, 0x63, 0x65, 0x61, 0x64,
+			0x62, 0x65, 0x62, 0x67, 0x67, 0x63, 0x61, 0x00),
+      0 },
+    { simde_mm_set_epi8(0x61, 0x66, 0x63, 0x68, 0x64, 0x61, 0x62, 0x66,
+			0x62, 0x63, 0x69, 0x62, 0x67, 0x63, 0x63, 0x63),
+      simde_mm_set_epi8(0x66, 0x61, 0x00, 0x63, 0x00, 0x65, 0x66, 0x64,
+			0x63, 0x65, 0x66, 0x61, 0x65, 0x64, 0x61, 0x69),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpistrc(test_vec[i].a, test_vec[i].b, simde_SIDD_SBYTE_OPS | simde_SIDD_CMP_EQUAL_ORDERED);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistri(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x62, 0x62,
+			0x61, 0x62, 0x61, 0x61, 0x63, 0x63, 0x62, 0x63),
+      simde_mm_set_epi8(0x63, 0x63, 0x62, 0x62, 0x62, 0x63, 0x62, 0x62,
+			0x61, 0x63, 0x62, 0x61, 0x62, 0x62, 0x61, 0x63),
+      0 },
+    { simde_mm_set_epi8(0x62, 0x65, 0x64, 0x62, 0x65, 0x62, 0x65, 0x64,
+			0x64, 0x64, 0x64, 0x61, 0x64, 0x61, 0x61, 0x64),
+      simde_mm_set_epi8(0x00, 0x62, 0x64, 0x61, 0x63, 0x64, 0x63, 0x65,
+			0x61, 0x62, 0x61, 0x62, 0x64, 0x62, 0x64, 0x61),
+      0 },
+    { simde_mm_set_epi8(0x67, 0x63, 0x65, 0x64, 0x66, 0x64, 0x63, 0x66,
+			0x63, 0x63, 0x62, 0x67, 0x67, 0x61, 0x65, 0x64),
+      simde_mm_set_epi8(0x65, 0x61, 0x61, 0x00, 0x00, 0x67, 0x65, 0x67,
+			0x66, 0x64, 0x66, 0x67, 0x64, 0x63, 0x65, 0x64),
+      0 },
+    { simde_mm_set_epi8(0x65, 0x64, 0x67, 0x61, 0x62, 0x67, 0x61, 0x66,
+			0x61, 0x64, 0x69, 0x62, 0x63, 0x69, 0x64, 0x68),
+      simde_mm_set_epi8(0x64, 0x69, 0x67, 0x66, 0x64, 0x61, 0x67, 0x63,
+			0x67, 0x67, 0x66, 0x64, 0x61, 0x66, 0x67, 0x69),
+      0 },
+    { simde_mm_set_epi8(0x62, 0x62, 0x61, 0x62, 0x63, 0x62, 0x63, 0x63,
+			0x62, 0x62, 0x61, 0x62, 0x00, 0x61, 0x61, 0x61),
+      simde_mm_set_epi8(0x62, 0x63, 0x62, 0x63, 0x63, 0x62, 0x63, 0x61,
+			0x61, 0x63, 0x61, 0x62, 0x63, 0x61, 0x61, 0x63),
+      1 },
+    { simde_mm_set_epi8(0x63, 0x65, 0x63, 0x62, 0x64, 0x61, 0x64, 0x61,
+			0x65, 0x63, 0x63, 0x64, 0x65, 0x62, 0x64, 0x64),
+      simde_mm_set_epi8(0x65, 0x62, 0x63, 0x65, 0x63, 0x62, 0x64, 0x61,
+			0x64, 0x61, 0x65, 0x63, 0x63, 0x64, 0x65, 0x62),
+      0 },
+    { simde_mm_set_epi8(0x00, 0x61, 0x63, 0x65, 0x63, 0x66, 0x61, 0x62,
+			0x63, 0x62, 0x63, 0x66, 0x00, 0x62, 0x67, 0x64),
+      simde_mm_set_epi8(0x67, 0x63, 0x64, 0x61, 0x63, 0x63, 0x64, 0x63,
+			0x62, 0x67, 0x64, 0x62, 0x66, 0x66, 0x67, 0x66),
+      1 },
+    { simde_mm_set_epi8(0x66, 0x62, 0x62, 0x68, 0x65, 0x69, 0x63, 0x61,
+			0x67, 0x69, 0x64, 0x68, 0x62, 0x67, 0x62, 0x62),
+      simde_mm_set_epi8(0x68, 0x66, 0x63, 0x67, 0x68, 0x63, 0x62, 0x67,
+			0x69, 0x65, 0x61, 0x67, 0x68, 0x63, 0x65, 0x64),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpistri(test_vec[i].a, test_vec[i].b, simde_SIDD_UBYTE_OPS | simde_SIDD_CMP_EQUAL_ANY | simde_SIDD_LEAST_SIGNIFICANT);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistrm(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62,
+			0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62),
+      simde_mm_set_epi8(0x62, 0x62, 0x61, 0x61, 0x62, 0x61, 0x62, 0x61,
+			0x62, 0x62, 0x62, 0x61, 0x61, 0x62, 0x62, 0x00),
+      simde_mm_set_epi16(     0,     -1,      0,      0,      0,      0,      0,      0) },
+    { simde_mm_set_epi8(0x63, 0x61, 0x62, 0x61, 0x62, 0x62, 0x63, 0x00,
+			0x63, 0x63, 0x00, 0x62, 0x63, 0x61, 0x62, 0x61),
+      simde_mm_set_epi8(0x63, 0x62, 0x63, 0x61, 0x62, 0x61, 0x62, 0x62,
+			0x63, 0x00, 0x63, 0x63, 0x00, 0x62, 0x63, 0x61),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      0,      0) },
+    { simde_mm_set_epi8(0x61, 0x64, 0x63, 0x62, 0x62, 0x61, 0x63, 0x64,
+			0x61, 0x64, 0x64, 0x63, 0x64, 0x64, 0x63, 0x63),
+      simde_mm_set_epi8(0x64, 0x61, 0x62, 0x62, 0x63, 0x63, 0x62, 0x63,
+			0x64, 0x63, 0x63, 0x63, 0x64, 0x61, 0x63, 0x63),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      0,     -1) },
+    { simde_mm_set_epi8(0x64, 0x00, 0x63, 0x64, 0x64, 0x65, 0x64, 0x61,
+			0x62, 0x63, 0x63, 0x61, 0x63, 0x61, 0x64, 0x64),
+      simde_mm_set_epi8(0x61, 0x62, 0x64, 0x00, 0x63, 0x64, 0x64, 0x65,
+			0x64, 0x61, 0x62, 0x63, 0x63, 0x61, 0x63, 0x61),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,     -1,      0) },
+    { simde_mm_set_epi8(0x61, 0x61, 0x62, 0x61, 0x61, 0x62, 0x62, 0x61,
+			0x61, 0x62, 0x61, 0x00, 0x62, 0x62, 0x61, 0x62),
+      simde_mm_set_epi8(0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61,
+			0x62, 0x62, 0x62, 0x62, 0x00, 0x62, 0x62, 0x61),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      0,      0) },
+    { simde_mm_set_epi8(0x61, 0x62, 0x62, 0x61, 0x63, 0x61, 0x62, 0x63,
+			0x63, 0x63, 0x62, 0x63, 0x61, 0x63, 0x63, 0x61),
+      simde_mm_set_epi8(0x62, 0x61, 0x61, 0x62, 0x62, 0x61, 0x63, 0x61,
+			0x62, 0x63, 0x63, 0x63, 0x62, 0x63, 0x61, 0x63),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      0,      0) },
+    { simde_mm_set_epi8(0x64, 0x61, 0x64, 0x64, 0x63, 0x00, 0x00, 0x64,
+			0x61, 0x63, 0x64, 0x64, 0x63, 0x64, 0x61, 0x63),
+      simde_mm_set_epi8(0x62, 0x61, 0x63, 0x64, 0x00, 0x62, 0x64, 0x61,
+			0x63, 0x64, 0x62, 0x61, 0x64, 0x64, 0x61, 0x63),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      0,     -1) },
+    { simde_mm_set_epi8(0x64, 0x62, 0x61, 0x65, 0x63, 0x64, 0x63, 0x65,
+			0x63, 0x61, 0x65, 0x63, 0x61, 0x64, 0x64, 0x62),
+      simde_mm_set_epi8(0x64, 0x63, 0x64, 0x62, 0x61, 0x65, 0x63, 0x64,
+			0x63, 0x65, 0x63, 0x61, 0x65, 0x63, 0x61, 0x64),
+      simde_mm_set_epi16(     0,      0,      0,      0,      0,      0,      0,      0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cmpistrm(test_vec[i].a, test_vec[i].b, simde_SIDD_UWORD_OPS | simde_SIDD_CMP_EQUAL_EACH | simde_SIDD_UNIT_MASK);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistro(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x63, 0x62, 0x62, 0x61, 0x62, 0x61, 0x61, 0x63,
+			0x62, 0x00, 0x00, 0x63, 0x63, 0x63, 0x61, 0x62),
+      simde_mm_set_epi8(0x62, 0x62, 0x63, 0x62, 0x63, 0x62, 0x62, 0x62,
+			0x61, 0x62, 0x62, 0x62, 0x00, 0x61, 0x61, 0x00),
+      0 },
+    { simde_mm_set_epi8(0x62, 0x61, 0x61, 0x64, 0x00, 0x65, 0x63, 0x63,
+			0x64, 0x61, 0x64, 0x61, 0x61, 0x63, 0x64, 0x61),
+      simde_mm_set_epi8(0x61, 0x65, 0x61, 0x64, 0x61, 0x63, 0x61, 0x61,
+			0x64, 0x61, 0x65, 0x61, 0x62, 0x65, 0x63, 0x62),
+      1 },
+    { simde_mm_set_epi8(0x65, 0x63, 0x65, 0x67, 0x66, 0x65, 0x61, 0x62,
+			0x63, 0x64, 0x64, 0x61, 0x00, 0x65, 0x61, 0x66),
+      simde_mm_set_epi8(0x64, 0x66, 0x62, 0x63, 0x66, 0x61, 0x61, 0x64,
+			0x67, 0x67, 0x64, 0x64, 0x65, 0x66, 0x63, 0x62),
+      0 },
+    { simde_mm_set_epi8(0x65, 0x61, 0x69, 0x69, 0x66, 0x00, 0x69, 0x62,
+			0x69, 0x61, 0x67, 0x62, 0x69, 0x66, 0x65, 0x67),
+      simde_mm_set_epi8(0x65, 0x00, 0x64, 0x66, 0x69, 0x63, 0x64, 0x67,
+			0x64, 0x00, 0x64, 0x65, 0x64, 0x67, 0x68, 0x67),
+      1 },
+    { simde_mm_set_epi8(0x61, 0x62, 0x62, 0x62, 0x00, 0x00, 0x61, 0x61,
+			0x62, 0x61, 0x61, 0x62, 0x61, 0x63, 0x61, 0x63),
+      simde_mm_set_epi8(0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62,
+			0x63, 0x63, 0x61, 0x61, 0x63, 0x63, 0x61, 0x61),
+      1 },
+    { simde_mm_set_epi8(0x62, 0x00, 0x64, 0x62, 0x62, 0x65, 0x65, 0x64,
+			0x64, 0x65, 0x63, 0x64, 0x63, 0x64, 0x62, 0x63),
+      simde_mm_set_epi8(0x65, 0x62, 0x62, 0x00, 0x64, 0x62, 0x62, 0x65,
+			0x65, 0x64, 0x64, 0x65, 0x63, 0x64, 0x63, 0x64),
+      1 },
+    { simde_mm_set_epi8(0x67, 0x64, 0x63, 0x67, 0x61, 0x64, 0x66, 0x62,
+			0x61, 0x62, 0x66, 0x63, 0x67, 0x62, 0x66, 0x61),
+      simde_mm_set_epi8(0x65, 0x62, 0x65, 0x67, 0x61, 0x61, 0x61, 0x63,
+			0x67, 0x66, 0x61, 0x66, 0x63, 0x63, 0x64, 0x66),
+      1 },
+    { simde_mm_set_epi8(0x66, 0x62, 0x66, 0x63, 0x61, 0x67, 0x63, 0x65,
+			0x67, 0x68, 0x63, 0x63, 0x00, 0x64, 0x64, 0x67),
+      simde_mm_set_epi8(0x67, 0x67, 0x61, 0x64, 0x65, 0x65, 0x66, 0x66,
+			0x67, 0x67, 0x66, 0x00, 0x66, 0x62, 0x64, 0x66),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpistro(test_vec[i].a, test_vec[i].b, simde_SIDD_UBYTE_OPS | simde_SIDD_CMP_RANGES);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistrs(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x62, 0x63, 0x63, 0x61, 0x63, 0x61, 0x63, 0x61,
+			0x62, 0x63, 0x61, 0x62, 0x00, 0x61, 0x63, 0x63),
+      simde_mm_set_epi8(0x61, 0x63, 0x63, 0x63, 0x62, 0x61, 0x63, 0x63,
+			0x00, 0x61, 0x61, 0x61, 0x61, 0x63, 0x63, 0x61),
+      1 },
+    { simde_mm_set_epi8(0x63, 0x00, 0x65, 0x62, 0x65, 0x61, 0x63, 0x00,
+			0x61, 0x63, 0x61, 0x65, 0x64, 0x63, 0x62, 0x64),
+      simde_mm_set_epi8(0x00, 0x62, 0x62, 0x63, 0x61, 0x64, 0x61, 0x65,
+			0x62, 0x63, 0x64, 0x62, 0x62, 0x65, 0x64, 0x63),
+      1 },
+    { simde_mm_set_epi8(0x64, 0x67, 0x64, 0x61, 0x62, 0x64, 0x62, 0x62,
+			0x61, 0x66, 0x00, 0x64, 0x66, 0x67, 0x65, 0x61),
+      simde_mm_set_epi8(0x63, 0x67, 0x62, 0x65, 0x00, 0x62, 0x64, 0x63,
+			0x67, 0x67, 0x63, 0x67, 0x65, 0x65, 0x64, 0x67),
+      1 },
+    { simde_mm_set_epi8(0x64, 0x69, 0x65, 0x65, 0x64, 0x64, 0x68, 0x61,
+			0x62, 0x00, 0x67, 0x64, 0x61, 0x61, 0x61, 0x67),
+      simde_mm_set_epi8(0x69, 0x65, 0x63, 0x62, 0x61, 0x64, 0x66, 0x68,
+			0x63, 0x63, 0x69, 0x62, 0x63, 0x66, 0x63, 0x65),
+      1 },
+    { simde_mm_set_epi8(0x62, 0x62, 0x62, 0x61, 0x61, 0x00, 0x61, 0x63,
+			0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x63, 0x63),
+      simde_mm_set_epi8(0x62, 0x62, 0x61, 0x61, 0x61, 0x63, 0x63, 0x61,
+			0x62, 0x63, 0x63, 0x62, 0x61, 0x62, 0x63, 0x63),
+      1 },
+    { simde_mm_set_epi8(0x64, 0x65, 0x61, 0x64, 0x00, 0x61, 0x65, 0x61,
+			0x62, 0x64, 0x65, 0x65, 0x00, 0x63, 0x61, 0x64),
+      simde_mm_set_epi8(0x00, 0x62, 0x64, 0x65, 0x61, 0x64, 0x00, 0x61,
+			0x65, 0x61, 0x62, 0x64, 0x65, 0x65, 0x00, 0x63),
+      1 },
+    { simde_mm_set_epi8(0x61, 0x64, 0x67, 0x67, 0x65, 0x67, 0x61, 0x62,
+			0x66, 0x65, 0x64, 0x64, 0x61, 0x62, 0x62, 0x65),
+      simde_mm_set_epi8(0x64, 0x67, 0x62, 0x66, 0x62, 0x62, 0x63, 0x63,
+			0x63, 0x67, 0x64, 0x63, 0x66, 0x66, 0x65, 0x64),
+      0 },
+    { simde_mm_set_epi8(0x67, 0x66, 0x68, 0x62, 0x66, 0x65, 0x68, 0x61,
+			0x67, 0x66, 0x00, 0x00, 0x69, 0x67, 0x63, 0x62),
+      simde_mm_set_epi8(0x67, 0x63, 0x66, 0x67, 0x68, 0x67, 0x62, 0x63,
+			0x62, 0x65, 0x69, 0x68, 0x61, 0x00, 0x66, 0x68),
+      1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpistrs(test_vec[i].a, test_vec[i].b, simde_SIDD_UBYTE_OPS | simde_SIDD_CMP_EQUAL_EACH);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistrz(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0x62, 0x61, 0x61, 0x62, 0x61, 0x63, 0x62, 0x00,
+			0x63, 0x62, 0x62, 0x63, 0x63, 0x00, 0x63, 0x62),
+      simde_mm_set_epi8(0x62, 0x61, 0x61, 0x61, 0x62, 0x62, 0x61, 0x62,
+			0x61, 0x61, 0x63, 0x62, 0x61, 0x62, 0x63, 0x61),
+      0 },
+    { simde_mm_set_epi8(0x61, 0x61, 0x61, 0x63, 0x65, 0x64, 0x00, 0x61,
+			0x63, 0x65, 0x63, 0x64, 0x61, 0x62, 0x65, 0x61),
+      simde_mm_set_epi8(0x63, 0x64, 0x63, 0x62, 0x65, 0x65, 0x63, 0x65,
+			0x61, 0x64, 0x64, 0x62, 0x65, 0x62, 0x63, 0x61),
+      0 },
+    { simde_mm_set_epi8(0x61, 0x63, 0x63, 0x63, 0x00, 0x64, 0x65, 0x67,
+			0x61, 0x63, 0x62, 0x63, 0x67, 0x66, 0x66, 0x61),
+      simde_mm_set_epi8(0x61, 0x64, 0x65, 0x62, 0x63, 0x65, 0x65, 0x62,
+			0x67, 0x66, 0x67, 0x64, 0x64, 0x61, 0x64, 0x63),
+      0 },
+    { simde_mm_set_epi8(0x65, 0x65, 0x62, 0x66, 0x65, 0x66, 0x68, 0x66,
+			0x68, 0x68, 0x64, 0x67, 0x67, 0x66, 0x69, 0x61),
+      simde_mm_set_epi8(0x63, 0x64, 0x67, 0x69, 0x68, 0x65, 0x69, 0x61,
+			0x67, 0x65, 0x69, 0x61, 0x69, 0x64, 0x65, 0x62),
+      0 },
+    { simde_mm_set_epi8(0x62, 0x61, 0x61, 0x62, 0x62, 0x63, 0x62, 0x63,
+			0x63, 0x62, 0x62, 0x61, 0x62, 0x62, 0x63, 0x61),
+      simde_mm_set_epi8(0x62, 0x62, 0x63, 0x63, 0x62, 0x63, 0x61, 0x62,
+			0x00, 0x62, 0x63, 0x61, 0x61, 0x61, 0x61, 0x63),
+      1 },
+    { simde_mm_set_epi8(0x61, 0x62, 0x65, 0x64, 0x64, 0x61, 0x62, 0x63,
+			0x00, 0x62, 0x64, 0x62, 0x61, 0x00, 0x61, 0x61),
+      simde_mm_set_epi8(0x64, 0x65, 0x61, 0x62, 0x65, 0x64, 0x64, 0x61,
+			0x62, 0x63, 0x00, 0x62, 0x64, 0x62, 0x61, 0x00),
+      1 },
+    { simde_mm_set_epi8(0x65, 0x67, 0x61, 0x66, 0x62, 0x67, 0x65, 0x65,
+			0x63, 0x65, 0x00, 0x64, 0x63, 0x63, 0x65, 0x65),
+      simde_mm_set_epi8(0x64, 0x64, 0x65, 0x00, 0x63, 0x67, 0x65, 0x64,
+			0x63, 0x64, 0x65, 0x64, 0x67, 0x67, 0x66, 0x67),
+      1 },
+    { simde_mm_set_epi8(0x64, 0x68, 0x68, 0x61, 0x69, 0x62, 0x61, 0x62,
+			0x68, 0x63, 0x69, 0x62, 0x65, 0x62, 0x69, 0x63),
+      simde_mm_set_epi8(0x64, 0x64, 0x67, 0x63, 0x65, 0x69, 0x62, 0x64,
+			0x69, 0x61, 0x61, 0x66, 0x68, 0x68, 0x63, 0x68),
+      0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    int r = simde_mm_cmpistrz(test_vec[i].a, test_vec[i].b, simde_SIDD_UBYTE_OPS | simde_SIDD_CMP_EQUAL_EACH);
+    munit_assert_int(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpgt_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(-3561813423550613875), INT64_C( 8623843478771139182)),
+      simde_mm_set_epi64x(INT64_C(-2214408822805619980), INT64_C( 1648495331598290555)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C( 8430660336268826327), INT64_C( 5658122942879582530)),
+      simde_mm_set_epi64x(INT64_C( 8430660336268826233), INT64_C( 5658122941966851271)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C( 5824733260392989285), INT64_C( 1064939686272604721)),
+      simde_mm_set_epi64x(INT64_C(-5488817308048397849), INT64_C(-3674113226969660934)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C( 7934899360517665944), INT64_C(-2702325168932611971)),
+      simde_mm_set_epi64x(INT64_C( 7934899360517665828), INT64_C(-2702325170408685722)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C( 1245689602418204890), INT64_C(-2123351763994195789)),
+      simde_mm_set_epi64x(INT64_C( 3752840428331199928), INT64_C(-8166381159303767485)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C(-5607510790531784663), INT64_C( 5546255433770838080)),
+      simde_mm_set_epi64x(INT64_C(-5607510790531784702), INT64_C( 5546255433207284400)),
+      simde_mm_set_epi64x(INT64_C(                  -1), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C(-4405187925447790864), INT64_C( 5020789011282233002)),
+      simde_mm_set_epi64x(INT64_C( 1494203191010841187), INT64_C(  798934894463300133)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                  -1)) },
+    { simde_mm_set_epi64x(INT64_C( 6281390634257325176), INT64_C( 6130800867315906800)),
+      simde_mm_set_epi64x(INT64_C( 6281390634257325305), INT64_C( 6130800870439635750)),
+      simde_mm_set_epi64x(INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_cmpgt_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_crc32_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t crc;
+    uint8_t v;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x31b6d9ef), UINT8_C(0xb7), UINT32_C(0xdbcd34c5) },
+    { UINT32_C(0x0016351a), UINT8_C(0xf0), UINT32_C(0x88d29617) },
+    { UINT32_C(0x94552d7c), UINT8_C(0x12), UINT32_C(0xcd2a7968) },
+    { UINT32_C(0x38d4f456), UINT8_C(0xb6), UINT32_C(0xe3087cee) },
+    { UINT32_C(0xbf49868f), UINT8_C(0x9b), UINT32_C(0xd77b19f6) },
+    { UINT32_C(0x073ca7e2), UINT8_C(0xc4), UINT32_C(0x061b5591) },
+    { UINT32_C(0xff4ab7e1), UINT8_C(0x49), UINT32_C(0x286da7de) },
+    { UINT32_C(0xcc3fce8a), UINT8_C(0x05), UINT32_C(0xdc293892) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_mm_crc32_u8(test_vec[i].crc, test_vec[i].v);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_crc32_u16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t crc;
+    uint16_t v;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0x37bdbb04), UINT16_C(0x8553), UINT32_C(0x26243feb) },
+    { UINT32_C(0xdc4037d1), UINT16_C(0x1f0f), UINT32_C(0x65ae55a7) },
+    { UINT32_C(0xb970f61e), UINT16_C(0x5a84), UINT32_C(0x915f3b28) },
+    { UINT32_C(0x7faaebb9), UINT16_C(0xe9b4), UINT32_C(0x2107354e) },
+    { UINT32_C(0x11557b1e), UINT16_C(0x775b), UINT32_C(0xef7ce12a) },
+    { UINT32_C(0xb56cc3fe), UINT16_C(0xbb4d), UINT32_C(0x742bf94d) },
+    { UINT32_C(0xf09c7699), UINT16_C(0xf54f), UINT32_C(0xc378a45e) },
+    { UINT32_C(0x536a3934), UINT16_C(0x06fe), UINT32_C(0xd075e954) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_mm_crc32_u16(test_vec[i].crc, test_vec[i].v);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_crc32_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t crc;
+    uint32_t v;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(0xe04b5365), UINT32_C(0x7b77f3b4), UINT32_C(0x3fb5e6c1) },
+    { UINT32_C(0xef48de09), UINT32_C(0xfbb4d096), UINT32_C(0xfda0b796) },
+    { UINT32_C(0x0cfd5e7e), UINT32_C(0xa6ef6f7b), UINT32_C(0x43e9d35a) },
+    { UINT32_C(0xdbbf218e), UINT32_C(0xbdd44466), UINT32_C(0xabd196b1) },
+    { UINT32_C(0x80ea42ce), UINT32_C(0xd70abe6c), UINT32_C(0xbf797429) },
+    { UINT32_C(0x865f060e), UINT32_C(0xd942d8ac), UINT32_C(0x1f2d9192) },
+    { UINT32_C(0x9c22e6ec), UINT32_C(0x5d166c66), UINT32_C(0xd8b8444b) },
+    { UINT32_C(0x6175be7d), UINT32_C(0x42bdb31d), UINT32_C(0xd560c1a2) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_mm_crc32_u32(test_vec[i].crc, test_vec[i].v);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_crc32_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t crc;
+    uint64_t v;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C(0x00000000620efee2), UINT64_C(0xf24f07354d50b83a), UINT64_C(0x00000000b03e1610) },
+    { UINT64_C(0x00000000f6fe4242), UINT64_C(0xa02ab71e63ba9131), UINT64_C(0x00000000b4555fe6) },
+    { UINT64_C(0x00000000b64cfdf7), UINT64_C(0x3e0048982dce235d), UINT64_C(0x000000004474d4c2) },
+    { UINT64_C(0x000000009a75bdab), UINT64_C(0x31f7eedc63039379), UINT64_C(0x0000000009883581) },
+    { UINT64_C(0x00000000caffb024), UINT64_C(0xa464360f1012dddd), UINT64_C(0x00000000a529a1e4) },
+    { UINT64_C(0x0000000074b438fd), UINT64_C(0x97b6e7e32f2c32b4), UINT64_C(0x0000000007de7bda) },
+    { UINT64_C(0x00000000a3db8471), UINT64_C(0xb4c077138ff52d13), UINT64_C(0x00000000010c1266) },
+    { UINT64_C(0x0000000090428332), UINT64_C(0x9052e58514763588), UINT64_C(0x00000000223706b9) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_mm_crc32_u64(test_vec[i].crc, test_vec[i].v);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitTest test_suite_tests[] = {
-  /* { (char*) "/sse4.2/mm_set_epi8",      test_simde_mm_set_epi8,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }, */
+  { (char*) "/mm_cmpestra",      test_simde_mm_cmpestra,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpestrc",      test_simde_mm_cmpestrc,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpestri",      test_simde_mm_cmpestri,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpestrm",      test_simde_mm_cmpestrm,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpestro",      test_simde_mm_cmpestro,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpestrs",      test_simde_mm_cmpestrs,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpestrz",      test_simde_mm_cmpestrz,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpistra",      test_simde_mm_cmpistra,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpistrc",      test_simde_mm_cmpistrc,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpistri",      test_simde_mm_cmpistri,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpistrm",      test_simde_mm_cmpistrm,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpistro",      test_simde_mm_cmpistro,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpistrs",      test_simde_mm_cmpistrs,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpistrz",      test_simde_mm_cmpistrz,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_cmpgt_epi64",   test_simde_mm_cmpgt_epi64,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_crc32_u8",      test_simde_mm_crc32_u8,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_crc32_u16",     test_simde_mm_crc32_u16,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_crc32_u32",     test_simde_mm_crc32_u32,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_crc32_u64",     test_simde_mm_crc32_u64,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
   { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
@@ -162,9 +162,1345 @@ test_simde_mm_shuffle_epi8(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm_abs_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0xce, 0x91, 0xe5, 0x90, 0x05, 0x0c, 0x36, 0x8d,
+			0x77, 0xae, 0x0b, 0xf3, 0xee, 0xb9, 0x02, 0x6e),
+      simde_mm_set_epi8(0x32, 0x6f, 0x1b, 0x70, 0x05, 0x0c, 0x36, 0x73,
+			0x77, 0x52, 0x0b, 0x0d, 0x12, 0x47, 0x02, 0x6e) },
+    { simde_mm_set_epi8(0xe1, 0x44, 0xd6, 0xe8, 0x79, 0x2e, 0x1a, 0xf4,
+			0x16, 0xe0, 0xa1, 0xc5, 0x1d, 0xce, 0x4e, 0x7b),
+      simde_mm_set_epi8(0x1f, 0x44, 0x2a, 0x18, 0x79, 0x2e, 0x1a, 0x0c,
+			0x16, 0x20, 0x5f, 0x3b, 0x1d, 0x32, 0x4e, 0x7b) },
+    { simde_mm_set_epi8(0x74, 0xff, 0xb8, 0xe8, 0x85, 0x47, 0x56, 0xd7,
+			0x4e, 0x85, 0xb0, 0xd6, 0xa9, 0xd3, 0x49, 0x42),
+      simde_mm_set_epi8(0x74, 0x01, 0x48, 0x18, 0x7b, 0x47, 0x56, 0x29,
+			0x4e, 0x7b, 0x50, 0x2a, 0x57, 0x2d, 0x49, 0x42) },
+    { simde_mm_set_epi8(0x99, 0xe8, 0x3f, 0x5a, 0x50, 0x79, 0xfc, 0x5d,
+			0x79, 0xf8, 0xad, 0xa7, 0xc4, 0x9b, 0xd6, 0x3b),
+      simde_mm_set_epi8(0x67, 0x18, 0x3f, 0x5a, 0x50, 0x79, 0x04, 0x5d,
+			0x79, 0x08, 0x53, 0x59, 0x3c, 0x65, 0x2a, 0x3b) },
+    { simde_mm_set_epi8(0x39, 0xb1, 0x6b, 0x71, 0x2d, 0xcf, 0xc8, 0xae,
+			0xfc, 0x38, 0x7d, 0xfa, 0xda, 0xbf, 0x55, 0x85),
+      simde_mm_set_epi8(0x39, 0x4f, 0x6b, 0x71, 0x2d, 0x31, 0x38, 0x52,
+			0x04, 0x38, 0x7d, 0x06, 0x26, 0x41, 0x55, 0x7b) },
+    { simde_mm_set_epi8(0x50, 0xd5, 0x9c, 0x0a, 0x21, 0x20, 0x82, 0x65,
+			0x0e, 0xc7, 0x6d, 0x00, 0x9b, 0x7e, 0x9a, 0x31),
+      simde_mm_set_epi8(0x50, 0x2b, 0x64, 0x0a, 0x21, 0x20, 0x7e, 0x65,
+			0x0e, 0x39, 0x6d, 0x00, 0x65, 0x7e, 0x66, 0x31) },
+    { simde_mm_set_epi8(0xb3, 0xd3, 0xcd, 0xbd, 0x44, 0xc2, 0x69, 0xe7,
+			0xcd, 0x02, 0xed, 0x7c, 0x81, 0xe8, 0xc1, 0xfa),
+      simde_mm_set_epi8(0x4d, 0x2d, 0x33, 0x43, 0x44, 0x3e, 0x69, 0x19,
+			0x33, 0x02, 0x13, 0x7c, 0x7f, 0x18, 0x3f, 0x06) },
+    { simde_mm_set_epi8(0x6e, 0x1e, 0x6c, 0xed, 0x70, 0x21, 0x34, 0x98,
+			0xda, 0x7f, 0x69, 0x93, 0x8e, 0x2c, 0x98, 0x7d),
+      simde_mm_set_epi8(0x6e, 0x1e, 0x6c, 0x13, 0x70, 0x21, 0x34, 0x68,
+			0x26, 0x7f, 0x69, 0x6d, 0x72, 0x2c, 0x68, 0x7d) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_abs_epi8(test_vec[i].a);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_abs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 19510,  32767,   1456, -16132, INT16_MIN,  30854,  32767,  32610),
+      simde_mm_set_epi16( 19510,  32767,   1456,  16132, INT16_MIN,  30854,  32767,  32610) },
+    { simde_mm_set_epi16( 13332,  32767,  30055,  -4680, -29013,  12186,  23361,      0),
+      simde_mm_set_epi16( 13332,  32767,  30055,   4680,  29013,  12186,  23361,      0) },
+    { simde_mm_set_epi16( 10043, INT16_MIN,    235,  12331,      0,   -602, INT16_MIN,  10992),
+      simde_mm_set_epi16( 10043, INT16_MIN,    235,  12331,      0,    602, INT16_MIN,  10992) },
+    { simde_mm_set_epi16( 22315,  -1152,  27231, -25480,  21780,  -1304,      0,  30960),
+      simde_mm_set_epi16( 22315,   1152,  27231,  25480,  21780,   1304,      0,  30960) },
+    { simde_mm_set_epi16(INT16_MIN, INT16_MIN,  32767,  32767,      0,  -9745,      0,      0),
+      simde_mm_set_epi16(INT16_MIN, INT16_MIN,  32767,  32767,      0,   9745,      0,      0) },
+    { simde_mm_set_epi16(-13249, -12662,  -6841,  20485,   -182, -18463,   2591, INT16_MIN),
+      simde_mm_set_epi16( 13249,  12662,   6841,  20485,    182,  18463,   2591, INT16_MIN) },
+    { simde_mm_set_epi16(-19092, -15362, INT16_MIN, -17587,      0,  31518,  10561,  30555),
+      simde_mm_set_epi16( 19092,  15362, INT16_MIN,  17587,      0,  31518,  10561,  30555) },
+    { simde_mm_set_epi16( -9281,   8590, INT16_MIN,  17510,   3325,  24190, -22801,  28539),
+      simde_mm_set_epi16(  9281,   8590, INT16_MIN,  17510,   3325,  24190,  22801,  28539) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_abs_epi16(test_vec[i].a);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_abs_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32( 1297135674,  -151109054,  1645149922,  -229701835),
+      simde_mm_set_epi32( 1297135674,   151109054,  1645149922,   229701835) },
+    { simde_mm_set_epi32(-1236468233,  1040205976, -1607813346,  1673171249),
+      simde_mm_set_epi32( 1236468233,  1040205976,  1607813346,  1673171249) },
+    { simde_mm_set_epi32(  838332124,  1661178745,   768484189, -1703559765),
+      simde_mm_set_epi32(  838332124,  1661178745,   768484189,  1703559765) },
+    { simde_mm_set_epi32(  269671901,  1957968125,  -889212892, -1536936433),
+      simde_mm_set_epi32(  269671901,  1957968125,   889212892,  1536936433) },
+    { simde_mm_set_epi32(-1545894799, -1262455021, -1749620765,   791425716),
+      simde_mm_set_epi32( 1545894799,  1262455021,  1749620765,   791425716) },
+    { simde_mm_set_epi32(-1873615483,   343291272, -1879757549, -1874689230),
+      simde_mm_set_epi32( 1873615483,   343291272,  1879757549,  1874689230) },
+    { simde_mm_set_epi32( 1535276339,  -601838349, -1633144051,  1240946121),
+      simde_mm_set_epi32( 1535276339,   601838349,  1633144051,  1240946121) },
+    { simde_mm_set_epi32(  579790769,   466050901,   -34974859,   839154619),
+      simde_mm_set_epi32(  579790769,   466050901,    34974859,   839154619) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_abs_epi32(test_vec[i].a);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_abs_pi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi8(0x61, 0xeb, 0x41, 0x95, 0x81, 0x0a, 0x9b, 0x82),
+      simde_mm_set_pi8(0x61, 0x15, 0x41, 0x6b, 0x7f, 0x0a, 0x65, 0x7e) },
+    { simde_mm_set_pi8(0x49, 0x59, 0x15, 0xad, 0x78, 0x06, 0xc5, 0x9e),
+      simde_mm_set_pi8(0x49, 0x59, 0x15, 0x53, 0x78, 0x06, 0x3b, 0x62) },
+    { simde_mm_set_pi8(0x9f, 0xf1, 0x35, 0x76, 0xa9, 0x6b, 0x18, 0x55),
+      simde_mm_set_pi8(0x61, 0x0f, 0x35, 0x76, 0x57, 0x6b, 0x18, 0x55) },
+    { simde_mm_set_pi8(0xd7, 0x71, 0x10, 0xb8, 0xfe, 0x5a, 0xeb, 0xcf),
+      simde_mm_set_pi8(0x29, 0x71, 0x10, 0x48, 0x02, 0x5a, 0x15, 0x31) },
+    { simde_mm_set_pi8(0xd1, 0xec, 0xaa, 0x02, 0xc7, 0x69, 0xb3, 0x28),
+      simde_mm_set_pi8(0x2f, 0x14, 0x56, 0x02, 0x39, 0x69, 0x4d, 0x28) },
+    { simde_mm_set_pi8(0x67, 0xa4, 0x76, 0x97, 0xc2, 0x41, 0xfa, 0x7a),
+      simde_mm_set_pi8(0x67, 0x5c, 0x76, 0x69, 0x3e, 0x41, 0x06, 0x7a) },
+    { simde_mm_set_pi8(0x23, 0x0a, 0xda, 0xef, 0x9d, 0x29, 0x0f, 0x1d),
+      simde_mm_set_pi8(0x23, 0x0a, 0x26, 0x11, 0x63, 0x29, 0x0f, 0x1d) },
+    { simde_mm_set_pi8(0xc8, 0xa9, 0xed, 0xed, 0x59, 0xe8, 0x9b, 0x57),
+      simde_mm_set_pi8(0x38, 0x57, 0x13, 0x13, 0x59, 0x18, 0x65, 0x57) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_abs_pi8(test_vec[i].a);
+    simde_assert_m64_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_abs_pi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi16(0x4713, 0xa9b8, 0x6687, 0xdb6b),
+      simde_mm_set_pi16(0x4713, 0x5648, 0x6687, 0x2495) },
+    { simde_mm_set_pi16(0x2267, 0x673f, 0xe635, 0x78c4),
+      simde_mm_set_pi16(0x2267, 0x673f, 0x19cb, 0x78c4) },
+    { simde_mm_set_pi16(0x2201, 0x9671, 0x598e, 0xbfea),
+      simde_mm_set_pi16(0x2201, 0x698f, 0x598e, 0x4016) },
+    { simde_mm_set_pi16(0xf3ca, 0x3ba2, 0x5868, 0x097b),
+      simde_mm_set_pi16(0x0c36, 0x3ba2, 0x5868, 0x097b) },
+    { simde_mm_set_pi16(0x1374, 0xaddc, 0xf7e9, 0xe83f),
+      simde_mm_set_pi16(0x1374, 0x5224, 0x0817, 0x17c1) },
+    { simde_mm_set_pi16(0xe4b2, 0xbad2, 0x63d9, 0x41e9),
+      simde_mm_set_pi16(0x1b4e, 0x452e, 0x63d9, 0x41e9) },
+    { simde_mm_set_pi16(0xea91, 0x67c9, 0x9a7c, 0x3966),
+      simde_mm_set_pi16(0x156f, 0x67c9, 0x6584, 0x3966) },
+    { simde_mm_set_pi16(0x6e3e, 0x83c4, 0xdea4, 0xd983),
+      simde_mm_set_pi16(0x6e3e, 0x7c3c, 0x215c, 0x267d) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_abs_pi16(test_vec[i].a);
+    simde_assert_m64_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_abs_pi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi32(0x318091b5, 0xb682e1cb),
+      simde_mm_set_pi32(0x318091b5, 0x497d1e35) },
+    { simde_mm_set_pi32(0x511b3390, 0xed6acaa2),
+      simde_mm_set_pi32(0x511b3390, 0x1295355e) },
+    { simde_mm_set_pi32(0xc6a67d00, 0xb3f99ebc),
+      simde_mm_set_pi32(0x39598300, 0x4c066144) },
+    { simde_mm_set_pi32(0x468dbb57, 0x594f126d),
+      simde_mm_set_pi32(0x468dbb57, 0x594f126d) },
+    { simde_mm_set_pi32(0x1d39f25c, 0x1f8cd39e),
+      simde_mm_set_pi32(0x1d39f25c, 0x1f8cd39e) },
+    { simde_mm_set_pi32(0x0b8ab05d, 0x8ccb432a),
+      simde_mm_set_pi32(0x0b8ab05d, 0x7334bcd6) },
+    { simde_mm_set_pi32(0x13f1c0b1, 0x782d96a0),
+      simde_mm_set_pi32(0x13f1c0b1, 0x782d96a0) },
+    { simde_mm_set_pi32(0xc836d721, 0x4c72979c),
+      simde_mm_set_pi32(0x37c928df, 0x4c72979c) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_abs_pi32(test_vec[i].a);
+    simde_assert_m64_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_alignr_pi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi8(0xc4, 0x53, 0x82, 0xb7, 0x58, 0x92, 0xd4, 0x29),
+      simde_mm_set_pi8(0xe9, 0x63, 0x37, 0xa6, 0x4e, 0xe4, 0xff, 0x44),
+      simde_mm_set_pi8(0xb7, 0x58, 0x92, 0xd4, 0x29, 0xe9, 0x63, 0x37) },
+    { simde_mm_set_pi8(0x5c, 0xdf, 0x01, 0x9a, 0x79, 0x6b, 0xe9, 0x95),
+      simde_mm_set_pi8(0xa2, 0x99, 0x35, 0xc2, 0x40, 0x5c, 0x13, 0x0c),
+      simde_mm_set_pi8(0x9a, 0x79, 0x6b, 0xe9, 0x95, 0xa2, 0x99, 0x35) },
+    { simde_mm_set_pi8(0xaa, 0xb0, 0x0d, 0xe2, 0x6a, 0x39, 0x2f, 0x39),
+      simde_mm_set_pi8(0x9d, 0xf6, 0x64, 0x99, 0xfb, 0xae, 0x04, 0xf4),
+      simde_mm_set_pi8(0xe2, 0x6a, 0x39, 0x2f, 0x39, 0x9d, 0xf6, 0x64) },
+    { simde_mm_set_pi8(0xa4, 0x01, 0x09, 0x4f, 0x29, 0xd8, 0x96, 0xfb),
+      simde_mm_set_pi8(0x75, 0x70, 0xa6, 0xe4, 0x11, 0xf6, 0x1c, 0x10),
+      simde_mm_set_pi8(0x4f, 0x29, 0xd8, 0x96, 0xfb, 0x75, 0x70, 0xa6) },
+    { simde_mm_set_pi8(0x43, 0x37, 0x81, 0xc1, 0xbb, 0x63, 0x20, 0x73),
+      simde_mm_set_pi8(0x50, 0x08, 0x2a, 0x0b, 0x37, 0xbe, 0x8d, 0xb8),
+      simde_mm_set_pi8(0xc1, 0xbb, 0x63, 0x20, 0x73, 0x50, 0x08, 0x2a) },
+    { simde_mm_set_pi8(0x7d, 0x03, 0x43, 0xe9, 0x76, 0x0a, 0xdd, 0x37),
+      simde_mm_set_pi8(0x96, 0xad, 0x55, 0xa9, 0x66, 0x69, 0x57, 0x68),
+      simde_mm_set_pi8(0xe9, 0x76, 0x0a, 0xdd, 0x37, 0x96, 0xad, 0x55) },
+    { simde_mm_set_pi8(0x25, 0xf8, 0x26, 0xbc, 0xdf, 0xdd, 0xa6, 0x46),
+      simde_mm_set_pi8(0x11, 0xe7, 0x9e, 0x1e, 0xa6, 0x50, 0xb7, 0x78),
+      simde_mm_set_pi8(0xbc, 0xdf, 0xdd, 0xa6, 0x46, 0x11, 0xe7, 0x9e) },
+    { simde_mm_set_pi8(0x3c, 0x4c, 0xa7, 0x31, 0xd3, 0x23, 0x0b, 0x5e),
+      simde_mm_set_pi8(0x8d, 0x6c, 0x7d, 0x2c, 0x76, 0x2b, 0xf5, 0x2b),
+      simde_mm_set_pi8(0x31, 0xd3, 0x23, 0x0b, 0x5e, 0x8d, 0x6c, 0x7d) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_alignr_pi8(test_vec[i].a, test_vec[i].b, 5);
+    simde_assert_m64_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hadd_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( -3035, -28279,  32767, -20016,  13265,  32767,  21819, -30386),
+      simde_mm_set_epi16( 32767,  32767, INT16_MIN,  -9505,  21237,   1711, INT16_MIN,      0),
+      simde_mm_set_epi16(    -2,  23263,  22948, INT16_MIN, -31314,  12751, -19504,  -8567) },
+    { simde_mm_set_epi16(-20600,  -1985,  23476,   2831,  10044,  32644,   3166,  18251),
+      simde_mm_set_epi16(   402, -12877, -23715,      0,  32767, INT16_MIN, -17856, INT16_MIN),
+      simde_mm_set_epi16(-12475, -23715,     -1,  14912, -22585,  26307, -22848,  21417) },
+    { simde_mm_set_epi16( 25444,  10238,  19171,  28281, -24900, -29637,  26134, -23629),
+      simde_mm_set_epi16(INT16_MIN,  32767,  32767,  28914,  16513,  -6257,  -6303,  15152),
+      simde_mm_set_epi16(    -1,  -3855,  10256,   8849, -29854, -18084,  10999,   2505) },
+    { simde_mm_set_epi16(     0,      0,    703, -14324,      0, -25740, INT16_MIN,  30551),
+      simde_mm_set_epi16( 24504,      0,  -8846, -21538,  32767,  32767,  23733,  22424),
+      simde_mm_set_epi16( 24504, -30384,     -2, -19379,      0, -13621, -25740,  -2217) },
+    { simde_mm_set_epi16(-15832,      0,  -9804, INT16_MIN,      0,  16029,   4933,  32767),
+      simde_mm_set_epi16(     0,  15815, -21874, -20565,  -6555,  32767,      0,  17100),
+      simde_mm_set_epi16( 15815,  23097,  26212,  17100, -15832,  22964,  16029, -27836) },
+    { simde_mm_set_epi16(-11031,  14317, -16098,  10539, INT16_MIN,  17278,   4035, -24388),
+      simde_mm_set_epi16(  2783,      0, INT16_MIN, -18151, -15071,      0,      0,  -4356),
+      simde_mm_set_epi16(  2783,  14617, -15071,  -4356,   3286,  -5559, -15490, -20353) },
+    { simde_mm_set_epi16(-22107, -13469,  32767,  24611, INT16_MIN,      0,   6845,   2753),
+      simde_mm_set_epi16( 32767,  14004,  32767,  26047, INT16_MIN,  -4400,  32767, -14176),
+      simde_mm_set_epi16(-18765,  -6722,  28368,  18591,  29960,  -8158, INT16_MIN,   9598) },
+    { simde_mm_set_epi16( 32767,  15503, -14954, INT16_MIN,      0,  -5774,   7723,  32767),
+      simde_mm_set_epi16(INT16_MIN, -17926, -22640,   2562, -24385,    876,  32767,  22721),
+      simde_mm_set_epi16( 14842, -20078, -23509, -10048, -17266,  17814,  -5774, -25046) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_hadd_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hadd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1638809232,  -457188338,  1296705354,  -290626522),
+      simde_mm_set_epi32(-1933703359, -1747916283,    21857582, -1260840457),
+      simde_mm_set_epi32(  613347654, -1238982875, -2095997570,  1006078832) },
+    { simde_mm_set_epi32( 1316606822,  -844868638,   619640955, -1367553453),
+      simde_mm_set_epi32(  540124895,  -640789174, -2014685594,   303510185),
+      simde_mm_set_epi32( -100664279, -1711175409,   471738184,  -747912498) },
+    { simde_mm_set_epi32(  998169149, -1780004763,   189647712,  -351822627),
+      simde_mm_set_epi32( 1492925612,   700441382,  1220798776,  1145362707),
+      simde_mm_set_epi32(-2101600302, -1928805813,  -781835614,  -162174915) },
+    { simde_mm_set_epi32( 1670774474,  1908738286, -1650415128,  -495581803),
+      simde_mm_set_epi32( -472212695,  1879431363,  1032949318, -1486159123),
+      simde_mm_set_epi32( 1407218668,  -453209805,  -715454536, -2145996931) },
+    { simde_mm_set_epi32( -966574006, -1671356231,  1183583903,  1201671196),
+      simde_mm_set_epi32( -967048346, -1696110853,   598404414,  -638367019),
+      simde_mm_set_epi32( 1631808097,   -39962605,  1657037059, -1909712197) },
+    { simde_mm_set_epi32( 1101360528,  1260639150,  -391020550, -1758052583),
+      simde_mm_set_epi32(  219690347,  1390132458,   197064071, -2018204850),
+      simde_mm_set_epi32( 1609822805, -1821140779, -1932967618,  2145894163) },
+    { simde_mm_set_epi32(-1393861589,  1596439013, -2098996677, -2099394577),
+      simde_mm_set_epi32( -794101390,   502181148, -1007311283, -1797989589),
+      simde_mm_set_epi32( -291920242,  1489666424,   202577424,    96576042) },
+    { simde_mm_set_epi32(  732107561, -1322545601, -1125916025,  -458998181),
+      simde_mm_set_epi32( 1778233763,  -234480590, -1582993132,   147553105),
+      simde_mm_set_epi32( 1543753173, -1435440027,  -590438040, -1584914206) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_hadd_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hadd_pi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi16(0x7e47, 0xd7d2, 0x698c, 0xe202),
+      simde_mm_set_pi16(0x9669, 0x72b5, 0xc04f, 0x1000),
+      simde_mm_set_pi16(0x091e, 0xd04f, 0x5619, 0x4b8e) },
+    { simde_mm_set_pi16(0x5d55, 0x5d5d, 0xed74, 0xdcf1),
+      simde_mm_set_pi16(0x9a5b, 0x12ce, 0x05f0, 0x73ad),
+      simde_mm_set_pi16(0xad29, 0x799d, 0xbab2, 0xca65) },
+    { simde_mm_set_pi16(0xcb7a, 0xea94, 0xea94, 0x6958),
+      simde_mm_set_pi16(0x1e63, 0x06b9, 0x9963, 0xa18d),
+      simde_mm_set_pi16(0x251c, 0x3af0, 0xb60e, 0x53ec) },
+    { simde_mm_set_pi16(0x1668, 0xe794, 0xc796, 0xb3f2),
+      simde_mm_set_pi16(0xb917, 0xcc58, 0x41a6, 0xa68b),
+      simde_mm_set_pi16(0x856f, 0xe831, 0xfdfc, 0x7b88) },
+    { simde_mm_set_pi16(0x1d8d, 0x9b86, 0x8506, 0x0ef3),
+      simde_mm_set_pi16(0x6291, 0xd48a, 0x77eb, 0xc7c7),
+      simde_mm_set_pi16(0x371b, 0x3fb2, 0xb913, 0x93f9) },
+    { simde_mm_set_pi16(0x1404, 0x82ca, 0x9367, 0x8efb),
+      simde_mm_set_pi16(0xa9d7, 0x6a6b, 0x2da5, 0x4813),
+      simde_mm_set_pi16(0x1442, 0x75b8, 0x96ce, 0x2262) },
+    { simde_mm_set_pi16(0x8a0f, 0x26ea, 0xb2f7, 0xb548),
+      simde_mm_set_pi16(0xa0ed, 0x00ef, 0x1b30, 0x5d8e),
+      simde_mm_set_pi16(0xa1dc, 0x78be, 0xb0f9, 0x683f) },
+    { simde_mm_set_pi16(0xa215, 0x272c, 0xc3fd, 0xdf2c),
+      simde_mm_set_pi16(0xff99, 0x3e12, 0x6555, 0xe4c7),
+      simde_mm_set_pi16(0x3dab, 0x4a1c, 0xc941, 0xa329) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_hadd_pi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hadd_pi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi32(0xeadedeba, 0x5808985d),
+      simde_mm_set_pi32(0x0fb6b3df, 0x6770c0f1),
+      simde_mm_set_pi32(0x772774d0, 0x42e77717) },
+    { simde_mm_set_pi32(0x8ffb35e3, 0xfb7df9b0),
+      simde_mm_set_pi32(0x5e018e41, 0x17711dd5),
+      simde_mm_set_pi32(0x7572ac16, 0x8b792f93) },
+    { simde_mm_set_pi32(0x0269395f, 0x36b53d66),
+      simde_mm_set_pi32(0x6d685cf3, 0xa3e5943f),
+      simde_mm_set_pi32(0x114df132, 0x391e76c5) },
+    { simde_mm_set_pi32(0xd7632179, 0xee34e94f),
+      simde_mm_set_pi32(0xcc723056, 0x20f36ad7),
+      simde_mm_set_pi32(0xed659b2d, 0xc5980ac8) },
+    { simde_mm_set_pi32(0x278b2db2, 0xf06f1ac3),
+      simde_mm_set_pi32(0x510de080, 0xf0c983e3),
+      simde_mm_set_pi32(0x41d76463, 0x17fa4875) },
+    { simde_mm_set_pi32(0xef942f1a, 0xef4a927a),
+      simde_mm_set_pi32(0x28b49859, 0x30c96b9c),
+      simde_mm_set_pi32(0x597e03f5, 0xdedec194) },
+    { simde_mm_set_pi32(0x824ba80b, 0xda24e574),
+      simde_mm_set_pi32(0xa2121c4a, 0x472da036),
+      simde_mm_set_pi32(0xe93fbc80, 0x5c708d7f) },
+    { simde_mm_set_pi32(0xe0c68f31, 0x7f721a64),
+      simde_mm_set_pi32(0x3d13890a, 0x11d7d8de),
+      simde_mm_set_pi32(0x4eeb61e8, 0x6038a995) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_hadd_pi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hadds_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 32767,  10505,  32767,      0,   -813,   5697, -31928, INT16_MIN),
+      simde_mm_set_epi16(-31512,  28039,  14602,  23526, INT16_MIN,  32767,  17094,  19858),
+      simde_mm_set_epi16( -3473,  32767,     -1,  32767,  32767,  32767,   4884, INT16_MIN) },
+    { simde_mm_set_epi16( -6903, INT16_MIN,  32767, INT16_MIN,  28803,   8747,   3468,  -6445),
+      simde_mm_set_epi16( 32767, INT16_MIN, INT16_MIN,  24518,  23216, -16591,  -1862,  -9605),
+      simde_mm_set_epi16(    -1,  -8250,   6625, -11467, INT16_MIN,     -1,  32767,  -2977) },
+    { simde_mm_set_epi16( 11315,  17058,   4829, INT16_MIN, INT16_MIN,      0,  22760,  32392),
+      simde_mm_set_epi16(     0, INT16_MIN, -29785,   2506,      0,  22900, INT16_MIN,  29396),
+      simde_mm_set_epi16(INT16_MIN, -27279,  22900,  -3372,  28373, -27939, INT16_MIN,  32767) },
+    { simde_mm_set_epi16(     0, -17503, -25185,  32767, -20790,  -3383, -21290,  23216),
+      simde_mm_set_epi16(-18701,  26430,  26211,  29435, INT16_MIN, -16339, -27839,      0),
+      simde_mm_set_epi16(  7729,  32767, INT16_MIN, -27839, -17503,   7582, -24173,   1926) },
+    { simde_mm_set_epi16( 13073,  18707, -25527, -27827, -32045, INT16_MIN,      0,  32767),
+      simde_mm_set_epi16(-12117, -16970,      0,  32767,  -7350, -23870, -15526,  26325),
+      simde_mm_set_epi16(-29087,  32767, -31220,  10799,  31780, INT16_MIN, INT16_MIN,  32767) },
+    { simde_mm_set_epi16( 26482, INT16_MIN,  -1544,   6501,    942, -17535,  32767, -31349),
+      simde_mm_set_epi16(INT16_MIN,      0, -19868,  32767,  32767,      0,  32767,  27894),
+      simde_mm_set_epi16(INT16_MIN,  12899,  32767,  32767,  -6286,   4957, -16593,   1418) },
+    { simde_mm_set_epi16( 32767, -29850,      0, -11914, INT16_MIN,  -3145,      0,  32767),
+      simde_mm_set_epi16(-25068, -21627,      0,  -4075,  22263,      0,  20535,      0),
+      simde_mm_set_epi16(INT16_MIN,  -4075,  22263,  20535,   2917, -11914, INT16_MIN,  32767) },
+    { simde_mm_set_epi16( 13943,     54,  12838,  32767,  -6203,  16282,  27902,  -1092),
+      simde_mm_set_epi16(  8452, -18984, -24130, -11395, -26425, -27770, INT16_MIN, -32011),
+      simde_mm_set_epi16(-10532, INT16_MIN, INT16_MIN, INT16_MIN,  13997,  32767,  10079,  26810) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_hadds_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hadds_pi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi16(0x0025, 0xdf79, 0xc4d0, 0xf3ae),
+      simde_mm_set_pi16(0x7753, 0x31a3, 0xf100, 0x3480),
+      simde_mm_set_pi16(0x7fff, 0x2580, 0xdf9e, 0xb87e) },
+    { simde_mm_set_pi16(0xd417, 0x5a6a, 0x6127, 0xc175),
+      simde_mm_set_pi16(0x7441, 0xc49d, 0xfcff, 0x76b8),
+      simde_mm_set_pi16(0x38de, 0x73b7, 0x2e81, 0x229c) },
+    { simde_mm_set_pi16(0x4f15, 0x0896, 0xbf3e, 0xaca2),
+      simde_mm_set_pi16(0x67ec, 0x29eb, 0x2961, 0x5396),
+      simde_mm_set_pi16(0x7fff, 0x7cf7, 0x57ab, 0x8000) },
+    { simde_mm_set_pi16(0x640b, 0xfe63, 0xa946, 0x7317),
+      simde_mm_set_pi16(0xdb78, 0xb4cb, 0xcdb5, 0x3535),
+      simde_mm_set_pi16(0x9043, 0x02ea, 0x626e, 0x1c5d) },
+    { simde_mm_set_pi16(0xa929, 0x266c, 0x285c, 0x96c7),
+      simde_mm_set_pi16(0x53eb, 0x2af9, 0x646c, 0xb438),
+      simde_mm_set_pi16(0x7ee4, 0x18a4, 0xcf95, 0xbf23) },
+    { simde_mm_set_pi16(0xc197, 0x970a, 0xb30b, 0x7719),
+      simde_mm_set_pi16(0x610a, 0xe21e, 0x31cc, 0xc1ad),
+      simde_mm_set_pi16(0x4328, 0xf379, 0x8000, 0x2a24) },
+    { simde_mm_set_pi16(0x9ef4, 0xa1b1, 0x8d29, 0x01a9),
+      simde_mm_set_pi16(0xcb79, 0xaf47, 0x8868, 0x6936),
+      simde_mm_set_pi16(0x8000, 0xf19e, 0x8000, 0x8ed2) },
+    { simde_mm_set_pi16(0x777d, 0x9f16, 0x217c, 0x686b),
+      simde_mm_set_pi16(0xf7b1, 0x43b4, 0x272b, 0x0101),
+      simde_mm_set_pi16(0x3b65, 0x282c, 0x1693, 0x7fff) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_hadds_pi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hsub_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16(-11918,      0, -27443, -18498, -26202, -30665,      0,  32767),
+      simde_mm_set_epi16( 20115,   1228,  -7077,      0, -14162,      0,  20221,      0),
+      simde_mm_set_epi16(-18887,   7077,  14162, -20221,  11918,   8945,  -4463,  32767) },
+    { simde_mm_set_epi16( 26761,  12985,  32767,  -6332,  32767,  -7139, -19445,  32767),
+      simde_mm_set_epi16(  9452,  32767,  10810, -27345,   9405,  -8397,   4839,  17417),
+      simde_mm_set_epi16( 23315,  27381, -17802,  12578, -13776,  26437,  25630, -13324) },
+    { simde_mm_set_epi16(-31228,  24830, -28234,      0,   -668,   6966, -26389, -24664),
+      simde_mm_set_epi16(     0,  32767,  16125, INT16_MIN, -18960,  21319,  -5463,  -3893),
+      simde_mm_set_epi16( 32767,  16643, -25257,   1570,  -9478,  28234,   7634,   1725) },
+    { simde_mm_set_epi16( 30710,  16665,  17152, -14541,  22099,  28155,  28331, -22884),
+      simde_mm_set_epi16( -3671,  32767, -19506,      0,  -3107,  -9651, -30474,  18683),
+      simde_mm_set_epi16(-29098,  19506,  -6544, -16379, -14045, -31693,   6056,  14321) },
+    { simde_mm_set_epi16( 20699,  32767, -17743,   4596,  11711,   4892,  22028,  -3203),
+      simde_mm_set_epi16(-12845,  27475,    232,      0,  -6476,  12162,  10541,  -7811),
+      simde_mm_set_epi16(-25216,   -232,  18638, -18352,  12068,  22339,  -6819, -25231) },
+    { simde_mm_set_epi16( 32767,  23757,  -1947,   9672, -10079,  13503,  10831,  -1536),
+      simde_mm_set_epi16(-24615,  32767,  32767,  -1466, -27030, -24792,  -9520, -15570),
+      simde_mm_set_epi16( -8154,  31303,   2238,  -6050,  -9010,  11619,  23582, -12367) },
+    { simde_mm_set_epi16( 17395,   1231,  24490,  32767,      0,  26699,  -6179, -16989),
+      simde_mm_set_epi16( 32767, -13383,  31540, -28869,   6732, INT16_MIN,      0,   6745),
+      simde_mm_set_epi16( 19386,   5127,  26036,   6745, -16164,   8277,  26699, -10810) },
+    { simde_mm_set_epi16(INT16_MIN,  14521,  22275,  32767, -28646,      0,  11639,      0),
+      simde_mm_set_epi16(-25096,  32767, -15432, -18914, -11137,   2931,    333, -12289),
+      simde_mm_set_epi16( -7673,  -3482,  14068, -12622, -18247,  10492,  28646, -11639) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_hsub_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hsub_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(-1113765689, -1943773598,  1283837268, -1556673907),
+      simde_mm_set_epi32( -815399259,  1149566280,   713404361,   840689034),
+      simde_mm_set_epi32( 1964965539,   127284673,  -830007909,  1454456121) },
+    { simde_mm_set_epi32(-1270757910,   193820010, -1144388726, -1021729446),
+      simde_mm_set_epi32( -121143791,  1683100840,  1474496002,     7626556),
+      simde_mm_set_epi32( 1804244631, -1466869446,  1464577920,   122659280) },
+    { simde_mm_set_epi32(-1916432482,   911881396,  1895674269,  1940242217),
+      simde_mm_set_epi32( 1225045139,  1663147886,  -834429931, -1402447447),
+      simde_mm_set_epi32(  438102747,  -568017516, -1466653418,    44567948) },
+    { simde_mm_set_epi32( -590165152, -1321901784,  1978479432, -1204616090),
+      simde_mm_set_epi32(  215094961,  1218205922,  -455669834, -1117662342),
+      simde_mm_set_epi32( 1003110961,  -661992508,  -731736632,  1111871774) },
+    { simde_mm_set_epi32( -813050630,   909025737,  -767098594,   282616300),
+      simde_mm_set_epi32(-1517349489, -1910898353,   179528990,   758321487),
+      simde_mm_set_epi32( -393548864,   578792497,  1722076367,  1049714894) },
+    { simde_mm_set_epi32( -958409457,  2070965471, -1709047306,  -219727477),
+      simde_mm_set_epi32( 1508870198,   108451697, -1888578660,   212081709),
+      simde_mm_set_epi32(-1400418501,  2100660369, -1265592368,  1489319829) },
+    { simde_mm_set_epi32(-1594834941,   345433995, -2122422097,   246739191),
+      simde_mm_set_epi32(-2127122310, -2058083627,  2037449533,  1363800104),
+      simde_mm_set_epi32(   69038683,  -673649429,  1940268936, -1925806008) },
+    { simde_mm_set_epi32(-2070105175,  -761947132, -1116630320, -1855472919),
+      simde_mm_set_epi32( 1934256381,  2050533704, -1694651633,  1220714650),
+      simde_mm_set_epi32(  116277323, -1379601013,  1308158043,  -738842599) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_hsub_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hsub_pi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi16(0x04a1, 0x2c65, 0xc8e0, 0x07e1),
+      simde_mm_set_pi16(0x55c2, 0x5737, 0x951f, 0x36b8),
+      simde_mm_set_pi16(0x0175, 0xa199, 0x27c4, 0x3f01) },
+    { simde_mm_set_pi16(0x5740, 0xba97, 0x7083, 0x18a8),
+      simde_mm_set_pi16(0x340b, 0x5f91, 0x540c, 0x2111),
+      simde_mm_set_pi16(0x2b86, 0xcd05, 0x6357, 0xa825) },
+    { simde_mm_set_pi16(0x44f4, 0xd45f, 0x7bf0, 0x847d),
+      simde_mm_set_pi16(0x475e, 0x6793, 0x62d5, 0xd98d),
+      simde_mm_set_pi16(0x2035, 0x76b8, 0x8f6b, 0x088d) },
+    { simde_mm_set_pi16(0xcd1b, 0x7fa4, 0xa9cd, 0xfa3f),
+      simde_mm_set_pi16(0x1004, 0x39f1, 0x268e, 0x3bb9),
+      simde_mm_set_pi16(0x29ed, 0x152b, 0xb289, 0x5072) },
+    { simde_mm_set_pi16(0x4da9, 0xf0b5, 0xe299, 0x2ba6),
+      simde_mm_set_pi16(0x244c, 0x7ef9, 0xfda7, 0xfd61),
+      simde_mm_set_pi16(0x5aad, 0xffba, 0xa30c, 0x490d) },
+    { simde_mm_set_pi16(0x43c3, 0xe136, 0xbb04, 0xf7f9),
+      simde_mm_set_pi16(0xf6ec, 0xf7a6, 0xfdae, 0xc717),
+      simde_mm_set_pi16(0x00ba, 0xc969, 0x9d73, 0x3cf5) },
+    { simde_mm_set_pi16(0xb633, 0xcaa4, 0x09e3, 0xf7c1),
+      simde_mm_set_pi16(0x91b8, 0x15a2, 0x0435, 0x4b6d),
+      simde_mm_set_pi16(0x83ea, 0x4738, 0x1471, 0xedde) },
+    { simde_mm_set_pi16(0xae1e, 0xfcde, 0x16fe, 0x0772),
+      simde_mm_set_pi16(0x351c, 0xf91a, 0xde35, 0x295f),
+      simde_mm_set_pi16(0xc3fe, 0x4b2a, 0x4ec0, 0xf074) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_hsub_pi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hsub_pi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi32(0xc494dd82, 0x5a06b6bc),
+      simde_mm_set_pi32(0x667c5ee8, 0x236431a5),
+      simde_mm_set_pi32(0xbce7d2bd, 0x9571d93a) },
+    { simde_mm_set_pi32(0xaf3b8d78, 0x5e7f193d),
+      simde_mm_set_pi32(0x48473468, 0x3311f1f5),
+      simde_mm_set_pi32(0xeacabd8d, 0xaf438bc5) },
+    { simde_mm_set_pi32(0x2bdef0c7, 0x02e9cba6),
+      simde_mm_set_pi32(0x33825460, 0x705f7a47),
+      simde_mm_set_pi32(0x3cdd25e7, 0xd70adadf) },
+    { simde_mm_set_pi32(0xcc106962, 0xdf42169e),
+      simde_mm_set_pi32(0x8fb60b58, 0x1399114c),
+      simde_mm_set_pi32(0x83e305f4, 0x1331ad3c) },
+    { simde_mm_set_pi32(0x82909e5f, 0x7ffd2a54),
+      simde_mm_set_pi32(0x278ccbbb, 0x1e614e0d),
+      simde_mm_set_pi32(0xf6d48252, 0xfd6c8bf5) },
+    { simde_mm_set_pi32(0x4277e586, 0xef5d7b1f),
+      simde_mm_set_pi32(0xf8358a83, 0x0d3ef8c0),
+      simde_mm_set_pi32(0x15096e3d, 0xace59599) },
+    { simde_mm_set_pi32(0xa0474dda, 0xb6136a4e),
+      simde_mm_set_pi32(0x38c7d3e7, 0xb0d17e0d),
+      simde_mm_set_pi32(0x7809aa26, 0x15cc1c74) },
+    { simde_mm_set_pi32(0x6ffb42de, 0x3d944077),
+      simde_mm_set_pi32(0x09d4d04a, 0x6be27eec),
+      simde_mm_set_pi32(0x620daea2, 0xcd98fd99) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_hsub_pi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hsubs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 32767,   9113,  32767,  32767, INT16_MIN,  28159,   1050,  21351),
+      simde_mm_set_epi16( 20984,      0, -16479, INT16_MIN,      0,      0,  22320,  10387),
+      simde_mm_set_epi16(-20984, -16289,      0, -11933, -23654,      0,  32767,  20301) },
+    { simde_mm_set_epi16( 30799,   5360,  -3468,  17750,  28235,   5007, INT16_MIN,      0),
+      simde_mm_set_epi16( 31412, INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN,  27506,   9012,  29906),
+      simde_mm_set_epi16(INT16_MIN,      0,  32767,  20894, -25439,  21218, -23228,  32767) },
+    { simde_mm_set_epi16( 32651,   3583,      0,  20914,  32767,  24761,  10310, -22099),
+      simde_mm_set_epi16(  8733, -10414,      0,      0,  12448, INT16_MIN, INT16_MIN, INT16_MIN),
+      simde_mm_set_epi16(-19147,      0, INT16_MIN,      0, -29068,  20914,  -8006, -32409) },
+    { simde_mm_set_epi16(INT16_MIN,  32767,  18292, -31165, -24651, -25745,  -7548,  32767),
+      simde_mm_set_epi16(-22975, -13625,   5273,  32767,  28927, -11996,  18676,   2343),
+      simde_mm_set_epi16(  9350,  27494, INT16_MIN, -16333,  32767, INT16_MIN,  -1094,  32767) },
+    { simde_mm_set_epi16( 32767,  28212,      0,  14264, -22197,  32767,      0,   1712),
+      simde_mm_set_epi16( 27253,   2692, -12791,  22299,  31380, INT16_MIN,  32767,  16564),
+      simde_mm_set_epi16(-24561,  32767, INT16_MIN, -16203,  -4555,  14264,  32767,   1712) },
+    { simde_mm_set_epi16( -4999,  29215,  19260,  30059,      0, INT16_MIN, -19644, -11616),
+      simde_mm_set_epi16(     0,   7169, -12751,  24091,  14046, -28909,      0,      0),
+      simde_mm_set_epi16(  7169,  32767, INT16_MIN,      0,  32767,  10799, INT16_MIN,   8028) },
+    { simde_mm_set_epi16( -6383,      0, INT16_MIN,  -5196,  18687,  19309,     63, -12363),
+      simde_mm_set_epi16( 22323,  32767, -11527,  32767, INT16_MIN, -17155,  -6325, INT16_MIN),
+      simde_mm_set_epi16( 10444,  32767,  15613, -26443,   6383,  27572,    622, -12426) },
+    { simde_mm_set_epi16( 32767,      0, INT16_MIN,      0,  -6106, INT16_MIN, -26567,  32767),
+      simde_mm_set_epi16(-19991, -16630,      0,  17866, INT16_MIN,  15716, -31906, INT16_MIN),
+      simde_mm_set_epi16(  3361,  17866,  32767,   -862, -32767,  32767, -26662,  32767) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_hsubs_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_hsubs_pi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi16(0x6b20, 0x2354, 0x106a, 0x2da3),
+      simde_mm_set_pi16(0x0dcb, 0x7d2f, 0xa10d, 0x24b9),
+      simde_mm_set_pi16(0x6f64, 0x7fff, 0xb834, 0x1d39) },
+    { simde_mm_set_pi16(0xd526, 0xf669, 0xd204, 0x27ee),
+      simde_mm_set_pi16(0x3b7b, 0x1073, 0xe45c, 0x3a27),
+      simde_mm_set_pi16(0xd4f8, 0x55cb, 0x2143, 0x55ea) },
+    { simde_mm_set_pi16(0x7e88, 0xa5a1, 0x9908, 0x2ad0),
+      simde_mm_set_pi16(0x1831, 0xd92b, 0x72e7, 0x1068),
+      simde_mm_set_pi16(0xc0fa, 0x9d81, 0x8000, 0x7fff) },
+    { simde_mm_set_pi16(0x8b88, 0xc739, 0x54a3, 0x5359),
+      simde_mm_set_pi16(0xdc91, 0xf1ca, 0xd280, 0xaa04),
+      simde_mm_set_pi16(0x1539, 0xd784, 0x3bb1, 0xfeb6) },
+    { simde_mm_set_pi16(0x3fc2, 0x5b22, 0x2ca3, 0xde58),
+      simde_mm_set_pi16(0x88cf, 0xfb04, 0x936a, 0xb46f),
+      simde_mm_set_pi16(0x7235, 0x2105, 0x1b60, 0xb1b5) },
+    { simde_mm_set_pi16(0x2e0f, 0x7fd7, 0x1a61, 0x61b7),
+      simde_mm_set_pi16(0xb267, 0x8484, 0xc013, 0xa06e),
+      simde_mm_set_pi16(0xd21d, 0xe05b, 0x51c8, 0x4756) },
+    { simde_mm_set_pi16(0x4e51, 0x24cf, 0xdd41, 0x862a),
+      simde_mm_set_pi16(0xb392, 0x4ee8, 0x5a93, 0x6500),
+      simde_mm_set_pi16(0x7fff, 0x0a6d, 0xd67e, 0xa8e9) },
+    { simde_mm_set_pi16(0xd652, 0x40c8, 0x788e, 0x1a20),
+      simde_mm_set_pi16(0xb5f9, 0x7fce, 0xbbe1, 0xfede),
+      simde_mm_set_pi16(0x7fff, 0x42fd, 0x6a76, 0xa192) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_hsubs_pi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maddubs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( 11280,   6213, -25742,   8168,    -15,  18249,   1243,  13100),
+      simde_mm_set_epi16(-10433,  11011,  23771,  27302,  31213,  -8689, -21546, -30089),
+      simde_mm_set_epi16(  -796,   1239,  10042, -17594,  26276,  -1319,  -9538,   -782) },
+    { simde_mm_set_epi16(  -677, -30863,  -1443,  20637,  25398,  18443,  -1692,  18701),
+      simde_mm_set_epi16(  7990, -22173,  20018,  -4822,    527,  -5710,    731, -23178),
+      simde_mm_set_epi16( 12757,   -558,  24150,   5074,   1008,  -2514,  -3202,  -5109) },
+    { simde_mm_set_epi16( 28963,  29362,  26140,   -411,   6958,  21693, -26023,  22015),
+      simde_mm_set_epi16(-16069, -16876,   9725, -23182, -19167,  28289,  27032, -23768),
+      simde_mm_set_epi16( -5054,  -3964,   3690, -11600,   -507, -14763,   6914,   2295) },
+    { simde_mm_set_epi16( -2013,  21112, -20041,   2245, -23116,  -1590,  -7068,  13630),
+      simde_mm_set_epi16(  2253,  -5717, -17933,   6972,   8533,   1975, -26360, -29028),
+      simde_mm_set_epi16(   199, -12086, -14946,  12036,  20745, -13003, -22684, -12242) },
+    { simde_mm_set_epi16(-29567,  -3389,  -9486, -17345, -27655,   4108,  12870, -22716),
+      simde_mm_set_epi16( 15009,  21838, -19482, -15393,  -4137,  -3988, -25851, -11440),
+      simde_mm_set_epi16( -4135,  32767, -23078, -13547, -12708,   1040,  -4700,  -2075) },
+    { simde_mm_set_epi16( 14002,  20537,  -4259,  18846,     44, -21233,  10679,  32340),
+      simde_mm_set_epi16(  3672,  15397, -21364,  -5531, -15030,  30924,  25137,  21203),
+      simde_mm_set_epi16( 16420,   6909, -30864,  14352,   3256,  19980,  12985,   6552) },
+    { simde_mm_set_epi16(-26728,   8595,  -3339,   1268, -15251, -23673,  27756,   3776),
+      simde_mm_set_epi16(  8729,  21749,  25369,  -4621, -11348, -19087,   2975,   7943),
+      simde_mm_set_epi16(  8934,   1155,  30083,  -3248, -17976,   3030,  -9288,   1778) },
+    { simde_mm_set_epi16(-27263, -29872,  21046,  -3956, -16952,    761,   -637,  28933),
+      simde_mm_set_epi16( -2450, -22803,  12586,  20748,  -6078,  26880, -23987,   2484),
+      simde_mm_set_epi16( 12700, -14030,   6286,  21120,   8664,    210, -13695,    637) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_maddubs_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maddubs_pi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi16(0xa116, 0xe14d, 0xb0b5, 0x70ca),
+      simde_mm_set_pi16(0x807f, 0x043f, 0xb4e4, 0xd4f4),
+      simde_mm_set_pi16(0xba6a, 0x1677, 0xb7f4, 0xe348) },
+    { simde_mm_set_pi16(0x021e, 0x0e88, 0x0d1c, 0x2d5a),
+      simde_mm_set_pi16(0xe254, 0x6b65, 0x546a, 0x2c9c),
+      simde_mm_set_pi16(0x099c, 0x3b82, 0x0fdc, 0xe494) },
+    { simde_mm_set_pi16(0x247f, 0xe128, 0x30ad, 0xe5b7),
+      simde_mm_set_pi16(0xeb52, 0x5968, 0x0adf, 0x7250),
+      simde_mm_set_pi16(0x25ba, 0x5e79, 0xeb93, 0x7fff) },
+    { simde_mm_set_pi16(0xd051, 0x7fa2, 0x0acf, 0x8f38),
+      simde_mm_set_pi16(0x79e7, 0x97be, 0x8894, 0x4745),
+      simde_mm_set_pi16(0x5a67, 0xa225, 0xa3fc, 0x36c1) },
+    { simde_mm_set_pi16(0x79c3, 0xee99, 0xbc25, 0x343c),
+      simde_mm_set_pi16(0x54cb, 0x9204, 0xc17c, 0xe689),
+      simde_mm_set_pi16(0xff55, 0x9c20, 0xe3a8, 0xded4) },
+    { simde_mm_set_pi16(0x198d, 0x86d3, 0xd2cf, 0xa451),
+      simde_mm_set_pi16(0x2f03, 0x3449, 0x394e, 0xa08f),
+      simde_mm_set_pi16(0x063e, 0x5763, 0x6dd4, 0x9ebf) },
+    { simde_mm_set_pi16(0x1c84, 0x11e2, 0xf5c6, 0x78a9),
+      simde_mm_set_pi16(0xac17, 0xa85c, 0x0fa6, 0x3584),
+      simde_mm_set_pi16(0x02ac, 0x4b60, 0xc8bf, 0xc6fc) },
+    { simde_mm_set_pi16(0x6566, 0xda13, 0xa9ba, 0xc291),
+      simde_mm_set_pi16(0xec12, 0x3986, 0xc3ec, 0x9dd4),
+      simde_mm_set_pi16(0xff48, 0x277c, 0xc933, 0x9c0e) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_maddubs_pi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mulhrs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16( -4009,  32767,      0,  32767,  22790, -27262,  18965,      0),
+      simde_mm_set_epi16(-22926,  27640, -26145, -28844, INT16_MIN,  32767,  25924,  28407),
+      simde_mm_set_epi16(  2805,  27639,      0, -28843, -22790, -27261,  15004,      0) },
+    { simde_mm_set_epi16( 32619,  32767, INT16_MIN, INT16_MIN,   8044,  23174,  32767,      0),
+      simde_mm_set_epi16(-21255,  11724, INT16_MIN,      0, -26584,    121, -18120,  17009),
+      simde_mm_set_epi16(-21158,  11724, INT16_MIN,      0,  -6526,     86, -18119,      0) },
+    { simde_mm_set_epi16(     0,  19973,  25877,   5057, -16224,  -1767, INT16_MIN,  -7409),
+      simde_mm_set_epi16(-20256,      0,  18411, -15276,      0,  -2525,      0,      0),
+      simde_mm_set_epi16(     0,      0,  14539,  -2358,      0,    136,      0,      0) },
+    { simde_mm_set_epi16(INT16_MIN,  32767,  32767,    578,  32767, INT16_MIN,  -5686,   1010),
+      simde_mm_set_epi16(-30431,  14992,   5450,  10826, -25741,  32767,   4000,      0),
+      simde_mm_set_epi16( 30431,  14992,   5450,    191, -25740, -32767,   -694,      0) },
+    { simde_mm_set_epi16(-29527, INT16_MIN,  26785,      0,  -8281,   -782, -26629, INT16_MIN),
+      simde_mm_set_epi16(INT16_MIN,  32767,      0, -24007, -12587,  -8749,  32767,      0),
+      simde_mm_set_epi16( 29527, -32767,      0,      0,   3181,    209, -26628,      0) },
+    { simde_mm_set_epi16( -1738,  22483,  -8961,  -4788,  27235,  28352,  32767,  32767),
+      simde_mm_set_epi16( 20700,      0,      0, INT16_MIN,  32767,  29964,   1763,   9091),
+      simde_mm_set_epi16( -1098,      0,      0,   4788,  27234,  25926,   1763,   9091) },
+    { simde_mm_set_epi16( -4157,  32767,      0,      0, -19465,   9585,   6820,   9737),
+      simde_mm_set_epi16( -8916,   7950,  12650,  -8869, -10955,  32537, INT16_MIN,  22012),
+      simde_mm_set_epi16(  1131,   7950,      0,      0,   6508,   9517,  -6820,   6541) },
+    { simde_mm_set_epi16(-23726,  27174,  32614,  26516,  -6249, -21555,  15282,  28762),
+      simde_mm_set_epi16( -9476,      0,      0,   -118,  31858,  27120,   3316, INT16_MIN),
+      simde_mm_set_epi16(  6861,      0,      0,    -95,  -6075, -17840,   1546, -28762) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mulhrs_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mulhrs_pi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi16(0x90c9, 0x9e2c, 0xa56e, 0x5834),
+      simde_mm_set_pi16(0x1e1f, 0x28c9, 0x5d9a, 0xb361),
+      simde_mm_set_pi16(0xe5d4, 0xe0d4, 0xbdc5, 0xcb34) },
+    { simde_mm_set_pi16(0x41fd, 0xa190, 0xeb04, 0x0024),
+      simde_mm_set_pi16(0x8be4, 0x4ccb, 0x2ab5, 0xcda8),
+      simde_mm_set_pi16(0xc424, 0xc758, 0xf900, 0xfff2) },
+    { simde_mm_set_pi16(0x3ebc, 0x492d, 0x95a5, 0xfbc1),
+      simde_mm_set_pi16(0x4703, 0x07ff, 0x2d29, 0x8c1d),
+      simde_mm_set_pi16(0x22ce, 0x0492, 0xda7a, 0x03d8) },
+    { simde_mm_set_pi16(0x2692, 0xd45a, 0x9ee7, 0x2491),
+      simde_mm_set_pi16(0x98a5, 0x1f32, 0x7317, 0xefc1),
+      simde_mm_set_pi16(0xe0db, 0xf55d, 0xa8b2, 0xfb5c) },
+    { simde_mm_set_pi16(0x407b, 0x5a66, 0x0aa3, 0x1a51),
+      simde_mm_set_pi16(0xa839, 0xb5c7, 0xfd78, 0x5f00),
+      simde_mm_set_pi16(0xd3c8, 0xcb95, 0xffca, 0x1388) },
+    { simde_mm_set_pi16(0x05a2, 0x6bb3, 0x6df6, 0x0e0b),
+      simde_mm_set_pi16(0x2915, 0xbd15, 0x5b38, 0x003d),
+      simde_mm_set_pi16(0x01cf, 0xc7b2, 0x4e5d, 0x0007) },
+    { simde_mm_set_pi16(0x2c41, 0x8c72, 0x32a6, 0x2f17),
+      simde_mm_set_pi16(0x8491, 0xcbd1, 0x67a7, 0xda43),
+      simde_mm_set_pi16(0xd553, 0x2f1c, 0x2904, 0xf21e) },
+    { simde_mm_set_pi16(0x4c1c, 0x3dc1, 0x4f33, 0x5b2a),
+      simde_mm_set_pi16(0xd971, 0xff89, 0xb675, 0x6bb2),
+      simde_mm_set_pi16(0xe913, 0xffc7, 0xd27f, 0x4cb4) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_mulhrs_pi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_shuffle_pi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi8(0x94, 0xf2, 0xc4, 0x0f, 0xb7, 0x61, 0x7b, 0x6f),
+      simde_mm_set_pi8(0xc5, 0x43, 0x18, 0xdb, 0x35, 0x38, 0x97, 0xd2),
+      simde_mm_set_pi8(0x00, 0xb7, 0x6f, 0x00, 0xc4, 0x6f, 0x00, 0x00) },
+    { simde_mm_set_pi8(0xb3, 0xbf, 0x69, 0x51, 0x4e, 0x49, 0xc9, 0x06),
+      simde_mm_set_pi8(0x06, 0xe2, 0xfe, 0x56, 0xb0, 0x7d, 0x61, 0x69),
+      simde_mm_set_pi8(0xbf, 0x00, 0x00, 0xbf, 0x00, 0x69, 0xc9, 0xc9) },
+    { simde_mm_set_pi8(0x70, 0x6a, 0x2c, 0x23, 0x53, 0x40, 0x84, 0x78),
+      simde_mm_set_pi8(0x9e, 0xcd, 0xf7, 0x6a, 0x9d, 0xa2, 0xd5, 0xb3),
+      simde_mm_set_pi8(0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00) },
+    { simde_mm_set_pi8(0x5c, 0xaf, 0x3b, 0xb0, 0x63, 0xdd, 0x9e, 0xdb),
+      simde_mm_set_pi8(0x80, 0x05, 0x98, 0x29, 0x52, 0xf4, 0x8d, 0xc7),
+      simde_mm_set_pi8(0x00, 0x3b, 0x00, 0x9e, 0xdd, 0x00, 0x00, 0x00) },
+    { simde_mm_set_pi8(0x7e, 0x9a, 0xcb, 0xe0, 0x6e, 0xd0, 0x8b, 0x0c),
+      simde_mm_set_pi8(0xea, 0xce, 0x60, 0x6c, 0xab, 0xe6, 0x2c, 0x3a),
+      simde_mm_set_pi8(0x00, 0x00, 0x0c, 0xe0, 0x00, 0x00, 0xe0, 0xd0) },
+    { simde_mm_set_pi8(0xbc, 0x3a, 0x6b, 0xd9, 0xc6, 0x7c, 0x55, 0xf7),
+      simde_mm_set_pi8(0xed, 0x10, 0x51, 0x3d, 0xd4, 0x2b, 0x60, 0x03),
+      simde_mm_set_pi8(0x00, 0xf7, 0x55, 0x6b, 0x00, 0xc6, 0xf7, 0xc6) },
+    { simde_mm_set_pi8(0xaa, 0x4a, 0xa6, 0xb0, 0x93, 0x22, 0x33, 0xe5),
+      simde_mm_set_pi8(0xa1, 0x64, 0x60, 0x6a, 0x3f, 0xc7, 0x22, 0xf2),
+      simde_mm_set_pi8(0x00, 0xb0, 0xe5, 0x22, 0xaa, 0x00, 0x22, 0x00) },
+    { simde_mm_set_pi8(0xc8, 0xc5, 0x23, 0x57, 0xa6, 0x4f, 0x63, 0x42),
+      simde_mm_set_pi8(0x31, 0xca, 0x47, 0xb2, 0xda, 0x79, 0x51, 0x3d),
+      simde_mm_set_pi8(0x63, 0x00, 0xc8, 0x00, 0x00, 0x63, 0x63, 0x23) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_shuffle_pi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sign_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(0xff, 0xe7, 0xd9, 0x63, 0xb9, 0x37, 0xff, 0xc0,
+			0x63, 0xf2, 0x2d, 0x3a, 0x89, 0x86, 0x5d, 0x37),
+      simde_mm_set_epi8(0x6a, 0x40, 0xdf, 0x4f, 0x8e, 0x58, 0x28, 0x0d,
+			0xbe, 0x0b, 0x73, 0x1a, 0x72, 0x95, 0x99, 0x0e),
+      simde_mm_set_epi8(0xff, 0xe7, 0x27, 0x63, 0x47, 0x37, 0xff, 0xc0,
+			0x9d, 0xf2, 0x2d, 0x3a, 0x89, 0x7a, 0xa3, 0x37) },
+    { simde_mm_set_epi8(0x08, 0x06, 0x97, 0x3b, 0x84, 0x08, 0x7e, 0x18,
+			0x77, 0x33, 0x71, 0x8e, 0xb5, 0x1f, 0x0b, 0xb9),
+      simde_mm_set_epi8(0x25, 0xa0, 0x5a, 0x5b, 0x4b, 0x23, 0x7e, 0x98,
+			0xdc, 0xb1, 0x6c, 0x9a, 0x7d, 0x32, 0x30, 0x55),
+      simde_mm_set_epi8(0x08, 0xfa, 0x97, 0x3b, 0x84, 0x08, 0x7e, 0xe8,
+			0x89, 0xcd, 0x71, 0x72, 0xb5, 0x1f, 0x0b, 0xb9) },
+    { simde_mm_set_epi8(0x21, 0xd4, 0x2a, 0xad, 0xf9, 0x52, 0x77, 0x9d,
+			0x53, 0x3e, 0x69, 0x23, 0x4a, 0xe2, 0xfa, 0xde),
+      simde_mm_set_epi8(0xb9, 0x2f, 0xc1, 0x71, 0x15, 0x79, 0xc8, 0x15,
+			0xbb, 0x8e, 0x22, 0x80, 0x79, 0xa1, 0x65, 0x12),
+      simde_mm_set_epi8(0xdf, 0xd4, 0xd6, 0xad, 0xf9, 0x52, 0x89, 0x9d,
+			0xad, 0xc2, 0x69, 0xdd, 0x4a, 0x1e, 0xfa, 0xde) },
+    { simde_mm_set_epi8(0x47, 0xef, 0x31, 0x40, 0xd4, 0x21, 0x7a, 0x54,
+			0xc9, 0x2d, 0xf6, 0xa7, 0x4f, 0x5c, 0x9c, 0xd1),
+      simde_mm_set_epi8(0xf1, 0xa6, 0xda, 0x4c, 0x40, 0x14, 0x93, 0x2d,
+			0x09, 0x0c, 0x26, 0xc4, 0xa9, 0x79, 0x58, 0xf9),
+      simde_mm_set_epi8(0xb9, 0x11, 0xcf, 0x40, 0xd4, 0x21, 0x86, 0x54,
+			0xc9, 0x2d, 0xf6, 0x59, 0xb1, 0x5c, 0x9c, 0x2f) },
+    { simde_mm_set_epi8(0xa7, 0x05, 0x7b, 0xf8, 0xaf, 0x3e, 0xbb, 0x7a,
+			0x1d, 0x68, 0x6b, 0x86, 0x1a, 0x8e, 0xd7, 0xf5),
+      simde_mm_set_epi8(0x6b, 0xe8, 0x14, 0xb4, 0x18, 0xbb, 0x85, 0x6d,
+			0xa6, 0xe8, 0x2c, 0xa0, 0xcf, 0x44, 0x16, 0xd7),
+      simde_mm_set_epi8(0xa7, 0xfb, 0x7b, 0x08, 0xaf, 0xc2, 0x45, 0x7a,
+			0xe3, 0x98, 0x6b, 0x7a, 0xe6, 0x8e, 0xd7, 0x0b) },
+    { simde_mm_set_epi8(0x11, 0x22, 0x75, 0x5c, 0xf9, 0x0e, 0x98, 0xb4,
+			0x12, 0xc8, 0xe9, 0x83, 0xc9, 0x08, 0xe4, 0x0d),
+      simde_mm_set_epi8(0xf3, 0x7b, 0x39, 0x8b, 0x9f, 0x1e, 0xc7, 0x50,
+			0x08, 0xec, 0xe8, 0x02, 0xf0, 0xb8, 0x27, 0x63),
+      simde_mm_set_epi8(0xef, 0x22, 0x75, 0xa4, 0x07, 0x0e, 0x68, 0xb4,
+			0x12, 0x38, 0x17, 0x83, 0x37, 0xf8, 0xe4, 0x0d) },
+    { simde_mm_set_epi8(0xcc, 0xa2, 0x76, 0x2e, 0xa8, 0x61, 0xc2, 0x3b,
+			0x4e, 0x0e, 0x22, 0x78, 0xc6, 0xd6, 0x6f, 0x99),
+      simde_mm_set_epi8(0x64, 0x96, 0xf1, 0x31, 0xaf, 0xce, 0x96, 0x6d,
+			0x56, 0x64, 0x8b, 0xd1, 0xee, 0x4a, 0x22, 0xd1),
+      simde_mm_set_epi8(0xcc, 0x5e, 0x8a, 0x2e, 0x58, 0x9f, 0x3e, 0x3b,
+			0x4e, 0x0e, 0xde, 0x88, 0x3a, 0xd6, 0x6f, 0x67) },
+    { simde_mm_set_epi8(0xec, 0xa5, 0xe8, 0xe4, 0x6f, 0x99, 0x28, 0x0f,
+			0x7e, 0xdc, 0x65, 0xac, 0x93, 0xf4, 0xd8, 0x0c),
+      simde_mm_set_epi8(0x72, 0x13, 0x60, 0xca, 0x72, 0x12, 0xaf, 0x0e,
+			0x53, 0xb2, 0xa0, 0x5d, 0x10, 0x2e, 0xfb, 0x58),
+      simde_mm_set_epi8(0xec, 0xa5, 0xe8, 0x1c, 0x6f, 0x99, 0xd8, 0x0f,
+			0x7e, 0x24, 0x9b, 0xac, 0x93, 0xf4, 0x28, 0x0c) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sign_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sign_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi16(  6665, -15217,      0,  -6717,  26489,   9290, INT16_MIN,   7060),
+      simde_mm_set_epi16( -9137,  32767,      0, -24688, -27972,      0, -32517,   2020),
+      simde_mm_set_epi16( -6665, -15217,      0,   6717, -26489,      0, INT16_MIN,   7060) },
+    { simde_mm_set_epi16(INT16_MIN,      0,  29324, -27903,      0,  22906,      0, -20423),
+      simde_mm_set_epi16( 17333, INT16_MIN,  19386,  31505,      0, INT16_MIN, INT16_MIN,  16423),
+      simde_mm_set_epi16(INT16_MIN,      0,  29324, -27903,      0, -22906,      0, -20423) },
+    { simde_mm_set_epi16(-26656, INT16_MIN,      0,  25452,  23432, -21048,  10113,  20806),
+      simde_mm_set_epi16( 15661,   9217,  -7552,  -1181,  -1188, INT16_MIN,  28955,  32767),
+      simde_mm_set_epi16(-26656, INT16_MIN,      0, -25452, -23432,  21048,  10113,  20806) },
+    { simde_mm_set_epi16( 32317,  22366,  -2476,  20551,      0, INT16_MIN, -26423,  32767),
+      simde_mm_set_epi16(-21082,  10590, -23758,  32767, -28989, -23495,  32767,  32767),
+      simde_mm_set_epi16(-32317,  22366,   2476,  20551,      0, INT16_MIN, -26423,  32767) },
+    { simde_mm_set_epi16(-29898, -18608,      0, INT16_MIN,   7352, -10910,  32767,  14033),
+      simde_mm_set_epi16(-15453,  19195, -15395,  32767,  18580,      0,  27462,  32767),
+      simde_mm_set_epi16( 29898, -18608,      0, INT16_MIN,   7352,      0,  32767,  14033) },
+    { simde_mm_set_epi16( -3926,  12266,   7582,   2075,   6198,  26644,      0,    702),
+      simde_mm_set_epi16(     0,      0,  12979,   8301, -15896,  -9718, INT16_MIN, -20880),
+      simde_mm_set_epi16(     0,      0,   7582,   2075,  -6198, -26644,      0,   -702) },
+    { simde_mm_set_epi16( 32767,   6095,      0, INT16_MIN, -25676,  24726, INT16_MIN,   5691),
+      simde_mm_set_epi16( -7452,  10682,  19897, -31766,  32767,  15811,  -7047,      0),
+      simde_mm_set_epi16(-32767,   6095,      0, INT16_MIN, -25676,  24726, INT16_MIN,      0) },
+    { simde_mm_set_epi16(  2420, -25738,      0,      0,   2126,  -2494, -27317,   2396),
+      simde_mm_set_epi16(  5468, -23497, -15175,  18126, -32570, -30259, -11337,  26955),
+      simde_mm_set_epi16(  2420,  25738,      0,      0,  -2126,   2494,  27317,   2396) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sign_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sign_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32( -781035170,  -160792973,   542373528, -1501324303),
+      simde_mm_set_epi32(  549211600, -1294692364, -2136824736,   155456885),
+      simde_mm_set_epi32( -781035170,   160792973,  -542373528, -1501324303) },
+    { simde_mm_set_epi32(-2072893604, -1017928367, -1558514121,  1714969155),
+      simde_mm_set_epi32( 1456788133,   300518782, -1518255743,  -823692828),
+      simde_mm_set_epi32(-2072893604, -1017928367,  1558514121, -1714969155) },
+    { simde_mm_set_epi32( -559993390,   257435853,   823312866,   533823840),
+      simde_mm_set_epi32(-1186270200,   372491567,  -992819779,   473474418),
+      simde_mm_set_epi32(  559993390,   257435853,  -823312866,   533823840) },
+    { simde_mm_set_epi32(-1810042416, -2045017758, -1771334580, -1056409535),
+      simde_mm_set_epi32( -838787753,   629321661, -1432855493,   -91147074),
+      simde_mm_set_epi32( 1810042416, -2045017758,  1771334580,  1056409535) },
+    { simde_mm_set_epi32(  600785256,   583345274,   750738023,  1639623021),
+      simde_mm_set_epi32( 2002839556,  1853892344,  -555078374,  -955023658),
+      simde_mm_set_epi32(  600785256,   583345274,  -750738023, -1639623021) },
+    { simde_mm_set_epi32( 1263289671,  1441836297,  -946074643,  1410483439),
+      simde_mm_set_epi32( 1654914084,  1370109101, -1923257446,  -892758851),
+      simde_mm_set_epi32( 1263289671,  1441836297,   946074643, -1410483439) },
+    { simde_mm_set_epi32(-1549912529,  -929089595,   272802303, -1288626558),
+      simde_mm_set_epi32(  112439384,  1049018777,   913392991,  -842716325),
+      simde_mm_set_epi32(-1549912529,  -929089595,   272802303,  1288626558) },
+    { simde_mm_set_epi32(-2084115334,  1914797412,  1926335414,  2131478485),
+      simde_mm_set_epi32( 1855956125,  1547074615, -1531202366,  1095039945),
+      simde_mm_set_epi32(-2084115334,  1914797412, -1926335414,  2131478485) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sign_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sign_pi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi8(0x6c, 0xa7, 0x2a, 0x6a, 0x9f, 0x9e, 0xd7, 0xe3),
+      simde_mm_set_pi8(0x14, 0x23, 0x9a, 0x7d, 0x4c, 0x1c, 0x52, 0xbb),
+      simde_mm_set_pi8(0x6c, 0xa7, 0xd6, 0x6a, 0x9f, 0x9e, 0xd7, 0x1d) },
+    { simde_mm_set_pi8(0xc3, 0xbc, 0xb5, 0x07, 0x1b, 0xcc, 0xf7, 0xb1),
+      simde_mm_set_pi8(0xc9, 0x5f, 0x87, 0x2d, 0x22, 0xf6, 0xfc, 0xdf),
+      simde_mm_set_pi8(0x3d, 0xbc, 0x4b, 0x07, 0x1b, 0x34, 0x09, 0x4f) },
+    { simde_mm_set_pi8(0x54, 0x9c, 0x4f, 0x3f, 0xbc, 0x21, 0xe2, 0xee),
+      simde_mm_set_pi8(0x18, 0x70, 0xed, 0xde, 0xd9, 0x6f, 0xab, 0x75),
+      simde_mm_set_pi8(0x54, 0x9c, 0xb1, 0xc1, 0x44, 0x21, 0x1e, 0xee) },
+    { simde_mm_set_pi8(0x52, 0xbf, 0x55, 0xf7, 0xc5, 0xeb, 0xc2, 0x53),
+      simde_mm_set_pi8(0xf6, 0xea, 0x1d, 0x66, 0x16, 0xc4, 0x22, 0x7c),
+      simde_mm_set_pi8(0xae, 0x41, 0x55, 0xf7, 0xc5, 0x15, 0xc2, 0x53) },
+    { simde_mm_set_pi8(0x88, 0x61, 0x7d, 0x15, 0x5a, 0x5e, 0x62, 0x85),
+      simde_mm_set_pi8(0x7f, 0xb6, 0x56, 0xee, 0x0c, 0xd0, 0x12, 0xda),
+      simde_mm_set_pi8(0x88, 0x9f, 0x7d, 0xeb, 0x5a, 0xa2, 0x62, 0x7b) },
+    { simde_mm_set_pi8(0x3b, 0x48, 0xcc, 0x6b, 0x9b, 0x70, 0xff, 0x46),
+      simde_mm_set_pi8(0x1b, 0xe3, 0x65, 0xa5, 0xd3, 0x0f, 0xf8, 0x09),
+      simde_mm_set_pi8(0x3b, 0xb8, 0xcc, 0x95, 0x65, 0x70, 0x01, 0x46) },
+    { simde_mm_set_pi8(0x43, 0x8b, 0x29, 0x14, 0x3c, 0xaf, 0x6c, 0x95),
+      simde_mm_set_pi8(0x8d, 0xf2, 0x5c, 0x16, 0xd1, 0xa9, 0x22, 0x6c),
+      simde_mm_set_pi8(0xbd, 0x75, 0x29, 0x14, 0xc4, 0x51, 0x6c, 0x95) },
+    { simde_mm_set_pi8(0xc2, 0x07, 0x5c, 0x42, 0x99, 0x49, 0x3a, 0xca),
+      simde_mm_set_pi8(0xf8, 0x0c, 0xf9, 0x44, 0x30, 0xb5, 0x26, 0x3b),
+      simde_mm_set_pi8(0x3e, 0x07, 0xa4, 0x42, 0x99, 0xb7, 0x3a, 0xca) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_sign_pi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sign_pi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi16(0x35e0, 0xe4f1, 0x573d, 0xc40a),
+      simde_mm_set_pi16(0x8518, 0x71cf, 0xf9e5, 0xfb3d),
+      simde_mm_set_pi16(0xca20, 0xe4f1, 0xa8c3, 0x3bf6) },
+    { simde_mm_set_pi16(0xfb0f, 0x2d34, 0x5c62, 0xb52d),
+      simde_mm_set_pi16(0x6945, 0xb285, 0x3408, 0x82c5),
+      simde_mm_set_pi16(0xfb0f, 0xd2cc, 0x5c62, 0x4ad3) },
+    { simde_mm_set_pi16(0xfa60, 0x82f8, 0xe14e, 0x37a2),
+      simde_mm_set_pi16(0x5a62, 0xa3ad, 0x98bd, 0xe4c5),
+      simde_mm_set_pi16(0xfa60, 0x7d08, 0x1eb2, 0xc85e) },
+    { simde_mm_set_pi16(0xaa93, 0xa3c5, 0xe4ec, 0x04a7),
+      simde_mm_set_pi16(0x9f35, 0xc08e, 0xcb0a, 0x25cc),
+      simde_mm_set_pi16(0x556d, 0x5c3b, 0x1b14, 0x04a7) },
+    { simde_mm_set_pi16(0x11a0, 0x3a9a, 0x2ddc, 0x4263),
+      simde_mm_set_pi16(0xa49c, 0x6be3, 0x8a9a, 0x079c),
+      simde_mm_set_pi16(0xee60, 0x3a9a, 0xd224, 0x4263) },
+    { simde_mm_set_pi16(0x67ed, 0x62b4, 0x51b3, 0x0325),
+      simde_mm_set_pi16(0xed8b, 0x6c5d, 0xb1fc, 0xc54e),
+      simde_mm_set_pi16(0x9813, 0x62b4, 0xae4d, 0xfcdb) },
+    { simde_mm_set_pi16(0x806f, 0x45ba, 0x1230, 0xba44),
+      simde_mm_set_pi16(0xc779, 0x9f5f, 0x72c3, 0x628c),
+      simde_mm_set_pi16(0x7f91, 0xba46, 0x1230, 0xba44) },
+    { simde_mm_set_pi16(0xd39c, 0x8c93, 0x436c, 0xe0eb),
+      simde_mm_set_pi16(0x5bb8, 0x8ca9, 0x16c1, 0x2570),
+      simde_mm_set_pi16(0xd39c, 0x736d, 0x436c, 0xe0eb) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_sign_pi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sign_pi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m64 a;
+    simde__m64 b;
+    simde__m64 r;
+  } test_vec[8] = {
+    { simde_mm_set_pi32(0xd7c46933, 0x5da9b017),
+      simde_mm_set_pi32(0xa69602d5, 0xd164e596),
+      simde_mm_set_pi32(0x283b96cd, 0xa2564fe9) },
+    { simde_mm_set_pi32(0xcf45189c, 0xb264e6f5),
+      simde_mm_set_pi32(0xe550d1ed, 0x4532a1ba),
+      simde_mm_set_pi32(0x30bae764, 0xb264e6f5) },
+    { simde_mm_set_pi32(0x3f1c5fdf, 0xbc3fc1d2),
+      simde_mm_set_pi32(0x0424f288, 0xc3997874),
+      simde_mm_set_pi32(0x3f1c5fdf, 0x43c03e2e) },
+    { simde_mm_set_pi32(0x56b9b10d, 0xb060dda8),
+      simde_mm_set_pi32(0x1f890ce5, 0x9fc47b7e),
+      simde_mm_set_pi32(0x56b9b10d, 0x4f9f2258) },
+    { simde_mm_set_pi32(0x55b549e3, 0x85114b3a),
+      simde_mm_set_pi32(0x864cf2ed, 0x00db9027),
+      simde_mm_set_pi32(0xaa4ab61d, 0x85114b3a) },
+    { simde_mm_set_pi32(0x4d87ebc4, 0x7a91384b),
+      simde_mm_set_pi32(0x11439082, 0x479d3ff0),
+      simde_mm_set_pi32(0x4d87ebc4, 0x7a91384b) },
+    { simde_mm_set_pi32(0xee734690, 0xe4d72bb3),
+      simde_mm_set_pi32(0x89233286, 0xf11885ce),
+      simde_mm_set_pi32(0x118cb970, 0x1b28d44d) },
+    { simde_mm_set_pi32(0xeecaa344, 0xb47fc5bc),
+      simde_mm_set_pi32(0x4938dd8e, 0xc540e908),
+      simde_mm_set_pi32(0xeecaa344, 0x4b803a44) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m64 r = simde_mm_sign_pi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m64_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitTest test_suite_tests[] = {
   { (char*) "/mm_alignr_epi8",      test_simde_mm_alignr_epi8,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
   { (char*) "/mm_shuffle_epi8",     test_simde_mm_shuffle_epi8,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_abs_epi8",         test_simde_mm_abs_epi8,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_abs_epi16",        test_simde_mm_abs_epi16,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_abs_epi32",        test_simde_mm_abs_epi32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_abs_pi8",          test_simde_mm_abs_pi8,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_abs_pi16",         test_simde_mm_abs_pi16,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_abs_pi32",         test_simde_mm_abs_pi32,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_alignr_pi8",       test_simde_mm_alignr_pi8,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hadd_epi16",       test_simde_mm_hadd_epi16,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hadd_epi32",       test_simde_mm_hadd_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hadd_pi16",        test_simde_mm_hadd_pi16,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hadd_pi32",        test_simde_mm_hadd_pi32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hadds_epi16",      test_simde_mm_hadds_epi16,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hadds_pi16",       test_simde_mm_hadds_pi16,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hsub_epi16",       test_simde_mm_hsub_epi16,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hsub_epi32",       test_simde_mm_hsub_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hsub_pi16",        test_simde_mm_hsub_pi16,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hsub_pi32",        test_simde_mm_hsub_pi32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hsubs_epi16",      test_simde_mm_hsubs_epi16,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_hsubs_pi16",       test_simde_mm_hsubs_pi16,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maddubs_epi16",    test_simde_mm_maddubs_epi16,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_maddubs_pi16",     test_simde_mm_maddubs_pi16,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_mulhrs_epi16",     test_simde_mm_mulhrs_epi16,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_mulhrs_pi16",      test_simde_mm_mulhrs_pi16,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_shuffle_pi8",      test_simde_mm_shuffle_pi8,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sign_epi8",        test_simde_mm_sign_epi8,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sign_epi16",       test_simde_mm_sign_epi16,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sign_epi32",       test_simde_mm_sign_epi32,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sign_pi8",         test_simde_mm_sign_pi8,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sign_pi16",        test_simde_mm_sign_pi16,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+  { (char*) "/mm_sign_pi32",        test_simde_mm_sign_pi32,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
   { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
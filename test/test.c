@@ -41,6 +41,19 @@ int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)]) {
     simde_ssse3_test_suite,
     simde_sse4_1_test_suite,
     simde_sse4_2_test_suite,
+    simde_avx_test_suite,
+    simde_avx2_test_suite,
+    simde_fma_test_suite,
+    simde_f16c_test_suite,
+    simde_aes_test_suite,
+    simde_clmul_test_suite,
+    simde_sha_test_suite,
+    simde_bmi_test_suite,
+    simde_bmi2_test_suite,
+    simde_popcnt_test_suite,
+    simde_lzcnt_test_suite,
+    simde_avx512f_test_suite,
+    simde_avx512vl_test_suite,
     { 0, },
   };
 
@@ -43,6 +43,19 @@ const MunitSuite simde_sse3_test_suite;
 const MunitSuite simde_ssse3_test_suite;
 const MunitSuite simde_sse4_1_test_suite;
 const MunitSuite simde_sse4_2_test_suite;
+const MunitSuite simde_avx_test_suite;
+const MunitSuite simde_avx2_test_suite;
+const MunitSuite simde_fma_test_suite;
+const MunitSuite simde_f16c_test_suite;
+const MunitSuite simde_aes_test_suite;
+const MunitSuite simde_clmul_test_suite;
+const MunitSuite simde_sha_test_suite;
+const MunitSuite simde_bmi_test_suite;
+const MunitSuite simde_bmi2_test_suite;
+const MunitSuite simde_popcnt_test_suite;
+const MunitSuite simde_lzcnt_test_suite;
+const MunitSuite simde_avx512f_test_suite;
+const MunitSuite simde_avx512vl_test_suite;
 
 #if defined(SIMDE__ENABLE_DEBUG_ARRAY)
 void debug_array_u8(const char* prefix, size_t nmemb, uint8_t v[HEDLEY_ARRAY_PARAM(nmemb)]);
@@ -220,6 +233,70 @@ simde_float64 random_f64_range(simde_float64 min, simde_float64 max);
   simde_assert_f32v_equal(simde_float64, 2, (simde_float64*) &(a), (simde_float64*) &(b), precision)
 #define simde_assert_m128d_f64_close(a, b, precision) \
   simde_assert_f32v_close(simde_float64, 2, (simde_float64*) &(a), (simde_float64*) &(b), precision)
+#define simde_assert_m128d_u64(a, op, b) \
+  simde_assert_typev(uint64_t, PRIu64, 2, (uint64_t*) &(a), op, (uint64_t*) &(b))
+
+#define simde_assert_m256_f32(a, op, b) \
+  simde_assert_typev(simde_float32, "f", 8, (simde_float32*) &(a), op, (simde_float32*) &(b))
+#define simde_assert_m256_f32_equal(a, b, precision) \
+  simde_assert_f32v_equal(simde_float32, 8, (simde_float32*) &(a), (simde_float32*) &(b), precision)
+#define simde_assert_m256_u32(a, op, b) \
+  simde_assert_typev(uint32_t, PRIu32, 8, (uint32_t*) &(a), op, (uint32_t*) &(b))
+
+#define simde_assert_m256d_f64(a, op, b) \
+  simde_assert_typev(simde_float64, "f", 4, (simde_float64*) &(a), op, (simde_float64*) &(b))
+#define simde_assert_m256d_f64_equal(a, b, precision) \
+  simde_assert_f32v_equal(simde_float64, 4, (simde_float64*) &(a), (simde_float64*) &(b), precision)
+#define simde_assert_m256d_u64(a, op, b) \
+  simde_assert_typev(uint64_t, PRIu64, 4, (uint64_t*) &(a), op, (uint64_t*) &(b))
+
+#define simde_assert_m256i_i8(a, op, b) \
+  simde_assert_typev(int8_t, PRId8, 32, (int8_t*) &(a), op, (int8_t*) &(b))
+#define simde_assert_m256i_u8(a, op, b) \
+  simde_assert_typev(uint8_t, PRIu8, 32, (uint8_t*) &(a), op, (uint8_t*) &(b))
+#define simde_assert_m256i_i16(a, op, b) \
+  simde_assert_typev(int16_t, PRId16, 16, (int16_t*) &(a), op, (int16_t*) &(b))
+#define simde_assert_m256i_u16(a, op, b) \
+  simde_assert_typev(uint16_t, PRIu16, 16, (uint16_t*) &(a), op, (uint16_t*) &(b))
+#define simde_assert_m256i_i32(a, op, b) \
+  simde_assert_typev(int32_t, PRId32, 8, (int32_t*) &(a), op, (int32_t*) &(b))
+#define simde_assert_m256i_u32(a, op, b) \
+  simde_assert_typev(uint32_t, PRIu32, 8, (uint32_t*) &(a), op, (uint32_t*) &(b))
+#define simde_assert_m256i_i64(a, op, b) \
+  simde_assert_typev(int64_t, PRId64, 4, (int64_t*) &(a), op, (int64_t*) &(b))
+#define simde_assert_m256i_u64(a, op, b) \
+  simde_assert_typev(uint64_t, PRIu64, 4, (uint64_t*) &(a), op, (uint64_t*) &(b))
+
+#define simde_assert_m512_f32(a, op, b) \
+  simde_assert_typev(simde_float32, "f", 16, (simde_float32*) &(a), op, (simde_float32*) &(b))
+#define simde_assert_m512_f32_equal(a, b, precision) \
+  simde_assert_f32v_equal(simde_float32, 16, (simde_float32*) &(a), (simde_float32*) &(b), precision)
+#define simde_assert_m512_u32(a, op, b) \
+  simde_assert_typev(uint32_t, PRIu32, 16, (uint32_t*) &(a), op, (uint32_t*) &(b))
+
+#define simde_assert_m512d_f64(a, op, b) \
+  simde_assert_typev(simde_float64, "f", 8, (simde_float64*) &(a), op, (simde_float64*) &(b))
+#define simde_assert_m512d_f64_equal(a, b, precision) \
+  simde_assert_f32v_equal(simde_float64, 8, (simde_float64*) &(a), (simde_float64*) &(b), precision)
+#define simde_assert_m512d_u64(a, op, b) \
+  simde_assert_typev(uint64_t, PRIu64, 8, (uint64_t*) &(a), op, (uint64_t*) &(b))
+
+#define simde_assert_m512i_i8(a, op, b) \
+  simde_assert_typev(int8_t, PRId8, 64, (int8_t*) &(a), op, (int8_t*) &(b))
+#define simde_assert_m512i_u8(a, op, b) \
+  simde_assert_typev(uint8_t, PRIu8, 64, (uint8_t*) &(a), op, (uint8_t*) &(b))
+#define simde_assert_m512i_i16(a, op, b) \
+  simde_assert_typev(int16_t, PRId16, 32, (int16_t*) &(a), op, (int16_t*) &(b))
+#define simde_assert_m512i_u16(a, op, b) \
+  simde_assert_typev(uint16_t, PRIu16, 32, (uint16_t*) &(a), op, (uint16_t*) &(b))
+#define simde_assert_m512i_i32(a, op, b) \
+  simde_assert_typev(int32_t, PRId32, 16, (int32_t*) &(a), op, (int32_t*) &(b))
+#define simde_assert_m512i_u32(a, op, b) \
+  simde_assert_typev(uint32_t, PRIu32, 16, (uint32_t*) &(a), op, (uint32_t*) &(b))
+#define simde_assert_m512i_i64(a, op, b) \
+  simde_assert_typev(int64_t, PRId64, 8, (int64_t*) &(a), op, (int64_t*) &(b))
+#define simde_assert_m512i_u64(a, op, b) \
+  simde_assert_typev(uint64_t, PRIu64, 8, (uint64_t*) &(a), op, (uint64_t*) &(b))
 
 /* SIMD floating-point conversion functions may or may not be the same
    as the normal FP conversion functions. */